@@ -99,6 +99,9 @@ struct fill_by_pos {
 /// @param ctx the geometry context
 struct bin_associator {
 
+    /// Number of threads that associate the grid bins
+    unsigned int n_threads{1u};
+
     template <typename detector_t, typename volume_type, typename grid_t,
               typename... Args>
     DETRAY_HOST auto operator()(grid_t &grid, detector_t &det,
@@ -120,7 +123,7 @@ struct bin_associator {
         // Fill the surfaces into the grid by matching their contour onto the
         // grid bins
         bin_association(ctx, surfaces, transforms, masks, grid, {0.1f, 0.1f},
-                        false);
+                        false, n_threads);
     }
 };
 
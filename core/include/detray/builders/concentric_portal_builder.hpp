@@ -0,0 +1,241 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/builders/volume_builder.hpp"
+#include "detray/builders/volume_builder_interface.hpp"
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/geometry.hpp"
+#include "detray/geometry/detector_volume.hpp"
+#include "detray/geometry/shapes/concentric_cylinder2D.hpp"
+#include "detray/geometry/shapes/cylinder2D.hpp"
+#include "detray/geometry/shapes/ring2D.hpp"
+#include "detray/geometry/surface.hpp"
+#include "detray/navigation/accelerators/concentric_portal_finder.hpp"
+
+// System include(s)
+#include <algorithm>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace detray {
+
+namespace detail {
+
+/// @brief Find out whether a portal is a cylinder or disc that is concentric
+/// around the beam axis.
+///
+/// @returns the shape category, the radius (cylinder) or z position (disc)
+/// and the lower z bound (cylinder) or inner radius (disc) of the portal
+struct concentric_portal_placement {
+
+    template <typename mask_group_t, typename index_t, typename transform3_t,
+              typename scalar_t>
+    DETRAY_HOST inline auto operator()(const mask_group_t &mask_group,
+                                       const index_t &index,
+                                       const transform3_t &trf,
+                                       const scalar_t tol) const
+        -> std::tuple<concentric_shape, scalar_t, scalar_t> {
+
+        using mask_t = typename mask_group_t::value_type;
+        using shape_t = typename mask_t::shape;
+
+        constexpr bool is_concentric_cylinder{
+            std::is_same_v<shape_t, concentric_cylinder2D>};
+        constexpr bool is_cylinder{std::is_same_v<shape_t, cylinder2D>};
+        constexpr bool is_ring{std::is_same_v<shape_t, ring2D>};
+
+        const auto &m = mask_group[index];
+        const auto t = trf.translation();
+        const auto z_axis = trf.z();
+
+        // Centered on the beam axis, and for cylinders and discs that can be
+        // rotated, aligned with it
+        const bool is_centered{math::abs(t[0]) < tol and
+                               math::abs(t[1]) < tol};
+        const bool is_aligned{math::abs(z_axis[0]) < tol and
+                              math::abs(z_axis[1]) < tol};
+
+        if constexpr (is_concentric_cylinder or is_cylinder) {
+            if (is_centered and (is_concentric_cylinder or is_aligned)) {
+                const scalar_t z_sign{
+                    is_concentric_cylinder or z_axis[2] > 0.f ? 1.f : -1.f};
+                const scalar_t z0{t[2] + z_sign * m[shape_t::e_n_half_z]};
+                const scalar_t z1{t[2] + z_sign * m[shape_t::e_p_half_z]};
+
+                return {concentric_shape::e_cylinder, m[shape_t::e_r],
+                        math::min(z0, z1)};
+            }
+        } else if constexpr (is_ring) {
+            if (is_centered and is_aligned) {
+                return {concentric_shape::e_disc, t[2],
+                        m[shape_t::e_inner_r]};
+            }
+        }
+
+        return {concentric_shape::e_other, 0.f, 0.f};
+    }
+};
+
+}  // namespace detail
+
+/// @brief Index the portals of a cylinder volume by their radius and z
+/// position.
+///
+/// Decorator class to a volume builder that replaces the brute force search
+/// of the portals and passive surfaces of a cylinder volume with a
+/// concentric portal collection. The index is only added, if all portal
+/// cylinders and discs are concentric around the beam axis and lie on at
+/// most two different radii and z positions, respectively. Otherwise, the
+/// volume keeps the brute force search.
+///
+/// @tparam detector_t the detector type
+/// @tparam portal_collection_t the type of the concentric portal collection
+///                             in the detector accelerator store
+template <typename detector_t, typename portal_collection_t>
+class concentric_portal_builder : public volume_decorator<detector_t> {
+
+    using link_id_t = typename detector_t::volume_type::object_id;
+    using shape_t = detail::concentric_shape;
+
+    public:
+    using scalar_type = typename detector_t::scalar_type;
+    using detector_type = detector_t;
+    using value_type = typename detector_type::surface_type;
+
+    /// Decorate a volume with a concentric portal index
+    DETRAY_HOST
+    explicit concentric_portal_builder(
+        std::unique_ptr<volume_builder_interface<detector_t>> vol_builder)
+        : volume_decorator<detector_t>(std::move(vol_builder)) {}
+
+    /// Set the tolerance to decide whether a portal is concentric and
+    /// whether two portals lie at the same radius or z position
+    void set_tolerance(const scalar_type tol) { m_tol = tol; }
+
+    /// @returns whether the last volume that was built got the index
+    bool is_indexed() const { return m_is_indexed; }
+
+    /// Add the volume and the portal index to the detector @param det
+    DETRAY_HOST
+    auto build(detector_t &det, typename detector_t::geometry_context ctx = {})
+        -> typename detector_t::volume_type * override {
+
+        // Add the volume with the brute force search for the portals
+        typename detector_t::volume_type *vol_ptr =
+            volume_decorator<detector_t>::build(det, ctx);
+
+        m_is_indexed = false;
+        if (vol_ptr->id() != volume_id::e_cylinder) {
+            return vol_ptr;
+        }
+
+        const auto vol = detector_volume{det, *vol_ptr};
+
+        // Same surfaces as in the brute force search of the volume
+        std::vector<value_type> surfaces{};
+        std::vector<shape_t> shapes{};
+        std::vector<scalar_type> positions{};
+        std::vector<scalar_type> lower{};
+        for (const auto &sf_desc : vol.surfaces()) {
+            if (this->has_accel() and sf_desc.is_sensitive()) {
+                continue;
+            }
+
+            shape_t shape{shape_t::e_other};
+            scalar_type pos{0.f};
+            scalar_type low{0.f};
+            if (sf_desc.is_portal()) {
+                const auto &trf =
+                    det.transform_store().at(sf_desc.transform(), ctx);
+                std::tie(shape, pos, low) =
+                    detray::surface{det, sf_desc}
+                        .template visit_mask<
+                            detail::concentric_portal_placement>(trf, m_tol);
+            }
+
+            surfaces.push_back(sf_desc);
+            shapes.push_back(shape);
+            positions.push_back(pos);
+            lower.push_back(low);
+        }
+
+        if (n_positions(shapes, positions, shape_t::e_cylinder) > 2u or
+            n_positions(shapes, positions, shape_t::e_disc) > 2u) {
+            return vol_ptr;
+        }
+
+        // Snap the positions that lie within tolerance of each other, so
+        // that they are sorted into the same boundary
+        snap(shapes, positions, shape_t::e_cylinder);
+        snap(shapes, positions, shape_t::e_disc);
+
+        // Add the index to the detector and link it to the volume, instead
+        // of the brute force search
+        constexpr auto pid{detector_t::accel::template get_id<
+            typename portal_collection_t::value_type>()};
+        auto &portal_coll = det.accelerator_store().template get<pid>();
+        portal_coll.push_back(surfaces, shapes, positions, lower);
+        vol_ptr->set_link(link_id_t::e_portal, pid, portal_coll.size() - 1u);
+
+        m_is_indexed = true;
+
+        return vol_ptr;
+    }
+
+    private:
+    /// @returns the number of distinct positions of the portals of shape
+    /// @param shape
+    std::size_t n_positions(const std::vector<shape_t> &shapes,
+                            const std::vector<scalar_type> &positions,
+                            const shape_t shape) const {
+        std::vector<scalar_type> distinct{};
+        for (std::size_t i = 0u; i < shapes.size(); ++i) {
+            if (shapes[i] != shape) {
+                continue;
+            }
+            const bool is_new{std::none_of(
+                distinct.begin(), distinct.end(), [&](const scalar_type p) {
+                    return math::abs(p - positions[i]) < m_tol;
+                })};
+            if (is_new) {
+                distinct.push_back(positions[i]);
+            }
+        }
+        return distinct.size();
+    }
+
+    /// Set the positions of the portals of shape @param shape that lie
+    /// within tolerance to the same value
+    void snap(const std::vector<shape_t> &shapes,
+              std::vector<scalar_type> &positions, const shape_t shape) const {
+        for (std::size_t i = 0u; i < shapes.size(); ++i) {
+            if (shapes[i] != shape) {
+                continue;
+            }
+            for (std::size_t j = 0u; j < i; ++j) {
+                if (shapes[j] == shape and
+                    math::abs(positions[j] - positions[i]) < m_tol) {
+                    positions[i] = positions[j];
+                    break;
+                }
+            }
+        }
+    }
+
+    /// Tolerance for the portal placements
+    scalar_type m_tol{1e-4f};
+    /// Whether the last volume got the portal index
+    bool m_is_indexed{false};
+};
+
+}  // namespace detray
@@ -15,40 +15,267 @@
 #include "detray/geometry/coordinates/cylindrical2D.hpp"
 #include "detray/geometry/coordinates/polar2D.hpp"
 #include "detray/geometry/detail/vertexing.hpp"
+#include "detray/propagator/parallel_executor.hpp"
 #include "detray/utils/grid/populators.hpp"
 #include "detray/utils/ranges.hpp"
 
 // System include(s)
+#include <algorithm>
 #include <array>
+#include <limits>
+#include <type_traits>
 #include <vector>
 
 namespace detray::detail {
 
-/// Run the bin association of surfaces (via their contour) to a given 2D grid.
+/// Contour of a surface (or of a part of it) in the 2D frame in which it is
+/// compared to the grid bins, and its extent along the two grid axes.
+template <typename point2_t>
+struct surface_contour {
+    std::vector<point2_t> points{};
+    /// Lower and upper extent along the first and second grid axis
+    std::array<std::array<scalar, 2>, 2> extent{
+        {{-std::numeric_limits<scalar>::max(),
+          std::numeric_limits<scalar>::max()},
+         {-std::numeric_limits<scalar>::max(),
+          std::numeric_limits<scalar>::max()}}};
+};
+
+/// @returns the minimal distance of the line segment between @param a and
+/// @param b to the origin
+template <typename point2_t>
+inline scalar distance_to_origin(const point2_t &a, const point2_t &b) {
+    const point2_t ab{b[0] - a[0], b[1] - a[1]};
+    const scalar len2{ab[0] * ab[0] + ab[1] * ab[1]};
+    scalar t{0.f};
+    if (len2 > 0.f) {
+        t = math::min(scalar{1.f},
+                      math::max(scalar{0.f},
+                                -(a[0] * ab[0] + a[1] * ab[1]) / len2));
+    }
+    const scalar x{a[0] + t * ab[0]};
+    const scalar y{a[1] + t * ab[1]};
+    return math::sqrt(x * x + y * y);
+}
+
+/// Set the radial and azimuthal extent of the convex hull of a cartesian
+/// surface contour @param c , which contains all of its points that can be
+/// associated to a disc grid bin
+template <typename point2_t>
+inline void set_polar_extent(surface_contour<point2_t> &c) {
+
+    const auto &pts = c.points;
+
+    scalar r_max{0.f};
+    std::vector<scalar> phis{};
+    phis.reserve(pts.size());
+    for (const point2_t &p : pts) {
+        r_max = math::max(r_max, math::sqrt(p[0] * p[0] + p[1] * p[1]));
+        phis.push_back(math::atan2(p[1], p[0]));
+    }
+    std::sort(phis.begin(), phis.end());
+
+    // Largest angular gap between the points (including the wrap around)
+    scalar max_gap{phis.front() + 2.f * constant<scalar>::pi - phis.back()};
+    scalar phi_start{phis.front()};
+    for (std::size_t i = 1u; i < phis.size(); ++i) {
+        if (phis[i] - phis[i - 1u] > max_gap) {
+            max_gap = phis[i] - phis[i - 1u];
+            phi_start = phis[i];
+        }
+    }
+
+    c.extent[0][1] = r_max;
+
+    // The origin is inside the hull: Full azimuthal range
+    if (max_gap <= constant<scalar>::pi) {
+        c.extent[0][0] = 0.f;
+        return;
+    }
+
+    // Otherwise the closest point of the hull lies on a segment between two
+    // of the points
+    scalar r_min{r_max};
+    for (std::size_t i = 0u; i < pts.size(); ++i) {
+        for (std::size_t j = i; j < pts.size(); ++j) {
+            r_min = math::min(r_min, distance_to_origin(pts[i], pts[j]));
+        }
+    }
+    c.extent[0][0] = r_min;
+    c.extent[1] = {phi_start,
+                   phi_start + 2.f * constant<scalar>::pi - max_gap};
+}
+
+/// Generate the contours of a surface in the frame in which they are
+/// compared to the bins of a 2D grid: cartesian for disc grids and (z, phi)
+/// for cylinder grids, where the contour is split at phi = +/- pi.
 ///
-/// @param context is the context to win which the association is done
-/// @param surfaces a range of detector surfaces
+/// @param sf the surface descriptor
 /// @param transforms the transforms that belong to the surfaces
 /// @param surface_masks the masks that belong to the surfaces
-/// @param grid either a cylinder or disc grid to be filled
-/// @param tolerance is the bin_tolerance in the two local coordinates
-/// @param absolute_tolerance is an indicator if the tolerance is to be
-///        taken absolute or relative
-template <typename context_t, typename surface_container_t,
-          typename transform_container_t, typename mask_container_t,
-          typename grid_t, std::enable_if_t<grid_t::dim == 2, bool> = true>
-static inline void bin_association(const context_t & /*context*/,
-                                   const surface_container_t &surfaces,
-                                   const transform_container_t &transforms,
-                                   const mask_container_t &surface_masks,
-                                   grid_t &grid,
-                                   const std::array<scalar, 2> &bin_tolerance,
-                                   bool absolute_tolerance = true) {
+///
+/// @returns the contours and their extent along the grid axes
+template <typename grid_t, typename surface_t, typename transform_container_t,
+          typename mask_container_t>
+inline auto get_surface_contours(const surface_t &sf,
+                                 const transform_container_t &transforms,
+                                 const mask_container_t &surface_masks) {
 
     using algebra_t = typename grid_t::local_frame_type::algebra_type;
     using point2_t = dpoint2D<algebra_t>;
     using point3_t = dpoint3D<algebra_t>;
 
+    std::vector<surface_contour<point2_t>> contours{};
+
+    // Unroll the mask container and generate vertices
+    const auto &transform = transforms[sf.transform()];
+
+    auto vertices_per_masks = surface_masks.template visit<
+        detail::vertexer<point2_t, point3_t>>(sf.mask());
+
+    // Disk type bin association
+    if constexpr (std::is_same_v<typename grid_t::local_frame_type,
+                                 polar2D<algebra_t>>) {
+
+        // Usually one mask per surface, but design allows
+        for (auto &vertices : vertices_per_masks) {
+            if (not vertices.empty()) {
+                // Create a surface contour
+                surface_contour<point2_t> c{};
+                c.points.reserve(vertices.size());
+                for (const auto &v : vertices) {
+                    auto vg = transform.point_to_global(v);
+                    c.points.push_back({vg[0], vg[1]});
+                }
+                set_polar_extent(c);
+                contours.push_back(std::move(c));
+            }
+        }
+    } else if constexpr (std::is_same_v<typename grid_t::local_frame_type,
+                                        cylindrical2D<algebra_t>> ||
+                         std::is_same_v<typename grid_t::local_frame_type,
+                                        concentric_cylindrical2D<algebra_t>>) {
+
+        for (auto &vertices : vertices_per_masks) {
+
+            if (not vertices.empty()) {
+                // Create a surface contour
+                std::vector<point2_t> surface_contour;
+                surface_contour.reserve(vertices.size());
+                scalar phi_min = std::numeric_limits<scalar>::max();
+                scalar phi_max = -std::numeric_limits<scalar>::max();
+                // We poentially need the split vertices
+                std::vector<point2_t> s_c_neg;
+                std::vector<point2_t> s_c_pos;
+                scalar z_min_neg = std::numeric_limits<scalar>::max();
+                scalar z_max_neg = -std::numeric_limits<scalar>::max();
+                scalar z_min_pos = std::numeric_limits<scalar>::max();
+                scalar z_max_pos = -std::numeric_limits<scalar>::max();
+
+                for (const auto &v : vertices) {
+                    const point3_t vg = transform.point_to_global(v);
+                    scalar phi = math::atan2(vg[1], vg[0]);
+                    phi_min = math::min(phi, phi_min);
+                    phi_max = math::max(phi, phi_max);
+                    surface_contour.push_back({vg[2], phi});
+                    if (phi < 0.) {
+                        s_c_neg.push_back({vg[2], phi});
+                        z_min_neg = math::min(vg[2], z_min_neg);
+                        z_max_neg = math::max(vg[2], z_max_neg);
+                    } else {
+                        s_c_pos.push_back({vg[2], phi});
+                        z_min_pos = math::min(vg[2], z_min_pos);
+                        z_max_pos = math::max(vg[2], z_max_pos);
+                    }
+                }
+                // Check for phi wrapping
+                std::vector<std::vector<point2_t>> surface_contours;
+                if (phi_max - phi_min > constant<scalar>::pi and
+                    phi_max * phi_min < 0.) {
+                    s_c_neg.push_back({z_max_neg, -constant<scalar>::pi});
+                    s_c_neg.push_back({z_min_neg, -constant<scalar>::pi});
+                    s_c_pos.push_back({z_max_pos, constant<scalar>::pi});
+                    s_c_pos.push_back({z_min_pos, constant<scalar>::pi});
+                    surface_contours = {s_c_neg, s_c_pos};
+                } else {
+                    surface_contours = {surface_contour};
+                }
+
+                // The contours are compared to the bins in the same frame
+                for (auto &s_c : surface_contours) {
+                    surface_contour<point2_t> c{};
+                    c.extent[0] = {std::numeric_limits<scalar>::max(),
+                                   -std::numeric_limits<scalar>::max()};
+                    c.extent[1] = c.extent[0];
+                    for (const point2_t &p : s_c) {
+                        for (unsigned int i = 0u; i < 2u; ++i) {
+                            c.extent[i][0] = math::min(c.extent[i][0], p[i]);
+                            c.extent[i][1] = math::max(c.extent[i][1], p[i]);
+                        }
+                    }
+                    c.points = std::move(s_c);
+                    contours.push_back(std::move(c));
+                }
+            }
+        }
+    }
+
+    return contours;
+}
+
+/// @returns the edges of all bins of the grid axis @param axis (lower bin
+/// edges plus the upper edge of the last bin)
+template <typename axis_t>
+inline std::vector<scalar> get_bin_edges(const axis_t &axis) {
+    std::vector<scalar> edges{};
+    edges.reserve(axis.nbins() + 1u);
+    for (unsigned int b = 0u; b < axis.nbins(); ++b) {
+        edges.push_back(axis.bin_edges(b)[0]);
+    }
+    edges.push_back(axis.bin_edges(axis.nbins() - 1u)[1]);
+    return edges;
+}
+
+/// @returns the first and last bin with an upper edge above @param lower and
+/// a lower edge below @param upper (first > last, if there is none)
+inline std::array<int, 2> get_bin_range(const std::vector<scalar> &edges,
+                                        const scalar lower,
+                                        const scalar upper) {
+    const auto first{static_cast<int>(
+        std::lower_bound(edges.begin() + 1, edges.end(), lower) -
+        (edges.begin() + 1))};
+    const auto last{static_cast<int>(
+                        std::upper_bound(edges.begin(), edges.end() - 1,
+                                         upper) -
+                        edges.begin()) -
+                    1};
+    return {first, last};
+}
+
+/// Find the surfaces (via their contour) that are associated with a single
+/// bin of a 2D grid.
+///
+/// @param surfaces the candidate surfaces for the bin
+/// @param contours the contours of the candidate surfaces
+/// @param grid either a cylinder or disc grid (is not filled)
+/// @param bin_0 the local bin index on the first grid axis
+/// @param bin_1 the local bin index on the second grid axis
+/// @param bin_tolerance is the bin_tolerance in the two local coordinates
+/// @param absolute_tolerance is an indicator if the tolerance is to be
+///        taken absolute or relative
+/// @param result collects the associated surfaces
+template <typename surface_t, typename point2_t, typename grid_t,
+          typename result_t, std::enable_if_t<grid_t::dim == 2, bool> = true>
+inline void associate_bin(
+    const std::vector<const surface_t *> &surfaces,
+    const std::vector<const std::vector<surface_contour<point2_t>> *>
+        &contours,
+    const grid_t &grid, const unsigned int bin_0, const unsigned int bin_1,
+    const std::array<scalar, 2> &bin_tolerance, const bool absolute_tolerance,
+    result_t &result) {
+
+    using algebra_t = typename grid_t::local_frame_type::algebra_type;
+
     const auto &axis_0 = grid.template get_axis<0>();
     const auto &axis_1 = grid.template get_axis<1>();
 
@@ -60,62 +287,32 @@ static inline void bin_association(const context_t & /*context*/,
         center_of_gravity_generic cgs_assoc;
         edges_intersect_generic edges_assoc;
 
-        // Loop over all bins and associate the surfaces
-        for (unsigned int bin_0 = 0; bin_0 < axis_0.nbins(); ++bin_0) {
-            for (unsigned int bin_1 = 0; bin_1 < axis_1.nbins(); ++bin_1) {
-
-                auto r_borders = axis_0.bin_edges(bin_0);
-                auto phi_borders = axis_1.bin_edges(bin_1);
-
-                scalar r_add =
-                    absolute_tolerance
-                        ? bin_tolerance[0]
-                        : bin_tolerance[0] * (r_borders[1] - r_borders[0]);
-                scalar phi_add =
-                    absolute_tolerance
-                        ? bin_tolerance[1]
-                        : bin_tolerance[1] * (phi_borders[1] - phi_borders[0]);
-
-                // Create a contour for the bin
-                std::vector<point2_t> bin_contour =
-                    detail::r_phi_polygon<scalar, point2_t>(
-                        r_borders[0] - r_add, r_borders[1] + r_add,
-                        phi_borders[0] - phi_add, phi_borders[1] + phi_add);
-
-                // Run through the surfaces and associate them by contour
-                for (auto sf : surfaces) {
-
-                    // Add only sensitive surfaces to the grid
-                    if (sf.is_portal()) {
-                        continue;
-                    }
-
-                    // Unroll the mask container and generate vertices
-                    const auto &transform = transforms[sf.transform()];
-
-                    auto vertices_per_masks = surface_masks.template visit<
-                        detail::vertexer<point2_t, point3_t>>(sf.mask());
-
-                    // Usually one mask per surface, but design allows - a
-                    // single association  is sufficient though
-                    for (auto &vertices : vertices_per_masks) {
-                        if (not vertices.empty()) {
-                            // Create a surface contour
-                            std::vector<point2_t> surface_contour;
-                            surface_contour.reserve(vertices.size());
-                            for (const auto &v : vertices) {
-                                auto vg = transform.point_to_global(v);
-                                surface_contour.push_back({vg[0], vg[1]});
-                            }
-                            // The association has worked
-                            if (cgs_assoc(bin_contour, surface_contour) or
-                                edges_assoc(bin_contour, surface_contour)) {
-                                grid.template populate<attach<>>({bin_0, bin_1},
-                                                                 sf);
-                                break;
-                            }
-                        }
-                    }
+        auto r_borders = axis_0.bin_edges(bin_0);
+        auto phi_borders = axis_1.bin_edges(bin_1);
+
+        scalar r_add = absolute_tolerance
+                           ? bin_tolerance[0]
+                           : bin_tolerance[0] * (r_borders[1] - r_borders[0]);
+        scalar phi_add =
+            absolute_tolerance
+                ? bin_tolerance[1]
+                : bin_tolerance[1] * (phi_borders[1] - phi_borders[0]);
+
+        // Create a contour for the bin
+        std::vector<point2_t> bin_contour =
+            detail::r_phi_polygon<scalar, point2_t>(
+                r_borders[0] - r_add, r_borders[1] + r_add,
+                phi_borders[0] - phi_add, phi_borders[1] + phi_add);
+
+        // Run through the surfaces and associate them by contour: a single
+        // association is sufficient
+        for (std::size_t i = 0u; i < surfaces.size(); ++i) {
+            for (const auto &c : *contours[i]) {
+                // The association has worked
+                if (cgs_assoc(bin_contour, c.points) or
+                    edges_assoc(bin_contour, c.points)) {
+                    result.push_back(*surfaces[i]);
+                    break;
                 }
             }
         }
@@ -127,127 +324,226 @@ static inline void bin_association(const context_t & /*context*/,
         center_of_gravity_rectangle cgs_assoc;
         edges_intersect_generic edges_assoc;
 
-        // Loop over all bins and associate the surfaces
-        for (unsigned int bin_0 = 0; bin_0 < axis_0.nbins(); ++bin_0) {
-            for (unsigned int bin_1 = 0; bin_1 < axis_1.nbins(); ++bin_1) {
-
-                auto z_borders = axis_0.bin_edges(bin_0);
-                auto phi_borders = axis_1.bin_edges(bin_1);
-
-                scalar z_add =
-                    absolute_tolerance
-                        ? bin_tolerance[0]
-                        : bin_tolerance[0] * (z_borders[1] - z_borders[0]);
-                scalar phi_add =
-                    absolute_tolerance
-                        ? bin_tolerance[1]
-                        : bin_tolerance[1] * (phi_borders[1] - phi_borders[0]);
-
-                scalar z_min = z_borders[0];
-                scalar z_max = z_borders[1];
-                scalar phi_min_rep = phi_borders[0];
-                scalar phi_max_rep = phi_borders[1];
-
-                point2_t p0_bin = {z_min - z_add, phi_min_rep - phi_add};
-                point2_t p1_bin = {z_min - z_add, phi_max_rep + phi_add};
-                point2_t p2_bin = {z_max + z_add, phi_max_rep + phi_add};
-                point2_t p3_bin = {z_max + z_add, phi_min_rep - phi_add};
-
-                std::vector<point2_t> bin_contour = {p0_bin, p1_bin, p2_bin,
-                                                     p3_bin};
-
-                // Loop over the surfaces within a volume
-                for (auto sf : surfaces) {
-
-                    // Add only sensitive surfaces to the grid
-                    if (sf.is_portal()) {
-                        continue;
+        auto z_borders = axis_0.bin_edges(bin_0);
+        auto phi_borders = axis_1.bin_edges(bin_1);
+
+        scalar z_add = absolute_tolerance
+                           ? bin_tolerance[0]
+                           : bin_tolerance[0] * (z_borders[1] - z_borders[0]);
+        scalar phi_add =
+            absolute_tolerance
+                ? bin_tolerance[1]
+                : bin_tolerance[1] * (phi_borders[1] - phi_borders[0]);
+
+        scalar z_min = z_borders[0];
+        scalar z_max = z_borders[1];
+        scalar phi_min_rep = phi_borders[0];
+        scalar phi_max_rep = phi_borders[1];
+
+        point2_t p0_bin = {z_min - z_add, phi_min_rep - phi_add};
+        point2_t p1_bin = {z_min - z_add, phi_max_rep + phi_add};
+        point2_t p2_bin = {z_max + z_add, phi_max_rep + phi_add};
+        point2_t p3_bin = {z_max + z_add, phi_min_rep - phi_add};
+
+        std::vector<point2_t> bin_contour = {p0_bin, p1_bin, p2_bin, p3_bin};
+
+        // Check the association (with potential splits)
+        for (std::size_t i = 0u; i < surfaces.size(); ++i) {
+            for (const auto &c : *contours[i]) {
+                // Register if associated
+                if (cgs_assoc(bin_contour, c.points) or
+                    edges_assoc(bin_contour, c.points)) {
+                    result.push_back(*surfaces[i]);
+                    break;
+                }
+            }
+        }
+    }
+}
+
+/// Run the bin association of surfaces (via their contour) to a given 2D grid.
+///
+/// The surface contours are generated once and their extent along the grid
+/// axes is translated into a range of candidate bins per axis, so that the
+/// exact contour test only runs for the bins that a surface can overlap
+/// (the pre-filter is conservative w.r.t. the bin tolerances).
+///
+/// The association of the bins is independent and can be distributed over
+/// several threads: Every worker stages the surfaces of the bins it handles
+/// and the staged surfaces are filled into the grid afterwards, in the same
+/// order as for the single threaded association.
+///
+/// @param context is the context to win which the association is done
+/// @param surfaces a range of detector surfaces
+/// @param transforms the transforms that belong to the surfaces
+/// @param surface_masks the masks that belong to the surfaces
+/// @param grid either a cylinder or disc grid to be filled
+/// @param tolerance is the bin_tolerance in the two local coordinates
+/// @param absolute_tolerance is an indicator if the tolerance is to be
+///        taken absolute or relative
+/// @param n_threads number of threads for the association
+/// @param prefilter test only the candidate bins of a surface (otherwise
+///        every surface is tested against every bin)
+template <typename context_t, typename surface_container_t,
+          typename transform_container_t, typename mask_container_t,
+          typename grid_t, std::enable_if_t<grid_t::dim == 2, bool> = true>
+static inline void bin_association(const context_t & /*context*/,
+                                   const surface_container_t &surfaces,
+                                   const transform_container_t &transforms,
+                                   const mask_container_t &surface_masks,
+                                   grid_t &grid,
+                                   const std::array<scalar, 2> &bin_tolerance,
+                                   bool absolute_tolerance = true,
+                                   const unsigned int n_threads = 1u,
+                                   const bool prefilter = true) {
+
+    using surface_t = detray::ranges::range_value_t<surface_container_t>;
+    using algebra_t = typename grid_t::local_frame_type::algebra_type;
+    using point2_t = dpoint2D<algebra_t>;
+    using contours_t = std::vector<surface_contour<point2_t>>;
+
+    constexpr bool is_disc{std::is_same_v<typename grid_t::local_frame_type,
+                                          polar2D<algebra_t>>};
+
+    const unsigned int n_bins_0{grid.template get_axis<0>().nbins()};
+    const unsigned int n_bins_1{grid.template get_axis<1>().nbins()};
+
+    // Add only sensitive surfaces to the grid and generate their contours
+    std::vector<surface_t> sf_descs{};
+    std::vector<contours_t> sf_contours{};
+    for (const auto &sf : surfaces) {
+        if (!sf.is_portal()) {
+            sf_descs.push_back(sf);
+            sf_contours.push_back(get_surface_contours<grid_t>(
+                sf, transforms, surface_masks));
+        }
+    }
+
+    // Bin edges and the largest tolerance per axis
+    const std::array<std::vector<scalar>, 2> edges{
+        get_bin_edges(grid.template get_axis<0>()),
+        get_bin_edges(grid.template get_axis<1>())};
+
+    std::array<scalar, 2> add{bin_tolerance};
+    if (!absolute_tolerance) {
+        for (unsigned int i = 0u; i < 2u; ++i) {
+            scalar max_width{0.f};
+            for (std::size_t b = 1u; b < edges[i].size(); ++b) {
+                max_width =
+                    math::max(max_width, edges[i][b] - edges[i][b - 1u]);
+            }
+            add[i] *= max_width;
+        }
+    }
+
+    // The radial chords of the disc bin contours come closer to the origin
+    // than the inner bin edge, by at most this factor. Without a finite
+    // phi extent, or with negative radii, the phi range is not restricted
+    scalar r_scale{1.f};
+    bool filter_phi{true};
+    if constexpr (is_disc) {
+        for (std::size_t b = 1u; b < edges[1].size(); ++b) {
+            const scalar dphi{edges[1][b] - edges[1][b - 1u] + 2.f * add[1]};
+            r_scale =
+                dphi < constant<scalar>::pi
+                    ? math::min(r_scale, static_cast<scalar>(math::cos(
+                                             0.5f * dphi)))
+                    : 0.f;
+        }
+        filter_phi = r_scale > 0.f and edges[0].front() - add[0] > 0.f;
+    }
+
+    // Candidate surfaces per bin, in the order of the surfaces
+    std::vector<std::vector<dindex>> candidates(n_bins_0 * n_bins_1);
+    for (dindex s = 0u; s < sf_descs.size(); ++s) {
+        for (const auto &c : sf_contours[s]) {
+
+            std::array<int, 2> range_0{0, static_cast<int>(n_bins_0) - 1};
+            std::vector<std::array<int, 2>> ranges_1{
+                {0, static_cast<int>(n_bins_1) - 1}};
+
+            if (prefilter) {
+                const scalar upper_0{
+                    r_scale > 0.f ? c.extent[0][1] / r_scale + add[0]
+                                  : std::numeric_limits<scalar>::max()};
+                range_0 =
+                    get_bin_range(edges[0], c.extent[0][0] - add[0], upper_0);
+
+                if (filter_phi) {
+                    ranges_1.clear();
+                    // Disc bins contours wrap around in phi
+                    const int n_shifts{is_disc ? 1 : 0};
+                    for (int k = -n_shifts; k <= n_shifts; ++k) {
+                        const scalar shift{static_cast<scalar>(k) * 2.f *
+                                           constant<scalar>::pi};
+                        ranges_1.push_back(get_bin_range(
+                            edges[1], c.extent[1][0] + shift - add[1],
+                            c.extent[1][1] + shift + add[1]));
                     }
+                }
+            }
 
-                    // Unroll the mask container and generate vertices
-                    const auto &transform = transforms[sf.transform()];
-
-                    auto vertices_per_masks = surface_masks.template visit<
-                        detail::vertexer<point2_t, point3_t>>(sf.mask());
-
-                    for (auto &vertices : vertices_per_masks) {
-
-                        if (not vertices.empty()) {
-                            // Create a surface contour
-                            std::vector<point2_t> surface_contour;
-                            surface_contour.reserve(vertices.size());
-                            scalar phi_min = std::numeric_limits<scalar>::max();
-                            scalar phi_max =
-                                -std::numeric_limits<scalar>::max();
-                            // We poentially need the split vertices
-                            std::vector<point2_t> s_c_neg;
-                            std::vector<point2_t> s_c_pos;
-                            scalar z_min_neg =
-                                std::numeric_limits<scalar>::max();
-                            scalar z_max_neg =
-                                -std::numeric_limits<scalar>::max();
-                            scalar z_min_pos =
-                                std::numeric_limits<scalar>::max();
-                            scalar z_max_pos =
-                                -std::numeric_limits<scalar>::max();
-
-                            for (const auto &v : vertices) {
-                                const point3_t vg =
-                                    transform.point_to_global(v);
-                                scalar phi = math::atan2(vg[1], vg[0]);
-                                phi_min = math::min(phi, phi_min);
-                                phi_max = math::max(phi, phi_max);
-                                surface_contour.push_back({vg[2], phi});
-                                if (phi < 0.) {
-                                    s_c_neg.push_back({vg[2], phi});
-                                    z_min_neg = math::min(vg[2], z_min_neg);
-                                    z_max_neg = math::max(vg[2], z_max_neg);
-                                } else {
-                                    s_c_pos.push_back({vg[2], phi});
-                                    z_min_pos = math::min(vg[2], z_min_pos);
-                                    z_max_pos = math::max(vg[2], z_max_pos);
-                                }
-                            }
-                            // Check for phi wrapping
-                            std::vector<std::vector<point2_t>> surface_contours;
-                            if (phi_max - phi_min > constant<scalar>::pi and
-                                phi_max * phi_min < 0.) {
-                                s_c_neg.push_back(
-                                    {z_max_neg, -constant<scalar>::pi});
-                                s_c_neg.push_back(
-                                    {z_min_neg, -constant<scalar>::pi});
-                                s_c_pos.push_back(
-                                    {z_max_pos, constant<scalar>::pi});
-                                s_c_pos.push_back(
-                                    {z_min_pos, constant<scalar>::pi});
-                                surface_contours = {s_c_neg, s_c_pos};
-                            } else {
-                                surface_contours = {surface_contour};
-                            }
-
-                            // Check the association (with potential splits)
-                            bool associated = false;
-                            for (const auto &s_c : surface_contours) {
-                                if (cgs_assoc(bin_contour, s_c) or
-                                    edges_assoc(bin_contour, s_c)) {
-                                    associated = true;
-                                    break;
-                                }
-                            }
-
-                            // Register if associated
-                            if (associated) {
-                                typename grid_t::loc_bin_index mbin{bin_0,
-                                                                    bin_1};
-                                grid.template populate<attach<>>(mbin, sf);
-                                break;
-                            }
+            for (int b0 = std::max(range_0[0], 0);
+                 b0 <= std::min(range_0[1], static_cast<int>(n_bins_0) - 1);
+                 ++b0) {
+                for (const auto &range_1 : ranges_1) {
+                    for (int b1 = std::max(range_1[0], 0);
+                         b1 <= std::min(range_1[1],
+                                        static_cast<int>(n_bins_1) - 1);
+                         ++b1) {
+                        auto &cand = candidates[static_cast<dindex>(b0) *
+                                                    n_bins_1 +
+                                                static_cast<dindex>(b1)];
+                        if (cand.empty() or cand.back() != s) {
+                            cand.push_back(s);
                         }
                     }
                 }
             }
         }
     }
+
+    // Staged surfaces per bin (every bin is handled by exactly one thread)
+    std::vector<std::vector<surface_t>> staged(n_bins_0 * n_bins_1);
+
+    // Associate all bins in a row of the first axis
+    auto associate_row = [&](const unsigned int bin_0) {
+        std::vector<const surface_t *> bin_sfs{};
+        std::vector<const contours_t *> bin_contours{};
+
+        for (unsigned int bin_1 = 0u; bin_1 < n_bins_1; ++bin_1) {
+            const dindex gbin{bin_0 * n_bins_1 + bin_1};
+
+            bin_sfs.clear();
+            bin_contours.clear();
+            for (const dindex s : candidates[gbin]) {
+                bin_sfs.push_back(&sf_descs[s]);
+                bin_contours.push_back(&sf_contours[s]);
+            }
+
+            associate_bin(bin_sfs, bin_contours, grid, bin_0, bin_1,
+                          bin_tolerance, absolute_tolerance, staged[gbin]);
+        }
+    };
+
+    if (n_threads <= 1u) {
+        for (unsigned int bin_0 = 0u; bin_0 < n_bins_0; ++bin_0) {
+            associate_row(bin_0);
+        }
+    } else {
+        const propagation::parallel_executor exec{n_threads, 1u};
+        exec(n_bins_0, associate_row);
+    }
+
+    // Merge the staged surfaces into the grid
+    for (unsigned int bin_0 = 0u; bin_0 < n_bins_0; ++bin_0) {
+        for (unsigned int bin_1 = 0u; bin_1 < n_bins_1; ++bin_1) {
+            typename grid_t::loc_bin_index mbin{bin_0, bin_1};
+            for (const surface_t &sf : staged[bin_0 * n_bins_1 + bin_1]) {
+                grid.template populate<attach<>>(mbin, sf);
+            }
+        }
+    }
 }
 
 }  // namespace detray::detail
@@ -0,0 +1,207 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/builders/bin_fillers.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/materials/material_slab.hpp"
+
+// System include(s)
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace detray::detail {
+
+/// @returns whether two values agree within the relative tolerance @param tol
+template <typename scalar_t>
+DETRAY_HOST inline bool is_within_tolerance(const scalar_t a, const scalar_t b,
+                                            const scalar_t tol) {
+    return math::fabs(a - b) <= tol * math::max(math::fabs(a), math::fabs(b));
+}
+
+/// @returns whether the material slabs @param a and @param b have the same
+/// thickness, radiation length, nuclear interaction length and mass density
+/// within the relative tolerance @param tol
+template <typename scalar_t>
+DETRAY_HOST inline bool is_similar_slab(const material_slab<scalar_t> &a,
+                                        const material_slab<scalar_t> &b,
+                                        const scalar_t tol) {
+    const auto &mat_a = a.get_material();
+    const auto &mat_b = b.get_material();
+
+    return is_within_tolerance(a.thickness(), b.thickness(), tol) &&
+           is_within_tolerance(mat_a.X0(), mat_b.X0(), tol) &&
+           is_within_tolerance(mat_a.L0(), mat_b.L0(), tol) &&
+           is_within_tolerance(mat_a.mass_density(), mat_b.mass_density(),
+                               tol);
+}
+
+/// @brief Dense representation of the bins of a material map during merging
+template <typename scalar_t, std::size_t DIM>
+struct dense_material_bins {
+
+    /// @returns the global index of the local bin @param loc
+    std::size_t global_index(const std::array<std::size_t, DIM> &loc) const {
+        std::size_t gbin{0u};
+        std::size_t stride{1u};
+        for (std::size_t a = 0u; a < DIM; ++a) {
+            gbin += loc[a] * stride;
+            stride *= n_bins[a];
+        }
+        return gbin;
+    }
+
+    /// @returns the local bin of the global index @param gbin
+    std::array<std::size_t, DIM> local_index(std::size_t gbin) const {
+        std::array<std::size_t, DIM> loc{};
+        for (std::size_t a = 0u; a < DIM; ++a) {
+            loc[a] = gbin % n_bins[a];
+            gbin /= n_bins[a];
+        }
+        return loc;
+    }
+
+    /// @returns whether the bins @param i and @param j can be merged
+    bool is_similar(const std::size_t i, const std::size_t j,
+                    const scalar_t tol) const {
+        return (filled[i] == filled[j]) &&
+               (!filled[i] || is_similar_slab(slabs[i], slabs[j], tol));
+    }
+
+    std::array<std::size_t, DIM> n_bins{};
+    std::vector<material_slab<scalar_t>> slabs{};
+    /// Bins that are not filled hold the default material slab in the grid
+    std::vector<bool> filled{};
+};
+
+/// Merge groups of @param k neighbouring bins along the axis @param ax of the
+/// material map @param bins, if the material of every bin in a group agrees
+/// with the first bin of the group.
+///
+/// @returns whether the bins were merged
+template <typename scalar_t, std::size_t DIM>
+DETRAY_HOST inline bool merge_axis_bins(
+    dense_material_bins<scalar_t, DIM> &bins, const std::size_t ax,
+    const std::size_t k, const scalar_t tol) {
+    assert(bins.n_bins[ax] % k == 0u);
+
+    // Every bin has to agree with the first bin of its group
+    for (std::size_t gbin = 0u; gbin < bins.slabs.size(); ++gbin) {
+        auto first = bins.local_index(gbin);
+        first[ax] -= first[ax] % k;
+
+        if (!bins.is_similar(gbin, bins.global_index(first), tol)) {
+            return false;
+        }
+    }
+
+    // Keep the first bin of every group
+    dense_material_bins<scalar_t, DIM> merged{};
+    merged.n_bins = bins.n_bins;
+    merged.n_bins[ax] /= k;
+
+    const std::size_t n_merged{bins.slabs.size() / k};
+    merged.slabs.reserve(n_merged);
+    merged.filled.reserve(n_merged);
+    for (std::size_t gbin = 0u; gbin < n_merged; ++gbin) {
+        auto first = merged.local_index(gbin);
+        first[ax] *= k;
+
+        const std::size_t src{bins.global_index(first)};
+        merged.slabs.push_back(bins.slabs[src]);
+        merged.filled.push_back(bins.filled[src]);
+    }
+
+    bins = std::move(merged);
+
+    return true;
+}
+
+/// @brief Reduce the resolution of a material map.
+///
+/// Neighbouring bins whose material slabs agree within the relative tolerance
+/// @param tol are merged by dividing the number of bins of an axis by the
+/// largest factor for which all merged bins agree. Since the detector
+/// material maps have regular axes, the bins can only be merged in groups of
+/// equal size. If all bins agree, the map is reduced to a single bin.
+///
+/// @param[in,out] bin_data the material of the filled bins
+/// @param[in,out] n_bins the number of bins per axis
+template <typename scalar_t, std::size_t DIM>
+DETRAY_HOST inline void merge_material_bins(
+    std::vector<fill_by_bin::bin_data<DIM, material_slab<scalar_t>>>
+        &bin_data,
+    std::array<std::size_t, DIM> &n_bins, const scalar_t tol) {
+
+    using bin_data_t = fill_by_bin::bin_data<DIM, material_slab<scalar_t>>;
+
+    dense_material_bins<scalar_t, DIM> bins{};
+    bins.n_bins = n_bins;
+
+    std::size_t n_total{1u};
+    for (const std::size_t n : n_bins) {
+        n_total *= n;
+    }
+    if (n_total <= 1u) {
+        return;
+    }
+
+    bins.slabs.resize(n_total);
+    bins.filled.resize(n_total, false);
+    for (const bin_data_t &bd : bin_data) {
+        std::array<std::size_t, DIM> loc{};
+        for (std::size_t a = 0u; a < DIM; ++a) {
+            loc[a] = static_cast<std::size_t>(bd.local_bin_idx[a]);
+        }
+        const std::size_t gbin{bins.global_index(loc)};
+        assert(gbin < n_total);
+
+        bins.slabs[gbin] = bd.single_element;
+        bins.filled[gbin] = true;
+    }
+
+    // Try the coarsest binning first
+    for (std::size_t a = 0u; a < DIM; ++a) {
+        for (std::size_t k = bins.n_bins[a]; k > 1u; --k) {
+            if (bins.n_bins[a] % k == 0u &&
+                merge_axis_bins(bins, a, k, tol)) {
+                break;
+            }
+        }
+    }
+
+    if (bins.n_bins == n_bins) {
+        return;
+    }
+
+    // Write the merged bins back
+    n_bins = bins.n_bins;
+    bin_data.clear();
+    for (std::size_t gbin = 0u; gbin < bins.slabs.size(); ++gbin) {
+        if (!bins.filled[gbin]) {
+            continue;
+        }
+        const auto loc = bins.local_index(gbin);
+
+        bin_data_t bd{};
+        for (std::size_t a = 0u; a < DIM; ++a) {
+            bd.local_bin_idx[a] = static_cast<dindex>(loc[a]);
+        }
+        bd.single_element = bins.slabs[gbin];
+        bin_data.push_back(bd);
+    }
+}
+
+}  // namespace detray::detail
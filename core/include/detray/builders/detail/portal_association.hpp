@@ -0,0 +1,168 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/geometry/detector_volume.hpp"
+#include "detray/geometry/surface.hpp"
+#include "detray/navigation/detail/ray.hpp"
+#include "detray/navigation/intersection/intersection.hpp"
+#include "detray/navigation/intersection/ray_intersector.hpp"
+#include "detray/navigation/intersection_kernel.hpp"
+#include "detray/utils/grid/populators.hpp"
+
+// System include(s)
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace detray::detail {
+
+/// Run the association of the exit portals of a volume to the bins of one of
+/// its surface grids.
+///
+/// Straight lines are cast from a reference point (e.g. the interaction
+/// region) in a regular pattern of directions, uniform in the azimuthal and
+/// the polar angle. Where a line passes through the volume, the portals
+/// through which it enters and leaves are associated with every grid bin
+/// that the line crosses in between. The grid is searched at the sampled
+/// positions, like the navigator does at the track position.
+///
+/// Every portal is added to a bin only once, and only while the bin has
+/// capacity left, so that the bin capacities have to leave room for the
+/// portals. Bins that do not get any portals are left as they are.
+///
+/// @param grid the surface grid (owning) that is placed in the volume
+/// @param det the detector that contains the volume and its portals
+/// @param vol_desc the descriptor of the volume
+/// @param ref_point origin of the lines in global coordinates
+/// @param n_directions number of directions per angle
+/// @param n_samples number of sampled positions per line segment
+template <typename detector_t, typename grid_t>
+inline void portal_association(
+    grid_t &grid, const detector_t &det,
+    const typename detector_t::volume_type &vol_desc,
+    const typename detector_t::point3_type &ref_point,
+    const std::size_t n_directions = 256u, const std::size_t n_samples = 32u) {
+
+    using algebra_t = typename detector_t::algebra_type;
+    using scalar_t = dscalar<algebra_t>;
+    using vector3_t = dvector3D<algebra_t>;
+    using surface_t = typename detector_t::surface_type;
+    using intersection_t = intersection2D<surface_t, algebra_t>;
+
+    // Portals of the volume (the brute force search might hold passives)
+    std::vector<surface_t> portals{};
+    for (const auto &sf_desc : detector_volume{det, vol_desc}.portals()) {
+        if (sf_desc.is_portal()) {
+            portals.push_back(sf_desc);
+        }
+    }
+    if (portals.empty() or grid.nbins() == 0u) {
+        return;
+    }
+
+    const auto &vol_trf = det.transform_store()[vol_desc.transform()];
+    const std::size_t n_portals{portals.size()};
+
+    // Position of a portal in the list above
+    auto portal_pos = [&portals](const surface_t &sf_desc) {
+        return static_cast<std::size_t>(
+            std::find_if(portals.begin(), portals.end(),
+                         [&sf_desc](const surface_t &pt_desc) {
+                             return pt_desc.index() == sf_desc.index();
+                         }) -
+            portals.begin());
+    };
+
+    // Flags the portals that are associated with a bin
+    std::vector<std::uint8_t> is_associated(grid.nbins() * n_portals, 0u);
+
+    // Mark the portals @param entry and @param exit for the bins that the
+    // line segment between the path lengths @param s_0 and @param s_1 crosses
+    auto associate = [&](const detail::ray<algebra_t> &ray, const scalar_t s_0,
+                         const scalar_t s_1, const std::size_t entry,
+                         const std::size_t exit) {
+        const scalar_t ds{(s_1 - s_0) / static_cast<scalar_t>(n_samples)};
+        for (std::size_t i = 0u; i < n_samples; ++i) {
+            const auto loc_pos = grid.project(
+                vol_trf,
+                ray.pos(s_0 + (static_cast<scalar_t>(i) + 0.5f) * ds),
+                ray.dir());
+            const std::size_t gbin{static_cast<std::size_t>(
+                grid.serialize(grid.axes().bins(loc_pos)))};
+
+            if (entry < n_portals) {
+                is_associated[gbin * n_portals + entry] = 1u;
+            }
+            is_associated[gbin * n_portals + exit] = 1u;
+        }
+    };
+
+    const scalar_t d_theta{constant<scalar_t>::pi /
+                           static_cast<scalar_t>(n_directions)};
+    const scalar_t d_phi{2.f * d_theta};
+
+    std::vector<intersection_t> hits{};
+    for (std::size_t i = 0u; i < n_directions; ++i) {
+        const scalar_t theta{(static_cast<scalar_t>(i) + 0.5f) * d_theta};
+        for (std::size_t j = 0u; j < n_directions; ++j) {
+            const scalar_t phi{-constant<scalar_t>::pi +
+                               (static_cast<scalar_t>(j) + 0.5f) * d_phi};
+            const vector3_t dir{math::sin(theta) * math::cos(phi),
+                                math::sin(theta) * math::sin(phi),
+                                math::cos(theta)};
+            const detail::ray<algebra_t> ray{ref_point, 0.f, dir, 0.f};
+
+            // Boundary crossings ahead of the reference point
+            hits.clear();
+            for (const surface_t &pt_desc : portals) {
+                surface{det, pt_desc}
+                    .template visit_mask<
+                        intersection_initialize<ray_intersector>>(
+                        hits, ray, pt_desc, det.transform_store(), 0.f, 0.f);
+            }
+            std::sort(hits.begin(), hits.end());
+
+            // An odd number of crossings: The line starts inside the volume
+            std::size_t k{0u};
+            if (hits.size() % 2u == 1u) {
+                associate(ray, 0.f, hits[0].path, n_portals,
+                          portal_pos(hits[0].sf_desc));
+                k = 1u;
+            }
+            for (; k + 1u < hits.size(); k += 2u) {
+                associate(ray, hits[k].path, hits[k + 1u].path,
+                          portal_pos(hits[k].sf_desc),
+                          portal_pos(hits[k + 1u].sf_desc));
+            }
+        }
+    }
+
+    // Add the portals to the bins that have room for them
+    for (std::size_t gbin = 0u; gbin < grid.nbins(); ++gbin) {
+        for (std::size_t p = 0u; p < n_portals; ++p) {
+            if (is_associated[gbin * n_portals + p] == 0u) {
+                continue;
+            }
+            const auto &bin = grid.bin(static_cast<dindex>(gbin));
+            if (bin.size() >= bin.capacity()) {
+                break;
+            }
+            grid.template populate<attach<>>(static_cast<dindex>(gbin),
+                                             portals[p]);
+        }
+    }
+}
+
+}  // namespace detray::detail
@@ -0,0 +1,91 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/qualifiers.hpp"
+
+// System include(s)
+#include <array>
+#include <cstddef>
+#include <utility>
+
+namespace detray::detail {
+
+/// @brief Number of objects in the data stores of a detector.
+///
+/// The volume builders add up the sizes of their staged data before the
+/// detector is built, so that the detector stores can be reserved exactly
+/// once instead of being regrown volume by volume.
+template <typename detector_t>
+struct store_sizes {
+
+    using masks = typename detector_t::masks;
+    using materials = typename detector_t::materials;
+
+    std::size_t n_volumes{0u};
+    std::size_t n_surfaces{0u};
+    std::size_t n_transforms{0u};
+    /// Number of masks per mask type
+    std::array<std::size_t, masks::n_types> n_masks{};
+    /// Number of material slabs, rods or maps per material type
+    std::array<std::size_t, materials::n_types> n_materials{};
+
+    /// Add the number of masks in the mask store @param mask_store
+    template <typename mask_store_t>
+    DETRAY_HOST void add_masks(const mask_store_t &mask_store) {
+        add<masks>(n_masks, mask_store,
+                   std::make_index_sequence<masks::n_types>{});
+    }
+
+    /// Add the number of materials in the material store @param mat_store
+    template <typename material_store_t>
+    DETRAY_HOST void add_materials(const material_store_t &mat_store) {
+        add<materials>(n_materials, mat_store,
+                       std::make_index_sequence<materials::n_types>{});
+    }
+
+    /// Reserve the memory of the detector @param det for the counted objects,
+    /// in addition to the objects that it already contains
+    DETRAY_HOST void reserve(detector_t &det) const {
+
+        typename detector_t::geometry_context ctx{};
+
+        det.volumes().reserve(det.volumes().size() + n_volumes);
+        det.surfaces().reserve(det.surfaces().size() + n_surfaces);
+        det.transform_store().reserve(
+            det.transform_store().size(ctx) + n_transforms, ctx);
+
+        reserve_store<masks>(det.mask_store(), n_masks,
+                             std::make_index_sequence<masks::n_types>{});
+        reserve_store<materials>(
+            det.material_store(), n_materials,
+            std::make_index_sequence<materials::n_types>{});
+    }
+
+    private:
+    template <typename registry_t, typename store_t, std::size_t N,
+              std::size_t... I>
+    DETRAY_HOST static void add(std::array<std::size_t, N> &sizes,
+                                const store_t &store,
+                                std::index_sequence<I...>) {
+        ((sizes[I] += store.template size<registry_t::to_id(I)>()), ...);
+    }
+
+    template <typename registry_t, typename store_t, std::size_t N,
+              std::size_t... I>
+    DETRAY_HOST static void reserve_store(
+        store_t &store, const std::array<std::size_t, N> &sizes,
+        std::index_sequence<I...>) {
+        ((store.template reserve<registry_t::to_id(I)>(
+             store.template size<registry_t::to_id(I)>() + sizes[I], {})),
+         ...);
+    }
+};
+
+}  // namespace detray::detail
@@ -0,0 +1,383 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/geometry.hpp"
+#include "detray/navigation/accelerators/surface_grid.hpp"
+#include "detray/utils/grid/detail/grid_bins.hpp"
+#include "detray/utils/invalid_values.hpp"
+#include "detray/utils/type_traits.hpp"
+
+// System include(s)
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace detray::detail {
+
+/// A functor that ranks the surfaces by the traversal order of an
+/// acceleration data structure (for grids: the bin serialization order)
+struct surface_traversal_order {
+
+    template <typename accel_group_t, typename accel_index_t>
+    DETRAY_HOST inline void operator()(const accel_group_t &group,
+                                       const accel_index_t index,
+                                       std::vector<dindex> &rank,
+                                       dindex &counter) const {
+
+        for (const auto &sf : group[index].all()) {
+            const dindex sf_idx{static_cast<dindex>(sf.index())};
+            if (sf_idx < rank.size() &&
+                detail::is_invalid_value(rank[sf_idx])) {
+                rank[sf_idx] = counter++;
+            }
+        }
+    }
+};
+
+/// A functor that moves every element of a data collection to a new position
+struct collection_permutation {
+
+    template <typename collection_t>
+    DETRAY_HOST inline void operator()(
+        collection_t &coll, const std::vector<dindex> &new_pos) const {
+
+        const std::vector<typename collection_t::value_type> old(coll.begin(),
+                                                                 coll.end());
+        for (std::size_t i = 0u; i < old.size(); ++i) {
+            const dindex j{i < new_pos.size() ? new_pos[i]
+                                              : static_cast<dindex>(i)};
+            coll[j] = old[i];
+        }
+    }
+};
+
+/// @brief Permute the data collection with the type id @param type_id in the
+/// store @param store (non-const access by compile-time id)
+template <std::size_t I = 0u, typename store_t>
+DETRAY_HOST void permute_collection(store_t &store, const std::size_t type_id,
+                                    const std::vector<dindex> &new_pos) {
+    if constexpr (I < store_t::n_collections()) {
+        constexpr auto id{store_t::value_types::to_id(I)};
+        if (static_cast<std::size_t>(id) == type_id) {
+            collection_permutation{}(store.template get<id>(), new_pos);
+            return;
+        }
+        permute_collection<I + 1u>(store, type_id, new_pos);
+    }
+}
+
+/// @brief Replaces the surface entries of the acceleration data structures
+/// by the reordered surfaces
+template <typename sf_desc_t>
+struct surface_remapper {
+
+    /// The reordered surface descriptors, by old surface index
+    const std::vector<sf_desc_t> &new_surfaces;
+    /// The new surface index, by old surface index
+    const std::vector<dindex> &new_pos;
+
+    /// Surface descriptors and compressed surface entries
+    template <typename entry_t>
+    DETRAY_HOST void remap(entry_t &entry) const {
+        const auto sf_idx{entry.index()};
+        if (sf_idx >= new_pos.size()) {
+            // Invalid entry (empty bin slot)
+            return;
+        }
+        if constexpr (is_surface_descriptor_v<entry_t>) {
+            entry = new_surfaces[sf_idx];
+        } else {
+            entry = entry_t{new_pos[sf_idx]};
+        }
+    }
+
+    /// Plain data: Nothing to be done
+    template <typename T>
+    DETRAY_HOST void operator()(dvector_view<T> &v) const {
+        using value_t = std::remove_cv_t<T>;
+
+        if constexpr (is_surface_descriptor_v<value_t> ||
+                      std::is_same_v<value_t, surface_index_entry>) {
+            for (auto i = 0u; i < v.size(); ++i) {
+                remap(v.ptr()[i]);
+            }
+        } else if constexpr (is_static_bin_v<value_t>) {
+            for (auto i = 0u; i < v.size(); ++i) {
+                for (auto &entry : v.ptr()[i]) {
+                    remap(entry);
+                }
+            }
+        }
+    }
+
+    /// Jagged data: remap the inner vectors
+    template <typename T>
+    DETRAY_HOST void operator()(djagged_vector_view<T> &v) const {
+        for (auto i = 0u; i < v.size(); ++i) {
+            (*this)(v.host_ptr()[i]);
+        }
+    }
+
+    /// Composite views: recurse
+    template <typename... Ts>
+    DETRAY_HOST void operator()(dmulti_view<Ts...> &v) const {
+        visit(v, std::make_index_sequence<sizeof...(Ts)>{});
+    }
+
+    private:
+    template <typename... Ts, std::size_t... I>
+    DETRAY_HOST void visit(dmulti_view<Ts...> &v,
+                           std::index_sequence<I...> /*seq*/) const {
+        ((*this)(detail::get<I>(v.m_view)), ...);
+    }
+
+    /// Recognize the static array bins of the surface grids
+    /// @{
+    template <typename T>
+    struct is_static_bin : public std::false_type {};
+
+    template <typename entry_t, std::size_t N>
+    struct is_static_bin<bins::static_array<entry_t, N>>
+        : public std::true_type {};
+
+    template <typename T>
+    static constexpr bool is_static_bin_v = is_static_bin<T>::value;
+    /// @}
+};
+
+/// @brief Assign the slots @param slots of a data collection to the objects
+/// in @param order
+///
+/// @param old_links the old link of every object
+/// @param new_pos receives the new position of every element of the data
+/// collection that moved
+/// @param new_links receives the new link of every object
+inline void assign_slots(const std::vector<dindex> &order,
+                         const std::vector<dindex> &old_links,
+                         std::vector<dindex> &new_pos,
+                         std::vector<dindex> &new_links) {
+
+    std::vector<dindex> slots{};
+    slots.reserve(order.size());
+    for (const dindex obj : order) {
+        slots.push_back(old_links[obj]);
+    }
+    std::sort(slots.begin(), slots.end());
+
+    for (std::size_t k = 0u; k < order.size(); ++k) {
+        const dindex old_link{old_links[order[k]]};
+        if (old_link >= new_pos.size()) {
+            new_pos.resize(old_link + 1u, dindex_invalid);
+        }
+        new_pos[old_link] = slots[k];
+        new_links[order[k]] = slots[k];
+    }
+}
+
+/// @returns whether the links @param links are unique (invalid links are
+/// ignored)
+inline bool are_unique(std::vector<dindex> links) {
+    links.erase(std::remove_if(links.begin(), links.end(),
+                               [](const dindex l) {
+                                   return detail::is_invalid_value(l);
+                               }),
+                links.end());
+    std::sort(links.begin(), links.end());
+    return std::adjacent_find(links.begin(), links.end()) == links.end();
+}
+
+/// @brief Reorder the surfaces of a detector by the traversal order of their
+/// acceleration data structures
+///
+/// Within every volume, the portal, sensitive and passive surface ranges are
+/// sorted by the order in which the accelerators of the volume visit them
+/// (e.g. the bin order of a surface grid). The transforms and masks of the
+/// surfaces are moved accordingly, so that neighboring grid bins refer to
+/// neighboring memory. All surface, transform and mask links are rewritten,
+/// including the surfaces held by the acceleration data structures.
+///
+/// Transforms and masks are only moved if every entry is used by a single
+/// object and, for the transforms, if there are no additional geometry
+/// contexts. Otherwise they keep their position and only the surfaces are
+/// reordered. The surface material is not moved.
+///
+/// @param det the detector (host containers)
+///
+/// @returns the new index of every surface, by old surface index
+template <typename detector_t>
+DETRAY_HOST auto reorder_surfaces(detector_t &det) -> std::vector<dindex> {
+
+    using sf_desc_t = typename detector_t::surface_type;
+    using mask_link_t = typename sf_desc_t::mask_link;
+    using mask_index_t = typename mask_link_t::index_type;
+
+    const auto n_surfaces{static_cast<dindex>(det.surfaces().size())};
+    std::vector<dindex> new_pos(n_surfaces);
+    std::iota(new_pos.begin(), new_pos.end(), 0u);
+
+    if (n_surfaces == 0u) {
+        return new_pos;
+    }
+
+    // Rank the surfaces by their traversal order
+    std::vector<dindex> rank(n_surfaces, dindex_invalid);
+    dindex counter{0u};
+    for (const auto &vol_desc : det.volumes()) {
+        const auto &links = vol_desc.accel_link();
+        for (std::size_t i = 0u; i < links.size(); ++i) {
+            if (!links[i].is_invalid()) {
+                det.accelerator_store()
+                    .template visit<surface_traversal_order>(links[i], rank,
+                                                             counter);
+            }
+        }
+    }
+
+    // New order of the surfaces within every surface range of a volume
+    std::vector<std::vector<dindex>> orders{};
+    for (const auto &vol_desc : det.volumes()) {
+        const std::array<dindex_range, 3u> ranges{
+            vol_desc.template sf_link<surface_id::e_portal>(),
+            vol_desc.template sf_link<surface_id::e_sensitive>(),
+            vol_desc.template sf_link<surface_id::e_passive>()};
+
+        for (std::size_t r = 0u; r < ranges.size(); ++r) {
+            const dindex_range &rg = ranges[r];
+            // Empty or already handled
+            if (rg[0] >= rg[1] || rg[1] > n_surfaces ||
+                std::find(ranges.begin(), ranges.begin() + r, rg) !=
+                    ranges.begin() + r) {
+                continue;
+            }
+
+            std::vector<dindex> order(rg[1] - rg[0]);
+            std::iota(order.begin(), order.end(), rg[0]);
+            std::stable_sort(order.begin(), order.end(),
+                             [&rank](const dindex a, const dindex b) {
+                                 return rank[a] < rank[b];
+                             });
+            for (std::size_t k = 0u; k < order.size(); ++k) {
+                new_pos[order[k]] = rg[0] + static_cast<dindex>(k);
+            }
+            orders.push_back(std::move(order));
+        }
+    }
+
+    // Current links of the surfaces
+    std::vector<sf_desc_t> old_surfaces{};
+    std::vector<std::uint64_t> sources{};
+    std::vector<dindex> old_trf_links{};
+    old_surfaces.reserve(n_surfaces);
+    sources.reserve(n_surfaces);
+    old_trf_links.reserve(n_surfaces);
+    for (const auto &sf : det.surfaces()) {
+        old_surfaces.push_back(sf);
+        sources.push_back(sf.source);
+        old_trf_links.push_back(static_cast<dindex>(sf.transform()));
+    }
+
+    // Move the transforms
+    std::vector<dindex> new_trf_links{old_trf_links};
+    std::vector<dindex> all_trf_links{old_trf_links};
+    for (const auto &vol_desc : det.volumes()) {
+        all_trf_links.push_back(vol_desc.transform());
+    }
+    if (det.transform_store().n_contexts() == 1u &&
+        are_unique(std::move(all_trf_links))) {
+        std::vector<dindex> trf_pos{};
+        for (const auto &order : orders) {
+            assign_slots(order, old_trf_links, trf_pos, new_trf_links);
+        }
+        collection_permutation{}(*(det.transform_store().data()), trf_pos);
+    }
+
+    // Move the masks of every mask type
+    std::vector<dindex> new_mask_links(n_surfaces, dindex_invalid);
+    if constexpr (std::is_integral_v<mask_index_t>) {
+        // Sort the surface masks by type
+        std::map<std::size_t, std::vector<dindex>> mask_links{};
+        for (dindex i = 0u; i < n_surfaces; ++i) {
+            const auto &mask_link = old_surfaces[i].mask();
+            auto &links = mask_links[static_cast<std::size_t>(mask_link.id())];
+            links.resize(n_surfaces, dindex_invalid);
+            links[i] = static_cast<dindex>(mask_link.index());
+        }
+
+        for (auto &[type_id, links] : mask_links) {
+            if (!are_unique(links)) {
+                continue;
+            }
+            std::vector<dindex> mask_pos{};
+            std::vector<dindex> new_links{links};
+            for (const auto &order : orders) {
+                // Only the surfaces that have a mask of this type
+                std::vector<dindex> typed_order{};
+                for (const dindex sf_idx : order) {
+                    if (!detail::is_invalid_value(links[sf_idx])) {
+                        typed_order.push_back(sf_idx);
+                    }
+                }
+                assign_slots(typed_order, links, mask_pos, new_links);
+            }
+            permute_collection(det.mask_store(), type_id, mask_pos);
+
+            for (dindex i = 0u; i < n_surfaces; ++i) {
+                if (!detail::is_invalid_value(links[i])) {
+                    new_mask_links[i] = new_links[i];
+                }
+            }
+        }
+    }
+
+    // Assemble the reordered surfaces
+    std::vector<sf_desc_t> new_surfaces{};
+    new_surfaces.reserve(n_surfaces);
+    for (dindex i = 0u; i < n_surfaces; ++i) {
+        const sf_desc_t &old_sf = old_surfaces[i];
+
+        mask_link_t mask_link{old_sf.mask()};
+        if (!detail::is_invalid_value(new_mask_links[i])) {
+            mask_link.set_index(static_cast<mask_index_t>(new_mask_links[i]));
+        }
+
+        sf_desc_t sf{static_cast<typename sf_desc_t::transform_link>(
+                         new_trf_links[i]),
+                     mask_link, old_sf.material(), old_sf.volume(),
+                     old_sf.id()};
+        sf.set_barcode(old_sf.barcode());
+        sf.set_index(new_pos[i]);
+
+        new_surfaces.push_back(sf);
+    }
+
+    using sf_link_t = typename detector_t::surface_lookup_container::value_type;
+    for (dindex i = 0u; i < n_surfaces; ++i) {
+        det.surfaces()[new_pos[i]] = sf_link_t{new_surfaces[i], sources[i]};
+    }
+
+    // Update the surfaces in the acceleration data structures
+    auto accel_data = detray::get_data(det.accelerator_store());
+    surface_remapper<sf_desc_t>{new_surfaces, new_pos}(accel_data);
+
+    det.surfaces().build_source_index();
+
+    return new_pos;
+}
+
+}  // namespace detray::detail
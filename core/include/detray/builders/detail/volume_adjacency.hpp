@@ -0,0 +1,69 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/utils/invalid_values.hpp"
+#include "detray/utils/ranges/subrange.hpp"
+
+// System include(s)
+#include <utility>
+#include <vector>
+
+namespace detray::detail {
+
+/// A functor that collects the volume links of the masks of a portal
+struct portal_link_getter {
+
+    template <typename mask_group_t, typename index_t>
+    DETRAY_HOST inline void operator()(
+        const mask_group_t &mask_group, const index_t &index,
+        const dindex pt_idx,
+        std::vector<std::pair<dindex, dindex>> &links) const {
+
+        for (const auto &mask : detray::ranges::subrange(mask_group, index)) {
+            // The link type can be narrower than the volume index type
+            const auto vol_link = mask.volume_link();
+            links.emplace_back(detail::is_invalid_value(vol_link)
+                                   ? detail::invalid_value<dindex>()
+                                   : static_cast<dindex>(vol_link),
+                               pt_idx);
+        }
+    }
+};
+
+/// Build the volume adjacency of the detector @param det from the volume
+/// links of its portals. Has to be rebuilt after the surfaces changed.
+template <typename detector_t>
+DETRAY_HOST void build_volume_adjacency(detector_t &det) {
+
+    const std::size_t n_volumes{det.volumes().size()};
+
+    // Links to the neighbours per volume: (neighbour, portal index)
+    std::vector<std::vector<std::pair<dindex, dindex>>> links(n_volumes);
+    std::size_t n_portals{0u};
+
+    for (const auto &sf_desc : det.surfaces()) {
+        if (sf_desc.is_portal()) {
+            det.mask_store().template visit<portal_link_getter>(
+                sf_desc.mask(), sf_desc.index(), links.at(sf_desc.volume()));
+            ++n_portals;
+        }
+    }
+
+    auto &adjacency = det.volume_adjacency();
+    adjacency.clear();
+    adjacency.reserve(n_volumes, n_portals);
+    for (auto &vol_links : links) {
+        adjacency.push_back(std::move(vol_links));
+    }
+}
+
+}  // namespace detray::detail
@@ -0,0 +1,91 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/geometry/detector_volume.hpp"
+#include "detray/geometry/shapes/concentric_cylinder2D.hpp"
+#include "detray/geometry/shapes/cylinder2D.hpp"
+#include "detray/geometry/shapes/ring2D.hpp"
+#include "detray/utils/invalid_values.hpp"
+
+// System include(s)
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+namespace detray::detail {
+
+/// A functor that enlarges an r-z box by the extent of a portal
+struct rz_extent_getter {
+
+    template <typename mask_group_t, typename index_t, typename transform3_t,
+              typename box_t>
+    DETRAY_HOST inline void operator()(const mask_group_t &mask_group,
+                                       const index_t &index,
+                                       const transform3_t &trf,
+                                       box_t &box) const {
+        using mask_t = typename mask_group_t::value_type;
+        using shape_t = typename mask_t::shape;
+
+        const mask_t &mask = mask_group[index];
+        const auto z{trf.translation()[2]};
+
+        // Cylinder portals along the z-axis
+        if constexpr (std::is_same_v<shape_t, concentric_cylinder2D> or
+                      std::is_same_v<shape_t, cylinder2D>) {
+            box.r_min = std::min(box.r_min, mask[shape_t::e_r]);
+            box.r_max = std::max(box.r_max, mask[shape_t::e_r]);
+            box.z_min = std::min(box.z_min, z + mask[shape_t::e_n_half_z]);
+            box.z_max = std::max(box.z_max, z + mask[shape_t::e_p_half_z]);
+        }
+        // Disc portals perpendicular to the z-axis
+        else if constexpr (std::is_same_v<shape_t, ring2D>) {
+            box.r_min = std::min(box.r_min, mask[shape_t::e_inner_r]);
+            box.r_max = std::max(box.r_max, mask[shape_t::e_outer_r]);
+            box.z_min = std::min(box.z_min, z);
+            box.z_max = std::max(box.z_max, z);
+        }
+    }
+};
+
+/// @returns the r-z extents of the cylindrical volumes of the detector
+/// @param det , as given by their cylinder and disc portals. Volumes that are
+/// not bounded by such portals are left out.
+template <typename box_t, typename detector_t>
+DETRAY_HOST inline auto volume_rz_boxes(
+    const detector_t &det,
+    const typename detector_t::geometry_context ctx = {}) {
+
+    using scalar_t = decltype(box_t{}.r_min);
+    constexpr scalar_t inv{detail::invalid_value<scalar_t>()};
+
+    std::vector<box_t> boxes{};
+    boxes.reserve(det.volumes().size());
+
+    for (const auto &vol_desc : det.volumes()) {
+        const auto vol = detector_volume{det, vol_desc};
+
+        box_t box{inv, -inv, inv, -inv, vol.index()};
+        for (const auto &pt_desc : vol.portals()) {
+            const auto &trf =
+                det.transform_store().at(pt_desc.transform(), ctx);
+            det.mask_store().template visit<rz_extent_getter>(pt_desc.mask(),
+                                                              trf, box);
+        }
+
+        if (box.r_min < box.r_max and box.z_min < box.z_max) {
+            boxes.push_back(box);
+        }
+    }
+
+    return boxes;
+}
+
+}  // namespace detray::detail
@@ -8,12 +8,16 @@
 #pragma once
 
 // Project include(s).
+#include "detray/builders/detail/surface_reordering.hpp"
+#include "detray/builders/detail/volume_adjacency.hpp"
+#include "detray/builders/detail/volume_extent.hpp"
 #include "detray/builders/grid_factory.hpp"
 #include "detray/builders/volume_builder.hpp"
 #include "detray/builders/volume_builder_interface.hpp"
 #include "detray/core/detector.hpp"
 #include "detray/core/detector_metadata.hpp"
 #include "detray/definitions/geometry.hpp"
+#include "detray/utils/parallel_algorithms.hpp"
 #include "detray/utils/type_traits.hpp"
 
 // Vecmem include(s)
@@ -95,18 +99,60 @@ class detector_builder {
 
         detector_type det{resource};
 
+        // Run the per-volume work concurrently, then add the volumes to the
+        // detector one after the other
+        if (m_n_threads > 1u) {
+            prepare_volumes();
+        }
+
+        // Size the detector stores once for all volumes, instead of
+        // regrowing them for every volume that is added
+        detail::store_sizes<detector_type> sizes{};
+        for (auto& vol_builder : m_volumes) {
+            vol_builder->count(sizes);
+        }
+        sizes.reserve(det);
+
         for (auto& vol_builder : m_volumes) {
             vol_builder->build(det);
         }
 
+        // Fill the volume finder from the volume extents, if not done already
+        using vol_finder_t = typename detector_type::volume_finder;
+        if constexpr (detail::is_two_level_volume_finder_v<vol_finder_t>) {
+            if (m_vol_finder.empty()) {
+                using box_t = typename vol_finder_t::box_type;
+
+                vol_finder_t vol_finder{resource};
+                vol_finder.build(detail::volume_rz_boxes<box_t>(det));
+                m_vol_finder = std::move(vol_finder);
+            }
+        }
+
         det.set_volume_finder(std::move(m_vol_finder));
 
-        // TODO: Add sorting, data deduplication etc. here later...
+        // Make the surfaces searchable by their source links
+        det.surfaces().build_source_index();
+
+        // Place the surfaces in the order in which they are navigated
+        // (rebuilds the source link index)
+        if (m_reorder_surfaces) {
+            detail::reorder_surfaces(det);
+        }
+
+        // Neighbours of the volumes through their portals
+        detail::build_volume_adjacency(det);
+
+        // TODO: Add data deduplication etc. here later...
 
         return det;
     }
 
     /// Put the volumes into a search data structure
+    ///
+    /// @note the two-level volume finder is filled from the r-z extents of
+    /// the volume portals when the detector is built, unless it was filled
+    /// through @c volume_finder() beforehand
     template <typename... Args>
     DETRAY_HOST void set_volume_finder([[maybe_unused]] Args&&... args) {
 
@@ -144,12 +190,43 @@ class detector_builder {
         return m_vol_finder;
     }
 
+    /// Reorder the surfaces, transforms and masks of every volume by the
+    /// traversal order of the volume accelerators, when the detector is built
+    /// (see @c detail::reorder_surfaces )
+    DETRAY_HOST void set_surface_reordering(const bool do_reorder) {
+        m_reorder_surfaces = do_reorder;
+    }
+
+    /// Prepare the volumes on @param n_threads threads, before they are
+    /// added to the detector (see @c volume_builder_interface::prepare ).
+    ///
+    /// @note the surface factories are not affected: They run when they are
+    /// added to a volume builder
+    DETRAY_HOST void set_n_threads(const unsigned int n_threads) {
+        m_n_threads = n_threads;
+    }
+
     protected:
+    /// Prepare all volume builders concurrently. Every builder only touches
+    /// its own (staged) surfaces, transforms and masks, which are relocated
+    /// into the detector stores when the volume is built
+    DETRAY_HOST void prepare_volumes() {
+
+        // The first error is rethrown on the calling thread
+        detray::ranges::for_each(
+            execution::host_threads_policy{m_n_threads, 1u}, m_volumes,
+            [](auto& vol_builder) { vol_builder->prepare(); });
+    }
+
     /// Data structure that holds a volume builder for every detector volume
     volume_data_t<std::unique_ptr<volume_builder_interface<detector_type>>>
         m_volumes{};
     /// Data structure to find volumes
     typename detector_type::volume_finder m_vol_finder{};
+    /// Reorder the surfaces for cache locality
+    bool m_reorder_surfaces{false};
+    /// Number of threads that prepare the volumes
+    unsigned int m_n_threads{1u};
 };
 
 }  // namespace detray
@@ -0,0 +1,146 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/builders/bin_fillers.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/geometry/detector_volume.hpp"
+#include "detray/materials/material.hpp"
+#include "detray/utils/consistency_checker.hpp"
+
+// System include(s)
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+/// Modify a detector that was already built, e.g. between the iterations of
+/// an alignment or material calibration. Only the listed objects are touched,
+/// so the detector does not have to be rebuilt from scratch.
+namespace detray::patch {
+
+/// @brief Set new placements for a number of surfaces.
+///
+/// @param det the detector
+/// @param placements pairs of surface index and new placement transform
+/// @param ctx the geometry context in which the placements change (only the
+///        nominal context changes the element for all other contexts)
+///
+/// @returns the sorted indices of the changed transforms in the transform
+/// store, e.g. to update a device copy of the detector
+template <typename detector_t>
+DETRAY_HOST std::vector<dindex> surface_transforms(
+    detector_t &det,
+    const std::vector<std::pair<dindex, typename detector_t::transform3_type>>
+        &placements,
+    const typename detector_t::geometry_context ctx = {}) {
+
+    std::vector<dindex> trf_indices{};
+    trf_indices.reserve(placements.size());
+
+    for (const auto &[sf_idx, trf] : placements) {
+        const dindex trf_idx{det.surface(sf_idx).transform()};
+
+        det.transform_store().set(trf_idx, trf, ctx);
+        trf_indices.push_back(trf_idx);
+    }
+
+    std::sort(trf_indices.begin(), trf_indices.end());
+    trf_indices.erase(std::unique(trf_indices.begin(), trf_indices.end()),
+                      trf_indices.end());
+
+    return trf_indices;
+}
+
+/// @brief Set the homogeneous material of the volume @param vol_idx
+///
+/// If the volume already has homogeneous material, it is overwritten in
+/// place, otherwise the material is appended and linked to the volume.
+///
+/// @param det the detector
+/// @param vol_idx the index of the volume
+/// @param mat the new volume material
+/// @param do_check run the consistency check on the modified detector
+template <typename detector_t>
+DETRAY_HOST void volume_material(
+    detector_t &det, const dindex vol_idx,
+    const material<typename detector_t::scalar_type> &mat,
+    const bool do_check = true) {
+
+    constexpr auto mat_id{detector_t::materials::id::e_raw_material};
+
+    auto &vol_desc = det.volumes().at(vol_idx);
+    auto &mat_coll = det.material_store().template get<mat_id>();
+
+    if (vol_desc.material().id() == mat_id) {
+        mat_coll.at(vol_desc.material().index()) = mat;
+    } else {
+        vol_desc.set_material(mat_id, static_cast<dindex>(mat_coll.size()));
+        det.material_store().template push_back<mat_id>(mat);
+    }
+
+    if (do_check) {
+        detail::check_consistency(det);
+    }
+}
+
+/// @brief Rebuild the surface grid of the volume @param vol_idx
+///
+/// The volume surfaces are filled into the empty grid @param grid, which is
+/// then appended to the accelerator store and linked to the volume in place
+/// of its previous grid (e.g. after the surface placements changed). The
+/// previous grid stays unreferenced in the store until the detector is
+/// built anew.
+///
+/// @tparam grid_t the (non-owning) grid type in the accelerator store
+///
+/// @param det the detector
+/// @param vol_idx the index of the volume
+/// @param grid the empty grid, already set up with its axes
+/// @param link_id the type of surfaces that the grid holds
+/// @param bin_filler how to fill the grid
+/// @param add_passives also add the passive surfaces to the grid
+/// @param do_check run the consistency check on the modified detector
+/// @param ctx the geometry context
+template <typename grid_t, typename detector_t,
+          typename bin_filler_t = fill_by_pos>
+DETRAY_HOST void surface_grid(
+    detector_t &det, const dindex vol_idx,
+    typename grid_t::template type<true> grid,
+    const typename detector_t::volume_type::object_id link_id =
+        detector_t::volume_type::object_id::e_sensitive,
+    const bin_filler_t &bin_filler = {}, const bool add_passives = false,
+    const bool do_check = true,
+    const typename detector_t::geometry_context ctx = {}) {
+
+    using surface_desc_t = typename detector_t::surface_type;
+
+    const auto vol = detector_volume{det, vol_idx};
+
+    std::vector<surface_desc_t> surfaces{};
+    for (const auto &sf_desc : vol.surfaces()) {
+        if (sf_desc.is_sensitive() or (add_passives and sf_desc.is_passive())) {
+            surfaces.push_back(sf_desc);
+        }
+    }
+
+    bin_filler(grid, vol, surfaces, det.transform_store(), det.mask_store(),
+               ctx);
+
+    // Add the grid to the detector and link it to its volume
+    constexpr auto gid{detector_t::accel::template get_id<grid_t>()};
+    det.accelerator_store().template push_back<gid>(grid);
+    det.volumes().at(vol_idx).set_link(
+        link_id, gid, det.accelerator_store().template size<gid>() - 1u);
+
+    if (do_check) {
+        detail::check_consistency(det);
+    }
+}
+
+}  // namespace detray::patch
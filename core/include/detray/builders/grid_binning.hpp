@@ -0,0 +1,455 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/grid_axis.hpp"
+#include "detray/utils/grid/detail/grid_bins.hpp"
+#include "detray/utils/type_list.hpp"
+
+// System include(s)
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+namespace detray {
+
+/// @brief Configuration of the automatic surface grid binning.
+template <typename scalar_t>
+struct grid_binning_config {
+    /// Mean number of surfaces per filled bin the binning aims for
+    scalar_t target_entries{1.f};
+    /// Memory budget for the bins of a single grid in bytes
+    std::size_t max_bytes{1u << 20u};
+    /// Maximal number of bins per axis
+    std::size_t max_bins_per_axis{1000u};
+    /// Surface positions that are closer than this fraction of the axis span
+    /// belong to the same row of surfaces
+    scalar_t rel_tolerance{1e-3f};
+};
+
+/// @brief Summary of an automatically chosen surface grid binning.
+///
+/// The surfaces are counted by the bin of their position, which is how
+/// @c fill_by_pos fills the grid.
+template <std::size_t DIM>
+struct grid_binning_report {
+    /// Number of bins per axis
+    std::array<std::size_t, DIM> n_bins{};
+    /// Number of distinct surface positions (rows) found per axis
+    std::array<std::size_t, DIM> n_rows{};
+    /// The axis is irregular
+    std::array<bool, DIM> irregular{};
+    /// The rows are unevenly spaced along a regular axis, so that an
+    /// irregular axis would need fewer bins
+    std::array<bool, DIM> irregular_recommended{};
+    /// Number of surfaces
+    std::size_t n_entries{0u};
+    /// Number of bins that contain at least one surface
+    std::size_t n_filled_bins{0u};
+    /// Largest number of surfaces in a single bin
+    std::size_t max_entries{0u};
+    /// Estimated memory of the grid bins in bytes
+    std::size_t bytes{0u};
+    /// A bin needs more entries than the bin type can hold
+    bool overflow{false};
+
+    /// @returns the total number of bins
+    std::size_t total_bins() const {
+        std::size_t n{1u};
+        for (const std::size_t nb : n_bins) {
+            n *= nb;
+        }
+        return n;
+    }
+
+    /// @returns the mean number of surfaces per filled bin
+    double mean_entries() const {
+        return n_filled_bins == 0u ? 0.
+                                   : static_cast<double>(n_entries) /
+                                         static_cast<double>(n_filled_bins);
+    }
+
+    /// Print the binning
+    friend std::ostream &operator<<(std::ostream &os,
+                                    const grid_binning_report &r) {
+        os << "grid bins:";
+        for (std::size_t i = 0u; i < DIM; ++i) {
+            os << " " << r.n_bins[i] << (r.irregular[i] ? " (irr.)" : "")
+               << " [rows " << r.n_rows[i]
+               << (r.irregular_recommended[i] ? ", uneven" : "") << "]";
+        }
+        os << " | entries: " << r.n_entries << " in " << r.n_filled_bins
+           << " bins (mean " << r.mean_entries() << ", max "
+           << r.max_entries << (r.overflow ? ", OVERFLOW" : "")
+           << ") | memory: " << r.bytes << " B";
+        return os;
+    }
+};
+
+/// @brief Automatically chosen binning of a surface grid.
+///
+/// Can be passed to @c grid_builder::init_grid or @c grid_factory::new_grid
+template <typename scalar_t, std::size_t DIM>
+struct grid_binning {
+    /// Number of bins per axis (for regular axes)
+    std::vector<std::size_t> n_bins{};
+    /// Bin edges per axis (for irregular axes, empty otherwise)
+    std::vector<std::vector<scalar_t>> bin_edges{};
+    /// Summary
+    grid_binning_report<DIM> report{};
+};
+
+namespace detail {
+
+/// Maximal number of entries a grid bin type can hold
+/// @{
+template <typename bin_t>
+struct max_bin_entries {
+    static constexpr std::size_t value{std::numeric_limits<std::size_t>::max()};
+};
+
+template <typename entry_t>
+struct max_bin_entries<bins::single<entry_t>> {
+    static constexpr std::size_t value{1u};
+};
+
+template <typename entry_t, std::size_t N>
+struct max_bin_entries<bins::static_array<entry_t, N>> {
+    static constexpr std::size_t value{N};
+};
+/// @}
+
+/// Binning of a single axis while the grid binning is searched
+template <typename scalar_t>
+struct axis_binning_state {
+
+    /// Axis span
+    scalar_t min{0.f}, max{0.f};
+    /// Bin edges are placed between the rows of surfaces
+    bool irregular{false};
+    /// Periodic axis
+    bool circular{false};
+    /// Number of bins of a regular axis
+    std::size_t n_bins{1u};
+    /// Number of rows per bin of an irregular axis
+    std::size_t group{1u};
+    /// Sorted positions of the surface rows along the axis
+    std::vector<scalar_t> rows{};
+
+    /// @returns the bin edges of an irregular axis
+    std::vector<scalar_t> edges() const {
+        std::vector<scalar_t> e{min};
+        for (std::size_t k = group; k < rows.size(); k += group) {
+            e.push_back(0.5f * (rows[k - 1u] + rows[k]));
+        }
+        e.push_back(max);
+        return e;
+    }
+
+    /// @returns the number of bins
+    std::size_t nbins() const {
+        if (!irregular) {
+            return n_bins;
+        }
+        return rows.empty() ? 1u : (rows.size() + group - 1u) / group;
+    }
+
+    /// Halve the number of bins, @returns false if there is only one
+    bool coarsen() {
+        if (nbins() <= 1u) {
+            return false;
+        }
+        if (irregular) {
+            group *= 2u;
+        } else {
+            n_bins = (n_bins + 1u) / 2u;
+        }
+        return true;
+    }
+
+    /// Double the number of bins, @returns false if it cannot be refined
+    bool refine(const std::size_t max_bins) {
+        if (irregular) {
+            if (group <= 1u) {
+                return false;
+            }
+            group /= 2u;
+        } else {
+            if (2u * n_bins > max_bins) {
+                return false;
+            }
+            n_bins *= 2u;
+        }
+        return true;
+    }
+
+    /// @returns the bin index of the value @param v the same way the grid
+    /// axis computes it
+    std::size_t bin(const scalar_t v, const std::vector<scalar_t> &e) const {
+        const auto n{static_cast<int>(nbins())};
+        int ibin{0};
+        if (irregular) {
+            ibin = static_cast<int>(std::lower_bound(e.begin(),
+                                                     e.begin() + n, v) -
+                                    e.begin()) -
+                   1;
+        } else {
+            const scalar_t width{(max - min) / static_cast<scalar_t>(n)};
+            ibin = static_cast<int>((v - min) / width + 1.f) - 1;
+        }
+        if (circular) {
+            ibin = ((ibin % n) + n) % n;
+        }
+        return static_cast<std::size_t>(std::clamp(ibin, 0, n - 1));
+    }
+};
+
+/// Set the binning and bounds types of the axes @tparam axes_t
+template <typename axes_t, typename scalar_t, std::size_t... I>
+void set_axis_types(
+    std::array<axis_binning_state<scalar_t>, sizeof...(I)> &axes,
+    std::index_sequence<I...> /*ids*/) {
+    ((axes[I].irregular = (types::at<typename axes_t::binnings, I>::type ==
+                           axis::binning::e_irregular)),
+     ...);
+    ((axes[I].circular = (types::at<typename axes_t::bounds, I>::type ==
+                          axis::bounds::e_circular)),
+     ...);
+}
+
+/// @returns the sorted rows of the values @param values , which are
+/// merged, if they are closer than @param tol
+template <typename scalar_t>
+std::vector<scalar_t> find_rows(std::vector<scalar_t> values,
+                                const scalar_t tol) {
+    std::sort(values.begin(), values.end());
+
+    std::vector<scalar_t> rows{};
+    std::size_t first{0u};
+    for (std::size_t i = 1u; i <= values.size(); ++i) {
+        if (i == values.size() or values[i] - values[first] > tol) {
+            scalar_t sum{0.f};
+            for (std::size_t j = first; j < i; ++j) {
+                sum += values[j];
+            }
+            rows.push_back(sum / static_cast<scalar_t>(i - first));
+            first = i;
+        }
+    }
+    return rows;
+}
+
+}  // namespace detail
+
+/// @brief Choose the binning of a surface grid from the surface positions.
+///
+/// Every axis is first binned so that each row of surfaces (surfaces at
+/// the same axis position) gets its own bin, then coarsened towards the
+/// target number of entries per bin and to fit the memory budget. Bins that
+/// hold more surfaces than the bin type can store are refined along the
+/// axis that separates their surfaces, as long as the budget allows it.
+///
+/// @tparam grid_t the grid type, which defines the axis binning types
+///
+/// @param positions the surface positions in the local grid frame
+/// @param spans the axis spans (min and max per axis)
+/// @param cfg the binning configuration
+template <typename grid_t, typename point_t, typename scalar_t>
+DETRAY_HOST auto find_grid_binning(const std::vector<point_t> &positions,
+                                   const std::vector<scalar_t> &spans,
+                                   const grid_binning_config<scalar_t> &cfg =
+                                       {}) {
+
+    constexpr std::size_t dim{grid_t::dim};
+    constexpr std::size_t capacity{
+        detail::max_bin_entries<typename grid_t::bin_type>::value};
+
+    using axes_t = typename grid_t::axes_type;
+    using state_t = detail::axis_binning_state<scalar_t>;
+
+    assert(spans.size() >= 2u * dim);
+
+    std::array<state_t, dim> axes{};
+    detail::set_axis_types<axes_t>(axes, std::make_index_sequence<dim>{});
+
+    grid_binning<scalar_t, dim> result{};
+    auto &report = result.report;
+    report.n_entries = positions.size();
+
+    // Rows of surfaces and the initial binning
+    const auto group{static_cast<std::size_t>(std::max(
+        1.f, std::round(std::pow(static_cast<float>(cfg.target_entries),
+                                 1.f / static_cast<float>(dim)))))};
+
+    for (std::size_t i = 0u; i < dim; ++i) {
+        state_t &ax = axes[i];
+        ax.min = spans[2u * i];
+        ax.max = spans[2u * i + 1u];
+
+        std::vector<scalar_t> values{};
+        values.reserve(positions.size());
+        for (const point_t &p : positions) {
+            values.push_back(p[i]);
+        }
+        ax.rows = detail::find_rows(std::move(values),
+                                    cfg.rel_tolerance * (ax.max - ax.min));
+        report.n_rows[i] = ax.rows.size();
+
+        ax.group = group;
+        if (ax.rows.size() > 1u) {
+            // Regular bins as wide as the mean distance between the rows
+            const scalar_t mean_gap{(ax.rows.back() - ax.rows.front()) /
+                                    static_cast<scalar_t>(ax.rows.size() - 1u)};
+            const auto n{static_cast<std::size_t>(
+                std::round((ax.max - ax.min) / mean_gap))};
+            ax.n_bins =
+                std::clamp((n + group - 1u) / group, std::size_t{1u},
+                           cfg.max_bins_per_axis);
+
+            // Unevenly spaced rows
+            scalar_t min_gap{ax.max - ax.min};
+            scalar_t max_gap{0.f};
+            for (std::size_t k = 1u; k < ax.rows.size(); ++k) {
+                const scalar_t gap{ax.rows[k] - ax.rows[k - 1u]};
+                min_gap = std::min(min_gap, gap);
+                max_gap = std::max(max_gap, gap);
+            }
+            report.irregular_recommended[i] =
+                !ax.irregular and max_gap > 2.f * min_gap;
+        }
+    }
+
+    // Estimated memory of the bins
+    const auto bin_bytes = [&report]() -> std::size_t {
+        std::size_t n{report.total_bins()};
+        if constexpr (capacity == std::numeric_limits<std::size_t>::max()) {
+            // Bin offset, size and capacity plus the entries
+            return n * 3u * sizeof(dindex) +
+                   report.n_entries * sizeof(typename grid_t::value_type);
+        } else {
+            return n * sizeof(typename grid_t::bin_type);
+        }
+    };
+    const auto update_bins = [&report, &axes]() {
+        for (std::size_t i = 0u; i < dim; ++i) {
+            report.n_bins[i] = axes[i].nbins();
+        }
+    };
+
+    // Fit the memory budget by coarsening the axis with the most bins
+    update_bins();
+    while (bin_bytes() > cfg.max_bytes) {
+        const auto ax_it = std::max_element(
+            axes.begin(), axes.end(), [](const state_t &a, const state_t &b) {
+                return a.nbins() < b.nbins();
+            });
+        if (!ax_it->coarsen()) {
+            break;
+        }
+        update_bins();
+    }
+
+    // Count the surfaces per bin
+    std::vector<std::size_t> global_bins(positions.size());
+    const auto fill = [&]() {
+        std::array<std::vector<scalar_t>, dim> edges{};
+        for (std::size_t i = 0u; i < dim; ++i) {
+            edges[i] = axes[i].edges();
+        }
+
+        std::vector<std::size_t> counts(report.total_bins(), 0u);
+        for (std::size_t s = 0u; s < positions.size(); ++s) {
+            std::size_t gbin{0u};
+            std::size_t stride{1u};
+            for (std::size_t i = 0u; i < dim; ++i) {
+                gbin += stride * axes[i].bin(positions[s][i], edges[i]);
+                stride *= axes[i].nbins();
+            }
+            global_bins[s] = gbin;
+            ++counts[gbin];
+        }
+
+        report.n_filled_bins = static_cast<std::size_t>(
+            std::count_if(counts.begin(), counts.end(),
+                          [](const std::size_t c) { return c > 0u; }));
+        const auto max_it = std::max_element(counts.begin(), counts.end());
+        report.max_entries = max_it == counts.end() ? 0u : *max_it;
+
+        return static_cast<std::size_t>(max_it - counts.begin());
+    };
+
+    // Refine the bins that overflow along the axis that separates the most
+    // rows of their surfaces
+    std::size_t fullest_bin{fill()};
+    while (report.max_entries > capacity) {
+
+        std::array<std::size_t, dim> n_sep_rows{};
+        for (std::size_t i = 0u; i < dim; ++i) {
+            std::vector<scalar_t> values{};
+            for (std::size_t s = 0u; s < positions.size(); ++s) {
+                if (global_bins[s] == fullest_bin) {
+                    values.push_back(positions[s][i]);
+                }
+            }
+            const scalar_t tol{cfg.rel_tolerance *
+                               (axes[i].max - axes[i].min)};
+            n_sep_rows[i] = detail::find_rows(std::move(values), tol).size();
+        }
+
+        // Refine in order of the separated rows, while the budget allows it
+        bool is_refined{false};
+        while (!is_refined) {
+            const auto it =
+                std::max_element(n_sep_rows.begin(), n_sep_rows.end());
+            if (*it <= 1u) {
+                break;
+            }
+            const auto i{static_cast<std::size_t>(it - n_sep_rows.begin())};
+            state_t refined{axes[i]};
+            if (refined.refine(cfg.max_bins_per_axis)) {
+                std::swap(axes[i], refined);
+                update_bins();
+                if (bin_bytes() <= cfg.max_bytes) {
+                    is_refined = true;
+                    break;
+                }
+                std::swap(axes[i], refined);
+                update_bins();
+            }
+            *it = 0u;
+        }
+        if (!is_refined) {
+            break;
+        }
+        fullest_bin = fill();
+    }
+
+    report.overflow = report.max_entries > capacity;
+    report.bytes = bin_bytes();
+
+    // Result
+    for (std::size_t i = 0u; i < dim; ++i) {
+        report.irregular[i] = axes[i].irregular;
+        result.n_bins.push_back(axes[i].nbins());
+        result.bin_edges.push_back(axes[i].irregular ? axes[i].edges()
+                                                     : std::vector<scalar_t>{});
+    }
+
+    return result;
+}
+
+}  // namespace detray
@@ -9,6 +9,8 @@
 
 // Project include(s).
 #include "detray/builders/bin_fillers.hpp"
+#include "detray/builders/detail/portal_association.hpp"
+#include "detray/builders/grid_binning.hpp"
 #include "detray/builders/grid_factory.hpp"
 #include "detray/builders/surface_factory_interface.hpp"
 #include "detray/builders/volume_builder.hpp"
@@ -24,6 +26,26 @@
 
 namespace detray {
 
+namespace detail {
+
+/// A volume that is not yet part of the detector: Provides its index and
+/// placement to the bin fillers
+template <typename detector_t>
+struct staged_volume {
+
+    DETRAY_HOST dindex index() const { return m_desc.index(); }
+
+    DETRAY_HOST
+    const typename detector_t::transform3_type &transform() const {
+        return m_trf;
+    }
+
+    const typename detector_t::volume_type &m_desc;
+    const typename detector_t::transform3_type &m_trf;
+};
+
+}  // namespace detail
+
 /// @brief Build a grid of a certain shape.
 ///
 /// Decorator class to a volume builder that adds a grid as the volumes
@@ -61,6 +83,17 @@ class grid_builder : public volume_decorator<detector_t> {
         m_add_passives = is_add_passive;
     }
 
+    /// Should the grid bins also hold the portals through which tracks from
+    /// the reference point @param ref_point leave the volume? The navigator
+    /// then only intersects these portals (see @c binned_portals in the
+    /// navigation config). The bin capacities need to leave room for them.
+    void set_add_portals(
+        bool is_add_portal = true,
+        const typename detector_t::point3_type &ref_point = {0.f, 0.f, 0.f}) {
+        m_add_portals = is_add_portal;
+        m_portal_ref_point = ref_point;
+    }
+
     /// Set the surface category this grid should contain (type id in the
     /// accelrator link in the volume)
     void set_type(std::size_t sf_id) {
@@ -78,6 +111,16 @@ class grid_builder : public volume_decorator<detector_t> {
         m_id = sf_id;
     }
 
+    /// Set the bin filling strategy @param filler that is used when the
+    /// grid is filled during the build (e.g. the number of threads)
+    void set_bin_filler(const bin_filler_t &filler) { m_bin_filler = filler; }
+
+    /// Use a lookup table for the bin search on irregular axes (needs to be
+    /// set before the grid is initialized)
+    void set_irregular_lookup(const bool use_lookup = true) {
+        m_factory.set_irregular_lookup(use_lookup);
+    }
+
     /// Delegate init call depending on @param span type
     template <typename grid_shape_t>
     DETRAY_HOST void init_grid(
@@ -110,6 +153,56 @@ class grid_builder : public volume_decorator<detector_t> {
             spans, n_bins, bin_capacities, ax_bin_edges);
     }
 
+    /// Choose the binning of the grid automatically from the surfaces of the
+    /// volume, when the grid is filled during the build (instead of calling
+    /// @c init_grid )
+    ///
+    /// @param spans the axis spans (min and max per axis)
+    /// @param cfg target entries per bin and memory budget
+    DETRAY_HOST void set_auto_binning(
+        const std::vector<scalar_type> &spans,
+        const grid_binning_config<scalar_type> &cfg = {}) {
+        m_auto_spans = spans;
+        m_binning_cfg = cfg;
+    }
+
+    /// Build the empty grid with a binning that is chosen from the positions
+    /// of the surfaces @param surfaces in the volume @param vol
+    ///
+    /// @param spans the axis spans (min and max per axis)
+    /// @param cfg target entries per bin and memory budget
+    ///
+    /// @returns a summary of the chosen binning
+    template <typename volume_type, typename surface_container_t,
+              typename transform_container_t>
+    DETRAY_HOST const grid_binning_report<grid_t::dim> &init_grid(
+        const volume_type &vol, const surface_container_t &surfaces,
+        const transform_container_t &transforms,
+        const std::vector<scalar_type> &spans,
+        const grid_binning_config<scalar_type> &cfg = {},
+        const typename detector_t::geometry_context ctx = {}) {
+
+        std::vector<typename grid_t::point_type> positions{};
+        positions.reserve(surfaces.size());
+        for (const auto &sf : surfaces) {
+            const auto &t = transforms.at(sf.transform(), ctx).translation();
+            positions.push_back(grid_t::local_frame_type::global_to_local(
+                vol.transform(), t, t));
+        }
+
+        const auto binning{find_grid_binning<grid_t>(positions, spans, cfg)};
+        init_grid(spans, binning.n_bins, {}, binning.bin_edges);
+        m_binning_report = binning.report;
+
+        return m_binning_report;
+    }
+
+    /// @returns the summary of the automatic binning
+    DETRAY_HOST
+    const grid_binning_report<grid_t::dim> &binning_report() const {
+        return m_binning_report;
+    }
+
     /// Fill grid from existing volume using a bin filling strategy
     /// This can also be called without a volume builder
     template <typename volume_type, typename... Args>
@@ -121,6 +214,17 @@ class grid_builder : public volume_decorator<detector_t> {
         bin_filler(m_grid, det, vol, ctx, args...);
     }
 
+    /// Add the exit portals of the volume @param vol to the bins of the grid
+    /// (the portals must be part of the detector @param det already)
+    ///
+    /// @param ref_point the origin of the tracks, e.g. the interaction region
+    template <typename volume_type>
+    DETRAY_HOST void fill_portals(
+        const detector_t &det, const volume_type &vol,
+        const typename detector_t::point3_type &ref_point = {0.f, 0.f, 0.f}) {
+        detail::portal_association(m_grid, det, vol, ref_point);
+    }
+
     /// Fill grid from externally provided surfaces - temporary solution until
     /// the volume builders can be deployed in the toy detector
     template <typename volume_type, typename surface_container_t,
@@ -135,6 +239,54 @@ class grid_builder : public volume_decorator<detector_t> {
         bin_filler(m_grid, vol, surfaces, transforms, masks, ctx, args...);
     }
 
+    /// Fill the grid from the surfaces of the volume builder, before they
+    /// are added to the detector. The grid entries then contain the
+    /// volume-local surface indices and are linked to the detector surfaces
+    /// in @c build()
+    DETRAY_HOST
+    void prepare(typename detector_t::geometry_context ctx = {}) override {
+
+        using surface_desc_t = typename detector_t::surface_type;
+
+        // Stand-alone grid builder
+        if (!this->m_builder) {
+            return;
+        }
+
+        volume_decorator<detector_t>::prepare(ctx);
+
+        // The grid was prefilled (e.g. from file IO)
+        if (m_grid.size() != 0u) {
+            return;
+        }
+
+        // The position of a surface in the builder is its local index
+        std::vector<surface_desc_t> surfaces{};
+        dindex local_idx{0u};
+        for (const auto &sf : this->surfaces()) {
+
+            auto sf_desc{static_cast<surface_desc_t>(sf)};
+            sf_desc.set_index(local_idx++);
+
+            if (sf_desc.is_sensitive() or
+                (m_add_passives and sf_desc.is_passive())) {
+                surfaces.push_back(sf_desc);
+            }
+        }
+
+        const detail::staged_volume<detector_t> vol{
+            volume_decorator<detector_t>::operator()(),
+            this->volume_placement()};
+
+        if (!m_auto_spans.empty()) {
+            init_grid(vol, surfaces, this->transforms(), m_auto_spans,
+                      m_binning_cfg, ctx);
+        }
+
+        this->fill_grid(vol, surfaces, this->transforms(), this->masks(), ctx,
+                        m_bin_filler);
+    }
+
     /// Add the volume and the grid to the detector @param det
     DETRAY_HOST
     auto build(detector_t &det, typename detector_t::geometry_context ctx = {})
@@ -161,29 +313,40 @@ class grid_builder : public volume_decorator<detector_t> {
                 }
             }
 
-            this->fill_grid(
-                detector_volume{det,
-                                volume_decorator<detector_t>::operator()()},
-                surfaces, det.transform_store(), det.mask_store(), ctx);
+            const auto grid_vol = detector_volume{
+                det, volume_decorator<detector_t>::operator()()};
+
+            if (!m_auto_spans.empty()) {
+                init_grid(grid_vol, surfaces, det.transform_store(),
+                          m_auto_spans, m_binning_cfg, ctx);
+            }
+
+            this->fill_grid(grid_vol, surfaces, det.transform_store(),
+                            det.mask_store(), ctx, m_bin_filler);
         } else {
-            // The grid is prefilled with surface descriptors that contain the
-            // correct LOCAL surface indices per bin (e.g. from file IO).
+            // The grid is prefilled with surface descriptors (or compressed
+            // surface entries) that contain the correct LOCAL surface indices
+            // per bin (e.g. from file IO).
             // Now add the rest of the linking information, which is only
             // available after the volume builder ran
-            for (surface_desc_t &sf_desc : m_grid.all()) {
+            for (auto &entry : m_grid.all()) {
 
-                assert(!detail::is_invalid_value(sf_desc.index()));
+                assert(!detail::is_invalid_value(entry.index()));
 
-                dindex glob_idx{vol_ptr->to_global_sf_index(sf_desc.index())};
+                dindex glob_idx{vol_ptr->to_global_sf_index(entry.index())};
                 const auto &new_sf_desc = det.surface(glob_idx);
 
                 assert(new_sf_desc.index() == glob_idx);
                 assert(!new_sf_desc.barcode().is_invalid());
 
-                sf_desc = new_sf_desc;
+                entry = new_sf_desc;
             }
         }
 
+        if (m_add_portals) {
+            fill_portals(det, *vol_ptr, m_portal_ref_point);
+        }
+
         // Add the grid to the detector and link it to its volume
         constexpr auto gid{detector_t::accel::template get_id<grid_t>()};
         det.accelerator_store().template push_back<gid>(m_grid);
@@ -203,6 +366,12 @@ class grid_builder : public volume_decorator<detector_t> {
     typename grid_t::template type<true> m_grid{};
     bin_filler_t m_bin_filler{};
     bool m_add_passives{false};
+    bool m_add_portals{false};
+    typename detector_t::point3_type m_portal_ref_point{0.f, 0.f, 0.f};
+    /// Axis spans for the automatic binning (not used if empty)
+    std::vector<scalar_type> m_auto_spans{};
+    grid_binning_config<scalar_type> m_binning_cfg{};
+    grid_binning_report<grid_t::dim> m_binning_report{};
 };
 
 /// Grid builder from single components
@@ -61,6 +61,11 @@ class grid_factory {
     explicit grid_factory(vecmem::memory_resource &resource)
         : m_resource(&resource) {}
 
+    /// Build a lookup table for the bin search on irregular axes
+    void set_irregular_lookup(const bool use_lookup = true) {
+        m_irregular_lookup = use_lookup;
+    }
+
     /// Print grid - up to three dimensions
     /// @note will likely become obsolete with the actsvg implementation
     template <typename grid_t>
@@ -578,12 +583,22 @@ class grid_factory {
             bin_edges.push_back(spans.at(I * 2u));
             bin_edges.push_back(spans.at(I * 2u + 1u));
         } else {
+            using irregular_t =
+                axis::irregular<host_container_types, scalar_type>;
+
             const auto &bin_edges_loc = ax_bin_edges.at(I);
+            auto n_bins_loc{static_cast<dindex>(bin_edges_loc.size() - 1u)};
+            if (m_irregular_lookup) {
+                n_bins_loc |= irregular_t::lookup_flag;
+            }
             axes_data.push_back(
-                {static_cast<dindex>(bin_edges.size()),
-                 static_cast<dindex>(bin_edges_loc.size() - 1u)});
+                {static_cast<dindex>(bin_edges.size()), n_bins_loc});
             bin_edges.insert(bin_edges.end(), bin_edges_loc.begin(),
                              bin_edges_loc.end());
+            // The lookup table follows the bin edges
+            if (m_irregular_lookup) {
+                irregular_t::append_lookup(bin_edges_loc, bin_edges);
+            }
         }
     }
 
@@ -602,6 +617,8 @@ class grid_factory {
     }
 
     vecmem::memory_resource *m_resource{};
+    /// Build lookup tables for irregular axes
+    bool m_irregular_lookup{false};
 };
 
 template <typename bin_t, template <std::size_t> class serializer_t,
@@ -65,6 +65,14 @@ class homogeneous_material_builder final : public volume_decorator<detector_t> {
     }
     /// @}
 
+    /// Add the number of staged objects, including the material, to
+    /// @param sizes
+    DETRAY_HOST
+    void count(detail::store_sizes<detector_t> &sizes) override {
+        volume_decorator<detector_t>::count(sizes);
+        sizes.add_materials(m_materials);
+    }
+
     /// Add the volume and the material to the detector @param det
     DETRAY_HOST
     auto build(detector_t &det, typename detector_t::geometry_context ctx = {})
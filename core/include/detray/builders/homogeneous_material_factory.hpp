@@ -279,6 +279,20 @@ class homogeneous_material_factory final
         std::size_t sf_offset{
             *std::min_element(m_indices.begin(), m_indices.end())};
 
+        // Make room for all slabs and rods of this factory at once
+        const auto n_slabs{static_cast<std::size_t>(
+            std::count_if(m_links.begin(), m_links.end(), [](const auto &l) {
+                return l.first == material_id::e_slab;
+            }))};
+        auto &slab_coll = materials.template get<material_id::e_slab>();
+        slab_coll.reserve(slab_coll.size() + n_slabs);
+
+        if constexpr (detector_t::materials::template is_defined<
+                          material_rod<scalar_type>>()) {
+            auto &rod_coll = materials.template get<material_id::e_rod>();
+            rod_coll.reserve(rod_coll.size() + m_links.size() - n_slabs);
+        }
+
         // Add the material to the surfaces that the data links against
         for (auto [i, sf] : detray::views::pick(surfaces, m_indices)) {
             std::size_t sf_idx{i - sf_offset};
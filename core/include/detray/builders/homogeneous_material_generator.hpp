@@ -113,6 +113,10 @@ class homogeneous_material_generator final
     /// Create material slabs or rods for all surfaces that the undelying
     /// surface factory builds.
     ///
+    /// The material of the whole surface range is added in bulk: The number
+    /// of slabs and rods is counted first, so that the material collections
+    /// of the volume are only grown once per call.
+    ///
     /// @param surfaces surface container of the volume builder that should get
     ///                 decorated with material.
     /// @param material material store of the volume builder that the new
@@ -124,74 +128,59 @@ class homogeneous_material_generator final
         using material_id = typename detector_t::materials::id;
         using link_t = typename detector_t::surface_type::material_link;
 
-        // Add the material to the surfaces that the data links against
-        for (auto &sf : detray::ranges::subrange(surfaces, m_surface_range)) {
+        auto sf_range = detray::ranges::subrange(surfaces, m_surface_range);
 
-            const material<scalar_t> *mat_ptr{nullptr};
+        // Count the material slabs and rods that will be added
+        std::size_t n_slabs{0u};
+        [[maybe_unused]] std::size_t n_rods{0u};
+        for (const auto &sf : sf_range) {
+            if (get_material(sf) == nullptr) {
+                continue;
+            }
+            if (is_line(sf)) {
+                ++n_rods;
+            } else {
+                ++n_slabs;
+            }
+        }
 
-            // Get the correct material for this surface type
-            constexpr vacuum<scalar_t> vac{};
-            switch (sf.id()) {
-                case surface_id::e_passive: {
-                    const auto &mat = m_cfg.passive_material();
-                    mat_ptr = (mat != vac) ? &mat : nullptr;
-                    break;
-                }
-                case surface_id::e_sensitive: {
-                    const auto &mat = m_cfg.sensitive_material();
-                    mat_ptr = (mat != vac) ? &mat : nullptr;
-                    break;
-                }
-                case surface_id::e_portal: {
-                    const auto &mat = m_cfg.portal_material();
-                    mat_ptr = (mat != vac) ? &mat : nullptr;
-                    break;
-                }
-                case surface_id::e_unknown: {
-                    throw std::runtime_error(
-                        "Encountered surface of unknown type during material "
-                        "generation");
-                    break;
-                }
-            };
+        auto &slab_coll = materials.template get<material_id::e_slab>();
+        slab_coll.reserve(slab_coll.size() + n_slabs);
+
+        if constexpr (detector_t::materials::template is_defined<
+                          material_rod<scalar_t>>()) {
+            auto &rod_coll = materials.template get<material_id::e_rod>();
+            rod_coll.reserve(rod_coll.size() + n_rods);
+        }
+
+        // Add the material to the surfaces that the data links against
+        for (auto &sf : sf_range) {
 
             // Found suitable material for this surface?
+            const material<scalar_t> *mat_ptr = get_material(sf);
             if (mat_ptr == nullptr) {
                 continue;
             }
 
-            // Handle line shaped surfaces differently
-            bool is_line{false};
             link_t mat_link;
 
-            if constexpr (detector_t::materials::template is_defined<
-                              material_rod<scalar_t>>()) {
-
-                using mask_id = typename detector_t::masks::id;
-
+            if (is_line(sf)) {
                 // If the current surface is a line, generate a material rod
-                const mask_id sf_mask_id = sf.mask().id();
-                if (sf_mask_id == mask_id::e_straw_tube ||
-                    sf_mask_id == mask_id::e_drift_cell) {
-
-                    is_line = true;
-
-                    auto &mat_coll =
+                if constexpr (detector_t::materials::template is_defined<
+                                  material_rod<scalar_t>>()) {
+                    auto &rod_coll =
                         materials.template get<material_id::e_rod>();
-                    mat_coll.emplace_back(*mat_ptr, m_cfg.thickness());
+                    rod_coll.emplace_back(*mat_ptr, m_cfg.thickness());
 
                     mat_link = {material_id::e_rod,
-                                static_cast<dindex>(mat_coll.size() - 1u)};
+                                static_cast<dindex>(rod_coll.size() - 1u)};
                 }
-            }
-
-            // For all surfaces that are not lines, generate a material slab
-            if (!is_line) {
-                auto &mat_coll = materials.template get<material_id::e_slab>();
-                mat_coll.emplace_back(*mat_ptr, m_cfg.thickness());
+            } else {
+                // For all other surfaces, generate a material slab
+                slab_coll.emplace_back(*mat_ptr, m_cfg.thickness());
 
                 mat_link = {material_id::e_slab,
-                            static_cast<dindex>(mat_coll.size() - 1u)};
+                            static_cast<dindex>(slab_coll.size() - 1u)};
             }
 
             // Set the initial surface material link (will be updated when
@@ -201,6 +190,59 @@ class homogeneous_material_generator final
     }
 
     private:
+    /// @returns the configured material for the type of the surface
+    /// @param sf, or nullptr if the surface should not receive material
+    template <typename surface_desc_t>
+    DETRAY_HOST const material<scalar_t> *get_material(
+        const surface_desc_t &sf) const {
+
+        const material<scalar_t> *mat_ptr{nullptr};
+
+        // Get the correct material for this surface type
+        constexpr vacuum<scalar_t> vac{};
+        switch (sf.id()) {
+            case surface_id::e_passive: {
+                const auto &mat = m_cfg.passive_material();
+                mat_ptr = (mat != vac) ? &mat : nullptr;
+                break;
+            }
+            case surface_id::e_sensitive: {
+                const auto &mat = m_cfg.sensitive_material();
+                mat_ptr = (mat != vac) ? &mat : nullptr;
+                break;
+            }
+            case surface_id::e_portal: {
+                const auto &mat = m_cfg.portal_material();
+                mat_ptr = (mat != vac) ? &mat : nullptr;
+                break;
+            }
+            case surface_id::e_unknown: {
+                throw std::runtime_error(
+                    "Encountered surface of unknown type during material "
+                    "generation");
+                break;
+            }
+        };
+
+        return mat_ptr;
+    }
+
+    /// @returns whether the surface @param sf is a line surface that
+    /// receives a material rod instead of a slab
+    template <typename surface_desc_t>
+    DETRAY_HOST bool is_line([[maybe_unused]] const surface_desc_t &sf) const {
+        if constexpr (detector_t::materials::template is_defined<
+                          material_rod<scalar_t>>()) {
+            using mask_id = typename detector_t::masks::id;
+
+            const mask_id sf_mask_id = sf.mask().id();
+            return (sf_mask_id == mask_id::e_straw_tube ||
+                    sf_mask_id == mask_id::e_drift_cell);
+        } else {
+            return false;
+        }
+    }
+
     /// Material generator configuration
     hom_material_config<scalar_t> m_cfg;
     /// Range of surface indices for which to generate material
@@ -0,0 +1,349 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/builders/detector_builder.hpp"
+#include "detray/builders/homogeneous_material_builder.hpp"
+#include "detray/builders/homogeneous_material_factory.hpp"
+#include "detray/builders/surface_factory.hpp"
+#include "detray/builders/volume_builder.hpp"
+#include "detray/builders/volume_builder_interface.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/geometry.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/geometry/detector_volume.hpp"
+#include "detray/geometry/shapes/concentric_cylinder2D.hpp"
+#include "detray/geometry/shapes/cylinder2D.hpp"
+#include "detray/geometry/shapes/ring2D.hpp"
+#include "detray/geometry/surface.hpp"
+#include "detray/materials/material.hpp"
+#include "detray/materials/predefined_materials.hpp"
+#include "detray/utils/type_traits.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace detray {
+
+namespace detail {
+
+/// Averaged material of a surface: The material with the largest
+/// contribution and the mean thickness in units of X0
+template <typename scalar_t>
+using material_budget = std::pair<material<scalar_t>, scalar_t>;
+
+/// A functor that averages the material of a surface (homogeneous material or
+/// material map) into a @c material_budget
+template <typename scalar_t>
+struct material_budget_getter {
+
+    template <typename mat_group_t, typename index_t>
+    DETRAY_HOST inline auto operator()(const mat_group_t &mat_group,
+                                       const index_t &idx) const
+        -> material_budget<scalar_t> {
+        using material_t = typename mat_group_t::value_type;
+
+        material_budget<scalar_t> budget{vacuum<scalar_t>{}, 0.f};
+
+        // Material maps: Mean over the (equally sized) bins
+        if constexpr (is_material_map_v<material_t>) {
+            scalar_t max_t_X0{0.f};
+            std::size_t n_bins{0u};
+            for (const auto &slab : mat_group[idx].all()) {
+                ++n_bins;
+                if (!slab) {
+                    continue;
+                }
+                const scalar_t t_X0{slab.thickness() /
+                                    slab.get_material().X0()};
+                budget.second += t_X0;
+                if (t_X0 > max_t_X0) {
+                    max_t_X0 = t_X0;
+                    budget.first = slab.get_material();
+                }
+            }
+            if (n_bins > 0u) {
+                budget.second /= static_cast<scalar_t>(n_bins);
+            }
+        }
+        // Slabs and rods (raw volume material has no thickness)
+        else if constexpr (is_hom_material_v<material_t> &&
+                           !std::is_same_v<material_t, material<scalar_t>>) {
+            const auto &mat = mat_group[idx];
+            if (mat) {
+                budget.first = mat.get_material();
+                budget.second = mat.thickness() / mat.get_material().X0();
+            }
+        }
+
+        return budget;
+    }
+};
+
+/// A functor that returns the area of a surface mask
+struct mask_area_getter {
+
+    template <typename mask_group_t, typename index_t>
+    DETRAY_HOST inline auto operator()(const mask_group_t &mask_group,
+                                       const index_t &idx) const {
+        return mask_group[idx].area();
+    }
+};
+
+/// Add the surfaces of the factory @param sf_factory to the volume builder
+/// @param v_builder , with a slab of the equivalent material @param budget ,
+/// if it is not empty
+template <typename detector_t, typename factory_t>
+DETRAY_HOST inline void add_with_material(
+    std::unique_ptr<factory_t> sf_factory,
+    const material_budget<typename detector_t::scalar_type> &budget,
+    volume_builder_interface<detector_t> &v_builder,
+    const typename detector_t::geometry_context &ctx) {
+
+    using material_id = typename detector_t::materials::id;
+
+    if (budget.second <= 0.f) {
+        v_builder.add_surfaces(std::move(sf_factory), ctx);
+        return;
+    }
+
+    auto mat_factory =
+        std::make_shared<homogeneous_material_factory<detector_t>>(
+            std::move(sf_factory));
+    mat_factory->add_material(
+        material_id::e_slab,
+        {budget.second * budget.first.X0(), budget.first});
+
+    v_builder.add_surfaces(mat_factory, ctx);
+}
+
+/// A functor that copies a surface (placement, mask and volume link) into a
+/// volume builder of the low-detail detector
+template <typename detector_t>
+struct surface_copier {
+
+    template <typename mask_group_t, typename index_t, typename transform3_t>
+    DETRAY_HOST inline void operator()(
+        const mask_group_t &mask_group, const index_t &idx,
+        const transform3_t &trf, const surface_id sf_id,
+        const std::uint64_t source,
+        const material_budget<typename detector_t::scalar_type> &budget,
+        volume_builder_interface<detector_t> &v_builder,
+        const typename detector_t::geometry_context &ctx) const {
+
+        using scalar_t = typename detector_t::scalar_type;
+        using shape_t = typename mask_group_t::value_type::shape;
+
+        const auto &mask = mask_group[idx];
+
+        auto sf_factory =
+            std::make_unique<surface_factory<detector_t, shape_t>>();
+        sf_factory->push_back(
+            {sf_id, trf, mask.volume_link(),
+             std::vector<scalar_t>(mask.values().begin(), mask.values().end()),
+             dindex_invalid, source});
+
+        add_with_material(std::move(sf_factory), budget, v_builder, ctx);
+    }
+};
+
+}  // namespace detail
+
+/// @brief Derives a low-detail version of the detector @param det .
+///
+/// Every volume of @param det is rebuilt in the same order, so that the volume
+/// indices, the portal links and the volume names stay valid. The portals and
+/// passive surfaces are copied, while the sensitive surfaces of a volume (one
+/// layer per volume) are merged into a single surface: a cylinder, if the
+/// modules extend further in z than in r (barrel), and a disc otherwise
+/// (endcap). The cylinder is placed at the mean radius of the module centers,
+/// the disc at their mean z position. Both cover the full extent of the
+/// modules.
+///
+/// The material of the merged surface is a single slab of the material with
+/// the largest contribution, which holds the mean material budget (in X0) of
+/// the modules over the layer area. Material maps are averaged over their
+/// bins and, like the portal and passive surface material, replaced by
+/// homogeneous slabs. Volume material is not transferred.
+///
+/// The result is meant for seeding-level propagation, e.g. to quickly
+/// estimate the material and the volume sequence along a track, where the
+/// navigation through the individual modules is not needed.
+///
+/// @tparam out_metadata_t the metadata of the low-detail detector. It can be
+///                        the same or a lighter version of the metadata of
+///                        @param det , but needs the shapes of the portals and
+///                        passives, a ring2D and either a concentric_cylinder2D
+///                        or a cylinder2D mask and material slabs.
+///
+/// @param resource the memory resource of the low-detail detector
+/// @param ctx the geometry context in which @param det is evaluated
+template <typename out_metadata_t, typename detector_t>
+DETRAY_HOST inline auto build_low_detail_detector(
+    const detector_t &det, vecmem::memory_resource &resource,
+    const typename detector_t::geometry_context ctx = {}) {
+
+    using builder_t = detector_builder<out_metadata_t, volume_builder>;
+    using out_detector_t = typename builder_t::detector_type;
+    using scalar_t = typename detector_t::scalar_type;
+    using point3_t = typename detector_t::point3_type;
+    using transform3_t = typename out_detector_t::transform3_type;
+    using nav_link_t = typename out_detector_t::surface_type::navigation_link;
+    using budget_t = detail::material_budget<scalar_t>;
+
+    static_assert(
+        std::is_same_v<scalar_t, typename out_detector_t::scalar_type>,
+        "The low-detail detector needs the same scalar type");
+
+    // Prefer the cheaper concentric cylinder for the barrel layers
+    using cylinder_shape_t = std::conditional_t<
+        out_detector_t::masks::template is_defined<
+            mask<concentric_cylinder2D, nav_link_t>>(),
+        concentric_cylinder2D, cylinder2D>;
+
+    const typename out_detector_t::geometry_context out_ctx{};
+    constexpr scalar_t inv{std::numeric_limits<scalar_t>::max()};
+    // Number of segments to approximate the edges of curved modules
+    constexpr dindex n_seg{10u};
+
+    builder_t det_builder{};
+
+    for (const auto &vol_desc : det.volumes()) {
+        const auto vol = detector_volume{det, vol_desc};
+
+        volume_builder_interface<out_detector_t> *v_builder =
+            det_builder.new_volume(vol.id());
+        v_builder->add_volume_placement(vol.transform());
+        v_builder = det_builder.template decorate<
+            homogeneous_material_builder<out_detector_t>>(v_builder);
+
+        // Extent and material of the layer
+        scalar_t r_min{inv};
+        scalar_t r_max{-inv};
+        scalar_t z_min{inv};
+        scalar_t z_max{-inv};
+        scalar_t sum_r{0.f};
+        scalar_t sum_z{0.f};
+        std::size_t n_modules{0u};
+        // Sum of area times thickness in X0 per material
+        std::vector<budget_t> contributions{};
+
+        for (const auto &sf_desc : vol.surfaces()) {
+            const auto sf = surface{det, sf_desc};
+
+            budget_t budget{vacuum<scalar_t>{}, 0.f};
+            if (sf.has_material()) {
+                budget = sf.template visit_material<
+                    detail::material_budget_getter<scalar_t>>();
+            }
+
+            // Keep portals and passives as they are
+            if (!sf.is_sensitive()) {
+                sf.template visit_mask<detail::surface_copier<out_detector_t>>(
+                    sf.transform(ctx), sf.id(),
+                    static_cast<std::uint64_t>(sf.source()), budget,
+                    *v_builder, out_ctx);
+                continue;
+            }
+
+            for (const point3_t &vtx : sf.global_vertices(ctx, n_seg)) {
+                const scalar_t r{getter::perp(vtx)};
+                r_min = math::min(r_min, r);
+                r_max = math::max(r_max, r);
+                z_min = math::min(z_min, vtx[2]);
+                z_max = math::max(z_max, vtx[2]);
+            }
+            const point3_t center{sf.center(ctx)};
+            sum_r += getter::perp(center);
+            sum_z += center[2];
+            ++n_modules;
+
+            if (budget.second > 0.f) {
+                const scalar_t area{
+                    sf.template visit_mask<detail::mask_area_getter>()};
+                auto itr = std::find_if(
+                    contributions.begin(), contributions.end(),
+                    [&budget](const budget_t &c) {
+                        return c.first == budget.first;
+                    });
+                if (itr == contributions.end()) {
+                    contributions.emplace_back(budget.first, 0.f);
+                    itr = std::prev(contributions.end());
+                }
+                itr->second += area * budget.second;
+            }
+        }
+
+        if (n_modules == 0u) {
+            continue;
+        }
+
+        // Equivalent material: the dominant material with the mean budget
+        budget_t layer_budget{vacuum<scalar_t>{}, 0.f};
+        if (!contributions.empty()) {
+            layer_budget.first =
+                std::max_element(contributions.begin(), contributions.end(),
+                                 [](const budget_t &a, const budget_t &b) {
+                                     return a.second < b.second;
+                                 })
+                    ->first;
+            for (const budget_t &c : contributions) {
+                layer_budget.second += c.second;
+            }
+        }
+
+        const scalar_t n{static_cast<scalar_t>(n_modules)};
+        const auto link{static_cast<nav_link_t>(vol.index())};
+
+        if (z_max - z_min > r_max - r_min) {
+            // Barrel layer
+            const scalar_t r{sum_r / n};
+            const scalar_t area{2.f * constant<scalar_t>::pi * r *
+                                (z_max - z_min)};
+            layer_budget.second /= area;
+
+            auto sf_factory = std::make_unique<
+                surface_factory<out_detector_t, cylinder_shape_t>>();
+            sf_factory->push_back({surface_id::e_sensitive, transform3_t{},
+                                   link,
+                                   std::vector<scalar_t>{r, z_min, z_max}});
+            detail::add_with_material(std::move(sf_factory), layer_budget,
+                                      *v_builder, out_ctx);
+        } else {
+            // Endcap layer
+            const scalar_t area{constant<scalar_t>::pi *
+                                (r_max * r_max - r_min * r_min)};
+            layer_budget.second /= area;
+
+            auto sf_factory =
+                std::make_unique<surface_factory<out_detector_t, ring2D>>();
+            sf_factory->push_back(
+                {surface_id::e_sensitive, transform3_t{point3_t{0.f, 0.f,
+                                                                sum_z / n}},
+                 link, std::vector<scalar_t>{r_min, r_max}});
+            detail::add_with_material(std::move(sf_factory), layer_budget,
+                                      *v_builder, out_ctx);
+        }
+    }
+
+    return det_builder.build(resource);
+}
+
+}  // namespace detray
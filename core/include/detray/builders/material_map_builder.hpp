@@ -9,6 +9,7 @@
 
 // Project include(s).
 #include "detray/builders/bin_fillers.hpp"
+#include "detray/builders/detail/material_map_merging.hpp"
 #include "detray/builders/grid_factory.hpp"
 #include "detray/builders/material_map_factory.hpp"
 #include "detray/builders/surface_factory_interface.hpp"
@@ -21,6 +22,7 @@
 #include <cassert>
 #include <map>
 #include <memory>
+#include <ostream>
 #include <stdexcept>
 #include <vector>
 
@@ -35,6 +37,43 @@ struct add_sf_material_map;
 
 }  // namespace detail
 
+/// Number of material map bins before and after merging similar bins
+struct material_map_compression {
+    /// Number of material maps that were merged
+    std::size_t n_maps{0u};
+    /// Number of maps that were reduced to a single bin
+    std::size_t n_homogeneous{0u};
+    /// Total number of bins before and after the merging
+    std::size_t n_bins_in{0u};
+    std::size_t n_bins_out{0u};
+
+    /// @returns the ratio of the number of bins before and after merging
+    double ratio() const {
+        return n_bins_out == 0u ? 1.
+                                : static_cast<double>(n_bins_in) /
+                                      static_cast<double>(n_bins_out);
+    }
+
+    /// Add the statistics of @param other
+    material_map_compression &operator+=(
+        const material_map_compression &other) {
+        n_maps += other.n_maps;
+        n_homogeneous += other.n_homogeneous;
+        n_bins_in += other.n_bins_in;
+        n_bins_out += other.n_bins_out;
+        return *this;
+    }
+
+    /// Print the statistics
+    friend std::ostream &operator<<(std::ostream &os,
+                                    const material_map_compression &c) {
+        os << "material maps: " << c.n_maps << " (homogeneous "
+           << c.n_homogeneous << ") | bins: " << c.n_bins_in << " -> "
+           << c.n_bins_out << " | compression: " << c.ratio();
+        return os;
+    }
+};
+
 /// @brief Build the material maps for a given volume.
 ///
 /// Decorator class to a volume builder that adds material maps to either
@@ -66,6 +105,20 @@ class material_map_builder : public volume_decorator<detector_t> {
         return m_bin_data;
     }
 
+    /// Merge neighbouring bins of the material maps, if their material slabs
+    /// agree within the relative tolerance @param rel_tol (thickness, X0, L0
+    /// and mass density). A negative tolerance switches the merging off.
+    DETRAY_HOST
+    void set_bin_merging(const scalar_type rel_tol) {
+        m_merge_tolerance = rel_tol;
+    }
+
+    /// @returns the number of bins that were removed by the bin merging
+    DETRAY_HOST
+    auto compression() const -> const material_map_compression& {
+        return m_compression;
+    }
+
     /// Not needed for material maps builder
     DETRAY_HOST void init_grid(const std::vector<scalar_type>&,
                                const std::vector<std::size_t>&,
@@ -96,6 +149,11 @@ class material_map_builder : public volume_decorator<detector_t> {
     auto build(detector_t& det, typename detector_t::geometry_context ctx = {})
         -> typename detector_t::volume_type* override {
 
+        // Reduce the map resolution before the maps are built
+        if (m_merge_tolerance >= 0.f) {
+            merge_bins();
+        }
+
         // Ensure the material links are correct BEFORE the surfaces are built
         // and potentially added to an acceleration data structure
         update_material_links(det);
@@ -130,6 +188,34 @@ class material_map_builder : public volume_decorator<detector_t> {
     }
 
     private:
+    /// Merge the similar bins of every material map
+    void merge_bins() {
+        for (auto& [sf_idx, bin_data] : m_bin_data) {
+            auto& n_bins = m_n_bins.at(sf_idx);
+
+            material_map_compression stats{};
+            stats.n_maps = 1u;
+            stats.n_bins_in = n_total_bins(n_bins);
+
+            detail::merge_material_bins(bin_data, n_bins, m_merge_tolerance);
+
+            stats.n_bins_out = n_total_bins(n_bins);
+            stats.n_homogeneous = (stats.n_bins_out == 1u) ? 1u : 0u;
+
+            m_compression += stats;
+        }
+    }
+
+    /// @returns the total number of bins of a map with @param n_bins per axis
+    static std::size_t n_total_bins(
+        const std::array<std::size_t, DIM>& n_bins) {
+        std::size_t n{1u};
+        for (const std::size_t n_ax : n_bins) {
+            n *= n_ax;
+        }
+        return n;
+    }
+
     /// Check whether a surface with a given index @param sf_idx should receive
     /// material
     bool surface_has_map(const dindex sf_idx) {
@@ -182,6 +268,10 @@ class material_map_builder : public volume_decorator<detector_t> {
     std::map<dindex, std::array<std::size_t, DIM>> m_n_bins{};
     /// Helper to generate empty grids
     mat_map_factory_t m_factory{};
+    /// Relative tolerance for the bin merging (negative: no merging)
+    scalar_type m_merge_tolerance{-1.f};
+    /// Bin counts of the merged maps
+    material_map_compression m_compression{};
 };
 
 namespace detail {
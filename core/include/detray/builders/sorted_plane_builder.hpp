@@ -0,0 +1,134 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/builders/volume_builder.hpp"
+#include "detray/builders/volume_builder_interface.hpp"
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/geometry/detector_volume.hpp"
+
+// System include(s)
+#include <cassert>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace detray {
+
+/// @brief Sort the planes of a volume along an axis.
+///
+/// Decorator class to a volume builder that adds a sorted plane collection
+/// as the volumes geometry accelerator structure. If no axis is given, the
+/// axis runs from the center of the first to the center of the last surface
+/// that was added to the volume (e.g. along the pilot track of a telescope).
+///
+/// @tparam detector_t the detector type
+/// @tparam plane_collection_t the type of the sorted plane collection in the
+///                            detector accelerator store
+template <typename detector_t, typename plane_collection_t>
+class sorted_plane_builder : public volume_decorator<detector_t> {
+
+    using link_id_t = typename detector_t::volume_type::object_id;
+    using axis_t = typename plane_collection_t::axis_type;
+    using point3_t = typename detector_t::point3_type;
+    using vector3_t = typename detector_t::vector3_type;
+
+    public:
+    using scalar_type = typename detector_t::scalar_type;
+    using detector_type = detector_t;
+    using value_type = typename detector_type::surface_type;
+
+    /// Decorate a volume with a sorted plane collection
+    DETRAY_HOST
+    sorted_plane_builder(
+        std::unique_ptr<volume_builder_interface<detector_t>> vol_builder)
+        : volume_decorator<detector_t>(std::move(vol_builder)) {
+        // The plane collection provides an acceleration structure to the
+        // volume, so don't add sensitive surfaces to the brute force method
+        if (this->m_builder) {
+            this->m_builder->has_accel(true);
+        }
+    }
+
+    /// Should the passive surfaces be added to the sorted planes ?
+    void set_add_passives(bool is_add_passive = true) {
+        m_add_passives = is_add_passive;
+    }
+
+    /// Set the surface category the planes should contain (type id in the
+    /// accelrator link in the volume)
+    void set_type(link_id_t sf_id) {
+        // Exclude zero, it is reserved for the brute force method
+        assert(static_cast<int>(sf_id) > 0);
+        // Make sure the id fits in the volume accelerator link
+        assert(sf_id < link_id_t::e_size);
+
+        m_id = sf_id;
+    }
+
+    /// Set the axis along which to sort the planes by a point @param origin
+    /// and a direction @param dir
+    void set_axis(const point3_t &origin, const vector3_t &dir) {
+        const vector3_t u{vector::normalize(dir)};
+        m_axis = axis_t{{origin[0], origin[1], origin[2]}, {u[0], u[1], u[2]}};
+    }
+
+    /// Add the volume and the sorted planes to the detector @param det
+    DETRAY_HOST
+    auto build(detector_t &det, typename detector_t::geometry_context ctx = {})
+        -> typename detector_t::volume_type * override {
+
+        // Add the surfaces (portals and/or passives) that are owned by the vol
+        typename detector_t::volume_type *vol_ptr =
+            volume_decorator<detector_t>::build(det, ctx);
+
+        const auto vol = detector_volume{det, vol_ptr->index()};
+
+        // Find the surfaces that should be sorted
+        std::vector<value_type> surfaces{};
+        std::vector<point3_t> centers{};
+        for (const auto &sf_desc : vol.surfaces()) {
+            if (sf_desc.is_sensitive() or
+                (m_add_passives and sf_desc.is_passive())) {
+                surfaces.push_back(sf_desc);
+                centers.push_back(
+                    det.transform_store().at(sf_desc.transform(), ctx)
+                        .translation());
+            }
+        }
+
+        axis_t axis{};
+        if (m_axis.has_value()) {
+            axis = *m_axis;
+        } else if (centers.size() > 1u) {
+            const vector3_t d{centers.back() - centers.front()};
+            if (getter::norm(d) > 0.f) {
+                const vector3_t u{vector::normalize(d)};
+                const point3_t &o = centers.front();
+                axis = axis_t{{o[0], o[1], o[2]}, {u[0], u[1], u[2]}};
+            }
+        }
+
+        // Add the planes to the detector and link them to their volume
+        constexpr auto pid{detector_t::accel::template get_id<
+            typename plane_collection_t::value_type>()};
+        auto &plane_coll = det.accelerator_store().template get<pid>();
+        plane_coll.push_back(surfaces, centers, axis);
+        vol_ptr->set_link(m_id, pid, plane_coll.size() - 1u);
+
+        return vol_ptr;
+    }
+
+    protected:
+    link_id_t m_id{link_id_t::e_sensitive};
+    std::optional<axis_t> m_axis{};
+    bool m_add_passives{false};
+};
+
+}  // namespace detray
@@ -106,6 +106,28 @@ class volume_builder : public volume_builder_interface<detector_t> {
         return &(det.volumes().back());
     }
 
+    /// Nothing to prepare: The surfaces are already constructed by the
+    /// surface factories
+    DETRAY_HOST
+    void prepare(typename detector_t::geometry_context = {}) override {}
+
+    /// @returns the placement transform of the volume
+    DETRAY_HOST
+    auto volume_placement() const ->
+        typename detector_t::transform3_type const & override {
+        return m_trf;
+    }
+
+    /// Add the number of staged objects to @param sizes
+    DETRAY_HOST
+    void count(detail::store_sizes<detector_t>& sizes) override {
+        ++sizes.n_volumes;
+        sizes.n_surfaces += m_surfaces.size();
+        // Surface transforms and the volume placement
+        sizes.n_transforms += m_transforms.size() + 1u;
+        sizes.add_masks(m_masks);
+    }
+
     /// Adds a placement transform @param trf for the volume
     DETRAY_HOST
     void add_volume_placement(
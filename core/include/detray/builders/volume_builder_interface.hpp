@@ -8,6 +8,7 @@
 #pragma once
 
 // Project include(s).
+#include "detray/builders/detail/store_sizes.hpp"
 #include "detray/geometry/detector_volume.hpp"
 
 // System include(s)
@@ -88,6 +89,25 @@ class volume_builder_interface {
         std::shared_ptr<surface_factory_interface<detector_t>> sf_factory,
         typename detector_t::geometry_context ctx = {}) = 0;
 
+    /// @brief Do the work on the volume data that does not need the detector
+    /// (e.g. fill a surface grid), before the volume is added to it.
+    ///
+    /// Only touches the data of this volume builder, so that it can be called
+    /// for different volumes concurrently. @c build() finishes the volume
+    /// either way.
+    DETRAY_HOST
+    virtual void prepare(typename detector_t::geometry_context ctx = {}) = 0;
+
+    /// @returns the placement transform of the volume
+    DETRAY_HOST
+    virtual auto volume_placement() const ->
+        typename detector_t::transform3_type const & = 0;
+
+    /// @brief Add the number of objects that the volume will add to the
+    /// detector stores to @param sizes
+    DETRAY_HOST
+    virtual void count(detail::store_sizes<detector_t> &sizes) = 0;
+
     protected:
     /// Access to builder data
     /// @{
@@ -141,6 +161,22 @@ class volume_decorator : public volume_builder_interface<detector_t> {
         return m_builder->build(det);
     }
 
+    DETRAY_HOST
+    void prepare(typename detector_t::geometry_context ctx = {}) override {
+        m_builder->prepare(ctx);
+    }
+
+    DETRAY_HOST
+    auto volume_placement() const ->
+        typename detector_t::transform3_type const & override {
+        return m_builder->volume_placement();
+    }
+
+    DETRAY_HOST
+    void count(detail::store_sizes<detector_t> &sizes) override {
+        m_builder->count(sizes);
+    }
+
     DETRAY_HOST
     void add_volume_placement(
         const typename detector_t::transform3_type &trf = {}) override {
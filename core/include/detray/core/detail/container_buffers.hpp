@@ -21,6 +21,8 @@
 
 // System include(s)
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace detray {
 
@@ -152,6 +154,9 @@ using get_buffer_t = typename has_buffer<T>::type;
 template <typename T>
 using dvector_buffer = vecmem::data::vector_buffer<T>;
 
+/// Events of asynchronous copies, in the order in which they were enqueued
+using dcopy_events = std::vector<vecmem::copy::event_type>;
+
 /// The detray container buffer exists, if all contained buffer types also
 /// derive from @c dbase_buffer.
 template <typename... buffer_ts>
@@ -159,19 +164,26 @@ using dmulti_buffer = detray::detail::dmulti_buffer_helper<
     std::conjunction_v<detail::is_buffer<buffer_ts>...>, buffer_ts...>;
 
 /// @brief Get the buffer representation of a vecmem vector - non-const
+///
+/// @param events if given, the event of an asynchronous copy is added to it
+///               instead of being discarded
 template <class T>
 dvector_buffer<T> get_buffer(
     const dvector_view<T>& vec_view, vecmem::memory_resource& mr,
     vecmem::copy& cpy, detray::copy cpy_type = detray::copy::sync,
-    vecmem::data::buffer_type buff_type = vecmem::data::buffer_type::fixed_size
-    /*, stream*/) {
+    vecmem::data::buffer_type buff_type = vecmem::data::buffer_type::fixed_size,
+    dcopy_events* events = nullptr) {
     dvector_buffer<T> buff{vec_view.size(), mr, buff_type};
-    // TODO: Move this to detray copy util, which bundles vecmem copy object and
-    // stream handle and gets this switch case right automatically
+    // The stream is the one the copy object (e.g. an async_copy) was
+    // created with
     switch (cpy_type) {
-        case detray::copy::async:
-            cpy(vec_view, buff /*, stream*/);
+        case detray::copy::async: {
+            auto event = cpy(vec_view, buff);
+            if (events != nullptr) {
+                events->push_back(std::move(event));
+            }
             break;
+        }
         default:
             cpy(vec_view, buff)->wait();
     };
@@ -186,8 +198,8 @@ template <typename... Ts>
 auto get_buffer(
     const dmulti_view<Ts...>&, vecmem::memory_resource&, vecmem::copy&,
     detray::copy = detray::copy::sync,
-    vecmem::data::buffer_type =
-        vecmem::data::buffer_type::fixed_size);  // Forward declaration
+    vecmem::data::buffer_type = vecmem::data::buffer_type::fixed_size,
+    dcopy_events* = nullptr);  // Forward declaration
 
 /// @brief Recursively get the buffer representation of a composite view
 ///
@@ -204,26 +216,31 @@ auto get_buffer(const dmulti_view<Ts...>& data_view,
                 std::index_sequence<I...> /*seq*/,
                 detray::copy cpy_type = detray::copy::sync,
                 vecmem::data::buffer_type buff_type =
-                    vecmem::data::buffer_type::fixed_size) {
+                    vecmem::data::buffer_type::fixed_size,
+                dcopy_events* events = nullptr) {
     // Evaluate recursive buffer type
     // (e.g. dmulti_view<..., dmulti_view<dvector_view<T>, ...>, ...>
     //       => dmulti_buffer<..., dmulti_buffer<dvector_buffer<T>, ...>, ...>)
     using result_buffer_t = dmulti_buffer<decltype(detray::get_buffer(
-        detail::get<I>(data_view.m_view), mr, cpy, cpy_type, buff_type))...>;
+        detail::get<I>(data_view.m_view), mr, cpy, cpy_type, buff_type,
+        events))...>;
 
-    return result_buffer_t{std::move(detray::get_buffer(
-        detail::get<I>(data_view.m_view), mr, cpy, cpy_type, buff_type))...};
+    // The copies are enqueued in the order of the views (braced init)
+    return result_buffer_t{std::move(
+        detray::get_buffer(detail::get<I>(data_view.m_view), mr, cpy,
+                           cpy_type, buff_type, events))...};
 }
 
 template <typename... Ts>
 auto get_buffer(const dmulti_view<Ts...>& data_view,
                 vecmem::memory_resource& mr, vecmem::copy& cpy,
-                detray::copy cpy_type, vecmem::data::buffer_type buff_type) {
+                detray::copy cpy_type, vecmem::data::buffer_type buff_type,
+                dcopy_events* events) {
     return detray::get_buffer(
         data_view, mr, cpy,
         std::make_index_sequence<
             detail::tuple_size_v<decltype(data_view.m_view)>>{},
-        cpy_type, buff_type);
+        cpy_type, buff_type, events);
 }
 
 /// @brief Get the buffer representation of a composite object - non-const
@@ -234,9 +251,10 @@ typename T::buffer_type get_buffer(T& bufferable, vecmem::memory_resource& mr,
                                    vecmem::copy& cpy,
                                    detray::copy cpy_type = detray::copy::sync,
                                    vecmem::data::buffer_type buff_type =
-                                       vecmem::data::buffer_type::fixed_size) {
+                                       vecmem::data::buffer_type::fixed_size,
+                                   dcopy_events* events = nullptr) {
     return detray::get_buffer(bufferable.get_data(), mr, cpy, cpy_type,
-                              buff_type);
+                              buff_type, events);
 }
 
 /// @brief Get the buffer representation of a vecmem vector - non-const
@@ -244,10 +262,10 @@ template <class T>
 dvector_buffer<T> get_buffer(
     dvector<T>& vec, vecmem::memory_resource& mr, vecmem::copy& cpy,
     detray::copy cpy_type = detray::copy::sync,
-    vecmem::data::buffer_type buff_type = vecmem::data::buffer_type::fixed_size
-    /*, stream*/) {
+    vecmem::data::buffer_type buff_type = vecmem::data::buffer_type::fixed_size,
+    dcopy_events* events = nullptr) {
     return detray::get_buffer(detray::get_data(vec), mr, cpy, cpy_type,
-                              buff_type);
+                              buff_type, events);
 }
 
 /// Get the vecmem view type of a vector buffer
@@ -30,7 +30,7 @@ class data_context {
 
     /// @returns the index to find the data for the context - const
     DETRAY_HOST_DEVICE
-    dindex get() const { return m_data; }
+    constexpr dindex get() const { return m_data; }
 
     private:
     dindex m_data{0};
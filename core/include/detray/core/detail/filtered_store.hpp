@@ -0,0 +1,101 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/multi_store.hpp"
+#include "detray/utils/grid/detail/grid_bins.hpp"
+#include "detray/utils/grid/grid.hpp"
+#include "detray/utils/type_list.hpp"
+
+// System include(s)
+#include <cstddef>
+#include <type_traits>
+
+namespace detray::detail {
+
+/// @brief Restrict a data store to a subset of its collections.
+///
+/// Used to derive the data stores of a reduced detector metadata from the
+/// stores of a larger one (e.g. only the mask types that a detector uses).
+///
+/// @tparam store_t the original @c multi_store type
+/// @tparam new_id_t the type id enum of the reduced store
+/// @tparam I the positions of the collections to keep in the original store,
+///           in the order of the new type ids
+template <typename store_t, typename new_id_t, std::size_t... I>
+struct filter_store {};
+
+/// Specialization for @c multi_store
+template <typename ID, typename context_t, template <typename...> class tuple_t,
+          typename... Ts, typename new_id_t, std::size_t... I>
+struct filter_store<multi_store<ID, context_t, tuple_t, Ts...>, new_id_t,
+                    I...> {
+    static_assert(((I < sizeof...(Ts)) && ...),
+                  "Filtered store: Collection index out of range");
+
+    using type = multi_store<new_id_t, context_t, tuple_t,
+                             types::at<types::list<Ts...>, I>...>;
+};
+
+template <typename store_t, typename new_id_t, std::size_t... I>
+using filter_store_t = typename filter_store<store_t, new_id_t, I...>::type;
+
+/// @brief Recursively replace the type @tparam old_t by @tparam new_t in the
+/// template arguments of @tparam T.
+///
+/// The acceleration structures hold surface descriptors, whose type changes
+/// with the mask and material links of a reduced metadata. This rebinds e.g.
+/// the surface grids of the original metadata to the new surface type.
+/// @{
+template <typename T, typename old_t, typename new_t>
+struct rebind_value;
+
+template <typename T, typename old_t, typename new_t>
+using rebind_value_t =
+    std::conditional_t<std::is_same_v<T, old_t>, new_t,
+                       typename rebind_value<T, old_t, new_t>::type>;
+
+/// Types that are not templates remain unchanged
+template <typename T, typename old_t, typename new_t>
+struct rebind_value {
+    using type = T;
+};
+
+/// Class templates with only type parameters
+template <template <typename...> class C, typename... Ts, typename old_t,
+          typename new_t>
+struct rebind_value<C<Ts...>, old_t, new_t> {
+    using type = C<rebind_value_t<Ts, old_t, new_t>...>;
+};
+
+/// Data stores
+template <typename ID, typename context_t, template <typename...> class tuple_t,
+          typename... Ts, typename old_t, typename new_t>
+struct rebind_value<multi_store<ID, context_t, tuple_t, Ts...>, old_t, new_t> {
+    using type = multi_store<ID, context_t, tuple_t,
+                             rebind_value_t<Ts, old_t, new_t>...>;
+};
+
+/// Grids: rebind the bin type
+template <typename axes_t, typename bin_t,
+          template <std::size_t> class serializer_t, typename old_t,
+          typename new_t>
+struct rebind_value<grid_impl<axes_t, bin_t, serializer_t>, old_t, new_t> {
+    using type =
+        grid_impl<axes_t, rebind_value_t<bin_t, old_t, new_t>, serializer_t>;
+};
+
+/// Static array bins
+template <typename entry_t, std::size_t N, typename old_t, typename new_t>
+struct rebind_value<bins::static_array<entry_t, N>, old_t, new_t> {
+    using type = bins::static_array<rebind_value_t<entry_t, old_t, new_t>, N>;
+};
+/// @}
+
+}  // namespace detray::detail
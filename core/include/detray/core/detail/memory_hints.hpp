@@ -0,0 +1,148 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/data/jagged_vector_view.hpp>
+#include <vecmem/containers/data/vector_view.hpp>
+
+// System include(s)
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace detray {
+
+/// How often the data of a detector store is accessed during navigation
+enum class memory_hint : std::uint_least8_t {
+    e_hot = 0u,   ///< accessed for every candidate (e.g. transforms, masks)
+    e_cold = 1u,  ///< accessed rarely (e.g. material, volume search)
+};
+
+/// @brief Access hints for the stores of a detector
+///
+/// When the detector is allocated in host-pinned or unified (managed) memory,
+/// the device can work on the detector view directly (@c detray::get_data),
+/// without copying it into a device buffer first. The hints can then be
+/// passed to the memory system per store, e.g. to prefetch the hot stores
+/// to the device and to keep the cold stores on the host.
+struct detector_memory_hints {
+    memory_hint volumes{memory_hint::e_hot};
+    memory_hint surfaces{memory_hint::e_hot};
+    memory_hint transforms{memory_hint::e_hot};
+    memory_hint masks{memory_hint::e_hot};
+    memory_hint materials{memory_hint::e_cold};
+    memory_hint accelerators{memory_hint::e_hot};
+    memory_hint volume_finder{memory_hint::e_cold};
+
+    /// @returns the hints in the order of the detector view members
+    constexpr std::array<memory_hint, 7u> by_store() const {
+        return {volumes,   surfaces,     transforms,   masks,
+                materials, accelerators, volume_finder};
+    }
+};
+
+namespace detail {
+
+/// @brief Call @param f with the memory region of a vector view
+template <typename T, typename functor_t>
+void for_each_memory_region(const dvector_view<T> &v, functor_t &&f) {
+    if (v.capacity() > 0u) {
+        f(static_cast<const void *>(v.ptr()),
+          static_cast<std::size_t>(v.capacity()) * sizeof(T));
+    }
+}
+
+/// @brief Call @param f with the memory regions of a jagged vector view
+/// (the inner views and the inner vectors)
+template <typename T, typename functor_t>
+void for_each_memory_region(const djagged_vector_view<T> &v, functor_t &&f) {
+    if (v.size() == 0u) {
+        return;
+    }
+    f(static_cast<const void *>(v.ptr()),
+      static_cast<std::size_t>(v.size()) * sizeof(dvector_view<T>));
+    for (std::size_t i = 0u; i < static_cast<std::size_t>(v.size()); ++i) {
+        detail::for_each_memory_region(v.host_ptr()[i], f);
+    }
+}
+
+/// @brief Recursively visit the memory regions of a composite view
+template <typename... Ts, typename functor_t>
+void for_each_memory_region(const dmulti_view<Ts...> &v,
+                            functor_t &&f);  // Forward declaration
+
+template <typename... Ts, typename functor_t, std::size_t... I>
+void for_each_memory_region(const dmulti_view<Ts...> &v, functor_t &&f,
+                            std::index_sequence<I...> /*seq*/) {
+    (detail::for_each_memory_region(detail::get<I>(v.m_view), f), ...);
+}
+
+template <typename... Ts, typename functor_t>
+void for_each_memory_region(const dmulti_view<Ts...> &v, functor_t &&f) {
+    detail::for_each_memory_region(v, f,
+                                   std::make_index_sequence<sizeof...(Ts)>{});
+}
+
+/// @brief Forward the memory regions of every detector store together with
+/// the hint of the store
+template <typename detector_view_t, typename functor_t, std::size_t... I>
+void apply_memory_hints(const detector_view_t &det_data, functor_t &advise,
+                        const std::array<memory_hint, 7u> &hints,
+                        std::index_sequence<I...> /*seq*/) {
+    (detail::for_each_memory_region(
+         detail::get<I>(det_data.m_view),
+         [&advise, hint = hints[I]](const void *ptr,
+                                    const std::size_t n_bytes) {
+             advise(ptr, n_bytes, hint);
+         }),
+     ...);
+}
+
+}  // namespace detail
+
+/// @brief Visit all memory regions that a (composite) view refers to
+///
+/// @param v the view, e.g. of a detector store
+/// @param f callable with the signature (const void* ptr, std::size_t bytes)
+///
+/// @note the view has to be host accessible (e.g. host, pinned or managed
+/// memory), since the inner views of jagged vectors are read on the host
+template <typename view_t, typename functor_t>
+DETRAY_HOST void for_each_memory_region(const view_t &v, functor_t &&f) {
+    detail::for_each_memory_region(v, f);
+}
+
+/// @brief Pass the memory access hints for every store of a detector view
+///
+/// Does not depend on a device runtime: The callable @param advise receives
+/// the memory regions of the stores together with their hint and is expected
+/// to forward them to the memory system (e.g. as prefetch or preferred
+/// location advice for unified memory).
+///
+/// @param det_data view of a detector in host accessible memory
+/// @param advise callable with the signature
+///               (const void* ptr, std::size_t bytes, memory_hint hint)
+/// @param hints the access hints per store
+template <typename detector_view_t, typename functor_t,
+          std::enable_if_t<detail::is_device_view_v<detector_view_t>, bool> =
+              true>
+DETRAY_HOST void apply_memory_hints(
+    const detector_view_t &det_data, functor_t &&advise,
+    const detector_memory_hints &hints = {}) {
+    detail::apply_memory_hints(det_data, advise, hints.by_store(),
+                               std::make_index_sequence<7u>{});
+}
+
+}  // namespace detray
@@ -0,0 +1,451 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_buffers.hpp"
+#include "detray/core/detail/container_views.hpp"
+#include "detray/core/detail/data_context.hpp"
+#include "detray/definitions/detail/algorithms.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <iterator>
+#include <type_traits>
+
+namespace detray {
+
+/// @brief Data store that holds a nominal data collection and the deviations
+/// from it for any number of additional contexts (e.g. alignment constants).
+///
+/// The context with index zero is the nominal one. Every other context only
+/// stores the elements that differ from the nominal collection (copy-on-write)
+/// in a flat delta table: The indices of the changed elements are kept sorted
+/// per context, so that an element is resolved by a binary search in the
+/// deltas of its context, falling back to the nominal element. All contexts
+/// share the same four flat containers, so that a single view/buffer
+/// transfers all of them to device.
+///
+/// The interface is compatible with the @c single_store , the elementwise
+/// access without context and the iteration always refer to the nominal data.
+///
+/// @tparam T The type of the collection data, e.g. transforms
+/// @tparam container_t The type of container to use for the data collection.
+/// @tparam context_t the context with which to retrieve the correct data.
+template <typename T, template <typename...> class container_t = dvector,
+          typename context_t = geometry_context>
+class multi_context_store {
+
+    public:
+    /// Underlying container type that can handle vecmem views
+    using base_type = container_t<T>;
+    using size_type = typename base_type::size_type;
+    using value_type = typename base_type::value_type;
+    using iterator = typename base_type::iterator;
+    using const_iterator = typename base_type::const_iterator;
+    using context_type = context_t;
+
+    /// How to find data in the store
+    /// @{
+    using link_type = dindex;
+    using single_link = dindex;
+    using range_link = dindex_range;
+    /// @}
+
+    /// Vecmem view types
+    using view_type = dmulti_view<detail::get_view_t<container_t<T>>,
+                                  detail::get_view_t<container_t<dindex>>,
+                                  detail::get_view_t<container_t<dindex>>,
+                                  detail::get_view_t<container_t<T>>>;
+    using const_view_type =
+        dmulti_view<detail::get_view_t<const container_t<T>>,
+                    detail::get_view_t<const container_t<dindex>>,
+                    detail::get_view_t<const container_t<dindex>>,
+                    detail::get_view_t<const container_t<T>>>;
+    using buffer_type = dmulti_buffer<detail::get_buffer_t<container_t<T>>,
+                                      detail::get_buffer_t<container_t<dindex>>,
+                                      detail::get_buffer_t<container_t<dindex>>,
+                                      detail::get_buffer_t<container_t<T>>>;
+
+    /// Empty container
+    constexpr multi_context_store() = default;
+
+    // Delegate constructors to container, which handles the memory
+
+    /// Copy construct from element types
+    constexpr explicit multi_context_store(const T &arg) : m_container(arg) {}
+
+    /// Construct with a specific memory resource @param resource
+    /// (host-side only)
+    template <typename allocator_t = vecmem::memory_resource,
+              std::enable_if_t<not detail::is_device_view_v<allocator_t>,
+                               bool> = true>
+    DETRAY_HOST explicit multi_context_store(allocator_t &resource)
+        : m_container(&resource),
+          m_context_offsets(&resource),
+          m_delta_indices(&resource),
+          m_deltas(&resource) {}
+
+    /// Copy Construct with a specific memory resource @param resource
+    /// (host-side only)
+    template <typename allocator_t = vecmem::memory_resource,
+              typename C = container_t<T>,
+              std::enable_if_t<std::is_same_v<C, std::vector<T>>, bool> = true>
+    DETRAY_HOST explicit multi_context_store(allocator_t &resource,
+                                             const T &arg)
+        : m_container(&resource, arg),
+          m_context_offsets(&resource),
+          m_delta_indices(&resource),
+          m_deltas(&resource) {}
+
+    /// Construct from the container @param view . Mainly used device-side.
+    template <typename container_view_t,
+              std::enable_if_t<detail::is_device_view_v<container_view_t>,
+                               bool> = true>
+    DETRAY_HOST_DEVICE multi_context_store(container_view_t &view)
+        : m_container(detail::get<0>(view.m_view)),
+          m_context_offsets(detail::get<1>(view.m_view)),
+          m_delta_indices(detail::get<2>(view.m_view)),
+          m_deltas(detail::get<3>(view.m_view)) {}
+
+    /// @returns a pointer to the underlying nominal container - const
+    DETRAY_HOST_DEVICE
+    constexpr auto data() const noexcept -> const base_type * {
+        return &m_container;
+    }
+
+    /// @returns a pointer to the underlying nominal container - non-const
+    DETRAY_HOST_DEVICE
+    constexpr auto data() noexcept -> base_type * { return &m_container; }
+
+    /// @returns the number of elements (the same in every context)
+    DETRAY_HOST_DEVICE
+    constexpr auto size(const context_type & /*ctx*/ = {}) const noexcept
+        -> dindex {
+        return static_cast<dindex>(m_container.size());
+    }
+
+    /// @returns true if the underlying container is empty
+    DETRAY_HOST_DEVICE
+    constexpr auto empty(const context_type & /*ctx*/ = {}) const noexcept
+        -> bool {
+        return m_container.empty();
+    }
+
+    /// @returns the number of contexts, including the nominal one
+    DETRAY_HOST_DEVICE
+    constexpr auto n_contexts() const noexcept -> dindex {
+        return static_cast<dindex>(m_context_offsets.size()) +
+               (m_context_offsets.empty() ? 1u : 0u);
+    }
+
+    /// @returns the number of elements that differ from the nominal ones in
+    /// the context @param ctx
+    DETRAY_HOST_DEVICE
+    constexpr auto n_deltas(const context_type &ctx) const noexcept -> dindex {
+        if (not is_aligned(ctx)) {
+            return 0u;
+        }
+        return m_context_offsets[ctx.get()] - m_context_offsets[ctx.get() - 1u];
+    }
+
+    /// @returns the nominal collections iterator at the start position.
+    DETRAY_HOST_DEVICE
+    constexpr auto begin(const context_type & /*ctx*/ = {}) {
+        return m_container.begin();
+    }
+
+    /// @returns the nominal collections iterator sentinel.
+    DETRAY_HOST_DEVICE
+    constexpr auto end(const context_type & /*ctx*/ = {}) {
+        return m_container.end();
+    }
+
+    /// @returns access to the underlying nominal container - const
+    DETRAY_HOST_DEVICE
+    constexpr auto get(const context_type & /*ctx*/) const noexcept
+        -> const base_type & {
+        return m_container;
+    }
+
+    /// @returns access to the underlying nominal container - non-const
+    DETRAY_HOST_DEVICE
+    constexpr auto get(const context_type & /*ctx*/) noexcept -> base_type & {
+        return m_container;
+    }
+
+    /// Elementwise access to the nominal data - non-const
+    DETRAY_HOST_DEVICE
+    constexpr decltype(auto) operator[](const dindex i) {
+        return m_container[i];
+    }
+
+    /// Elementwise access to the nominal data - const
+    DETRAY_HOST_DEVICE
+    constexpr decltype(auto) operator[](const dindex i) const {
+        return m_container[i];
+    }
+
+    /// @returns context based access to an element - const
+    DETRAY_HOST_DEVICE
+    constexpr auto at(const dindex i, const context_type &ctx) const noexcept
+        -> const T & {
+        const dindex pos{find_delta(i, ctx)};
+        return (pos == dindex_invalid) ? m_container[i] : m_deltas[pos];
+    }
+
+    /// @returns context based access to an element. If the element does not
+    /// differ from the nominal one in @param ctx , this is the nominal element.
+    /// Use @c set to change the element in a single context.
+    DETRAY_HOST_DEVICE
+    constexpr auto at(const dindex i, const context_type &ctx) noexcept
+        -> T & {
+        const dindex pos{find_delta(i, ctx)};
+        return (pos == dindex_invalid) ? m_container[i] : m_deltas[pos];
+    }
+
+    /// Add a new context, in which all elements are nominal
+    ///
+    /// @returns the new context
+    DETRAY_HOST auto add_context() noexcept(false) -> context_type {
+        // Offset of the nominal context
+        if (m_context_offsets.empty()) {
+            m_context_offsets.push_back(0u);
+        }
+        m_context_offsets.push_back(
+            static_cast<dindex>(m_delta_indices.size()));
+
+        return context_type{static_cast<dindex>(m_context_offsets.size() - 1u)};
+    }
+
+    /// Set the element @param i to the value @param arg in the context
+    /// @param ctx (copy-on-write). Setting it in the nominal context changes
+    /// all contexts that do not hold their own version of the element.
+    ///
+    /// @note in general can throw an exception
+    template <typename U>
+    DETRAY_HOST void set(const dindex i, U &&arg,
+                         const context_type &ctx) noexcept(false) {
+        if (not is_aligned(ctx)) {
+            m_container.at(i) = std::forward<U>(arg);
+            return;
+        }
+
+        const auto first =
+            m_delta_indices.begin() + m_context_offsets[ctx.get() - 1u];
+        const auto last =
+            m_delta_indices.begin() + m_context_offsets[ctx.get()];
+        const auto itr = detail::lower_bound(first, last, i);
+        const auto pos{std::distance(m_delta_indices.begin(), itr)};
+
+        if (itr != last and *itr == i) {
+            m_deltas[static_cast<std::size_t>(pos)] = std::forward<U>(arg);
+            return;
+        }
+
+        // Insert the new delta and shift the following contexts
+        m_delta_indices.insert(itr, i);
+        m_deltas.insert(m_deltas.begin() + pos, std::forward<U>(arg));
+        for (std::size_t c = ctx.get(); c < m_context_offsets.size(); ++c) {
+            ++m_context_offsets[c];
+        }
+    }
+
+    /// Removes and destructs all elements and contexts in the container.
+    DETRAY_HOST void clear(const context_type & /*ctx*/) {
+        m_container.clear();
+        m_context_offsets.clear();
+        m_delta_indices.clear();
+        m_deltas.clear();
+    }
+
+    /// Reserve memory of size @param n for the nominal context
+    DETRAY_HOST void reserve(std::size_t n, const context_type & /*ctx*/) {
+        m_container.reserve(n);
+    }
+
+    /// Resize the nominal container to @param n
+    DETRAY_HOST void resize(std::size_t n, const context_type & /*ctx*/) {
+        m_container.resize(n);
+    }
+
+    /// Add a new nominal element to the collection - copy
+    ///
+    /// @tparam U type that can be converted to T
+    ///
+    /// @param arg the constructor argument
+    ///
+    /// @note in general can throw an exception
+    template <typename U>
+    DETRAY_HOST constexpr auto push_back(
+        const U &arg, const context_type & /*ctx*/ = {}) noexcept(false)
+        -> void {
+        m_container.push_back(arg);
+    }
+
+    /// Add a new nominal element to the collection - move
+    ///
+    /// @tparam U type that can be converted to T
+    ///
+    /// @param arg the constructor argument
+    ///
+    /// @note in general can throw an exception
+    template <typename U>
+    DETRAY_HOST constexpr auto push_back(
+        U &&arg, const context_type & /*ctx*/ = {}) noexcept(false) -> void {
+        m_container.push_back(std::move(arg));
+    }
+
+    /// Add a new nominal element to the collection in place
+    ///
+    /// @tparam Args are the types of the constructor arguments
+    ///
+    /// @param args is the list of constructor arguments
+    ///
+    /// @note in general can throw an exception
+    template <typename... Args>
+    DETRAY_HOST constexpr decltype(auto) emplace_back(
+        const context_type & /*ctx*/ = {}, Args &&... args) noexcept(false) {
+        return m_container.emplace_back(std::forward<Args>(args)...);
+    }
+
+    /// Insert another nominal collection - copy
+    ///
+    /// @tparam U type that can be converted to T
+    ///
+    /// @param new_data is the new collection to be added
+    ///
+    /// @note in general can throw an exception
+    template <typename U>
+    DETRAY_HOST auto insert(container_t<U> &new_data,
+                            const context_type & /*ctx*/ = {}) noexcept(false)
+        -> void {
+        m_container.reserve(m_container.size() + new_data.size());
+        m_container.insert(m_container.end(), new_data.begin(), new_data.end());
+    }
+
+    /// Insert another nominal collection - move
+    ///
+    /// @tparam U type that can be converted to T
+    ///
+    /// @param new_data is the new collection to be added
+    ///
+    /// @note in general can throw an exception
+    template <typename U>
+    DETRAY_HOST auto insert(container_t<U> &&new_data,
+                            const context_type & /*ctx*/ = {}) noexcept(false)
+        -> void {
+        m_container.reserve(m_container.size() + new_data.size());
+        m_container.insert(m_container.end(),
+                           std::make_move_iterator(new_data.begin()),
+                           std::make_move_iterator(new_data.end()));
+    }
+
+    /// Append another store to the current one. The deltas of the other
+    /// store are added to the context with the same index.
+    ///
+    /// @param other The other container
+    ///
+    /// @note in general can throw an exception
+    DETRAY_HOST void append(multi_context_store &other,
+                            const context_type &ctx = {}) noexcept(false) {
+        const auto offset{size()};
+        insert(other.m_container, ctx);
+        append_deltas(other, offset);
+    }
+
+    /// Append another store to the current one - move
+    ///
+    /// @param other The other container
+    ///
+    /// @note in general can throw an exception
+    DETRAY_HOST void append(multi_context_store &&other,
+                            const context_type &ctx = {}) noexcept(false) {
+        const auto offset{size()};
+        insert(std::move(other.m_container), ctx);
+        append_deltas(other, offset);
+    }
+
+    /// @return the view on the underlying containers - non-const
+    DETRAY_HOST auto get_data() -> view_type {
+        return view_type{
+            detray::get_data(m_container), detray::get_data(m_context_offsets),
+            detray::get_data(m_delta_indices), detray::get_data(m_deltas)};
+    }
+
+    /// @return the view on the underlying containers - const
+    DETRAY_HOST auto get_data() const -> const_view_type {
+        return const_view_type{
+            detray::get_data(m_container), detray::get_data(m_context_offsets),
+            detray::get_data(m_delta_indices), detray::get_data(m_deltas)};
+    }
+
+    private:
+    /// @returns true if @param ctx is a valid context that is not nominal
+    DETRAY_HOST_DEVICE
+    constexpr bool is_aligned(const context_type &ctx) const noexcept {
+        return ctx.get() != 0u and ctx.get() < m_context_offsets.size();
+    }
+
+    /// @returns the position of the delta of element @param i in context
+    /// @param ctx , or an invalid index if the element is nominal
+    DETRAY_HOST_DEVICE
+    constexpr dindex find_delta(const dindex i,
+                                const context_type &ctx) const noexcept {
+        if (not is_aligned(ctx)) {
+            return dindex_invalid;
+        }
+
+        const auto first =
+            m_delta_indices.begin() + m_context_offsets[ctx.get() - 1u];
+        const auto last =
+            m_delta_indices.begin() + m_context_offsets[ctx.get()];
+        if (first == last) {
+            return dindex_invalid;
+        }
+
+        const auto itr = detail::lower_bound(first, last, i);
+        if (itr == last or *itr != i) {
+            return dindex_invalid;
+        }
+
+        return static_cast<dindex>(std::distance(m_delta_indices.begin(), itr));
+    }
+
+    /// Add the deltas of the store @param other , whose elements were placed
+    /// behind @param offset
+    DETRAY_HOST void append_deltas(const multi_context_store &other,
+                                   const dindex offset) noexcept(false) {
+        for (dindex c = 1u; c < other.m_context_offsets.size(); ++c) {
+            while (n_contexts() <= c) {
+                add_context();
+            }
+            const context_type ctx{c};
+            for (dindex d = other.m_context_offsets[c - 1u];
+                 d < other.m_context_offsets[c]; ++d) {
+                set(other.m_delta_indices[d] + offset, other.m_deltas[d], ctx);
+            }
+        }
+    }
+
+    /// The nominal data
+    base_type m_container;
+    /// End of the deltas of every context in the delta table (the first
+    /// entry belongs to the nominal context and is always zero)
+    container_t<dindex> m_context_offsets;
+    /// Indices of the elements that differ from nominal, sorted per context
+    container_t<dindex> m_delta_indices;
+    /// The elements that differ from nominal
+    base_type m_deltas;
+};
+
+}  // namespace detray
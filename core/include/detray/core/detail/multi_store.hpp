@@ -269,7 +269,9 @@ class multi_store {
         auto &coll = const_cast<collection_t &>(
             detail::get<collection_t>(m_tuple_container));
 
-        coll.reserve(coll.size() + new_data.size());
+        // No exact reservation: the range insertion grows the capacity
+        // geometrically, so that appending the data of many volumes does not
+        // reallocate the collection every time
         coll.insert(coll.end(), new_data.begin(), new_data.end());
     }
 
@@ -290,7 +292,6 @@ class multi_store {
 
         auto &coll = detail::get<collection_t>(m_tuple_container);
 
-        coll.reserve(coll.size() + new_data.size());
         coll.insert(coll.end(), std::make_move_iterator(new_data.begin()),
                     std::make_move_iterator(new_data.end()));
     }
@@ -360,6 +361,22 @@ class multi_store {
             static_cast<std::size_t>(id), std::forward<Args>(args)...);
     }
 
+    /// Calls a functor with a specific data collection (given by ID) - const
+    ///
+    /// @tparam functor_t functor that will be called on the group.
+    /// @tparam Args argument types for the functor
+    ///
+    /// @param id the element id
+    /// @param args additional functor arguments
+    ///
+    /// @return the functor output
+    template <typename functor_t, typename... Args>
+    DETRAY_HOST_DEVICE decltype(auto) visit(const ID id,
+                                            Args &&... args) const {
+        return m_tuple_container.template visit<functor_t>(
+            static_cast<std::size_t>(id), std::forward<Args>(args)...);
+    }
+
     /// Calls a functor with a specific element of a data collection
     /// (given by a link).
     ///
@@ -378,6 +395,26 @@ class multi_store {
             detail::get<1>(link), std::forward<Args>(args)...);
     }
 
+    /// Calls a functor with a specific element of a data collection
+    /// (given by a link), if the collection is one of the IDs in @tparam seq_t
+    ///
+    /// @tparam functor_t functor that will be called on the group.
+    /// @tparam seq_t index sequence of the IDs that can be visited
+    /// @tparam Args argument types for the functor
+    ///
+    /// @param link the element link
+    /// @param args additional functor arguments
+    ///
+    /// @return the functor output, or the default output for all other IDs
+    template <typename functor_t, typename seq_t, typename link_t,
+              typename... Args>
+    DETRAY_HOST_DEVICE decltype(auto) visit_subset(const link_t link,
+                                                   Args &&... args) const {
+        return m_tuple_container.template visit_subset<functor_t, seq_t>(
+            static_cast<std::size_t>(detail::get<0>(link)),
+            detail::get<1>(link), std::forward<Args>(args)...);
+    }
+
     /// Print the types that are in the store
     DETRAY_HOST
     static constexpr void print() {
@@ -0,0 +1,257 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_buffers.hpp"
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/data/vector_view.hpp>
+#include <vecmem/memory/memory_resource.hpp>
+#include <vecmem/memory/unique_ptr.hpp>
+#include <vecmem/utils/copy.hpp>
+
+// System include(s)
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace detray {
+
+namespace detail {
+
+/// Alignment of every container in the arena (cache line)
+inline constexpr std::size_t arena_alignment{64u};
+
+/// Position of a single container in the arena
+struct arena_entry {
+    /// Offset of the first element in bytes, relative to the arena base
+    std::size_t offset{0u};
+    /// Number of elements
+    std::size_t size{0u};
+};
+
+/// @returns @param n_bytes rounded up to the arena alignment
+constexpr std::size_t arena_align(const std::size_t n_bytes) {
+    return (n_bytes + arena_alignment - 1u) / arena_alignment *
+           arena_alignment;
+}
+
+/// @brief Place a vector in the arena layout
+///
+/// Appends the offset table entry of the vector view @param v and advances
+/// the arena size @param n_bytes accordingly.
+template <typename T>
+void arena_layout(const dvector_view<T> &v, std::vector<arena_entry> &entries,
+                  std::size_t &n_bytes) {
+    n_bytes = arena_align(n_bytes);
+    entries.push_back({n_bytes, static_cast<std::size_t>(v.size())});
+    n_bytes += static_cast<std::size_t>(v.size()) * sizeof(T);
+}
+
+/// @brief Recursively place a composite view in the arena layout
+template <typename... Ts>
+void arena_layout(const dmulti_view<Ts...> &v,
+                  std::vector<arena_entry> &entries,
+                  std::size_t &n_bytes);  // Forward declaration
+
+template <typename... Ts, std::size_t... I>
+void arena_layout(const dmulti_view<Ts...> &v,
+                  std::vector<arena_entry> &entries, std::size_t &n_bytes,
+                  std::index_sequence<I...> /*seq*/) {
+    (detail::arena_layout(detail::get<I>(v.m_view), entries, n_bytes), ...);
+}
+
+template <typename... Ts>
+void arena_layout(const dmulti_view<Ts...> &v,
+                  std::vector<arena_entry> &entries, std::size_t &n_bytes) {
+    detail::arena_layout(v, entries, n_bytes,
+                         std::make_index_sequence<sizeof...(Ts)>{});
+}
+
+/// @brief Copy the content of a (host accessible) vector view into the
+/// staging arena at @param base
+template <typename T>
+void arena_fill(const dvector_view<T> &v, std::byte *base,
+                const arena_entry *&entry) {
+    if (v.size() > 0u) {
+        std::memcpy(base + entry->offset, v.ptr(),
+                    static_cast<std::size_t>(v.size()) * sizeof(T));
+    }
+    ++entry;
+}
+
+/// @brief Recursively copy a composite view into the staging arena
+template <typename... Ts>
+void arena_fill(const dmulti_view<Ts...> &v, std::byte *base,
+                const arena_entry *&entry);  // Forward declaration
+
+template <typename... Ts, std::size_t... I>
+void arena_fill(const dmulti_view<Ts...> &v, std::byte *base,
+                const arena_entry *&entry, std::index_sequence<I...> /*seq*/) {
+    (detail::arena_fill(detail::get<I>(v.m_view), base, entry), ...);
+}
+
+template <typename... Ts>
+void arena_fill(const dmulti_view<Ts...> &v, std::byte *base,
+                const arena_entry *&entry) {
+    detail::arena_fill(v, base, entry,
+                       std::make_index_sequence<sizeof...(Ts)>{});
+}
+
+/// @brief Reconstruct a vector view from the arena base pointer @param base
+/// and its offset table entry
+template <typename T>
+void arena_assemble(dvector_view<T> &v, std::byte *base,
+                    const arena_entry *&entry) {
+    using size_type = typename dvector_view<T>::size_type;
+
+    v = dvector_view<T>{static_cast<size_type>(entry->size),
+                        reinterpret_cast<T *>(base + entry->offset)};
+    ++entry;
+}
+
+/// @brief Recursively reconstruct a composite view from the arena
+template <typename... Ts>
+void arena_assemble(dmulti_view<Ts...> &v, std::byte *base,
+                    const arena_entry *&entry);  // Forward declaration
+
+template <typename... Ts, std::size_t... I>
+void arena_assemble(dmulti_view<Ts...> &v, std::byte *base,
+                    const arena_entry *&entry,
+                    std::index_sequence<I...> /*seq*/) {
+    (detail::arena_assemble(detail::get<I>(v.m_view), base, entry), ...);
+}
+
+template <typename... Ts>
+void arena_assemble(dmulti_view<Ts...> &v, std::byte *base,
+                    const arena_entry *&entry) {
+    detail::arena_assemble(v, base, entry,
+                           std::make_index_sequence<sizeof...(Ts)>{});
+}
+
+}  // namespace detail
+
+/// @brief Buffer that packs all containers of a composite view into a single
+/// allocation.
+///
+/// The data of every vector in the (recursive) view is placed into one
+/// aligned arena. The arena is laid out on the host and then transferred
+/// with a single copy, instead of one allocation and one copy per container.
+/// The views are reconstructed from the arena base pointer and an offset
+/// table, so that the same layout is valid for any copy of the arena (e.g.
+/// a memory mapped file).
+///
+/// @tparam view_t the view type of the packed object, e.g. the detector
+template <typename view_t>
+class packed_buffer {
+
+    static_assert(detail::is_device_view_v<view_t>,
+                  "Packed buffer needs a detray view type");
+
+    public:
+    using view_type = view_t;
+
+    packed_buffer() = default;
+
+    /// Pack the data of the view @param src into an arena that is allocated
+    /// from the memory resource @param mr and filled by @param cpy
+    ///
+    /// @note the data referenced by @param src has to be host accessible
+    DETRAY_HOST
+    packed_buffer(const view_t &src, vecmem::memory_resource &mr,
+                  vecmem::copy &cpy) {
+        detail::arena_layout(src, m_offsets, m_size);
+        m_size = detail::arena_align(m_size);
+
+        using size_type = typename dvector_view<std::byte>::size_type;
+        if (m_size > std::numeric_limits<size_type>::max()) {
+            throw std::length_error("Packed buffer: Arena too large");
+        }
+
+        // Lay out the arena on the host
+        std::vector<std::byte> staging(m_size);
+        const detail::arena_entry *entry{m_offsets.data()};
+        detail::arena_fill(src, staging.data(), entry);
+
+        // Transfer the whole arena in one go
+        m_arena = vecmem::make_unique_alloc<std::byte[]>(mr, m_size);
+        const dvector_view<const std::byte> from{
+            static_cast<size_type>(m_size), staging.data()};
+        cpy(from, dvector_view<std::byte>{static_cast<size_type>(m_size),
+                                          m_arena.get()})
+            ->wait();
+    }
+
+    /// @returns the size of the arena in bytes
+    DETRAY_HOST
+    std::size_t size() const { return m_size; }
+
+    /// @returns the base pointer of the arena
+    DETRAY_HOST
+    std::byte *data() { return m_arena.get(); }
+
+    /// @returns the base pointer of the arena - const
+    DETRAY_HOST
+    const std::byte *data() const { return m_arena.get(); }
+
+    /// @returns the offset table of the packed containers in layout order
+    DETRAY_HOST
+    const std::vector<detail::arena_entry> &offsets() const {
+        return m_offsets;
+    }
+
+    /// @returns the view onto the arena of this buffer
+    DETRAY_HOST
+    view_type get_data() { return get_data(m_arena.get()); }
+
+    /// @returns the view onto an arena with the layout of this buffer that
+    /// starts at @param base (relocation)
+    DETRAY_HOST
+    view_type get_data(std::byte *base) const {
+        view_type v{};
+        const detail::arena_entry *entry{m_offsets.data()};
+        detail::arena_assemble(v, base, entry);
+
+        return v;
+    }
+
+    private:
+    /// Offsets and sizes of the packed containers
+    std::vector<detail::arena_entry> m_offsets{};
+    /// Size of the arena in bytes
+    std::size_t m_size{0u};
+    /// The arena
+    vecmem::unique_alloc_ptr<std::byte[]> m_arena{};
+};
+
+/// @brief Get the view of a packed buffer
+template <typename view_t>
+view_t get_data(packed_buffer<view_t> &buff) {
+    return buff.get_data();
+}
+
+/// @brief Pack a composite object (e.g. a detector) into a single allocation
+/// from @param mr
+template <
+    class T,
+    std::enable_if_t<detail::is_device_view_v<typename T::view_type>, bool> =
+        true>
+packed_buffer<typename T::view_type> get_packed_buffer(
+    T &bufferable, vecmem::memory_resource &mr, vecmem::copy &cpy) {
+    return packed_buffer<typename T::view_type>{bufferable.get_data(), mr,
+                                                cpy};
+}
+
+}  // namespace detray
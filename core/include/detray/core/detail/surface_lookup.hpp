@@ -10,19 +10,45 @@
 // Project include(s)
 #include "detray/core/detail/container_buffers.hpp"
 #include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/detail/algorithms.hpp"
 #include "detray/definitions/detail/indexing.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/geometry/barcode.hpp"
+#include "detray/utils/invalid_values.hpp"
 
 // Vecmem include(s)
 #include <vecmem/memory/memory_resource.hpp>
 
 // System include(s)
+#include <cstdint>
 #include <iostream>
 #include <type_traits>
 
 namespace detray {
 
+namespace detail {
+
+/// Entry of the source link index: Maps a source link to a surface index
+struct source_index_entry {
+    std::uint64_t source{detail::invalid_value<std::uint64_t>()};
+    dindex index{detail::invalid_value<dindex>()};
+
+    /// Order by source link first, then by surface index
+    DETRAY_HOST_DEVICE
+    constexpr bool operator<(const source_index_entry &rhs) const {
+        return (source < rhs.source) or
+               (source == rhs.source and index < rhs.index);
+    }
+
+    /// Compare to a source link (binary search)
+    DETRAY_HOST_DEVICE
+    constexpr bool operator<(const std::uint64_t src) const {
+        return source < src;
+    }
+};
+
+}  // namespace detail
+
 /// General case: Brute force search for the corresponding sf-descriptor
 struct default_searcher {
 
@@ -47,6 +73,44 @@ struct default_searcher {
     std::uint64_t m_source;
 };
 
+/// Binary search for the corresponding sf-descriptor in the source link index
+/// of the surface lookup. Falls back to the brute force search, if the index
+/// was not built.
+struct source_link_searcher {
+
+    template <typename source_link_contianer_t, typename index_container_t>
+    DETRAY_HOST_DEVICE auto operator()(
+        const source_link_contianer_t &sf_container,
+        const index_container_t &source_index) const {
+        // Check that this searcher can be used on the passed surface container
+        static_assert(
+            std::is_same_v<decltype(sf_container[0].source), std::uint64_t>,
+            "Source link searcher not compatible with detector");
+
+        using sf_link_t = typename source_link_contianer_t::value_type;
+
+        if (source_index.empty()) {
+            for (const auto &sf : sf_container) {
+                if (sf.source == m_source) {
+                    return sf;
+                }
+            }
+            return sf_link_t{};
+        }
+
+        const auto itr = detail::lower_bound(source_index.begin(),
+                                             source_index.end(), m_source);
+        if (itr != source_index.end() and (*itr).source == m_source) {
+            return sf_link_t{sf_container[(*itr).index]};
+        }
+
+        return sf_link_t{};
+    }
+
+    /// The query source link
+    std::uint64_t m_source;
+};
+
 /// Couple the surface descriptor to a source link
 template <typename sf_desc_t>
 struct source_link : sf_desc_t {
@@ -77,12 +141,19 @@ class surface_lookup {
     using iterator = typename base_type::iterator;
     using const_iterator = typename base_type::const_iterator;
 
+    /// Sorted index of the source links
+    using index_type = container_t<detail::source_index_entry>;
+
     /// Vecmem view types
-    using view_type = detail::get_view_t<container_t<source_link<sf_desc_t>>>;
-    using const_view_type =
-        detail::get_view_t<const container_t<source_link<sf_desc_t>>>;
+    using view_type =
+        dmulti_view<detail::get_view_t<container_t<source_link<sf_desc_t>>>,
+                    detail::get_view_t<index_type>>;
+    using const_view_type = dmulti_view<
+        detail::get_view_t<const container_t<source_link<sf_desc_t>>>,
+        detail::get_view_t<const index_type>>;
     using buffer_type =
-        detail::get_buffer_t<container_t<source_link<sf_desc_t>>>;
+        dmulti_buffer<detail::get_buffer_t<container_t<source_link<sf_desc_t>>>,
+                      detail::get_buffer_t<index_type>>;
 
     /// Empty container
     constexpr surface_lookup() = default;
@@ -93,7 +164,7 @@ class surface_lookup {
               std::enable_if_t<not detail::is_device_view_v<allocator_t>,
                                bool> = true>
     DETRAY_HOST explicit surface_lookup(allocator_t &resource)
-        : m_container(&resource) {}
+        : m_container(&resource), m_source_index(&resource) {}
 
     /// Copy Construct with a specific memory resource @param resource
     /// (host-side only)
@@ -104,14 +175,15 @@ class surface_lookup {
                          bool> = true>
     DETRAY_HOST explicit surface_lookup(allocator_t &resource,
                                         const source_link<sf_desc_t> &arg)
-        : m_container(&resource, arg) {}
+        : m_container(&resource, arg), m_source_index(&resource) {}
 
     /// Construct from the container @param view . Mainly used device-side.
     template <typename container_view_t,
               std::enable_if_t<detail::is_device_view_v<container_view_t>,
                                bool> = true>
     DETRAY_HOST_DEVICE surface_lookup(container_view_t &view)
-        : m_container(view) {}
+        : m_container(detail::get<0>(view.m_view)),
+          m_source_index(detail::get<1>(view.m_view)) {}
 
     /// @returns the size of the underlying container
     DETRAY_HOST_DEVICE
@@ -132,7 +204,10 @@ class surface_lookup {
     DETRAY_HOST void resize(std::size_t n) { m_container.resize(n); }
 
     /// Removes and destructs all elements in the container.
-    DETRAY_HOST void clear() { m_container.clear(); }
+    DETRAY_HOST void clear() {
+        m_container.clear();
+        m_source_index.clear();
+    }
 
     /// @returns the collections iterator at the start position.
     DETRAY_HOST_DEVICE
@@ -197,11 +272,35 @@ class surface_lookup {
     }
 
     /// @returns the surface descriptor according to the searcher passed as
-    /// @param source_searcher
+    /// @param source_searcher (is handed the source link index, if it can
+    /// make use of it)
     template <typename searcher_t = default_searcher>
     DETRAY_HOST_DEVICE constexpr decltype(auto) search(
         searcher_t &&source_searcher) const {
-        return source_searcher(m_container);
+        if constexpr (std::is_invocable_v<searcher_t, const base_type &,
+                                          const index_type &>) {
+            return source_searcher(m_container, m_source_index);
+        } else {
+            return source_searcher(m_container);
+        }
+    }
+
+    /// @returns the sorted source link index - const
+    DETRAY_HOST_DEVICE
+    auto source_index() const -> const index_type & { return m_source_index; }
+
+    /// Build the sorted source link index over all surfaces that have a
+    /// valid source link. Has to be rebuilt after the surfaces changed.
+    DETRAY_HOST void build_source_index() {
+        m_source_index.clear();
+        m_source_index.reserve(m_container.size());
+
+        for (const auto &sf_link : m_container) {
+            if (!detail::is_invalid_value(sf_link.source)) {
+                m_source_index.push_back({sf_link.source, sf_link.index()});
+            }
+        }
+        detail::sequential_sort(m_source_index.begin(), m_source_index.end());
     }
 
     /// Add a new element to the collection
@@ -212,6 +311,7 @@ class surface_lookup {
                                          std::uint64_t src) noexcept(false)
         -> void {
         m_container.push_back({sf_desc, src});
+        m_source_index.clear();
     }
 
     /// Add a new element to the collection - copy
@@ -220,6 +320,7 @@ class surface_lookup {
     DETRAY_HOST constexpr auto push_back(
         source_link<sf_desc_t> sf_link) noexcept(false) -> void {
         m_container.push_back(sf_link);
+        m_source_index.clear();
     }
 
     /// Insert a surface descriptor @param sf_desc and its source index
@@ -242,21 +343,26 @@ class surface_lookup {
             m_container.resize(sf_link.index() + 1u);
         }
         m_container.at(sf_link.index()) = sf_link;
+        m_source_index.clear();
     }
 
     /// @return the view on the underlying container - non-const
     DETRAY_HOST auto get_data() -> view_type {
-        return detray::get_data(m_container);
+        return view_type{detray::get_data(m_container),
+                         detray::get_data(m_source_index)};
     }
 
     /// @return the view on the underlying container - const
     DETRAY_HOST auto get_data() const -> const_view_type {
-        return detray::get_data(m_container);
+        return const_view_type{detray::get_data(m_container),
+                               detray::get_data(m_source_index)};
     }
 
     private:
     /// The underlying container implementation
     base_type m_container;
+    /// Source links and surface indices, sorted by source link
+    index_type m_source_index;
 };
 
 }  // namespace detray
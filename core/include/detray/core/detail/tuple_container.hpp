@@ -134,10 +134,39 @@ class tuple_container {
     DETRAY_HOST_DEVICE decltype(auto) visit(const std::size_t idx,
                                             Args &&... As) const {
 
+        return visit_dispatch<functor_t>(
+            idx, std::make_index_sequence<sizeof...(Ts)>{},
+            std::forward<Args>(As)...);
+    }
+
+    /// Visits a tuple element according to its @param idx by testing the
+    /// indices one after the other (reference implementation of @c visit ).
+    ///
+    /// @returns the functor result.
+    template <typename functor_t, typename... Args>
+    DETRAY_HOST_DEVICE decltype(auto) visit_sequential(const std::size_t idx,
+                                                       Args &&... As) const {
+
         return visit<functor_t>(idx, std::make_index_sequence<sizeof...(Ts)>{},
                                 std::forward<Args>(As)...);
     }
 
+    /// Visits a tuple element according to its @param idx, but only if it is
+    /// one of the elements in the index sequence @tparam seq_t. No code is
+    /// generated for the other elements and they yield the default result.
+    ///
+    /// @returns the functor result.
+    template <typename functor_t, typename seq_t, typename... Args>
+    DETRAY_HOST_DEVICE decltype(auto) visit_subset(const std::size_t idx,
+                                                   Args &&... As) const {
+
+        if constexpr (seq_t::size() == 0u) {
+            return visit_result_t<functor_t, Args...>();
+        } else {
+            return visit<functor_t>(idx, seq_t{}, std::forward<Args>(As)...);
+        }
+    }
+
     private:
     /// @returns the view for all contained types.
     template <bool all_viewable = std::conjunction_v<detail::has_view<Ts>...>,
@@ -175,6 +204,68 @@ class tuple_container {
         return functor_t{}(std::forward<Args>(As)..., get<I>()...);
     }
 
+    /// Result type of a visitor @tparam functor_t
+    template <typename functor_t, typename... Args>
+    using visit_result_t =
+        std::invoke_result_t<functor_t,
+                             const detail::tuple_element_t<0, tuple_type> &,
+                             Args...>;
+
+    /// Calls the functor on the tuple element @tparam I of @param container
+    template <typename functor_t, std::size_t I, typename... Args>
+    DETRAY_HOST_DEVICE static visit_result_t<functor_t, Args...> visit_element(
+        const tuple_container &container, Args &&... As) {
+        return functor_t()(container.template get<I>(),
+                           std::forward<Args>(As)...);
+    }
+
+    /// Calls a functor on the element that corresponds to @param idx.
+    ///
+    /// On the host, the element is selected by a jump through a table of
+    /// function pointers that is built at compile time, which is a single
+    /// indirect call regardless of the number of types. In device code, where
+    /// indirect calls are expensive, the index comparisons are flattened into
+    /// a fold expression that the compiler can lower into a switch.
+    ///
+    /// @tparam functor_t functor that will be called on the element.
+    /// @tparam Args argument types for the functor
+    template <typename functor_t, typename... Args, std::size_t... I>
+    DETRAY_HOST_DEVICE visit_result_t<functor_t, Args...> visit_dispatch(
+        const std::size_t idx, std::index_sequence<I...> /*seq*/,
+        Args &&... As) const {
+
+        using result_t = visit_result_t<functor_t, Args...>;
+
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__) || \
+    defined(__SYCL_DEVICE_ONLY__)
+        if constexpr (std::is_same_v<result_t, void>) {
+            (void)((idx == I and
+                    (functor_t()(get<I>(), std::forward<Args>(As)...), true)) or
+                   ...);
+        } else {
+            result_t result{};
+            (void)((idx == I and
+                    (result = functor_t()(get<I>(), std::forward<Args>(As)...),
+                     true)) or
+                   ...);
+            return result;
+        }
+#else
+        using dispatch_t = result_t (*)(const tuple_container &, Args &&...);
+
+        constexpr dispatch_t table[]{
+            &tuple_container::template visit_element<functor_t, I, Args...>...};
+
+        if (idx < sizeof...(I)) {
+            return table[idx](*this, std::forward<Args>(As)...);
+        }
+        // If there is no matching ID, return default output
+        if constexpr (not std::is_same_v<result_t, void>) {
+            return {};
+        }
+#endif
+    }
+
     /// Variadic unrolling of the tuple that calls a functor on the element that
     /// corresponds to @param idx.
     ///
@@ -0,0 +1,192 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_buffers.hpp"
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/detail/algorithms.hpp"
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/utils/invalid_values.hpp"
+#include "detray/utils/ranges/subrange.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace detray {
+
+/// @brief Adjacency of the detector volumes through their portals.
+///
+/// The neighbours of all volumes are stored in compressed sparse row format:
+/// The volume index selects a range of edges, and every edge holds the index
+/// of a neighbouring volume, together with the range of portals that lead
+/// into it. The portals are stored as surface indices, grouped by edge.
+/// Portals that leave the detector world form an edge with an invalid
+/// neighbour index.
+///
+/// @tparam container_t The type of container to use for the data
+template <template <typename...> class container_t = dvector>
+class volume_adjacency {
+
+    public:
+    /// Link from a volume to one of its neighbours
+    struct edge {
+        /// Index of the neighbouring volume
+        dindex volume{detail::invalid_value<dindex>()};
+        /// Range of portals that lead into the neighbour
+        dindex_range portals{0u, 0u};
+
+        /// @returns true if the edge leaves the detector world
+        DETRAY_HOST_DEVICE
+        constexpr bool leaves_world() const {
+            return detail::is_invalid_value(volume);
+        }
+
+        /// @returns the number of portals that lead into the neighbour
+        DETRAY_HOST_DEVICE
+        constexpr dindex n_portals() const { return portals[1] - portals[0]; }
+    };
+
+    using offset_container = container_t<dindex>;
+    using edge_container = container_t<edge>;
+    using portal_container = container_t<dindex>;
+
+    /// Vecmem view types
+    using view_type = dmulti_view<detail::get_view_t<offset_container>,
+                                  detail::get_view_t<edge_container>,
+                                  detail::get_view_t<portal_container>>;
+    using const_view_type =
+        dmulti_view<detail::get_view_t<const offset_container>,
+                    detail::get_view_t<const edge_container>,
+                    detail::get_view_t<const portal_container>>;
+    using buffer_type = dmulti_buffer<detail::get_buffer_t<offset_container>,
+                                      detail::get_buffer_t<edge_container>,
+                                      detail::get_buffer_t<portal_container>>;
+
+    /// Empty adjacency
+    constexpr volume_adjacency() = default;
+
+    /// Construct with a specific memory resource @param resource
+    /// (host-side only)
+    template <typename allocator_t = vecmem::memory_resource,
+              std::enable_if_t<not detail::is_device_view_v<allocator_t>,
+                               bool> = true>
+    DETRAY_HOST explicit volume_adjacency(allocator_t &resource)
+        : m_offsets(&resource), m_edges(&resource), m_portals(&resource) {}
+
+    /// Construct from the container @param view . Mainly used device-side.
+    template <typename container_view_t,
+              std::enable_if_t<detail::is_device_view_v<container_view_t>,
+                               bool> = true>
+    DETRAY_HOST_DEVICE explicit volume_adjacency(container_view_t &view)
+        : m_offsets(detail::get<0>(view.m_view)),
+          m_edges(detail::get<1>(view.m_view)),
+          m_portals(detail::get<2>(view.m_view)) {}
+
+    /// @returns the number of volumes in the adjacency
+    DETRAY_HOST_DEVICE
+    constexpr dindex n_volumes() const {
+        return m_offsets.empty() ? 0u
+                                 : static_cast<dindex>(m_offsets.size() - 1u);
+    }
+
+    /// @returns true if the adjacency was not built
+    DETRAY_HOST_DEVICE
+    constexpr bool empty() const { return m_offsets.empty(); }
+
+    /// @returns the edges to the neighbours of the volume @param vol_idx
+    DETRAY_HOST_DEVICE
+    constexpr auto neighbours(const dindex vol_idx) const {
+        return detray::ranges::subrange(
+            m_edges, dindex_range{m_offsets[vol_idx], m_offsets[vol_idx + 1u]});
+    }
+
+    /// @returns the surface indices of the portals along the edge @param e
+    DETRAY_HOST_DEVICE
+    constexpr auto portals(const edge &e) const {
+        return detray::ranges::subrange(m_portals, e.portals);
+    }
+
+    /// @returns all edges - const
+    DETRAY_HOST_DEVICE
+    auto edges() const -> const edge_container & { return m_edges; }
+
+    /// Removes all volumes
+    DETRAY_HOST void clear() {
+        m_offsets.clear();
+        m_edges.clear();
+        m_portals.clear();
+    }
+
+    /// Reserve memory for @param n_volumes volumes and @param n_portals
+    /// portals in total
+    DETRAY_HOST void reserve(const std::size_t n_volumes,
+                             const std::size_t n_portals) {
+        m_offsets.reserve(n_volumes + 1u);
+        m_edges.reserve(n_portals);
+        m_portals.reserve(n_portals);
+    }
+
+    /// Append the next volume, given the links of its portals
+    ///
+    /// @param links pairs of neighbour volume index and portal surface index
+    DETRAY_HOST void push_back(std::vector<std::pair<dindex, dindex>> links) {
+        if (m_offsets.empty()) {
+            m_offsets.push_back(0u);
+        }
+
+        // Group the portals by neighbour (the world edge goes last)
+        detail::sequential_sort(links.begin(), links.end());
+
+        for (std::size_t i = 0u; i < links.size();) {
+            const dindex neighbour{links[i].first};
+            const auto first{static_cast<dindex>(m_portals.size())};
+
+            for (; i < links.size() and links[i].first == neighbour; ++i) {
+                m_portals.push_back(links[i].second);
+            }
+
+            m_edges.push_back(
+                {neighbour,
+                 dindex_range{first, static_cast<dindex>(m_portals.size())}});
+        }
+
+        m_offsets.push_back(static_cast<dindex>(m_edges.size()));
+    }
+
+    /// @return the view on the underlying containers - non-const
+    DETRAY_HOST auto get_data() -> view_type {
+        return view_type{detray::get_data(m_offsets),
+                         detray::get_data(m_edges),
+                         detray::get_data(m_portals)};
+    }
+
+    /// @return the view on the underlying containers - const
+    DETRAY_HOST auto get_data() const -> const_view_type {
+        return const_view_type{detray::get_data(m_offsets),
+                               detray::get_data(m_edges),
+                               detray::get_data(m_portals)};
+    }
+
+    private:
+    /// First edge of every volume (with one past the end for the last volume)
+    offset_container m_offsets;
+    /// Neighbours of all volumes
+    edge_container m_edges;
+    /// Surface indices of the portals of all edges
+    portal_container m_portals;
+};
+
+}  // namespace detray
@@ -12,18 +12,26 @@
 #include "detray/core/detail/container_buffers.hpp"
 #include "detray/core/detail/container_views.hpp"
 #include "detray/core/detail/surface_lookup.hpp"
+#include "detray/core/detail/volume_adjacency.hpp"
 #include "detray/core/detector_metadata.hpp"
 #include "detray/definitions/detail/algebra.hpp"
 #include "detray/definitions/detail/containers.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/units.hpp"
 #include "detray/geometry/detail/volume_descriptor.hpp"
+#include "detray/geometry/detector_volume.hpp"
+#include "detray/geometry/surface.hpp"
+#include "detray/navigation/detail/ray.hpp"
+#include "detray/navigation/navigation_config.hpp"
 #include "detray/utils/ranges.hpp"  // @TODO remove
+#include "detray/utils/type_traits.hpp"
 
 // Vecmem include(s)
 #include <vecmem/memory/memory_resource.hpp>
 
 // System include(s)
 #include <algorithm>
+#include <array>
 #include <map>
 #include <sstream>
 #include <string>
@@ -119,6 +127,9 @@ class detector {
     using volume_finder =
         typename metadata::template volume_finder<container_t>;
 
+    /// Neighbours of the volumes through their portals
+    using volume_adjacency_type = detray::volume_adjacency<vector_type>;
+
     /// Detector view types
     /// @TODO: Switch to const_view_type always if possible
     using view_type = dmulti_view<dvector_view<volume_type>,
@@ -127,7 +138,8 @@ class detector {
                                   typename mask_container::view_type,
                                   typename material_container::view_type,
                                   typename accelerator_container::view_type,
-                                  typename volume_finder::view_type>;
+                                  typename volume_finder::view_type,
+                                  typename volume_adjacency_type::view_type>;
 
     static_assert(detail::is_device_view_v<view_type>,
                   "Detector view type ill-formed");
@@ -139,7 +151,8 @@ class detector {
                     typename mask_container::const_view_type,
                     typename material_container::const_view_type,
                     typename accelerator_container::const_view_type,
-                    typename volume_finder::const_view_type>;
+                    typename volume_finder::const_view_type,
+                    typename volume_adjacency_type::const_view_type>;
 
     static_assert(detail::is_device_view_v<const_view_type>,
                   "Detector const view type ill-formed");
@@ -152,7 +165,8 @@ class detector {
                       typename mask_container::buffer_type,
                       typename material_container::buffer_type,
                       typename accelerator_container::buffer_type,
-                      typename volume_finder::buffer_type>;
+                      typename volume_finder::buffer_type,
+                      typename volume_adjacency_type::buffer_type>;
 
     static_assert(detail::is_buffer_v<buffer_type>,
                   "Detector buffer type ill-formed");
@@ -182,6 +196,7 @@ class detector {
           _materials(resource),
           _accelerators(resource),
           _volume_finder(resource),
+          _volume_adjacency(resource),
           _resource(&resource) {}
 
     /// Constructor from detector data view
@@ -195,7 +210,8 @@ class detector {
           _masks(detray::detail::get<3>(det_data.m_view)),
           _materials(detray::detail::get<4>(det_data.m_view)),
           _accelerators(detray::detail::get<5>(det_data.m_view)),
-          _volume_finder(detray::detail::get<6>(det_data.m_view)) {}
+          _volume_finder(detray::detail::get<6>(det_data.m_view)),
+          _volume_adjacency(detray::detail::get<7>(det_data.m_view)) {}
     /// @}
 
     /// @return the sub-volumes of the detector - const access
@@ -213,14 +229,18 @@ class detector {
     /// @return the volume by global cartesian @param position - const access
     DETRAY_HOST_DEVICE
     inline const auto &volume(const point3_type &p) const {
-        // The 3D cylindrical volume search grid is concentric
-        const transform3_type identity{};
-        const auto loc_pos =
-            _volume_finder.project(identity, p, identity.translation());
-
-        // Only one entry per bin
-        dindex volume_index{*_volume_finder.search(loc_pos)};
-        return _volumes[volume_index];
+        if constexpr (detail::is_grid_v<volume_finder>) {
+            // The 3D cylindrical volume search grid is concentric
+            const transform3_type identity{};
+            const auto loc_pos =
+                _volume_finder.project(identity, p, identity.translation());
+
+            // Only one entry per bin
+            dindex volume_index{*_volume_finder.search(loc_pos)};
+            return _volumes[volume_index];
+        } else {
+            return _volumes[_volume_finder.search(p)];
+        }
     }
 
     /// @return the sub-volumes of the detector - const access
@@ -236,6 +256,75 @@ class detector {
         return _surfaces.search(std::forward<query_t>(q));
     }
 
+    /// @returns the sensitive surface on which the global point @param p
+    /// lies, or a surface descriptor with an invalid barcode, if there is
+    /// none.
+    ///
+    /// The volume of the point is taken from the volume finder and only the
+    /// sensitive surfaces in the neighborhood search of its accelerators
+    /// (around the point, plus one bin) are tested. The point has to be inside
+    /// of the detector world.
+    ///
+    /// @param tol how far the point may lie off the surface or its mask
+    /// @param ctx the geometry context
+    /// @param dir a direction through the point, e.g. the track direction
+    ///            of a hit. It defines the local frame of line surfaces and
+    ///            the search direction of some accelerators. The default is
+    ///            the direction from the origin.
+    DETRAY_HOST_DEVICE
+    inline auto surface_at(const point3_type &p,
+                           const scalar_type tol = 1.f * unit<scalar_type>::um,
+                           const geometry_context &ctx = {},
+                           const vector3_type &dir = {0.f, 0.f, 0.f}) const
+        -> surface_type {
+
+        const scalar_type r{getter::norm(p)};
+        const vector3_type search_dir{
+            getter::norm(dir) > 0.f
+                ? vector::normalize(dir)
+                : (r > 0.f ? (1.f / r) * p : vector3_type{0.f, 0.f, 1.f})};
+
+        navigation::volume_config<scalar_type> cfg{};
+        cfg.mask_tolerance = tol;
+        cfg.search_window = {1u, 1u};
+
+        const detail::ray<algebra_type> query(p, 0.f, search_dir, 0.f);
+
+        surface_type result{};
+        const auto vol = detector_volume{*this, volume(p)};
+        vol.template visit_neighborhood<surface_matcher>(
+            query, cfg, *this, p, search_dir, tol, ctx, result);
+
+        return result;
+    }
+
+    /// Find the sensitive surfaces of a batch of global points.
+    ///
+    /// Writes the result of @c surface_at for the point at every index to
+    /// the same index in @param results . The executor decides which indices
+    /// are processed by the caller, e.g. all of them in a loop on host, or
+    /// the index of the thread in a device kernel (see the executors of the
+    /// batch propagation).
+    ///
+    /// @param points the global points, e.g. the simulated hits of an event
+    /// @param results the matched surfaces, at least one per point
+    /// @param exec the executor that calls a functor for the point indices
+    /// @param tol how far a point may lie off the surface or its mask
+    /// @param ctx the geometry context
+    template <typename point_range_t, typename result_range_t,
+              typename executor_t>
+    DETRAY_HOST_DEVICE inline void surfaces_at(
+        const point_range_t &points, result_range_t &results,
+        const executor_t &exec,
+        const scalar_type tol = 1.f * unit<scalar_type>::um,
+        const geometry_context &ctx = {}) const {
+
+        exec(static_cast<unsigned int>(points.size()),
+             [&](const unsigned int i) {
+                 results[i] = surface_at(points[i], tol, ctx);
+             });
+    }
+
     /// @return detector transform store
     DETRAY_HOST_DEVICE
     inline auto transform_store() const -> const transform_container & {
@@ -264,22 +353,35 @@ class detector {
         return _volume_finder;
     }
 
+    /// @returns the neighbours of the volumes - const access
+    /// @note only available if the detector was built by a detector builder
+    DETRAY_HOST_DEVICE
+    inline auto volume_adjacency() const -> const volume_adjacency_type & {
+        return _volume_adjacency;
+    }
+
     /// @returns view of a detector
     DETRAY_HOST auto get_data() -> view_type {
-        return view_type{
-            detray::get_data(_volumes),      detray::get_data(_surfaces),
-            detray::get_data(_transforms),   detray::get_data(_masks),
-            detray::get_data(_materials),    detray::get_data(_accelerators),
-            detray::get_data(_volume_finder)};
+        return view_type{detray::get_data(_volumes),
+                         detray::get_data(_surfaces),
+                         detray::get_data(_transforms),
+                         detray::get_data(_masks),
+                         detray::get_data(_materials),
+                         detray::get_data(_accelerators),
+                         detray::get_data(_volume_finder),
+                         detray::get_data(_volume_adjacency)};
     }
 
     /// @returns const view of a detector
     DETRAY_HOST auto get_data() const -> const_view_type {
-        return const_view_type{
-            detray::get_data(_volumes),      detray::get_data(_surfaces),
-            detray::get_data(_transforms),   detray::get_data(_masks),
-            detray::get_data(_materials),    detray::get_data(_accelerators),
-            detray::get_data(_volume_finder)};
+        return const_view_type{detray::get_data(_volumes),
+                               detray::get_data(_surfaces),
+                               detray::get_data(_transforms),
+                               detray::get_data(_masks),
+                               detray::get_data(_materials),
+                               detray::get_data(_accelerators),
+                               detray::get_data(_volume_finder),
+                               detray::get_data(_volume_adjacency)};
     }
 
     /// @param names maps a volume to its string representation.
@@ -442,6 +544,12 @@ class detector {
         return _volume_finder;
     }
 
+    /// @returns the neighbours of the volumes - non-const access
+    DETRAY_HOST_DEVICE
+    inline auto volume_adjacency() -> volume_adjacency_type & {
+        return _volume_adjacency;
+    }
+
     ///------------------------------------------------------------------------
     /// @TODO Remove the following methods once all of the geometry building
     /// code has been migrated to the detector builder
@@ -559,7 +667,43 @@ class detector {
         return *std::max_element(n_candidates.begin(), n_candidates.end());
     }
 
+    /// @returns an upper bound on the number of surface candidates that any
+    /// volume may return for a neighborhood lookup with the search window
+    /// @param win_size (e.g. the @c search_window of the navigation config)
+    template <typename neighbor_t>
+    DETRAY_HOST inline auto n_max_candidates(
+        const std::array<neighbor_t, 2> &win_size) const -> std::size_t {
+        std::size_t n_max{0u};
+        for (const auto &vol : _volumes) {
+            n_max = std::max(
+                n_max, static_cast<std::size_t>(
+                           detector_volume{*this, vol}.n_max_candidates(
+                               win_size)));
+        }
+        return n_max;
+    }
+
     private:
+    /// A functor that keeps the first sensitive surface of a neighborhood
+    /// search on which a point lies
+    struct surface_matcher {
+        DETRAY_HOST_DEVICE
+        inline void operator()(const surface_type &sf_desc,
+                               const detector &det, const point3_type &p,
+                               const vector3_type &dir, const scalar_type tol,
+                               const geometry_context &ctx,
+                               surface_type &result) const {
+            if (not result.barcode().is_invalid() or
+                not sf_desc.is_sensitive()) {
+                return;
+            }
+            if (detray::surface{det, sf_desc}.is_on_surface(ctx, p, dir,
+                                                            tol)) {
+                result = sf_desc;
+            }
+        }
+    };
+
     /// Contains the detector sub-volumes.
     volume_container _volumes;
 
@@ -581,6 +725,9 @@ class detector {
     /// Search structure for volumes
     volume_finder _volume_finder;
 
+    /// Neighbours of the volumes, built together with the detector
+    volume_adjacency_type _volume_adjacency;
+
     /// The memory resource represents how and where (host, device, managed)
     /// the memory for the detector containers is allocated
     vecmem::memory_resource *_resource = nullptr;
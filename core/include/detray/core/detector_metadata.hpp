@@ -8,8 +8,8 @@
 #pragma once
 
 // Project include(s)
+#include "detray/core/detail/multi_context_store.hpp"
 #include "detray/core/detail/multi_store.hpp"
-#include "detray/core/detail/single_store.hpp"
 #include "detray/definitions/detail/algebra.hpp"
 #include "detray/definitions/detail/containers.hpp"
 #include "detray/definitions/detail/indexing.hpp"
@@ -21,8 +21,11 @@
 #include "detray/materials/material_map.hpp"
 #include "detray/materials/material_rod.hpp"
 #include "detray/materials/material_slab.hpp"
+#include "detray/navigation/accelerators/bounding_volume_hierarchy.hpp"
 #include "detray/navigation/accelerators/brute_force_finder.hpp"
 #include "detray/navigation/accelerators/surface_grid.hpp"
+#include "detray/navigation/accelerators/two_level_volume_finder.hpp"
+#include "detray/navigation/accelerators/wire_layer_finder.hpp"
 
 namespace detray {
 
@@ -147,7 +150,8 @@ struct default_metadata {
     /// How to store coordinate transform matrices
     template <template <typename...> class vector_t = dvector>
     using transform_store =
-        single_store<dtransform3D<algebra_type>, vector_t, geometry_context>;
+        multi_context_store<dtransform3D<algebra_type>, vector_t,
+                            geometry_context>;
 
     /// Give your mask types a name (needs to be consecutive and has to match
     /// the types position in the mask store!)
@@ -249,8 +253,10 @@ unbounded_cell, unmasked_plane*/>;
         e_cylinder2_grid = 2,  // e.g. barrel layers
         e_irr_disc_grid = 3,
         e_irr_cylinder2_grid = 4,
-        // e_cylinder3_grid = 5,
-        // e_irr_cylinder3_grid = 6,
+        e_bvh = 5,  // e.g. irregular volumes (bounding volume hierarchy)
+        e_wire_layers = 6,  // e.g. straw tube layers (wires sorted by phi)
+        // e_cylinder3_grid = 7,
+        // e_irr_cylinder3_grid = 8,
         // ... e.g. frustum navigation types
         e_default = e_brute_force,
     };
@@ -271,19 +277,22 @@ unbounded_cell, unmasked_plane*/>;
                         cylinder2D_sf_grid<surface_type, container_t>>,
                     grid_collection<
                         irr_disc_sf_grid<surface_type, container_t>>,
-                    grid_collection<irr_cylinder2D_sf_grid<
-                        surface_type, container_t>> /*,
+                    grid_collection<
+                        irr_cylinder2D_sf_grid<surface_type, container_t>>,
+                    bvh_collection<surface_type, container_t,
+                                   dscalar<algebra_type>>,
+                    wire_layer_collection<surface_type, container_t,
+                                          dscalar<algebra_type>> /*,
 grid_collection<cylinder3D_sf_grid<surface_type,
 container_t>>,
 grid_collection<irr_cylinder3D_sf_grid<surface_type,
 container_t>>*/>;
 
-    /// Volume search grid
+    /// Volume search data structure (coarse r-z grid with per-cell volume
+    /// lists)
     template <typename container_t = host_container_types>
     using volume_finder =
-        grid<axes<cylinder3D, axis::bounds::e_open, axis::irregular,
-                  axis::regular, axis::irregular>,
-             bins::single<dindex>, simple_serializer, container_t>;
+        two_level_volume_finder<container_t, dscalar<algebra_type>>;
 };
 
 }  // namespace detray
@@ -0,0 +1,90 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/packed_buffer.hpp"
+#include "detray/utils/numa.hpp"
+
+// Vecmem include(s)
+#include <vecmem/utils/copy.hpp>
+
+// System include(s)
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace detray {
+
+/// @brief Copies of the immutable detector data, one per NUMA node.
+///
+/// On hosts with several sockets, a detector that was built by a single
+/// thread lives on the memory of one node, and the threads of the other
+/// nodes pay the remote access latency for every transform, mask and grid
+/// lookup. The replicas pack the detector into one arena per node (see
+/// @c packed_buffer ), which is allocated on that node and optionally backed
+/// by huge pages. A thread that is bound to a node then constructs its
+/// detector from the view of the local replica, using the device container
+/// types (e.g. with @c propagation::propagate_batch_replicated ).
+///
+/// @tparam detector_t the host detector type
+template <typename detector_t>
+class detector_replicas {
+
+    public:
+    using view_type = typename detector_t::view_type;
+
+    /// Replicate the detector @param det on @param n_nodes NUMA nodes, with
+    /// huge pages if @param huge_pages is set
+    ///
+    /// @note the detector has to be fully built, since later changes are not
+    /// propagated to the replicas
+    detector_replicas(detector_t &det, const unsigned int n_nodes,
+                      const bool huge_pages = false) {
+        m_replicas.reserve(n_nodes);
+
+        vecmem::copy cpy{};
+        for (unsigned int node = 0u; node < n_nodes; ++node) {
+            // The memory resource has to outlive the arena
+            auto mr = std::make_unique<numa::memory_resource>(node, huge_pages);
+            auto buffer = detray::get_packed_buffer(det, *mr, cpy);
+
+            m_replicas.push_back({std::move(mr), std::move(buffer)});
+        }
+    }
+
+    /// Replicate the detector @param det on all NUMA nodes of the host
+    explicit detector_replicas(detector_t &det, const bool huge_pages = false)
+        : detector_replicas(det, numa::n_nodes(), huge_pages) {}
+
+    /// @returns the number of replicas
+    std::size_t size() const { return m_replicas.size(); }
+
+    /// @returns the size of a replica in bytes
+    std::size_t replica_size() const {
+        return m_replicas.empty() ? 0u : m_replicas.front().buffer.size();
+    }
+
+    /// @returns the view of the replica on the node @param node
+    view_type get_data(const unsigned int node) {
+        assert(node < m_replicas.size());
+        return m_replicas[node].buffer.get_data();
+    }
+
+    private:
+    /// The data of a single node
+    struct replica {
+        std::unique_ptr<numa::memory_resource> mr;
+        packed_buffer<view_type> buffer;
+    };
+
+    std::vector<replica> m_replicas{};
+};
+
+}  // namespace detray
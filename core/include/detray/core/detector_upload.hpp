@@ -0,0 +1,196 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_buffers.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
+
+// System include(s)
+#include <cassert>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace detray {
+
+/// Stages of an asynchronous detector upload, in the order of their copies
+enum class upload_stage : std::uint_least8_t {
+    /// Volumes, transforms, masks, surfaces and acceleration structures
+    e_geometry = 0u,
+    /// Material description
+    e_material = 1u,
+};
+
+/// @brief Events of an asynchronous detector upload, grouped by stage
+class upload_events {
+
+    public:
+    /// @returns the copy events of the stage @param s
+    dcopy_events &operator[](const upload_stage s) {
+        return s == upload_stage::e_geometry ? m_geometry : m_material;
+    }
+
+    /// Wait for the copies of the stage @param s to finish
+    void wait(const upload_stage s) {
+        for (auto &event : (*this)[s]) {
+            event->wait();
+        }
+    }
+
+    /// Wait for the entire upload to finish
+    void wait() {
+        wait(upload_stage::e_geometry);
+        wait(upload_stage::e_material);
+    }
+
+    private:
+    dcopy_events m_geometry{};
+    dcopy_events m_material{};
+};
+
+/// @brief Device buffer of a detector, together with its upload events
+template <typename detector_t>
+struct detector_upload {
+    typename detector_t::buffer_type buffer;
+    upload_events events{};
+};
+
+/// @brief Enqueue the copy of a detector @param det into device memory.
+///
+/// The copies are enqueued stage by stage: The data that the navigation needs
+/// goes first, starting with the volumes, transforms and masks, and the
+/// material goes last. The function does not wait for the copies, so a
+/// propagation that does not need the material can start as soon as the
+/// geometry stage has arrived, while the material is still in flight.
+///
+/// @note The copies are asynchronous only for an asynchronous copy object
+/// (e.g. @c vecmem::cuda::async_copy or @c vecmem::sycl::async_copy ), which
+/// also determines the stream/queue they are enqueued on. The host data has
+/// to stay alive until the upload is finished.
+///
+/// @param det the detector in host (or host accessible) memory
+/// @param mr the device memory resource for the buffers
+/// @param cpy the copy object
+/// @param buff_type fixed size or resizable buffers
+///
+/// @returns the detector buffer and the events of the upload stages
+template <typename detector_t>
+detector_upload<detector_t> upload_async(
+    detector_t &det, vecmem::memory_resource &mr, vecmem::copy &cpy,
+    vecmem::data::buffer_type buff_type =
+        vecmem::data::buffer_type::fixed_size) {
+
+    upload_events events{};
+    dcopy_events *geo_events{&events[upload_stage::e_geometry]};
+    dcopy_events *mat_events{&events[upload_stage::e_material]};
+
+    constexpr auto async{detray::copy::async};
+
+    auto vol_buff = detray::get_buffer(det.volumes(), mr, cpy, async,
+                                       buff_type, geo_events);
+    auto trf_buff = detray::get_buffer(det.transform_store(), mr, cpy, async,
+                                       buff_type, geo_events);
+    auto msk_buff = detray::get_buffer(det.mask_store(), mr, cpy, async,
+                                       buff_type, geo_events);
+    auto sf_buff = detray::get_buffer(det.surfaces(), mr, cpy, async,
+                                      buff_type, geo_events);
+    auto acc_buff = detray::get_buffer(det.accelerator_store(), mr, cpy,
+                                       async, buff_type, geo_events);
+    auto vgrid_buff = detray::get_buffer(det.volume_search_grid(), mr, cpy,
+                                         async, buff_type, geo_events);
+    auto adj_buff = detray::get_buffer(det.volume_adjacency(), mr, cpy, async,
+                                       buff_type, geo_events);
+    auto mat_buff = detray::get_buffer(det.material_store(), mr, cpy, async,
+                                       buff_type, mat_events);
+
+    return {typename detector_t::buffer_type(
+                std::move(vol_buff), std::move(sf_buff), std::move(trf_buff),
+                std::move(msk_buff), std::move(mat_buff), std::move(acc_buff),
+                std::move(vgrid_buff), std::move(adj_buff)),
+            std::move(events)};
+}
+
+/// @brief Enqueue the copy of single elements of a host vector into a device
+/// vector of the same size (e.g. the nominal transforms of a detector buffer
+/// after some surfaces were realigned).
+///
+/// Neighbouring elements are copied together, so that a patch of a large
+/// store does not need to copy the entire store again.
+///
+/// @param host the view of the host vector
+/// @param device the view of the device vector
+/// @param indices the sorted indices of the elements to be copied
+/// @param cpy the copy object
+/// @param cpy_type whether to wait for the copies
+/// @param events if given, the events of asynchronous copies are added to it
+template <typename T>
+void update_elements(const dvector_view<const T> &host,
+                     const dvector_view<T> &device,
+                     const std::vector<dindex> &indices, vecmem::copy &cpy,
+                     detray::copy cpy_type = detray::copy::sync,
+                     dcopy_events *events = nullptr) {
+
+    using size_type = typename dvector_view<T>::size_type;
+
+    assert(host.size() == device.size());
+
+    for (std::size_t i = 0u; i < indices.size();) {
+        // Find the end of the current run of neighbouring elements
+        std::size_t j{i + 1u};
+        while (j < indices.size() && indices[j] == indices[j - 1u] + 1u) {
+            ++j;
+        }
+
+        const dindex first{indices[i]};
+        const auto n{static_cast<size_type>(j - i)};
+        assert(first + n <= host.size());
+
+        const dvector_view<const T> src{n, host.ptr() + first};
+        const dvector_view<T> dst{n, device.ptr() + first};
+
+        if (cpy_type == detray::copy::async) {
+            auto event = cpy(src, dst);
+            if (events != nullptr) {
+                events->push_back(std::move(event));
+            }
+        } else {
+            cpy(src, dst)->wait();
+        }
+
+        i = j;
+    }
+}
+
+/// @brief Enqueue the copy of the nominal transforms @param trf_indices of
+/// the detector @param det into its device buffer @param buff
+///
+/// @see detray::patch::surface_transforms
+template <typename detector_t>
+void update_transforms(const detector_t &det,
+                       typename detector_t::buffer_type &buff,
+                       const std::vector<dindex> &trf_indices,
+                       vecmem::copy &cpy,
+                       detray::copy cpy_type = detray::copy::sync,
+                       dcopy_events *events = nullptr) {
+
+    // Nominal transforms on host and device
+    const auto host_view =
+        detail::get<0>(det.transform_store().get_data().m_view);
+    auto device_view = detray::get_data(
+        detail::get<0>(detail::get<2>(buff.m_buffer).m_buffer));
+
+    update_elements(host_view, device_view, trf_indices, cpy, cpy_type,
+                    events);
+}
+
+}  // namespace detray
@@ -0,0 +1,75 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s)
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace detray {
+
+/// Index sequence of type IDs (e.g. mask or material IDs of a metadata)
+template <auto... ids>
+using id_sequence = std::index_sequence<static_cast<std::size_t>(ids)...>;
+
+/// Restricts the mask and material types that the surfaces of a detector
+/// visit to a compile-time subset of the types in the metadata.
+///
+/// The data layout is that of @tparam metadata_t, so that a device detector
+/// with the trimmed metadata can be constructed from the view of a detector
+/// that was built with the full metadata. Since the visitors are only
+/// instantiated for the given types, the navigation and material kernels are
+/// smaller and need fewer registers. It is up to the caller to make sure that
+/// the geometry does not contain any other mask or material types: surfaces
+/// with other types are silently treated as not intersected and material-free.
+///
+/// @tparam metadata_t the metadata the detector was built with
+/// @tparam mask_ids_t @c id_sequence of the mask IDs that are visited
+/// @tparam material_ids_t @c id_sequence of the material IDs that are visited
+template <typename metadata_t, typename mask_ids_t, typename material_ids_t>
+struct trimmed_metadata : public metadata_t {
+    using visited_masks = mask_ids_t;
+    using visited_materials = material_ids_t;
+};
+
+namespace detail {
+
+/// Check whether a metadata restricts the visited mask types
+/// @{
+template <typename metadata_t, typename = void>
+struct has_visited_masks : public std::false_type {};
+
+template <typename metadata_t>
+struct has_visited_masks<metadata_t,
+                         std::void_t<typename metadata_t::visited_masks>>
+    : public std::true_type {};
+
+template <typename metadata_t>
+inline constexpr bool has_visited_masks_v =
+    has_visited_masks<metadata_t>::value;
+/// @}
+
+/// Check whether a metadata restricts the visited material types
+/// @{
+template <typename metadata_t, typename = void>
+struct has_visited_materials : public std::false_type {};
+
+template <typename metadata_t>
+struct has_visited_materials<
+    metadata_t, std::void_t<typename metadata_t::visited_materials>>
+    : public std::true_type {};
+
+template <typename metadata_t>
+inline constexpr bool has_visited_materials_v =
+    has_visited_materials<metadata_t>::value;
+/// @}
+
+}  // namespace detail
+
+}  // namespace detray
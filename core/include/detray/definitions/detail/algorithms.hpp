@@ -22,6 +22,7 @@
 // System include(s)
 #include <algorithm>
 #include <cmath>
+#include <functional>
 #include <type_traits>
 #include <utility>
 
@@ -49,6 +50,87 @@ DETRAY_HOST_DEVICE inline void sequential_sort(RandomIt first, RandomIt last,
 #endif
 }
 
+/// Largest range that is sorted by a sorting network in @c adaptive_sort
+inline constexpr long k_network_sort_max{8};
+/// Largest range that is always insertion sorted in @c adaptive_sort (on
+/// device, the general purpose sort is a selection sort)
+#if defined(__CUDACC__) || defined(CL_SYCL_LANGUAGE_VERSION) || \
+    defined(SYCL_LANGUAGE_VERSION)
+inline constexpr long k_insertion_sort_max{64};
+#else
+inline constexpr long k_insertion_sort_max{16};
+#endif
+/// Larger ranges are insertion sorted, if at most one in this many
+/// neighbouring elements is out of order
+inline constexpr long k_presorted_ratio{8};
+
+/// @brief sequential (single thread) sort that picks the algorithm by the
+/// size and the presortedness of the range:
+///
+/// - up to @c k_network_sort_max elements: sorting network
+/// - already sorted ranges are detected in a single pass and left alone
+/// - small or almost sorted ranges: insertion sort
+/// - otherwise: @c sequential_sort
+template <class RandomIt, class Comp = std::less<void>>
+DETRAY_HOST_DEVICE inline void adaptive_sort(RandomIt first, RandomIt last,
+                                             Comp&& comp = Comp()) {
+
+    const auto n{static_cast<long>(last - first)};
+    if (n <= k_network_sort_max) {
+        sorting_network(first, last, comp);
+        return;
+    }
+
+    const auto n_descents{static_cast<long>(count_descents(first, last, comp))};
+    if (n_descents == 0) {
+        return;
+    }
+
+    if (n <= k_insertion_sort_max || n_descents * k_presorted_ratio <= n) {
+        linear_insertion_sort(first, last, comp);
+    } else if constexpr (std::is_same_v<std::decay_t<Comp>, std::less<void>>) {
+        sequential_sort(first, last);
+    } else {
+        sequential_sort(first, last, std::forward<Comp>(comp));
+    }
+}
+
+/// @brief sequential (single thread) partial sort function: only the range
+/// [first, middle) is sorted and holds the smallest elements
+template <class RandomIt>
+DETRAY_HOST_DEVICE inline void sequential_partial_sort(RandomIt first,
+                                                       RandomIt middle,
+                                                       RandomIt last) {
+#if defined(__CUDACC__) || defined(CL_SYCL_LANGUAGE_VERSION) || \
+    defined(SYCL_LANGUAGE_VERSION)
+    partial_selection_sort(first, middle, last);
+#else
+    std::partial_sort(first, middle, last);
+#endif
+}
+
+/// @brief partition implementation for host/device (single thread): element
+/// that satisfy the predicate are moved to the front of the range (unstable)
+///
+/// @returns iterator to the first element of the second group
+template <class RandomIt, class Predicate>
+DETRAY_HOST_DEVICE inline auto partition(RandomIt first, RandomIt last,
+                                         Predicate&& comp) {
+    RandomIt middle = first;
+    for (RandomIt i = first; i != last; ++i) {
+        if (comp(*i)) {
+            if (i != middle) {
+                auto t = *middle;
+                *middle = *i;
+                *i = t;
+            }
+            ++middle;
+        }
+    }
+
+    return middle;
+}
+
 /// @brief find_if implementation for host/devcie (single thread)
 template <class RandomIt, class Predicate>
 DETRAY_HOST_DEVICE inline auto find_if(RandomIt first, RandomIt last,
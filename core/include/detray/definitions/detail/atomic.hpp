@@ -0,0 +1,106 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/qualifiers.hpp"
+
+// SYCL include(s).
+#if defined(CL_SYCL_LANGUAGE_VERSION) || defined(SYCL_LANGUAGE_VERSION)
+#include <CL/sycl.hpp>
+#endif
+
+// System include(s).
+#include <type_traits>
+
+namespace detray::detail {
+
+/// Relaxed atomic operations on plain values in host or device memory.
+///
+/// The operations only guarantee that concurrent updates of the same value
+/// are not lost: Other memory accesses are not ordered by them, which is
+/// enough as long as the results are only read after the threads (or the
+/// kernel) have been joined.
+/// @{
+
+/// Atomically add @param value to the integer or floating point value at
+/// @param address (double precision needs compute capability 6.0 on CUDA)
+///
+/// @returns the value before the addition
+template <typename T>
+DETRAY_HOST_DEVICE inline T atomic_add(T *address, const T value) {
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+    return atomicAdd(address, value);
+#elif defined(__SYCL_DEVICE_ONLY__)
+    cl::sycl::atomic_ref<T, cl::sycl::memory_order::relaxed,
+                         cl::sycl::memory_scope::device>
+        ref{*address};
+    return ref.fetch_add(value);
+#else
+    if constexpr (std::is_floating_point_v<T>) {
+        // No fetch-add for floating point values: Retry the addition until
+        // no other thread changed the value in between
+        T old;
+        __atomic_load(address, &old, __ATOMIC_RELAXED);
+        T desired{old + value};
+        while (!__atomic_compare_exchange(address, &old, &desired, false,
+                                          __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+            desired = old + value;
+        }
+        return old;
+    } else {
+        return __atomic_fetch_add(address, value, __ATOMIC_RELAXED);
+    }
+#endif
+}
+
+/// Atomically replace the integer at @param address by @param desired , if
+/// it is equal to @param expected
+///
+/// @returns the value before the operation (equal to @param expected if the
+///          replacement took place)
+template <typename T>
+DETRAY_HOST_DEVICE inline T atomic_cas(T *address, T expected,
+                                       const T desired) {
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+    return atomicCAS(address, expected, desired);
+#elif defined(__SYCL_DEVICE_ONLY__)
+    cl::sycl::atomic_ref<T, cl::sycl::memory_order::relaxed,
+                         cl::sycl::memory_scope::device>
+        ref{*address};
+    ref.compare_exchange_strong(expected, desired);
+    return expected;
+#else
+    __atomic_compare_exchange_n(address, &expected, desired, false,
+                                __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+    return expected;
+#endif
+}
+
+/// Atomically increment the integer at @param address , unless it has
+/// reached @param bound
+///
+/// @returns the value before the increment or @param bound if the value was
+///          not incremented
+template <typename T>
+DETRAY_HOST_DEVICE inline T atomic_inc_below(T *address, const T bound) {
+    // The first exchange fails, unless the value is zero, but yields the
+    // current value
+    T n{0};
+    while (n < bound) {
+        const T old{atomic_cas(address, n, static_cast<T>(n + 1))};
+        if (old == n) {
+            return n;
+        }
+        n = old;
+    }
+    return bound;
+}
+/// @}
+
+}  // namespace detray::detail
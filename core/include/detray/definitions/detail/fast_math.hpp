@@ -0,0 +1,239 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+
+// System include(s)
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace detray {
+
+namespace detail::approx {
+
+/// Branch-free single precision approximations of the transcendental
+/// functions (after the Cephes library), that can be vectorized by the
+/// compiler. The errors are given with respect to the correctly rounded
+/// results, for arguments in the stated domain.
+/// @{
+
+/// Sine and cosine of @param x : absolute error < 2e-7 for |x| < 8192
+template <typename scalar_t>
+DETRAY_HOST_DEVICE inline void sincos(const scalar_t x, scalar_t &sin_x,
+                                      scalar_t &cos_x) {
+    static_assert(std::is_same_v<scalar_t, float>, "Single precision only");
+
+    // Reduce to r in [-pi/4, pi/4] (pi/2 split in three parts for accuracy)
+    const float q{math::floor(x * 0.636619772367581343f + 0.5f)};
+    const float r{((x - q * 1.5703125f) - q * 4.837512969970703125e-4f) -
+                  q * 7.54978995489188216e-8f};
+    const float z{r * r};
+
+    const float s{
+        ((-1.9515295891e-4f * z + 8.3321608736e-3f) * z - 1.6666654611e-1f) *
+            z * r +
+        r};
+    const float c{
+        ((2.443315711809948e-5f * z - 1.388731625493765e-3f) * z +
+         4.166664568298827e-2f) *
+            z * z -
+        0.5f * z + 1.f};
+
+    // Map back from the quadrant
+    const auto quadrant{static_cast<std::int32_t>(q) & 3};
+    sin_x = (quadrant & 1) ? c : s;
+    cos_x = (quadrant & 1) ? s : c;
+    sin_x = (quadrant & 2) ? -sin_x : sin_x;
+    cos_x = ((quadrant + 1) & 2) ? -cos_x : cos_x;
+}
+
+/// @returns the sine of @param x (see @c sincos )
+template <typename scalar_t>
+DETRAY_HOST_DEVICE inline scalar_t sin(const scalar_t x) {
+    scalar_t s;
+    scalar_t c;
+    sincos(x, s, c);
+    return s;
+}
+
+/// @returns the cosine of @param x (see @c sincos )
+template <typename scalar_t>
+DETRAY_HOST_DEVICE inline scalar_t cos(const scalar_t x) {
+    scalar_t s;
+    scalar_t c;
+    sincos(x, s, c);
+    return c;
+}
+
+/// @returns the angle of the point (@param x, @param y ) in [-pi, pi]:
+/// absolute error < 3e-7
+template <typename scalar_t>
+DETRAY_HOST_DEVICE inline scalar_t atan2(const scalar_t y, const scalar_t x) {
+    static_assert(std::is_same_v<scalar_t, float>, "Single precision only");
+
+    constexpr float pi{3.14159265358979323846f};
+
+    const float ax{math::fabs(x)};
+    const float ay{math::fabs(y)};
+    const float max_xy{math::fmax(ax, ay)};
+    const float min_xy{math::fmin(ax, ay)};
+
+    // Ratio in [0, 1], shifted to [-1/3, tan(pi/8)] above tan(pi/8)
+    const float t{max_xy > 0.f ? min_xy / max_xy : 0.f};
+    const bool is_large{t > 0.4142135623730950f};
+    const float u{is_large ? (t - 1.f) / (t + 1.f) : t};
+    const float z{u * u};
+
+    float a{(((8.05374449538e-2f * z - 1.38776856032e-1f) * z +
+              1.99777106478e-1f) *
+                 z -
+             3.33329491539e-1f) *
+                z * u +
+            u};
+    a = is_large ? a + 0.25f * pi : a;
+
+    // Map back to the octant
+    a = (ay > ax) ? 0.5f * pi - a : a;
+    a = (x < 0.f) ? pi - a : a;
+
+    return math::copysign(a, y);
+}
+
+/// @returns the natural logarithm of @param x : absolute error < 1e-7 in
+/// [0.5, 2], relative error < 2e-7 for all other positive, normal values
+template <typename scalar_t>
+DETRAY_HOST_DEVICE inline scalar_t log(const scalar_t x) {
+    static_assert(std::is_same_v<scalar_t, float>, "Single precision only");
+
+    // Split into mantissa in [0.5, 1) and exponent
+    std::uint32_t bits;
+    std::memcpy(&bits, &x, sizeof(float));
+    float e{static_cast<float>(static_cast<std::int32_t>((bits >> 23) & 0xffu) -
+                               126)};
+    bits = (bits & 0x807fffffu) | 0x3f000000u;
+    float m;
+    std::memcpy(&m, &bits, sizeof(float));
+
+    // Mantissa in [sqrt(0.5), sqrt(2)) around one
+    const bool is_small{m < 0.707106781186547524f};
+    e = is_small ? e - 1.f : e;
+    m = is_small ? m + m - 1.f : m - 1.f;
+    const float z{m * m};
+
+    float y{((((((((7.0376836292e-2f * m - 1.1514610310e-1f) * m +
+                   1.1676998740e-1f) *
+                      m -
+                  1.2420140846e-1f) *
+                     m +
+                 1.4249322787e-1f) *
+                    m -
+                1.6668057665e-1f) *
+                   m +
+               2.0000714765e-1f) *
+                  m -
+              2.4999993993e-1f) *
+                 m +
+             3.3333331174e-1f) *
+            z * m};
+    y += -2.12194440e-4f * e - 0.5f * z;
+
+    return m + y + 0.693359375f * e;
+}
+/// @}
+
+}  // namespace detail::approx
+
+/// @brief Transcendental functions for the hot paths (coordinate
+/// transformations, Jacobians, material interaction, helix).
+///
+/// Forward to the standard math functions, unless detray is built with
+/// @c DETRAY_FAST_MATH : Then single precision arguments are routed to the
+/// polynomial approximations in @c detail::approx on host and to the CUDA/HIP
+/// intrinsics on device (@c __sinf, @c __cosf : absolute error < 2^-21.4 in
+/// [-pi, pi], growing outside; @c __logf : absolute error < 2^-21.4 in
+/// [0.5, 2], relative error < 2^-21 otherwise). Double precision is never
+/// approximated.
+namespace fast_math {
+
+#if defined(DETRAY_FAST_MATH) && \
+    (defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__))
+#define DETRAY_FAST_MATH_DEVICE
+#endif
+
+template <typename scalar_t>
+DETRAY_HOST_DEVICE inline scalar_t sin(const scalar_t x) {
+#if defined(DETRAY_FAST_MATH)
+    if constexpr (std::is_same_v<scalar_t, float>) {
+#if defined(DETRAY_FAST_MATH_DEVICE)
+        return __sinf(x);
+#else
+        return detail::approx::sin(x);
+#endif
+    }
+#endif
+    return math::sin(x);
+}
+
+template <typename scalar_t>
+DETRAY_HOST_DEVICE inline scalar_t cos(const scalar_t x) {
+#if defined(DETRAY_FAST_MATH)
+    if constexpr (std::is_same_v<scalar_t, float>) {
+#if defined(DETRAY_FAST_MATH_DEVICE)
+        return __cosf(x);
+#else
+        return detail::approx::cos(x);
+#endif
+    }
+#endif
+    return math::cos(x);
+}
+
+/// No device intrinsic: the polynomial is used on host and device
+template <typename scalar_t>
+DETRAY_HOST_DEVICE inline scalar_t atan2(const scalar_t y, const scalar_t x) {
+#if defined(DETRAY_FAST_MATH)
+    if constexpr (std::is_same_v<scalar_t, float>) {
+        return detail::approx::atan2(y, x);
+    }
+#endif
+    return math::atan2(y, x);
+}
+
+template <typename scalar_t>
+DETRAY_HOST_DEVICE inline scalar_t log(const scalar_t x) {
+#if defined(DETRAY_FAST_MATH)
+    if constexpr (std::is_same_v<scalar_t, float>) {
+#if defined(DETRAY_FAST_MATH_DEVICE)
+        return __logf(x);
+#else
+        return detail::approx::log(x);
+#endif
+    }
+#endif
+    return math::log(x);
+}
+
+/// @returns the azimuthal angle of the vector @param v
+template <typename vector_t>
+DETRAY_HOST_DEVICE inline auto phi(const vector_t &v) {
+    // Element access can return proxy types (e.g. Vc)
+    using scalar_t =
+        std::remove_cv_t<std::remove_reference_t<decltype(v[0] + v[1])>>;
+    return fast_math::atan2<scalar_t>(v[1], v[0]);
+}
+
+#undef DETRAY_FAST_MATH_DEVICE
+
+}  // namespace fast_math
+
+}  // namespace detray
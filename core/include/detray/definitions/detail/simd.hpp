@@ -0,0 +1,108 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/qualifiers.hpp"
+
+// System include(s)
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+namespace detray::detail::simd {
+
+/// Lane-wise operations on horizontally vectorized values.
+///
+/// The value type is either a plain scalar (one lane) or a SIMD vector type
+/// like @c Vc::Vector, which provides the arithmetic operators, lane access
+/// via @c operator[] and comparisons that yield a lane mask. The math
+/// functions of the SIMD library are picked up by argument dependent lookup.
+/// @{
+
+/// @returns the number of lanes of the value type @tparam value_t
+template <typename value_t>
+DETRAY_HOST_DEVICE constexpr std::size_t size() {
+    if constexpr (std::is_arithmetic_v<value_t>) {
+        return 1u;
+    } else {
+        return value_t::size();
+    }
+}
+
+/// @returns lane @param i of the value @param v
+template <typename value_t>
+DETRAY_HOST_DEVICE constexpr auto get(const value_t &v,
+                                      [[maybe_unused]] const std::size_t i) {
+    if constexpr (std::is_arithmetic_v<value_t>) {
+        return v;
+    } else {
+        return v[i];
+    }
+}
+
+/// Set lane @param i of the value @param v to @param s
+template <typename value_t, typename scalar_t>
+DETRAY_HOST_DEVICE constexpr void set(value_t &v,
+                                      [[maybe_unused]] const std::size_t i,
+                                      const scalar_t s) {
+    if constexpr (std::is_arithmetic_v<value_t>) {
+        v = s;
+    } else {
+        v[i] = s;
+    }
+}
+
+/// @returns @param a in the lanes where @param m is set, @param b otherwise
+template <typename mask_t, typename value_t>
+DETRAY_HOST_DEVICE constexpr value_t select(const mask_t &m, const value_t &a,
+                                            const value_t &b) {
+    if constexpr (std::is_same_v<mask_t, bool>) {
+        return m ? a : b;
+    } else {
+        return iif(m, a, b);
+    }
+}
+
+/// @returns whether lane @param i of the mask @param m is set
+template <typename mask_t>
+DETRAY_HOST_DEVICE constexpr bool is_set(const mask_t &m,
+                                         [[maybe_unused]] const std::size_t i) {
+    if constexpr (std::is_same_v<mask_t, bool>) {
+        return m;
+    } else {
+        return m[i];
+    }
+}
+
+/// @returns whether any lane of the mask @param m is set
+template <typename mask_t>
+DETRAY_HOST_DEVICE constexpr bool any(const mask_t &m) {
+    if constexpr (std::is_same_v<mask_t, bool>) {
+        return m;
+    } else {
+        return any_of(m);
+    }
+}
+
+/// @returns the lane-wise square root of @param v
+template <typename value_t>
+DETRAY_HOST_DEVICE inline value_t sqrt(const value_t &v) {
+    using std::sqrt;
+    return sqrt(v);
+}
+
+/// @returns the lane-wise absolute value of @param v
+template <typename value_t>
+DETRAY_HOST_DEVICE inline value_t abs(const value_t &v) {
+    using std::abs;
+    return abs(v);
+}
+/// @}
+
+}  // namespace detray::detail::simd
@@ -26,6 +26,8 @@ enum pdg_particle : std::int32_t {
     ePionZero = 111,
     ePionPlus = 211,
     ePionMinus = -ePionPlus,
+    eKaonPlus = 321,
+    eKaonMinus = -eKaonPlus,
     eNeutron = 2112,
     eAntiNeutron = -eNeutron,
     eProton = 2212,
@@ -0,0 +1,321 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/tracks/detail/transform_track_parameters.hpp"
+
+// System include(s)
+#include <cassert>
+#include <cstddef>
+
+namespace detray {
+
+namespace geometry {
+
+/// @brief Order of the elements of a batch, grouped by the mask type of their
+/// surfaces.
+///
+/// The elements that belong to the mask type with id @c i are found at
+/// @c order[offsets[i]] to @c order[offsets[i+1]-1] .
+///
+/// @tparam n_types the number of mask types in the detector
+template <std::size_t n_types>
+struct mask_grouping {
+    /// Indices of the batch elements, sorted by mask type
+    dvector<unsigned int> order{};
+    /// Where the elements of every mask type begin in @c order
+    darray<unsigned int, n_types + 1u> offsets{};
+
+    /// @returns the mask type id of the element at @param pos in @c order
+    DETRAY_HOST_DEVICE
+    static constexpr std::size_t group_of(
+        const darray<unsigned int, n_types + 1u> &offs,
+        const unsigned int pos) {
+        std::size_t i{0u};
+        while (i + 1u < n_types and offs[i + 1u] <= pos) {
+            ++i;
+        }
+        return i;
+    }
+};
+
+/// Group the elements of a batch by the mask type of their surfaces
+///
+/// Counting sort over the mask ids, which keeps the original order of the
+/// elements within a group.
+///
+/// @param surfaces the surface descriptor of every batch element
+template <typename detector_t, typename surface_range_t>
+DETRAY_HOST auto group_by_mask(const detector_t & /*det*/,
+                               const surface_range_t &surfaces) {
+
+    constexpr std::size_t n_types{
+        detector_t::mask_container::n_collections()};
+
+    mask_grouping<n_types> groups{};
+    groups.order.resize(surfaces.size());
+
+    // Count the elements per mask type
+    for (const auto &sf_desc : surfaces) {
+        const auto id{static_cast<std::size_t>(sf_desc.mask().id())};
+        assert(id < n_types);
+        ++groups.offsets[id + 1u];
+    }
+    for (std::size_t i = 0u; i < n_types; ++i) {
+        groups.offsets[i + 1u] += groups.offsets[i];
+    }
+
+    // Fill the element indices into their groups
+    darray<unsigned int, n_types + 1u> pos{groups.offsets};
+    for (unsigned int i = 0u; i < static_cast<unsigned int>(surfaces.size());
+         ++i) {
+        const auto id{static_cast<std::size_t>(surfaces[i].mask().id())};
+        groups.order[pos[id]++] = i;
+    }
+
+    return groups;
+}
+
+}  // namespace geometry
+
+namespace detail {
+
+/// @brief Visitor that applies an element-wise conversion to a group of batch
+/// elements that share the same mask type.
+///
+/// The mask store visitor dispatches once per group, after which the loop
+/// over the elements only deals with a single mask type.
+template <typename functor_t>
+struct batch_conversion {
+
+    template <typename mask_group_t, typename detector_t,
+              typename surface_range_t, typename... Args>
+    DETRAY_HOST_DEVICE inline void operator()(
+        const mask_group_t &mask_group, const detector_t &det,
+        const unsigned int *order, const unsigned int n,
+        const surface_range_t &surfaces,
+        const typename detector_t::geometry_context &ctx,
+        Args &... args) const {
+
+        const auto &transforms = det.transform_store();
+
+        for (unsigned int j = 0u; j < n; ++j) {
+            const unsigned int i{order[j]};
+            const auto &sf_desc = surfaces[i];
+
+            functor_t{}(mask_group[sf_desc.mask().index()],
+                        transforms.at(sf_desc.transform(), ctx), i, args...);
+        }
+    }
+};
+
+/// Element-wise conversions of a batch
+struct batch_kernels {
+
+    /// Global position to bound local position
+    struct global_to_bound {
+        template <typename mask_t, typename transform3_t,
+                  typename point_range_t, typename dir_range_t,
+                  typename result_range_t>
+        DETRAY_HOST_DEVICE inline void operator()(
+            const mask_t &mask, const transform3_t &trf3, const unsigned int i,
+            const point_range_t &globals, const dir_range_t &dirs,
+            result_range_t &results) const {
+
+            using point2_t = dpoint2D<typename mask_t::algebra_type>;
+
+            const auto local = mask.to_local_frame(trf3, globals[i], dirs[i]);
+            results[i] = point2_t{local[0], local[1]};
+        }
+    };
+
+    /// Global position to 3D local position
+    struct global_to_local {
+        template <typename mask_t, typename transform3_t,
+                  typename point_range_t, typename dir_range_t,
+                  typename result_range_t>
+        DETRAY_HOST_DEVICE inline void operator()(
+            const mask_t &mask, const transform3_t &trf3, const unsigned int i,
+            const point_range_t &globals, const dir_range_t &dirs,
+            result_range_t &results) const {
+
+            results[i] = mask.to_local_frame(trf3, globals[i], dirs[i]);
+        }
+    };
+
+    /// Free track vector to bound track vector
+    struct free_to_bound_vector {
+        template <typename mask_t, typename transform3_t,
+                  typename vector_range_t, typename result_range_t>
+        DETRAY_HOST_DEVICE inline void operator()(
+            const mask_t & /*mask*/, const transform3_t &trf3,
+            const unsigned int i, const vector_range_t &free_vecs,
+            result_range_t &results) const {
+
+            using frame_t = typename mask_t::local_frame_type;
+
+            results[i] =
+                detail::free_to_bound_vector<frame_t>(trf3, free_vecs[i]);
+        }
+    };
+
+    /// Bound track vector to free track vector
+    struct bound_to_free_vector {
+        template <typename mask_t, typename transform3_t,
+                  typename vector_range_t, typename result_range_t>
+        DETRAY_HOST_DEVICE inline void operator()(
+            const mask_t &mask, const transform3_t &trf3, const unsigned int i,
+            const vector_range_t &bound_vecs, result_range_t &results) const {
+
+            results[i] =
+                detail::bound_to_free_vector(trf3, mask, bound_vecs[i]);
+        }
+    };
+};
+
+/// Run the conversion @tparam functor_t on every group of the batch
+template <typename functor_t, typename detector_t, std::size_t n_types,
+          typename surface_range_t, typename... Args>
+DETRAY_HOST inline void convert_batch(
+    const detector_t &det, const geometry::mask_grouping<n_types> &groups,
+    const surface_range_t &surfaces,
+    const typename detector_t::geometry_context &ctx, Args &... args) {
+    using mask_id = typename detector_t::masks::id;
+
+    assert(groups.order.size() == surfaces.size());
+
+    for (std::size_t id = 0u; id < n_types; ++id) {
+        const unsigned int n{groups.offsets[id + 1u] - groups.offsets[id]};
+        if (n == 0u) {
+            continue;
+        }
+        det.mask_store().template visit<batch_conversion<functor_t>>(
+            static_cast<mask_id>(id), det,
+            groups.order.data() + groups.offsets[id], n, surfaces, ctx,
+            args...);
+    }
+}
+
+/// Run the conversion @tparam functor_t on the element at @param pos of the
+/// grouped batch order, e.g. for the device thread with that index.
+///
+/// Neighbouring positions belong to the same mask type, so that neighbouring
+/// threads take the same branch of the mask visitor.
+template <typename functor_t, typename detector_t, std::size_t n_offsets,
+          typename order_range_t, typename surface_range_t, typename... Args>
+DETRAY_HOST_DEVICE inline void convert_element(
+    const detector_t &det, const darray<unsigned int, n_offsets> &offsets,
+    const order_range_t &order, const unsigned int pos,
+    const surface_range_t &surfaces,
+    const typename detector_t::geometry_context &ctx, Args &... args) {
+    using mask_id = typename detector_t::masks::id;
+    constexpr std::size_t n_types{n_offsets - 1u};
+
+    if (pos >= offsets[n_types]) {
+        return;
+    }
+
+    const std::size_t id{
+        geometry::mask_grouping<n_types>::group_of(offsets, pos)};
+    const unsigned int i{order[pos]};
+
+    det.mask_store().template visit<batch_conversion<functor_t>>(
+        static_cast<mask_id>(id), det, &i, 1u, surfaces, ctx, args...);
+}
+
+}  // namespace detail
+
+namespace geometry {
+
+/// @brief Batched conversion of global positions to bound local positions
+///
+/// Equivalent to calling @c surface::global_to_bound for every element, but
+/// the mask type is resolved only once per group of elements that share it.
+///
+/// @param det the detector
+/// @param groups the batch elements grouped by mask type (@see group_by_mask)
+/// @param surfaces the surface descriptor of every element
+/// @param globals the global positions
+/// @param dirs the global directions (needed for line surfaces)
+/// @param results the bound local positions, at least one per element
+/// @param ctx the geometry context
+template <typename detector_t, std::size_t n_types, typename surface_range_t,
+          typename point_range_t, typename dir_range_t,
+          typename result_range_t>
+DETRAY_HOST inline void global_to_bound(
+    const detector_t &det, const mask_grouping<n_types> &groups,
+    const surface_range_t &surfaces, const point_range_t &globals,
+    const dir_range_t &dirs, result_range_t &results,
+    const typename detector_t::geometry_context &ctx = {}) {
+
+    detail::convert_batch<detail::batch_kernels::global_to_bound>(
+        det, groups, surfaces, ctx, globals, dirs, results);
+}
+
+/// @brief Batched conversion of global positions to 3D local positions
+///
+/// @see global_to_bound
+template <typename detector_t, std::size_t n_types, typename surface_range_t,
+          typename point_range_t, typename dir_range_t,
+          typename result_range_t>
+DETRAY_HOST inline void global_to_local(
+    const detector_t &det, const mask_grouping<n_types> &groups,
+    const surface_range_t &surfaces, const point_range_t &globals,
+    const dir_range_t &dirs, result_range_t &results,
+    const typename detector_t::geometry_context &ctx = {}) {
+
+    detail::convert_batch<detail::batch_kernels::global_to_local>(
+        det, groups, surfaces, ctx, globals, dirs, results);
+}
+
+/// @brief Batched conversion of free to bound track vectors
+///
+/// Equivalent to calling @c surface::free_to_bound_vector for every element
+///
+/// @param det the detector
+/// @param groups the batch elements grouped by mask type (@see group_by_mask)
+/// @param surfaces the surface descriptor of every element
+/// @param free_vecs the free track vectors
+/// @param results the bound track vectors, at least one per element
+/// @param ctx the geometry context
+template <typename detector_t, std::size_t n_types, typename surface_range_t,
+          typename vector_range_t, typename result_range_t>
+DETRAY_HOST inline void free_to_bound_vector(
+    const detector_t &det, const mask_grouping<n_types> &groups,
+    const surface_range_t &surfaces, const vector_range_t &free_vecs,
+    result_range_t &results,
+    const typename detector_t::geometry_context &ctx = {}) {
+
+    detail::convert_batch<detail::batch_kernels::free_to_bound_vector>(
+        det, groups, surfaces, ctx, free_vecs, results);
+}
+
+/// @brief Batched conversion of bound to free track vectors
+///
+/// Equivalent to calling @c surface::bound_to_free_vector for every element
+///
+/// @see free_to_bound_vector
+template <typename detector_t, std::size_t n_types, typename surface_range_t,
+          typename vector_range_t, typename result_range_t>
+DETRAY_HOST inline void bound_to_free_vector(
+    const detector_t &det, const mask_grouping<n_types> &groups,
+    const surface_range_t &surfaces, const vector_range_t &bound_vecs,
+    result_range_t &results,
+    const typename detector_t::geometry_context &ctx = {}) {
+
+    detail::convert_batch<detail::batch_kernels::bound_to_free_vector>(
+        det, groups, surfaces, ctx, bound_vecs, results);
+}
+
+}  // namespace geometry
+
+}  // namespace detray
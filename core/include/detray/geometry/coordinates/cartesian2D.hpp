@@ -29,8 +29,9 @@ struct cartesian2D {
 
     /// This method transforms a point from a global cartesian 3D frame to a
     /// local 3D cartesian point
+    template <typename transform3_t>
     DETRAY_HOST_DEVICE
-    static inline point3_type global_to_local_3D(const transform3_type &trf,
+    static inline point3_type global_to_local_3D(const transform3_t &trf,
                                                  const point3_type &p,
                                                  const vector3_type & /*dir*/) {
         return trf.point_to_local(p);
@@ -38,8 +39,9 @@ struct cartesian2D {
 
     /// This method transforms a point from a global cartesian 3D frame to a
     /// local 2D cartesian point
+    template <typename transform3_t>
     DETRAY_HOST_DEVICE
-    static inline loc_point global_to_local(const transform3_type &trf,
+    static inline loc_point global_to_local(const transform3_t &trf,
                                             const point3_type &p,
                                             const vector3_type & /*dir*/) {
         auto loc_p = trf.point_to_local(p);
@@ -48,31 +50,33 @@ struct cartesian2D {
 
     /// This method transforms from a local 3D cartesian point to a point in
     /// the global cartesian 3D frame
+    template <typename transform3_t>
     DETRAY_HOST_DEVICE static inline point3_type local_to_global(
-        const transform3_type &trf, const point3_type &p) {
+        const transform3_t &trf, const point3_type &p) {
         return trf.point_to_global(p);
     }
 
     /// This method transforms from a local 2D cartesian point to a point in
     /// the global cartesian 3D frame
-    template <typename mask_t>
+    template <typename mask_t, typename transform3_t>
     DETRAY_HOST_DEVICE static inline point3_type local_to_global(
-        const transform3_type &trf, const mask_t & /*mask*/, const loc_point &p,
+        const transform3_t &trf, const mask_t & /*mask*/, const loc_point &p,
         const vector3_type & /*dir*/) {
         return trf.point_to_global(point3_type{p[0], p[1], 0.f});
     }
 
     /// @returns the normal vector in global coordinates
-    template <typename mask_t>
+    template <typename mask_t, typename transform3_t>
     DETRAY_HOST_DEVICE static inline vector3_type normal(
-        const transform3_type &trf, const point2_type & = {},
+        const transform3_t &trf, const point2_type & = {},
         const mask_t & = {}) {
         return trf.z();
     }
 
     /// @returns the normal vector in global coordinates
+    template <typename transform3_t>
     DETRAY_HOST_DEVICE static inline vector3_type normal(
-        const transform3_type &trf, const point3_type & = {}) {
+        const transform3_t &trf, const point3_type & = {}) {
         return trf.z();
     }
 
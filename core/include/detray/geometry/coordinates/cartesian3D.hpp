@@ -29,8 +29,9 @@ struct cartesian3D {
 
     /// This method transforms a point from a global cartesian 3D frame to a
     /// local 3D cartesian point
+    template <typename transform3_t>
     DETRAY_HOST_DEVICE
-    static inline point3_type global_to_local_3D(const transform3_type &trf,
+    static inline point3_type global_to_local_3D(const transform3_t &trf,
                                                  const point3_type &p,
                                                  const vector3_type &dir) {
         return cartesian3D<algebra_t>::global_to_local(trf, p, dir);
@@ -38,8 +39,9 @@ struct cartesian3D {
 
     /// This method transforms a point from a global cartesian 3D frame to a
     /// local 3D cartesian point
+    template <typename transform3_t>
     DETRAY_HOST_DEVICE
-    static inline loc_point global_to_local(const transform3_type &trf,
+    static inline loc_point global_to_local(const transform3_t &trf,
                                             const point3_type &p,
                                             const vector3_type & /*dir*/) {
         return trf.point_to_local(p);
@@ -47,16 +49,17 @@ struct cartesian3D {
 
     /// This method transforms from a local 3D cartesian point to a point in
     /// the global cartesian 3D frame
+    template <typename transform3_t>
     DETRAY_HOST_DEVICE static inline point3_type local_to_global(
-        const transform3_type &trf, const point3_type &p) {
+        const transform3_t &trf, const point3_type &p) {
         return trf.point_to_global(p);
     }
 
     /// This method transforms from a local 3D cartesian point to a point in
     /// the global cartesian 3D frame
-    template <typename mask_t>
+    template <typename mask_t, typename transform3_t>
     DETRAY_HOST_DEVICE static inline point3_type local_to_global(
-        const transform3_type &trf, const mask_t & /*mask*/, const loc_point &p,
+        const transform3_t &trf, const mask_t & /*mask*/, const loc_point &p,
         const vector3_type & /*dir*/) {
         return cartesian3D<algebra_t>::local_to_global(trf, p);
     }
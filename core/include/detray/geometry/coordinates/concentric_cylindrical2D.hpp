@@ -9,6 +9,7 @@
 
 // Project include(s)
 #include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/fast_math.hpp"
 #include "detray/definitions/detail/math.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
 
@@ -31,36 +32,39 @@ struct concentric_cylindrical2D {
 
     /// This method transforms a point from a global cartesian 3D frame to a
     /// local 2D cylindrical point
+    template <typename transform3_t>
     DETRAY_HOST_DEVICE
-    static inline point3_type global_to_local_3D(const transform3_type &trf,
+    static inline point3_type global_to_local_3D(const transform3_t &trf,
                                                  const point3_type &p,
                                                  const vector3_type & /*dir*/) {
         const point3_type local3 = p - trf.translation();
         const scalar_type r{getter::perp(local3)};
 
-        return {r * getter::phi(local3), local3[2], r};
+        return {r * fast_math::phi(local3), local3[2], r};
     }
 
     /// This method transforms a point from a global cartesian 3D frame to a
     /// local 2D cylindrical point
+    template <typename transform3_t>
     DETRAY_HOST_DEVICE
-    static inline loc_point global_to_local(const transform3_type &trf,
+    static inline loc_point global_to_local(const transform3_t &trf,
                                             const point3_type &p,
                                             const vector3_type & /*dir*/) {
         const point3_type local3 = p - trf.translation();
 
-        return {getter::phi(local3), local3[2]};
+        return {fast_math::phi(local3), local3[2]};
     }
 
     /// This method transforms from a local 3D cylindrical point to a point in
     /// the global cartesian 3D frame
+    template <typename transform3_t>
     DETRAY_HOST_DEVICE static inline point3_type local_to_global(
-        const transform3_type &trf, const point3_type &p) {
+        const transform3_t &trf, const point3_type &p) {
 
         const scalar_type r{p[2]};
         const scalar_type phi{p[0] / r};
-        const scalar_type x{r * math::cos(phi)};
-        const scalar_type y{r * math::sin(phi)};
+        const scalar_type x{r * fast_math::cos(phi)};
+        const scalar_type y{r * fast_math::sin(phi)};
         const scalar_type z{p[1]};
 
         return point3_type{x, y, z} + trf.translation();
@@ -68,37 +72,38 @@ struct concentric_cylindrical2D {
 
     /// This method transforms from a local 2D cylindrical point to a point in
     /// the global cartesian 3D frame
-    template <typename mask_t>
+    template <typename mask_t, typename transform3_t>
     DETRAY_HOST_DEVICE static inline point3_type local_to_global(
-        const transform3_type &trf, const mask_t &mask, const loc_point &p,
+        const transform3_t &trf, const mask_t &mask, const loc_point &p,
         const vector3_type & /*dir*/) {
 
         const scalar_type r{mask[mask_t::shape::e_r]};
-        const scalar_type x{r * math::cos(p[0])};
-        const scalar_type y{r * math::sin(p[0])};
+        const scalar_type x{r * fast_math::cos(p[0])};
+        const scalar_type y{r * fast_math::sin(p[0])};
         const scalar_type z{p[1]};
 
         return point3_type{x, y, z} + trf.translation();
     }
 
     /// @returns the normal vector in global coordinates
-    template <typename mask_t>
+    template <typename mask_t, typename transform3_t>
     DETRAY_HOST_DEVICE static inline vector3_type normal(
-        const transform3_type &, const point2_type &p,
+        const transform3_t &, const point2_type &p,
         const mask_t & /*mask*/) {
 
         // normal vector in global coordinates (concentric cylinders have no
         // rotation)
-        return {math::cos(p[0]), math::sin(p[0]), 0.f};
+        return {fast_math::cos(p[0]), fast_math::sin(p[0]), 0.f};
     }
 
     /// @returns the normal vector given a local position @param p
+    template <typename transform3_t>
     DETRAY_HOST_DEVICE static inline vector3_type normal(
-        const transform3_type &, const point3_type &p) {
+        const transform3_t &, const point3_type &p) {
         const scalar_type phi{p[0] / p[2]};
         // normal vector in global coordinates (concentric cylinders have no
         // rotation)
-        return {math::cos(phi), math::sin(phi), 0.f};
+        return {fast_math::cos(phi), fast_math::sin(phi), 0.f};
     }
 
 };  // struct concentric_cylindrical2D
@@ -9,6 +9,7 @@
 
 // Project include(s)
 #include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/fast_math.hpp"
 #include "detray/definitions/detail/math.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
 
@@ -30,36 +31,39 @@ struct cylindrical2D {
 
     /// This method transforms a point from a global cartesian 3D frame to a
     /// local 3D cylindrical point
+    template <typename transform3_t>
     DETRAY_HOST_DEVICE
-    static inline point3_type global_to_local_3D(const transform3_type &trf,
+    static inline point3_type global_to_local_3D(const transform3_t &trf,
                                                  const point3_type &p,
                                                  const vector3_type & /*dir*/) {
         const auto local3 = trf.point_to_local(p);
         const scalar_type r{getter::perp(local3)};
 
-        return {r * getter::phi(local3), local3[2], r};
+        return {r * fast_math::phi(local3), local3[2], r};
     }
 
     /// This method transforms a point from a global cartesian 3D frame to a
     /// local 2D cylindrical point
+    template <typename transform3_t>
     DETRAY_HOST_DEVICE
-    static inline loc_point global_to_local(const transform3_type &trf,
+    static inline loc_point global_to_local(const transform3_t &trf,
                                             const point3_type &p,
                                             const vector3_type & /*dir*/) {
         const auto local3 = trf.point_to_local(p);
 
-        return {getter::perp(local3) * getter::phi(local3), local3[2]};
+        return {getter::perp(local3) * fast_math::phi(local3), local3[2]};
     }
 
     /// This method transform from a local 3D cylindrical point to a point in
     /// the global cartesian 3D frame
+    template <typename transform3_t>
     DETRAY_HOST_DEVICE static inline point3_type local_to_global(
-        const transform3_type &trf, const point3_type &p) {
+        const transform3_t &trf, const point3_type &p) {
 
         const scalar_type r{p[2]};
         const scalar_type phi{p[0] / r};
-        const scalar_type x{r * math::cos(phi)};
-        const scalar_type y{r * math::sin(phi)};
+        const scalar_type x{r * fast_math::cos(phi)};
+        const scalar_type y{r * fast_math::sin(phi)};
         const scalar_type z{p[1]};
 
         return trf.point_to_global(point3_type{x, y, z});
@@ -67,9 +71,9 @@ struct cylindrical2D {
 
     /// This method transform from a local 2D cylindrical point to a point in
     /// the global cartesian 3D frame
-    template <typename mask_t>
+    template <typename mask_t, typename transform3_t>
     DETRAY_HOST_DEVICE static inline point3_type local_to_global(
-        const transform3_type &trf, const mask_t &mask, const loc_point &p,
+        const transform3_t &trf, const mask_t &mask, const loc_point &p,
         const vector3_type & /*dir*/) {
 
         return cylindrical2D<algebra_t>::local_to_global(
@@ -77,11 +81,12 @@ struct cylindrical2D {
     }
 
     /// @returns the normal vector in global coordinates
-    template <typename mask_t>
+    template <typename mask_t, typename transform3_t>
     DETRAY_HOST_DEVICE static inline vector3_type normal(
-        const transform3_type &trf, const point2_type &p, const mask_t &mask) {
+        const transform3_t &trf, const point2_type &p, const mask_t &mask) {
         const scalar_type phi{p[0] / mask[mask_t::shape::e_r]};
-        const vector3_type local_normal{math::cos(phi), math::sin(phi), 0.f};
+        const vector3_type local_normal{fast_math::cos(phi),
+                                        fast_math::sin(phi), 0.f};
 
         // normal vector in global coordinate
         return trf.vector_to_global(local_normal);
@@ -89,10 +94,12 @@ struct cylindrical2D {
 
     /// @returns the normal vector in global coordinates given a local position
     /// @param p
+    template <typename transform3_t>
     DETRAY_HOST_DEVICE static inline vector3_type normal(
-        const transform3_type &trf, const point3_type &p) {
+        const transform3_t &trf, const point3_type &p) {
         const scalar_type phi{p[0] / p[2]};
-        const vector3_type local_normal{math::cos(phi), math::sin(phi), 0.f};
+        const vector3_type local_normal{fast_math::cos(phi),
+                                        fast_math::sin(phi), 0.f};
 
         // normal vector in global coordinate
         return trf.vector_to_global(local_normal);
@@ -9,6 +9,7 @@
 
 // Project include(s)
 #include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/fast_math.hpp"
 #include "detray/definitions/detail/math.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
 
@@ -30,8 +31,9 @@ struct cylindrical3D {
 
     /// This method transforms a point from a global cartesian 3D frame to a
     /// local 3D cylindrical point
+    template <typename transform3_t>
     DETRAY_HOST_DEVICE
-    static inline point3_type global_to_local_3D(const transform3_type &trf,
+    static inline point3_type global_to_local_3D(const transform3_t &trf,
                                                  const point3_type &p,
                                                  const vector3_type &dir) {
         return cylindrical3D<algebra_t>::global_to_local(trf, p, dir);
@@ -39,29 +41,31 @@ struct cylindrical3D {
 
     /// This method transforms a point from a global cartesian 3D frame to a
     /// local 3D cylindrical point
+    template <typename transform3_t>
     DETRAY_HOST_DEVICE
-    static inline loc_point global_to_local(const transform3_type &trf,
+    static inline loc_point global_to_local(const transform3_t &trf,
                                             const point3_type &p,
                                             const vector3_type & /*dir*/) {
         const auto local3 = trf.point_to_local(p);
-        return {getter::perp(local3), getter::phi(local3), local3[2]};
+        return {getter::perp(local3), fast_math::phi(local3), local3[2]};
     }
 
     /// This method transforms from a local 3D cylindrical point to a point in
     /// the global cartesian 3D frame
+    template <typename transform3_t>
     DETRAY_HOST_DEVICE static inline point3_type local_to_global(
-        const transform3_type &trf, const point3_type &p) {
-        const scalar_type x{p[0] * math::cos(p[1])};
-        const scalar_type y{p[0] * math::sin(p[1])};
+        const transform3_t &trf, const point3_type &p) {
+        const scalar_type x{p[0] * fast_math::cos(p[1])};
+        const scalar_type y{p[0] * fast_math::sin(p[1])};
 
         return trf.point_to_global(point3_type{x, y, p[2]});
     }
 
     /// This method transforms from a local 3D cylindrical point to a point in
     /// the global cartesian 3D frame
-    template <typename mask_t>
+    template <typename mask_t, typename transform3_t>
     DETRAY_HOST_DEVICE static inline point3_type local_to_global(
-        const transform3_type &trf, const mask_t & /*mask*/, const loc_point &p,
+        const transform3_t &trf, const mask_t & /*mask*/, const loc_point &p,
         const vector3_type & /*dir*/) {
         return cylindrical3D<algebra_t>::global_to_local(trf, p);
     }
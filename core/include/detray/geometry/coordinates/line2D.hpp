@@ -9,6 +9,7 @@
 
 // Project include(s)
 #include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/fast_math.hpp"
 #include "detray/definitions/detail/math.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
 
@@ -30,8 +31,9 @@ struct line2D {
 
     /// This method transforms a point from a global cartesian 3D frame to a
     /// local 3D line point
+    template <typename transform3_t>
     DETRAY_HOST_DEVICE
-    static inline point3_type global_to_local_3D(const transform3_type &trf,
+    static inline point3_type global_to_local_3D(const transform3_t &trf,
                                                  const point3_type &p,
                                                  const vector3_type &dir) {
 
@@ -51,13 +53,14 @@ struct line2D {
         // Left: 1
         const scalar_type sign = vector::dot(r, t - p) > 0.f ? -1.f : 1.f;
 
-        return {sign * getter::perp(local3), local3[2], getter::phi(local3)};
+        return {sign * getter::perp(local3), local3[2], fast_math::phi(local3)};
     }
 
     /// This method transforms a point from a global cartesian 3D frame to a
     /// local 3D line point
+    template <typename transform3_t>
     DETRAY_HOST_DEVICE
-    static inline loc_point global_to_local(const transform3_type &trf,
+    static inline loc_point global_to_local(const transform3_t &trf,
                                             const point3_type &p,
                                             const vector3_type &dir) {
 
@@ -69,20 +72,21 @@ struct line2D {
 
     /// This method transforms from a local 3D line point to a point in
     /// the global cartesian 3D frame
+    template <typename transform3_t>
     DETRAY_HOST_DEVICE static inline point3_type local_to_global(
-        const transform3_type &trf, const point3_type &p) {
+        const transform3_t &trf, const point3_type &p) {
         const scalar_type R = math::abs(p[0]);
-        const point3_type local = {R * math::cos(p[2]), R * math::sin(p[2]),
-                                   p[1]};
+        const point3_type local = {R * fast_math::cos(p[2]),
+                                   R * fast_math::sin(p[2]), p[1]};
 
         return trf.point_to_global(local);
     }
 
     /// This method transforms from a local 2D line point to a point in
     /// the global cartesian 3D frame
-    template <typename mask_t>
+    template <typename mask_t, typename transform3_t>
     DETRAY_HOST_DEVICE static inline point3_type local_to_global(
-        const transform3_type &trf, const mask_t & /*mask*/, const loc_point &p,
+        const transform3_t &trf, const mask_t & /*mask*/, const loc_point &p,
         const vector3_type &dir) {
 
         // Line direction
@@ -99,16 +103,17 @@ struct line2D {
     }
 
     /// @returns the normal vector in global coordinates
-    template <typename mask_t>
+    template <typename mask_t, typename transform3_t>
     DETRAY_HOST_DEVICE static inline vector3_type normal(
-        const transform3_type &trf, const point2_type & = {},
+        const transform3_t &trf, const point2_type & = {},
         const mask_t & = {}) {
         return trf.z();
     }
 
     /// @returns the normal vector in global coordinates
+    template <typename transform3_t>
     DETRAY_HOST_DEVICE static inline vector3_type normal(
-        const transform3_type &trf, const point3_type & = {}) {
+        const transform3_t &trf, const point3_type & = {}) {
         return trf.z();
     }
 };
@@ -9,6 +9,7 @@
 
 // Project include(s)
 #include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/fast_math.hpp"
 #include "detray/definitions/detail/math.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
 
@@ -30,55 +31,59 @@ struct polar2D {
 
     /// This method transforms a point from a global cartesian 3D frame to a
     /// local 3D polar point
+    template <typename transform3_t>
     DETRAY_HOST_DEVICE
-    static inline point3_type global_to_local_3D(const transform3_type &trf,
+    static inline point3_type global_to_local_3D(const transform3_t &trf,
                                                  const point3_type &p,
                                                  const vector3_type & /*dir*/) {
         const auto local3 = trf.point_to_local(p);
-        return {getter::perp(local3), getter::phi(local3), local3[2]};
+        return {getter::perp(local3), fast_math::phi(local3), local3[2]};
     }
 
     /// This method transforms a point from a global cartesian 3D frame to a
     /// local 2D polar point
+    template <typename transform3_t>
     DETRAY_HOST_DEVICE
-    static inline loc_point global_to_local(const transform3_type &trf,
+    static inline loc_point global_to_local(const transform3_t &trf,
                                             const point3_type &p,
                                             const vector3_type & /*d*/) {
         const auto local3 = trf.point_to_local(p);
-        return {getter::perp(local3), getter::phi(local3)};
+        return {getter::perp(local3), fast_math::phi(local3)};
     }
 
     /// This method transforms from a local 3D polar point to a point in
     /// the global cartesian 3D frame
+    template <typename transform3_t>
     DETRAY_HOST_DEVICE static inline point3_type local_to_global(
-        const transform3_type &trf, const point3_type &p) {
-        const scalar_type x = p[0] * math::cos(p[1]);
-        const scalar_type y = p[0] * math::sin(p[1]);
+        const transform3_t &trf, const point3_type &p) {
+        const scalar_type x = p[0] * fast_math::cos(p[1]);
+        const scalar_type y = p[0] * fast_math::sin(p[1]);
 
         return trf.point_to_global(point3_type{x, y, p[2]});
     }
 
     /// This method transforms from a local 2D polar point to a point in
     /// the global cartesian 3D frame
-    template <typename mask_t>
+    template <typename mask_t, typename transform3_t>
     DETRAY_HOST_DEVICE static inline point3_type local_to_global(
-        const transform3_type &trf, const mask_t & /*mask*/, const loc_point &p,
+        const transform3_t &trf, const mask_t & /*mask*/, const loc_point &p,
         const vector3_type & /*dir*/) {
 
         return polar2D<algebra_t>::local_to_global(trf, {p[0], p[1], 0.f});
     }
 
     /// @returns the normal vector in global coordinates
-    template <typename mask_t>
+    template <typename mask_t, typename transform3_t>
     DETRAY_HOST_DEVICE static inline vector3_type normal(
-        const transform3_type &trf, const point2_type & = {},
+        const transform3_t &trf, const point2_type & = {},
         const mask_t & = {}) {
         return trf.z();
     }
 
     /// @returns the normal vector in global coordinates
+    template <typename transform3_t>
     DETRAY_HOST_DEVICE static inline vector3_type normal(
-        const transform3_type &trf, const point3_type & = {}) {
+        const transform3_t &trf, const point3_type & = {}) {
         return trf.z();
     }
 };
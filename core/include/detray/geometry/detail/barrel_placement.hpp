@@ -0,0 +1,155 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+
+// System include(s)
+#include <cassert>
+
+namespace detray::detail {
+
+/// @brief Procedural placement of the modules of a regular barrel layer.
+///
+/// The modules are arranged in rings along z, with the same number of
+/// modules per ring. Module @c (phi_bin, z_bin) sits at the azimuth of the
+/// phi bin center, at the position of its ring in z and at the layer radius,
+/// which alternates by the radial stagger between neighboring rings. Its
+/// normal is tilted by a fixed angle w.r.t. the radial direction.
+///
+/// The transforms of the modules follow from these few parameters and are
+/// computed on the fly, instead of being loaded from the transform store. The
+/// modules are stored ring by ring, so that module @c (phi_bin, z_bin) has
+/// the transform index @c offset + z_bin * n_phi + phi_bin .
+template <typename algebra_t>
+class barrel_placement {
+
+    public:
+    using scalar_type = dscalar<algebra_t>;
+    using point3_type = dpoint3D<algebra_t>;
+    using vector3_type = dvector3D<algebra_t>;
+    using transform3_type = dtransform3D<algebra_t>;
+
+    /// Default constructor: Contains no modules
+    barrel_placement() = default;
+
+    /// Construct from the layer parameters
+    ///
+    /// @param trf_offset transform index of the first module
+    /// @param n_phi number of modules per ring
+    /// @param n_z number of rings
+    /// @param radius the layer radius
+    /// @param radial_stagger the radial distance between neighboring rings
+    /// @param tilt_phi tilt of the module normals around the z-axis
+    /// @param z_start position of the first ring in z
+    /// @param z_step distance between the rings
+    DETRAY_HOST_DEVICE
+    constexpr barrel_placement(const dindex trf_offset, const dindex n_phi,
+                               const dindex n_z, const scalar_type radius,
+                               const scalar_type radial_stagger,
+                               const scalar_type tilt_phi,
+                               const scalar_type z_start,
+                               const scalar_type z_step)
+        : m_trf_offset{trf_offset},
+          m_n_phi{n_phi},
+          m_n_z{n_z},
+          m_radius{radius},
+          m_radial_stagger{radial_stagger},
+          m_tilt_phi{tilt_phi},
+          m_z_start{z_start},
+          m_z_step{z_step} {}
+
+    /// @returns the number of modules in the layer
+    DETRAY_HOST_DEVICE
+    constexpr dindex n_modules() const { return m_n_phi * m_n_z; }
+
+    /// @returns the transform index of the first module
+    DETRAY_HOST_DEVICE
+    constexpr dindex transform_offset() const { return m_trf_offset; }
+
+    /// @returns true if the transform with index @param trf_idx belongs to a
+    /// module of the layer
+    DETRAY_HOST_DEVICE
+    constexpr bool contains(const dindex trf_idx) const {
+        return trf_idx >= m_trf_offset and
+               trf_idx < m_trf_offset + n_modules();
+    }
+
+    /// @returns the index of module @param phi_bin , @param z_bin in the
+    /// layer (e.g. from the bin of a surface grid with the same binning)
+    DETRAY_HOST_DEVICE
+    constexpr dindex module_index(const dindex phi_bin,
+                                  const dindex z_bin) const {
+        return z_bin * m_n_phi + phi_bin;
+    }
+
+    /// @returns the transform index of module @param phi_bin , @param z_bin
+    DETRAY_HOST_DEVICE
+    constexpr dindex transform_index(const dindex phi_bin,
+                                     const dindex z_bin) const {
+        return m_trf_offset + module_index(phi_bin, z_bin);
+    }
+
+    /// @returns the placement of module @param phi_bin , @param z_bin
+    DETRAY_HOST_DEVICE
+    transform3_type transform(const dindex phi_bin, const dindex z_bin) const {
+
+        const scalar_type phi_step{2.f * constant<scalar_type>::pi /
+                                   static_cast<scalar_type>(m_n_phi)};
+        const scalar_type phi{-constant<scalar_type>::pi +
+                              (static_cast<scalar_type>(phi_bin) + 0.5f) *
+                                  phi_step};
+        const scalar_type z{m_z_start +
+                            static_cast<scalar_type>(z_bin) * m_z_step};
+        const scalar_type r{(z_bin % 2u) != 0u
+                                ? m_radius - 0.5f * m_radial_stagger
+                                : m_radius + 0.5f * m_radial_stagger};
+
+        const scalar_type cos_phi{math::cos(phi)};
+        const scalar_type sin_phi{math::sin(phi)};
+        const scalar_type cos_tilt{math::cos(phi + m_tilt_phi)};
+        const scalar_type sin_tilt{math::sin(phi + m_tilt_phi)};
+
+        // Local z axis is the normal, local x axis lies in the x-y plane
+        const point3_type center{r * cos_phi, r * sin_phi, z};
+        const vector3_type local_z{cos_tilt, sin_tilt, 0.f};
+        const vector3_type local_x{-sin_tilt, cos_tilt, 0.f};
+
+        return transform3_type{center, local_z, local_x};
+    }
+
+    /// @returns the placement of the module with transform index
+    /// @param trf_idx
+    DETRAY_HOST_DEVICE
+    transform3_type transform(const dindex trf_idx) const {
+        assert(contains(trf_idx));
+
+        const dindex module{trf_idx - m_trf_offset};
+
+        return transform(module % m_n_phi, module / m_n_phi);
+    }
+
+    private:
+    /// Transform index of the first module
+    dindex m_trf_offset{0u};
+    /// Number of modules per ring and number of rings
+    dindex m_n_phi{0u};
+    dindex m_n_z{0u};
+    /// Layer parameters
+    scalar_type m_radius{0.f};
+    scalar_type m_radial_stagger{0.f};
+    scalar_type m_tilt_phi{0.f};
+    scalar_type m_z_start{0.f};
+    scalar_type m_z_step{0.f};
+};
+
+}  // namespace detray::detail
@@ -0,0 +1,38 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+
+// System include(s)
+#include <cstddef>
+#include <cstdint>
+
+namespace detray::detail {
+
+/// Result of a batched boundary check: Bit i is set if point i is inside
+using boundary_bitmask = std::uint64_t;
+
+/// @returns the bitmask of the boundary check results in @param is_inside
+template <std::size_t N>
+DETRAY_HOST_DEVICE constexpr boundary_bitmask pack_bitmask(
+    const darray<bool, N> &is_inside) {
+
+    static_assert(N <= 64u, "Batch does not fit into the bitmask");
+
+    boundary_bitmask bits{0u};
+    for (std::size_t i = 0u; i < N; ++i) {
+        bits |= static_cast<boundary_bitmask>(is_inside[i]) << i;
+    }
+
+    return bits;
+}
+
+}  // namespace detray::detail
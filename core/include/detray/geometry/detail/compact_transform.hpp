@@ -0,0 +1,174 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+
+// System include(s)
+#include <array>
+
+namespace detray {
+
+/// @brief Compact placement transform of a rigid body.
+///
+/// Stores only the rotation matrix and the translation (3x4 elements) in a
+/// configurable, usually lower, precision instead of the full homogeneous
+/// matrix and its inverse. Since the rotation is orthonormal, the inverse
+/// transformation is applied with the transposed rotation, so that no inverse
+/// needs to be stored.
+///
+/// The interface covers what the intersectors and local coordinate frames
+/// need. Everywhere else, the compact transform converts to the full algebra
+/// transform.
+///
+/// @tparam algebra_t the algebra in which the transformations are computed
+/// @tparam storage_scalar_t the precision of the stored elements
+template <typename algebra_t, typename storage_scalar_t = float>
+class compact_transform3D {
+
+    public:
+    using algebra_type = algebra_t;
+    using scalar_type = dscalar<algebra_t>;
+    using storage_scalar_type = storage_scalar_t;
+    using point3 = dpoint3D<algebra_t>;
+    using vector3 = dvector3D<algebra_t>;
+    using transform3_type = dtransform3D<algebra_t>;
+
+    /// Identity transform
+    constexpr compact_transform3D() = default;
+
+    /// Construct from the translation @param t and the (orthonormal) local
+    /// axes @param x , @param y and @param z in global coordinates
+    DETRAY_HOST_DEVICE
+    compact_transform3D(const point3 &t, const vector3 &x, const vector3 &y,
+                        const vector3 &z) {
+        for (unsigned int i = 0u; i < 3u; ++i) {
+            m_data[e_x + i] = static_cast<storage_scalar_t>(x[i]);
+            m_data[e_y + i] = static_cast<storage_scalar_t>(y[i]);
+            m_data[e_z + i] = static_cast<storage_scalar_t>(z[i]);
+            m_data[e_t + i] = static_cast<storage_scalar_t>(t[i]);
+        }
+    }
+
+    /// Compress the full algebra transform @param trf
+    DETRAY_HOST_DEVICE
+    compact_transform3D(const transform3_type &trf)
+        : compact_transform3D(trf.translation(), trf.x(), trf.y(), trf.z()) {}
+
+    /// @returns the full algebra transform (computes the inverse)
+    DETRAY_HOST_DEVICE
+    transform3_type full() const {
+        return transform3_type{translation(), z(), x(), true};
+    }
+
+    /// Implicit conversion to the full algebra transform
+    DETRAY_HOST_DEVICE
+    operator transform3_type() const { return full(); }
+
+    /// @returns the translation
+    DETRAY_HOST_DEVICE
+    point3 translation() const { return column<point3>(e_t); }
+
+    /// @returns the local x-axis in global coordinates
+    DETRAY_HOST_DEVICE
+    vector3 x() const { return column<vector3>(e_x); }
+
+    /// @returns the local y-axis in global coordinates
+    DETRAY_HOST_DEVICE
+    vector3 y() const { return column<vector3>(e_y); }
+
+    /// @returns the local z-axis in global coordinates
+    DETRAY_HOST_DEVICE
+    vector3 z() const { return column<vector3>(e_z); }
+
+    /// @returns the homogeneous matrix of the full transform
+    DETRAY_HOST_DEVICE
+    auto matrix() const { return full().matrix(); }
+
+    /// @returns the rotation matrix of the full transform
+    DETRAY_HOST_DEVICE
+    auto rotation() const { return full().rotation(); }
+
+    /// @returns the point @param p in global coordinates
+    DETRAY_HOST_DEVICE
+    point3 point_to_global(const point3 &p) const {
+        return rotate(p) + translation();
+    }
+
+    /// @returns the point @param p in local coordinates
+    DETRAY_HOST_DEVICE
+    point3 point_to_local(const point3 &p) const {
+        return rotate_inverse(p - translation());
+    }
+
+    /// @returns the vector @param v in global coordinates
+    DETRAY_HOST_DEVICE
+    vector3 vector_to_global(const vector3 &v) const { return rotate(v); }
+
+    /// @returns the vector @param v in local coordinates
+    DETRAY_HOST_DEVICE
+    vector3 vector_to_local(const vector3 &v) const {
+        return rotate_inverse(v);
+    }
+
+    /// Equality operator
+    DETRAY_HOST_DEVICE
+    constexpr bool operator==(const compact_transform3D &rhs) const {
+        for (unsigned int i = 0u; i < 12u; ++i) {
+            if (m_data[i] != rhs.m_data[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    private:
+    /// Offsets of the rotation columns and the translation in the data
+    enum offset : unsigned int { e_x = 0u, e_y = 3u, e_z = 6u, e_t = 9u };
+
+    /// @returns the column that starts at @param off as a vector/point
+    template <typename vector_t>
+    DETRAY_HOST_DEVICE vector_t column(const unsigned int off) const {
+        return vector_t{static_cast<scalar_type>(m_data[off]),
+                        static_cast<scalar_type>(m_data[off + 1u]),
+                        static_cast<scalar_type>(m_data[off + 2u])};
+    }
+
+    /// @returns R * v
+    template <typename vector_t>
+    DETRAY_HOST_DEVICE vector_t rotate(const vector_t &v) const {
+        vector_t res{0.f, 0.f, 0.f};
+        for (unsigned int i = 0u; i < 3u; ++i) {
+            res[i] = static_cast<scalar_type>(m_data[e_x + i]) * v[0] +
+                     static_cast<scalar_type>(m_data[e_y + i]) * v[1] +
+                     static_cast<scalar_type>(m_data[e_z + i]) * v[2];
+        }
+        return res;
+    }
+
+    /// @returns R^T * v (inverse rotation)
+    template <typename vector_t>
+    DETRAY_HOST_DEVICE vector_t rotate_inverse(const vector_t &v) const {
+        vector_t res{0.f, 0.f, 0.f};
+        for (unsigned int i = 0u; i < 3u; ++i) {
+            const unsigned int off{3u * i};
+            res[i] = static_cast<scalar_type>(m_data[off]) * v[0] +
+                     static_cast<scalar_type>(m_data[off + 1u]) * v[1] +
+                     static_cast<scalar_type>(m_data[off + 2u]) * v[2];
+        }
+        return res;
+    }
+
+    /// Rotation columns (local axes) followed by the translation
+    std::array<storage_scalar_t, 12> m_data{1.f, 0.f, 0.f, 0.f, 1.f, 0.f,
+                                            0.f, 0.f, 1.f, 0.f, 0.f, 0.f};
+};
+
+}  // namespace detray
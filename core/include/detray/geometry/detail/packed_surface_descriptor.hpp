@@ -0,0 +1,366 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/geometry.hpp"
+#include "detray/geometry/barcode.hpp"
+#include "detray/utils/bit_encoder.hpp"
+#include "detray/utils/type_traits.hpp"
+
+// System include(s)
+#include <cstdint>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+
+namespace detray {
+
+/// @brief Surface descriptor that fits into 16 bytes.
+///
+/// Holds the same information as the @c surface_descriptor, but the mask
+/// link, the material link and the transform index are bit-encoded into a
+/// single 64 bit word next to the barcode. Since the descriptor is copied
+/// into every intersection and into the bins of the surface grids, this
+/// shrinks those by the same amount. It can be used as a drop-in replacement
+/// by setting the @c surface_type of the detector metadata.
+///
+/// The links are limited to:
+/// - 15 mask types and 2^20 - 2 masks per type
+/// - 15 material types and 2^18 - 2 material entries per type
+/// - 2^18 - 2 transforms
+/// An encoded value with all bits set is read back as invalid link.
+///
+/// @note As the links are not stored as separate objects, the accessors
+/// return them by value. The mutable material access returns a proxy that
+/// writes back into the encoded word.
+///
+/// @tparam mask_link_t type of the typed link to the surface mask
+/// @tparam material_link_t type of the typed link to the surface material
+/// @tparam transform_link_t type of the index of the surface transform
+/// @tparam navigation_link_t type of the volume link of the masks
+template <typename mask_link_t = dtyped_index<dindex, dindex>,
+          typename material_link_t = dtyped_index<dindex, dindex>,
+          typename transform_link_t = dindex,
+          typename navigation_link_t = dindex>
+class packed_surface_descriptor {
+
+    static_assert(std::is_integral_v<typename mask_link_t::index_type>,
+                  "Packed surface descriptor needs a single mask index");
+    static_assert(std::is_integral_v<typename material_link_t::index_type>,
+                  "Packed surface descriptor needs a single material index");
+    static_assert(std::is_integral_v<transform_link_t>,
+                  "Packed surface descriptor needs a single transform index");
+
+    using value_t = std::uint_least64_t;
+    using encoder = detail::bit_encoder<value_t>;
+
+    public:
+    /// Link type of the mask to a volume.
+    using navigation_link = navigation_link_t;
+    // Broadcast the type of links
+    using transform_link = transform_link_t;
+    using mask_link = mask_link_t;
+    using mask_id = typename mask_link::id_type;
+    using material_link = material_link_t;
+    using material_id = typename material_link::id_type;
+
+    /// @brief Writes a material link back into the encoded descriptor
+    class material_link_ref {
+        public:
+        DETRAY_HOST_DEVICE
+        constexpr explicit material_link_ref(packed_surface_descriptor &desc)
+            : m_desc{desc} {}
+
+        /// @returns the decoded material link
+        DETRAY_HOST_DEVICE
+        constexpr operator material_link() const {
+            return std::as_const(m_desc).material();
+        }
+
+        /// Replace the material link
+        DETRAY_HOST_DEVICE
+        constexpr material_link_ref &operator=(const material_link &link) {
+            m_desc.set_material(link);
+            return *this;
+        }
+
+        /// Set the material type id
+        DETRAY_HOST_DEVICE
+        constexpr material_link_ref &set_id(const material_id id) {
+            m_desc.set_material(material_link{*this}.set_id(id));
+            return *this;
+        }
+
+        /// Set the material index
+        DETRAY_HOST_DEVICE
+        constexpr material_link_ref &set_index(
+            const typename material_link::index_type idx) {
+            m_desc.set_material(material_link{*this}.set_index(idx));
+            return *this;
+        }
+
+        /// @returns the material type id
+        DETRAY_HOST_DEVICE
+        constexpr auto id() const { return material_link{*this}.id(); }
+
+        /// @returns the material index
+        DETRAY_HOST_DEVICE
+        constexpr auto index() const { return material_link{*this}.index(); }
+
+        /// @returns whether the material link is invalid
+        DETRAY_HOST_DEVICE
+        constexpr bool is_invalid() const {
+            return material_link{*this}.is_invalid();
+        }
+
+        /// @returns whether the material type id is invalid
+        DETRAY_HOST_DEVICE
+        constexpr bool is_invalid_id() const {
+            return material_link{*this}.is_invalid_id();
+        }
+
+        /// @returns whether the material index is invalid
+        DETRAY_HOST_DEVICE
+        constexpr bool is_invalid_index() const {
+            return material_link{*this}.is_invalid_index();
+        }
+
+        private:
+        packed_surface_descriptor &m_desc;
+    };
+
+    /// Constructor with full arguments
+    ///
+    /// @param trf the transform for positioning and 3D local frame
+    /// @param mask the type and index of the mask for this surface
+    /// @param material the type and index of the material for this surface
+    /// @param vol the volume this surface belongs to
+    /// @param sf_id remember whether this is a portal or not
+    DETRAY_HOST
+    constexpr packed_surface_descriptor(const transform_link trf,
+                                        const mask_link &mask,
+                                        const material_link &material,
+                                        const dindex volume,
+                                        const surface_id sf_id) {
+        m_barcode = geometry::barcode{}.set_volume(volume).set_id(sf_id);
+        set_mask(mask);
+        set_material(material);
+        set_transform(trf);
+    }
+
+    constexpr packed_surface_descriptor() = default;
+
+    /// Equality operator
+    ///
+    /// @param rhs is the right hand side to be compared to
+    DETRAY_HOST_DEVICE
+    constexpr auto operator==(const packed_surface_descriptor &rhs) const
+        -> bool {
+        return (m_links == rhs.m_links and m_barcode == rhs.m_barcode);
+    }
+
+    /// Sets a new surface barcode
+    DETRAY_HOST_DEVICE
+    auto set_barcode(const geometry::barcode bcd) -> void { m_barcode = bcd; }
+
+    /// @returns the surface barcode
+    DETRAY_HOST_DEVICE
+    constexpr auto barcode() const -> geometry::barcode { return m_barcode; }
+
+    /// Sets a new surface id (portal/passive/sensitive)
+    DETRAY_HOST_DEVICE
+    auto set_id(const surface_id new_id) -> void { m_barcode.set_id(new_id); }
+
+    /// @returns the surface id (sensitive, passive or portal)
+    DETRAY_HOST_DEVICE
+    constexpr auto id() const -> surface_id { return m_barcode.id(); }
+
+    /// Sets a new volume link (index in volume collection of detector)
+    DETRAY_HOST
+    auto set_volume(const dindex new_idx) -> void {
+        m_barcode.set_volume(new_idx);
+    }
+
+    /// @returns the index of the volume the surface belongs to
+    DETRAY_HOST_DEVICE
+    constexpr auto volume() const -> dindex { return m_barcode.volume(); }
+
+    /// Sets a new surface index (index in surface collection of surface store)
+    DETRAY_HOST_DEVICE
+    auto set_index(const dindex new_idx) -> void {
+        m_barcode.set_index(new_idx);
+    }
+
+    /// @returns the index of the surface in the detector surface lookup
+    DETRAY_HOST_DEVICE
+    constexpr auto index() const -> dindex { return m_barcode.index(); }
+
+    /// Update the transform index
+    ///
+    /// @param offset update the position when move into new collection
+    DETRAY_HOST
+    auto update_transform(dindex offset) -> void {
+        set_transform(transform() + offset);
+    }
+
+    /// @return the transform index
+    DETRAY_HOST_DEVICE
+    constexpr auto transform() const -> transform_link {
+        if (encoder::template is_invalid<k_trf_mask>(m_links)) {
+            return detail::invalid_value<transform_link>();
+        }
+        return static_cast<transform_link>(
+            encoder::template get_bits<k_trf_mask>(m_links));
+    }
+
+    /// Update the mask link
+    ///
+    /// @param offset update the position when move into new collection
+    DETRAY_HOST
+    auto update_mask(dindex offset) -> void {
+        mask_link link{mask()};
+        link += offset;
+        set_mask(link);
+    }
+
+    /// @return the mask link
+    DETRAY_HOST_DEVICE
+    constexpr auto mask() const -> mask_link {
+        return decode<mask_link, k_mask_id_mask, k_mask_index_mask>();
+    }
+
+    /// Update the material link
+    ///
+    /// @param offset update the position when move into new collection
+    DETRAY_HOST
+    auto update_material(dindex offset) -> void {
+        material_link link{material()};
+        link += offset;
+        set_material(link);
+    }
+
+    /// Access to the material
+    DETRAY_HOST_DEVICE
+    constexpr auto material() -> material_link_ref {
+        return material_link_ref{*this};
+    }
+
+    /// @return the material link
+    DETRAY_HOST_DEVICE
+    constexpr auto material() const -> material_link {
+        return decode<material_link, k_mat_id_mask, k_mat_index_mask>();
+    }
+
+    /// @returns true if the surface is a senstive detector module.
+    DETRAY_HOST_DEVICE
+    constexpr auto is_sensitive() const -> bool {
+        return m_barcode.id() == surface_id::e_sensitive;
+    }
+
+    /// @returns true if the surface is a portal.
+    DETRAY_HOST_DEVICE
+    constexpr auto is_portal() const -> bool {
+        return m_barcode.id() == surface_id::e_portal;
+    }
+
+    /// @returns true if the surface is a passive detector element.
+    DETRAY_HOST_DEVICE
+    constexpr auto is_passive() const -> bool {
+        return m_barcode.id() == surface_id::e_passive;
+    }
+
+    /// @returns a string stream that prints the surface details
+    DETRAY_HOST
+    friend std::ostream &operator<<(std::ostream &os,
+                                    const packed_surface_descriptor &sf) {
+        os << sf.m_barcode;
+        os << " | trf.: " << sf.transform();
+        os << " | mask: " << sf.mask();
+        os << " | mat.: " << sf.material();
+        return os;
+    }
+
+    private:
+    // clang-format off
+    static constexpr value_t k_mask_id_mask    = 0xf000000000000000; // (2^4)-1 = 15 mask types
+    static constexpr value_t k_mask_index_mask = 0x0fffff0000000000; // (2^20)-1 = 1048575 masks per type
+    static constexpr value_t k_mat_id_mask     = 0x000000f000000000; // (2^4)-1 = 15 material types
+    static constexpr value_t k_mat_index_mask  = 0x0000000ffffc0000; // (2^18)-1 = 262143 materials per type
+    static constexpr value_t k_trf_mask        = 0x000000000003ffff; // (2^18)-1 = 262143 transforms
+    // clang-format on
+
+    /// Encode the mask link @param link
+    DETRAY_HOST_DEVICE
+    constexpr void set_mask(const mask_link &link) {
+        encode<k_mask_id_mask, k_mask_index_mask>(link);
+    }
+
+    /// Encode the material link @param link
+    DETRAY_HOST_DEVICE
+    constexpr void set_material(const material_link &link) {
+        encode<k_mat_id_mask, k_mat_index_mask>(link);
+    }
+
+    /// Encode the transform index @param trf
+    DETRAY_HOST_DEVICE
+    constexpr void set_transform(const transform_link trf) {
+        encoder::template set_bits<k_trf_mask>(
+            m_links, detail::is_invalid_value(trf)
+                         ? ~static_cast<value_t>(0)
+                         : static_cast<value_t>(trf));
+    }
+
+    /// Encode a typed link into the bits of @tparam id_mask and
+    /// @tparam index_mask
+    template <value_t id_mask, value_t index_mask, typename link_t>
+    DETRAY_HOST_DEVICE constexpr void encode(const link_t &link) {
+        encoder::template set_bits<id_mask>(
+            m_links, link.is_invalid_id() ? ~static_cast<value_t>(0)
+                                          : static_cast<value_t>(link.id()));
+        encoder::template set_bits<index_mask>(
+            m_links, link.is_invalid_index()
+                         ? ~static_cast<value_t>(0)
+                         : static_cast<value_t>(link.index()));
+    }
+
+    /// Decode a typed link from the bits of @tparam id_mask and
+    /// @tparam index_mask (fields with all bits set remain invalid)
+    template <typename link_t, value_t id_mask, value_t index_mask>
+    DETRAY_HOST_DEVICE constexpr link_t decode() const {
+        link_t link{};
+        if (!encoder::template is_invalid<id_mask>(m_links)) {
+            link.set_id(static_cast<typename link_t::id_type>(
+                encoder::template get_bits<id_mask>(m_links)));
+        }
+        if (!encoder::template is_invalid<index_mask>(m_links)) {
+            link.set_index(static_cast<typename link_t::index_type>(
+                encoder::template get_bits<index_mask>(m_links)));
+        }
+        return link;
+    }
+
+    geometry::barcode m_barcode{};
+    /// Encoded mask link, material link and transform index. Default: The
+    /// links are invalid and the transform index is zero
+    value_t m_links{~k_trf_mask};
+};
+
+namespace detail {
+
+template <typename mask_link_t, typename material_link_t,
+          typename transform_link_t, typename navigation_link_t>
+struct is_surface_descriptor<
+    packed_surface_descriptor<mask_link_t, material_link_t, transform_link_t,
+                              navigation_link_t>> : public std::true_type {};
+
+}  // namespace detail
+
+}  // namespace detray
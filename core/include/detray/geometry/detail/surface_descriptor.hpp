@@ -12,9 +12,11 @@
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/definitions/geometry.hpp"
 #include "detray/geometry/barcode.hpp"
+#include "detray/utils/type_traits.hpp"
 
 // Sysytem include(s)
 #include <memory>
+#include <type_traits>
 
 namespace detray {
 
@@ -201,4 +203,14 @@ class surface_descriptor {
     transform_link_t _trf{};
 };
 
+namespace detail {
+
+template <typename mask_link_t, typename material_link_t,
+          typename transform_link_t, typename navigation_link_t>
+struct is_surface_descriptor<
+    surface_descriptor<mask_link_t, material_link_t, transform_link_t,
+                       navigation_link_t>> : public std::true_type {};
+
+}  // namespace detail
+
 }  // namespace detray
@@ -11,6 +11,7 @@
 #include "detray/definitions/detail/indexing.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/materials/detail/material_accessor.hpp"
+#include "detray/navigation/intersection/intersection.hpp"
 #include "detray/propagator/detail/jacobian_engine.hpp"
 #include "detray/tracks/detail/transform_track_parameters.hpp"
 #include "detray/tracks/tracks.hpp"
@@ -88,6 +89,37 @@ struct surface_kernels {
         }
     };
 
+    /// A functor to prefetch the material at a given local/bound position
+    struct prefetch_material {
+        template <typename mat_group_t, typename index_t>
+        DETRAY_HOST_DEVICE inline void operator()(
+            [[maybe_unused]] const mat_group_t& mat_group,
+            [[maybe_unused]] const index_t& idx,
+            [[maybe_unused]] const point2_type& loc_p) const {
+
+            // Only surface material maps have bins that can be prefetched
+            if constexpr (detail::is_material_map_v<
+                              typename mat_group_t::value_type>) {
+                detail::material_accessor::prefetch(mat_group, idx, loc_p);
+            }
+        }
+    };
+
+    /// A functor to prefetch the mask of the surface
+    struct prefetch_mask {
+        template <typename mask_group_t, typename index_t>
+        DETRAY_HOST_DEVICE inline void operator()(
+            [[maybe_unused]] const mask_group_t& mask_group,
+            [[maybe_unused]] const index_t& index) const {
+
+#if (defined(__GNUC__) || defined(__clang__)) &&                  \
+    !(defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__) || \
+      defined(__SYCL_DEVICE_ONLY__))
+            __builtin_prefetch(&(mask_group[index]));
+#endif
+        }
+    };
+
     /// A functor get the surface normal at a given local/bound position
     struct normal {
         template <typename mask_group_t, typename index_t>
@@ -146,6 +178,30 @@ struct surface_kernels {
         }
     };
 
+    /// A functor to check whether a global point lies on the surface
+    struct is_on_surface {
+        template <typename mask_group_t, typename index_t, typename scalar_t>
+        DETRAY_HOST_DEVICE inline bool operator()(
+            const mask_group_t& mask_group, const index_t& index,
+            const transform3_type& trf3, const point3_type& global,
+            const vector3_type& dir, const scalar_t tol) const {
+
+            const auto& m = mask_group[index];
+
+            const point3_type local = m.to_local_frame(trf3, global, dir);
+
+            // Distance to the point on the surface with the same bound
+            // coordinates
+            const point3_type on_surface = m.local_frame().local_to_global(
+                trf3, m, point2_type{local[0], local[1]}, dir);
+            if (getter::norm(global - on_surface) > tol) {
+                return false;
+            }
+
+            return m.is_inside(local, tol) == intersection::status::e_inside;
+        }
+    };
+
     /// A functor to perform local to global transformation
     struct local_to_global {
 
@@ -135,6 +135,16 @@ class volume_descriptor {
         return idx_range_t{min, max};
     }
 
+    /// @returns whether the volume contains only portals (gap volume), i.e.
+    /// it has no sensitive or passive surfaces
+    DETRAY_HOST_DEVICE constexpr auto is_portal_only() const -> bool {
+        const auto& sen_range = sf_link<surface_id::e_sensitive>();
+        const auto& psv_range = sf_link<surface_id::e_passive>();
+
+        return (detail::get<0>(sen_range) == detail::get<1>(sen_range) &&
+                detail::get<0>(psv_range) == detail::get<1>(psv_range));
+    }
+
     /// @returns a surface index with respect to the volume surface range
     DETRAY_HOST_DEVICE constexpr dindex to_local_sf_index(dindex sf_idx) const {
 
@@ -8,10 +8,18 @@
 #pragma once
 
 // Project include(s)
+#include "detray/definitions/detail/containers.hpp"
 #include "detray/definitions/detail/indexing.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/materials/detail/material_accessor.hpp"
 #include "detray/materials/material.hpp"
+#include "detray/utils/ranges/for_each.hpp"
+
+// System include(s)
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
 
 namespace detray::detail {
 
@@ -38,20 +46,37 @@ struct get_material_params {
     }
 };
 
+/// @returns the surface descriptor that belongs to an entry @param sf of an
+/// acceleration data structure: Descriptors are passed through, while
+/// compressed entries (surface indices) are looked up in the detector
+/// @param det
+template <typename detector_t, typename entry_t>
+DETRAY_HOST_DEVICE constexpr decltype(auto) to_surface_descriptor(
+    const detector_t &det, const entry_t &sf) {
+    if constexpr (std::is_same_v<entry_t, typename detector_t::surface_type>) {
+        return (sf);
+    } else {
+        return det.surface(sf.index());
+    }
+}
+
 /// A functor to access the surfaces of a volume
 template <typename functor_t>
 struct surface_getter {
 
     /// Call operator that forwards the neighborhood search call in a volume
     /// to a surface finder data structure
-    template <typename accel_group_t, typename accel_index_t, typename... Args>
+    template <typename accel_group_t, typename accel_index_t,
+              typename detector_t, typename... Args>
     DETRAY_HOST_DEVICE inline void operator()(const accel_group_t &group,
                                               const accel_index_t index,
+                                              const detector_t &det,
                                               Args &&... args) const {
 
         // Run over the surfaces in a single acceleration data structure
         for (const auto &sf : group[index].all()) {
-            functor_t{}(sf, std::forward<Args>(args)...);
+            functor_t{}(to_surface_descriptor(det, sf),
+                        std::forward<Args>(args)...);
         }
     }
 };
@@ -73,9 +98,70 @@ struct neighborhood_getter {
         decltype(auto) accel = group[index];
 
         // Run over the surfaces in a single acceleration data structure
-        for (const auto &sf : accel.search(det, volume, track, cfg)) {
-            functor_t{}(sf, std::forward<Args>(args)...);
-        }
+        detray::ranges::for_each(
+            accel.search(det, volume, track, cfg), [&](const auto &entry) {
+                functor_t{}(to_surface_descriptor(det, entry),
+                            std::forward<Args>(args)...);
+            });
+    }
+};
+
+/// A functor to find surfaces in the neighborhood of a track position, which
+/// visits every surface only once, even if it is contained in several bins of
+/// the search window
+///
+/// @tparam n_words size of the bitmap that marks the visited surfaces (in
+///                 64 bit words). Surfaces whose index in the volume exceeds
+///                 the bitmap capacity are visited every time they are found.
+template <typename functor_t, std::size_t n_words = 32u>
+struct unique_neighborhood_getter {
+
+    /// Call operator that forwards the neighborhood search call in a volume
+    /// to a surface finder data structure
+    template <typename accel_group_t, typename accel_index_t,
+              typename detector_t, typename track_t, typename config_t,
+              typename... Args>
+    DETRAY_HOST_DEVICE inline void operator()(
+        const accel_group_t &group, const accel_index_t index,
+        const detector_t &det, const typename detector_t::volume_type &volume,
+        const track_t &track, const config_t &cfg, Args &&... args) const {
+
+        constexpr dindex n_bits{64u * static_cast<dindex>(n_words)};
+
+        decltype(auto) accel = group[index];
+
+        // Mark the visited surfaces by their index in the volume
+        const dindex first_sf{detail::get<0>(volume.full_sf_range())};
+        darray<std::uint64_t, n_words> visited{};
+
+        // Run over the surfaces in a single acceleration data structure
+        detray::ranges::for_each(
+            accel.search(det, volume, track, cfg), [&](const auto &entry) {
+                const dindex i{entry.index() - first_sf};
+                if (i < n_bits) {
+                    const std::uint64_t bit{std::uint64_t{1u} << (i % 64u)};
+                    std::uint64_t &word = visited[i / 64u];
+                    if (word & bit) {
+                        return;
+                    }
+                    word |= bit;
+                }
+                functor_t{}(to_surface_descriptor(det, entry),
+                            std::forward<Args>(args)...);
+            });
+    }
+};
+
+/// A functor to get the maximum number of candidates of an acceleration data
+/// structure, optionally for a given search window
+struct n_candidates_getter {
+
+    template <typename accel_group_t, typename accel_index_t,
+              typename... Args>
+    DETRAY_HOST_DEVICE inline unsigned int operator()(
+        const accel_group_t &group, const accel_index_t index,
+        Args &&... args) const {
+        return group[index].n_max_candidates(std::forward<Args>(args)...);
     }
 };
 
@@ -18,6 +18,7 @@
 
 // System include(s)
 #include <algorithm>
+#include <array>
 #include <iostream>
 #include <sstream>
 
@@ -82,6 +83,12 @@ class detector_volume {
     DETRAY_HOST_DEVICE
     constexpr auto index() const -> dindex { return m_desc.index(); }
 
+    /// @returns whether the volume contains only portals (gap volume)
+    DETRAY_HOST_DEVICE
+    constexpr auto is_portal_only() const -> bool {
+        return m_desc.is_portal_only();
+    }
+
     /// @returns the (non contextual) transform for the placement of the
     /// volume in the detector geometry.
     DETRAY_HOST_DEVICE
@@ -139,7 +146,7 @@ class detector_volume {
               typename... Args>
     DETRAY_HOST_DEVICE constexpr void visit_surfaces(Args &&... args) const {
         visit_surfaces_impl<detail::surface_getter<functor_t>>(
-            std::forward<Args>(args)...);
+            m_detector, std::forward<Args>(args)...);
     }
 
     /// Apply a functor to a neighborhood of surfaces around a track position
@@ -158,6 +165,23 @@ class detector_volume {
             m_detector, m_desc, track, cfg, std::forward<Args>(args)...);
     }
 
+    /// Apply a functor to a neighborhood of surfaces around a track position
+    /// in the volume, but visit every surface only once, even if the search
+    /// finds it in multiple bins.
+    ///
+    /// @tparam functor_t the prescription to be applied to the surfaces (
+    ///                   customization point for the navigation)
+    /// @tparam track_t   the track around which to build up the neighborhood
+    /// @tparam Args      types of additional arguments to the functor
+    template <typename functor_t,
+              int I = static_cast<int>(descr_t::object_id::e_size) - 1,
+              typename track_t, typename config_t, typename... Args>
+    DETRAY_HOST_DEVICE constexpr void visit_unique_neighborhood(
+        const track_t &track, const config_t &cfg, Args &&... args) const {
+        visit_surfaces_impl<detail::unique_neighborhood_getter<functor_t>>(
+            m_detector, m_desc, track, cfg, std::forward<Args>(args)...);
+    }
+
     /// Call a functor on the volume material with additional arguments.
     ///
     /// @tparam functor_t the prescription to be applied to the material
@@ -176,19 +200,16 @@ class detector_volume {
     template <int I = static_cast<int>(descr_t::object_id::e_size) - 1>
     DETRAY_HOST_DEVICE constexpr auto n_max_candidates(
         unsigned int n = 0u) const -> unsigned int {
-        // Get the index of the surface collection with type index 'I'
-        constexpr auto sf_col_id{
-            static_cast<typename detector_t::accel::id>(I)};
         const auto &link{m_desc.template accel_link<
             static_cast<typename descr_t::object_id>(I)>()};
 
         // Check if this volume holds such a collection and, if so, add max
-        // number of candidates that we can expect from it
+        // number of candidates that we can expect from it (the type of the
+        // collection is given by the link, not by the geometry object slot)
         if (not link.is_invalid()) {
             const unsigned int n_max{
                 m_detector.accelerator_store()
-                    .template get<sf_col_id>()[detail::get<1>(link)]
-                    .n_max_candidates()};
+                    .template visit<detail::n_candidates_getter>(link)};
             // @todo: Remove when local navigation becomes available !!!!
             n += n_max > 20u ? 20u : n_max;
         }
@@ -200,6 +221,29 @@ class detector_volume {
         }
     }
 
+    /// @returns an upper bound on the number of surface candidates during a
+    /// neighborhood lookup with the search window @param win_size, summed
+    /// over all acceleration structures of the volume (including portals)
+    template <int I = static_cast<int>(descr_t::object_id::e_size) - 1,
+              typename neighbor_t>
+    DETRAY_HOST_DEVICE constexpr auto n_max_candidates(
+        const std::array<neighbor_t, 2> &win_size, unsigned int n = 0u) const
+        -> unsigned int {
+        const auto &link{m_desc.template accel_link<
+            static_cast<typename descr_t::object_id>(I)>()};
+
+        if (not link.is_invalid()) {
+            n += m_detector.accelerator_store()
+                     .template visit<detail::n_candidates_getter>(link,
+                                                                  win_size);
+        }
+        if constexpr (I > 0) {
+            return n_max_candidates<I - 1>(win_size, n);
+        } else {
+            return n;
+        }
+    }
+
     /// Do a consistency check on the volume after building the detector.
     ///
     /// @param os output stream for error messages.
@@ -10,6 +10,7 @@
 // Project include(s)
 #include "detray/definitions/detail/indexing.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/geometry/detail/boundary_bitmask.hpp"
 #include "detray/geometry/shapes/cuboid3D.hpp"
 #include "detray/navigation/intersection/intersection.hpp"
 
@@ -18,10 +19,47 @@
 #include <cassert>
 #include <ostream>
 #include <sstream>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace detray {
 
+namespace detail {
+
+/// Checks whether the shape @tparam shape_t provides a batched boundary check
+/// for @tparam N points
+/// @{
+template <typename shape_t, typename bounds_t, typename scalar_t,
+          std::size_t N, typename = void>
+struct has_batched_boundary_check : public std::false_type {};
+
+template <typename shape_t, typename bounds_t, typename scalar_t,
+          std::size_t N>
+struct has_batched_boundary_check<
+    shape_t, bounds_t, scalar_t, N,
+    std::void_t<decltype(std::declval<const shape_t &>().check_boundaries(
+        std::declval<const bounds_t &>(),
+        std::declval<const darray<scalar_t, N> &>(),
+        std::declval<const darray<scalar_t, N> &>(), scalar_t{}))>>
+    : public std::true_type {};
+/// @}
+
+/// Checks whether the shape @tparam shape_t accepts every local point
+/// @{
+template <typename shape_t, typename = void>
+struct is_unbounded_shape : public std::false_type {};
+
+template <typename shape_t>
+struct is_unbounded_shape<shape_t, std::enable_if_t<shape_t::is_unbounded>>
+    : public std::true_type {};
+
+template <typename shape_t>
+inline constexpr bool is_unbounded_shape_v = is_unbounded_shape<shape_t>::value;
+/// @}
+
+}  // namespace detail
+
 /// @brief Mask a region on a surface and link it to a volume.
 ///
 /// The class uses a lightweight 'shape' that defines the local geometry of a
@@ -53,6 +91,9 @@ class mask {
     using point3_type = dpoint3D<algebra_t>;
     using vector3_type = dvector3D<algebra_t>;
 
+    /// Every local point is inside the mask (no boundary check needed)
+    static constexpr bool is_unbounded{detail::is_unbounded_shape_v<shape_t>};
+
     /// Default constructor
     constexpr mask() = default;
 
@@ -156,9 +197,53 @@ class mask {
         const scalar_type t = std::numeric_limits<scalar_type>::epsilon()) const
         -> intersection::status {
 
-        return _shape.check_boundaries(_values, loc_p, t)
-                   ? intersection::status::e_inside
-                   : intersection::status::e_outside;
+        if constexpr (is_unbounded) {
+            return intersection::status::e_inside;
+        } else {
+            return _shape.check_boundaries(_values, loc_p, t)
+                       ? intersection::status::e_inside
+                       : intersection::status::e_outside;
+        }
+    }
+
+    /// @brief Mask this shape onto a surface for a batch of points.
+    ///
+    /// The points are given in structure-of-arrays layout of their first two
+    /// local coordinates. Shapes that provide a batched boundary check (e.g.
+    /// @c trapezoid2D, @c annulus2D and @c ring2D) evaluate all points in a
+    /// single loop, otherwise every point is checked on its own.
+    ///
+    /// @param loc0 the first local coordinates of the points
+    /// @param loc1 the second local coordinates of the points
+    /// @param tol dynamic tolerance determined by caller
+    ///
+    /// @return a bitmask with bit i set if point i is inside the mask
+    template <std::size_t N>
+    DETRAY_HOST_DEVICE inline auto is_inside(
+        const darray<scalar_type, N>& loc0, const darray<scalar_type, N>& loc1,
+        const scalar_type t = std::numeric_limits<scalar_type>::epsilon()) const
+        -> detail::boundary_bitmask {
+
+        static_assert(shape::dim == 2u,
+                      "Batched mask check is only defined for 2D shapes");
+
+        if constexpr (is_unbounded) {
+            static_assert(N > 0u && N <= 64u,
+                          "Batch does not fit into the bitmask");
+            // All points are inside
+            constexpr auto all{~detail::boundary_bitmask{0u}};
+            return all >> (64u - N);
+        } else if constexpr (detail::has_batched_boundary_check<
+                                 shape, mask_values, scalar_type, N>::value) {
+            return _shape.check_boundaries(_values, loc0, loc1, t);
+        } else {
+            darray<bool, N> inside;
+            for (std::size_t i = 0u; i < N; ++i) {
+                inside[i] = _shape.check_boundaries(
+                    _values, point3_type{loc0[i], loc1[i], 0.f}, t);
+            }
+            return detail::pack_bitmask(inside);
+        }
     }
 
     /// @returns return local frame object (used in geometrical checks)
@@ -14,9 +14,11 @@
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/definitions/units.hpp"
 #include "detray/geometry/coordinates/polar2D.hpp"
+#include "detray/geometry/detail/boundary_bitmask.hpp"
 #include "detray/geometry/detail/vertexing.hpp"
 
 // System include(s)
+#include <cstddef>
 #include <limits>
 #include <ostream>
 #include <string>
@@ -125,6 +127,55 @@ class annulus2D {
                 (r_mod2 <= maxR_tol * maxR_tol));
     }
 
+    /// @brief Check boundary values for a batch of local points.
+    ///
+    /// @param bounds the boundary values for this shape
+    /// @param loc0 the radii of the points in the focal system
+    /// @param loc1 the polar angles of the points in the focal system
+    /// @param tol dynamic tolerance determined by caller
+    ///
+    /// @return a bitmask with bit i set if point i lies within the boundaries.
+    template <template <typename, std::size_t> class bounds_t,
+              typename scalar_t, std::size_t kDIM, std::size_t N,
+              typename std::enable_if_t<kDIM == e_size, bool> = true>
+    DETRAY_HOST_DEVICE inline detail::boundary_bitmask check_boundaries(
+        const bounds_t<scalar_t, kDIM> &bounds, const darray<scalar_t, N> &loc0,
+        const darray<scalar_t, N> &loc1,
+        const scalar_t tol = std::numeric_limits<scalar_t>::epsilon()) const {
+
+        // The shift of the beam system in polar coordinates is the same for
+        // all points
+        const scalar_t shift_x{-bounds[e_shift_x]};
+        const scalar_t shift_y{-bounds[e_shift_y]};
+        const scalar_t shift_r{
+            math::sqrt(shift_x * shift_x + shift_y * shift_y)};
+        const scalar_t shift_phi{math::atan2(shift_y, shift_x)};
+
+        const scalar_t min_phi{bounds[e_min_phi_rel] - tol};
+        const scalar_t max_phi{bounds[e_max_phi_rel] + tol};
+
+        const scalar_t minR_tol{bounds[e_min_r] - tol};
+        const scalar_t maxR_tol{bounds[e_max_r] + tol};
+
+        assert(minR_tol >= 0.f);
+
+        // Evaluate both conditions for all points without branching
+        darray<bool, N> is_inside;
+        for (std::size_t i = 0u; i < N; ++i) {
+            const scalar_t phi_strp{loc1[i] - bounds[e_average_phi]};
+
+            const scalar_t r_mod2{shift_r * shift_r + loc0[i] * loc0[i] +
+                                  2.f * shift_r * loc0[i] *
+                                      math::cos(phi_strp - shift_phi)};
+
+            is_inside[i] = (phi_strp >= min_phi) & (phi_strp <= max_phi) &
+                           (r_mod2 >= minR_tol * minR_tol) &
+                           (r_mod2 <= maxR_tol * maxR_tol);
+        }
+
+        return detail::pack_bitmask(is_inside);
+    }
+
     /// @brief Measure of the shape: Area
     ///
     /// @note (not yet implemented!)
@@ -13,8 +13,10 @@
 #include "detray/definitions/detail/math.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/geometry/coordinates/cartesian2D.hpp"
+#include "detray/geometry/detail/boundary_bitmask.hpp"
 
 // System include(s)
+#include <cstddef>
 #include <limits>
 #include <ostream>
 #include <string>
@@ -73,6 +75,39 @@ class trapezoid2D {
                 math::abs(loc_p[1]) <= bounds[e_half_length_2] + tol);
     }
 
+    /// @brief Check boundary values for a batch of local points.
+    ///
+    /// @param bounds the boundary values for this shape
+    /// @param loc0 the first local coordinates of the points
+    /// @param loc1 the second local coordinates of the points
+    /// @param tol dynamic tolerance determined by caller
+    ///
+    /// @return a bitmask with bit i set if point i lies within the boundaries.
+    template <template <typename, std::size_t> class bounds_t,
+              typename scalar_t, std::size_t kDIM, std::size_t N,
+              typename std::enable_if_t<kDIM == e_size, bool> = true>
+    DETRAY_HOST_DEVICE inline detail::boundary_bitmask check_boundaries(
+        const bounds_t<scalar_t, kDIM> &bounds, const darray<scalar_t, N> &loc0,
+        const darray<scalar_t, N> &loc1,
+        const scalar_t tol = std::numeric_limits<scalar_t>::epsilon()) const {
+
+        const scalar_t max_x0{bounds[e_half_length_0] + tol};
+        const scalar_t slope{(bounds[e_half_length_1] -
+                              bounds[e_half_length_0]) *
+                             bounds[e_divisor]};
+        const scalar_t max_y{bounds[e_half_length_2] + tol};
+
+        darray<bool, N> is_inside;
+        for (std::size_t i = 0u; i < N; ++i) {
+            const scalar_t max_x{max_x0 +
+                                 (bounds[e_half_length_2] + loc1[i]) * slope};
+            is_inside[i] =
+                (math::abs(loc0[i]) <= max_x) & (math::abs(loc1[i]) <= max_y);
+        }
+
+        return detail::pack_bitmask(is_inside);
+    }
+
     /// @brief Measure of the shape: Area
     ///
     /// @param bounds the boundary values for this shape
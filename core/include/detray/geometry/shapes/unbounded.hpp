@@ -38,6 +38,9 @@ class unbounded {
     /// Dimension of the local coordinate system
     static constexpr std::size_t dim{shape_t::dim};
 
+    /// The shape does not restrict the surface: Every point is inside
+    static constexpr bool is_unbounded{true};
+
     /// @brief Check boundary values for a local point.
     ///
     /// @tparam bounds_t any type of boundary values
@@ -9,6 +9,7 @@
 #pragma once
 
 // Project include(s)
+#include "detray/core/trimmed_metadata.hpp"
 #include "detray/definitions/detail/indexing.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/definitions/geometry.hpp"
@@ -213,6 +214,24 @@ class surface {
         return visit_material<typename kernels::get_material_params>(loc_p);
     }
 
+    /// Hint the cache to load the material at the local position @param loc_p
+    /// (only has an effect for material maps)
+    DETRAY_HOST_DEVICE constexpr void prefetch_material(
+        const point2_type &loc_p) const {
+        visit_material<typename kernels::prefetch_material>(loc_p);
+    }
+
+    /// Hint the cache to load the transform and the mask of the surface for
+    /// the geometry context @param ctx (host only)
+    DETRAY_HOST_DEVICE constexpr void prefetch(const context &ctx = {}) const {
+#if (defined(__GNUC__) || defined(__clang__)) &&                  \
+    !(defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__) || \
+      defined(__SYCL_DEVICE_ONLY__))
+        __builtin_prefetch(&transform(ctx));
+#endif
+        visit_mask<typename kernels::prefetch_mask>();
+    }
+
     /// @returns the bound (2D) position to the global point @param global for
     /// a given geometry context @param ctx and track direction @param dir
     DETRAY_HOST_DEVICE
@@ -223,6 +242,18 @@ class surface {
                                                              global, dir);
     }
 
+    /// @returns true if the global point @param global lies on the surface,
+    /// i.e. within the distance @param tol of it and inside of the mask
+    /// (enlarged by the same tolerance). The direction @param dir is only
+    /// needed to define the local frame of line surfaces.
+    DETRAY_HOST_DEVICE
+    constexpr bool is_on_surface(const context &ctx, const point3_type &global,
+                                 const vector3_type &dir,
+                                 const scalar_type tol) const {
+        return visit_mask<typename kernels::is_on_surface>(transform(ctx),
+                                                           global, dir, tol);
+    }
+
     /// @returns the local position to the global point @param global for
     /// a given geometry context @param ctx and track direction @param dir
     DETRAY_HOST_DEVICE
@@ -326,26 +357,46 @@ class surface {
 
     /// Call a functor on the surfaces mask with additional arguments.
     ///
+    /// @note If the detector metadata is trimmed, only the mask types it
+    /// lists are visited (@see trimmed_metadata)
+    ///
     /// @tparam functor_t the prescription to be applied to the mask
     /// @tparam Args      types of additional arguments to the functor
     template <typename functor_t, typename... Args>
     DETRAY_HOST_DEVICE constexpr auto visit_mask(Args &&... args) const {
+        using metadata_t = typename detector_t::metadata;
         const auto &masks = m_detector.mask_store();
 
-        return masks.template visit<functor_t>(m_desc.mask(),
-                                               std::forward<Args>(args)...);
+        if constexpr (detail::has_visited_masks_v<metadata_t>) {
+            return masks.template visit_subset<
+                functor_t, typename metadata_t::visited_masks>(
+                m_desc.mask(), std::forward<Args>(args)...);
+        } else {
+            return masks.template visit<functor_t>(
+                m_desc.mask(), std::forward<Args>(args)...);
+        }
     }
 
     /// Call a functor on the surfaces material with additional arguments.
     ///
+    /// @note If the detector metadata is trimmed, only the material types it
+    /// lists are visited (@see trimmed_metadata)
+    ///
     /// @tparam functor_t the prescription to be applied to the material
     /// @tparam Args      types of additional arguments to the functor
     template <typename functor_t, typename... Args>
     DETRAY_HOST_DEVICE constexpr auto visit_material(Args &&... args) const {
+        using metadata_t = typename detector_t::metadata;
         const auto &materials = m_detector.material_store();
 
-        return materials.template visit<functor_t>(m_desc.material(),
-                                                   std::forward<Args>(args)...);
+        if constexpr (detail::has_visited_materials_v<metadata_t>) {
+            return materials.template visit_subset<
+                functor_t, typename metadata_t::visited_materials>(
+                m_desc.material(), std::forward<Args>(args)...);
+        } else {
+            return materials.template visit<functor_t>(
+                m_desc.material(), std::forward<Args>(args)...);
+        }
     }
 
     /// Do a consistency check on the surface after building the detector.
@@ -26,6 +26,12 @@ namespace detray {
  * @tparam tparam axis_p1_t the type of the second axis
  * @tparam serialzier_t  type of the serializer to the storage represenations
  *
+ * @deprecated use @c grid_impl in "detray/utils/grid/grid.hpp" instead:
+ * @c zone(p, {nhood0, nhood1}) maps to @c search(p, {{nhood0, nhood1}}) ,
+ * the populators map to @c replace , @c complete and @c attach (which sort
+ * the bin content with @c kSORT ). The search returns a view: Copy it into a
+ * container to sort the entries of the whole zone.
+ *
  **/
 template <template <template <typename...> class, template <typename...> class,
                     template <typename, std::size_t> class, typename, bool,
@@ -45,6 +45,35 @@ DETRAY_HOST_DEVICE inline constexpr decltype(auto) get(
     return *(material_coll[idx].search(loc_point));
 }
 
+/// Homogeneous material has no bins: Nothing to prefetch
+template <class material_coll_t, typename point_t = void,
+          std::enable_if_t<
+              detail::is_hom_material_v<typename material_coll_t::value_type>,
+              bool> = true>
+DETRAY_HOST_DEVICE inline constexpr void prefetch(const material_coll_t &,
+                                                  const dindex,
+                                                  const point_t &) noexcept {}
+
+/// Hint the cache to load the material slab of the material map bin that
+/// contains @param loc_point, before it is accessed (host only)
+template <
+    class material_coll_t,
+    std::enable_if_t<detail::is_grid_v<typename material_coll_t::value_type>,
+                     bool> = true>
+DETRAY_HOST_DEVICE inline void prefetch(
+    [[maybe_unused]] const material_coll_t &material_coll,
+    [[maybe_unused]] const dindex idx,
+    [[maybe_unused]] const typename material_coll_t::value_type::point_type
+        &loc_point) noexcept {
+
+#if (defined(__GNUC__) || defined(__clang__)) &&                  \
+    !(defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__) || \
+      defined(__SYCL_DEVICE_ONLY__))
+    // Only the address of the slab is computed, the bin is not read
+    __builtin_prefetch(&(*(material_coll[idx].search(loc_point))));
+#endif
+}
+
 }  // namespace material_accessor
 
 }  // namespace detray::detail
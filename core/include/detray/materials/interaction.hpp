@@ -8,6 +8,7 @@
 #pragma once
 
 // Project include(s)
+#include "detray/definitions/detail/fast_math.hpp"
 #include "detray/definitions/detail/math.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/definitions/pdg_particle.hpp"
@@ -119,8 +120,9 @@ struct interaction {
         const scalar_type dhalf{rq.compute_delta_half(mat)};
         const scalar_type t{rq.compute_mass_term(constant<scalar_type>::m_e)};
         // uses RPP2018 eq. 33.11
-        const scalar_type running{math::log(t / I) + math::log(eps / I) + 0.2f -
-                                  rq.m_beta2 - 2.f * dhalf};
+        const scalar_type running{fast_math::log(t / I) +
+                                  fast_math::log(eps / I) + 0.2f - rq.m_beta2 -
+                                  2.f * dhalf};
         return eps * running;
     }
 
@@ -206,7 +208,7 @@ struct interaction {
         // log((x/X0) * (q²/beta²)) = log((sqrt(x/X0) * (q/beta))²)
         //                          = 2 * log(sqrt(x/X0) * (q/beta))
         return 13.6f * unit<scalar_type>::MeV * momentumInv * t *
-               (1.0f + 0.038f * 2.f * math::log(t));
+               (1.0f + 0.038f * 2.f * fast_math::log(t));
     }
 
     /// Multiple scattering theta0 for electrons.
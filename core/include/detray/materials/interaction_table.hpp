@@ -0,0 +1,217 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/materials/detail/relativistic_quantities.hpp"
+#include "detray/materials/interaction.hpp"
+#include "detray/materials/material.hpp"
+#include "detray/utils/type_traits.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace detray {
+
+/// @brief Tabulated Bethe-Bloch stopping power of a material for a particle.
+///
+/// The stopping power of a unit charge is sampled in equidistant bins of
+/// ln(beta*gamma) on the host, including the density effect correction.
+/// Since the stopping power only depends on the material, the mass and the
+/// beta*gamma of the particle (and scales with q²), the evaluation during
+/// propagation reduces to one logarithm and a linear interpolation, instead
+/// of the logarithms and powers of the analytic formula. The interpolation
+/// error is well below a percent, except in the bins that contain a step of
+/// the density effect parametrization (e.g. at beta*gamma = 10 for materials
+/// without density effect data), where the step is smeared over one bin.
+///
+/// @tparam scalar_t the scalar type of the material
+/// @tparam N the number of sampling points
+template <typename scalar_t, std::size_t N = 256u>
+class stopping_power_table {
+
+    public:
+    using scalar_type = scalar_t;
+    using material_type = material<scalar_type>;
+
+    /// Number of sampling points
+    static constexpr std::size_t n_points{N};
+
+    static_assert(N >= 2u, "Need at least two sampling points");
+
+    /// Default range of the table in ln(beta*gamma): [0.05, 10^5]
+    /// @{
+    static constexpr scalar_type default_min_log_bg{-3.f};
+    static constexpr scalar_type default_max_log_bg{11.5f};
+    /// @}
+
+    constexpr stopping_power_table() = default;
+
+    /// Sample the stopping power of @param mat for a particle of mass
+    /// @param mass between @param min_log_bg and @param max_log_bg
+    DETRAY_HOST
+    stopping_power_table(const material_type &mat, const scalar_type mass,
+                         const scalar_type min_log_bg = default_min_log_bg,
+                         const scalar_type max_log_bg = default_max_log_bg)
+        : m_material{mat},
+          m_mass{mass},
+          m_min_log_bg{min_log_bg},
+          m_max_log_bg{max_log_bg},
+          m_inv_bin_width{static_cast<scalar_type>(N - 1u) /
+                          (max_log_bg - min_log_bg)} {
+
+        assert(mass > 0.f);
+        assert(min_log_bg < max_log_bg);
+
+        const scalar_type bin_width{1.f / m_inv_bin_width};
+        for (std::size_t i = 0u; i < N; ++i) {
+            const scalar_type log_bg{min_log_bg +
+                                     static_cast<scalar_type>(i) * bin_width};
+            // beta*gamma = p/m
+            const scalar_type qop{1.f / (mass * math::exp(log_bg))};
+            const detail::relativistic_quantities<scalar_type> rq(mass, qop,
+                                                                  1.f);
+            // The particle type does not enter the Bethe-Bloch formula
+            m_stopping_power[i] =
+                interaction<scalar_type>().compute_bethe_bloch(mat, 0, rq);
+        }
+    }
+
+    /// @returns the material the table was built for
+    DETRAY_HOST_DEVICE
+    constexpr const material_type &get_material() const { return m_material; }
+
+    /// @returns the particle mass the table was built for
+    DETRAY_HOST_DEVICE
+    constexpr scalar_type mass() const { return m_mass; }
+
+    /// @returns whether the table was built for @param mat and @param mass
+    DETRAY_HOST_DEVICE
+    constexpr bool matches(const material_type &mat,
+                           const scalar_type mass) const {
+        return (m_mass == mass) && (m_material == mat);
+    }
+
+    /// @returns whether @param log_bg is covered by the table
+    DETRAY_HOST_DEVICE
+    constexpr bool in_range(const scalar_type log_bg) const {
+        return (log_bg >= m_min_log_bg) && (log_bg <= m_max_log_bg);
+    }
+
+    /// @returns the interpolated stopping power of a unit charge at
+    /// ln(beta*gamma) = @param log_bg (clamped to the range of the table)
+    DETRAY_HOST_DEVICE
+    scalar_type operator()(const scalar_type log_bg) const {
+
+        const scalar_type u{math::min(
+            math::max((log_bg - m_min_log_bg) * m_inv_bin_width, 0.f),
+            static_cast<scalar_type>(N - 1u))};
+        const auto i{math::min(static_cast<std::size_t>(u), N - 2u)};
+        const scalar_type t{u - static_cast<scalar_type>(i)};
+
+        return m_stopping_power[i] +
+               t * (m_stopping_power[i + 1u] - m_stopping_power[i]);
+    }
+
+    private:
+    /// The material and particle mass the table was sampled for
+    material_type m_material{};
+    scalar_type m_mass{0.f};
+    /// Range and binning in ln(beta*gamma)
+    scalar_type m_min_log_bg{default_min_log_bg};
+    scalar_type m_max_log_bg{default_max_log_bg};
+    scalar_type m_inv_bin_width{0.f};
+    /// Sampled stopping power
+    darray<scalar_type, N> m_stopping_power{};
+};
+
+namespace detail {
+
+/// Add the distinct materials of the collection @param coll to
+/// @param materials
+template <typename scalar_t, typename collection_t>
+DETRAY_HOST void add_materials(const collection_t &coll,
+                               std::vector<material<scalar_t>> &materials) {
+
+    using material_t = typename collection_t::value_type;
+
+    auto add = [&materials](const material<scalar_t> &mat) {
+        if (mat.mass_density() > 0.f &&
+            std::find(materials.begin(), materials.end(), mat) ==
+                materials.end()) {
+            materials.push_back(mat);
+        }
+    };
+
+    for (const auto &entry : coll) {
+        if constexpr (std::is_same_v<material_t, material<scalar_t>>) {
+            add(entry);
+        } else if constexpr (is_hom_material_v<material_t>) {
+            add(entry.get_material());
+        } else if constexpr (is_material_map_v<material_t>) {
+            for (const auto &slab : entry.all()) {
+                add(slab.get_material());
+            }
+        }
+    }
+}
+
+/// Add the distinct materials of all collections in @param store
+template <typename scalar_t, typename store_t, std::size_t... I>
+DETRAY_HOST void add_materials(const store_t &store,
+                               std::vector<material<scalar_t>> &materials,
+                               std::index_sequence<I...> /*seq*/) {
+    (add_materials(store.template get<I>(), materials), ...);
+}
+
+}  // namespace detail
+
+/// @returns the distinct materials in the material store of @param det
+/// (homogeneous material and the bins of material maps)
+template <typename detector_t>
+DETRAY_HOST auto collect_materials(const detector_t &det) {
+
+    using scalar_t = typename detector_t::scalar_type;
+    using material_store_t = typename detector_t::material_container;
+
+    std::vector<material<scalar_t>> materials;
+    detail::add_materials(
+        det.material_store(), materials,
+        std::make_index_sequence<material_store_t::n_collections()>{});
+
+    return materials;
+}
+
+/// @returns the stopping power tables of the @param materials for a particle
+/// of mass @param mass
+template <typename scalar_t, std::size_t N = 256u>
+DETRAY_HOST auto make_stopping_power_tables(
+    const std::vector<material<scalar_t>> &materials, const scalar_t mass,
+    vecmem::memory_resource &resource) {
+
+    dvector<stopping_power_table<scalar_t, N>> tables(&resource);
+    tables.reserve(materials.size());
+    for (const auto &mat : materials) {
+        tables.emplace_back(mat, mass);
+    }
+
+    return tables;
+}
+
+}  // namespace detray
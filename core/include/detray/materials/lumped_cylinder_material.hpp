@@ -0,0 +1,70 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/materials/material_slab.hpp"
+
+// System include(s)
+#include <cstddef>
+
+namespace detray {
+
+/// @brief Coarse material description as a set of concentric cylinders.
+///
+/// Every layer is a cylinder around the z-axis with a homogeneous material
+/// slab, e.g. the lumped material of a beampipe or a barrel layer. It is used
+/// to estimate the material budget of a direct extrapolation, which does not
+/// see the detector surfaces.
+template <typename scalar_t, std::size_t N = 16u>
+struct lumped_cylinder_material {
+
+    using scalar_type = scalar_t;
+
+    /// A single cylinder of lumped material
+    struct layer {
+        /// Radius of the cylinder
+        scalar_type radius{0.f};
+        /// Half length of the cylinder in z
+        scalar_type half_length{0.f};
+        /// The material of the cylinder
+        material_slab<scalar_type> slab{};
+    };
+
+    /// Add the cylinder with radius @param r , the half length @param hz and
+    /// the material @param slab
+    ///
+    /// @returns false if the model is full
+    DETRAY_HOST_DEVICE
+    constexpr bool add(const scalar_type r, const scalar_type hz,
+                       const material_slab<scalar_type> &slab) {
+        if (m_n == N) {
+            return false;
+        }
+        m_layers[m_n++] = layer{r, hz, slab};
+        return true;
+    }
+
+    /// @returns the number of layers
+    DETRAY_HOST_DEVICE
+    constexpr std::size_t size() const { return m_n; }
+
+    /// @returns the layer @param i
+    DETRAY_HOST_DEVICE
+    constexpr const layer &operator[](const std::size_t i) const {
+        return m_layers[i];
+    }
+
+    private:
+    darray<layer, N> m_layers{};
+    std::size_t m_n{0u};
+};
+
+}  // namespace detray
@@ -0,0 +1,203 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/grid_axis.hpp"
+#include "detray/geometry/barcode.hpp"
+#include "detray/materials/detail/material_accessor.hpp"
+#include "detray/materials/material_slab.hpp"
+#include "detray/utils/type_traits.hpp"
+
+// System include(s)
+#include <cstddef>
+#include <limits>
+
+namespace detray {
+
+/// @brief Caches the results of material map lookups per surface.
+///
+/// When a track is propagated repeatedly through the same detector (e.g. in
+/// the iterations of a Kalman filter and its smoother), it crosses the
+/// surfaces at nearly the same local positions. The cache keeps the material
+/// slab of the last visited map bin for up to @tparam CAPACITY surfaces,
+/// together with the local bin boundaries, and returns it without accessing
+/// the material map as long as the local position stays inside that bin.
+/// Surfaces beyond the capacity replace the oldest entry.
+///
+/// @note Homogeneous material is not cached, since its lookup is a plain
+/// array access.
+/// @note The cache has to be cleared when the detector material changes.
+template <typename scalar_t, std::size_t CAPACITY = 16u>
+class material_cache {
+
+    using slab_type = material_slab<scalar_t>;
+
+    /// Material of the last visited map bin on a surface
+    struct entry {
+        geometry::barcode sf_barcode{};
+        slab_type slab{};
+        /// Local bin boundaries
+        darray<scalar_t, 2> lower{0.f, 0.f};
+        darray<scalar_t, 2> upper{0.f, 0.f};
+
+        /// @returns whether the local position @param loc is in the bin
+        template <typename point_t>
+        DETRAY_HOST_DEVICE constexpr bool contains(const point_t &loc) const {
+            return (lower[0] <= loc[0]) && (loc[0] < upper[0]) &&
+                   (lower[1] <= loc[1]) && (loc[1] < upper[1]);
+        }
+    };
+
+    public:
+    /// @returns the material of the surface @param sf_barcode in the
+    /// collection @param material_coll at index @param idx for the local
+    /// position @param loc_point
+    template <class material_coll_t, typename point_t>
+    DETRAY_HOST_DEVICE decltype(auto) get(const geometry::barcode sf_barcode,
+                                          const material_coll_t &material_coll,
+                                          const dindex idx,
+                                          const point_t &loc_point) {
+
+        using material_t = typename material_coll_t::value_type;
+
+        if constexpr (detail::is_grid_v<material_t> &&
+                      material_t::dim == 2u) {
+            return get_from_map(sf_barcode, material_coll[idx], loc_point);
+        } else {
+            return detail::material_accessor::get(material_coll, idx,
+                                                  loc_point);
+        }
+    }
+
+    /// @returns the number of lookups that were served from the cache
+    DETRAY_HOST_DEVICE
+    constexpr std::size_t n_hits() const { return m_n_hits; }
+
+    /// @returns the number of lookups that needed a material map search
+    DETRAY_HOST_DEVICE
+    constexpr std::size_t n_misses() const { return m_n_misses; }
+
+    /// @returns the number of cached surfaces
+    DETRAY_HOST_DEVICE
+    constexpr std::size_t size() const { return m_size; }
+
+    /// @returns the maximal number of cached surfaces
+    DETRAY_HOST_DEVICE
+    static constexpr std::size_t capacity() { return CAPACITY; }
+
+    /// Remove all entries and reset the counters
+    DETRAY_HOST_DEVICE
+    constexpr void clear() {
+        m_size = 0u;
+        m_next = 0u;
+        m_n_hits = 0u;
+        m_n_misses = 0u;
+    }
+
+    private:
+    /// @returns the material slab of the material map @param map at the
+    /// local position @param loc_point of the surface @param sf_barcode
+    template <typename map_t, typename point_t>
+    DETRAY_HOST_DEVICE slab_type get_from_map(
+        const geometry::barcode sf_barcode, const map_t &map,
+        const point_t &loc_point) {
+
+        // Look for the surface in the cache
+        std::size_t slot{m_size};
+        for (std::size_t i = 0u; i < m_size; ++i) {
+            if (m_entries[i].sf_barcode == sf_barcode) {
+                slot = i;
+                break;
+            }
+        }
+
+        if (slot < m_size && m_entries[slot].contains(loc_point)) {
+            ++m_n_hits;
+            return m_entries[slot].slab;
+        }
+        ++m_n_misses;
+
+        // New surface: Fill an empty slot or replace the oldest entry
+        if (slot == m_size) {
+            if (m_size < CAPACITY) {
+                ++m_size;
+            } else {
+                slot = m_next;
+                m_next = (m_next + 1u) % CAPACITY;
+            }
+        }
+
+        const typename map_t::point_type loc{loc_point[0], loc_point[1]};
+        const auto mbin = map.axes().bins(loc);
+
+        entry &e = m_entries[slot];
+        e.sf_barcode = sf_barcode;
+        e.slab = *(map.bin(mbin));
+        set_bin_edges(map.template get_axis<0>(), mbin[0], e.lower[0],
+                      e.upper[0]);
+        set_bin_edges(map.template get_axis<1>(), mbin[1], e.lower[1],
+                      e.upper[1]);
+
+        return e.slab;
+    }
+
+    /// Set the local range @param lower, @param upper that is mapped onto
+    /// the bin @param ibin of the axis @param ax
+    template <typename axis_t>
+    DETRAY_HOST_DEVICE static void set_bin_edges(const axis_t &ax,
+                                                 const dindex ibin,
+                                                 scalar_t &lower,
+                                                 scalar_t &upper) {
+        constexpr scalar_t inf{std::numeric_limits<scalar_t>::max()};
+        constexpr axis::bounds bounds_type{axis_t::bounds_type::type};
+
+        const dindex n_bins{ax.nbins()};
+
+        if constexpr (bounds_type == axis::bounds::e_open) {
+            // Under- and overflow bins are added beyond the axis span
+            if (ibin == 0u) {
+                lower = -inf;
+                upper = ax.min();
+            } else if (ibin == n_bins - 1u) {
+                lower = ax.max();
+                upper = inf;
+            } else {
+                const auto edges = ax.bin_edges(ibin - 1u);
+                lower = edges[0];
+                upper = edges[1];
+            }
+        } else {
+            const auto edges = ax.bin_edges(ibin);
+            lower = edges[0];
+            upper = edges[1];
+
+            // Under- and overflow are mapped onto the first and last bin
+            if constexpr (bounds_type == axis::bounds::e_closed) {
+                lower = (ibin == 0u) ? -inf : lower;
+                upper = (ibin == n_bins - 1u) ? inf : upper;
+            }
+        }
+    }
+
+    /// Cached surfaces
+    darray<entry, CAPACITY> m_entries{};
+    /// Number of cached surfaces
+    std::size_t m_size{0u};
+    /// Next entry to be replaced, once the cache is full
+    std::size_t m_next{0u};
+
+    /// Cache statistics
+    std::size_t m_n_hits{0u};
+    std::size_t m_n_misses{0u};
+};
+
+}  // namespace detray
@@ -0,0 +1,118 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/algorithms.hpp"
+#include "detray/definitions/detail/atomic.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/materials/material.hpp"
+#include "detray/materials/material_slab.hpp"
+#include "detray/utils/grid/populators.hpp"
+#include "detray/utils/invalid_values.hpp"
+
+namespace detray {
+
+/// @brief Material that was recorded on a surface, e.g. by a simulation
+template <typename algebra_t>
+struct material_recording {
+    using scalar_type = dscalar<algebra_t>;
+    using point2_type = dpoint2D<algebra_t>;
+
+    /// Index of the material map of the surface in its collection
+    dindex map_index{detail::invalid_value<dindex>()};
+    /// Local position on the surface
+    point2_type loc{};
+    /// Traversed material, at normal incidence
+    material_slab<scalar_type> slab{};
+};
+
+/// @brief Sums of the material that was recorded in a material map bin
+///
+/// The thickness and the thickness in units of X0 and L0 are summed up, as
+/// well as the mass per area and the mass weighted atomic number and relative
+/// atomic mass, from which the average material of the bin is obtained.
+template <typename scalar_t>
+struct material_bin_sums {
+    using scalar_type = scalar_t;
+
+    scalar_type thickness{0.f};
+    scalar_type thickness_in_X0{0.f};
+    scalar_type thickness_in_L0{0.f};
+    scalar_type mass{0.f};
+    scalar_type mass_Z{0.f};
+    scalar_type mass_Ar{0.f};
+    dindex n_entries{0u};
+
+    /// Add the material @param slab to the sums - thread safe
+    DETRAY_HOST_DEVICE void add(const material_slab<scalar_type> &slab) {
+        const auto &mat = slab.get_material();
+        const scalar_type m{slab.thickness() * mat.mass_density()};
+
+        detail::atomic_add(&thickness, slab.thickness());
+        detail::atomic_add(&thickness_in_X0, slab.thickness_in_X0());
+        detail::atomic_add(&thickness_in_L0, slab.thickness_in_L0());
+        detail::atomic_add(&mass, m);
+        detail::atomic_add(&mass_Z, m * mat.Z());
+        detail::atomic_add(&mass_Ar, m * mat.Ar());
+        detail::atomic_add(&n_entries, 1u);
+    }
+
+    /// @returns the average material slab of the recorded entries, which
+    /// keeps the average thickness in X0 and L0 (invalid, if the bin is empty
+    /// or contains only vacuum)
+    DETRAY_HOST_DEVICE material_slab<scalar_type> average() const {
+        if (n_entries == 0u || thickness_in_X0 <= 0.f || mass <= 0.f) {
+            return {};
+        }
+
+        const material<scalar_type> mat{
+            thickness / thickness_in_X0, thickness / thickness_in_L0,
+            mass_Ar / mass,              mass_Z / mass,
+            mass / thickness,            material_state::e_solid};
+
+        return {mat, thickness / static_cast<scalar_type>(n_entries)};
+    }
+};
+
+/// Add the material recording @param rec to the sums of its bin
+///
+/// @param maps the collection of material maps the recording refers to
+/// @param sums the material sums, one per bin of the collection (in the
+///             order of the collection bin storage) - thread safe
+template <typename map_collection_t, typename sums_t, typename algebra_t>
+DETRAY_HOST_DEVICE inline void accumulate_material(
+    const map_collection_t &maps, sums_t &sums,
+    const material_recording<algebra_t> &rec) {
+
+    const auto map = maps[rec.map_index];
+    const dindex gbin{map.serialize(map.axes().bins(rec.loc))};
+
+    sums[maps.offsets()[rec.map_index] + gbin].add(rec.slab);
+}
+
+/// Replace the content of the bin @param i in the bin storage of the material
+/// map collection @param maps by the average material of its @param sums
+///
+/// @note Thread safe, as long as every bin is finalized by one thread only
+template <typename map_collection_t, typename sums_t>
+DETRAY_HOST_DEVICE inline void finalize_material_bin(
+    const map_collection_t &maps, const sums_t &sums, const dindex i) {
+
+    // Find the map that contains the bin
+    const auto &offsets = maps.offsets();
+    const auto itr = detail::upper_bound(offsets.begin(), offsets.end(), i);
+    const auto map_idx{static_cast<dindex>(itr - offsets.begin()) - 1u};
+
+    maps[map_idx].template populate<replace<>>(i - offsets[map_idx],
+                                               sums[i].average());
+}
+
+}  // namespace detray
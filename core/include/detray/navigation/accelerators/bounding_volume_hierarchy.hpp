@@ -0,0 +1,675 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Detray include(s).
+#include "detray/core/detail/container_buffers.hpp"
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/geometry/shapes/cuboid3D.hpp"
+#include "detray/utils/bounding_volume.hpp"
+#include "detray/utils/invalid_values.hpp"
+#include "detray/utils/ranges.hpp"
+#include "detray/utils/type_traits.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+namespace detray {
+
+namespace detail {
+
+/// @brief Node of a flattened bounding volume hierarchy
+///
+/// The nodes are stored in depth-first order: The first child of an inner
+/// node follows directly after it and the subtree of a node is contiguous.
+/// This allows a stackless traversal, which skips a subtree by jumping over
+/// its nodes.
+template <typename scalar_t>
+struct bvh_node {
+    /// Corners of the axis aligned bounding box in global coordinates
+    darray<scalar_t, 3> min{};
+    darray<scalar_t, 3> max{};
+    /// Number of nodes in the subtree of this node (including itself)
+    dindex n_subtree{1u};
+    /// Range of the surfaces in the subtree of this node
+    dindex sf_begin{0u};
+    dindex sf_end{0u};
+
+    /// @returns true if the node does not have children
+    DETRAY_HOST_DEVICE
+    constexpr bool is_leaf() const { return n_subtree == 1u; }
+};
+
+}  // namespace detail
+
+/// @brief A collection of bounding volume hierarchies (one per volume) over
+/// the surfaces of the detector volumes, callable by index.
+///
+/// The hierarchies are built on the host with the surface area heuristic
+/// (SAH) and flattened into a single node container, so that they can be
+/// copied to device as they are. A neighborhood lookup returns the surfaces
+/// whose bounding boxes are crossed by the straight line through the track
+/// position along the track direction.
+///
+/// This class fulfills all criteria to be used in the detector @c multi_store .
+///
+/// @tparam value_t the entry type in the collection (e.g. surface descriptors).
+/// @tparam container_t the types of underlying containers to be used.
+/// @tparam scalar_t the scalar type of the bounding boxes.
+template <class value_t, typename container_t = host_container_types,
+          typename scalar_t = detray::scalar>
+class bvh_collection {
+
+    public:
+    template <typename T>
+    using vector_type = typename container_t::template vector_type<T>;
+    using size_type = dindex;
+    using node_type = detail::bvh_node<scalar_t>;
+    using aabb_type = axis_aligned_bounding_volume<cuboid3D, scalar_t>;
+
+    /// The surfaces in the bounding boxes that are crossed by a line
+    class line_search
+        : public detray::ranges::view_interface<line_search> {
+
+        public:
+        /// @brief Traverse the hierarchy and iterate the surfaces in the
+        /// leaves that are crossed by the line
+        struct iterator {
+
+            using difference_type = std::ptrdiff_t;
+            using value_type = value_t;
+            using pointer = const value_t *;
+            using reference = const value_t &;
+            using iterator_category = detray::ranges::forward_iterator_tag;
+
+            /// Default constructor required by LegacyIterator trait
+            constexpr iterator() = default;
+
+            /// Construct from the @param search and the index of the first
+            /// node to be tested
+            DETRAY_HOST_DEVICE
+            iterator(const line_search &search, const dindex node)
+                : m_search{&search}, m_node{node} {
+                next_leaf();
+            }
+
+            /// @returns true if it points to the same surface
+            DETRAY_HOST_DEVICE constexpr bool operator==(
+                const iterator &rhs) const {
+                return m_pos == rhs.m_pos;
+            }
+
+            /// @returns false if it points to the same surface
+            DETRAY_HOST_DEVICE constexpr bool operator!=(
+                const iterator &rhs) const {
+                return m_pos != rhs.m_pos;
+            }
+
+            /// Increment to the next surface, possibly in the next leaf
+            DETRAY_HOST_DEVICE auto operator++() -> iterator & {
+                ++m_pos;
+                if (m_pos == m_end) {
+                    next_leaf();
+                }
+                return *this;
+            }
+
+            /// @returns the current surface
+            DETRAY_HOST_DEVICE
+            constexpr auto operator*() const -> reference { return *m_pos; }
+
+            private:
+            /// Find the next leaf that is crossed by the line
+            DETRAY_HOST_DEVICE constexpr void next_leaf() {
+                while (m_node < m_search->m_n_nodes) {
+                    const node_type &node = m_search->m_nodes[m_node];
+                    if (not m_search->is_crossed(node)) {
+                        // Skip the subtree
+                        m_node += node.n_subtree;
+                    } else if (node.is_leaf()) {
+                        m_pos = m_search->m_surfaces + node.sf_begin;
+                        m_end = m_search->m_surfaces + node.sf_end;
+                        ++m_node;
+                        return;
+                    } else {
+                        // Descend to the first child
+                        ++m_node;
+                    }
+                }
+                // End position
+                m_pos = nullptr;
+                m_end = nullptr;
+            }
+
+            /// The search that defines the line
+            const line_search *m_search{nullptr};
+            /// Index of the next node to be tested
+            dindex m_node{0u};
+            /// Current surface and end of the current leaf
+            const value_t *m_pos{nullptr};
+            const value_t *m_end{nullptr};
+        };
+
+        /// Default constructor
+        constexpr line_search() = default;
+
+        /// Construct from the @param nodes of a hierarchy, the global
+        /// surface container and the line, given by a point @param pos and
+        /// a direction @param dir . Every box is enlarged by @param tol .
+        template <typename point3_t, typename vector3_t>
+        DETRAY_HOST_DEVICE line_search(const node_type *nodes,
+                                       const dindex n_nodes,
+                                       const value_t *surfaces,
+                                       const point3_t &pos,
+                                       const vector3_t &dir,
+                                       const scalar_t tol)
+            : m_nodes{nodes},
+              m_n_nodes{n_nodes},
+              m_surfaces{surfaces},
+              m_tol{tol} {
+            for (unsigned int i = 0u; i < 3u; ++i) {
+                m_pos[i] = static_cast<scalar_t>(pos[i]);
+                m_is_parallel[i] = (dir[i] == 0.f);
+                m_inv_dir[i] = m_is_parallel[i]
+                                   ? 0.f
+                                   : 1.f / static_cast<scalar_t>(dir[i]);
+            }
+        }
+
+        /// @returns start position: first surface in the first crossed leaf
+        DETRAY_HOST_DEVICE
+        auto begin() const -> iterator { return {*this, 0u}; }
+
+        /// @returns sentinel of the range
+        DETRAY_HOST_DEVICE
+        auto end() const -> iterator { return {*this, m_n_nodes}; }
+
+        private:
+        /// @returns true if the line crosses the box of @param node
+        DETRAY_HOST_DEVICE
+        constexpr bool is_crossed(const node_type &node) const {
+            constexpr scalar_t inv{detail::invalid_value<scalar_t>()};
+            // The whole line is tested, since the navigator also keeps
+            // candidates behind the track position (overstepping)
+            scalar_t t_min{-inv};
+            scalar_t t_max{inv};
+            for (unsigned int i = 0u; i < 3u; ++i) {
+                const scalar_t lo{node.min[i] - m_tol};
+                const scalar_t hi{node.max[i] + m_tol};
+                if (m_is_parallel[i]) {
+                    if (m_pos[i] < lo or m_pos[i] > hi) {
+                        return false;
+                    }
+                    continue;
+                }
+                scalar_t t1{(lo - m_pos[i]) * m_inv_dir[i]};
+                scalar_t t2{(hi - m_pos[i]) * m_inv_dir[i]};
+                if (t1 > t2) {
+                    const scalar_t t{t1};
+                    t1 = t2;
+                    t2 = t;
+                }
+                t_min = t1 > t_min ? t1 : t_min;
+                t_max = t2 < t_max ? t2 : t_max;
+                if (t_min > t_max) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /// Nodes of the hierarchy
+        const node_type *m_nodes{nullptr};
+        dindex m_n_nodes{0u};
+        /// Access to the surface storage
+        const value_t *m_surfaces{nullptr};
+        /// The line
+        darray<scalar_t, 3> m_pos{};
+        darray<scalar_t, 3> m_inv_dir{};
+        darray<bool, 3> m_is_parallel{};
+        /// Enlargement of the boxes
+        scalar_t m_tol{0.f};
+    };
+
+    /// A nested surface finder that traverses the hierarchy of a single
+    /// volume. This type will be returned when the surface collection is
+    /// queried for the surfaces of a particular volume.
+    struct bvh_finder {
+
+        using scalar_type = scalar_t;
+        using node_type = detail::bvh_node<scalar_t>;
+
+        /// Default constructor
+        bvh_finder() = default;
+
+        /// Constructor from the @param nodes and @param surfaces containers
+        /// and the node range @param range of the hierarchy
+        DETRAY_HOST_DEVICE constexpr bvh_finder(
+            const vector_type<node_type> &nodes,
+            const vector_type<value_t> &surfaces, const dindex_range &range)
+            : m_nodes{nodes.data() + detail::get<0>(range)},
+              m_n_nodes{detail::get<1>(range) - detail::get<0>(range)},
+              m_surfaces{&surfaces} {}
+
+        /// @returns the surfaces whose boxes are crossed by the straight line
+        /// along the track direction
+        template <typename detector_t, typename track_t, typename config_t>
+        DETRAY_HOST_DEVICE constexpr auto search(
+            const detector_t & /*det*/,
+            const typename detector_t::volume_type & /*volume*/,
+            const track_t &track, const config_t &cfg) const {
+            return line_search{m_nodes,     m_n_nodes,   m_surfaces->data(),
+                               track.pos(), track.dir(), cfg.mask_tolerance};
+        }
+
+        /// @returns the number of surfaces in the hierarchy
+        DETRAY_HOST_DEVICE constexpr auto size() const -> dindex {
+            return m_n_nodes == 0u ? 0u
+                                   : m_nodes[0].sf_end - m_nodes[0].sf_begin;
+        }
+
+        /// @returns the surface at a given index @param i - const
+        DETRAY_HOST_DEVICE constexpr const value_t &at(const dindex i) const {
+            assert(i < size());
+            return (*m_surfaces)[m_nodes[0].sf_begin + i];
+        }
+
+        /// @returns an iterator over all surfaces in the data structure
+        DETRAY_HOST_DEVICE constexpr auto all() const {
+            const dindex first{m_n_nodes == 0u ? 0u : m_nodes[0].sf_begin};
+            return detray::ranges::subrange<const vector_type<value_t>>{
+                *m_surfaces, dindex_range{first, first + size()}};
+        }
+
+        /// @returns the number of nodes in the hierarchy
+        DETRAY_HOST_DEVICE constexpr auto n_nodes() const -> dindex {
+            return m_n_nodes;
+        }
+
+        /// @returns the node at a given index @param i - const
+        DETRAY_HOST_DEVICE constexpr const node_type &node(
+            const dindex i) const {
+            assert(i < m_n_nodes);
+            return m_nodes[i];
+        }
+
+        /// @return the maximum number of surface candidates during a
+        /// neighborhood lookup
+        DETRAY_HOST_DEVICE constexpr auto n_max_candidates() const
+            -> unsigned int {
+            return static_cast<unsigned int>(size());
+        }
+
+        /// @return the maximum number of surface candidates during a
+        /// neighborhood lookup (independent of the search window)
+        template <typename neighbor_t>
+        DETRAY_HOST_DEVICE constexpr auto n_max_candidates(
+            const std::array<neighbor_t, 2> & /*win_size*/) const
+            -> unsigned int {
+            return n_max_candidates();
+        }
+
+        private:
+        /// Nodes of the hierarchy
+        const node_type *m_nodes{nullptr};
+        dindex m_n_nodes{0u};
+        /// Access to the surface storage of the collection
+        const vector_type<value_t> *m_surfaces{nullptr};
+    };
+
+    using value_type = bvh_finder;
+
+    using view_type =
+        dmulti_view<dvector_view<size_type>, dvector_view<node_type>,
+                    dvector_view<value_t>>;
+    using const_view_type = dmulti_view<dvector_view<const size_type>,
+                                        dvector_view<const node_type>,
+                                        dvector_view<const value_t>>;
+    using buffer_type =
+        dmulti_buffer<dvector_buffer<size_type>, dvector_buffer<node_type>,
+                      dvector_buffer<value_t>>;
+
+    /// Default constructor
+    constexpr bvh_collection() {
+        // Start of first node range
+        m_offsets.push_back(0u);
+    };
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit constexpr bvh_collection(vecmem::memory_resource *resource)
+        : m_offsets(resource), m_nodes(resource), m_surfaces(resource) {
+        // Start of first node range
+        m_offsets.push_back(0u);
+    }
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit constexpr bvh_collection(vecmem::memory_resource &resource)
+        : bvh_collection(&resource) {}
+
+    /// Device-side construction from a vecmem based view type
+    template <typename coll_view_t,
+              typename std::enable_if_t<detail::is_device_view_v<coll_view_t>,
+                                        bool> = true>
+    DETRAY_HOST_DEVICE bvh_collection(coll_view_t &view)
+        : m_offsets(detail::get<0>(view.m_view)),
+          m_nodes(detail::get<1>(view.m_view)),
+          m_surfaces(detail::get<2>(view.m_view)) {}
+
+    /// @returns access to the node offsets of the hierarchies - const
+    DETRAY_HOST const auto &offsets() const { return m_offsets; }
+
+    /// @returns number of hierarchies - const
+    DETRAY_HOST_DEVICE
+    constexpr auto size() const noexcept -> size_type {
+        // The start index of the first range is always present
+        return static_cast<dindex>(m_offsets.size()) - 1u;
+    }
+
+    /// @note outside of navigation, the number of elements is unknown
+    DETRAY_HOST_DEVICE
+    constexpr auto empty() const noexcept -> bool {
+        return size() == size_type{0};
+    }
+
+    /// @return access to the node container - const.
+    DETRAY_HOST_DEVICE
+    auto nodes() const -> const vector_type<node_type> & { return m_nodes; }
+
+    /// @return access to the surface container - const.
+    DETRAY_HOST_DEVICE
+    auto all() const -> const vector_type<value_t> & { return m_surfaces; }
+
+    /// Create the surface finder of the hierarchy with index @param i - const
+    DETRAY_HOST_DEVICE
+    auto operator[](const size_type i) const -> value_type {
+        return {m_nodes, m_surfaces,
+                dindex_range{m_offsets[i], m_offsets[i + 1u]}};
+    }
+
+    /// Build a new hierarchy over @param surfaces with the global bounding
+    /// boxes @param boxes (one per surface)
+    ///
+    /// @param max_leaf_size leaves are split until they hold at most this
+    ///                      number of surfaces, or splitting does not pay off
+    template <typename sf_container_t,
+              typename std::enable_if_t<detray::ranges::range_v<sf_container_t>,
+                                        bool> = true,
+              typename std::enable_if_t<
+                  std::is_same_v<typename sf_container_t::value_type, value_t>,
+                  bool> = true>
+    DETRAY_HOST auto push_back(const sf_container_t &surfaces,
+                               const std::vector<aabb_type> &boxes,
+                               const dindex max_leaf_size = 4u) noexcept(false)
+        -> void {
+        assert(surfaces.size() == boxes.size());
+
+        if (not surfaces.empty()) {
+            std::vector<dindex> indices(surfaces.size());
+            std::iota(indices.begin(), indices.end(), 0u);
+
+            m_surfaces.reserve(m_surfaces.size() + surfaces.size());
+            build_node(surfaces, boxes, indices.begin(), indices.end(),
+                       std::max(1u, max_leaf_size));
+        }
+
+        // End of this range is the start of the next range
+        m_offsets.push_back(static_cast<dindex>(m_nodes.size()));
+    }
+
+    /// @return the view on the hierarchies - non-const
+    DETRAY_HOST
+    constexpr auto get_data() noexcept -> view_type {
+        return view_type{detray::get_data(m_offsets),
+                         detray::get_data(m_nodes),
+                         detray::get_data(m_surfaces)};
+    }
+
+    /// @return the view on the hierarchies - const
+    DETRAY_HOST
+    constexpr auto get_data() const noexcept -> const_view_type {
+        return const_view_type{detray::get_data(m_offsets),
+                               detray::get_data(m_nodes),
+                               detray::get_data(m_surfaces)};
+    }
+
+    private:
+    using index_itr_t = std::vector<dindex>::iterator;
+
+    /// Number of bins per axis for the SAH split search
+    static constexpr std::size_t n_sah_bins{12u};
+
+    /// @returns the box around the boxes in [@param first, @param last)
+    DETRAY_HOST static auto merge(const std::vector<aabb_type> &boxes,
+                                  index_itr_t first, index_itr_t last)
+        -> node_type {
+        constexpr scalar_t inv{detail::invalid_value<scalar_t>()};
+        node_type node{{inv, inv, inv}, {-inv, -inv, -inv}};
+        for (auto itr = first; itr != last; ++itr) {
+            const aabb_type &box = boxes[*itr];
+            for (unsigned int i = 0u; i < 3u; ++i) {
+                node.min[i] = std::min(node.min[i], box[cuboid3D::e_min_x + i]);
+                node.max[i] = std::max(node.max[i], box[cuboid3D::e_max_x + i]);
+            }
+        }
+        return node;
+    }
+
+    /// @returns the surface area of a box (up to a factor of two)
+    DETRAY_HOST static auto half_area(const darray<scalar_t, 3> &min,
+                                      const darray<scalar_t, 3> &max)
+        -> scalar_t {
+        const scalar_t dx{max[0] - min[0]};
+        const scalar_t dy{max[1] - min[1]};
+        const scalar_t dz{max[2] - min[2]};
+        return dx * dy + dy * dz + dz * dx;
+    }
+
+    /// @returns the center of a box on the axis @param i
+    DETRAY_HOST static auto center(const aabb_type &box, const unsigned int i)
+        -> scalar_t {
+        return 0.5f * (box[cuboid3D::e_min_x + i] + box[cuboid3D::e_max_x + i]);
+    }
+
+    /// Recursively build the subtree over the surfaces in [@param first,
+    /// @param last) in depth-first order
+    template <typename sf_container_t>
+    DETRAY_HOST void build_node(const sf_container_t &surfaces,
+                                const std::vector<aabb_type> &boxes,
+                                index_itr_t first, index_itr_t last,
+                                const dindex max_leaf_size) {
+
+        const auto n{static_cast<dindex>(last - first)};
+        const auto node_idx{static_cast<dindex>(m_nodes.size())};
+        m_nodes.push_back(merge(boxes, first, last));
+
+        index_itr_t split{first};
+        if (n > 1u) {
+            split = find_split(boxes, first, last, m_nodes.back(),
+                               n > max_leaf_size);
+        }
+
+        if (split == first) {
+            // Leaf: add the surfaces in the order of the leaves
+            node_type &node = m_nodes[node_idx];
+            node.sf_begin = static_cast<dindex>(m_surfaces.size());
+            for (auto itr = first; itr != last; ++itr) {
+                m_surfaces.push_back(surfaces[*itr]);
+            }
+            node.sf_end = static_cast<dindex>(m_surfaces.size());
+            return;
+        }
+
+        const auto sf_begin{static_cast<dindex>(m_surfaces.size())};
+        build_node(surfaces, boxes, first, split, max_leaf_size);
+        build_node(surfaces, boxes, split, last, max_leaf_size);
+
+        node_type &node = m_nodes[node_idx];
+        node.n_subtree = static_cast<dindex>(m_nodes.size()) - node_idx;
+        node.sf_begin = sf_begin;
+        node.sf_end = static_cast<dindex>(m_surfaces.size());
+    }
+
+    /// Partition the surfaces in [@param first, @param last) along the split
+    /// with the lowest SAH cost
+    ///
+    /// @param parent the node that contains the surfaces
+    /// @param force split even if it does not reduce the SAH cost
+    ///
+    /// @returns the start of the second child, or @param first for a leaf
+    DETRAY_HOST static auto find_split(const std::vector<aabb_type> &boxes,
+                                       index_itr_t first, index_itr_t last,
+                                       const node_type &parent,
+                                       const bool force) -> index_itr_t {
+
+        constexpr scalar_t inv{detail::invalid_value<scalar_t>()};
+        const auto n{static_cast<dindex>(last - first)};
+
+        // Extent of the box centers
+        darray<scalar_t, 3> c_min{inv, inv, inv};
+        darray<scalar_t, 3> c_max{-inv, -inv, -inv};
+        for (auto itr = first; itr != last; ++itr) {
+            for (unsigned int i = 0u; i < 3u; ++i) {
+                const scalar_t c{center(boxes[*itr], i)};
+                c_min[i] = std::min(c_min[i], c);
+                c_max[i] = std::max(c_max[i], c);
+            }
+        }
+
+        // Cost of a leaf, relative to the cost of a surface intersection
+        scalar_t best_cost{static_cast<scalar_t>(n) *
+                           half_area(parent.min, parent.max)};
+        unsigned int best_axis{3u};
+        std::size_t best_bin{0u};
+
+        for (unsigned int i = 0u; i < 3u; ++i) {
+            const scalar_t extent{c_max[i] - c_min[i]};
+            if (extent <= 0.f) {
+                continue;
+            }
+            const scalar_t scale{static_cast<scalar_t>(n_sah_bins) / extent};
+            auto bin_of = [&](const dindex idx) {
+                const auto b{static_cast<std::size_t>(
+                    (center(boxes[idx], i) - c_min[i]) * scale)};
+                return std::min(b, n_sah_bins - 1u);
+            };
+
+            // Fill the bins
+            std::array<node_type, n_sah_bins> bins;
+            std::array<dindex, n_sah_bins> counts{};
+            for (auto &b : bins) {
+                b = node_type{{inv, inv, inv}, {-inv, -inv, -inv}};
+            }
+            for (auto itr = first; itr != last; ++itr) {
+                const std::size_t b{bin_of(*itr)};
+                ++counts[b];
+                for (unsigned int j = 0u; j < 3u; ++j) {
+                    bins[b].min[j] = std::min(
+                        bins[b].min[j], boxes[*itr][cuboid3D::e_min_x + j]);
+                    bins[b].max[j] = std::max(
+                        bins[b].max[j], boxes[*itr][cuboid3D::e_max_x + j]);
+                }
+            }
+
+            // Sweep from the right to get the cost of the right children
+            std::array<scalar_t, n_sah_bins> right_cost{};
+            node_type acc{{inv, inv, inv}, {-inv, -inv, -inv}};
+            dindex n_right{0u};
+            for (std::size_t b = n_sah_bins - 1u; b > 0u; --b) {
+                for (unsigned int j = 0u; j < 3u; ++j) {
+                    acc.min[j] = std::min(acc.min[j], bins[b].min[j]);
+                    acc.max[j] = std::max(acc.max[j], bins[b].max[j]);
+                }
+                n_right += counts[b];
+                right_cost[b] = n_right == 0u
+                                    ? 0.f
+                                    : static_cast<scalar_t>(n_right) *
+                                          half_area(acc.min, acc.max);
+            }
+
+            // Sweep from the left and evaluate the split after every bin
+            acc = node_type{{inv, inv, inv}, {-inv, -inv, -inv}};
+            dindex n_left{0u};
+            for (std::size_t b = 0u; b < n_sah_bins - 1u; ++b) {
+                for (unsigned int j = 0u; j < 3u; ++j) {
+                    acc.min[j] = std::min(acc.min[j], bins[b].min[j]);
+                    acc.max[j] = std::max(acc.max[j], bins[b].max[j]);
+                }
+                n_left += counts[b];
+                if (n_left == 0u or n_left == n) {
+                    continue;
+                }
+                // Traversal cost of the two children: one box test each
+                const scalar_t cost{
+                    static_cast<scalar_t>(n_left) *
+                        half_area(acc.min, acc.max) +
+                    right_cost[b + 1u] +
+                    2.f * half_area(parent.min, parent.max) /
+                        static_cast<scalar_t>(n)};
+                if (cost < best_cost) {
+                    best_cost = cost;
+                    best_axis = i;
+                    best_bin = b;
+                }
+            }
+        }
+
+        if (best_axis == 3u) {
+            if (not force) {
+                return first;
+            }
+            // All centers coincide or no split is cheaper: split by count
+            return first + n / 2u;
+        }
+
+        // Partition along the best axis
+        const unsigned int i{best_axis};
+        const scalar_t extent{c_max[i] - c_min[i]};
+        const scalar_t scale{static_cast<scalar_t>(n_sah_bins) / extent};
+        return std::partition(first, last, [&](const dindex idx) {
+            const auto b{static_cast<std::size_t>(
+                (center(boxes[idx], i) - c_min[i]) * scale)};
+            return std::min(b, n_sah_bins - 1u) <= best_bin;
+        });
+    }
+
+    /// Offsets for the respective hierarchies into the node storage
+    vector_type<size_type> m_offsets{};
+    /// The nodes of all hierarchies
+    vector_type<node_type> m_nodes{};
+    /// The storage for all surface handles, in the order of the leaves
+    vector_type<value_t> m_surfaces{};
+};
+
+namespace detail {
+
+template <class accelerator_t>
+struct is_bvh<
+    accelerator_t,
+    std::enable_if_t<std::is_same_v<
+        typename accelerator_t::node_type,
+        bvh_node<typename accelerator_t::scalar_type>>,
+                     void>> : public std::true_type {};
+
+}  // namespace detail
+
+}  // namespace detray
@@ -15,11 +15,13 @@
 #include "detray/definitions/detail/indexing.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/utils/ranges.hpp"
+#include "detray/utils/type_traits.hpp"
 
 // VecMem include(s).
 #include <vecmem/memory/memory_resource.hpp>
 
 // System include(s)
+#include <array>
 #include <type_traits>
 
 namespace detray {
@@ -85,6 +87,15 @@ class brute_force_collection {
             -> unsigned int {
             return static_cast<unsigned int>(this->size());
         }
+
+        /// @return the maximum number of surface candidates during a
+        /// neighborhood lookup (independent of the search window)
+        template <typename neighbor_t>
+        DETRAY_HOST_DEVICE constexpr auto n_max_candidates(
+            const std::array<neighbor_t, 2>& /*win_size*/) const
+            -> unsigned int {
+            return n_max_candidates();
+        }
     };
 
     using value_type = brute_forcer;
@@ -215,4 +226,13 @@ class brute_force_collection {
     vector_type<value_t> m_surfaces{};
 };
 
+namespace detail {
+
+/// Identify the brute force surface collection
+template <class value_t, typename container_t>
+struct is_brute_force<brute_force_collection<value_t, container_t>>
+    : public std::true_type {};
+
+}  // namespace detail
+
 }  // namespace detray
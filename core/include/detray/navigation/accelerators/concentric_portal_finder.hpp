@@ -0,0 +1,493 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Detray include(s).
+#include "detray/core/detail/container_buffers.hpp"
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/detail/algorithms.hpp"
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/utils/ranges.hpp"
+#include "detray/utils/ranges/static_join.hpp"
+#include "detray/utils/type_traits.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+namespace detray {
+
+namespace detail {
+
+/// @brief Where the surfaces of a volume are found in a concentric portal
+/// collection.
+///
+/// The surfaces are stored as: other surfaces (always searched), portal
+/// cylinders sorted by radius, portal discs sorted by z.
+struct concentric_layers {
+    /// Start of the other surfaces (start of the volume)
+    dindex begin{0u};
+    /// Start of the portal cylinders
+    dindex cylinders{0u};
+    /// Start of the portal discs
+    dindex discs{0u};
+    /// End of the volume
+    dindex end{0u};
+};
+
+/// How a surface is placed with respect to the beam axis
+enum class concentric_shape : std::uint_least8_t {
+    e_other = 0u,
+    e_cylinder = 1u,
+    e_disc = 2u,
+};
+
+}  // namespace detail
+
+/// @brief A collection of surface finders that index the portals of
+/// cylindrical volumes by their radius and z position, callable by index.
+///
+/// Meant for volumes that are bounded by portal cylinders at fixed radii and
+/// portal discs at fixed z, which are concentric around the beam axis (e.g.
+/// the barrel layers of the toy detector), and whose boundaries can be split
+/// into many portal segments that link to different neighbor volumes.
+///
+/// The portal cylinders are sorted by radius and, for the same radius, by
+/// the lower z bound of their segment. The portal discs are sorted by z and
+/// then by their inner radius. A neighborhood lookup computes where the
+/// straight track crosses the inner and outer radius and the lower and upper
+/// z boundary of the volume and finds the portal segment at every crossing by
+/// binary search. Only these segments, plus one segment on either side, are
+/// returned. All other surfaces (e.g. passives) are always returned.
+///
+/// The volume can have at most two distinct portal radii and z positions
+/// (see @c concentric_portal_builder ).
+///
+/// This class fulfills all criteria to be used in the detector @c multi_store .
+///
+/// @tparam value_t the entry type in the collection (e.g. surface descriptors).
+/// @tparam container_t the types of underlying containers to be used.
+/// @tparam scalar_t the scalar type of the portal positions.
+template <class value_t, typename container_t = host_container_types,
+          typename scalar_t = detray::scalar>
+class concentric_portal_collection {
+
+    public:
+    template <typename T>
+    using vector_type = typename container_t::template vector_type<T>;
+    using size_type = dindex;
+    using scalar_type = scalar_t;
+    using layers_type = detail::concentric_layers;
+
+    /// A nested surface finder that searches the portals of a single volume.
+    /// This type will be returned when the surface collection is queried for
+    /// the surfaces of a particular volume.
+    struct portal_finder {
+
+        using scalar_type = scalar_t;
+        using layers_type = detail::concentric_layers;
+        using range_type = detray::ranges::subrange<const vector_type<value_t>>;
+        using search_type = detray::views::static_join<
+            5u, detray::ranges::const_iterator_t<range_type>>;
+
+        /// Number of portal segments that are returned on either side of
+        /// the segment at the crossing point
+        static constexpr dindex n_neighbors{1u};
+
+        /// Default constructor
+        portal_finder() = default;
+
+        /// Constructor from the @param surfaces , their @param positions
+        /// (radius or z) and the @param lower bounds of their segments (z or
+        /// radius) and the surface @param layers of the volume
+        DETRAY_HOST_DEVICE constexpr portal_finder(
+            const vector_type<value_t> &surfaces,
+            const vector_type<scalar_t> &positions,
+            const vector_type<scalar_t> &lower, const layers_type &layers)
+            : m_surfaces{&surfaces},
+              m_positions{&positions},
+              m_lower{&lower},
+              m_layers{layers} {}
+
+        /// @returns the other surfaces, the portal segments at which the
+        /// straight track crosses the radial boundaries and the portal
+        /// segments at which it crosses the z boundaries of the volume
+        template <typename detector_t, typename track_t, typename config_t>
+        DETRAY_HOST_DEVICE constexpr auto search(
+            const detector_t & /*det*/,
+            const typename detector_t::volume_type & /*volume*/,
+            const track_t &track, const config_t & /*cfg*/) const
+            -> search_type {
+
+            const auto &pos = track.pos();
+            const auto &dir = track.dir();
+
+            const auto x{static_cast<scalar_t>(pos[0])};
+            const auto y{static_cast<scalar_t>(pos[1])};
+            const auto z{static_cast<scalar_t>(pos[2])};
+            const auto dx{static_cast<scalar_t>(dir[0])};
+            const auto dy{static_cast<scalar_t>(dir[1])};
+            const auto dz{static_cast<scalar_t>(dir[2])};
+            const scalar_t r{math::sqrt(x * x + y * y)};
+
+            // Inner and outer radial boundary
+            dindex_range inner{m_layers.cylinders, m_layers.cylinders};
+            dindex_range outer{m_layers.discs, m_layers.discs};
+            if (n_cylinders() > 0u) {
+                const scalar_t r_in{(*m_positions)[m_layers.cylinders]};
+                const scalar_t r_out{(*m_positions)[m_layers.discs - 1u]};
+                const dindex split{
+                    lower_bound(m_layers.cylinders, m_layers.discs, r_out)};
+
+                if (split > m_layers.cylinders) {
+                    const scalar_t s{
+                        radial_crossing(x, y, dx, dy, r_in, true)};
+                    inner = segments(m_layers.cylinders, split,
+                                     s > 0.f ? z + s * dz : z);
+                }
+                const scalar_t s{radial_crossing(x, y, dx, dy, r_out, false)};
+                outer = segments(split, m_layers.discs,
+                                 s > 0.f ? z + s * dz : z);
+            }
+
+            // Lower and upper boundary in z
+            dindex_range lower{m_layers.discs, m_layers.discs};
+            dindex_range upper{m_layers.end, m_layers.end};
+            if (n_discs() > 0u) {
+                const scalar_t z_lo{(*m_positions)[m_layers.discs]};
+                const scalar_t z_hi{(*m_positions)[m_layers.end - 1u]};
+                const dindex split{
+                    lower_bound(m_layers.discs, m_layers.end, z_hi)};
+
+                // Radius at which the straight track reaches a disc
+                auto r_at = [&](const scalar_t z_disc) {
+                    const scalar_t s{dz != 0.f ? (z_disc - z) / dz : -1.f};
+                    if (s <= 0.f) {
+                        return r;
+                    }
+                    const scalar_t xc{x + s * dx};
+                    const scalar_t yc{y + s * dy};
+                    return math::sqrt(xc * xc + yc * yc);
+                };
+
+                if (split > m_layers.discs) {
+                    lower = segments(m_layers.discs, split, r_at(z_lo));
+                }
+                upper = segments(split, m_layers.end, r_at(z_hi));
+            }
+
+            const range_type others{
+                *m_surfaces, dindex_range{m_layers.begin, m_layers.cylinders}};
+            const range_type cyl_inner{*m_surfaces, inner};
+            const range_type cyl_outer{*m_surfaces, outer};
+            const range_type disc_lower{*m_surfaces, lower};
+            const range_type disc_upper{*m_surfaces, upper};
+
+            return search_type{others, cyl_inner, cyl_outer, disc_lower,
+                               disc_upper};
+        }
+
+        /// @returns the number of surfaces in the volume
+        DETRAY_HOST_DEVICE constexpr auto size() const -> dindex {
+            return m_layers.end - m_layers.begin;
+        }
+
+        /// @returns the number of surfaces that are not indexed
+        DETRAY_HOST_DEVICE constexpr auto n_others() const -> dindex {
+            return m_layers.cylinders - m_layers.begin;
+        }
+
+        /// @returns the number of portal cylinders
+        DETRAY_HOST_DEVICE constexpr auto n_cylinders() const -> dindex {
+            return m_layers.discs - m_layers.cylinders;
+        }
+
+        /// @returns the number of portal discs
+        DETRAY_HOST_DEVICE constexpr auto n_discs() const -> dindex {
+            return m_layers.end - m_layers.discs;
+        }
+
+        /// @returns the surface at a given index @param i - const
+        DETRAY_HOST_DEVICE constexpr const value_t &at(const dindex i) const {
+            assert(i < size());
+            return (*m_surfaces)[m_layers.begin + i];
+        }
+
+        /// @returns the radius (portal cylinders) or z position (portal
+        /// discs) of the surface @param i
+        DETRAY_HOST_DEVICE constexpr scalar_t position(const dindex i) const {
+            assert(i < size());
+            return (*m_positions)[m_layers.begin + i];
+        }
+
+        /// @returns an iterator over all surfaces in the data structure
+        DETRAY_HOST_DEVICE constexpr auto all() const -> range_type {
+            return {*m_surfaces, dindex_range{m_layers.begin, m_layers.end}};
+        }
+
+        /// @return the maximum number of surface candidates during a
+        /// neighborhood lookup
+        DETRAY_HOST_DEVICE constexpr auto n_max_candidates() const
+            -> unsigned int {
+            // Two boundaries in r and z, each with a window of segments
+            constexpr dindex n_window{4u * (2u * n_neighbors + 1u)};
+            const dindex n_portals{n_cylinders() + n_discs()};
+
+            return static_cast<unsigned int>(
+                n_others() + (n_portals < n_window ? n_portals : n_window));
+        }
+
+        /// @return the maximum number of surface candidates during a
+        /// neighborhood lookup with the search window @param win_size
+        template <typename neighbor_t>
+        DETRAY_HOST_DEVICE constexpr auto n_max_candidates(
+            const std::array<neighbor_t, 2> & /*win_size*/) const
+            -> unsigned int {
+            return n_max_candidates();
+        }
+
+        private:
+        /// @returns the index of the first position in [@param first,
+        /// @param last) that is not less than @param p
+        DETRAY_HOST_DEVICE constexpr dindex lower_bound(
+            const dindex first, const dindex last, const scalar_t p) const {
+            const auto begin = m_positions->begin();
+            return static_cast<dindex>(
+                detail::lower_bound(begin + first, begin + last, p) - begin);
+        }
+
+        /// @returns the window of segments in [@param first, @param last)
+        /// around the segment that contains @param p
+        DETRAY_HOST_DEVICE constexpr dindex_range segments(
+            const dindex first, const dindex last, const scalar_t p) const {
+            const auto begin = m_lower->begin();
+            const auto ub{static_cast<dindex>(
+                detail::upper_bound(begin + first, begin + last, p) - begin)};
+
+            // Segment that contains the crossing (the first, if none does)
+            const dindex k{ub > first ? ub - 1u : first};
+
+            return {k > first + n_neighbors ? k - n_neighbors : first,
+                    k + n_neighbors + 1u < last ? k + n_neighbors + 1u : last};
+        }
+
+        /// @returns the path length along the straight track (position
+        /// @param x , @param y and direction @param dx , @param dy in the
+        /// transverse plane) to the concentric cylinder of radius
+        /// @param radius , or a negative value if it is not crossed
+        ///
+        /// @param inner whether the cylinder lies inside of the track
+        /// position, in which case the first crossing is returned
+        DETRAY_HOST_DEVICE static constexpr scalar_t radial_crossing(
+            const scalar_t x, const scalar_t y, const scalar_t dx,
+            const scalar_t dy, const scalar_t radius, const bool inner) {
+
+            const scalar_t a{dx * dx + dy * dy};
+            if (a == 0.f) {
+                return -1.f;
+            }
+            const scalar_t b{x * dx + y * dy};
+            const scalar_t c{x * x + y * y - radius * radius};
+            const scalar_t discr{b * b - a * c};
+            if (discr < 0.f) {
+                return -1.f;
+            }
+            const scalar_t sqrt_discr{math::sqrt(discr)};
+
+            return inner ? (-b - sqrt_discr) / a : (-b + sqrt_discr) / a;
+        }
+
+        /// Access to the surface storage of the collection
+        const vector_type<value_t> *m_surfaces{nullptr};
+        /// Access to the portal positions (radius or z) of the collection
+        const vector_type<scalar_t> *m_positions{nullptr};
+        /// Access to the lower segment bounds (z or radius) of the collection
+        const vector_type<scalar_t> *m_lower{nullptr};
+        /// Surface ranges of this volume
+        layers_type m_layers{};
+    };
+
+    using value_type = portal_finder;
+
+    using view_type =
+        dmulti_view<dvector_view<layers_type>, dvector_view<scalar_t>,
+                    dvector_view<scalar_t>, dvector_view<value_t>>;
+    using const_view_type =
+        dmulti_view<dvector_view<const layers_type>,
+                    dvector_view<const scalar_t>,
+                    dvector_view<const scalar_t>, dvector_view<const value_t>>;
+    using buffer_type =
+        dmulti_buffer<dvector_buffer<layers_type>, dvector_buffer<scalar_t>,
+                      dvector_buffer<scalar_t>, dvector_buffer<value_t>>;
+
+    /// Default constructor
+    constexpr concentric_portal_collection() = default;
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit constexpr concentric_portal_collection(
+        vecmem::memory_resource *resource)
+        : m_layers(resource),
+          m_positions(resource),
+          m_lower(resource),
+          m_surfaces(resource) {}
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit constexpr concentric_portal_collection(
+        vecmem::memory_resource &resource)
+        : concentric_portal_collection(&resource) {}
+
+    /// Device-side construction from a vecmem based view type
+    template <typename coll_view_t,
+              typename std::enable_if_t<detail::is_device_view_v<coll_view_t>,
+                                        bool> = true>
+    DETRAY_HOST_DEVICE concentric_portal_collection(coll_view_t &view)
+        : m_layers(detail::get<0>(view.m_view)),
+          m_positions(detail::get<1>(view.m_view)),
+          m_lower(detail::get<2>(view.m_view)),
+          m_surfaces(detail::get<3>(view.m_view)) {}
+
+    /// @returns number of portal finders (one per volume) - const
+    DETRAY_HOST_DEVICE
+    constexpr auto size() const noexcept -> size_type {
+        return static_cast<dindex>(m_layers.size());
+    }
+
+    /// @note outside of navigation, the number of elements is unknown
+    DETRAY_HOST_DEVICE
+    constexpr auto empty() const noexcept -> bool {
+        return size() == size_type{0};
+    }
+
+    /// @return access to the surface container - const.
+    DETRAY_HOST_DEVICE
+    auto all() const -> const vector_type<value_t> & { return m_surfaces; }
+
+    /// Create the portal finder of the volume with index @param i - const
+    DETRAY_HOST_DEVICE
+    auto operator[](const size_type i) const -> value_type {
+        return {m_surfaces, m_positions, m_lower, m_layers[i]};
+    }
+
+    /// Add the @param surfaces of a new volume.
+    ///
+    /// @param shapes whether a surface is a portal cylinder or portal disc
+    ///               that is concentric around the beam axis
+    /// @param positions the radius of a cylinder or the z position of a disc
+    /// @param lower the lower z bound of a cylinder or the inner radius of a
+    ///              disc
+    template <typename sf_container_t,
+              typename std::enable_if_t<detray::ranges::range_v<sf_container_t>,
+                                        bool> = true,
+              typename std::enable_if_t<
+                  std::is_same_v<typename sf_container_t::value_type, value_t>,
+                  bool> = true>
+    DETRAY_HOST auto push_back(
+        const sf_container_t &surfaces,
+        const std::vector<detail::concentric_shape> &shapes,
+        const std::vector<scalar_t> &positions,
+        const std::vector<scalar_t> &lower) noexcept(false) -> void {
+        assert(surfaces.size() == shapes.size());
+        assert(surfaces.size() == positions.size());
+        assert(surfaces.size() == lower.size());
+
+        // Other surfaces first, then cylinders and discs by position and by
+        // the lower bound of the segment
+        std::vector<dindex> indices(surfaces.size());
+        std::iota(indices.begin(), indices.end(), 0u);
+        using shape_t = detail::concentric_shape;
+        std::stable_sort(indices.begin(), indices.end(),
+                         [&](const dindex i, const dindex j) {
+                             if (shapes[i] != shapes[j]) {
+                                 return shapes[i] < shapes[j];
+                             }
+                             if (shapes[i] == shape_t::e_other) {
+                                 return false;
+                             }
+                             if (positions[i] != positions[j]) {
+                                 return positions[i] < positions[j];
+                             }
+                             return lower[i] < lower[j];
+                         });
+
+        const auto begin{static_cast<dindex>(m_surfaces.size())};
+        layers_type layers{begin, begin, begin, begin};
+
+        m_surfaces.reserve(m_surfaces.size() + surfaces.size());
+        m_positions.reserve(m_positions.size() + surfaces.size());
+        m_lower.reserve(m_lower.size() + surfaces.size());
+        for (const dindex i : indices) {
+            m_surfaces.push_back(surfaces[i]);
+            m_positions.push_back(positions[i]);
+            m_lower.push_back(lower[i]);
+
+            const auto n{static_cast<dindex>(m_surfaces.size())};
+            if (shapes[i] == shape_t::e_other) {
+                layers.cylinders = n;
+            }
+            if (shapes[i] != shape_t::e_disc) {
+                layers.discs = n;
+            }
+            layers.end = n;
+        }
+
+        m_layers.push_back(layers);
+    }
+
+    /// @return the view on the portal finders - non-const
+    DETRAY_HOST
+    constexpr auto get_data() noexcept -> view_type {
+        return view_type{
+            detray::get_data(m_layers), detray::get_data(m_positions),
+            detray::get_data(m_lower), detray::get_data(m_surfaces)};
+    }
+
+    /// @return the view on the portal finders - const
+    DETRAY_HOST
+    constexpr auto get_data() const noexcept -> const_view_type {
+        return const_view_type{
+            detray::get_data(m_layers), detray::get_data(m_positions),
+            detray::get_data(m_lower), detray::get_data(m_surfaces)};
+    }
+
+    private:
+    /// Surface ranges of every volume
+    vector_type<layers_type> m_layers{};
+    /// Radius of the portal cylinders, z position of the portal discs
+    vector_type<scalar_t> m_positions{};
+    /// Lower z bound of the cylinder segments, inner radius of the discs
+    vector_type<scalar_t> m_lower{};
+    /// The storage for all surface handles, sorted per volume
+    vector_type<value_t> m_surfaces{};
+};
+
+namespace detail {
+
+/// Identify the concentric portal collection and its surface finders
+template <class accelerator_t>
+struct is_concentric_portals<
+    accelerator_t,
+    std::enable_if_t<std::is_same_v<typename accelerator_t::layers_type,
+                                    concentric_layers>,
+                     void>> : public std::true_type {};
+
+}  // namespace detail
+
+}  // namespace detray
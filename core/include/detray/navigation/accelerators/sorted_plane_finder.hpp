@@ -0,0 +1,408 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Detray include(s).
+#include "detray/core/detail/container_buffers.hpp"
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/detail/algorithms.hpp"
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/utils/ranges.hpp"
+#include "detray/utils/type_traits.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+namespace detray {
+
+namespace detail {
+
+/// @brief Axis along which the planes of a volume are sorted
+template <typename scalar_t>
+struct plane_axis {
+    /// Reference point of the axis (projected position zero)
+    darray<scalar_t, 3> origin{0.f, 0.f, 0.f};
+    /// Unit direction of the axis
+    darray<scalar_t, 3> dir{0.f, 0.f, 1.f};
+
+    /// @returns the position of the point @param p projected onto the axis
+    template <typename point3_t>
+    DETRAY_HOST_DEVICE constexpr scalar_t project(const point3_t &p) const {
+        return (static_cast<scalar_t>(p[0]) - origin[0]) * dir[0] +
+               (static_cast<scalar_t>(p[1]) - origin[1]) * dir[1] +
+               (static_cast<scalar_t>(p[2]) - origin[2]) * dir[2];
+    }
+
+    /// @returns the component of the vector @param v along the axis
+    template <typename vector3_t>
+    DETRAY_HOST_DEVICE constexpr scalar_t component(const vector3_t &v) const {
+        return static_cast<scalar_t>(v[0]) * dir[0] +
+               static_cast<scalar_t>(v[1]) * dir[1] +
+               static_cast<scalar_t>(v[2]) * dir[2];
+    }
+};
+
+}  // namespace detail
+
+/// @brief A collection of surface finders that keep the planes of a volume
+/// sorted along an axis, callable by index.
+///
+/// Meant for telescope-like volumes, in which a long row of (roughly)
+/// parallel planes is crossed one after the other. The planes are sorted by
+/// the position of their centers projected onto the axis of the volume. A
+/// neighborhood lookup finds the position of the track on the axis by binary
+/// search and only returns the next planes in the direction of travel (the
+/// first entry of the search window, plus one), together with the plane
+/// directly behind the track (overstepping and on-surface tolerance).
+///
+/// Because the search is incomplete, the navigator asks for the search
+/// horizon, i.e. the path to the last plane of the window: portals that lie
+/// beyond it are not targeted and the volume is re-initialized once the track
+/// has passed the window.
+///
+/// This class fulfills all criteria to be used in the detector @c multi_store .
+///
+/// @tparam value_t the entry type in the collection (e.g. surface descriptors).
+/// @tparam container_t the types of underlying containers to be used.
+/// @tparam scalar_t the scalar type of the projected positions.
+template <class value_t, typename container_t = host_container_types,
+          typename scalar_t = detray::scalar>
+class sorted_plane_collection {
+
+    public:
+    template <typename T>
+    using vector_type = typename container_t::template vector_type<T>;
+    using size_type = dindex;
+    using scalar_type = scalar_t;
+    using axis_type = detail::plane_axis<scalar_t>;
+
+    /// A nested surface finder that searches the sorted planes of a single
+    /// volume. This type will be returned when the surface collection is
+    /// queried for the surfaces of a particular volume.
+    struct plane_finder {
+
+        using scalar_type = scalar_t;
+        using axis_type = detail::plane_axis<scalar_t>;
+        using range_type = detray::ranges::subrange<const vector_type<value_t>>;
+
+        /// Default constructor
+        plane_finder() = default;
+
+        /// Constructor from the @param surfaces and their projected
+        /// @param positions , the @param axis and the surface range
+        /// @param range of the volume
+        DETRAY_HOST_DEVICE constexpr plane_finder(
+            const vector_type<value_t> &surfaces,
+            const vector_type<scalar_t> &positions, const axis_type &axis,
+            const dindex_range &range)
+            : m_surfaces{&surfaces},
+              m_positions{&positions},
+              m_axis{axis},
+              m_range{range} {}
+
+        /// @returns the plane directly behind the track and the next planes
+        /// in the direction of travel
+        template <typename detector_t, typename track_t, typename config_t>
+        DETRAY_HOST_DEVICE constexpr auto search(
+            const detector_t & /*det*/,
+            const typename detector_t::volume_type & /*volume*/,
+            const track_t &track, const config_t &cfg) const -> range_type {
+
+            const auto [first, last] = window(track, cfg);
+            const dindex offset{detail::get<0>(m_range)};
+
+            return {*m_surfaces, dindex_range{offset + first, offset + last}};
+        }
+
+        /// @returns the path along the (straight) track direction to the
+        /// last plane of the search window, or the maximal scalar value if
+        /// the window covers all planes in the direction of travel
+        template <typename track_t, typename config_t>
+        DETRAY_HOST_DEVICE constexpr auto horizon(const track_t &track,
+                                                  const config_t &cfg) const
+            -> scalar_t {
+
+            constexpr scalar_t inf{std::numeric_limits<scalar_t>::max()};
+
+            const scalar_t cos_dir{m_axis.component(track.dir())};
+            if (cos_dir == 0.f) {
+                return inf;
+            }
+
+            const auto [first, last] = window(track, cfg);
+            const dindex offset{detail::get<0>(m_range)};
+
+            if (cos_dir > 0.f) {
+                if (last == size()) {
+                    return inf;
+                }
+                return ((*m_positions)[offset + last - 1u] -
+                        m_axis.project(track.pos())) /
+                       cos_dir;
+            }
+            if (first == 0u) {
+                return inf;
+            }
+            return ((*m_positions)[offset + first] -
+                    m_axis.project(track.pos())) /
+                   cos_dir;
+        }
+
+        /// @returns the number of planes in the volume
+        DETRAY_HOST_DEVICE constexpr auto size() const -> dindex {
+            return detail::get<1>(m_range) - detail::get<0>(m_range);
+        }
+
+        /// @returns the surface at a given index @param i - const
+        DETRAY_HOST_DEVICE constexpr const value_t &at(const dindex i) const {
+            assert(i < size());
+            return (*m_surfaces)[detail::get<0>(m_range) + i];
+        }
+
+        /// @returns the projected position of the plane @param i on the axis
+        DETRAY_HOST_DEVICE constexpr scalar_t position(const dindex i) const {
+            assert(i < size());
+            return (*m_positions)[detail::get<0>(m_range) + i];
+        }
+
+        /// @returns the axis along which the planes are sorted
+        DETRAY_HOST_DEVICE constexpr const axis_type &axis() const {
+            return m_axis;
+        }
+
+        /// @returns an iterator over all surfaces in the data structure
+        DETRAY_HOST_DEVICE constexpr auto all() const -> range_type {
+            return {*m_surfaces, m_range};
+        }
+
+        /// @return the maximum number of surface candidates during a
+        /// neighborhood lookup
+        DETRAY_HOST_DEVICE constexpr auto n_max_candidates() const
+            -> unsigned int {
+            return static_cast<unsigned int>(size());
+        }
+
+        /// @return the maximum number of surface candidates during a
+        /// neighborhood lookup with the search window @param win_size
+        template <typename neighbor_t>
+        DETRAY_HOST_DEVICE constexpr auto n_max_candidates(
+            const std::array<neighbor_t, 2> &win_size) const -> unsigned int {
+            const auto n{static_cast<unsigned int>(win_size[0]) + 2u};
+            return n < size() ? n : static_cast<unsigned int>(size());
+        }
+
+        private:
+        /// @returns the local index range [first, last) of the planes in the
+        /// search window of the track
+        template <typename track_t, typename config_t>
+        DETRAY_HOST_DEVICE constexpr auto window(const track_t &track,
+                                                 const config_t &cfg) const
+            -> darray<dindex, 2> {
+
+            const dindex n{size()};
+            if (n == 0u) {
+                return {0u, 0u};
+            }
+
+            const dindex offset{detail::get<0>(m_range)};
+            const auto pos_begin = m_positions->begin() + offset;
+            const auto pos_end = pos_begin + n;
+
+            // Index of the first plane in front of the track on the axis
+            const scalar_t s{m_axis.project(track.pos())};
+            const auto ahead{static_cast<dindex>(
+                detail::upper_bound(pos_begin, pos_end, s) - pos_begin)};
+
+            // Number of planes to be returned in the direction of travel
+            const dindex n_next{static_cast<dindex>(cfg.search_window[0]) + 1u};
+
+            if (m_axis.component(track.dir()) >= 0.f) {
+                const dindex first{ahead > 0u ? ahead - 1u : 0u};
+                const dindex last{n - ahead > n_next ? ahead + n_next : n};
+                return {first, last};
+            }
+            const dindex first{ahead > n_next ? ahead - n_next : 0u};
+            const dindex last{ahead < n ? ahead + 1u : n};
+            return {first, last};
+        }
+
+        /// Access to the surface storage of the collection
+        const vector_type<value_t> *m_surfaces{nullptr};
+        /// Access to the projected plane positions of the collection
+        const vector_type<scalar_t> *m_positions{nullptr};
+        /// Axis of the volume
+        axis_type m_axis{};
+        /// Range of the planes of this volume
+        dindex_range m_range{0u, 0u};
+    };
+
+    using value_type = plane_finder;
+
+    using view_type =
+        dmulti_view<dvector_view<size_type>, dvector_view<axis_type>,
+                    dvector_view<scalar_t>, dvector_view<value_t>>;
+    using const_view_type =
+        dmulti_view<dvector_view<const size_type>,
+                    dvector_view<const axis_type>,
+                    dvector_view<const scalar_t>, dvector_view<const value_t>>;
+    using buffer_type =
+        dmulti_buffer<dvector_buffer<size_type>, dvector_buffer<axis_type>,
+                      dvector_buffer<scalar_t>, dvector_buffer<value_t>>;
+
+    /// Default constructor
+    constexpr sorted_plane_collection() {
+        // Start of first subrange
+        m_offsets.push_back(0u);
+    };
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit constexpr sorted_plane_collection(
+        vecmem::memory_resource *resource)
+        : m_offsets(resource),
+          m_axes(resource),
+          m_positions(resource),
+          m_surfaces(resource) {
+        // Start of first subrange
+        m_offsets.push_back(0u);
+    }
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit constexpr sorted_plane_collection(
+        vecmem::memory_resource &resource)
+        : sorted_plane_collection(&resource) {}
+
+    /// Device-side construction from a vecmem based view type
+    template <typename coll_view_t,
+              typename std::enable_if_t<detail::is_device_view_v<coll_view_t>,
+                                        bool> = true>
+    DETRAY_HOST_DEVICE sorted_plane_collection(coll_view_t &view)
+        : m_offsets(detail::get<0>(view.m_view)),
+          m_axes(detail::get<1>(view.m_view)),
+          m_positions(detail::get<2>(view.m_view)),
+          m_surfaces(detail::get<3>(view.m_view)) {}
+
+    /// @returns access to the volume offsets - const
+    DETRAY_HOST const auto &offsets() const { return m_offsets; }
+
+    /// @returns number of plane collections (one per volume) - const
+    DETRAY_HOST_DEVICE
+    constexpr auto size() const noexcept -> size_type {
+        // The start index of the first range is always present
+        return static_cast<dindex>(m_offsets.size()) - 1u;
+    }
+
+    /// @note outside of navigation, the number of elements is unknown
+    DETRAY_HOST_DEVICE
+    constexpr auto empty() const noexcept -> bool {
+        return size() == size_type{0};
+    }
+
+    /// @return access to the surface container - const.
+    DETRAY_HOST_DEVICE
+    auto all() const -> const vector_type<value_t> & { return m_surfaces; }
+
+    /// Create the plane finder of the volume with index @param i - const
+    DETRAY_HOST_DEVICE
+    auto operator[](const size_type i) const -> value_type {
+        return {m_surfaces, m_positions, m_axes[i],
+                dindex_range{m_offsets[i], m_offsets[i + 1u]}};
+    }
+
+    /// Add the @param surfaces of a new volume, which are placed at the
+    /// global @param centers , sorted along the @param axis
+    template <typename sf_container_t, typename point3_t,
+              typename std::enable_if_t<detray::ranges::range_v<sf_container_t>,
+                                        bool> = true,
+              typename std::enable_if_t<
+                  std::is_same_v<typename sf_container_t::value_type, value_t>,
+                  bool> = true>
+    DETRAY_HOST auto push_back(const sf_container_t &surfaces,
+                               const std::vector<point3_t> &centers,
+                               const axis_type &axis) noexcept(false)
+        -> void {
+        assert(surfaces.size() == centers.size());
+
+        std::vector<scalar_t> positions;
+        positions.reserve(centers.size());
+        for (const auto &c : centers) {
+            positions.push_back(axis.project(c));
+        }
+
+        std::vector<dindex> indices(surfaces.size());
+        std::iota(indices.begin(), indices.end(), 0u);
+        std::stable_sort(indices.begin(), indices.end(),
+                         [&positions](const dindex i, const dindex j) {
+                             return positions[i] < positions[j];
+                         });
+
+        m_surfaces.reserve(m_surfaces.size() + surfaces.size());
+        m_positions.reserve(m_positions.size() + surfaces.size());
+        for (const dindex i : indices) {
+            m_surfaces.push_back(surfaces[i]);
+            m_positions.push_back(positions[i]);
+        }
+        m_axes.push_back(axis);
+
+        // End of this range is the start of the next range
+        m_offsets.push_back(static_cast<dindex>(m_surfaces.size()));
+    }
+
+    /// @return the view on the plane finders - non-const
+    DETRAY_HOST
+    constexpr auto get_data() noexcept -> view_type {
+        return view_type{
+            detray::get_data(m_offsets), detray::get_data(m_axes),
+            detray::get_data(m_positions), detray::get_data(m_surfaces)};
+    }
+
+    /// @return the view on the plane finders - const
+    DETRAY_HOST
+    constexpr auto get_data() const noexcept -> const_view_type {
+        return const_view_type{
+            detray::get_data(m_offsets), detray::get_data(m_axes),
+            detray::get_data(m_positions), detray::get_data(m_surfaces)};
+    }
+
+    private:
+    /// Offsets for the respective volumes into the surface storage
+    vector_type<size_type> m_offsets{};
+    /// The axis of every volume
+    vector_type<axis_type> m_axes{};
+    /// Projected positions of the planes, sorted per volume
+    vector_type<scalar_t> m_positions{};
+    /// The storage for all surface handles, sorted per volume
+    vector_type<value_t> m_surfaces{};
+};
+
+namespace detail {
+
+/// Identify the sorted plane collection and its surface finders
+template <class accelerator_t>
+struct is_sorted_planes<
+    accelerator_t,
+    std::enable_if_t<
+        std::is_same_v<typename accelerator_t::axis_type,
+                       plane_axis<typename accelerator_t::scalar_type>>,
+        void>> : public std::true_type {};
+
+}  // namespace detail
+
+}  // namespace detray
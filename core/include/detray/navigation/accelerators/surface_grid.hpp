@@ -8,6 +8,8 @@
 #pragma once
 
 // Project include(s)
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/geometry/detail/surface_descriptor.hpp"
 #include "detray/utils/grid/detail/axis_helpers.hpp"
 #include "detray/utils/grid/detail/grid_bins.hpp"
@@ -15,6 +17,66 @@
 #include "detray/utils/grid/grid_collection.hpp"
 #include "detray/utils/type_traits.hpp"
 
+// System include(s)
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace detray {
+
+/// @brief Compressed surface grid entry.
+///
+/// Instead of a full surface descriptor, only the index of the surface in the
+/// detector surface lookup (@c detector::surfaces()) is stored in the grid
+/// bins. The descriptor is fetched from the detector when the surface is
+/// visited (see @c detail::surface_getter).
+///
+/// Can be constructed from a surface descriptor, so that the grid builders and
+/// bin fillers can fill it the same way as a grid of descriptors.
+class surface_index_entry {
+
+    public:
+    using index_type = std::uint32_t;
+
+    /// Default constructor: invalid entry
+    constexpr surface_index_entry() = default;
+
+    /// Construct from the global index @param idx of the surface
+    DETRAY_HOST_DEVICE
+    explicit constexpr surface_index_entry(const dindex idx)
+        : m_index{static_cast<index_type>(idx)} {}
+
+    /// Construct from a surface descriptor @param sf_desc
+    template <typename surface_t,
+              std::enable_if_t<detail::is_surface_descriptor_v<surface_t>,
+                               bool> = true>
+    DETRAY_HOST_DEVICE constexpr surface_index_entry(const surface_t &sf_desc)
+        : m_index{static_cast<index_type>(sf_desc.index())} {}
+
+    /// @returns the index of the surface in the detector surface lookup
+    DETRAY_HOST_DEVICE
+    constexpr auto index() const -> dindex {
+        return static_cast<dindex>(m_index);
+    }
+
+    /// Equality operator
+    DETRAY_HOST_DEVICE
+    constexpr bool operator==(const surface_index_entry &rhs) const {
+        return m_index == rhs.m_index;
+    }
+
+    /// Inequality operator
+    DETRAY_HOST_DEVICE
+    constexpr bool operator!=(const surface_index_entry &rhs) const {
+        return m_index != rhs.m_index;
+    }
+
+    private:
+    index_type m_index{std::numeric_limits<index_type>::max()};
+};
+
+}  // namespace detray
+
 namespace detray::detail {
 
 // TODO: Define concepts
@@ -24,13 +86,13 @@ struct is_surface_grid<
     accelerator_t,
     std::enable_if_t<
         is_grid_v<accelerator_t> &&
-            std::is_same_v<
-                typename accelerator_t::value_type,
-                surface_descriptor<
-                    typename accelerator_t::value_type::mask_link,
-                    typename accelerator_t::value_type::material_link,
-                    typename accelerator_t::value_type::transform_link,
-                    typename accelerator_t::value_type::navigation_link>>,
+            is_surface_descriptor_v<typename accelerator_t::value_type>,
         void>> : public std::true_type {};
 
+/// Surface grids that hold compressed entries
+template <typename accelerator_t>
+inline constexpr bool is_surface_index_grid_v =
+    is_grid_v<accelerator_t> &&
+    std::is_same_v<typename accelerator_t::value_type, surface_index_entry>;
+
 }  // namespace detray::detail
@@ -0,0 +1,325 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Detray include(s).
+#include "detray/core/detail/container_buffers.hpp"
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/utils/invalid_values.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+namespace detray {
+
+namespace detail {
+
+/// @brief Extent of a cylindrical volume in r and z
+template <typename scalar_t>
+struct volume_rz_box {
+    scalar_t r_min{0.f};
+    scalar_t r_max{0.f};
+    scalar_t z_min{0.f};
+    scalar_t z_max{0.f};
+    dindex volume{detail::invalid_value<dindex>()};
+
+    /// @returns true if the point (@param r, @param z) lies in the box
+    DETRAY_HOST_DEVICE
+    constexpr bool contains(const scalar_t r, const scalar_t z) const {
+        return (r_min <= r and r <= r_max and z_min <= z and z <= z_max);
+    }
+};
+
+/// @brief Cell of the coarse grid of the two-level volume finder
+///
+/// If the cell does not hold any entries, the value is the index of the
+/// volume that covers the entire cell (or invalid, if no volume touches the
+/// cell). Otherwise, it is the offset of the cells entries in the list of
+/// volume boxes.
+struct volume_finder_cell {
+    dindex value{detail::invalid_value<dindex>()};
+    dindex n_entries{0u};
+};
+
+/// @brief Binning of the coarse grid of the two-level volume finder
+template <typename scalar_t>
+struct volume_finder_axes {
+    scalar_t r_min{0.f};
+    scalar_t z_min{0.f};
+    scalar_t r_max{0.f};
+    scalar_t z_max{0.f};
+    /// Inverse bin widths
+    scalar_t inv_dr{0.f};
+    scalar_t inv_dz{0.f};
+    dindex n_bins_r{0u};
+    dindex n_bins_z{0u};
+};
+
+}  // namespace detail
+
+/// @brief Finds the volume that contains a given global position
+///
+/// The volumes are described by their extent in r and z (full azimuth). A
+/// coarse regular r-z grid is laid over the detector: Every cell that lies
+/// entirely inside a single volume stores the index of that volume directly.
+/// The remaining cells point to a short list of the volume boxes that overlap
+/// them, which is sorted in z and scanned linearly. A lookup therefore costs
+/// two multiplications and, only close to a volume boundary, a few box tests,
+/// instead of a binary search on every irregular grid axis.
+///
+/// @tparam container_t the types of underlying containers to be used.
+/// @tparam scalar_t the scalar type of the volume boundaries.
+template <typename container_t = host_container_types,
+          typename scalar_t = detray::scalar>
+class two_level_volume_finder {
+
+    public:
+    template <typename T>
+    using vector_type = typename container_t::template vector_type<T>;
+    using size_type = dindex;
+    using scalar_type = scalar_t;
+    using box_type = detail::volume_rz_box<scalar_t>;
+    using cell_type = detail::volume_finder_cell;
+    using axes_type = detail::volume_finder_axes<scalar_t>;
+
+    using view_type =
+        dmulti_view<dvector_view<axes_type>, dvector_view<cell_type>,
+                    dvector_view<box_type>>;
+    using const_view_type = dmulti_view<dvector_view<const axes_type>,
+                                        dvector_view<const cell_type>,
+                                        dvector_view<const box_type>>;
+    using buffer_type =
+        dmulti_buffer<dvector_buffer<axes_type>, dvector_buffer<cell_type>,
+                      dvector_buffer<box_type>>;
+
+    /// Default constructor
+    constexpr two_level_volume_finder() = default;
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit constexpr two_level_volume_finder(
+        vecmem::memory_resource *resource)
+        : m_axes(resource), m_cells(resource), m_boxes(resource) {}
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit constexpr two_level_volume_finder(
+        vecmem::memory_resource &resource)
+        : two_level_volume_finder(&resource) {}
+
+    /// Device-side construction from a vecmem based view type
+    template <typename finder_view_t,
+              typename std::enable_if_t<
+                  detail::is_device_view_v<finder_view_t>, bool> = true>
+    DETRAY_HOST_DEVICE two_level_volume_finder(finder_view_t &view)
+        : m_axes(detail::get<0>(view.m_view)),
+          m_cells(detail::get<1>(view.m_view)),
+          m_boxes(detail::get<2>(view.m_view)) {}
+
+    /// @returns true if the finder was not built yet
+    DETRAY_HOST_DEVICE
+    constexpr auto empty() const noexcept -> bool { return m_cells.empty(); }
+
+    /// @returns the binning of the coarse grid - const
+    DETRAY_HOST_DEVICE
+    constexpr auto axes() const -> const axes_type & { return m_axes[0]; }
+
+    /// @returns access to the cells of the coarse grid - const
+    DETRAY_HOST_DEVICE
+    auto cells() const -> const vector_type<cell_type> & { return m_cells; }
+
+    /// @returns access to the volume boxes of all cells - const
+    DETRAY_HOST_DEVICE
+    auto boxes() const -> const vector_type<box_type> & { return m_boxes; }
+
+    /// @returns the index of the volume that contains the global position
+    /// @param glob_pos , or an invalid index if there is none
+    template <typename point3_t>
+    DETRAY_HOST_DEVICE auto search(const point3_t &glob_pos) const -> dindex {
+        const scalar_t x{static_cast<scalar_t>(glob_pos[0])};
+        const scalar_t y{static_cast<scalar_t>(glob_pos[1])};
+        return search(math::sqrt(x * x + y * y),
+                      static_cast<scalar_t>(glob_pos[2]));
+    }
+
+    /// @returns the index of the volume that contains the point ( @param r ,
+    /// @param z ), or an invalid index if there is none
+    DETRAY_HOST_DEVICE auto search(const scalar_t r, const scalar_t z) const
+        -> dindex {
+        constexpr dindex inv_idx{detail::invalid_value<dindex>()};
+
+        if (empty()) {
+            return inv_idx;
+        }
+
+        // First level: coarse grid cell
+        const axes_type &ax = m_axes[0];
+        if (r < ax.r_min or r > ax.r_max or z < ax.z_min or z > ax.z_max) {
+            return inv_idx;
+        }
+        // The upper boundaries belong to the last bin
+        auto bin_r{static_cast<dindex>((r - ax.r_min) * ax.inv_dr)};
+        auto bin_z{static_cast<dindex>((z - ax.z_min) * ax.inv_dz)};
+        bin_r = bin_r < ax.n_bins_r ? bin_r : ax.n_bins_r - 1u;
+        bin_z = bin_z < ax.n_bins_z ? bin_z : ax.n_bins_z - 1u;
+
+        const cell_type &cell = m_cells[bin_z * ax.n_bins_r + bin_r];
+
+        if (cell.n_entries == 0u) {
+            return cell.value;
+        }
+
+        // Second level: Boxes that overlap the cell
+        for (dindex i = cell.value; i < cell.value + cell.n_entries; ++i) {
+            if (m_boxes[i].contains(r, z)) {
+                return m_boxes[i].volume;
+            }
+        }
+
+        return inv_idx;
+    }
+
+    /// Build the lookup from the r-z extents @param boxes of the volumes
+    ///
+    /// @param n_bins_r number of cells of the coarse grid in r. If zero, it
+    ///                 is chosen as twice the number of distinct volume
+    ///                 boundaries in r.
+    /// @param n_bins_z number of cells of the coarse grid in z (see above)
+    DETRAY_HOST void build(const std::vector<box_type> &boxes,
+                           dindex n_bins_r = 0u,
+                           dindex n_bins_z = 0u) noexcept(false) {
+
+        m_axes.clear();
+        m_cells.clear();
+        m_boxes.clear();
+
+        if (boxes.empty()) {
+            return;
+        }
+
+        // Extent of the coarse grid and distinct volume boundaries
+        std::vector<scalar_t> r_edges{};
+        std::vector<scalar_t> z_edges{};
+        axes_type ax{boxes[0].r_min, boxes[0].z_min, boxes[0].r_max,
+                     boxes[0].z_max};
+        for (const box_type &box : boxes) {
+            ax.r_min = std::min(ax.r_min, box.r_min);
+            ax.r_max = std::max(ax.r_max, box.r_max);
+            ax.z_min = std::min(ax.z_min, box.z_min);
+            ax.z_max = std::max(ax.z_max, box.z_max);
+            r_edges.insert(r_edges.end(), {box.r_min, box.r_max});
+            z_edges.insert(z_edges.end(), {box.z_min, box.z_max});
+        }
+        auto n_distinct = [](std::vector<scalar_t> &edges) {
+            std::sort(edges.begin(), edges.end());
+            return static_cast<dindex>(
+                std::unique(edges.begin(), edges.end()) - edges.begin());
+        };
+        ax.n_bins_r = n_bins_r == 0u ? 2u * n_distinct(r_edges) : n_bins_r;
+        ax.n_bins_z = n_bins_z == 0u ? 2u * n_distinct(z_edges) : n_bins_z;
+
+        const scalar_t dr{(ax.r_max - ax.r_min) /
+                          static_cast<scalar_t>(ax.n_bins_r)};
+        const scalar_t dz{(ax.z_max - ax.z_min) /
+                          static_cast<scalar_t>(ax.n_bins_z)};
+        ax.inv_dr = dr > 0.f ? 1.f / dr : 0.f;
+        ax.inv_dz = dz > 0.f ? 1.f / dz : 0.f;
+
+        // Fill the cells
+        m_cells.reserve(ax.n_bins_r * ax.n_bins_z);
+        std::vector<box_type> overlaps{};
+        for (dindex iz = 0u; iz < ax.n_bins_z; ++iz) {
+            const scalar_t z_lo{ax.z_min + static_cast<scalar_t>(iz) * dz};
+            const scalar_t z_hi{z_lo + dz};
+
+            for (dindex ir = 0u; ir < ax.n_bins_r; ++ir) {
+                const scalar_t r_lo{ax.r_min + static_cast<scalar_t>(ir) * dr};
+                const scalar_t r_hi{r_lo + dr};
+
+                overlaps.clear();
+                for (const box_type &box : boxes) {
+                    if (box.r_min <= r_hi and box.r_max >= r_lo and
+                        box.z_min <= z_hi and box.z_max >= z_lo) {
+                        overlaps.push_back(box);
+                    }
+                }
+
+                cell_type cell{};
+                if (overlaps.size() == 1u and overlaps[0].r_min <= r_lo and
+                    overlaps[0].r_max >= r_hi and overlaps[0].z_min <= z_lo and
+                    overlaps[0].z_max >= z_hi) {
+                    // The cell lies entirely in one volume
+                    cell.value = overlaps[0].volume;
+                } else if (not overlaps.empty()) {
+                    std::sort(overlaps.begin(), overlaps.end(),
+                              [](const box_type &a, const box_type &b) {
+                                  return a.z_min < b.z_min or
+                                         (a.z_min == b.z_min and
+                                          a.r_min < b.r_min);
+                              });
+                    cell.value = static_cast<dindex>(m_boxes.size());
+                    cell.n_entries = static_cast<dindex>(overlaps.size());
+                    m_boxes.insert(m_boxes.end(), overlaps.begin(),
+                                   overlaps.end());
+                }
+                m_cells.push_back(cell);
+            }
+        }
+
+        m_axes.push_back(ax);
+    }
+
+    /// @return the view on the volume finder - non-const
+    DETRAY_HOST
+    constexpr auto get_data() noexcept -> view_type {
+        return view_type{detray::get_data(m_axes), detray::get_data(m_cells),
+                         detray::get_data(m_boxes)};
+    }
+
+    /// @return the view on the volume finder - const
+    DETRAY_HOST
+    constexpr auto get_data() const noexcept -> const_view_type {
+        return const_view_type{detray::get_data(m_axes),
+                               detray::get_data(m_cells),
+                               detray::get_data(m_boxes)};
+    }
+
+    private:
+    /// Binning of the coarse grid (a single entry)
+    vector_type<axes_type> m_axes{};
+    /// Cells of the coarse grid
+    vector_type<cell_type> m_cells{};
+    /// Volume boxes that overlap a cell, sorted in z per cell
+    vector_type<box_type> m_boxes{};
+};
+
+namespace detail {
+
+template <typename T>
+struct is_two_level_volume_finder : public std::false_type {};
+
+template <typename container_t, typename scalar_t>
+struct is_two_level_volume_finder<
+    two_level_volume_finder<container_t, scalar_t>> : public std::true_type {};
+
+template <typename T>
+inline constexpr bool is_two_level_volume_finder_v =
+    is_two_level_volume_finder<T>::value;
+
+}  // namespace detail
+
+}  // namespace detray
@@ -0,0 +1,499 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Detray include(s).
+#include "detray/core/detail/container_buffers.hpp"
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/detail/algorithms.hpp"
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/utils/ranges.hpp"
+#include "detray/utils/ranges/static_join.hpp"
+#include "detray/utils/type_traits.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+namespace detray {
+
+namespace detail {
+
+/// @brief Parameters of a layer of wires around the beam axis
+template <typename scalar_t>
+struct wire_layer {
+    /// Inner radius of the band in which the wires can be hit
+    scalar_t r_min{0.f};
+    /// Outer radius of the band in which the wires can be hit
+    scalar_t r_max{0.f};
+    /// Smallest and largest change of the wire phi with z (stereo angle)
+    scalar_t slope_min{0.f};
+    scalar_t slope_max{0.f};
+};
+
+}  // namespace detail
+
+/// @brief A collection of surface finders that index the wires of straw tube
+/// or drift chamber layers by their azimuthal angle, callable by index.
+///
+/// Meant for volumes that contain a single layer of (roughly) equally spaced
+/// wires around the beam axis, possibly inclined by a stereo angle, like the
+/// layers of the wire chamber. The wires are sorted by the azimuthal angle at
+/// which they cross the plane z = 0. For a wire at the radius r, that is
+/// rotated by the stereo angle a, this angle changes along the wire by
+/// tan(a) / r per unit of z.
+///
+/// A neighborhood lookup computes, where the straight track leaves the radial
+/// band of the layer and which range of azimuthal angles it sweeps on the way
+/// there. Corrected by the stereo shift at the z positions of the track, this
+/// gives the range of wires that can be crossed, which is found by binary
+/// search. Only these wires, plus the first entry of the search window (at
+/// least one) on either side, are returned. The range may wrap around at
+/// +-pi and is then returned in two parts.
+///
+/// This class fulfills all criteria to be used in the detector @c multi_store .
+///
+/// @tparam value_t the entry type in the collection (e.g. surface descriptors).
+/// @tparam container_t the types of underlying containers to be used.
+/// @tparam scalar_t the scalar type of the wire positions.
+template <class value_t, typename container_t = host_container_types,
+          typename scalar_t = detray::scalar>
+class wire_layer_collection {
+
+    public:
+    template <typename T>
+    using vector_type = typename container_t::template vector_type<T>;
+    using size_type = dindex;
+    using scalar_type = scalar_t;
+    using layer_type = detail::wire_layer<scalar_t>;
+
+    /// A nested surface finder that searches the wires of a single volume.
+    /// This type will be returned when the surface collection is queried for
+    /// the surfaces of a particular volume.
+    struct wire_finder {
+
+        using scalar_type = scalar_t;
+        using layer_type = detail::wire_layer<scalar_t>;
+        using range_type = detray::ranges::subrange<const vector_type<value_t>>;
+        using search_type = detray::views::static_join<
+            2u, detray::ranges::const_iterator_t<range_type>>;
+
+        /// Minimal number of wires that are returned on either side of the
+        /// crossed range
+        static constexpr dindex n_neighbors{1u};
+
+        /// Default constructor
+        wire_finder() = default;
+
+        /// Constructor from the @param surfaces , their azimuthal angles
+        /// @param phis , the @param layer parameters and the surface
+        /// @param range of the volume
+        DETRAY_HOST_DEVICE constexpr wire_finder(
+            const vector_type<value_t> &surfaces,
+            const vector_type<scalar_t> &phis, const layer_type &layer,
+            const dindex_range &range)
+            : m_surfaces{&surfaces},
+              m_phis{&phis},
+              m_layer{layer},
+              m_range{range} {}
+
+        /// @returns the wires that the straight track can cross in the layer
+        template <typename detector_t, typename track_t, typename config_t>
+        DETRAY_HOST_DEVICE constexpr auto search(
+            const detector_t & /*det*/,
+            const typename detector_t::volume_type & /*volume*/,
+            const track_t &track, const config_t &cfg) const -> search_type {
+
+            const auto [first, count] = window(track, cfg);
+            const dindex n{size()};
+            const dindex offset{detail::get<0>(m_range)};
+
+            // Split the range, if it wraps around at +-pi
+            const dindex end{first + count};
+            const range_type lower{
+                *m_surfaces,
+                dindex_range{offset + first, offset + (end < n ? end : n)}};
+            const range_type upper{
+                *m_surfaces,
+                dindex_range{offset, offset + (end > n ? end - n : 0u)}};
+
+            return search_type{lower, upper};
+        }
+
+        /// @returns the number of wires in the volume
+        DETRAY_HOST_DEVICE constexpr auto size() const -> dindex {
+            return detail::get<1>(m_range) - detail::get<0>(m_range);
+        }
+
+        /// @returns the surface at a given index @param i - const
+        DETRAY_HOST_DEVICE constexpr const value_t &at(const dindex i) const {
+            assert(i < size());
+            return (*m_surfaces)[detail::get<0>(m_range) + i];
+        }
+
+        /// @returns the azimuthal angle of the wire @param i at z = 0
+        DETRAY_HOST_DEVICE constexpr scalar_t phi(const dindex i) const {
+            assert(i < size());
+            return (*m_phis)[detail::get<0>(m_range) + i];
+        }
+
+        /// @returns the layer parameters
+        DETRAY_HOST_DEVICE constexpr const layer_type &layer() const {
+            return m_layer;
+        }
+
+        /// @returns an iterator over all surfaces in the data structure
+        DETRAY_HOST_DEVICE constexpr auto all() const -> range_type {
+            return {*m_surfaces, m_range};
+        }
+
+        /// @return the maximum number of surface candidates during a
+        /// neighborhood lookup
+        DETRAY_HOST_DEVICE constexpr auto n_max_candidates() const
+            -> unsigned int {
+            return static_cast<unsigned int>(size());
+        }
+
+        /// @return the maximum number of surface candidates during a
+        /// neighborhood lookup with the search window @param win_size
+        ///
+        /// @note the number of wires a track crosses depends on its
+        /// inclination, so the bound does not depend on the window
+        template <typename neighbor_t>
+        DETRAY_HOST_DEVICE constexpr auto n_max_candidates(
+            const std::array<neighbor_t, 2> & /*win_size*/) const
+            -> unsigned int {
+            return n_max_candidates();
+        }
+
+        private:
+        /// @returns the local index of the first wire in the search window
+        /// of the track and the number of wires in the window
+        template <typename track_t, typename config_t>
+        DETRAY_HOST_DEVICE constexpr auto window(const track_t &track,
+                                                 const config_t &cfg) const
+            -> darray<dindex, 2> {
+
+            constexpr scalar_t pi{constant<scalar_t>::pi};
+            constexpr scalar_t two_pi{2.f * constant<scalar_t>::pi};
+
+            const dindex n{size()};
+            if (n == 0u) {
+                return {0u, 0u};
+            }
+
+            const auto &pos = track.pos();
+            const auto &dir = track.dir();
+
+            const auto x{static_cast<scalar_t>(pos[0])};
+            const auto y{static_cast<scalar_t>(pos[1])};
+            const auto z{static_cast<scalar_t>(pos[2])};
+            const auto dx{static_cast<scalar_t>(dir[0])};
+            const auto dy{static_cast<scalar_t>(dir[1])};
+            const auto dz{static_cast<scalar_t>(dir[2])};
+
+            // Parallel to the beam axis: the wires cannot be found by the
+            // azimuthal angle alone
+            const scalar_t a{dx * dx + dy * dy};
+            if (a == 0.f) {
+                return {0u, n};
+            }
+
+            // Path to where the track leaves the band: Through the inner
+            // radius, if it gets there, else through the outer radius
+            const scalar_t b{x * dx + y * dy};
+            const scalar_t r2{x * x + y * y};
+            scalar_t s_max{0.f};
+            const scalar_t discr_in{
+                b * b - a * (r2 - m_layer.r_min * m_layer.r_min)};
+            const scalar_t s_in{discr_in >= 0.f
+                                    ? (-b - math::sqrt(discr_in)) / a
+                                    : -1.f};
+            if (s_in > 0.f) {
+                s_max = s_in;
+            } else {
+                const scalar_t discr_out{
+                    b * b - a * (r2 - m_layer.r_max * m_layer.r_max)};
+                if (discr_out >= 0.f) {
+                    const scalar_t s_out{(-b + math::sqrt(discr_out)) / a};
+                    s_max = s_out > 0.f ? s_out : 0.f;
+                }
+            }
+            // Also look behind the track by half the width of the band
+            const scalar_t s_min{-0.5f * (m_layer.r_max - m_layer.r_min) /
+                                 math::sqrt(a)};
+
+            // The azimuthal angle changes monotonously along a straight line
+            const scalar_t x0{x + s_min * dx};
+            const scalar_t y0{y + s_min * dy};
+            const scalar_t x1{x + s_max * dx};
+            const scalar_t y1{y + s_max * dy};
+            const scalar_t phi0{math::atan2(y0, x0)};
+            const scalar_t dphi{
+                math::atan2(x0 * y1 - y0 * x1, x0 * x1 + y0 * y1)};
+
+            // Stereo shift of the wires at the z positions of the track
+            const scalar_t z0{z + s_min * dz};
+            const scalar_t z1{z + s_max * dz};
+            const darray<scalar_t, 4> shifts{
+                m_layer.slope_min * z0, m_layer.slope_min * z1,
+                m_layer.slope_max * z0, m_layer.slope_max * z1};
+            scalar_t shift_min{shifts[0]};
+            scalar_t shift_max{shifts[0]};
+            for (const scalar_t sh : shifts) {
+                shift_min = sh < shift_min ? sh : shift_min;
+                shift_max = sh > shift_max ? sh : shift_max;
+            }
+
+            // Range of wire angles at z = 0 that can be crossed
+            scalar_t lo{phi0 + (dphi < 0.f ? dphi : 0.f) - shift_max};
+            const scalar_t width{math::fabs(dphi) + shift_max - shift_min};
+            if (width >= two_pi) {
+                return {0u, n};
+            }
+            lo -= two_pi * math::floor((lo + pi) / two_pi);
+            const scalar_t hi{lo + width};
+
+            const auto phi_begin = m_phis->begin() + detail::get<0>(m_range);
+            const auto phi_end = phi_begin + n;
+
+            const auto first{static_cast<int>(
+                detail::lower_bound(phi_begin, phi_end, lo) - phi_begin)};
+            const auto last{static_cast<int>(
+                hi < pi
+                    ? detail::upper_bound(phi_begin, phi_end, hi) - phi_begin
+                    : n + (detail::upper_bound(phi_begin, phi_end,
+                                               hi - two_pi) -
+                           phi_begin))};
+
+            // Add the neighbors on either side
+            const auto win{static_cast<dindex>(cfg.search_window[0])};
+            const auto n_nb{static_cast<int>(win > n_neighbors ? win
+                                                               : n_neighbors)};
+            const int begin{first - n_nb};
+            const int count{last + n_nb - begin};
+            if (count >= static_cast<int>(n)) {
+                return {0u, n};
+            }
+            const int n_wires{static_cast<int>(n)};
+
+            return {static_cast<dindex>((begin % n_wires + n_wires) % n_wires),
+                    static_cast<dindex>(count)};
+        }
+
+        /// Access to the surface storage of the collection
+        const vector_type<value_t> *m_surfaces{nullptr};
+        /// Access to the wire angles of the collection
+        const vector_type<scalar_t> *m_phis{nullptr};
+        /// Parameters of the layer
+        layer_type m_layer{};
+        /// Range of the wires of this volume
+        dindex_range m_range{0u, 0u};
+    };
+
+    using value_type = wire_finder;
+
+    using view_type =
+        dmulti_view<dvector_view<size_type>, dvector_view<layer_type>,
+                    dvector_view<scalar_t>, dvector_view<value_t>>;
+    using const_view_type =
+        dmulti_view<dvector_view<const size_type>,
+                    dvector_view<const layer_type>,
+                    dvector_view<const scalar_t>, dvector_view<const value_t>>;
+    using buffer_type =
+        dmulti_buffer<dvector_buffer<size_type>, dvector_buffer<layer_type>,
+                      dvector_buffer<scalar_t>, dvector_buffer<value_t>>;
+
+    /// Default constructor
+    constexpr wire_layer_collection() {
+        // Start of first subrange
+        m_offsets.push_back(0u);
+    };
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit constexpr wire_layer_collection(vecmem::memory_resource *resource)
+        : m_offsets(resource),
+          m_layers(resource),
+          m_phis(resource),
+          m_surfaces(resource) {
+        // Start of first subrange
+        m_offsets.push_back(0u);
+    }
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit constexpr wire_layer_collection(vecmem::memory_resource &resource)
+        : wire_layer_collection(&resource) {}
+
+    /// Device-side construction from a vecmem based view type
+    template <typename coll_view_t,
+              typename std::enable_if_t<detail::is_device_view_v<coll_view_t>,
+                                        bool> = true>
+    DETRAY_HOST_DEVICE wire_layer_collection(coll_view_t &view)
+        : m_offsets(detail::get<0>(view.m_view)),
+          m_layers(detail::get<1>(view.m_view)),
+          m_phis(detail::get<2>(view.m_view)),
+          m_surfaces(detail::get<3>(view.m_view)) {}
+
+    /// @returns access to the volume offsets - const
+    DETRAY_HOST const auto &offsets() const { return m_offsets; }
+
+    /// @returns number of wire layers (one per volume) - const
+    DETRAY_HOST_DEVICE
+    constexpr auto size() const noexcept -> size_type {
+        // The start index of the first range is always present
+        return static_cast<dindex>(m_offsets.size()) - 1u;
+    }
+
+    /// @note outside of navigation, the number of elements is unknown
+    DETRAY_HOST_DEVICE
+    constexpr auto empty() const noexcept -> bool {
+        return size() == size_type{0};
+    }
+
+    /// @return access to the surface container - const.
+    DETRAY_HOST_DEVICE
+    auto all() const -> const vector_type<value_t> & { return m_surfaces; }
+
+    /// Create the wire finder of the volume with index @param i - const
+    DETRAY_HOST_DEVICE
+    auto operator[](const size_type i) const -> value_type {
+        return {m_surfaces, m_phis, m_layers[i],
+                dindex_range{m_offsets[i], m_offsets[i + 1u]}};
+    }
+
+    /// Add the wire @param surfaces of a new volume.
+    ///
+    /// @param centers the global positions of the wire centers
+    /// @param dirs the global directions of the wires
+    /// @param half_width the distance from a wire, up to which the track can
+    ///                   still hit it (e.g. half the diagonal of a drift cell)
+    template <typename sf_container_t, typename point3_t, typename vector3_t,
+              typename std::enable_if_t<detray::ranges::range_v<sf_container_t>,
+                                        bool> = true,
+              typename std::enable_if_t<
+                  std::is_same_v<typename sf_container_t::value_type, value_t>,
+                  bool> = true>
+    DETRAY_HOST auto push_back(const sf_container_t &surfaces,
+                               const std::vector<point3_t> &centers,
+                               const std::vector<vector3_t> &dirs,
+                               const scalar_t half_width) noexcept(false)
+        -> void {
+        assert(surfaces.size() == centers.size());
+        assert(surfaces.size() == dirs.size());
+
+        constexpr scalar_t pi{constant<scalar_t>::pi};
+        constexpr scalar_t two_pi{2.f * constant<scalar_t>::pi};
+
+        layer_type layer{};
+        std::vector<scalar_t> phis;
+        phis.reserve(centers.size());
+        for (std::size_t i = 0u; i < centers.size(); ++i) {
+            const auto x{static_cast<scalar_t>(centers[i][0])};
+            const auto y{static_cast<scalar_t>(centers[i][1])};
+            const auto z{static_cast<scalar_t>(centers[i][2])};
+            const scalar_t r{std::hypot(x, y)};
+            assert(r > half_width);
+            assert(dirs[i][2] != 0.f);
+
+            // Change of the azimuthal angle along the wire per unit of z
+            const scalar_t phi{std::atan2(y, x)};
+            const scalar_t d_phi{
+                (-std::sin(phi) * static_cast<scalar_t>(dirs[i][0]) +
+                 std::cos(phi) * static_cast<scalar_t>(dirs[i][1])) /
+                r};
+            const scalar_t slope{d_phi / static_cast<scalar_t>(dirs[i][2])};
+
+            // Azimuthal angle of the wire at z = 0 in [-pi, pi)
+            scalar_t phi_0{phi - slope * z};
+            phi_0 -= two_pi * std::floor((phi_0 + pi) / two_pi);
+            phis.push_back(phi_0);
+
+            if (i == 0u) {
+                layer = {r - half_width, r + half_width, slope, slope};
+            } else {
+                layer.r_min = std::min(layer.r_min, r - half_width);
+                layer.r_max = std::max(layer.r_max, r + half_width);
+                layer.slope_min = std::min(layer.slope_min, slope);
+                layer.slope_max = std::max(layer.slope_max, slope);
+            }
+        }
+
+        std::vector<dindex> indices(surfaces.size());
+        std::iota(indices.begin(), indices.end(), 0u);
+        std::stable_sort(indices.begin(), indices.end(),
+                         [&phis](const dindex i, const dindex j) {
+                             return phis[i] < phis[j];
+                         });
+
+        m_surfaces.reserve(m_surfaces.size() + surfaces.size());
+        m_phis.reserve(m_phis.size() + surfaces.size());
+        for (const dindex i : indices) {
+            m_surfaces.push_back(surfaces[i]);
+            m_phis.push_back(phis[i]);
+        }
+        m_layers.push_back(layer);
+
+        // End of this range is the start of the next range
+        m_offsets.push_back(static_cast<dindex>(m_surfaces.size()));
+    }
+
+    /// @return the view on the wire finders - non-const
+    DETRAY_HOST
+    constexpr auto get_data() noexcept -> view_type {
+        return view_type{
+            detray::get_data(m_offsets), detray::get_data(m_layers),
+            detray::get_data(m_phis), detray::get_data(m_surfaces)};
+    }
+
+    /// @return the view on the wire finders - const
+    DETRAY_HOST
+    constexpr auto get_data() const noexcept -> const_view_type {
+        return const_view_type{
+            detray::get_data(m_offsets), detray::get_data(m_layers),
+            detray::get_data(m_phis), detray::get_data(m_surfaces)};
+    }
+
+    private:
+    /// Offsets for the respective volumes into the surface storage
+    vector_type<size_type> m_offsets{};
+    /// The layer parameters of every volume
+    vector_type<layer_type> m_layers{};
+    /// Azimuthal angles of the wires at z = 0, sorted per volume
+    vector_type<scalar_t> m_phis{};
+    /// The storage for all surface handles, sorted per volume
+    vector_type<value_t> m_surfaces{};
+};
+
+namespace detail {
+
+/// Identify the wire layer collection and its surface finders
+template <class accelerator_t>
+struct is_wire_layers<
+    accelerator_t,
+    std::enable_if_t<
+        std::is_same_v<typename accelerator_t::layer_type,
+                       wire_layer<typename accelerator_t::scalar_type>>,
+        void>> : public std::true_type {};
+
+}  // namespace detail
+
+}  // namespace detray
@@ -8,6 +8,7 @@
 #pragma once
 
 // Project include(s).
+#include "detray/definitions/detail/fast_math.hpp"
 #include "detray/definitions/detail/math.hpp"
 #include "detray/definitions/units.hpp"
 #include "detray/tracks/detail/track_helper.hpp"
@@ -135,9 +136,9 @@ class helix {
         }
 
         point3_type ret = _pos;
-        ret = ret + _delta / _K * (_K * s - math::sin(_K * s)) * _h0;
-        ret = ret + math::sin(_K * s) / _K * _t0;
-        ret = ret + _alpha / _K * (1.f - math::cos(_K * s)) * _n0;
+        ret = ret + _delta / _K * (_K * s - fast_math::sin(_K * s)) * _h0;
+        ret = ret + fast_math::sin(_K * s) / _K * _t0;
+        ret = ret + _alpha / _K * (1.f - fast_math::cos(_K * s)) * _n0;
 
         return ret;
     }
@@ -145,6 +146,91 @@ class helix {
     DETRAY_HOST_DEVICE
     point3_type pos() const { return _pos; }
 
+    /// @returns the second derivative of the position w.r.t. the path length
+    /// at the helix origin (points to the center of the helix circle)
+    DETRAY_HOST_DEVICE
+    vector3_type curvature() const {
+
+        // Handle the case of pT ~ 0
+        if (_vz_over_vt == detail::invalid_value<scalar_type>()) {
+            return {0.f, 0.f, 0.f};
+        }
+
+        return (_alpha * _K) * _n0;
+    }
+
+    /// @returns the third derivative of the position w.r.t. the path length
+    /// at the helix origin (derivative of the curvature vector)
+    DETRAY_HOST_DEVICE
+    vector3_type curvature_derivative() const {
+
+        // Handle the case of pT ~ 0
+        if (_vz_over_vt == detail::invalid_value<scalar_type>()) {
+            return {0.f, 0.f, 0.f};
+        }
+
+        return (_K * _K) * (_delta * _h0 - _t0);
+    }
+
+    /// Conservative check whether the helix can pass through a sphere
+    ///
+    /// The helix lies on the mantle of a cylinder with radius @c _R around its
+    /// axis (parallel to the B field). A sphere that does not cross that
+    /// mantle can never be reached, regardless of the path length.
+    ///
+    /// @param center the center of the sphere in global coordinates
+    /// @param radius the radius of the sphere
+    ///
+    /// @returns false if the sphere is certainly missed
+    DETRAY_HOST_DEVICE
+    bool can_reach(const point3_type &center, const scalar_type radius) const {
+
+        // Straight line along the B field or no bending: Don't reject
+        if (_vz_over_vt == detail::invalid_value<scalar_type>() or
+            _K == 0.f) {
+            return true;
+        }
+
+        // Point on the helix axis
+        const point3_type axis_pos = _pos + (_alpha / _K) * _n0;
+        // Distance of the sphere center to the helix axis
+        const vector3_type d = center - axis_pos;
+        const scalar_type d_perp{getter::norm(d - vector::dot(d, _h0) * _h0)};
+
+        // Allow for the rounding errors on large helix radii. Written such
+        // that invalid values (e.g. from unbounded masks) never reject
+        const scalar_type margin{radius + 1e-5f * _R};
+
+        return !(math::abs(d_perp - _R) > margin);
+    }
+
+    /// Conservative check whether the helix can hit the surface with the
+    /// mask @param mask and placement @param trf
+    ///
+    /// Uses the bounding sphere of the local minimum bounding box of the mask
+    /// (the padding covers linear as well as angular mask tolerances).
+    ///
+    /// @param tol the mask tolerance plus any convergence tolerance
+    ///
+    /// @returns false if the surface is certainly missed
+    template <typename mask_t>
+    DETRAY_HOST_DEVICE bool can_reach(const mask_t &mask,
+                                      const transform3_type &trf,
+                                      const scalar_type tol) const {
+
+        const auto bounds = mask.local_min_bounds();
+
+        const point3_type lower{bounds[0], bounds[1], bounds[2]};
+        const point3_type upper{bounds[3], bounds[4], bounds[5]};
+        const point3_type loc_center = 0.5f * (lower + upper);
+
+        const scalar_type half_diag{0.5f * getter::norm(upper - lower)};
+        const scalar_type radius{
+            half_diag + tol * (1.f + getter::norm(loc_center) + half_diag)};
+
+        return can_reach(trf.point_to_global(loc_center), radius);
+    }
+
     /// @returns the tangential vector after propagating the path length of s
     DETRAY_HOST_DEVICE
     vector3_type dir(const scalar_type s) const {
@@ -156,9 +242,9 @@ class helix {
 
         vector3_type ret{0.f, 0.f, 0.f};
 
-        ret = ret + _delta * (1 - math::cos(_K * s)) * _h0;
-        ret = ret + math::cos(_K * s) * _t0;
-        ret = ret + _alpha * math::sin(_K * s) * _n0;
+        ret = ret + _delta * (1 - fast_math::cos(_K * s)) * _h0;
+        ret = ret + fast_math::cos(_K * s) * _t0;
+        ret = ret + _alpha * fast_math::sin(_K * s) * _n0;
 
         return vector::normalize(ret);
     }
@@ -202,8 +288,8 @@ class helix {
         // Get drdt
         auto drdt = Z33;
 
-        const scalar sin_ks = math::sin(_K * s);
-        const scalar cos_ks = math::cos(_K * s);
+        const scalar sin_ks = fast_math::sin(_K * s);
+        const scalar cos_ks = fast_math::cos(_K * s);
         drdt = drdt + sin_ks / _K * I33;
 
         matrix_type<3, 1> H0 = matrix_operator().template zero<3, 1>();
@@ -0,0 +1,61 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/navigation/detail/ray.hpp"
+#include "detray/navigation/intersection/ray_intersector.hpp"
+
+// System include(s)
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace detray::detail {
+
+/// Number of intersections in the result type @tparam T of an intersector
+/// @{
+template <typename T>
+struct n_solutions : public std::integral_constant<std::size_t, 1u> {};
+
+template <typename T, std::size_t N>
+struct n_solutions<std::array<T, N>>
+    : public std::integral_constant<std::size_t, N> {};
+/// @}
+
+/// @returns the largest number of intersections that a straight line can
+/// have with a surface of the detector @tparam detector_t, i.e. how many
+/// candidates the navigator adds for a single surface at most (e.g. two for
+/// cylinders that are not portals).
+template <typename detector_t, std::size_t I = 0u>
+DETRAY_HOST_DEVICE constexpr std::size_t max_intersection_solutions() {
+
+    using algebra_t = typename detector_t::algebra_type;
+    using masks = typename detector_t::masks;
+    using mask_t = typename masks::template get_type<masks::to_id(I)>::type;
+    using intersector_t = ray_intersector<typename mask_t::shape, algebra_t>;
+    using result_t = decltype(std::declval<const intersector_t &>()(
+        std::declval<const detail::ray<algebra_t> &>(),
+        std::declval<const typename detector_t::surface_type &>(),
+        std::declval<const mask_t &>(),
+        std::declval<const typename detector_t::transform3_type &>()));
+
+    constexpr std::size_t n{n_solutions<result_t>::value};
+
+    if constexpr (I + 1u < static_cast<std::size_t>(masks::n_types)) {
+        constexpr std::size_t n_other{
+            max_intersection_solutions<detector_t, I + 1u>()};
+        return n > n_other ? n : n_other;
+    } else {
+        return n;
+    }
+}
+
+}  // namespace detray::detail
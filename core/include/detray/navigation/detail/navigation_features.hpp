@@ -0,0 +1,152 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/geometry/barcode.hpp"
+#include "detray/utils/invalid_values.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <cstdint>
+
+namespace detray {
+
+namespace navigation {
+
+/// @brief Selects the optional data of the navigation state.
+///
+/// The default navigation state only carries what every propagation needs.
+/// Navigation config options that need more data in the state only take
+/// effect if the navigator is instantiated with the respective feature. To
+/// select features, derive from this struct and hide the flags.
+struct default_features {
+    /// Candidate cache of the volume behind the next portal
+    /// (@c config::portal_lookahead )
+    static constexpr bool lookahead{false};
+    /// Result of the last accelerator search (@c config::cache_search )
+    static constexpr bool search_cache{false};
+    /// Restriction of the navigation to a sequence of surfaces
+    /// (@c navigator::state::set_guide )
+    static constexpr bool guide{false};
+    /// Replay of the accelerator searches of a leader track
+    /// (@c navigator::state::set_leader , needs the search cache)
+    static constexpr bool bundle{false};
+    /// Compact and procedural surface placements
+    /// (@c navigator::state::set_plane_records and
+    /// @c navigator::state::set_barrel_placements )
+    static constexpr bool placements{false};
+};
+
+/// All optional data of the navigation state
+struct all_features : public default_features {
+    static constexpr bool lookahead{true};
+    static constexpr bool search_cache{true};
+    static constexpr bool guide{true};
+    static constexpr bool bundle{true};
+    static constexpr bool placements{true};
+};
+
+}  // namespace navigation
+
+namespace detail {
+
+/// @brief The look-ahead data of the navigation state (empty if disabled).
+///
+/// The candidates of the current volume and of the volume behind the next
+/// portal are kept in two caches. Which one is active is given by a flag, so
+/// that switching to the look-ahead does not move any candidates.
+template <typename cache_t, bool enabled>
+struct lookahead_data {
+    lookahead_data() = default;
+    DETRAY_HOST explicit lookahead_data(vecmem::memory_resource &) {}
+};
+
+template <typename cache_t>
+struct lookahead_data<cache_t, true> {
+
+    lookahead_data() = default;
+
+    DETRAY_HOST
+    explicit lookahead_data(vecmem::memory_resource &resource)
+        : m_lookahead(&resource) {}
+
+    /// Second candidate cache
+    cache_t m_lookahead = {};
+
+    /// The portal for which the look-ahead candidates were prefetched
+    geometry::barcode m_lookahead_portal{};
+
+    /// Search bins in which the look-ahead candidates were found
+    std::uint64_t m_lookahead_key{detail::invalid_value<std::uint64_t>()};
+
+    /// Whether the second cache holds the candidates of the current volume
+    bool m_lookahead_active{false};
+
+    /// Whether the look-ahead cache can be filled (not the case for an
+    /// externally provided candidates container)
+    bool m_can_prefetch{true};
+};
+
+/// @brief The result of the last accelerator search in the navigation state
+/// (empty if disabled).
+template <typename search_cache_t, bool enabled>
+struct search_cache_data {};
+
+template <typename search_cache_t>
+struct search_cache_data<search_cache_t, true> {
+    /// The last accelerator search (kept when the state is cleared)
+    search_cache_t m_search_cache{};
+};
+
+/// @brief The surface sequence that the navigation is restricted to (empty
+/// if disabled).
+template <bool enabled>
+struct guide_data {};
+
+template <>
+struct guide_data<true> {
+    /// Ordered surface barcodes the navigation is restricted to (if any)
+    const geometry::barcode *m_guide{nullptr};
+
+    /// Number of surfaces in the guide
+    dindex m_guide_size{0u};
+
+    /// Whether the navigation is restricted to the guide
+    bool m_is_guided{false};
+};
+
+/// @brief The search cache of the leader track in bundle mode (empty if
+/// disabled).
+template <typename search_cache_t, bool enabled>
+struct bundle_data {};
+
+template <typename search_cache_t>
+struct bundle_data<search_cache_t, true> {
+    /// The last accelerator search of a leader track
+    const search_cache_t *m_leader_search{nullptr};
+};
+
+/// @brief The alternative surface placements of the navigation state (empty
+/// if disabled).
+template <typename placements_t, bool enabled>
+struct placement_data {};
+
+template <typename placements_t>
+struct placement_data<placements_t, true> {
+    /// Compact or procedural placements of the surfaces (if any)
+    placements_t m_placements{};
+};
+
+}  // namespace detail
+
+}  // namespace detray
@@ -0,0 +1,183 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/geometry/coordinates/cartesian2D.hpp"
+#include "detray/geometry/coordinates/polar2D.hpp"
+#include "detray/navigation/detail/ray.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <cassert>
+#include <type_traits>
+
+namespace detray::detail {
+
+/// @brief Compact placement of a planar surface for the ray intersection.
+///
+/// Holds only the local axes and the translation of the placement (twelve
+/// values), instead of the full transform together with its inverse matrix.
+/// Since the rotation is orthonormal, the global-to-local transformation of
+/// a point reduces to three dot products. Provides the part of the transform
+/// interface that the ray-plane intersection needs, so that it can be used in
+/// place of the transform there.
+template <typename algebra_t>
+struct plane_record {
+
+    using scalar_type = dscalar<algebra_t>;
+    using point3_type = dpoint3D<algebra_t>;
+    using vector3_type = dvector3D<algebra_t>;
+
+    /// Default constructor
+    plane_record() = default;
+
+    /// Construct from the placement transform @param trf of the surface
+    template <typename transform3_t>
+    DETRAY_HOST_DEVICE explicit plane_record(const transform3_t &trf)
+        : m_u{trf.x()}, m_v{trf.y()}, m_n{trf.z()}, m_t{trf.translation()} {}
+
+    /// @returns the local axes and the translation of the placement
+    /// @{
+    DETRAY_HOST_DEVICE
+    constexpr const vector3_type &x() const { return m_u; }
+    DETRAY_HOST_DEVICE
+    constexpr const vector3_type &y() const { return m_v; }
+    DETRAY_HOST_DEVICE
+    constexpr const vector3_type &z() const { return m_n; }
+    DETRAY_HOST_DEVICE
+    constexpr const point3_type &translation() const { return m_t; }
+    /// @}
+
+    /// @returns the global point @param p in the local frame of the plane
+    DETRAY_HOST_DEVICE
+    inline point3_type point_to_local(const point3_type &p) const {
+        const vector3_type d = p - m_t;
+        return {vector::dot(d, m_u), vector::dot(d, m_v), vector::dot(d, m_n)};
+    }
+
+    /// @returns the global vector @param v in the local frame of the plane
+    DETRAY_HOST_DEVICE
+    inline vector3_type vector_to_local(const vector3_type &v) const {
+        return {vector::dot(v, m_u), vector::dot(v, m_v), vector::dot(v, m_n)};
+    }
+
+    private:
+    /// Local axes in global coordinates (u, v in the plane, n the normal)
+    vector3_type m_u{1.f, 0.f, 0.f};
+    vector3_type m_v{0.f, 1.f, 0.f};
+    vector3_type m_n{0.f, 0.f, 1.f};
+    /// Position of the plane origin
+    point3_type m_t{0.f, 0.f, 0.f};
+};
+
+/// @brief Transform store that also provides the plane records.
+///
+/// Non-owning: Wraps the transform store of a detector together with the
+/// plane records of its placements (indexed like the transforms, see
+/// @c build_plane_records ). The intersection kernels use the records for
+/// rays and planar surfaces and the full transforms otherwise.
+template <typename transform_container_t, typename algebra_t>
+class plane_record_transforms {
+
+    public:
+    using plane_type = plane_record<algebra_t>;
+
+    /// Construct from the transform store @param trfs and the records
+    /// @param planes , which contain one entry per transform
+    DETRAY_HOST_DEVICE
+    constexpr plane_record_transforms(const transform_container_t &trfs,
+                                      const plane_type *planes)
+        : m_trfs{trfs}, m_planes{planes} {}
+
+    /// @returns the full transform with index @param i
+    DETRAY_HOST_DEVICE
+    constexpr decltype(auto) operator[](const dindex i) const {
+        return m_trfs[i];
+    }
+
+    /// @returns the plane record of the transform with index @param i
+    DETRAY_HOST_DEVICE
+    constexpr const plane_type &plane(const dindex i) const {
+        assert(m_planes != nullptr);
+        return m_planes[i];
+    }
+
+    private:
+    /// The detector transforms
+    const transform_container_t &m_trfs;
+    /// The plane records (same indexing as the transforms)
+    const plane_type *m_planes{nullptr};
+};
+
+/// Check whether a transform container provides plane records
+/// @{
+template <typename T>
+struct has_plane_records : public std::false_type {};
+
+template <typename transform_container_t, typename algebra_t>
+struct has_plane_records<
+    plane_record_transforms<transform_container_t, algebra_t>>
+    : public std::true_type {};
+
+template <typename T>
+inline constexpr bool has_plane_records_v = has_plane_records<T>::value;
+/// @}
+
+/// @returns the placement of the surface with the transform index @param i
+/// that the intersection of the trajectory type @tparam traj_t with a mask of
+/// type @tparam mask_t needs: the plane record for rays and planar masks, if
+/// the transform container @param trfs provides it, otherwise the transform.
+template <typename mask_t, typename traj_t, typename transform_container_t>
+DETRAY_HOST_DEVICE constexpr decltype(auto) placement(
+    const transform_container_t &trfs, const dindex i) {
+
+    using algebra_t = typename mask_t::algebra_type;
+    using frame_t = typename mask_t::local_frame_type;
+
+    if constexpr (has_plane_records_v<transform_container_t> &&
+                  std::is_same_v<traj_t, ray<algebra_t>> &&
+                  (std::is_same_v<frame_t, cartesian2D<algebra_t>> ||
+                   std::is_same_v<frame_t, polar2D<algebra_t>>)) {
+        return trfs.plane(i);
+    } else {
+        return trfs[i];
+    }
+}
+
+/// Build the plane records of all placements in the detector @param det
+///
+/// The records are built once per geometry context @param ctx and have to
+/// be rebuilt, when the alignment changes.
+///
+/// @returns one record per transform, in the order of the transform store
+template <typename detector_t>
+DETRAY_HOST auto build_plane_records(
+    const detector_t &det, vecmem::memory_resource &mr,
+    const typename detector_t::geometry_context &ctx = {}) {
+
+    using algebra_t = typename detector_t::algebra_type;
+
+    const auto &trfs = det.transform_store();
+
+    vecmem::vector<plane_record<algebra_t>> records(&mr);
+    records.reserve(trfs.size(ctx));
+    for (const auto &trf : trfs.get(ctx)) {
+        records.emplace_back(trf);
+    }
+
+    return records;
+}
+
+}  // namespace detray::detail
@@ -0,0 +1,118 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/geometry/coordinates/cartesian2D.hpp"
+#include "detray/geometry/coordinates/concentric_cylindrical2D.hpp"
+#include "detray/geometry/coordinates/cylindrical2D.hpp"
+#include "detray/geometry/coordinates/polar2D.hpp"
+#include "detray/navigation/detail/ray.hpp"
+#include "detray/utils/invalid_values.hpp"
+#include "detray/utils/quadratic_equation.hpp"
+#include "detray/utils/ranges.hpp"
+
+// System include(s)
+#include <limits>
+#include <type_traits>
+
+namespace detray::detail {
+
+/// @brief Path lengths of a ray to the unbounded surface of a portal.
+///
+/// The portals of cylinder and cuboid volumes lie on planes and cylinders
+/// that bound the volume. The first of these unbounded surfaces that a ray
+/// reaches from inside of the volume determines where the ray exits, which
+/// is found without evaluating the portal masks (local coordinates, boundary
+/// checks) or filling the candidate cache.
+///
+/// @returns the up to two path lengths (invalid value if there is no
+/// solution). For portal shapes that are not supported, both path lengths
+/// are zero, so that the portal is never discarded.
+struct portal_distance {
+
+    template <typename mask_group_t, typename mask_range_t,
+              typename algebra_t, typename transform_container_t>
+    DETRAY_HOST_DEVICE inline darray<dscalar<algebra_t>, 2> operator()(
+        const mask_group_t &mask_group, const mask_range_t &mask_range,
+        const detail::ray<algebra_t> &ray,
+        const transform_container_t &transforms, const dindex trf_idx) const {
+
+        using scalar_t = dscalar<algebra_t>;
+        using vector3_t = dvector3D<algebra_t>;
+        using mask_t = typename mask_group_t::value_type;
+        using frame_t = typename mask_t::local_frame_type;
+
+        constexpr bool is_plane{
+            std::is_same_v<frame_t, cartesian2D<algebra_t>> ||
+            std::is_same_v<frame_t, polar2D<algebra_t>>};
+        constexpr bool is_cylinder{
+            std::is_same_v<frame_t, cylindrical2D<algebra_t>>};
+        constexpr bool is_concentric_cylinder{
+            std::is_same_v<frame_t, concentric_cylindrical2D<algebra_t>>};
+
+        constexpr scalar_t inv{detail::invalid_value<scalar_t>()};
+
+        const dpoint3D<algebra_t> &ro = ray.pos();
+        const vector3_t &rd = ray.dir();
+
+        if constexpr (is_plane) {
+            // Plane: Only the placement is needed
+            const auto &trf = transforms[trf_idx];
+            const vector3_t sn = trf.z();
+            const scalar_t denom{vector::dot(sn, rd)};
+            if (denom == 0.f) {
+                return {inv, inv};
+            }
+            return {vector::dot(sn, trf.translation() - ro) / denom, inv};
+        } else if constexpr (is_cylinder || is_concentric_cylinder) {
+            // Cylinder: The radius is the same for all masks of the surface
+            const auto &mask =
+                *detray::ranges::subrange(mask_group, mask_range).begin();
+            const scalar_t r{mask[mask_t::shape::e_r]};
+
+            // Concentric cylinders are centered on the z-axis
+            vector3_t sz{0.f, 0.f, 1.f};
+            vector3_t sc{0.f, 0.f, 0.f};
+            if constexpr (is_cylinder) {
+                const auto &trf = transforms[trf_idx];
+                sz = trf.z();
+                sc = trf.translation();
+            }
+
+            const vector3_t pc_cross_sz = vector::cross(ro - sc, sz);
+            const vector3_t rd_cross_sz = vector::cross(rd, sz);
+            const scalar_t a{vector::dot(rd_cross_sz, rd_cross_sz)};
+            // Ray parallel to the cylinder axis
+            if (a <= std::numeric_limits<scalar_t>::epsilon()) {
+                return {inv, inv};
+            }
+            const scalar_t b{2.f * vector::dot(rd_cross_sz, pc_cross_sz)};
+            const scalar_t c{vector::dot(pc_cross_sz, pc_cross_sz) - (r * r)};
+
+            const quadratic_equation<scalar_t> qe{a, b, c};
+            switch (qe.solutions()) {
+                case 2:
+                    return {qe.smaller(), qe.larger()};
+                case 1:
+                    return {qe.smaller(), inv};
+                default:
+                    return {inv, inv};
+            };
+        } else {
+            // Unsupported shape: Always intersect the portal fully
+            return {0.f, 0.f};
+        }
+    }
+};
+
+}  // namespace detray::detail
@@ -0,0 +1,60 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/geometry/detail/barrel_placement.hpp"
+
+namespace detray::detail {
+
+/// @brief Transform store that computes the module placements of regular
+/// barrel layers on the fly.
+///
+/// Non-owning: Wraps the transform store of a detector together with the
+/// procedural placements of some of its barrel layers. The transforms of the
+/// modules in these layers are computed from the layer parameters, instead
+/// of being loaded from the store, all other transforms are read as usual.
+template <typename transform_container_t, typename algebra_t>
+class procedural_transforms {
+
+    public:
+    using barrel_type = barrel_placement<algebra_t>;
+    using transform3_type = dtransform3D<algebra_t>;
+
+    /// Construct from the transform store @param trfs and the @param n
+    /// procedural layers in @param barrels
+    DETRAY_HOST_DEVICE
+    constexpr procedural_transforms(const transform_container_t &trfs,
+                                    const barrel_type *barrels,
+                                    const dindex n)
+        : m_trfs{trfs}, m_barrels{barrels}, m_n_barrels{n} {}
+
+    /// @returns the transform with index @param i (by value)
+    DETRAY_HOST_DEVICE
+    transform3_type operator[](const dindex i) const {
+        // Only a few layers: Linear search
+        for (dindex b = 0u; b < m_n_barrels; ++b) {
+            if (m_barrels[b].contains(i)) {
+                return m_barrels[b].transform(i);
+            }
+        }
+        return m_trfs[i];
+    }
+
+    private:
+    /// The detector transforms
+    const transform_container_t &m_trfs;
+    /// The procedural barrel layers
+    const barrel_type *m_barrels{nullptr};
+    dindex m_n_barrels{0u};
+};
+
+}  // namespace detray::detail
@@ -0,0 +1,82 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+
+// System include(s)
+#include <cstdint>
+
+namespace detray::detail {
+
+/// @brief Remembers the projection of a ray onto the last surface placement.
+///
+/// Surfaces that share a placement transform (e.g. stacked discs or
+/// cylinders around a common axis) see the same ray in their local frame.
+/// The quantities of the intersection calculation that only depend on the
+/// ray and the placement can therefore be reused for consecutive surfaces
+/// with the same transform index, as long as the ray does not change (i.e.
+/// within one candidate search).
+template <typename algebra_t>
+class ray_transform_cache {
+
+    public:
+    using scalar_type = dscalar<algebra_t>;
+
+    /// Kind of projection that is held by the cache
+    enum class projection : std::uint_least8_t {
+        e_none = 0u,
+        e_plane = 1u,
+        e_cylinder = 2u,
+    };
+
+    /// Cached values (plane: ray direction and distance along the normal,
+    /// cylinder: coefficients of the quadratic equation without the radius)
+    using values_type = darray<scalar_type, 3>;
+
+    /// @returns whether the cache holds the projection @param p onto the
+    /// transform with index @param trf_idx
+    DETRAY_HOST_DEVICE
+    constexpr bool contains(const dindex trf_idx, const projection p) const {
+        return (m_projection == p) and (m_trf_idx == trf_idx);
+    }
+
+    /// @returns the cached values
+    DETRAY_HOST_DEVICE
+    constexpr const values_type &values() const { return m_values; }
+
+    /// Set the projection @param p onto the transform @param trf_idx
+    DETRAY_HOST_DEVICE
+    constexpr void set(const dindex trf_idx, const projection p,
+                       const values_type &values) {
+        m_trf_idx = trf_idx;
+        m_projection = p;
+        m_values = values;
+    }
+
+    /// Forget the cached projection (e.g. when the ray changes)
+    DETRAY_HOST_DEVICE
+    constexpr void reset() {
+        m_trf_idx = dindex_invalid;
+        m_projection = projection::e_none;
+    }
+
+    private:
+    /// Index of the transform the values belong to
+    dindex m_trf_idx{dindex_invalid};
+    /// What the values describe
+    projection m_projection{projection::e_none};
+    /// The cached values
+    values_type m_values{};
+};
+
+}  // namespace detray::detail
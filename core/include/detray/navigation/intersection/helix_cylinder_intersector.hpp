@@ -19,6 +19,7 @@
 #include "detray/utils/invalid_values.hpp"
 
 // System include(s)
+#include <cstddef>
 #include <limits>
 #include <type_traits>
 
@@ -67,6 +68,12 @@ struct helix_intersector_impl<cylindrical2D<algebra_t>, algebra_t>
 
         std::array<intersection_type<surface_descr_t>, 2> ret;
 
+        // Early out: Skip the Newton iteration if the helix cannot reach
+        // the bounding sphere of the mask
+        if (!h.can_reach(mask, trf, mask_tolerance + convergence_tolerance)) {
+            return ret;
+        }
+
         // Guard against inifinite loops
         constexpr std::size_t max_n_tries{1000u};
 
@@ -110,6 +117,13 @@ struct helix_intersector_impl<cylindrical2D<algebra_t>, algebra_t>
                 paths[0] = qe.smaller();
         };
 
+        // Move the guesses towards the intersections of the polynomial
+        // approximation of the helix, which also works for lower p_T
+        if (polynomial_seed) {
+            paths[0] = refine_seed(h, sc, sz, r, paths[0]);
+            paths[1] = refine_seed(h, sc, sz, r, paths[1]);
+        }
+
         // Obtain both possible solutions by looping over the (different)
         // starting positions
         unsigned int n_runs =
@@ -144,6 +158,10 @@ struct helix_intersector_impl<cylindrical2D<algebra_t>, algebra_t>
 
                 ++n_tries;
             }
+            if (n_iterations) {
+                *n_iterations += n_tries;
+            }
+
             // No intersection found within max number of trials
             if (n_tries == max_n_tries) {
                 return ret;
@@ -170,6 +188,72 @@ struct helix_intersector_impl<cylindrical2D<algebra_t>, algebra_t>
 
     /// Tolerance for convergence
     scalar_type convergence_tolerance{1e-3f};
+    /// Refine the starting points of the Newton iteration on a polynomial
+    /// approximation of the helix
+    bool polynomial_seed{true};
+    /// Optional counter for the number of Newton iterations (instrumentation)
+    std::size_t *n_iterations{nullptr};
+
+    private:
+    /// Refine a starting path length @param s for the Newton iteration.
+    ///
+    /// Close to its origin, the helix is approximated by its Taylor expansion
+    /// p(s) = pos + s * dir + s^2/2 * curvature + s^3/6 * curvature'. The
+    /// parabolic term describes the bending, the cubic term corrects the
+    /// path length along the initial direction. The intersection with the
+    /// cylinder is found by a Newton iteration on the resulting polynomial,
+    /// which does not need any trigonometric functions.
+    ///
+    /// @returns the refined path length or @param s, if the polynomial does
+    /// not yield a solution close to the helix origin
+    DETRAY_HOST_DEVICE inline scalar_type refine_seed(
+        const helix_type &h, const point3_type &sc, const vector3_type &sz,
+        const scalar_type r, const scalar_type s) const {
+
+        // Guard against inifinite loops
+        constexpr std::size_t max_n_tries{20u};
+
+        const vector3_type k = h.curvature();
+        const scalar_type kappa{getter::norm(k)};
+
+        // Polynomial projected onto the plane perpendicular to the cylinder
+        // axis: d(s) = c0 + s * c1 + s^2 * c2 + s^3 * c3
+        const vector3_type c0 = vector::cross(h.pos() - sc, sz);
+        const vector3_type c1 = vector::cross(h.dir(), sz);
+        const vector3_type c2 = 0.5f * vector::cross(k, sz);
+        const vector3_type c3 =
+            (1.f / 6.f) * vector::cross(h.curvature_derivative(), sz);
+
+        // f(s) = d(s)^2 - r^2 == 0
+        scalar_type s_poly{s};
+        for (std::size_t n_tries = 0u; n_tries < max_n_tries; ++n_tries) {
+
+            const scalar_type s2{s_poly * s_poly};
+            const vector3_type d =
+                c0 + s_poly * c1 + s2 * c2 + (s2 * s_poly) * c3;
+            // f'(s) = 2 * d(s) * d'(s)
+            const vector3_type dd = c1 + (2.f * s_poly) * c2 + (3.f * s2) * c3;
+            const scalar_type denom{2.f * vector::dot(d, dd)};
+
+            if (denom == 0.f) {
+                return s;
+            }
+
+            const scalar_type step{(vector::dot(d, d) - r * r) / denom};
+            s_poly -= step;
+
+            // The expansion is only a good approximation for small bending
+            if (!(math::abs(s_poly) * kappa < 1.f)) {
+                return s;
+            }
+            if (math::abs(step) < convergence_tolerance) {
+                return s_poly;
+            }
+        }
+
+        // Not converged: Keep the original guess
+        return s;
+    }
 };
 
 template <typename algebra_t>
@@ -61,6 +61,12 @@ struct helix_intersector_impl<cartesian2D<algebra_t>, algebra_t> {
 
         intersection_type<surface_descr_t> sfi;
 
+        // Early out: Skip the Newton iteration if the helix cannot reach
+        // the bounding sphere of the mask
+        if (!h.can_reach(mask, trf, mask_tolerance + convergence_tolerance)) {
+            return sfi;
+        }
+
         // Guard against inifinite loops
         constexpr std::size_t max_n_tries{1000u};
 
@@ -38,6 +38,16 @@ enum class status : std::uint_least8_t {
     e_inside = 3u      //!< surface hit and inside confirmed
 };
 
+/// Leave the incidence angle of the candidates undefined, where it is not a
+/// by-product of the intersection (e.g. on cylinders). It is then computed
+/// on demand for the surface the track reaches (see
+/// @c navigator::state::cos_incidence_angle ), instead of for every candidate
+#if defined(DETRAY_LAZY_INCIDENCE)
+inline constexpr bool lazy_incidence{true};
+#else
+inline constexpr bool lazy_incidence{false};
+#endif
+
 }  // namespace intersection
 
 /// @brief This class holds the intersection information.
@@ -0,0 +1,562 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/detail/simd.hpp"
+#include "detray/geometry/coordinates/cartesian2D.hpp"
+#include "detray/geometry/coordinates/concentric_cylindrical2D.hpp"
+#include "detray/geometry/coordinates/cylindrical2D.hpp"
+#include "detray/geometry/coordinates/line2D.hpp"
+#include "detray/geometry/coordinates/polar2D.hpp"
+#include "detray/geometry/shapes/concentric_cylinder2D.hpp"
+#include "detray/geometry/shapes/cylinder2D.hpp"
+#include "detray/geometry/shapes/line.hpp"
+#include "detray/geometry/shapes/rectangle2D.hpp"
+#include "detray/geometry/shapes/ring2D.hpp"
+#include "detray/geometry/shapes/trapezoid2D.hpp"
+#include "detray/navigation/detail/ray.hpp"
+#include "detray/utils/invalid_values.hpp"
+
+// System include(s)
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace detray {
+
+/// @brief Default value type of a ray bundle for the algebra @tparam algebra_t
+///
+/// Algebra plugins with a SIMD backend define the member type @c bundle_type
+/// (e.g. @c Vc::Vector ), all others fall back to single rays.
+/// @{
+template <typename algebra_t, typename = void>
+struct ray_bundle_value {
+    using type = dscalar<algebra_t>;
+};
+
+template <typename algebra_t>
+struct ray_bundle_value<algebra_t,
+                        std::void_t<typename algebra_t::bundle_type>> {
+    using type = typename algebra_t::bundle_type;
+};
+
+template <typename algebra_t>
+using ray_bundle_value_t = typename ray_bundle_value<algebra_t>::type;
+/// @}
+
+/// @brief A number of rays in horizontally vectorized form.
+///
+/// Every lane of the value type holds the coordinate of a different ray, e.g.
+/// a @c Vc::Vector<float> of width 16 on AVX-512 holds the x-components of
+/// the positions of 16 rays. With a plain scalar value type, the bundle
+/// degenerates to a single ray.
+///
+/// @tparam algebra_t the linear algebra of the single rays
+/// @tparam value_t the (SIMD) value type
+template <typename algebra_t, typename value_t = ray_bundle_value_t<algebra_t>>
+struct ray_bundle {
+
+    using algebra_type = algebra_t;
+    using scalar_type = dscalar<algebra_t>;
+    using value_type = value_t;
+    /// Lane mask that results from comparisons of the value type
+    using mask_type = decltype(value_t{} < value_t{});
+    using ray_type = detail::ray<algebra_t>;
+
+    /// @returns the number of lanes
+    DETRAY_HOST_DEVICE
+    static constexpr std::size_t capacity() {
+        return detail::simd::size<value_t>();
+    }
+
+    /// @returns the number of rays in the bundle
+    DETRAY_HOST_DEVICE
+    constexpr std::size_t size() const { return m_size; }
+
+    /// @returns true if no further ray can be added
+    DETRAY_HOST_DEVICE
+    constexpr bool full() const { return m_size == capacity(); }
+
+    /// Add the ray @param r in the next free lane.
+    ///
+    /// @note The unused lanes repeat the first ray, so that they never
+    /// produce floating point exceptions.
+    DETRAY_HOST_DEVICE
+    constexpr void push_back(const ray_type &r) {
+        assert(!full());
+        const std::size_t first{m_size};
+        const std::size_t last{m_size == 0u ? capacity() : m_size + 1u};
+        for (std::size_t i = first; i < last; ++i) {
+            for (std::size_t j = 0u; j < 3u; ++j) {
+                detail::simd::set(pos[j], i, r.pos()[j]);
+                detail::simd::set(dir[j], i, r.dir()[j]);
+            }
+        }
+        ++m_size;
+    }
+
+    /// @returns the ray in lane @param i
+    DETRAY_HOST_DEVICE
+    constexpr ray_type operator[](const std::size_t i) const {
+        assert(i < m_size);
+        using point3_t = dpoint3D<algebra_t>;
+        using vector3_t = dvector3D<algebra_t>;
+        return ray_type{point3_t{detail::simd::get(pos[0], i),
+                                 detail::simd::get(pos[1], i),
+                                 detail::simd::get(pos[2], i)},
+                        0.f,
+                        vector3_t{detail::simd::get(dir[0], i),
+                                  detail::simd::get(dir[1], i),
+                                  detail::simd::get(dir[2], i)},
+                        0.f};
+    }
+
+    /// @returns the positions of the rays after the path lengths @param s
+    DETRAY_HOST_DEVICE
+    inline darray<value_t, 3> pos_at(const value_t &s) const {
+        return {pos[0] + s * dir[0], pos[1] + s * dir[1], pos[2] + s * dir[2]};
+    }
+
+    /// Straight line step: Move every ray by its path length in @param s
+    DETRAY_HOST_DEVICE
+    inline void advance(const value_t &s) { pos = pos_at(s); }
+
+    /// Positions by component
+    darray<value_t, 3> pos{};
+    /// Normalized directions by component
+    darray<value_t, 3> dir{};
+
+    private:
+    /// Number of rays in the bundle
+    std::size_t m_size{0u};
+};
+
+/// @brief Path lengths of a ray bundle to a surface.
+///
+/// @tparam value_t the (SIMD) value type
+/// @tparam N the number of solutions per ray (e.g. two for a cylinder)
+template <typename value_t, std::size_t N>
+struct bundle_solutions {
+
+    using mask_type = decltype(value_t{} < value_t{});
+
+    /// @returns the number of solutions per ray
+    DETRAY_HOST_DEVICE
+    static constexpr std::size_t size() { return N; }
+
+    /// Path lengths to the surface
+    darray<value_t, N> path{};
+    /// Whether the solutions exist and are above the overstep tolerance
+    darray<mask_type, N> is_valid{};
+};
+
+namespace detail {
+
+/// @returns the dot product of a bundle component array @param a with the
+/// scalar vector @param v
+template <typename value_t, typename vector3_t>
+DETRAY_HOST_DEVICE inline value_t bundle_dot(const darray<value_t, 3> &a,
+                                             const vector3_t &v) {
+    return a[0] * v[0] + a[1] * v[1] + a[2] * v[2];
+}
+
+/// @returns the cross product of a bundle component array @param a with the
+/// scalar vector @param v
+template <typename value_t, typename vector3_t>
+DETRAY_HOST_DEVICE inline darray<value_t, 3> bundle_cross(
+    const darray<value_t, 3> &a, const vector3_t &v) {
+    return {a[1] * v[2] - a[2] * v[1], a[2] * v[0] - a[0] * v[2],
+            a[0] * v[1] - a[1] * v[0]};
+}
+
+/// @returns the difference of the scalar point @param p and the bundle
+/// positions @param a
+template <typename value_t, typename point3_t>
+DETRAY_HOST_DEVICE inline darray<value_t, 3> bundle_diff(
+    const point3_t &p, const darray<value_t, 3> &a) {
+    return {value_t(p[0]) - a[0], value_t(p[1]) - a[1],
+            value_t(p[2]) - a[2]};
+}
+
+/// @returns the bundle positions @param a in the local cartesian frame of
+/// the placement @param trf
+template <typename value_t, typename transform3_t>
+DETRAY_HOST_DEVICE inline darray<value_t, 3> bundle_to_local(
+    const darray<value_t, 3> &a, const transform3_t &trf) {
+    const auto t = trf.translation();
+    const darray<value_t, 3> d{a[0] - t[0], a[1] - t[1], a[2] - t[2]};
+    return {bundle_dot(d, trf.x()), bundle_dot(d, trf.y()),
+            bundle_dot(d, trf.z())};
+}
+
+/// Solve the ray-cylinder quadratic equation for every lane
+///
+/// @note Rays that are parallel to the cylinder axis are flagged as invalid
+template <typename value_t, typename mask_t, typename transform3_t,
+          typename scalar_t>
+DETRAY_HOST_DEVICE inline bundle_solutions<value_t, 2> solve_cylinder(
+    const darray<value_t, 3> &pos, const darray<value_t, 3> &dir,
+    const mask_t &mask, const transform3_t &trf) {
+
+    using mask_type = typename bundle_solutions<value_t, 2>::mask_type;
+
+    const scalar_t r{mask[mask_t::shape::e_r]};
+    const auto sz = trf.z();
+    const auto sc = trf.translation();
+
+    // Origin relative to the cylinder center (sign does not matter below)
+    const darray<value_t, 3> pc = bundle_diff(sc, pos);
+    const darray<value_t, 3> pc_cross_sz = bundle_cross(pc, sz);
+    const darray<value_t, 3> rd_cross_sz = bundle_cross(dir, sz);
+
+    const value_t a{rd_cross_sz[0] * rd_cross_sz[0] +
+                    rd_cross_sz[1] * rd_cross_sz[1] +
+                    rd_cross_sz[2] * rd_cross_sz[2]};
+    const value_t b{-2.f * (rd_cross_sz[0] * pc_cross_sz[0] +
+                            rd_cross_sz[1] * pc_cross_sz[1] +
+                            rd_cross_sz[2] * pc_cross_sz[2])};
+    const value_t c{pc_cross_sz[0] * pc_cross_sz[0] +
+                    pc_cross_sz[1] * pc_cross_sz[1] +
+                    pc_cross_sz[2] * pc_cross_sz[2] - r * r};
+
+    constexpr scalar_t eps{std::numeric_limits<scalar_t>::epsilon()};
+    const value_t zero(0.f);
+    const value_t one(1.f);
+
+    const value_t disc{b * b - 4.f * a * c};
+    const mask_type is_quadratic = (a > eps);
+    const mask_type has_one = is_quadratic && (disc >= zero);
+    const mask_type has_two = is_quadratic && (disc > eps);
+
+    // Numerically stable solution (see @c quadratic_equation )
+    const value_t sq{simd::sqrt(simd::select(has_one, disc, zero))};
+    const value_t q{-0.5f * (b + simd::select(b < zero, -sq, sq))};
+    const value_t safe_a{simd::select(is_quadratic, a, one)};
+    const value_t safe_q{simd::select(q == zero, one, q)};
+
+    const value_t s0{simd::select(has_two, q / safe_a, -0.5f * b / safe_a)};
+    const value_t s1{simd::select(has_two, c / safe_q, s0)};
+
+    bundle_solutions<value_t, 2> res{};
+    res.path[0] = simd::select(s0 < s1, s0, s1);
+    res.path[1] = simd::select(s0 < s1, s1, s0);
+    res.is_valid[0] = has_one;
+    res.is_valid[1] = has_two;
+
+    return res;
+}
+
+}  // namespace detail
+
+/// @brief Horizontally vectorized intersection of many rays with a single
+/// surface.
+///
+/// Only computes the path lengths to the surface: the mask check is left to
+/// the caller, since it is only needed for the lanes that reach the surface
+/// (see @c ray_bundle_mask_check ).
+///
+/// @note specialized for the different local geometries below
+template <typename frame_t, typename algebra_t>
+struct ray_bundle_intersector_impl {};
+
+/// Planar surfaces
+template <typename algebra_t>
+struct ray_bundle_intersector_impl<cartesian2D<algebra_t>, algebra_t> {
+
+    using scalar_type = dscalar<algebra_t>;
+
+    static constexpr std::size_t n_solutions{1u};
+
+    /// @returns the path lengths of the rays in @param bundle to the plane
+    /// with placement @param trf (rays parallel to the plane are invalid)
+    template <typename value_t, typename mask_t, typename transform3_t>
+    DETRAY_HOST_DEVICE inline bundle_solutions<value_t, 1> operator()(
+        const ray_bundle<algebra_t, value_t> &bundle, const mask_t & /*mask*/,
+        const transform3_t &trf, const scalar_type overstep_tol = 0.f) const {
+
+        const auto sn = trf.z();
+        const value_t zero(0.f);
+        const value_t one(1.f);
+
+        const value_t denom{detail::bundle_dot(bundle.dir, sn)};
+        const value_t num{
+            detail::bundle_dot(detail::bundle_diff(trf.translation(),
+                                                   bundle.pos),
+                               sn)};
+
+        const auto is_parallel = (denom == zero);
+
+        bundle_solutions<value_t, 1> res{};
+        res.path[0] = num / detray::detail::simd::select(is_parallel, one,
+                                                         denom);
+        res.is_valid[0] = !is_parallel && (res.path[0] >= overstep_tol);
+
+        return res;
+    }
+};
+
+template <typename algebra_t>
+struct ray_bundle_intersector_impl<polar2D<algebra_t>, algebra_t>
+    : public ray_bundle_intersector_impl<cartesian2D<algebra_t>, algebra_t> {
+};
+
+/// Cylinders: Up to two solutions per ray
+template <typename algebra_t>
+struct ray_bundle_intersector_impl<cylindrical2D<algebra_t>, algebra_t> {
+
+    using scalar_type = dscalar<algebra_t>;
+
+    static constexpr std::size_t n_solutions{2u};
+
+    /// @returns the sorted path lengths of the rays in @param bundle to the
+    /// cylinder with radius from @param mask and placement @param trf
+    template <typename value_t, typename mask_t, typename transform3_t>
+    DETRAY_HOST_DEVICE inline bundle_solutions<value_t, 2> operator()(
+        const ray_bundle<algebra_t, value_t> &bundle, const mask_t &mask,
+        const transform3_t &trf, const scalar_type overstep_tol = 0.f) const {
+
+        auto res = detail::solve_cylinder<value_t, mask_t, transform3_t,
+                                          scalar_type>(bundle.pos, bundle.dir,
+                                                       mask, trf);
+        res.is_valid[0] = res.is_valid[0] && (res.path[0] >= overstep_tol);
+        res.is_valid[1] = res.is_valid[1] && (res.path[1] >= overstep_tol);
+
+        return res;
+    }
+};
+
+/// Cylindrical portals: Only the closest solution above the overstep
+/// tolerance
+template <typename algebra_t>
+struct ray_bundle_intersector_impl<concentric_cylindrical2D<algebra_t>,
+                                   algebra_t> {
+
+    using scalar_type = dscalar<algebra_t>;
+
+    static constexpr std::size_t n_solutions{1u};
+
+    /// @returns the closest path lengths of the rays in @param bundle to the
+    /// cylinder with radius from @param mask and placement @param trf
+    template <typename value_t, typename mask_t, typename transform3_t>
+    DETRAY_HOST_DEVICE inline bundle_solutions<value_t, 1> operator()(
+        const ray_bundle<algebra_t, value_t> &bundle, const mask_t &mask,
+        const transform3_t &trf, const scalar_type overstep_tol = 0.f) const {
+
+        const auto qe = detail::solve_cylinder<value_t, mask_t, transform3_t,
+                                               scalar_type>(
+            bundle.pos, bundle.dir, mask, trf);
+
+        const value_t tol(overstep_tol);
+        const auto take_smaller = qe.is_valid[1] && (qe.path[0] > tol);
+
+        bundle_solutions<value_t, 1> res{};
+        res.path[0] =
+            detray::detail::simd::select(take_smaller, qe.path[0], qe.path[1]);
+        res.is_valid[0] = qe.is_valid[1] && (qe.path[1] > tol);
+
+        return res;
+    }
+};
+
+/// Lines: Point of closest approach
+template <typename algebra_t>
+struct ray_bundle_intersector_impl<line2D<algebra_t>, algebra_t> {
+
+    using scalar_type = dscalar<algebra_t>;
+
+    static constexpr std::size_t n_solutions{1u};
+
+    /// @returns the path lengths of the rays in @param bundle to the point of
+    /// closest approach to the line with placement @param trf
+    template <typename value_t, typename mask_t, typename transform3_t>
+    DETRAY_HOST_DEVICE inline bundle_solutions<value_t, 1> operator()(
+        const ray_bundle<algebra_t, value_t> &bundle, const mask_t & /*mask*/,
+        const transform3_t &trf, const scalar_type overstep_tol = 0.f) const {
+
+        const auto lz = trf.z();
+        const value_t one(1.f);
+
+        // Projection of the line on the track directions
+        const value_t zd{detail::bundle_dot(bundle.dir, lz)};
+        const value_t denom{one - zd * zd};
+        const auto is_parallel = (denom < 1e-5f);
+
+        // Vector from track position to line center
+        const darray<value_t, 3> t2l =
+            detail::bundle_diff(trf.translation(), bundle.pos);
+        const value_t t2l_on_line{detail::bundle_dot(t2l, lz)};
+        const value_t t2l_on_track{t2l[0] * bundle.dir[0] +
+                                   t2l[1] * bundle.dir[1] +
+                                   t2l[2] * bundle.dir[2]};
+
+        bundle_solutions<value_t, 1> res{};
+        res.path[0] =
+            (t2l_on_track - t2l_on_line * zd) /
+            detray::detail::simd::select(is_parallel, one, denom);
+        res.is_valid[0] = !is_parallel && (res.path[0] >= overstep_tol);
+
+        return res;
+    }
+};
+
+template <typename shape_t, typename algebra_t>
+using ray_bundle_intersector = ray_bundle_intersector_impl<
+    typename shape_t::template local_frame_type<algebra_t>, algebra_t>;
+
+/// Whether there is a bundle intersector for the shape @tparam shape_t
+template <typename shape_t, typename algebra_t, typename = void>
+struct has_ray_bundle_intersector : public std::false_type {};
+
+template <typename shape_t, typename algebra_t>
+struct has_ray_bundle_intersector<
+    shape_t, algebra_t,
+    std::void_t<decltype(
+        ray_bundle_intersector<shape_t, algebra_t>::n_solutions)>>
+    : public std::true_type {};
+
+template <typename shape_t, typename algebra_t>
+inline constexpr bool has_ray_bundle_intersector_v =
+    has_ray_bundle_intersector<shape_t, algebra_t>::value;
+
+/// @brief Lane-wise boundary check of the hit points of a ray bundle.
+///
+/// Follows @c check_boundaries of the shape @tparam shape_t on the local
+/// coordinates of all lanes at once and @returns the lane mask of the points
+/// that are inside. Shapes without a specialization are checked ray by ray.
+template <typename shape_t>
+struct ray_bundle_mask_check : public std::false_type {};
+
+template <>
+struct ray_bundle_mask_check<rectangle2D> : public std::true_type {
+
+    template <typename value_t, typename mask_t, typename transform3_t,
+              typename scalar_t>
+    DETRAY_HOST_DEVICE inline auto operator()(const darray<value_t, 3> &glob,
+                                              const mask_t &mask,
+                                              const transform3_t &trf,
+                                              const scalar_t tol) const {
+        using shape_t = rectangle2D;
+
+        const auto loc = detail::bundle_to_local(glob, trf);
+        return (detail::simd::abs(loc[0]) <= mask[shape_t::e_half_x] + tol) &&
+               (detail::simd::abs(loc[1]) <= mask[shape_t::e_half_y] + tol);
+    }
+};
+
+template <>
+struct ray_bundle_mask_check<trapezoid2D> : public std::true_type {
+
+    template <typename value_t, typename mask_t, typename transform3_t,
+              typename scalar_t>
+    DETRAY_HOST_DEVICE inline auto operator()(const darray<value_t, 3> &glob,
+                                              const mask_t &mask,
+                                              const transform3_t &trf,
+                                              const scalar_t tol) const {
+        using shape_t = trapezoid2D;
+
+        const auto loc = detail::bundle_to_local(glob, trf);
+        const scalar_t h0{mask[shape_t::e_half_length_0]};
+        const scalar_t slope{(mask[shape_t::e_half_length_1] - h0) *
+                             mask[shape_t::e_divisor]};
+        const value_t rel_y{mask[shape_t::e_half_length_2] + loc[1]};
+
+        return (detail::simd::abs(loc[0]) <= h0 + rel_y * slope + tol) &&
+               (detail::simd::abs(loc[1]) <=
+                mask[shape_t::e_half_length_2] + tol);
+    }
+};
+
+template <>
+struct ray_bundle_mask_check<ring2D> : public std::true_type {
+
+    template <typename value_t, typename mask_t, typename transform3_t,
+              typename scalar_t>
+    DETRAY_HOST_DEVICE inline auto operator()(const darray<value_t, 3> &glob,
+                                              const mask_t &mask,
+                                              const transform3_t &trf,
+                                              const scalar_t tol) const {
+        const auto loc = detail::bundle_to_local(glob, trf);
+        const value_t r{detail::simd::sqrt(loc[0] * loc[0] + loc[1] * loc[1])};
+
+        return (r + tol >= mask[ring2D::e_inner_r]) &&
+               (r <= mask[ring2D::e_outer_r] + tol);
+    }
+};
+
+template <>
+struct ray_bundle_mask_check<cylinder2D> : public std::true_type {
+
+    template <typename value_t, typename mask_t, typename transform3_t,
+              typename scalar_t>
+    DETRAY_HOST_DEVICE inline auto operator()(const darray<value_t, 3> &glob,
+                                              const mask_t &mask,
+                                              const transform3_t &trf,
+                                              const scalar_t tol) const {
+        const value_t z{detail::bundle_to_local(glob, trf)[2]};
+
+        return (mask[cylinder2D::e_n_half_z] - tol <= z) &&
+               (z <= mask[cylinder2D::e_p_half_z] + tol);
+    }
+};
+
+/// The concentric cylinder is not rotated, so only its translation counts
+template <>
+struct ray_bundle_mask_check<concentric_cylinder2D> : public std::true_type {
+
+    template <typename value_t, typename mask_t, typename transform3_t,
+              typename scalar_t>
+    DETRAY_HOST_DEVICE inline auto operator()(const darray<value_t, 3> &glob,
+                                              const mask_t &mask,
+                                              const transform3_t &trf,
+                                              const scalar_t tol) const {
+        using shape_t = concentric_cylinder2D;
+
+        const value_t z{glob[2] - trf.translation()[2]};
+
+        return (mask[shape_t::e_n_half_z] - tol <= z) &&
+               (z <= mask[shape_t::e_p_half_z] + tol);
+    }
+};
+
+/// The hit points are the points of closest approach to the line
+template <bool kSquareCrossSect>
+struct ray_bundle_mask_check<line<kSquareCrossSect>> : public std::true_type {
+
+    template <typename value_t, typename mask_t, typename transform3_t,
+              typename scalar_t>
+    DETRAY_HOST_DEVICE inline auto operator()(const darray<value_t, 3> &glob,
+                                              const mask_t &mask,
+                                              const transform3_t &trf,
+                                              const scalar_t tol) const {
+        using shape_t = line<kSquareCrossSect>;
+
+        const auto loc = detail::bundle_to_local(glob, trf);
+        const scalar_t max_r{mask[shape_t::e_cross_section] + tol};
+        const auto in_z =
+            (detail::simd::abs(loc[2]) <= mask[shape_t::e_half_z] + tol);
+
+        if constexpr (kSquareCrossSect) {
+            return (detail::simd::abs(loc[0]) <= max_r) &&
+                   (detail::simd::abs(loc[1]) <= max_r) && in_z;
+        } else {
+            return (loc[0] * loc[0] + loc[1] * loc[1] <= max_r * max_r) &&
+                   in_z;
+        }
+    }
+};
+
+template <typename shape_t>
+inline constexpr bool has_ray_bundle_mask_check_v =
+    ray_bundle_mask_check<shape_t>::value;
+
+}  // namespace detray
@@ -52,10 +52,10 @@ struct ray_concentric_cylinder_intersector {
     /// @param overstep_tol negative cutoff for the path
     ///
     /// @return the intersection
-    template <typename surface_descr_t, typename mask_t>
+    template <typename surface_descr_t, typename mask_t, typename transform3_t>
     DETRAY_HOST_DEVICE inline intersection_type<surface_descr_t> operator()(
         const ray_type &ray, const surface_descr_t &sf, const mask_t &mask,
-        const transform3_type & /*trf*/, const scalar_type mask_tolerance = 0.f,
+        const transform3_t & /*trf*/, const scalar_type mask_tolerance = 0.f,
         const scalar_type overstep_tol = 0.f) const {
 
         intersection_type<surface_descr_t> is;
@@ -122,9 +122,11 @@ struct ray_concentric_cylinder_intersector {
                     is.volume_link = mask.volume_link();
 
                     // Get incidence angle
-                    const vector3_type normal = {math::cos(phi), math::sin(phi),
-                                                 0.f};
-                    is.cos_incidence_angle = vector::dot(rd, normal);
+                    if constexpr (!intersection::lazy_incidence) {
+                        const vector3_type normal = {math::cos(phi),
+                                                     math::sin(phi), 0.f};
+                        is.cos_incidence_angle = vector::dot(rd, normal);
+                    }
                 }
             }
         }
@@ -142,10 +144,10 @@ struct ray_concentric_cylinder_intersector {
     /// @param trf is the surface placement transform
     /// @param mask_tolerance is the tolerance for mask edges
     /// @param overstep_tol negative cutoff for the path
-    template <typename surface_descr_t, typename mask_t>
+    template <typename surface_descr_t, typename mask_t, typename transform3_t>
     DETRAY_HOST_DEVICE inline void update(
         const ray_type &ray, intersection_type<surface_descr_t> &sfi,
-        const mask_t &mask, const transform3_type &trf,
+        const mask_t &mask, const transform3_t &trf,
         const scalar_type mask_tolerance = 0.f,
         const scalar_type overstep_tol = 0.f) const {
         sfi = this->operator()(ray, sfi.sf_desc, mask, trf, mask_tolerance,
@@ -8,10 +8,12 @@
 #pragma once
 
 // Project include(s)
+#include "detray/definitions/detail/containers.hpp"
 #include "detray/definitions/detail/math.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/geometry/coordinates/cylindrical2D.hpp"
 #include "detray/navigation/detail/ray.hpp"
+#include "detray/navigation/detail/ray_transform_cache.hpp"
 #include "detray/navigation/intersection/intersection.hpp"
 #include "detray/utils/invalid_values.hpp"
 #include "detray/utils/quadratic_equation.hpp"
@@ -53,40 +55,36 @@ struct ray_intersector_impl<cylindrical2D<algebra_t>, algebra_t> {
     /// @param overstep_tol negative cutoff for the path
     ///
     /// @return the intersections.
-    template <typename surface_descr_t, typename mask_t>
+    template <typename surface_descr_t, typename mask_t, typename transform3_t>
     DETRAY_HOST_DEVICE inline std::array<intersection_type<surface_descr_t>, 2>
     operator()(const ray_type &ray, const surface_descr_t &sf,
-               const mask_t &mask, const transform3_type &trf,
+               const mask_t &mask, const transform3_t &trf,
                const scalar_type mask_tolerance = 0.f,
                const scalar_type overstep_tol = 0.f) const {
 
-        // One or both of these solutions might be invalid
-        const auto qe = solve_intersection(ray, mask, trf);
+        return build_candidates(ray, sf, mask, trf,
+                                solve_intersection(ray, mask, trf),
+                                mask_tolerance, overstep_tol);
+    }
 
-        std::array<intersection_type<surface_descr_t>, 2> ret;
-        switch (qe.solutions()) {
-            case 2:
-                ret[1] = build_candidate<surface_descr_t>(
-                    ray, mask, trf, qe.larger(), mask_tolerance, overstep_tol);
-                ret[1].sf_desc = sf;
-                // If there are two solutions, reuse the case for a single
-                // solution to setup the intersection with the smaller path
-                // in ret[0]
-                [[fallthrough]];
-            case 1:
-                ret[0] = build_candidate<surface_descr_t>(
-                    ray, mask, trf, qe.smaller(), mask_tolerance, overstep_tol);
-                ret[0].sf_desc = sf;
-                break;
-            case 0:
-                ret[0].status = intersection::status::e_missed;
-                ret[1].status = intersection::status::e_missed;
-        };
+    /// Operator function to find intersections between a ray and a 2D
+    /// cylinder, which reuses the projection of the ray onto the cylinder
+    /// axis from @param trf_cache, if the previous surface had the same
+    /// transform.
+    ///
+    /// @return the intersections.
+    template <typename surface_descr_t, typename mask_t, typename transform3_t>
+    DETRAY_HOST_DEVICE inline std::array<intersection_type<surface_descr_t>, 2>
+    operator()(const ray_type &ray, const surface_descr_t &sf,
+               const mask_t &mask, const transform3_t &trf,
+               detail::ray_transform_cache<algebra_t> &trf_cache,
+               const scalar_type mask_tolerance = 0.f,
+               const scalar_type overstep_tol = 0.f) const {
 
-        // Even if there are two geometrically valid solutions, the smaller one
-        // might not be passed on if it is below the overstepping tolerance:
-        // see 'build_candidate'
-        return ret;
+        return build_candidates(ray, sf, mask, trf,
+                                solve_intersection(ray, sf, mask, trf,
+                                                   trf_cache),
+                                mask_tolerance, overstep_tol);
     }
 
     /// Operator function to find intersections between a ray and a 2D cylinder
@@ -99,10 +97,10 @@ struct ray_intersector_impl<cylindrical2D<algebra_t>, algebra_t> {
     /// @param trf is the surface placement transform
     /// @param mask_tolerance is the tolerance for mask edges
     /// @param overstep_tol negative cutoff for the path
-    template <typename surface_descr_t, typename mask_t>
+    template <typename surface_descr_t, typename mask_t, typename transform3_t>
     DETRAY_HOST_DEVICE inline void update(
         const ray_type &ray, intersection_type<surface_descr_t> &sfi,
-        const mask_t &mask, const transform3_type &trf,
+        const mask_t &mask, const transform3_t &trf,
         const scalar_type mask_tolerance = 0.f,
         const scalar_type overstep_tol = 0.f) const {
 
@@ -120,29 +118,103 @@ struct ray_intersector_impl<cylindrical2D<algebra_t>, algebra_t> {
     }
 
     protected:
+    /// Sets up the intersection candidates from the solutions @param qe of
+    /// the quadratic equation
+    template <typename surface_descr_t, typename mask_t, typename transform3_t>
+    DETRAY_HOST_DEVICE inline std::array<intersection_type<surface_descr_t>, 2>
+    build_candidates(const ray_type &ray, const surface_descr_t &sf,
+                     const mask_t &mask, const transform3_t &trf,
+                     const detail::quadratic_equation<scalar_type> &qe,
+                     const scalar_type mask_tolerance,
+                     const scalar_type overstep_tol) const {
+
+        std::array<intersection_type<surface_descr_t>, 2> ret;
+        switch (qe.solutions()) {
+            case 2:
+                ret[1] = build_candidate<surface_descr_t>(
+                    ray, mask, trf, qe.larger(), mask_tolerance, overstep_tol);
+                ret[1].sf_desc = sf;
+                // If there are two solutions, reuse the case for a single
+                // solution to setup the intersection with the smaller path
+                // in ret[0]
+                [[fallthrough]];
+            case 1:
+                ret[0] = build_candidate<surface_descr_t>(
+                    ray, mask, trf, qe.smaller(), mask_tolerance, overstep_tol);
+                ret[0].sf_desc = sf;
+                break;
+            case 0:
+                ret[0].status = intersection::status::e_missed;
+                ret[1].status = intersection::status::e_missed;
+        };
+
+        // Even if there are two geometrically valid solutions, the smaller one
+        // might not be passed on if it is below the overstepping tolerance:
+        // see 'build_candidate'
+        return ret;
+    }
+
     /// Calculates the distance to the (two) intersection points on the
     /// cylinder in global coordinates.
     ///
     /// @returns a quadratic equation object that contains the solution(s).
-    template <typename mask_t>
+    template <typename mask_t, typename transform3_t>
     DETRAY_HOST_DEVICE inline detail::quadratic_equation<scalar_type>
     solve_intersection(const ray_type &ray, const mask_t &mask,
-                       const transform3_type &trf) const {
+                       const transform3_t &trf) const {
         const scalar_type r{mask[mask_t::shape::e_r]};
-        const auto &m = trf.matrix();
-        const vector3_type sz = getter::vector<3>(m, 0u, 2u);
-        const vector3_type sc = getter::vector<3>(m, 0u, 3u);
+        const auto proj = project(ray, trf);
+
+        return detail::quadratic_equation<scalar_type>{proj[0], proj[1],
+                                                       proj[2] - (r * r)};
+    }
+
+    /// Calculates the distance to the (two) intersection points on the
+    /// cylinder, reusing the projection of the ray from @param trf_cache
+    ///
+    /// @returns a quadratic equation object that contains the solution(s).
+    template <typename surface_descr_t, typename mask_t, typename transform3_t>
+    DETRAY_HOST_DEVICE inline detail::quadratic_equation<scalar_type>
+    solve_intersection(
+        const ray_type &ray, const surface_descr_t &sf, const mask_t &mask,
+        const transform3_t &trf,
+        detail::ray_transform_cache<algebra_t> &trf_cache) const {
+
+        using projection_t =
+            typename detail::ray_transform_cache<algebra_t>::projection;
+
+        if (!trf_cache.contains(sf.transform(), projection_t::e_cylinder)) {
+            trf_cache.set(sf.transform(), projection_t::e_cylinder,
+                          project(ray, trf));
+        }
+
+        const scalar_type r{mask[mask_t::shape::e_r]};
+        const auto &proj = trf_cache.values();
+
+        return detail::quadratic_equation<scalar_type>{proj[0], proj[1],
+                                                       proj[2] - (r * r)};
+    }
+
+    /// Projects the ray onto the plane perpendicular to the cylinder axis
+    ///
+    /// @returns the coefficients of the quadratic equation, where the
+    /// squared cylinder radius still has to be subtracted from the last one
+    template <typename transform3_t>
+    DETRAY_HOST_DEVICE inline darray<scalar_type, 3> project(
+        const ray_type &ray, const transform3_t &trf) const {
+
+        const vector3_type sz = trf.z();
+        const vector3_type sc = trf.translation();
 
         const point3_type &ro = ray.pos();
         const vector3_type &rd = ray.dir();
 
         const auto pc_cross_sz = vector::cross(ro - sc, sz);
         const auto rd_cross_sz = vector::cross(rd, sz);
-        const scalar_type a{vector::dot(rd_cross_sz, rd_cross_sz)};
-        const scalar_type b{2.f * vector::dot(rd_cross_sz, pc_cross_sz)};
-        const scalar_type c{vector::dot(pc_cross_sz, pc_cross_sz) - (r * r)};
 
-        return detail::quadratic_equation<scalar_type>{a, b, c};
+        return {vector::dot(rd_cross_sz, rd_cross_sz),
+                2.f * vector::dot(rd_cross_sz, pc_cross_sz),
+                vector::dot(pc_cross_sz, pc_cross_sz)};
     }
 
     /// From the intersection path, construct an intersection candidate and
@@ -151,10 +223,10 @@ struct ray_intersector_impl<cylindrical2D<algebra_t>, algebra_t> {
     /// @returns the intersection candidate. Might be (partially) uninitialized
     /// if the overstepping tolerance is not met or the intersection lies
     /// outside of the mask.
-    template <typename surface_descr_t, typename mask_t>
+    template <typename surface_descr_t, typename mask_t, typename transform3_t>
     DETRAY_HOST_DEVICE inline intersection_type<surface_descr_t>
     build_candidate(const ray_type &ray, mask_t &mask,
-                    const transform3_type &trf, const scalar_type path,
+                    const transform3_t &trf, const scalar_type path,
                     const scalar_type mask_tolerance = 0.f,
                     const scalar_type overstep_tol = 0.f) const {
 
@@ -181,10 +253,12 @@ struct ray_intersector_impl<cylindrical2D<algebra_t>, algebra_t> {
                 is.volume_link = mask.volume_link();
 
                 // Get incidence angle
-                const scalar_type phi{is.local[0] / is.local[2]};
-                const vector3_type normal = {math::cos(phi), math::sin(phi),
-                                             0.f};
-                is.cos_incidence_angle = vector::dot(rd, normal);
+                if constexpr (!intersection::lazy_incidence) {
+                    const scalar_type phi{is.local[0] / is.local[2]};
+                    const vector3_type normal = {math::cos(phi),
+                                                 math::sin(phi), 0.f};
+                    is.cos_incidence_angle = vector::dot(rd, normal);
+                }
             }
         } else {
             is.status = intersection::status::e_missed;
@@ -13,6 +13,7 @@
 #include "detray/geometry/coordinates/concentric_cylindrical2D.hpp"
 #include "detray/geometry/coordinates/cylindrical2D.hpp"
 #include "detray/navigation/detail/ray.hpp"
+#include "detray/navigation/detail/ray_transform_cache.hpp"
 #include "detray/navigation/intersection/intersection.hpp"
 #include "detray/navigation/intersection/ray_cylinder_intersector.hpp"
 #include "detray/utils/quadratic_equation.hpp"
@@ -59,32 +60,34 @@ struct ray_intersector_impl<concentric_cylindrical2D<algebra_t>, algebra_t>
     /// @param overstep_tol negative cutoff for the path
     ///
     /// @return the closest intersection
-    template <typename surface_descr_t, typename mask_t>
+    template <typename surface_descr_t, typename mask_t, typename transform3_t>
     DETRAY_HOST_DEVICE inline intersection_type<surface_descr_t> operator()(
         const ray_type &ray, const surface_descr_t &sf, const mask_t &mask,
-        const transform3_type &trf, const scalar_type mask_tolerance = 0.f,
+        const transform3_t &trf, const scalar_type mask_tolerance = 0.f,
         const scalar_type overstep_tol = 0.f) const {
 
-        intersection_type<surface_descr_t> is;
-
-        // Intersecting the cylinder from the inside yield one intersection
-        // along the direction of the track and one behind it
-        const auto qe = this->solve_intersection(ray, mask, trf);
+        return build_closest(ray, sf, mask, trf,
+                             this->solve_intersection(ray, mask, trf),
+                             mask_tolerance, overstep_tol);
+    }
 
-        // Find the closest valid intersection
-        if (qe.solutions() > 0 and qe.larger() > overstep_tol) {
-            // Only the closest intersection that is outside the overstepping
-            // tolerance is needed
-            const scalar_type t{(qe.smaller() > overstep_tol) ? qe.smaller()
-                                                              : qe.larger()};
-            is = this->template build_candidate<surface_descr_t>(
-                ray, mask, trf, t, mask_tolerance, overstep_tol);
-            is.sf_desc = sf;
-        } else {
-            is.status = intersection::status::e_missed;
-        }
+    /// Operator function to find intersections between ray and cylinder mask,
+    /// which reuses the projection of the ray onto the cylinder axis from
+    /// @param trf_cache, if the previous surface had the same transform.
+    ///
+    /// @return the closest intersection
+    template <typename surface_descr_t, typename mask_t, typename transform3_t>
+    DETRAY_HOST_DEVICE inline intersection_type<surface_descr_t> operator()(
+        const ray_type &ray, const surface_descr_t &sf, const mask_t &mask,
+        const transform3_t &trf,
+        detail::ray_transform_cache<algebra_t> &trf_cache,
+        const scalar_type mask_tolerance = 0.f,
+        const scalar_type overstep_tol = 0.f) const {
 
-        return is;
+        return build_closest(
+            ray, sf, mask, trf,
+            this->solve_intersection(ray, sf, mask, trf, trf_cache),
+            mask_tolerance, overstep_tol);
     }
 
     /// Operator function to find intersections between a ray and a 2D cylinder
@@ -97,15 +100,46 @@ struct ray_intersector_impl<concentric_cylindrical2D<algebra_t>, algebra_t>
     /// @param trf is the surface placement transform
     /// @param mask_tolerance is the tolerance for mask edges
     /// @param overstep_tol negative cutoff for the path
-    template <typename surface_descr_t, typename mask_t>
+    template <typename surface_descr_t, typename mask_t, typename transform3_t>
     DETRAY_HOST_DEVICE inline void update(
         const ray_type &ray, intersection_type<surface_descr_t> &sfi,
-        const mask_t &mask, const transform3_type &trf,
+        const mask_t &mask, const transform3_t &trf,
         const scalar_type mask_tolerance = 0.f,
         const scalar_type overstep_tol = 0.f) const {
         sfi = this->operator()(ray, sfi.sf_desc, mask, trf, mask_tolerance,
                                overstep_tol);
     }
+
+    private:
+    /// Sets up the closest intersection candidate from the solutions @param qe
+    /// of the quadratic equation
+    template <typename surface_descr_t, typename mask_t, typename transform3_t>
+    DETRAY_HOST_DEVICE inline intersection_type<surface_descr_t>
+    build_closest(const ray_type &ray, const surface_descr_t &sf,
+                  const mask_t &mask, const transform3_t &trf,
+                  const detail::quadratic_equation<scalar_type> &qe,
+                  const scalar_type mask_tolerance,
+                  const scalar_type overstep_tol) const {
+
+        intersection_type<surface_descr_t> is;
+
+        // Intersecting the cylinder from the inside yield one intersection
+        // along the direction of the track and one behind it: Find the
+        // closest valid intersection
+        if (qe.solutions() > 0 and qe.larger() > overstep_tol) {
+            // Only the closest intersection that is outside the overstepping
+            // tolerance is needed
+            const scalar_type t{(qe.smaller() > overstep_tol) ? qe.smaller()
+                                                              : qe.larger()};
+            is = this->template build_candidate<surface_descr_t>(
+                ray, mask, trf, t, mask_tolerance, overstep_tol);
+            is.sf_desc = sf;
+        } else {
+            is.status = intersection::status::e_missed;
+        }
+
+        return is;
+    }
 };
 
 }  // namespace detray
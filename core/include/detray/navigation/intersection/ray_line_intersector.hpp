@@ -48,16 +48,16 @@ struct ray_intersector_impl<line2D<algebra_t>, algebra_t> {
     /// @param overstep_tol negative cutoff for the path
     //
     /// @return the intersection
-    template <typename surface_descr_t, typename mask_t>
+    template <typename surface_descr_t, typename mask_t, typename transform3_t>
     DETRAY_HOST_DEVICE inline intersection_type<surface_descr_t> operator()(
         const ray_type &ray, const surface_descr_t &sf, const mask_t &mask,
-        const transform3_type &trf, const scalar_type mask_tolerance = 0.f,
+        const transform3_t &trf, const scalar_type mask_tolerance = 0.f,
         const scalar_type overstep_tol = 0.f) const {
 
         intersection_type<surface_descr_t> is;
 
         // line direction
-        const vector3_type _z = getter::vector<3>(trf.matrix(), 0u, 2u);
+        const vector3_type _z = trf.z();
 
         // line center
         const point3_type _t = trf.translation();
@@ -129,10 +129,10 @@ struct ray_intersector_impl<line2D<algebra_t>, algebra_t> {
     /// @param trf is the surface placement transform
     /// @param mask_tolerance is the tolerance for mask edges
     /// @param overstep_tol negative cutoff for the path
-    template <typename surface_descr_t, typename mask_t>
+    template <typename surface_descr_t, typename mask_t, typename transform3_t>
     DETRAY_HOST_DEVICE inline void update(
         const ray_type &ray, intersection_type<surface_descr_t> &sfi,
-        const mask_t &mask, const transform3_type &trf,
+        const mask_t &mask, const transform3_t &trf,
         const scalar_type mask_tolerance = 0.f,
         const scalar_type overstep_tol = 0.f) const {
 
@@ -0,0 +1,227 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/navigation/detail/ray.hpp"
+#include "detray/navigation/intersection/intersection.hpp"
+#include "detray/utils/invalid_values.hpp"
+
+// System include(s)
+#include <cassert>
+#include <cstddef>
+
+namespace detray {
+
+/// @brief A number of surfaces that are intersected together
+///
+/// All surfaces in the batch are expected to have a mask of the same type,
+/// so that they can be handled by a single visit of the mask store.
+///
+/// @tparam surface_t the surface descriptor type
+/// @tparam kWIDTH the maximal number of surfaces in the batch
+template <typename surface_t, std::size_t kWIDTH = 8u>
+class surface_batch {
+
+    static_assert(kWIDTH > 0u, "Width of surface batch has to be > 0");
+
+    public:
+    using value_type = surface_t;
+    using size_type = std::size_t;
+
+    /// Default constructor: empty batch
+    constexpr surface_batch() = default;
+
+    /// @returns the compile-time capacity
+    DETRAY_HOST_DEVICE
+    static constexpr size_type capacity() { return kWIDTH; }
+
+    /// @returns the number of surfaces in the batch
+    DETRAY_HOST_DEVICE
+    constexpr size_type size() const { return m_size; }
+
+    /// @returns true if the batch holds no surfaces
+    DETRAY_HOST_DEVICE
+    constexpr bool empty() const { return m_size == 0u; }
+
+    /// @returns true if no further surface can be added
+    DETRAY_HOST_DEVICE
+    constexpr bool full() const { return m_size == kWIDTH; }
+
+    /// Remove all surfaces
+    DETRAY_HOST_DEVICE
+    constexpr void clear() { m_size = 0u; }
+
+    /// Add the surface @param sf
+    ///
+    /// @returns false if the batch is full and the surface was dropped
+    DETRAY_HOST_DEVICE
+    constexpr bool push_back(const surface_t &sf) {
+        if (full()) {
+            return false;
+        }
+        m_surfaces[m_size++] = sf;
+        return true;
+    }
+
+    /// @returns the surface at position @param i
+    DETRAY_HOST_DEVICE
+    constexpr const surface_t &operator[](const size_type i) const {
+        assert(i < m_size);
+        return m_surfaces[i];
+    }
+
+    private:
+    /// Number of surfaces in the batch
+    size_type m_size{0u};
+    /// The surface descriptors
+    darray<surface_t, kWIDTH> m_surfaces{};
+};
+
+/// @brief Intersects a single ray with a batch of planar surfaces.
+///
+/// The placements of the planes are loaded into a structure-of-arrays
+/// (translation, local axes and normal per coordinate), after which the path
+/// lengths, the local positions and the incidence angles are computed for all
+/// planes in a single branch-free loop that the compiler can vectorize. The
+/// masks are not evaluated here: The caller checks the reachable
+/// intersections against the masks afterwards.
+///
+/// @note Only valid for surfaces with a local 2D cartesian frame (e.g.
+/// rectangles and trapezoids), where the local position is the projection
+/// onto the local axes of the plane.
+///
+/// @tparam algebra_t the linear algebra implementation
+/// @tparam kWIDTH the maximal number of planes in a batch
+template <typename algebra_t, std::size_t kWIDTH = 8u>
+struct ray_plane_batch_intersector {
+
+    /// linear algebra types
+    /// @{
+    using scalar_type = dscalar<algebra_t>;
+    using point3_type = dpoint3D<algebra_t>;
+    using vector3_type = dvector3D<algebra_t>;
+    /// @}
+
+    using ray_type = detail::ray<algebra_t>;
+
+    template <typename T>
+    using array_type = darray<T, kWIDTH>;
+
+    /// Plane placements in structure-of-arrays layout
+    struct plane_batch {
+        /// Translations
+        array_type<scalar_type> t0{};
+        array_type<scalar_type> t1{};
+        array_type<scalar_type> t2{};
+        /// Local x-axes
+        array_type<scalar_type> x0{};
+        array_type<scalar_type> x1{};
+        array_type<scalar_type> x2{};
+        /// Local y-axes
+        array_type<scalar_type> y0{};
+        array_type<scalar_type> y1{};
+        array_type<scalar_type> y2{};
+        /// Normals (local z-axes)
+        array_type<scalar_type> n0{};
+        array_type<scalar_type> n1{};
+        array_type<scalar_type> n2{};
+        /// Number of planes in the batch
+        std::size_t size{0u};
+
+        /// Add the placement @param trf of a plane
+        template <typename transform3_t>
+        DETRAY_HOST_DEVICE constexpr void push_back(const transform3_t &trf) {
+            assert(size < kWIDTH);
+            const vector3_type t = trf.translation();
+            const vector3_type x = trf.x();
+            const vector3_type y = trf.y();
+            const vector3_type z = trf.z();
+
+            t0[size] = t[0];
+            t1[size] = t[1];
+            t2[size] = t[2];
+            x0[size] = x[0];
+            x1[size] = x[1];
+            x2[size] = x[2];
+            y0[size] = y[0];
+            y1[size] = y[1];
+            y2[size] = y[2];
+            n0[size] = z[0];
+            n1[size] = z[1];
+            n2[size] = z[2];
+            ++size;
+        }
+    };
+
+    /// Intersection results in structure-of-arrays layout
+    struct result_batch {
+        /// Path lengths
+        array_type<scalar_type> path{};
+        /// Local positions
+        array_type<scalar_type> loc0{};
+        array_type<scalar_type> loc1{};
+        /// Cosines of the incidence angles
+        array_type<scalar_type> cos_incidence_angle{};
+        /// Whether the plane can be reached (not parallel or behind)
+        array_type<bool> is_reachable{};
+    };
+
+    /// Intersect the ray @param ray with all planes in @param planes
+    ///
+    /// @param overstep_tol negative cutoff for the path
+    ///
+    /// @returns the results for the first @c planes.size entries
+    DETRAY_HOST_DEVICE inline result_batch operator()(
+        const ray_type &ray, const plane_batch &planes,
+        const scalar_type overstep_tol = 0.f) const {
+
+        result_batch res{};
+
+        const point3_type &ro = ray.pos();
+        const vector3_type &rd = ray.dir();
+
+        for (std::size_t i = 0u; i < planes.size; ++i) {
+            // Distance of the ray origin to the plane position
+            const scalar_type d0{planes.t0[i] - ro[0]};
+            const scalar_type d1{planes.t1[i] - ro[1]};
+            const scalar_type d2{planes.t2[i] - ro[2]};
+
+            const scalar_type denom{rd[0] * planes.n0[i] +
+                                    rd[1] * planes.n1[i] +
+                                    rd[2] * planes.n2[i]};
+            const scalar_type num{d0 * planes.n0[i] + d1 * planes.n1[i] +
+                                  d2 * planes.n2[i]};
+
+            const bool is_parallel{denom == 0.f};
+            const scalar_type s{is_parallel ? 0.f : num / denom};
+
+            // Intersection point relative to the plane position
+            const scalar_type p0{s * rd[0] - d0};
+            const scalar_type p1{s * rd[1] - d1};
+            const scalar_type p2{s * rd[2] - d2};
+
+            res.path[i] =
+                is_parallel ? detail::invalid_value<scalar_type>() : s;
+            res.loc0[i] =
+                p0 * planes.x0[i] + p1 * planes.x1[i] + p2 * planes.x2[i];
+            res.loc1[i] =
+                p0 * planes.y0[i] + p1 * planes.y1[i] + p2 * planes.y2[i];
+            res.cos_incidence_angle[i] = math::abs(denom);
+            res.is_reachable[i] = !is_parallel && (s >= overstep_tol);
+        }
+
+        return res;
+    }
+};
+
+}  // namespace detray
@@ -8,11 +8,13 @@
 #pragma once
 
 // Project include(s)
+#include "detray/definitions/detail/containers.hpp"
 #include "detray/definitions/detail/math.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/geometry/coordinates/cartesian2D.hpp"
 #include "detray/geometry/coordinates/polar2D.hpp"
 #include "detray/navigation/detail/ray.hpp"
+#include "detray/navigation/detail/ray_transform_cache.hpp"
 #include "detray/navigation/intersection/intersection.hpp"
 
 // System include(s)
@@ -52,26 +54,103 @@ struct ray_intersector_impl<cartesian2D<algebra_t>, algebra_t> {
     /// @param overstep_tol negative cutoff for the path
     ///
     /// @return the intersection
-    template <typename surface_descr_t, typename mask_t>
+    template <typename surface_descr_t, typename mask_t, typename transform3_t>
     DETRAY_HOST_DEVICE inline intersection_type<surface_descr_t> operator()(
         const ray_type &ray, const surface_descr_t &sf, const mask_t &mask,
-        const transform3_type &trf, const scalar_type mask_tolerance = 0.f,
+        const transform3_t &trf, const scalar_type mask_tolerance = 0.f,
         const scalar_type overstep_tol = 0.f) const {
 
-        intersection_type<surface_descr_t> is;
+        const auto proj = project(ray, trf);
+
+        return build_candidate(ray, sf, mask, trf, proj[0], proj[1],
+                               mask_tolerance, overstep_tol);
+    }
+
+    /// Operator function to find intersections between ray and planar mask,
+    /// which reuses the projection of the ray onto the surface placement
+    /// from @param trf_cache, if the previous surface had the same transform.
+    ///
+    /// @return the intersection
+    template <typename surface_descr_t, typename mask_t, typename transform3_t>
+    DETRAY_HOST_DEVICE inline intersection_type<surface_descr_t> operator()(
+        const ray_type &ray, const surface_descr_t &sf, const mask_t &mask,
+        const transform3_t &trf,
+        detail::ray_transform_cache<algebra_t> &trf_cache,
+        const scalar_type mask_tolerance = 0.f,
+        const scalar_type overstep_tol = 0.f) const {
+
+        using projection_t =
+            typename detail::ray_transform_cache<algebra_t>::projection;
+
+        if (!trf_cache.contains(sf.transform(), projection_t::e_plane)) {
+            const auto proj = project(ray, trf);
+            trf_cache.set(sf.transform(), projection_t::e_plane,
+                          {proj[0], proj[1], 0.f});
+        }
+        const auto &proj = trf_cache.values();
+
+        return build_candidate(ray, sf, mask, trf, proj[0], proj[1],
+                               mask_tolerance, overstep_tol);
+    }
+
+
+    /// Operator function to updtae an intersections between a ray and a planar
+    /// surface.
+    ///
+    /// @tparam mask_t is the input mask type
+    ///
+    /// @param ray is the input ray trajectory
+    /// @param sfi the intersection to be updated
+    /// @param mask is the input mask that defines the surface extent
+    /// @param trf is the surface placement transform
+    /// @param mask_tolerance is the tolerance for mask edges
+    /// @param overstep_tol negative cutoff for the path
+    template <typename surface_descr_t, typename mask_t, typename transform3_t>
+    DETRAY_HOST_DEVICE inline void update(
+        const ray_type &ray, intersection_type<surface_descr_t> &sfi,
+        const mask_t &mask, const transform3_t &trf,
+        const scalar_type mask_tolerance = 0.f,
+        const scalar_type overstep_tol = 0.f) const {
+        sfi = this->operator()(ray, sfi.sf_desc, mask, trf, mask_tolerance,
+                               overstep_tol);
+    }
+
+    protected:
+    /// Projects the ray onto the surface normal of the placement @param trf
+    ///
+    /// @returns the projection of the ray direction and of the distance
+    /// between ray origin and surface onto the normal.
+    template <typename transform3_t>
+    DETRAY_HOST_DEVICE inline darray<scalar_type, 2> project(
+        const ray_type &ray, const transform3_t &trf) const {
 
         // Retrieve the surface normal & translation (context resolved)
-        const auto &sm = trf.matrix();
-        const vector3_type sn = getter::vector<3>(sm, 0u, 2u);
-        const vector3_type st = getter::vector<3>(sm, 0u, 3u);
+        const vector3_type sn = trf.z();
+        const vector3_type st = trf.translation();
+
+        return {vector::dot(ray.dir(), sn), vector::dot(sn, st - ray.pos())};
+    }
+
+    /// From the projection of the ray onto the surface normal, construct an
+    /// intersection candidate and check it against the surface boundaries.
+    ///
+    /// @returns the intersection candidate.
+    template <typename surface_descr_t, typename mask_t, typename transform3_t>
+    DETRAY_HOST_DEVICE inline intersection_type<surface_descr_t>
+    build_candidate(const ray_type &ray, const surface_descr_t &sf,
+                    const mask_t &mask, const transform3_t &trf,
+                    const scalar_type denom, const scalar_type dist,
+                    const scalar_type mask_tolerance,
+                    const scalar_type overstep_tol) const {
+
+        intersection_type<surface_descr_t> is;
 
         // Intersection code
         const point3_type &ro = ray.pos();
         const vector3_type &rd = ray.dir();
-        const scalar_type denom = vector::dot(rd, sn);
         // this is dangerous
         if (denom != 0.f) {
-            is.path = vector::dot(sn, st - ro) / denom;
+            is.path = dist / denom;
 
             // Intersection is valid for navigation - continue
             if (is.path >= overstep_tol) {
@@ -100,27 +179,6 @@ struct ray_intersector_impl<cartesian2D<algebra_t>, algebra_t> {
 
         return is;
     }
-
-    /// Operator function to updtae an intersections between a ray and a planar
-    /// surface.
-    ///
-    /// @tparam mask_t is the input mask type
-    ///
-    /// @param ray is the input ray trajectory
-    /// @param sfi the intersection to be updated
-    /// @param mask is the input mask that defines the surface extent
-    /// @param trf is the surface placement transform
-    /// @param mask_tolerance is the tolerance for mask edges
-    /// @param overstep_tol negative cutoff for the path
-    template <typename surface_descr_t, typename mask_t>
-    DETRAY_HOST_DEVICE inline void update(
-        const ray_type &ray, intersection_type<surface_descr_t> &sfi,
-        const mask_t &mask, const transform3_type &trf,
-        const scalar_type mask_tolerance = 0.f,
-        const scalar_type overstep_tol = 0.f) const {
-        sfi = this->operator()(ray, sfi.sf_desc, mask, trf, mask_tolerance,
-                               overstep_tol);
-    }
 };
 
 template <typename algebra_t>
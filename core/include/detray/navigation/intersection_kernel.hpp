@@ -9,9 +9,17 @@
 
 // Project include(s)
 #include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/geometry/coordinates/cartesian2D.hpp"
+#include "detray/navigation/detail/plane_record.hpp"
+#include "detray/navigation/detail/ray.hpp"
 #include "detray/navigation/intersection/intersection.hpp"
+#include "detray/navigation/intersection/ray_plane_batch_intersector.hpp"
 #include "detray/utils/ranges.hpp"
 
+// System include(s)
+#include <cstddef>
+#include <type_traits>
+
 namespace detray {
 
 /// A functor to add all valid intersections between the trajectory and surface
@@ -31,7 +39,8 @@ struct intersection_initialize {
     /// @param is_container is the intersection container to be filled
     /// @param traj is the input trajectory
     /// @param surface is the input surface
-    /// @param contextual_transforms is the input transform container
+    /// @param contextual_transforms is the input transform container (can
+    ///        provide plane records, see @c detail::plane_record_transforms )
     /// @param mask_tolerance is the tolerance for mask size
     /// @param overstep_tol negative cutoff for the path
     ///
@@ -47,25 +56,184 @@ struct intersection_initialize {
         const scalar_t mask_tolerance = 0.f,
         const scalar_t overstep_tol = 0.f) const {
 
+        using mask_t = typename mask_group_t::value_type;
+
+        intersect_masks(mask_group, mask_range, is_container, traj, surface,
+                        detail::placement<mask_t, traj_t>(
+                            contextual_transforms, surface.transform()),
+                        mask_tolerance, overstep_tol);
+    }
+
+    /// Operator function to initalize intersections, which reuses the
+    /// projection of the trajectory onto the surface placement, if the
+    /// previous surface that was intersected shares the transform
+    ///
+    /// @param trf_cache holds the projection onto the last placement. Must
+    ///                  only be used for a single trajectory
+    ///
+    /// @see the operator function above for the other parameters
+    template <typename mask_group_t, typename mask_range_t,
+              typename is_container_t, typename traj_t, typename surface_t,
+              typename transform_container_t, typename scalar_t,
+              typename trf_cache_t>
+    DETRAY_HOST_DEVICE inline void operator()(
+        const mask_group_t &mask_group, const mask_range_t &mask_range,
+        is_container_t &is_container, const traj_t &traj,
+        const surface_t &surface,
+        const transform_container_t &contextual_transforms,
+        const scalar_t mask_tolerance, const scalar_t overstep_tol,
+        trf_cache_t &trf_cache) const {
+
+        using mask_t = typename mask_group_t::value_type;
+        using intersector_type =
+            intersector_t<typename mask_t::shape,
+                          typename mask_t::algebra_type>;
+
+        const auto &ctf = detail::placement<mask_t, traj_t>(
+            contextual_transforms, surface.transform());
+
+        // Not every intersector can make use of the cache
+        if constexpr (std::is_invocable_v<intersector_type, const traj_t &,
+                                          const surface_t &, const mask_t &,
+                                          decltype(ctf), trf_cache_t &,
+                                          scalar_t, scalar_t>) {
+            intersect_masks(mask_group, mask_range, is_container, traj,
+                            surface, ctf, mask_tolerance, overstep_tol,
+                            trf_cache);
+        } else {
+            intersect_masks(mask_group, mask_range, is_container, traj,
+                            surface, ctf, mask_tolerance, overstep_tol);
+        }
+    }
+
+    /// Operator function to initalize the intersections with a batch of
+    /// surfaces that share the mask type
+    ///
+    /// Rays and surfaces with a local 2D cartesian frame (rectangles,
+    /// trapezoids) are intersected with the batched plane intersector, all
+    /// other combinations fall back to one surface at a time.
+    ///
+    /// @param mask_group is the input mask group (visited by mask id)
+    /// @param batch the surfaces to be intersected
+    /// @param is_container is the intersection container to be filled
+    /// @param traj is the input trajectory
+    /// @param contextual_transforms is the input transform container
+    /// @param mask_tolerance is the tolerance for mask size
+    /// @param overstep_tol negative cutoff for the path
+    template <typename mask_group_t, typename surface_t, std::size_t kWIDTH,
+              typename is_container_t, typename traj_t,
+              typename transform_container_t, typename scalar_t>
+    DETRAY_HOST_DEVICE inline void operator()(
+        const mask_group_t &mask_group,
+        const surface_batch<surface_t, kWIDTH> &batch,
+        is_container_t &is_container, const traj_t &traj,
+        const transform_container_t &contextual_transforms,
+        const scalar_t mask_tolerance, const scalar_t overstep_tol) const {
+
         using mask_t = typename mask_group_t::value_type;
         using algebra_t = typename mask_t::algebra_type;
+        using frame_t = typename mask_t::local_frame_type;
+
+        if constexpr (std::is_same_v<frame_t, cartesian2D<algebra_t>> &&
+                      std::is_same_v<traj_t, detail::ray<algebra_t>>) {
+
+            using batch_intersector_t =
+                ray_plane_batch_intersector<algebra_t, kWIDTH>;
+            using intersection_t = typename is_container_t::value_type;
+            using point3_t = typename mask_t::point3_type;
+
+            // Load the placements of all planes first
+            typename batch_intersector_t::plane_batch planes{};
+            for (std::size_t i = 0u; i < batch.size(); ++i) {
+                planes.push_back(detail::placement<mask_t, traj_t>(
+                    contextual_transforms, batch[i].transform()));
+            }
+
+            const auto res = batch_intersector_t{}(traj, planes, overstep_tol);
 
-        const auto &ctf = contextual_transforms[surface.transform()];
+            // Check the masks of the reachable planes
+            for (std::size_t i = 0u; i < batch.size(); ++i) {
+                if (!res.is_reachable[i]) {
+                    continue;
+                }
+                const point3_t loc{res.loc0[i], res.loc1[i], 0.f};
 
-        // Run over the masks that belong to the surface (only one can be hit)
-        for (const auto &mask :
-             detray::ranges::subrange(mask_group, mask_range)) {
+                for (const auto &mask : detray::ranges::subrange(
+                         mask_group, batch[i].mask().index())) {
 
-            if (place_in_collection(
-                    intersector_t<typename mask_t::shape, algebra_t>{}(
-                        traj, surface, mask, ctf, mask_tolerance, overstep_tol),
-                    is_container)) {
-                return;
-            };
+                    if (mask.is_inside(loc, mask_tolerance) ==
+                        intersection::status::e_inside) {
+                        intersection_t sfi{};
+                        sfi.sf_desc = batch[i];
+                        sfi.path = res.path[i];
+                        sfi.local = loc;
+                        sfi.status = intersection::status::e_inside;
+                        sfi.direction =
+                            detail::signbit(sfi.path)
+                                ? intersection::direction::e_opposite
+                                : intersection::direction::e_along;
+                        sfi.volume_link = mask.volume_link();
+                        sfi.cos_incidence_angle = res.cos_incidence_angle[i];
+
+                        is_container.push_back(sfi);
+                        break;
+                    }
+                }
+            }
+        } else {
+            for (std::size_t i = 0u; i < batch.size(); ++i) {
+                (*this)(mask_group, batch[i].mask().index(), is_container,
+                        traj, batch[i], contextual_transforms, mask_tolerance,
+                        overstep_tol);
+            }
         }
     }
 
     private:
+    /// Intersect the masks of a surface and add the first valid
+    /// intersection(s) to the container. The placement cache is optional.
+    template <typename mask_group_t, typename mask_range_t,
+              typename is_container_t, typename traj_t, typename surface_t,
+              typename transform3_t, typename scalar_t,
+              typename... trf_cache_t>
+    DETRAY_HOST_DEVICE inline void intersect_masks(
+        const mask_group_t &mask_group, const mask_range_t &mask_range,
+        is_container_t &is_container, const traj_t &traj,
+        const surface_t &surface, const transform3_t &ctf,
+        const scalar_t mask_tolerance, const scalar_t overstep_tol,
+        trf_cache_t &...trf_cache) const {
+
+        using mask_t = typename mask_group_t::value_type;
+        using algebra_t = typename mask_t::algebra_type;
+
+        using intersector_type =
+            intersector_t<typename mask_t::shape, algebra_t>;
+
+        const auto masks = detray::ranges::subrange(mask_group, mask_range);
+
+        if constexpr (mask_t::is_unbounded) {
+            // All masks of the surface contain the intersection: Only the
+            // first one needs to be tested
+            place_in_collection(
+                intersector_type{}(traj, surface, *masks.begin(), ctf,
+                                   trf_cache..., mask_tolerance, overstep_tol),
+                is_container);
+        } else {
+            // Run over the masks that belong to the surface (only one can be
+            // hit)
+            for (const auto &mask : masks) {
+
+                if (place_in_collection(
+                        intersector_type{}(traj, surface, mask, ctf,
+                                           trf_cache..., mask_tolerance,
+                                           overstep_tol),
+                        is_container)) {
+                    return;
+                };
+            }
+        }
+    }
+
     template <typename is_container_t>
     DETRAY_HOST_DEVICE bool place_in_collection(
         typename is_container_t::value_type &&sfi,
@@ -129,21 +297,33 @@ struct intersection_update {
         using mask_t = typename mask_group_t::value_type;
         using algebra_t = typename mask_t::algebra_type;
 
-        const auto &ctf = contextual_transforms[sfi.sf_desc.transform()];
+        using intersector_type =
+            intersector_t<typename mask_t::shape, algebra_t>;
+
+        const auto &ctf = detail::placement<mask_t, traj_t>(
+            contextual_transforms, sfi.sf_desc.transform());
+        const auto masks = detray::ranges::subrange(mask_group, mask_range);
 
-        // Run over the masks that belong to the surface
-        for (const auto &mask :
-             detray::ranges::subrange(mask_group, mask_range)) {
+        if constexpr (mask_t::is_unbounded) {
+            // All masks of the surface contain the intersection
+            intersector_type{}.update(traj, sfi, *masks.begin(), ctf,
+                                      mask_tolerance, overstep_tol);
 
-            intersector_t<typename mask_t::shape, algebra_t>{}.update(
-                traj, sfi, mask, ctf, mask_tolerance, overstep_tol);
+            return (sfi.status == intersection::status::e_inside);
+        } else {
+            // Run over the masks that belong to the surface
+            for (const auto &mask : masks) {
 
-            if (sfi.status == intersection::status::e_inside) {
-                return true;
+                intersector_type{}.update(traj, sfi, mask, ctf, mask_tolerance,
+                                          overstep_tol);
+
+                if (sfi.status == intersection::status::e_inside) {
+                    return true;
+                }
             }
-        }
 
-        return false;
+            return false;
+        }
     }
 };
 
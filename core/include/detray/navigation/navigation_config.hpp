@@ -9,7 +9,15 @@
 
 // Project include(s)
 #include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/definitions/units.hpp"
+#include "detray/utils/invalid_values.hpp"
+#include "detray/utils/static_vector.hpp"
+
+// System include(s)
+#include <array>
+#include <cstddef>
+#include <cstdint>
 
 namespace detray::navigation {
 
@@ -21,17 +29,168 @@ enum class trust_level {
     e_full = 4   ///< don't update anything
 };
 
+/// How to order the candidates after they have been (re-)evaluated
+enum class candidate_ordering : std::uint_least8_t {
+    e_full_sort = 0,  ///< sort all candidates
+    e_insertion = 1,  ///< insertion sort (cheap for almost sorted caches)
+    e_k_nearest = 2,  ///< only select and sort the k nearest candidates
+    e_adaptive = 3    ///< pick the sort by candidate count and presortedness
+};
+
+/// Maximal number of volumes that can have their own navigation settings
+inline constexpr std::size_t k_max_volume_configs{8u};
+
+/// Navigation settings that can be overwritten for a single volume
+template <typename scalar_t>
+struct volume_config {
+    /// Index of the volume in the detector volume container
+    dindex volume{detail::invalid_value<dindex>()};
+    /// Tolerance on the masks 'is_inside' check
+    scalar_t mask_tolerance{15.f * unit<scalar_t>::um};
+    /// How far behind the track position to look for candidates
+    scalar_t overstep_tolerance{-100.f * unit<scalar_t>::um};
+    /// Search window size for grid based acceleration structures
+    std::array<dindex, 2> search_window = {0u, 0u};
+    /// Visit every surface of a neighborhood search only once, even if it
+    /// is found in multiple bins of the search window
+    bool unique_candidates{false};
+    /// Path length along the track direction that the grid search covers
+    scalar_t search_path_length{0.f};
+    /// Only intersect the portals through which the track can exit the volume
+    bool analytic_portal_exit{false};
+    /// Don't intersect passive surfaces that carry no material
+    bool skip_empty_passives{false};
+    /// Only intersect the portals that the grids hold in the bin of the track
+    bool binned_portals{false};
+};
+
 /// Navigation configuration
 template <typename scalar_t>
 struct config {
     /// Tolerance on the masks 'is_inside' check
     scalar_t mask_tolerance{15.f * unit<scalar_t>::um};
+    /// Widen the mask tolerance of a volume to the sagitta of the track over
+    /// the step size, if the sagitta is larger (the fixed or per-volume
+    /// value above remains the lower bound)
+    bool adaptive_mask_tolerance{false};
+    /// Upper bound of the adaptive mask tolerance
+    scalar_t max_mask_tolerance{1.f * unit<scalar_t>::mm};
     /// Maximal absolute path distance for a track to be considered 'on surface'
     scalar_t on_surface_tolerance{1.f * unit<scalar_t>::um};
     /// How far behind the track position to look for candidates
     scalar_t overstep_tolerance{-100.f * unit<scalar_t>::um};
+    /// If a step passed the candidates beyond the overstep tolerance, look
+    /// this far behind the track for them again and step back, before the
+    /// volume is re-initialized (zero: no recovery)
+    scalar_t overstep_recovery_tolerance{0.f};
     /// Search window size for grid based acceleration structures
     std::array<dindex, 2> search_window = {0u, 0u};
+    /// Visit every surface of a neighborhood search only once, even if it
+    /// is found in multiple bins of the search window (surfaces that span
+    /// several grid bins are intersected only once)
+    bool unique_candidates{false};
+    /// Path length along the track direction that the grid search covers: The
+    /// search window is placed around every bin that the tangent ray passes
+    /// through on this path (zero: search window around the track position)
+    scalar_t search_path_length{0.f};
+    /// How to order the candidates in the navigation cache
+    candidate_ordering ordering{candidate_ordering::e_full_sort};
+    /// Number of candidates to select in the k-nearest ordering
+    unsigned int n_nearest{4u};
+    /// Prefetch the candidates of the next volume while the track approaches
+    /// a portal, so that the volume switch skips the accelerator search
+    /// (needs a navigation state that owns its candidate cache and the
+    /// @c lookahead navigation feature)
+    bool portal_lookahead{false};
+    /// Remember the surfaces of the last accelerator search, so that a volume
+    /// initialization in the same search bins only re-intersects them
+    /// (needs the @c search_cache navigation feature)
+    bool cache_search{false};
+    /// Find the exit of cylinder and cuboid volumes from the unbounded portal
+    /// surfaces and only intersect the portals that lie on the exit boundary
+    /// (and the one the track might be sitting on)
+    bool analytic_portal_exit{false};
+    /// Don't intersect passive surfaces that carry no material: They neither
+    /// interact with the track nor limit the step size anymore (only if no
+    /// actor needs to see them)
+    bool skip_empty_passives{false};
+    /// Only intersect the portals that the surface grids of a volume hold in
+    /// the bin of the track position (see @c grid_builder::set_add_portals ),
+    /// and all portals if none of them lies ahead of the track
+    bool binned_portals{false};
+    /// In cylinder and cuboid volumes that contain only portals, intersect
+    /// only the exit portal, as long as the track stays within the mask
+    /// tolerance of its tangent on the way there
+    bool gap_volume_shortcut{false};
+    /// Prefetch the material map bin of the next candidate surface at its
+    /// predicted local position, before the track reaches it
+    bool prefetch_material{false};
+    /// Volumes that don't use the global tolerances and search window
+    ///
+    /// An entry holds every setting of its volume and is used instead of the
+    /// global settings in that volume. Entries created by
+    /// @c edit_volume_config start as a copy of the global settings at the
+    /// time they are created, and don't follow later changes to them.
+    static_vector<volume_config<scalar_t>, k_max_volume_configs>
+        volume_configs{};
+
+    /// Add/replace the navigation settings of a single volume
+    ///
+    /// @note The entry is replaced as a whole: Settings that are not given in
+    /// @param vol_cfg fall back to the defaults of @c volume_config , not to
+    /// the global settings. Use @c edit_volume_config or start from
+    /// @c for_volume to only change some of them.
+    ///
+    /// @returns false if the table of volume configurations is full
+    DETRAY_HOST_DEVICE
+    constexpr bool set_volume_config(const volume_config<scalar_t> &vol_cfg) {
+        for (auto &entry : volume_configs) {
+            if (entry.volume == vol_cfg.volume) {
+                entry = vol_cfg;
+                return true;
+            }
+        }
+        if (volume_configs.full()) {
+            return false;
+        }
+        volume_configs.push_back(vol_cfg);
+        return true;
+    }
+
+    /// Get the navigation settings of volume @param vol for modification
+    ///
+    /// If the volume has no entry yet, a new one is added that starts from
+    /// the current global settings, so that only the settings that differ
+    /// need to be changed.
+    ///
+    /// @returns the entry of the volume, or nullptr if the table of volume
+    /// configurations is full
+    DETRAY_HOST_DEVICE
+    constexpr volume_config<scalar_t> *edit_volume_config(const dindex vol) {
+        for (auto &entry : volume_configs) {
+            if (entry.volume == vol) {
+                return &entry;
+            }
+        }
+        if (volume_configs.full()) {
+            return nullptr;
+        }
+        volume_configs.push_back(for_volume(vol));
+        return &volume_configs.back();
+    }
+
+    /// @returns the navigation settings that apply in volume @param vol
+    DETRAY_HOST_DEVICE
+    constexpr volume_config<scalar_t> for_volume(const dindex vol) const {
+        for (const auto &entry : volume_configs) {
+            if (entry.volume == vol) {
+                return entry;
+            }
+        }
+        return {vol, mask_tolerance, overstep_tolerance, search_window,
+                unique_candidates, search_path_length, analytic_portal_exit,
+                skip_empty_passives, binned_portals};
+    }
 };
 
 }  // namespace detray::navigation
@@ -15,16 +15,34 @@
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/definitions/units.hpp"
 #include "detray/geometry/barcode.hpp"
+#include "detray/navigation/detail/intersection_solutions.hpp"
+#include "detray/navigation/detail/navigation_features.hpp"
+#include "detray/navigation/detail/plane_record.hpp"
+#include "detray/navigation/detail/portal_exit.hpp"
+#include "detray/navigation/detail/procedural_transforms.hpp"
 #include "detray/navigation/detail/ray.hpp"
+#include "detray/navigation/detail/ray_transform_cache.hpp"
 #include "detray/navigation/intersection/intersection.hpp"
 #include "detray/navigation/intersection/ray_intersector.hpp"
 #include "detray/navigation/intersection_kernel.hpp"
 #include "detray/navigation/navigation_config.hpp"
+#include "detray/propagator/stepping_config.hpp"
+#include "detray/utils/invalid_values.hpp"
 #include "detray/utils/ranges.hpp"
+#include "detray/utils/static_vector.hpp"
+#include "detray/utils/type_traits.hpp"
 
 // vecmem include(s)
 #include <vecmem/containers/data/jagged_vector_buffer.hpp>
 #include <vecmem/memory/memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
+
+// System include(s)
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace detray {
 
@@ -37,6 +55,7 @@ enum class direction : int { e_backward = -1, e_forward = 1 };
 
 /// Navigation status flags
 enum class status {
+    e_overflow = -4,       ///< candidate cache full, propagation aborted
     e_abort = -3,          ///< error ocurred, propagation will be aborted
     e_on_target = -2,      ///< navigation exited successfully
     e_unknown = -1,        ///< unknown state/not initialized
@@ -45,6 +64,20 @@ enum class status {
     e_on_portal = 2,       ///< reached portal surface
 };
 
+/// Navigation calls that are reported to the inspectors (together with a
+/// message), so that they don't have to parse the messages
+enum class event : std::uint_least8_t {
+    e_other = 0u,              ///< not classified (e.g. debug output)
+    e_init = 1u,               ///< volume initialization (local navigation)
+    e_update_high = 2u,        ///< 'high trust' update
+    e_update_fair = 3u,        ///< 'fair trust' update
+    e_overstep_recovery = 4u,  ///< passed candidate found again
+    e_lookahead_switch = 5u,   ///< volume switch on prefetched candidates
+    e_overflow = 6u,           ///< candidates did not fit into the cache
+    e_abort = 7u,              ///< navigation aborted
+    e_exit = 8u,               ///< navigation left the detector/reached target
+};
+
 /// A void inpector that does nothing.
 ///
 /// Inspectors can be plugged in to understand the current navigation state.
@@ -54,6 +87,136 @@ struct void_inspector {
                                        const char * /*ignored*/) {}
 };
 
+/// A candidate cache with a compile-time capacity and in-place storage.
+///
+/// When the cache is full, a new candidate replaces the furthest candidate
+/// in the cache, if it is closer. That way, the closest candidates are always
+/// kept and the remaining ones are picked up again by the next volume
+/// initialization. Portals are never replaced by other surfaces and always
+/// take the place of the furthest other surface, so that the track can still
+/// leave the volume. Every candidate that is lost this way is counted.
+///
+/// @tparam intersection_t the candidate type (needs to be ordered by distance)
+/// @tparam kCAPACITY maximal number of candidates that can be held
+template <typename intersection_t, std::size_t kCAPACITY>
+class candidate_cache : public static_vector<intersection_t, kCAPACITY> {
+
+    using base_type = static_vector<intersection_t, kCAPACITY>;
+
+    public:
+    /// Insert a new candidate, evicting the furthest one on overflow
+    DETRAY_HOST_DEVICE
+    constexpr void push_back(const intersection_t &candidate) {
+        if (!this->full()) {
+            base_type::push_back(candidate);
+            return;
+        }
+        // Furthest other surface and furthest portal in the cache
+        auto furthest = this->end();
+        auto furthest_portal = this->end();
+        for (auto itr = this->begin(); itr != this->end(); ++itr) {
+            auto &f = itr->sf_desc.is_portal() ? furthest_portal : furthest;
+            if (f == this->end() or *f < *itr) {
+                f = itr;
+            }
+        }
+        // One candidate is lost in any case
+        ++m_n_evicted;
+        m_is_complete = false;
+        if (furthest != this->end()) {
+            if (candidate.sf_desc.is_portal() or candidate < *furthest) {
+                *furthest = candidate;
+            }
+        } else if (candidate.sf_desc.is_portal() and
+                   candidate < *furthest_portal) {
+            // The cache holds only portals
+            *furthest_portal = candidate;
+        }
+    }
+
+    /// Remove all candidates (the eviction count is kept)
+    DETRAY_HOST_DEVICE
+    constexpr void clear() {
+        base_type::clear();
+        m_is_complete = true;
+    }
+
+    /// @returns false if candidates were evicted since the last @c clear
+    DETRAY_HOST_DEVICE
+    constexpr bool is_complete() const { return m_is_complete; }
+
+    /// @returns the number of candidates that did not fit into the cache
+    DETRAY_HOST_DEVICE
+    constexpr std::size_t n_evicted() const { return m_n_evicted; }
+
+    private:
+    /// Number of candidates that were dropped on overflow
+    std::size_t m_n_evicted{0u};
+    /// Whether all candidates since the last clear were kept
+    bool m_is_complete{true};
+};
+
+/// A cache for the result of the last accelerator search in the navigation
+/// state.
+///
+/// Remembers the volume and the search bins (encoded in a single key) of the
+/// last volume initialization, together with the surfaces that the search
+/// returned. If the next initialization happens in the same volume and bins,
+/// the surfaces can be intersected directly, without querying the
+/// accelerator structures again.
+///
+/// @tparam kCAPACITY maximal number of surfaces that can be remembered
+template <std::size_t kCAPACITY>
+struct search_cache {
+
+    /// Key that marks a search that cannot be cached
+    static constexpr std::uint64_t k_invalid_key{
+        detail::invalid_value<std::uint64_t>()};
+
+    /// Volume of the cached search
+    dindex volume{detail::invalid_value<dindex>()};
+    /// Encoded search bins of the cached search
+    std::uint64_t bin_key{k_invalid_key};
+    /// Whether all surfaces of the search fit into the cache
+    bool complete{false};
+    /// Indices of the surfaces that the search returned (in search order)
+    static_vector<dindex, kCAPACITY> surfaces{};
+
+    /// Start recording a new search in volume @param vol and bins @param key
+    DETRAY_HOST_DEVICE
+    constexpr void reset(const dindex vol, const std::uint64_t key) {
+        volume = vol;
+        bin_key = key;
+        complete = true;
+        surfaces.clear();
+    }
+
+    /// Record the surface with index @param sf_idx
+    DETRAY_HOST_DEVICE
+    constexpr void record(const dindex sf_idx) {
+        if (surfaces.full()) {
+            complete = false;
+            return;
+        }
+        surfaces.push_back(sf_idx);
+    }
+
+    /// @returns true if the search in volume @param vol and bins @param key
+    /// can be replayed from the cache
+    DETRAY_HOST_DEVICE
+    constexpr bool is_hit(const dindex vol, const std::uint64_t key) const {
+        return complete and key != k_invalid_key and vol == volume and
+               key == bin_key;
+    }
+
+    /// Forget the cached search
+    DETRAY_HOST_DEVICE
+    constexpr void clear() {
+        reset(detail::invalid_value<dindex>(), k_invalid_key);
+        complete = false;
+    }
+};
+
 }  // namespace navigation
 
 /// @brief The geometry navigation class.
@@ -87,14 +250,26 @@ struct void_inspector {
 /// @tparam detector_t the detector to navigate
 /// @tparam inspector_t is a validation inspector that can record information
 ///         about the navigation state at different points of the nav. flow.
+/// @tparam intersection_t the type of the surface candidates
+/// @tparam k_cache_capacity if larger than zero, the candidates are kept in a
+///         fixed size cache of this capacity inside the navigation state,
+///         instead of a (dynamically allocated) vector
+/// @tparam features_t selects the optional data of the navigation state
+///         (see @c navigation::default_features )
 template <
     typename detector_t, typename inspector_t = navigation::void_inspector,
     typename intersection_t = intersection2D<typename detector_t::surface_type,
-                                             typename detector_t::algebra_type>>
+                                             typename detector_t::algebra_type>,
+    std::size_t k_cache_capacity = 0u,
+    typename features_t = navigation::default_features>
 class navigator {
 
+    static_assert(not features_t::bundle or features_t::search_cache,
+                  "The bundle mode replays the search cache of the leader");
+
     public:
     using inspector_type = inspector_t;
+    using features_type = features_t;
     using detector_type = detector_t;
     using scalar_type = typename detector_t::scalar_type;
     using volume_type = typename detector_t::volume_type;
@@ -102,8 +277,58 @@ class navigator {
     using vector_type = typename detector_t::template vector_type<T>;
     using intersection_type = intersection_t;
     using nav_link_type = typename detector_t::surface_type::navigation_link;
+    /// Container type of the candidate cache in the navigation state
+    using candidate_cache_type = std::conditional_t<
+        k_cache_capacity == 0u, vector_type<intersection_type>,
+        navigation::candidate_cache<intersection_type, k_cache_capacity>>;
+    /// Maximal number of candidates that a single surface can add
+    static constexpr std::size_t k_max_solutions{
+        detail::max_intersection_solutions<detector_t>()};
+    /// Maximal number of surfaces that are remembered from the last search
+    static constexpr std::size_t k_search_cache_capacity{32u};
+    /// Cache of the last accelerator search in the navigation state
+    using search_cache_type =
+        navigation::search_cache<k_search_cache_capacity>;
+    /// Projection of the track onto the last surface placement in a search
+    using trf_cache_type =
+        detail::ray_transform_cache<typename detector_t::algebra_type>;
+    /// Compact placement of the planar surfaces (optional)
+    using plane_record_type =
+        detail::plane_record<typename detector_t::algebra_type>;
+    using plane_transforms_type = detail::plane_record_transforms<
+        typename detector_t::transform_container,
+        typename detector_t::algebra_type>;
+    /// Procedural module placement of regular barrel layers (optional)
+    using barrel_placement_type =
+        detail::barrel_placement<typename detector_t::algebra_type>;
+    using procedural_transforms_type = detail::procedural_transforms<
+        typename detector_t::transform_container,
+        typename detector_t::algebra_type>;
+
+    /// Alternative placements of the surfaces for the intersection
+    struct placement_records {
+        /// Compact placements of the planar surfaces (take precedence)
+        const plane_record_type *planes{nullptr};
+        /// Procedural placements of regular barrel layers
+        const barrel_placement_type *barrels{nullptr};
+        dindex n_barrels{0u};
+    };
 
     private:
+    /// @returns whether the candidate cache @param candidates can take the
+    /// intersections of another surface. Only a device vector on a candidates
+    /// buffer can neither grow nor evict candidates.
+    DETRAY_HOST_DEVICE
+    static constexpr bool has_room(const candidate_cache_type &candidates) {
+        if constexpr (k_cache_capacity != 0u or
+                      detail::has_reserve<candidate_cache_type>::value) {
+            return true;
+        } else {
+            return candidates.size() + k_max_solutions <=
+                   candidates.capacity();
+        }
+    }
+
     /// A functor that fills the navigation candidates vector by intersecting
     /// the surfaces in the volume neighborhood
     struct candidate_search {
@@ -113,14 +338,216 @@ class navigator {
         DETRAY_HOST_DEVICE void operator()(
             const typename detector_type::surface_type &sf_descr,
             const detector_type &det, const track_t &track,
-            vector_type<intersection_type> &candidates,
-            const scalar_type mask_tol, const scalar_type overstep_tol) const {
+            candidate_cache_type &candidates, const scalar_type mask_tol,
+            const scalar_type overstep_tol, const bool skip_portals = false,
+            trf_cache_type *trf_cache = nullptr,
+            const bool skip_empty_passives = false,
+            const placement_records &placements = {}) const {
+
+            // Drop the surface instead of writing past the capacity (the
+            // overflow is reported by the volume initialization)
+            if (not has_room(candidates)) {
+                return;
+            }
 
             const auto sf = surface{det, sf_descr};
 
-            sf.template visit_mask<intersection_initialize<ray_intersector>>(
-                candidates, detail::ray(track), sf_descr, det.transform_store(),
-                sf.is_portal() ? 0.f : mask_tol, overstep_tol);
+            // The portals are added by the exit portal search
+            if (skip_portals and sf.is_portal()) {
+                return;
+            }
+            // Passive surfaces without material do not change the track
+            if (skip_empty_passives and sf.is_passive() and
+                not sf.has_material()) {
+                return;
+            }
+
+            const scalar_type tol{sf.is_portal() ? 0.f : mask_tol};
+
+            if (placements.planes) {
+                intersect(sf, sf_descr, track, candidates,
+                          plane_transforms_type{det.transform_store(),
+                                                placements.planes},
+                          tol, overstep_tol, trf_cache);
+            } else if (placements.barrels) {
+                intersect(sf, sf_descr, track, candidates,
+                          procedural_transforms_type{det.transform_store(),
+                                                     placements.barrels,
+                                                     placements.n_barrels},
+                          tol, overstep_tol, trf_cache);
+            } else {
+                intersect(sf, sf_descr, track, candidates,
+                          det.transform_store(), tol, overstep_tol, trf_cache);
+            }
+        }
+
+        private:
+        /// Intersect the surface with the placements from @param trfs
+        template <typename surface_t, typename track_t,
+                  typename transform_container_t>
+        DETRAY_HOST_DEVICE void intersect(
+            const surface_t &sf,
+            const typename detector_type::surface_type &sf_descr,
+            const track_t &track, candidate_cache_type &candidates,
+            const transform_container_t &trfs, const scalar_type tol,
+            const scalar_type overstep_tol, trf_cache_type *trf_cache) const {
+
+            // Reuse the track projection of surfaces with the same placement
+            if (trf_cache) {
+                sf.template visit_mask<
+                    intersection_initialize<ray_intersector>>(
+                    candidates, detail::ray(track), sf_descr, trfs, tol,
+                    overstep_tol, *trf_cache);
+            } else {
+                sf.template visit_mask<
+                    intersection_initialize<ray_intersector>>(
+                    candidates, detail::ray(track), sf_descr, trfs, tol,
+                    overstep_tol);
+            }
+        }
+    };
+
+    /// A functor that remembers the surfaces of an accelerator search, before
+    /// intersecting them like the @c candidate_search
+    struct recording_candidate_search {
+
+        template <typename track_t>
+        DETRAY_HOST_DEVICE void operator()(
+            const typename detector_type::surface_type &sf_descr,
+            const detector_type &det, const track_t &track,
+            candidate_cache_type &candidates, const scalar_type mask_tol,
+            const scalar_type overstep_tol, search_cache_type &search_cache,
+            const bool skip_portals = false,
+            trf_cache_type *trf_cache = nullptr,
+            const bool skip_empty_passives = false,
+            const placement_records &placements = {}) const {
+
+            // The exit portals are searched on every initialization
+            if (skip_portals and sf_descr.is_portal()) {
+                return;
+            }
+
+            search_cache.record(sf_descr.index());
+            candidate_search{}(sf_descr, det, track, candidates, mask_tol,
+                               overstep_tol, false, trf_cache,
+                               skip_empty_passives, placements);
+        }
+    };
+
+    /// A functor that encodes the bins an accelerator searches for a track
+    /// into a key.
+    ///
+    /// Grids are keyed by the bin ranges of their search window, the brute
+    /// force search returns the same surfaces everywhere (key zero). Other
+    /// accelerators cannot be cached (invalid key).
+    struct search_bin_getter {
+
+        template <typename accel_group_t, typename accel_index_t,
+                  typename track_t>
+        DETRAY_HOST_DEVICE std::uint64_t operator()(
+            const accel_group_t &group, const accel_index_t index,
+            const detector_type &det, const volume_type &vol_desc,
+            const track_t &track,
+            const navigation::volume_config<scalar_type> &vol_cfg) const {
+
+            using accel_t = typename accel_group_t::value_type;
+            constexpr std::uint64_t inv{search_cache_type::k_invalid_key};
+
+            if constexpr (detail::is_brute_force_v<accel_group_t>) {
+                return 0u;
+            } else if constexpr (detail::is_grid_v<accel_t>) {
+                const auto grid = group[index];
+
+                const auto &trf = det.transform_store()[vol_desc.transform()];
+                const auto loc_pos =
+                    grid.project(trf, track.pos(), track.dir());
+                const auto ranges =
+                    grid.axes().bin_ranges(loc_pos, vol_cfg.search_window);
+
+                // Pack the (possibly negative) range bounds of all axes
+                constexpr std::size_t n_bounds{2u * accel_t::dim};
+                constexpr std::uint64_t n_bits{64u / n_bounds};
+                constexpr std::int64_t offset{std::int64_t{1} << (n_bits - 1)};
+
+                std::uint64_t key{0u};
+                for (std::size_t i = 0u; i < accel_t::dim; ++i) {
+                    for (const int bound : ranges[i]) {
+                        const std::int64_t shifted{bound + offset};
+                        if (shifted < 0 or shifted >= 2 * offset) {
+                            return inv;
+                        }
+                        key = (key << n_bits) |
+                              static_cast<std::uint64_t>(shifted);
+                    }
+                }
+                // Zero is reserved for the brute force search
+                return key == 0u ? inv : key;
+            } else {
+                return inv;
+            }
+        }
+    };
+
+    /// A functor that returns the path along the track direction up to which
+    /// the neighborhood search of an accelerator is complete.
+    ///
+    /// Only the sorted planes return a window of the surfaces ahead of the
+    /// track, all other accelerators cover the whole volume.
+    struct search_horizon_getter {
+
+        template <typename accel_group_t, typename accel_index_t,
+                  typename track_t>
+        DETRAY_HOST_DEVICE scalar_type operator()(
+            const accel_group_t &group, const accel_index_t index,
+            const track_t &track,
+            const navigation::volume_config<scalar_type> &vol_cfg) const {
+
+            using accel_t = typename accel_group_t::value_type;
+
+            if constexpr (detail::is_sorted_planes_v<accel_t>) {
+                return static_cast<scalar_type>(
+                    group[index].horizon(track, vol_cfg));
+            } else {
+                return std::numeric_limits<scalar_type>::max();
+            }
+        }
+    };
+
+    /// A functor that intersects the portals that a grid holds in the bin of
+    /// the track position (see @c grid_builder::set_add_portals ).
+    ///
+    /// Other accelerators don't hold portal subsets.
+    struct binned_portal_search {
+
+        template <typename accel_group_t, typename accel_index_t,
+                  typename track_t>
+        DETRAY_HOST_DEVICE void operator()(
+            const accel_group_t &group, const accel_index_t index,
+            const detector_type &det, const volume_type &vol_desc,
+            const track_t &track,
+            const navigation::volume_config<scalar_type> &vol_cfg,
+            candidate_cache_type &candidates) const {
+
+            using accel_t = typename accel_group_t::value_type;
+
+            if constexpr (detail::is_grid_v<accel_t>) {
+                const auto grid = group[index];
+
+                const auto &trf = det.transform_store()[vol_desc.transform()];
+                const auto loc_pos =
+                    grid.project(trf, track.pos(), track.dir());
+
+                constexpr candidate_search search{};
+                for (const auto &entry : grid.search(loc_pos)) {
+                    const auto &sf_desc =
+                        detail::to_surface_descriptor(det, entry);
+                    if (sf_desc.is_portal()) {
+                        search(sf_desc, det, track, candidates,
+                               vol_cfg.mask_tolerance,
+                               vol_cfg.overstep_tolerance);
+                    }
+                }
+            }
         }
     };
 
@@ -133,16 +560,28 @@ class navigator {
     /// towards the navigation. The navigator is responsible for updating the
     /// elements  in the state's cache with every navigation call, establishing
     /// 'full trust' again.
-    class state : public detray::ranges::view_interface<state> {
+    class state
+        : public detray::ranges::view_interface<state>,
+          private detail::lookahead_data<candidate_cache_type,
+                                         features_t::lookahead>,
+          private detail::search_cache_data<search_cache_type,
+                                            features_t::search_cache>,
+          private detail::guide_data<features_t::guide>,
+          private detail::bundle_data<search_cache_type, features_t::bundle>,
+          private detail::placement_data<placement_records,
+                                         features_t::placements> {
         friend class navigator;
         // Allow the filling/updating of candidates
         friend struct intersection_initialize<ray_intersector>;
         friend struct intersection_update<ray_intersector>;
 
-        using candidate_itr_t =
-            typename vector_type<intersection_type>::iterator;
+        using candidate_itr_t = typename candidate_cache_type::iterator;
         using const_candidate_itr_t =
-            typename vector_type<intersection_type>::const_iterator;
+            typename candidate_cache_type::const_iterator;
+        using candidate_diff_t =
+            typename std::iterator_traits<candidate_itr_t>::difference_type;
+        using lookahead_base =
+            detail::lookahead_data<candidate_cache_type, features_t::lookahead>;
 
         public:
         using detector_type = navigator::detector_type;
@@ -155,28 +594,48 @@ class navigator {
         /// Constructor with memory resource
         DETRAY_HOST
         state(const detector_type &det, vecmem::memory_resource &resource)
-            : m_detector(&det), m_candidates(&resource) {}
+            : lookahead_base(resource),
+              m_detector(&det),
+              m_candidates(&resource) {}
 
         /// Constructor from candidates vector_view
+        template <std::size_t N = k_cache_capacity,
+                  std::enable_if_t<N == 0u, bool> = true>
         DETRAY_HOST_DEVICE state(const detector_type &det,
                                  vector_type<intersection_type> candidates)
-            : m_detector(&det), m_candidates(candidates) {}
+            : m_detector(&det), m_candidates(candidates) {
+            if constexpr (features_t::lookahead) {
+                this->m_can_prefetch = false;
+            }
+        }
+
+        /// Constructor for the fixed size cache: no external candidates
+        /// container is needed (the argument is ignored)
+        template <std::size_t N = k_cache_capacity,
+                  std::enable_if_t<N != 0u, bool> = true>
+        DETRAY_HOST_DEVICE state(const detector_type &det,
+                                 vector_type<intersection_type> &&)
+            : m_detector(&det) {}
 
         /// @return start position of valid candidate range.
         DETRAY_HOST_DEVICE
-        constexpr auto begin() -> candidate_itr_t { return m_next; }
+        constexpr auto begin() -> candidate_itr_t { return at(m_next); }
 
         /// @return start position of the valid candidate range - const
         DETRAY_HOST_DEVICE
-        constexpr auto begin() const -> const_candidate_itr_t { return m_next; }
+        constexpr auto begin() const -> const_candidate_itr_t {
+            return at(m_next);
+        }
 
         /// @return sentinel of the valid candidate range.
         DETRAY_HOST_DEVICE
-        constexpr auto end() -> candidate_itr_t { return m_last; }
+        constexpr auto end() -> candidate_itr_t { return at(m_last); }
 
         /// @return sentinel of the valid candidate range.
         DETRAY_HOST_DEVICE
-        constexpr auto end() const -> const_candidate_itr_t { return m_last; }
+        constexpr auto end() const -> const_candidate_itr_t {
+            return at(m_last);
+        }
 
         /// @returns a pointer of detector
         DETRAY_HOST_DEVICE
@@ -185,38 +644,223 @@ class navigator {
         /// Scalar representation of the navigation state,
         /// @returns distance to next
         DETRAY_HOST_DEVICE
-        scalar_type operator()() const { return m_next->path; }
+        scalar_type operator()() const { return at(m_next)->path; }
+
+        /// @returns whether the candidates of the volume behind the next
+        /// portal have been prefetched for the current portal @param bcd
+        DETRAY_HOST_DEVICE
+        inline bool has_lookahead(const geometry::barcode bcd) const {
+            if constexpr (features_t::lookahead) {
+                return !this->m_lookahead_portal.is_invalid() &&
+                       this->m_lookahead_portal == bcd;
+            } else {
+                return false;
+            }
+        }
+
+        /// @returns the prefetched candidates of the next volume - const
+        template <typename F = features_t,
+                  std::enable_if_t<F::lookahead, bool> = true>
+        DETRAY_HOST_DEVICE inline auto lookahead() const
+            -> const candidate_cache_type & {
+            return this->m_lookahead_active ? m_candidates : this->m_lookahead;
+        }
+
+        /// Restrict the navigation to a precomputed sequence of surfaces
+        /// (guided mode).
+        ///
+        /// Only the surfaces in @param guide and the portals of the current
+        /// volume are intersected, the volume accelerators are not queried.
+        ///
+        /// @note The state does not own the barcodes, the guide has to outlive
+        /// the navigation.
+        template <typename barcode_range_t, typename F = features_t,
+                  std::enable_if_t<F::guide, bool> = true>
+        DETRAY_HOST_DEVICE inline void set_guide(const barcode_range_t &guide) {
+            this->m_guide = guide.data();
+            this->m_guide_size = static_cast<dindex>(guide.size());
+            this->m_is_guided = true;
+        }
+
+        /// Go back to the unrestricted navigation
+        template <typename F = features_t,
+                  std::enable_if_t<F::guide, bool> = true>
+        DETRAY_HOST_DEVICE inline void clear_guide() {
+            this->m_guide = nullptr;
+            this->m_guide_size = 0u;
+            this->m_is_guided = false;
+        }
+
+        /// @returns whether the navigation is restricted to a guide
+        DETRAY_HOST_DEVICE
+        inline bool is_guided() const {
+            if constexpr (features_t::guide) {
+                return this->m_is_guided;
+            } else {
+                return false;
+            }
+        }
+
+        /// Share the accelerator searches of the leader track with the
+        /// navigation state @param leader (bundle mode).
+        ///
+        /// When this track is initialized in the same volume and search bins
+        /// as the last search of the leader, the surfaces that the leader
+        /// found are intersected directly, instead of querying the
+        /// accelerator structures again. Only has an effect if the search
+        /// caching is switched on in the navigation config.
+        ///
+        /// @note The leader state has to outlive the navigation and needs to
+        /// be accessible to this track (e.g. in shared memory on device).
+        template <typename F = features_t,
+                  std::enable_if_t<F::bundle, bool> = true>
+        DETRAY_HOST_DEVICE inline void set_leader(const state &leader) {
+            this->m_leader_search = &(leader.m_search_cache);
+        }
+
+        /// Stop sharing the searches of a leader track
+        template <typename F = features_t,
+                  std::enable_if_t<F::bundle, bool> = true>
+        DETRAY_HOST_DEVICE inline void clear_leader() {
+            this->m_leader_search = nullptr;
+        }
+
+        /// @returns whether the track follows the searches of a leader
+        DETRAY_HOST_DEVICE
+        inline bool has_leader() const {
+            if constexpr (features_t::bundle) {
+                return this->m_leader_search != nullptr;
+            } else {
+                return false;
+            }
+        }
+
+        /// Intersect rays with planar surfaces using the compact placements
+        /// in @param planes (see @c detail::build_plane_records ), instead of
+        /// the full transforms of the detector.
+        ///
+        /// @note The state does not own the records, they have to outlive the
+        /// navigation and contain one entry per detector transform.
+        template <typename plane_range_t, typename F = features_t,
+                  std::enable_if_t<F::placements, bool> = true>
+        DETRAY_HOST_DEVICE inline void set_plane_records(
+            const plane_range_t &planes) {
+            this->m_placements.planes = planes.data();
+        }
+
+        /// Go back to the full transforms for the plane intersection
+        template <typename F = features_t,
+                  std::enable_if_t<F::placements, bool> = true>
+        DETRAY_HOST_DEVICE inline void clear_plane_records() {
+            this->m_placements.planes = nullptr;
+        }
+
+        /// @returns whether the plane records are used
+        DETRAY_HOST_DEVICE
+        inline bool has_plane_records() const {
+            return placements().planes != nullptr;
+        }
+
+        /// Compute the module placements of the regular barrel layers in
+        /// @param barrels on the fly (see @c detail::barrel_placement ),
+        /// instead of loading them from the transform store. Only the layers
+        /// in the range are procedural, the plane records take precedence.
+        ///
+        /// @note The state does not own the placements, they have to outlive
+        /// the navigation.
+        template <typename barrel_range_t, typename F = features_t,
+                  std::enable_if_t<F::placements, bool> = true>
+        DETRAY_HOST_DEVICE inline void set_barrel_placements(
+            const barrel_range_t &barrels) {
+            this->m_placements.barrels = barrels.data();
+            this->m_placements.n_barrels = static_cast<dindex>(barrels.size());
+        }
+
+        /// Go back to the stored transforms for the barrel modules
+        template <typename F = features_t,
+                  std::enable_if_t<F::placements, bool> = true>
+        DETRAY_HOST_DEVICE inline void clear_barrel_placements() {
+            this->m_placements.barrels = nullptr;
+            this->m_placements.n_barrels = 0u;
+        }
+
+        /// @returns whether procedural barrel placements are used
+        DETRAY_HOST_DEVICE
+        inline bool has_barrel_placements() const {
+            return placements().n_barrels > 0u;
+        }
+
+        /// @returns the alternative surface placements (none, if the
+        /// navigator was not instantiated with the placements feature)
+        DETRAY_HOST_DEVICE
+        constexpr auto placements() const -> placement_records {
+            if constexpr (features_t::placements) {
+                return this->m_placements;
+            } else {
+                return {};
+            }
+        }
 
         /// @returns currently cached candidates - const
         DETRAY_HOST_DEVICE
-        inline auto candidates() const
-            -> const vector_type<intersection_type> & {
-            return m_candidates;
+        inline auto candidates() const -> const candidate_cache_type & {
+            return cache();
         }
 
         /// @returns numer of currently cached (reachable) candidates - const
         DETRAY_HOST_DEVICE
-        inline auto n_candidates() const ->
-            typename std::iterator_traits<candidate_itr_t>::difference_type {
-            return std::distance(m_next, m_last);
+        inline auto n_candidates() const -> candidate_diff_t {
+            return std::distance(begin(), end());
+        }
+
+        /// @returns whether a full fixed size cache could not keep all
+        /// candidates of the current volume
+        DETRAY_HOST_DEVICE
+        inline auto is_incomplete() const -> bool {
+            if constexpr (k_cache_capacity == 0u) {
+                return false;
+            } else {
+                return not cache().is_complete();
+            }
+        }
+
+        /// @returns the number of candidates that a full fixed size cache
+        /// could not keep (always zero for dynamically sized caches)
+        DETRAY_HOST_DEVICE
+        inline auto n_evicted() const -> std::size_t {
+            if constexpr (k_cache_capacity == 0u) {
+                return 0u;
+            } else if constexpr (features_t::lookahead) {
+                return m_candidates.n_evicted() +
+                       this->m_lookahead.n_evicted();
+            } else {
+                return m_candidates.n_evicted();
+            }
         }
 
         /// @returns current/previous object that was reached
         DETRAY_HOST_DEVICE
         inline auto current() const -> const_candidate_itr_t {
-            return m_next - 1;
+            return at(m_next) - 1;
         }
 
         /// @returns next object that we want to reach (current target) - const
         DETRAY_HOST_DEVICE
-        inline auto next() const -> const const_candidate_itr_t & {
-            return m_next;
+        inline auto next() const -> const_candidate_itr_t {
+            return at(m_next);
         }
 
         /// @returns last valid candidate (by position in the cache) - const
         DETRAY_HOST_DEVICE
-        inline auto last() const -> const const_candidate_itr_t & {
-            return m_last;
+        inline auto last() const -> const_candidate_itr_t {
+            return at(m_last);
+        }
+
+        /// @returns end of the candidate range that is in order (the cache
+        /// might only be partially sorted) - const
+        DETRAY_HOST_DEVICE
+        inline auto sorted_end() const -> const_candidate_itr_t {
+            return at(m_sorted_end);
         }
 
         /// @returns the navigation inspector
@@ -244,7 +888,7 @@ class navigator {
         DETRAY_HOST_DEVICE
         inline auto next_surface() const {
             return surface<detector_type>{*m_detector,
-                                          m_next->sf_desc.barcode()};
+                                          at(m_next)->sf_desc.barcode()};
         }
 
         /// @returns current detector surface the navigator is on
@@ -255,6 +899,25 @@ class navigator {
             return surface<detector_type>{*m_detector, barcode()};
         }
 
+        /// @returns the cosine of the incidence angle of a track with the
+        /// direction @param dir on the current surface
+        ///
+        /// Taken from the intersection, if the intersector provided it,
+        /// otherwise computed from the surface normal at the local position
+        /// (absolute value, e.g. for lazy intersections or helices)
+        DETRAY_HOST_DEVICE
+        inline auto cos_incidence_angle(
+            const typename detector_type::vector3_type &dir) const
+            -> scalar_type {
+            const scalar_type cos_inc{current()->cos_incidence_angle};
+            if (!detail::is_invalid_value(cos_inc)) {
+                return cos_inc;
+            }
+            return math::abs(get_surface().cos_angle(
+                typename detector_type::geometry_context{}, dir,
+                current()->local));
+        }
+
         /// @returns current navigation status - const
         DETRAY_HOST_DEVICE
         inline auto status() const -> navigation::status { return m_status; }
@@ -337,7 +1000,7 @@ class navigator {
         /// Helper method to check if a kernel is exhausted - const
         DETRAY_HOST_DEVICE
         inline auto is_exhausted() const -> bool {
-            return std::distance(m_next, m_last) <= 0;
+            return m_last <= m_next;
         }
 
         /// @returns flag that indicates whether navigation was successful
@@ -357,7 +1020,21 @@ class navigator {
             m_heartbeat = false;
             // Don't do anything if aborted
             m_trust_level = navigation::trust_level::e_full;
-            run_inspector({}, "Aborted: ");
+            run_inspector({}, "Aborted: ", navigation::event::e_abort);
+            return m_heartbeat;
+        }
+
+        /// The candidates of the volume did not fit into the cache: Stop the
+        /// navigation, so that it can be rerun with a larger cache.
+        ///
+        /// @return navigation heartbeat (dead)
+        DETRAY_HOST_DEVICE
+        inline auto overflow() -> bool {
+            m_status = navigation::status::e_overflow;
+            m_heartbeat = false;
+            m_trust_level = navigation::trust_level::e_full;
+            run_inspector({}, "Candidate overflow: ",
+                          navigation::event::e_overflow);
             return m_heartbeat;
         }
 
@@ -370,7 +1047,7 @@ class navigator {
             m_status = navigation::status::e_on_target;
             m_heartbeat = false;
             m_trust_level = navigation::trust_level::e_full;
-            run_inspector({}, "Exited: ");
+            run_inspector({}, "Exited: ", navigation::event::e_exit);
             this->clear();
             return m_heartbeat;
         }
@@ -385,41 +1062,134 @@ class navigator {
 
         /// @returns next object that we want to reach (current target)
         DETRAY_HOST_DEVICE
-        inline auto next() -> candidate_itr_t & { return m_next; }
+        inline auto next() -> candidate_itr_t { return at(m_next); }
+
+        /// Updates the position of the next candidate
+        DETRAY_HOST_DEVICE
+        inline void set_next(const const_candidate_itr_t new_next) {
+            m_next = pos(new_next);
+        }
+
+        /// Updates the position of the last valid candidate
+        DETRAY_HOST_DEVICE
+        inline void set_last(const const_candidate_itr_t new_last) {
+            m_last = pos(new_last);
+        }
 
-        /// Updates the iterator position of the last valid candidate
+        /// Updates the end of the candidate range that is in order
         DETRAY_HOST_DEVICE
-        inline void set_next(candidate_itr_t &&new_next) {
-            m_next = std::move(new_next);
+        inline void set_sorted_end(const const_candidate_itr_t new_end) {
+            m_sorted_end = pos(new_end);
         }
 
-        /// Updates the iterator position of the last valid candidate
+        /// @returns the candidate at position @param i in the cache
+        /// @{
         DETRAY_HOST_DEVICE
-        inline void set_last(candidate_itr_t &&new_last) {
-            m_last = std::move(new_last);
+        constexpr auto at(const dindex i) -> candidate_itr_t {
+            return cache().begin() + static_cast<candidate_diff_t>(i);
+        }
+        DETRAY_HOST_DEVICE
+        constexpr auto at(const dindex i) const -> const_candidate_itr_t {
+            return cache().begin() + static_cast<candidate_diff_t>(i);
+        }
+        /// @}
+
+        /// @returns the position of the candidate @param itr in the cache
+        DETRAY_HOST_DEVICE
+        constexpr auto pos(const const_candidate_itr_t itr) const -> dindex {
+            return static_cast<dindex>(itr - cache().begin());
+        }
+
+        /// @returns the cache that holds the candidates of the current volume
+        /// @{
+        DETRAY_HOST_DEVICE
+        constexpr auto cache() -> candidate_cache_type & {
+            if constexpr (features_t::lookahead) {
+                return this->m_lookahead_active ? this->m_lookahead
+                                                : m_candidates;
+            } else {
+                return m_candidates;
+            }
+        }
+        DETRAY_HOST_DEVICE
+        constexpr auto cache() const -> const candidate_cache_type & {
+            if constexpr (features_t::lookahead) {
+                return this->m_lookahead_active ? this->m_lookahead
+                                                : m_candidates;
+            } else {
+                return m_candidates;
+            }
+        }
+        /// @}
+
+        /// @returns the cache that receives the look-ahead candidates
+        DETRAY_HOST_DEVICE
+        constexpr auto lookahead_cache() -> candidate_cache_type & {
+            return this->m_lookahead_active ? m_candidates : this->m_lookahead;
+        }
+
+        /// @returns the result of the last accelerator search (only filled if
+        /// the search caching is switched on in the navigation config)
+        template <typename F = features_t,
+                  std::enable_if_t<F::search_cache, bool> = true>
+        DETRAY_HOST_DEVICE inline auto search_cache() const
+            -> const search_cache_type & {
+            return this->m_search_cache;
         }
 
         /// @returns currently cached candidates
         DETRAY_HOST_DEVICE
-        inline auto candidates() -> vector_type<intersection_type> & {
-            return m_candidates;
+        inline auto candidates() -> candidate_cache_type & {
+            return cache();
         }
 
         /// Clear the state
         DETRAY_HOST_DEVICE
         inline void clear() {
-            m_candidates.clear();
-            m_next = m_candidates.end();
-            m_last = m_candidates.end();
+            cache().clear();
+            m_next = 0u;
+            m_last = 0u;
+            m_sorted_end = 0u;
+            if constexpr (features_t::lookahead) {
+                clear_lookahead();
+            }
         }
 
-        /// Call the navigation inspector
+        /// Forget the prefetched candidates
+        DETRAY_HOST_DEVICE
+        inline void clear_lookahead() {
+            lookahead_cache().clear();
+            this->m_lookahead_portal = geometry::barcode{};
+            this->m_lookahead_key = search_cache_type::k_invalid_key;
+        }
+
+        /// Replace the candidates by the prefetched ones of the next volume:
+        /// Only the roles of the two caches are swapped
+        DETRAY_HOST_DEVICE
+        inline void swap_lookahead() {
+            this->m_lookahead_active = !this->m_lookahead_active;
+            clear_lookahead();
+            m_next = 0u;
+            m_last = static_cast<dindex>(cache().size());
+            m_sorted_end = 0u;
+        }
+
+        /// Call the navigation inspector. The @param ev is only passed to
+        /// inspectors that take it as an additional argument
         DETRAY_HOST_DEVICE
         inline void run_inspector(
             [[maybe_unused]] const navigation::config<scalar_type> &cfg,
-            [[maybe_unused]] const char *message) {
-            if constexpr (not std::is_same_v<inspector_t,
-                                             navigation::void_inspector>) {
+            [[maybe_unused]] const char *message,
+            [[maybe_unused]] const navigation::event ev =
+                navigation::event::e_other) {
+            if constexpr (std::is_invocable_v<
+                              inspector_t &, state &,
+                              const navigation::config<scalar_type> &,
+                              const char *, navigation::event>) {
+                m_inspector(*this, cfg, message, ev);
+            } else if constexpr (not std::is_same_v<
+                                     inspector_t,
+                                     navigation::void_inspector>) {
                 m_inspector(*this, cfg, message);
             }
         }
@@ -430,14 +1200,23 @@ class navigator {
         /// Detector pointer
         const detector_type *const m_detector;
 
-        /// Our cache of candidates (intersections with any kind of surface)
-        vector_type<intersection_type> m_candidates = {};
+        /// Our cache of candidates (intersections with any kind of surface),
+        /// use @c cache() to access the candidates of the current volume
+        candidate_cache_type m_candidates = {};
 
+        /// Positions in the candidate cache, stored as indices, so that the
+        /// state can be copied and moved
+        /// @{
         /// The next best candidate
-        candidate_itr_t m_next = m_candidates.end();
+        dindex m_next{0u};
 
         /// The last reachable candidate
-        candidate_itr_t m_last = m_candidates.end();
+        dindex m_last{0u};
+
+        /// End of the candidate range that is in order (the cache might only
+        /// be partially sorted)
+        dindex m_sorted_end{0u};
+        /// @}
 
         /// The inspector type of this navigation engine
         inspector_type m_inspector;
@@ -480,22 +1259,38 @@ class navigator {
         navigation.clear();
         navigation.m_heartbeat = true;
         // Get the max number of candidates & run them through the kernel
+        // (no-op for the fixed size cache)
         // detail::call_reserve(navigation.candidates(), volume.n_objects());
-        // @TODO: switch to fixed size buffer
         detail::call_reserve(navigation.candidates(), 20u);
 
         // Search for neighboring surfaces and fill candidates into cache
-        volume.template visit_neighborhood<candidate_search>(
-            track, cfg, *det, track, navigation.candidates(),
-            cfg.mask_tolerance, cfg.overstep_tolerance);
+        const auto vol_cfg =
+            get_volume_config(propagation, cfg, navigation.volume());
+        if (cfg.gap_volume_shortcut and
+            search_gap_exit(propagation, volume, vol_cfg)) {
+            // Only the exit portal of the gap volume is in the cache
+        } else if (cfg.cache_search) {
+            search_candidates_cached(navigation, volume, track, vol_cfg);
+        } else {
+            search_candidates(navigation, volume, track, vol_cfg,
+                              navigation.candidates());
+        }
+        // Surfaces might have been dropped: Don't navigate on an incomplete
+        // cache
+        if (not has_room(navigation.candidates())) {
+            navigation.overflow();
+            return navigation.m_heartbeat;
+        }
 
         // Sort all candidates and pick the closest one
-        detail::sequential_sort(navigation.candidates().begin(),
-                                navigation.candidates().end());
+        navigation.set_sorted_end(
+            order_candidates(navigation.candidates().begin(),
+                             navigation.candidates().end(), cfg));
 
         navigation.set_next(navigation.candidates().begin());
-        // No unreachable candidates in cache after local navigation
-        navigation.set_last(navigation.candidates().end());
+        // Only the portals behind the search horizon of the accelerators are
+        // unreachable after local navigation
+        navigation.set_last(find_invalid(navigation.candidates()));
         // Determine overall state of the navigation after updating the cache
         update_navigation_state(cfg, propagation);
         // If init was not successful, the propagation setup is broken
@@ -504,10 +1299,10 @@ class navigator {
         }
 
         auto &stepping = propagation._stepping;
-        stepping._step_size = navigation();
-        stepping._initialized = true;
+        stepping.reset_step_size(navigation());
 
-        navigation.run_inspector(cfg, "Init complete: ");
+        navigation.run_inspector(cfg, "Init complete: ",
+                                 navigation::event::e_init);
 
         return navigation.m_heartbeat;
     }
@@ -541,39 +1336,71 @@ class navigator {
             return navigation.m_heartbeat;
         }
         // Otherwise: did we run into a portal?
-        else if (navigation.is_on_portal()) {
-            // Set volume index to the next volume provided by the portal
-            navigation.set_volume(navigation.current()->volume_link);
-
-            // Navigation reached the end of the detector world
-            if (detail::is_invalid_value(navigation.volume())) {
-                navigation.exit();
+        if (not navigation.is_on_portal()) {
+            // If no trust could be restored for the current state, (local)
+            // navigation might be exhausted: re-initialize volume
+            navigation.m_heartbeat &= init(propagation, cfg);
+            if (navigation.status() == navigation::status::e_overflow) {
                 return navigation.m_heartbeat;
             }
-            // Run inspection when needed (keep for debugging)
-            // navigation.run_inspector(cfg, "Volume switch: ");
 
-            init(propagation, cfg);
+            // The re-initialization can find the track on a portal, e.g.
+            // when it reached the edge between two portals
+            if (not navigation.is_on_portal()) {
+                // Sanity check: Should never be the case after complete
+                // update call
+                if (navigation.trust_level() !=
+                        navigation::trust_level::e_full or
+                    navigation.is_exhausted()) {
+                    navigation.abort();
+                }
 
-            // Fresh initialization, reset trust and hearbeat
-            navigation.m_trust_level = navigation::trust_level::e_full;
-            navigation.m_heartbeat = true;
+                return navigation.m_heartbeat;
+            }
+        }
 
+        // Set volume index to the next volume provided by the portal
+        navigation.set_volume(navigation.current()->volume_link);
+
+        // Navigation reached the end of the detector world
+        if (detail::is_invalid_value(navigation.volume())) {
+            navigation.exit();
             return navigation.m_heartbeat;
         }
-        // If no trust could be restored for the current state, (local)
-        // navigation might be exhausted: re-initialize volume
-        navigation.m_heartbeat &= init(propagation, cfg);
-
-        // Sanity check: Should never be the case after complete update call
-        if (navigation.trust_level() != navigation::trust_level::e_full or
-            navigation.is_exhausted()) {
-            navigation.abort();
+        // Run inspection when needed (keep for debugging)
+        // navigation.run_inspector(cfg, "Volume switch: ");
+
+        // The candidates of the new volume have been prefetched for this
+        // portal: Only re-evaluate them, otherwise run the full init
+        if (not switch_to_lookahead(propagation, cfg) and
+            not init(propagation, cfg) and
+            navigation.status() == navigation::status::e_overflow) {
+            return navigation.m_heartbeat;
         }
 
+        // Fresh initialization, reset trust and hearbeat
+        navigation.m_trust_level = navigation::trust_level::e_full;
+        navigation.m_heartbeat = true;
+
         return navigation.m_heartbeat;
     }
 
+    /// @brief Hint the cache to load the transform and the mask of the next
+    /// candidate.
+    ///
+    /// This is useful when the caller switches to other work before the next
+    /// navigation update of the track, e.g. to another track.
+    ///
+    /// @param navigation the navigation state
+    DETRAY_HOST_DEVICE inline void prefetch_next(
+        const state &navigation) const {
+
+        if (not navigation.is_exhausted()) {
+            surface{*navigation.detector(), navigation.next()->sf_desc}
+                .prefetch();
+        }
+    }
+
     private:
     /// Helper method to update the candidates (surface intersections)
     /// based on an externally provided trust level. Will (re-)initialize the
@@ -596,6 +1423,10 @@ class navigator {
             return;
         }
 
+        // Tolerances that apply in the current volume
+        const auto vol_cfg =
+            get_volume_config(propagation, cfg, navigation.volume());
+
         // Update only the current candidate and the corresponding next target
         // - do this only when the navigation state is still coherent
         if (navigation.trust_level() == navigation::trust_level::e_high ||
@@ -603,7 +1434,12 @@ class navigator {
              navigation.trust_level() == navigation::trust_level::e_high)) {
 
             // Update next candidate: If not reachable, 'high trust' is broken
-            if (not update_candidate(*navigation.next(), track, det, cfg)) {
+            if (not update_candidate(*navigation.next(), track, det, vol_cfg,
+                                     navigation.placements())) {
+                // The step might have passed it: Try to recover
+                if (recover_overstep(propagation, cfg, vol_cfg)) {
+                    return;
+                }
                 navigation.m_status = navigation::status::e_unknown;
                 navigation.set_no_trust();
                 return;
@@ -612,7 +1448,8 @@ class navigator {
             // Update navigation flow on the new candidate information
             update_navigation_state(cfg, propagation);
 
-            navigation.run_inspector(cfg, "Update complete: high trust: ");
+            navigation.run_inspector(cfg, "Update complete: high trust: ",
+                                     navigation::event::e_update_high);
 
             // The work is done if: the track has not reached a surface yet or
             // trust is gone (portal was reached or the cache is broken).
@@ -624,7 +1461,8 @@ class navigator {
 
             // Else: Track is on module.
             // Ready the next candidate after the current module
-            if (update_candidate(*navigation.next(), track, det, cfg)) {
+            if (update_candidate(*navigation.next(), track, det, vol_cfg,
+                                 navigation.placements())) {
                 return;
             }
 
@@ -640,20 +1478,30 @@ class navigator {
 
             for (auto &candidate : navigation) {
                 // Disregard this candidate if it is not reachable
-                if (not update_candidate(candidate, track, det, cfg)) {
+                if (not update_candidate(candidate, track, det, vol_cfg,
+                                         navigation.placements())) {
                     // Forcefully set dist to numeric max for sorting
                     candidate.path = std::numeric_limits<scalar_type>::max();
                 }
             }
-            detail::sequential_sort(navigation.begin(), navigation.end());
+            navigation.set_sorted_end(
+                order_candidates(navigation.begin(), navigation.end(), cfg));
             // Take the nearest (sorted) candidate first
             navigation.set_next(navigation.begin());
             // Ignore unreachable elements (needed to determine exhaustion)
             navigation.set_last(find_invalid(navigation.candidates()));
+
+            // No candidate left: The step might have passed them
+            if (navigation.is_exhausted() and
+                recover_overstep(propagation, cfg, vol_cfg)) {
+                return;
+            }
+
             // Update navigation flow on the new candidate information
             update_navigation_state(cfg, propagation);
 
-            navigation.run_inspector(cfg, "Update complete: fair trust: ");
+            navigation.run_inspector(cfg, "Update complete: fair trust: ",
+                                     navigation::event::e_update_fair);
 
             return;
         }
@@ -666,6 +1514,64 @@ class navigator {
         }
     }
 
+    /// @brief Helper method that looks for candidates, which the last step
+    /// passed beyond the overstep tolerance.
+    ///
+    /// Only the candidates of the cache that have not been reached yet
+    /// (including the ones that were dropped as unreachable) are intersected
+    /// again, with the overstep recovery tolerance of the configuration. If
+    /// any of them is found, the track is steered back to the first one
+    /// along its trajectory, which is much cheaper than re-initializing the
+    /// volume.
+    ///
+    /// @param propagation contains the stepper and navigator states
+    /// @param cfg the navigation configuration
+    /// @param vol_cfg the navigation settings in the current volume
+    ///
+    /// @returns whether a passed candidate was recovered
+    template <typename propagator_state_t>
+    DETRAY_HOST_DEVICE inline bool recover_overstep(
+        propagator_state_t &propagation,
+        const navigation::config<scalar_type> &cfg,
+        navigation::volume_config<scalar_type> vol_cfg) const {
+
+        state &navigation = propagation._navigation;
+        auto &candidates = navigation.candidates();
+
+        if (cfg.overstep_recovery_tolerance >= vol_cfg.overstep_tolerance or
+            navigation.next() == candidates.end()) {
+            return false;
+        }
+
+        const auto det = navigation.detector();
+        const auto &track = propagation._stepping();
+        vol_cfg.overstep_tolerance = cfg.overstep_recovery_tolerance;
+
+        bool is_recovered{false};
+        for (auto itr = navigation.next(); itr != candidates.end(); ++itr) {
+            if (update_candidate(*itr, track, det, vol_cfg,
+                                 navigation.placements())) {
+                is_recovered = true;
+            } else {
+                itr->path = std::numeric_limits<scalar_type>::max();
+            }
+        }
+        if (not is_recovered) {
+            return false;
+        }
+
+        // The candidate furthest behind the track comes first
+        navigation.set_sorted_end(
+            order_candidates(navigation.next(), candidates.end(), cfg));
+        navigation.set_last(find_invalid(candidates));
+        update_navigation_state(cfg, propagation);
+
+        navigation.run_inspector(cfg, "Update complete: overstep recovery: ",
+                                 navigation::event::e_overstep_recovery);
+
+        return true;
+    }
+
     /// @brief Helper method that re-establishes the navigation state after an
     /// update.
     ///
@@ -692,17 +1598,47 @@ class navigator {
             // Set the next object that we want to reach (this function is only
             // called once the cache has been updated to a full trust state).
             // Might lead to exhausted cache.
-            ++navigation.next();
+            ++navigation.m_next;
             navigation.m_status = (navigation.current()->sf_desc.is_portal())
                                       ? navigation::status::e_on_portal
                                       : navigation::status::e_on_module;
 
-            stepping._step_size = navigation();
+            // Only a part of the cache was put in order: order the next batch
+            if (navigation.m_next == navigation.m_sorted_end and
+                not navigation.is_exhausted()) {
+                navigation.set_sorted_end(
+                    order_candidates(navigation.next(), navigation.end(), cfg));
+            }
+
+            // Surfaces were evicted from the full cache: They lie beyond the
+            // last surface that was kept, so re-initialize there instead of
+            // heading for the portal
+            if (navigation.is_incomplete() and not navigation.is_on_portal() and
+                not navigation.is_exhausted() and
+                navigation.next()->sf_desc.is_portal()) {
+                navigation.m_last = navigation.m_next;
+            }
+
+            // The cache is exhausted when the track reached the last portal
+            if (not navigation.is_exhausted()) {
+                stepping._step_size = navigation();
+            }
             stepping._initialized = true;
         } else {
             // Otherwise the track is moving towards a surface
             navigation.m_status = navigation::status::e_towards_object;
         }
+        // Next target is a portal: get the candidates of the next volume ready
+        if constexpr (features_t::lookahead) {
+            if (cfg.portal_lookahead and not navigation.is_exhausted() and
+                not navigation.is_on_portal()) {
+                prefetch(propagation, cfg);
+            }
+        }
+        // Get the material of the next target ready for the interactors
+        if (cfg.prefetch_material and not navigation.is_exhausted()) {
+            prefetch_material(navigation);
+        }
         // Exhaustion happens when after an update no next candidate in the
         // cache is reachable anymore -> triggers init of [new] volume
         // In backwards navigation or with strongly bent tracks, the cache may
@@ -714,6 +1650,689 @@ class navigator {
                 : navigation::trust_level::e_full;
     }
 
+    /// @brief Helper method that hints the cache to load the material of the
+    /// next candidate at the local position of its intersection.
+    ///
+    /// @param navigation the navigation state
+    DETRAY_HOST_DEVICE inline void prefetch_material(
+        const state &navigation) const {
+
+        const auto &next = *navigation.next();
+        const auto sf = surface{*navigation.detector(), next.sf_desc};
+
+        if (sf.has_material()) {
+            sf.prefetch_material({next.local[0], next.local[1]});
+        }
+    }
+
+    /// @brief Helper method that fills a candidates cache for a volume.
+    ///
+    /// Queries the volume accelerators, or, in guided mode, intersects the
+    /// guide surfaces that belong to the volume together with its portals.
+    ///
+    /// @param navigation the navigation state (holds the guide)
+    /// @param volume the volume to be searched
+    /// @param track the track (or ray) to be intersected
+    /// @param vol_cfg the navigation configuration of the volume
+    /// @param candidates the cache to be filled
+    template <typename volume_t, typename track_t>
+    DETRAY_HOST_DEVICE inline void search_candidates(
+        const state &navigation, const volume_t &volume, const track_t &track,
+        const navigation::volume_config<scalar_type> &vol_cfg,
+        candidate_cache_type &candidates) const {
+
+        const auto &det = *navigation.detector();
+        const bool exit_search{use_exit_search(volume, vol_cfg)};
+        const bool skip_portals{exit_search or vol_cfg.binned_portals};
+        trf_cache_type trf_cache{};
+
+        if (not navigation.is_guided()) {
+            if (vol_cfg.unique_candidates) {
+                volume.template visit_unique_neighborhood<candidate_search>(
+                    track, vol_cfg, det, track, candidates,
+                    vol_cfg.mask_tolerance, vol_cfg.overstep_tolerance,
+                    skip_portals, &trf_cache, vol_cfg.skip_empty_passives,
+                    navigation.placements());
+            } else {
+                volume.template visit_neighborhood<candidate_search>(
+                    track, vol_cfg, det, track, candidates,
+                    vol_cfg.mask_tolerance, vol_cfg.overstep_tolerance,
+                    skip_portals, &trf_cache, vol_cfg.skip_empty_passives,
+                    navigation.placements());
+            }
+            if (skip_portals) {
+                search_portals(det, volume, track, vol_cfg, candidates);
+            }
+            cut_at_search_horizon(det, volume, track, vol_cfg, candidates);
+            return;
+        }
+
+        // Guided mode (only with the guide feature)
+        if constexpr (features_t::guide) {
+            constexpr candidate_search search{};
+
+            // The portals are always tested, in case the track leaves the
+            // guide
+            if (exit_search) {
+                search_exit_portals(det, volume, track, vol_cfg, candidates);
+            } else {
+                for (const auto &pt_desc : volume.portals()) {
+                    search(pt_desc, det, track, candidates,
+                           vol_cfg.mask_tolerance, vol_cfg.overstep_tolerance,
+                           false, &trf_cache, false, navigation.placements());
+                }
+            }
+            for (dindex i = 0u; i < navigation.m_guide_size; ++i) {
+                const geometry::barcode bcd{navigation.m_guide[i]};
+                if (bcd.volume() != volume.index()) {
+                    continue;
+                }
+                const auto &sf_desc = det.surface(bcd);
+                if (not sf_desc.is_portal()) {
+                    search(sf_desc, det, track, candidates,
+                           vol_cfg.mask_tolerance, vol_cfg.overstep_tolerance,
+                           false, &trf_cache, false, navigation.placements());
+                }
+            }
+        }
+    }
+
+    /// @brief Helper method that fills the candidates cache for a volume
+    /// initialization and remembers the surfaces of the accelerator search.
+    ///
+    /// If the track is still in the volume and search bins of the last
+    /// initialization (or of the last search of its leader track), the
+    /// surfaces of that search are intersected directly. Guided navigation
+    /// and searches along the track direction are not cached, neither is any
+    /// search if the navigator was not instantiated with the
+    /// @c search_cache feature.
+    ///
+    /// @param navigation the navigation state (holds the search cache)
+    /// @param volume the volume to be searched
+    /// @param track the track (or ray) to be intersected
+    /// @param vol_cfg the navigation configuration of the volume
+    template <typename volume_t, typename track_t>
+    DETRAY_HOST_DEVICE inline void search_candidates_cached(
+        state &navigation, const volume_t &volume, const track_t &track,
+        const navigation::volume_config<scalar_type> &vol_cfg) const {
+
+        // The state has no search cache: Search as usual
+        if constexpr (not features_t::search_cache) {
+            search_candidates(navigation, volume, track, vol_cfg,
+                              navigation.candidates());
+        } else {
+            search_candidates_cached_impl(navigation, volume, track, vol_cfg);
+        }
+    }
+
+    /// @see search_candidates_cached
+    template <typename volume_t, typename track_t>
+    DETRAY_HOST_DEVICE inline void search_candidates_cached_impl(
+        state &navigation, const volume_t &volume, const track_t &track,
+        const navigation::volume_config<scalar_type> &vol_cfg) const {
+
+        const auto &det = *navigation.detector();
+        auto &search_cache = navigation.m_search_cache;
+        auto &candidates = navigation.candidates();
+
+        const std::uint64_t key{
+            (navigation.is_guided() or vol_cfg.search_path_length > 0.f)
+                ? search_cache_type::k_invalid_key
+                : search_bin_key(det, det.volumes()[volume.index()], track,
+                                 vol_cfg)};
+
+        if (key == search_cache_type::k_invalid_key) {
+            search_cache.clear();
+            search_candidates(navigation, volume, track, vol_cfg, candidates);
+            return;
+        }
+
+        // The portals are not recorded, if they are searched separately
+        const bool skip_portals{use_exit_search(volume, vol_cfg) or
+                                vol_cfg.binned_portals};
+
+        trf_cache_type trf_cache{};
+
+        // Same bins as before, or as the leader track: Skip the accelerator
+        // search
+        const search_cache_type *replay{nullptr};
+        if (search_cache.is_hit(volume.index(), key)) {
+            replay = &search_cache;
+        } else if constexpr (features_t::bundle) {
+            if (navigation.has_leader() and
+                navigation.m_leader_search->is_hit(volume.index(), key)) {
+                replay = navigation.m_leader_search;
+            }
+        }
+
+        if (replay != nullptr) {
+            constexpr candidate_search search{};
+            for (const dindex sf_idx : replay->surfaces) {
+                search(det.surface(sf_idx), det, track, candidates,
+                       vol_cfg.mask_tolerance, vol_cfg.overstep_tolerance,
+                       skip_portals, &trf_cache, vol_cfg.skip_empty_passives,
+                       navigation.placements());
+            }
+        } else {
+            search_cache.reset(volume.index(), key);
+            if (vol_cfg.unique_candidates) {
+                volume.template visit_unique_neighborhood<
+                    recording_candidate_search>(
+                    track, vol_cfg, det, track, candidates,
+                    vol_cfg.mask_tolerance, vol_cfg.overstep_tolerance,
+                    search_cache, skip_portals, &trf_cache,
+                    vol_cfg.skip_empty_passives, navigation.placements());
+            } else {
+                volume.template visit_neighborhood<recording_candidate_search>(
+                    track, vol_cfg, det, track, candidates,
+                    vol_cfg.mask_tolerance, vol_cfg.overstep_tolerance,
+                    search_cache, skip_portals, &trf_cache,
+                    vol_cfg.skip_empty_passives, navigation.placements());
+            }
+        }
+
+        if (skip_portals) {
+            search_portals(det, volume, track, vol_cfg, candidates);
+        }
+    }
+
+    /// @brief Helper method that drops the portals behind the search horizon.
+    ///
+    /// If an accelerator only returned the surfaces in a window ahead of the
+    /// track, the portals that lie beyond the window must not become the next
+    /// target, since the track could skip surfaces outside of the window on
+    /// the way there. They are flagged as unreachable, so that the cache runs
+    /// empty at the end of the window and the volume is re-initialized. If no
+    /// other surface ahead of the track can be reached, the portals are kept.
+    ///
+    /// @param det the detector
+    /// @param volume the volume that was searched
+    /// @param track the track (or ray) that was intersected
+    /// @param vol_cfg the navigation configuration of the volume
+    /// @param candidates the cache to be cut
+    template <typename volume_t, typename track_t>
+    DETRAY_HOST_DEVICE inline void cut_at_search_horizon(
+        const detector_type &det, const volume_t &volume, const track_t &track,
+        const navigation::volume_config<scalar_type> &vol_cfg,
+        candidate_cache_type &candidates) const {
+
+        using geo_obj_id = typename volume_type::object_id;
+        constexpr scalar_type inf{std::numeric_limits<scalar_type>::max()};
+
+        const auto &vol_desc = det.volumes()[volume.index()];
+
+        scalar_type horizon{inf};
+        for (std::size_t i = 0u;
+             i < static_cast<std::size_t>(geo_obj_id::e_size); ++i) {
+            const auto &link = vol_desc.accel_link()[i];
+            if (link.is_invalid()) {
+                continue;
+            }
+            const scalar_type h{
+                det.accelerator_store().template visit<search_horizon_getter>(
+                    link, track, vol_cfg)};
+            horizon = h < horizon ? h : horizon;
+        }
+        if (horizon == inf) {
+            return;
+        }
+
+        // Is there a target ahead of the track, once the portals are cut?
+        auto is_target = [horizon](const intersection_type &candidate) {
+            return candidate.path > 0.f and
+                   (not candidate.sf_desc.is_portal() or
+                    candidate.path <= horizon);
+        };
+        if (detail::find_if(candidates.begin(), candidates.end(), is_target) ==
+            candidates.end()) {
+            return;
+        }
+        for (auto &candidate : candidates) {
+            if (candidate.sf_desc.is_portal() and candidate.path > horizon) {
+                candidate.path = inf;
+            }
+        }
+    }
+
+    /// @brief Helper method that adds the portals, which were skipped in the
+    /// accelerator search, to the candidates.
+    ///
+    /// With binned portals, only the portals that the grids of the volume
+    /// hold in the bin of the track position are intersected. If none of
+    /// them lies ahead of the track (e.g. the bin holds no portals, or the
+    /// track does not move like the tracks the subsets were recorded for),
+    /// the portals of the volume are searched as usual.
+    ///
+    /// @param det the detector
+    /// @param volume the volume to be searched
+    /// @param track the track (or ray) to be intersected
+    /// @param vol_cfg the navigation configuration of the volume
+    /// @param candidates the cache to be filled
+    template <typename volume_t, typename track_t>
+    DETRAY_HOST_DEVICE inline void search_portals(
+        const detector_type &det, const volume_t &volume, const track_t &track,
+        const navigation::volume_config<scalar_type> &vol_cfg,
+        candidate_cache_type &candidates) const {
+
+        using geo_obj_id = typename volume_type::object_id;
+
+        if (vol_cfg.binned_portals) {
+            const auto &vol_desc = det.volumes()[volume.index()];
+
+            for (std::size_t i = 0u;
+                 i < static_cast<std::size_t>(geo_obj_id::e_size); ++i) {
+                const auto &link = vol_desc.accel_link()[i];
+                if (link.is_invalid()) {
+                    continue;
+                }
+                det.accelerator_store().template visit<binned_portal_search>(
+                    link, det, vol_desc, track, vol_cfg, candidates);
+            }
+
+            // Is one of the portals of the bin ahead of the track?
+            const scalar_type tol{math::abs(vol_cfg.overstep_tolerance)};
+            auto is_exit = [tol](const intersection_type &candidate) {
+                return candidate.sf_desc.is_portal() and candidate.path > tol;
+            };
+            if (detail::find_if(candidates.begin(), candidates.end(),
+                                is_exit) != candidates.end()) {
+                return;
+            }
+        }
+
+        if (use_exit_search(volume, vol_cfg)) {
+            search_exit_portals(det, volume, track, vol_cfg, candidates);
+            return;
+        }
+
+        constexpr candidate_search search{};
+        for (const auto &pt_desc : volume.portals()) {
+            if (pt_desc.is_portal()) {
+                search(pt_desc, det, track, candidates, vol_cfg.mask_tolerance,
+                       vol_cfg.overstep_tolerance);
+            }
+        }
+    }
+
+    /// @returns whether the exit portals of @param volume are found from the
+    /// unbounded portal surfaces, instead of intersecting all portals
+    template <typename volume_t>
+    DETRAY_HOST_DEVICE inline bool use_exit_search(
+        const volume_t &volume,
+        const navigation::volume_config<scalar_type> &vol_cfg) const {
+        return vol_cfg.analytic_portal_exit and
+               (volume.id() == volume_id::e_cylinder or
+                volume.id() == volume_id::e_cuboid);
+    }
+
+    /// @brief Helper method that adds the portals through which the track can
+    /// leave the volume to the candidates.
+    ///
+    /// The path lengths to the unbounded portal surfaces (planes and
+    /// cylinders that bound the volume) are computed first. The smallest path
+    /// beyond the overstep tolerance is the exit distance. Only the portals
+    /// that can be reached before the exit (including a portal that the track
+    /// currently sits on) are intersected fully.
+    ///
+    /// @param det the detector
+    /// @param volume the volume to be searched
+    /// @param track the track (or ray) to be intersected
+    /// @param vol_cfg the navigation configuration of the volume
+    /// @param candidates the cache to be filled
+    template <typename volume_t, typename track_t>
+    DETRAY_HOST_DEVICE inline void search_exit_portals(
+        const detector_type &det, const volume_t &volume, const track_t &track,
+        const navigation::volume_config<scalar_type> &vol_cfg,
+        candidate_cache_type &candidates) const {
+
+        constexpr candidate_search search{};
+        // Maximal number of portals for which the path lengths are kept
+        constexpr std::size_t k_max_portals{16u};
+
+        const auto portals = volume.portals();
+
+        if (portals.size() > k_max_portals) {
+            for (const auto &pt_desc : portals) {
+                search(pt_desc, det, track, candidates, vol_cfg.mask_tolerance,
+                       vol_cfg.overstep_tolerance);
+            }
+            return;
+        }
+
+        const detail::ray<typename detector_type::algebra_type> ray(track);
+        const scalar_type tol{math::abs(vol_cfg.overstep_tolerance)};
+
+        // Path lengths to the unbounded portal surfaces and exit distance
+        darray<darray<scalar_type, 2>, k_max_portals> paths;
+        scalar_type exit_path{detail::invalid_value<scalar_type>()};
+
+        std::size_t i{0u};
+        for (const auto &pt_desc : portals) {
+            paths[i] = surface{det, pt_desc}
+                           .template visit_mask<detail::portal_distance>(
+                               ray, det.transform_store(), pt_desc.transform());
+            for (const scalar_type s : paths[i]) {
+                if (s > tol and s < exit_path) {
+                    exit_path = s;
+                }
+            }
+            ++i;
+        }
+
+        // Keep every portal with a solution in the window (invalid values,
+        // e.g. NaN, are not discarded)
+        const scalar_type min_path{vol_cfg.overstep_tolerance};
+        const scalar_type max_path{exit_path + tol};
+
+        i = 0u;
+        for (const auto &pt_desc : portals) {
+            for (const scalar_type s : paths[i]) {
+                if (not(s < min_path or s > max_path)) {
+                    search(pt_desc, det, track, candidates,
+                           vol_cfg.mask_tolerance, vol_cfg.overstep_tolerance);
+                    break;
+                }
+            }
+            ++i;
+        }
+    }
+
+    /// @brief Helper method that fills the candidates cache of a gap volume
+    /// (a volume that contains only portals) with its exit portal.
+    ///
+    /// The exit portal is found from the unbounded portal surfaces, without
+    /// querying the volume accelerators. This is only done if the sagitta of
+    /// the track on the way to the exit is below the mask tolerance, so that
+    /// the track cannot bend towards a different portal.
+    ///
+    /// @param propagation contains the stepper and navigator states
+    /// @param volume the volume to be searched
+    /// @param vol_cfg the navigation configuration of the volume
+    ///
+    /// @returns false if the shortcut does not apply (the cache stays empty)
+    template <typename propagator_state_t, typename volume_t>
+    DETRAY_HOST_DEVICE inline bool search_gap_exit(
+        propagator_state_t &propagation, const volume_t &volume,
+        const navigation::volume_config<scalar_type> &vol_cfg) const {
+
+        if (not volume.is_portal_only() or
+            not(volume.id() == volume_id::e_cylinder or
+                volume.id() == volume_id::e_cuboid)) {
+            return false;
+        }
+
+        state &navigation = propagation._navigation;
+        auto &candidates = navigation.candidates();
+
+        search_exit_portals(*navigation.detector(), volume,
+                            propagation._stepping(), vol_cfg, candidates);
+
+        // Straight line tracks always reach the exit portal
+        const scalar_type curvature{track_curvature(propagation)};
+        if (curvature == 0.f) {
+            return true;
+        }
+
+        scalar_type max_path{0.f};
+        for (const auto &candidate : candidates) {
+            max_path = math::max(max_path, candidate.path);
+        }
+        if (0.5f * curvature * max_path * max_path < vol_cfg.mask_tolerance) {
+            return true;
+        }
+
+        // The track bends too much: Run the full search
+        candidates.clear();
+
+        return false;
+    }
+
+    /// @returns the key of the bins that the accelerators of the volume
+    /// @param vol_desc search for the @param track , or an invalid key if the
+    /// search cannot be cached
+    template <typename track_t>
+    DETRAY_HOST_DEVICE inline std::uint64_t search_bin_key(
+        const detector_type &det, const volume_type &vol_desc,
+        const track_t &track,
+        const navigation::volume_config<scalar_type> &vol_cfg) const {
+
+        using geo_obj_id = typename volume_type::object_id;
+
+        std::uint64_t key{0u};
+        for (std::size_t i = 0u;
+             i < static_cast<std::size_t>(geo_obj_id::e_size); ++i) {
+            const auto &link = vol_desc.accel_link()[i];
+            if (link.is_invalid()) {
+                continue;
+            }
+            const std::uint64_t bin_key{
+                det.accelerator_store().template visit<search_bin_getter>(
+                    link, det, vol_desc, track, vol_cfg)};
+
+            if (bin_key == search_cache_type::k_invalid_key) {
+                return bin_key;
+            }
+            // Only one binned accelerator per volume can be keyed
+            if (bin_key != 0u) {
+                if (key != 0u) {
+                    return search_cache_type::k_invalid_key;
+                }
+                key = bin_key;
+            }
+        }
+
+        return key;
+    }
+
+    /// @brief Helper method that fills the look-ahead cache.
+    ///
+    /// If the next candidate is a portal, the surfaces of the volume it links
+    /// to are searched and intersected from the point where the track is
+    /// expected to cross the portal. The search bins at that point are kept,
+    /// so that the candidates are only used if the track really crosses the
+    /// portal in the same bins.
+    ///
+    /// @tparam propagator_state_t state type of the propagator
+    ///
+    /// @param propagation contains the stepper and navigator states
+    template <typename propagator_state_t>
+    DETRAY_HOST_DEVICE inline void prefetch(
+        propagator_state_t &propagation,
+        const navigation::config<scalar_type> &cfg) const {
+
+        state &navigation = propagation._navigation;
+        const auto &next = *navigation.next();
+
+        if (not navigation.m_can_prefetch or not next.sf_desc.is_portal() or
+            detail::is_invalid_value(next.volume_link) or
+            navigation.has_lookahead(next.sf_desc.barcode())) {
+            return;
+        }
+
+        const auto det = navigation.detector();
+        const auto &track = propagation._stepping();
+
+        // The distance to the portal might be outdated (e.g. after the track
+        // reached the previous candidate)
+        intersection_type portal{next};
+        if (not update_candidate(
+                portal, track, det,
+                get_volume_config(propagation, cfg, navigation.volume()),
+                navigation.placements())) {
+            return;
+        }
+
+        // Straight line estimate of the portal crossing
+        detail::ray<typename detector_type::algebra_type> ray(track);
+        ray.set_pos(ray.pos(portal.path));
+
+        const auto volume = detector_volume{*det, portal.volume_link};
+
+        const auto vol_cfg =
+            get_volume_config(propagation, cfg, portal.volume_link);
+
+        // Without a key, the search cannot be checked after the crossing
+        // (searches along the direction depend on more than the bins)
+        const std::uint64_t key{
+            vol_cfg.search_path_length > 0.f
+                ? search_cache_type::k_invalid_key
+                : search_bin_key(*det, det->volumes()[portal.volume_link],
+                                 ray, vol_cfg)};
+        if (key == search_cache_type::k_invalid_key) {
+            return;
+        }
+
+        navigation.clear_lookahead();
+        search_candidates(navigation, volume, ray, vol_cfg,
+                          navigation.lookahead_cache());
+        navigation.m_lookahead_portal = portal.sf_desc.barcode();
+        navigation.m_lookahead_key = key;
+    }
+
+    /// @brief Helper method that replaces the candidates by the prefetched
+    /// candidates of the new volume after a portal was crossed.
+    ///
+    /// The prefetched candidates are re-evaluated and sorted like in a 'fair
+    /// trust' update, which skips the search in the volume accelerators. This
+    /// requires that the accelerators search the same bins at the real
+    /// crossing as at the estimated crossing of the prefetch (a curved track
+    /// might reach the portal elsewhere).
+    ///
+    /// @tparam propagator_state_t state type of the propagator
+    ///
+    /// @param propagation contains the stepper and navigator states
+    ///
+    /// @returns false, if no matching look-ahead was available or the
+    /// prefetched candidates are not reachable (volume needs init)
+    template <typename propagator_state_t>
+    DETRAY_HOST_DEVICE inline bool switch_to_lookahead(
+        propagator_state_t &propagation,
+        const navigation::config<scalar_type> &cfg) const {
+
+        if constexpr (not features_t::lookahead) {
+            return false;
+        } else {
+            return switch_to_lookahead_impl(propagation, cfg);
+        }
+    }
+
+    /// @see switch_to_lookahead
+    template <typename propagator_state_t>
+    DETRAY_HOST_DEVICE inline bool switch_to_lookahead_impl(
+        propagator_state_t &propagation,
+        const navigation::config<scalar_type> &cfg) const {
+
+        state &navigation = propagation._navigation;
+
+        if (not cfg.portal_lookahead or
+            not navigation.has_lookahead(
+                navigation.current()->sf_desc.barcode())) {
+            return false;
+        }
+
+        // Check the search bins at the real portal crossing
+        const auto det = navigation.detector();
+        const std::uint64_t key{search_bin_key(
+            *det, det->volumes()[navigation.volume()], propagation._stepping(),
+            get_volume_config(propagation, cfg, navigation.volume()))};
+        if (key != navigation.m_lookahead_key) {
+            navigation.clear_lookahead();
+            return false;
+        }
+
+        navigation.swap_lookahead();
+        navigation.m_trust_level = navigation::trust_level::e_fair;
+        update_kernel(propagation, cfg);
+
+        if (navigation.is_exhausted()) {
+            return false;
+        }
+
+        auto &stepping = propagation._stepping;
+        stepping.reset_step_size(navigation());
+
+        navigation.run_inspector(cfg, "Volume switch (look-ahead): ",
+                                 navigation::event::e_lookahead_switch);
+
+        return true;
+    }
+
+    /// @brief Helper method to get the navigation settings for a volume.
+    ///
+    /// If the adaptive mask tolerance is switched on, the tolerance of the
+    /// volume is widened to the sagitta of the track over the current step,
+    /// i.e. the distance between the straight line that is used for the
+    /// surface intersection and the curved track. The result is capped at the
+    /// maximal mask tolerance. Before the first step, the step length is not
+    /// known yet and the maximal tolerance is used.
+    ///
+    /// @tparam propagator_state_t state type of the propagator
+    ///
+    /// @param propagation contains the stepper and navigator states
+    /// @param vol_idx index of the volume
+    ///
+    /// @returns the navigation settings that apply in the volume
+    template <typename propagator_state_t>
+    DETRAY_HOST_DEVICE inline auto get_volume_config(
+        const propagator_state_t &propagation,
+        const navigation::config<scalar_type> &cfg,
+        const dindex vol_idx) const -> navigation::volume_config<scalar_type> {
+
+        auto vol_cfg = cfg.for_volume(vol_idx);
+
+        if (not cfg.adaptive_mask_tolerance) {
+            return vol_cfg;
+        }
+
+        const scalar_type curvature{track_curvature(propagation)};
+        if (curvature == 0.f) {
+            return vol_cfg;
+        }
+
+        const auto &stepping = propagation._stepping;
+        const scalar_type step{
+            math::max(math::abs(stepping._step_size),
+                      math::abs(stepping._prev_step_size))};
+        if (step == 0.f) {
+            vol_cfg.mask_tolerance =
+                math::max(vol_cfg.mask_tolerance, cfg.max_mask_tolerance);
+            return vol_cfg;
+        }
+
+        const scalar_type sagitta{0.5f * curvature * step * step};
+        vol_cfg.mask_tolerance = math::max(
+            vol_cfg.mask_tolerance, math::min(sagitta, cfg.max_mask_tolerance));
+
+        return vol_cfg;
+    }
+
+    /// @returns the curvature of the track: |dt/ds| = |q/p (t x B)| for the
+    /// Runge-Kutta stepper, zero for straight line steppers
+    ///
+    /// @note Before the first step, the field is not cached in the stepper
+    /// yet and is looked up at the track position
+    template <typename propagator_state_t>
+    DETRAY_HOST_DEVICE inline auto track_curvature(
+        const propagator_state_t &propagation) const -> scalar_type {
+
+        using stepping_t = std::decay_t<decltype(propagation._stepping)>;
+
+        if constexpr (stepping_t::id == stepping::id::e_rk) {
+            const auto &stepping = propagation._stepping;
+            const auto &track = stepping();
+
+            auto b_field = stepping._step_data.b_first;
+            if (getter::norm(b_field) == 0.f) {
+                b_field = stepping.evaluate_field(track.pos());
+            }
+
+            return math::abs(track.qop()) *
+                   getter::norm(vector::cross(track.dir(), b_field));
+        } else {
+            return 0.f;
+        }
+    }
+
     /// @brief Helper method that updates the intersection of a single candidate
     /// and checks reachability
     ///
@@ -721,24 +2340,83 @@ class navigator {
     ///
     /// @param candidate the intersection to be updated
     /// @param track the track information
+    /// @param cfg the navigation settings in the current volume
+    /// @param placements alternative placements of the surfaces (optional)
     ///
     /// @returns whether the track can reach this candidate.
     template <typename track_t>
     DETRAY_HOST_DEVICE inline bool update_candidate(
         intersection_type &candidate, const track_t &track,
         const detector_type *det,
-        const navigation::config<scalar_type> &cfg) const {
+        const navigation::volume_config<scalar_type> &cfg,
+        const placement_records &placements = {}) const {
 
         if (candidate.sf_desc.barcode().is_invalid()) {
             return false;
         }
 
         const auto sf = surface{*det, candidate.sf_desc};
+        const scalar_type tol{sf.is_portal() ? 0.f : cfg.mask_tolerance};
 
         // Check whether this candidate is reachable by the track
+        if (placements.planes) {
+            return sf.template visit_mask<intersection_update<ray_intersector>>(
+                detail::ray(track), candidate,
+                plane_transforms_type{det->transform_store(),
+                                      placements.planes},
+                tol, cfg.overstep_tolerance);
+        }
+        if (placements.barrels) {
+            return sf.template visit_mask<intersection_update<ray_intersector>>(
+                detail::ray(track), candidate,
+                procedural_transforms_type{det->transform_store(),
+                                           placements.barrels,
+                                           placements.n_barrels},
+                tol, cfg.overstep_tolerance);
+        }
         return sf.template visit_mask<intersection_update<ray_intersector>>(
-            detail::ray(track), candidate, det->transform_store(),
-            sf.is_portal() ? 0.f : cfg.mask_tolerance, cfg.overstep_tolerance);
+            detail::ray(track), candidate, det->transform_store(), tol,
+            cfg.overstep_tolerance);
+    }
+
+    /// Helper to order the candidates in the range [first, last) according to
+    /// the policy in the navigation configuration @param cfg
+    ///
+    /// @returns the end of the range of candidates that are in order
+    template <typename candidate_itr_t>
+    DETRAY_HOST_DEVICE inline auto order_candidates(
+        candidate_itr_t first, candidate_itr_t last,
+        const navigation::config<scalar_type> &cfg) const -> candidate_itr_t {
+
+        switch (cfg.ordering) {
+            case navigation::candidate_ordering::e_insertion: {
+                insertion_sort(first, last);
+                return last;
+            }
+            case navigation::candidate_ordering::e_adaptive: {
+                detail::adaptive_sort(first, last);
+                return last;
+            }
+            case navigation::candidate_ordering::e_k_nearest: {
+                // Move unreachable candidates out of the way, so that they can
+                // be cut by 'find_invalid' without a complete sort
+                auto reachable_end = detail::partition(
+                    first, last, [](const intersection_type &candidate) {
+                        return candidate.path !=
+                               std::numeric_limits<scalar_type>::max();
+                    });
+                const auto n_reachable{std::distance(first, reachable_end)};
+                const auto k{static_cast<decltype(n_reachable)>(cfg.n_nearest)};
+                auto middle = (k > 0 and k < n_reachable) ? first + k
+                                                          : reachable_end;
+                detail::sequential_partial_sort(first, middle, reachable_end);
+                return middle;
+            }
+            default: {
+                detail::sequential_sort(first, last);
+                return last;
+            }
+        }
     }
 
     /// Helper to evict all unreachable/invalid candidates from the cache:
@@ -747,7 +2425,7 @@ class navigator {
     ///
     /// @param candidates the cache of candidates to be cleaned
     DETRAY_HOST_DEVICE inline auto find_invalid(
-        vector_type<intersection_type> &candidates) const {
+        candidate_cache_type &candidates) const {
         // Depends on previous invalidation of unreachable candidates!
         auto not_reachable = [](const intersection_type &candidate) {
             return candidate.path == std::numeric_limits<scalar_type>::max();
@@ -758,23 +2436,109 @@ class navigator {
     }
 };
 
-/// @return the vecmem jagged vector buffer for surface candidates
-// TODO: det.get_n_max_objects_per_volume() is way too many for
-// candidates size allocation. With the local navigation, the size can be
-// restricted to much smaller value
-template <typename detector_t>
+/// @returns the number of candidates per track that a candidates buffer
+/// needs for the navigation config @param cfg : the largest neighborhood any
+/// volume can return for the search windows of the config (global and
+/// per-volume), times the largest number of intersections of a surface.
+///
+/// @note A search along a path (@c search_path_length ) can span any number
+/// of bins, so that the bound then assumes a search over the entire grids.
+template <typename detector_t, typename scalar_t>
+DETRAY_HOST std::size_t n_max_candidates(
+    const detector_t &det, const navigation::config<scalar_t> &cfg) {
+
+    // The grids clamp the search window to the number of bins of an axis
+    constexpr dindex full_axis{detail::invalid_value<dindex>() / 4u};
+    auto max_neighborhood = [&det](const auto &search_cfg) {
+        if (search_cfg.search_path_length > 0.f) {
+            return det.n_max_candidates(
+                std::array<dindex, 2>{full_axis, full_axis});
+        }
+        return det.n_max_candidates(search_cfg.search_window);
+    };
+
+    // Volumes with their own search settings might need more space
+    std::size_t n_surfaces{max_neighborhood(cfg)};
+    for (const auto &vol_cfg : cfg.volume_configs) {
+        n_surfaces = std::max(n_surfaces, max_neighborhood(vol_cfg));
+    }
+
+    // Room for one more surface: The navigator reports an overflow as soon
+    // as the next surface might not fit
+    constexpr std::size_t n_solutions{
+        detail::max_intersection_solutions<detector_t>()};
+
+    return (n_surfaces + 1u) * n_solutions;
+}
+
+/// @return the vecmem jagged vector buffer for surface candidates, with a
+/// capacity per track of @c n_max_candidates for the navigation config
+/// @param cfg , scaled by @param scale
+///
+/// @note The device vectors on the buffer cannot grow: If the candidates of a
+/// volume do not fit, the navigation stops with the status
+/// @c navigation::status::e_overflow (see
+/// @c propagate_with_candidates_buffer for a retry with a larger buffer).
+template <typename detector_t, typename scalar_t>
 DETRAY_HOST vecmem::data::jagged_vector_buffer<intersection2D<
     typename detector_t::surface_type, typename detector_t::algebra_type>>
 create_candidates_buffer(
     const detector_t &det, const std::size_t n_tracks,
+    const navigation::config<scalar_t> &cfg,
     vecmem::memory_resource &device_resource,
-    vecmem::memory_resource *host_access_resource = nullptr) {
+    vecmem::memory_resource *host_access_resource = nullptr,
+    const std::size_t scale = 1u) {
+
     // Build the buffer from capacities, device and host accessible resources
     return vecmem::data::jagged_vector_buffer<intersection2D<
         typename detector_t::surface_type, typename detector_t::algebra_type>>(
-        std::vector<std::size_t>(n_tracks, det.n_max_candidates()),
+        std::vector<std::size_t>(n_tracks, scale * n_max_candidates(det, cfg)),
         device_resource, host_access_resource,
         vecmem::data::buffer_type::resizable);
 }
 
+/// @brief Run a propagation on a candidates buffer and retry with a larger
+/// buffer, as long as the candidate cache of any track overflows.
+///
+/// The capacity per track doubles with every attempt.
+///
+/// @param det the detector
+/// @param n_tracks the number of tracks
+/// @param cfg the navigation config the propagation runs with
+/// @param propagate callable that runs the propagation on a (set up)
+///        candidates buffer and @returns the number of tracks that stopped
+///        with @c navigation::status::e_overflow
+/// @param copy the vecmem copy object to set up the buffers with
+/// @param device_resource the memory resource of the buffer
+/// @param host_access_resource optional host accessible resource
+/// @param max_attempts the number of propagation runs at most
+///
+/// @returns the candidates buffer of the last attempt, together with the
+/// number of tracks that still overflowed (zero on success)
+template <typename detector_t, typename scalar_t, typename propagate_t>
+DETRAY_HOST auto propagate_with_candidates_buffer(
+    const detector_t &det, const std::size_t n_tracks,
+    const navigation::config<scalar_t> &cfg, propagate_t &&propagate,
+    vecmem::copy &copy, vecmem::memory_resource &device_resource,
+    vecmem::memory_resource *host_access_resource = nullptr,
+    const unsigned int max_attempts = 4u) {
+
+    std::size_t scale{1u};
+    auto buffer = create_candidates_buffer(det, n_tracks, cfg, device_resource,
+                                           host_access_resource, scale);
+    copy.setup(buffer);
+    std::size_t n_overflows{propagate(buffer)};
+
+    for (unsigned int attempt = 1u; n_overflows > 0u and attempt < max_attempts;
+         ++attempt) {
+        scale *= 2u;
+        buffer = create_candidates_buffer(det, n_tracks, cfg, device_resource,
+                                          host_access_resource, scale);
+        copy.setup(buffer);
+        n_overflows = propagate(buffer);
+    }
+
+    return std::make_pair(std::move(buffer), n_overflows);
+}
+
 }  // namespace detray
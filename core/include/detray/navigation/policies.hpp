@@ -9,8 +9,10 @@
 
 // detray definitions
 #include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/indexing.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/propagator/base_actor.hpp"
+#include "detray/utils/invalid_values.hpp"
 
 // system includes
 #include <climits>
@@ -128,4 +130,117 @@ struct stepper_rk_policy : actor {
     }
 };
 
+/// Navigation policy that predicts whether the order of the candidates can
+/// have changed since the last full update of the candidates: The transverse
+/// deviation of the track from the straight line at the last full update is
+/// compared with the smallest gap between the path lengths of neighbouring
+/// candidates. Only if the deviation (times a safety factor) reaches the gap,
+/// the trust level is lowered to 'fair trust' and the candidates are sorted
+/// again, otherwise only the next candidate is updated ('high trust').
+///
+/// @note Only the sorted range of the candidate cache is checked.
+template <typename algebra_t>
+struct stepper_curvature_policy : actor {
+
+    using scalar_type = dscalar<algebra_t>;
+    using point3_type = dpoint3D<algebra_t>;
+    using vector3_type = dvector3D<algebra_t>;
+
+    struct state {
+        /// Safety factor on the transverse deviation, as the change of the
+        /// path length grows with the incidence angle on the surfaces
+        scalar_type safety{2.f};
+
+        /// Track position, direction and path length at the last full update
+        /// @{
+        point3_type ref_pos{0.f, 0.f, 0.f};
+        vector3_type ref_dir{0.f, 0.f, 1.f};
+        scalar_type ref_path{0.f};
+        /// @}
+
+        /// Track position, direction and path length at the previous call
+        /// @{
+        point3_type prev_pos{0.f, 0.f, 0.f};
+        vector3_type prev_dir{0.f, 0.f, 1.f};
+        scalar_type prev_path{0.f};
+        /// @}
+
+        /// Volume at the previous call
+        dindex volume{detail::invalid_value<dindex>()};
+    };
+
+    /// Sets the navigation trust level depending on whether the candidate
+    /// order can have changed
+    ///
+    /// @param pol_state contains the safety factor and the track reference
+    /// @param propagation state of the propagation
+    template <typename propagator_state_t>
+    DETRAY_HOST_DEVICE inline void operator()(
+        state &pol_state, propagator_state_t &propagation) const {
+
+        const auto &stepping = propagation._stepping;
+        auto &navigation = propagation._navigation;
+        const auto &track = stepping();
+
+        const point3_type pos = track.pos();
+        const vector3_type dir = track.dir();
+        const scalar_type path{stepping.path_length()};
+
+        bool is_stale{false};
+        if (detail::is_invalid_value(pol_state.volume)) {
+            // The start position is unknown: Sort again once
+            is_stale = true;
+        } else if (static_cast<dindex>(navigation.volume()) !=
+                   pol_state.volume) {
+            // The candidates of the new volume were set up at the end of the
+            // previous step
+            pol_state.ref_pos = pol_state.prev_pos;
+            pol_state.ref_dir = pol_state.prev_dir;
+            pol_state.ref_path = pol_state.prev_path;
+        }
+
+        if (!is_stale) {
+            // Transverse deviation from the straight line at the reference
+            const vector3_type v = pos - pol_state.ref_pos;
+            const scalar_type d_perp{getter::norm(
+                v - vector::dot(v, pol_state.ref_dir) * pol_state.ref_dir)};
+
+            // The path lengths of the candidates after the next one are still
+            // those of the last full update, the next candidate was updated at
+            // the previous call
+            const auto last = navigation.sorted_end() < navigation.last()
+                                  ? navigation.sorted_end()
+                                  : navigation.last();
+            auto itr = navigation.next();
+            if (itr != last) {
+                scalar_type prev{itr->path + pol_state.prev_path -
+                                 pol_state.ref_path};
+                for (++itr; itr != last; ++itr) {
+                    if (itr->path - prev <= pol_state.safety * d_perp) {
+                        is_stale = true;
+                        break;
+                    }
+                    prev = itr->path;
+                }
+            }
+        }
+
+        if (is_stale) {
+            // Re-evaluate all candidates at the current position
+            navigation.set_fair_trust();
+            pol_state.ref_pos = pos;
+            pol_state.ref_dir = dir;
+            pol_state.ref_path = path;
+        } else {
+            // Re-evaluate only next candidate
+            navigation.set_high_trust();
+        }
+
+        pol_state.prev_pos = pos;
+        pol_state.prev_dir = dir;
+        pol_state.prev_path = path;
+        pol_state.volume = static_cast<dindex>(navigation.volume());
+    }
+};
+
 }  // namespace detray
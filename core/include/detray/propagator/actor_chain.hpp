@@ -31,22 +31,83 @@ class actor_chain {
     using actor_list_type = tuple_t<actors_t...>;
     // Type of states tuple that is used in the propagator
     using state = tuple_t<typename actors_t::state &...>;
+    // Type of the tuple that holds the actor states
+    using state_tuple = tuple_t<typename actors_t::state...>;
+
+    /// @returns the states tuple for the propagator that refers to the actor
+    /// states in @param states
+    DETRAY_HOST_DEVICE static state make_state(state_tuple &states) {
+        return make_state(states,
+                          std::make_index_sequence<sizeof...(actors_t)>{});
+    }
 
     /// Call all actors in the chain.
     ///
+    /// If the chain contains surface actors, they are skipped with a single
+    /// check while the track is not on a module. On a module, the surface
+    /// mask is visited only once and handed to all surface actors.
+    ///
     /// @param states the states of the actors.
     /// @param p_state the propagation state.
     template <typename actor_states_t, typename propagator_state_t>
     DETRAY_HOST_DEVICE void operator()(actor_states_t &states,
                                        propagator_state_t &p_state) const {
 
-        run(states, p_state, std::make_index_sequence<sizeof...(actors_t)>{});
+        constexpr auto ids = std::make_index_sequence<sizeof...(actors_t)>{};
+
+        if constexpr (n_surface_actors == 0u) {
+            run(states, p_state, ids);
+        } else {
+            const auto &navigation = p_state._navigation;
+
+            if (not navigation.is_on_module()) {
+                run_off_surface(states, p_state, ids);
+                return;
+            }
+
+            using geo_cxt_t =
+                typename propagator_state_t::detector_type::geometry_context;
+            const geo_cxt_t ctx{};
+
+            // Resolve the surface and its mask once for all actors
+            const auto sf = navigation.get_surface();
+            sf.template visit_mask<fused_kernel>(sf.transform(ctx), sf, *this,
+                                                 states, p_state);
+        }
     }
 
     /// @returns the actor list
     DETRAY_HOST_DEVICE const actor_list_type &actors() const { return _actors; }
 
     private:
+    /// Whether an actor is called through the fused surface dispatch
+    template <typename actor_t>
+    static constexpr bool is_surface_actor_v{
+        actor_t::is_surface_actor::value and
+        not actor_t::is_comp_actor::value};
+
+    /// Number of surface actors in the chain
+    static constexpr std::size_t n_surface_actors{
+        (0u + ... + (is_surface_actor_v<actors_t> ? 1u : 0u))};
+
+    /// Mask store visitor that calls the actors on the resolved mask
+    struct fused_kernel {
+
+        template <typename mask_group_t, typename index_t,
+                  typename transform3_t, typename surface_t,
+                  typename actor_states_t, typename propagator_state_t>
+        DETRAY_HOST_DEVICE inline void operator()(
+            const mask_group_t &mask_group, const index_t &index,
+            const transform3_t &trf3, const surface_t &sf,
+            const actor_chain &chain, actor_states_t &states,
+            propagator_state_t &p_state) const {
+
+            chain.run_on_surface(
+                states, p_state, sf, mask_group, index, trf3,
+                std::make_index_sequence<sizeof...(actors_t)>{});
+        }
+    };
+
     /// Call the actors. Either single actor or composition.
     ///
     /// @param actr the actor (might be a composite actor)
@@ -76,6 +137,57 @@ class actor_chain {
         (run(detail::get<indices>(_actors), states, p_state), ...);
     }
 
+    /// Call the actors that do not only act on surfaces
+    template <typename actor_states_t, typename propagator_state_t,
+              std::size_t... indices>
+    DETRAY_HOST_DEVICE inline void run_off_surface(
+        actor_states_t &states, propagator_state_t &p_state,
+        std::index_sequence<indices...> /*ids*/) const {
+
+        auto run_if = [&](const auto &actr) {
+            using actor_t = std::decay_t<decltype(actr)>;
+            if constexpr (not is_surface_actor_v<actor_t>) {
+                run(actr, states, p_state);
+            }
+        };
+
+        (run_if(detail::get<indices>(_actors)), ...);
+    }
+
+    /// Call all actors in order on the current surface @param sf with its
+    /// resolved mask (given by @param mask_group and @param index)
+    template <typename actor_states_t, typename propagator_state_t,
+              typename surface_t, typename mask_group_t, typename index_t,
+              typename transform3_t, std::size_t... indices>
+    DETRAY_HOST_DEVICE inline void run_on_surface(
+        actor_states_t &states, propagator_state_t &p_state,
+        const surface_t &sf, const mask_group_t &mask_group,
+        const index_t &index, const transform3_t &trf3,
+        std::index_sequence<indices...> /*ids*/) const {
+
+        auto run_on_sf = [&](const auto &actr) {
+            using actor_t = std::decay_t<decltype(actr)>;
+            if constexpr (is_surface_actor_v<actor_t>) {
+                // A previous actor might have changed the navigation status
+                if (p_state._navigation.is_on_module()) {
+                    actr(detail::get<typename actor_t::state &>(states), sf,
+                         mask_group, index, trf3, p_state);
+                }
+            } else {
+                run(actr, states, p_state);
+            }
+        };
+
+        (run_on_sf(detail::get<indices>(_actors)), ...);
+    }
+
+    /// Resolve the references to the actor states
+    template <std::size_t... indices>
+    DETRAY_HOST_DEVICE static state make_state(
+        state_tuple &states, std::index_sequence<indices...> /*ids*/) {
+        return state(detail::get<indices>(states)...);
+    }
+
     /// Tuple of actors
     actor_list_type _actors = {};
 };
@@ -87,6 +199,12 @@ class actor_chain<> {
     public:
     /// Empty states replaces a real actor states container
     struct state {};
+    using state_tuple = state;
+
+    /// @returns the empty states
+    DETRAY_HOST_DEVICE static state make_state(state_tuple &states) {
+        return states;
+    }
 
     /// Call to actors does nothing.
     ///
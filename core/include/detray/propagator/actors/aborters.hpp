@@ -1,6 +1,6 @@
 /** Detray library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2023 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,11 +8,17 @@
 #pragma once
 
 // Project include(s)
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/math.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/units.hpp"
 #include "detray/propagator/base_actor.hpp"
 #include "detray/propagator/base_stepper.hpp"
+#include "detray/utils/invalid_values.hpp"
 
 // System include(s)
+#include <cstdint>
 #include <limits>
 
 namespace detray {
@@ -119,4 +125,119 @@ struct next_surface_aborter : actor {
     }
 };
 
+/// Aborter that stops soft looping tracks, which would otherwise propagate
+/// until the path limit is reached.
+///
+/// A track is stopped when its momentum falls below a threshold, when its
+/// direction turned more than a number of times in the transverse plane, or
+/// when it re-entered recently visited volumes too many times.
+struct looper_aborter : actor {
+
+    /// Reason why the track was stopped
+    enum class reason : std::uint_least8_t {
+        e_none = 0u,
+        e_momentum = 1u,
+        e_turns = 2u,
+        e_revisits = 3u,
+    };
+
+    /// Number of recently visited volumes that are checked for revisits
+    static constexpr unsigned int n_recent_volumes{8u};
+
+    struct state {
+        /// Momentum threshold
+        scalar min_p{0.f};
+        /// Maximal number of turns of the direction in phi
+        scalar max_turns{std::numeric_limits<scalar>::max()};
+        /// Maximal number of re-entries into recently visited volumes
+        unsigned int max_revisits{std::numeric_limits<unsigned int>::max()};
+
+        /// Accumulated turning angle in the transverse plane
+        scalar acc_phi{0.f};
+        /// Direction phi at the previous call
+        scalar prev_phi{detail::invalid_value<scalar>()};
+        /// Number of re-entries into recently visited volumes
+        unsigned int n_revisits{0u};
+        /// Recently visited volumes (ring buffer)
+        darray<dindex, n_recent_volumes> recent_volumes{};
+        /// Number of volumes that were entered
+        unsigned int n_volumes{0u};
+
+        /// Why the track was stopped
+        reason abort_reason{reason::e_none};
+
+        /// @returns the number of turns in the transverse plane
+        DETRAY_HOST_DEVICE
+        inline scalar n_turns() const {
+            return acc_phi / (2.f * constant<scalar>::pi);
+        }
+    };
+
+    /// Stops the propagation of a looping track
+    ///
+    /// @param abrt_state contains the thresholds and the track history
+    /// @param prop_state state of the propagation
+    template <typename propagator_state_t>
+    DETRAY_HOST_DEVICE void operator()(state &abrt_state,
+                                       propagator_state_t &prop_state) const {
+        auto &navigation = prop_state._navigation;
+        const auto &track = prop_state._stepping();
+
+        // Nothing left to do. Propagation will exit successfully
+        if (navigation.is_complete()) {
+            return;
+        }
+
+        // Check the momentum
+        if (track.p() < abrt_state.min_p) {
+            abrt_state.abort_reason = reason::e_momentum;
+            prop_state._heartbeat &= navigation.abort();
+            return;
+        }
+
+        // Accumulate the turning angle of the direction since the last call
+        const auto dir = track.dir();
+        const scalar phi{math::atan2(dir[1], dir[0])};
+        if (!detail::is_invalid_value(abrt_state.prev_phi)) {
+            scalar dphi{math::abs(phi - abrt_state.prev_phi)};
+            if (dphi > constant<scalar>::pi) {
+                dphi = 2.f * constant<scalar>::pi - dphi;
+            }
+            abrt_state.acc_phi += dphi;
+        }
+        abrt_state.prev_phi = phi;
+
+        if (abrt_state.n_turns() > abrt_state.max_turns) {
+            abrt_state.abort_reason = reason::e_turns;
+            prop_state._heartbeat &= navigation.abort();
+            return;
+        }
+
+        // Count the re-entries into recently visited volumes
+        const auto volume{static_cast<dindex>(navigation.volume())};
+        const unsigned int n_recent{abrt_state.n_volumes < n_recent_volumes
+                                        ? abrt_state.n_volumes
+                                        : n_recent_volumes};
+        const unsigned int last{(abrt_state.n_volumes + n_recent_volumes - 1u) %
+                                n_recent_volumes};
+
+        if (n_recent == 0u || abrt_state.recent_volumes[last] != volume) {
+            for (unsigned int i = 0u; i < n_recent; ++i) {
+                if (abrt_state.recent_volumes[i] == volume) {
+                    ++abrt_state.n_revisits;
+                    break;
+                }
+            }
+            abrt_state.recent_volumes[abrt_state.n_volumes %
+                                      n_recent_volumes] = volume;
+            ++abrt_state.n_volumes;
+        }
+
+        if (abrt_state.n_revisits > abrt_state.max_revisits) {
+            abrt_state.abort_reason = reason::e_revisits;
+            prop_state._heartbeat &= navigation.abort();
+        }
+    }
+};
+
 }  // namespace detray
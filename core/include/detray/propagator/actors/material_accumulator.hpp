@@ -0,0 +1,241 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/geometry/barcode.hpp"
+#include "detray/materials/detail/material_accessor.hpp"
+#include "detray/materials/interaction.hpp"
+#include "detray/propagator/actors/pointwise_material_interactor.hpp"
+#include "detray/propagator/base_actor.hpp"
+#include "detray/tracks/bound_track_parameters.hpp"
+#include "detray/utils/type_traits.hpp"
+
+// System include(s).
+#include <limits>
+#include <type_traits>
+
+namespace detray {
+
+/// @brief Accumulates the material budget along the track.
+///
+/// Sums up the path length in material, the path length in units of X0 and
+/// L0 and the mean energy loss on every material surface, without updating
+/// the track parameters. Once the track reaches the target surface, the
+/// accumulated material is applied to the bound track parameters in a single
+/// lumped update: The energy loss is subtracted from the momentum and, if
+/// requested, the covariance receives the energy loss straggling and the
+/// multiple scattering variance of the total X/X0 (Highland formula).
+///
+/// This is a cheaper approximation of the @c pointwise_material_interactor
+/// for applications that only need seeding-level precision, since the
+/// trajectory in between is not corrected for the energy loss.
+template <typename algebra_t>
+struct material_accumulator : actor {
+
+    using algebra_type = algebra_t;
+    using scalar_type = dscalar<algebra_t>;
+    using point2_type = dpoint2D<algebra_t>;
+    using interaction_type = interaction<scalar_type>;
+    using interactor_type = pointwise_material_interactor<algebra_t>;
+
+    struct state {
+
+        /// The particle mass
+        scalar_type mass{105.7f * unit<scalar_type>::MeV};
+        /// The particle pdg
+        int pdg = 13;  // default muon
+
+        /// Surface on which the accumulated material is applied (if the
+        /// barcode is invalid, the track parameters are never updated)
+        geometry::barcode target_surface{};
+
+        bool do_covariance_transport = true;
+        bool do_energy_loss = true;
+        bool do_multiple_scattering = true;
+
+        /// Accumulated material budget
+        /// @{
+        /// Path length in material
+        scalar_type path_length{0.f};
+        /// Path length in units of the radiation length
+        scalar_type path_in_X0{0.f};
+        /// Path length in units of the nuclear interaction length
+        scalar_type path_in_L0{0.f};
+        /// Mean energy loss
+        scalar_type e_loss{0.f};
+        /// Variance of q/p from the energy loss straggling
+        scalar_type var_qop{0.f};
+        /// Number of material surfaces that were crossed
+        unsigned int n_surfaces{0u};
+        /// @}
+
+        /// Whether the accumulated material was applied on the target
+        bool applied{false};
+
+        DETRAY_HOST_DEVICE
+        void reset() {
+            path_length = 0.f;
+            path_in_X0 = 0.f;
+            path_in_L0 = 0.f;
+            e_loss = 0.f;
+            var_qop = 0.f;
+            n_surfaces = 0u;
+            applied = false;
+        }
+    };
+
+    /// Material store visitor
+    struct kernel {
+
+        template <typename mat_group_t, typename index_t>
+        DETRAY_HOST_DEVICE inline bool operator()(
+            [[maybe_unused]] const mat_group_t &material_group,
+            [[maybe_unused]] const index_t &mat_index,
+            [[maybe_unused]] state &s,
+            [[maybe_unused]] const scalar_type qop,
+            [[maybe_unused]] const scalar_type charge,
+            [[maybe_unused]] const scalar_type cos_inc_angle,
+            [[maybe_unused]] const scalar_type approach,
+            [[maybe_unused]] const point2_type &loc) const {
+
+            using material_t = typename mat_group_t::value_type;
+
+            // Same material types as for the pointwise interactions
+            if constexpr ((detail::is_hom_material_v<material_t> &&
+                           !std::is_same_v<material_t,
+                                           material<scalar_type>>) ||
+                          detail::is_material_map_v<material_t>) {
+
+                const auto mat = detail::material_accessor::get(
+                    material_group, mat_index, loc);
+
+                if (mat.thickness() <=
+                    std::numeric_limits<scalar_type>::epsilon()) {
+                    return false;
+                }
+
+                const scalar_type path_segment{
+                    mat.path_segment(cos_inc_angle, approach)};
+
+                s.path_length += path_segment;
+                s.path_in_X0 += mat.path_segment_in_X0(cos_inc_angle, approach);
+                s.path_in_L0 += mat.path_segment_in_L0(cos_inc_angle, approach);
+                ++s.n_surfaces;
+
+                if (s.do_energy_loss) {
+                    s.e_loss +=
+                        interaction_type().compute_energy_loss_bethe_bloch(
+                            path_segment, mat.get_material(), s.pdg, s.mass,
+                            qop, charge);
+
+                    if (s.do_covariance_transport) {
+                        const scalar_type sigma_qop{
+                            interaction_type()
+                                .compute_energy_loss_landau_sigma_QOverP(
+                                    path_segment, mat.get_material(), s.pdg,
+                                    s.mass, qop, charge)};
+                        s.var_qop += sigma_qop * sigma_qop;
+                    }
+                }
+
+                return true;
+            } else {
+                return false;
+            }
+        }
+    };
+
+    template <typename propagator_state_t>
+    DETRAY_HOST_DEVICE inline void operator()(
+        state &accumulator_state, propagator_state_t &prop_state) const {
+
+        const auto &navigation = prop_state._navigation;
+
+        if (!navigation.encountered_sf_material()) {
+            return;
+        }
+
+        auto &bound_params = prop_state._stepping._bound_params;
+
+        // The track parameters are not updated before the target is reached:
+        // Evaluate the energy loss with the momentum after the accumulated
+        // energy loss
+        const scalar_type m{accumulator_state.mass};
+        const scalar_type p{bound_params.p()};
+        const scalar_type charge{bound_params.charge()};
+        const scalar_type pending_e_loss{
+            accumulator_state.applied ? 0.f : accumulator_state.e_loss};
+        const scalar_type energy{math::sqrt(m * m + p * p) - pending_e_loss};
+
+        // Particle at rest: Nothing left to accumulate
+        if (energy <= m) {
+            return;
+        }
+        const scalar_type p_run{math::sqrt(energy * energy - m * m)};
+        const scalar_type qop{(charge != 0.f ? charge : 1.f) / p_run};
+
+        // The local position of the intersection is already known
+        const auto &loc = navigation.current()->local;
+        navigation.get_surface().template visit_material<kernel>(
+            accumulator_state, qop, charge,
+            navigation.cos_incidence_angle(bound_params.dir()), loc[0],
+            point2_type{loc[0], loc[1]});
+
+        if (!accumulator_state.applied &&
+            navigation.barcode() == accumulator_state.target_surface) {
+            apply(bound_params, accumulator_state,
+                  static_cast<int>(navigation.direction()));
+        }
+    }
+
+    /// @brief Apply the accumulated material to the track parameters.
+    ///
+    /// @param[out] bound_params bound track parameter
+    /// @param[in,out] accumulator_state actor state
+    /// @param[in]  nav_dir navigation direction
+    DETRAY_HOST_DEVICE inline void apply(
+        bound_track_parameters<algebra_t> &bound_params,
+        state &accumulator_state, const int nav_dir) const {
+
+        const state &s = accumulator_state;
+        const interactor_type interactor{};
+
+        auto &covariance = bound_params.covariance();
+
+        // Scattering angle of the total material with the initial momentum
+        if (s.do_multiple_scattering && s.do_covariance_transport &&
+            s.path_in_X0 > 0.f) {
+            const scalar_type theta0{
+                interaction_type().compute_multiple_scattering_theta0(
+                    s.path_in_X0, s.pdg, s.mass, bound_params.qop(),
+                    bound_params.charge())};
+
+            interactor.update_angle_variance(covariance, bound_params.dir(),
+                                             theta0, nav_dir);
+        }
+
+        if (s.do_energy_loss) {
+            interactor.update_qop(bound_params.vector(), bound_params.p(),
+                                  bound_params.charge(), s.mass, s.e_loss,
+                                  nav_dir);
+
+            if (s.do_covariance_transport) {
+                interactor.update_qop_variance(
+                    covariance, math::sqrt(s.var_qop), nav_dir);
+            }
+        }
+
+        accumulator_state.applied = true;
+    }
+};
+
+}  // namespace detray
@@ -0,0 +1,264 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/track_parametrization.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/materials/interaction.hpp"
+#include "detray/propagator/actors/pointwise_material_interactor.hpp"
+#include "detray/propagator/base_actor.hpp"
+#include "detray/tracks/bound_track_parameters.hpp"
+#include "detray/utils/invalid_values.hpp"
+
+// System include(s)
+#include <cstddef>
+
+namespace detray {
+
+/// @brief Follows additional mass hypotheses along the reference track.
+///
+/// A PID-ambiguous track is propagated only once, with the particle
+/// hypothesis of the stepper (the reference). The navigation and the
+/// transport Jacobians of the reference are shared by up to @tparam N
+/// additional hypotheses, which only keep their own q/p and covariance: On
+/// every module surface, their covariance is transported with the Jacobian of
+/// the reference and on surfaces with material, their energy loss and
+/// scattering are computed for their own mass (see
+/// @c pointwise_material_interactor ).
+///
+/// Since the curvature of the shared trajectory belongs to the q/p of the
+/// reference, a hypothesis is only followed as long as its q/p stays within
+/// a relative deviation of the reference q/p. Otherwise it is marked as
+/// diverged and keeps its parameters on the surface where this was detected
+/// (before the material of the surface), so that it can be propagated on its
+/// own from there.
+///
+/// @note The actor has to be placed in the actor chain after the
+/// @c parameter_transporter and before the material interactor of the
+/// reference, so that it sees the transported reference parameters before
+/// the material effects of the reference are applied.
+template <typename algebra_t, std::size_t N = 4u>
+struct multi_hypothesis_interactor : actor {
+
+    using algebra_type = algebra_t;
+    using scalar_type = dscalar<algebra_t>;
+    using point2_type = dpoint2D<algebra_t>;
+    using matrix_operator = dmatrix_operator<algebra_t>;
+    using bound_param_type = bound_track_parameters<algebra_t>;
+    using bound_matrix_type = bound_matrix<algebra_t>;
+    using interactor_type = pointwise_material_interactor<algebra_t>;
+
+    /// A particle hypothesis and its track parameters
+    struct hypothesis {
+        /// Mass and pdg code of the hypothesis and the interaction results
+        typename interactor_type::state interactor{};
+        /// The track parameters on the last surface
+        bound_param_type params{};
+        /// Whether the parameters are bound to a surface yet
+        bool is_bound{false};
+        /// The hypothesis cannot follow the reference trajectory anymore
+        bool diverged{false};
+    };
+
+    struct state {
+
+        /// Largest relative deviation of the q/p of a hypothesis from the q/p
+        /// of the reference, up to which it can share its trajectory
+        scalar_type max_qop_deviation{0.01f};
+
+        /// Add a hypothesis with the pdg code @param pdg and the mass
+        /// @param mass . Its parameters are taken from the reference on the
+        /// first module surface.
+        ///
+        /// @returns false if the state is full
+        DETRAY_HOST_DEVICE
+        constexpr bool add(const int pdg, const scalar_type mass) {
+            if (m_n == N) {
+                return false;
+            }
+            hypothesis &h = m_hypotheses[m_n++];
+            h = hypothesis{};
+            h.interactor.pdg = pdg;
+            h.interactor.mass = mass;
+            return true;
+        }
+
+        /// Add a hypothesis with the pdg code @param pdg and the mass
+        /// @param mass , which starts from the bound parameters @param seed
+        ///
+        /// @returns false if the state is full
+        DETRAY_HOST_DEVICE
+        constexpr bool add(const int pdg, const scalar_type mass,
+                           const bound_param_type &seed) {
+            if (!add(pdg, mass)) {
+                return false;
+            }
+            hypothesis &h = m_hypotheses[m_n - 1u];
+            h.params = seed;
+            h.is_bound = true;
+            return true;
+        }
+
+        /// @returns the number of hypotheses
+        DETRAY_HOST_DEVICE
+        constexpr std::size_t size() const { return m_n; }
+
+        /// @returns the number of hypotheses that diverged from the reference
+        DETRAY_HOST_DEVICE
+        constexpr std::size_t n_diverged() const {
+            std::size_t n{0u};
+            for (std::size_t i = 0u; i < m_n; ++i) {
+                n += m_hypotheses[i].diverged ? 1u : 0u;
+            }
+            return n;
+        }
+
+        /// Access the hypothesis @param i
+        /// @{
+        DETRAY_HOST_DEVICE
+        constexpr hypothesis &operator[](const std::size_t i) {
+            return m_hypotheses[i];
+        }
+        DETRAY_HOST_DEVICE
+        constexpr const hypothesis &operator[](const std::size_t i) const {
+            return m_hypotheses[i];
+        }
+        /// @}
+
+        private:
+        darray<hypothesis, N> m_hypotheses{};
+        std::size_t m_n{0u};
+    };
+
+    template <typename propagator_state_t>
+    DETRAY_HOST_DEVICE inline void operator()(
+        state &hyp_state, propagator_state_t &prop_state) const {
+
+        const auto &navigation = prop_state._navigation;
+
+        if (hyp_state.size() == 0u ||
+            !(navigation.is_on_module() || navigation.is_on_portal())) {
+            return;
+        }
+
+        const auto &stepping = prop_state._stepping;
+        const bound_param_type &ref = stepping._bound_params;
+        const auto sf = navigation.get_surface();
+
+        // The parameter transporter moved the reference to this surface
+        const bool transported{navigation.is_on_module() &&
+                               ref.surface_link() == sf.barcode()};
+        const bool has_material{navigation.encountered_sf_material()};
+
+        if (!transported && !has_material) {
+            return;
+        }
+
+        const int nav_dir{static_cast<int>(navigation.direction())};
+        const auto &loc = navigation.current()->local;
+        const scalar_type cos_inc_angle{
+            navigation.cos_incidence_angle(ref.dir())};
+        const scalar_type ref_qop{ref.qop()};
+
+        for (std::size_t i = 0u; i < hyp_state.size(); ++i) {
+            hypothesis &h = hyp_state[i];
+            if (h.diverged) {
+                continue;
+            }
+
+            if (transported) {
+                transport(h, stepping);
+            }
+            if (!h.is_bound) {
+                continue;
+            }
+
+            // Safety re-check: Can the hypothesis still share the trajectory?
+            // (both before the material of this surface)
+            if (math::abs(h.params.qop() - ref_qop) >
+                hyp_state.max_qop_deviation * math::abs(ref_qop)) {
+                h.diverged = true;
+                continue;
+            }
+
+            if (has_material) {
+                h.interactor.reset();
+                interactor_type{}.update(h.params, h.interactor, nav_dir, sf,
+                                         cos_inc_angle,
+                                         point2_type{loc[0], loc[1]});
+
+                // The particle was stopped in the material
+                h.diverged = detail::is_invalid_value(h.params.qop());
+            }
+        }
+    }
+
+    private:
+    /// Move the hypothesis @param h to the surface of the reference track
+    /// with the transport Jacobian of the reference
+    template <typename stepping_t>
+    DETRAY_HOST_DEVICE inline void transport(hypothesis &h,
+                                             const stepping_t &stepping) const {
+
+        const bound_param_type &ref = stepping._bound_params;
+        const scalar_type qop{h.params.qop()};
+
+        if (stepping.do_covariance_transport()) {
+            if (h.is_bound) {
+                const bound_matrix_type &jac = stepping._full_jacobian;
+                bound_matrix_type cov = jac * h.params.covariance() *
+                                        matrix_operator().transpose(jac);
+
+                if (stepping._path_in_X0 > 0.f) {
+                    add_volume_scattering(cov, h, stepping._path_in_X0,
+                                          ref.dir()[2], qop);
+                }
+                h.params.set_covariance(cov);
+            } else {
+                // Same seed as the reference on the first surface
+                h.params.set_covariance(ref.covariance());
+            }
+        }
+
+        // Shared position and direction, but the own momentum
+        h.params.set_vector(ref.vector());
+        h.params.set_surface_link(ref.surface_link());
+        if (h.is_bound) {
+            h.params.set_qop(qop);
+        }
+        h.is_bound = true;
+    }
+
+    /// Add the scattering in the volume material along the step to the
+    /// covariance @param cov of the hypothesis @param h
+    DETRAY_HOST_DEVICE inline void add_volume_scattering(
+        bound_matrix_type &cov, const hypothesis &h,
+        const scalar_type path_in_X0, const scalar_type dir_z,
+        const scalar_type qop) const {
+
+        const scalar_type charge{h.params.charge()};
+        const scalar_type theta0{
+            interaction<scalar_type>().compute_multiple_scattering_theta0(
+                path_in_X0, h.interactor.pdg, h.interactor.mass, qop,
+                charge)};
+        const scalar_type var_theta0{theta0 * theta0};
+        const scalar_type sin2_theta{1.f - dir_z * dir_z};
+
+        constexpr auto inv{detail::invalid_value<scalar_type>()};
+        matrix_operator().element(cov, e_bound_phi, e_bound_phi) +=
+            (sin2_theta == 0.f) ? inv : var_theta0 / sin2_theta;
+        matrix_operator().element(cov, e_bound_theta, e_bound_theta) +=
+            var_theta0;
+    }
+};
+
+}  // namespace detray
@@ -16,11 +16,21 @@
 
 namespace detray {
 
-template <typename algebra_t>
+/// Resets the free track parameters and the jacobians on the module surfaces
+/// that are reached
+///
+/// @tparam algebra_t the algebra type
+/// @tparam do_covariance set to false for trajectory-only propagation, so
+///         that the jacobian code is not instantiated
+///         (@see parameter_transporter )
+template <typename algebra_t, bool do_covariance = true>
 struct parameter_resetter : actor {
 
     using scalar_type = dscalar<algebra_t>;
 
+    /// Only acts on module surfaces
+    struct is_surface_actor : public std::true_type {};
+
     struct state {};
 
     /// Mask store visitor
@@ -30,6 +40,9 @@ struct parameter_resetter : actor {
         using transform3_type = dtransform3D<algebra_t>;
         using matrix_operator = dmatrix_operator<algebra_t>;
 
+        /// Only the global position needs the mask (e.g. the cylinder
+        /// radius), the rest is dispatched to the local frame of the mask, so
+        /// that it is instantiated once per frame and not once per mask type
         template <typename mask_group_t, typename index_t,
                   typename stepper_state_t>
         DETRAY_HOST_DEVICE inline void operator()(
@@ -40,21 +53,46 @@ struct parameter_resetter : actor {
             const auto& mask = mask_group[index];
 
             using frame_t = decltype(mask.local_frame());
-            using jacobian_engine = detail::jacobian_engine<frame_t>;
+
+            reset<frame_t>(trf3,
+                           detail::bound_to_free_vector(
+                               trf3, mask, stepping._bound_params.vector()),
+                           stepping);
+        }
+
+        /// Reset the stepper state to the free vector @param free_vec on the
+        /// surface with the placement @param trf3 and the local frame
+        /// @tparam frame_t
+        template <typename frame_t, typename stepper_state_t>
+        DETRAY_HOST_DEVICE static inline void reset(
+            const transform3_type& trf3,
+            const free_vector<algebra_t>& free_vec,
+            stepper_state_t& stepping) {
 
             // Reset the free vector
-            stepping().set_vector(detail::bound_to_free_vector(
-                trf3, mask, stepping._bound_params.vector()));
+            stepping().set_vector(free_vec);
 
             // Reset the path length
             stepping._s = 0;
+            stepping._path_in_X0 = 0.f;
+            stepping._path_in_material = 0.f;
 
-            // Reset jacobian coordinate transformation at the current surface
-            stepping._jac_to_global = jacobian_engine::bound_to_free_jacobian(
-                trf3, mask, stepping._bound_params.vector());
+            if constexpr (do_covariance) {
+                using jacobian_engine = detail::jacobian_engine<frame_t>;
 
-            // Reset jacobian transport to identity matrix
-            matrix_operator().set_identity(stepping._jac_transport);
+                if (not stepping.do_covariance_transport()) {
+                    return;
+                }
+
+                // Reset jacobian coordinate transformation at the current
+                // surface
+                stepping._jac_to_global =
+                    jacobian_engine::bound_to_free_jacobian(
+                        trf3, stepping._bound_params.vector(), free_vec);
+
+                // Reset jacobian transport to identity matrix
+                matrix_operator().set_identity(stepping._jac_transport);
+            }
         }
     };
 
@@ -77,8 +115,31 @@ struct parameter_resetter : actor {
         // Surface
         const auto sf = navigation.get_surface();
 
+        // No bound parameters on this surface: nothing to reset
+        if (not stepping.do_bound_conversion(sf)) {
+            return;
+        }
+
         sf.template visit_mask<kernel>(sf.transform(ctx), stepping);
     }
+
+    /// Reset the track parameters on the current module surface, the mask of
+    /// which was already resolved by the actor chain
+    template <typename surface_t, typename mask_group_t, typename index_t,
+              typename propagator_state_t>
+    DETRAY_HOST_DEVICE void operator()(
+        state& /*resetter_state*/, const surface_t& sf,
+        const mask_group_t& mask_group, const index_t& index,
+        const dtransform3D<algebra_t>& trf3,
+        propagator_state_t& propagation) const {
+
+        // No bound parameters on this surface: nothing to reset
+        if (not propagation._stepping.do_bound_conversion(sf)) {
+            return;
+        }
+
+        kernel{}(mask_group, index, trf3, propagation._stepping);
+    }
 };
 
 }  // namespace detray
@@ -11,14 +11,29 @@
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/definitions/track_parametrization.hpp"
 #include "detray/geometry/surface.hpp"
+#include "detray/materials/interaction.hpp"
 #include "detray/propagator/base_actor.hpp"
 #include "detray/propagator/detail/jacobian_engine.hpp"
+#include "detray/utils/invalid_values.hpp"
 
 namespace detray {
 
-template <typename algebra_t>
+/// Transports the track parameters and their covariance to the module
+/// surfaces that are reached
+///
+/// @tparam algebra_t the algebra type
+/// @tparam do_covariance set to false for trajectory-only propagation (e.g.
+///         material mapping or detector scans): Then only the free track
+///         parameters are converted to bound parameters, and the jacobian
+///         code is not instantiated at all. Otherwise, the covariance
+///         transport can still be switched off per track at runtime
+///         (@see base_stepper::state::set_covariance_transport )
+template <typename algebra_t, bool do_covariance = true>
 struct parameter_transporter : actor {
 
+    /// Only acts on module surfaces
+    struct is_surface_actor : public std::true_type {};
+
     struct state {};
 
     /// Mask store visitor
@@ -33,12 +48,12 @@ struct parameter_transporter : actor {
         using scalar_type = dscalar<algebra_t>;
         // Matrix actor
         using matrix_operator = dmatrix_operator<algebra_t>;
-        // 2D matrix type
-        template <std::size_t ROWS, std::size_t COLS>
-        using matrix_type = dmatrix<algebra_t, ROWS, COLS>;
 
         /// @}
 
+        /// Dispatch to the local frame of the mask group: The transport only
+        /// depends on the frame, so that it is instantiated once per frame
+        /// and not once per mask type that shares the frame
         template <typename mask_group_t, typename index_t,
                   typename propagator_state_t>
         DETRAY_HOST_DEVICE inline void operator()(
@@ -48,6 +63,45 @@ struct parameter_transporter : actor {
             using frame_t = typename mask_group_t::value_type::shape::
                 template local_frame_type<algebra_t>;
 
+            transport<frame_t>(trf3, propagation);
+        }
+
+        /// Transport the track parameters and covariance to the surface
+        /// with the placement @param trf3 and the local frame @tparam frame_t
+        template <typename frame_t, typename propagator_state_t>
+        DETRAY_HOST_DEVICE static inline void transport(
+            const transform3_type& trf3, propagator_state_t& propagation) {
+
+            // Stepper and Navigator states
+            auto& stepping = propagation._stepping;
+
+            // Free vector
+            const auto& free_vec = stepping().vector();
+
+            // Convert free to bound vector
+            stepping._bound_params.set_vector(
+                detail::free_to_bound_vector<frame_t>(trf3, free_vec));
+
+            // Transport the covariance, unless only the track parameters
+            // are needed for this track
+            if constexpr (do_covariance) {
+                if (stepping.do_covariance_transport()) {
+                    transport_covariance<frame_t>(trf3, propagation);
+                    return;
+                }
+            }
+            if (propagation.param_type() == parameter_type::e_free) {
+                propagation.set_param_type(parameter_type::e_bound);
+            }
+        }
+
+        /// Transport the covariance to the surface with the placement
+        /// @param trf3 and the local frame @tparam frame_t . The bound track
+        /// vector must already be set.
+        template <typename frame_t, typename propagator_state_t>
+        DETRAY_HOST_DEVICE static inline void transport_covariance(
+            const transform3_type& trf3, propagator_state_t& propagation) {
+
             using jacobian_engine_t = detail::jacobian_engine<frame_t>;
 
             using bound_matrix_t = bound_matrix<algebra_t>;
@@ -58,44 +112,33 @@ struct parameter_transporter : actor {
             using free_to_bound_matrix_t =
                 typename jacobian_engine_t::free_to_bound_matrix_type;
 
-            // Stepper and Navigator states
             auto& stepping = propagation._stepping;
-
-            // Free vector
             const auto& free_vec = stepping().vector();
 
-            // Convert free to bound vector
-            stepping._bound_params.set_vector(
-                detail::free_to_bound_vector<frame_t>(trf3, free_vec));
-
-            // Free to bound jacobian at the destination surface
+            // Free to bound jacobian at the destination surface, corrected
+            // for the variation of the path length
             const free_to_bound_matrix_t free_to_bound_jacobian =
-                jacobian_engine_t::free_to_bound_jacobian(trf3, free_vec);
+                jacobian_engine_t::corrected_free_to_bound_jacobian(
+                    trf3, free_vec, stepping.dtds(), stepping.dqopds());
 
             // Transport jacobian in free coordinate
-            free_matrix_t& free_transport_jacobian = stepping._jac_transport;
+            const free_matrix_t& free_transport_jacobian =
+                stepping._jac_transport;
 
-            // Path correction factor
-            free_matrix_t path_correction = jacobian_engine_t::path_correction(
-                stepping().pos(), stepping().dir(), stepping.dtds(),
-                stepping.dqopds(), trf3);
-
-            const free_matrix_t correction_term =
-                matrix_operator()
-                    .template identity<e_free_size, e_free_size>() +
-                path_correction;
+            // The products skip the structural zeros of the jacobians
+            const free_to_bound_matrix_t transport_to_bound =
+                jacobian_engine_t::free_to_bound_transport(
+                    free_to_bound_jacobian, free_transport_jacobian);
 
             bound_matrix_t new_cov =
                 matrix_operator().template zero<e_bound_size, e_bound_size>();
 
             if (propagation.param_type() == parameter_type::e_free) {
 
-                const matrix_type<e_bound_size, e_free_size> full_jacobian =
-                    free_to_bound_jacobian * correction_term *
-                    free_transport_jacobian;
-
-                new_cov = full_jacobian * stepping().covariance() *
-                          matrix_operator().transpose(full_jacobian);
+                new_cov =
+                    jacobian_engine_t::template transport_covariance<
+                        e_free_size>(transport_to_bound,
+                                     stepping().covariance());
 
                 propagation.set_param_type(parameter_type::e_bound);
 
@@ -104,18 +147,87 @@ struct parameter_transporter : actor {
                 const bound_to_free_matrix_t& bound_to_free_jacobian =
                     stepping._jac_to_global;
 
-                stepping._full_jacobian =
-                    free_to_bound_jacobian * correction_term *
-                    free_transport_jacobian * bound_to_free_jacobian;
+                stepping._full_jacobian = jacobian_engine_t::full_jacobian(
+                    transport_to_bound, bound_to_free_jacobian);
+
+                new_cov = jacobian_engine_t::template transport_covariance<
+                    e_bound_size>(stepping._full_jacobian,
+                                  stepping._bound_params.covariance());
+            }
 
-                new_cov = stepping._full_jacobian *
-                          stepping._bound_params.covariance() *
-                          matrix_operator().transpose(stepping._full_jacobian);
+            // Multiple scattering in the volume material along the way
+            if (stepping._path_in_X0 > 0.f) {
+                add_volume_scattering(new_cov, free_to_bound_jacobian,
+                                      stepping);
             }
 
             // Calculate surface-to-surface covariance transport
             stepping._bound_params.set_covariance(new_cov);
         }
+
+        /// Add the multiple scattering in the volume material that was
+        /// accumulated by the stepper to @param cov
+        ///
+        /// The material along the path is treated as a single thick
+        /// scatterer of length L: In both directions transverse to the track,
+        /// the angle has the variance theta0^2, the position the variance
+        /// L^2 theta0^2 / 3 and their covariance is L theta0^2 / 2. The free
+        /// noise is projected onto the surface with the path corrected free
+        /// to bound jacobian @param free_to_bound_jacobian
+        template <typename free_to_bound_matrix_t, typename stepper_state_t>
+        DETRAY_HOST_DEVICE static inline void add_volume_scattering(
+            bound_matrix<algebra_t>& cov,
+            const free_to_bound_matrix_t& free_to_bound_jacobian,
+            const stepper_state_t& stepping) {
+
+            const auto& track = stepping();
+
+            const scalar_type theta0{
+                interaction<scalar_type>().compute_multiple_scattering_theta0(
+                    stepping._path_in_X0, stepping._pdg, stepping._mass,
+                    track.qop(), track.charge())};
+            const scalar_type var_theta0{theta0 * theta0};
+            const scalar_type L{stepping._path_in_material};
+
+            const scalar_type var_dir{var_theta0};
+            const scalar_type var_pos{L * L * var_theta0 / 3.f};
+            const scalar_type cov_pos_dir{0.5f * L * var_theta0};
+
+            const auto dir = track.dir();
+
+            // Position and direction rows of the jacobian, projected
+            // transverse to the track: x^T (1 - t t^T) y
+            const auto& jac = free_to_bound_jacobian;
+            const auto transverse = [&jac, &dir](unsigned int i,
+                                                 unsigned int off_i,
+                                                 unsigned int j,
+                                                 unsigned int off_j) {
+                scalar_type xy{0.f};
+                scalar_type xt{0.f};
+                scalar_type yt{0.f};
+                for (unsigned int k = 0u; k < 3u; ++k) {
+                    const scalar_type x{
+                        matrix_operator().element(jac, i, off_i + k)};
+                    const scalar_type y{
+                        matrix_operator().element(jac, j, off_j + k)};
+                    xy += x * y;
+                    xt += x * dir[k];
+                    yt += y * dir[k];
+                }
+                return xy - xt * yt;
+            };
+
+            for (unsigned int i = 0u; i < e_bound_size; ++i) {
+                for (unsigned int j = 0u; j < e_bound_size; ++j) {
+                    matrix_operator().element(cov, i, j) +=
+                        var_pos * transverse(i, e_free_pos0, j, e_free_pos0) +
+                        cov_pos_dir *
+                            (transverse(i, e_free_pos0, j, e_free_dir0) +
+                             transverse(i, e_free_dir0, j, e_free_pos0)) +
+                        var_dir * transverse(i, e_free_dir0, j, e_free_dir0);
+                }
+            }
+        }
     };
 
     template <typename propagator_state_t>
@@ -135,11 +247,37 @@ struct parameter_transporter : actor {
         // Surface
         const auto sf = navigation.get_surface();
 
+        // Keep accumulating the free transport jacobian
+        if (not propagation._stepping.do_bound_conversion(sf)) {
+            return;
+        }
+
         sf.template visit_mask<kernel>(sf.transform(ctx), propagation);
 
         // Set surface link
         propagation._stepping._bound_params.set_surface_link(sf.barcode());
     }
+
+    /// Transport to the current module surface @param sf, the mask of which
+    /// was already resolved by the actor chain
+    template <typename surface_t, typename mask_group_t, typename index_t,
+              typename propagator_state_t>
+    DETRAY_HOST_DEVICE void operator()(
+        state& /*actor_state*/, const surface_t& sf,
+        const mask_group_t& mask_group, const index_t& index,
+        const dtransform3D<algebra_t>& trf3,
+        propagator_state_t& propagation) const {
+
+        // Keep accumulating the free transport jacobian
+        if (not propagation._stepping.do_bound_conversion(sf)) {
+            return;
+        }
+
+        kernel{}(mask_group, index, trf3, propagation);
+
+        // Set surface link
+        propagation._stepping._bound_params.set_surface_link(sf.barcode());
+    }
 };  // namespace detray
 
 }  // namespace detray
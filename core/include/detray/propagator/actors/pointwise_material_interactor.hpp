@@ -8,16 +8,22 @@
 #pragma once
 
 // Project include(s).
+#include "detray/core/detail/container_views.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/definitions/track_parametrization.hpp"
 #include "detray/geometry/surface.hpp"
 #include "detray/materials/detail/material_accessor.hpp"
 #include "detray/materials/interaction.hpp"
+#include "detray/materials/interaction_table.hpp"
+#include "detray/materials/material_cache.hpp"
 #include "detray/propagator/base_actor.hpp"
 #include "detray/tracks/bound_track_parameters.hpp"
 #include "detray/utils/ranges.hpp"
 #include "detray/utils/type_traits.hpp"
 
+// Vecmem include(s)
+#include <vecmem/containers/device_vector.hpp>
+
 namespace detray {
 
 template <typename algebra_t>
@@ -25,12 +31,15 @@ struct pointwise_material_interactor : actor {
 
     using algebra_type = algebra_t;
     using scalar_type = dscalar<algebra_t>;
+    using point2_type = dpoint2D<algebra_t>;
     using vector3_type = dvector3D<algebra_t>;
     using transform3_type = dtransform3D<algebra_t>;
     using matrix_operator = dmatrix_operator<algebra_t>;
     using interaction_type = interaction<scalar_type>;
+    using stopping_power_table_type = stopping_power_table<scalar_type>;
     using bound_vector_type = bound_vector<algebra_t>;
     using bound_matrix_type = bound_matrix<algebra_t>;
+    using material_cache_type = material_cache<scalar_type>;
 
     struct state {
 
@@ -50,6 +59,14 @@ struct pointwise_material_interactor : actor {
         bool do_energy_loss = true;
         bool do_multiple_scattering = true;
 
+        /// Optional stopping power tables for the particle mass. The energy
+        /// loss in materials without a table is computed analytically
+        dvector_view<const stopping_power_table_type> stopping_power_tables{};
+
+        /// Optional cache of the material map lookups, which can be kept
+        /// between repeated propagations of the same track (e.g. refits)
+        material_cache_type *mat_cache{nullptr};
+
         DETRAY_HOST_DEVICE
         void reset() {
             e_loss = 0.f;
@@ -71,7 +88,9 @@ struct pointwise_material_interactor : actor {
             [[maybe_unused]] const bound_track_parameters<algebra_t>
                 &bound_params,
             [[maybe_unused]] const scalar_type cos_inc_angle,
-            [[maybe_unused]] const scalar_type approach) const {
+            [[maybe_unused]] const scalar_type approach,
+            [[maybe_unused]] const point2_type &loc,
+            [[maybe_unused]] const geometry::barcode sf_barcode) const {
 
             using material_t = typename mat_group_t::value_type;
 
@@ -81,8 +100,12 @@ struct pointwise_material_interactor : actor {
                                            material<scalar_type>>) ||
                           detail::is_material_map_v<material_t>) {
 
-                const auto mat = detail::material_accessor::get(
-                    material_group, mat_index, bound_params.bound_local());
+                const auto mat =
+                    s.mat_cache
+                        ? s.mat_cache->get(sf_barcode, material_group,
+                                           mat_index, loc)
+                        : detail::material_accessor::get(material_group,
+                                                         mat_index, loc);
 
                 // return early in case of zero thickness
                 if (mat.thickness() <=
@@ -98,10 +121,8 @@ struct pointwise_material_interactor : actor {
 
                 // Energy Loss
                 if (s.do_energy_loss) {
-                    s.e_loss =
-                        interaction_type().compute_energy_loss_bethe_bloch(
-                            path_segment, mat.get_material(), s.pdg, s.mass,
-                            qop, charge);
+                    s.e_loss = energy_loss(s, mat.get_material(),
+                                           path_segment, qop, charge);
                 }
 
                 // @todo: include the radiative loss (Bremsstrahlung)
@@ -129,6 +150,42 @@ struct pointwise_material_interactor : actor {
                 return false;
             }
         }
+
+        /// @returns the Bethe-Bloch energy loss in @param mat along
+        /// @param path_segment , interpolated from the stopping power table
+        /// of the material if the state @param s provides one
+        DETRAY_HOST_DEVICE inline scalar_type energy_loss(
+            const state &s, const material<scalar_type> &mat,
+            const scalar_type path_segment, const scalar_type qop,
+            const scalar_type charge) const {
+
+            if (s.stopping_power_tables.size() > 0u && charge != 0.f) {
+                const vecmem::device_vector<const stopping_power_table_type>
+                    tables(s.stopping_power_tables);
+
+                for (const auto &table : tables) {
+                    if (!table.matches(mat, s.mass)) {
+                        continue;
+                    }
+                    // beta*gamma = p/m
+                    const scalar_type m_qop{s.mass * math::abs(qop)};
+                    const scalar_type log_bg{-math::log(m_qop)};
+                    if (!table.in_range(log_bg)) {
+                        break;
+                    }
+                    // The table is sampled for a unit charge: q²/beta²
+                    // relative to 1/beta²
+                    const scalar_type m_qop2{m_qop * m_qop};
+                    const scalar_type q2_scale{(charge * charge + m_qop2) /
+                                               (1.f + m_qop2)};
+
+                    return path_segment * q2_scale * table(log_bg);
+                }
+            }
+
+            return interaction_type().compute_energy_loss_bethe_bloch(
+                path_segment, mat, s.pdg, s.mass, qop, charge);
+        }
     };
 
     template <typename propagator_state_t>
@@ -144,10 +201,15 @@ struct pointwise_material_interactor : actor {
 
             auto &stepping = prop_state._stepping;
 
+            // The local position of the intersection is already known
+            const auto &loc = navigation.current()->local;
+
             this->update(stepping._bound_params, interactor_state,
                          static_cast<int>(navigation.direction()),
                          navigation.get_surface(),
-                         navigation.current()->cos_incidence_angle);
+                         navigation.cos_incidence_angle(
+                             stepping._bound_params.dir()),
+                         point2_type{loc[0], loc[1]});
         }
     }
 
@@ -157,19 +219,39 @@ struct pointwise_material_interactor : actor {
     /// @param[out] interactor_state actor state
     /// @param[in]  nav_dir navigation direction
     /// @param[in]  sf the surface
+    /// @param[in]  cos_inc_angle cosine of the incidence angle
     template <typename surface_t>
     DETRAY_HOST_DEVICE inline void update(
         bound_track_parameters<algebra_t> &bound_params,
         state &interactor_state, const int nav_dir, const surface_t &sf,
         const scalar_type cos_inc_angle) const {
 
+        update(bound_params, interactor_state, nav_dir, sf, cos_inc_angle,
+               bound_params.bound_local());
+    }
+
+    /// @brief Update the bound track parameter
+    ///
+    /// @param[out] bound_params bound track parameter
+    /// @param[out] interactor_state actor state
+    /// @param[in]  nav_dir navigation direction
+    /// @param[in]  sf the surface
+    /// @param[in]  cos_inc_angle cosine of the incidence angle
+    /// @param[in]  loc local position on the surface (e.g. from the
+    ///             intersection), used for the material lookup
+    template <typename surface_t>
+    DETRAY_HOST_DEVICE inline void update(
+        bound_track_parameters<algebra_t> &bound_params,
+        state &interactor_state, const int nav_dir, const surface_t &sf,
+        const scalar_type cos_inc_angle, const point2_type &loc) const {
+
         // Closest approach of the track to a line surface. Otherwise this is
         // ignored.
-        const auto approach{
-            matrix_operator().element(bound_params.vector(), e_bound_loc0, 0)};
+        const scalar_type approach{loc[0]};
 
         const bool succeed = sf.template visit_material<kernel>(
-            interactor_state, bound_params, cos_inc_angle, approach);
+            interactor_state, bound_params, cos_inc_angle, approach, loc,
+            sf.barcode());
 
         if (succeed) {
 
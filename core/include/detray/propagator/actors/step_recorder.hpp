@@ -0,0 +1,656 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/core/detail/container_buffers.hpp"
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/track_parametrization.hpp"
+#include "detray/geometry/barcode.hpp"
+#include "detray/propagator/base_actor.hpp"
+#include "detray/utils/invalid_values.hpp"
+#include "detray/utils/tuple_helpers.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace detray {
+
+/// Which steps are written by the @c step_recorder
+enum class step_record_mode : std::uint_least8_t {
+    e_steps = 0u,       //< every step of the stepper (full trace)
+    e_surfaces = 1u,    //< only the steps that end on a surface
+    e_sensitives = 2u,  //< only the steps that end on a sensitive surface
+};
+
+/// @brief Flat storage for the recorded steps of a batch of tracks.
+///
+/// Every quantity is stored in its own vector (SoA), in which every track owns
+/// a slice of fixed capacity. The number of records of a track is kept in a
+/// separate counter, together with the number of steps that did not fit into
+/// the slice anymore. Recording a step is therefore a plain store, without
+/// allocation or atomic operations, both on host and device (one track per
+/// thread). The Jacobians are optional, since they dominate the memory.
+///
+/// @tparam algebra_t the algebra type of the recorded data
+/// @tparam container_t the types of underlying containers to be used.
+template <typename algebra_t, typename container_t = host_container_types>
+class step_record_collection {
+
+    public:
+    template <typename T>
+    using vector_type = typename container_t::template vector_type<T>;
+    using algebra_type = algebra_t;
+    using container_type = container_t;
+    using size_type = dindex;
+    using scalar_type = dscalar<algebra_t>;
+    using point3_type = dpoint3D<algebra_t>;
+    using vector3_type = dvector3D<algebra_t>;
+    using free_matrix_type = free_matrix<algebra_t>;
+
+    /// Vecmem based view type
+    using view_type =
+        dmulti_view<dvector_view<unsigned int>, dvector_view<unsigned int>,
+                    dvector_view<scalar_type>, dvector_view<point3_type>,
+                    dvector_view<vector3_type>, dvector_view<scalar_type>,
+                    dvector_view<geometry::barcode>,
+                    dvector_view<free_matrix_type>>;
+    using const_view_type = dmulti_view<
+        dvector_view<const unsigned int>, dvector_view<const unsigned int>,
+        dvector_view<const scalar_type>, dvector_view<const point3_type>,
+        dvector_view<const vector3_type>, dvector_view<const scalar_type>,
+        dvector_view<const geometry::barcode>,
+        dvector_view<const free_matrix_type>>;
+
+    /// Vecmem based buffer type
+    using buffer_type = dmulti_buffer<
+        dvector_buffer<unsigned int>, dvector_buffer<unsigned int>,
+        dvector_buffer<scalar_type>, dvector_buffer<point3_type>,
+        dvector_buffer<vector3_type>, dvector_buffer<scalar_type>,
+        dvector_buffer<geometry::barcode>, dvector_buffer<free_matrix_type>>;
+
+    /// Default constructor
+    constexpr step_record_collection() = default;
+
+    /// Allocate the storage for @param n_tracks tracks with @param capacity
+    /// records each from the memory resource @param resource
+    ///
+    /// @param with_jacobians whether to store the transport Jacobians
+    DETRAY_HOST
+    step_record_collection(vecmem::memory_resource &resource,
+                           const size_type n_tracks, const size_type capacity,
+                           const bool with_jacobians = false)
+        : m_n_records(n_tracks, 0u, &resource),
+          m_n_overflow(n_tracks, 0u, &resource),
+          m_path_lengths(n_tracks * capacity, &resource),
+          m_positions(n_tracks * capacity, &resource),
+          m_directions(n_tracks * capacity, &resource),
+          m_qops(n_tracks * capacity, &resource),
+          m_barcodes(n_tracks * capacity, &resource),
+          m_jac_transports(with_jacobians ? n_tracks * capacity : 0u,
+                           &resource) {}
+
+    /// Device-side construction from a vecmem based view type
+    template <typename coll_view_t,
+              typename std::enable_if_t<detail::is_device_view_v<coll_view_t>,
+                                        bool> = true>
+    DETRAY_HOST_DEVICE explicit step_record_collection(coll_view_t &view)
+        : m_n_records(detail::get<0>(view.m_view)),
+          m_n_overflow(detail::get<1>(view.m_view)),
+          m_path_lengths(detail::get<2>(view.m_view)),
+          m_positions(detail::get<3>(view.m_view)),
+          m_directions(detail::get<4>(view.m_view)),
+          m_qops(detail::get<5>(view.m_view)),
+          m_barcodes(detail::get<6>(view.m_view)),
+          m_jac_transports(detail::get<7>(view.m_view)) {}
+
+    /// @returns the number of tracks
+    DETRAY_HOST_DEVICE
+    constexpr size_type size() const {
+        return static_cast<size_type>(m_n_records.size());
+    }
+
+    /// @returns the number of records a track can hold
+    DETRAY_HOST_DEVICE
+    constexpr size_type capacity() const {
+        return size() == 0u
+                   ? 0u
+                   : static_cast<size_type>(m_path_lengths.size()) / size();
+    }
+
+    /// @returns whether the transport Jacobians are recorded
+    DETRAY_HOST_DEVICE
+    constexpr bool has_jacobians() const { return !m_jac_transports.empty(); }
+
+    /// @returns the number of records of track @param trk
+    DETRAY_HOST_DEVICE
+    constexpr unsigned int n_records(const size_type trk) const {
+        return m_n_records[trk];
+    }
+
+    /// @returns the number of steps of track @param trk that were dropped,
+    /// because its slice was full
+    DETRAY_HOST_DEVICE
+    constexpr unsigned int n_overflow(const size_type trk) const {
+        return m_n_overflow[trk];
+    }
+
+    /// Access the record @param i of track @param trk
+    /// @{
+    DETRAY_HOST_DEVICE
+    constexpr scalar_type path_length(const size_type trk,
+                                      const size_type i) const {
+        return m_path_lengths[index(trk, i)];
+    }
+    DETRAY_HOST_DEVICE
+    constexpr const point3_type &pos(const size_type trk,
+                                     const size_type i) const {
+        return m_positions[index(trk, i)];
+    }
+    DETRAY_HOST_DEVICE
+    constexpr const vector3_type &dir(const size_type trk,
+                                      const size_type i) const {
+        return m_directions[index(trk, i)];
+    }
+    DETRAY_HOST_DEVICE
+    constexpr scalar_type qop(const size_type trk, const size_type i) const {
+        return m_qops[index(trk, i)];
+    }
+    DETRAY_HOST_DEVICE
+    constexpr geometry::barcode barcode(const size_type trk,
+                                        const size_type i) const {
+        return m_barcodes[index(trk, i)];
+    }
+    DETRAY_HOST_DEVICE
+    constexpr const free_matrix_type &jac_transport(const size_type trk,
+                                                    const size_type i) const {
+        assert(has_jacobians());
+        return m_jac_transports[index(trk, i)];
+    }
+    /// @}
+
+    /// Add a record to the slice of track @param trk
+    ///
+    /// @param path_length the path length of the track
+    /// @param pos the global position
+    /// @param dir the global direction
+    /// @param qop charge over momentum
+    /// @param bcd the surface the track is on (invalid in between surfaces)
+    /// @param jac the transport Jacobian (only stored if requested)
+    ///
+    /// @returns false if the slice of the track was full
+    DETRAY_HOST_DEVICE
+    constexpr bool record(const size_type trk, const scalar_type path_length,
+                          const point3_type &pos, const vector3_type &dir,
+                          const scalar_type qop, const geometry::barcode bcd,
+                          const free_matrix_type &jac) {
+        const unsigned int n{m_n_records[trk]};
+        if (n >= capacity()) {
+            ++m_n_overflow[trk];
+            return false;
+        }
+
+        const size_type idx{index(trk, n)};
+        m_path_lengths[idx] = path_length;
+        m_positions[idx] = pos;
+        m_directions[idx] = dir;
+        m_qops[idx] = qop;
+        m_barcodes[idx] = bcd;
+        if (has_jacobians()) {
+            m_jac_transports[idx] = jac;
+        }
+        m_n_records[trk] = n + 1u;
+
+        return true;
+    }
+
+    /// Clear the records of track @param trk
+    DETRAY_HOST_DEVICE
+    constexpr void clear(const size_type trk) {
+        m_n_records[trk] = 0u;
+        m_n_overflow[trk] = 0u;
+    }
+
+    /// @return the view on the records - non-const
+    DETRAY_HOST
+    constexpr auto get_data() noexcept -> view_type {
+        return view_type{
+            detray::get_data(m_n_records),  detray::get_data(m_n_overflow),
+            detray::get_data(m_path_lengths), detray::get_data(m_positions),
+            detray::get_data(m_directions), detray::get_data(m_qops),
+            detray::get_data(m_barcodes),   detray::get_data(m_jac_transports)};
+    }
+
+    /// @return the view on the records - const
+    DETRAY_HOST
+    constexpr auto get_data() const noexcept -> const_view_type {
+        return const_view_type{
+            detray::get_data(m_n_records),  detray::get_data(m_n_overflow),
+            detray::get_data(m_path_lengths), detray::get_data(m_positions),
+            detray::get_data(m_directions), detray::get_data(m_qops),
+            detray::get_data(m_barcodes),   detray::get_data(m_jac_transports)};
+    }
+
+    private:
+    /// @returns the global index of record @param i of track @param trk
+    DETRAY_HOST_DEVICE
+    constexpr size_type index(const size_type trk, const size_type i) const {
+        assert(trk < size());
+        assert(i < capacity());
+        return trk * capacity() + i;
+    }
+
+    /// Records per track
+    vector_type<unsigned int> m_n_records{};
+    /// Dropped records per track
+    vector_type<unsigned int> m_n_overflow{};
+    /// Recorded quantities
+    /// @{
+    vector_type<scalar_type> m_path_lengths{};
+    vector_type<point3_type> m_positions{};
+    vector_type<vector3_type> m_directions{};
+    vector_type<scalar_type> m_qops{};
+    vector_type<geometry::barcode> m_barcodes{};
+    vector_type<free_matrix_type> m_jac_transports{};
+    /// @}
+};
+
+/// @brief Records the track state along the trajectory.
+///
+/// Writes the path length, position, direction, q/p and (optionally) the
+/// transport Jacobian of the track into its slice of a
+/// @c step_record_collection , either after every step or only on surfaces.
+/// Steps that do not fit into the slice are counted, but dropped.
+///
+/// @note Every track needs its own recorder state, pointing to its own slice.
+template <typename algebra_t, typename container_t = host_container_types>
+struct step_recorder : actor {
+
+    using collection_type = step_record_collection<algebra_t, container_t>;
+    using size_type = typename collection_type::size_type;
+
+    struct state {
+
+        /// Record into the slice of track @param trk in @param records
+        DETRAY_HOST_DEVICE
+        state(collection_type &records, const size_type trk,
+              const step_record_mode mode = step_record_mode::e_steps)
+            : m_records{&records}, m_trk{trk}, m_mode{mode} {
+            m_records->clear(m_trk);
+        }
+
+        /// Record nothing, until the state is bound to a track (e.g. by
+        /// @c propagator::propagate_batch_recorded )
+        DETRAY_HOST_DEVICE
+        explicit state(const step_record_mode mode) : m_mode{mode} {}
+
+        /// Record into the slice of track @param trk in @param records
+        DETRAY_HOST_DEVICE
+        void bind(collection_type &records, const size_type trk) {
+            m_records = &records;
+            m_trk = trk;
+            m_records->clear(m_trk);
+        }
+
+        /// @returns the number of records of the track
+        DETRAY_HOST_DEVICE
+        unsigned int n_records() const { return m_records->n_records(m_trk); }
+
+        /// @returns the number of steps that were dropped
+        DETRAY_HOST_DEVICE
+        unsigned int n_overflow() const {
+            return m_records->n_overflow(m_trk);
+        }
+
+        collection_type *m_records{nullptr};
+        size_type m_trk{detail::invalid_value<size_type>()};
+        step_record_mode m_mode{step_record_mode::e_steps};
+    };
+
+    template <typename propagator_state_t>
+    DETRAY_HOST_DEVICE void operator()(
+        state &recorder_state, const propagator_state_t &prop_state) const {
+
+        const auto &stepping = prop_state._stepping;
+        const auto &navigation = prop_state._navigation;
+
+        // Nothing happened yet (first call of actor chain) or not bound
+        if (stepping.path_length() == 0.f ||
+            recorder_state.m_records == nullptr) {
+            return;
+        }
+
+        const bool on_surface{navigation.is_on_module() ||
+                              navigation.is_on_portal()};
+        if ((recorder_state.m_mode == step_record_mode::e_surfaces &&
+             !on_surface) ||
+            (recorder_state.m_mode == step_record_mode::e_sensitives &&
+             !navigation.is_on_sensitive())) {
+            return;
+        }
+
+        const auto &track = stepping();
+        recorder_state.m_records->record(
+            recorder_state.m_trk, stepping.path_length(), track.pos(),
+            track.dir(), track.qop(),
+            on_surface ? navigation.barcode() : geometry::barcode{},
+            stepping._jac_transport);
+    }
+};
+
+/// @brief Dense storage of the recorded steps of a batch of tracks.
+///
+/// The records of all tracks are stored back to back (SoA), without the
+/// unused capacity of the track slices of a @c step_record_collection . The
+/// records of track @c trk are found in [offsets[trk], offsets[trk + 1]).
+/// Only this compact form has to be copied from the device to the host.
+///
+/// The offsets are the running sum of the numbers of records, which can be
+/// computed in parallel (stream compaction). If the buffer is too small, the
+/// records that lie beyond its capacity are dropped.
+///
+/// @tparam algebra_t the algebra type of the recorded data
+/// @tparam container_t the types of underlying containers to be used.
+template <typename algebra_t, typename container_t = host_container_types>
+class compact_step_record_collection {
+
+    public:
+    template <typename T>
+    using vector_type = typename container_t::template vector_type<T>;
+    using size_type = dindex;
+    using scalar_type = dscalar<algebra_t>;
+    using point3_type = dpoint3D<algebra_t>;
+    using vector3_type = dvector3D<algebra_t>;
+    using free_matrix_type = free_matrix<algebra_t>;
+
+    /// Vecmem based view type
+    using view_type =
+        dmulti_view<dvector_view<unsigned int>, dvector_view<scalar_type>,
+                    dvector_view<point3_type>, dvector_view<vector3_type>,
+                    dvector_view<scalar_type>, dvector_view<geometry::barcode>,
+                    dvector_view<free_matrix_type>>;
+    using const_view_type = dmulti_view<
+        dvector_view<const unsigned int>, dvector_view<const scalar_type>,
+        dvector_view<const point3_type>, dvector_view<const vector3_type>,
+        dvector_view<const scalar_type>, dvector_view<const geometry::barcode>,
+        dvector_view<const free_matrix_type>>;
+
+    /// Vecmem based buffer type
+    using buffer_type = dmulti_buffer<
+        dvector_buffer<unsigned int>, dvector_buffer<scalar_type>,
+        dvector_buffer<point3_type>, dvector_buffer<vector3_type>,
+        dvector_buffer<scalar_type>, dvector_buffer<geometry::barcode>,
+        dvector_buffer<free_matrix_type>>;
+
+    /// Default constructor
+    constexpr compact_step_record_collection() = default;
+
+    /// Allocate the storage for @param n_tracks tracks with @param capacity
+    /// records in total from the memory resource @param resource
+    ///
+    /// @param with_jacobians whether to store the transport Jacobians
+    DETRAY_HOST
+    compact_step_record_collection(vecmem::memory_resource &resource,
+                                   const size_type n_tracks,
+                                   const size_type capacity,
+                                   const bool with_jacobians = false)
+        : m_offsets(n_tracks + 1u, 0u, &resource),
+          m_path_lengths(capacity, &resource),
+          m_positions(capacity, &resource),
+          m_directions(capacity, &resource),
+          m_qops(capacity, &resource),
+          m_barcodes(capacity, &resource),
+          m_jac_transports(with_jacobians ? capacity : 0u, &resource) {}
+
+    /// Device-side construction from a vecmem based view type
+    template <typename coll_view_t,
+              typename std::enable_if_t<detail::is_device_view_v<coll_view_t>,
+                                        bool> = true>
+    DETRAY_HOST_DEVICE explicit compact_step_record_collection(
+        coll_view_t &view)
+        : m_offsets(detail::get<0>(view.m_view)),
+          m_path_lengths(detail::get<1>(view.m_view)),
+          m_positions(detail::get<2>(view.m_view)),
+          m_directions(detail::get<3>(view.m_view)),
+          m_qops(detail::get<4>(view.m_view)),
+          m_barcodes(detail::get<5>(view.m_view)),
+          m_jac_transports(detail::get<6>(view.m_view)) {}
+
+    /// @returns the number of tracks
+    DETRAY_HOST_DEVICE
+    constexpr size_type size() const {
+        return m_offsets.empty()
+                   ? 0u
+                   : static_cast<size_type>(m_offsets.size()) - 1u;
+    }
+
+    /// @returns the number of records the buffer can hold
+    DETRAY_HOST_DEVICE
+    constexpr size_type capacity() const {
+        return static_cast<size_type>(m_path_lengths.size());
+    }
+
+    /// @returns whether the transport Jacobians are recorded
+    DETRAY_HOST_DEVICE
+    constexpr bool has_jacobians() const { return !m_jac_transports.empty(); }
+
+    /// @returns the number of records that are stored
+    DETRAY_HOST_DEVICE
+    constexpr size_type n_records() const {
+        return size() == 0u ? 0u : offset(size());
+    }
+
+    /// @returns the number of records of track @param trk that are stored
+    DETRAY_HOST_DEVICE
+    constexpr unsigned int n_records(const size_type trk) const {
+        return offset(trk + 1u) - offset(trk);
+    }
+
+    /// @returns the number of records that did not fit into the buffer
+    DETRAY_HOST_DEVICE
+    constexpr unsigned int n_dropped() const {
+        return size() == 0u ? 0u : m_offsets[size()] - offset(size());
+    }
+
+    /// Access the record @param i of track @param trk
+    /// @{
+    DETRAY_HOST_DEVICE
+    constexpr scalar_type path_length(const size_type trk,
+                                      const size_type i) const {
+        return m_path_lengths[index(trk, i)];
+    }
+    DETRAY_HOST_DEVICE
+    constexpr const point3_type &pos(const size_type trk,
+                                     const size_type i) const {
+        return m_positions[index(trk, i)];
+    }
+    DETRAY_HOST_DEVICE
+    constexpr const vector3_type &dir(const size_type trk,
+                                      const size_type i) const {
+        return m_directions[index(trk, i)];
+    }
+    DETRAY_HOST_DEVICE
+    constexpr scalar_type qop(const size_type trk, const size_type i) const {
+        return m_qops[index(trk, i)];
+    }
+    DETRAY_HOST_DEVICE
+    constexpr geometry::barcode barcode(const size_type trk,
+                                        const size_type i) const {
+        return m_barcodes[index(trk, i)];
+    }
+    DETRAY_HOST_DEVICE
+    constexpr const free_matrix_type &jac_transport(const size_type trk,
+                                                    const size_type i) const {
+        assert(has_jacobians());
+        return m_jac_transports[index(trk, i)];
+    }
+    /// @}
+
+    /// Copy the records of track @param trk from the slices in @param src
+    ///
+    /// @note The offsets have to be set already. The tracks can be gathered
+    /// independently of each other (one track per thread).
+    template <typename src_container_t>
+    DETRAY_HOST_DEVICE constexpr void gather(
+        const step_record_collection<algebra_t, src_container_t> &src,
+        const size_type trk) {
+        assert(trk < size());
+        assert(trk < src.size());
+
+        const size_type first{offset(trk)};
+        const unsigned int n{n_records(trk)};
+        const bool copy_jacobians{has_jacobians() && src.has_jacobians()};
+
+        for (size_type i = 0u; i < n; ++i) {
+            m_path_lengths[first + i] = src.path_length(trk, i);
+            m_positions[first + i] = src.pos(trk, i);
+            m_directions[first + i] = src.dir(trk, i);
+            m_qops[first + i] = src.qop(trk, i);
+            m_barcodes[first + i] = src.barcode(trk, i);
+            if (copy_jacobians) {
+                m_jac_transports[first + i] = src.jac_transport(trk, i);
+            }
+        }
+    }
+
+    /// @returns access to the offsets: Entry @c trk + 1 holds the total
+    /// number of records of the tracks up to and including @c trk
+    DETRAY_HOST_DEVICE
+    constexpr auto offsets() -> vector_type<unsigned int> & {
+        return m_offsets;
+    }
+
+    /// @return the view on the records - non-const
+    DETRAY_HOST
+    constexpr auto get_data() noexcept -> view_type {
+        return view_type{
+            detray::get_data(m_offsets),    detray::get_data(m_path_lengths),
+            detray::get_data(m_positions),  detray::get_data(m_directions),
+            detray::get_data(m_qops),       detray::get_data(m_barcodes),
+            detray::get_data(m_jac_transports)};
+    }
+
+    /// @return the view on the records - const
+    DETRAY_HOST
+    constexpr auto get_data() const noexcept -> const_view_type {
+        return const_view_type{
+            detray::get_data(m_offsets),    detray::get_data(m_path_lengths),
+            detray::get_data(m_positions),  detray::get_data(m_directions),
+            detray::get_data(m_qops),       detray::get_data(m_barcodes),
+            detray::get_data(m_jac_transports)};
+    }
+
+    private:
+    /// @returns the offset of track @param trk , cut at the capacity
+    DETRAY_HOST_DEVICE
+    constexpr size_type offset(const size_type trk) const {
+        const size_type off{m_offsets[trk]};
+        return off < capacity() ? off : capacity();
+    }
+
+    /// @returns the global index of record @param i of track @param trk
+    DETRAY_HOST_DEVICE
+    constexpr size_type index(const size_type trk, const size_type i) const {
+        assert(trk < size());
+        assert(i < n_records(trk));
+        return offset(trk) + i;
+    }
+
+    /// Running sum of the records per track (size: number of tracks + 1)
+    vector_type<unsigned int> m_offsets{};
+    /// Recorded quantities
+    /// @{
+    vector_type<scalar_type> m_path_lengths{};
+    vector_type<point3_type> m_positions{};
+    vector_type<vector3_type> m_directions{};
+    vector_type<scalar_type> m_qops{};
+    vector_type<geometry::barcode> m_barcodes{};
+    vector_type<free_matrix_type> m_jac_transports{};
+    /// @}
+};
+
+/// Copy the records in the slices of @param records into a dense collection,
+/// allocated from @param resource , that holds exactly the recorded steps
+template <typename algebra_t, typename container_t>
+DETRAY_HOST auto compact_step_records(
+    const step_record_collection<algebra_t, container_t> &records,
+    vecmem::memory_resource &resource)
+    -> compact_step_record_collection<algebra_t> {
+
+    using size_type =
+        typename step_record_collection<algebra_t, container_t>::size_type;
+
+    unsigned int n_total{0u};
+    for (size_type trk = 0u; trk < records.size(); ++trk) {
+        n_total += records.n_records(trk);
+    }
+
+    compact_step_record_collection<algebra_t> compact(
+        resource, records.size(), n_total, records.has_jacobians());
+
+    auto &offsets = compact.offsets();
+    for (size_type trk = 0u; trk < records.size(); ++trk) {
+        offsets[trk + 1u] = offsets[trk] + records.n_records(trk);
+    }
+    for (size_type trk = 0u; trk < records.size(); ++trk) {
+        compact.gather(records, trk);
+    }
+
+    return compact;
+}
+
+namespace detail {
+
+/// Bind the step recorder states in @param states to the slice of track
+/// @param trk in @param records
+/// @{
+template <typename collection_t, typename actor_state_t>
+DETRAY_HOST_DEVICE constexpr void bind_step_record(actor_state_t &actor_state,
+                                                   collection_t &records,
+                                                   const dindex trk) {
+    using recorder_state_t =
+        typename step_recorder<typename collection_t::algebra_type,
+                               typename collection_t::container_type>::state;
+
+    // Other actors are not touched
+    if constexpr (std::is_same_v<actor_state_t, recorder_state_t>) {
+        actor_state.bind(records, trk);
+    }
+}
+
+template <typename state_tuple_t, typename collection_t, std::size_t... I>
+DETRAY_HOST_DEVICE constexpr void bind_step_records(
+    state_tuple_t &states, collection_t &records, const dindex trk,
+    std::index_sequence<I...> /*ids*/) {
+    (bind_step_record(detail::get<I>(states), records, trk), ...);
+}
+
+template <typename state_tuple_t, typename collection_t>
+DETRAY_HOST_DEVICE constexpr void bind_step_records(state_tuple_t &states,
+                                                    collection_t &records,
+                                                    const dindex trk) {
+    bind_step_records(
+        states, records, trk,
+        std::make_index_sequence<detail::tuple_size_v<state_tuple_t>>{});
+}
+/// @}
+
+}  // namespace detail
+
+}  // namespace detray
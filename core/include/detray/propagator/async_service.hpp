@@ -0,0 +1,287 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Vecmem include(s)
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace detray::propagation {
+
+/// @brief Asynchronous propagation service that coalesces small requests.
+///
+/// Callers submit a few tracks at a time from any thread and get the results
+/// back through a future or a completion callback. A service thread collects
+/// the pending requests into a batch, which is dispatched once it holds
+/// enough tracks or once the oldest request has waited for the maximal
+/// delay, whichever comes first. The batch size controls the utilisation of
+/// the executor (e.g. a device), the delay bounds the latency of a request.
+///
+/// The dispatcher propagates a whole batch, e.g. with
+/// @c propagator::propagate_batch and a host executor, or on a device with
+/// @c cuda::multi_device_propagator . It is only ever called from the service
+/// thread. Requests are never split between batches, so that a request that
+/// is larger than the batch size is dispatched on its own.
+///
+/// @tparam track_t the track parameter type
+/// @tparam result_t the type of the propagation outcome of a track
+/// @tparam dispatcher_t callable with the signature
+///         (const vecmem::vector<track_t>&, vecmem::vector<result_t>&), which
+///         fills one result per track
+template <typename track_t, typename result_t, typename dispatcher_t>
+class async_service {
+
+    using clock_t = std::chrono::steady_clock;
+
+    public:
+    /// Completion callback of a request
+    using callback_type = std::function<void(std::vector<result_t> &&)>;
+
+    /// Configuration of the batching
+    struct config {
+        /// Dispatch as soon as the pending requests hold this many tracks
+        std::size_t batch_size{4096u};
+        /// Dispatch at the latest when the oldest request waited this long
+        std::chrono::microseconds max_delay{500};
+    };
+
+    /// Counters of the service, e.g. to tune the batching
+    struct statistics {
+        /// Number of dispatched batches
+        std::size_t n_batches{0u};
+        /// Number of propagated tracks
+        std::size_t n_tracks{0u};
+        /// Batches that were dispatched because of the delay
+        std::size_t n_deadline_batches{0u};
+    };
+
+    /// Start the service thread
+    ///
+    /// @param dispatcher propagates a batch of tracks
+    /// @param mr memory resource of the batch buffers (e.g. pinned memory
+    ///           for the transfer to a device)
+    /// @param cfg the batching configuration
+    async_service(dispatcher_t dispatcher, vecmem::memory_resource &mr,
+                  const config &cfg = {})
+        : m_cfg{cfg},
+          m_dispatcher{std::move(dispatcher)},
+          m_tracks{&mr},
+          m_results{&mr} {
+        m_cfg.batch_size = std::max(m_cfg.batch_size, std::size_t{1u});
+        m_tracks.reserve(m_cfg.batch_size);
+        m_results.reserve(m_cfg.batch_size);
+
+        m_thread = std::thread([this]() { run(); });
+    }
+
+    /// Not copyable or movable: The service thread refers to the object
+    /// @{
+    async_service(const async_service &) = delete;
+    async_service &operator=(const async_service &) = delete;
+    /// @}
+
+    /// Dispatch the remaining requests and stop the service thread
+    ~async_service() {
+        {
+            const std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_wake_up.notify_one();
+        m_thread.join();
+    }
+
+    /// Submit the @param tracks for propagation
+    ///
+    /// @returns the future of the results, one per track in the order of the
+    /// tracks. If the dispatcher throws, the exception is stored in the
+    /// future.
+    std::future<std::vector<result_t>> submit(std::vector<track_t> tracks) {
+        request req{};
+        req.tracks = std::move(tracks);
+        auto future = req.promise.get_future();
+        enqueue(std::move(req));
+
+        return future;
+    }
+
+    /// Submit the @param tracks for propagation and call @param callback
+    /// with the results, once they are available.
+    ///
+    /// The callback is called on the service thread and should return
+    /// quickly. If the dispatcher throws, it is called without results.
+    void submit(std::vector<track_t> tracks, callback_type callback) {
+        request req{};
+        req.tracks = std::move(tracks);
+        req.callback = std::move(callback);
+        enqueue(std::move(req));
+    }
+
+    /// @returns the counters of the service
+    statistics stats() const {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        return m_stats;
+    }
+
+    private:
+    /// A submitted request
+    struct request {
+        std::vector<track_t> tracks{};
+        /// Completion through a callback, if set, otherwise the promise
+        callback_type callback{};
+        std::promise<std::vector<result_t>> promise{};
+        /// Time of submission
+        clock_t::time_point submitted{};
+    };
+
+    /// Add the request @param req to the queue and wake the service thread,
+    /// if a batch is ready
+    void enqueue(request &&req) {
+        req.submitted = clock_t::now();
+        bool was_empty{false};
+        bool is_full{false};
+        {
+            const std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_stop) {
+                throw std::logic_error("Propagation service is stopped");
+            }
+            was_empty = m_pending.empty();
+            m_n_pending_tracks += req.tracks.size();
+            m_pending.push_back(std::move(req));
+            is_full = (m_n_pending_tracks >= m_cfg.batch_size);
+        }
+        // The service thread needs a new deadline or can dispatch now
+        if (was_empty || is_full) {
+            m_wake_up.notify_one();
+        }
+    }
+
+    /// Loop of the service thread
+    void run() {
+        std::vector<request> batch{};
+
+        while (true) {
+            bool on_deadline{false};
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+
+                // Wait for the first request
+                m_wake_up.wait(lock, [this]() {
+                    return m_stop || !m_pending.empty();
+                });
+                if (m_pending.empty()) {
+                    // Stopped and drained
+                    return;
+                }
+
+                // Wait for a full batch until the oldest request is due
+                const clock_t::time_point deadline{
+                    m_pending.front().submitted + m_cfg.max_delay};
+                on_deadline = !m_wake_up.wait_until(lock, deadline, [this]() {
+                    return m_stop || m_n_pending_tracks >= m_cfg.batch_size;
+                });
+
+                // Take whole requests up to the batch size
+                std::size_t n_tracks{0u};
+                while (!m_pending.empty() &&
+                       (batch.empty() ||
+                        n_tracks + m_pending.front().tracks.size() <=
+                            m_cfg.batch_size)) {
+                    n_tracks += m_pending.front().tracks.size();
+                    batch.push_back(std::move(m_pending.front()));
+                    m_pending.pop_front();
+                }
+                m_n_pending_tracks -= n_tracks;
+
+                ++m_stats.n_batches;
+                m_stats.n_tracks += n_tracks;
+                m_stats.n_deadline_batches += on_deadline ? 1u : 0u;
+            }
+
+            dispatch(batch);
+            batch.clear();
+        }
+    }
+
+    /// Propagate the tracks of the requests in @param batch together and
+    /// complete the requests
+    void dispatch(std::vector<request> &batch) {
+        m_tracks.clear();
+        for (const request &req : batch) {
+            m_tracks.insert(m_tracks.end(), req.tracks.begin(),
+                            req.tracks.end());
+        }
+        m_results.resize(m_tracks.size());
+
+        try {
+            m_dispatcher(m_tracks, m_results);
+        } catch (...) {
+            const std::exception_ptr error = std::current_exception();
+            for (request &req : batch) {
+                if (req.callback) {
+                    req.callback({});
+                } else {
+                    req.promise.set_exception(error);
+                }
+            }
+            return;
+        }
+
+        // Hand the results back in the order of the requests
+        auto first = m_results.begin();
+        for (request &req : batch) {
+            const auto last =
+                first + static_cast<std::ptrdiff_t>(req.tracks.size());
+            std::vector<result_t> results(first, last);
+            first = last;
+
+            if (req.callback) {
+                req.callback(std::move(results));
+            } else {
+                req.promise.set_value(std::move(results));
+            }
+        }
+    }
+
+    /// Batching configuration
+    config m_cfg{};
+    /// Propagates the batches
+    dispatcher_t m_dispatcher;
+
+    /// Guards the queue, the counters and the stop flag
+    mutable std::mutex m_mutex{};
+    std::condition_variable m_wake_up{};
+    /// Submitted requests that were not dispatched yet
+    std::deque<request> m_pending{};
+    std::size_t m_n_pending_tracks{0u};
+    statistics m_stats{};
+    bool m_stop{false};
+
+    /// Batch buffers, reused between the batches (service thread only)
+    vecmem::vector<track_t> m_tracks;
+    vecmem::vector<result_t> m_results;
+
+    /// The service thread (started last)
+    std::thread m_thread{};
+};
+
+}  // namespace detray::propagation
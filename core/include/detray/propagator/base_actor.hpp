@@ -21,6 +21,12 @@ struct actor {
     /// Tag whether this is a composite type
     struct is_comp_actor : public std::false_type {};
 
+    /// Tag whether the actor only acts when the track is on a module surface.
+    /// Such an actor also provides a call operator that takes the surface and
+    /// its resolved mask, which the actor chain uses to visit the mask only
+    /// once for all of its surface actors.
+    struct is_surface_actor : public std::false_type {};
+
     /// Defines the actors state. Hidden by actor implementations.
     struct state {};
 };
@@ -42,6 +48,10 @@ class composite_actor final : public actor_impl_t {
     /// Tag whether this is a composite type (hides the def in the actor)
     struct is_comp_actor : public std::true_type {};
 
+    /// The composition is always called as a whole (hides the def in the
+    /// actor)
+    struct is_surface_actor : public std::false_type {};
+
     /// The composite is an actor in itself. For simplicity, it cannot be
     /// derived from another composition (final).
     using actor_type = actor_impl_t;
@@ -8,6 +8,7 @@
 #pragma once
 
 // Project include(s).
+#include "detray/definitions/detail/math.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/definitions/units.hpp"
 #include "detray/geometry/surface.hpp"
@@ -124,12 +125,25 @@ class base_stepper {
         /// the track reaches a new surface
         scalar_type _s{0.f};
 
+        /// Path length in volume material in units of the radiation length
+        /// from the last surface. It will be reset to 0 when the track reaches
+        /// a new surface
+        scalar_type _path_in_X0{0.f};
+
+        /// Path length in volume material from the last surface
+        scalar_type _path_in_material{0.f};
+
         /// Current step size
         scalar_type _step_size{0.f};
 
         /// Previous step size (DEBUG purpose only)
         scalar_type _prev_step_size{0.f};
 
+        /// Absolute step size suggested by the error control of the last
+        /// step (zero if the stepper does not control the error). It is kept
+        /// when the navigation resets the step size
+        scalar_type _suggested_step_size{0.f};
+
         /// The particle mass
         scalar_type _mass{105.7f * unit<scalar_type>::MeV};
 
@@ -139,6 +153,15 @@ class base_stepper {
         /// is step size just initialized
         bool _initialized = true;
 
+        /// Transport the jacobian for this track (the covariance transport
+        /// can also be switched off for all tracks in the stepping config)
+        bool _do_covariance_transport = true;
+
+        /// Only convert to bound parameters on sensitive surfaces and on
+        /// surfaces with material. On the other module surfaces the free
+        /// transport jacobian keeps accumulating
+        bool _do_lazy_bound_conversion = false;
+
         /// Set new step constraint
         template <step::constraint type = step::constraint::e_actor>
         DETRAY_HOST_DEVICE inline void set_constraint(scalar_type step_size) {
@@ -174,10 +197,63 @@ class base_stepper {
         DETRAY_HOST_DEVICE
         inline void set_step_size(const scalar_type step) { _step_size = step; }
 
+        /// Restart the step size control with the distance to the next
+        /// candidate @param nav_step, but not beyond the step size that was
+        /// suggested by the error estimate of the last step
+        DETRAY_HOST_DEVICE
+        inline void reset_step_size(const scalar_type nav_step) {
+            _step_size = nav_step;
+            if (_suggested_step_size > 0.f &&
+                math::abs(nav_step) > _suggested_step_size) {
+                _step_size = math::copysign(_suggested_step_size, nav_step);
+            }
+            _initialized = true;
+        }
+
+        /// Update the suggested step size from the next step size
+        /// @param next_step of the error control. If the last step was cut
+        /// by the navigation or the constraints (@param is_cut), its error
+        /// says little about the step size that the field allows
+        DETRAY_HOST_DEVICE
+        inline void update_suggested_step_size(const scalar_type next_step,
+                                               const bool is_cut) {
+            _suggested_step_size =
+                is_cut ? math::max(_suggested_step_size, math::abs(next_step))
+                       : math::abs(next_step);
+        }
+
         /// @returns the current step size of this state.
         DETRAY_HOST_DEVICE
         inline scalar_type step_size() const { return _step_size; }
 
+        /// Switch the jacobian transport for this track on or off
+        DETRAY_HOST_DEVICE
+        inline void set_covariance_transport(const bool do_transport) {
+            _do_covariance_transport = do_transport;
+        }
+
+        /// @returns whether the jacobian is transported for this track
+        DETRAY_HOST_DEVICE
+        inline bool do_covariance_transport() const {
+            return _do_covariance_transport;
+        }
+
+        /// Switch the lazy conversion to bound parameters for this track on
+        /// or off
+        DETRAY_HOST_DEVICE
+        inline void set_lazy_bound_conversion(const bool do_lazy) {
+            _do_lazy_bound_conversion = do_lazy;
+        }
+
+        /// @returns whether the track parameters are converted to bound
+        /// parameters on the module surface @param sf
+        template <typename surface_t>
+        DETRAY_HOST_DEVICE inline bool do_bound_conversion(
+            const surface_t &sf) const {
+            return !_do_lazy_bound_conversion || sf.is_sensitive() ||
+                   sf.has_material();
+        }
+
         /// @returns this states remaining path length.
         DETRAY_HOST_DEVICE
         inline scalar_type path_length() const { return _path_length; }
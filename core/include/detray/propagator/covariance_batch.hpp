@@ -0,0 +1,186 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/track_parametrization.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+
+namespace detray::propagation {
+
+/// @brief Structure-of-arrays view of the matrices of a batch of tracks.
+///
+/// The element (i, j) of all tracks is stored contiguously, followed by the
+/// element (i, j + 1) and so on (row major over the elements). A loop over
+/// the tracks then runs over densely packed values: On the host it can be
+/// vectorized, on a device the threads of a warp read coalesced memory.
+///
+/// @note The view does not own the data, which holds
+/// @c n_elements(n_tracks) values (e.g. a vecmem vector or buffer).
+template <typename scalar_t, std::size_t ROWS, std::size_t COLS>
+struct matrix_batch_view {
+
+    using scalar_type = scalar_t;
+
+    /// @returns the number of values that a batch of @param n_tracks needs
+    DETRAY_HOST_DEVICE
+    static constexpr std::size_t n_elements(const unsigned int n_tracks) {
+        return ROWS * COLS * n_tracks;
+    }
+
+    /// @returns the element (@param i, @param j) of the track @param trk
+    DETRAY_HOST_DEVICE
+    scalar_t &operator()(const unsigned int i, const unsigned int j,
+                         const unsigned int trk) const {
+        assert(i < ROWS && j < COLS && trk < n_tracks);
+        return data[(i * COLS + j) * n_tracks + trk];
+    }
+
+    /// Pointer to the matrix elements
+    scalar_t *data{nullptr};
+    /// Number of tracks in the batch
+    unsigned int n_tracks{0u};
+};
+
+/// Bound matrices of a batch of tracks
+template <typename algebra_t>
+using bound_matrix_batch_view =
+    matrix_batch_view<dscalar<algebra_t>, e_bound_size, e_bound_size>;
+
+/// Copy the matrix @param m into the batch @param batch at the track index
+/// @param trk
+template <typename matrix_t, typename scalar_t, std::size_t ROWS,
+          std::size_t COLS>
+DETRAY_HOST_DEVICE inline void gather(
+    const matrix_t &m, const matrix_batch_view<scalar_t, ROWS, COLS> &batch,
+    const unsigned int trk) {
+    for (unsigned int i = 0u; i < ROWS; ++i) {
+        for (unsigned int j = 0u; j < COLS; ++j) {
+            batch(i, j, trk) = getter::element(m, i, j);
+        }
+    }
+}
+
+/// Copy the matrix of the track @param trk in the batch @param batch into
+/// the matrix @param m
+template <typename matrix_t, typename scalar_t, std::size_t ROWS,
+          std::size_t COLS>
+DETRAY_HOST_DEVICE inline void scatter(
+    const matrix_batch_view<scalar_t, ROWS, COLS> &batch,
+    const unsigned int trk, matrix_t &m) {
+    for (unsigned int i = 0u; i < ROWS; ++i) {
+        for (unsigned int j = 0u; j < COLS; ++j) {
+            getter::element(m, i, j) = batch(i, j, trk);
+        }
+    }
+}
+
+/// @brief Transport the covariance of a single track in a batch.
+///
+/// Computes C <- J * C * J^T for the track @param trk in place. Only the
+/// upper triangle is computed and then mirrored, since C is symmetric. On a
+/// device, every thread calls this for its own track.
+///
+/// @param jac the full bound to bound jacobians of the batch
+/// @param cov the bound covariances of the batch
+template <typename scalar_t, std::size_t N>
+DETRAY_HOST_DEVICE inline void transport_covariance(
+    const matrix_batch_view<scalar_t, N, N> &jac,
+    const matrix_batch_view<scalar_t, N, N> &cov, const unsigned int trk) {
+    assert(jac.n_tracks == cov.n_tracks);
+
+    // J * C
+    scalar_t jac_cov[N][N];
+    for (unsigned int i = 0u; i < N; ++i) {
+        for (unsigned int j = 0u; j < N; ++j) {
+            scalar_t v{0.f};
+            for (unsigned int k = 0u; k < N; ++k) {
+                v += jac(i, k, trk) * cov(k, j, trk);
+            }
+            jac_cov[i][j] = v;
+        }
+    }
+
+    // (J * C) * J^T
+    for (unsigned int i = 0u; i < N; ++i) {
+        for (unsigned int j = i; j < N; ++j) {
+            scalar_t v{0.f};
+            for (unsigned int k = 0u; k < N; ++k) {
+                v += jac_cov[i][k] * jac(j, k, trk);
+            }
+            cov(i, j, trk) = v;
+            cov(j, i, trk) = v;
+        }
+    }
+}
+
+/// @brief Transport the covariances of all tracks in a batch on the host.
+///
+/// Computes C <- J * C * J^T for every track in place. The tracks are
+/// processed in chunks of @tparam kLANES, with the loop over the tracks of
+/// a chunk innermost, so that the compiler can vectorize across tracks.
+///
+/// @param jac the full bound to bound jacobians of the batch
+/// @param cov the bound covariances of the batch
+template <std::size_t kLANES = 64u, typename scalar_t, std::size_t N>
+DETRAY_HOST inline void transport_covariance(
+    const matrix_batch_view<scalar_t, N, N> &jac,
+    const matrix_batch_view<scalar_t, N, N> &cov) {
+    assert(jac.n_tracks == cov.n_tracks);
+
+    // J * C of the current chunk
+    scalar_t jac_cov[N][N][kLANES];
+
+    for (unsigned int first = 0u; first < cov.n_tracks; first += kLANES) {
+        const unsigned int n_lanes{std::min(
+            static_cast<unsigned int>(kLANES), cov.n_tracks - first)};
+        const scalar_t *const jac_data{jac.data + first};
+        scalar_t *const cov_data{cov.data + first};
+        const std::size_t stride{cov.n_tracks};
+
+        for (unsigned int i = 0u; i < N; ++i) {
+            for (unsigned int j = 0u; j < N; ++j) {
+                scalar_t *const out{jac_cov[i][j]};
+                std::fill(out, out + n_lanes, scalar_t{0.f});
+                for (unsigned int k = 0u; k < N; ++k) {
+                    const scalar_t *const a{jac_data + (i * N + k) * stride};
+                    const scalar_t *const b{cov_data + (k * N + j) * stride};
+                    for (unsigned int l = 0u; l < n_lanes; ++l) {
+                        out[l] += a[l] * b[l];
+                    }
+                }
+            }
+        }
+
+        for (unsigned int i = 0u; i < N; ++i) {
+            for (unsigned int j = i; j < N; ++j) {
+                scalar_t *const out_ij{cov_data + (i * N + j) * stride};
+                std::fill(out_ij, out_ij + n_lanes, scalar_t{0.f});
+                for (unsigned int k = 0u; k < N; ++k) {
+                    const scalar_t *const a{jac_cov[i][k]};
+                    const scalar_t *const b{jac_data + (j * N + k) * stride};
+                    for (unsigned int l = 0u; l < n_lanes; ++l) {
+                        out_ij[l] += a[l] * b[l];
+                    }
+                }
+                if (i != j) {
+                    std::copy(out_ij, out_ij + n_lanes,
+                              cov_data + (j * N + i) * stride);
+                }
+            }
+        }
+    }
+}
+
+}  // namespace detray::propagation
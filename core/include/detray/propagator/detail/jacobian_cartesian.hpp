@@ -44,6 +44,9 @@ struct jacobian<cartesian2D<algebra_t>> {
     using free_to_path_matrix_type = free_to_path_matrix<algebra_t>;
     /// @}
 
+    /// The path derivative does not depend on the track direction
+    static constexpr bool has_dir_path_derivative{false};
+
     DETRAY_HOST_DEVICE
     static inline auto reference_frame(const transform3_type &trf3,
                                        const point3_type & /*pos*/,
@@ -9,6 +9,7 @@
 
 // Project include(s).
 #include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/fast_math.hpp"
 #include "detray/definitions/detail/math.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/definitions/track_parametrization.hpp"
@@ -55,6 +56,22 @@ struct jacobian_engine {
     bound_to_free_jacobian(const transform3_type& trf3, const mask_t& mask,
                            const bound_vector<algebra_type>& bound_vec) {
 
+        // Global position and direction
+        return bound_to_free_jacobian(
+            trf3, bound_vec, bound_to_free_vector(trf3, mask, bound_vec));
+    }
+
+    /// @returns the bound to free jacobian for the bound vector
+    /// @param bound_vec and the corresponding free vector @param free_vec .
+    ///
+    /// Only the local frame enters here, so that this is instantiated once
+    /// per frame, not once per mask type: The mask is only needed to obtain
+    /// the global position, which is contained in @param free_vec
+    DETRAY_HOST_DEVICE static inline bound_to_free_matrix_type
+    bound_to_free_jacobian(const transform3_type& trf3,
+                           const bound_vector<algebra_type>& bound_vec,
+                           const free_vector<algebra_type>& free_vec) {
+
         // Declare jacobian for bound to free coordinate transform
         bound_to_free_matrix_type jac_to_global =
             matrix_operator().template zero<e_free_size, e_bound_size>();
@@ -65,15 +82,12 @@ struct jacobian_engine {
         const scalar_type phi{
             matrix_operator().element(bound_vec, e_bound_phi, 0u)};
 
-        const scalar_type cos_theta{math::cos(theta)};
-        const scalar_type sin_theta{math::sin(theta)};
-        const scalar_type cos_phi{math::cos(phi)};
-        const scalar_type sin_phi{math::sin(phi)};
+        const scalar_type cos_theta{fast_math::cos(theta)};
+        const scalar_type sin_theta{fast_math::sin(theta)};
+        const scalar_type cos_phi{fast_math::cos(phi)};
+        const scalar_type sin_phi{fast_math::sin(phi)};
 
         // Global position and direction
-        const free_vector<algebra_type> free_vec =
-            bound_to_free_vector(trf3, mask, bound_vec);
-
         const vector3_type pos = track_helper().pos(free_vec);
         const vector3_type dir = track_helper().dir(free_vec);
 
@@ -119,13 +133,13 @@ struct jacobian_engine {
         const vector3_type pos = track_helper().pos(free_vec);
         const vector3_type dir = track_helper().dir(free_vec);
 
-        const scalar_type theta{getter::theta(dir)};
-        const scalar_type phi{getter::phi(dir)};
+        const scalar_type theta{fast_math::atan2(getter::perp(dir), dir[2])};
+        const scalar_type phi{fast_math::phi(dir)};
 
-        const scalar_type cos_theta{math::cos(theta)};
-        const scalar_type sin_theta{math::sin(theta)};
-        const scalar_type cos_phi{math::cos(phi)};
-        const scalar_type sin_phi{math::sin(phi)};
+        const scalar_type cos_theta{fast_math::cos(theta)};
+        const scalar_type sin_theta{fast_math::sin(theta)};
+        const scalar_type cos_phi{fast_math::cos(phi)};
+        const scalar_type sin_phi{fast_math::sin(phi)};
 
         // Set d(loc0, loc1)/d(x,y,z)
         jacobian_t::set_free_pos_to_bound_pos_derivative(jac_to_local, trf3,
@@ -155,13 +169,10 @@ struct jacobian_engine {
         return jac_to_local;
     }
 
-    DETRAY_HOST_DEVICE static inline free_matrix<algebra_type> path_correction(
-        const vector3_type& pos, const vector3_type& dir,
-        const vector3_type& dtds, const scalar dqopds,
-        const transform3_type& trf3) {
-
-        free_to_path_matrix_type path_derivative =
-            jacobian_t::path_derivative(trf3, pos, dir, dtds);
+    /// @returns the derivative of the free track parameters w.r.t. the path
+    DETRAY_HOST_DEVICE static inline path_to_free_matrix_type
+    path_to_free_derivative(const vector3_type& dir, const vector3_type& dtds,
+                            const scalar_type dqopds) {
 
         path_to_free_matrix_type derivative =
             matrix_operator().template zero<e_free_size, 1u>();
@@ -173,8 +184,190 @@ struct jacobian_engine {
         matrix_operator().element(derivative, e_free_dir2, 0u) = dtds[2];
         matrix_operator().element(derivative, e_free_qoverp, 0u) = dqopds;
 
-        return derivative * path_derivative;
+        return derivative;
     }
+
+    DETRAY_HOST_DEVICE static inline free_matrix<algebra_type> path_correction(
+        const vector3_type& pos, const vector3_type& dir,
+        const vector3_type& dtds, const scalar dqopds,
+        const transform3_type& trf3) {
+
+        free_to_path_matrix_type path_derivative =
+            jacobian_t::path_derivative(trf3, pos, dir, dtds);
+
+        return path_to_free_derivative(dir, dtds, dqopds) * path_derivative;
+    }
+
+    /// @name Products that skip the structural zeros of the jacobians
+    /// @{
+
+    /// @returns whether the element (@param row, @param col) of the path
+    /// corrected free to bound jacobian can be non-zero
+    DETRAY_HOST_DEVICE static constexpr bool is_free_to_bound_nonzero(
+        const unsigned int row, const unsigned int col) {
+        if (col <= e_free_pos2) {
+            return row != e_bound_time;
+        }
+        if (col == e_free_time) {
+            return row == e_bound_time;
+        }
+        if (col == e_free_qoverp) {
+            return row == e_bound_qoverp;
+        }
+        // Direction: only frames with a direction dependent path derivative
+        // correct the local position and q/p
+        if (jacobian_t::has_dir_path_derivative && row != e_bound_time) {
+            return true;
+        }
+        return row == e_bound_theta ||
+               (row == e_bound_phi && col != e_free_dir2);
+    }
+
+    /// @returns whether the element (@param row, @param col) of a bound to
+    /// free jacobian can be non-zero, independent of the departure frame
+    DETRAY_HOST_DEVICE static constexpr bool is_bound_to_free_nonzero(
+        const unsigned int row, const unsigned int col) {
+        if (row <= e_free_pos2) {
+            return col <= e_bound_theta;
+        }
+        if (row == e_free_time) {
+            return col == e_bound_time;
+        }
+        if (row == e_free_qoverp) {
+            return col == e_bound_qoverp;
+        }
+        return col == e_bound_theta ||
+               (col == e_bound_phi && row != e_free_dir2);
+    }
+
+    /// @brief Free to bound jacobian, corrected for the path length variation
+    ///
+    /// Computes J_f2b * (1 + d(free)/ds * ds/d(free)) as a rank-one update of
+    /// the free to bound jacobian, instead of forming the dense 8x8 path
+    /// correction matrix.
+    DETRAY_HOST_DEVICE
+    static inline free_to_bound_matrix_type corrected_free_to_bound_jacobian(
+        const transform3_type& trf3, const free_vector<algebra_type>& free_vec,
+        const vector3_type& dtds, const scalar_type dqopds) {
+
+        free_to_bound_matrix_type jac = free_to_bound_jacobian(trf3, free_vec);
+
+        const vector3_type pos = track_helper().pos(free_vec);
+        const vector3_type dir = track_helper().dir(free_vec);
+
+        const path_to_free_matrix_type path_to_free =
+            path_to_free_derivative(dir, dtds, dqopds);
+        const free_to_path_matrix_type free_to_path =
+            jacobian_t::path_derivative(trf3, pos, dir, dtds);
+
+        for (unsigned int i = 0u; i < e_bound_size; ++i) {
+            // Variation of the bound parameter along the path
+            scalar_type dbds{0.f};
+            for (unsigned int k = 0u; k < e_free_size; ++k) {
+                if (is_free_to_bound_nonzero(i, k)) {
+                    dbds += matrix_operator().element(jac, i, k) *
+                            matrix_operator().element(path_to_free, k, 0u);
+                }
+            }
+            // The path derivative only depends on the position (and the
+            // direction for some frames)
+            for (unsigned int j = 0u; j < e_free_size; ++j) {
+                if (j <= e_free_pos2 ||
+                    (jacobian_t::has_dir_path_derivative && j >= e_free_dir0 &&
+                     j <= e_free_dir2)) {
+                    matrix_operator().element(jac, i, j) +=
+                        dbds * matrix_operator().element(free_to_path, 0u, j);
+                }
+            }
+        }
+
+        return jac;
+    }
+
+    /// @returns the product of the path corrected free to bound jacobian
+    /// @param free_to_bound and the free transport jacobian @param transport
+    DETRAY_HOST_DEVICE
+    static inline free_to_bound_matrix_type free_to_bound_transport(
+        const free_to_bound_matrix_type& free_to_bound,
+        const free_matrix<algebra_type>& transport) {
+
+        free_to_bound_matrix_type result =
+            matrix_operator().template zero<e_bound_size, e_free_size>();
+
+        for (unsigned int i = 0u; i < e_bound_size; ++i) {
+            for (unsigned int k = 0u; k < e_free_size; ++k) {
+                if (!is_free_to_bound_nonzero(i, k)) {
+                    continue;
+                }
+                const scalar_type a{
+                    matrix_operator().element(free_to_bound, i, k)};
+                for (unsigned int j = 0u; j < e_free_size; ++j) {
+                    matrix_operator().element(result, i, j) +=
+                        a * matrix_operator().element(transport, k, j);
+                }
+            }
+        }
+
+        return result;
+    }
+
+    /// @returns the full bound to bound jacobian from the transport to the
+    /// bound frame @param transport_to_bound and the bound to free jacobian
+    /// of the departure surface @param bound_to_free
+    DETRAY_HOST_DEVICE
+    static inline bound_matrix<algebra_type> full_jacobian(
+        const free_to_bound_matrix_type& transport_to_bound,
+        const bound_to_free_matrix_type& bound_to_free) {
+
+        bound_matrix<algebra_type> result =
+            matrix_operator().template zero<e_bound_size, e_bound_size>();
+
+        for (unsigned int k = 0u; k < e_free_size; ++k) {
+            for (unsigned int j = 0u; j < e_bound_size; ++j) {
+                if (!is_bound_to_free_nonzero(k, j)) {
+                    continue;
+                }
+                const scalar_type b{
+                    matrix_operator().element(bound_to_free, k, j)};
+                for (unsigned int i = 0u; i < e_bound_size; ++i) {
+                    matrix_operator().element(result, i, j) +=
+                        matrix_operator().element(transport_to_bound, i, k) *
+                        b;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    /// @returns the transported covariance J * C * J^T for the jacobian
+    /// @param jac and the symmetric covariance @param cov . Only the upper
+    /// triangle is computed and then mirrored.
+    template <std::size_t N>
+    DETRAY_HOST_DEVICE static inline bound_matrix<algebra_type>
+    transport_covariance(const dmatrix<algebra_type, e_bound_size, N>& jac,
+                         const dmatrix<algebra_type, N, N>& cov) {
+
+        const dmatrix<algebra_type, e_bound_size, N> jac_cov = jac * cov;
+
+        bound_matrix<algebra_type> result =
+            matrix_operator().template zero<e_bound_size, e_bound_size>();
+
+        for (unsigned int i = 0u; i < e_bound_size; ++i) {
+            for (unsigned int j = i; j < e_bound_size; ++j) {
+                scalar_type c_ij{0.f};
+                for (unsigned int k = 0u; k < N; ++k) {
+                    c_ij += matrix_operator().element(jac_cov, i, k) *
+                            matrix_operator().element(jac, j, k);
+                }
+                matrix_operator().element(result, i, j) = c_ij;
+                matrix_operator().element(result, j, i) = c_ij;
+            }
+        }
+
+        return result;
+    }
+    /// @}
 };
 
 }  // namespace detray::detail
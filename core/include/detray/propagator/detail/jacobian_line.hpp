@@ -40,6 +40,9 @@ struct jacobian<line2D<algebra_t>> {
     using free_to_path_matrix_type = free_to_path_matrix<algebra_t>;
     /// @}
 
+    /// The path derivative depends on the track direction
+    static constexpr bool has_dir_path_derivative{true};
+
     DETRAY_HOST_DEVICE
     static inline rotation_matrix reference_frame(const transform3_type &trf3,
                                                   const point3_type & /*pos*/,
@@ -9,6 +9,7 @@
 
 // Project include(s).
 #include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/fast_math.hpp"
 #include "detray/definitions/detail/math.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/definitions/track_parametrization.hpp"
@@ -45,6 +46,9 @@ struct jacobian<polar2D<algebra_t>> {
     using free_to_path_matrix_type = free_to_path_matrix<algebra_t>;
     /// @}
 
+    /// The path derivative does not depend on the track direction
+    static constexpr bool has_dir_path_derivative{false};
+
     DETRAY_HOST_DEVICE
     static inline rotation_matrix reference_frame(
         const transform3_type &trf3, const point3_type & /*pos*/,
@@ -84,8 +88,8 @@ struct jacobian<polar2D<algebra_t>> {
         const scalar_type lrad{local[0]};
         const scalar_type lphi{local[1]};
 
-        const scalar_type lcos_phi{math::cos(lphi)};
-        const scalar_type lsin_phi{math::sin(lphi)};
+        const scalar_type lcos_phi{fast_math::cos(lphi)};
+        const scalar_type lsin_phi{fast_math::sin(lphi)};
 
         // reference matrix
         const auto frame = reference_frame(trf3, pos, dir);
@@ -126,8 +130,8 @@ struct jacobian<polar2D<algebra_t>> {
         const scalar_type lrad{local[0]};
         const scalar_type lphi{local[1]};
 
-        const scalar_type lcos_phi{math::cos(lphi)};
-        const scalar_type lsin_phi{math::sin(lphi)};
+        const scalar_type lcos_phi{fast_math::cos(lphi)};
+        const scalar_type lsin_phi{fast_math::sin(lphi)};
 
         // reference matrix
         const auto frame = reference_frame(trf3, pos, dir);
@@ -0,0 +1,434 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/track_parametrization.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/geometry/detail/surface_descriptor.hpp"
+#include "detray/geometry/mask.hpp"
+#include "detray/geometry/shapes/cylinder2D.hpp"
+#include "detray/materials/lumped_cylinder_material.hpp"
+#include "detray/navigation/detail/helix.hpp"
+#include "detray/navigation/detail/ray.hpp"
+#include "detray/navigation/intersection/helix_intersector.hpp"
+#include "detray/navigation/intersection/intersection.hpp"
+#include "detray/navigation/intersection/ray_intersector.hpp"
+#include "detray/propagator/detail/jacobian_engine.hpp"
+#include "detray/tracks/tracks.hpp"
+#include "detray/utils/invalid_values.hpp"
+
+// System include(s)
+#include <array>
+#include <cstddef>
+
+namespace detray {
+
+namespace extrapolation {
+
+/// Configuration of the direct extrapolation
+template <typename scalar_t>
+struct config {
+    /// Largest remaining distance to the target surface at convergence
+    scalar_t path_tolerance{1.f * unit<scalar_t>::um};
+    /// Maximal number of field evaluations along the trajectory
+    unsigned int max_iterations{10u};
+    /// Tolerance on the edges of the target mask
+    scalar_t mask_tolerance{0.f};
+    /// Also extrapolate opposite to the track direction
+    bool allow_backward{false};
+};
+
+}  // namespace extrapolation
+
+/// @brief Extrapolates a track directly to a user defined surface.
+///
+/// Does not use the detector or the navigator: The track is moved onto the
+/// target surface (a mask and a placement that need not be part of a detector)
+/// by solving the intersection of the trajectory with the surface. This is
+/// meant for cases in which the intermediate surfaces do not matter, e.g. the
+/// extrapolation to the beamline or to the calorimeter face.
+///
+/// The intersection is first solved on the helix with the field at the start
+/// position and then again on the helix with the field in the middle of that
+/// arc. The track is moved along the second helix and the solution is refined
+/// from there, until the remaining distance to the surface is below the path
+/// tolerance. In a homogeneous field this converges after a single step, for
+/// tracks without bending the straight line is used. The transport jacobian
+/// is the product of the helix jacobians along the way.
+///
+/// The material can optionally be estimated from a lumped material model
+/// (see @c lumped_cylinder_material ). The material is only summed up: No
+/// energy loss or scattering is applied to the track.
+template <typename algebra_t>
+struct direct_extrapolator {
+
+    using algebra_type = algebra_t;
+    using scalar_type = dscalar<algebra_t>;
+    using point3_type = dpoint3D<algebra_t>;
+    using vector3_type = dvector3D<algebra_t>;
+    using transform3_type = dtransform3D<algebra_t>;
+    using matrix_operator = dmatrix_operator<algebra_t>;
+    using free_track_parameters_type = free_track_parameters<algebra_t>;
+    using bound_track_parameters_type = bound_track_parameters<algebra_t>;
+    using free_matrix_type = free_matrix<algebra_t>;
+    using bound_matrix_type = bound_matrix<algebra_t>;
+    using ray_type = detail::ray<algebra_t>;
+    using helix_type = detail::helix<algebra_t>;
+    using intersection_type = intersection2D<surface_descriptor<>, algebra_t>;
+    using material_type = lumped_cylinder_material<scalar_type>;
+    using config_type = extrapolation::config<scalar_type>;
+
+    /// Result of the extrapolation
+    struct result {
+        /// The track reached the target surface
+        bool success{false};
+        /// Number of field evaluations along the trajectory
+        unsigned int n_iterations{0u};
+        /// Path length to the target surface
+        scalar_type path_length{0.f};
+        /// Material that was crossed on the way (only with material model)
+        scalar_type path_in_X0{0.f};
+        scalar_type path_in_L0{0.f};
+        /// The free track parameters on the target surface
+        free_track_parameters_type free_params{};
+        /// The bound track parameters on the target surface (the surface has
+        /// no barcode, since it does not belong to a detector)
+        bound_track_parameters_type bound_params{};
+        /// Free transport jacobian from the start to the target
+        free_matrix_type free_jacobian =
+            matrix_operator().template identity<e_free_size, e_free_size>();
+        /// Bound to bound jacobian (only for bound input parameters)
+        bound_matrix_type full_jacobian =
+            matrix_operator().template identity<e_bound_size, e_bound_size>();
+    };
+
+    /// Extrapolate free track parameters to a target surface
+    ///
+    /// @param track the free input parameters and their covariance
+    /// @param mask the mask of the target surface
+    /// @param trf the placement of the target surface
+    /// @param field the magnetic field (view)
+    /// @param mat the lumped material model (optional)
+    /// @param cfg the extrapolation configuration
+    ///
+    /// @returns the parameters on the target surface and the jacobian
+    template <typename mask_t, typename field_t,
+              typename material_t = material_type>
+    DETRAY_HOST_DEVICE result operator()(
+        const free_track_parameters_type &track, const mask_t &mask,
+        const transform3_type &trf, const field_t &field,
+        const material_t *mat = nullptr, const config_type &cfg = {}) const {
+
+        using frame_t = typename mask_t::local_frame_type;
+        using jacobian_engine_t = detail::jacobian_engine<frame_t>;
+
+        result res = extrapolate(track, mask, trf, field, mat, cfg);
+        if (!res.success) {
+            return res;
+        }
+
+        const auto transport_to_bound = to_bound<frame_t>(res, trf, field);
+        res.bound_params.set_covariance(
+            jacobian_engine_t::template transport_covariance<e_free_size>(
+                transport_to_bound, track.covariance()));
+
+        return res;
+    }
+
+    /// Extrapolate bound track parameters to a target surface
+    ///
+    /// @param params the bound input parameters and their covariance
+    /// @param dep_mask the mask of the departure surface of @param params
+    /// @param dep_trf the placement of the departure surface
+    /// @param mask the mask of the target surface
+    /// @param trf the placement of the target surface
+    /// @param field the magnetic field (view)
+    /// @param mat the lumped material model (optional)
+    /// @param cfg the extrapolation configuration
+    ///
+    /// @returns the parameters on the target surface and the jacobian
+    template <typename departure_mask_t, typename mask_t, typename field_t,
+              typename material_t = material_type>
+    DETRAY_HOST_DEVICE result operator()(
+        const bound_track_parameters_type &params,
+        const departure_mask_t &dep_mask, const transform3_type &dep_trf,
+        const mask_t &mask, const transform3_type &trf, const field_t &field,
+        const material_t *mat = nullptr, const config_type &cfg = {}) const {
+
+        using dep_frame_t = typename departure_mask_t::local_frame_type;
+        using frame_t = typename mask_t::local_frame_type;
+        using jacobian_engine_t = detail::jacobian_engine<frame_t>;
+
+        const free_vector<algebra_t> free_vec =
+            detail::bound_to_free_vector(dep_trf, dep_mask, params.vector());
+        const free_track_parameters_type track{
+            free_vec,
+            matrix_operator().template zero<e_free_size, e_free_size>()};
+
+        result res = extrapolate(track, mask, trf, field, mat, cfg);
+        if (!res.success) {
+            return res;
+        }
+
+        const auto transport_to_bound = to_bound<frame_t>(res, trf, field);
+        const auto bound_to_free =
+            detail::jacobian_engine<dep_frame_t>::bound_to_free_jacobian(
+                dep_trf, params.vector(), free_vec);
+
+        res.full_jacobian =
+            jacobian_engine_t::full_jacobian(transport_to_bound, bound_to_free);
+        res.bound_params.set_covariance(
+            jacobian_engine_t::template transport_covariance<e_bound_size>(
+                res.full_jacobian, params.covariance()));
+
+        return res;
+    }
+
+    private:
+    /// Move the track onto the target surface
+    template <typename mask_t, typename field_t, typename material_t>
+    DETRAY_HOST_DEVICE result
+    extrapolate(const free_track_parameters_type &track, const mask_t &mask,
+                const transform3_type &trf, const field_t &field,
+                const material_t *mat, const config_type &cfg) const {
+        result res{};
+        res.free_params = track;
+
+        for (unsigned int i = 0u; i < cfg.max_iterations; ++i) {
+            const bool is_first{i == 0u};
+            const free_track_parameters_type &trk = res.free_params;
+            const vector3_type b_first = field_at(field, trk.pos());
+            ++res.n_iterations;
+
+            // No bending: The straight line solution is exact
+            if (getter::norm(b_first) * math::abs(trk.qop()) == 0.f) {
+                const ray_type r(trk);
+                const intersection_type sfi =
+                    select(intersect(r, mask, trf, cfg.mask_tolerance),
+                           is_first, cfg);
+                if (sfi.status != intersection::status::e_inside) {
+                    return res;
+                }
+                advance(res, r, sfi.path, mat, cfg);
+                res.success = true;
+                return res;
+            }
+
+            const helix_type hlx(trk, &b_first);
+            intersection_type sfi = select(
+                intersect(hlx, mask, trf, cfg.mask_tolerance), is_first, cfg);
+            if (sfi.status != intersection::status::e_inside) {
+                return res;
+            }
+            if (math::abs(sfi.path) < cfg.path_tolerance) {
+                res.success = true;
+                return res;
+            }
+
+            // Solve again with the field in the middle of the arc
+            vector3_type b_mid = field_at(field, hlx.pos(0.5f * sfi.path));
+            if (getter::norm(b_mid) == 0.f) {
+                b_mid = b_first;
+            }
+            const helix_type hlx_mid(trk, &b_mid);
+            sfi = select(intersect(hlx_mid, mask, trf, cfg.mask_tolerance),
+                         is_first, cfg);
+            if (sfi.status != intersection::status::e_inside) {
+                return res;
+            }
+            advance(res, hlx_mid, sfi.path, mat, cfg);
+        }
+
+        // Did not converge
+        return res;
+    }
+
+    /// Set the bound parameters on the target surface
+    ///
+    /// @returns the transport jacobian from the start to the bound frame
+    template <typename frame_t, typename field_t>
+    DETRAY_HOST_DEVICE auto to_bound(result &res, const transform3_type &trf,
+                                     const field_t &field) const {
+
+        using jacobian_engine_t = detail::jacobian_engine<frame_t>;
+
+        const free_track_parameters_type &trk = res.free_params;
+        const auto &free_vec = trk.vector();
+
+        res.bound_params.set_vector(
+            detail::free_to_bound_vector<frame_t>(trf, free_vec));
+
+        // Derivative of the direction on the target surface
+        const vector3_type dtds =
+            trk.qop() * vector::cross(trk.dir(), field_at(field, trk.pos()));
+
+        return jacobian_engine_t::free_to_bound_transport(
+            jacobian_engine_t::corrected_free_to_bound_jacobian(trf, free_vec,
+                                                                dtds, 0.f),
+            res.free_jacobian);
+    }
+
+    /// Move the track along the trajectory @param traj by the path length
+    /// @param s and update the jacobian and the material
+    template <typename trajectory_t, typename material_t>
+    DETRAY_HOST_DEVICE void advance(result &res, const trajectory_t &traj,
+                                    const scalar_type s, const material_t *mat,
+                                    const config_type &cfg) const {
+        if (mat != nullptr) {
+            collect_material(res, traj, s, *mat, cfg);
+        }
+
+        res.free_jacobian = jacobian(traj, s) * res.free_jacobian;
+        res.free_params.set_pos(traj.pos(s));
+        res.free_params.set_dir(traj.dir(s));
+        res.path_length += s;
+    }
+
+    /// Add the material of all layers of @param mat that the trajectory
+    /// @param traj crosses within the path length @param s
+    template <typename trajectory_t, typename material_t>
+    DETRAY_HOST_DEVICE void collect_material(result &res,
+                                             const trajectory_t &traj,
+                                             const scalar_type s,
+                                             const material_t &mat,
+                                             const config_type &cfg) const {
+
+        const transform3_type identity{};
+
+        for (std::size_t i = 0u; i < mat.size(); ++i) {
+            const auto &layer = mat[i];
+            const mask<cylinder2D> cyl{0u, layer.radius, -layer.half_length,
+                                       layer.half_length};
+
+            const auto crossings =
+                intersect(traj, cyl, identity, cfg.mask_tolerance);
+
+            for (const intersection_type &sfi : crossings) {
+                // Only crossings along the step (not the start point)
+                if (sfi.status != intersection::status::e_inside ||
+                    sfi.path * s <= 0.f || math::abs(sfi.path) > math::abs(s)) {
+                    continue;
+                }
+                const point3_type pos = traj.pos(sfi.path);
+                const vector3_type normal =
+                    vector::normalize(vector3_type{pos[0], pos[1], 0.f});
+                const scalar_type cos_inc{
+                    math::abs(vector::dot(normal, traj.dir(sfi.path)))};
+
+                res.path_in_X0 += layer.slab.path_segment_in_X0(cos_inc);
+                res.path_in_L0 += layer.slab.path_segment_in_L0(cos_inc);
+            }
+        }
+    }
+
+    /// @returns the valid intersection with the shortest path, forward only
+    /// on the first step, unless backward extrapolation is allowed
+    /// @{
+    DETRAY_HOST_DEVICE
+    static intersection_type select(const intersection_type &sfi,
+                                    const bool is_first,
+                                    const config_type &cfg) {
+        if (sfi.status != intersection::status::e_inside ||
+            (is_first && !cfg.allow_backward &&
+             sfi.path <= -cfg.path_tolerance)) {
+            return {};
+        }
+        return sfi;
+    }
+
+    template <std::size_t N>
+    DETRAY_HOST_DEVICE static intersection_type select(
+        const std::array<intersection_type, N> &sfis, const bool is_first,
+        const config_type &cfg) {
+
+        intersection_type closest{};
+        for (const intersection_type &sfi : sfis) {
+            const intersection_type cand = select(sfi, is_first, cfg);
+            if (cand.status == intersection::status::e_inside &&
+                (closest.status != intersection::status::e_inside ||
+                 math::abs(cand.path) < math::abs(closest.path))) {
+                closest = cand;
+            }
+        }
+        return closest;
+    }
+    /// @}
+
+    /// Intersect the trajectory with the surface described by @param mask
+    /// and @param trf
+    /// @{
+    template <typename mask_t>
+    DETRAY_HOST_DEVICE static auto intersect(const helix_type &h,
+                                             const mask_t &mask,
+                                             const transform3_type &trf,
+                                             const scalar_type mask_tol) {
+        return as_array(
+            helix_intersector<typename mask_t::shape, algebra_t>{}(
+                h, surface_descriptor<>{}, mask, trf, mask_tol));
+    }
+
+    template <typename mask_t>
+    DETRAY_HOST_DEVICE static auto intersect(const ray_type &r,
+                                             const mask_t &mask,
+                                             const transform3_type &trf,
+                                             const scalar_type mask_tol) {
+        // Accept any path: The direction is checked in 'select'
+        return as_array(ray_intersector<typename mask_t::shape, algebra_t>{}(
+            r, surface_descriptor<>{}, mask, trf, mask_tol,
+            -detail::invalid_value<scalar_type>()));
+    }
+    /// @}
+
+    /// Wrap a single intersection in an array
+    /// @{
+    DETRAY_HOST_DEVICE
+    static std::array<intersection_type, 1> as_array(
+        const intersection_type &sfi) {
+        return {sfi};
+    }
+
+    template <std::size_t N>
+    DETRAY_HOST_DEVICE static std::array<intersection_type, N> as_array(
+        const std::array<intersection_type, N> &sfis) {
+        return sfis;
+    }
+    /// @}
+
+    /// @returns the transport jacobian along the trajectory
+    /// @{
+    DETRAY_HOST_DEVICE
+    static free_matrix_type jacobian(const helix_type &h, const scalar_type s) {
+        return h.jacobian(s);
+    }
+
+    DETRAY_HOST_DEVICE
+    static free_matrix_type jacobian(const ray_type &, const scalar_type s) {
+        free_matrix_type jac =
+            matrix_operator().template identity<e_free_size, e_free_size>();
+        for (unsigned int i = 0u; i < 3u; ++i) {
+            matrix_operator().element(jac, e_free_pos0 + i, e_free_dir0 + i) =
+                s;
+        }
+        return jac;
+    }
+    /// @}
+
+    /// @returns the field at the position @param pos
+    template <typename field_t>
+    DETRAY_HOST_DEVICE static vector3_type field_at(const field_t &field,
+                                                    const point3_type &pos) {
+        const auto bvec = field.at(pos[0], pos[1], pos[2]);
+        return {bvec[0u], bvec[1u], bvec[2u]};
+    }
+};
+
+}  // namespace detray
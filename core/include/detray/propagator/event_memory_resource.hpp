@@ -0,0 +1,181 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Vecmem include(s)
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace detray::propagation {
+
+/// @brief Event-scoped memory resource for the host propagation buffers.
+///
+/// Hands out memory from a few large slabs by bumping a pointer, instead of
+/// going to the upstream resource for every navigation candidate vector and
+/// every per-track output. Deallocation is free: Only the most recent
+/// allocation is given back (e.g. the candidates of a track that was
+/// propagated on its own, which lets the next track reuse the same memory),
+/// everything else is released in bulk with @c reset at the end of the event.
+/// The slabs are kept for the next event, so that a steady state needs no
+/// upstream allocations at all.
+///
+/// @note Allocations are serialized by a mutex, so that the resource can be
+/// shared by the worker threads of a @c parallel_executor . Since the buffers
+/// of a track are only (re)allocated when they grow, this is rarely
+/// contended.
+class event_memory_resource final : public vecmem::memory_resource {
+
+    public:
+    /// Default size of a slab: 1 MiB
+    static constexpr std::size_t default_slab_size{1u << 20u};
+
+    /// Construct from the @param upstream resource, from which slabs of
+    /// @param slab_size bytes are allocated
+    explicit event_memory_resource(vecmem::memory_resource &upstream,
+                                   std::size_t slab_size = default_slab_size)
+        : m_upstream{&upstream}, m_slab_size{std::max(slab_size, k_align)} {}
+
+    /// No copies of the slabs
+    /// @{
+    event_memory_resource(const event_memory_resource &) = delete;
+    event_memory_resource &operator=(const event_memory_resource &) = delete;
+    /// @}
+
+    /// Return the slabs to the upstream resource
+    ~event_memory_resource() override { release(); }
+
+    /// Free all allocations of the event at once, but keep the slabs
+    void reset() {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        m_current = 0u;
+        m_top = 0u;
+    }
+
+    /// Free all allocations and return the slabs to the upstream resource
+    void release() {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        for (const slab &s : m_slabs) {
+            m_upstream->deallocate(s.data, s.size, k_align);
+        }
+        m_slabs.clear();
+        m_current = 0u;
+        m_top = 0u;
+    }
+
+    /// @returns the number of slabs that were taken from upstream
+    std::size_t n_slabs() const {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        return m_slabs.size();
+    }
+
+    /// @returns the total capacity of the slabs in bytes
+    std::size_t capacity() const {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        std::size_t cap{0u};
+        for (const slab &s : m_slabs) {
+            cap += s.size;
+        }
+        return cap;
+    }
+
+    private:
+    /// Alignment of the slabs
+    static constexpr std::size_t k_align{alignof(std::max_align_t)};
+
+    /// Memory block from the upstream resource
+    struct slab {
+        std::byte *data{nullptr};
+        std::size_t size{0u};
+    };
+
+    /// @returns the offset of the first address at or after @param top in
+    /// slab @param s with the given @param alignment
+    static std::size_t aligned_offset(const slab &s, const std::size_t top,
+                                      const std::size_t alignment) {
+        const auto addr{reinterpret_cast<std::uintptr_t>(s.data) + top};
+        const auto aligned{(addr + alignment - 1u) & ~(alignment - 1u)};
+
+        return top + static_cast<std::size_t>(aligned - addr);
+    }
+
+    /// Bump allocation
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+
+        bytes = std::max(bytes, std::size_t{1u});
+        alignment = std::max(alignment, std::size_t{1u});
+
+        // Try the current slab first, then the slabs that are left from
+        // previous events
+        for (; m_current < m_slabs.size(); ++m_current, m_top = 0u) {
+            const slab &s = m_slabs[m_current];
+            const std::size_t offset{aligned_offset(s, m_top, alignment)};
+            if (offset + bytes <= s.size) {
+                m_top = offset + bytes;
+                return s.data + offset;
+            }
+        }
+
+        // New slab, large enough for oversized allocations
+        slab s{};
+        s.size = std::max(m_slab_size, bytes + alignment);
+        s.data = static_cast<std::byte *>(m_upstream->allocate(s.size, k_align));
+        m_slabs.push_back(s);
+
+        m_current = m_slabs.size() - 1u;
+        const std::size_t offset{aligned_offset(s, 0u, alignment)};
+        m_top = offset + bytes;
+
+        return s.data + offset;
+    }
+
+    /// Only the latest allocation is given back
+    void do_deallocate(void *p, std::size_t bytes,
+                       std::size_t /*alignment*/) override {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_current >= m_slabs.size()) {
+            return;
+        }
+        bytes = std::max(bytes, std::size_t{1u});
+
+        const slab &s = m_slabs[m_current];
+        const auto *ptr = static_cast<std::byte *>(p);
+        if (ptr >= s.data and ptr + bytes == s.data + m_top) {
+            m_top = static_cast<std::size_t>(ptr - s.data);
+        }
+    }
+
+    /// Memory can only be deallocated by the same resource
+    bool do_is_equal(const vecmem::memory_resource &other) const
+        noexcept override {
+        return this == &other;
+    }
+
+    /// Where the slabs come from
+    vecmem::memory_resource *m_upstream{nullptr};
+    /// Size of a regular slab
+    std::size_t m_slab_size{default_slab_size};
+    /// The slabs of the resource
+    std::vector<slab> m_slabs{};
+    /// Slab that is currently allocated from
+    std::size_t m_current{0u};
+    /// Bytes in use in the current slab
+    std::size_t m_top{0u};
+    /// Serialize the allocations from multiple threads
+    mutable std::mutex m_mutex{};
+};
+
+}  // namespace detray::propagation
@@ -0,0 +1,210 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/geometry/detector_volume.hpp"
+#include "detray/navigation/detail/helix.hpp"
+#include "detray/navigation/policies.hpp"
+#include "detray/propagator/base_stepper.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/tracks/tracks.hpp"
+
+namespace detray {
+
+/// Stepper that advances the track analytically along a helix.
+///
+/// The field is evaluated at the start and at the predicted end point of a
+/// step. If the field is constant to within the RK error tolerance over the
+/// step and the track does not pass through volume material, the track and
+/// the transport jacobian are taken from the analytical solution. Otherwise,
+/// the step is done by the Runge-Kutta-Nystrom stepper.
+///
+/// @tparam magnetic_field_t the type of magnetic field
+/// @tparam algebra_t the algebra plugin
+/// @tparam constraint_t the type of constraints on the stepper
+/// @tparam policy_t the navigation policy of the stepper
+/// @tparam inspector_t stepping inspector type
+template <typename magnetic_field_t, typename algebra_t,
+          typename constraint_t = unconstrained_step,
+          typename policy_t = stepper_rk_policy,
+          typename inspector_t = stepping::void_inspector,
+          template <typename, std::size_t> class array_t = darray>
+class helix_stepper final
+    : public base_stepper<algebra_t, constraint_t, policy_t, inspector_t> {
+
+    /// Fallback for inhomogeneous fields and material
+    using rk_stepper_type = rk_stepper<magnetic_field_t, algebra_t,
+                                       constraint_t, policy_t, inspector_t,
+                                       array_t>;
+
+    public:
+    using base_type =
+        base_stepper<algebra_t, constraint_t, policy_t, inspector_t>;
+
+    using algebra_type = algebra_t;
+    using scalar_type = dscalar<algebra_t>;
+    using point3_type = dpoint3D<algebra_t>;
+    using vector3_type = dvector3D<algebra_t>;
+    using transform3_type = dtransform3D<algebra_t>;
+    using matrix_operator = dmatrix_operator<algebra_t>;
+    using free_track_parameters_type =
+        typename base_type::free_track_parameters_type;
+    using bound_track_parameters_type =
+        typename base_type::bound_track_parameters_type;
+    using magnetic_field_type = magnetic_field_t;
+
+    DETRAY_HOST_DEVICE
+    helix_stepper() {}
+
+    struct state : public rk_stepper_type::state {
+
+        using rk_state_type = typename rk_stepper_type::state;
+
+        DETRAY_HOST_DEVICE
+        state(const free_track_parameters_type& t,
+              const magnetic_field_t& mag_field)
+            : rk_state_type(t, mag_field) {}
+
+        template <typename detector_t>
+        DETRAY_HOST_DEVICE state(
+            const bound_track_parameters_type& bound_params,
+            const magnetic_field_t& mag_field, const detector_t& det)
+            : rk_state_type(bound_params, mag_field, det) {}
+
+        /// Whether the last step was done analytically
+        bool _is_helix_step{false};
+
+        /// Number of analytical steps
+        unsigned int _n_helix_steps{0u};
+
+        /// Number of Runge-Kutta steps
+        unsigned int _n_rk_steps{0u};
+    };
+
+    /// Take a step, either along a helix or using the Runge-Kutta algorithm.
+    ///
+    /// @return returning the heartbeat, indicating if the stepping is alive
+    template <typename propagation_state_t>
+    DETRAY_HOST_DEVICE bool step(
+        propagation_state_t& propagation,
+        const stepping::config<scalar_type>& cfg = {}) const {
+
+        // Get stepper and navigator states
+        state& stepping = propagation._stepping;
+        auto& navigation = propagation._navigation;
+
+        const free_track_parameters_type& track = stepping();
+        const point3_type pos = track.pos();
+
+        // The helix is the exact solution, the step size only depends on the
+        // distance to the next surface and the constraints
+        scalar_type h{navigation()};
+        const step::direction step_dir = h >= 0.f
+                                             ? step::direction::e_forward
+                                             : step::direction::e_backward;
+        stepping.set_direction(step_dir);
+        if (math::abs(h) > math::abs(stepping.constraints().template size<>(
+                               stepping.direction()))) {
+            h = stepping.constraints().template size<>(stepping.direction());
+        }
+
+        const auto vol =
+            detector_volume{*navigation.detector(), navigation.volume()};
+
+        const vector3_type b_first = stepping.evaluate_field(pos);
+        const scalar_type qop{track.qop()};
+
+        // No helix in empty space or for tracks with energy loss
+        bool is_helix{not vol.has_material() and
+                      getter::norm(b_first) * math::abs(qop) > 0.f};
+
+        if (is_helix) {
+            const detail::helix<algebra_t> hlx(track, &b_first);
+
+            // The position error of the helix is about (qop * dB * h^2)/4
+            // for a linearly changing field
+            const point3_type end_pos = hlx(h);
+            const vector3_type b_last = stepping.evaluate_field(end_pos);
+            const scalar_type pos_error{0.25f * math::abs(qop) * h * h *
+                                        getter::norm(b_last - b_first)};
+
+            is_helix = pos_error <= cfg.rk_error_tol;
+
+            if (is_helix) {
+                advance(stepping, hlx, h, b_first, b_last, cfg);
+            }
+        }
+
+        if (not is_helix) {
+            // The RK step size control has to restart after a helix step
+            if (stepping._is_helix_step) {
+                stepping._initialized = true;
+            }
+            stepping._is_helix_step = false;
+            ++stepping._n_rk_steps;
+
+            return rk_stepper_type{}.step(propagation, cfg);
+        }
+
+        stepping._is_helix_step = true;
+        stepping._initialized = false;
+        ++stepping._n_helix_steps;
+
+        // Call navigation update policy
+        typename helix_stepper::policy_type{}(stepping.policy_state(),
+                                              propagation);
+
+        // Run final inspection
+        stepping.run_inspector(cfg, "Step complete: ");
+
+        return true;
+    }
+
+    private:
+    /// Advance the track and the transport jacobian along the helix @param hlx
+    /// by the path length @param h
+    DETRAY_HOST_DEVICE
+    inline void advance(state& stepping, const detail::helix<algebra_t>& hlx,
+                        const scalar_type h, const vector3_type& b_first,
+                        const vector3_type& b_last,
+                        const stepping::config<scalar_type>& cfg) const {
+
+        auto& track = stepping._track;
+
+        track.set_pos(hlx.pos(h));
+        track.set_dir(hlx.dir(h));
+
+        stepping._mat = nullptr;
+        stepping._step_size = h;
+        stepping._prev_step_size = h;
+
+        // Derivatives at the end point for the parameter transport
+        auto& sd = stepping._step_data;
+        sd.b_first = b_first;
+        sd.b_middle = b_first;
+        sd.b_last = b_last;
+        sd.dtds[3u] = track.qop() * vector::cross(track.dir(), b_first);
+        sd.dqopds[3u] = 0.f;
+
+        if (cfg.do_covariance_transport &&
+            stepping.do_covariance_transport()) {
+            stepping._jac_transport =
+                hlx.jacobian(h) * stepping._jac_transport;
+        }
+
+        // Update path length
+        stepping._path_length += h;
+        stepping._abs_path_length += math::abs(h);
+        stepping._s += h;
+    }
+};
+
+}  // namespace detray
@@ -132,7 +132,9 @@ class line_stepper final
         stepping.advance_track();
 
         // Advance jacobian transport
-        stepping.advance_jacobian();
+        if (stepping.do_covariance_transport()) {
+            stepping.advance_jacobian();
+        }
 
         // Call navigation update policy
         typename line_stepper::policy_type{}(stepping.policy_state(),
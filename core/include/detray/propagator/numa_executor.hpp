@@ -0,0 +1,140 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/core/detector_replicas.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/utils/numa.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace detray::propagation {
+
+/// Executor that takes chunks of tracks from a counter, which is shared with
+/// other executors (e.g. the workers on the different NUMA nodes)
+struct shared_queue_executor {
+
+    /// Next track that has not been started
+    std::atomic<unsigned int> *next_track{nullptr};
+
+    /// Number of tracks that are taken at once
+    unsigned int chunk_size{8u};
+
+    /// Call @param func for the track indices taken from the counter, until
+    /// all @param n_tracks are started
+    template <typename function_t>
+    DETRAY_HOST void operator()(const unsigned int n_tracks,
+                                function_t &&func) const {
+        const unsigned int chunk{std::max(1u, chunk_size)};
+
+        for (unsigned int begin = next_track->fetch_add(chunk);
+             begin < n_tracks; begin = next_track->fetch_add(chunk)) {
+
+            const unsigned int end{std::min(begin + chunk, n_tracks)};
+            for (unsigned int i = begin; i < end; ++i) {
+                func(i);
+            }
+        }
+    }
+};
+
+/// Configuration of the host propagation on several NUMA nodes
+struct numa_executor {
+
+    /// Number of worker threads per node (all CPUs of the node, if zero)
+    unsigned int threads_per_node{0u};
+
+    /// Number of tracks that a worker takes at once
+    unsigned int chunk_size{8u};
+};
+
+/// @brief Propagate a batch of tracks on all NUMA nodes of the host, with
+/// the detector data local to every node.
+///
+/// The worker threads of a node are bound to its CPUs and navigate the
+/// replica of the detector on that node (see @c detector_replicas ), as well
+/// as the magnetic field of that node. All workers take their tracks from a
+/// shared counter, like the @c parallel_executor , so that the batch is
+/// balanced between the nodes. The results are written in the input order
+/// of the tracks.
+///
+/// @tparam propagator_t propagator type with a detector of device container
+///                      types, which can be constructed from a replica view
+///
+/// @param p the propagator
+/// @param replicas the detector replicas, one per node
+/// @param tracks the initial track parameters
+/// @param results the outcomes, at least one per track
+/// @param exec the number of workers per node and their chunk size
+/// @param actor_states the initial actor states of every track
+/// @param fields the magnetic field (view) of every node, e.g. made with
+///               @c numa::replicate
+template <typename propagator_t, typename detector_t, typename track_range_t,
+          typename result_range_t, typename field_range_t>
+DETRAY_HOST void propagate_batch_replicated(
+    const propagator_t &p, detector_replicas<detector_t> &replicas,
+    const track_range_t &tracks, result_range_t &results,
+    const numa_executor &exec,
+    const typename propagator_t::actor_chain_type::state_tuple &actor_states,
+    const field_range_t &fields) {
+
+    using replica_detector_t = typename propagator_t::detector_type;
+
+    static_assert(std::is_same_v<typename replica_detector_t::view_type,
+                                 typename detector_t::view_type>,
+                  "Propagator does not match the detector replicas");
+
+    assert(fields.size() >= replicas.size());
+
+    const auto n_nodes{static_cast<unsigned int>(replicas.size())};
+
+    // Views of the replicas, assembled once
+    std::vector<typename detector_t::view_type> views{};
+    views.reserve(n_nodes);
+    for (unsigned int node = 0u; node < n_nodes; ++node) {
+        views.push_back(replicas.get_data(node));
+    }
+
+    std::atomic<unsigned int> next_track{0u};
+    const shared_queue_executor queue{&next_track, exec.chunk_size};
+
+    auto worker = [&](const unsigned int node) {
+        numa::bind_thread(node);
+
+        const replica_detector_t det(views[node]);
+
+        propagator_t worker_p{p};
+        worker_p.propagate_batch(tracks, results, queue, actor_states,
+                                 fields[node], det);
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned int node = 0u; node < n_nodes; ++node) {
+        const auto n_cpus{
+            static_cast<unsigned int>(numa::node_cpus(node).size())};
+        const unsigned int n_workers{std::max(
+            1u, exec.threads_per_node > 0u ? exec.threads_per_node : n_cpus)};
+
+        for (unsigned int t = 0u; t < n_workers; ++t) {
+            threads.emplace_back(worker, node);
+        }
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+}
+
+}  // namespace detray::propagation
@@ -0,0 +1,77 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/detail/qualifiers.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace detray::propagation {
+
+/// Host executor that propagates the tracks of a batch on multiple threads.
+///
+/// The tracks are handed out in chunks from a shared, atomic track counter:
+/// A worker thread that is done with its chunk takes the next one, so that
+/// expensive tracks (e.g. loopers) do not stall the other threads as with a
+/// static partitioning of the batch. The propagation state of a track lives
+/// on the stack of the worker thread that handles it, while the detector and
+/// the field are shared read-only between all threads.
+struct parallel_executor {
+
+    /// Number of worker threads (including the calling thread)
+    unsigned int n_threads{std::max(1u, std::thread::hardware_concurrency())};
+
+    /// Number of tracks that a worker takes at once
+    unsigned int chunk_size{8u};
+
+    /// Call @param func for every track index in [0, @param n_tracks) and
+    /// return once all tracks are done
+    template <typename function_t>
+    DETRAY_HOST void operator()(const unsigned int n_tracks,
+                                function_t &&func) const {
+
+        const unsigned int chunk{std::max(1u, chunk_size)};
+        const unsigned int n_chunks{(n_tracks + chunk - 1u) / chunk};
+        const unsigned int n_workers{
+            std::min(std::max(1u, n_threads), n_chunks)};
+
+        // Next track that has not been started
+        std::atomic<unsigned int> next_track{0u};
+
+        auto worker = [&]() {
+            for (unsigned int begin = next_track.fetch_add(chunk);
+                 begin < n_tracks; begin = next_track.fetch_add(chunk)) {
+
+                const unsigned int end{std::min(begin + chunk, n_tracks)};
+                for (unsigned int i = begin; i < end; ++i) {
+                    func(i);
+                }
+            }
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(n_workers);
+        for (unsigned int t = 1u; t < n_workers; ++t) {
+            threads.emplace_back(worker);
+        }
+
+        // The calling thread works as well
+        worker();
+
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    }
+};
+
+}  // namespace detray::propagation
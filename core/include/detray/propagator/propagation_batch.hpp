@@ -0,0 +1,86 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/tracks/tracks.hpp"
+
+namespace detray::propagation {
+
+/// Compact outcome of the propagation of a single track in a batch
+template <typename algebra_t>
+struct result {
+    /// Track parameters at the end of the propagation
+    free_track_parameters<algebra_t> params{};
+    /// Total (signed) path length
+    dscalar<algebra_t> path_length{0.f};
+    /// Final status of the navigation
+    navigation::status status{navigation::status::e_unknown};
+    /// Whether the navigation exited the detector successfully
+    bool success{false};
+};
+
+/// Executor that propagates the tracks of a batch one after the other
+struct sequential_executor {
+
+    /// Call @param func for every track index in [0, @param n_tracks)
+    template <typename function_t>
+    DETRAY_HOST_DEVICE void operator()(const unsigned int n_tracks,
+                                       function_t &&func) const {
+        for (unsigned int i = 0u; i < n_tracks; ++i) {
+            func(i);
+        }
+    }
+};
+
+/// Executor that propagates a single track of a batch, e.g. the track that
+/// belongs to a device thread
+struct single_track_executor {
+
+    /// Index of the track that should be propagated
+    unsigned int index{0u};
+
+    /// Call @param func for the track index, if it is in [0, @param n_tracks)
+    template <typename function_t>
+    DETRAY_HOST_DEVICE void operator()(const unsigned int n_tracks,
+                                       function_t &&func) const {
+        if (index < n_tracks) {
+            func(index);
+        }
+    }
+};
+
+/// Executor that hands the tracks of a batch to an underlying executor in a
+/// given order (e.g. the @c spatial_order of the tracks)
+///
+/// The i-th call of the underlying executor is forwarded to the track with
+/// the index @c order[i] . Since the results are indexed by the track, they
+/// stay in the input order of the batch.
+template <typename executor_t>
+struct ordered_executor {
+
+    /// The executor that distributes the calls
+    executor_t exec{};
+    /// Track index for every call (identity, if null)
+    const unsigned int *order{nullptr};
+
+    /// Call @param func for the track indices in the given order
+    template <typename function_t>
+    DETRAY_HOST_DEVICE void operator()(const unsigned int n_tracks,
+                                       function_t &&func) const {
+        const unsigned int *const trk_order{order};
+        exec(n_tracks, [&func, trk_order](const unsigned int i) {
+            func(trk_order != nullptr ? trk_order[i] : i);
+        });
+    }
+};
+
+}  // namespace detray::propagation
@@ -0,0 +1,135 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <cstdint>
+
+#if !defined(__CUDA_ARCH__) && !defined(__HIP_DEVICE_COMPILE__) && \
+    !defined(__SYCL_DEVICE_ONLY__)
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+#endif
+
+namespace detray::propagation {
+
+/// Phases of the propagation that can be timed
+enum class phase : std::uint_least8_t {
+    e_navigation = 0u,
+    e_stepping = 1u,
+    e_actors = 2u,
+};
+
+/// @brief Propagation timer that does not record anything (default).
+///
+/// All calls are empty and are removed by the compiler.
+struct void_timer {
+
+    using tick_type = std::uint64_t;
+
+    DETRAY_HOST_DEVICE
+    static constexpr tick_type now() { return 0u; }
+
+    DETRAY_HOST_DEVICE
+    constexpr void add(const phase, const tick_type) const { /*Do nothing*/ }
+};
+
+/// @brief Accumulates the clock ticks that the propagation spends in the
+/// navigation, the stepping and the actors.
+///
+/// The ticks are read from the time stamp counter on x86 hosts ('rdtsc') and
+/// from the streaming multiprocessor clock ('clock64') on CUDA and HIP
+/// devices. Other hosts fall back to the steady clock in nanoseconds. The
+/// SYCL device code has no portable clock, so that nothing is recorded there.
+///
+/// @note The ticks are not comparable between host and device, and the time
+/// stamp counter runs at a constant rate that can differ from the core clock.
+struct phase_timer {
+
+    using tick_type = std::uint64_t;
+
+    static constexpr std::size_t n_phases{3u};
+
+    /// @returns the current value of the clock
+    DETRAY_HOST_DEVICE
+    static inline tick_type now() {
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+        return static_cast<tick_type>(clock64());
+#elif defined(__SYCL_DEVICE_ONLY__)
+        return 0u;
+#elif defined(__x86_64__) || defined(__i386__)
+        return static_cast<tick_type>(__rdtsc());
+#else
+        return static_cast<tick_type>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch())
+                .count());
+#endif
+    }
+
+    /// Add the ticks since @param start to the phase @param p
+    DETRAY_HOST_DEVICE
+    inline void add(const phase p, const tick_type start) {
+        const auto i{static_cast<std::size_t>(p)};
+        m_ticks[i] += now() - start;
+        ++m_calls[i];
+    }
+
+    /// @returns the accumulated ticks of the phase @param p
+    DETRAY_HOST_DEVICE
+    constexpr tick_type ticks(const phase p) const {
+        return m_ticks[static_cast<std::size_t>(p)];
+    }
+
+    /// @returns the number of timed calls of the phase @param p
+    DETRAY_HOST_DEVICE
+    constexpr std::size_t calls(const phase p) const {
+        return m_calls[static_cast<std::size_t>(p)];
+    }
+
+    /// @returns the accumulated ticks of all phases
+    DETRAY_HOST_DEVICE
+    constexpr tick_type total() const {
+        return m_ticks[0] + m_ticks[1] + m_ticks[2];
+    }
+
+    /// Add the ticks of another timer @param other (e.g. of another track)
+    DETRAY_HOST_DEVICE
+    constexpr phase_timer &operator+=(const phase_timer &other) {
+        for (std::size_t i = 0u; i < n_phases; ++i) {
+            m_ticks[i] += other.m_ticks[i];
+            m_calls[i] += other.m_calls[i];
+        }
+        return *this;
+    }
+
+    /// Reset the timer
+    DETRAY_HOST_DEVICE
+    constexpr void reset() {
+        for (std::size_t i = 0u; i < n_phases; ++i) {
+            m_ticks[i] = 0u;
+            m_calls[i] = 0u;
+        }
+    }
+
+    private:
+    /// Accumulated ticks per phase
+    darray<tick_type, n_phases> m_ticks{};
+    /// Number of timed calls per phase
+    darray<std::size_t, n_phases> m_calls{};
+};
+
+}  // namespace detray::propagation
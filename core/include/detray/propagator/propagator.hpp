@@ -13,21 +13,72 @@
 #include "detray/navigation/intersection/intersection.hpp"
 #include "detray/navigation/navigator.hpp"
 #include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/actors/step_recorder.hpp"
 #include "detray/propagator/base_stepper.hpp"
+#include "detray/propagator/event_memory_resource.hpp"
+#include "detray/propagator/propagation_batch.hpp"
 #include "detray/propagator/propagation_config.hpp"
+#include "detray/propagator/propagation_timer.hpp"
 #include "detray/tracks/tracks.hpp"
 
 // System include(s).
-#include <iomanip>
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <type_traits>
+#include <vector>
 
 namespace detray {
 
+namespace propagation {
+
+/// A void inpector that does nothing.
+///
+/// Inspectors can be plugged in to understand the current propagation state.
+struct void_inspector {
+    template <typename state_t>
+    DETRAY_HOST_DEVICE constexpr void operator()(
+        const state_t & /*ignored*/) {}
+};
+
+/// Predicate for @c propagator::propagate_until : The track reached a
+/// sensitive surface (e.g. a measurement surface)
+struct on_sensitive {
+    template <typename state_t>
+    DETRAY_HOST_DEVICE constexpr bool operator()(
+        const state_t &propagation) const {
+        return propagation._navigation.is_on_sensitive();
+    }
+};
+
+/// Predicate for @c propagator::propagate_until : The track reached any
+/// surface or portal
+struct on_surface {
+    template <typename state_t>
+    DETRAY_HOST_DEVICE constexpr bool operator()(
+        const state_t &propagation) const {
+        return propagation._navigation.is_on_module() ||
+               propagation._navigation.is_on_portal();
+    }
+};
+
+}  // namespace propagation
+
 /// Templated propagator class, using a stepper and a navigator object in
 /// succession.
 ///
 /// @tparam stepper_t for the transport
 /// @tparam navigator_t for the navigation
-template <typename stepper_t, typename navigator_t, typename actor_chain_t>
+/// @tparam actor_chain_t the actors that are run after every step
+/// @tparam timer_t accumulates the time spent in the navigation, stepping
+///                 and actors per track (e.g. @c propagation::phase_timer ),
+///                 no timing by default
+/// @tparam inspector_t is called after every step to record the state of the
+///                     propagation for debugging (e.g.
+///                     @c propagation::print_inspector ), nothing by default
+template <typename stepper_t, typename navigator_t, typename actor_chain_t,
+          typename timer_t = propagation::void_timer,
+          typename inspector_t = propagation::void_inspector>
 struct propagator {
 
     using stepper_type = stepper_t;
@@ -35,6 +86,8 @@ struct propagator {
     using intersection_type = typename navigator_type::intersection_type;
     using detector_type = typename navigator_type::detector_type;
     using actor_chain_type = actor_chain_t;
+    using timer_type = timer_t;
+    using inspector_type = inspector_t;
     using algebra_type = typename stepper_t::algebra_type;
     using scalar_type = dscalar<algebra_type>;
     using free_track_parameters_type =
@@ -118,11 +171,10 @@ struct propagator {
 
         typename stepper_t::state _stepping;
         typename navigator_t::state _navigation;
-
-        bool do_debug = false;
-#if defined(__NO_DEVICE__)
-        std::stringstream debug_stream{};
-#endif
+        // Time spent in the propagation phases
+        timer_t _timer{};
+        // Records the propagation flow (debugging)
+        inspector_t _inspector{};
     };
 
     /// Propagate method: Coordinates the calls of the stepper, navigator and
@@ -139,45 +191,145 @@ struct propagator {
     DETRAY_HOST_DEVICE bool propagate(state_t &propagation,
                                       actor_states_t &&actor_states = {}) {
 
+        propagate_init(propagation, actor_states);
+        propagate_steps(propagation, actor_states);
+
+        // Pass on the whether the propagation was successful
+        return propagation._navigation.is_complete();
+    }
+
+    /// Initialize the propagation, so that it can be run step-wise by
+    /// @c propagate_steps
+    ///
+    /// @param propagation the state of a propagation flow
+    /// @param actor_states the actor state
+    ///
+    /// @return whether the propagation is alive
+    template <typename state_t, typename actor_states_t = actor_chain<>::state>
+    DETRAY_HOST_DEVICE bool propagate_init(state_t &propagation,
+                                           actor_states_t &&actor_states = {}) {
+
         // Initialize the navigation
+        const auto start{timer_t::now()};
         propagation._heartbeat =
             m_navigator.init(propagation, m_cfg.navigation);
+        propagation._timer.add(propagation::phase::e_navigation, start);
 
         // Run all registered actors/aborters after init
-        run_actors(actor_states, propagation);
+        actor_stage(propagation, actor_states);
 
-        // Find next candidate
-        propagation._heartbeat &=
-            m_navigator.update(propagation, m_cfg.navigation);
+        return propagation._heartbeat;
+    }
+
+    /// Continue an initialized propagation for at most @param max_steps steps.
+    /// This allows to interrupt the propagation of a batch of tracks, e.g. to
+    /// remove finished tracks and regroup the live ones.
+    ///
+    /// @param propagation the state of a propagation flow
+    /// @param actor_states the actor state
+    ///
+    /// @return whether the propagation is still alive
+    template <typename state_t, typename actor_states_t = actor_chain<>::state>
+    DETRAY_HOST_DEVICE bool propagate_steps(
+        state_t &propagation, actor_states_t &&actor_states = {},
+        const unsigned int max_steps =
+            std::numeric_limits<unsigned int>::max()) {
 
         // Run while there is a heartbeat
-        while (propagation._heartbeat) {
+        for (unsigned int i = 0u; i < max_steps && propagation._heartbeat;
+             ++i) {
 
             // Take the step
-            propagation._heartbeat &=
-                m_stepper.step(propagation, m_cfg.stepping);
+            step_stage(propagation);
 
             // Find next candidate
-            propagation._heartbeat &=
-                m_navigator.update(propagation, m_cfg.navigation);
+            navigation_stage(propagation);
 
-            // Run all registered actors/aborters after update
-            run_actors(actor_states, propagation);
+            // Run all registered actors/aborters after update and check the
+            // status
+            actor_stage(propagation, actor_states);
 
-            // And check the status
-            propagation._heartbeat &=
-                m_navigator.update(propagation, m_cfg.navigation);
+            run_inspector(propagation);
+        }
 
-#if defined(__NO_DEVICE__)
-            if (propagation.do_debug) {
-                inspect(propagation);
+        return propagation._heartbeat;
+    }
+
+    /// Continue an initialized propagation until @param pred is fulfilled
+    /// after a step, e.g. when the track reached a measurement surface.
+    ///
+    /// The propagation state is left intact, so that e.g. the track parameters
+    /// on the surface can be updated by a fitter, before the propagation is
+    /// resumed by another call. At least one step is taken per call, so that a
+    /// propagation that was suspended on a surface moves on.
+    ///
+    /// @tparam predicate_t callable on the propagation state (e.g.
+    ///                     @c propagation::on_sensitive )
+    ///
+    /// @param propagation the state of a propagation flow
+    /// @param actor_states the actor state
+    ///
+    /// @return whether the propagation is still alive (is suspended)
+    template <typename state_t, typename predicate_t,
+              typename actor_states_t = actor_chain<>::state>
+    DETRAY_HOST_DEVICE bool propagate_until(
+        state_t &propagation, const predicate_t &pred,
+        actor_states_t &&actor_states = {}) {
+
+        while (propagate_steps(propagation, actor_states, 1u)) {
+            if (pred(propagation)) {
+                break;
             }
-#endif
         }
 
-        // Pass on the whether the propagation was successful
-        return propagation._navigation.is_complete();
+        return propagation._heartbeat;
+    }
+
+    /// @name Stages of a propagation step
+    ///
+    /// A step of @c propagate_steps is equivalent to calling the stages in the
+    /// order @c step_stage , @c navigation_stage and @c actor_stage . This
+    /// allows to schedule the stages separately, e.g. as individual device
+    /// kernels that work on the states of many tracks in turn, so that the
+    /// register footprint of one stage does not limit the occupancy of the
+    /// others.
+    ///
+    /// @param propagation the state of a propagation flow
+    ///
+    /// @return whether the propagation is still alive
+    /// @{
+    /// Take a step
+    template <typename state_t>
+    DETRAY_HOST_DEVICE bool step_stage(state_t &propagation) {
+        const auto start{timer_t::now()};
+        propagation._heartbeat &= m_stepper.step(propagation, m_cfg.stepping);
+        propagation._timer.add(propagation::phase::e_stepping, start);
+        return propagation._heartbeat;
+    }
+
+    /// Find the next candidate
+    template <typename state_t>
+    DETRAY_HOST_DEVICE bool navigation_stage(state_t &propagation) {
+        const auto start{timer_t::now()};
+        propagation._heartbeat &=
+            m_navigator.update(propagation, m_cfg.navigation);
+        propagation._timer.add(propagation::phase::e_navigation, start);
+        return propagation._heartbeat;
+    }
+
+    /// Run all registered actors/aborters and check the navigation status
+    ///
+    /// @param actor_states the actor state
+    template <typename state_t, typename actor_states_t = actor_chain<>::state>
+    DETRAY_HOST_DEVICE bool actor_stage(state_t &propagation,
+                                        actor_states_t &&actor_states = {}) {
+        const auto start{timer_t::now()};
+        run_actors(actor_states, propagation);
+        propagation._timer.add(propagation::phase::e_actors, start);
+
+        return navigation_stage(propagation);
     }
+    /// @}
 
     /// Propagate method with two while loops. In the CPU, propagate and
     /// propagate_sync() should be equivalent to each other. In the SIMT level
@@ -195,55 +347,35 @@ struct propagator {
     DETRAY_HOST_DEVICE bool propagate_sync(state_t &propagation,
                                            actor_states_t &&actor_states = {}) {
 
-        // Initialize the navigation
-        propagation._heartbeat =
-            m_navigator.init(propagation, m_cfg.navigation);
-
-        // Run all registered actors/aborters after init
-        run_actors(actor_states, propagation);
-
-        // Find next candidate
-        propagation._heartbeat &=
-            m_navigator.update(propagation, m_cfg.navigation);
+        // Initialize the navigation and run all registered actors/aborters
+        propagate_init(propagation, actor_states);
 
         while (propagation._heartbeat) {
 
             while (propagation._heartbeat) {
 
                 // Take the step
-                propagation._heartbeat &=
-                    m_stepper.step(propagation, m_cfg.stepping);
+                step_stage(propagation);
 
                 // Find next candidate
-                propagation._heartbeat &=
-                    m_navigator.update(propagation, m_cfg.navigation);
+                navigation_stage(propagation);
 
                 // If the track is on a sensitive surface, break the loop to
                 // synchornize the threads
                 if (propagation._navigation.is_on_sensitive()) {
                     break;
                 } else {
-                    run_actors(actor_states, propagation);
-
-                    // And check the status
-                    propagation._heartbeat &=
-                        m_navigator.update(propagation, m_cfg.navigation);
+                    // Run the actors and check the status
+                    actor_stage(propagation, actor_states);
                 }
             }
 
             // Synchornized actor
             if (propagation._heartbeat) {
-                run_actors(actor_states, propagation);
+                // Run the actors and check the status
+                actor_stage(propagation, actor_states);
 
-                // And check the status
-                propagation._heartbeat &=
-                    m_navigator.update(propagation, m_cfg.navigation);
-
-#if defined(__NO_DEVICE__)
-                if (propagation.do_debug) {
-                    inspect(propagation);
-                }
-#endif
+                run_inspector(propagation);
             }
         }
 
@@ -251,54 +383,289 @@ struct propagator {
         return propagation._navigation.is_complete();
     }
 
-    template <typename state_t>
-    DETRAY_HOST void inspect(state_t &propagation) {
-        const auto &navigation = propagation._navigation;
-        const auto &stepping = propagation._stepping;
-
-        propagation.debug_stream << std::left << std::setw(30);
-        switch (navigation.status()) {
-            case navigation::status::e_abort:
-                propagation.debug_stream << "status: abort";
-                break;
-            case navigation::status::e_on_target:
-                propagation.debug_stream << "status: e_on_target";
-                break;
-            case navigation::status::e_unknown:
-                propagation.debug_stream << "status: unknowm";
-                break;
-            case navigation::status::e_towards_object:
-                propagation.debug_stream << "status: towards_surface";
-                break;
-            case navigation::status::e_on_module:
-                propagation.debug_stream << "status: on_module";
-                break;
-            case navigation::status::e_on_portal:
-                propagation.debug_stream << "status: on_portal";
-                break;
-        };
-
-        if (detail::is_invalid_value(navigation.volume())) {
-            propagation.debug_stream << "volume: " << std::setw(10)
-                                     << "invalid";
-        } else {
-            propagation.debug_stream << "volume: " << std::setw(10)
-                                     << navigation.volume();
-        }
+    /// Propagate a batch of tracks and collect the per-track outcomes.
+    ///
+    /// The propagation state of every track is set up from the track
+    /// parameters and @param args, i.e. the detector or the magnetic field and
+    /// the detector. Every track starts from a copy of the actor states in
+    /// @param actor_states.
+    ///
+    /// The state of every track is constructed in the executor call. With the
+    /// default (dynamic) candidate cache of the navigator, this allocates a
+    /// candidate buffer per track. The batch is only free of allocations if
+    /// the navigator uses a candidate cache of fixed capacity (which is also
+    /// required for device code), if the candidate buffers are taken from an
+    /// event-scoped memory resource, or if the states are preallocated and
+    /// passed to @c propagate_batch_pooled .
+    ///
+    /// @tparam track_range_t range of free track parameters (e.g. a vecmem
+    ///                       vector or device vector)
+    /// @tparam result_range_t range of @c propagation::result
+    /// @tparam executor_t distributes the tracks, e.g. sequentially on host or
+    ///                    one track per thread on device
+    ///
+    /// @param tracks the initial track parameters
+    /// @param results the outcomes, at least one per track
+    /// @param exec the executor
+    /// @param actor_states the initial actor states of every track
+    /// @param args the arguments for the propagation state construction
+    template <typename track_range_t, typename result_range_t,
+              typename executor_t = propagation::sequential_executor,
+              typename... state_args_t>
+    DETRAY_HOST_DEVICE void propagate_batch(
+        const track_range_t &tracks, result_range_t &results,
+        const executor_t &exec,
+        const typename actor_chain_t::state_tuple &actor_states,
+        const state_args_t &... args) {
+
+        assert(results.size() >= tracks.size());
+
+        exec(static_cast<unsigned int>(tracks.size()),
+             [&](const unsigned int i) {
+                 // Per track actor states
+                 typename actor_chain_t::state_tuple trk_actor_states{
+                     actor_states};
+
+                 state propagation(tracks[i], args...);
+                 const bool success{propagate(
+                     propagation, actor_chain_t::make_state(trk_actor_states))};
+
+                 auto &res = results[i];
+                 res.params = propagation._stepping();
+                 res.path_length = propagation._stepping._path_length;
+                 res.status = propagation._navigation.status();
+                 res.success = success;
+             });
+    }
 
-        propagation.debug_stream << "surface: " << std::setw(14);
-        if (navigation.is_on_portal() or navigation.is_on_module()) {
-            propagation.debug_stream << navigation.barcode();
-        } else {
-            propagation.debug_stream << "undefined";
-        }
+    /// Propagate a batch of tracks like @c propagate_batch , but take the
+    /// navigation candidate buffers of all tracks from the event-scoped
+    /// memory resource @param event_mr .
+    ///
+    /// When the tracks are propagated one after the other, every track reuses
+    /// the candidate buffer memory of the previous track. The memory is
+    /// released in bulk with @c event_memory_resource::reset , once the
+    /// results of the event have been consumed. Per-track outputs of the
+    /// actors (e.g. recorded surfaces) can be allocated from the same
+    /// resource by constructing the actor states with it.
+    template <typename track_range_t, typename result_range_t,
+              typename executor_t = propagation::sequential_executor,
+              typename... state_args_t>
+    DETRAY_HOST void propagate_batch(
+        const track_range_t &tracks, result_range_t &results,
+        const executor_t &exec, propagation::event_memory_resource &event_mr,
+        const typename actor_chain_t::state_tuple &actor_states,
+        const state_args_t &... args) {
+
+        assert(results.size() >= tracks.size());
+
+        exec(static_cast<unsigned int>(tracks.size()),
+             [&](const unsigned int i) {
+                 typename actor_chain_t::state_tuple trk_actor_states{
+                     actor_states};
+
+                 state propagation(tracks[i], args...,
+                                   vector_type<intersection_type>(&event_mr));
+                 const bool success{propagate(
+                     propagation, actor_chain_t::make_state(trk_actor_states))};
+
+                 auto &res = results[i];
+                 res.params = propagation._stepping();
+                 res.path_length = propagation._stepping._path_length;
+                 res.status = propagation._navigation.status();
+                 res.success = success;
+             });
+    }
+
+    /// Propagate a batch of preallocated propagation states like
+    /// @c propagate_batch .
+    ///
+    /// Every state in @param states is set up by the caller for one track
+    /// (e.g. with a candidate buffer from preallocated memory) and is
+    /// propagated in place, so that no state is constructed in the executor
+    /// call. The pool can be filled again for the next batch by assigning
+    /// new states, which reuse the candidate buffer memory as long as the
+    /// buffers are moved between them.
+    ///
+    /// @tparam state_range_t range of propagation states (e.g. a vecmem
+    ///                       vector)
+    ///
+    /// @param states the propagation states, one per track
+    /// @param results the outcomes, at least one per state
+    /// @param exec the executor
+    /// @param actor_states the initial actor states of every track
+    template <typename state_range_t, typename result_range_t,
+              typename executor_t = propagation::sequential_executor>
+    DETRAY_HOST_DEVICE void propagate_batch_pooled(
+        state_range_t &states, result_range_t &results,
+        const executor_t &exec,
+        const typename actor_chain_t::state_tuple &actor_states) {
+
+        assert(results.size() >= states.size());
+
+        exec(static_cast<unsigned int>(states.size()),
+             [&](const unsigned int i) {
+                 typename actor_chain_t::state_tuple trk_actor_states{
+                     actor_states};
+
+                 state &propagation = states[i];
+                 const bool success{propagate(
+                     propagation, actor_chain_t::make_state(trk_actor_states))};
+
+                 auto &res = results[i];
+                 res.params = propagation._stepping();
+                 res.path_length = propagation._stepping._path_length;
+                 res.status = propagation._navigation.status();
+                 res.success = success;
+             });
+    }
+
+    /// Propagate a batch of tracks like @c propagate_batch and record the
+    /// trajectory of every track into its slice of @param records .
+    ///
+    /// The output mode is set by the step recorder state in
+    /// @param actor_states : the full trace ( @c step_record_mode::e_steps ,
+    /// with the Jacobians if the collection stores them), all surfaces or
+    /// only the sensitive surfaces. The recorder state is bound to the track
+    /// before its propagation. If only the final states are needed, the plain
+    /// @c propagate_batch without a recorder fills the results alone.
+    ///
+    /// The slices can be packed densely with @c compact_step_records ,
+    /// before they are copied from the device.
+    ///
+    /// @param tracks the initial track parameters
+    /// @param results the outcomes, at least one per track
+    /// @param records the preallocated slices, at least one per track
+    /// @param exec the executor
+    /// @param actor_states the initial actor states of every track
+    /// @param args the arguments for the propagation state construction
+    template <typename track_range_t, typename result_range_t,
+              typename record_collection_t,
+              typename executor_t = propagation::sequential_executor,
+              typename... state_args_t>
+    DETRAY_HOST_DEVICE void propagate_batch_recorded(
+        const track_range_t &tracks, result_range_t &results,
+        record_collection_t &records, const executor_t &exec,
+        const typename actor_chain_t::state_tuple &actor_states,
+        const state_args_t &... args) {
+
+        assert(results.size() >= tracks.size());
+        assert(records.size() >= tracks.size());
+
+        exec(static_cast<unsigned int>(tracks.size()),
+             [&](const unsigned int i) {
+                 typename actor_chain_t::state_tuple trk_actor_states{
+                     actor_states};
+                 detail::bind_step_records(trk_actor_states, records, i);
+
+                 state propagation(tracks[i], args...);
+                 const bool success{propagate(
+                     propagation, actor_chain_t::make_state(trk_actor_states))};
+
+                 auto &res = results[i];
+                 res.params = propagation._stepping();
+                 res.path_length = propagation._stepping._path_length;
+                 res.status = propagation._navigation.status();
+                 res.success = success;
+             });
+    }
 
-        propagation.debug_stream << "step_size: " << std::setw(10)
-                                 << stepping._prev_step_size << std::endl;
+    /// Propagate a batch of tracks like @c propagate_batch , but interleave
+    /// the steps of a group of tracks on every executor call.
+    ///
+    /// The executor hands out groups of @param group_size tracks, which are
+    /// advanced in turn by one step at a time. Before the propagation
+    /// switches to the next track of the group, the transform and the mask of
+    /// the next candidate of the current track are prefetched. These are then
+    /// likely in cache once the track takes its next step, instead of
+    /// stalling the navigation on the dependent memory accesses. Since every
+    /// track keeps its own propagation state, the results are the same as
+    /// for @c propagate_batch .
+    ///
+    /// @tparam track_range_t range of free track parameters
+    /// @tparam result_range_t range of @c propagation::result
+    /// @tparam executor_t distributes the groups of tracks, e.g. on multiple
+    ///                    host threads
+    ///
+    /// @param tracks the initial track parameters
+    /// @param results the outcomes, at least one per track
+    /// @param exec the executor
+    /// @param group_size number of tracks that are interleaved
+    /// @param actor_states the initial actor states of every track
+    /// @param args the arguments for the propagation state construction
+    template <typename track_range_t, typename result_range_t,
+              typename executor_t = propagation::sequential_executor,
+              typename... state_args_t>
+    DETRAY_HOST void propagate_batch_interleaved(
+        const track_range_t &tracks, result_range_t &results,
+        const executor_t &exec, const unsigned int group_size,
+        const typename actor_chain_t::state_tuple &actor_states,
+        const state_args_t &... args) {
+
+        assert(results.size() >= tracks.size());
+
+        const auto n_tracks{static_cast<unsigned int>(tracks.size())};
+        const unsigned int group{std::max(1u, group_size)};
+        const unsigned int n_groups{(n_tracks + group - 1u) / group};
+
+        exec(n_groups, [&](const unsigned int g) {
+            const unsigned int begin{g * group};
+            const unsigned int end{std::min(begin + group, n_tracks)};
+
+            // Per track propagation and actor states of the group
+            std::vector<state> states;
+            states.reserve(end - begin);
+            std::vector<typename actor_chain_t::state_tuple> trk_actor_states(
+                end - begin, actor_states);
+
+            for (unsigned int i = begin; i < end; ++i) {
+                states.emplace_back(tracks[i], args...);
+            }
 
-        propagation.debug_stream << std::setw(10)
-                                 << detail::ray<algebra_type>(stepping())
-                                 << std::endl;
+            unsigned int n_alive{0u};
+            for (std::size_t j = 0u; j < states.size(); ++j) {
+                if (propagate_init(states[j], actor_chain_t::make_state(
+                                                  trk_actor_states[j]))) {
+                    m_navigator.prefetch_next(states[j]._navigation);
+                    ++n_alive;
+                }
+            }
+
+            // Round-robin over the live tracks, one step per track
+            while (n_alive > 0u) {
+                n_alive = 0u;
+                for (std::size_t j = 0u; j < states.size(); ++j) {
+                    if (not states[j]._heartbeat) {
+                        continue;
+                    }
+                    if (propagate_steps(
+                            states[j],
+                            actor_chain_t::make_state(trk_actor_states[j]),
+                            1u)) {
+                        m_navigator.prefetch_next(states[j]._navigation);
+                        ++n_alive;
+                    }
+                }
+            }
+
+            for (std::size_t j = 0u; j < states.size(); ++j) {
+                auto &res = results[begin + j];
+                res.params = states[j]._stepping();
+                res.path_length = states[j]._stepping._path_length;
+                res.status = states[j]._navigation.status();
+                res.success = states[j]._navigation.is_complete();
+            }
+        });
+    }
+
+    /// Run the inspector on the propagation state @param propagation
+    template <typename state_t>
+    DETRAY_HOST_DEVICE inline void run_inspector(
+        [[maybe_unused]] state_t &propagation) const {
+        if constexpr (not std::is_same_v<inspector_t,
+                                         propagation::void_inspector>) {
+            propagation._inspector(propagation);
+        }
     }
 };
 
@@ -0,0 +1,203 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/track_parametrization.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/navigation/policies.hpp"
+#include "detray/propagator/base_stepper.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// System include(s)
+#include <cstddef>
+#include <limits>
+
+namespace detray {
+
+namespace detail {
+
+/// Butcher tableau of the Dormand-Prince 5(4) Runge-Kutta pair
+template <typename scalar_t>
+struct dormand_prince_tableau {
+
+    /// Runge-Kutta matrix (the last row are the weights of the 5th order
+    /// solution, so that the last stage is evaluated at the end point)
+    scalar_t a[7][6] = {
+        {0.f},
+        {static_cast<scalar_t>(1. / 5.)},
+        {static_cast<scalar_t>(3. / 40.), static_cast<scalar_t>(9. / 40.)},
+        {static_cast<scalar_t>(44. / 45.), static_cast<scalar_t>(-56. / 15.),
+         static_cast<scalar_t>(32. / 9.)},
+        {static_cast<scalar_t>(19372. / 6561.),
+         static_cast<scalar_t>(-25360. / 2187.),
+         static_cast<scalar_t>(64448. / 6561.),
+         static_cast<scalar_t>(-212. / 729.)},
+        {static_cast<scalar_t>(9017. / 3168.),
+         static_cast<scalar_t>(-355. / 33.),
+         static_cast<scalar_t>(46732. / 5247.),
+         static_cast<scalar_t>(49. / 176.),
+         static_cast<scalar_t>(-5103. / 18656.)},
+        {static_cast<scalar_t>(35. / 384.), 0.f,
+         static_cast<scalar_t>(500. / 1113.),
+         static_cast<scalar_t>(125. / 192.),
+         static_cast<scalar_t>(-2187. / 6784.),
+         static_cast<scalar_t>(11. / 84.)}};
+
+    /// Weights of the 5th order solution
+    scalar_t b[7] = {static_cast<scalar_t>(35. / 384.),
+                     0.f,
+                     static_cast<scalar_t>(500. / 1113.),
+                     static_cast<scalar_t>(125. / 192.),
+                     static_cast<scalar_t>(-2187. / 6784.),
+                     static_cast<scalar_t>(11. / 84.),
+                     0.f};
+
+    /// Difference between the weights of the 5th and 4th order solutions
+    scalar_t e[7] = {static_cast<scalar_t>(71. / 57600.),
+                     0.f,
+                     static_cast<scalar_t>(-71. / 16695.),
+                     static_cast<scalar_t>(71. / 1920.),
+                     static_cast<scalar_t>(-17253. / 339200.),
+                     static_cast<scalar_t>(22. / 525.),
+                     static_cast<scalar_t>(-1. / 40.)};
+};
+
+}  // namespace detail
+
+/// Embedded Runge-Kutta stepper of 5(4)th order after Dormand and Prince.
+///
+/// The track state (position, direction and q/p) is integrated as a first
+/// order system with seven stages per step. The last stage is evaluated at the
+/// end point of the step (first-same-as-last), so it provides the first stage
+/// of the next step, and the error estimate of the embedded 4th order
+/// solution needs no additional field evaluations.
+///
+/// Reference: J.R. Dormand, P.J. Prince, A family of embedded Runge-Kutta
+/// formulae, J. Comp. Appl. Math. 6 (1980) 19-26
+///
+/// @tparam magnetic_field_t the type of magnetic field
+/// @tparam algebra_t the algebra plugin
+/// @tparam constraint_t the type of constraints on the stepper
+/// @tparam policy_t the navigation policy of the stepper
+/// @tparam inspector_t stepping inspector type
+template <typename magnetic_field_t, typename algebra_t,
+          typename constraint_t = unconstrained_step,
+          typename policy_t = stepper_rk_policy,
+          typename inspector_t = stepping::void_inspector,
+          template <typename, std::size_t> class array_t = darray>
+class rk_dp_stepper final
+    : public base_stepper<algebra_t, constraint_t, policy_t, inspector_t> {
+
+    /// The RK4 stepper provides the field and energy loss evaluations
+    using rk_stepper_type = rk_stepper<magnetic_field_t, algebra_t,
+                                       constraint_t, policy_t, inspector_t,
+                                       array_t>;
+
+    public:
+    using base_type =
+        base_stepper<algebra_t, constraint_t, policy_t, inspector_t>;
+
+    using algebra_type = algebra_t;
+    using scalar_type = dscalar<algebra_t>;
+    using point3_type = dpoint3D<algebra_t>;
+    using vector3_type = dvector3D<algebra_t>;
+    using transform3_type = dtransform3D<algebra_t>;
+    using matrix_operator = dmatrix_operator<algebra_t>;
+    using free_track_parameters_type =
+        typename base_type::free_track_parameters_type;
+    using bound_track_parameters_type =
+        typename base_type::bound_track_parameters_type;
+    using magnetic_field_type = magnetic_field_t;
+    template <std::size_t ROWS, std::size_t COLS>
+    using matrix_type = dmatrix<algebra_t, ROWS, COLS>;
+
+    /// Number of stages of the Runge-Kutta pair
+    static constexpr std::size_t n_stages{7u};
+    /// Number of integration variables (position, direction and q/p)
+    static constexpr std::size_t n_vars{7u};
+
+    DETRAY_HOST_DEVICE
+    rk_dp_stepper() {}
+
+    struct state : public rk_stepper_type::state {
+
+        using rk_state_type = typename rk_stepper_type::state;
+
+        /// Derivatives of the integration variables wrt. their initial values
+        using jacobian_type = array_t<array_t<scalar_type, n_vars>, n_vars>;
+
+        DETRAY_HOST_DEVICE
+        state(const free_track_parameters_type& t,
+              const magnetic_field_t& mag_field)
+            : rk_state_type(t, mag_field) {}
+
+        template <typename detector_t>
+        DETRAY_HOST_DEVICE state(
+            const bound_track_parameters_type& bound_params,
+            const magnetic_field_t& mag_field, const detector_t& det)
+            : rk_state_type(bound_params, mag_field, det) {}
+
+        /// Stage data of the embedded Runge-Kutta pair
+        struct {
+            // Position at the stage
+            array_t<point3_type, n_stages> r;
+            // Tangential direction at the stage = dr/ds
+            array_t<vector3_type, n_stages> t;
+            // q/p at the stage
+            array_t<scalar_type, n_stages> qop;
+            // Magnetic field at the stage
+            array_t<vector3_type, n_stages> b;
+            // dt/ds = q/p ( t X B )
+            array_t<vector3_type, n_stages> dtds;
+            // d(q/p)/ds
+            array_t<scalar_type, n_stages> dqopds;
+        } _stage_data;
+
+        /// Whether the last stage of the previous step can be reused
+        bool _fsal{false};
+
+        /// Material of the previous step (validity of the last stage)
+        const detray::material<scalar_type>* _fsal_mat{nullptr};
+
+        /// Evaluate the stages (but the first) for the step size @param h
+        DETRAY_HOST_DEVICE
+        inline void evaluate_stages(const scalar_type h);
+
+        /// Evaluate the slopes of the stage @param i from its inputs
+        DETRAY_HOST_DEVICE
+        inline void evaluate_derivatives(const std::size_t i);
+
+        /// @returns the local error estimate for the step size @param h
+        DETRAY_HOST_DEVICE
+        inline scalar_type error_estimate(const scalar_type h) const;
+
+        /// Update the track state to the 5th order solution
+        DETRAY_HOST_DEVICE
+        inline void advance_track();
+
+        /// Update the jacobian transport from the stages of the free
+        /// propagation
+        DETRAY_HOST_DEVICE
+        inline void advance_jacobian(
+            const stepping::config<scalar_type>& cfg = {});
+    };
+
+    /// Take a step, using an adaptive, embedded Runge-Kutta algorithm.
+    ///
+    /// @return returning the heartbeat, indicating if the stepping is alive
+    template <typename propagation_state_t>
+    DETRAY_HOST_DEVICE bool step(propagation_state_t& propagation,
+                                 const stepping::config<scalar_type>& cfg = {});
+};
+
+}  // namespace detray
+
+#include "detray/propagator/rk_dp_stepper.ipp"
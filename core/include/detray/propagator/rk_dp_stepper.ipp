@@ -0,0 +1,410 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "detray/geometry/detector_volume.hpp"
+
+template <typename magnetic_field_t, typename algebra_t, typename constraint_t,
+          typename policy_t, typename inspector_t,
+          template <typename, std::size_t> class array_t>
+DETRAY_HOST_DEVICE void detray::rk_dp_stepper<
+    magnetic_field_t, algebra_t, constraint_t, policy_t, inspector_t,
+    array_t>::state::evaluate_derivatives(const std::size_t i) {
+    auto& sd = this->_stage_data;
+
+    sd.b[i] = this->evaluate_field(sd.r[i]);
+
+    // dtds = qop * (t X B) from Lorentz force
+    sd.dtds[i] = sd.qop[i] * vector::cross(sd.t[i], sd.b[i]);
+
+    // d(qop)ds is zero for empty space
+    sd.dqopds[i] = this->dqopds(sd.qop[i]);
+}
+
+template <typename magnetic_field_t, typename algebra_t, typename constraint_t,
+          typename policy_t, typename inspector_t,
+          template <typename, std::size_t> class array_t>
+DETRAY_HOST_DEVICE void detray::rk_dp_stepper<
+    magnetic_field_t, algebra_t, constraint_t, policy_t, inspector_t,
+    array_t>::state::evaluate_stages(const scalar_type h) {
+    constexpr detail::dormand_prince_tableau<scalar_type> tab{};
+
+    auto& sd = this->_stage_data;
+
+    // The first stage is known at the beginning of the step. The slopes of
+    // the last stage are not needed for the error estimate and are evaluated
+    // once the step is accepted (see 'advance_track')
+    for (std::size_t i = 1u; i < n_stages; ++i) {
+        point3_type r = sd.r[0u];
+        vector3_type t = sd.t[0u];
+        scalar_type qop{sd.qop[0u]};
+
+        for (std::size_t j = 0u; j < i; ++j) {
+            const scalar_type ha{h * tab.a[i][j]};
+            r = r + ha * sd.t[j];
+            t = t + ha * sd.dtds[j];
+            qop += ha * sd.dqopds[j];
+        }
+
+        sd.r[i] = r;
+        sd.t[i] = t;
+        sd.qop[i] = qop;
+
+        if (i < n_stages - 1u) {
+            evaluate_derivatives(i);
+        }
+    }
+}
+
+template <typename magnetic_field_t, typename algebra_t, typename constraint_t,
+          typename policy_t, typename inspector_t,
+          template <typename, std::size_t> class array_t>
+DETRAY_HOST_DEVICE auto detray::rk_dp_stepper<
+    magnetic_field_t, algebra_t, constraint_t, policy_t, inspector_t,
+    array_t>::state::error_estimate(const scalar_type h) const -> scalar_type {
+
+    constexpr detail::dormand_prince_tableau<scalar_type> tab{};
+
+    const auto& sd = this->_stage_data;
+
+    // Difference between the positions of the 5th and 4th order solutions
+    vector3_type err_vec{0.f, 0.f, 0.f};
+    for (std::size_t i = 0u; i < n_stages; ++i) {
+        err_vec = err_vec + tab.e[i] * sd.t[i];
+    }
+
+    return math::abs(h) * getter::norm(err_vec);
+}
+
+template <typename magnetic_field_t, typename algebra_t, typename constraint_t,
+          typename policy_t, typename inspector_t,
+          template <typename, std::size_t> class array_t>
+DETRAY_HOST_DEVICE void detray::rk_dp_stepper<
+    magnetic_field_t, algebra_t, constraint_t, policy_t, inspector_t,
+    array_t>::state::advance_track() {
+
+    auto& sd = this->_stage_data;
+    const scalar_type h{this->_step_size};
+    auto& track = this->_track;
+
+    // The last stage is the 5th order solution
+    track.set_pos(sd.r[n_stages - 1u]);
+
+    const vector3_type dir = vector::normalize(sd.t[n_stages - 1u]);
+    track.set_dir(dir);
+
+    if (!(this->_mat == nullptr)) {
+        track.set_qop(sd.qop[n_stages - 1u]);
+    }
+
+    // Evaluate the slopes at the end point with the normalized direction, so
+    // that they can be used as the first stage of the next step
+    sd.t[n_stages - 1u] = dir;
+    sd.qop[n_stages - 1u] = track.qop();
+    evaluate_derivatives(n_stages - 1u);
+
+    // Derivatives at the end point for the parameter transport
+    auto& rk_data = this->_step_data;
+    rk_data.b_first = sd.b[0u];
+    rk_data.b_middle = sd.b[3u];
+    rk_data.b_last = sd.b[n_stages - 1u];
+    rk_data.dtds[3u] = sd.dtds[n_stages - 1u];
+    rk_data.dqopds[3u] = sd.dqopds[n_stages - 1u];
+
+    // Update path length
+    this->_path_length += h;
+    this->_abs_path_length += math::abs(h);
+    this->_s += h;
+}
+
+template <typename magnetic_field_t, typename algebra_t, typename constraint_t,
+          typename policy_t, typename inspector_t,
+          template <typename, std::size_t> class array_t>
+DETRAY_HOST_DEVICE void detray::rk_dp_stepper<
+    magnetic_field_t, algebra_t, constraint_t, policy_t, inspector_t,
+    array_t>::state::advance_jacobian(const stepping::config<scalar_type>&
+                                          cfg) {
+    /// The transport jacobian is obtained by integrating the variational
+    /// equations dJ/ds = (df/dy) * J of the equations of motion
+    /// y' = f(y), y = (r, t, qop), with the same Runge-Kutta scheme as the
+    /// track state. The time is not integrated, its derivatives are zero.
+    constexpr detail::dormand_prince_tableau<scalar_type> tab{};
+
+    const auto& sd = this->_stage_data;
+    const scalar_type h{this->_step_size};
+
+    // The weight of the last stage is zero in the 5th order solution
+    constexpr std::size_t n_used_stages{n_stages - 1u};
+
+    // Derivatives of the stage slopes wrt. the initial values
+    array_t<jacobian_type, n_used_stages> dkdy;
+
+    for (std::size_t i = 0u; i < n_used_stages; ++i) {
+
+        // Derivatives of the stage inputs wrt. the initial values
+        jacobian_type dydy;
+        for (std::size_t row = 0u; row < n_vars; ++row) {
+            for (std::size_t col = 0u; col < n_vars; ++col) {
+                scalar_type sum{row == col ? 1.f : 0.f};
+                for (std::size_t j = 0u; j < i; ++j) {
+                    sum += h * tab.a[i][j] * dkdy[j][row][col];
+                }
+                dydy[row][col] = sum;
+            }
+        }
+
+        const vector3_type& t = sd.t[i];
+        const vector3_type& b = sd.b[i];
+        const scalar_type qop{sd.qop[i]};
+        const vector3_type t_x_b = vector::cross(t, b);
+
+        // Field gradient dB/dr
+        matrix_type<3, 3> dBdr = matrix_operator().template zero<3, 3>();
+        if (cfg.use_field_gradient) {
+            dBdr = this->evaluate_field_gradient(sd.r[i]);
+        }
+
+        // d(dqop/ds)/dqop
+        scalar_type d2qopdsdqop{0.f};
+        if (cfg.use_eloss_gradient) {
+            d2qopdsdqop = this->d2qopdsdqop(qop);
+        }
+
+        for (std::size_t col = 0u; col < n_vars; ++col) {
+            const vector3_type dr{dydy[0u][col], dydy[1u][col], dydy[2u][col]};
+            const vector3_type dt{dydy[3u][col], dydy[4u][col], dydy[5u][col]};
+            const scalar_type dqop{dydy[6u][col]};
+
+            // d(dr/ds) = dt
+            dkdy[i][0u][col] = dt[0u];
+            dkdy[i][1u][col] = dt[1u];
+            dkdy[i][2u][col] = dt[2u];
+
+            // d(dt/ds) = qop * (dt X B + t X dB/dr dr) + dqop * (t X B)
+            vector3_type db;
+            for (unsigned int k = 0u; k < 3u; ++k) {
+                db[k] = getter::element(dBdr, k, 0u) * dr[0u] +
+                        getter::element(dBdr, k, 1u) * dr[1u] +
+                        getter::element(dBdr, k, 2u) * dr[2u];
+            }
+            const vector3_type ddtds =
+                qop * (vector::cross(dt, b) + vector::cross(t, db)) +
+                dqop * t_x_b;
+            dkdy[i][3u][col] = ddtds[0u];
+            dkdy[i][4u][col] = ddtds[1u];
+            dkdy[i][5u][col] = ddtds[2u];
+
+            // d(dqop/ds) = d2qop/dsdqop * dqop
+            dkdy[i][6u][col] = d2qopdsdqop * dqop;
+        }
+    }
+
+    // Map the integration variables to the free track parameters
+    constexpr unsigned int free_idx[n_vars]{
+        e_free_pos0, e_free_pos1, e_free_pos2,  e_free_dir0,
+        e_free_dir1, e_free_dir2, e_free_qoverp};
+
+    // Set transport matrix (D) and update Jacobian transport
+    //( JacTransport = D * JacTransport )
+    auto D = matrix_operator().template identity<e_free_size, e_free_size>();
+
+    for (std::size_t row = 0u; row < n_vars; ++row) {
+        for (std::size_t col = 0u; col < n_vars; ++col) {
+            scalar_type sum{row == col ? 1.f : 0.f};
+            for (std::size_t i = 0u; i < n_used_stages; ++i) {
+                sum += h * tab.b[i] * dkdy[i][row][col];
+            }
+            getter::element(D, free_idx[row], free_idx[col]) = sum;
+        }
+    }
+
+    this->_jac_transport = D * this->_jac_transport;
+}
+
+template <typename magnetic_field_t, typename algebra_t, typename constraint_t,
+          typename policy_t, typename inspector_t,
+          template <typename, std::size_t> class array_t>
+template <typename propagation_state_t>
+DETRAY_HOST_DEVICE bool detray::rk_dp_stepper<
+    magnetic_field_t, algebra_t, constraint_t, policy_t, inspector_t,
+    array_t>::step(propagation_state_t& propagation,
+                   const detray::stepping::config<scalar_type>& cfg) {
+
+    // Get stepper and navigator states
+    state& stepping = propagation._stepping;
+    auto& navigation = propagation._navigation;
+
+    // Whether the step size of the error control is cut by the navigation
+    bool is_cut{math::abs(navigation()) < math::abs(stepping._step_size)};
+
+    if (stepping._step_size == 0.f) {
+        stepping._step_size = cfg.min_stepsize;
+    } else if (stepping._step_size > 0) {
+        stepping._step_size = math::min(stepping._step_size, navigation());
+    } else {
+        stepping._step_size = math::max(stepping._step_size, navigation());
+    }
+
+    const auto& track = stepping();
+    const point3_type pos = track.pos();
+    const vector3_type dir = track.dir();
+
+    auto vol = detector_volume{*navigation.detector(), navigation.volume()};
+    if (vol.has_material()) {
+        stepping._mat = vol.material_parameters(pos);
+    } else {
+        stepping._mat = nullptr;
+    }
+
+    // Limit the step size in volume material to a fraction of X0
+    if (stepping._mat != nullptr &&
+        cfg.max_step_in_X0 < std::numeric_limits<scalar_type>::max()) {
+        const scalar_type max_step{cfg.max_step_in_X0 * stepping._mat->X0()};
+        if (math::abs(stepping._step_size) > max_step) {
+            stepping._step_size =
+                math::copysign(max_step, stepping._step_size);
+            is_cut = true;
+        }
+    }
+
+    auto& sd = stepping._stage_data;
+    constexpr std::size_t last{n_stages - 1u};
+
+    // First Runge-Kutta stage: Reuse the last stage of the previous step,
+    // unless the track was modified in between (e.g. by an actor)
+    const bool fsal{stepping._fsal && stepping._fsal_mat == stepping._mat &&
+                    sd.r[last][0] == pos[0] && sd.r[last][1] == pos[1] &&
+                    sd.r[last][2] == pos[2] && sd.t[last][0] == dir[0] &&
+                    sd.t[last][1] == dir[1] && sd.t[last][2] == dir[2] &&
+                    sd.qop[last] == track.qop()};
+    if (fsal) {
+        sd.r[0u] = sd.r[last];
+        sd.t[0u] = sd.t[last];
+        sd.qop[0u] = sd.qop[last];
+        sd.b[0u] = sd.b[last];
+        sd.dtds[0u] = sd.dtds[last];
+        sd.dqopds[0u] = sd.dqopds[last];
+    } else {
+        sd.r[0u] = pos;
+        sd.t[0u] = dir;
+        sd.qop[0u] = track.qop();
+        stepping.evaluate_derivatives(0u);
+    }
+
+    const auto estimate_error = [&](const scalar_type& h) -> scalar_type {
+        stepping.evaluate_stages(h);
+
+        return math::max(stepping.error_estimate(h),
+                         static_cast<scalar_type>(1e-20));
+    };
+
+    // The local error of the 4th order solution scales with h^5
+    constexpr scalar_type order_exp{static_cast<scalar_type>(0.2)};
+
+    scalar_type error{1e20f};
+
+    // Whenever navigator::init() is called the step size is set to navigation
+    // path length (navigation()). We need to reduce it down to make error small
+    // enough
+    if (stepping._initialized) {
+        for (unsigned int i_t = 0u; i_t < cfg.max_rk_updates; i_t++) {
+
+            error = estimate_error(stepping._step_size);
+
+            // Error is small enough
+            // ---> break and advance track
+            if (error <= cfg.rk_error_tol) {
+                stepping._initialized = false;
+                break;
+            }
+            // Error estimate is too big
+            // ---> Make step size smaller and esimate error again
+            else {
+
+                scalar_type step_size_scaling =
+                    math::pow(cfg.rk_error_tol / error, order_exp);
+
+                stepping._step_size *= step_size_scaling;
+                is_cut = false;
+
+                // Run inspection while the stepsize is getting adjusted
+                stepping.run_inspector(cfg, "Adjust stepsize: ", i_t + 1,
+                                       step_size_scaling);
+            }
+        }
+    } else {
+        stepping._initialized = false;
+        error = estimate_error(stepping._step_size);
+    }
+
+    assert(stepping._initialized == false);
+    // If the stepper state is still in the initialized state, abort.
+    if (stepping._initialized == true) {
+        return navigation.abort();
+    }
+
+    // Update navigation direction
+    const step::direction step_dir = stepping._step_size >= 0.f
+                                         ? step::direction::e_forward
+                                         : step::direction::e_backward;
+    stepping.set_direction(step_dir);
+
+    // Check constraints
+    if (math::abs(stepping._step_size) >
+        math::abs(
+            stepping.constraints().template size<>(stepping.direction()))) {
+
+        // Run inspection before step size is cut
+        stepping.run_inspector(cfg, "Before constraint: ");
+
+        stepping.set_step_size(
+            stepping.constraints().template size<>(stepping.direction()));
+        is_cut = true;
+
+        // The stages have to match the step size
+        error = estimate_error(stepping._step_size);
+    }
+
+    // Advance track state
+    stepping.advance_track();
+    stepping._fsal = true;
+    stepping._fsal_mat = stepping._mat;
+
+    // Accumulate the volume material for the multiple scattering, which is
+    // added to the covariance on the next surface
+    if (cfg.do_volume_scattering && stepping._mat != nullptr) {
+        stepping._path_in_X0 +=
+            math::abs(stepping._step_size) / stepping._mat->X0();
+        stepping._path_in_material += math::abs(stepping._step_size);
+    }
+
+    // Advance jacobian transport
+    if (cfg.do_covariance_transport && stepping.do_covariance_transport()) {
+        stepping.advance_jacobian(cfg);
+    }
+
+    // Call navigation update policy
+    typename rk_dp_stepper::policy_type{}(stepping.policy_state(),
+                                          propagation);
+
+    const scalar_type step_size_scaling = static_cast<scalar_type>(
+        math::min(math::max(math::pow(cfg.rk_error_tol / error, order_exp),
+                            static_cast<scalar_type>(0.25)),
+                  static_cast<scalar_type>(4.)));
+
+    // Save the current step size
+    stepping._prev_step_size = stepping._step_size;
+
+    // Update the step size
+    stepping._step_size *= step_size_scaling;
+    stepping.update_suggested_step_size(stepping._step_size, is_cut);
+
+    // Run final inspection
+    stepping.run_inspector(cfg, "Step complete: ");
+
+    return true;
+}
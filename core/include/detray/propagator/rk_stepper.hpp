@@ -1,6 +1,6 @@
 /** Detray library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2023 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -18,18 +18,54 @@
 #include "detray/tracks/tracks.hpp"
 #include "detray/utils/matrix_helper.hpp"
 
+// System include(s)
+#include <array>
+#include <limits>
+#include <type_traits>
+
 namespace detray {
 
+namespace detail {
+
+/// @brief Track position and path lengths in the accumulator precision of the
+/// RK stepper state (empty if the stepper does not run in mixed precision)
+template <typename accumulator_t, bool enabled>
+struct rk_accumulator_data {};
+
+template <typename accumulator_t>
+struct rk_accumulator_data<accumulator_t, true> {
+    struct {
+        std::array<accumulator_t, 3u> pos{0.f, 0.f, 0.f};
+        accumulator_t path_length{0.f};
+        accumulator_t abs_path_length{0.f};
+        accumulator_t s{0.f};
+    } _acc;
+};
+
+}  // namespace detail
+
 /// Runge-Kutta-Nystrom 4th order stepper implementation
 ///
 /// @tparam magnetic_field_t the type of magnetic field
 /// @tparam track_t the type of track that is being advanced by the stepper
 /// @tparam constraint_ the type of constraints on the stepper
+/// @tparam accumulator_t scalar type in which the track position and the path
+///         lengths are accumulated. If it is more precise than the scalar type
+///         of the algebra (e.g. double for a float algebra), the stage
+///         arithmetic stays in the algebra precision, but long tracks do not
+///         accumulate rounding errors from the many small position updates
+/// @tparam transport_jacobian whether the code for the transport of the
+///         jacobian is compiled in at all. Switching it off removes the
+///         largest contributor to the register pressure of device kernels
+///         that only need the track position (e.g. for simulation or
+///         navigation studies)
 template <typename magnetic_field_t, typename algebra_t,
           typename constraint_t = unconstrained_step,
           typename policy_t = stepper_rk_policy,
           typename inspector_t = stepping::void_inspector,
-          template <typename, std::size_t> class array_t = darray>
+          template <typename, std::size_t> class array_t = darray,
+          typename accumulator_t = dscalar<algebra_t>,
+          bool transport_jacobian = true>
 class rk_stepper final
     : public base_stepper<algebra_t, constraint_t, policy_t, inspector_t> {
 
@@ -51,11 +87,19 @@ class rk_stepper final
     using magnetic_field_type = magnetic_field_t;
     template <std::size_t ROWS, std::size_t COLS>
     using matrix_type = dmatrix<algebra_t, ROWS, COLS>;
+    using accumulator_type = accumulator_t;
+
+    /// Whether the position and path lengths are accumulated separately
+    static constexpr bool is_mixed_precision{
+        not std::is_same_v<accumulator_t, scalar_type>};
 
     DETRAY_HOST_DEVICE
     rk_stepper() {}
 
-    struct state : public base_type::state {
+    struct state
+        : public base_type::state,
+          public detail::rk_accumulator_data<accumulator_t,
+                                             is_mixed_precision> {
 
         static constexpr const stepping::id id = stepping::id::e_rk;
 
@@ -102,6 +146,12 @@ class rk_stepper final
         DETRAY_HOST_DEVICE
         inline void advance_track();
 
+        /// Reset the accumulators to the track position and path lengths, if
+        /// they were modified outside of the stepper (no-op if the stepper
+        /// does not run in mixed precision)
+        DETRAY_HOST_DEVICE
+        inline void sync_accumulators();
+
         /// Update the jacobian transport from free propagation
         DETRAY_HOST_DEVICE
         inline void advance_jacobian(
@@ -121,9 +171,14 @@ class rk_stepper final
                                           const vector3_type& dtds_prev,
                                           const scalar_type qop);
 
+        /// @returns the magnetic field at @param pos
+        DETRAY_HOST_DEVICE
+        inline vector3_type evaluate_field(const point3_type& pos) const;
+
+        /// @returns the field gradient dB/dr at @param pos
         DETRAY_HOST_DEVICE
         inline matrix_type<3, 3> evaluate_field_gradient(
-            const point3_type& pos);
+            const point3_type& pos) const;
 
         /// Evaluate dtds, where t is the unit tangential direction
         DETRAY_HOST_DEVICE
@@ -12,10 +12,12 @@
 
 template <typename magnetic_field_t, typename algebra_t, typename constraint_t,
           typename policy_t, typename inspector_t,
-          template <typename, std::size_t> class array_t>
+          template <typename, std::size_t> class array_t,
+          typename accumulator_t, bool transport_jacobian>
 DETRAY_HOST_DEVICE void
 detray::rk_stepper<magnetic_field_t, algebra_t, constraint_t, policy_t,
-                   inspector_t, array_t>::state::advance_track() {
+                   inspector_t, array_t,
+                   accumulator_t, transport_jacobian>::state::advance_track() {
 
     const auto& sd = this->_step_data;
     const scalar_type h{this->_step_size};
@@ -26,7 +28,19 @@ detray::rk_stepper<magnetic_field_t, algebra_t, constraint_t, policy_t,
 
     // Update the track parameters according to the equations of motion
     // Reference: Eq (82) of https://doi.org/10.1016/0029-554X(81)90063-X
-    pos = pos + h * (sd.t[0u] + h_6 * (sd.dtds[0] + sd.dtds[1] + sd.dtds[2]));
+    const vector3_type dpos{
+        h * (sd.t[0u] + h_6 * (sd.dtds[0] + sd.dtds[1] + sd.dtds[2]))};
+
+    if constexpr (is_mixed_precision) {
+        // Only the increment is calculated in the scalar precision
+        this->sync_accumulators();
+        for (unsigned int i = 0u; i < 3u; ++i) {
+            this->_acc.pos[i] += static_cast<accumulator_t>(dpos[i]);
+            pos[i] = static_cast<scalar_type>(this->_acc.pos[i]);
+        }
+    } else {
+        pos = pos + dpos;
+    }
     track.set_pos(pos);
 
     // Reference: Eq (82) of https://doi.org/10.1016/0029-554X(81)90063-X
@@ -45,17 +59,66 @@ detray::rk_stepper<magnetic_field_t, algebra_t, constraint_t, policy_t,
     track.set_qop(qop);
 
     // Update path length
-    this->_path_length += h;
-    this->_abs_path_length += math::abs(h);
-    this->_s += h;
+    if constexpr (is_mixed_precision) {
+        auto& acc = this->_acc;
+        acc.path_length += static_cast<accumulator_t>(h);
+        acc.abs_path_length += static_cast<accumulator_t>(math::abs(h));
+        acc.s += static_cast<accumulator_t>(h);
+
+        this->_path_length = static_cast<scalar_type>(acc.path_length);
+        this->_abs_path_length = static_cast<scalar_type>(acc.abs_path_length);
+        this->_s = static_cast<scalar_type>(acc.s);
+    } else {
+        this->_path_length += h;
+        this->_abs_path_length += math::abs(h);
+        this->_s += h;
+    }
 }
 
 template <typename magnetic_field_t, typename algebra_t, typename constraint_t,
           typename policy_t, typename inspector_t,
-          template <typename, std::size_t> class array_t>
+          template <typename, std::size_t> class array_t,
+          typename accumulator_t, bool transport_jacobian>
+DETRAY_HOST_DEVICE void
+detray::rk_stepper<magnetic_field_t, algebra_t, constraint_t, policy_t,
+                   inspector_t, array_t, accumulator_t,
+                   transport_jacobian>::state::sync_accumulators() {
+
+    if constexpr (is_mixed_precision) {
+        auto& acc = this->_acc;
+        const point3_type pos = this->_track.pos();
+
+        // The track position was set from outside the stepper (e.g. by an
+        // actor)
+        if (static_cast<scalar_type>(acc.pos[0]) != pos[0] ||
+            static_cast<scalar_type>(acc.pos[1]) != pos[1] ||
+            static_cast<scalar_type>(acc.pos[2]) != pos[2]) {
+            for (unsigned int i = 0u; i < 3u; ++i) {
+                acc.pos[i] = static_cast<accumulator_t>(pos[i]);
+            }
+        }
+        if (static_cast<scalar_type>(acc.path_length) != this->_path_length) {
+            acc.path_length = static_cast<accumulator_t>(this->_path_length);
+        }
+        if (static_cast<scalar_type>(acc.abs_path_length) !=
+            this->_abs_path_length) {
+            acc.abs_path_length =
+                static_cast<accumulator_t>(this->_abs_path_length);
+        }
+        if (static_cast<scalar_type>(acc.s) != this->_s) {
+            acc.s = static_cast<accumulator_t>(this->_s);
+        }
+    }
+}
+
+template <typename magnetic_field_t, typename algebra_t, typename constraint_t,
+          typename policy_t, typename inspector_t,
+          template <typename, std::size_t> class array_t,
+          typename accumulator_t, bool transport_jacobian>
 DETRAY_HOST_DEVICE void detray::rk_stepper<
-    magnetic_field_t, algebra_t, constraint_t, policy_t, inspector_t, array_t>::
-    state::advance_jacobian(const detray::stepping::config<scalar_type>& cfg) {
+    magnetic_field_t, algebra_t, constraint_t, policy_t, inspector_t, array_t,
+    accumulator_t, transport_jacobian>::state::
+    advance_jacobian(const detray::stepping::config<scalar_type>& cfg) {
     /// The calculations are based on ATL-SOFT-PUB-2009-002. The update of the
     /// Jacobian matrix is requires only the calculation of eq. 17 and 18.
     /// Since the terms of eq. 18 are currently 0, this matrix is not needed
@@ -403,12 +466,14 @@ DETRAY_HOST_DEVICE void detray::rk_stepper<
 
 template <typename magnetic_field_t, typename algebra_t, typename constraint_t,
           typename policy_t, typename inspector_t,
-          template <typename, std::size_t> class array_t>
+          template <typename, std::size_t> class array_t,
+          typename accumulator_t, bool transport_jacobian>
 DETRAY_HOST_DEVICE auto detray::rk_stepper<
-    magnetic_field_t, algebra_t, constraint_t, policy_t, inspector_t, array_t>::
-    state::evaluate_dqopds(const std::size_t i, const scalar_type h,
-                           const scalar dqopds_prev,
-                           const detray::stepping::config<scalar_type>& cfg)
+    magnetic_field_t, algebra_t, constraint_t, policy_t, inspector_t, array_t,
+    accumulator_t, transport_jacobian>::state::
+    evaluate_dqopds(const std::size_t i, const scalar_type h,
+                    const scalar dqopds_prev,
+                    const detray::stepping::config<scalar_type>& cfg)
         -> scalar_type {
 
     const auto& track = this->_track;
@@ -440,13 +505,17 @@ DETRAY_HOST_DEVICE auto detray::rk_stepper<
 
 template <typename magnetic_field_t, typename algebra_t, typename constraint_t,
           typename policy_t, typename inspector_t,
-          template <typename, std::size_t> class array_t>
+          template <typename, std::size_t> class array_t,
+          typename accumulator_t, bool transport_jacobian>
 DETRAY_HOST_DEVICE auto detray::rk_stepper<
     magnetic_field_t, algebra_t, constraint_t, policy_t, inspector_t,
-    array_t>::state::evaluate_dtds(const vector3_type& b_field,
-                                   const std::size_t i, const scalar_type h,
-                                   const vector3_type& dtds_prev,
-                                   const scalar_type qop) -> vector3_type {
+    array_t, accumulator_t,
+    transport_jacobian>::state::evaluate_dtds(const vector3_type& b_field,
+                                              const std::size_t i,
+                                              const scalar_type h,
+                                              const vector3_type& dtds_prev,
+                                              const scalar_type qop)
+    -> vector3_type {
     auto& track = this->_track;
     const auto dir = track.dir();
     auto& sd = this->_step_data;
@@ -464,11 +533,32 @@ DETRAY_HOST_DEVICE auto detray::rk_stepper<
 
 template <typename magnetic_field_t, typename algebra_t, typename constraint_t,
           typename policy_t, typename inspector_t,
-          template <typename, std::size_t> class array_t>
+          template <typename, std::size_t> class array_t,
+          typename accumulator_t, bool transport_jacobian>
 DETRAY_HOST_DEVICE auto detray::rk_stepper<
     magnetic_field_t, algebra_t, constraint_t, policy_t, inspector_t,
-    array_t>::state::evaluate_field_gradient(const point3_type& pos)
-    -> matrix_type<3, 3> {
+    array_t, accumulator_t,
+    transport_jacobian>::state::evaluate_field(const point3_type& pos) const
+    -> vector3_type {
+
+    const auto bvec_tmp = this->_magnetic_field.at(pos[0], pos[1], pos[2]);
+    vector3_type bvec;
+    bvec[0u] = bvec_tmp[0u];
+    bvec[1u] = bvec_tmp[1u];
+    bvec[2u] = bvec_tmp[2u];
+
+    return bvec;
+}
+
+template <typename magnetic_field_t, typename algebra_t, typename constraint_t,
+          typename policy_t, typename inspector_t,
+          template <typename, std::size_t> class array_t,
+          typename accumulator_t, bool transport_jacobian>
+DETRAY_HOST_DEVICE auto detray::rk_stepper<
+    magnetic_field_t, algebra_t, constraint_t, policy_t, inspector_t,
+    array_t, accumulator_t,
+    transport_jacobian>::state::evaluate_field_gradient(const point3_type& pos)
+    const -> matrix_type<3, 3> {
 
     matrix_type<3, 3> dBdr = matrix_operator().template zero<3, 3>();
 
@@ -478,21 +568,11 @@ DETRAY_HOST_DEVICE auto detray::rk_stepper<
 
         point3_type dpos1 = pos;
         dpos1[i] += delta;
-        const auto bvec1_tmp =
-            this->_magnetic_field.at(dpos1[0], dpos1[1], dpos1[2]);
-        vector3_type bvec1;
-        bvec1[0u] = bvec1_tmp[0u];
-        bvec1[1u] = bvec1_tmp[1u];
-        bvec1[2u] = bvec1_tmp[2u];
+        const vector3_type bvec1 = evaluate_field(dpos1);
 
         point3_type dpos2 = pos;
         dpos2[i] -= delta;
-        const auto bvec2_tmp =
-            this->_magnetic_field.at(dpos2[0], dpos2[1], dpos2[2]);
-        vector3_type bvec2;
-        bvec2[0u] = bvec2_tmp[0u];
-        bvec2[1u] = bvec2_tmp[1u];
-        bvec2[2u] = bvec2_tmp[2u];
+        const vector3_type bvec2 = evaluate_field(dpos2);
 
         const vector3_type gradient = (bvec1 - bvec2) * (1.f / (2.f * delta));
 
@@ -506,10 +586,13 @@ DETRAY_HOST_DEVICE auto detray::rk_stepper<
 
 template <typename magnetic_field_t, typename algebra_t, typename constraint_t,
           typename policy_t, typename inspector_t,
-          template <typename, std::size_t> class array_t>
+          template <typename, std::size_t> class array_t,
+          typename accumulator_t, bool transport_jacobian>
 DETRAY_HOST_DEVICE auto
 detray::rk_stepper<magnetic_field_t, algebra_t, constraint_t, policy_t,
-                   inspector_t, array_t>::state::dtds() const -> vector3_type {
+                   inspector_t, array_t, accumulator_t,
+                   transport_jacobian>::state::dtds() const
+    -> vector3_type {
 
     // In case there was no step before
     if (this->_path_length == 0.f) {
@@ -528,10 +611,13 @@ detray::rk_stepper<magnetic_field_t, algebra_t, constraint_t, policy_t,
 
 template <typename magnetic_field_t, typename algebra_t, typename constraint_t,
           typename policy_t, typename inspector_t,
-          template <typename, std::size_t> class array_t>
+          template <typename, std::size_t> class array_t,
+          typename accumulator_t, bool transport_jacobian>
 DETRAY_HOST_DEVICE auto
 detray::rk_stepper<magnetic_field_t, algebra_t, constraint_t, policy_t,
-                   inspector_t, array_t>::state::dqopds() const -> scalar_type {
+                   inspector_t, array_t, accumulator_t,
+                   transport_jacobian>::state::dqopds() const
+    -> scalar_type {
 
     // In case there was no step before
     if (this->_path_length == 0.f) {
@@ -543,10 +629,13 @@ detray::rk_stepper<magnetic_field_t, algebra_t, constraint_t, policy_t,
 
 template <typename magnetic_field_t, typename algebra_t, typename constraint_t,
           typename policy_t, typename inspector_t,
-          template <typename, std::size_t> class array_t>
+          template <typename, std::size_t> class array_t,
+          typename accumulator_t, bool transport_jacobian>
 DETRAY_HOST_DEVICE auto detray::rk_stepper<
     magnetic_field_t, algebra_t, constraint_t, policy_t, inspector_t,
-    array_t>::state::dqopds(const scalar_type qop) const -> scalar_type {
+    array_t, accumulator_t,
+    transport_jacobian>::state::dqopds(const scalar_type qop) const
+    -> scalar_type {
 
     // d(qop)ds is zero for empty space
     if (this->_mat == nullptr) {
@@ -576,10 +665,13 @@ DETRAY_HOST_DEVICE auto detray::rk_stepper<
 
 template <typename magnetic_field_t, typename algebra_t, typename constraint_t,
           typename policy_t, typename inspector_t,
-          template <typename, std::size_t> class array_t>
+          template <typename, std::size_t> class array_t,
+          typename accumulator_t, bool transport_jacobian>
 DETRAY_HOST_DEVICE auto detray::rk_stepper<
     magnetic_field_t, algebra_t, constraint_t, policy_t, inspector_t,
-    array_t>::state::d2qopdsdqop(const scalar_type qop) const -> scalar_type {
+    array_t, accumulator_t,
+    transport_jacobian>::state::d2qopdsdqop(const scalar_type qop) const
+    -> scalar_type {
 
     if (this->_mat == nullptr) {
         return 0.f;
@@ -618,18 +710,23 @@ DETRAY_HOST_DEVICE auto detray::rk_stepper<
 
 template <typename magnetic_field_t, typename algebra_t, typename constraint_t,
           typename policy_t, typename inspector_t,
-          template <typename, std::size_t> class array_t>
+          template <typename, std::size_t> class array_t,
+          typename accumulator_t, bool transport_jacobian>
 template <typename propagation_state_t>
 DETRAY_HOST_DEVICE bool detray::rk_stepper<
     magnetic_field_t, algebra_t, constraint_t, policy_t, inspector_t,
-    array_t>::step(propagation_state_t& propagation,
-                   const detray::stepping::config<scalar_type>& cfg) {
+    array_t, accumulator_t,
+    transport_jacobian>::step(propagation_state_t& propagation,
+                              const detray::stepping::config<scalar_type>&
+                                  cfg) {
 
     // Get stepper and navigator states
     state& stepping = propagation._stepping;
-    auto& magnetic_field = stepping._magnetic_field;
     auto& navigation = propagation._navigation;
 
+    // Whether the step size of the error control is cut by the navigation
+    bool is_cut{math::abs(navigation()) < math::abs(stepping._step_size)};
+
     if (stepping._step_size == 0.f) {
         stepping._step_size = cfg.min_stepsize;
     } else if (stepping._step_size > 0) {
@@ -647,15 +744,23 @@ DETRAY_HOST_DEVICE bool detray::rk_stepper<
         stepping._mat = nullptr;
     }
 
+    // Limit the step size in volume material to a fraction of X0
+    if (stepping._mat != nullptr &&
+        cfg.max_step_in_X0 < std::numeric_limits<scalar_type>::max()) {
+        const scalar_type max_step{cfg.max_step_in_X0 * stepping._mat->X0()};
+        if (math::abs(stepping._step_size) > max_step) {
+            stepping._step_size =
+                math::copysign(max_step, stepping._step_size);
+            is_cut = true;
+        }
+    }
+
     auto& sd = stepping._step_data;
 
     scalar_type error_estimate{0.f};
 
     // First Runge-Kutta point
-    const auto bvec = magnetic_field.at(pos[0], pos[1], pos[2]);
-    sd.b_first[0] = bvec[0];
-    sd.b_first[1] = bvec[1];
-    sd.b_first[2] = bvec[2];
+    sd.b_first = stepping.evaluate_field(pos);
 
     // qop should be recalcuated at every point
     // Reference: Eq (84) of https://doi.org/10.1016/0029-554X(81)90063-X
@@ -673,10 +778,7 @@ DETRAY_HOST_DEVICE bool detray::rk_stepper<
         // Eq (84) of https://doi.org/10.1016/0029-554X(81)90063-X
         const point3_type pos1 =
             pos + half_h * sd.t[0u] + h2 * 0.125f * sd.dtds[0u];
-        const auto bvec1 = magnetic_field.at(pos1[0], pos1[1], pos1[2]);
-        sd.b_middle[0] = bvec1[0];
-        sd.b_middle[1] = bvec1[1];
-        sd.b_middle[2] = bvec1[2];
+        sd.b_middle = stepping.evaluate_field(pos1);
 
         sd.dqopds[1u] =
             stepping.evaluate_dqopds(1u, half_h, sd.dqopds[0u], cfg);
@@ -695,10 +797,7 @@ DETRAY_HOST_DEVICE bool detray::rk_stepper<
         // qop should be recalcuated at every point
         // Eq (84) of https://doi.org/10.1016/0029-554X(81)90063-X
         const point3_type pos2 = pos + h * sd.t[0u] + h2 * 0.5f * sd.dtds[2u];
-        const auto bvec2 = magnetic_field.at(pos2[0], pos2[1], pos2[2]);
-        sd.b_last[0] = bvec2[0];
-        sd.b_last[1] = bvec2[1];
-        sd.b_last[2] = bvec2[2];
+        sd.b_last = stepping.evaluate_field(pos2);
 
         sd.dqopds[3u] = stepping.evaluate_dqopds(3u, h, sd.dqopds[2u], cfg);
         sd.dtds[3u] =
@@ -741,6 +840,7 @@ DETRAY_HOST_DEVICE bool detray::rk_stepper<
                     math::sqrt(math::sqrt(cfg.rk_error_tol / error));
 
                 stepping._step_size *= step_size_scaling;
+                is_cut = false;
 
                 // Run inspection while the stepsize is getting adjusted
                 stepping.run_inspector(cfg, "Adjust stepsize: ", i_t + 1,
@@ -775,14 +875,26 @@ DETRAY_HOST_DEVICE bool detray::rk_stepper<
 
         stepping.set_step_size(
             stepping.constraints().template size<>(stepping.direction()));
+        is_cut = true;
     }
 
     // Advance track state
     stepping.advance_track();
 
-    // Advance jacobian transport
-    if (cfg.do_covariance_transport) {
-        stepping.advance_jacobian(cfg);
+    // Accumulate the volume material for the multiple scattering, which is
+    // added to the covariance on the next surface
+    if (cfg.do_volume_scattering && stepping._mat != nullptr) {
+        stepping._path_in_X0 +=
+            math::abs(stepping._step_size) / stepping._mat->X0();
+        stepping._path_in_material += math::abs(stepping._step_size);
+    }
+
+    // Advance jacobian transport (compiled out if it is disabled)
+    if constexpr (transport_jacobian) {
+        if (cfg.do_covariance_transport &&
+            stepping.do_covariance_transport()) {
+            stepping.advance_jacobian(cfg);
+        }
     }
 
     // Call navigation update policy
@@ -798,6 +910,7 @@ DETRAY_HOST_DEVICE bool detray::rk_stepper<
 
     // Update the step size
     stepping._step_size *= step_size_scaling;
+    stepping.update_suggested_step_size(stepping._step_size, is_cut);
 
     // Run final inspection
     stepping.run_inspector(cfg, "Step complete: ");
@@ -43,6 +43,11 @@ struct config {
     bool use_field_gradient{false};
     /// Do covariance transport
     bool do_covariance_transport{true};
+    /// Accumulate the multiple scattering in the volume material over the
+    /// steps and add it to the covariance on the next surface
+    bool do_volume_scattering{false};
+    /// Maximal step size in volume material in units of its radiation length
+    scalar_t max_step_in_X0{std::numeric_limits<scalar_t>::max()};
 };
 
 }  // namespace detray::stepping
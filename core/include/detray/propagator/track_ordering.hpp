@@ -0,0 +1,143 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/units.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+namespace detray::propagation {
+
+/// Configuration of the spatial ordering of a track batch
+template <typename scalar_t>
+struct ordering_config {
+    /// The pseudorapidity is binned in [-eta_max, eta_max]
+    scalar_t eta_max{4.f};
+    /// Number of momentum buckets, uniform in |q/p|
+    unsigned int n_qop_bins{4u};
+    /// Largest |q/p| that is binned
+    scalar_t qop_max{1.f / (100.f * unit<scalar_t>::MeV)};
+};
+
+namespace detail {
+
+/// Number of bits per coordinate in the Morton code
+inline constexpr unsigned int n_morton_bits{10u};
+
+/// @returns the lower ten bits of @param v , spread out such that two zero
+/// bits lie between them
+DETRAY_HOST_DEVICE constexpr std::uint32_t spread_bits_3D(std::uint32_t v) {
+    v &= 0x3ffu;
+    v = (v | (v << 16u)) & 0x030000ffu;
+    v = (v | (v << 8u)) & 0x0300f00fu;
+    v = (v | (v << 4u)) & 0x030c30c3u;
+    v = (v | (v << 2u)) & 0x09249249u;
+    return v;
+}
+
+/// @returns the value @param u in [0, 1] as an integer coordinate of the
+/// Morton code
+template <typename scalar_t>
+DETRAY_HOST_DEVICE constexpr std::uint32_t morton_coordinate(scalar_t u) {
+    constexpr std::uint32_t n_cells{1u << n_morton_bits};
+    u = u < 0.f ? 0.f : (u > 1.f ? 1.f : u);
+    const auto c{
+        static_cast<std::uint32_t>(u * static_cast<scalar_t>(n_cells))};
+    return c < n_cells ? c : n_cells - 1u;
+}
+
+}  // namespace detail
+
+/// Sort key that places tracks with similar direction and momentum close to
+/// each other: The Morton (Z-order) code of the pseudorapidity, the
+/// azimuthal angle and the momentum bucket of the track.
+///
+/// @param track the track parameters
+/// @param cfg the binning of the coordinates
+///
+/// @returns the 30 bit key
+template <typename track_t, typename scalar_t>
+DETRAY_HOST_DEVICE inline std::uint32_t spatial_key(
+    const track_t &track, const ordering_config<scalar_t> &cfg) {
+    assert(cfg.n_qop_bins > 0u);
+    assert(cfg.eta_max > 0.f);
+
+    constexpr scalar_t pi{constant<scalar_t>::pi};
+
+    const auto dir = track.dir();
+    const auto dx{static_cast<scalar_t>(dir[0])};
+    const auto dy{static_cast<scalar_t>(dir[1])};
+    const auto dz{static_cast<scalar_t>(dir[2])};
+
+    // Pseudorapidity from the longitudinal direction, clamped to the range
+    const scalar_t cos_max{math::tanh(cfg.eta_max)};
+    const scalar_t cos_theta{dz < -cos_max ? -cos_max
+                                           : (dz > cos_max ? cos_max : dz)};
+    const scalar_t eta{math::atanh(cos_theta)};
+
+    const scalar_t phi{math::atan2(dy, dx)};
+
+    const scalar_t u_qop{
+        math::min(math::abs(static_cast<scalar_t>(track.qop())) / cfg.qop_max,
+                  static_cast<scalar_t>(1))};
+    const unsigned int qop_bin{math::min(
+        static_cast<unsigned int>(u_qop *
+                                  static_cast<scalar_t>(cfg.n_qop_bins)),
+        cfg.n_qop_bins - 1u)};
+
+    const std::uint32_t x{
+        detail::morton_coordinate(0.5f * (eta / cfg.eta_max + 1.f))};
+    const std::uint32_t y{
+        detail::morton_coordinate((phi + pi) / (2.f * pi))};
+    const std::uint32_t z{detail::morton_coordinate(
+        static_cast<scalar_t>(qop_bin) /
+        static_cast<scalar_t>(cfg.n_qop_bins))};
+
+    return detail::spread_bits_3D(x) | (detail::spread_bits_3D(y) << 1u) |
+           (detail::spread_bits_3D(z) << 2u);
+}
+
+/// Order a batch of tracks by their spatial keys, so that neighboring tracks
+/// traverse the same detector regions.
+///
+/// The tracks themselves are not moved: Pass the order to the batch
+/// propagation through an @c ordered_executor . The results are then still
+/// written in the input order of the tracks.
+///
+/// @param tracks the track batch
+/// @param order the track indices in the order of their keys, one entry per
+///              track
+/// @param cfg the binning of the spatial key
+template <typename track_range_t, typename index_range_t, typename scalar_t>
+DETRAY_HOST inline void spatial_order(const track_range_t &tracks,
+                                      index_range_t &order,
+                                      const ordering_config<scalar_t> &cfg) {
+    assert(order.size() == tracks.size());
+
+    std::vector<std::uint32_t> keys;
+    keys.reserve(tracks.size());
+    for (const auto &track : tracks) {
+        keys.push_back(spatial_key(track, cfg));
+    }
+
+    std::iota(order.begin(), order.end(), 0u);
+    std::stable_sort(order.begin(), order.end(),
+                     [&keys](const auto idx_a, const auto idx_b) {
+                         return keys[idx_a] < keys[idx_b];
+                     });
+}
+
+}  // namespace detray::propagation
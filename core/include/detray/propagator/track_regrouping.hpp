@@ -0,0 +1,78 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cassert>
+
+namespace detray::propagation {
+
+/// Sort key that groups tracks by their current volume and, within a volume,
+/// by their momentum.
+///
+/// @param propagation the propagation state of the track
+/// @param n_qop_bins number of momentum bins per volume
+/// @param qop_max largest |q/p| that is binned, the bins are uniform in |q/p|
+///
+/// @returns the key, which is smaller for lower volume indices
+template <typename state_t, typename scalar_t>
+DETRAY_HOST_DEVICE inline unsigned int regroup_key(
+    const state_t &propagation, const unsigned int n_qop_bins,
+    const scalar_t qop_max) {
+    assert(n_qop_bins > 0u);
+
+    const auto &track = propagation._stepping();
+    const scalar_t u{
+        math::min(math::abs(track.qop()) / qop_max, static_cast<scalar_t>(1))};
+    const unsigned int qop_bin{math::min(
+        static_cast<unsigned int>(u * static_cast<scalar_t>(n_qop_bins)),
+        n_qop_bins - 1u)};
+
+    return static_cast<unsigned int>(propagation._navigation.volume()) *
+               n_qop_bins +
+           qop_bin;
+}
+
+/// Remove the finished tracks from a list of track indices and regroup the
+/// live tracks by their sort keys (stream compaction).
+///
+/// @param indices the indices of the tracks that are still in flight. On
+///                return, the first entries are the live tracks in the order
+///                of their keys
+/// @param n_tracks the number of valid entries in @param indices
+/// @param is_alive whether a track (by track index) is still alive
+/// @param keys the sort key of every track (by track index)
+///
+/// @returns the number of live tracks
+template <typename index_range_t, typename flag_range_t,
+          typename key_range_t>
+DETRAY_HOST inline unsigned int regroup_tracks(index_range_t &indices,
+                                               const unsigned int n_tracks,
+                                               const flag_range_t &is_alive,
+                                               const key_range_t &keys) {
+    assert(n_tracks <= indices.size());
+
+    auto first = indices.begin();
+    auto last = std::stable_partition(
+        first, first + n_tracks, [&is_alive](const auto idx) {
+            return static_cast<bool>(is_alive[idx]);
+        });
+
+    std::stable_sort(first, last, [&keys](const auto idx_a, const auto idx_b) {
+        return keys[idx_a] < keys[idx_b];
+    });
+
+    return static_cast<unsigned int>(last - first);
+}
+
+}  // namespace detray::propagation
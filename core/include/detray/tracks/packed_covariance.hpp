@@ -0,0 +1,141 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/track_parametrization.hpp"
+
+// System include(s).
+#include <cassert>
+#include <cstddef>
+
+namespace detray {
+
+/// @brief Covariance matrix in packed symmetric storage.
+///
+/// Only the upper triangle of the symmetric N x N matrix is kept, row by
+/// row, which needs N(N + 1)/2 instead of N^2 values (21 instead of 36 for
+/// the bound covariance). The covariance can be transported and updated
+/// without unpacking it into a dense matrix of the algebra plugin.
+///
+/// @tparam algebra_t the algebra plugin, which provides the dense matrices
+/// @tparam N the dimension of the covariance
+template <typename algebra_t, std::size_t N = e_bound_size>
+class packed_covariance {
+
+    public:
+    using algebra_type = algebra_t;
+    using scalar_type = dscalar<algebra_t>;
+    using matrix_operator = dmatrix_operator<algebra_t>;
+    /// Dense matrix type of the algebra plugin
+    using matrix_type = dmatrix<algebra_t, N, N>;
+
+    /// Number of stored values
+    static constexpr std::size_t n_elements{N * (N + 1u) / 2u};
+
+    /// Default constructor: zero covariance
+    constexpr packed_covariance() = default;
+
+    /// Construct from the upper triangle of the dense covariance @param cov
+    DETRAY_HOST_DEVICE
+    explicit packed_covariance(const matrix_type &cov) {
+        for (unsigned int i = 0u; i < N; ++i) {
+            for (unsigned int j = i; j < N; ++j) {
+                m_data[index(i, j)] = matrix_operator().element(cov, i, j);
+            }
+        }
+    }
+
+    /// @returns the position of the element (@param i, @param j) in the
+    /// packed storage
+    DETRAY_HOST_DEVICE
+    static constexpr std::size_t index(const unsigned int i,
+                                       const unsigned int j) {
+        assert(i < N && j < N);
+        // Use the upper triangle
+        const unsigned int row{i < j ? i : j};
+        const unsigned int col{i < j ? j : i};
+        return row * (2u * N - row + 1u) / 2u + (col - row);
+    }
+
+    /// @returns the element (@param i, @param j) - const
+    DETRAY_HOST_DEVICE
+    constexpr scalar_type operator()(const unsigned int i,
+                                     const unsigned int j) const {
+        return m_data[index(i, j)];
+    }
+
+    /// @returns the element (@param i, @param j), which is the same storage
+    /// as (@param j, @param i) - non-const
+    DETRAY_HOST_DEVICE
+    constexpr scalar_type &operator()(const unsigned int i,
+                                      const unsigned int j) {
+        return m_data[index(i, j)];
+    }
+
+    /// Add @param var to the variance of the parameter @param i
+    DETRAY_HOST_DEVICE
+    constexpr void add_variance(const unsigned int i, const scalar_type var) {
+        m_data[index(i, i)] += var;
+    }
+
+    /// @returns the dense covariance matrix
+    DETRAY_HOST_DEVICE
+    matrix_type to_matrix() const {
+        matrix_type cov{matrix_operator().template zero<N, N>()};
+        for (unsigned int i = 0u; i < N; ++i) {
+            for (unsigned int j = 0u; j < N; ++j) {
+                matrix_operator().element(cov, i, j) = m_data[index(i, j)];
+            }
+        }
+        return cov;
+    }
+
+    /// @brief Transport the covariance with the jacobian @param jac .
+    ///
+    /// Computes J * C * J^T and stores only its upper triangle.
+    DETRAY_HOST_DEVICE
+    packed_covariance transport(const matrix_type &jac) const {
+
+        // J * C
+        scalar_type jac_cov[N][N];
+        for (unsigned int i = 0u; i < N; ++i) {
+            for (unsigned int j = 0u; j < N; ++j) {
+                scalar_type v{0.f};
+                for (unsigned int k = 0u; k < N; ++k) {
+                    v += matrix_operator().element(jac, i, k) *
+                         m_data[index(k, j)];
+                }
+                jac_cov[i][j] = v;
+            }
+        }
+
+        // (J * C) * J^T
+        packed_covariance result{};
+        for (unsigned int i = 0u; i < N; ++i) {
+            for (unsigned int j = i; j < N; ++j) {
+                scalar_type v{0.f};
+                for (unsigned int k = 0u; k < N; ++k) {
+                    v += jac_cov[i][k] * matrix_operator().element(jac, j, k);
+                }
+                result.m_data[index(i, j)] = v;
+            }
+        }
+
+        return result;
+    }
+
+    private:
+    /// Upper triangle, row by row
+    darray<scalar_type, n_elements> m_data{};
+};
+
+}  // namespace detray
@@ -0,0 +1,157 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/utils/inspectors.hpp"
+#include "detray/utils/invalid_values.hpp"
+
+// System include(s)
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+namespace detray {
+
+namespace detail {
+
+/// @returns the name of the navigation call @param kind
+inline const char *to_string(const navigation::trace_record::call kind) {
+    switch (kind) {
+        case navigation::trace_record::call::e_init:
+            return "init";
+        case navigation::trace_record::call::e_update:
+            return "update";
+        case navigation::trace_record::call::e_abort:
+            return "abort";
+        case navigation::trace_record::call::e_exit:
+            return "exit";
+        default:
+            return "other";
+    };
+}
+
+/// @returns the name of the navigation status @param nav_status
+inline const char *to_string(const navigation::status nav_status) {
+    switch (nav_status) {
+        case navigation::status::e_overflow:
+            return "overflow";
+        case navigation::status::e_abort:
+            return "abort";
+        case navigation::status::e_on_target:
+            return "on_target";
+        case navigation::status::e_towards_object:
+            return "towards_object";
+        case navigation::status::e_on_module:
+            return "on_module";
+        case navigation::status::e_on_portal:
+            return "on_portal";
+        default:
+            return "unknown";
+    };
+}
+
+/// Write the index @param idx to the stream @param os, or 'null' if invalid
+template <typename index_t>
+inline void write_json_index(std::ostream &os, const index_t idx) {
+    if (detail::is_invalid_value(idx)) {
+        os << "null";
+    } else {
+        os << idx;
+    }
+}
+
+}  // namespace detail
+
+/// Append the records that are held by the trace inspector @param insp to
+/// @param records, oldest first
+template <std::size_t kCAPACITY>
+DETRAY_HOST void collect_trace(
+    const navigation::trace_inspector<kCAPACITY> &insp,
+    std::vector<navigation::trace_record> &records) {
+    for (std::size_t i = 0u; i < insp.size(); ++i) {
+        records.push_back(insp[i]);
+    }
+}
+
+/// @brief Write navigation trace records as Chrome trace event JSON.
+///
+/// The output can be loaded into 'chrome://tracing' or the Perfetto UI
+/// ('ui.perfetto.dev'). Every track is shown as a thread of its own. Every
+/// navigation call is a complete event that lasts until the next call on the
+/// same track, the last call of a track is an instant event. The record
+/// data is attached to the events as arguments.
+///
+/// @param os the output stream
+/// @param records the trace records of one or more tracks
+/// @param ticks_per_us clock ticks of the timestamps per microsecond, which
+///                     is the time unit of the trace format
+DETRAY_HOST inline void write_chrome_trace(
+    std::ostream &os, std::vector<navigation::trace_record> records,
+    const double ticks_per_us = 1.) {
+
+    using record_t = navigation::trace_record;
+
+    // Group the records by track, in the order in which they were written
+    std::stable_sort(records.begin(), records.end(),
+                     [](const record_t &a, const record_t &b) {
+                         return a.track_id < b.track_id ||
+                                (a.track_id == b.track_id &&
+                                 a.timestamp < b.timestamp);
+                     });
+
+    // Start the timeline at the first record
+    std::uint64_t t0{0u};
+    if (!records.empty()) {
+        t0 = std::min_element(records.begin(), records.end(),
+                              [](const record_t &a, const record_t &b) {
+                                  return a.timestamp < b.timestamp;
+                              })
+                 ->timestamp;
+    }
+    const auto to_us = [t0, ticks_per_us](const std::uint64_t ticks) {
+        return static_cast<double>(ticks - t0) / ticks_per_us;
+    };
+
+    const auto precision{os.precision(15)};
+
+    os << "{\"traceEvents\":[";
+    for (std::size_t i = 0u; i < records.size(); ++i) {
+        const record_t &rec = records[i];
+        const bool is_last{i + 1u == records.size() ||
+                           records[i + 1u].track_id != rec.track_id};
+
+        os << (i == 0u ? "" : ",") << "\n{\"name\":\""
+           << detail::to_string(rec.kind) << "\",\"cat\":\"navigation\""
+           << ",\"ph\":\"" << (is_last ? "i" : "X")
+           << "\",\"ts\":" << to_us(rec.timestamp);
+        if (is_last) {
+            os << ",\"s\":\"t\"";
+        } else {
+            os << ",\"dur\":"
+               << to_us(records[i + 1u].timestamp) - to_us(rec.timestamp);
+        }
+        os << ",\"pid\":0,\"tid\":" << rec.track_id << ",\"args\":{\"step\":"
+           << rec.step << ",\"volume\":";
+        detail::write_json_index(os, rec.volume);
+        os << ",\"surface\":";
+        detail::write_json_index(os, rec.surface);
+        os << ",\"status\":\""
+           << detail::to_string(static_cast<navigation::status>(rec.nav_status))
+           << "\",\"step_size\":" << rec.step_size << "}}";
+    }
+    os << "\n],\"displayTimeUnit\":\"ns\"}" << std::endl;
+
+    os.precision(precision);
+}
+
+}  // namespace detray
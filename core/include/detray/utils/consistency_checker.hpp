@@ -11,13 +11,16 @@
 #include "detray/geometry/detector_volume.hpp"
 #include "detray/geometry/surface.hpp"
 #include "detray/materials/predefined_materials.hpp"
+#include "detray/utils/parallel_algorithms.hpp"
 #include "detray/utils/ranges.hpp"
 
 // System include(s)
+#include <cstdint>
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 namespace detray::detail {
 
@@ -224,12 +227,17 @@ inline void check_empty(const detector_t &det, const bool verbose) {
     // Check if there is at least one volume in the detector volume finder
     auto find_volumes =
         [](const typename detector_t::volume_finder &vf) -> bool {
-        for (const auto &v : vf.all()) {
-            if (not detail::is_invalid_value(v)) {
-                return true;
+        if constexpr (detail::is_two_level_volume_finder_v<
+                          typename detector_t::volume_finder>) {
+            return not vf.empty();
+        } else {
+            for (const auto &v : vf.all()) {
+                if (not detail::is_invalid_value(v)) {
+                    return true;
+                }
             }
+            return false;
         }
-        return false;
     };
 
     // Fatal errors
@@ -279,18 +287,75 @@ inline void check_empty(const detector_t &det, const bool verbose) {
     }
 }
 
+/// How thoroughly the detector is checked
+enum class check_level : std::uint_least8_t {
+    /// Check the indices and links of the volumes and surfaces and that every
+    /// surface is registered in its volume (e.g. at the start of a job)
+    e_light = 0u,
+    /// Also check every entry of the acceleration data structures and the
+    /// material
+    e_full = 1u,
+};
+
+/// A functor that marks the surfaces that are registered in the acceleration
+/// data structures of a volume and checks them on the way
+struct surface_registration {
+
+    /// Mark the surface @param sf_descr of the volume @param vol_idx in
+    /// @param registered
+    template <typename detector_t>
+    DETRAY_HOST void operator()(
+        const typename detector_t::surface_type &sf_descr,
+        const detector_t &det, const dindex vol_idx, const check_level level,
+        std::vector<std::uint8_t> &registered) const {
+
+        if (level == check_level::e_full) {
+            surface_checker{}(sf_descr, det, vol_idx);
+        } else if (sf_descr.volume() != vol_idx) {
+            std::stringstream err_stream{};
+            err_stream << "ERROR: Incorrect volume index on surface: vol "
+                       << vol_idx << ", sf: " << surface{det, sf_descr};
+
+            throw std::invalid_argument(err_stream.str());
+        }
+
+        // Only the volume of the surface writes its flag
+        if (sf_descr.index() < registered.size()) {
+            registered[sf_descr.index()] = 1u;
+        }
+    }
+};
+
 /// @brief Checks the internal consistency of a detector
+///
+/// The volumes and the surfaces are checked independently of each other on
+/// @param n_threads host threads. If several of them are broken, the error
+/// of the one with the lowest index is reported.
+///
+/// @param det the detector
+/// @param verbose print the empty data stores
+/// @param level how thoroughly to check the detector
+/// @param n_threads number of host threads
 template <typename detector_t>
 inline bool check_consistency(const detector_t &det,
-                              const bool verbose = false) {
+                              const bool verbose = false,
+                              const check_level level = check_level::e_full,
+                              const unsigned int n_threads = 1u) {
     check_empty(det, verbose);
 
-    std::stringstream err_stream{};
+    const bool full_check{level == check_level::e_full};
+
+    // Surfaces that were found in their volume's acceleration data structures
+    std::vector<std::uint8_t> registered(det.surfaces().size(), 0u);
+
     // Check the volumes
-    for (const auto &[idx, vol_desc] :
-         detray::views::enumerate(det.volumes())) {
+    auto check_volume = [&det, &registered, level,
+                         full_check](const auto &idx_and_desc) {
+        const auto &[idx, vol_desc] = idx_and_desc;
         const auto vol = detector_volume{det, vol_desc};
 
+        std::stringstream err_stream{};
+
         // Check that nothing is obviously broken
         if (not vol.self_check(err_stream)) {
             throw std::invalid_argument(err_stream.str());
@@ -303,21 +368,30 @@ inline bool check_consistency(const detector_t &det,
             throw std::invalid_argument(err_stream.str());
         }
 
-        // Go through the acceleration data structures and check the surfaces
-        vol.template visit_surfaces<detail::surface_checker>(det, vol.index());
+        // Go through the acceleration data structures, check the surfaces
+        // and register them
+        vol.template visit_surfaces<detail::surface_registration>(
+            det, vol.index(), level, registered);
 
         // Check the volume material, if present
-        if (vol.has_material()) {
+        if (full_check and vol.has_material()) {
             vol.template visit_material<detail::material_checker>(
                 vol_desc.material().id());
         }
-    }
+    };
+
+    const detray::execution::host_threads_policy policy{n_threads, 1u};
+    detray::ranges::for_each(policy, detray::views::enumerate(det.volumes()),
+                             check_volume);
 
     // Check the surfaces in the detector's surface lookup
-    for (const auto &[idx, sf_desc] :
-         detray::views::enumerate(det.surfaces())) {
+    auto check_surface = [&det, &registered,
+                          full_check](const auto &idx_and_desc) {
+        const auto &[idx, sf_desc] = idx_and_desc;
         const auto sf = surface{det, sf_desc};
 
+        std::stringstream err_stream{};
+
         // Check that nothing is obviously broken
         if (not sf.self_check(err_stream)) {
             err_stream << "\nat surface no. " << std::to_string(idx);
@@ -334,13 +408,7 @@ inline bool check_consistency(const detector_t &det,
         // Check that the surface can be found in its volume's acceleration
         // data structures (if there are no grids, must at least be in the
         // brute force method)
-        const auto vol = detector_volume{det, sf.volume()};
-        bool is_registered = false;
-
-        vol.template visit_surfaces<detail::surface_checker>(
-            sf_desc, is_registered, det);
-
-        if (not is_registered) {
+        if (not registered[idx]) {
             err_stream << "ERROR: Found surface that is not part of its "
                        << "volume's navigation acceleration data structures:\n"
                        << "Surface: " << sf;
@@ -348,11 +416,15 @@ inline bool check_consistency(const detector_t &det,
         }
 
         // Check the surface material, if present
-        if (sf.has_material()) {
+        if (full_check and sf.has_material()) {
             sf.template visit_material<detail::material_checker>(
                 sf_desc.material().id());
         }
-    }
+    };
+
+    detray::ranges::for_each(
+        detray::execution::host_threads_policy{n_threads, 64u},
+        detray::views::enumerate(det.surfaces()), check_surface);
 
     return true;
 }
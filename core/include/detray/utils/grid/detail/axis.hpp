@@ -387,6 +387,60 @@ class multi_axis {
         return bin_ranges;
     }
 
+    /// @brief Get a bin range on every axis corresponding to the given point
+    /// and a separate neighborhood around it on every axis.
+    ///
+    /// @tparam neighbor_t the type of neighborhood defined on the axes around
+    ///                    the point
+    ///
+    /// @param p the point in the local coordinate system that is spanned
+    ///          by the axes.
+    /// @param nhoods the search window definition per axis (e.g. the window
+    ///               on the x-axis in entry 0)
+    ///
+    /// @returns a multi bin range that contains the resulting bin ranges for
+    ///          every axis in the corresponding entry (e.g. rng_x in entry 0)
+    template <typename neighbor_t>
+    DETRAY_HOST_DEVICE multi_bin_range<dim> bin_ranges(
+        const point_type &p,
+        const std::array<std::array<neighbor_t, 2>, dim> &nhoods) const {
+        // Empty bin ranges to be filled
+        multi_bin_range<dim> bin_ranges{};
+        // Run the range resolution for every axis in this multi-axis type
+        (get_axis_bin_ranges(get_axis<axis_ts>(), p, nhoods, bin_ranges), ...);
+
+        return bin_ranges;
+    }
+
+    /// @brief Get a bin range on every axis that covers the segment between
+    /// two points and the neighborhood around it.
+    ///
+    /// On circular axes, the segment takes the shorter way around the axis,
+    /// and the resulting range never covers a bin twice.
+    ///
+    /// @tparam neighbor_t the type of neighborhood defined on the axis around
+    ///                    the points
+    ///
+    /// @param p0 the first point in the local coordinate system that is
+    ///           spanned by the axes.
+    /// @param p1 the second point in the local coordinate system.
+    /// @param nhood the search window definition around either point.
+    ///
+    /// @returns a multi bin range that contains the resulting bin ranges for
+    ///          every axis in the corresponding entry (e.g. rng_x in entry 0)
+    template <typename neighbor_t>
+    DETRAY_HOST_DEVICE multi_bin_range<dim> bin_ranges(
+        const point_type &p0, const point_type &p1,
+        const std::array<neighbor_t, 2> &nhood) const {
+        // Empty bin ranges to be filled
+        multi_bin_range<dim> bin_ranges{};
+        // Run the range resolution for every axis in this multi-axis type
+        (get_axis_bin_ranges(get_axis<axis_ts>(), p0, p1, nhood, bin_ranges),
+         ...);
+
+        return bin_ranges;
+    }
+
     /// @returns a vecmem view on the axes data. Only allowed if it owns data.
     template <bool owner = is_owning, std::enable_if_t<owner, bool> = true>
     DETRAY_HOST auto get_data() -> view_type {
@@ -456,6 +510,79 @@ class multi_axis {
         bin_ranges.indices[loc_idx] = ax.range(p[loc_idx], nhood);
     }
 
+    /// Perform the bin lookup on a particular axis within the bin
+    /// neighborhood that is defined for this axis
+    ///
+    /// @tparam axis_t defines the axis for the lookup (axis types are unique)
+    /// @tparam neighbor_t the type of neighborhood defined on the axes around
+    ///                    the point
+    ///
+    /// @param [in] ax the axis that performs the lookup
+    /// @param [in] p the point to be looked up on the axis
+    /// @param [in] nhoods the neighborhoods around the point on every axis
+    /// @param [out] bin_ranges the multi-bin-range object that is filled with
+    ///                         the neighbor bin range
+    template <typename axis_t, typename neighbor_t>
+    DETRAY_HOST_DEVICE void get_axis_bin_ranges(
+        const axis_t &ax, const point_type &p,
+        const std::array<std::array<neighbor_t, 2>, dim> &nhoods,
+        multi_bin_range<dim> &bin_ranges) const {
+        // Get the index corresponding to the axis label (e.g. bin_range_x = 0)
+        constexpr auto loc_idx{axis_reg::to_index(axis_t::bounds_type::label)};
+        bin_ranges.indices[loc_idx] = ax.range(p[loc_idx], nhoods[loc_idx]);
+    }
+
+    /// Perform the bin lookup on a particular axis for the segment between
+    /// two points within a given bin neighborhood
+    ///
+    /// @tparam axis_t defines the axis for the lookup (axis types are unique)
+    /// @tparam neighbor_t the type of neighborhood defined on the axis around
+    ///                    the points
+    ///
+    /// @param [in] ax the axis that performs the lookup
+    /// @param [in] p0 the first point to be looked up on the axis
+    /// @param [in] p1 the second point to be looked up on the axis
+    /// @param [in] nhood the neighborhood around the points for the lookup
+    /// @param [out] bin_ranges the multi-bin-range object that is filled with
+    ///                         the neighbor bin range
+    template <typename axis_t, typename neighbor_t>
+    DETRAY_HOST_DEVICE void get_axis_bin_ranges(
+        const axis_t &ax, const point_type &p0, const point_type &p1,
+        const std::array<neighbor_t, 2> &nhood,
+        multi_bin_range<dim> &bin_ranges) const {
+        // Get the index corresponding to the axis label (e.g. bin_range_x = 0)
+        constexpr auto loc_idx{axis_reg::to_index(axis_t::bounds_type::label)};
+
+        const bin_range rng0 = ax.range(p0[loc_idx], nhood);
+        bin_range rng1 = ax.range(p1[loc_idx], nhood);
+
+        constexpr bool is_circular{axis_t::bounds_type::type ==
+                                   axis::bounds::e_circular};
+        const int n_bins{static_cast<int>(ax.nbins())};
+
+        // Take the shorter way around a circular axis
+        if constexpr (is_circular) {
+            const int shift{rng1[0] - rng0[0]};
+            if (2 * shift > n_bins) {
+                rng1 = {rng1[0] - n_bins, rng1[1] - n_bins};
+            } else if (2 * shift < -n_bins) {
+                rng1 = {rng1[0] + n_bins, rng1[1] + n_bins};
+            }
+        }
+
+        bin_range rng{rng0[0] < rng1[0] ? rng0[0] : rng1[0],
+                      rng0[1] > rng1[1] ? rng0[1] : rng1[1]};
+
+        // Don't visit any bin twice
+        if constexpr (is_circular) {
+            if (rng[1] - rng[0] > n_bins) {
+                rng[1] = rng[0] + n_bins;
+            }
+        }
+
+        bin_ranges.indices[loc_idx] = rng;
+    }
+
     /// Data that the axes keep: index ranges in the edges container
     edge_offset_range_t m_edge_offsets{};
     /// Contains all bin edges for all axes
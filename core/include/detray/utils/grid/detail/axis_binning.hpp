@@ -11,12 +11,16 @@
 #include "detray/definitions/detail/algebra.hpp"
 #include "detray/definitions/detail/algorithms.hpp"
 #include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/math.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/definitions/grid_axis.hpp"
 
 // System include(s).
+#include <algorithm>
+#include <cassert>
 #include <cstddef>
 #include <iterator>
+#include <vector>
 
 namespace detray::axis {
 
@@ -174,6 +178,14 @@ struct regular {
 ///
 /// @note The bin search makes this type comparatively expensive. Only use when
 /// absolutely needed.
+///
+/// Optionally, a uniform lookup table can be stored behind the bin edges when
+/// the axis is constructed (see @c irregular::append_lookup ). It maps a value
+/// to a bin index with one multiplication and at most a single correction for
+/// the bin edge that lies in the same table cell, instead of a binary search.
+/// The table lives in the bin edges storage, so that it is copied to device
+/// together with the edges. Whether it is present, is encoded in the number
+/// of bins of the index range (see @c irregular::lookup_flag ).
 template <typename dcontainers = host_container_types,
           typename scalar_t = scalar>
 struct irregular {
@@ -190,10 +202,17 @@ struct irregular {
 
     static constexpr binning type = binning::e_irregular;
 
+    /// Marks an index range whose bin edges are followed by a lookup table
+    static constexpr dindex lookup_flag{1u << 31};
+    /// Maximal number of lookup table cells per bin
+    static constexpr dindex max_lookup_cells_per_bin{8u};
+
     /// Offset into the bin edges container and the number of bins
     dindex m_offset{0}, m_n_bins{0};
     /// Access to the bin edges
     const vector_type<scalar_type> *m_bin_edges{nullptr};
+    /// Whether a lookup table follows the bin edges
+    bool m_has_lookup{false};
 
     /// Default constructor (no concrete memory access)
     irregular() = default;
@@ -205,13 +224,18 @@ struct irregular {
     DETRAY_HOST_DEVICE
     irregular(const dindex_range &range, const vector_type<scalar_type> *edges)
         : m_offset(detray::detail::get<0>(range)),
-          m_n_bins{detray::detail::get<1>(range)},
-          m_bin_edges(edges) {}
+          m_n_bins{detray::detail::get<1>(range) & ~lookup_flag},
+          m_bin_edges(edges),
+          m_has_lookup{(detray::detail::get<1>(range) & lookup_flag) != 0u} {}
 
     /// @returns the total number of bins
     DETRAY_HOST_DEVICE
     dindex nbins() const { return m_n_bins; }
 
+    /// @returns true if the bin search uses a lookup table
+    DETRAY_HOST_DEVICE
+    bool has_lookup() const { return m_has_lookup; }
+
     /// Access function to a single bin from a value v
     ///
     /// @param v is the value for the bin search
@@ -219,6 +243,10 @@ struct irregular {
     /// @returns the corresponding bin index
     DETRAY_HOST_DEVICE
     int bin(const scalar_type v) const {
+        if (m_has_lookup) {
+            return lookup_bin(v);
+        }
+
         auto bins_begin =
             m_bin_edges->begin() + static_cast<index_type>(m_offset);
         auto bins_end = bins_begin + static_cast<index_type>(m_n_bins);
@@ -302,6 +330,89 @@ struct irregular {
 
         return {min, max};
     }
+
+    /// Append a lookup table for the bin edges @param edges (lower bin edges
+    /// + the upper edge of the last bin) to the edges storage @param storage .
+    ///
+    /// The table is laid out as: number of cells, inverse cell width, and
+    /// the bin index at the lower edge of every cell. The cells are at most
+    /// as wide as the smallest bin, unless this would exceed
+    /// @c max_lookup_cells_per_bin cells per bin on average.
+    template <typename edge_container_t>
+    DETRAY_HOST static void append_lookup(
+        const std::vector<scalar_type> &edges, edge_container_t &storage) {
+        assert(edges.size() >= 2u);
+
+        const auto n_bins{static_cast<dindex>(edges.size() - 1u)};
+        const scalar_type lower{edges.front()};
+        const scalar_type extent{edges.back() - lower};
+
+        scalar_type min_width{extent};
+        for (dindex i = 0u; i < n_bins; ++i) {
+            const scalar_type w{edges[i + 1u] - edges[i]};
+            min_width = (w > 0.f and w < min_width) ? w : min_width;
+        }
+
+        dindex n_cells{n_bins};
+        if (min_width > 0.f) {
+            const scalar_type max_cells{
+                static_cast<scalar_type>(max_lookup_cells_per_bin * n_bins)};
+            const scalar_type n_uniform{math::ceil(extent / min_width)};
+            n_cells = std::max(
+                n_bins, static_cast<dindex>(std::min(n_uniform, max_cells)));
+        }
+        const scalar_type width{extent / static_cast<scalar_type>(n_cells)};
+
+        storage.push_back(static_cast<scalar_type>(n_cells));
+        storage.push_back(width > 0.f ? 1.f / width : 0.f);
+
+        // Bin index at the lower cell edge, with the same convention as the
+        // binary search: the number of lower bin edges below the value - 1
+        dindex n_below{0u};
+        for (dindex c = 0u; c < n_cells; ++c) {
+            const scalar_type cell_lower{lower +
+                                         static_cast<scalar_type>(c) * width};
+            while (n_below < n_bins and edges[n_below] < cell_lower) {
+                ++n_below;
+            }
+            storage.push_back(static_cast<scalar_type>(n_below) - 1.f);
+        }
+    }
+
+    private:
+    /// @returns the bin index for the value @param v from the lookup table
+    DETRAY_HOST_DEVICE
+    int lookup_bin(const scalar_type v) const {
+        const vector_type<scalar_type> &edges = *m_bin_edges;
+        const auto n{static_cast<int>(m_n_bins)};
+        // Table data behind the lower bin edges and the upper edge
+        const dindex table{m_offset + m_n_bins + 1u};
+
+        // Same results as the binary search on the lower bin edges
+        if (v <= edges[m_offset]) {
+            return -1;
+        }
+        if (v > edges[m_offset + m_n_bins - 1u]) {
+            return n - 1;
+        }
+
+        const auto n_cells{static_cast<dindex>(edges[table])};
+        auto c{static_cast<dindex>((v - edges[m_offset]) * edges[table + 1u])};
+        c = c < n_cells ? c : n_cells - 1u;
+
+        int b{static_cast<int>(edges[table + 2u + c])};
+
+        // Correct for the bin edges inside the cell (usually at most one)
+        while (b >= 0 and edges[m_offset + static_cast<dindex>(b)] >= v) {
+            --b;
+        }
+        while (b + 1 < n and
+               edges[m_offset + static_cast<dindex>(b) + 1u] < v) {
+            ++b;
+        }
+
+        return b;
+    }
 };
 
 }  // namespace detray::axis
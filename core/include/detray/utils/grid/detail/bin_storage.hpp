@@ -13,6 +13,7 @@
 #include "detray/definitions/detail/indexing.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/utils/grid/detail/grid_bins.hpp"
+#include "detray/utils/invalid_values.hpp"
 #include "detray/utils/ranges.hpp"
 
 namespace detray::detail {
@@ -365,6 +366,19 @@ class bin_storage<is_owning, detray::bins::dynamic_array<entry_t>, containers>
     const bin_range_t& bin_data() const { return m_bin_data; }
     const entry_range_t& entry_data() const { return m_entry_data; }
 
+    /// Lay out the bins in the entry storage according to their capacities
+    /// (e.g. counted with the @c atomic_count populator) and empty them.
+    template <bool owner = is_owning, std::enable_if_t<owner, bool> = true>
+    DETRAY_HOST void allocate_entries() {
+        dindex offset{0u};
+        for (bin_data_t& data : m_bin_data) {
+            data.offset = offset;
+            data.size = 0u;
+            offset += data.capacity;
+        }
+        m_entry_data.resize(offset, detail::invalid_value<entry_t>());
+    }
+
     /// begin and end of the bin range
     /// @{
     DETRAY_HOST_DEVICE
@@ -412,4 +426,280 @@ class bin_storage<is_owning, detray::bins::dynamic_array<entry_t>, containers>
     entry_range_t m_entry_data{};
 };
 
+/// Facade/wrapper for the data containers of the compressed (CSR) bin storage
+/// to fit in the grid collection.
+///
+/// Holds one contiguous array of entries and the offset of the first entry of
+/// every bin, plus a trailing offset that closes the last bin. Consecutive
+/// grids in a collection share the boundary offset, so that a grid with n bins
+/// views n + 1 offsets.
+template <typename entry_t, typename containers>
+struct csr_bin_container {
+
+    template <typename T>
+    using vector_t = typename containers::template vector_type<T>;
+
+    vector_t<dindex> offsets{};
+    vector_t<entry_t> entries{};
+
+    // Vecmem based view type
+    using view_type = dmulti_view<dvector_view<dindex>, dvector_view<entry_t>>;
+    using const_view_type =
+        dmulti_view<dvector_view<const dindex>, dvector_view<const entry_t>>;
+
+    // Vecmem based buffer type
+    using buffer_type =
+        dmulti_buffer<dvector_buffer<dindex>, dvector_buffer<entry_t>>;
+
+    constexpr csr_bin_container() = default;
+    DETRAY_HOST
+    csr_bin_container(vecmem::memory_resource* resource)
+        : offsets{resource}, entries{resource} {}
+    csr_bin_container(const csr_bin_container& other) = default;
+    csr_bin_container(csr_bin_container&& other) = default;
+
+    csr_bin_container& operator=(const csr_bin_container&) = default;
+    csr_bin_container& operator=(csr_bin_container&&) = default;
+
+    /// Device-side construction from a vecmem based view type
+    template <typename view_t,
+              typename std::enable_if_t<detail::is_device_view_v<view_t>,
+                                        bool> = true>
+    DETRAY_HOST_DEVICE csr_bin_container(view_t& view)
+        : offsets(detail::get<0>(view.m_view)),
+          entries(detail::get<1>(view.m_view)) {}
+
+    /// Insert the bins of any bin range (e.g. of a grid with dynamic bin
+    /// capacities) at the end. Only the valid entries of every bin are kept.
+    template <typename grid_bin_range_t>
+    DETRAY_HOST void append(const grid_bin_range_t& grid_bins) {
+        // Remove the closing offset, it will be the offset of the first new
+        // bin
+        if (not offsets.empty()) {
+            offsets.pop_back();
+        }
+
+        for (const auto& bin : grid_bins) {
+            offsets.push_back(static_cast<dindex>(entries.size()));
+            for (const auto& entry : bin) {
+                entries.push_back(entry);
+            }
+        }
+        offsets.push_back(static_cast<dindex>(entries.size()));
+    }
+
+    /// @returns a vecmem view on the bin data - non-const
+    DETRAY_HOST auto get_data() -> view_type {
+        return view_type{detray::get_data(offsets), detray::get_data(entries)};
+    }
+
+    /// @returns a vecmem view on the bin data - const
+    DETRAY_HOST
+    auto get_data() const -> const_view_type {
+        return const_view_type{detray::get_data(offsets),
+                               detray::get_data(entries)};
+    }
+
+    /// @returns the number of bins
+    DETRAY_HOST_DEVICE
+    std::size_t size() const {
+        return offsets.empty() ? 0u : offsets.size() - 1u;
+    }
+
+    /// Clear out all data
+    DETRAY_HOST
+    void clear() {
+        offsets.clear();
+        entries.clear();
+    }
+};
+
+/// @brief bin data state of a grid with compressed (CSR) bin storage
+///
+/// Can be data-owning or not. Does not contain the data of the axes,
+/// as that is managed by the multi-axis type directly.
+template <bool is_owning, typename entry_t, typename containers>
+class bin_storage<is_owning, detray::bins::csr_array<entry_t>, containers>
+    : public detray::ranges::view_interface<bin_storage<
+          is_owning, detray::bins::csr_array<entry_t>, containers>> {
+
+    template <typename T>
+    using vector_t = typename containers::template vector_type<T>;
+    using bin_t = detray::bins::csr_array<entry_t>;
+    using offset_range_t =
+        std::conditional_t<is_owning, vector_t<dindex>,
+                           detray::ranges::subrange<vector_t<dindex>>>;
+    using entry_range_t =
+        std::conditional_t<is_owning, vector_t<entry_t>,
+                           detray::ranges::subrange<vector_t<entry_t>>>;
+
+    /// Iterator that constructs the bins from the offsets on the fly
+    struct iterator {
+        using difference_type = std::ptrdiff_t;
+        using value_type = bin_t;
+        using pointer = bin_t*;
+        using reference = bin_t&;
+        using iterator_category = detray::ranges::random_access_iterator_tag;
+
+        DETRAY_HOST_DEVICE
+        iterator(const dindex* offsets, const entry_t* entries)
+            : m_offsets{offsets}, m_entries{entries} {}
+
+        /// Wrap iterator functionality
+        /// @{
+        DETRAY_HOST_DEVICE bool operator==(const iterator& other) const {
+            return m_offsets == other.m_offsets;
+        }
+        DETRAY_HOST_DEVICE bool operator!=(const iterator& other) const {
+            return m_offsets != other.m_offsets;
+        }
+        DETRAY_HOST_DEVICE iterator& operator++() {
+            ++m_offsets;
+            return *this;
+        }
+        DETRAY_HOST_DEVICE iterator& operator--() {
+            --m_offsets;
+            return *this;
+        }
+        DETRAY_HOST_DEVICE
+        difference_type operator-(const iterator& other) const {
+            return m_offsets - other.m_offsets;
+        }
+        DETRAY_HOST_DEVICE
+        iterator operator-(difference_type i) const {
+            return {m_offsets - i, m_entries};
+        }
+        DETRAY_HOST_DEVICE
+        iterator operator+(difference_type i) const {
+            return {m_offsets + i, m_entries};
+        }
+        DETRAY_HOST_DEVICE
+        constexpr bin_t operator[](const difference_type i) const {
+            return *(*this + i);
+        }
+        /// @}
+
+        /// Construct and @returns a bin on the fly
+        DETRAY_HOST_DEVICE
+        constexpr bin_t operator*() const {
+            return bin_t{m_entries, *m_offsets, *(m_offsets + 1)};
+        }
+
+        private:
+        /// Offset of the current bin
+        const dindex* m_offsets;
+        /// Access to the bin content
+        const entry_t* m_entries;
+    };
+
+    public:
+    /// Bin type: csr_array
+    using bin_type = bin_t;
+    /// Backend storage type for the grid
+    using bin_container_type = csr_bin_container<entry_t, containers>;
+
+    // Vecmem based view type
+    using view_type = dmulti_view<dvector_view<dindex>, dvector_view<entry_t>>;
+    using const_view_type =
+        dmulti_view<dvector_view<const dindex>, dvector_view<const entry_t>>;
+
+    // Vecmem based buffer type
+    using buffer_type =
+        dmulti_buffer<dvector_buffer<dindex>, dvector_buffer<entry_t>>;
+
+    /// Default constructor
+    bin_storage() = default;
+    /// Copy constructor
+    bin_storage(const bin_storage&) = default;
+    /// Move constructor
+    bin_storage(bin_storage&&) = default;
+
+    /// Construct containers using a memory resources
+    template <bool owner = is_owning, std::enable_if_t<owner, bool> = true>
+    DETRAY_HOST bin_storage(vecmem::memory_resource& resource)
+        : m_offsets(&resource), m_entry_data(&resource) {}
+
+    /// Construct grid data from containers - move
+    template <bool owner = is_owning, std::enable_if_t<owner, bool> = true>
+    DETRAY_HOST_DEVICE bin_storage(bin_container_type&& bin_data)
+        : m_offsets(std::move(bin_data.offsets)),
+          m_entry_data(std::move(bin_data.entries)) {}
+
+    /// Construct the non-owning type from the @param offset into the global
+    /// containers @param bin_data and the number of bins @param size
+    template <bool owner = is_owning, std::enable_if_t<!owner, bool> = true>
+    DETRAY_HOST_DEVICE bin_storage(bin_container_type& bin_data, dindex offset,
+                                   dindex size)
+        : m_offsets(bin_data.offsets,
+                    dindex_range{offset, offset + size + 1u}),
+          m_entry_data(
+              bin_data.entries,
+              dindex_range{0u, static_cast<dindex>(bin_data.entries.size())}) {}
+
+    /// Construct bin storage from its vecmem view
+    template <typename view_t,
+              typename std::enable_if_t<detail::is_device_view_v<view_t>,
+                                        bool> = true>
+    DETRAY_HOST_DEVICE bin_storage(const view_t& view)
+        : m_offsets(detray::detail::get<0>(view.m_view)),
+          m_entry_data(detray::detail::get<1>(view.m_view)) {}
+
+    /// Copy assignment
+    bin_storage& operator=(const bin_storage&) = default;
+    /// Move assignment
+    bin_storage& operator=(bin_storage&&) = default;
+
+    /// @returns the bin offsets (one more than the number of bins)
+    DETRAY_HOST_DEVICE
+    const dindex* offsets() const { return m_offsets.data(); }
+
+    /// @returns the bin entries
+    DETRAY_HOST_DEVICE
+    const entry_t* entries() const { return m_entry_data.data(); }
+
+    /// @returns a bin that contains the entries of the consecutive bins
+    /// [@param first_bin, @param last_bin)
+    DETRAY_HOST_DEVICE
+    bin_t bin_range(const dindex first_bin, const dindex last_bin) const {
+        return bin_t{entries(), offsets()[first_bin], offsets()[last_bin]};
+    }
+
+    /// begin and end of the bin range
+    /// @{
+    DETRAY_HOST_DEVICE
+    auto begin() const { return iterator{offsets(), entries()}; }
+    DETRAY_HOST_DEVICE
+    auto end() const { return iterator{offsets() + n_bins(), entries()}; }
+    /// @}
+
+    /// @returns the vecmem view of the bin storage
+    template <bool owner = is_owning, std::enable_if_t<owner, bool> = true>
+    DETRAY_HOST auto get_data() -> view_type {
+        return view_type{detray::get_data(m_offsets),
+                         detray::get_data(m_entry_data)};
+    }
+
+    /// @returns the vecmem view of the bin storage - const
+    template <bool owner = is_owning, std::enable_if_t<owner, bool> = true>
+    DETRAY_HOST auto get_data() const -> const_view_type {
+        return const_view_type{detray::get_data(m_offsets),
+                               detray::get_data(m_entry_data)};
+    }
+
+    private:
+    /// @returns the number of bins
+    DETRAY_HOST_DEVICE
+    dindex n_bins() const {
+        const auto n_offsets{static_cast<dindex>(m_offsets.size())};
+        return n_offsets == 0u ? 0u : n_offsets - 1u;
+    }
+
+    /// Offsets of the bins into the entry container (including the closing
+    /// offset) when owning or a view into an externally owned container
+    offset_range_t m_offsets{};
+    /// Container that holds all bin entries when owning or a view into an
+    /// externally owned container
+    entry_range_t m_entry_data{};
+};
+
 }  // namespace detray::detail
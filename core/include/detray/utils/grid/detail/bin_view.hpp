@@ -199,4 +199,192 @@ struct bin_iterator {
     typename grid_t::loc_bin_index m_lbin;
 };
 
+/// @brief Range adaptor that iterates the entries of a search window in a 2D
+/// grid with compressed (CSR) bin storage.
+///
+/// The bins of a row (consecutive bins on the first axis) are stored
+/// contiguously, so the search window is resolved into one contiguous range of
+/// entries per row (two, if the row wraps around a circular axis), instead of
+/// joining the individual bins.
+template <typename grid_t>
+struct bin_row_view
+    : public detray::ranges::view_interface<bin_row_view<grid_t>> {
+
+    using entry_t = typename grid_t::value_type;
+
+    static_assert(grid_t::dim == 2u,
+                  "The row view is only implemented for 2D grids");
+
+    /// @brief Iterate through the entries of all rows in the search window
+    struct iterator {
+
+        using difference_type = std::ptrdiff_t;
+        using value_type = entry_t;
+        using pointer = const entry_t *;
+        using reference = const entry_t &;
+        using iterator_category = detray::ranges::forward_iterator_tag;
+
+        /// Default constructor required by LegacyIterator trait
+        constexpr iterator() = default;
+
+        /// Construct from the @param view and the index of the first span
+        DETRAY_HOST_DEVICE
+        iterator(const bin_row_view &view, const dindex span)
+            : m_view{&view}, m_span{span} {
+            load_span();
+        }
+
+        /// @returns true if it points to the same entry
+        DETRAY_HOST_DEVICE constexpr bool operator==(
+            const iterator &rhs) const {
+            return m_pos == rhs.m_pos;
+        }
+
+        /// @returns false if it points to the same entry
+        DETRAY_HOST_DEVICE constexpr bool operator!=(
+            const iterator &rhs) const {
+            return m_pos != rhs.m_pos;
+        }
+
+        /// Increment to the next entry, possibly in the next span
+        DETRAY_HOST_DEVICE auto operator++() -> iterator & {
+            ++m_pos;
+            if (m_pos == m_end) {
+                ++m_span;
+                load_span();
+            }
+            return *this;
+        }
+
+        /// @returns the current entry
+        DETRAY_HOST_DEVICE
+        constexpr auto operator*() const -> reference { return *m_pos; }
+
+        private:
+        /// Set the entry range of the current (non-empty) span
+        DETRAY_HOST_DEVICE constexpr void load_span() {
+            for (; m_span < m_view->n_spans(); ++m_span) {
+                const auto [first, last] = m_view->entry_range(m_span);
+                if (first != last) {
+                    m_pos = m_view->m_entries + first;
+                    m_end = m_view->m_entries + last;
+                    return;
+                }
+            }
+            // End position
+            m_pos = nullptr;
+            m_end = nullptr;
+        }
+
+        /// The view that defines the spans
+        const bin_row_view *m_view{nullptr};
+        /// Index of the current span
+        dindex m_span{0u};
+        /// Current entry and end of the current span
+        const entry_t *m_pos{nullptr};
+        const entry_t *m_end{nullptr};
+    };
+
+    /// Default constructor
+    constexpr bin_row_view() = default;
+
+    /// Construct from a @param search_window of local bin index ranges and an
+    /// underlying @param grid
+    DETRAY_HOST_DEVICE
+    bin_row_view(const grid_t &grid,
+                 const axis::multi_bin_range<2> &search_window)
+        : m_offsets{grid.bins().offsets()}, m_entries{grid.bins().entries()} {
+
+        const auto ax0 = grid.template get_axis<0>();
+        const auto ax1 = grid.template get_axis<1>();
+        m_n_cols = static_cast<dindex>(ax0.nbins());
+        m_n_rows = static_cast<dindex>(ax1.nbins());
+
+        // Column spans of every row
+        const bin_range &cols = detray::detail::get<0>(search_window);
+        using bounds0_t = typename decltype(ax0)::bounds_type;
+        if constexpr (bounds0_t::type == axis::bounds::e_circular) {
+            const int n{static_cast<int>(m_n_cols)};
+            const int width{cols[1] - cols[0]};
+            if (width >= n) {
+                m_cols[0] = {0u, m_n_cols};
+            } else {
+                const int first{axis::circular<>{}.wrap(cols[0], m_n_cols)};
+                const int last{first + width};
+                m_cols[0] = {static_cast<dindex>(first),
+                             static_cast<dindex>(last < n ? last : n)};
+                if (last > n) {
+                    m_cols[1] = {0u, static_cast<dindex>(last - n)};
+                    m_n_col_spans = 2u;
+                }
+            }
+        } else {
+            m_cols[0] = {static_cast<dindex>(cols[0]),
+                         static_cast<dindex>(cols[1])};
+        }
+
+        // Rows in the search window
+        const bin_range &rows = detray::detail::get<1>(search_window);
+        using bounds1_t = typename decltype(ax1)::bounds_type;
+        if constexpr (bounds1_t::type == axis::bounds::e_circular) {
+            m_wrap_rows = true;
+            const int width{rows[1] - rows[0]};
+            m_first_row = static_cast<dindex>(
+                axis::circular<>{}.wrap(rows[0], m_n_rows));
+            m_n_window_rows = static_cast<dindex>(
+                width < static_cast<int>(m_n_rows) ? width : m_n_rows);
+        } else {
+            m_first_row = static_cast<dindex>(rows[0]);
+            m_n_window_rows = static_cast<dindex>(rows[1] - rows[0]);
+        }
+    }
+
+    /// @returns start position: first entry of the first row
+    DETRAY_HOST_DEVICE
+    auto begin() const -> iterator { return {*this, 0u}; }
+
+    /// @returns sentinel of the range
+    DETRAY_HOST_DEVICE
+    auto end() const -> iterator { return {*this, n_spans()}; }
+
+    /// @returns the number of contiguous entry ranges in the search window
+    DETRAY_HOST_DEVICE
+    constexpr dindex n_spans() const { return m_n_window_rows * m_n_col_spans; }
+
+    /// @returns the entry index range of the span with index @param span
+    DETRAY_HOST_DEVICE
+    constexpr darray<dindex, 2> entry_range(const dindex span) const {
+        dindex row{m_first_row + span / m_n_col_spans};
+        if (m_wrap_rows and row >= m_n_rows) {
+            row -= m_n_rows;
+        }
+        const darray<dindex, 2> &cols = m_cols[span % m_n_col_spans];
+
+        // First and last + 1 global bin of the span
+        const dindex offset{row * m_n_cols};
+        return {m_offsets[offset + cols[0]], m_offsets[offset + cols[1]]};
+    }
+
+    /// @returns the entries of the span with index @param span
+    DETRAY_HOST_DEVICE
+    constexpr auto span(const dindex span) const
+        -> detray::ranges::contiguous_span<const entry_t> {
+        const auto [first, last] = entry_range(span);
+        return {m_entries + first, last - first};
+    }
+
+    private:
+    /// Access to the bin storage
+    const dindex *m_offsets{nullptr};
+    const entry_t *m_entries{nullptr};
+    /// Number of bins on the axes
+    dindex m_n_cols{0u}, m_n_rows{0u};
+    /// Column (first axis) bin ranges per row
+    darray<darray<dindex, 2>, 2> m_cols{};
+    dindex m_n_col_spans{1u};
+    /// Row (second axis) bin range of the search window
+    dindex m_first_row{0u}, m_n_window_rows{0u};
+    bool m_wrap_rows{false};
+};
+
 }  // namespace detray::axis::detail
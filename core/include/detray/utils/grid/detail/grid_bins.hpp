@@ -9,11 +9,15 @@
 
 // Project include(s).
 #include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/detail/atomic.hpp"
 #include "detray/definitions/detail/indexing.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/utils/invalid_values.hpp"
 #include "detray/utils/ranges.hpp"
 
+// System include(s).
+#include <type_traits>
+
 namespace detray::bins {
 
 /// @brief Bin with a single entry
@@ -109,6 +113,19 @@ class static_array
         ++m_size;
     }
 
+    /// Add a new entry to the bin - thread safe
+    ///
+    /// @returns false if the bin was already full
+    template <typename E = entry_t>
+    DETRAY_HOST_DEVICE bool atomic_push_back(E&& entry) noexcept {
+        const dindex idx{detail::atomic_inc_below(&m_size, capacity())};
+        if (idx < capacity()) {
+            m_content[idx] = std::forward<E>(entry);
+            return true;
+        }
+        return false;
+    }
+
     /// Initilialize with a single entry filled
     ///
     /// @returns Access to the initialized bin
@@ -251,6 +268,31 @@ class dynamic_array
         }
     }
 
+    /// Add a new entry to the bin - thread safe
+    ///
+    /// @returns false if the bin was already full
+    template <typename E = entry_type>
+    DETRAY_HOST_DEVICE bool atomic_push_back(E&& entry) {
+        assert(m_global_storage);
+
+        const dindex idx{detail::atomic_inc_below(
+            &(const_cast<data*>(m_data)->size), m_capacity)};
+        if (idx < m_capacity) {
+            *(const_cast<entry_type*>(m_global_storage) + idx) =
+                std::forward<E>(entry);
+            return true;
+        }
+        return false;
+    }
+
+    /// Increase the capacity of the bin by @param n entries - thread safe
+    ///
+    /// @note The bin offsets in the global storage have to be updated before
+    /// the bin can be filled (this bin instance still sees the old capacity)
+    DETRAY_HOST_DEVICE void atomic_reserve(const dindex n = 1u) {
+        detail::atomic_add(&(const_cast<data*>(m_data)->capacity), n);
+    }
+
     /// @note The bin capacity has to be set correctly before calling this
     /// method
     /// @returns Access to an initialized bin in the backend storage
@@ -325,4 +367,87 @@ dynamic_array(const entry_t* bin_storage, const data_t& bin_data)
     -> dynamic_array<entry_t>;
 /// @}
 
+/// @brief Bin that views a contiguous range of entries in a compressed (CSR)
+/// bin storage.
+///
+/// The entries of all bins are kept in a single contiguous array and the bin
+/// boundaries are given by an array of offsets (prefix sum over the bin
+/// sizes). The bin capacity is fixed at construction of the storage, so these
+/// bins are read-only.
+template <typename entry_t>
+class csr_array : public detray::ranges::view_interface<csr_array<entry_t>> {
+
+    public:
+    using entry_type = entry_t;
+
+    /// Default constructor: empty bin
+    constexpr csr_array() = default;
+
+    /// Construct from the global entry storage @param entries and the entry
+    /// index range [@param begin, @param end)
+    DETRAY_HOST_DEVICE
+    constexpr csr_array(const entry_type* entries, const dindex begin,
+                        const dindex end)
+        : m_begin{entries + begin}, m_end{entries + end} {}
+
+    /// @returns iterator over bin content in start or end position
+    /// @{
+    DETRAY_HOST_DEVICE
+    constexpr const entry_type* begin() const { return m_begin; }
+    DETRAY_HOST_DEVICE
+    constexpr const entry_type* end() const { return m_end; }
+    /// @}
+
+    /// @returns the number of entries in this bin
+    DETRAY_HOST_DEVICE
+    constexpr dindex size() const {
+        return static_cast<dindex>(m_end - m_begin);
+    }
+
+    /// The storage capacity of this bin (cannot grow)
+    DETRAY_HOST_DEVICE
+    constexpr dindex capacity() const noexcept { return size(); }
+
+    private:
+    /// First entry of the bin in the global storage
+    const entry_type* m_begin{nullptr};
+    /// One past the last entry of the bin in the global storage
+    const entry_type* m_end{nullptr};
+};
+
 }  // namespace detray::bins
+
+namespace detray::ranges {
+
+/// The bin entries are stored contiguously
+/// @{
+template <typename entry_t, std::size_t N>
+struct is_contiguous_range<bins::static_array<entry_t, N>>
+    : public std::true_type {};
+
+template <typename entry_t>
+struct is_contiguous_range<bins::dynamic_array<entry_t>>
+    : public std::true_type {};
+
+template <typename entry_t>
+struct is_contiguous_range<bins::csr_array<entry_t>> : public std::true_type {
+};
+/// @}
+
+}  // namespace detray::ranges
+
+namespace detray::detail {
+
+/// Whether the bins of a grid are kept in a compressed (CSR) bin storage
+/// @{
+template <typename bin_t>
+struct is_csr_bin : public std::false_type {};
+
+template <typename entry_t>
+struct is_csr_bin<bins::csr_array<entry_t>> : public std::true_type {};
+
+template <typename bin_t>
+inline constexpr bool is_csr_bin_v = is_csr_bin<bin_t>::value;
+/// @}
+
+}  // namespace detray::detail
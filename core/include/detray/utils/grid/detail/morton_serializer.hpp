@@ -0,0 +1,135 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+
+// System include(s).
+#include <cstddef>
+
+namespace detray {
+
+/// @brief Serializes the local bin indices along a Morton (Z-order) curve
+///
+/// The bits of the axis-local bin indices are interleaved, so that bins that
+/// are close on the axes are mostly also close in memory. In a neighborhood
+/// lookup, this reduces the number of cache lines that have to be loaded
+/// compared to the row-major order of the @c simple_serializer.
+///
+/// The Morton order is compacted to the bins that exist in the grid: A bin is
+/// serialized to its rank among the valid bins along the curve, so that the
+/// global bin indices stay dense in [0, nbins) for any number of bins per
+/// axis (not only powers of two). Both directions take one pass over the bits
+/// of the bin indices for every axis.
+///
+/// @note the bin indices are expected to start at zero.
+template <std::size_t kDIM>
+struct morton_serializer {
+
+    /// @brief Create a serial bin from a multi-bin
+    ///
+    /// @tparam multi_axis_t is the type of multi-dimensional axis
+    ///
+    /// @param axes contains all axes (multi-axis)
+    /// @param mbin contains a bin index for every axis in the multi-axis.
+    ///
+    /// @returns a dindex for the bin data storage
+    template <typename multi_axis_t>
+    DETRAY_HOST_DEVICE auto operator()(
+        multi_axis_t &axes, typename multi_axis_t::loc_bin_index mbin) const
+        -> dindex {
+        const auto n_bins = axes.nbins_per_axis();
+
+        // Lower corner of the current Morton cell
+        typename multi_axis_t::loc_bin_index lower{};
+        dindex gbin{0u};
+
+        for (unsigned int l = n_levels(n_bins); l-- > 0u;) {
+            const dindex half{1u << l};
+            for (std::size_t d = kDIM; d-- > 0u;) {
+                // Every valid bin in the lower half of the cell comes first
+                if (mbin[d] & half) {
+                    gbin += n_valid_bins(n_bins, lower, d, l);
+                    lower[d] += half;
+                }
+            }
+        }
+
+        return gbin;
+    }
+
+    /// @brief Create a multi-bin from a serialized bin
+    ///
+    /// @tparam multi_axis_t is the type of multi-dimensional axis
+    ///
+    /// @param axes contains all axes (multi-axis)
+    /// @param gbin the global (serial) bin
+    ///
+    /// @return a kDIM-dimensional multi-bin
+    template <typename multi_axis_t>
+    DETRAY_HOST_DEVICE auto operator()(multi_axis_t &axes, dindex gbin) const ->
+        typename multi_axis_t::loc_bin_index {
+        const auto n_bins = axes.nbins_per_axis();
+
+        // Descend into the half of the cell that contains the global bin
+        typename multi_axis_t::loc_bin_index mbin{};
+        for (unsigned int l = n_levels(n_bins); l-- > 0u;) {
+            const dindex half{1u << l};
+            for (std::size_t d = kDIM; d-- > 0u;) {
+                const dindex n_lower{n_valid_bins(n_bins, mbin, d, l)};
+                if (gbin >= n_lower) {
+                    gbin -= n_lower;
+                    mbin[d] += half;
+                }
+            }
+        }
+
+        return mbin;
+    }
+
+    private:
+    /// @returns the number of bits that are needed for the largest axis
+    template <typename bin_index_t>
+    DETRAY_HOST_DEVICE static constexpr auto n_levels(
+        const bin_index_t &n_bins) -> unsigned int {
+        dindex n_max{0u};
+        for (std::size_t d = 0u; d < kDIM; ++d) {
+            n_max = n_bins[d] > n_max ? n_bins[d] : n_max;
+        }
+        unsigned int n{0u};
+        while (n_max > (1u << n)) {
+            ++n;
+        }
+        return n;
+    }
+
+    /// @returns the number of valid bins in the lower half of the Morton cell
+    /// at @param lower, when it is split on the axis @param split_axis on the
+    /// bit level @param l
+    template <typename bin_index_t>
+    DETRAY_HOST_DEVICE static constexpr auto n_valid_bins(
+        const bin_index_t &n_bins, const bin_index_t &lower,
+        const std::size_t split_axis, const unsigned int l) -> dindex {
+        dindex n{1u};
+        for (std::size_t d = 0u; d < kDIM; ++d) {
+            if (lower[d] >= n_bins[d]) {
+                return 0u;
+            }
+            // The axes that come after the split axis have not been split on
+            // this level yet
+            const dindex extent{d < split_axis ? 2u << l : 1u << l};
+            const dindex n_left{n_bins[d] - lower[d]};
+            n *= n_left < extent ? n_left : extent;
+        }
+        return n;
+    }
+};
+
+}  // namespace detray
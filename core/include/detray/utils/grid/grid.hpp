@@ -277,10 +277,20 @@ class grid_impl {
 
         // Track position in grid coordinates
         const auto &trf = det.transform_store()[volume.transform()];
-        const auto loc_pos = project(trf, track.pos(), track.dir());
+        const auto &pos = track.pos();
+        const auto &dir = track.dir();
+        const auto loc_pos = project(trf, pos, dir);
 
-        // Grid lookup
-        return search(loc_pos, cfg.search_window);
+        if (cfg.search_path_length <= 0.f) {
+            // Grid lookup around the track position
+            return search(loc_pos, cfg.search_window);
+        }
+
+        // Grid lookup along the tangent ray of the track
+        const auto end_pos =
+            pos + static_cast<scalar_type>(cfg.search_path_length) * dir;
+
+        return search(loc_pos, project(trf, end_pos, dir), cfg.search_window);
     }
 
     /// Find the value of a single bin - const
@@ -314,11 +324,65 @@ class grid_impl {
         const point_type &p, const std::array<neighbor_t, 2> &win_size) const {
 
         // Return iterable over bins in the search window
-        auto search_window = axes().bin_ranges(p, win_size);
-        auto search_area = axis::detail::bin_view(*this, search_window);
+        return search(axes().bin_ranges(p, win_size));
+    }
+
+    /// @brief Return a neighborhood of values from the grid
+    ///
+    /// The lookup is done with a separate search window on every axis
+    ///
+    /// @param p is point in the local frame
+    /// @param win_sizes size of the binned/scalar search window per axis
+    ///
+    /// @return the sequence of values
+    template <typename neighbor_t>
+    DETRAY_HOST_DEVICE auto search(
+        const point_type &p,
+        const std::array<std::array<neighbor_t, 2>, dim> &win_sizes) const {
 
-        // Join the respective bins to a single iteration
-        return detray::views::join(std::move(search_area));
+        // Return iterable over bins in the search window
+        return search(axes().bin_ranges(p, win_sizes));
+    }
+
+    /// @brief Return the values along a segment in the grid
+    ///
+    /// The lookup collects the bins that the segment between two points
+    /// passes through, including a search window around them
+    ///
+    /// @param p0 is the start point of the segment in the local frame
+    /// @param p1 is the end point of the segment in the local frame
+    /// @param win_size size of the binned/scalar search window
+    ///
+    /// @return the sequence of values
+    template <typename neighbor_t>
+    DETRAY_HOST_DEVICE auto search(
+        const point_type &p0, const point_type &p1,
+        const std::array<neighbor_t, 2> &win_size) const {
+
+        // Return iterable over bins in the search window
+        return search(axes().bin_ranges(p0, p1, win_size));
+    }
+
+    /// @brief Return the values in a range of bins
+    ///
+    /// @param search_window the local bin index ranges on every axis
+    ///
+    /// @return the sequence of values
+    DETRAY_HOST_DEVICE auto search(
+        axis::multi_bin_range<dim> search_window) const {
+
+        if constexpr (dim == 2u && detray::detail::is_csr_bin_v<bin_type> &&
+                      std::is_same_v<serializer_type<2>,
+                                     simple_serializer<2>>) {
+            // The bins of a row are contiguous in the compressed storage:
+            // Iterate the entries row by row
+            return axis::detail::bin_row_view(*this, search_window);
+        } else {
+            auto search_area = axis::detail::bin_view(*this, search_window);
+
+            // Join the respective bins to a single iteration
+            return detray::views::join(std::move(search_area));
+        }
     }
 
     /// Poupulate a bin with a single one of its corresponding values @param v
@@ -350,6 +414,37 @@ class grid_impl {
         return 20u;
     }
 
+    /// @returns an upper bound on the number of surface candidates that a
+    /// neighborhood lookup with the search window @param win_size can return
+    ///
+    /// @note counts surfaces, not intersections (see @c n_max_candidates of
+    /// the navigator for the capacity of a candidate cache)
+    /// @note this has to query every bin for the number of elements
+    template <typename neighbor_t>
+    DETRAY_HOST_DEVICE constexpr auto n_max_candidates(
+        const std::array<neighbor_t, 2> &win_size) const -> unsigned int {
+
+        // Largest bin in the grid
+        unsigned int max_bin_size{0u};
+        for (const auto &b : bins()) {
+            const auto n{static_cast<unsigned int>(b.size())};
+            max_bin_size = n > max_bin_size ? n : max_bin_size;
+        }
+
+        // Number of bins in the search window: the window cannot be larger
+        // than the axis, even if it wraps around (circular axes)
+        const auto n_bins_per_axis = m_axes.nbins_per_axis();
+        const auto n_win_bins{static_cast<unsigned int>(win_size[0] +
+                                                        win_size[1] + 1u)};
+        unsigned int n_bins{1u};
+        for (unsigned int i = 0u; i < dim; ++i) {
+            const auto n_ax{static_cast<unsigned int>(n_bins_per_axis[i])};
+            n_bins *= n_win_bins < n_ax ? n_win_bins : n_ax;
+        }
+
+        return n_bins * max_bin_size;
+    }
+
     /// @returns view of a grid, including the grids multi_axis. Also valid if
     /// the value type of the grid is cv qualified (then value_t propagates
     /// quialifiers) - non-const
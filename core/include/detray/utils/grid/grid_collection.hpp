@@ -338,6 +338,16 @@ class grid_collection<
         bin_data.append(grid_bins);
     }
 
+    /// Insert data into the backend containers of a grid with compressed
+    /// (CSR) bin storage
+    template <typename entry_t, typename container_t,
+              typename grid_bin_range_t>
+    DETRAY_HOST void insert_bin_data(
+        detray::detail::csr_bin_container<entry_t, container_t> &bin_data,
+        const grid_bin_range_t &grid_bins) {
+        bin_data.append(grid_bins);
+    }
+
     /// Offsets for the respective grids into the bin storage
     vector_type<size_type> m_bin_offsets{};
     /// Contains the bin content for all grids
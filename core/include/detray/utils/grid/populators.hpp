@@ -13,6 +13,10 @@
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/utils/invalid_values.hpp"
 
+// System include(s).
+#include <cassert>
+#include <utility>
+
 namespace detray {
 
 /// A replace populator that overrides whatever current content is in the bin
@@ -35,7 +39,7 @@ struct replace {
 
         // Optionally sort the bin content
         if constexpr (kSORT) {
-            detray::detail::sequential_sort(bin.begin(), bin.end());
+            detray::detail::adaptive_sort(bin.begin(), bin.end());
         }
     }
 };
@@ -56,7 +60,7 @@ struct attach {
 
         // Optionally sort the bin content
         if constexpr (kSORT) {
-            detray::detail::sequential_sort(bin.begin(), bin.end());
+            detray::detail::adaptive_sort(bin.begin(), bin.end());
         }
     }
 };
@@ -80,9 +84,60 @@ struct complete {
 
         // Optionally sort the bin content
         if constexpr (kSORT) {
-            detray::detail::sequential_sort(bin.begin(), bin.end());
+            detray::detail::adaptive_sort(bin.begin(), bin.end());
         }
     }
 };
 
+/// An attach populator that adds a new entry to a given bin and can be called
+/// concurrently from several threads (or on device).
+///
+/// The entry slots are handed out by an atomic counter in the bin, so the bin
+/// capacity has to be fixed: either a @c bins::static_array , or a
+/// @c bins::dynamic_array after its capacity was counted (see
+/// @c atomic_count ). Entries that do not fit into a full bin are dropped.
+///
+/// @note The entry order depends on the thread scheduling: Sort the bins
+/// once after the population is done (see @c sort_bins ).
+struct atomic_attach {
+
+    /// Append a new entry to the bin - forwarding
+    ///
+    /// @param bin the bin for which to add the content
+    /// @param content new content to be added
+    template <typename bin_t, typename entry_t>
+    DETRAY_HOST_DEVICE void operator()(bin_t &&bin, entry_t &&entry) const {
+        [[maybe_unused]] const bool success{
+            bin.atomic_push_back(std::forward<entry_t>(entry))};
+        assert(success);
+    }
+};
+
+/// First phase of a concurrent population of bins with dynamic capacity:
+/// Only counts the entries per bin, which can be called concurrently from
+/// several threads (or on device).
+///
+/// Populate the grid with all entries, using this populator, then lay out the
+/// entry storage (@c allocate_entries on the bin storage of the grid) and
+/// populate the grid again with the same entries, using @c atomic_attach .
+struct atomic_count {
+
+    /// Count an entry for the bin
+    ///
+    /// @param bin the bin for which to count the content
+    template <typename bin_t, typename entry_t>
+    DETRAY_HOST_DEVICE void operator()(bin_t &&bin, entry_t &&) const {
+        bin.atomic_reserve(1u);
+    }
+};
+
+/// Sort the entries of every bin in @param grid once, e.g. after it was
+/// populated concurrently
+template <typename grid_t>
+DETRAY_HOST void sort_bins(grid_t &grid) {
+    for (auto &&bin : grid.bins()) {
+        detray::detail::adaptive_sort(bin.begin(), bin.end());
+    }
+}
+
 }  // namespace detray
@@ -8,4 +8,5 @@
 #pragma once
 
 // Project include(s).
+#include "detray/utils/grid/detail/morton_serializer.hpp"
 #include "detray/utils/grid/detail/simple_serializer.hpp"
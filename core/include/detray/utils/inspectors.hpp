@@ -8,16 +8,26 @@
 #pragma once
 
 // Project include(s)
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/units.hpp"
 #include "detray/geometry/surface.hpp"
 #include "detray/navigation/detail/ray.hpp"
 #include "detray/navigation/navigation_config.hpp"
 #include "detray/navigation/navigator.hpp"
 #include "detray/propagator/base_actor.hpp"
 #include "detray/propagator/base_stepper.hpp"
+#include "detray/propagator/constrained_step.hpp"
+#include "detray/propagator/propagation_timer.hpp"
 #include "detray/propagator/stepping_config.hpp"
+#include "detray/utils/invalid_values.hpp"
 #include "detray/utils/tuple_helpers.hpp"
 
 // System include(s)
+#include <cstddef>
+#include <cstdint>
 #include <iomanip>
 #include <sstream>
 #include <string>
@@ -27,6 +37,21 @@
 
 namespace detray {
 
+namespace detail {
+
+/// @returns true if the string @param str starts with @param prefix
+DETRAY_HOST_DEVICE
+constexpr bool starts_with(const char *str, const char *prefix) {
+    for (; *prefix != '\0'; ++str, ++prefix) {
+        if (*str != *prefix) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace detail
+
 /// An inspector that aggregates a number of different inspectors.
 template <typename... Inspectors>
 struct aggregate_inspector {
@@ -49,6 +74,31 @@ struct aggregate_inspector {
         }
     }
 
+    /// Inspector interface with the navigation event, which is only passed
+    /// on to the inspectors that take it
+    template <unsigned int current_id = 0, typename state_type,
+              typename scalar_t>
+    auto operator()(state_type &state, const navigation::config<scalar_t> &cfg,
+                    const char *message, const navigation::event ev) {
+        // Call inspector
+        auto &inspector = std::get<current_id>(_inspectors);
+        using inspector_t = std::decay_t<decltype(inspector)>;
+        if constexpr (std::is_invocable_v<
+                          inspector_t &, state_type &,
+                          const navigation::config<scalar_t> &, const char *,
+                          navigation::event>) {
+            inspector(state, cfg, message, ev);
+        } else {
+            inspector(state, cfg, message);
+        }
+
+        // Next inspector
+        if constexpr (current_id <
+                      std::tuple_size<inspector_tuple_t>::value - 1) {
+            return operator()<current_id + 1>(state, cfg, message, ev);
+        }
+    }
+
     /// @returns a specific inspector
     template <typename inspector_t>
     decltype(auto) get() {
@@ -134,6 +184,9 @@ struct print_inspector {
         }
 
         switch (state.status()) {
+            case status::e_overflow:
+                debug_stream << "status" << tabs << "overflow" << std::endl;
+                break;
             case status::e_abort:
                 debug_stream << "status" << tabs << "abort" << std::endl;
                 break;
@@ -191,6 +244,254 @@ struct print_inspector {
     std::string to_string() { return debug_stream.str(); }
 };
 
+/// Navigation counters of a single volume (or of all volumes)
+struct volume_counters {
+    /// Number of volume initializations (local navigation)
+    unsigned int n_inits{0u};
+    /// Number of 'high trust' updates
+    unsigned int n_high_trust{0u};
+    /// Number of 'fair trust' updates
+    unsigned int n_fair_trust{0u};
+    /// Number of 'no trust' updates (re-initialization in the same volume)
+    unsigned int n_no_trust{0u};
+    /// Number of candidates that were found during all initializations
+    unsigned int n_candidates{0u};
+    /// Number of times the navigation entered this volume through a portal
+    unsigned int n_volume_switches{0u};
+    /// Number of aborted navigation streams
+    unsigned int n_aborts{0u};
+    /// Number of candidate cache overflows (not counted as aborts)
+    unsigned int n_overflows{0u};
+    /// Number of passed candidates that were recovered without an init
+    unsigned int n_overstep_recoveries{0u};
+    /// Number of volume switches on prefetched candidates (without init)
+    unsigned int n_lookahead_switches{0u};
+
+    /// Add the counts of @param other
+    DETRAY_HOST_DEVICE
+    constexpr volume_counters &operator+=(const volume_counters &other) {
+        n_inits += other.n_inits;
+        n_high_trust += other.n_high_trust;
+        n_fair_trust += other.n_fair_trust;
+        n_no_trust += other.n_no_trust;
+        n_candidates += other.n_candidates;
+        n_volume_switches += other.n_volume_switches;
+        n_aborts += other.n_aborts;
+        n_overflows += other.n_overflows;
+        n_overstep_recoveries += other.n_overstep_recoveries;
+        n_lookahead_switches += other.n_lookahead_switches;
+        return *this;
+    }
+};
+
+/// A navigation inspector that only counts the navigation calls, per volume.
+///
+/// Does not allocate, so it can be used in device code. The counters of
+/// volumes with an index beyond the capacity only enter the totals.
+///
+/// @tparam kMAX_VOLUMES number of volumes that get their own counters
+template <std::size_t kMAX_VOLUMES = 32u>
+struct counting_inspector {
+
+    /// Counters per volume
+    darray<volume_counters, kMAX_VOLUMES> per_volume{};
+    /// Counters summed over all volumes
+    volume_counters total{};
+    /// Volume of the previous inspector call
+    dindex last_volume{detail::invalid_value<dindex>()};
+
+    /// Inspector interface. Only counts the navigation calls
+    template <typename state_type, typename scalar_t>
+    DETRAY_HOST_DEVICE auto operator()(const state_type &state,
+                                       const navigation::config<scalar_t> &,
+                                       const char * /*message*/,
+                                       const event ev) {
+        // Navigation left the detector
+        if (detail::is_invalid_value(state.volume())) {
+            return;
+        }
+        const dindex vol{static_cast<dindex>(state.volume())};
+
+        volume_counters counts{};
+        const bool has_switched{
+            not detail::is_invalid_value(last_volume) and
+            vol != last_volume};
+        counts.n_volume_switches = has_switched ? 1u : 0u;
+
+        switch (ev) {
+            case event::e_init:
+                counts.n_inits = 1u;
+                counts.n_candidates =
+                    static_cast<unsigned int>(state.candidates().size());
+                // A repeated initialization in the same volume
+                counts.n_no_trust =
+                    (not has_switched and
+                     not detail::is_invalid_value(last_volume))
+                        ? 1u
+                        : 0u;
+                break;
+            case event::e_update_high:
+                counts.n_high_trust = 1u;
+                break;
+            case event::e_update_fair:
+                counts.n_fair_trust = 1u;
+                break;
+            case event::e_overstep_recovery:
+                counts.n_overstep_recoveries = 1u;
+                break;
+            case event::e_lookahead_switch:
+                counts.n_lookahead_switches = 1u;
+                break;
+            case event::e_overflow:
+                counts.n_overflows = 1u;
+                break;
+            case event::e_abort:
+                counts.n_aborts = 1u;
+                break;
+            default:
+                break;
+        }
+
+        if (vol < kMAX_VOLUMES) {
+            per_volume[vol] += counts;
+        }
+        total += counts;
+        last_volume = vol;
+    }
+
+    /// @returns the counters of the volume with index @param vol
+    DETRAY_HOST_DEVICE
+    constexpr const volume_counters &operator[](const dindex vol) const {
+        return per_volume[vol];
+    }
+
+    /// Add the counters of a different navigation stream @param other
+    DETRAY_HOST_DEVICE
+    constexpr counting_inspector &operator+=(const counting_inspector &other) {
+        for (std::size_t i = 0u; i < kMAX_VOLUMES; ++i) {
+            per_volume[i] += other.per_volume[i];
+        }
+        total += other.total;
+        return *this;
+    }
+};
+
+/// Compact record of a navigation call, as written by the @c trace_inspector
+struct trace_record {
+
+    /// Kind of navigation call that produced the record
+    enum class call : std::uint_least8_t {
+        e_init = 0u,
+        e_update = 1u,
+        e_abort = 2u,
+        e_exit = 3u,
+        e_other = 4u,
+    };
+
+    /// Clock ticks of the propagation timer (see @c propagation::phase_timer)
+    std::uint64_t timestamp{0u};
+    /// Barcode value of the current surface (invalid if not on a surface)
+    std::uint64_t surface{detail::invalid_value<std::uint64_t>()};
+    /// Distance to the next candidate (step size the navigator allows)
+    float step_size{0.f};
+    /// Track that the record belongs to
+    std::uint32_t track_id{0u};
+    /// Index of the navigation call for this track
+    std::uint32_t step{0u};
+    /// Current volume index
+    dindex volume{detail::invalid_value<dindex>()};
+    /// Navigation status after the call
+    std::int8_t nav_status{static_cast<std::int8_t>(status::e_unknown)};
+    /// Kind of navigation call
+    call kind{call::e_other};
+};
+
+/// A navigation inspector that writes a compact record for every navigation
+/// call into a ring buffer of fixed capacity.
+///
+/// Does not allocate, so it can be used in device code. When the buffer is
+/// full, the oldest records are overwritten. The records can be exported as
+/// a Chrome trace (see 'detray/utils/chrome_trace.hpp').
+///
+/// @tparam kCAPACITY number of records in the ring buffer
+template <std::size_t kCAPACITY = 256u>
+struct trace_inspector {
+
+    static_assert(kCAPACITY > 0u, "Trace buffer needs a capacity");
+
+    /// Ring buffer of records
+    darray<trace_record, kCAPACITY> buffer{};
+    /// Total number of records that were written
+    std::size_t n_records{0u};
+    /// Track that is being navigated (set by the caller)
+    std::uint32_t track_id{0u};
+
+    /// Inspector interface. Records the navigation state
+    template <typename state_type, typename scalar_t>
+    DETRAY_HOST_DEVICE auto operator()(const state_type &state,
+                                       const navigation::config<scalar_t> &,
+                                       const char * /*message*/,
+                                       const event ev) {
+        trace_record rec{};
+        rec.timestamp = propagation::phase_timer::now();
+        rec.track_id = track_id;
+        rec.step = static_cast<std::uint32_t>(n_records);
+        rec.volume = static_cast<dindex>(state.volume());
+        rec.nav_status = static_cast<std::int8_t>(state.status());
+        if (not state.is_exhausted()) {
+            rec.step_size = static_cast<float>(state());
+        }
+        if (state.is_on_portal() or state.is_on_module()) {
+            rec.surface = state.barcode().value();
+        }
+
+        switch (ev) {
+            case event::e_init:
+            case event::e_lookahead_switch:
+                rec.kind = trace_record::call::e_init;
+                break;
+            case event::e_update_high:
+            case event::e_update_fair:
+            case event::e_overstep_recovery:
+                rec.kind = trace_record::call::e_update;
+                break;
+            case event::e_overflow:
+            case event::e_abort:
+                rec.kind = trace_record::call::e_abort;
+                break;
+            case event::e_exit:
+                rec.kind = trace_record::call::e_exit;
+                break;
+            default:
+                break;
+        }
+
+        buffer[n_records % kCAPACITY] = rec;
+        ++n_records;
+    }
+
+    /// @returns the number of records that are still in the buffer
+    DETRAY_HOST_DEVICE
+    constexpr std::size_t size() const {
+        return n_records < kCAPACITY ? n_records : kCAPACITY;
+    }
+
+    /// @returns the record @param i, counted from the oldest record that is
+    /// still in the buffer
+    DETRAY_HOST_DEVICE
+    constexpr const trace_record &operator[](const std::size_t i) const {
+        const std::size_t first{n_records - size()};
+        return buffer[(first + i) % kCAPACITY];
+    }
+
+    /// Start recording a new track with id @param id
+    DETRAY_HOST_DEVICE
+    constexpr void reset(const std::uint32_t id) {
+        n_records = 0u;
+        track_id = id;
+    }
+};
+
 }  // namespace navigation
 
 namespace stepping {
@@ -272,6 +573,270 @@ struct print_inspector {
     std::string to_string() { return debug_stream.str(); }
 };
 
+/// A stepper inspector that only counts the steps and the step size
+/// adjustments of the adaptive Runge-Kutta steppers.
+///
+/// Does not allocate, so it can be used in device code.
+struct counting_inspector {
+
+    /// Number of completed steps
+    unsigned int n_steps{0u};
+    /// Number of step size reductions of the Runge-Kutta error control
+    unsigned int n_rk_adjustments{0u};
+    /// Number of steps that were cut by a step size constraint
+    unsigned int n_constrained{0u};
+
+    /// Inspector interface. Only counts the stepping calls
+    template <typename state_type, typename scalar_t, typename... Args>
+    DETRAY_HOST_DEVICE void operator()(const state_type &,
+                                       const stepping::config<scalar_t> &,
+                                       const char *message, Args &&...) {
+        if (detail::starts_with(message, "Step complete")) {
+            ++n_steps;
+        } else if (detail::starts_with(message, "Adjust stepsize")) {
+            ++n_rk_adjustments;
+        } else if (detail::starts_with(message, "Before constraint")) {
+            ++n_constrained;
+        }
+    }
+
+    /// Add the counters of a different track @param other
+    DETRAY_HOST_DEVICE
+    constexpr counting_inspector &operator+=(const counting_inspector &other) {
+        n_steps += other.n_steps;
+        n_rk_adjustments += other.n_rk_adjustments;
+        n_constrained += other.n_constrained;
+        return *this;
+    }
+};
+
+/// A stepper inspector that collects statistics of the adaptive Runge-Kutta
+/// stepping: The distribution of the step sizes and of the error control
+/// retries per step, the number of field lookups and which constraints cut
+/// the steps.
+///
+/// Does not allocate, so it can be used in device code.
+///
+/// @note The field lookups are counted as requested by the stages of the
+/// @c rk_stepper (one at the start of a step and two per error estimate),
+/// i.e. before they reach the field cache of the stepper.
+///
+/// @tparam kSTEP_BINS number of step size bins: The first bin holds steps
+///                    below 1um, every other bin a decade of step sizes and
+///                    the last bin all remaining steps
+/// @tparam kRETRY_BINS number of retry bins: Bin i holds the steps with i
+///                     step size adjustments, the last bin all remaining steps
+template <std::size_t kSTEP_BINS = 10u, std::size_t kRETRY_BINS = 8u>
+struct statistics_inspector {
+
+    static_assert(kSTEP_BINS > 1u, "Need at least two step size bins");
+    static_assert(kRETRY_BINS > 1u, "Need at least two retry bins");
+
+    /// Number of completed steps
+    unsigned int n_steps{0u};
+    /// Total number of step size adjustments of the error control
+    unsigned int n_retries{0u};
+    /// Number of steps that exhausted the maximal number of adjustments
+    unsigned int n_max_retries{0u};
+    /// Number of steps that were not larger than the minimal step size
+    unsigned int n_min_steps{0u};
+    /// Number of magnetic field lookups
+    unsigned int n_field_lookups{0u};
+    /// Number of steps that were cut by a constraint, per constraint type
+    /// (accuracy, actor, aborter, user)
+    darray<unsigned int, 4u> n_constrained{0u, 0u, 0u, 0u};
+
+    /// Histogram of the absolute step sizes
+    darray<unsigned int, kSTEP_BINS> step_size_hist{};
+    /// Histogram of the number of step size adjustments per step
+    darray<unsigned int, kRETRY_BINS> retry_hist{};
+
+    /// @returns the lower edge of the step size bin @param i
+    DETRAY_HOST_DEVICE
+    static constexpr scalar step_size_edge(const std::size_t i) {
+        if (i == 0u) {
+            return 0.f;
+        }
+        scalar edge{1.f * unit<scalar>::um};
+        for (std::size_t j = 1u; j < i; ++j) {
+            edge *= 10.f;
+        }
+        return edge;
+    }
+
+    /// Inspector interface for the general stepping calls
+    template <typename state_type, typename scalar_t>
+    DETRAY_HOST_DEVICE void operator()(const state_type &state,
+                                       const stepping::config<scalar_t> &cfg,
+                                       const char *message) {
+
+        if (detail::starts_with(message, "Step complete")) {
+            const scalar_t step_size{math::abs(state._prev_step_size)};
+
+            ++n_steps;
+            n_min_steps += (step_size <= cfg.min_stepsize) ? 1u : 0u;
+            // The last error estimate was successful
+            n_field_lookups += 3u + 2u * m_step_retries;
+
+            ++step_size_hist[step_size_bin(step_size)];
+            ++retry_hist[m_step_retries < kRETRY_BINS ? m_step_retries
+                                                      : kRETRY_BINS - 1u];
+            m_step_retries = 0u;
+
+        } else if (detail::starts_with(message, "Before constraint")) {
+            // Find the strongest constraint
+            const auto &constraints = state.constraints();
+            const darray<scalar_t, 4u> sizes{
+                constraints.template size<step::constraint::e_accuracy>(),
+                constraints.template size<step::constraint::e_actor>(),
+                constraints.template size<step::constraint::e_aborter>(),
+                constraints.template size<step::constraint::e_user>()};
+
+            std::size_t cause{0u};
+            for (std::size_t i = 1u; i < 4u; ++i) {
+                cause = (sizes[i] < sizes[cause]) ? i : cause;
+            }
+            ++n_constrained[cause];
+        }
+    }
+
+    /// Inspector interface for the step size adjustments of the error control
+    template <typename state_type, typename scalar_t, typename scaling_t>
+    DETRAY_HOST_DEVICE void operator()(const state_type &,
+                                       const stepping::config<scalar_t> &cfg,
+                                       const char *message,
+                                       const std::size_t n_trials,
+                                       const scaling_t) {
+
+        if (detail::starts_with(message, "Adjust stepsize")) {
+            ++n_retries;
+            m_step_retries = static_cast<unsigned int>(n_trials);
+
+            // The step is aborted, since the error is still too large
+            if (n_trials >= cfg.max_rk_updates) {
+                ++n_max_retries;
+                n_field_lookups += 1u + 2u * m_step_retries;
+                m_step_retries = 0u;
+            }
+        }
+    }
+
+    /// @returns the mean number of step size adjustments per step
+    DETRAY_HOST_DEVICE
+    constexpr scalar mean_retries() const {
+        return n_steps > 0u ? static_cast<scalar>(n_retries) /
+                                  static_cast<scalar>(n_steps)
+                            : 0.f;
+    }
+
+    /// Add the statistics of a different track @param other
+    DETRAY_HOST_DEVICE
+    constexpr statistics_inspector &operator+=(
+        const statistics_inspector &other) {
+        n_steps += other.n_steps;
+        n_retries += other.n_retries;
+        n_max_retries += other.n_max_retries;
+        n_min_steps += other.n_min_steps;
+        n_field_lookups += other.n_field_lookups;
+        for (std::size_t i = 0u; i < 4u; ++i) {
+            n_constrained[i] += other.n_constrained[i];
+        }
+        for (std::size_t i = 0u; i < kSTEP_BINS; ++i) {
+            step_size_hist[i] += other.step_size_hist[i];
+        }
+        for (std::size_t i = 0u; i < kRETRY_BINS; ++i) {
+            retry_hist[i] += other.retry_hist[i];
+        }
+        return *this;
+    }
+
+    private:
+    /// @returns the histogram bin of the step size @param step_size
+    template <typename scalar_t>
+    DETRAY_HOST_DEVICE static constexpr std::size_t step_size_bin(
+        const scalar_t step_size) {
+        std::size_t i{1u};
+        for (; i < kSTEP_BINS; ++i) {
+            if (step_size < static_cast<scalar_t>(step_size_edge(i))) {
+                break;
+            }
+        }
+        return i - 1u;
+    }
+
+    /// Number of step size adjustments in the current step
+    unsigned int m_step_retries{0u};
+};
+
 }  // namespace stepping
 
+namespace propagation {
+
+/// A propagation inspector that prints the state of the propagation after
+/// every step. Meant for debugging.
+struct print_inspector {
+
+    /// Gathers propagation information accross the steps
+    std::stringstream debug_stream{};
+
+    /// Inspector interface. Gathers the propagation state after a step
+    template <typename state_type>
+    void operator()(const state_type &propagation) {
+        const auto &navigation = propagation._navigation;
+        const auto &stepping = propagation._stepping;
+
+        using algebra_t =
+            typename std::decay_t<decltype(stepping())>::algebra_type;
+
+        debug_stream << std::left << std::setw(30);
+        switch (navigation.status()) {
+            case navigation::status::e_overflow:
+                debug_stream << "status: overflow";
+                break;
+            case navigation::status::e_abort:
+                debug_stream << "status: abort";
+                break;
+            case navigation::status::e_on_target:
+                debug_stream << "status: e_on_target";
+                break;
+            case navigation::status::e_unknown:
+                debug_stream << "status: unknowm";
+                break;
+            case navigation::status::e_towards_object:
+                debug_stream << "status: towards_surface";
+                break;
+            case navigation::status::e_on_module:
+                debug_stream << "status: on_module";
+                break;
+            case navigation::status::e_on_portal:
+                debug_stream << "status: on_portal";
+                break;
+        };
+
+        if (detail::is_invalid_value(navigation.volume())) {
+            debug_stream << "volume: " << std::setw(10) << "invalid";
+        } else {
+            debug_stream << "volume: " << std::setw(10) << navigation.volume();
+        }
+
+        debug_stream << "surface: " << std::setw(14);
+        if (navigation.is_on_portal() or navigation.is_on_module()) {
+            debug_stream << navigation.barcode();
+        } else {
+            debug_stream << "undefined";
+        }
+
+        debug_stream << "step_size: " << std::setw(10)
+                     << stepping._prev_step_size << std::endl;
+
+        debug_stream << std::setw(10) << detail::ray<algebra_t>(stepping())
+                     << std::endl;
+    }
+
+    /// @returns a string representation of the gathered information
+    std::string to_string() const { return debug_stream.str(); }
+};
+
+}  // namespace propagation
+
 }  // namespace detray
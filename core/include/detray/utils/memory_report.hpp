@@ -0,0 +1,251 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/utils/grid/detail/grid_bins.hpp"
+#include "detray/utils/grid/grid.hpp"
+#include "detray/utils/tuple.hpp"
+#include "detray/utils/tuple_helpers.hpp"
+
+// System include(s)
+#include <cstddef>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace detray {
+
+/// Memory that is occupied by a data store
+struct memory_usage {
+    /// Number of contiguous containers the data is spread over
+    std::size_t n_containers{0u};
+    /// Total number of bytes of the data, as it would be copied to a device
+    std::size_t bytes{0u};
+    /// Bytes of grid bin entries that are reserved, but not filled
+    /// (bin capacity minus bin size, included in @c bytes )
+    std::size_t bin_slack_bytes{0u};
+
+    /// Add the memory usage of another store @param other
+    DETRAY_HOST
+    memory_usage &operator+=(const memory_usage &other) {
+        n_containers += other.n_containers;
+        bytes += other.bytes;
+        bin_slack_bytes += other.bin_slack_bytes;
+        return *this;
+    }
+};
+
+/// @brief Memory footprint of a detector, broken down by data store.
+///
+/// Every collection of a multi store (e.g. every mask type, every material
+/// type and every acceleration structure type) gets its own entry.
+struct memory_report {
+
+    /// Memory usage of a single data store
+    struct entry {
+        std::string name{};
+        memory_usage usage{};
+    };
+
+    /// @returns the summed memory usage of all stores
+    DETRAY_HOST
+    memory_usage total() const {
+        memory_usage sum{};
+        for (const entry &e : entries) {
+            sum += e.usage;
+        }
+        return sum;
+    }
+
+    /// @returns a table of the memory usage of the stores
+    DETRAY_HOST
+    std::string to_string() const {
+        std::stringstream ss;
+
+        const auto print = [&ss](const std::string &name,
+                                 const memory_usage &usage) {
+            ss << std::left << std::setw(28) << name << std::right
+               << std::setw(6) << usage.n_containers << std::setw(16)
+               << usage.bytes << std::setw(16) << usage.bin_slack_bytes
+               << std::endl;
+        };
+
+        ss << std::left << std::setw(28) << "store" << std::right
+           << std::setw(6) << "vecs" << std::setw(16) << "bytes"
+           << std::setw(16) << "bin slack" << std::endl;
+
+        for (const entry &e : entries) {
+            print(e.name, e.usage);
+        }
+        print("total", total());
+
+        return ss.str();
+    }
+
+    std::vector<entry> entries{};
+};
+
+namespace detail {
+
+/// @returns the memory usage of the data behind a vecmem vector view
+/// @param view
+template <typename T>
+DETRAY_HOST memory_usage get_memory_usage(const dvector_view<T> &view) {
+    return {1u, view.size() * sizeof(T), 0u};
+}
+
+/// @returns the memory usage of the data behind a composite view @param view
+/// @{
+template <typename... Ts>
+DETRAY_HOST memory_usage get_memory_usage(const dmulti_view<Ts...> &view);
+
+template <typename... Ts, std::size_t... I>
+DETRAY_HOST memory_usage get_memory_usage(const dmulti_view<Ts...> &view,
+                                          std::index_sequence<I...> /*seq*/) {
+    memory_usage usage{};
+    ((usage += get_memory_usage(detail::get<I>(view.m_view))), ...);
+    return usage;
+}
+
+template <typename... Ts>
+DETRAY_HOST memory_usage get_memory_usage(const dmulti_view<Ts...> &view) {
+    return get_memory_usage(view, std::make_index_sequence<sizeof...(Ts)>{});
+}
+/// @}
+
+/// @returns the bytes of the bin entries in the grid @param gr that are
+/// reserved, but not filled
+template <typename grid_t>
+DETRAY_HOST std::size_t bin_slack_bytes(const grid_t &gr) {
+    using bin_t = typename grid_t::bin_type;
+    using entry_t = typename bin_t::entry_type;
+
+    // Single entry bins are always considered full
+    if constexpr (std::is_same_v<bin_t, bins::single<entry_t>>) {
+        return 0u;
+    } else {
+        std::size_t n_slack{0u};
+        for (const auto &bin : gr.bins()) {
+            n_slack += bin.capacity() - bin.size();
+        }
+        return n_slack * sizeof(entry_t);
+    }
+}
+
+/// Helper trait to check whether a collection holds grids
+/// @{
+template <typename T, typename = void>
+struct is_grid_collection : public std::false_type {};
+
+template <typename T>
+struct is_grid_collection<
+    T, std::enable_if_t<detail::is_grid_v<typename T::value_type>, void>>
+    : public std::true_type {};
+
+template <typename T>
+inline constexpr bool is_grid_collection_v = is_grid_collection<T>::value;
+/// @}
+
+/// @returns the memory usage of a data collection @param coll of the
+/// detector, including the bin slack if it is a grid or a grid collection
+template <typename collection_t>
+DETRAY_HOST memory_usage get_memory_usage(const collection_t &coll) {
+    memory_usage usage{get_memory_usage(detray::get_data(coll))};
+
+    if constexpr (detail::is_grid_v<collection_t>) {
+        usage.bin_slack_bytes = bin_slack_bytes(coll);
+    } else if constexpr (is_grid_collection_v<collection_t>) {
+        for (const auto &gr : coll) {
+            usage.bin_slack_bytes += bin_slack_bytes(gr);
+        }
+    }
+
+    return usage;
+}
+
+/// @returns the name of the collection with index @tparam I in a multi
+/// store, which is the shape name for masks
+template <typename value_t, std::size_t I, typename = void>
+struct collection_name {
+    static std::string get() { return std::to_string(I); }
+};
+
+template <typename value_t, std::size_t I>
+struct collection_name<value_t, I,
+                       std::void_t<decltype(value_t::shape::name)>> {
+    static std::string get() { return value_t::shape::name; }
+};
+
+/// Add an entry for every collection in the multi store @param store to
+/// the memory @param report
+template <typename store_t, std::size_t... I>
+DETRAY_HOST void add_memory_usage(memory_report &report,
+                                  const std::string &store_name,
+                                  const store_t &store,
+                                  std::index_sequence<I...> /*seq*/) {
+    (report.entries.push_back(
+         {store_name + "/" +
+              collection_name<
+                  typename store_t::template get_type<
+                      store_t::value_types::to_id(I)>,
+                  I>::get(),
+          get_memory_usage(
+              store.template get<store_t::value_types::to_id(I)>())}),
+     ...);
+}
+
+}  // namespace detail
+
+/// @brief Walk the data stores of the detector @param det and collect
+/// their memory footprint.
+///
+/// The byte counts are taken from the views of the stores and therefore
+/// correspond to the sizes of the device buffers that the detector is
+/// copied to (the spare capacity of the host vectors is not counted).
+///
+/// @returns the memory report of the detector
+template <typename detector_t>
+DETRAY_HOST memory_report get_memory_report(const detector_t &det) {
+
+    memory_report report{};
+
+    report.entries.push_back(
+        {"volumes", detail::get_memory_usage(det.volumes())});
+    report.entries.push_back(
+        {"surfaces", detail::get_memory_usage(det.surfaces())});
+    report.entries.push_back(
+        {"transforms", detail::get_memory_usage(det.transform_store())});
+
+    using mask_store_t = typename detector_t::mask_container;
+    detail::add_memory_usage(
+        report, "masks", det.mask_store(),
+        std::make_index_sequence<mask_store_t::n_collections()>{});
+
+    using material_store_t = typename detector_t::material_container;
+    detail::add_memory_usage(
+        report, "materials", det.material_store(),
+        std::make_index_sequence<material_store_t::n_collections()>{});
+
+    using accel_store_t = typename detector_t::accelerator_container;
+    detail::add_memory_usage(
+        report, "accelerators", det.accelerator_store(),
+        std::make_index_sequence<accel_store_t::n_collections()>{});
+
+    report.entries.push_back(
+        {"volume finder", detail::get_memory_usage(det.volume_search_grid())});
+
+    return report;
+}
+
+}  // namespace detray
@@ -0,0 +1,266 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Vecmem include(s)
+#include <vecmem/memory/memory_resource.hpp>
+
+// POSIX include(s)
+#if defined(__linux__)
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// System include(s)
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace detray::numa {
+
+namespace detail {
+
+/// Size of a (transparent) huge page on x86-64 and aarch64: 2 MiB
+inline constexpr std::size_t huge_page_size{1u << 21u};
+
+/// Memory policy of @c mbind that restricts the pages to the given nodes
+inline constexpr int mpol_bind{2};
+
+/// @returns the numbers in a kernel list format, e.g. "0-3,8,10-11"
+inline std::vector<unsigned int> parse_list(const std::string &list) {
+    std::vector<unsigned int> values{};
+
+    std::stringstream stream(list);
+    std::string range;
+    while (std::getline(stream, range, ',')) {
+        if (range.empty() || range == "\n") {
+            continue;
+        }
+        const std::size_t dash{range.find('-')};
+        const auto first{
+            static_cast<unsigned int>(std::stoul(range.substr(0u, dash)))};
+        const auto last{dash == std::string::npos
+                            ? first
+                            : static_cast<unsigned int>(
+                                  std::stoul(range.substr(dash + 1u)))};
+        for (unsigned int v = first; v <= last; ++v) {
+            values.push_back(v);
+        }
+    }
+
+    return values;
+}
+
+/// @returns the content of the sysfs file @param path (empty on failure)
+inline std::string read_sysfs(const std::string &path) {
+    std::ifstream file(path);
+    std::string content{};
+    std::getline(file, content);
+    return content;
+}
+
+/// @returns @param n rounded up to a multiple of @param align
+constexpr std::size_t round_up(const std::size_t n, const std::size_t align) {
+    return (n + align - 1u) / align * align;
+}
+
+}  // namespace detail
+
+/// @returns the number of NUMA nodes of the host (one, if it is unknown)
+inline unsigned int n_nodes() {
+    const std::vector<unsigned int> nodes = detail::parse_list(
+        detail::read_sysfs("/sys/devices/system/node/online"));
+    return nodes.empty() ? 1u : nodes.back() + 1u;
+}
+
+/// @returns the CPUs of the NUMA node @param node (empty, if it is unknown)
+inline std::vector<unsigned int> node_cpus(const unsigned int node) {
+    return detail::parse_list(detail::read_sysfs(
+        "/sys/devices/system/node/node" + std::to_string(node) + "/cpulist"));
+}
+
+/// Restrict the calling thread to the CPUs of the NUMA node @param node
+///
+/// Memory that the thread touches first is then placed on the node, too.
+///
+/// @returns false if the thread could not be bound (e.g. unknown topology)
+inline bool bind_thread(const unsigned int node) {
+#if defined(__linux__)
+    const std::vector<unsigned int> cpus = node_cpus(node);
+    if (cpus.empty()) {
+        return false;
+    }
+
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (const unsigned int cpu : cpus) {
+        if (cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &cpu_set);
+        }
+    }
+
+    return ::sched_setaffinity(0, sizeof(cpu_set_t), &cpu_set) == 0;
+#else
+    (void)node;
+    return false;
+#endif
+}
+
+/// @brief Construct an object once per NUMA node
+///
+/// Every object is made by @param factory on a thread that is bound to the
+/// node (see @c bind_thread ), so that the memory it allocates and fills is
+/// local to that node (first touch), e.g. a copy of a magnetic field map.
+///
+/// @returns one object per node, in the order of the nodes
+template <typename factory_t>
+auto replicate(const unsigned int n, factory_t &&factory) {
+    std::vector<decltype(factory(0u))> replicas{};
+    replicas.reserve(n);
+
+    for (unsigned int node = 0u; node < n; ++node) {
+        std::thread worker([&replicas, &factory, node]() {
+            bind_thread(node);
+            replicas.push_back(factory(node));
+        });
+        worker.join();
+    }
+
+    return replicas;
+}
+
+/// @brief Memory resource that places its allocations on a NUMA node.
+///
+/// Every allocation is an anonymous memory mapping, which is bound to the
+/// node and, if requested, backed by transparent huge pages, which reduces
+/// the TLB misses on large, randomly accessed stores. Since every allocation
+/// takes at least a page, the resource is meant for a few large allocations,
+/// e.g. the arena of a packed detector (see @c detector_replicas ).
+///
+/// If the host has no NUMA support, the memory is placed by the kernel as
+/// usual (first touch). On other platforms than Linux, the allocations fall
+/// back to the aligned global operator new.
+class memory_resource final : public vecmem::memory_resource {
+
+    public:
+    /// Allocate on the node @param node , with huge pages if
+    /// @param huge_pages is set
+    explicit memory_resource(const unsigned int node,
+                             const bool huge_pages = false)
+        : m_node{node}, m_huge_pages{huge_pages} {}
+
+    /// @returns the NUMA node of the allocations
+    unsigned int node() const { return m_node; }
+
+    /// @returns whether huge pages are requested for the allocations
+    bool huge_pages() const { return m_huge_pages; }
+
+    private:
+    /// @returns the mapped size for an allocation of @param bytes
+    std::size_t mapped_size(const std::size_t bytes) const {
+        return detail::round_up(std::max(bytes, std::size_t{1u}),
+                                m_huge_pages ? detail::huge_page_size
+                                             : page_size());
+    }
+
+    /// @returns the size of a regular page
+    static std::size_t page_size() {
+#if defined(__linux__)
+        return static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+#else
+        return 4096u;
+#endif
+    }
+
+    /// @returns the alignment of an allocation with @param alignment
+    std::size_t mapped_alignment(const std::size_t alignment) const {
+        return std::max(alignment,
+                        m_huge_pages ? detail::huge_page_size : page_size());
+    }
+
+    void *do_allocate(const std::size_t bytes,
+                      const std::size_t alignment) override {
+        const std::size_t size{mapped_size(bytes)};
+        const std::size_t align{mapped_alignment(alignment)};
+
+#if defined(__linux__)
+        // Over-allocate, so that the mapping can be aligned
+        const std::size_t total{size + align};
+        void *addr = ::mmap(nullptr, total, PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (addr == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+
+        // Give back the unaligned head and the tail of the mapping
+        const auto base{reinterpret_cast<std::uintptr_t>(addr)};
+        const std::uintptr_t aligned{detail::round_up(base, align)};
+        if (aligned > base) {
+            ::munmap(addr, aligned - base);
+        }
+        const std::uintptr_t end{aligned + size};
+        if (base + total > end) {
+            ::munmap(reinterpret_cast<void *>(end), base + total - end);
+        }
+
+        auto *ptr = reinterpret_cast<void *>(aligned);
+
+        if (m_huge_pages) {
+            ::madvise(ptr, size, MADV_HUGEPAGE);
+        }
+
+        // Bind the pages to the node, before they are touched. Failure is
+        // not fatal: The pages are then placed by first touch
+        constexpr std::size_t bits{8u * sizeof(unsigned long)};
+        std::vector<unsigned long> node_mask(m_node / bits + 1u, 0ul);
+        node_mask[m_node / bits] = 1ul << (m_node % bits);
+        ::syscall(SYS_mbind, ptr, size, detail::mpol_bind, node_mask.data(),
+                  node_mask.size() * bits + 1u, 0u);
+
+        return ptr;
+#else
+        return ::operator new(size, std::align_val_t{align});
+#endif
+    }
+
+    void do_deallocate(void *ptr, const std::size_t bytes,
+                       const std::size_t alignment) override {
+        if (ptr != nullptr) {
+#if defined(__linux__)
+            (void)alignment;
+            ::munmap(ptr, mapped_size(bytes));
+#else
+            (void)bytes;
+            ::operator delete(ptr, std::align_val_t{
+                                       mapped_alignment(alignment)});
+#endif
+        }
+    }
+
+    bool do_is_equal(
+        const vecmem::memory_resource &other) const noexcept override {
+        const auto *numa_mr = dynamic_cast<const memory_resource *>(&other);
+        return numa_mr != nullptr && numa_mr->m_node == m_node &&
+               numa_mr->m_huge_pages == m_huge_pages;
+    }
+
+    /// The node of the allocations
+    unsigned int m_node{0u};
+    /// Back the allocations by transparent huge pages
+    bool m_huge_pages{false};
+};
+
+}  // namespace detray::numa
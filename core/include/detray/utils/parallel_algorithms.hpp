@@ -0,0 +1,343 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/algorithms.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/propagator/parallel_executor.hpp"
+#include "detray/utils/ranges/for_each.hpp"
+#include "detray/utils/ranges/ranges.hpp"
+
+// Thrust include(s)
+#if defined(__CUDACC__)
+#include <thrust/execution_policy.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+#endif
+
+// System include(s)
+#include <algorithm>
+#include <cassert>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace detray {
+
+/// Execution policies that select where the range algorithms below run
+namespace execution {
+
+/// Run on the calling thread (host or device)
+struct sequenced_policy {};
+
+/// Run on several host threads, which take the elements of the range in
+/// chunks (see @c propagation::parallel_executor )
+struct host_threads_policy {
+    /// Number of threads (including the calling thread)
+    unsigned int n_threads{std::max(1u, std::thread::hardware_concurrency())};
+    /// Number of elements that a thread takes at once
+    unsigned int chunk_size{256u};
+};
+
+#if defined(__CUDACC__)
+/// Hand the algorithm to Thrust, e.g. with @c thrust::device for ranges that
+/// live in device memory
+template <typename thrust_exec_t>
+struct thrust_policy {
+    thrust_exec_t exec{};
+};
+#endif
+
+inline constexpr sequenced_policy seq{};
+
+}  // namespace execution
+
+namespace ranges {
+
+namespace detail {
+
+/// Call @param func for every index in [0, @param n) on the host threads of
+/// @param policy.
+///
+/// Exceptions are caught on the worker threads and the one thrown for the
+/// lowest index is rethrown on the calling thread, once all indices are done
+template <typename func_t>
+DETRAY_HOST void run_on_host_threads(
+    const execution::host_threads_policy &policy, const unsigned int n,
+    func_t &&func) {
+
+    std::mutex error_mutex;
+    unsigned int error_idx{n};
+    std::exception_ptr error{};
+
+    const propagation::parallel_executor exec{policy.n_threads,
+                                              policy.chunk_size};
+    exec(n, [&](const unsigned int i) {
+        try {
+            func(i);
+        } catch (...) {
+            const std::lock_guard<std::mutex> lock{error_mutex};
+            if (i < error_idx) {
+                error_idx = i;
+                error = std::current_exception();
+            }
+        }
+    });
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+/// @returns the iterator to the element @param i of a random access range
+template <typename iterator_t>
+DETRAY_HOST_DEVICE constexpr auto at(const iterator_t &first,
+                                     const unsigned int i) {
+    using difference_t =
+        typename std::iterator_traits<iterator_t>::difference_type;
+    return first + static_cast<difference_t>(i);
+}
+
+template <typename range_t>
+inline constexpr bool parallel_range_v = detray::ranges::random_access_range_v<
+    detray::detail::remove_cvref_t<range_t>>;
+
+}  // namespace detail
+
+/// for_each
+/// @{
+/// Call @param f on every element of the range @param r
+template <typename range_t, typename func_t>
+DETRAY_HOST_DEVICE constexpr void for_each(execution::sequenced_policy,
+                                           range_t &&r, func_t &&f) {
+    detray::ranges::for_each(std::forward<range_t>(r), f);
+}
+
+template <typename range_t, typename func_t>
+DETRAY_HOST void for_each(const execution::host_threads_policy &policy,
+                          range_t &&r, func_t &&f) {
+    static_assert(detail::parallel_range_v<range_t>,
+                  "Parallel for_each needs a random access range");
+
+    const auto first = detray::ranges::begin(r);
+    const auto n{static_cast<unsigned int>(detray::ranges::size(r))};
+
+    detail::run_on_host_threads(policy, n, [&first, &f](const unsigned int i) {
+        f(*detail::at(first, i));
+    });
+}
+
+#if defined(__CUDACC__)
+template <typename thrust_exec_t, typename range_t, typename func_t>
+DETRAY_HOST void for_each(const execution::thrust_policy<thrust_exec_t> &policy,
+                          range_t &&r, func_t &&f) {
+    thrust::for_each(policy.exec, detray::ranges::begin(r),
+                     detray::ranges::end(r), std::forward<func_t>(f));
+}
+#endif
+/// @}
+
+/// transform
+/// @{
+/// Write the result of @param f for every element of the range @param in to
+/// the corresponding element of the range @param out
+template <typename in_range_t, typename out_range_t, typename func_t>
+DETRAY_HOST_DEVICE constexpr void transform(execution::sequenced_policy,
+                                            const in_range_t &in,
+                                            out_range_t &&out, func_t &&f) {
+    auto out_itr = detray::ranges::begin(out);
+    for (const auto &v : in) {
+        *out_itr = f(v);
+        ++out_itr;
+    }
+}
+
+template <typename in_range_t, typename out_range_t, typename func_t>
+DETRAY_HOST void transform(const execution::host_threads_policy &policy,
+                           const in_range_t &in, out_range_t &&out,
+                           func_t &&f) {
+    static_assert(detail::parallel_range_v<in_range_t> and
+                      detail::parallel_range_v<out_range_t>,
+                  "Parallel transform needs random access ranges");
+    assert(detray::ranges::size(out) >= detray::ranges::size(in));
+
+    const auto in_first = detray::ranges::begin(in);
+    const auto out_first = detray::ranges::begin(out);
+    const auto n{static_cast<unsigned int>(detray::ranges::size(in))};
+
+    detail::run_on_host_threads(
+        policy, n, [&in_first, &out_first, &f](const unsigned int i) {
+            *detail::at(out_first, i) = f(*detail::at(in_first, i));
+        });
+}
+
+#if defined(__CUDACC__)
+template <typename thrust_exec_t, typename in_range_t, typename out_range_t,
+          typename func_t>
+DETRAY_HOST void transform(
+    const execution::thrust_policy<thrust_exec_t> &policy,
+    const in_range_t &in, out_range_t &&out, func_t &&f) {
+    thrust::transform(policy.exec, detray::ranges::begin(in),
+                      detray::ranges::end(in), detray::ranges::begin(out),
+                      std::forward<func_t>(f));
+}
+#endif
+/// @}
+
+/// transform_reduce
+/// @{
+/// Reduce the results of @param transform_op for all elements of the range
+/// @param r with @param reduce_op, starting from @param init.
+///
+/// @note the host threads reduce the range in chunks, so the result only
+/// equals the sequential one if @param reduce_op is associative (e.g. not
+/// exactly for floating point sums)
+template <typename range_t, typename value_t, typename reduce_t,
+          typename transform_t>
+DETRAY_HOST_DEVICE constexpr value_t transform_reduce(
+    execution::sequenced_policy, const range_t &r, value_t init,
+    reduce_t &&reduce_op, transform_t &&transform_op) {
+    for (const auto &v : r) {
+        init = reduce_op(init, transform_op(v));
+    }
+    return init;
+}
+
+template <typename range_t, typename value_t, typename reduce_t,
+          typename transform_t>
+DETRAY_HOST value_t transform_reduce(
+    const execution::host_threads_policy &policy, const range_t &r,
+    value_t init, reduce_t &&reduce_op, transform_t &&transform_op) {
+    static_assert(detail::parallel_range_v<range_t>,
+                  "Parallel transform_reduce needs a random access range");
+
+    const auto first = detray::ranges::begin(r);
+    const auto n{static_cast<unsigned int>(detray::ranges::size(r))};
+    const unsigned int chunk{std::max(1u, policy.chunk_size)};
+    const unsigned int n_chunks{(n + chunk - 1u) / chunk};
+
+    // Reduce every chunk separately, then reduce the chunks in order
+    std::vector<value_t> partials(n_chunks, init);
+    detail::run_on_host_threads(
+        {policy.n_threads, 1u}, n_chunks, [&](const unsigned int c) {
+            const unsigned int begin{c * chunk};
+            const unsigned int end{std::min(begin + chunk, n)};
+
+            value_t partial = transform_op(*detail::at(first, begin));
+            for (unsigned int i = begin + 1u; i < end; ++i) {
+                partial =
+                    reduce_op(partial, transform_op(*detail::at(first, i)));
+            }
+            partials[c] = std::move(partial);
+        });
+
+    for (const value_t &partial : partials) {
+        init = reduce_op(init, partial);
+    }
+    return init;
+}
+
+#if defined(__CUDACC__)
+template <typename thrust_exec_t, typename range_t, typename value_t,
+          typename reduce_t, typename transform_t>
+DETRAY_HOST value_t transform_reduce(
+    const execution::thrust_policy<thrust_exec_t> &policy, const range_t &r,
+    value_t init, reduce_t &&reduce_op, transform_t &&transform_op) {
+    return thrust::transform_reduce(
+        policy.exec, detray::ranges::begin(r), detray::ranges::end(r),
+        std::forward<transform_t>(transform_op), init,
+        std::forward<reduce_t>(reduce_op));
+}
+#endif
+/// @}
+
+/// sort
+/// @{
+/// Sort the elements of the range @param r according to @param comp
+template <typename range_t, typename comp_t = std::less<>>
+DETRAY_HOST_DEVICE inline void sort(execution::sequenced_policy, range_t &&r,
+                                    comp_t &&comp = {}) {
+    detray::detail::sequential_sort(detray::ranges::begin(r),
+                                    detray::ranges::end(r),
+                                    std::forward<comp_t>(comp));
+}
+
+/// Every thread sorts a part of the range first, then neighbouring parts are
+/// merged pairwise, until the whole range is sorted
+template <typename range_t, typename comp_t = std::less<>>
+DETRAY_HOST void sort(const execution::host_threads_policy &policy,
+                      range_t &&r, comp_t &&comp = {}) {
+    static_assert(detail::parallel_range_v<range_t>,
+                  "Parallel sort needs a random access range");
+
+    const auto first = detray::ranges::begin(r);
+    const auto n{static_cast<unsigned int>(detray::ranges::size(r))};
+    const unsigned int n_parts{std::min(
+        std::max(1u, policy.n_threads),
+        std::max(1u, n / std::max(1u, policy.chunk_size)))};
+
+    if (n_parts == 1u) {
+        std::sort(first, detail::at(first, n), comp);
+        return;
+    }
+
+    // Element index range of every part
+    std::vector<unsigned int> bounds(n_parts + 1u);
+    for (unsigned int p = 0u; p <= n_parts; ++p) {
+        bounds[p] = static_cast<unsigned int>(
+            (static_cast<std::size_t>(p) * n) / n_parts);
+    }
+
+    const execution::host_threads_policy one_by_one{n_parts, 1u};
+    detail::run_on_host_threads(one_by_one, n_parts,
+                                [&](const unsigned int p) {
+                                    std::sort(detail::at(first, bounds[p]),
+                                              detail::at(first, bounds[p + 1u]),
+                                              comp);
+                                });
+
+    for (unsigned int width = 1u; width < n_parts; width *= 2u) {
+        const unsigned int n_merges{(n_parts + 2u * width - 1u) /
+                                    (2u * width)};
+        detail::run_on_host_threads(
+            one_by_one, n_merges, [&](const unsigned int m) {
+                const unsigned int lower{2u * m * width};
+                const unsigned int middle{std::min(lower + width, n_parts)};
+                const unsigned int upper{std::min(lower + 2u * width, n_parts)};
+                if (middle < upper) {
+                    std::inplace_merge(detail::at(first, bounds[lower]),
+                                       detail::at(first, bounds[middle]),
+                                       detail::at(first, bounds[upper]), comp);
+                }
+            });
+    }
+}
+
+#if defined(__CUDACC__)
+template <typename thrust_exec_t, typename range_t,
+          typename comp_t = thrust::less<
+              detray::ranges::range_value_t<std::remove_reference_t<range_t>>>>
+DETRAY_HOST void sort(const execution::thrust_policy<thrust_exec_t> &policy,
+                      range_t &&r, comp_t &&comp = {}) {
+    thrust::sort(policy.exec, detray::ranges::begin(r), detray::ranges::end(r),
+                 std::forward<comp_t>(comp));
+}
+#endif
+/// @}
+
+}  // namespace ranges
+
+}  // namespace detray
@@ -11,6 +11,7 @@
 #include "detray/utils/ranges/cartesian_product.hpp"
 #include "detray/utils/ranges/empty.hpp"
 #include "detray/utils/ranges/enumerate.hpp"
+#include "detray/utils/ranges/for_each.hpp"
 #include "detray/utils/ranges/iota.hpp"
 #include "detray/utils/ranges/join.hpp"
 #include "detray/utils/ranges/pick.hpp"
@@ -0,0 +1,125 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/utils/ranges/join.hpp"
+#include "detray/utils/ranges/ranges.hpp"
+#include "detray/utils/ranges/static_join.hpp"
+
+// System include(s)
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace detray::ranges {
+
+/// @brief A contiguous range of elements, given by a pointer and a count.
+template <typename T>
+struct contiguous_span {
+    T *ptr{nullptr};
+    dindex size{0u};
+};
+
+namespace detail {
+
+/// Ranges that consist of a number of contiguous spans:
+/// @c n_spans() and @c span(i) returning a @c contiguous_span
+/// @{
+template <typename R, typename = void>
+struct has_spans : public std::false_type {};
+
+template <typename R>
+struct has_spans<R, std::void_t<decltype(std::declval<const R &>().n_spans()),
+                                decltype(std::declval<const R &>().span(
+                                    std::declval<dindex>()))>>
+    : public std::true_type {};
+/// @}
+
+template <typename R>
+struct is_join_view : public std::false_type {};
+
+template <typename R>
+struct is_join_view<detray::ranges::join_view<R>> : public std::true_type {};
+
+template <typename R>
+struct is_join_view<detray::views::join<R>> : public std::true_type {};
+
+template <typename R>
+struct is_static_join_view : public std::false_type {};
+
+template <std::size_t I, typename I_t>
+struct is_static_join_view<detray::ranges::static_join_view<I, I_t>>
+    : public std::true_type {};
+
+template <std::size_t I, typename I_t>
+struct is_static_join_view<detray::views::static_join<I, I_t>>
+    : public std::true_type {};
+
+/// Call @param f on every element of the span @param s
+template <typename T, typename func_t>
+DETRAY_HOST_DEVICE constexpr void for_each_in_span(
+    const contiguous_span<T> &s, func_t &f) {
+    for (dindex i = 0u; i < s.size; ++i) {
+        f(s.ptr[i]);
+    }
+}
+
+/// Call @param f on every element of the range @param r, with a plain
+/// counted loop if the range is contiguous
+template <typename range_t, typename func_t>
+DETRAY_HOST_DEVICE constexpr void for_each_element(range_t &&r, func_t &f) {
+    if constexpr (detray::ranges::contiguous_range_v<range_t>) {
+        for_each_in_span(
+            contiguous_span<std::remove_pointer_t<decltype(r.data())>>{
+                r.data(), static_cast<dindex>(r.size())},
+            f);
+    } else {
+        for (auto &&v : r) {
+            f(v);
+        }
+    }
+}
+
+}  // namespace detail
+
+/// @brief Call @param f on every element of the range @param r .
+///
+/// Unlike a range-based for loop, the nested loops of joined ranges are not
+/// flattened into a single iterator with branchy increments: Every sub-range
+/// is handled by its own loop, which runs over (pointer, count) spans if the
+/// sub-ranges are contiguous.
+template <typename range_t, typename func_t>
+DETRAY_HOST_DEVICE constexpr void for_each(range_t &&r, func_t &&f) {
+
+    using view_t = std::remove_cv_t<std::remove_reference_t<range_t>>;
+
+    if constexpr (detail::has_spans<view_t>::value) {
+        for (dindex i = 0u; i < r.n_spans(); ++i) {
+            detail::for_each_in_span(r.span(i), f);
+        }
+    } else if constexpr (detail::is_join_view<view_t>::value) {
+        for (auto itr = r.m_begin; itr != r.m_end; ++itr) {
+            detail::for_each_element(*itr, f);
+        }
+    } else if constexpr (detail::is_static_join_view<view_t>::value) {
+        constexpr std::size_t n_ranges{
+            std::tuple_size_v<std::remove_cv_t<decltype(view_t::m_begins)>>};
+        for (std::size_t i = 0u; i < n_ranges; ++i) {
+            for (auto itr = r.m_begins[i]; itr != r.m_ends[i]; ++itr) {
+                f(*itr);
+            }
+        }
+    } else {
+        detail::for_each_element(std::forward<range_t>(r), f);
+    }
+}
+
+}  // namespace detray::ranges
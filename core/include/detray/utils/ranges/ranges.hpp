@@ -167,11 +167,15 @@ template <class R>
 inline constexpr bool random_access_range_v = detray::ranges::range_v<R>and
     random_access_iterator_v<detray::ranges::iterator_t<R>>;
 
-// Contiguous iterator trait is only available in c++20
-/*
+// Contiguous iterator trait is only available in c++20: Ranges that store
+// their elements contiguously (accessible through @c data() and @c size() )
+// opt in by specializing @c is_contiguous_range
+template <typename R, typename = void>
+struct is_contiguous_range : public std::false_type {};
+
 template <typename R>
-inline constexpr bool contiguous_range_v = ...
-*/
+inline constexpr bool contiguous_range_v =
+    is_contiguous_range<detray::detail::remove_cvref_t<R>>::value;
 
 /// @see https://en.cppreference.com/w/cpp/ranges/sized_range
 template <class R>
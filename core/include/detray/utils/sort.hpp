@@ -12,6 +12,7 @@
 
 // System include(s).
 #include <algorithm>
+#include <cstddef>
 #include <functional>
 
 namespace detray {
@@ -60,4 +61,148 @@ DETRAY_HOST_DEVICE inline void selection_sort(vector_t<TYPE> &vec) {
     selection_sort(vec.begin(), vec.end());
 }
 
+/// Selection sort that stops after the smallest elements have been placed in
+/// the range [first, middle). The order of [middle, last) is unspecified.
+template <class RandomIt, class Comp = std::less<void>>
+DETRAY_HOST_DEVICE inline void partial_selection_sort(RandomIt first,
+                                                      RandomIt middle,
+                                                      RandomIt last,
+                                                      Comp &&comp = Comp()) {
+    for (RandomIt i = first; i < middle; ++i) {
+        RandomIt k = i;
+
+        for (RandomIt j = i + 1; j < last; ++j) {
+            if (comp(*j, *k)) {
+                k = j;
+            }
+        }
+
+        if (k != i) {
+            auto t = *i;
+            *i = *k;
+            *k = t;
+        }
+    }
+}
+
+/// Swap the elements @param a and @param b , if they are out of order
+template <class T, class Comp>
+DETRAY_HOST_DEVICE inline void compare_exchange(T &a, T &b, Comp &&comp) {
+    if (comp(b, a)) {
+        auto t = a;
+        a = b;
+        b = t;
+    }
+}
+
+/// Insertion sort that searches the insertion point linearly from the back.
+/// Runs in linear time on ranges where every element is close to its final
+/// position (e.g. after updating the path of the navigation candidates).
+template <class RandomIt, class Comp = std::less<void>>
+DETRAY_HOST_DEVICE inline void linear_insertion_sort(RandomIt first,
+                                                     RandomIt last,
+                                                     Comp &&comp = Comp()) {
+    if (first == last) {
+        return;
+    }
+    for (RandomIt i = first + 1; i < last; ++i) {
+        auto t = *i;
+        RandomIt j = i;
+        for (; j != first && comp(t, *(j - 1)); --j) {
+            *j = *(j - 1);
+        }
+        *j = t;
+    }
+}
+
+namespace detail {
+
+/// Apply the compare-exchange operations @param pairs to the range that
+/// starts at @param first
+template <class RandomIt, class Comp, std::size_t N>
+DETRAY_HOST_DEVICE inline void apply_network(RandomIt first, Comp &&comp,
+                                             const int (&pairs)[N][2]) {
+    for (std::size_t i = 0u; i < N; ++i) {
+        compare_exchange(first[pairs[i][0]], first[pairs[i][1]], comp);
+    }
+}
+
+}  // namespace detail
+
+/// Sorting networks (fixed sequence of compare-exchange operations without
+/// data dependent branching) for ranges of up to eight elements.
+///
+/// @returns false if the range is too large and was left unsorted
+template <class RandomIt, class Comp = std::less<void>>
+DETRAY_HOST_DEVICE inline bool sorting_network(RandomIt first, RandomIt last,
+                                               Comp &&comp = Comp()) {
+    switch (last - first) {
+        case 0:
+        case 1: {
+            return true;
+        }
+        case 2: {
+            compare_exchange(first[0], first[1], comp);
+            return true;
+        }
+        case 3: {
+            constexpr int net[3][2]{{0, 2}, {0, 1}, {1, 2}};
+            detail::apply_network(first, comp, net);
+            return true;
+        }
+        case 4: {
+            constexpr int net[5][2]{{0, 2}, {1, 3}, {0, 1}, {2, 3}, {1, 2}};
+            detail::apply_network(first, comp, net);
+            return true;
+        }
+        case 5: {
+            constexpr int net[9][2]{{0, 3}, {1, 4}, {0, 2}, {1, 3}, {0, 1},
+                                    {2, 4}, {1, 2}, {3, 4}, {2, 3}};
+            detail::apply_network(first, comp, net);
+            return true;
+        }
+        case 6: {
+            constexpr int net[12][2]{{0, 5}, {1, 3}, {2, 4}, {1, 2},
+                                     {3, 4}, {0, 3}, {2, 5}, {0, 1},
+                                     {2, 3}, {4, 5}, {1, 2}, {3, 4}};
+            detail::apply_network(first, comp, net);
+            return true;
+        }
+        case 7: {
+            constexpr int net[16][2]{{0, 6}, {2, 3}, {4, 5}, {0, 2},
+                                     {1, 4}, {3, 6}, {0, 1}, {2, 5},
+                                     {3, 4}, {1, 2}, {4, 6}, {2, 3},
+                                     {4, 5}, {1, 2}, {3, 4}, {5, 6}};
+            detail::apply_network(first, comp, net);
+            return true;
+        }
+        case 8: {
+            constexpr int net[19][2]{{0, 2}, {1, 3}, {4, 6}, {5, 7}, {0, 4},
+                                     {1, 5}, {2, 6}, {3, 7}, {0, 1}, {2, 3},
+                                     {4, 5}, {6, 7}, {2, 4}, {3, 5}, {1, 4},
+                                     {3, 6}, {1, 2}, {3, 4}, {5, 6}};
+            detail::apply_network(first, comp, net);
+            return true;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+/// @returns the number of neighbouring elements in the range [first, last)
+/// that are out of order (zero for a sorted range)
+template <class RandomIt, class Comp = std::less<void>>
+DETRAY_HOST_DEVICE inline auto count_descents(RandomIt first, RandomIt last,
+                                              Comp &&comp = Comp()) {
+    decltype(last - first) n{0};
+    if (first == last) {
+        return n;
+    }
+    for (RandomIt i = first + 1; i < last; ++i) {
+        n += comp(*i, *(i - 1)) ? 1 : 0;
+    }
+    return n;
+}
+
 }  // namespace detray
@@ -0,0 +1,162 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+
+// System include(s)
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+namespace detray {
+
+/// @brief Vector with a compile-time capacity and in-place storage.
+///
+/// Behaves like a (minimal) @c std::vector, but its elements live in an array
+/// that is a member of the container. No dynamic memory is ever allocated,
+/// which makes it usable as a per-thread cache on host and device.
+///
+/// @note Elements that are pushed into a full container are dropped. Use
+/// @c full() to check whether there is space left before inserting.
+///
+/// @tparam value_t the element type
+/// @tparam kCAPACITY the maximal number of elements the container can hold
+template <typename value_t, std::size_t kCAPACITY>
+class static_vector {
+
+    static_assert(kCAPACITY > 0u, "Capacity of static vector has to be > 0");
+
+    using array_type = darray<value_t, kCAPACITY>;
+
+    public:
+    using value_type = value_t;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_t &;
+    using const_reference = const value_t &;
+    using pointer = value_t *;
+    using const_pointer = const value_t *;
+    using iterator = value_t *;
+    using const_iterator = const value_t *;
+
+    /// Default constructor: empty container
+    constexpr static_vector() = default;
+
+    /// @returns the compile-time capacity
+    DETRAY_HOST_DEVICE
+    static constexpr size_type capacity() { return kCAPACITY; }
+
+    /// @returns the maximal number of elements - same as capacity
+    DETRAY_HOST_DEVICE
+    static constexpr size_type max_size() { return kCAPACITY; }
+
+    /// @returns the number of elements currently in the container
+    DETRAY_HOST_DEVICE
+    constexpr size_type size() const { return m_size; }
+
+    /// @returns true if the container holds no elements
+    DETRAY_HOST_DEVICE
+    constexpr bool empty() const { return m_size == 0u; }
+
+    /// @returns true if no further element can be added
+    DETRAY_HOST_DEVICE
+    constexpr bool full() const { return m_size == kCAPACITY; }
+
+    /// Access an element - non-const
+    DETRAY_HOST_DEVICE
+    constexpr reference operator[](const size_type i) {
+        assert(i < m_size);
+        return m_data[i];
+    }
+
+    /// Access an element - const
+    DETRAY_HOST_DEVICE
+    constexpr const_reference operator[](const size_type i) const {
+        assert(i < m_size);
+        return m_data[i];
+    }
+
+    /// @returns the first element - non-const
+    DETRAY_HOST_DEVICE
+    constexpr reference front() { return (*this)[0u]; }
+
+    /// @returns the first element - const
+    DETRAY_HOST_DEVICE
+    constexpr const_reference front() const { return (*this)[0u]; }
+
+    /// @returns the last element - non-const
+    DETRAY_HOST_DEVICE
+    constexpr reference back() { return (*this)[m_size - 1u]; }
+
+    /// @returns the last element - const
+    DETRAY_HOST_DEVICE
+    constexpr const_reference back() const { return (*this)[m_size - 1u]; }
+
+    /// @returns pointer to the underlying storage - non-const
+    DETRAY_HOST_DEVICE
+    constexpr pointer data() { return m_data.data(); }
+
+    /// @returns pointer to the underlying storage - const
+    DETRAY_HOST_DEVICE
+    constexpr const_pointer data() const { return m_data.data(); }
+
+    /// @returns iterator to the first element - non-const
+    DETRAY_HOST_DEVICE
+    constexpr iterator begin() { return data(); }
+
+    /// @returns iterator to the first element - const
+    DETRAY_HOST_DEVICE
+    constexpr const_iterator begin() const { return data(); }
+
+    /// @returns sentinel of the element range - non-const
+    DETRAY_HOST_DEVICE
+    constexpr iterator end() { return data() + m_size; }
+
+    /// @returns sentinel of the element range - const
+    DETRAY_HOST_DEVICE
+    constexpr const_iterator end() const { return data() + m_size; }
+
+    /// Add an element at the end, if there is space left
+    DETRAY_HOST_DEVICE
+    constexpr void push_back(const value_t &value) {
+        if (!full()) {
+            m_data[m_size++] = value;
+        }
+    }
+
+    /// Construct an element in place at the end, if there is space left
+    template <typename... Args>
+    DETRAY_HOST_DEVICE constexpr void emplace_back(Args &&... args) {
+        if (!full()) {
+            m_data[m_size++] = value_t(std::forward<Args>(args)...);
+        }
+    }
+
+    /// Remove the last element
+    DETRAY_HOST_DEVICE
+    constexpr void pop_back() {
+        assert(m_size > 0u);
+        --m_size;
+    }
+
+    /// Remove all elements (the storage is not touched)
+    DETRAY_HOST_DEVICE
+    constexpr void clear() { m_size = 0u; }
+
+    private:
+    /// In-place element storage
+    array_type m_data{};
+    /// Current number of elements
+    size_type m_size{0u};
+};
+
+}  // namespace detray
@@ -130,6 +130,13 @@ template <typename T, typename... Ts>
 inline constexpr std::size_t get_type_pos_v = get_type_pos<T, Ts...>::value;
 /// @}
 
+template <class surface_t>
+struct is_surface_descriptor : public std::false_type {};
+
+template <typename T>
+inline constexpr bool is_surface_descriptor_v =
+    is_surface_descriptor<T>::value;
+
 template <class grid_t>
 struct is_grid : public std::false_type {};
 
@@ -142,6 +149,37 @@ struct is_surface_grid : public std::false_type {};
 template <typename T>
 inline constexpr bool is_surface_grid_v = is_surface_grid<T>::value;
 
+template <class accelerator_t, typename = void>
+struct is_bvh : public std::false_type {};
+
+template <typename T>
+inline constexpr bool is_bvh_v = is_bvh<T>::value;
+
+template <class accelerator_t, typename = void>
+struct is_sorted_planes : public std::false_type {};
+
+template <typename T>
+inline constexpr bool is_sorted_planes_v = is_sorted_planes<T>::value;
+
+template <class accelerator_t, typename = void>
+struct is_concentric_portals : public std::false_type {};
+
+template <typename T>
+inline constexpr bool is_concentric_portals_v =
+    is_concentric_portals<T>::value;
+
+template <class accelerator_t, typename = void>
+struct is_wire_layers : public std::false_type {};
+
+template <typename T>
+inline constexpr bool is_wire_layers_v = is_wire_layers<T>::value;
+
+template <class accelerator_t, typename = void>
+struct is_brute_force : public std::false_type {};
+
+template <typename T>
+inline constexpr bool is_brute_force_v = is_brute_force<T>::value;
+
 template <class material_t, typename = void>
 struct is_hom_material : public std::false_type {};
 
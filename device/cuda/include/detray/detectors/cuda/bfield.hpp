@@ -0,0 +1,111 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/detectors/compressed_bfield.hpp"
+#include "detray/detectors/sparse_bfield.hpp"
+
+// Covfie include(s)
+#include <covfie/core/backend/transformer/affine.hpp>
+#include <covfie/core/backend/transformer/linear.hpp>
+#include <covfie/core/backend/transformer/strided.hpp>
+#include <covfie/core/field.hpp>
+#include <covfie/core/parameter_pack.hpp>
+#include <covfie/core/vector.hpp>
+#include <covfie/cuda/backend/primitive/cuda_device_array.hpp>
+#include <covfie/cuda/backend/primitive/cuda_texture.hpp>
+
+// System include(s)
+#include <cstddef>
+#include <cstdint>
+
+namespace detray::bfield::cuda {
+
+/// Inhomogeneous field in device memory (cuda)
+///
+/// The field is interpolated trilinearly in software, in the precision of
+/// the detray scalar type.
+using inhom_bknd_t = covfie::backend::affine<covfie::backend::linear<
+    covfie::backend::strided<covfie::vector::vector_d<std::size_t, 3>,
+                             covfie::backend::cuda_device_array<
+                                 covfie::vector::vector_d<scalar, 3>>>>>;
+
+using inhom_field_t = covfie::field<inhom_bknd_t>;
+
+/// Inhomogeneous field in a texture (cuda)
+///
+/// The field is interpolated trilinearly by the texture units and cached in
+/// the texture cache, which takes the interpolation off the arithmetic units.
+///
+/// @note The texture holds single precision values and the hardware uses
+/// interpolation weights with 8 bits of fractional precision. The relative
+/// deviation from the software interpolation is therefore up to 2^-9 of the
+/// field difference between neighbouring grid points, which stays well below
+/// 1e-3 T for the usual (smooth) detector field maps. The field position has
+/// to be passed in single precision.
+using inhom_tex_bknd_t = covfie::backend::affine<covfie::backend::cuda_texture<
+    covfie::vector::float3, covfie::vector::float3>>;
+
+using inhom_tex_field_t = covfie::field<inhom_tex_bknd_t>;
+
+/// Inhomogeneous field with compressed field values in device memory (cuda)
+///
+/// Constructed from the corresponding host field (@see compress_field ). The
+/// grid points are read in the compressed format by the trilinear
+/// interpolation and decoded in registers, which reduces the memory traffic
+/// of the field lookups and lets a larger part of the map stay in the L2
+/// cache.
+template <typename codec_t>
+using compressed_bknd_t = covfie::backend::affine<
+    covfie::backend::linear<bfield::detail::decompress<
+        codec_t,
+        covfie::backend::strided<
+            covfie::vector::vector_d<std::size_t, 3>,
+            covfie::backend::cuda_device_array<covfie::vector::vector_d<
+                typename codec_t::storage_type, 3>>>>>>;
+
+/// Inhomogeneous field, stored as scaled 16 bit integers (cuda)
+using inhom_int16_bknd_t =
+    compressed_bknd_t<bfield::detail::int16_codec<scalar>>;
+using inhom_int16_field_t = covfie::field<inhom_int16_bknd_t>;
+
+/// Inhomogeneous field, stored as bfloat16 (cuda)
+using inhom_bf16_bknd_t =
+    compressed_bknd_t<bfield::detail::bfloat16_codec<scalar>>;
+using inhom_bf16_field_t = covfie::field<inhom_bf16_bknd_t>;
+
+/// Inhomogeneous field with constant blocks stored only once (cuda)
+///
+/// Constructed from the corresponding host field (@see sparsify_field ).
+/// The block table and the value pool are copied to device memory as they
+/// are, so that the device field takes the same (reduced) memory.
+template <std::size_t block_size = 4u>
+using sparse_bknd_t = covfie::backend::affine<
+    covfie::backend::linear<bfield::detail::block_sparse<
+        block_size,
+        covfie::backend::cuda_device_array<
+            covfie::vector::vector_d<std::uint32_t, 1>>,
+        covfie::backend::cuda_device_array<
+            covfie::vector::vector_d<scalar, 3>>>>>;
+
+using inhom_sparse_bknd_t = sparse_bknd_t<>;
+using inhom_sparse_field_t = covfie::field<inhom_sparse_bknd_t>;
+
+/// @returns a texture field with the content of the host field @param field
+inline inhom_tex_field_t create_inhom_texture_field(
+    const bfield::inhom_field_t &field) {
+    // The texture units take over the linear interpolation
+    return inhom_tex_field_t{covfie::make_parameter_pack(
+        field.backend().get_configuration(),
+        field.backend().get_backend().get_backend())};
+}
+
+}  // namespace detray::bfield::cuda
@@ -0,0 +1,72 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+#if !defined(__CUDACC__)
+#error "The detray CUDA kernels need to be compiled by a CUDA compiler"
+#endif
+
+// Project include(s)
+#include "detray/definitions/detail/cuda_definitions.hpp"
+
+// CUDA include(s)
+#include <cuda_runtime.h>
+
+// System include(s)
+#include <cstddef>
+#include <type_traits>
+
+namespace detray::cuda {
+
+namespace detail {
+
+/// Largest view that is placed in constant memory (the constant bank holds
+/// 64 KiB, which is shared with the other constants of the module)
+inline constexpr std::size_t max_constant_view_size{16u * 1024u};
+
+/// Constant memory slot of the view type @tparam view_t
+template <typename view_t>
+__constant__ __align__(16) unsigned char constant_view_storage[sizeof(view_t)];
+
+}  // namespace detail
+
+/// @brief Places a view (e.g. of the detector or the magnetic field) in
+/// constant memory.
+///
+/// A detector view is a @c dmulti_view of a vecmem view per container and
+/// grows with the metadata. Passed as a kernel argument, it is copied into
+/// the parameter space of every launch, where it competes with the kernel
+/// parameter limit. In constant memory, it is uploaded once and then read
+/// through the constant cache, which broadcasts it to all threads of a warp.
+///
+/// There is one slot per view type and CUDA module: Uploading a second view
+/// of the same type replaces the first one for all later kernels on the
+/// device.
+///
+/// @param view the view of the data in device memory
+/// @param stream the stream on which the upload is enqueued (ordered before
+///               the kernels on the same stream)
+template <typename view_t>
+void upload_constant_view(const view_t &view, cudaStream_t stream = nullptr) {
+
+    static_assert(sizeof(view_t) <= detail::max_constant_view_size,
+                  "View is too large for constant memory");
+
+    DETRAY_CUDA_ERROR_CHECK(cudaMemcpyToSymbolAsync(
+        detail::constant_view_storage<view_t>, &view, sizeof(view_t), 0u,
+        cudaMemcpyHostToDevice, stream));
+}
+
+/// @returns the view of type @tparam view_t from constant memory
+template <typename view_t>
+__device__ inline const view_t &constant_view() {
+    return *reinterpret_cast<const view_t *>(
+        detail::constant_view_storage<view_t>);
+}
+
+}  // namespace detray::cuda
@@ -0,0 +1,168 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+#if !defined(__CUDACC__)
+#error "The detray CUDA kernels need to be compiled by a CUDA compiler"
+#endif
+
+// Project include(s)
+#include "detray/core/detail/container_views.hpp"
+#include "detray/utils/tuple_helpers.hpp"
+
+// CUDA include(s)
+#include <cuda_runtime.h>
+
+// System include(s)
+#include <cstddef>
+#include <type_traits>
+
+namespace detray::cuda {
+
+/// @brief Stages the hot geometry data of a detector in shared memory.
+///
+/// During the navigation, every thread reads the descriptor of its current
+/// volume (accelerator links) and the portal descriptors of that volume from
+/// global memory. As most tracks of a block sit in a handful of volumes, the
+/// threads of the block can cooperatively copy this data to shared memory
+/// once and then read it from there. The staged data is:
+/// - the volume descriptors
+/// - the brute force surface collection (portals and passive surfaces),
+///   including its volume offsets
+///
+/// The transforms, masks and surface grids are not staged: They are too
+/// large and the threads of a block rarely access the same entries.
+///
+/// @note The portals of a volume are addressed by offsets into a single
+/// collection, so that the collection can only be staged as a whole. If it
+/// does not fit into shared memory, the kernel reads it from global memory.
+template <typename detector_t>
+struct shared_geometry {
+
+    using view_type = typename detector_t::view_type;
+
+    /// Alignment of the dynamic shared memory
+    static constexpr std::size_t alignment{16u};
+
+    private:
+    static constexpr auto bf_id{
+        static_cast<std::size_t>(detector_t::accel::id::e_brute_force)};
+
+    /// Access the views of the staged containers
+    /// @{
+    __host__ __device__ static auto &volumes(view_type &det_view) {
+        return detray::detail::get<0>(det_view.m_view);
+    }
+    __host__ __device__ static auto &bf_offsets(view_type &det_view) {
+        return detray::detail::get<0>(
+            detray::detail::get<bf_id>(
+                detray::detail::get<5>(det_view.m_view).m_view)
+                .m_view);
+    }
+    __host__ __device__ static auto &bf_surfaces(view_type &det_view) {
+        return detray::detail::get<1>(
+            detray::detail::get<bf_id>(
+                detray::detail::get<5>(det_view.m_view).m_view)
+                .m_view);
+    }
+    /// @}
+
+    template <typename view_t>
+    using value_t = typename std::remove_reference_t<view_t>::value_type;
+
+    using volume_t = value_t<decltype(volumes(std::declval<view_type &>()))>;
+    using offset_t = value_t<decltype(bf_offsets(std::declval<view_type &>()))>;
+    using surface_t =
+        value_t<decltype(bf_surfaces(std::declval<view_type &>()))>;
+
+    static_assert(std::is_trivially_copyable_v<volume_t> &&
+                      std::is_trivially_copyable_v<surface_t>,
+                  "Staged geometry data has to be trivially copyable");
+    static_assert(alignof(volume_t) <= alignment &&
+                      alignof(surface_t) <= alignment &&
+                      alignof(offset_t) <= alignment,
+                  "Staged geometry data is over-aligned");
+
+    /// @returns @param offset rounded up to the alignment of @tparam T
+    template <typename T>
+    __host__ __device__ static constexpr std::size_t align(
+        const std::size_t offset) {
+        return (offset + alignof(T) - 1u) / alignof(T) * alignof(T);
+    }
+
+    /// Byte offsets of the staged containers in shared memory
+    struct layout {
+        std::size_t volumes{0u};
+        std::size_t surfaces{0u};
+        std::size_t offsets{0u};
+        std::size_t size{0u};
+    };
+
+    /// @returns the shared memory layout for the detector @param det_view
+    __host__ __device__ static layout make_layout(view_type &det_view) {
+        layout l{};
+        l.surfaces = align<surface_t>(l.volumes + volumes(det_view).size() *
+                                                      sizeof(volume_t));
+        l.offsets = align<offset_t>(l.surfaces + bf_surfaces(det_view).size() *
+                                                     sizeof(surface_t));
+        l.size = l.offsets + bf_offsets(det_view).size() * sizeof(offset_t);
+
+        return l;
+    }
+
+    /// Cooperatively copy @param n elements from @param src to @param dst
+    template <typename T>
+    __device__ static void block_copy(T *dst, const T *src,
+                                      const unsigned int n) {
+        for (unsigned int i = threadIdx.x; i < n; i += blockDim.x) {
+            dst[i] = src[i];
+        }
+    }
+
+    public:
+    /// @returns the shared memory in bytes that is needed to stage the
+    /// geometry of the detector @param det_view
+    static std::size_t size(view_type det_view) {
+        return make_layout(det_view).size;
+    }
+
+    /// Copy the geometry data of @param det_view to the shared memory
+    /// @param shared , which has to hold at least @c size() bytes.
+    ///
+    /// @note Has to be called by all threads of the block.
+    ///
+    /// @returns the detector view that refers to the staged data
+    __device__ static view_type stage(view_type det_view,
+                                      unsigned char *shared) {
+
+        const layout l{make_layout(det_view)};
+
+        auto &vol_view = volumes(det_view);
+        auto &sf_view = bf_surfaces(det_view);
+        auto &offset_view = bf_offsets(det_view);
+
+        auto *vol_ptr = reinterpret_cast<volume_t *>(shared + l.volumes);
+        auto *sf_ptr = reinterpret_cast<surface_t *>(shared + l.surfaces);
+        auto *offset_ptr = reinterpret_cast<offset_t *>(shared + l.offsets);
+
+        block_copy(vol_ptr, vol_view.ptr(), vol_view.size());
+        block_copy(sf_ptr, sf_view.ptr(), sf_view.size());
+        block_copy(offset_ptr, offset_view.ptr(), offset_view.size());
+
+        // Redirect the views to shared memory
+        vol_view = {vol_view.size(), vol_ptr};
+        sf_view = {sf_view.size(), sf_ptr};
+        offset_view = {offset_view.size(), offset_ptr};
+
+        __syncthreads();
+
+        return det_view;
+    }
+};
+
+}  // namespace detray::cuda
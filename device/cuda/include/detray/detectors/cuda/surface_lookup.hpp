@@ -0,0 +1,91 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+#if !defined(__CUDACC__)
+#error "The detray CUDA kernels need to be compiled by a CUDA compiler"
+#endif
+
+// Project include(s)
+#include "detray/definitions/detail/cuda_definitions.hpp"
+#include "detray/propagator/cuda/propagate_batch.hpp"
+#include "detray/propagator/propagation_batch.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/data/vector_view.hpp>
+#include <vecmem/containers/device_vector.hpp>
+
+// CUDA include(s)
+#include <cuda_runtime.h>
+
+namespace detray::cuda {
+
+namespace kernels {
+
+/// Find the surface of one point per thread
+///
+/// @see detray::cuda::surfaces_at
+template <typename detector_t>
+__global__ void surfaces_at(
+    typename detector_t::view_type det_view,
+    vecmem::data::vector_view<const typename detector_t::point3_type>
+        points_view,
+    vecmem::data::vector_view<typename detector_t::surface_type> results_view,
+    const typename detector_t::scalar_type tol) {
+
+    const unsigned int gid{threadIdx.x + blockIdx.x * blockDim.x};
+
+    const detector_t det(det_view);
+    const vecmem::device_vector<const typename detector_t::point3_type> points(
+        points_view);
+    vecmem::device_vector<typename detector_t::surface_type> results(
+        results_view);
+
+    det.surfaces_at(points, results, propagation::single_track_executor{gid},
+                    tol);
+}
+
+}  // namespace kernels
+
+/// @brief Enqueue the surface lookup of a batch of global points on the
+/// device.
+///
+/// Every point is associated with its sensitive surface by its own thread
+/// (see @c detector::surface_at ). The kernel is enqueued on the stream of
+/// @param launch and the function returns without synchronizing.
+///
+/// @tparam detector_t the device detector type
+///
+/// @param launch the launch geometry and stream
+/// @param det_view view of the detector in device memory
+/// @param points_view the global points in device memory
+/// @param results_view the matched surfaces, at least one per point
+/// @param tol how far a point may lie off the surface or its mask
+template <typename detector_t>
+void surfaces_at(
+    const launch_config &launch, typename detector_t::view_type det_view,
+    vecmem::data::vector_view<const typename detector_t::point3_type>
+        points_view,
+    vecmem::data::vector_view<typename detector_t::surface_type> results_view,
+    const typename detector_t::scalar_type tol) {
+
+    const unsigned int n_points{points_view.size()};
+    if (n_points == 0u) {
+        return;
+    }
+
+    kernels::surfaces_at<detector_t>
+        <<<launch.n_blocks(n_points), launch.threads_per_block,
+           launch.shared_memory, launch.stream>>>(det_view, points_view,
+                                                  results_view, tol);
+
+    // Launch errors only: The kernel is not waited for
+    DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
+}
+
+}  // namespace detray::cuda
@@ -0,0 +1,225 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+#if !defined(__CUDACC__)
+#error "The detray CUDA kernels need to be compiled by a CUDA compiler"
+#endif
+
+// Project include(s)
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/cuda_definitions.hpp"
+#include "detray/geometry/batch_conversion.hpp"
+#include "detray/propagator/cuda/propagate_batch.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/data/vector_view.hpp>
+#include <vecmem/containers/device_vector.hpp>
+
+// CUDA include(s)
+#include <cuda_runtime.h>
+
+// System include(s)
+#include <cstddef>
+
+namespace detray::cuda {
+
+namespace kernels {
+
+/// Convert positions (and directions) of a grouped batch, one element per
+/// thread
+template <typename functor_t, typename detector_t, std::size_t n_offsets,
+          typename point_t, typename vector_t, typename result_t>
+__global__ void convert_positions(
+    typename detector_t::view_type det_view,
+    const darray<unsigned int, n_offsets> offsets,
+    vecmem::data::vector_view<const unsigned int> order_view,
+    vecmem::data::vector_view<const typename detector_t::surface_type>
+        surfaces_view,
+    vecmem::data::vector_view<const point_t> globals_view,
+    vecmem::data::vector_view<const vector_t> dirs_view,
+    vecmem::data::vector_view<result_t> results_view,
+    const typename detector_t::geometry_context ctx) {
+
+    const unsigned int gid{threadIdx.x + blockIdx.x * blockDim.x};
+
+    const detector_t det(det_view);
+    const vecmem::device_vector<const unsigned int> order(order_view);
+    const vecmem::device_vector<const typename detector_t::surface_type>
+        surfaces(surfaces_view);
+    const vecmem::device_vector<const point_t> globals(globals_view);
+    const vecmem::device_vector<const vector_t> dirs(dirs_view);
+    vecmem::device_vector<result_t> results(results_view);
+
+    detail::convert_element<functor_t>(det, offsets, order, gid, surfaces,
+                                       ctx, globals, dirs, results);
+}
+
+/// Convert track vectors of a grouped batch, one element per thread
+template <typename functor_t, typename detector_t, std::size_t n_offsets,
+          typename vector_t, typename result_t>
+__global__ void convert_vectors(
+    typename detector_t::view_type det_view,
+    const darray<unsigned int, n_offsets> offsets,
+    vecmem::data::vector_view<const unsigned int> order_view,
+    vecmem::data::vector_view<const typename detector_t::surface_type>
+        surfaces_view,
+    vecmem::data::vector_view<const vector_t> vecs_view,
+    vecmem::data::vector_view<result_t> results_view,
+    const typename detector_t::geometry_context ctx) {
+
+    const unsigned int gid{threadIdx.x + blockIdx.x * blockDim.x};
+
+    const detector_t det(det_view);
+    const vecmem::device_vector<const unsigned int> order(order_view);
+    const vecmem::device_vector<const typename detector_t::surface_type>
+        surfaces(surfaces_view);
+    const vecmem::device_vector<const vector_t> vecs(vecs_view);
+    vecmem::device_vector<result_t> results(results_view);
+
+    detail::convert_element<functor_t>(det, offsets, order, gid, surfaces,
+                                       ctx, vecs, results);
+}
+
+}  // namespace kernels
+
+/// @brief Enqueue the batched conversion of global positions to bound local
+/// positions on the device.
+///
+/// The threads process the elements in the order of @param order_view (see
+/// @c geometry::group_by_mask ), so that the threads of a warp mostly visit
+/// the same mask type. The function returns without synchronizing.
+///
+/// @param launch the launch geometry and stream
+/// @param det_view view of the detector in device memory
+/// @param offsets the group offsets of the batch order
+/// @param order_view the batch order in device memory
+/// @param surfaces_view the surface descriptor of every element
+/// @param globals_view the global positions
+/// @param dirs_view the global directions
+/// @param results_view the bound local positions, at least one per element
+/// @param ctx the geometry context
+template <typename detector_t, std::size_t n_offsets, typename point_t,
+          typename vector_t, typename result_t>
+void global_to_bound(
+    const launch_config &launch, typename detector_t::view_type det_view,
+    const darray<unsigned int, n_offsets> &offsets,
+    vecmem::data::vector_view<const unsigned int> order_view,
+    vecmem::data::vector_view<const typename detector_t::surface_type>
+        surfaces_view,
+    vecmem::data::vector_view<const point_t> globals_view,
+    vecmem::data::vector_view<const vector_t> dirs_view,
+    vecmem::data::vector_view<result_t> results_view,
+    const typename detector_t::geometry_context ctx = {}) {
+
+    const unsigned int n{order_view.size()};
+    if (n == 0u) {
+        return;
+    }
+
+    kernels::convert_positions<detail::batch_kernels::global_to_bound,
+                               detector_t>
+        <<<launch.n_blocks(n), launch.threads_per_block, launch.shared_memory,
+           launch.stream>>>(det_view, offsets, order_view, surfaces_view,
+                            globals_view, dirs_view, results_view, ctx);
+
+    DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
+}
+
+/// @brief Enqueue the batched conversion of global positions to 3D local
+/// positions on the device.
+///
+/// @see global_to_bound
+template <typename detector_t, std::size_t n_offsets, typename point_t,
+          typename vector_t, typename result_t>
+void global_to_local(
+    const launch_config &launch, typename detector_t::view_type det_view,
+    const darray<unsigned int, n_offsets> &offsets,
+    vecmem::data::vector_view<const unsigned int> order_view,
+    vecmem::data::vector_view<const typename detector_t::surface_type>
+        surfaces_view,
+    vecmem::data::vector_view<const point_t> globals_view,
+    vecmem::data::vector_view<const vector_t> dirs_view,
+    vecmem::data::vector_view<result_t> results_view,
+    const typename detector_t::geometry_context ctx = {}) {
+
+    const unsigned int n{order_view.size()};
+    if (n == 0u) {
+        return;
+    }
+
+    kernels::convert_positions<detail::batch_kernels::global_to_local,
+                               detector_t>
+        <<<launch.n_blocks(n), launch.threads_per_block, launch.shared_memory,
+           launch.stream>>>(det_view, offsets, order_view, surfaces_view,
+                            globals_view, dirs_view, results_view, ctx);
+
+    DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
+}
+
+/// @brief Enqueue the batched conversion of free to bound track vectors on
+/// the device.
+///
+/// @see global_to_bound
+template <typename detector_t, std::size_t n_offsets, typename vector_t,
+          typename result_t>
+void free_to_bound_vector(
+    const launch_config &launch, typename detector_t::view_type det_view,
+    const darray<unsigned int, n_offsets> &offsets,
+    vecmem::data::vector_view<const unsigned int> order_view,
+    vecmem::data::vector_view<const typename detector_t::surface_type>
+        surfaces_view,
+    vecmem::data::vector_view<const vector_t> free_vecs_view,
+    vecmem::data::vector_view<result_t> results_view,
+    const typename detector_t::geometry_context ctx = {}) {
+
+    const unsigned int n{order_view.size()};
+    if (n == 0u) {
+        return;
+    }
+
+    kernels::convert_vectors<detail::batch_kernels::free_to_bound_vector,
+                             detector_t>
+        <<<launch.n_blocks(n), launch.threads_per_block, launch.shared_memory,
+           launch.stream>>>(det_view, offsets, order_view, surfaces_view,
+                            free_vecs_view, results_view, ctx);
+
+    DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
+}
+
+/// @brief Enqueue the batched conversion of bound to free track vectors on
+/// the device.
+///
+/// @see global_to_bound
+template <typename detector_t, std::size_t n_offsets, typename vector_t,
+          typename result_t>
+void bound_to_free_vector(
+    const launch_config &launch, typename detector_t::view_type det_view,
+    const darray<unsigned int, n_offsets> &offsets,
+    vecmem::data::vector_view<const unsigned int> order_view,
+    vecmem::data::vector_view<const typename detector_t::surface_type>
+        surfaces_view,
+    vecmem::data::vector_view<const vector_t> bound_vecs_view,
+    vecmem::data::vector_view<result_t> results_view,
+    const typename detector_t::geometry_context ctx = {}) {
+
+    const unsigned int n{order_view.size()};
+    if (n == 0u) {
+        return;
+    }
+
+    kernels::convert_vectors<detail::batch_kernels::bound_to_free_vector,
+                             detector_t>
+        <<<launch.n_blocks(n), launch.threads_per_block, launch.shared_memory,
+           launch.stream>>>(det_view, offsets, order_view, surfaces_view,
+                            bound_vecs_view, results_view, ctx);
+
+    DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
+}
+
+}  // namespace detray::cuda
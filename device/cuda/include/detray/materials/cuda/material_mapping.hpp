@@ -0,0 +1,147 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+#if !defined(__CUDACC__)
+#error "The detray CUDA kernels need to be compiled by a CUDA compiler"
+#endif
+
+// Project include(s)
+#include "detray/definitions/detail/cuda_definitions.hpp"
+#include "detray/materials/material_mapping.hpp"
+#include "detray/propagator/cuda/propagate_batch.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/data/vector_view.hpp>
+#include <vecmem/containers/device_vector.hpp>
+
+// CUDA include(s)
+#include <cuda_runtime.h>
+
+namespace detray::cuda {
+
+namespace kernels {
+
+/// Accumulate one material recording per thread
+///
+/// @see detray::cuda::accumulate_material
+template <typename map_collection_t, typename algebra_t>
+__global__ void accumulate_material(
+    typename map_collection_t::view_type maps_view,
+    vecmem::data::vector_view<material_bin_sums<dscalar<algebra_t>>>
+        sums_view,
+    vecmem::data::vector_view<const material_recording<algebra_t>>
+        recordings_view) {
+
+    const unsigned int gid{threadIdx.x + blockIdx.x * blockDim.x};
+
+    const vecmem::device_vector<const material_recording<algebra_t>>
+        recordings(recordings_view);
+    if (gid >= recordings.size()) {
+        return;
+    }
+
+    const map_collection_t maps(maps_view);
+    vecmem::device_vector<material_bin_sums<dscalar<algebra_t>>> sums(
+        sums_view);
+
+    detray::accumulate_material(maps, sums, recordings[gid]);
+}
+
+/// Finalize one material map bin per thread
+///
+/// @see detray::cuda::finalize_material_maps
+template <typename map_collection_t, typename scalar_t>
+__global__ void finalize_material_maps(
+    typename map_collection_t::view_type maps_view,
+    vecmem::data::vector_view<const material_bin_sums<scalar_t>> sums_view) {
+
+    const unsigned int gid{threadIdx.x + blockIdx.x * blockDim.x};
+
+    const vecmem::device_vector<const material_bin_sums<scalar_t>> sums(
+        sums_view);
+    if (gid >= sums.size()) {
+        return;
+    }
+
+    const map_collection_t maps(maps_view);
+
+    detray::finalize_material_bin(maps, sums, gid);
+}
+
+}  // namespace kernels
+
+/// @brief Enqueue the binning of material recordings into the material maps
+/// of a collection on the device.
+///
+/// Every recording is added to the material sums of its bin by its own
+/// thread, using atomics. The kernel is enqueued on the stream of
+/// @param launch and the function returns without synchronizing.
+///
+/// @tparam map_collection_t the device type of the material map collection
+///
+/// @param maps_view view of the material map collection in device memory
+/// @param sums_view the material sums, one per bin of the collection, which
+///                  have to be zeroed before the first recordings are added
+///                  (e.g. with @c vecmem::copy::memset )
+/// @param recordings_view the material recordings in device memory
+template <typename map_collection_t, typename algebra_t>
+void accumulate_material(
+    const launch_config &launch,
+    typename map_collection_t::view_type maps_view,
+    vecmem::data::vector_view<material_bin_sums<dscalar<algebra_t>>>
+        sums_view,
+    vecmem::data::vector_view<const material_recording<algebra_t>>
+        recordings_view) {
+
+    const unsigned int n_recordings{recordings_view.size()};
+    if (n_recordings == 0u) {
+        return;
+    }
+
+    kernels::accumulate_material<map_collection_t, algebra_t>
+        <<<launch.n_blocks(n_recordings), launch.threads_per_block,
+           launch.shared_memory, launch.stream>>>(maps_view, sums_view,
+                                                  recordings_view);
+
+    // Launch errors only: The kernel is not waited for
+    DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
+}
+
+/// @brief Enqueue the finalization of the material maps of a collection on
+/// the device.
+///
+/// Every bin of the collection is replaced by the average material of its
+/// sums by its own thread (bins without recordings get invalid material).
+/// The kernel is enqueued on the stream of @param launch and the function
+/// returns without synchronizing.
+///
+/// @tparam map_collection_t the device type of the material map collection
+///
+/// @param maps_view view of the material map collection in device memory
+/// @param sums_view the material sums, one per bin of the collection
+template <typename map_collection_t, typename scalar_t>
+void finalize_material_maps(
+    const launch_config &launch,
+    typename map_collection_t::view_type maps_view,
+    vecmem::data::vector_view<const material_bin_sums<scalar_t>> sums_view) {
+
+    const unsigned int n_bins{sums_view.size()};
+    if (n_bins == 0u) {
+        return;
+    }
+
+    kernels::finalize_material_maps<map_collection_t, scalar_t>
+        <<<launch.n_blocks(n_bins), launch.threads_per_block,
+           launch.shared_memory, launch.stream>>>(maps_view, sums_view);
+
+    // Launch errors only: The kernel is not waited for
+    DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
+}
+
+}  // namespace detray::cuda
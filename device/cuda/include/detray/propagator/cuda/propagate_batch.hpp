@@ -0,0 +1,400 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+#if !defined(__CUDACC__)
+#error "The detray CUDA kernels need to be compiled by a CUDA compiler"
+#endif
+
+// Project include(s)
+#include "detray/definitions/detail/cuda_definitions.hpp"
+#include "detray/detectors/cuda/constant_view.hpp"
+#include "detray/detectors/cuda/shared_geometry.hpp"
+#include "detray/propagator/propagation_batch.hpp"
+#include "detray/propagator/propagation_config.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/data/vector_view.hpp>
+#include <vecmem/containers/device_vector.hpp>
+
+// CUDA include(s)
+#include <cuda_runtime.h>
+
+// System include(s)
+#include <algorithm>
+#include <cstddef>
+
+namespace detray::cuda {
+
+/// @brief Launch geometry and stream of the propagation kernels
+struct launch_config {
+    /// Number of threads per block
+    unsigned int threads_per_block{2u * WARP_SIZE};
+    /// Dynamic shared memory per block in bytes
+    std::size_t shared_memory{0u};
+    /// Stream that the kernel is enqueued on (the default stream, if null)
+    cudaStream_t stream{nullptr};
+    /// Persistent threads: Launch only as many blocks as can be resident on
+    /// the device and let the threads pull tracks from a work queue
+    bool persistent{false};
+    /// Number of tracks a persistent thread pulls from the queue at once
+    unsigned int chunk_size{1u};
+    /// Stage the volume and portal descriptors in shared memory, if they fit
+    /// (see @c shared_geometry , batch propagation only)
+    bool stage_geometry{false};
+    /// Pass the detector and field views through constant memory instead of
+    /// the kernel arguments (see @c upload_constant_view )
+    bool constant_views{false};
+    /// Device pointer to the order in which the tracks are handed to the
+    /// threads (e.g. @c propagation::spatial_order ), input order if null
+    const unsigned int *order{nullptr};
+
+    /// @returns the number of blocks that are needed for @param n_tracks
+    unsigned int n_blocks(const unsigned int n_tracks) const {
+        return (n_tracks + threads_per_block - 1u) / threads_per_block;
+    }
+};
+
+/// @brief Executor of persistent threads that pull the tracks of a batch
+/// from a global work queue.
+///
+/// Every thread takes the next chunk of track indices from an atomic
+/// counter until the batch is exhausted. Threads that finish their tracks
+/// early take over more work, instead of idling until the slowest track of
+/// their block is done (e.g. loopers or low-pT tracks).
+struct persistent_executor {
+
+    /// Global counter of the next track index in device memory (zeroed)
+    unsigned int *counter{nullptr};
+    /// Number of track indices that are taken at once
+    unsigned int chunk_size{1u};
+
+    /// Call @param func for the track indices pulled from the queue
+    template <typename function_t>
+    __device__ void operator()(const unsigned int n_tracks,
+                               function_t &&func) const {
+        while (true) {
+            const unsigned int first{atomicAdd(counter, chunk_size)};
+            if (first >= n_tracks) {
+                return;
+            }
+            const unsigned int last{min(first + chunk_size, n_tracks)};
+            for (unsigned int i = first; i < last; ++i) {
+                func(i);
+            }
+        }
+    }
+};
+
+namespace detail {
+
+/// Stage the geometry of @param det_view in the dynamic shared memory
+template <typename propagator_t>
+__device__ typename propagator_t::detector_type::view_type stage_geometry(
+    typename propagator_t::detector_type::view_type det_view) {
+
+    using detector_t = typename propagator_t::detector_type;
+
+    static_assert(shared_geometry<detector_t>::alignment <= 16u,
+                  "Alignment of the dynamic shared memory is too small");
+
+    extern __shared__ __align__(16) unsigned char shared_data[];
+
+    return shared_geometry<detector_t>::stage(det_view, shared_data);
+}
+
+}  // namespace detail
+
+namespace kernels {
+
+/// Propagate one track of the batch per thread
+///
+/// @see detray::cuda::propagate_batch
+template <typename propagator_t, typename... field_view_t>
+__global__ void propagate_batch(
+    const propagation::config<typename propagator_t::scalar_type> cfg,
+    typename propagator_t::detector_type::view_type det_view,
+    vecmem::data::vector_view<
+        const typename propagator_t::free_track_parameters_type>
+        tracks_view,
+    vecmem::data::vector_view<
+        propagation::result<typename propagator_t::algebra_type>>
+        results_view,
+    const typename propagator_t::actor_chain_type::state_tuple actor_states,
+    const unsigned int *order, const bool stage_geometry,
+    field_view_t... field) {
+
+    const unsigned int gid{threadIdx.x + blockIdx.x * blockDim.x};
+
+    if (stage_geometry) {
+        det_view = detail::stage_geometry<propagator_t>(det_view);
+    }
+
+    const typename propagator_t::detector_type det(det_view);
+    const vecmem::device_vector<
+        const typename propagator_t::free_track_parameters_type>
+        tracks(tracks_view);
+    vecmem::device_vector<
+        propagation::result<typename propagator_t::algebra_type>>
+        results(results_view);
+
+    propagator_t p{cfg};
+    p.propagate_batch(tracks, results,
+                      propagation::ordered_executor<
+                          propagation::single_track_executor>{{gid}, order},
+                      actor_states, field..., det);
+}
+
+/// Propagate the tracks of the batch with persistent threads
+///
+/// @see detray::cuda::propagate_batch
+template <typename propagator_t, typename... field_view_t>
+__global__ void propagate_batch_persistent(
+    const propagation::config<typename propagator_t::scalar_type> cfg,
+    typename propagator_t::detector_type::view_type det_view,
+    vecmem::data::vector_view<
+        const typename propagator_t::free_track_parameters_type>
+        tracks_view,
+    vecmem::data::vector_view<
+        propagation::result<typename propagator_t::algebra_type>>
+        results_view,
+    const typename propagator_t::actor_chain_type::state_tuple actor_states,
+    const persistent_executor exec, const unsigned int *order,
+    const bool stage_geometry, field_view_t... field) {
+
+    if (stage_geometry) {
+        det_view = detail::stage_geometry<propagator_t>(det_view);
+    }
+
+    const typename propagator_t::detector_type det(det_view);
+    const vecmem::device_vector<
+        const typename propagator_t::free_track_parameters_type>
+        tracks(tracks_view);
+    vecmem::device_vector<
+        propagation::result<typename propagator_t::algebra_type>>
+        results(results_view);
+
+    propagator_t p{cfg};
+    p.propagate_batch(tracks, results,
+                      propagation::ordered_executor<persistent_executor>{
+                          exec, order},
+                      actor_states, field..., det);
+}
+
+/// Propagate the tracks of the batch, with the detector and field views
+/// read from constant memory
+///
+/// @see detray::cuda::propagate_batch
+template <typename propagator_t, typename... field_view_t>
+__global__ void propagate_batch_constant(
+    const propagation::config<typename propagator_t::scalar_type> cfg,
+    vecmem::data::vector_view<
+        const typename propagator_t::free_track_parameters_type>
+        tracks_view,
+    vecmem::data::vector_view<
+        propagation::result<typename propagator_t::algebra_type>>
+        results_view,
+    const typename propagator_t::actor_chain_type::state_tuple actor_states,
+    const bool persistent, const persistent_executor exec,
+    const unsigned int *order, const bool stage_geometry) {
+
+    using det_view_t = typename propagator_t::detector_type::view_type;
+
+    const unsigned int gid{threadIdx.x + blockIdx.x * blockDim.x};
+
+    const typename propagator_t::detector_type det(
+        stage_geometry ? detail::stage_geometry<propagator_t>(
+                             constant_view<det_view_t>())
+                       : constant_view<det_view_t>());
+    const vecmem::device_vector<
+        const typename propagator_t::free_track_parameters_type>
+        tracks(tracks_view);
+    vecmem::device_vector<
+        propagation::result<typename propagator_t::algebra_type>>
+        results(results_view);
+
+    propagator_t p{cfg};
+    if (persistent) {
+        p.propagate_batch(tracks, results,
+                          propagation::ordered_executor<persistent_executor>{
+                              exec, order},
+                          actor_states, constant_view<field_view_t>()...,
+                          det);
+    } else {
+        p.propagate_batch(tracks, results,
+                          propagation::ordered_executor<
+                              propagation::single_track_executor>{{gid},
+                                                                  order},
+                          actor_states, constant_view<field_view_t>()...,
+                          det);
+    }
+}
+
+}  // namespace kernels
+
+/// @brief Enqueue the propagation of a batch of tracks on the device.
+///
+/// Every track is propagated by its own thread, starting from a copy of
+/// @param actor_states , and its outcome is written to @param results_view .
+/// The kernel is enqueued on the stream of @param launch and the function
+/// returns without synchronizing, so that the propagation can overlap with
+/// other work. The results are available once the stream was synchronized.
+///
+/// In persistent mode, the grid is limited to the number of blocks that can
+/// be resident on the device at once and the threads pull the tracks from a
+/// work queue (see @c persistent_executor ). The queue counter is allocated
+/// and released in stream order.
+///
+/// If requested, the blocks first stage the volume and portal descriptors in
+/// shared memory (see @c shared_geometry ). The staged data is placed in
+/// front of the dynamic shared memory of @param launch . If it exceeds the
+/// shared memory of a block, the geometry is read from global memory.
+///
+/// If an order is given in @param launch , the threads propagate the tracks
+/// in that order (see @c propagation::ordered_executor ), while the results
+/// stay in the input order of the tracks.
+///
+/// If requested, the detector and field views are uploaded to constant
+/// memory on the stream of @param launch and the kernel reads them from
+/// there, so that its arguments do not grow with the detector metadata.
+///
+/// @tparam propagator_t the propagator type with the device detector type.
+///                      Its navigator has to use a candidate cache of fixed
+///                      capacity.
+/// @tparam field_view_t the magnetic field view type, if the stepper needs
+///                      a magnetic field
+///
+/// @param launch the launch geometry and stream
+/// @param cfg the propagation configuration
+/// @param det_view view of the detector in device memory
+/// @param tracks_view the initial track parameters in device memory
+/// @param results_view the propagation outcomes, at least one per track
+/// @param actor_states the initial actor states of every track
+/// @param field the magnetic field view
+template <typename propagator_t, typename... field_view_t>
+void propagate_batch(
+    const launch_config& launch,
+    const propagation::config<typename propagator_t::scalar_type>& cfg,
+    typename propagator_t::detector_type::view_type det_view,
+    vecmem::data::vector_view<
+        const typename propagator_t::free_track_parameters_type>
+        tracks_view,
+    vecmem::data::vector_view<
+        propagation::result<typename propagator_t::algebra_type>>
+        results_view,
+    const typename propagator_t::actor_chain_type::state_tuple& actor_states,
+    field_view_t... field) {
+
+    static_assert(sizeof...(field_view_t) <= 1u,
+                  "At most one magnetic field can be passed");
+
+    const unsigned int n_tracks{tracks_view.size()};
+    if (n_tracks == 0u) {
+        return;
+    }
+
+    int device{0};
+    DETRAY_CUDA_ERROR_CHECK(cudaGetDevice(&device));
+
+    // Stage the geometry only if it fits into the shared memory of a block
+    std::size_t shared_memory{launch.shared_memory};
+    bool stage_geometry{false};
+    if (launch.stage_geometry) {
+        int max_shared_memory{0};
+        DETRAY_CUDA_ERROR_CHECK(cudaDeviceGetAttribute(
+            &max_shared_memory, cudaDevAttrMaxSharedMemoryPerBlock, device));
+
+        const std::size_t staged_memory{
+            shared_geometry<typename propagator_t::detector_type>::size(
+                det_view)};
+
+        stage_geometry = (shared_memory + staged_memory <=
+                          static_cast<std::size_t>(max_shared_memory));
+        if (stage_geometry) {
+            shared_memory += staged_memory;
+        }
+    }
+
+    if (launch.constant_views) {
+        upload_constant_view(det_view, launch.stream);
+        (upload_constant_view(field, launch.stream), ...);
+    }
+
+    if (!launch.persistent) {
+        if (launch.constant_views) {
+            kernels::propagate_batch_constant<propagator_t, field_view_t...>
+                <<<launch.n_blocks(n_tracks), launch.threads_per_block,
+                   shared_memory, launch.stream>>>(
+                    cfg, tracks_view, results_view, actor_states, false,
+                    persistent_executor{}, launch.order, stage_geometry);
+
+            DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
+            return;
+        }
+
+        kernels::propagate_batch<propagator_t, field_view_t...>
+            <<<launch.n_blocks(n_tracks), launch.threads_per_block,
+               shared_memory, launch.stream>>>(
+                cfg, det_view, tracks_view, results_view, actor_states,
+                launch.order, stage_geometry, field...);
+
+        // Launch errors only: The kernel is not waited for
+        DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
+        return;
+    }
+
+    const auto kernel =
+        kernels::propagate_batch_persistent<propagator_t, field_view_t...>;
+    const auto constant_kernel =
+        kernels::propagate_batch_constant<propagator_t, field_view_t...>;
+
+    // Fill the device with resident blocks
+    int n_sms{0};
+    int blocks_per_sm{0};
+    DETRAY_CUDA_ERROR_CHECK(cudaDeviceGetAttribute(
+        &n_sms, cudaDevAttrMultiProcessorCount, device));
+    if (launch.constant_views) {
+        DETRAY_CUDA_ERROR_CHECK(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+            &blocks_per_sm, constant_kernel,
+            static_cast<int>(launch.threads_per_block), shared_memory));
+    } else {
+        DETRAY_CUDA_ERROR_CHECK(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+            &blocks_per_sm, kernel, static_cast<int>(launch.threads_per_block),
+            shared_memory));
+    }
+
+    const unsigned int n_blocks{std::max(
+        1u, std::min(launch.n_blocks(n_tracks),
+                     static_cast<unsigned int>(n_sms * blocks_per_sm)))};
+
+    persistent_executor exec{};
+    exec.chunk_size = std::max(launch.chunk_size, 1u);
+    DETRAY_CUDA_ERROR_CHECK(cudaMallocAsync(
+        reinterpret_cast<void **>(&exec.counter), sizeof(unsigned int),
+        launch.stream));
+    DETRAY_CUDA_ERROR_CHECK(
+        cudaMemsetAsync(exec.counter, 0, sizeof(unsigned int), launch.stream));
+
+    if (launch.constant_views) {
+        constant_kernel<<<n_blocks, launch.threads_per_block, shared_memory,
+                          launch.stream>>>(cfg, tracks_view, results_view,
+                                           actor_states, true, exec,
+                                           launch.order, stage_geometry);
+    } else {
+        kernel<<<n_blocks, launch.threads_per_block, shared_memory,
+                 launch.stream>>>(cfg, det_view, tracks_view, results_view,
+                                  actor_states, exec, launch.order,
+                                  stage_geometry, field...);
+    }
+
+    // Launch errors only: The kernel is not waited for
+    DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
+    DETRAY_CUDA_ERROR_CHECK(cudaFreeAsync(exec.counter, launch.stream));
+}
+
+}  // namespace detray::cuda
@@ -0,0 +1,283 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+#if !defined(__CUDACC__)
+#error "The detray CUDA kernels need to be compiled by a CUDA compiler"
+#endif
+
+// Project include(s)
+#include "detray/propagator/cuda/propagate_multi_device.hpp"
+#include "detray/propagator/parallel_executor.hpp"
+#include "detray/propagator/propagation_batch.hpp"
+#include "detray/propagator/propagation_config.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/data/vector_view.hpp>
+#include <vecmem/containers/device_vector.hpp>
+#include <vecmem/containers/vector.hpp>
+
+// System include(s)
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace detray::cuda {
+
+/// @brief Propagates track batches on the host and on several CUDA devices
+/// at the same time.
+///
+/// Every device and the host are driven by their own host thread (the
+/// "workers"), which take chunks of tracks from a shared counter of the
+/// batch, until it is exhausted. The chunk size of a worker follows its
+/// share of the measured throughput of all workers: A worker takes a
+/// fraction of its share of the remaining tracks, so that the chunks become
+/// smaller towards the end of the batch and all workers finish at about the
+/// same time. The throughput of a worker is a running average over its
+/// chunks and is kept between batches. As long as the throughput of any
+/// worker is unknown, the workers only take their minimal chunks.
+///
+/// The host chunks are propagated with @c propagator::propagate_batch on
+/// the host detector and the host executor, the device chunks with
+/// @c multi_device_propagator::propagate_on on the device copies of the
+/// same detector. Both use the same actor chain and actor states, so that
+/// the results do not depend on where a track was propagated.
+///
+/// The host detector and the field that are passed to the constructor have
+/// to outlive the propagator. The host results should be in pinned memory.
+///
+/// @tparam host_propagator_t the propagator type with the host detector type
+/// @tparam device_propagator_t the propagator type with the device detector
+///                             type (see @c cuda::propagate_batch )
+/// @tparam field_t the magnetic field type (see @c multi_device_propagator )
+template <typename host_propagator_t, typename device_propagator_t,
+          typename field_t>
+class heterogeneous_propagator {
+
+    using host_detector_t = typename host_propagator_t::detector_type;
+    using scalar_t = typename host_propagator_t::scalar_type;
+    using track_t = typename host_propagator_t::free_track_parameters_type;
+    using result_t =
+        propagation::result<typename host_propagator_t::algebra_type>;
+    using actor_states_t =
+        typename host_propagator_t::actor_chain_type::state_tuple;
+
+    static_assert(
+        std::is_same_v<typename host_propagator_t::actor_chain_type,
+                       typename device_propagator_t::actor_chain_type>,
+        "Host and device have to run the same actor chain");
+    static_assert(std::is_same_v<track_t, typename device_propagator_t::
+                                              free_track_parameters_type>,
+                  "Host and device track types do not match");
+
+    public:
+    /// Configuration of the scheduling
+    struct config {
+        /// Propagate on the host as well as on the devices
+        bool use_host{true};
+        /// Smallest number of tracks the host takes at once
+        unsigned int min_host_chunk{64u};
+        /// Smallest number of tracks a device takes at once
+        unsigned int min_device_chunk{4096u};
+        /// A worker takes this fraction of its share of the remaining tracks
+        float share_fraction{0.5f};
+        /// Weight of the latest chunk in the throughput average
+        float smoothing{0.5f};
+    };
+
+    /// Upload the host detector @param det and the magnetic field
+    /// @param field to the devices @param devices .
+    ///
+    /// @param host_exec the executor of the host chunks. It should leave one
+    ///                  hardware thread per device for the device workers.
+    /// @param cfg the scheduling configuration
+    heterogeneous_propagator(
+        const std::vector<int> &devices, host_detector_t &det,
+        const field_t &field,
+        const propagation::parallel_executor &host_exec = {},
+        const config &cfg = {})
+        : m_cfg{cfg},
+          m_host_exec{host_exec},
+          m_det{&det},
+          m_field{&field},
+          m_devices{devices, det, field},
+          m_throughput(m_devices.n_devices() + 1u) {
+        reset_throughput();
+    }
+
+    /// @returns the number of devices the tracks are distributed over
+    std::size_t n_devices() const { return m_devices.n_devices(); }
+
+    /// @returns the current throughput estimate in tracks per second: first
+    /// the host, then the devices (zero, if not measured yet)
+    std::vector<double> throughput() const {
+        std::vector<double> rates{};
+        rates.reserve(m_throughput.size());
+        for (const auto &rate : m_throughput) {
+            rates.push_back(rate.load(std::memory_order_relaxed));
+        }
+        return rates;
+    }
+
+    /// Forget the measured throughput, e.g. when the workload changes
+    void reset_throughput() {
+        for (auto &rate : m_throughput) {
+            rate.store(0., std::memory_order_relaxed);
+        }
+    }
+
+    /// Propagate the batch of @param tracks and wait for the results
+    ///
+    /// @param launch the launch geometry on every device
+    /// @param cfg the propagation configuration
+    /// @param tracks the initial track parameters in host memory
+    /// @param results the propagation outcomes, resized to the number of
+    ///                tracks
+    /// @param actor_states the initial actor states of every track
+    void propagate(const launch_config &launch,
+                   const propagation::config<scalar_t> &cfg,
+                   const vecmem::vector<track_t> &tracks,
+                   vecmem::vector<result_t> &results,
+                   const actor_states_t &actor_states) {
+
+        results.resize(tracks.size());
+
+        const auto n_tracks{static_cast<unsigned int>(tracks.size())};
+
+        // Next track that has not been handed out
+        std::atomic<unsigned int> next_track{0u};
+
+        // Worker 0 is the host, worker i > 0 drives device i - 1
+        auto worker = [&](const std::size_t w) {
+            while (true) {
+                const unsigned int done{
+                    std::min(next_track.load(std::memory_order_relaxed),
+                             n_tracks)};
+                const unsigned int chunk{chunk_size(w, n_tracks - done)};
+
+                const unsigned int first{next_track.fetch_add(chunk)};
+                if (first >= n_tracks) {
+                    return;
+                }
+                const unsigned int n{std::min(chunk, n_tracks - first)};
+
+                const auto start{std::chrono::steady_clock::now()};
+
+                if (w == 0u) {
+                    propagate_on_host(cfg, tracks.data() + first,
+                                      results.data() + first, n,
+                                      actor_states);
+                } else {
+                    m_devices.propagate_on(w - 1u, launch, cfg,
+                                           tracks.data() + first,
+                                           results.data() + first, n,
+                                           actor_states);
+                }
+
+                const std::chrono::duration<double> elapsed{
+                    std::chrono::steady_clock::now() - start};
+                update_throughput(w, n, elapsed.count());
+            }
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(m_devices.n_devices());
+        for (std::size_t w = 1u; w < m_throughput.size(); ++w) {
+            threads.emplace_back(worker, w);
+        }
+
+        // The calling thread works on the host chunks
+        if (m_cfg.use_host) {
+            worker(0u);
+        }
+
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    }
+
+    private:
+    /// @returns the number of tracks that the worker @param w takes next,
+    /// when @param n_remaining tracks are left in the batch
+    unsigned int chunk_size(const std::size_t w,
+                            const unsigned int n_remaining) const {
+
+        const unsigned int min_chunk{std::max(
+            1u, w == 0u ? m_cfg.min_host_chunk : m_cfg.min_device_chunk)};
+
+        double total{0.};
+        for (std::size_t i = 0u; i < m_throughput.size(); ++i) {
+            if (i == 0u && !m_cfg.use_host) {
+                continue;
+            }
+            const double rate{m_throughput[i].load(std::memory_order_relaxed)};
+            // Not all workers have been measured yet
+            if (rate <= 0.) {
+                return min_chunk;
+            }
+            total += rate;
+        }
+
+        const double share{m_throughput[w].load(std::memory_order_relaxed) /
+                           total};
+        const auto chunk{static_cast<unsigned int>(
+            static_cast<double>(m_cfg.share_fraction) * share *
+            static_cast<double>(n_remaining))};
+
+        return std::max(chunk, min_chunk);
+    }
+
+    /// Add the measurement of @param n tracks in @param seconds to the
+    /// throughput average of the worker @param w
+    void update_throughput(const std::size_t w, const unsigned int n,
+                           const double seconds) {
+        const double rate{static_cast<double>(n) / std::max(seconds, 1e-9)};
+        const double old_rate{m_throughput[w].load(std::memory_order_relaxed)};
+        const auto alpha{static_cast<double>(m_cfg.smoothing)};
+
+        // Only the worker itself writes its throughput
+        m_throughput[w].store(
+            old_rate > 0. ? alpha * rate + (1. - alpha) * old_rate : rate,
+            std::memory_order_relaxed);
+    }
+
+    /// Propagate @param n tracks on the host with the host executor
+    void propagate_on_host(const propagation::config<scalar_t> &cfg,
+                           const track_t *tracks, result_t *results,
+                           const unsigned int n,
+                           const actor_states_t &actor_states) const {
+
+        const vecmem::device_vector<const track_t> trk_range(
+            vecmem::data::vector_view<const track_t>(n, tracks));
+        vecmem::device_vector<result_t> res_range(
+            vecmem::data::vector_view<result_t>(n, results));
+
+        host_propagator_t p{cfg};
+        p.propagate_batch(trk_range, res_range, m_host_exec, actor_states,
+                          typename field_t::view_t(*m_field), *m_det);
+    }
+
+    /// Scheduling configuration
+    config m_cfg{};
+    /// Executor of the host chunks
+    propagation::parallel_executor m_host_exec{};
+    /// The host detector
+    const host_detector_t *m_det{nullptr};
+    /// The host magnetic field
+    const field_t *m_field{nullptr};
+    /// The device copies of the detector and the field
+    multi_device_propagator<device_propagator_t, field_t> m_devices;
+    /// Throughput estimate of every worker in tracks per second
+    std::vector<std::atomic<double>> m_throughput;
+};
+
+}  // namespace detray::cuda
@@ -0,0 +1,256 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+#if !defined(__CUDACC__)
+#error "The detray CUDA kernels need to be compiled by a CUDA compiler"
+#endif
+
+// Project include(s)
+#include "detray/core/detector_upload.hpp"
+#include "detray/definitions/detail/cuda_definitions.hpp"
+#include "detray/propagator/cuda/propagate_batch.hpp"
+#include "detray/propagator/propagation_batch.hpp"
+#include "detray/propagator/propagation_config.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/data/vector_buffer.hpp>
+#include <vecmem/containers/data/vector_view.hpp>
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/cuda/device_memory_resource.hpp>
+#include <vecmem/utils/cuda/async_copy.hpp>
+#include <vecmem/utils/cuda/stream_wrapper.hpp>
+
+// CUDA include(s)
+#include <cuda_runtime.h>
+
+// System include(s)
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace detray::cuda {
+
+/// @returns the indices of all CUDA devices that are visible to the process
+inline std::vector<int> available_devices() {
+    int n_devices{0};
+    DETRAY_CUDA_ERROR_CHECK(cudaGetDeviceCount(&n_devices));
+
+    std::vector<int> devices(static_cast<std::size_t>(n_devices));
+    for (int i = 0; i < n_devices; ++i) {
+        devices[static_cast<std::size_t>(i)] = i;
+    }
+
+    return devices;
+}
+
+/// @brief Propagates track batches on several CUDA devices.
+///
+/// The detector and the magnetic field are uploaded once to every device,
+/// when the driver is constructed. A batch of tracks is then split into
+/// contiguous partitions of equal size, one per device, which are
+/// propagated concurrently on the streams of the devices with
+/// @c cuda::propagate_batch . The results are gathered directly into the
+/// host result collection, which should be in pinned host memory (e.g.
+/// @c vecmem::cuda::host_memory_resource ), so that the copies from the
+/// different devices can overlap.
+///
+/// @tparam propagator_t the propagator type with the device detector type
+///                      (see @c cuda::propagate_batch )
+/// @tparam field_t the magnetic field type on the device. It is constructed
+///                 from the host field on every device.
+template <typename propagator_t, typename field_t>
+class multi_device_propagator {
+
+    using detector_t = typename propagator_t::detector_type;
+    using scalar_t = typename propagator_t::scalar_type;
+    using track_t = typename propagator_t::free_track_parameters_type;
+    using result_t = propagation::result<typename propagator_t::algebra_type>;
+    using actor_states_t = typename propagator_t::actor_chain_type::state_tuple;
+
+    /// The resources and the detector data of a single device
+    struct device_data {
+        /// Set up the resources on the device @param id
+        explicit device_data(const int id)
+            : device{id}, stream{id}, mr{id}, copy{stream} {}
+
+        int device;
+        vecmem::cuda::stream_wrapper stream;
+        vecmem::cuda::device_memory_resource mr;
+        vecmem::cuda::async_copy copy;
+        typename detector_t::buffer_type det_buffer{};
+        std::unique_ptr<field_t> field{};
+    };
+
+    public:
+    /// Upload the host detector @param det and the host magnetic field
+    /// @param field to the devices @param devices .
+    ///
+    /// The uploads to the different devices run concurrently. The host data
+    /// is not needed anymore, once the constructor returns.
+    template <typename host_detector_t, typename host_field_t>
+    multi_device_propagator(const std::vector<int> &devices,
+                            host_detector_t &det, const host_field_t &field) {
+
+        static_assert(std::is_same_v<typename host_detector_t::buffer_type,
+                                     typename detector_t::buffer_type>,
+                      "Host and device detector types do not match");
+
+        if (devices.empty()) {
+            throw std::invalid_argument("No device to propagate on");
+        }
+
+        std::vector<detector_upload<host_detector_t>> uploads{};
+        uploads.reserve(devices.size());
+
+        for (const int id : devices) {
+            DETRAY_CUDA_ERROR_CHECK(cudaSetDevice(id));
+
+            auto &dev = *m_devices.emplace_back(
+                std::make_unique<device_data>(id));
+
+            uploads.push_back(upload_async(det, dev.mr, dev.copy));
+            dev.field = std::make_unique<field_t>(field);
+        }
+
+        // Wait for all uploads
+        for (std::size_t i = 0u; i < m_devices.size(); ++i) {
+            DETRAY_CUDA_ERROR_CHECK(cudaSetDevice(m_devices[i]->device));
+            uploads[i].events.wait();
+            m_devices[i]->det_buffer = std::move(uploads[i].buffer);
+        }
+    }
+
+    /// @returns the number of devices the tracks are distributed over
+    std::size_t n_devices() const { return m_devices.size(); }
+
+    /// Propagate the batch of @param tracks and wait for the results
+    ///
+    /// @param launch the launch geometry on every device (its stream is
+    ///               replaced by the stream of the device)
+    /// @param cfg the propagation configuration
+    /// @param tracks the initial track parameters in host memory
+    /// @param results the propagation outcomes, resized to the number of
+    ///                tracks
+    /// @param actor_states the initial actor states of every track
+    void propagate(const launch_config &launch,
+                   const propagation::config<scalar_t> &cfg,
+                   const vecmem::vector<track_t> &tracks,
+                   vecmem::vector<result_t> &results,
+                   const actor_states_t &actor_states) {
+
+        results.resize(tracks.size());
+
+        const std::size_t n_tracks{tracks.size()};
+        const std::size_t n_devs{m_devices.size()};
+
+        // Device buffers, which have to stay alive until the streams are done
+        std::vector<vecmem::data::vector_buffer<track_t>> track_buffers;
+        std::vector<vecmem::data::vector_buffer<result_t>> result_buffers;
+        track_buffers.reserve(n_devs);
+        result_buffers.reserve(n_devs);
+
+        for (std::size_t i = 0u; i < n_devs; ++i) {
+            device_data &dev = *m_devices[i];
+            DETRAY_CUDA_ERROR_CHECK(cudaSetDevice(dev.device));
+
+            // Contiguous partition of the batch
+            const std::size_t first{n_tracks * i / n_devs};
+            const std::size_t last{n_tracks * (i + 1u) / n_devs};
+            const auto n{static_cast<unsigned int>(last - first)};
+
+            auto &trk_buffer = track_buffers.emplace_back(n, dev.mr);
+            auto &res_buffer = result_buffers.emplace_back(n, dev.mr);
+
+            enqueue(dev, launch, cfg, tracks.data() + first,
+                    results.data() + first, trk_buffer, res_buffer,
+                    actor_states);
+        }
+
+        // Gather the results
+        for (auto &dev : m_devices) {
+            DETRAY_CUDA_ERROR_CHECK(cudaSetDevice(dev->device));
+            dev->stream.synchronize();
+        }
+    }
+
+    /// Propagate the @param n tracks that start at @param tracks on the
+    /// device with the index @param dev_idx and wait for the results
+    ///
+    /// Other than @c propagate , this can be called concurrently for
+    /// different devices, e.g. from a scheduler that drives every device from
+    /// its own host thread.
+    ///
+    /// @param dev_idx index of the device in the list of the constructor
+    /// @param launch the launch geometry (its stream is replaced by the
+    ///               stream of the device)
+    /// @param cfg the propagation configuration
+    /// @param tracks the initial track parameters in host memory
+    /// @param results the propagation outcomes in host memory, one per track
+    /// @param n number of tracks
+    /// @param actor_states the initial actor states of every track
+    void propagate_on(const std::size_t dev_idx, const launch_config &launch,
+                      const propagation::config<scalar_t> &cfg,
+                      const track_t *tracks, result_t *results,
+                      const unsigned int n,
+                      const actor_states_t &actor_states) {
+
+        assert(dev_idx < m_devices.size());
+
+        device_data &dev = *m_devices[dev_idx];
+        DETRAY_CUDA_ERROR_CHECK(cudaSetDevice(dev.device));
+
+        vecmem::data::vector_buffer<track_t> trk_buffer(n, dev.mr);
+        vecmem::data::vector_buffer<result_t> res_buffer(n, dev.mr);
+
+        enqueue(dev, launch, cfg, tracks, results, trk_buffer, res_buffer,
+                actor_states);
+
+        dev.stream.synchronize();
+    }
+
+    private:
+    /// Enqueue the copies and the propagation of the tracks that start at
+    /// @param tracks on the stream of the device @param dev . The number of
+    /// tracks is given by the size of the device buffers, which have to stay
+    /// alive until the stream was synchronized.
+    void enqueue(device_data &dev, const launch_config &launch,
+                 const propagation::config<scalar_t> &cfg,
+                 const track_t *tracks, result_t *results,
+                 vecmem::data::vector_buffer<track_t> &trk_buffer,
+                 vecmem::data::vector_buffer<result_t> &res_buffer,
+                 const actor_states_t &actor_states) {
+
+        const unsigned int n{trk_buffer.size()};
+        if (n == 0u) {
+            return;
+        }
+
+        dev.copy(vecmem::data::vector_view<const track_t>(n, tracks),
+                 trk_buffer, vecmem::copy::type::host_to_device);
+
+        launch_config dev_launch{launch};
+        dev_launch.stream = static_cast<cudaStream_t>(dev.stream.stream());
+
+        propagate_batch<propagator_t>(
+            dev_launch, cfg, detray::get_data(dev.det_buffer),
+            vecmem::get_data(trk_buffer), vecmem::get_data(res_buffer),
+            actor_states, typename field_t::view_t(*dev.field));
+
+        dev.copy(res_buffer, vecmem::data::vector_view<result_t>(n, results),
+                 vecmem::copy::type::device_to_host);
+    }
+
+    /// Resources of the devices (not movable)
+    std::vector<std::unique_ptr<device_data>> m_devices{};
+};
+
+}  // namespace detray::cuda
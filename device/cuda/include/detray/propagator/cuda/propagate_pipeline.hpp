@@ -0,0 +1,209 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+#if !defined(__CUDACC__)
+#error "The detray CUDA kernels need to be compiled by a CUDA compiler"
+#endif
+
+// Project include(s)
+#include "detray/definitions/detail/cuda_definitions.hpp"
+#include "detray/propagator/cuda/propagate_batch.hpp"
+#include "detray/propagator/propagation_batch.hpp"
+#include "detray/propagator/propagation_config.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/data/vector_buffer.hpp>
+#include <vecmem/containers/data/vector_view.hpp>
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/memory_resource.hpp>
+#include <vecmem/utils/cuda/stream_wrapper.hpp>
+
+// CUDA include(s)
+#include <cuda_runtime.h>
+
+// System include(s)
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+namespace detray::cuda {
+
+/// @brief Propagates a sequence of events in an overlapping pipeline.
+///
+/// Every event goes through the same three stages: the upload of its tracks,
+/// the propagation kernel (see @c cuda::propagate_batch ) and the download of
+/// its results. The events are distributed round robin over a number of
+/// slots, each with its own stream and device buffers, so that the upload of
+/// the next event and the download of the previous one run on the copy
+/// engines, while the current event is being propagated. A slot is only
+/// reused once its previous event has finished.
+///
+/// The host collections of an event have to be in pinned memory (e.g.
+/// @c vecmem::cuda::host_memory_resource ), for the copies to be
+/// asynchronous, and must not be touched until the event is done, i.e. until
+/// its slot is reused or @c wait returns. The navigator of the propagator
+/// uses a candidate cache of fixed capacity, so that the slots do not need
+/// candidate buffers.
+///
+/// @tparam propagator_t the propagator type with the device detector type
+///                      (see @c cuda::propagate_batch )
+/// @tparam field_view_t the magnetic field view type, if the stepper needs
+///                      a magnetic field
+template <typename propagator_t, typename... field_view_t>
+class propagation_pipeline {
+
+    using scalar_t = typename propagator_t::scalar_type;
+    using track_t = typename propagator_t::free_track_parameters_type;
+    using result_t = propagation::result<typename propagator_t::algebra_type>;
+    using actor_states_t = typename propagator_t::actor_chain_type::state_tuple;
+    using detector_view_t = typename propagator_t::detector_type::view_type;
+
+    /// Stream and device buffers of an event in flight
+    struct slot {
+        slot(vecmem::memory_resource &mr, const unsigned int max_tracks)
+            : track_buffer(max_tracks, mr), result_buffer(max_tracks, mr) {}
+
+        vecmem::cuda::stream_wrapper stream{};
+        vecmem::data::vector_buffer<track_t> track_buffer;
+        vecmem::data::vector_buffer<result_t> result_buffer;
+    };
+
+    public:
+    /// Set up the pipeline
+    ///
+    /// @param device_mr the resource of the device buffers of the slots
+    /// @param n_slots number of events that can be in flight at once
+    /// @param max_tracks the largest number of tracks in an event
+    /// @param launch the launch geometry (its stream is replaced by the
+    ///               streams of the slots)
+    /// @param cfg the propagation configuration
+    /// @param det_view view of the detector in device memory
+    /// @param actor_states the initial actor states of every track
+    /// @param field the magnetic field view
+    propagation_pipeline(vecmem::memory_resource &device_mr,
+                         const unsigned int n_slots,
+                         const unsigned int max_tracks,
+                         const launch_config &launch,
+                         const propagation::config<scalar_t> &cfg,
+                         detector_view_t det_view,
+                         const actor_states_t &actor_states,
+                         field_view_t... field)
+        : m_max_tracks{max_tracks},
+          m_launch{launch},
+          m_cfg{cfg},
+          m_det_view{det_view},
+          m_actor_states{actor_states},
+          m_field{field...} {
+
+        if (n_slots == 0u) {
+            throw std::invalid_argument("Pipeline needs at least one slot");
+        }
+
+        m_slots.reserve(n_slots);
+        for (unsigned int i = 0u; i < n_slots; ++i) {
+            m_slots.push_back(std::make_unique<slot>(device_mr, max_tracks));
+        }
+    }
+
+    /// Not copyable: owns the streams and buffers of the slots
+    /// @{
+    propagation_pipeline(const propagation_pipeline &) = delete;
+    propagation_pipeline &operator=(const propagation_pipeline &) = delete;
+    /// @}
+
+    /// The device buffers are released only after the events are done
+    ~propagation_pipeline() {
+        for (auto &s : m_slots) {
+            // Do not throw from the destructor
+            cudaStreamSynchronize(
+                static_cast<cudaStream_t>(s->stream.stream()));
+        }
+    }
+
+    /// @returns the number of events that can be in flight at once
+    std::size_t n_slots() const { return m_slots.size(); }
+
+    /// Enqueue the propagation of the event with the tracks @param tracks
+    ///
+    /// Waits only, if the next slot is still busy with an earlier event.
+    ///
+    /// @param results the propagation outcomes, at least one per track. They
+    ///                are available once the slot was reused or after
+    ///                @c wait
+    void submit(const vecmem::vector<track_t> &tracks,
+                vecmem::vector<result_t> &results) {
+
+        const auto n_tracks{static_cast<unsigned int>(tracks.size())};
+        if (n_tracks > m_max_tracks || results.size() < tracks.size()) {
+            throw std::invalid_argument(
+                "Event does not fit into the pipeline buffers");
+        }
+        if (n_tracks == 0u) {
+            return;
+        }
+
+        slot &s = *m_slots[m_next];
+        m_next = (m_next + 1u) % m_slots.size();
+
+        // The buffers of the slot are free once its last event is done
+        s.stream.synchronize();
+
+        const auto stream{static_cast<cudaStream_t>(s.stream.stream())};
+
+        DETRAY_CUDA_ERROR_CHECK(cudaMemcpyAsync(
+            s.track_buffer.ptr(), tracks.data(), n_tracks * sizeof(track_t),
+            cudaMemcpyHostToDevice, stream));
+
+        launch_config slot_launch{m_launch};
+        slot_launch.stream = stream;
+
+        std::apply(
+            [&](const field_view_t &... field) {
+                propagate_batch<propagator_t>(
+                    slot_launch, m_cfg, m_det_view,
+                    vecmem::data::vector_view<const track_t>(
+                        n_tracks, s.track_buffer.ptr()),
+                    vecmem::data::vector_view<result_t>(
+                        n_tracks, s.result_buffer.ptr()),
+                    m_actor_states, field...);
+            },
+            m_field);
+
+        DETRAY_CUDA_ERROR_CHECK(cudaMemcpyAsync(
+            results.data(), s.result_buffer.ptr(),
+            n_tracks * sizeof(result_t), cudaMemcpyDeviceToHost, stream));
+    }
+
+    /// Wait until all events that were submitted are done
+    void wait() {
+        for (auto &s : m_slots) {
+            s->stream.synchronize();
+        }
+    }
+
+    private:
+    /// Capacity of the slot buffers
+    unsigned int m_max_tracks;
+    /// Launch configuration and data of the propagation
+    /// @{
+    launch_config m_launch;
+    propagation::config<scalar_t> m_cfg;
+    detector_view_t m_det_view;
+    actor_states_t m_actor_states;
+    std::tuple<field_view_t...> m_field;
+    /// @}
+    /// The slots of the pipeline (not movable)
+    std::vector<std::unique_ptr<slot>> m_slots{};
+    /// Slot of the next event
+    std::size_t m_next{0u};
+};
+
+}  // namespace detray::cuda
@@ -0,0 +1,311 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+#if !defined(__CUDACC__)
+#error "The detray CUDA kernels need to be compiled by a CUDA compiler"
+#endif
+
+// Project include(s)
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/cuda_definitions.hpp"
+#include "detray/propagator/actors/step_recorder.hpp"
+#include "detray/propagator/cuda/propagate_batch.hpp"
+#include "detray/propagator/propagation_batch.hpp"
+#include "detray/propagator/propagation_config.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/data/vector_view.hpp>
+#include <vecmem/containers/device_vector.hpp>
+#include <vecmem/memory/memory_resource.hpp>
+
+// CUDA include(s)
+#include <cub/device/device_scan.cuh>
+#include <cuda_runtime.h>
+
+// System include(s)
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+
+namespace detray::cuda {
+
+namespace kernels {
+
+/// Propagate one track of the batch per thread and record its trajectory
+///
+/// @see detray::cuda::propagate_batch_recorded
+template <typename propagator_t, typename... field_view_t>
+__global__ void propagate_batch_recorded(
+    const propagation::config<typename propagator_t::scalar_type> cfg,
+    typename propagator_t::detector_type::view_type det_view,
+    vecmem::data::vector_view<
+        const typename propagator_t::free_track_parameters_type>
+        tracks_view,
+    vecmem::data::vector_view<
+        propagation::result<typename propagator_t::algebra_type>>
+        results_view,
+    typename step_record_collection<typename propagator_t::algebra_type,
+                                    device_container_types>::view_type
+        records_view,
+    const typename propagator_t::actor_chain_type::state_tuple actor_states,
+    const unsigned int *order, const bool stage_geometry,
+    field_view_t... field) {
+
+    using algebra_t = typename propagator_t::algebra_type;
+
+    const unsigned int gid{threadIdx.x + blockIdx.x * blockDim.x};
+
+    if (stage_geometry) {
+        det_view = detail::stage_geometry<propagator_t>(det_view);
+    }
+
+    const typename propagator_t::detector_type det(det_view);
+    const vecmem::device_vector<
+        const typename propagator_t::free_track_parameters_type>
+        tracks(tracks_view);
+    vecmem::device_vector<propagation::result<algebra_t>> results(
+        results_view);
+    step_record_collection<algebra_t, device_container_types> records(
+        records_view);
+
+    propagator_t p{cfg};
+    p.propagate_batch_recorded(
+        tracks, results, records,
+        propagation::ordered_executor<propagation::single_track_executor>{
+            {gid}, order},
+        actor_states, field..., det);
+}
+
+/// Copy the records of one track per thread into the dense collection
+///
+/// @see detray::cuda::compact_step_records
+template <typename algebra_t>
+__global__ void gather_step_records(
+    typename step_record_collection<algebra_t, device_container_types>::
+        view_type records_view,
+    typename compact_step_record_collection<
+        algebra_t, device_container_types>::view_type compact_view) {
+
+    const unsigned int gid{threadIdx.x + blockIdx.x * blockDim.x};
+
+    const step_record_collection<algebra_t, device_container_types> records(
+        records_view);
+    if (gid >= records.size()) {
+        return;
+    }
+    compact_step_record_collection<algebra_t, device_container_types> compact(
+        compact_view);
+
+    compact.gather(records, gid);
+}
+
+}  // namespace kernels
+
+/// @brief Enqueue the propagation of a batch of tracks on the device and
+/// record the trajectory of every track.
+///
+/// Like @c propagate_batch , but every track writes the steps that the
+/// output mode of the step recorder in @param actor_states selects (full
+/// trace, surfaces or sensitive surfaces) into its slice of
+/// @param records_view . For the final states alone, use the plain
+/// @c propagate_batch . The slices should be packed with
+/// @c compact_step_records before they are copied to the host.
+///
+/// @tparam propagator_t the propagator type with the device detector type.
+///                      Its actor chain has to contain a @c step_recorder on
+///                      device containers.
+/// @tparam field_view_t the magnetic field view type, if the stepper needs
+///                      a magnetic field
+///
+/// @param launch the launch geometry and stream (persistent threads and
+///               constant views are not supported)
+/// @param cfg the propagation configuration
+/// @param det_view view of the detector in device memory
+/// @param tracks_view the initial track parameters in device memory
+/// @param results_view the propagation outcomes, at least one per track
+/// @param records_view the record slices, at least one per track
+/// @param actor_states the initial actor states of every track
+/// @param field the magnetic field view
+template <typename propagator_t, typename... field_view_t>
+void propagate_batch_recorded(
+    const launch_config &launch,
+    const propagation::config<typename propagator_t::scalar_type> &cfg,
+    typename propagator_t::detector_type::view_type det_view,
+    vecmem::data::vector_view<
+        const typename propagator_t::free_track_parameters_type>
+        tracks_view,
+    vecmem::data::vector_view<
+        propagation::result<typename propagator_t::algebra_type>>
+        results_view,
+    typename step_record_collection<typename propagator_t::algebra_type,
+                                    device_container_types>::view_type
+        records_view,
+    const typename propagator_t::actor_chain_type::state_tuple &actor_states,
+    field_view_t... field) {
+
+    static_assert(sizeof...(field_view_t) <= 1u,
+                  "At most one magnetic field can be passed");
+
+    const unsigned int n_tracks{tracks_view.size()};
+    if (n_tracks == 0u) {
+        return;
+    }
+
+    // Stage the geometry only if it fits into the shared memory of a block
+    std::size_t shared_memory{launch.shared_memory};
+    bool stage_geometry{false};
+    if (launch.stage_geometry) {
+        int device{0};
+        int max_shared_memory{0};
+        DETRAY_CUDA_ERROR_CHECK(cudaGetDevice(&device));
+        DETRAY_CUDA_ERROR_CHECK(cudaDeviceGetAttribute(
+            &max_shared_memory, cudaDevAttrMaxSharedMemoryPerBlock, device));
+
+        const std::size_t staged_memory{
+            shared_geometry<typename propagator_t::detector_type>::size(
+                det_view)};
+
+        stage_geometry = (shared_memory + staged_memory <=
+                          static_cast<std::size_t>(max_shared_memory));
+        if (stage_geometry) {
+            shared_memory += staged_memory;
+        }
+    }
+
+    kernels::propagate_batch_recorded<propagator_t, field_view_t...>
+        <<<launch.n_blocks(n_tracks), launch.threads_per_block, shared_memory,
+           launch.stream>>>(cfg, det_view, tracks_view, results_view,
+                            records_view, actor_states, launch.order,
+                            stage_geometry, field...);
+
+    // Launch errors only: The kernel is not waited for
+    DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
+}
+
+/// @brief Enqueue the compaction of the record slices on the device.
+///
+/// The offsets of the tracks in the dense collection are the running sum of
+/// their numbers of records (device-wide scan), after which every thread
+/// copies the records of one track. Records beyond the capacity of
+/// @param compact_view are dropped (see
+/// @c compact_step_record_collection::n_dropped ). Nothing is waited for.
+///
+/// @param launch the launch geometry and stream
+/// @param records_view the record slices of the tracks
+/// @param compact_view the dense collection with one offset per track + 1
+template <typename algebra_t>
+void compact_step_records(
+    const launch_config &launch,
+    typename step_record_collection<algebra_t, device_container_types>::
+        view_type records_view,
+    typename compact_step_record_collection<
+        algebra_t, device_container_types>::view_type compact_view) {
+
+    auto n_records_view = detail::get<0>(records_view.m_view);
+    auto offsets_view = detail::get<0>(compact_view.m_view);
+
+    const unsigned int n_tracks{n_records_view.size()};
+    if (n_tracks == 0u) {
+        return;
+    }
+    assert(offsets_view.size() == n_tracks + 1u);
+
+    // offsets[0] = 0, offsets[trk + 1] = sum of records up to track trk
+    DETRAY_CUDA_ERROR_CHECK(cudaMemsetAsync(
+        offsets_view.ptr(), 0, sizeof(unsigned int), launch.stream));
+
+    std::size_t temp_bytes{0u};
+    DETRAY_CUDA_ERROR_CHECK(cub::DeviceScan::InclusiveSum(
+        nullptr, temp_bytes, n_records_view.ptr(), offsets_view.ptr() + 1,
+        static_cast<int>(n_tracks), launch.stream));
+
+    void *temp_storage{nullptr};
+    DETRAY_CUDA_ERROR_CHECK(
+        cudaMallocAsync(&temp_storage, temp_bytes, launch.stream));
+    DETRAY_CUDA_ERROR_CHECK(cub::DeviceScan::InclusiveSum(
+        temp_storage, temp_bytes, n_records_view.ptr(),
+        offsets_view.ptr() + 1, static_cast<int>(n_tracks), launch.stream));
+    DETRAY_CUDA_ERROR_CHECK(cudaFreeAsync(temp_storage, launch.stream));
+
+    kernels::gather_step_records<algebra_t>
+        <<<launch.n_blocks(n_tracks), launch.threads_per_block,
+           launch.shared_memory, launch.stream>>>(records_view, compact_view);
+
+    // Launch errors only: The kernel is not waited for
+    DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
+}
+
+/// @brief Copy the dense records from the device to the host.
+///
+/// Only the offsets and the records that are stored are transferred, not the
+/// full capacity of the device buffer. Waits for @param stream .
+///
+/// @param stream the stream that produced the compact records
+/// @param compact_view the dense collection in device memory
+/// @param mr the host memory resource for the result
+///
+/// @returns the records on the host
+template <typename algebra_t>
+auto copy_step_records(
+    cudaStream_t stream,
+    typename compact_step_record_collection<
+        algebra_t, device_container_types>::view_type compact_view,
+    vecmem::memory_resource &mr) -> compact_step_record_collection<algebra_t> {
+
+    // The offsets tell how many records there are
+    const auto d_offsets = detail::get<0>(compact_view.m_view);
+    const unsigned int n_tracks{d_offsets.size() == 0u ? 0u
+                                                       : d_offsets.size() - 1u};
+    unsigned int n_total{0u};
+    if (n_tracks > 0u) {
+        DETRAY_CUDA_ERROR_CHECK(cudaMemcpyAsync(
+            &n_total, d_offsets.ptr() + n_tracks, sizeof(unsigned int),
+            cudaMemcpyDeviceToHost, stream));
+        DETRAY_CUDA_ERROR_CHECK(cudaStreamSynchronize(stream));
+    }
+    const unsigned int n{
+        std::min(n_total, detail::get<1>(compact_view.m_view).size())};
+    const bool with_jacobians{detail::get<6>(compact_view.m_view).size() > 0u};
+
+    compact_step_record_collection<algebra_t> host_records(mr, n_tracks, n,
+                                                           with_jacobians);
+    auto host_view = host_records.get_data();
+
+    // Copy the first @param n_elements of a device vector
+    auto copy = [stream](auto h_view, const auto &d_view,
+                         const std::size_t n_elements) {
+        if (n_elements == 0u) {
+            return;
+        }
+        DETRAY_CUDA_ERROR_CHECK(cudaMemcpyAsync(
+            h_view.ptr(), d_view.ptr(), n_elements * sizeof(*d_view.ptr()),
+            cudaMemcpyDeviceToHost, stream));
+    };
+
+    copy(detail::get<0>(host_view.m_view), d_offsets, d_offsets.size());
+    copy(detail::get<1>(host_view.m_view),
+         detail::get<1>(compact_view.m_view), n);
+    copy(detail::get<2>(host_view.m_view),
+         detail::get<2>(compact_view.m_view), n);
+    copy(detail::get<3>(host_view.m_view),
+         detail::get<3>(compact_view.m_view), n);
+    copy(detail::get<4>(host_view.m_view),
+         detail::get<4>(compact_view.m_view), n);
+    copy(detail::get<5>(host_view.m_view),
+         detail::get<5>(compact_view.m_view), n);
+    if (with_jacobians) {
+        copy(detail::get<6>(host_view.m_view),
+             detail::get<6>(compact_view.m_view), n);
+    }
+    DETRAY_CUDA_ERROR_CHECK(cudaStreamSynchronize(stream));
+
+    return host_records;
+}
+
+}  // namespace detray::cuda
@@ -0,0 +1,333 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+#if !defined(__CUDACC__)
+#error "The detray CUDA kernels need to be compiled by a CUDA compiler"
+#endif
+
+// Project include(s)
+#include "detray/definitions/detail/cuda_definitions.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/propagator/cuda/propagate_batch.hpp"
+#include "detray/propagator/propagation_batch.hpp"
+#include "detray/propagator/propagation_config.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/data/vector_view.hpp>
+#include <vecmem/containers/device_vector.hpp>
+
+// CUDA include(s)
+#include <cuda_runtime.h>
+
+// System include(s)
+#include <algorithm>
+#include <new>
+
+namespace detray::cuda {
+
+namespace detail {
+
+/// State of a track that persists between the stage kernels
+template <typename propagator_t>
+struct wavefront_track {
+
+    template <typename... args_t>
+    DETRAY_DEVICE wavefront_track(
+        const typename propagator_t::free_track_parameters_type &track,
+        const typename propagator_t::actor_chain_type::state_tuple &actors,
+        const args_t &... args)
+        : propagation(track, args...), actor_states(actors) {}
+
+    typename propagator_t::state propagation;
+    typename propagator_t::actor_chain_type::state_tuple actor_states;
+};
+
+/// Queue of track indices in device memory
+struct wavefront_queue {
+    /// Number of track indices in the queue
+    unsigned int *size{nullptr};
+    /// Track indices
+    unsigned int *indices{nullptr};
+
+    /// Add the track index @param trk_idx
+    DETRAY_DEVICE void push(const unsigned int trk_idx) const {
+        indices[atomicAdd(size, 1u)] = trk_idx;
+    }
+};
+
+}  // namespace detail
+
+namespace kernels {
+
+/// Construct the device detector in global memory, since the propagation
+/// states keep a pointer to it between the kernels
+template <typename detector_t>
+__global__ void wavefront_setup(typename detector_t::view_type det_view,
+                                detector_t *det) {
+    if (threadIdx.x + blockIdx.x * blockDim.x == 0u) {
+        new (det) detector_t(det_view);
+    }
+}
+
+/// Set up the track states and initialize the propagation
+template <typename propagator_t, typename... field_view_t>
+__global__ void wavefront_init(
+    const propagation::config<typename propagator_t::scalar_type> cfg,
+    const typename propagator_t::detector_type *det,
+    vecmem::data::vector_view<
+        const typename propagator_t::free_track_parameters_type>
+        tracks_view,
+    detail::wavefront_track<propagator_t> *track_states,
+    const typename propagator_t::actor_chain_type::state_tuple actor_states,
+    const detail::wavefront_queue out, field_view_t... field) {
+
+    const unsigned int gid{threadIdx.x + blockIdx.x * blockDim.x};
+
+    const vecmem::device_vector<
+        const typename propagator_t::free_track_parameters_type>
+        tracks(tracks_view);
+    if (gid >= tracks.size()) {
+        return;
+    }
+
+    auto *trk = new (&track_states[gid]) detail::wavefront_track<propagator_t>(
+        tracks[gid], actor_states, field..., *det);
+
+    propagator_t p{cfg};
+    if (p.propagate_init(trk->propagation,
+                         propagator_t::actor_chain_type::make_state(
+                             trk->actor_states))) {
+        out.push(gid);
+    }
+}
+
+/// Run the stepping of the tracks in the queue @param in
+template <typename propagator_t>
+__global__ void wavefront_step(
+    const propagation::config<typename propagator_t::scalar_type> cfg,
+    detail::wavefront_track<propagator_t> *track_states,
+    const detail::wavefront_queue in, const detail::wavefront_queue out) {
+
+    const unsigned int gid{threadIdx.x + blockIdx.x * blockDim.x};
+    if (gid >= *in.size) {
+        return;
+    }
+
+    const unsigned int trk_idx{in.indices[gid]};
+    propagator_t p{cfg};
+    if (p.step_stage(track_states[trk_idx].propagation)) {
+        out.push(trk_idx);
+    }
+}
+
+/// Run the navigation update of the tracks in the queue @param in
+template <typename propagator_t>
+__global__ void wavefront_navigate(
+    const propagation::config<typename propagator_t::scalar_type> cfg,
+    detail::wavefront_track<propagator_t> *track_states,
+    const detail::wavefront_queue in, const detail::wavefront_queue out) {
+
+    const unsigned int gid{threadIdx.x + blockIdx.x * blockDim.x};
+    if (gid >= *in.size) {
+        return;
+    }
+
+    const unsigned int trk_idx{in.indices[gid]};
+    propagator_t p{cfg};
+    if (p.navigation_stage(track_states[trk_idx].propagation)) {
+        out.push(trk_idx);
+    }
+}
+
+/// Run the actors of the tracks in the queue @param in
+template <typename propagator_t>
+__global__ void wavefront_actors(
+    const propagation::config<typename propagator_t::scalar_type> cfg,
+    detail::wavefront_track<propagator_t> *track_states,
+    const detail::wavefront_queue in, const detail::wavefront_queue out) {
+
+    const unsigned int gid{threadIdx.x + blockIdx.x * blockDim.x};
+    if (gid >= *in.size) {
+        return;
+    }
+
+    const unsigned int trk_idx{in.indices[gid]};
+    auto &trk = track_states[trk_idx];
+    propagator_t p{cfg};
+    if (p.actor_stage(trk.propagation,
+                      propagator_t::actor_chain_type::make_state(
+                          trk.actor_states))) {
+        out.push(trk_idx);
+    }
+}
+
+/// Write the outcome of every track
+template <typename propagator_t>
+__global__ void wavefront_finalize(
+    const detail::wavefront_track<propagator_t> *track_states,
+    vecmem::data::vector_view<
+        propagation::result<typename propagator_t::algebra_type>>
+        results_view,
+    const unsigned int n_tracks) {
+
+    const unsigned int gid{threadIdx.x + blockIdx.x * blockDim.x};
+    if (gid >= n_tracks) {
+        return;
+    }
+
+    vecmem::device_vector<
+        propagation::result<typename propagator_t::algebra_type>>
+        results(results_view);
+
+    const auto &propagation = track_states[gid].propagation;
+    auto &res = results[gid];
+    res.params = propagation._stepping();
+    res.path_length = propagation._stepping._path_length;
+    res.status = propagation._navigation.status();
+    res.success = propagation._navigation.is_complete();
+}
+
+}  // namespace kernels
+
+/// @brief Propagate a batch of tracks on the device in a wavefront pipeline.
+///
+/// Instead of running the whole propagation loop in one kernel, every stage
+/// of a propagation step (see @c propagator::step_stage ,
+/// @c propagator::navigation_stage and @c propagator::actor_stage ) runs in
+/// its own kernel over all live tracks. The track states are kept in global
+/// memory between the kernels and every stage appends the tracks that are
+/// still alive to the queue of the next stage. This way, the register
+/// footprint of e.g. the Runge-Kutta stepper does not limit the occupancy of
+/// the navigation, and the finished tracks drop out of the grid.
+///
+/// The kernels are enqueued on the stream of @param launch . To find out
+/// when the batch is finished, the number of live tracks is read back every
+/// @param sync_interval steps, which synchronizes the stream. The results
+/// are available once the function has returned.
+///
+/// @tparam propagator_t the propagator type with the device detector type.
+///                      Its navigator has to use a candidate cache of fixed
+///                      capacity.
+/// @tparam field_view_t the magnetic field view type, if the stepper needs
+///                      a magnetic field
+///
+/// @param launch the launch geometry and stream (the persistent mode and the
+///               chunk size are not used)
+/// @param cfg the propagation configuration
+/// @param det_view view of the detector in device memory
+/// @param tracks_view the initial track parameters in device memory
+/// @param results_view the propagation outcomes, at least one per track
+/// @param actor_states the initial actor states of every track
+/// @param sync_interval number of steps between two reads of the queue size
+/// @param field the magnetic field view
+template <typename propagator_t, typename... field_view_t>
+void propagate_wavefront(
+    const launch_config &launch,
+    const propagation::config<typename propagator_t::scalar_type> &cfg,
+    typename propagator_t::detector_type::view_type det_view,
+    vecmem::data::vector_view<
+        const typename propagator_t::free_track_parameters_type>
+        tracks_view,
+    vecmem::data::vector_view<
+        propagation::result<typename propagator_t::algebra_type>>
+        results_view,
+    const typename propagator_t::actor_chain_type::state_tuple &actor_states,
+    const unsigned int sync_interval, field_view_t... field) {
+
+    static_assert(sizeof...(field_view_t) <= 1u,
+                  "At most one magnetic field can be passed");
+
+    using detector_t = typename propagator_t::detector_type;
+    using track_state_t = detail::wavefront_track<propagator_t>;
+
+    const unsigned int n_tracks{tracks_view.size()};
+    if (n_tracks == 0u) {
+        return;
+    }
+
+    const unsigned int n_threads{launch.threads_per_block};
+    const std::size_t shmem{launch.shared_memory};
+    cudaStream_t stream{launch.stream};
+
+    // Device storage of the detector, the track states and the queues
+    detector_t *det{nullptr};
+    track_state_t *track_states{nullptr};
+    unsigned int *queue_data{nullptr};
+    DETRAY_CUDA_ERROR_CHECK(cudaMallocAsync(
+        reinterpret_cast<void **>(&det), sizeof(detector_t), stream));
+    DETRAY_CUDA_ERROR_CHECK(
+        cudaMallocAsync(reinterpret_cast<void **>(&track_states),
+                        n_tracks * sizeof(track_state_t), stream));
+    DETRAY_CUDA_ERROR_CHECK(
+        cudaMallocAsync(reinterpret_cast<void **>(&queue_data),
+                        3u * (n_tracks + 1u) * sizeof(unsigned int), stream));
+
+    // The queues of the step, navigation and actor stages
+    detail::wavefront_queue queues[3];
+    for (unsigned int i = 0u; i < 3u; ++i) {
+        queues[i].size = queue_data + i * (n_tracks + 1u);
+        queues[i].indices = queues[i].size + 1u;
+    }
+    const auto reset = [stream](const detail::wavefront_queue &q) {
+        DETRAY_CUDA_ERROR_CHECK(
+            cudaMemsetAsync(q.size, 0, sizeof(unsigned int), stream));
+    };
+
+    kernels::wavefront_setup<detector_t><<<1, 1, 0, stream>>>(det_view, det);
+    DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
+
+    reset(queues[0]);
+    kernels::wavefront_init<propagator_t, field_view_t...>
+        <<<launch.n_blocks(n_tracks), n_threads, shmem, stream>>>(
+            cfg, det, tracks_view, track_states, actor_states, queues[0],
+            field...);
+    DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
+
+    // The number of live tracks only decreases, so the last value that was
+    // read back bounds the size of every queue
+    unsigned int n_live{n_tracks};
+    const unsigned int interval{std::max(sync_interval, 1u)};
+    while (n_live > 0u) {
+        for (unsigned int i = 0u; i < interval; ++i) {
+            const unsigned int n_blocks{launch.n_blocks(n_live)};
+
+            reset(queues[1]);
+            kernels::wavefront_step<propagator_t>
+                <<<n_blocks, n_threads, shmem, stream>>>(
+                    cfg, track_states, queues[0], queues[1]);
+            reset(queues[2]);
+            kernels::wavefront_navigate<propagator_t>
+                <<<n_blocks, n_threads, shmem, stream>>>(
+                    cfg, track_states, queues[1], queues[2]);
+            reset(queues[0]);
+            kernels::wavefront_actors<propagator_t>
+                <<<n_blocks, n_threads, shmem, stream>>>(
+                    cfg, track_states, queues[2], queues[0]);
+            DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
+        }
+
+        DETRAY_CUDA_ERROR_CHECK(cudaMemcpyAsync(&n_live, queues[0].size,
+                                                sizeof(unsigned int),
+                                                cudaMemcpyDeviceToHost,
+                                                stream));
+        DETRAY_CUDA_ERROR_CHECK(cudaStreamSynchronize(stream));
+    }
+
+    kernels::wavefront_finalize<propagator_t>
+        <<<launch.n_blocks(n_tracks), n_threads, shmem, stream>>>(
+            track_states, results_view, n_tracks);
+    DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
+
+    DETRAY_CUDA_ERROR_CHECK(cudaFreeAsync(queue_data, stream));
+    DETRAY_CUDA_ERROR_CHECK(cudaFreeAsync(track_states, stream));
+    DETRAY_CUDA_ERROR_CHECK(cudaFreeAsync(det, stream));
+    DETRAY_CUDA_ERROR_CHECK(cudaStreamSynchronize(stream));
+}
+
+}  // namespace detray::cuda
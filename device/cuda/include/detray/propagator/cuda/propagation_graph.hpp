@@ -0,0 +1,265 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+#if !defined(__CUDACC__)
+#error "The detray CUDA kernels need to be compiled by a CUDA compiler"
+#endif
+
+// Project include(s)
+#include "detray/definitions/detail/cuda_definitions.hpp"
+#include "detray/propagator/cuda/propagate_batch.hpp"
+#include "detray/propagator/propagation_batch.hpp"
+#include "detray/propagator/propagation_config.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/data/vector_view.hpp>
+
+// CUDA include(s)
+#include <cuda_runtime.h>
+
+// System include(s)
+#include <cstddef>
+#include <tuple>
+
+namespace detray::cuda {
+
+/// @brief Replays the per-event propagation sequence as a CUDA graph.
+///
+/// The upload of the tracks, the propagation kernel (see
+/// @c cuda::propagate_batch ) and the download of the results are captured
+/// from the stream once and are then launched as a single graph for every
+/// event. This saves the launch overhead of the individual operations, which
+/// is a sizeable part of the latency for small events.
+///
+/// The graph is bound to the buffers and the number of tracks of the event it
+/// was captured for. As long as the same buffers are passed, an event is a
+/// plain graph launch. If they change, the sequence is captured again and the
+/// executable graph is updated with the new pointers, which is much cheaper
+/// than instantiating it anew (the latter is only done, if the update fails,
+/// e.g. for the stream-ordered allocation of the persistent mode).
+///
+/// @tparam propagator_t the propagator type with the device detector type
+///                      (see @c cuda::propagate_batch )
+/// @tparam field_view_t the magnetic field view type, if the stepper needs
+///                      a magnetic field
+template <typename propagator_t, typename... field_view_t>
+class propagation_graph {
+
+    using scalar_t = typename propagator_t::scalar_type;
+    using track_t = typename propagator_t::free_track_parameters_type;
+    using result_t = propagation::result<typename propagator_t::algebra_type>;
+    using actor_states_t = typename propagator_t::actor_chain_type::state_tuple;
+    using detector_view_t = typename propagator_t::detector_type::view_type;
+
+    /// Buffers and size of an event, which are baked into the graph
+    struct event_shape {
+        const track_t *host_tracks{nullptr};
+        track_t *device_tracks{nullptr};
+        result_t *device_results{nullptr};
+        result_t *host_results{nullptr};
+        unsigned int n_tracks{0u};
+
+        bool operator==(const event_shape &other) const {
+            return host_tracks == other.host_tracks &&
+                   device_tracks == other.device_tracks &&
+                   device_results == other.device_results &&
+                   host_results == other.host_results &&
+                   n_tracks == other.n_tracks;
+        }
+    };
+
+    public:
+    /// Set up the propagation of the events
+    ///
+    /// @param launch the launch geometry and stream. If no stream is given,
+    ///               the graph creates its own (the legacy default stream
+    ///               cannot be captured).
+    /// @param cfg the propagation configuration
+    /// @param det_view view of the detector in device memory
+    /// @param actor_states the initial actor states of every track
+    /// @param field the magnetic field view
+    propagation_graph(const launch_config &launch,
+                      const propagation::config<scalar_t> &cfg,
+                      detector_view_t det_view,
+                      const actor_states_t &actor_states,
+                      field_view_t... field)
+        : m_launch{launch},
+          m_cfg{cfg},
+          m_det_view{det_view},
+          m_actor_states{actor_states},
+          m_field{field...} {
+        if (m_launch.stream == nullptr) {
+            DETRAY_CUDA_ERROR_CHECK(cudaStreamCreateWithFlags(
+                &m_launch.stream, cudaStreamNonBlocking));
+            m_owns_stream = true;
+        }
+    }
+
+    /// Owns the graph and possibly the stream
+    /// @{
+    propagation_graph(const propagation_graph &) = delete;
+    propagation_graph &operator=(const propagation_graph &) = delete;
+    /// @}
+
+    /// Release the graph and the stream
+    ~propagation_graph() {
+        // Do not throw from the destructor
+        if (m_exec != nullptr) {
+            cudaGraphExecDestroy(m_exec);
+        }
+        if (m_graph != nullptr) {
+            cudaGraphDestroy(m_graph);
+        }
+        if (m_owns_stream) {
+            cudaStreamDestroy(m_launch.stream);
+        }
+    }
+
+    /// @returns the stream the events are enqueued on
+    cudaStream_t stream() const { return m_launch.stream; }
+
+    /// @returns how often the sequence was captured
+    std::size_t n_captures() const { return m_n_captures; }
+
+    /// @returns how often the executable graph had to be instantiated
+    std::size_t n_instantiations() const { return m_n_instantiations; }
+
+    /// Enqueue the propagation of an event without synchronizing
+    ///
+    /// The host buffers should be in pinned memory, so that the copies are
+    /// asynchronous. The results are available once the stream was
+    /// synchronized.
+    ///
+    /// @param host_tracks the initial track parameters of the event (host)
+    /// @param device_tracks device buffer for the track parameters
+    /// @param device_results device buffer for the propagation outcomes
+    /// @param host_results the propagation outcomes of the event (host)
+    /// @param n_tracks the number of tracks in the event
+    void enqueue(const track_t *host_tracks, track_t *device_tracks,
+                 result_t *device_results, result_t *host_results,
+                 const unsigned int n_tracks) {
+
+        if (n_tracks == 0u) {
+            return;
+        }
+
+        const event_shape shape{host_tracks, device_tracks, device_results,
+                                host_results, n_tracks};
+        if (m_exec == nullptr || !(shape == m_shape)) {
+            capture(shape);
+        }
+
+        DETRAY_CUDA_ERROR_CHECK(cudaGraphLaunch(m_exec, m_launch.stream));
+    }
+
+    /// Propagate an event and wait for the results
+    ///
+    /// @see propagation_graph::enqueue
+    void run(const track_t *host_tracks, track_t *device_tracks,
+             result_t *device_results, result_t *host_results,
+             const unsigned int n_tracks) {
+        enqueue(host_tracks, device_tracks, device_results, host_results,
+                n_tracks);
+        DETRAY_CUDA_ERROR_CHECK(cudaStreamSynchronize(m_launch.stream));
+    }
+
+    private:
+    /// Capture the sequence for the event @param shape and update (or
+    /// instantiate) the executable graph
+    void capture(const event_shape &shape) {
+
+        const std::size_t track_bytes{shape.n_tracks * sizeof(track_t)};
+        const std::size_t result_bytes{shape.n_tracks * sizeof(result_t)};
+
+        cudaGraph_t graph{nullptr};
+        DETRAY_CUDA_ERROR_CHECK(cudaStreamBeginCapture(
+            m_launch.stream, cudaStreamCaptureModeThreadLocal));
+
+        DETRAY_CUDA_ERROR_CHECK(
+            cudaMemcpyAsync(shape.device_tracks, shape.host_tracks,
+                            track_bytes, cudaMemcpyHostToDevice,
+                            m_launch.stream));
+
+        std::apply(
+            [&](const field_view_t &... field) {
+                propagate_batch<propagator_t>(
+                    m_launch, m_cfg, m_det_view,
+                    vecmem::data::vector_view<const track_t>(
+                        shape.n_tracks, shape.device_tracks),
+                    vecmem::data::vector_view<result_t>(shape.n_tracks,
+                                                        shape.device_results),
+                    m_actor_states, field...);
+            },
+            m_field);
+
+        DETRAY_CUDA_ERROR_CHECK(
+            cudaMemcpyAsync(shape.host_results, shape.device_results,
+                            result_bytes, cudaMemcpyDeviceToHost,
+                            m_launch.stream));
+
+        DETRAY_CUDA_ERROR_CHECK(cudaStreamEndCapture(m_launch.stream, &graph));
+        ++m_n_captures;
+
+        // Swap the new parameters into the executable graph
+        if (m_exec != nullptr) {
+#if CUDART_VERSION >= 12000
+            cudaGraphExecUpdateResultInfo info{};
+            const bool updated{cudaGraphExecUpdate(m_exec, graph, &info) ==
+                               cudaSuccess};
+#else
+            cudaGraphNode_t error_node{nullptr};
+            cudaGraphExecUpdateResult info{};
+            const bool updated{cudaGraphExecUpdate(m_exec, graph, &error_node,
+                                                   &info) == cudaSuccess};
+#endif
+            if (!updated) {
+                // Clear the error of the failed update
+                static_cast<void>(cudaGetLastError());
+                DETRAY_CUDA_ERROR_CHECK(cudaGraphExecDestroy(m_exec));
+                m_exec = nullptr;
+            }
+        }
+        if (m_exec == nullptr) {
+            DETRAY_CUDA_ERROR_CHECK(
+                cudaGraphInstantiateWithFlags(&m_exec, graph, 0u));
+            ++m_n_instantiations;
+        }
+
+        if (m_graph != nullptr) {
+            DETRAY_CUDA_ERROR_CHECK(cudaGraphDestroy(m_graph));
+        }
+        m_graph = graph;
+        m_shape = shape;
+    }
+
+    /// Launch configuration and data of the propagation
+    /// @{
+    launch_config m_launch;
+    propagation::config<scalar_t> m_cfg;
+    detector_view_t m_det_view;
+    actor_states_t m_actor_states;
+    std::tuple<field_view_t...> m_field;
+    /// @}
+
+    /// Whether the stream was created by the graph
+    bool m_owns_stream{false};
+    /// The captured sequence and its executable version
+    /// @{
+    cudaGraph_t m_graph{nullptr};
+    cudaGraphExec_t m_exec{nullptr};
+    event_shape m_shape{};
+    /// @}
+    /// Statistics
+    /// @{
+    std::size_t m_n_captures{0u};
+    std::size_t m_n_instantiations{0u};
+    /// @}
+};
+
+}  // namespace detray::cuda
@@ -0,0 +1,77 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+#if !defined(__CUDACC__)
+#error "The detray CUDA kernels need to be compiled by a CUDA compiler"
+#endif
+
+// Project include(s)
+#include "detray/definitions/detail/cuda_definitions.hpp"
+#include "detray/propagator/covariance_batch.hpp"
+#include "detray/propagator/cuda/propagate_batch.hpp"
+
+// CUDA include(s)
+#include <cuda_runtime.h>
+
+// System include(s)
+#include <cstddef>
+
+namespace detray::cuda {
+
+namespace kernels {
+
+/// Transport the covariance of one track of the batch per thread
+///
+/// @see detray::cuda::transport_covariance
+template <typename scalar_t, std::size_t N>
+__global__ void transport_covariance(
+    const propagation::matrix_batch_view<scalar_t, N, N> jac,
+    const propagation::matrix_batch_view<scalar_t, N, N> cov) {
+
+    const unsigned int gid{threadIdx.x + blockIdx.x * blockDim.x};
+    if (gid >= cov.n_tracks) {
+        return;
+    }
+
+    propagation::transport_covariance(jac, cov, gid);
+}
+
+}  // namespace kernels
+
+/// @brief Enqueue the covariance transport of a batch of tracks.
+///
+/// Computes C <- J * C * J^T in place for every track of the batch, e.g.
+/// between the stages of a staged propagation or in a track fit. The
+/// matrices are stored as structure-of-arrays (see
+/// @c propagation::matrix_batch_view ), so that the neighbouring threads of
+/// a warp read neighbouring matrix elements. The kernel is enqueued on the
+/// stream of @param launch and not waited for.
+///
+/// @param launch the launch geometry and stream
+/// @param jac the full jacobians of the batch in device memory
+/// @param cov the covariances of the batch in device memory
+template <typename scalar_t, std::size_t N>
+void transport_covariance(
+    const launch_config& launch,
+    const propagation::matrix_batch_view<scalar_t, N, N>& jac,
+    const propagation::matrix_batch_view<scalar_t, N, N>& cov) {
+
+    if (cov.n_tracks == 0u) {
+        return;
+    }
+
+    kernels::transport_covariance<scalar_t, N>
+        <<<launch.n_blocks(cov.n_tracks), launch.threads_per_block, 0u,
+           launch.stream>>>(jac, cov);
+
+    // Launch errors only: The kernel is not waited for
+    DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
+}
+
+}  // namespace detray::cuda
@@ -0,0 +1,106 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+#if !defined(__CUDACC__)
+#error "The detray CUDA kernels need to be compiled by a CUDA compiler"
+#endif
+
+// Project include(s)
+#include "detray/definitions/detail/cuda_definitions.hpp"
+#include "detray/propagator/cuda/propagate_batch.hpp"
+#include "detray/propagator/propagation_batch.hpp"
+#include "detray/simulation/fast_simulator.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/data/vector_view.hpp>
+#include <vecmem/containers/device_vector.hpp>
+
+// CUDA include(s)
+#include <cuda_runtime.h>
+
+namespace detray::cuda {
+
+namespace kernels {
+
+/// Simulate one track of the batch per thread
+///
+/// @see detray::cuda::simulate_batch
+template <typename simulator_t, typename... field_view_t>
+__global__ void simulate_batch(
+    const typename simulator_t::config cfg,
+    typename simulator_t::detector_type::view_type det_view,
+    vecmem::data::vector_view<
+        const typename simulator_t::free_track_parameters_type>
+        tracks_view,
+    typename simulator_t::hit_collection_type::view_type hits_view,
+    field_view_t... field) {
+
+    const unsigned int gid{threadIdx.x + blockIdx.x * blockDim.x};
+
+    const typename simulator_t::detector_type det(det_view);
+    const vecmem::device_vector<
+        const typename simulator_t::free_track_parameters_type>
+        tracks(tracks_view);
+
+    const simulator_t sim{cfg};
+    sim.simulate(tracks, hits_view, propagation::single_track_executor{gid},
+                 field..., det);
+}
+
+}  // namespace kernels
+
+/// @brief Enqueue the fast simulation of a batch of tracks on the device.
+///
+/// Every track is simulated by its own thread and its hits are recorded in
+/// its slots of the hit collection @param hits_view . Since the random
+/// numbers only depend on the event number and the track index, the hits
+/// agree with a simulation of the batch on the host up to the floating point
+/// differences of host and device. The kernel is enqueued on the stream of
+/// @param launch (only the block size and the stream are used) and the
+/// function returns without synchronizing.
+///
+/// @tparam simulator_t the @c fast_simulator type with the device detector
+///                     type
+/// @tparam field_view_t the magnetic field view type, if the stepper needs
+///                      a magnetic field
+///
+/// @param launch the launch geometry and stream
+/// @param cfg the simulation configuration
+/// @param det_view view of the detector in device memory
+/// @param tracks_view the initial track parameters in device memory
+/// @param hits_view the hit collection, with one track slot per track
+/// @param field the magnetic field view
+template <typename simulator_t, typename... field_view_t>
+void simulate_batch(
+    const launch_config &launch, const typename simulator_t::config &cfg,
+    typename simulator_t::detector_type::view_type det_view,
+    vecmem::data::vector_view<
+        const typename simulator_t::free_track_parameters_type>
+        tracks_view,
+    typename simulator_t::hit_collection_type::view_type hits_view,
+    field_view_t... field) {
+
+    static_assert(sizeof...(field_view_t) <= 1u,
+                  "At most one magnetic field can be passed");
+
+    const unsigned int n_tracks{tracks_view.size()};
+    if (n_tracks == 0u) {
+        return;
+    }
+
+    kernels::simulate_batch<simulator_t, field_view_t...>
+        <<<launch.n_blocks(n_tracks), launch.threads_per_block,
+           launch.shared_memory, launch.stream>>>(cfg, det_view, tracks_view,
+                                                  hits_view, field...);
+
+    // Launch errors only: The kernel is not waited for
+    DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
+}
+
+}  // namespace detray::cuda
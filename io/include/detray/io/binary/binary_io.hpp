@@ -0,0 +1,683 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/io/frontend/payloads.hpp"
+
+// System include(s)
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <map>
+#include <optional>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+//
+// Binary (de)serialization of the io payloads
+//
+
+/// All records are written as flat sequences of little-endian values without
+/// padding: Arithmetic values are written with their native width (enums
+/// with the width of their underlying type), strings and containers are
+/// prefixed by their size as a 64 bit unsigned integer and optional values by
+/// a one byte flag. Payload structs are written member by member in the order
+/// of declaration, except for the grid collections, which are written as one
+/// size-prefixed record per volume, and the compressed grid bins.
+namespace detray::io {
+
+namespace detail {
+
+static_assert(sizeof(std::size_t) == 8u,
+              "Binary detector IO requires a 64 bit std::size_t");
+static_assert(sizeof(real_io) == 8u,
+              "Binary detector IO requires 64 bit floating point values");
+
+/// Identifies a detray binary file
+inline constexpr std::array<char, 4> binary_magic{'D', 'T', 'R', 'B'};
+
+/// Version of the record layout. Has to be increased whenever the layout of
+/// a payload changes
+inline constexpr std::uint32_t binary_format_version{3u};
+
+/// @returns true if the host stores values in little-endian byte order
+inline bool is_little_endian() {
+    const std::uint16_t one{1u};
+    unsigned char first_byte{0u};
+    std::memcpy(&first_byte, &one, 1u);
+    return first_byte == 1u;
+}
+
+/// @returns a stream error for the record @param what
+inline std::runtime_error binary_read_error(const std::string& what) {
+    return std::runtime_error("Binary detector IO: Could not read " + what);
+}
+
+/// Variable length encoding of integers (LEB128): Seven bits per byte, the
+/// highest bit flags that more bytes follow
+/// @{
+inline void write_varint(std::ostream& os, std::uint64_t value) {
+    while (value >= 0x80u) {
+        os.put(static_cast<char>((value & 0x7fu) | 0x80u));
+        value >>= 7u;
+    }
+    os.put(static_cast<char>(value));
+}
+
+inline std::uint64_t read_varint(std::istream& is) {
+    std::uint64_t value{0u};
+    for (unsigned int shift = 0u; shift < 64u; shift += 7u) {
+        const int byte{is.get()};
+        if (byte == std::char_traits<char>::eof()) {
+            throw binary_read_error("varint");
+        }
+        value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0) {
+            return value;
+        }
+    }
+    throw binary_read_error("varint: Too many bytes");
+}
+
+/// Signed values are mapped to unsigned ones first, so that small negative
+/// values also get a short encoding
+inline void write_zigzag(std::ostream& os, const std::int64_t value) {
+    write_varint(os, (static_cast<std::uint64_t>(value) << 1u) ^
+                         static_cast<std::uint64_t>(value >> 63));
+}
+
+inline std::int64_t read_zigzag(std::istream& is) {
+    const std::uint64_t value{read_varint(is)};
+    return static_cast<std::int64_t>(value >> 1u) ^
+           -static_cast<std::int64_t>(value & 1u);
+}
+/// @}
+
+}  // namespace detail
+
+/// Generic types
+/// @{
+template <typename T,
+          std::enable_if_t<std::is_arithmetic_v<T> || std::is_enum_v<T>,
+                           bool> = true>
+inline void to_binary(std::ostream& os, const T& value);
+
+template <typename T,
+          std::enable_if_t<std::is_arithmetic_v<T> || std::is_enum_v<T>,
+                           bool> = true>
+inline void from_binary(std::istream& is, T& value);
+
+inline void to_binary(std::ostream& os, const std::string& s);
+inline void from_binary(std::istream& is, std::string& s);
+
+template <typename T, std::size_t N>
+inline void to_binary(std::ostream& os, const std::array<T, N>& arr);
+template <typename T, std::size_t N>
+inline void from_binary(std::istream& is, std::array<T, N>& arr);
+
+template <typename T>
+inline void to_binary(std::ostream& os, const std::vector<T>& vec);
+template <typename T>
+inline void from_binary(std::istream& is, std::vector<T>& vec);
+
+template <typename T>
+inline void to_binary(std::ostream& os, const std::optional<T>& opt);
+template <typename T>
+inline void from_binary(std::istream& is, std::optional<T>& opt);
+
+template <typename K, typename V>
+inline void to_binary(std::ostream& os, const std::map<K, V>& m);
+template <typename K, typename V>
+inline void from_binary(std::istream& is, std::map<K, V>& m);
+
+template <typename T,
+          std::enable_if_t<std::is_arithmetic_v<T> || std::is_enum_v<T>,
+                           bool>>
+inline void to_binary(std::ostream& os, const T& value) {
+    std::array<char, sizeof(T)> bytes;
+    std::memcpy(bytes.data(), &value, sizeof(T));
+    if (!detail::is_little_endian()) {
+        std::reverse(bytes.begin(), bytes.end());
+    }
+    os.write(bytes.data(), sizeof(T));
+}
+
+template <typename T,
+          std::enable_if_t<std::is_arithmetic_v<T> || std::is_enum_v<T>,
+                           bool>>
+inline void from_binary(std::istream& is, T& value) {
+    std::array<char, sizeof(T)> bytes;
+    if (!is.read(bytes.data(), sizeof(T))) {
+        throw detail::binary_read_error("value");
+    }
+    if (!detail::is_little_endian()) {
+        std::reverse(bytes.begin(), bytes.end());
+    }
+    std::memcpy(&value, bytes.data(), sizeof(T));
+}
+
+/// Read a container size
+inline std::size_t read_binary_size(std::istream& is) {
+    std::uint64_t n{0u};
+    from_binary(is, n);
+    return static_cast<std::size_t>(n);
+}
+
+inline void to_binary(std::ostream& os, const std::string& s) {
+    to_binary(os, static_cast<std::uint64_t>(s.size()));
+    os.write(s.data(), static_cast<std::streamsize>(s.size()));
+}
+
+inline void from_binary(std::istream& is, std::string& s) {
+    s.resize(read_binary_size(is));
+    if (!is.read(s.data(), static_cast<std::streamsize>(s.size()))) {
+        throw detail::binary_read_error("string");
+    }
+}
+
+template <typename T, std::size_t N>
+inline void to_binary(std::ostream& os, const std::array<T, N>& arr) {
+    for (const T& value : arr) {
+        to_binary(os, value);
+    }
+}
+
+template <typename T, std::size_t N>
+inline void from_binary(std::istream& is, std::array<T, N>& arr) {
+    for (T& value : arr) {
+        from_binary(is, value);
+    }
+}
+
+template <typename T>
+inline void to_binary(std::ostream& os, const std::vector<T>& vec) {
+    to_binary(os, static_cast<std::uint64_t>(vec.size()));
+
+    // Arithmetic data can be written in one go on little-endian hosts
+    if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) {
+        if (detail::is_little_endian()) {
+            os.write(reinterpret_cast<const char*>(vec.data()),
+                     static_cast<std::streamsize>(vec.size() * sizeof(T)));
+            return;
+        }
+    }
+    for (const T& value : vec) {
+        to_binary(os, value);
+    }
+}
+
+template <typename T>
+inline void from_binary(std::istream& is, std::vector<T>& vec) {
+    vec.resize(read_binary_size(is));
+
+    if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) {
+        if (detail::is_little_endian()) {
+            if (!is.read(reinterpret_cast<char*>(vec.data()),
+                         static_cast<std::streamsize>(vec.size() *
+                                                      sizeof(T)))) {
+                throw detail::binary_read_error("vector");
+            }
+            return;
+        }
+    }
+    for (T& value : vec) {
+        from_binary(is, value);
+    }
+}
+
+template <typename T>
+inline void to_binary(std::ostream& os, const std::optional<T>& opt) {
+    to_binary(os, static_cast<std::uint8_t>(opt.has_value()));
+    if (opt.has_value()) {
+        to_binary(os, *opt);
+    }
+}
+
+template <typename T>
+inline void from_binary(std::istream& is, std::optional<T>& opt) {
+    std::uint8_t has_value{0u};
+    from_binary(is, has_value);
+    if (has_value != 0u) {
+        T value{};
+        from_binary(is, value);
+        opt = std::move(value);
+    } else {
+        opt.reset();
+    }
+}
+
+template <typename K, typename V>
+inline void to_binary(std::ostream& os, const std::map<K, V>& m) {
+    to_binary(os, static_cast<std::uint64_t>(m.size()));
+    for (const auto& [key, value] : m) {
+        to_binary(os, key);
+        to_binary(os, value);
+    }
+}
+
+template <typename K, typename V>
+inline void from_binary(std::istream& is, std::map<K, V>& m) {
+    m.clear();
+    const std::size_t n{read_binary_size(is)};
+    for (std::size_t i = 0u; i < n; ++i) {
+        K key{};
+        from_binary(is, key);
+        from_binary(is, m[key]);
+    }
+}
+/// @}
+
+/// Header IO
+/// @{
+inline void to_binary(std::ostream& os, const common_header_payload& h) {
+    to_binary(os, h.version);
+    to_binary(os, h.detector);
+    to_binary(os, h.tag);
+    to_binary(os, h.date);
+}
+
+inline void from_binary(std::istream& is, common_header_payload& h) {
+    from_binary(is, h.version);
+    from_binary(is, h.detector);
+    from_binary(is, h.tag);
+    from_binary(is, h.date);
+}
+
+inline void to_binary(std::ostream& os, const geo_sub_header_payload& h) {
+    to_binary(os, h.n_volumes);
+    to_binary(os, h.n_surfaces);
+}
+
+inline void from_binary(std::istream& is, geo_sub_header_payload& h) {
+    from_binary(is, h.n_volumes);
+    from_binary(is, h.n_surfaces);
+}
+
+inline void to_binary(std::ostream& os,
+                      const homogeneous_material_sub_header_payload& h) {
+    to_binary(os, h.n_slabs);
+    to_binary(os, h.n_rods);
+}
+
+inline void from_binary(std::istream& is,
+                        homogeneous_material_sub_header_payload& h) {
+    from_binary(is, h.n_slabs);
+    from_binary(is, h.n_rods);
+}
+
+inline void to_binary(std::ostream& os, const grid_sub_header_payload& h) {
+    to_binary(os, h.n_grids);
+}
+
+inline void from_binary(std::istream& is, grid_sub_header_payload& h) {
+    from_binary(is, h.n_grids);
+}
+
+template <typename sub_header_payload_t>
+inline void to_binary(std::ostream& os,
+                      const header_payload<sub_header_payload_t>& h) {
+    to_binary(os, h.common);
+    to_binary(os, h.sub_header);
+}
+
+template <typename sub_header_payload_t>
+inline void from_binary(std::istream& is,
+                        header_payload<sub_header_payload_t>& h) {
+    from_binary(is, h.common);
+    from_binary(is, h.sub_header);
+}
+/// @}
+
+/// Data links IO
+/// @{
+inline void to_binary(std::ostream& os, const single_link_payload& so) {
+    to_binary(os, so.link);
+}
+
+inline void from_binary(std::istream& is, single_link_payload& so) {
+    from_binary(is, so.link);
+}
+
+template <typename type_id_t>
+inline void to_binary(std::ostream& os,
+                      const typed_link_payload<type_id_t>& l) {
+    to_binary(os, l.type);
+    to_binary(os, l.index);
+}
+
+template <typename type_id_t>
+inline void from_binary(std::istream& is, typed_link_payload<type_id_t>& l) {
+    from_binary(is, l.type);
+    from_binary(is, l.index);
+}
+/// @}
+
+/// Geometry IO
+/// @{
+inline void to_binary(std::ostream& os, const transform_payload& t) {
+    to_binary(os, t.tr);
+    to_binary(os, t.rot);
+}
+
+inline void from_binary(std::istream& is, transform_payload& t) {
+    from_binary(is, t.tr);
+    from_binary(is, t.rot);
+}
+
+inline void to_binary(std::ostream& os, const mask_payload& m) {
+    to_binary(os, m.shape);
+    to_binary(os, m.volume_link);
+    to_binary(os, m.boundaries);
+}
+
+inline void from_binary(std::istream& is, mask_payload& m) {
+    from_binary(is, m.shape);
+    from_binary(is, m.volume_link);
+    from_binary(is, m.boundaries);
+}
+
+inline void to_binary(std::ostream& os, const surface_payload& s) {
+    to_binary(os, s.index_in_coll);
+    to_binary(os, s.transform);
+    to_binary(os, s.mask);
+    to_binary(os, s.material);
+    to_binary(os, s.source);
+    to_binary(os, s.barcode);
+    to_binary(os, s.type);
+}
+
+inline void from_binary(std::istream& is, surface_payload& s) {
+    from_binary(is, s.index_in_coll);
+    from_binary(is, s.transform);
+    from_binary(is, s.mask);
+    from_binary(is, s.material);
+    from_binary(is, s.source);
+    from_binary(is, s.barcode);
+    from_binary(is, s.type);
+}
+
+inline void to_binary(std::ostream& os, const volume_payload& v) {
+    to_binary(os, v.name);
+    to_binary(os, v.type);
+    to_binary(os, v.transform);
+    to_binary(os, v.surfaces);
+    to_binary(os, v.index);
+    to_binary(os, v.acc_links);
+}
+
+inline void from_binary(std::istream& is, volume_payload& v) {
+    from_binary(is, v.name);
+    from_binary(is, v.type);
+    from_binary(is, v.transform);
+    from_binary(is, v.surfaces);
+    from_binary(is, v.index);
+    from_binary(is, v.acc_links);
+}
+/// @}
+
+/// Material IO
+/// @{
+inline void to_binary(std::ostream& os, const material_payload& m) {
+    to_binary(os, m.params);
+}
+
+inline void from_binary(std::istream& is, material_payload& m) {
+    from_binary(is, m.params);
+}
+
+inline void to_binary(std::ostream& os, const material_slab_payload& m) {
+    to_binary(os, m.type);
+    to_binary(os, m.index_in_coll);
+    to_binary(os, m.surface);
+    to_binary(os, m.thickness);
+    to_binary(os, m.mat);
+}
+
+inline void from_binary(std::istream& is, material_slab_payload& m) {
+    from_binary(is, m.type);
+    from_binary(is, m.index_in_coll);
+    from_binary(is, m.surface);
+    from_binary(is, m.thickness);
+    from_binary(is, m.mat);
+}
+
+inline void to_binary(std::ostream& os, const material_volume_payload& m) {
+    to_binary(os, m.volume_link);
+    to_binary(os, m.mat_slabs);
+    to_binary(os, m.mat_rods);
+}
+
+inline void from_binary(std::istream& is, material_volume_payload& m) {
+    from_binary(is, m.volume_link);
+    from_binary(is, m.mat_slabs);
+    from_binary(is, m.mat_rods);
+}
+
+inline void to_binary(std::ostream& os,
+                      const detector_homogeneous_material_payload& d) {
+    to_binary(os, d.volumes);
+}
+
+inline void from_binary(std::istream& is,
+                        detector_homogeneous_material_payload& d) {
+    from_binary(is, d.volumes);
+}
+/// @}
+
+/// Grid IO
+/// @{
+inline void to_binary(std::ostream& os, const axis_payload& a) {
+    to_binary(os, a.binning);
+    to_binary(os, a.bounds);
+    to_binary(os, a.label);
+    to_binary(os, a.bins);
+    to_binary(os, a.edges);
+}
+
+inline void from_binary(std::istream& is, axis_payload& a) {
+    from_binary(is, a.binning);
+    from_binary(is, a.bounds);
+    from_binary(is, a.label);
+    from_binary(is, a.bins);
+    from_binary(is, a.edges);
+}
+
+template <typename content_t>
+inline void to_binary(std::ostream& os, const grid_bin_payload<content_t>& b) {
+    to_binary(os, b.loc_index);
+    to_binary(os, b.content);
+}
+
+template <typename content_t>
+inline void from_binary(std::istream& is, grid_bin_payload<content_t>& b) {
+    from_binary(is, b.loc_index);
+    from_binary(is, b.content);
+}
+
+/// The bins of a grid are compressed: The local bin indices are written as
+/// differences to the previous bin, integer bin content as differences
+/// between consecutive entries (both as zigzag varints), and the content of
+/// a bin that is identical to the content of the previous bin (e.g. the
+/// material of neighbouring bins) is replaced by a one byte repeat flag.
+template <typename content_t>
+inline void to_binary(std::ostream& os,
+                      const std::vector<grid_bin_payload<content_t>>& bins) {
+    to_binary(os, static_cast<std::uint64_t>(bins.size()));
+
+    std::vector<unsigned int> prev_loc{};
+    std::string prev_content{};
+    std::ostringstream content_stream{std::ios_base::out |
+                                      std::ios_base::binary};
+
+    for (const auto& bin : bins) {
+        // Local bin indices
+        detail::write_varint(os, bin.loc_index.size());
+        for (std::size_t i = 0u; i < bin.loc_index.size(); ++i) {
+            const std::int64_t prev{i < prev_loc.size() ? prev_loc[i] : 0};
+            detail::write_zigzag(os, bin.loc_index[i] - prev);
+        }
+        prev_loc = bin.loc_index;
+
+        // Bin content
+        content_stream.str(std::string{});
+        if constexpr (std::is_integral_v<content_t>) {
+            detail::write_varint(content_stream, bin.content.size());
+            std::int64_t prev{0};
+            for (const content_t c : bin.content) {
+                detail::write_zigzag(content_stream,
+                                     static_cast<std::int64_t>(c) - prev);
+                prev = static_cast<std::int64_t>(c);
+            }
+        } else {
+            to_binary(content_stream, bin.content);
+        }
+        std::string content{content_stream.str()};
+
+        const bool repeat{&bin != &bins.front() and content == prev_content};
+        to_binary(os, static_cast<std::uint8_t>(repeat));
+        if (!repeat) {
+            os.write(content.data(),
+                     static_cast<std::streamsize>(content.size()));
+            prev_content = std::move(content);
+        }
+    }
+}
+
+template <typename content_t>
+inline void from_binary(std::istream& is,
+                        std::vector<grid_bin_payload<content_t>>& bins) {
+    bins.resize(read_binary_size(is));
+
+    const std::vector<unsigned int>* prev_loc{nullptr};
+    const std::vector<content_t>* prev_content{nullptr};
+
+    for (auto& bin : bins) {
+        // Local bin indices
+        bin.loc_index.resize(detail::read_varint(is));
+        for (std::size_t i = 0u; i < bin.loc_index.size(); ++i) {
+            const std::int64_t prev{
+                (prev_loc != nullptr and i < prev_loc->size())
+                    ? (*prev_loc)[i]
+                    : 0};
+            bin.loc_index[i] =
+                static_cast<unsigned int>(prev + detail::read_zigzag(is));
+        }
+        prev_loc = &bin.loc_index;
+
+        // Bin content
+        std::uint8_t repeat{0u};
+        from_binary(is, repeat);
+        if (repeat != 0u) {
+            if (prev_content == nullptr) {
+                throw detail::binary_read_error("grid bin content");
+            }
+            bin.content = *prev_content;
+            continue;
+        }
+        if constexpr (std::is_integral_v<content_t>) {
+            bin.content.resize(detail::read_varint(is));
+            std::int64_t prev{0};
+            for (content_t& c : bin.content) {
+                prev += detail::read_zigzag(is);
+                c = static_cast<content_t>(prev);
+            }
+        } else {
+            from_binary(is, bin.content);
+        }
+        prev_content = &bin.content;
+    }
+}
+
+template <typename content_t, typename grid_id_t>
+inline void to_binary(std::ostream& os,
+                      const grid_payload<content_t, grid_id_t>& g) {
+    to_binary(os, g.owner_link);
+    to_binary(os, g.grid_link);
+    to_binary(os, g.axes);
+    to_binary(os, g.bins);
+    to_binary(os, g.transform);
+}
+
+template <typename content_t, typename grid_id_t>
+inline void from_binary(std::istream& is,
+                        grid_payload<content_t, grid_id_t>& g) {
+    from_binary(is, g.owner_link);
+    from_binary(is, g.grid_link);
+    from_binary(is, g.axes);
+    from_binary(is, g.bins);
+    from_binary(is, g.transform);
+}
+
+/// The grids are written as one size-prefixed record per volume, so that
+/// the grids of volumes that are not needed can be skipped when reading
+template <typename content_t, typename grid_id_t>
+inline void to_binary(std::ostream& os,
+                      const detector_grids_payload<content_t, grid_id_t>& d) {
+    to_binary(os, static_cast<std::uint64_t>(d.grids.size()));
+    for (const auto& [vol_idx, grids] : d.grids) {
+        std::ostringstream vol_stream{std::ios_base::out |
+                                      std::ios_base::binary};
+        to_binary(vol_stream, grids);
+        const std::string vol_record{vol_stream.str()};
+
+        to_binary(os, vol_idx);
+        to_binary(os, static_cast<std::uint64_t>(vol_record.size()));
+        os.write(vol_record.data(),
+                 static_cast<std::streamsize>(vol_record.size()));
+    }
+}
+
+/// Read the grids of the volumes for which @param is_selected returns true
+template <typename content_t, typename grid_id_t, typename predicate_t>
+inline void from_binary(std::istream& is,
+                        detector_grids_payload<content_t, grid_id_t>& d,
+                        const predicate_t& is_selected) {
+    d.grids.clear();
+    const std::size_t n_volumes{read_binary_size(is)};
+    for (std::size_t i = 0u; i < n_volumes; ++i) {
+        std::size_t vol_idx{0u};
+        from_binary(is, vol_idx);
+        const std::size_t record_size{read_binary_size(is)};
+
+        if (is_selected(vol_idx)) {
+            from_binary(is, d.grids[vol_idx]);
+        } else if (!is.seekg(static_cast<std::streamoff>(record_size),
+                             std::ios_base::cur)) {
+            throw detail::binary_read_error("grid record");
+        }
+    }
+}
+
+template <typename content_t, typename grid_id_t>
+inline void from_binary(std::istream& is,
+                        detector_grids_payload<content_t, grid_id_t>& d) {
+    from_binary(is, d, [](std::size_t) { return true; });
+}
+/// @}
+
+/// Detector IO
+/// @{
+inline void to_binary(std::ostream& os, const detector_payload& d) {
+    to_binary(os, d.volumes);
+    to_binary(os, d.volume_grid);
+}
+
+inline void from_binary(std::istream& is, detector_payload& d) {
+    from_binary(is, d.volumes);
+    from_binary(is, d.volume_grid);
+}
+/// @}
+
+}  // namespace detray::io
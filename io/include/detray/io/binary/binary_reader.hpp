@@ -0,0 +1,144 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/builders/detector_builder.hpp"
+#include "detray/io/binary/binary_io.hpp"
+#include "detray/io/frontend/reader_interface.hpp"
+#include "detray/io/frontend/utils/file_handle.hpp"
+
+// System include(s)
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ios>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace detray::io {
+
+namespace detail {
+
+/// Read the file preamble and the common part of the header record from
+/// @param is and leave the stream at the beginning of the data record
+inline common_header_payload read_binary_header(std::istream& is) {
+
+    std::array<char, binary_magic.size()> magic{};
+    if (!is.read(magic.data(), magic.size()) or magic != binary_magic) {
+        throw std::invalid_argument("Not a detray binary file");
+    }
+
+    std::uint32_t version{0u};
+    from_binary(is, version);
+    if (version != binary_format_version) {
+        throw std::invalid_argument(
+            "Unsupported detray binary format version " +
+            std::to_string(version) + " (expected " +
+            std::to_string(binary_format_version) + ")");
+    }
+
+    std::uint64_t header_size{0u};
+    from_binary(is, header_size);
+    const std::streampos data_begin{is.tellg() +
+                                    static_cast<std::streamoff>(header_size)};
+
+    // Need only the common part here: skip the sub-header
+    common_header_payload header;
+    from_binary(is, header);
+    is.seekg(data_begin);
+
+    return header;
+}
+
+/// Detects grid collection payloads, which can be read per volume
+/// @{
+template <typename T>
+struct is_grids_payload : public std::false_type {};
+
+template <typename content_t, typename grid_id_t>
+struct is_grids_payload<detector_grids_payload<content_t, grid_id_t>>
+    : public std::true_type {};
+
+template <typename T>
+inline constexpr bool is_grids_payload_v = is_grids_payload<T>::value;
+/// @}
+
+}  // namespace detail
+
+/// @brief Class that adds binary functionality to common reader types.
+///
+/// Assemble the binary readers from the common reader types, which handle the
+/// volume builders, and this class, which provides the payload data of type
+/// @tparam payload_t from the binary stream. Unlike for json, the payload is
+/// deserialized directly, without an intermediate document representation.
+///
+/// @note The resulting reader types will fulfill @c reader_interface through
+/// the common readers they are being extended with
+template <class detector_t, class reader_backend_t, class payload_t>
+class binary_reader final : public reader_interface<detector_t> {
+
+    using io_backend = reader_backend_t;
+
+    public:
+    /// Set binary file extension
+    binary_reader() : reader_interface<detector_t>(".dbin") {}
+
+    /// Reads the detector component from file with a given name
+    virtual void read(detector_builder<typename detector_t::metadata,
+                                       volume_builder>& det_builder,
+                      typename detector_t::name_map& name_map,
+                      const std::string& file_name) override {
+        load(file_name);
+        convert(det_builder, name_map);
+    }
+
+    /// Deserialize the payload from the file with name @param file_name
+    virtual void load(const std::string& file_name) override {
+
+        io::file_handle file{file_name,
+                             std::ios_base::in | std::ios_base::binary};
+
+        // Skip the header
+        detail::read_binary_header(*file);
+
+        // Reads the data from file into the corresponding io payload
+        m_payload = payload_t{};
+        if constexpr (detail::is_grids_payload_v<payload_t>) {
+            from_binary(*file, m_payload, [this](const std::size_t vol_idx) {
+                return this->is_selected(vol_idx);
+            });
+        } else {
+            from_binary(*file, m_payload);
+        }
+    }
+
+    /// Add the loaded payload to the detector builder @param det_builder
+    virtual void convert(detector_builder<typename detector_t::metadata,
+                                          volume_builder>& det_builder,
+                         typename detector_t::name_map& name_map) override {
+
+        // Add the data from the payload to the detray detector builder
+        io_backend::template convert<detector_t>(det_builder, name_map,
+                                                 std::move(m_payload));
+        m_payload = payload_t{};
+    }
+
+    /// @returns whether the backend reads the detector geometry
+    virtual bool is_geometry() const override {
+        return io_backend::tag == "geometry";
+    }
+
+    private:
+    /// The loaded payload
+    payload_t m_payload{};
+};
+
+}  // namespace detray::io
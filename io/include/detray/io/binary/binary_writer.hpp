@@ -0,0 +1,100 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/io/binary/binary_io.hpp"
+#include "detray/io/frontend/utils/file_handle.hpp"
+#include "detray/io/frontend/writer_interface.hpp"
+
+// System include(s)
+#include <cassert>
+#include <cstdint>
+#include <filesystem>
+#include <ios>
+#include <sstream>
+#include <string>
+
+namespace detray::io {
+
+namespace detail {
+
+/// Write the file preamble and the header record @param header to @param os
+///
+/// The header record is prefixed by its size, so that readers can skip the
+/// component specific sub-header after peeking at the common header.
+template <typename header_t>
+inline void write_binary_header(std::ostream& os, const header_t& header) {
+
+    std::ostringstream header_stream{std::ios_base::out |
+                                     std::ios_base::binary};
+    to_binary(header_stream, header);
+    const std::string header_record{header_stream.str()};
+
+    os.write(binary_magic.data(), binary_magic.size());
+    to_binary(os, binary_format_version);
+    to_binary(os, static_cast<std::uint64_t>(header_record.size()));
+    os.write(header_record.data(),
+             static_cast<std::streamsize>(header_record.size()));
+}
+
+}  // namespace detail
+
+/// @brief Class that adds binary functionality to common writer types.
+///
+/// Assemble the binary writers from the common writer types, which serialize
+/// a detector into the io payloads, and this class, which does the file
+/// handling and writes the payloads as flat little-endian records (see
+/// "detray/io/binary/binary_io.hpp").
+///
+/// @note The resulting writer types will fulfill @c writer_interface through
+/// the common writers they are being extended with
+template <class detector_t, class writer_backend_t>
+class binary_writer final : public writer_interface<detector_t> {
+
+    using io_backend = writer_backend_t;
+
+    public:
+    /// File gets created with the binary file extension
+    binary_writer() : writer_interface<detector_t>(".dbin") {}
+
+    /// Writes the detector component to file with a given name
+    virtual std::string write(
+        const detector_t& det, const typename detector_t::name_map& names,
+        const std::ios_base::openmode mode = std::ios::out | std::ios::binary,
+        const std::filesystem::path& file_path = {"./"}) override {
+        // Assert output stream
+        assert(((mode == (std::ios_base::out | std::ios_base::binary)) or
+                (mode == (std::ios_base::out | std::ios_base::trunc |
+                          std::ios_base::binary))) &&
+               "Illegal file mode for binary writer");
+
+        // By convention the name of the detector is the first element
+        std::string det_name = "";
+        if (not names.empty()) {
+            det_name = names.at(0);
+        }
+
+        // Create a new file
+        std::string file_stem{det_name + "_" + io_backend::tag};
+        io::file_handle file{file_path / file_stem, this->m_file_extension,
+                             mode};
+
+        // Write some general information
+        detail::write_binary_header(*file,
+                                    io_backend::write_header(det, det_name));
+
+        // Write the detector data by using the serialization functions
+        // defined in "detray/io/binary/binary_io.hpp"
+        to_binary(*file, io_backend::convert(det, names));
+
+        return file_stem + this->m_file_extension;
+    }
+};
+
+}  // namespace detray::io
@@ -365,6 +365,10 @@ class grid_reader {
             }
 
             vgr_builder->set_type(sf_type);
+            // Irregular surface grid axes are searched with a lookup table
+            if constexpr (detector_t::accel::template is_defined<grid_t>()) {
+                vgr_builder->set_irregular_lookup(true);
+            }
             vgr_builder->init_grid(spans, n_bins_per_axis, capacities,
                                    ax_bin_edges);
             auto &grid = vgr_builder->get();
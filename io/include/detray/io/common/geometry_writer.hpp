@@ -195,9 +195,20 @@ class geometry_writer {
 
             auto id{acc_links_payload::type_id::unknown};
 
-            // Only convert grids
+            // Only convert grids, bounding volume hierarchies, sorted planes,
+            // concentric portals and wire layers (for the latter four, only
+            // the link is written)
             if constexpr (detray::detail::is_grid_v<accel_t>) {
                 id = io::detail::get_id<accel_t>();
+            } else if constexpr (detray::detail::is_bvh_v<accel_t>) {
+                id = io::accel_id::bvh;
+            } else if constexpr (detray::detail::is_sorted_planes_v<accel_t>) {
+                id = io::accel_id::sorted_planes;
+            } else if constexpr (detray::detail::is_concentric_portals_v<
+                                     accel_t>) {
+                id = io::accel_id::concentric_portals;
+            } else if constexpr (detray::detail::is_wire_layers_v<accel_t>) {
+                id = io::accel_id::wire_layers;
             }
 
             return detail::basic_converter::convert(id, index);
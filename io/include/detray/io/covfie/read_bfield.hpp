@@ -1,6 +1,6 @@
 /** Detray library, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -14,13 +14,139 @@
 #include <covfie/core/utility/binary_io.hpp>
 
 // System include(s)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <ios>
 #include <iostream>
+#include <istream>
 #include <stdexcept>
+#include <streambuf>
 #include <string>
+#include <system_error>
 
 namespace detray::io {
 
+namespace detail {
+
+/// @brief Read-only mapping of a complete file into memory
+class mapped_file {
+
+    public:
+    /// Map the file @param file_name
+    explicit mapped_file(const std::string& file_name) {
+
+        const int fd{::open(file_name.c_str(), O_RDONLY)};
+        if (fd < 0) {
+            throw std::system_error(errno, std::generic_category(),
+                                    "Could not open file " + file_name);
+        }
+
+        struct stat info {};
+        if (::fstat(fd, &info) != 0) {
+            const int err{errno};
+            ::close(fd);
+            throw std::system_error(err, std::generic_category(),
+                                    "Could not inspect file " + file_name);
+        }
+        m_size = static_cast<std::size_t>(info.st_size);
+        if (m_size == 0u) {
+            ::close(fd);
+            return;
+        }
+
+        // The mapping stays valid after the file is closed
+        void* addr = ::mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fd, 0);
+        const int err{errno};
+        ::close(fd);
+        if (addr == MAP_FAILED) {
+            throw std::system_error(err, std::generic_category(),
+                                    "Could not map file " + file_name);
+        }
+        m_data = static_cast<char*>(addr);
+
+        // The field data is consumed front to back
+        ::madvise(addr, m_size, MADV_SEQUENTIAL);
+    }
+
+    /// No copies of the mapping
+    /// @{
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+    /// @}
+
+    /// Unmap the file
+    ~mapped_file() {
+        if (m_data != nullptr) {
+            ::munmap(m_data, m_size);
+        }
+    }
+
+    /// @returns the mapped file content
+    const char* data() const { return m_data; }
+
+    /// @returns the file size in bytes
+    std::size_t size() const { return m_size; }
+
+    private:
+    char* m_data{nullptr};
+    std::size_t m_size{0u};
+};
+
+/// @brief Stream buffer that reads directly from a region of memory
+class memory_streambuf final : public std::streambuf {
+
+    public:
+    /// Read from the memory region [@param data, @param data + @param size)
+    memory_streambuf(const char* data, std::size_t size) {
+        // The buffer is never written to
+        char* begin{const_cast<char*>(data)};
+        setg(begin, begin, begin + size);
+    }
+
+    protected:
+    /// Copy @param n characters to @param s, bypassing the per-character
+    /// interface for the bulk reads of the field data
+    std::streamsize xsgetn(char* s, std::streamsize n) override {
+        const std::streamsize n_read{std::min(n, egptr() - gptr())};
+        if (n_read > 0) {
+            std::memcpy(s, gptr(), static_cast<std::size_t>(n_read));
+            gbump(static_cast<int>(n_read));
+        }
+        return n_read;
+    }
+
+    /// Support @c tellg and relative @c seekg
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir,
+                     std::ios_base::openmode which) override {
+        if (!(which & std::ios_base::in)) {
+            return pos_type(off_type(-1));
+        }
+        char* pos{dir == std::ios_base::beg   ? eback() + off
+                  : dir == std::ios_base::cur ? gptr() + off
+                                              : egptr() + off};
+        if (pos < eback() or pos > egptr()) {
+            return pos_type(off_type(-1));
+        }
+        setg(eback(), pos, egptr());
+        return pos_type(pos - eback());
+    }
+
+    /// Support absolute @c seekg
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+};
+
+}  // namespace detail
+
 /// @brief Function that reads the first 4 bytes of a potential bfield file and
 /// checks that it contains data for a covfie field
 inline bool check_covfie_file(const std::string& file_name) {
@@ -49,4 +175,34 @@ inline bfield_t read_bfield(const std::string& file_name) {
     return bfield_t(*file);
 }
 
+/// @brief function that reads a covfie field through a memory mapping of
+/// the file
+///
+/// This is a reader only: The field is deserialized straight from the page
+/// cache, without going through a buffered file stream, and the kernel can
+/// read the file ahead while the field is being constructed. The returned
+/// field does not refer to the mapping. Like for @c read_bfield , the covfie
+/// backend owns its storage and the field values are copied into it once.
+/// The mapping is released before the function returns.
+template <typename bfield_t>
+inline bfield_t read_bfield_via_mmap(const std::string& file_name) {
+
+    const detail::mapped_file file{file_name};
+
+    // Compare to magic bytes
+    std::uint32_t hdr{0u};
+    if (file.size() < sizeof(hdr)) {
+        throw std::runtime_error("Not a valid covfie file: " + file_name);
+    }
+    std::memcpy(&hdr, file.data(), sizeof(hdr));
+    if (hdr != covfie::utility::MAGIC_HEADER) {
+        throw std::runtime_error("Not a valid covfie file: " + file_name);
+    }
+
+    detail::memory_streambuf buffer{file.data(), file.size()};
+    std::istream is{&buffer};
+
+    return bfield_t(is);
+}
+
 }  // namespace detray::io
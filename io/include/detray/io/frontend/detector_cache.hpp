@@ -0,0 +1,200 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/builders/detector_builder.hpp"
+#include "detray/io/binary/binary_io.hpp"
+#include "detray/io/frontend/detector_reader.hpp"
+#include "detray/io/frontend/detector_reader_config.hpp"
+#include "detray/io/frontend/detector_snapshot.hpp"
+#include "detray/io/frontend/shared_detector.hpp"
+#include "detray/io/frontend/utils/file_handle.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/memory_resource.hpp>
+
+// POSIX include(s)
+#include <unistd.h>
+
+// System include(s)
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <ios>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace detray::io {
+
+namespace detail {
+
+/// FNV-1a hash state
+struct fnv1a_hash {
+    std::uint64_t value{0xcbf29ce484222325ull};
+
+    /// Add @param n bytes at @param data to the hash
+    void update(const char* data, std::size_t n) {
+        for (std::size_t i = 0u; i < n; ++i) {
+            value ^= static_cast<std::uint8_t>(data[i]);
+            value *= 0x100000001b3ull;
+        }
+    }
+
+    /// Add the arithmetic value @param v to the hash
+    template <typename T>
+    void update(const T v) {
+        update(reinterpret_cast<const char*>(&v), sizeof(T));
+    }
+};
+
+}  // namespace detail
+
+/// @brief Cache of built detectors, keyed by their inputs.
+///
+/// The key of a cache entry is a hash of the content of the input files (in
+/// the order in which they appear in the reader config), the detector type,
+/// the surface grid template parameters and the reader options that change
+/// the resulting detector. On a hit, the detector is mapped from the
+/// @c detector_snapshot in the cache directory. On a miss, the detector is
+/// read from the input files and a snapshot is added to the cache before it
+/// is mapped. The volume names are stored next to the snapshot.
+///
+/// @note the cache entries are written to a temporary file first and then
+/// renamed, so that concurrent jobs never map an incomplete snapshot.
+///
+/// @tparam detector_t the type of detector to be built
+/// @tparam CAP surface grid bin capacity (see @c read_detector )
+/// @tparam DIM dimension of the surface grids, usually 2D
+/// @tparam volume_builder_t the type of base volume builder to be used
+template <class detector_t, std::size_t CAP = 0u, std::size_t DIM = 2u,
+          template <typename> class volume_builder_t = volume_builder>
+class detector_cache {
+
+    public:
+    using snapshot_type = detector_snapshot<detector_t>;
+    using name_map = typename detector_t::name_map;
+
+    /// Keep the cache entries in the directory @param cache_dir
+    explicit detector_cache(std::string cache_dir)
+        : m_cache_dir{std::move(cache_dir)} {
+        std::filesystem::create_directories(m_cache_dir);
+    }
+
+    /// @returns the cache key for the reader config @param cfg
+    static std::string key(const detector_reader_config& cfg) {
+
+        detail::fnv1a_hash hash{};
+        hash.update(detail::detector_type_hash<detector_t>());
+        hash.update(static_cast<std::uint64_t>(CAP));
+        hash.update(static_cast<std::uint64_t>(DIM));
+
+        // Only the material of these volumes is part of the detector
+        hash.update(static_cast<std::uint64_t>(cfg.material_volumes().size()));
+        for (const std::size_t vol_idx : cfg.material_volumes()) {
+            hash.update(static_cast<std::uint64_t>(vol_idx));
+        }
+
+        std::array<char, 1u << 16u> buffer{};
+        for (const std::string& file_name : cfg.files()) {
+            if (file_name.empty()) {
+                continue;
+            }
+            io::file_handle file{file_name,
+                                 std::ios_base::in | std::ios_base::binary};
+
+            // The file boundaries are part of the key
+            hash.update(static_cast<std::uint64_t>(
+                std::filesystem::file_size(file_name)));
+            while (file->read(buffer.data(),
+                              static_cast<std::streamsize>(buffer.size())) or
+                   file->gcount() > 0) {
+                hash.update(buffer.data(),
+                            static_cast<std::size_t>(file->gcount()));
+            }
+        }
+
+        std::stringstream ss;
+        ss << std::hex << hash.value;
+        return ss.str();
+    }
+
+    /// @returns whether the cache holds a detector for the config @param cfg
+    bool contains(const detector_reader_config& cfg) const {
+        return std::filesystem::exists(snapshot_file(key(cfg)));
+    }
+
+    /// @brief Get the detector for the reader config @param cfg
+    ///
+    /// @param resc the memory resource for the detector, in case it has to be
+    ///             built from the input files
+    ///
+    /// @returns the mapped detector snapshot + the volume names
+    std::pair<snapshot_type, name_map> load(
+        vecmem::memory_resource& resc,
+        const detector_reader_config& cfg) const noexcept(false) {
+
+        const std::string entry{key(cfg)};
+        const std::filesystem::path snap_file{snapshot_file(entry)};
+        const std::filesystem::path names_file{this->names_file(entry)};
+
+        if (!std::filesystem::exists(snap_file) or
+            !std::filesystem::exists(names_file)) {
+
+            auto [det, names] =
+                read_detector<detector_t, CAP, DIM, volume_builder_t>(resc,
+                                                                      cfg);
+
+            // Write to temporary files and move them in place
+            const std::string suffix{".tmp" + std::to_string(::getpid())};
+            const std::string tmp_snap{snap_file.string() + suffix};
+            const std::string tmp_names{names_file.string() + suffix};
+
+            snapshot_type::write(tmp_snap, det);
+            {
+                io::file_handle file{tmp_names, std::ios_base::out |
+                                                    std::ios_base::binary |
+                                                    std::ios_base::trunc};
+                to_binary(*file, names);
+            }
+            std::filesystem::rename(tmp_names, names_file);
+            std::filesystem::rename(tmp_snap, snap_file);
+        } else if (cfg.verbose_check()) {
+            std::cout << "Detector cache hit: " << snap_file << std::endl;
+        }
+
+        name_map names{};
+        {
+            io::file_handle file{names_file.string(),
+                                 std::ios_base::in | std::ios_base::binary};
+            from_binary(*file, names);
+        }
+
+        return {snapshot_type::open(snap_file.string()), std::move(names)};
+    }
+
+    private:
+    /// @returns the path of the snapshot for the cache key @param entry
+    std::filesystem::path snapshot_file(const std::string& entry) const {
+        return m_cache_dir / (entry + ".dsnp");
+    }
+
+    /// @returns the path of the volume names for the cache key @param entry
+    std::filesystem::path names_file(const std::string& entry) const {
+        return m_cache_dir / (entry + "_names.dbin");
+    }
+
+    /// Directory of the cache entries
+    std::filesystem::path m_cache_dir;
+};
+
+}  // namespace detray::io
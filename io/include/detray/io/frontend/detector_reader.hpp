@@ -10,6 +10,7 @@
 // Project include(s)
 #include "detray/builders/detector_builder.hpp"
 #include "detray/io/frontend/detector_reader_config.hpp"
+#include "detray/io/frontend/implementation/binary_readers.hpp"
 #include "detray/io/frontend/implementation/json_readers.hpp"
 #include "detray/io/frontend/utils/detector_components_reader.hpp"
 #include "detray/utils/consistency_checker.hpp"
@@ -20,6 +21,7 @@
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -50,7 +52,11 @@ auto read_detector(vecmem::memory_resource& resc,
 
     // Find all required
     detail::detector_components_reader<detector_t> readers;
-    detail::add_json_readers<CAP, DIM>(readers, cfg.files());
+    detail::add_json_readers<CAP, DIM>(readers, cfg.files(),
+                                       cfg.stream_grids(),
+                                       cfg.material_volumes());
+    detail::add_binary_readers<CAP, DIM>(readers, cfg.files(),
+                                         cfg.material_volumes());
 
     // Make sure that all files will be read
     if (readers.size() != cfg.files().size()) {
@@ -63,14 +69,20 @@ auto read_detector(vecmem::memory_resource& resc,
     }
 
     // Read the data
-    readers.read(det_builder, names);
+    readers.read(det_builder, names, cfg.parallel_read());
 
     // Build and return the detector
     auto det = det_builder.build(resc);
 
     if (cfg.do_check()) {
         // This will throw an exception in case of inconsistencies
-        detray::detail::check_consistency(det, cfg.verbose_check());
+        const auto level{cfg.light_check()
+                             ? detray::detail::check_level::e_light
+                             : detray::detail::check_level::e_full};
+        const unsigned int n_threads{
+            cfg.parallel_read() ? std::thread::hardware_concurrency() : 1u};
+        detray::detail::check_consistency(det, cfg.verbose_check(), level,
+                                          n_threads);
         std::cout << "Detector check: OK" << std::endl;
     }
 
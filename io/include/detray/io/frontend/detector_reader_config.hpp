@@ -9,7 +9,9 @@
 
 // System include(s)
 #include <array>
+#include <cstddef>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace detray::io {
@@ -22,12 +24,27 @@ struct detector_reader_config {
     bool m_do_check{true};
     /// Verbosity of the detector consistency check
     bool m_verbose{false};
+    /// Only run the light consistency check (e.g. at the start of a job)
+    bool m_light_check{false};
+    /// Load the input files concurrently
+    bool m_parallel{true};
+    /// Convert the grid files while parsing them, instead of loading them
+    /// completely first (bounded memory, but no concurrent loading)
+    bool m_stream_grids{false};
+    /// Only load the material maps of these volumes (all, if empty)
+    std::vector<std::size_t> m_material_volumes{};
 
     /// Getters
     /// @{
     const std::vector<std::string>& files() const { return m_files; }
     bool do_check() const { return m_do_check; }
     bool verbose_check() const { return m_verbose; }
+    bool light_check() const { return m_light_check; }
+    bool parallel_read() const { return m_parallel; }
+    bool stream_grids() const { return m_stream_grids; }
+    const std::vector<std::size_t>& material_volumes() const {
+        return m_material_volumes;
+    }
     /// @}
 
     /// Setters
@@ -47,6 +64,25 @@ struct detector_reader_config {
         m_verbose = verbose;
         return *this;
     }
+    detector_reader_config& light_check(const bool light) {
+        if (light && !m_do_check) {
+            m_do_check = true;
+        }
+        m_light_check = light;
+        return *this;
+    }
+    detector_reader_config& parallel_read(const bool parallel) {
+        m_parallel = parallel;
+        return *this;
+    }
+    detector_reader_config& stream_grids(const bool stream) {
+        m_stream_grids = stream;
+        return *this;
+    }
+    detector_reader_config& material_volumes(std::vector<std::size_t> vols) {
+        m_material_volumes = std::move(vols);
+        return *this;
+    }
     /// @}
 };
 
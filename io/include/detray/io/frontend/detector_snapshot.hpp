@@ -0,0 +1,252 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/packed_buffer.hpp"
+#include "detray/io/frontend/shared_detector.hpp"
+
+// POSIX include(s)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// System include(s)
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <ios>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace detray::io {
+
+namespace detail {
+
+/// "DTRYSNP1"
+inline constexpr std::uint64_t snapshot_magic{0x44545259'534e5031ull};
+
+}  // namespace detail
+
+/// @brief Memory mapped snapshot of a fully built detector.
+///
+/// The detector data (all stores, the surface and material grids and the
+/// volume finder) is written to file in the relocatable arena layout of
+/// @c packed_buffer , i.e. in its in-memory representation with offsets
+/// relative to the arena base. Opening the snapshot maps the file read-only
+/// and reconstructs the detector views from the offset table, without any
+/// builder pass or copy: Pages are only loaded from disk when they are
+/// accessed and are shared between all processes that map the same file.
+///
+/// The layout of the file is the same as for a @c shared_detector segment:
+/// header, offset table and the arena. The names and any other host-only
+/// data of the detector are not part of the snapshot.
+///
+/// @note A snapshot can only be opened with the same detector type (checked
+/// on open) and a build with the same container element layouts (not
+/// checked) as the one that wrote it.
+///
+/// @tparam detector_t the host detector type
+template <typename detector_t>
+class detector_snapshot {
+
+    public:
+    using view_type = typename detector_t::view_type;
+    using const_view_type = typename detector_t::const_view_type;
+
+    detector_snapshot() = default;
+
+    /// Not copyable: owns the mapping
+    detector_snapshot(const detector_snapshot&) = delete;
+    detector_snapshot& operator=(const detector_snapshot&) = delete;
+
+    /// Move constructor
+    detector_snapshot(detector_snapshot&& other) noexcept { swap(other); }
+
+    /// Move assignment
+    detector_snapshot& operator=(detector_snapshot&& other) noexcept {
+        if (this != &other) {
+            release();
+            swap(other);
+        }
+        return *this;
+    }
+
+    /// Unmap the file
+    ~detector_snapshot() { release(); }
+
+    /// @brief Write a snapshot of the detector @param det to the file
+    /// @param file_name (an existing file is replaced)
+    ///
+    /// @returns the size of the snapshot in bytes
+    ///
+    /// @throws std::runtime_error if the file cannot be written
+    static std::size_t write(const std::string& file_name,
+                             const detector_t& det) {
+
+        const const_view_type src = det.get_data();
+
+        // Layout of the file: header, offset table, arena
+        std::vector<detray::detail::arena_entry> entries{};
+        std::size_t arena_size{0u};
+        detray::detail::arena_layout(src, entries, arena_size);
+        arena_size = detray::detail::arena_align(arena_size);
+
+        detail::shared_segment_header header{};
+        header.magic = detail::snapshot_magic;
+        header.type_hash = detail::detector_type_hash<detector_t>();
+        header.n_entries = entries.size();
+        header.arena_offset = detray::detail::arena_align(
+            sizeof(detail::shared_segment_header) +
+            entries.size() * sizeof(detray::detail::arena_entry));
+        header.arena_size = arena_size;
+
+        // Stage the complete file content
+        std::vector<std::byte> content(header.arena_offset + arena_size,
+                                       std::byte{0});
+        std::memcpy(content.data(), &header, sizeof(header));
+        std::memcpy(content.data() + sizeof(header), entries.data(),
+                    entries.size() * sizeof(detray::detail::arena_entry));
+        const detray::detail::arena_entry* entry{entries.data()};
+        detray::detail::arena_fill(src, content.data() + header.arena_offset,
+                                   entry);
+
+        std::ofstream file{file_name, std::ios_base::out |
+                                          std::ios_base::binary |
+                                          std::ios_base::trunc};
+        if (!file.is_open()) {
+            throw std::runtime_error("Could not open snapshot file: " +
+                                     file_name);
+        }
+        file.write(reinterpret_cast<const char*>(content.data()),
+                   static_cast<std::streamsize>(content.size()));
+        if (!file) {
+            throw std::runtime_error("Could not write snapshot file: " +
+                                     file_name);
+        }
+
+        return content.size();
+    }
+
+    /// @brief Map the snapshot file @param file_name read-only
+    ///
+    /// @throws std::runtime_error if the file does not exist or does not
+    /// contain a detector of type @tparam detector_t
+    static detector_snapshot open(const std::string& file_name) {
+
+        detector_snapshot snap{};
+
+        const int fd{::open(file_name.c_str(), O_RDONLY)};
+        if (fd < 0) {
+            detail::throw_system_error("Could not open snapshot file " +
+                                       file_name);
+        }
+
+        struct stat info {};
+        if (::fstat(fd, &info) != 0) {
+            ::close(fd);
+            detail::throw_system_error("Could not inspect snapshot file " +
+                                       file_name);
+        }
+        snap.m_size = static_cast<std::size_t>(info.st_size);
+        if (snap.m_size < sizeof(detail::shared_segment_header)) {
+            ::close(fd);
+            throw std::runtime_error("Not a detector snapshot: " + file_name);
+        }
+
+        // The mapping stays valid after the file is closed
+        void* addr = ::mmap(nullptr, snap.m_size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (addr == MAP_FAILED) {
+            detail::throw_system_error("Could not map snapshot file " +
+                                       file_name);
+        }
+        snap.m_base = static_cast<std::byte*>(addr);
+
+        detail::shared_segment_header header{};
+        std::memcpy(&header, snap.m_base, sizeof(header));
+        if (header.magic != detail::snapshot_magic) {
+            throw std::runtime_error("Not a detector snapshot: " + file_name);
+        }
+        if (header.type_hash != detail::detector_type_hash<detector_t>()) {
+            throw std::runtime_error("Detector type mismatch in snapshot: " +
+                                     file_name);
+        }
+        if (header.arena_offset + header.arena_size > snap.m_size) {
+            throw std::runtime_error("Truncated detector snapshot: " +
+                                     file_name);
+        }
+
+        snap.m_arena = snap.m_base + header.arena_offset;
+        snap.m_offsets.resize(static_cast<std::size_t>(header.n_entries));
+        std::memcpy(snap.m_offsets.data(), snap.m_base + sizeof(header),
+                    snap.m_offsets.size() *
+                        sizeof(detray::detail::arena_entry));
+
+        return snap;
+    }
+
+    /// @returns the size of the mapping in bytes
+    std::size_t size() const { return m_size; }
+
+    /// @returns a read-only view of the detector in the snapshot
+    const_view_type get_data() const {
+        return assemble<const_view_type>();
+    }
+
+    /// @returns a view of the detector in the snapshot, which can be used to
+    /// construct a detector with device container types.
+    /// @note the file is mapped read-only: The detector must not be modified
+    /// through this view
+    view_type get_view() const { return assemble<view_type>(); }
+
+    private:
+    /// @returns a view of type @tparam v_t onto the arena
+    template <typename v_t>
+    v_t assemble() const {
+        v_t v{};
+        const detray::detail::arena_entry* entry{m_offsets.data()};
+        // The views are only constructed, the data is never written
+        detray::detail::arena_assemble(v, const_cast<std::byte*>(m_arena),
+                                       entry);
+        return v;
+    }
+
+    /// Unmap the file
+    void release() noexcept {
+        if (m_base != nullptr) {
+            ::munmap(m_base, m_size);
+        }
+        m_base = nullptr;
+        m_arena = nullptr;
+        m_size = 0u;
+    }
+
+    /// Swap the state with @param other
+    void swap(detector_snapshot& other) noexcept {
+        std::swap(m_size, other.m_size);
+        std::swap(m_base, other.m_base);
+        std::swap(m_arena, other.m_arena);
+        std::swap(m_offsets, other.m_offsets);
+    }
+
+    /// Size of the mapping in bytes
+    std::size_t m_size{0u};
+    /// Beginning of the mapping
+    std::byte* m_base{nullptr};
+    /// Beginning of the arena in the mapping
+    const std::byte* m_arena{nullptr};
+    /// Offset table of the packed containers
+    std::vector<detray::detail::arena_entry> m_offsets{};
+};
+
+}  // namespace detray::io
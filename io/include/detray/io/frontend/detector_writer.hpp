@@ -9,6 +9,7 @@
 
 // Project include(s)
 #include "detray/io/frontend/detector_writer_config.hpp"
+#include "detray/io/frontend/implementation/binary_writers.hpp"
 #include "detray/io/frontend/implementation/json_writers.hpp"
 #include "detray/io/frontend/utils/create_path.hpp"
 #include "detray/io/frontend/utils/detector_components_writer.hpp"
@@ -44,9 +45,11 @@ void write_detector(detector_t& det, const typename detector_t::name_map& names,
     io::detail::detector_components_writer<detector_t> writer{};
     if (cfg.format() == io::format::json) {
         detail::add_json_writers(writer, cfg);
+    } else if (cfg.format() == io::format::binary) {
+        detail::add_binary_writers(writer, cfg);
     }
 
-    if (cfg.compactify_json()) {
+    if (cfg.format() == io::format::json and cfg.compactify_json()) {
         std::cout << "WARNING: Compactifying json files is not yet implemented"
                   << std::endl;
     }
@@ -11,6 +11,7 @@
 #include "detray/io/frontend/definitions.hpp"
 
 // System include(s)
+#include <cstddef>
 #include <string>
 
 namespace detray::io {
@@ -29,6 +30,9 @@ struct detector_writer_config {
     bool m_write_material = true;
     /// Whether to write the accelerator grids to file
     bool m_write_grids = true;
+    /// Split the json files into this many per-volume shards, which are
+    /// written concurrently (no sharding, if zero)
+    std::size_t m_n_shards = 0u;
 
     /// Getters
     /// @{
@@ -38,6 +42,7 @@ struct detector_writer_config {
     bool compactify_json() const { return m_compact_io; }
     bool write_material() const { return m_write_material; }
     bool write_grids() const { return m_write_grids; }
+    std::size_t n_shards() const { return m_n_shards; }
     /// @}
 
     /// Setters
@@ -66,6 +71,10 @@ struct detector_writer_config {
         m_write_grids = flag;
         return *this;
     }
+    detector_writer_config& n_shards(std::size_t n) {
+        m_n_shards = n;
+        return *this;
+    }
     /// @}
 };
 
@@ -0,0 +1,138 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/io/binary/binary_reader.hpp"
+#include "detray/io/common/geometry_reader.hpp"
+#include "detray/io/common/homogeneous_material_reader.hpp"
+#include "detray/io/common/material_map_reader.hpp"
+#include "detray/io/common/surface_grid_reader.hpp"
+#include "detray/io/frontend/payloads.hpp"
+#include "detray/io/frontend/utils/detector_components_reader.hpp"
+#include "detray/io/frontend/utils/io_metadata.hpp"
+#include "detray/io/frontend/utils/type_traits.hpp"
+
+// System include(s)
+#include <filesystem>
+#include <ios>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace detray::io::detail {
+
+/// @brief Function that reads the common header part of a file in binary
+/// format
+inline common_header_payload deserialize_binary_header(
+    const std::string& file_name) {
+
+    io::file_handle file{file_name, std::ios_base::in | std::ios_base::binary};
+
+    const common_header_payload header = read_binary_header(*file);
+
+    if (header.version < io::detail::minimal_io_version) {
+        std::cout
+            << "WARNING: File was generated with a different detray version"
+            << std::endl;
+    }
+
+    return header;
+}
+
+/// From the list of files that are given @param files, infer the readers that
+/// are needed by peeking into the file headers
+///
+/// @tparam CAP surface grid bin capacity (@TODO make runtime)
+/// @tparam DIM dimension of the surface grids, usually 2D
+/// @tparam detector_t type of the detector instance: Must match the data that
+///                    is read from file!
+///
+/// @param material_volumes only read the material maps of these volumes
+template <std::size_t CAP, std::size_t DIM, class detector_t>
+inline void add_binary_readers(
+    io::detail::detector_components_reader<detector_t>& reader,
+    const std::vector<std::string>& files,
+    const std::vector<std::size_t>& material_volumes = {}) noexcept(false) {
+
+    for (const std::string& file_name : files) {
+
+        // Empty file names are reported by the json readers
+        if (file_name.empty()) {
+            continue;
+        }
+
+        std::string extension{std::filesystem::path{file_name}.extension()};
+
+        // Only add readers for binary files
+        if (extension != ".dbin") {
+            continue;
+        }
+
+        // Peek at the header to determine the kind of reader that is needed
+        auto header = deserialize_binary_header(file_name);
+
+        if (header.tag == "geometry") {
+            reader.set_detector_name(header.detector);
+
+            using binary_geometry_reader =
+                binary_reader<detector_t, geometry_reader, detector_payload>;
+
+            reader.template add<binary_geometry_reader>(file_name);
+
+        } else if (header.tag == "homogeneous_material") {
+            if constexpr (detray::detail::has_homogeneous_material_v<
+                              detector_t>) {
+                using binary_hom_material_reader =
+                    binary_reader<detector_t, homogeneous_material_reader,
+                                  detector_homogeneous_material_payload>;
+
+                reader.template add<binary_hom_material_reader>(file_name);
+            } else {
+                print_type_warning<detector_t>(header.tag);
+            }
+        } else if (header.tag == "material_maps") {
+            if constexpr (detray::detail::has_material_grids_v<detector_t>) {
+                using binary_material_map_reader = binary_reader<
+                    detector_t,
+                    material_map_reader<
+                        std::integral_constant<std::size_t, DIM>>,
+                    detector_grids_payload<material_slab_payload,
+                                           io::material_id>>;
+
+                auto mat_reader =
+                    std::make_unique<binary_material_map_reader>();
+                mat_reader->select_volumes(material_volumes);
+                reader.add(std::move(mat_reader), file_name);
+            } else {
+                print_type_warning<detector_t>(header.tag);
+            }
+        } else if (header.tag == "surface_grids") {
+            if constexpr (detray::detail::has_surface_grids_v<detector_t>) {
+                using binary_surface_grid_reader = binary_reader<
+                    detector_t,
+                    surface_grid_reader<
+                        typename detector_t::surface_type,
+                        std::integral_constant<std::size_t, CAP>,
+                        std::integral_constant<std::size_t, DIM>>,
+                    detector_grids_payload<std::size_t, io::accel_id>>;
+
+                reader.template add<binary_surface_grid_reader>(file_name);
+            } else {
+                print_type_warning<detector_t>(header.tag);
+            }
+        } else {
+            throw std::invalid_argument("Unsupported file tag '" + header.tag +
+                                        "' in input file: " + file_name);
+        }
+    }
+}
+
+}  // namespace detray::io::detail
@@ -0,0 +1,67 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/io/binary/binary_writer.hpp"
+#include "detray/io/common/geometry_writer.hpp"
+#include "detray/io/common/homogeneous_material_writer.hpp"
+#include "detray/io/common/material_map_writer.hpp"
+#include "detray/io/common/surface_grid_writer.hpp"
+#include "detray/io/frontend/detector_writer_config.hpp"
+#include "detray/io/frontend/utils/detector_components_writer.hpp"
+#include "detray/io/frontend/utils/type_traits.hpp"
+
+namespace detray::io {
+
+struct detector_writer_config;
+
+namespace detail {
+
+/// Infer the binary writers that are needed from the detector type
+/// @tparam detector_t
+template <class detector_t>
+void add_binary_writers(detector_components_writer<detector_t>& writers,
+                        const detray::io::detector_writer_config& cfg) {
+
+    // Always needed
+    using binary_geometry_writer = binary_writer<detector_t, geometry_writer>;
+
+    writers.template add<binary_geometry_writer>();
+
+    // Find other writers, depending on the detector type
+    if (cfg.write_material()) {
+        // Simple material
+        if constexpr (detray::detail::has_homogeneous_material_v<detector_t>) {
+            using binary_homogeneous_material_writer =
+                binary_writer<detector_t, homogeneous_material_writer>;
+
+            writers.template add<binary_homogeneous_material_writer>();
+        }
+        // Material maps
+        if constexpr (detray::detail::has_material_grids_v<detector_t>) {
+            using binary_material_map_writer =
+                binary_writer<detector_t, material_map_writer>;
+
+            writers.template add<binary_material_map_writer>();
+        }
+    }
+    // Navigation acceleration structures
+    if constexpr (detray::detail::has_surface_grids_v<detector_t>) {
+        using binary_surface_grid_writer =
+            binary_writer<detector_t, surface_grid_writer>;
+
+        if (cfg.write_grids()) {
+            writers.template add<binary_surface_grid_writer>();
+        }
+    }
+}
+
+}  // namespace detail
+
+}  // namespace detray::io
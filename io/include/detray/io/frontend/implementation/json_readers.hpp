@@ -17,12 +17,15 @@
 #include "detray/io/frontend/utils/io_metadata.hpp"
 #include "detray/io/frontend/utils/type_traits.hpp"
 #include "detray/io/json/json_reader.hpp"
+#include "detray/io/json/json_stream_reader.hpp"
 
 // System include(s)
 #include <filesystem>
 #include <ios>
+#include <memory>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace detray::io::detail {
@@ -31,10 +34,14 @@ namespace detray::io::detail {
 inline common_header_payload deserialize_json_header(
     const std::string& file_name) {
 
-    // Read json file
+    // Read json file, but skip the detector data
     io::file_handle file{file_name, std::ios_base::in | std::ios_base::binary};
-    nlohmann::json in_json;
-    *file >> in_json;
+    auto skip_data = [](int depth, nlohmann::json::parse_event_t event,
+                        nlohmann::json& parsed) {
+        return not(event == nlohmann::json::parse_event_t::key and
+                   depth == 1 and parsed == "data");
+    };
+    nlohmann::json in_json = nlohmann::json::parse(*file, skip_data);
 
     // Reads the header from file
     header_payload<> h = in_json["header"];
@@ -58,10 +65,15 @@ inline common_header_payload deserialize_json_header(
 /// @tparam DIM dimension of the surface grids, usually 2D
 /// @tparam detector_t type of the detector instance: Must match the data that
 ///                    is read from file!
+///
+/// @param stream_grids convert the material maps and surface grids while
+///                     their files are being parsed (see @c json_stream_reader)
+/// @param material_volumes only read the material maps of these volumes
 template <std::size_t CAP, std::size_t DIM, class detector_t>
 inline void add_json_readers(
     io::detail::detector_components_reader<detector_t>& reader,
-    const std::vector<std::string>& files) noexcept(false) {
+    const std::vector<std::string>& files, const bool stream_grids = false,
+    const std::vector<std::size_t>& material_volumes = {}) noexcept(false) {
 
     for (const std::string& file_name : files) {
 
@@ -101,25 +113,45 @@ inline void add_json_readers(
             }
         } else if (header.tag == "material_maps") {
             if constexpr (detray::detail::has_material_grids_v<detector_t>) {
+                using material_map_reader_t = material_map_reader<
+                    std::integral_constant<std::size_t, DIM>>;
                 using json_material_map_reader =
-                    json_reader<detector_t,
-                                material_map_reader<
-                                    std::integral_constant<std::size_t, DIM>>>;
-
-                reader.template add<json_material_map_reader>(file_name);
+                    json_reader<detector_t, material_map_reader_t>;
+                using json_material_map_stream_reader = json_stream_reader<
+                    detector_t, material_map_reader_t,
+                    detector_grids_payload<material_slab_payload,
+                                           io::material_id>>;
+
+                std::unique_ptr<reader_interface<detector_t>> mat_reader;
+                if (stream_grids) {
+                    mat_reader =
+                        std::make_unique<json_material_map_stream_reader>();
+                } else {
+                    mat_reader = std::make_unique<json_material_map_reader>();
+                }
+                mat_reader->select_volumes(material_volumes);
+                reader.add(std::move(mat_reader), file_name);
             } else {
                 print_type_warning<detector_t>(header.tag);
             }
         } else if (header.tag == "surface_grids") {
             if constexpr (detray::detail::has_surface_grids_v<detector_t>) {
+                using surface_grid_reader_t = surface_grid_reader<
+                    typename detector_t::surface_type,
+                    std::integral_constant<std::size_t, CAP>,
+                    std::integral_constant<std::size_t, DIM>>;
                 using json_surface_grid_reader =
-                    json_reader<detector_t,
-                                surface_grid_reader<
-                                    typename detector_t::surface_type,
-                                    std::integral_constant<std::size_t, CAP>,
-                                    std::integral_constant<std::size_t, DIM>>>;
-
-                reader.template add<json_surface_grid_reader>(file_name);
+                    json_reader<detector_t, surface_grid_reader_t>;
+                using json_surface_grid_stream_reader = json_stream_reader<
+                    detector_t, surface_grid_reader_t,
+                    detector_grids_payload<std::size_t, io::accel_id>>;
+
+                if (stream_grids) {
+                    reader.template add<json_surface_grid_stream_reader>(
+                        file_name);
+                } else {
+                    reader.template add<json_surface_grid_reader>(file_name);
+                }
             } else {
                 print_type_warning<detector_t>(header.tag);
             }
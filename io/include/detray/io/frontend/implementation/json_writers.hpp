@@ -17,6 +17,9 @@
 #include "detray/io/frontend/utils/type_traits.hpp"
 #include "detray/io/json/json_writer.hpp"
 
+// System include(s)
+#include <memory>
+
 namespace detray::io {
 
 struct detector_writer_config;
@@ -31,7 +34,7 @@ void add_json_writers(detector_components_writer<detector_t>& writers,
     // Always needed
     using json_geometry_writer = json_writer<detector_t, geometry_writer>;
 
-    writers.template add<json_geometry_writer>();
+    writers.add(std::make_unique<json_geometry_writer>(cfg.n_shards()));
 
     // Find other writers, depending on the detector type
     if (cfg.write_material()) {
@@ -40,14 +43,16 @@ void add_json_writers(detector_components_writer<detector_t>& writers,
             using json_homogeneous_material_writer =
                 json_writer<detector_t, homogeneous_material_writer>;
 
-            writers.template add<json_homogeneous_material_writer>();
+            writers.add(std::make_unique<json_homogeneous_material_writer>(
+                cfg.n_shards()));
         }
         // Material maps
         if constexpr (detray::detail::has_material_grids_v<detector_t>) {
             using json_material_map_writer =
                 json_writer<detector_t, material_map_writer>;
 
-            writers.template add<json_material_map_writer>();
+            writers.add(
+                std::make_unique<json_material_map_writer>(cfg.n_shards()));
         }
     }
     // Navigation acceleration structures
@@ -56,7 +61,8 @@ void add_json_writers(detector_components_writer<detector_t>& writers,
             json_writer<detector_t, surface_grid_writer>;
 
         if (cfg.write_grids()) {
-            writers.template add<json_surface_grid_writer>();
+            writers.add(
+                std::make_unique<json_surface_grid_writer>(cfg.n_shards()));
         }
     }
 }
@@ -0,0 +1,456 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/multi_store.hpp"
+#include "detray/io/common/detail/type_info.hpp"
+#include "detray/io/frontend/definitions.hpp"
+#include "detray/utils/type_list.hpp"
+#include "detray/utils/type_traits.hpp"
+
+// System include(s)
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <ios>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace detray::io {
+
+/// @brief Usage of a type that is registered in a detector data store
+struct type_usage {
+    /// Position of the collection in the data store
+    std::size_t position{0u};
+    /// Demangled name of the collection value type
+    std::string type_name{};
+    /// Conventional type id names (the first is the canonical one)
+    std::vector<std::string> id_names{};
+    /// Number of references to the collection from the geometry
+    std::size_t n_references{0u};
+
+    /// @returns whether the detector geometry refers to the type
+    bool is_used() const { return n_references > 0u; }
+};
+
+/// @brief Which of the registered mask, material and acceleration structure
+/// types a detector actually uses
+struct detector_type_usage {
+    std::vector<type_usage> masks{};
+    std::vector<type_usage> materials{};
+    std::vector<type_usage> accelerators{};
+
+    /// @returns the number of used types in @param usage
+    static std::size_t n_used(const std::vector<type_usage>& usage) {
+        return static_cast<std::size_t>(
+            std::count_if(usage.begin(), usage.end(),
+                          [](const type_usage& u) { return u.is_used(); }));
+    }
+};
+
+namespace detail {
+
+/// Unwrap the collection types of a data store
+/// @{
+template <typename store_t>
+struct store_collections {};
+
+template <typename ID, typename context_t, template <typename...> class tuple_t,
+          typename... Ts>
+struct store_collections<multi_store<ID, context_t, tuple_t, Ts...>> {
+    using type = types::list<Ts...>;
+};
+/// @}
+
+/// @returns the conventional enumerator names for the IO shape @param id
+inline std::vector<std::string> shape_id_names(const shape_id id) {
+    switch (id) {
+        case shape_id::annulus2:
+            return {"e_annulus2"};
+        case shape_id::cuboid3:
+            return {"e_cuboid3"};
+        case shape_id::cylinder2:
+            return {"e_cylinder2"};
+        case shape_id::cylinder3:
+            return {"e_cylinder3", "e_portal_cylinder3"};
+        case shape_id::portal_cylinder2:
+            return {"e_portal_cylinder2"};
+        case shape_id::rectangle2:
+            return {"e_rectangle2", "e_portal_rectangle2"};
+        case shape_id::ring2:
+            return {"e_ring2", "e_portal_ring2"};
+        case shape_id::trapezoid2:
+            return {"e_trapezoid2"};
+        case shape_id::drift_cell:
+            return {"e_drift_cell"};
+        case shape_id::straw_tube:
+            return {"e_straw_tube"};
+        case shape_id::single1:
+            return {"e_single1"};
+        case shape_id::single2:
+            return {"e_single2"};
+        case shape_id::single3:
+            return {"e_single3"};
+        default:
+            return {};
+    }
+}
+
+/// Check whether a mask shape can be mapped to an IO shape id
+/// @{
+template <typename shape_t, typename = void>
+struct has_io_shape_id : public std::false_type {};
+
+template <typename shape_t>
+struct has_io_shape_id<
+    shape_t, std::enable_if_t<std::is_enum_v<typename shape_t::boundaries>,
+                              void>> : public std::true_type {};
+/// @}
+
+/// @returns the conventional enumerator names for a mask type
+template <typename mask_t>
+std::vector<std::string> mask_id_names() {
+    using shape_t = typename mask_t::shape;
+
+    if constexpr (!has_io_shape_id<shape_t>::value) {
+        return {};
+    } else {
+        return shape_id_names(io::detail::get_id<shape_t>());
+    }
+}
+
+/// @returns the conventional enumerator names for a material type
+template <typename material_t>
+std::vector<std::string> material_id_names() {
+    if constexpr (detray::detail::is_hom_material_v<material_t> ||
+                  detray::detail::is_material_map_v<material_t> ||
+                  detray::detail::is_volume_material_v<material_t>) {
+        switch (io::detail::get_id<material_t>()) {
+            case material_id::annulus2_map:
+                return {"e_disc2_map", "e_annulus2_map"};
+            case material_id::rectangle2_map:
+                return {"e_rectangle2_map", "e_trapezoid2_map"};
+            case material_id::cuboid3_map:
+                return {"e_cuboid3_map"};
+            case material_id::concentric_cylinder2_map:
+                return {"e_concentric_cylinder2_map"};
+            case material_id::cylinder2_map:
+                return {"e_cylinder2_map"};
+            case material_id::cylinder3_map:
+                return {"e_cylinder3_map"};
+            case material_id::slab:
+                return {"e_slab"};
+            case material_id::rod:
+                return {"e_rod"};
+            case material_id::raw_material:
+                return {"e_raw_material"};
+            default:
+                return {};
+        }
+    } else {
+        return {};
+    }
+}
+
+/// @returns the conventional enumerator names for an acceleration structure
+template <typename collection_t>
+std::vector<std::string> accel_id_names() {
+    using value_t = detray::detail::get_value_t<collection_t>;
+
+    if constexpr (detray::detail::is_brute_force_v<collection_t>) {
+        return {"e_brute_force"};
+    } else if constexpr (detray::detail::is_bvh_v<collection_t>) {
+        return {"e_bvh"};
+    } else if constexpr (detray::detail::is_sorted_planes_v<collection_t>) {
+        return {"e_sorted_planes"};
+    } else if constexpr (detray::detail::is_concentric_portals_v<
+                             collection_t>) {
+        return {"e_concentric_portals"};
+    } else if constexpr (detray::detail::is_wire_layers_v<collection_t>) {
+        return {"e_wire_layers"};
+    } else if constexpr (detray::detail::is_surface_grid_v<value_t>) {
+        switch (io::detail::get_id<value_t>()) {
+            case accel_id::cartesian2_grid:
+                return {"e_rectangle2_grid"};
+            case accel_id::cuboid3_grid:
+                return {"e_cuboid3_grid"};
+            case accel_id::polar2_grid:
+                return {"e_disc_grid"};
+            case accel_id::concentric_cylinder2_grid:
+                return {"e_cylinder2_grid"};
+            case accel_id::cylinder2_grid:
+                return {"e_cylinder2_grid"};
+            case accel_id::cylinder3_grid:
+                return {"e_cylinder3_grid"};
+            default:
+                return {};
+        }
+    } else {
+        return {};
+    }
+}
+
+/// Fill the usage entries of the types in a data store
+/// @{
+template <typename value_t>
+struct mask_id_namer {
+    auto operator()() const {
+        return mask_id_names<detray::detail::get_value_t<value_t>>();
+    }
+};
+
+template <typename value_t>
+struct material_id_namer {
+    auto operator()() const {
+        return material_id_names<detray::detail::get_value_t<value_t>>();
+    }
+};
+
+template <typename value_t>
+struct accel_id_namer {
+    auto operator()() const { return accel_id_names<value_t>(); }
+};
+
+template <template <typename> class namer_t, typename... Ts>
+std::vector<type_usage> init_usage(types::list<Ts...> /*collections*/) {
+    std::vector<type_usage> usage{};
+    usage.reserve(sizeof...(Ts));
+
+    (usage.push_back(
+         {usage.size(),
+          types::demangle_type_name<detray::detail::get_value_t<Ts>>(),
+          namer_t<Ts>{}(), 0u}),
+     ...);
+
+    return usage;
+}
+/// @}
+
+/// Count a reference to the type with @param id in @param usage
+template <typename id_t>
+void add_reference(std::vector<type_usage>& usage, const id_t id) {
+    const auto pos{static_cast<std::size_t>(id)};
+    // Invalid ids, e.g. surfaces without material, are skipped
+    if (pos < usage.size()) {
+        ++usage[pos].n_references;
+    }
+}
+
+/// Assign unique enumerator names to the used types
+inline std::vector<std::vector<std::string>> unique_id_names(
+    const std::vector<type_usage>& usage, const std::string& fallback) {
+
+    std::vector<std::string> taken{};
+    std::vector<std::vector<std::string>> names{};
+
+    for (const type_usage& u : usage) {
+        if (!u.is_used()) {
+            continue;
+        }
+        std::vector<std::string> type_names{};
+        for (const std::string& name : u.id_names) {
+            if (std::find(taken.begin(), taken.end(), name) == taken.end()) {
+                type_names.push_back(name);
+            }
+        }
+        // Unknown type or the conventional name is used by another type
+        if (type_names.empty()) {
+            const std::string base{u.id_names.empty() ? fallback
+                                                      : u.id_names.front()};
+            type_names.push_back(base + "_" + std::to_string(u.position));
+        }
+        taken.insert(taken.end(), type_names.begin(), type_names.end());
+        names.push_back(std::move(type_names));
+    }
+
+    return names;
+}
+
+/// Write the enum and the filtered store definition for one data store
+inline void write_store(std::ostream& out, const std::vector<type_usage>& usage,
+                        const std::string& fallback,
+                        const std::string& id_enum,
+                        const std::string& store_name,
+                        const std::string& store_tparams,
+                        const std::string& original_store,
+                        const std::vector<std::string>& extra_ids) {
+
+    const auto names = unique_id_names(usage, fallback);
+
+    out << "    enum class " << id_enum << " : std::uint8_t {\n";
+    for (std::size_t i = 0u; i < names.size(); ++i) {
+        for (const std::string& name : names[i]) {
+            out << "        " << name << " = " << i << "u,\n";
+        }
+    }
+    for (const std::string& extra : extra_ids) {
+        out << "        " << extra << ",\n";
+    }
+    out << "    };\n\n";
+
+    out << "    template <" << store_tparams << ">\n";
+    out << "    using " << store_name << " = detray::detail::filter_store_t<\n";
+    out << "        " << original_store << ",\n";
+    out << "        " << id_enum;
+    for (const type_usage& u : usage) {
+        if (u.is_used()) {
+            out << ", " << u.position << "u";
+        }
+    }
+    out << ">;\n\n";
+}
+
+}  // namespace detail
+
+/// @brief Inspect which registered types the detector @param det refers to
+///
+/// The masks and materials are counted by the links of the surfaces, the
+/// acceleration structures by the links of the volumes.
+template <typename detector_t>
+detector_type_usage get_type_usage(const detector_t& det) {
+
+    using mask_collections_t = typename detail::store_collections<
+        typename detector_t::mask_container>::type;
+    using material_collections_t = typename detail::store_collections<
+        typename detector_t::material_container>::type;
+    using accel_collections_t = typename detail::store_collections<
+        typename detector_t::accelerator_container>::type;
+
+    detector_type_usage usage{};
+    usage.masks =
+        detail::init_usage<detail::mask_id_namer>(mask_collections_t{});
+    usage.materials = detail::init_usage<detail::material_id_namer>(
+        material_collections_t{});
+    usage.accelerators =
+        detail::init_usage<detail::accel_id_namer>(accel_collections_t{});
+
+    for (const auto& sf_desc : det.surfaces()) {
+        detail::add_reference(usage.masks, sf_desc.mask().id());
+        if (!sf_desc.material().is_invalid()) {
+            detail::add_reference(usage.materials, sf_desc.material().id());
+        }
+    }
+
+    for (const auto& vol_desc : det.volumes()) {
+        const auto& links = vol_desc.accel_link();
+        for (std::size_t i = 0u; i < links.size(); ++i) {
+            if (!links[i].is_invalid()) {
+                detail::add_reference(usage.accelerators, links[i].id());
+            }
+        }
+    }
+
+    return usage;
+}
+
+/// @brief Write a reduced detector metadata for the detector @param det
+///
+/// The generated metadata derives from the metadata of @param det and only
+/// registers the mask, material and acceleration structure types that the
+/// detector actually uses. Its data stores are filtered from the stores of
+/// the original metadata, so the element types stay identical. The type ids
+/// keep the conventional enumerator names of the detray metadata, so that the
+/// builders and the detector IO work with the reduced detector as well. A
+/// detector can be re-materialized in the new metadata by writing it to file
+/// and reading it back with @c io::read_detector .
+///
+/// @param det the detector to be inspected
+/// @param metadata_name name of the generated metadata struct
+/// @param out output stream for the C++ header
+/// @param metadata_header include path of the original metadata
+template <typename detector_t>
+void write_minimal_metadata(
+    const detector_t& det, const std::string& metadata_name,
+    std::ostream& out,
+    const std::string& metadata_header = "detray/core/detector_metadata.hpp") {
+
+    const detector_type_usage usage = get_type_usage(det);
+
+    const std::string base{
+        types::demangle_type_name<typename detector_t::metadata>()};
+
+    // The brute force search is also the default acceleration structure
+    std::string default_accel{"0u"};
+    for (const type_usage& u : usage.accelerators) {
+        if (u.is_used() && !u.id_names.empty() &&
+            u.id_names.front() == "e_brute_force") {
+            default_accel = "e_brute_force";
+        }
+    }
+
+    out << "// Generated by detray::io::write_minimal_metadata\n\n";
+    out << "#pragma once\n\n";
+    out << "#include \"detray/core/detail/filtered_store.hpp\"\n";
+    out << "#include \"" << metadata_header << "\"\n\n";
+    out << "#include <cstdint>\n\n";
+    out << "namespace detray {\n\n";
+    out << "/// Reduced metadata: only the types used by the detector\n";
+    out << "struct " << metadata_name << " : public " << base << " {\n\n";
+    out << "    using base_metadata = " << base << ";\n\n";
+
+    detail::write_store(
+        out, usage.masks, "e_mask", "mask_ids", "mask_store",
+        "template <typename...> class tuple_t = dtuple,\n"
+        "              template <typename...> class vector_t = dvector",
+        "typename base_metadata::template mask_store<tuple_t, vector_t>", {});
+
+    detail::write_store(
+        out, usage.materials, "e_material", "material_ids", "material_store",
+        "template <typename...> class tuple_t = dtuple,\n"
+        "              typename container_t = host_container_types",
+        "typename base_metadata::template material_store<tuple_t, "
+        "container_t>",
+        {"e_none = " +
+         std::to_string(detector_type_usage::n_used(usage.materials)) + "u"});
+
+    out << "    using mask_link = typename mask_store<>::single_link;\n";
+    out << "    using material_link = typename material_store<>::single_link;"
+           "\n";
+    out << "    using surface_type =\n"
+           "        surface_descriptor<mask_link, material_link,\n"
+           "                           typename base_metadata::transform_link,"
+           "\n"
+           "                           typename base_metadata::surface_type::"
+           "navigation_link>;\n\n";
+
+    detail::write_store(
+        out, usage.accelerators, "e_accel", "accel_ids", "accelerator_store",
+        "template <typename...> class tuple_t = dtuple,\n"
+        "              typename container_t = host_container_types",
+        "detray::detail::rebind_value_t<\n"
+        "            typename base_metadata::template accelerator_store<\n"
+        "                tuple_t, container_t>,\n"
+        "            typename base_metadata::surface_type, surface_type>",
+        {"e_default = " + default_accel});
+
+    out << "    using object_link_type =\n"
+           "        dmulti_index<dtyped_index<accel_ids, dindex>,\n"
+           "                     base_metadata::geo_objects::e_size>;\n";
+    out << "};\n\n";
+    out << "}  // namespace detray\n";
+}
+
+/// @brief Write a reduced detector metadata for the detector @param det to
+/// the header file @param file_name
+template <typename detector_t>
+void write_minimal_metadata(
+    const detector_t& det, const std::string& metadata_name,
+    const std::string& file_name,
+    const std::string& metadata_header = "detray/core/detector_metadata.hpp") {
+    std::ofstream file{file_name, std::ios_base::out | std::ios_base::trunc};
+    if (!file.is_open()) {
+        throw std::invalid_argument("Could not open file: " + file_name);
+    }
+    write_minimal_metadata(det, metadata_name, file, metadata_header);
+}
+
+}  // namespace detray::io
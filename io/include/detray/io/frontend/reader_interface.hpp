@@ -12,10 +12,14 @@
 #include "detray/io/frontend/payloads.hpp"
 
 // System include(s)
+#include <algorithm>
+#include <cstddef>
 #include <filesystem>
 #include <ios>
 #include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 namespace detray::io {
 
@@ -40,9 +44,52 @@ class reader_interface {
         detector_builder<typename detector_t::metadata, volume_builder>&,
         typename detector_t::name_map&, const std::string&) = 0;
 
+    /// Reading in two steps, so that the files of different readers can be
+    /// loaded concurrently, while the data is added to the detector builder
+    /// in order:
+    /// @{
+    /// Loads the data from the file with name @param file_name. Must not
+    /// touch any shared state. By default, only the file name is kept and
+    /// the file is read by @c convert
+    virtual void load(const std::string& file_name) {
+        m_file_name = file_name;
+    }
+
+    /// Adds the loaded data to the detector builder @param det_builder and
+    /// fills the name map @param name_map
+    virtual void convert(
+        detector_builder<typename detector_t::metadata, volume_builder>&
+            det_builder,
+        typename detector_t::name_map& name_map) {
+        read(det_builder, name_map, m_file_name);
+    }
+    /// @}
+
+    /// @returns whether the reader provides the detector geometry, which has
+    /// to be added to the builder before any other component
+    virtual bool is_geometry() const { return false; }
+
+    /// Only add the per-volume data (material maps) of the volumes with the
+    /// indices @param volumes to the detector. An empty selection means all
+    /// volumes. The other data is skipped as early as the file format allows.
+    void select_volumes(std::vector<std::size_t> volumes) {
+        std::sort(volumes.begin(), volumes.end());
+        m_volumes = std::move(volumes);
+    }
+
+    /// @returns whether the data of the volume @param vol_idx should be added
+    bool is_selected(const std::size_t vol_idx) const {
+        return m_volumes.empty() or
+               std::binary_search(m_volumes.begin(), m_volumes.end(), vol_idx);
+    }
+
     protected:
     /// Extension that matches the file format of the respective reader
     std::string m_file_extension;
+    /// File that was passed to @c load
+    std::string m_file_name{};
+    /// Selected volumes (sorted)
+    std::vector<std::size_t> m_volumes{};
 };
 
 }  // namespace detray::io
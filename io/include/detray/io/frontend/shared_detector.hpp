@@ -0,0 +1,325 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/packed_buffer.hpp"
+#include "detray/utils/type_list.hpp"
+
+// POSIX include(s)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// System include(s)
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace detray::io {
+
+namespace detail {
+
+/// Header at the beginning of a shared detector memory segment
+struct shared_segment_header {
+    /// Identifies a detray detector segment
+    std::uint64_t magic{0u};
+    /// Hash of the detector type name: only the same type can attach
+    std::uint64_t type_hash{0u};
+    /// Number of entries in the offset table that follows the header
+    std::uint64_t n_entries{0u};
+    /// Offset of the arena from the beginning of the segment in bytes
+    std::uint64_t arena_offset{0u};
+    /// Size of the arena in bytes
+    std::uint64_t arena_size{0u};
+};
+
+/// "DTRYSHM1"
+inline constexpr std::uint64_t shared_segment_magic{0x44545259'53484d31ull};
+
+/// @returns the fingerprint of the detector type @tparam detector_t
+template <typename detector_t>
+std::uint64_t detector_type_hash() {
+    return static_cast<std::uint64_t>(
+        std::hash<std::string>{}(types::demangle_type_name<detector_t>()));
+}
+
+/// @throws std::runtime_error with the message @param msg and the
+/// description of the current errno
+[[noreturn]] inline void throw_system_error(const std::string& msg) {
+    throw std::runtime_error(msg + ": " + std::strerror(errno));
+}
+
+}  // namespace detail
+
+/// @brief Detector in a named POSIX shared memory segment.
+///
+/// A fully built detector is packed into a relocatable arena (see
+/// @c packed_buffer ) inside of a shared memory segment, together with the
+/// offset table of its containers. Other processes can then attach to the
+/// segment by name and map it read-only, instead of building their own copy
+/// of the detector. The names and any other host-only data of the detector
+/// are not part of the segment.
+///
+/// The process that created the segment removes its name again on
+/// destruction. Processes that are already attached keep their mapping.
+///
+/// @note All processes need to use the same detector type (checked on attach)
+/// and the same build (the container element layouts are not checked).
+///
+/// @tparam detector_t the host detector type
+template <typename detector_t>
+class shared_detector {
+
+    public:
+    using view_type = typename detector_t::view_type;
+    using const_view_type = typename detector_t::const_view_type;
+
+    shared_detector() = default;
+
+    /// Not copyable: owns the mapping
+    shared_detector(const shared_detector&) = delete;
+    shared_detector& operator=(const shared_detector&) = delete;
+
+    /// Move constructor
+    shared_detector(shared_detector&& other) noexcept { swap(other); }
+
+    /// Move assignment
+    shared_detector& operator=(shared_detector&& other) noexcept {
+        if (this != &other) {
+            release();
+            swap(other);
+        }
+        return *this;
+    }
+
+    /// Unmap the segment (and remove its name, if it was created here)
+    ~shared_detector() { release(); }
+
+    /// @brief Place the detector @param det in a new shared memory segment
+    ///
+    /// @param name name of the segment (e.g. "/detray_itk")
+    ///
+    /// @throws std::runtime_error if the segment exists already or cannot be
+    /// created
+    static shared_detector create(const std::string& name,
+                                  const detector_t& det) {
+
+        const const_view_type src = det.get_data();
+
+        // Layout of the segment: header, offset table, arena
+        std::vector<detray::detail::arena_entry> entries{};
+        std::size_t arena_size{0u};
+        detray::detail::arena_layout(src, entries, arena_size);
+        arena_size = detray::detail::arena_align(arena_size);
+
+        detail::shared_segment_header header{};
+        header.magic = detail::shared_segment_magic;
+        header.type_hash = detail::detector_type_hash<detector_t>();
+        header.n_entries = entries.size();
+        header.arena_offset = detray::detail::arena_align(
+            sizeof(detail::shared_segment_header) +
+            entries.size() * sizeof(detray::detail::arena_entry));
+        header.arena_size = arena_size;
+
+        shared_detector seg{};
+        seg.m_name = name;
+        seg.m_size = header.arena_offset + header.arena_size;
+
+        seg.m_fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+        if (seg.m_fd < 0) {
+            detail::throw_system_error("Could not create shared segment " +
+                                       name);
+        }
+        // From here on, the name is removed again if anything goes wrong
+        seg.m_is_owner = true;
+
+        if (::ftruncate(seg.m_fd, static_cast<off_t>(seg.m_size)) != 0) {
+            detail::throw_system_error("Could not resize shared segment " +
+                                       name);
+        }
+        void* addr = ::mmap(nullptr, seg.m_size, PROT_READ | PROT_WRITE,
+                            MAP_SHARED, seg.m_fd, 0);
+        if (addr == MAP_FAILED) {
+            detail::throw_system_error("Could not map shared segment " + name);
+        }
+        seg.m_base = static_cast<std::byte*>(addr);
+
+        // Fill the segment
+        std::memcpy(seg.m_base, &header, sizeof(header));
+        std::memcpy(seg.m_base + sizeof(header), entries.data(),
+                    entries.size() * sizeof(detray::detail::arena_entry));
+        const detray::detail::arena_entry* entry{entries.data()};
+        detray::detail::arena_fill(src, seg.m_base + header.arena_offset,
+                                   entry);
+
+        // The detector is immutable from now on
+        if (::mprotect(addr, seg.m_size, PROT_READ) != 0) {
+            detail::throw_system_error("Could not protect shared segment " +
+                                       name);
+        }
+        seg.read_offsets();
+
+        return seg;
+    }
+
+    /// @brief Attach read-only to an existing segment with name @param name
+    ///
+    /// @throws std::runtime_error if the segment does not exist or does not
+    /// contain a detector of type @tparam detector_t
+    static shared_detector attach(const std::string& name) {
+
+        shared_detector seg{};
+        seg.m_name = name;
+
+        seg.m_fd = ::shm_open(name.c_str(), O_RDONLY, 0);
+        if (seg.m_fd < 0) {
+            detail::throw_system_error("Could not open shared segment " +
+                                       name);
+        }
+
+        struct stat info {};
+        if (::fstat(seg.m_fd, &info) != 0) {
+            detail::throw_system_error("Could not inspect shared segment " +
+                                       name);
+        }
+        seg.m_size = static_cast<std::size_t>(info.st_size);
+        if (seg.m_size < sizeof(detail::shared_segment_header)) {
+            throw std::runtime_error("Not a detector segment: " + name);
+        }
+
+        void* addr =
+            ::mmap(nullptr, seg.m_size, PROT_READ, MAP_SHARED, seg.m_fd, 0);
+        if (addr == MAP_FAILED) {
+            detail::throw_system_error("Could not map shared segment " + name);
+        }
+        seg.m_base = static_cast<std::byte*>(addr);
+
+        const detail::shared_segment_header header = seg.header();
+        if (header.magic != detail::shared_segment_magic) {
+            throw std::runtime_error("Not a detector segment: " + name);
+        }
+        if (header.type_hash != detail::detector_type_hash<detector_t>()) {
+            throw std::runtime_error("Detector type mismatch in segment: " +
+                                     name);
+        }
+        if (header.arena_offset + header.arena_size > seg.m_size) {
+            throw std::runtime_error("Truncated detector segment: " + name);
+        }
+        seg.read_offsets();
+
+        return seg;
+    }
+
+    /// @brief Remove the segment name @param name from the system
+    ///
+    /// @returns false if there was no such segment
+    static bool remove(const std::string& name) {
+        return ::shm_unlink(name.c_str()) == 0;
+    }
+
+    /// @returns the name of the segment
+    const std::string& name() const { return m_name; }
+
+    /// @returns the size of the segment in bytes
+    std::size_t size() const { return m_size; }
+
+    /// @returns whether the segment was created by this object
+    bool is_owner() const { return m_is_owner; }
+
+    /// @returns a read-only view of the shared detector
+    const_view_type get_data() const {
+        return assemble<const_view_type>();
+    }
+
+    /// @returns a view of the shared detector, which can be used to construct
+    /// a detector with device container types.
+    /// @note the segment is mapped read-only: The detector must not be
+    /// modified through this view
+    view_type get_view() const { return assemble<view_type>(); }
+
+    private:
+    /// @returns a copy of the segment header
+    detail::shared_segment_header header() const {
+        detail::shared_segment_header h{};
+        std::memcpy(&h, m_base, sizeof(h));
+        return h;
+    }
+
+    /// Read the offset table from the segment
+    void read_offsets() {
+        const detail::shared_segment_header h = header();
+        m_arena = m_base + h.arena_offset;
+        m_offsets.resize(static_cast<std::size_t>(h.n_entries));
+        std::memcpy(m_offsets.data(), m_base + sizeof(h),
+                    m_offsets.size() * sizeof(detray::detail::arena_entry));
+    }
+
+    /// @returns a view of type @tparam v_t onto the arena
+    template <typename v_t>
+    v_t assemble() const {
+        v_t v{};
+        const detray::detail::arena_entry* entry{m_offsets.data()};
+        // The views are only constructed, the data is never written
+        detray::detail::arena_assemble(v, const_cast<std::byte*>(m_arena),
+                                       entry);
+        return v;
+    }
+
+    /// Unmap the segment and close the file descriptor
+    void release() noexcept {
+        if (m_base != nullptr) {
+            ::munmap(m_base, m_size);
+        }
+        if (m_fd >= 0) {
+            ::close(m_fd);
+        }
+        if (m_is_owner) {
+            ::shm_unlink(m_name.c_str());
+        }
+        m_base = nullptr;
+        m_arena = nullptr;
+        m_fd = -1;
+        m_is_owner = false;
+    }
+
+    /// Swap the state with @param other
+    void swap(shared_detector& other) noexcept {
+        std::swap(m_name, other.m_name);
+        std::swap(m_fd, other.m_fd);
+        std::swap(m_size, other.m_size);
+        std::swap(m_base, other.m_base);
+        std::swap(m_arena, other.m_arena);
+        std::swap(m_offsets, other.m_offsets);
+        std::swap(m_is_owner, other.m_is_owner);
+    }
+
+    /// Name of the segment
+    std::string m_name{};
+    /// File descriptor of the segment
+    int m_fd{-1};
+    /// Size of the mapping in bytes
+    std::size_t m_size{0u};
+    /// Beginning of the mapping
+    std::byte* m_base{nullptr};
+    /// Beginning of the arena in the mapping
+    const std::byte* m_arena{nullptr};
+    /// Offset table of the packed containers
+    std::vector<detray::detail::arena_entry> m_offsets{};
+    /// Whether this object created the segment
+    bool m_is_owner{false};
+};
+
+}  // namespace detray::io
@@ -15,10 +15,13 @@
 // System include(s)
 #include <algorithm>
 #include <cassert>
+#include <exception>
 #include <map>
 #include <memory>
 #include <string>
+#include <thread>
 #include <type_traits>
+#include <vector>
 
 namespace detray::io::detail {
 
@@ -60,9 +63,14 @@ class detector_components_reader final {
 
     /// Reads the full detector into @param det by calling the readers, while
     /// using the name map @param volume_names for to write the volume names.
+    ///
+    /// If @param parallel is set, the files are loaded concurrently (one
+    /// thread per file) and the data is added to the builder afterwards,
+    /// starting with the geometry.
     virtual void read(detector_builder<typename detector_t::metadata,
                                        volume_builder>& det_builder,
-                      typename detector_t::name_map& volume_names) {
+                      typename detector_t::name_map& volume_names,
+                      const bool parallel = false) {
 
         // We have to at least read a geometry
         assert(size() != 0u &&
@@ -71,9 +79,50 @@ class detector_components_reader final {
         // Set the detector name in the name map
         volume_names.emplace(0u, m_det_name);
 
-        // Call the read method on all readers
+        if (not parallel or size() == 1u) {
+            // Call the read method on all readers
+            for (const auto& [name, reader] : m_readers) {
+                reader->read(det_builder, volume_names, name);
+            }
+            return;
+        }
+
+        // Load all files concurrently
+        std::vector<std::exception_ptr> errors(size());
+        std::vector<std::thread> threads;
+        threads.reserve(size());
+
+        std::size_t i{0u};
+        for (const auto& [name, reader] : m_readers) {
+            threads.emplace_back(
+                [&error = errors[i], &file_name = name, r = reader.get()]() {
+                    try {
+                        r->load(file_name);
+                    } catch (...) {
+                        error = std::current_exception();
+                    }
+                });
+            ++i;
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        for (const auto& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+        // Add the data to the builder: The geometry has to come first
+        for (const auto& [name, reader] : m_readers) {
+            if (reader->is_geometry()) {
+                reader->convert(det_builder, volume_names);
+            }
+        }
         for (const auto& [name, reader] : m_readers) {
-            reader->read(det_builder, volume_names, name);
+            if (not reader->is_geometry()) {
+                reader->convert(det_builder, volume_names);
+            }
         }
     }
 
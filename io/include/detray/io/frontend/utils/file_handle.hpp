@@ -8,6 +8,7 @@
 #pragma once
 
 // System include(s)
+#include <atomic>
 #include <cassert>
 #include <cstdint>
 #include <filesystem>
@@ -31,7 +32,8 @@ namespace detray::io {
 /// - Closes the stream when the handle goes out of scope and checks whether
 ///   anything went wrong during the IO operations
 ///
-/// @note Not thread safe.
+/// @note A single handle is not thread safe, but different handles can be
+/// used on different threads.
 /// @note Can throw exceptions during construction.
 class file_handle final {
 
@@ -59,8 +61,9 @@ class file_handle final {
         if (mode == std::ios_base::out or
             (mode == (std::ios_base::out | std::ios_base::binary))) {
             // Default name for output
-            file_stem =
-                name.empty() ? "detray_" + std::to_string(n_files) : name;
+            file_stem = name.empty()
+                            ? "detray_" + std::to_string(n_files.load())
+                            : name;
 
             std::filesystem::path file_path{file_stem + extension};
             std::size_t n_trials{2u};
@@ -107,6 +110,7 @@ class file_handle final {
         }
 
         // Open file
+        m_file_name = file_name;
         m_stream.open(file_name, mode);
 
         if (!m_stream.is_open()) {
@@ -126,6 +130,10 @@ class file_handle final {
     /// @returns the output stream
     std::fstream& operator*() { return m_stream; }
 
+    /// @returns the name of the file that was opened (can differ from the
+    /// requested name in output mode, if the file existed already)
+    const std::string& file_name() const { return m_file_name; }
+
     private:
     /// @returns alternate file stem upon collision
     std::string get_alternate_file_stem(std::string& stem,
@@ -151,10 +159,12 @@ class file_handle final {
 
     /// Output file handle
     std::fstream m_stream;
+    /// Name of the opened file
+    std::string m_file_name;
 
     /// How many files have been created? Maximum: 65'536
-    inline static std::size_t n_files{0u};
-    inline static std::size_t n_open_files{0u};
+    inline static std::atomic<std::size_t> n_files{0u};
+    inline static std::atomic<std::size_t> n_open_files{0u};
 };
 
 }  // namespace detray::io
@@ -1,6 +1,6 @@
 /** Detray library, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -15,12 +15,50 @@
 #include "detray/io/json/json_io.hpp"
 
 // System include(s)
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <filesystem>
 #include <ios>
 #include <iostream>
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace detray::io {
 
+namespace detail {
+
+/// @returns the path of the shard @param shard_name of the sharded json file
+/// @param index_file (the shards are in the same directory)
+inline std::string json_shard_path(const std::string& index_file,
+                                   const std::string& shard_name) {
+    return (std::filesystem::path{index_file}.parent_path() / shard_name)
+        .string();
+}
+
+/// Append the data of @param shard to @param data : The volume collections
+/// are concatenated, other entries are taken from the first shard that has
+/// them
+inline void merge_json_shard(nlohmann::json& data, nlohmann::json&& shard) {
+    if (shard.is_null()) {
+        return;
+    }
+    for (auto& [key, value] : shard.items()) {
+        if (value.is_array() and data.contains(key)) {
+            auto& collection = data[key];
+            for (auto& elem : value) {
+                collection.push_back(std::move(elem));
+            }
+        } else if (not data.contains(key)) {
+            data[key] = std::move(value);
+        }
+    }
+}
+
+}  // namespace detail
+
 /// @brief Class that adds json functionality to common reader types.
 ///
 /// Assemble the json readers from the common reader types, which handle the
@@ -28,6 +66,9 @@ namespace detray::io {
 /// json stream. It also inlcudes the respective @c to_json and @c from_json
 /// functions for the payloads ("json_serializers").
 ///
+/// Sharded files (see @c json_writer ) are resolved while loading: The shard
+/// files are parsed concurrently and merged into a single document.
+///
 /// @note The resulting reader types will fulfill @c reader_interface through
 /// the common readers they are being extended with
 template <class detector_t, class reader_backend_t>
@@ -39,24 +80,110 @@ class json_reader final : public reader_interface<detector_t> {
     /// Set json file extension
     json_reader() : reader_interface<detector_t>(".json") {}
 
-    /// Writes the geometry to file with a given name
+    /// Reads the detector component from file with a given name
     virtual void read(detector_builder<typename detector_t::metadata,
                                        volume_builder>& det_builder,
                       typename detector_t::name_map& name_map,
                       const std::string& file_name) override {
+        load(file_name);
+        convert(det_builder, name_map);
+    }
+
+    /// Parse the json file with name @param file_name
+    virtual void load(const std::string& file_name) override {
 
         // Read json from file
         io::file_handle file{file_name,
                              std::ios_base::in | std::ios_base::binary};
 
         // Reads the data from file and returns the corresponding io payloads
-        nlohmann::json in_json;
-        *file >> in_json;
+        *file >> m_in_json;
+
+        if (auto shards = m_in_json.find("shards"); shards != m_in_json.end()) {
+            load_shards(file_name, *shards);
+            m_in_json.erase("shards");
+        }
+    }
+
+    /// Add the parsed data to the detector builder @param det_builder
+    virtual void convert(detector_builder<typename detector_t::metadata,
+                                          volume_builder>& det_builder,
+                         typename detector_t::name_map& name_map) override {
+
+        nlohmann::json& data = m_in_json["data"];
+
+        // Remove the grids of the volumes that were not selected
+        if (auto grids = data.find("grids"); grids != data.end()) {
+            auto& vol_grids = *grids;
+            vol_grids.erase(
+                std::remove_if(vol_grids.begin(), vol_grids.end(),
+                               [this](const nlohmann::json& jvol) {
+                                   return not this->is_selected(
+                                       jvol["volume_link"]
+                                           .template get<std::size_t>());
+                               }),
+                vol_grids.end());
+        }
 
         // Add the data from the payload to the detray detector builder
-        io_backend::template convert<detector_t>(det_builder, name_map,
-                                                 in_json["data"]);
+        io_backend::template convert<detector_t>(det_builder, name_map, data);
+
+        // Release the memory
+        m_in_json = nlohmann::json{};
+    }
+
+    /// @returns whether the backend reads the detector geometry
+    virtual bool is_geometry() const override {
+        return io_backend::tag == "geometry";
+    }
+
+    private:
+    /// Parse the shard files @param shards of the file @param file_name
+    /// concurrently and merge them into the data of the document
+    void load_shards(const std::string& file_name,
+                     const nlohmann::json& shards) {
+
+        std::vector<nlohmann::json> shard_data(shards.size());
+        std::vector<std::exception_ptr> errors(shards.size());
+        std::vector<std::thread> threads;
+        threads.reserve(shards.size());
+
+        for (std::size_t i = 0u; i < shards.size(); ++i) {
+            const std::string shard_file{detail::json_shard_path(
+                file_name, shards[i].template get<std::string>())};
+
+            threads.emplace_back([&shard_data, &errors, shard_file, i]() {
+                try {
+                    io::file_handle file{
+                        shard_file, std::ios_base::in | std::ios_base::binary};
+                    nlohmann::json in_json;
+                    *file >> in_json;
+                    shard_data[i] = std::move(in_json["data"]);
+                } catch (...) {
+                    errors[i] = std::current_exception();
+                }
+            });
+        }
+
+        for (std::thread& t : threads) {
+            t.join();
+        }
+        for (const std::exception_ptr& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+        // Keep the order of the shards
+        nlohmann::json& data = m_in_json["data"];
+        data = nlohmann::json::object();
+        for (nlohmann::json& shard : shard_data) {
+            detail::merge_json_shard(data, std::move(shard));
+        }
     }
+
+    /// The parsed json file
+    nlohmann::json m_in_json;
 };
 
 }  // namespace detray::io
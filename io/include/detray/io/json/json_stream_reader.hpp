@@ -0,0 +1,139 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/builders/detector_builder.hpp"
+#include "detray/io/frontend/reader_interface.hpp"
+#include "detray/io/frontend/utils/file_handle.hpp"
+#include "detray/io/json/json.hpp"
+#include "detray/io/json/json_io.hpp"
+#include "detray/io/json/json_reader.hpp"
+
+// System include(s)
+#include <cstddef>
+#include <ios>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace detray::io {
+
+/// @brief Class that adds streaming json functionality to the grid readers.
+///
+/// Unlike the @c json_reader , which parses the complete file into a json
+/// document before converting it, this reader hands the grids of every
+/// volume to the reader backend as soon as they are parsed, and then drops
+/// them from the document. The memory that is needed to read a file is
+/// therefore bounded by the grids of a single volume, which makes it
+/// possible to read very large material map or surface grid files.
+///
+/// The shards of a sharded file (see @c json_writer ) are parsed one after
+/// the other.
+///
+/// @note Since the data goes directly into the detector builder, the file is
+/// only read in the @c convert step and can not be loaded concurrently.
+///
+/// @tparam payload_t the grid collection payload type that the reader
+///                   backend converts (@c detector_grids_payload )
+template <class detector_t, class reader_backend_t, class payload_t>
+class json_stream_reader final : public reader_interface<detector_t> {
+
+    using io_backend = reader_backend_t;
+    using grid_payload_t =
+        typename decltype(payload_t::grids)::mapped_type::value_type;
+
+    public:
+    /// Set json file extension
+    json_stream_reader() : reader_interface<detector_t>(".json") {}
+
+    /// Reads the grids from file with a given name
+    virtual void read(detector_builder<typename detector_t::metadata,
+                                       volume_builder>& det_builder,
+                      typename detector_t::name_map& name_map,
+                      const std::string& file_name) override {
+        this->load(file_name);
+        convert(det_builder, name_map);
+    }
+
+    /// Parse the file and convert the grids volume by volume
+    virtual void convert(detector_builder<typename detector_t::metadata,
+                                          volume_builder>& det_builder,
+                         typename detector_t::name_map& name_map) override {
+
+        // Shard files, if the file is sharded (see @c json_writer )
+        std::vector<std::string> shard_files{};
+
+        // Keys of the enclosing objects at depth one and two
+        std::string data_key{};
+        std::string grids_key{};
+
+        // The volume entries of the grid collection are at depth three:
+        // { "data": { "grids": [ {"volume_link": ..., "grid_data": [...]} ]}}
+        auto callback = [&](int depth, nlohmann::json::parse_event_t event,
+                            nlohmann::ordered_json& parsed) {
+            using event_t = nlohmann::json::parse_event_t;
+
+            if (event == event_t::key) {
+                if (depth == 1) {
+                    data_key = parsed.get<std::string>();
+                } else if (depth == 2) {
+                    grids_key = parsed.get<std::string>();
+                }
+                return true;
+            }
+
+            // List of shard files: These are parsed after this file
+            if (event == event_t::array_end and depth == 1 and
+                data_key == "shards") {
+                shard_files = parsed.get<std::vector<std::string>>();
+                return false;
+            }
+
+            if (event == event_t::object_end and depth == 3 and
+                data_key == "data" and grids_key == "grids") {
+
+                const std::size_t vol_idx = parsed["volume_link"];
+                if (not this->is_selected(vol_idx)) {
+                    return false;
+                }
+
+                // Convert the grids of this volume
+                payload_t vol_grids{};
+                auto& grids = vol_grids.grids[vol_idx];
+                for (const auto& jgrid : parsed["grid_data"]) {
+                    grids.push_back(jgrid.get<grid_payload_t>());
+                }
+                io_backend::template convert<detector_t>(
+                    det_builder, name_map, std::move(vol_grids));
+
+                // Drop the volume from the json document
+                return false;
+            }
+
+            return true;
+        };
+
+        {
+            io::file_handle file{this->m_file_name,
+                                 std::ios_base::in | std::ios_base::binary};
+            nlohmann::ordered_json::parse(*file, callback);
+        }
+
+        for (const std::string& shard : shard_files) {
+            io::file_handle file{
+                detail::json_shard_path(this->m_file_name, shard),
+                std::ios_base::in | std::ios_base::binary};
+            data_key.clear();
+            grids_key.clear();
+            nlohmann::ordered_json::parse(*file, callback);
+        }
+    }
+};
+
+}  // namespace detray::io
@@ -1,6 +1,6 @@
 /** Detray library, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,20 +8,106 @@
 #pragma once
 
 // Project include(s)
+#include "detray/io/frontend/payloads.hpp"
 #include "detray/io/frontend/utils/file_handle.hpp"
 #include "detray/io/frontend/writer_interface.hpp"
 #include "detray/io/json/json.hpp"
 #include "detray/io/json/json_io.hpp"
 
 // System include(s)
+#include <algorithm>
 #include <cassert>
+#include <cstddef>
+#include <exception>
 #include <filesystem>
+#include <iomanip>
 #include <ios>
+#include <iterator>
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace detray::io {
 
+namespace detail {
+
+/// Split the elements of @param v into @param n_shards ranges of consecutive
+/// elements (at least one shard, at most one per element)
+template <typename T>
+std::vector<std::vector<T>> split_range(std::vector<T>&& v,
+                                        const std::size_t n_shards) {
+    const std::size_t n{
+        std::max(std::min(n_shards, v.size()), static_cast<std::size_t>(1u))};
+    std::vector<std::vector<T>> shards(n);
+
+    auto first = v.begin();
+    for (std::size_t i = 0u; i < n; ++i) {
+        // Distribute the remainder over the first shards
+        const auto n_elem{static_cast<std::ptrdiff_t>(
+            v.size() / n + (i < v.size() % n ? 1u : 0u))};
+        shards[i].assign(std::make_move_iterator(first),
+                         std::make_move_iterator(first + n_elem));
+        first += n_elem;
+    }
+
+    return shards;
+}
+
+/// Split the payloads into @param n_shards shards of consecutive volumes
+/// @{
+inline std::vector<detector_payload> split_payload(
+    detector_payload&& payload, const std::size_t n_shards) {
+
+    std::vector<detector_payload> shards{};
+    for (auto& volumes : split_range(std::move(payload.volumes), n_shards)) {
+        shards.emplace_back().volumes = std::move(volumes);
+    }
+    shards.front().volume_grid = std::move(payload.volume_grid);
+
+    return shards;
+}
+
+inline std::vector<detector_homogeneous_material_payload> split_payload(
+    detector_homogeneous_material_payload&& payload,
+    const std::size_t n_shards) {
+
+    std::vector<detector_homogeneous_material_payload> shards{};
+    for (auto& volumes : split_range(std::move(payload.volumes), n_shards)) {
+        shards.emplace_back().volumes = std::move(volumes);
+    }
+
+    return shards;
+}
+
+template <typename content_t, typename grid_id_t>
+std::vector<detector_grids_payload<content_t, grid_id_t>> split_payload(
+    detector_grids_payload<content_t, grid_id_t>&& payload,
+    const std::size_t n_shards) {
+
+    using grid_coll_t = typename decltype(payload.grids)::mapped_type;
+
+    std::vector<std::pair<std::size_t, grid_coll_t>> entries{};
+    entries.reserve(payload.grids.size());
+    for (auto& [vol_idx, grids] : payload.grids) {
+        entries.emplace_back(vol_idx, std::move(grids));
+    }
+
+    std::vector<detector_grids_payload<content_t, grid_id_t>> shards{};
+    for (auto& range : split_range(std::move(entries), n_shards)) {
+        auto& shard = shards.emplace_back();
+        for (auto& [vol_idx, grids] : range) {
+            shard.grids.emplace(vol_idx, std::move(grids));
+        }
+    }
+
+    return shards;
+}
+/// @}
+
+}  // namespace detail
+
 /// @brief Class that adds json functionality to common writer types.
 ///
 /// Assemble the json writers from the common writer types, which serialize a
@@ -29,6 +115,11 @@ namespace detray::io {
 /// handling and provides the json stream. It also inlcudes the respective
 /// @c to_json and @c from_json functions for the payloads ("json_serializers").
 ///
+/// If the number of shards is non-zero, the payload is split into shards of
+/// consecutive volumes, which are serialized into separate files in parallel.
+/// The file with the regular name then only contains the header and the list
+/// of shard files ("shards"), which is resolved by the @c json_reader .
+///
 /// @note The resulting writer types will fulfill @c writer_interface through
 /// the common writers they are being extended with
 template <class detector_t, class writer_backend_t>
@@ -38,7 +129,9 @@ class json_writer final : public writer_interface<detector_t> {
 
     public:
     /// File gets created with the json file extension
-    json_writer() : writer_interface<detector_t>(".json") {}
+    /// @param n_shards number of per-volume shards (no sharding if zero)
+    explicit json_writer(const std::size_t n_shards = 0u)
+        : writer_interface<detector_t>(".json"), m_n_shards{n_shards} {}
 
     /// Writes the geometry to file with a given name
     virtual std::string write(
@@ -68,15 +161,75 @@ class json_writer final : public writer_interface<detector_t> {
         nlohmann::ordered_json out_json;
         out_json["header"] = io_backend::write_header(det, det_name);
 
-        // Write the detector data into the json stream by using the
-        // conversion functions defined in "detray/io/json/json_io.hpp"
-        out_json["data"] = io_backend::convert(det, names);
+        if (m_n_shards > 0u) {
+            out_json["shards"] = write_shards(
+                io_backend::convert(det, names),
+                std::filesystem::path{file.file_name()}.stem().string(),
+                file_path);
+        } else {
+            // Write the detector data into the json stream by using the
+            // conversion functions defined in "detray/io/json/json_io.hpp"
+            out_json["data"] = io_backend::convert(det, names);
+        }
 
         // Write to file
         *file << std::setw(4) << out_json << std::endl;
 
         return file_stem + this->m_file_extension;
     }
+
+    private:
+    /// Write the shards of @param payload concurrently into the files
+    /// "<index_stem>_shard_<i>" in the directory @param file_path
+    ///
+    /// @returns the names of the shard files
+    template <typename payload_t>
+    std::vector<std::string> write_shards(
+        payload_t&& payload, const std::string& index_stem,
+        const std::filesystem::path& file_path) const {
+
+        auto shards = detail::split_payload(std::move(payload), m_n_shards);
+
+        std::vector<std::string> shard_files(shards.size());
+        std::vector<std::exception_ptr> errors(shards.size());
+        std::vector<std::thread> threads;
+        threads.reserve(shards.size());
+
+        for (std::size_t i = 0u; i < shards.size(); ++i) {
+            shard_files[i] = index_stem + "_shard_" + std::to_string(i) +
+                             this->m_file_extension;
+
+            threads.emplace_back([&, i]() {
+                try {
+                    // The shards belong to the index file: always replace
+                    io::file_handle file{
+                        (file_path / shard_files[i]).string(),
+                        std::ios_base::out | std::ios_base::binary |
+                            std::ios_base::trunc};
+
+                    nlohmann::ordered_json out_json;
+                    out_json["data"] = shards[i];
+                    *file << std::setw(4) << out_json << std::endl;
+                } catch (...) {
+                    errors[i] = std::current_exception();
+                }
+            });
+        }
+
+        for (std::thread& t : threads) {
+            t.join();
+        }
+        for (const std::exception_ptr& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+        return shard_files;
+    }
+
+    /// Number of per-volume shards
+    std::size_t m_n_shards{0u};
 };
 
 }  // namespace detray::io
@@ -34,6 +34,9 @@ struct vc_cmath {
     using point3D = algebra::vc::point3<value_type>;
     using vector3D = algebra::vc::vector3<value_type>;
 
+    /// Horizontal vectorization: one ray per lane (see @c ray_bundle )
+    using bundle_type = Vc::Vector<value_type>;
+
     // Define matrix/vector operator
     using matrix_operator = algebra::matrix::actor<
         value_type, algebra::matrix::determinant::preset0<value_type>,
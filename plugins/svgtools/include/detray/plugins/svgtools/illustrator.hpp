@@ -67,7 +67,7 @@ class illustrator {
         : _detector{detector}, _name_map{name_map}, _style{style} {}
 
     /// @returns the detector and volume names
-    const typename detector_t::name_map& names() { return _name_map; }
+    const typename detector_t::name_map& names() const { return _name_map; }
 
     /// Access the illustrator style
     styling::style& style() { return _style; }
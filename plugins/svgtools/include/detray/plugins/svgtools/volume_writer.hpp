@@ -0,0 +1,108 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/io/frontend/utils/file_handle.hpp"
+#include "detray/plugins/svgtools/illustrator.hpp"
+#include "detray/plugins/svgtools/writer.hpp"
+#include "detray/utils/invalid_values.hpp"
+#include "detray/utils/parallel_algorithms.hpp"
+
+// Actsvg include(s)
+#include "actsvg/core.hpp"
+
+// System include(s)
+#include <filesystem>
+#include <ios>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace detray::svgtools {
+
+/// @brief Entry of the index of the per-volume svg files
+struct volume_svg_entry {
+    /// Index of the volume in the detector
+    dindex index{detail::invalid_value<dindex>()};
+    /// Name of the volume
+    std::string name{};
+    /// Names of the svg files that display the volume
+    std::vector<std::string> files{};
+};
+
+/// @brief Converts the volumes @param indices of a detector one at a time
+/// and writes every volume into its own svg files in @param path .
+///
+/// The volumes are converted in parallel on @param n_threads threads and the
+/// svgs of a volume are released as soon as they are written, so that only a
+/// few volumes are held in memory at any time. A volume with a surface grid
+/// additionally gets a file for its grid sheet (if the view has one).
+///
+/// @param il the illustrator that converts the volumes
+/// @param view the display view
+/// @param axes the axes that are drawn into every volume display
+/// @param gctx the geometry context
+///
+/// @returns the index of the written files, in the order of @param indices
+template <typename detector_t, typename range_t, typename view_t>
+inline std::vector<volume_svg_entry> write_volume_svgs(
+    const std::filesystem::path& path, const illustrator<detector_t>& il,
+    const range_t& indices, const view_t& view,
+    const actsvg::svg::object& axes, const unsigned int n_threads = 1u,
+    const typename detector_t::geometry_context& gctx = {}) {
+
+    std::vector<volume_svg_entry> svg_index{};
+    for (const dindex vol_idx : indices) {
+        svg_index.push_back({vol_idx, il.names().at(vol_idx + 1u), {}});
+    }
+
+    // Every thread writes only the files and index entry of its own volume
+    const execution::host_threads_policy policy{n_threads, 1u};
+    detray::ranges::for_each(
+        policy, svg_index, [&path, &il, &view, &axes, &gctx](
+                               volume_svg_entry& entry) {
+            [[maybe_unused]] auto [vol_svg, sheet] =
+                il.draw_volume(entry.index, view, gctx);
+
+            if constexpr (!std::is_same_v<view_t, actsvg::views::z_phi>) {
+                write_svg(path / vol_svg._id, {axes, vol_svg});
+                entry.files.push_back(vol_svg._id + ".svg");
+            }
+            if (!sheet._id.empty()) {
+                write_svg(path / sheet._id, sheet);
+                entry.files.push_back(sheet._id + ".svg");
+            }
+        });
+
+    return svg_index;
+}
+
+/// @brief Writes a lightweight html index @param file_name in @param path
+/// that links the per-volume svg files of @param svg_index .
+inline void write_svg_index(const std::filesystem::path& path,
+                            const std::string& file_name,
+                            const std::vector<volume_svg_entry>& svg_index) {
+
+    detray::io::file_handle stream{path / file_name, ".html",
+                                   std::ios::out | std::ios::trunc};
+
+    *stream << "<!DOCTYPE html>\n<html>\n<head><title>" << file_name
+            << "</title></head>\n<body>\n<ul>\n";
+    for (const volume_svg_entry& entry : svg_index) {
+        *stream << "<li>" << entry.index << ": " << entry.name;
+        for (const std::string& file : entry.files) {
+            *stream << " <a href=\"" << file << "\">" << file << "</a>";
+        }
+        *stream << "</li>\n";
+    }
+    *stream << "</ul>\n</body>\n</html>\n";
+}
+
+}  // namespace detray::svgtools
@@ -0,0 +1,109 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/builders/bin_fillers.hpp"
+#include "detray/builders/grid_builder.hpp"
+#include "detray/detectors/build_toy_detector.hpp"
+#include "detray/geometry/detector_volume.hpp"
+#include "detray/geometry/mask.hpp"
+#include "detray/geometry/shapes/ring2D.hpp"
+#include "detray/test/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google Benchmark include(s)
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <algorithm>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Use the detray:: namespace implicitly.
+using namespace detray;
+
+namespace {
+
+constexpr std::size_t n_r_bins{20u};
+constexpr std::size_t n_phi_bins{360u};
+
+}  // namespace
+
+// This benchmark fills a finely binned disc grid with the modules of an
+// endcap layer of the toy detector by bin association. The argument is the
+// number of threads that associate the grid bins.
+void BM_BIN_ASSOCIATION(benchmark::State &state) {
+
+    // Detector configuration
+    vecmem::host_memory_resource host_mr;
+    const auto [d, names] = build_toy_detector(host_mr);
+
+    using detector_t = std::remove_cv_t<decltype(d)>;
+    using surface_t = typename detector_t::surface_type;
+    using accel_id = typename detector_t::accel::id;
+    using geo_obj_id = typename detector_t::geo_obj_ids;
+
+    using disc_grid_t =
+        grid<axes<ring2D>, bins::static_array<surface_t, 20>,
+             simple_serializer, host_container_types, false>;
+
+    // Endcap layer with the first disc grid of the toy detector
+    const auto &vol_desc = *std::find_if(
+        d.volumes().begin(), d.volumes().end(), [](const auto &vol) {
+            const auto &link =
+                vol.template accel_link<geo_obj_id::e_sensitive>();
+            return link.id() == accel_id::e_disc_grid and link.index() == 0u;
+        });
+
+    std::vector<surface_t> surfaces{};
+    for (const auto &sf_desc : d.surfaces()) {
+        if (sf_desc.volume() == vol_desc.index() and sf_desc.is_sensitive()) {
+            surfaces.push_back(sf_desc);
+        }
+    }
+
+    const auto &ax_r = d.accelerator_store()
+                           .template get<accel_id::e_disc_grid>()[0]
+                           .template get_axis<axis::label::e_r>();
+    const mask<ring2D> disc_mask{0u, ax_r.min(), ax_r.max()};
+
+    const bin_associator bin_filler{static_cast<unsigned int>(state.range(0))};
+
+    for (auto _ : state) {
+        grid_builder<detector_t, disc_grid_t, bin_associator> gbuilder{};
+        gbuilder.init_grid(disc_mask, {n_r_bins, n_phi_bins});
+        gbuilder.fill_grid(detector_volume{d, vol_desc}, surfaces,
+                           d.transform_store(), d.mask_store(), {},
+                           bin_filler);
+
+        benchmark::DoNotOptimize(gbuilder.get());
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["bins"] =
+        benchmark::Counter(static_cast<double>(n_r_bins * n_phi_bins),
+                           benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// Double the number of threads up to the number of hardware threads
+void bin_association_args(benchmark::internal::Benchmark *bench) {
+    const auto max_threads{static_cast<int>(
+        std::max(1u, std::thread::hardware_concurrency()))};
+
+    for (int n_threads = 1; n_threads < 2 * max_threads; n_threads *= 2) {
+        bench->Arg(std::min(n_threads, max_threads));
+    }
+}
+
+BENCHMARK(BM_BIN_ASSOCIATION)
+    ->Apply(bin_association_args)
+    ->ArgName("threads")
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,82 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/build_telescope_detector.hpp"
+#include "detray/detectors/build_toy_detector.hpp"
+#include "detray/materials/predefined_materials.hpp"
+#include "detray/test/types.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <cstdint>
+#include <iostream>
+
+// Use the detray:: namespace implicitly.
+using namespace detray;
+
+// Benchmarks the construction of a telescope detector with homogeneous
+// material on every module (all modules in a single volume)
+void BM_BUILD_TELESCOPE(benchmark::State &state) {
+
+    vecmem::host_memory_resource host_mr;
+
+    tel_det_config<rectangle2D> tel_cfg{20.f * unit<scalar>::mm,
+                                        20.f * unit<scalar>::mm};
+    tel_cfg.n_surfaces(static_cast<unsigned int>(state.range(0)))
+        .length(10.f * unit<scalar>::m)
+        .module_material(silicon_tml<scalar>())
+        .do_check(false);
+
+    for (auto _ : state) {
+        auto [det, names] = build_telescope_detector(host_mr, tel_cfg);
+        benchmark::DoNotOptimize(det);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_BUILD_TELESCOPE)
+    ->RangeMultiplier(10)
+    ->Range(100, 10000)
+    ->Unit(benchmark::kMillisecond);
+
+// Benchmarks the construction of the toy detector with homogeneous material
+// on all surfaces
+void BM_BUILD_TOY_DETECTOR(benchmark::State &state) {
+
+    vecmem::host_memory_resource host_mr;
+
+    toy_det_config<scalar> toy_cfg{};
+    toy_cfg.n_brl_layers(4u)
+        .n_edc_layers(static_cast<unsigned int>(state.range(0)))
+        .do_check(false);
+
+    std::size_t n_surfaces{0u};
+    for (auto _ : state) {
+        auto [det, names] = build_toy_detector(host_mr, toy_cfg);
+        n_surfaces = det.surfaces().size();
+        benchmark::DoNotOptimize(det);
+    }
+
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(n_surfaces));
+
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+    std::cout << "No. surfaces : " << n_surfaces << std::endl;
+#endif  // DETRAY_BENCHMARK_PRINTOUTS
+}
+
+BENCHMARK(BM_BUILD_TOY_DETECTOR)
+    ->DenseRange(1, 7, 3)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,338 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/builders/grid_factory.hpp"
+#include "detray/core/detail/container_buffers.hpp"
+#include "detray/detectors/build_toy_detector.hpp"
+#include "detray/geometry/mask.hpp"
+#include "detray/geometry/shapes/concentric_cylinder2D.hpp"
+#include "detray/io/frontend/detector_reader.hpp"
+#include "detray/io/frontend/detector_writer.hpp"
+#include "detray/test/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
+
+// Google Benchmark include(s)
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+// Use the detray:: namespace implicitly.
+using namespace detray;
+
+/// Cost of the detector startup: construction, file I/O and data transfer.
+///
+/// Times the construction of toy detectors of increasing size, the writing
+/// and reading of the detector files in json and binary format, the
+/// construction of surface grids in the @c grid_factory and the creation of
+/// the detector buffers. The largest toy detector has roughly the number of
+/// sensitive modules of an ITk-size tracker.
+///
+/// Every benchmark reports the peak resident set size of the process
+/// ('peak_rss'), which is a high-water mark over the whole process lifetime.
+/// Run a single benchmark (--benchmark_filter) to attribute it correctly.
+///
+/// The benchmark arguments are:
+/// - 'modules': modules per layer along phi/r, in percent of the default
+/// - 'format': 0 = json, 1 = binary
+
+using scalar_t = test::scalar;
+using detector_t = detector<toy_metadata>;
+
+namespace {
+
+/// The surface grids of the toy detector have bin capacity one
+constexpr std::size_t grid_capacity{1u};
+
+/// File formats of the I/O benchmarks
+enum class file_format : std::int64_t {
+    e_json = 0,
+    e_binary = 1,
+};
+
+/// @returns the toy detector configuration with the number of modules per
+/// layer scaled by @param module_scale
+auto make_config(const scalar_t module_scale) {
+
+    auto scale = [module_scale](const unsigned int n) {
+        const auto n_scaled{static_cast<unsigned int>(
+            math::round(static_cast<scalar_t>(n) * module_scale))};
+        return n_scaled > 0u ? n_scaled : 1u;
+    };
+
+    toy_det_config<scalar_t> toy_cfg{};
+    toy_cfg.n_brl_layers(4u).n_edc_layers(7u).do_check(false);
+
+    std::vector<std::pair<unsigned int, unsigned int>> brl_binning{
+        toy_cfg.barrel_layer_binning()};
+    for (auto &bins : brl_binning) {
+        bins.first = scale(bins.first);
+    }
+    toy_cfg.barrel_layer_binning(brl_binning);
+
+    std::vector<unsigned int> edc_binning{toy_cfg.endcap_config().binning()};
+    for (auto &bins : edc_binning) {
+        bins = scale(bins);
+    }
+    toy_cfg.endcap_config().binning(edc_binning);
+
+    return toy_cfg;
+}
+
+/// @returns the module scale of the benchmark @param state
+scalar_t module_scale(const benchmark::State &state) {
+    return static_cast<scalar_t>(state.range(0)) / 100.f;
+}
+
+/// @returns the writer configuration for the file format of the benchmark
+/// @param state , writing to the directory @param dir
+io::detector_writer_config make_writer_config(const benchmark::State &state,
+                                              const std::string &dir) {
+    const auto fmt{static_cast<file_format>(state.range(1))};
+
+    return io::detector_writer_config{}
+        .path(dir)
+        .format(fmt == file_format::e_binary ? io::format::binary
+                                             : io::format::json)
+        .replace_files(true);
+}
+
+/// @returns a fresh output directory for the benchmark @param state
+std::string make_output_dir(const benchmark::State &state) {
+    const std::filesystem::path dir{
+        std::filesystem::temp_directory_path() / "detray_benchmark_io" /
+        ("modules_" + std::to_string(state.range(0)) + "_format_" +
+         std::to_string(state.range(1)))};
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir);
+
+    return dir.string();
+}
+
+/// @returns the files in the directory @param dir and their total size
+std::pair<std::vector<std::string>, std::uintmax_t> list_files(
+    const std::string &dir) {
+    std::vector<std::string> files{};
+    std::uintmax_t n_bytes{0u};
+    for (const auto &entry : std::filesystem::directory_iterator(dir)) {
+        if (entry.is_regular_file()) {
+            files.push_back(entry.path().string());
+            n_bytes += entry.file_size();
+        }
+    }
+    return {files, n_bytes};
+}
+
+/// Set the peak resident set size of the process as counter of the
+/// benchmark @param state
+void set_peak_rss(benchmark::State &state) {
+#if defined(__unix__) || defined(__APPLE__)
+    struct rusage usage {};
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#if defined(__APPLE__)
+        // Reported in bytes
+        const auto rss_bytes{static_cast<double>(usage.ru_maxrss)};
+#else
+        // Reported in kilobytes
+        const auto rss_bytes{static_cast<double>(usage.ru_maxrss) * 1024.};
+#endif
+        state.counters["peak_rss"] = benchmark::Counter(
+            rss_bytes, benchmark::Counter::kDefaults,
+            benchmark::Counter::kIs1024);
+    }
+#else
+    (void)state;
+#endif
+}
+
+}  // anonymous namespace
+
+/// Benchmarks the construction of toy detectors of increasing size
+void BM_BUILD_SCALED_TOY_DETECTOR(benchmark::State &state) {
+
+    vecmem::host_memory_resource host_mr;
+    const auto toy_cfg = make_config(module_scale(state));
+
+    std::size_t n_surfaces{0u};
+    for (auto _ : state) {
+        auto [det, names] = build_toy_detector(host_mr, toy_cfg);
+        n_surfaces = det.surfaces().size();
+        benchmark::DoNotOptimize(det);
+    }
+
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(n_surfaces));
+    state.counters["surfaces"] = static_cast<double>(n_surfaces);
+    set_peak_rss(state);
+}
+
+BENCHMARK(BM_BUILD_SCALED_TOY_DETECTOR)
+    ->Name("BM_BUILD_SCALED_TOY_DETECTOR")
+    ->ArgName("modules")
+    ->Arg(100)
+    ->Arg(200)
+    ->Arg(400)
+    ->Unit(benchmark::kMillisecond);
+
+/// Benchmarks writing the toy detector to file
+void BM_WRITE_DETECTOR(benchmark::State &state) {
+
+    vecmem::host_memory_resource host_mr;
+    auto [det, names] =
+        build_toy_detector(host_mr, make_config(module_scale(state)));
+
+    const std::string dir{make_output_dir(state)};
+    auto writer_cfg = make_writer_config(state, dir);
+
+    for (auto _ : state) {
+        io::write_detector(det, names, writer_cfg);
+        benchmark::ClobberMemory();
+    }
+
+    const auto n_bytes{list_files(dir).second};
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<std::int64_t>(n_bytes));
+    state.counters["file_bytes"] = benchmark::Counter(
+        static_cast<double>(n_bytes), benchmark::Counter::kDefaults,
+        benchmark::Counter::kIs1024);
+    set_peak_rss(state);
+
+    std::filesystem::remove_all(dir);
+}
+
+BENCHMARK(BM_WRITE_DETECTOR)
+    ->Name("BM_WRITE_DETECTOR")
+    ->ArgNames({"modules", "format"})
+    ->ArgsProduct({{100, 200, 400}, {0, 1}})
+    ->Unit(benchmark::kMillisecond);
+
+/// Benchmarks reading the toy detector from file, including the detector
+/// construction from the file data
+void BM_READ_DETECTOR(benchmark::State &state) {
+
+    vecmem::host_memory_resource host_mr;
+
+    const std::string dir{make_output_dir(state)};
+    {
+        auto [det, names] =
+            build_toy_detector(host_mr, make_config(module_scale(state)));
+        auto writer_cfg = make_writer_config(state, dir);
+        io::write_detector(det, names, writer_cfg);
+    }
+
+    const auto [files, n_bytes] = list_files(dir);
+    io::detector_reader_config reader_cfg{};
+    reader_cfg.do_check(false);
+    for (const std::string &file : files) {
+        reader_cfg.add_file(file);
+    }
+
+    for (auto _ : state) {
+        auto [det, names] =
+            io::read_detector<detector_t, grid_capacity>(host_mr, reader_cfg);
+        benchmark::DoNotOptimize(det);
+    }
+
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<std::int64_t>(n_bytes));
+    state.counters["file_bytes"] = benchmark::Counter(
+        static_cast<double>(n_bytes), benchmark::Counter::kDefaults,
+        benchmark::Counter::kIs1024);
+    set_peak_rss(state);
+
+    std::filesystem::remove_all(dir);
+}
+
+BENCHMARK(BM_READ_DETECTOR)
+    ->Name("BM_READ_DETECTOR")
+    ->ArgNames({"modules", "format"})
+    ->ArgsProduct({{100, 200, 400}, {0, 1}})
+    ->Unit(benchmark::kMillisecond);
+
+/// Benchmarks the construction of a barrel surface grid with a variable bin
+/// capacity in the grid factory
+void BM_GRID_FACTORY(benchmark::State &state) {
+
+    using bin_t = bins::dynamic_array<dindex>;
+    using factory_t = grid_factory<bin_t, simple_serializer>;
+    using grid_t =
+        typename factory_t::template grid_type<concentric_cylinder2D>;
+    using loc_bin_t = typename grid_t::loc_bin_index;
+
+    vecmem::host_memory_resource host_mr;
+    const factory_t gr_factory{host_mr};
+
+    // Number of bins in phi and z
+    const auto n_phi{static_cast<std::size_t>(state.range(0))};
+    const std::size_t n_z{n_phi / 2u};
+
+    const mask<concentric_cylinder2D> cyl_mask{0u, 100.f, -500.f, 500.f};
+
+    std::vector<std::pair<loc_bin_t, dindex>> capacities{};
+    capacities.reserve(n_phi * n_z);
+    for (dindex i = 0u; i < n_phi; ++i) {
+        for (dindex j = 0u; j < n_z; ++j) {
+            capacities.emplace_back(loc_bin_t{i, j}, 1u + (i + j) % 4u);
+        }
+    }
+
+    for (auto _ : state) {
+        grid_t gr = gr_factory.new_grid(cyl_mask, {n_phi, n_z}, capacities);
+        benchmark::DoNotOptimize(gr);
+    }
+
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(n_phi * n_z));
+    set_peak_rss(state);
+}
+
+BENCHMARK(BM_GRID_FACTORY)
+    ->Name("BM_GRID_FACTORY")
+    ->ArgName("phi_bins")
+    ->RangeMultiplier(4)
+    ->Range(16, 1024)
+    ->Unit(benchmark::kMicrosecond);
+
+/// Benchmarks the creation of the detector buffers, which includes the copy
+/// of the detector data (into host memory, as a stand-in for the device)
+void BM_DETECTOR_BUFFER(benchmark::State &state) {
+
+    vecmem::host_memory_resource host_mr;
+    vecmem::copy cpy{};
+
+    auto [det, names] =
+        build_toy_detector(host_mr, make_config(module_scale(state)));
+
+    for (auto _ : state) {
+        auto det_buffer = detray::get_buffer(det, host_mr, cpy);
+        benchmark::DoNotOptimize(det_buffer);
+    }
+
+    state.counters["surfaces"] = static_cast<double>(det.surfaces().size());
+    set_peak_rss(state);
+}
+
+BENCHMARK(BM_DETECTOR_BUFFER)
+    ->Name("BM_DETECTOR_BUFFER")
+    ->ArgName("modules")
+    ->Arg(100)
+    ->Arg(200)
+    ->Arg(400)
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,198 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/detectors/build_toy_detector.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/line_stepper.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/simulation/event_generator/track_generators.hpp"
+#include "detray/test/types.hpp"
+#include "detray/test/utils/perf_counters.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+#include <vecmem/memory/memory_resource.hpp>
+
+// Google Benchmark include(s)
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Use the detray:: namespace implicitly.
+using namespace detray;
+
+/// Scaling of the navigation initialization with the detector size.
+///
+/// Synthesises toy detectors with a varying number of barrel layers (with
+/// all endcap layers for a full barrel), a varying number of modules per
+/// layer and a varying number of surface grid bins per module, and measures
+/// the time to initialize the navigation in the start volume of a batch of
+/// straight line tracks ('t_per_init'). Every benchmark also reports the
+/// number of surfaces of the detector ('surfaces') and the memory that was
+/// allocated for the detector ('det_bytes').
+///
+/// The benchmark arguments are:
+/// - 'layers': number of barrel layers
+/// - 'modules': modules per layer along phi, in percent of the default
+/// - 'grid': grid bins per module and axis, in percent
+
+using algebra_t = test::algebra;
+using scalar_t = test::scalar;
+
+using trk_generator_t =
+    uniform_track_generator<free_track_parameters<algebra_t>>;
+
+namespace {
+
+constexpr unsigned int theta_steps{20u};
+constexpr unsigned int phi_steps{20u};
+
+/// Memory resource that counts the bytes that are currently allocated
+/// through it, forwarding to an upstream resource
+class counting_memory_resource : public vecmem::memory_resource {
+
+    public:
+    explicit counting_memory_resource(vecmem::memory_resource &upstream)
+        : m_upstream{upstream} {}
+
+    /// @returns the number of bytes that are currently allocated
+    std::size_t bytes() const { return m_bytes; }
+
+    private:
+    void *do_allocate(std::size_t size, std::size_t align) override {
+        void *ptr{m_upstream.allocate(size, align)};
+        m_bytes += size;
+        return ptr;
+    }
+
+    void do_deallocate(void *ptr, std::size_t size,
+                       std::size_t align) override {
+        m_upstream.deallocate(ptr, size, align);
+        m_bytes -= size;
+    }
+
+    bool do_is_equal(
+        const vecmem::memory_resource &other) const noexcept override {
+        return this == &other;
+    }
+
+    vecmem::memory_resource &m_upstream;
+    std::size_t m_bytes{0u};
+};
+
+/// @returns the toy detector configuration for @param n_layers barrel
+/// layers, with the modules per layer scaled by @param module_scale and the
+/// grid bins per module scaled by @param grid_scale
+auto make_config(const unsigned int n_layers, const scalar_t module_scale,
+                 const scalar_t grid_scale) {
+
+    auto scale = [module_scale](const unsigned int n) {
+        const auto n_scaled{static_cast<unsigned int>(
+            math::round(static_cast<scalar_t>(n) * module_scale))};
+        return n_scaled > 0u ? n_scaled : 1u;
+    };
+
+    toy_det_config<scalar_t> toy_cfg{};
+    toy_cfg.n_brl_layers(n_layers)
+        .n_edc_layers(n_layers == 4u ? 7u : 0u)
+        .grid_bin_scale(grid_scale)
+        .do_check(false);
+
+    // Scale the number of modules in phi, keep the modules along z/r
+    std::vector<std::pair<unsigned int, unsigned int>> brl_binning{
+        toy_cfg.barrel_layer_binning()};
+    for (auto &bins : brl_binning) {
+        bins.first = scale(bins.first);
+    }
+    toy_cfg.barrel_layer_binning(brl_binning);
+
+    std::vector<unsigned int> edc_binning{toy_cfg.endcap_config().binning()};
+    for (auto &bins : edc_binning) {
+        bins = scale(bins);
+    }
+    toy_cfg.endcap_config().binning(edc_binning);
+
+    return toy_cfg;
+}
+
+}  // anonymous namespace
+
+/// This benchmark initializes the navigation of a track batch in toy
+/// detectors of increasing size and surface density
+void BM_DETECTOR_SCALING(benchmark::State &state) {
+
+    const auto n_layers{static_cast<unsigned int>(state.range(0))};
+    const scalar_t module_scale{static_cast<scalar_t>(state.range(1)) /
+                                100.f};
+    const scalar_t grid_scale{static_cast<scalar_t>(state.range(2)) / 100.f};
+
+    vecmem::host_memory_resource host_mr;
+    counting_memory_resource counting_mr{host_mr};
+
+    const auto toy_cfg = make_config(n_layers, module_scale, grid_scale);
+    auto [det, names] = build_toy_detector(counting_mr, toy_cfg);
+
+    using detector_t = decltype(det);
+    using navigator_t = navigator<detector_t>;
+    using stepper_t = line_stepper<algebra_t>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain<>>;
+
+    const navigation::config<scalar_t> nav_cfg{};
+    const navigator_t nav{};
+
+    // Set up the propagation states of the track batch up front, so that
+    // only the navigation initialization is timed
+    auto trk_generator = trk_generator_t{};
+    trk_generator.config().theta_steps(theta_steps).phi_steps(phi_steps);
+
+    std::vector<typename propagator_t::state> propagations;
+    propagations.reserve(trk_generator.size());
+    for (const auto track : trk_generator) {
+        propagations.emplace_back(track, det);
+    }
+
+    std::size_t n_candidates{0u};
+
+    test::perf_counters perf{};
+    perf.start();
+    for (auto _ : state) {
+        for (auto &propagation : propagations) {
+            benchmark::DoNotOptimize(nav.init(propagation, nav_cfg));
+            n_candidates += propagation._navigation.candidates().size();
+        }
+        benchmark::ClobberMemory();
+    }
+    perf.stop(state);
+
+    const auto n_inits{static_cast<double>(propagations.size())};
+
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(propagations.size()));
+    state.counters["t_per_init"] = benchmark::Counter(
+        n_inits, benchmark::Counter::kIsIterationInvariantRate |
+                     benchmark::Counter::kInvert);
+    state.counters["candidates"] = benchmark::Counter(
+        static_cast<double>(n_candidates) / n_inits,
+        benchmark::Counter::kAvgIterations);
+    state.counters["surfaces"] = static_cast<double>(det.surfaces().size());
+    state.counters["det_bytes"] = benchmark::Counter(
+        static_cast<double>(counting_mr.bytes()), benchmark::Counter::kDefaults,
+        benchmark::Counter::kIs1024);
+}
+
+BENCHMARK(BM_DETECTOR_SCALING)
+    ->Name("BM_DETECTOR_SCALING")
+    ->ArgNames({"layers", "modules", "grid"})
+    ->ArgsProduct({{1, 2, 3, 4}, {50, 100, 200}, {25, 100, 400}})
+    ->Unit(benchmark::kMicrosecond);
@@ -1,6 +1,6 @@
 /** Detray library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2023 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -24,29 +24,19 @@ using namespace detray;
 // Benchmarks the cost of searching a volume by position
 void BM_FIND_VOLUMES(benchmark::State &state) {
 
-    // This test is broken at the moment, don't run it.
-    state.SkipWithError("Benchmark disabled for the toy geometry");
-    return;
-
     // Detector configuration
     vecmem::host_memory_resource host_mr;
     toy_det_config<scalar> toy_cfg{};
     toy_cfg.n_edc_layers(7u);
     auto [d, names] = build_toy_detector(host_mr, toy_cfg);
 
-    static const unsigned int itest = 10000u;
-
-    auto &volume_grid = d.volume_search_grid();
-
-    const auto &axis_r = volume_grid.get_axis<axis::label::e_r>();
-    const auto &axis_z = volume_grid.get_axis<axis::label::e_z>();
+    static const unsigned int itest = 1000u;
 
-    // Get a rough step size from irregular axes
-    auto range0 = axis_r.span();
-    auto range1 = axis_z.span();
+    // Extent of the coarse grid of the volume finder
+    const auto &axes = d.volume_search_grid().axes();
 
-    scalar step0{(range0[1] - range0[0]) / itest};
-    scalar step1{(range1[1] - range1[0]) / itest};
+    scalar step0{(axes.r_max - axes.r_min) / itest};
+    scalar step1{(axes.z_max - axes.z_min) / itest};
 
     std::size_t successful{0u};
     std::size_t unsuccessful{0u};
@@ -54,13 +44,14 @@ void BM_FIND_VOLUMES(benchmark::State &state) {
     for (auto _ : state) {
         for (unsigned int i1 = 0u; i1 < itest; ++i1) {
             for (unsigned int i0 = 0u; i0 < itest; ++i0) {
-                test::vector3 rz{static_cast<scalar>(i0) * step0, 0.f,
-                                 static_cast<scalar>(i1) * step1};
-                const auto &v = d.volume(rz);
+                test::point3 rz{
+                    axes.r_min + static_cast<scalar>(i0) * step0, 0.f,
+                    axes.z_min + static_cast<scalar>(i1) * step1};
+                const dindex vol_idx{d.volume_search_grid().search(rz)};
 
                 benchmark::DoNotOptimize(successful);
                 benchmark::DoNotOptimize(unsuccessful);
-                if (v.index() == dindex_invalid) {
+                if (vol_idx == dindex_invalid) {
                     ++unsuccessful;
                 } else {
                     ++successful;
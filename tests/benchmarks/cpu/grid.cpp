@@ -11,10 +11,12 @@
 #include "detray/builders/grid_factory.hpp"
 #include "detray/definitions/detail/containers.hpp"
 #include "detray/definitions/detail/indexing.hpp"
+#include "detray/geometry/shapes/cuboid3D.hpp"
 #include "detray/geometry/shapes/rectangle2D.hpp"
 
 // Detray test include(s).
 #include "detray/test/types.hpp"
+#include "detray/test/utils/perf_counters.hpp"
 
 // VecMem include(s).
 #include <vecmem/memory/host_memory_resource.hpp>
@@ -25,6 +27,7 @@
 // System include(s)
 #include <cstdlib>
 #include <iostream>
+#include <utility>
 #include <vector>
 
 // Use the detray:: namespace implicitly.
@@ -51,12 +54,28 @@ auto make_random_points() {
     return points;
 }
 
+/// Prepare 3D test points
+auto make_random_points3D() {
+
+    std::srand(42);
+
+    std::vector<test::point3> points{};
+    for (unsigned int itest = 0u; itest < 1000000u; ++itest) {
+        points.push_back({static_cast<scalar>((std::rand() % 100)) * 0.5f,
+                          static_cast<scalar>((std::rand() % 100)) * 0.5f,
+                          static_cast<scalar>((std::rand() % 100)) * 0.5f});
+    }
+
+    return points;
+}
+
 /// Make a regular grid for the tests.
-template <typename bin_t>
+template <typename bin_t,
+          template <std::size_t> class serializer_t = simple_serializer>
 auto make_regular_grid(vecmem::memory_resource &mr) {
 
     // Data-owning grids with bin capacity 1
-    auto gr_factory = grid_factory<bin_t, simple_serializer>{mr};
+    auto gr_factory = grid_factory<bin_t, serializer_t>{mr};
 
     // Spans of the axes
     std::vector<scalar> spans = {0.f, 25.f, 0.f, 60.f};
@@ -71,6 +90,26 @@ auto make_regular_grid(vecmem::memory_resource &mr) {
         types::list<axis::regular<>, axis::regular<>>{});
 }
 
+/// Make a regular 3D grid for the tests.
+template <typename bin_t, template <std::size_t> class serializer_t>
+auto make_regular_grid3D(vecmem::memory_resource &mr) {
+
+    auto gr_factory = grid_factory<bin_t, serializer_t>{mr};
+
+    // Spans of the axes
+    std::vector<scalar> spans = {0.f, 50.f, 0.f, 50.f, 0.f, 50.f};
+    // #bins of the axes
+    std::vector<std::size_t> nbins = {50u, 50u, 50u};
+
+    // Cuboid grid with closed bin bounds and regular binning on all axes
+    return gr_factory.template new_grid<cuboid3D>(
+        spans, nbins, {}, {},
+        types::list<axis::closed<axis::label::e_x>,
+                    axis::closed<axis::label::e_y>,
+                    axis::closed<axis::label::e_z>>{},
+        types::list<axis::regular<>, axis::regular<>, axis::regular<>>{});
+}
+
 /// Make an irregular grid for the tests.
 template <typename bin_t>
 auto make_irregular_grid(vecmem::memory_resource &mr) {
@@ -120,11 +159,14 @@ void BM_GRID_REGULAR_BIN_CAP1(benchmark::State &state) {
     // Prepare test points
     auto points = make_random_points();
 
+    test::perf_counters perf{};
+    perf.start();
     for (auto _ : state) {
         for (const auto &p : points) {
             benchmark::DoNotOptimize(*g2r.search(p));
         }
     }
+    perf.stop(state);
 
 #ifdef DETRAY_BENCHMARK_PRINTOUTS
     std::cout << "BM_GRID_REGULAR_BIN_CAP1:" << std::endl;
@@ -142,6 +184,8 @@ void BM_GRID_REGULAR_BIN_CAP4(benchmark::State &state) {
 
     auto points = make_random_points();
 
+    test::perf_counters perf{};
+    perf.start();
     for (auto _ : state) {
         for (const auto &p : points) {
             for (const dindex entry : g2r.search(p)) {
@@ -149,6 +193,7 @@ void BM_GRID_REGULAR_BIN_CAP4(benchmark::State &state) {
             }
         }
     }
+    perf.stop(state);
 
 #ifdef DETRAY_BENCHMARK_PRINTOUTS
     std::cout << "BM_GRID_REGULAR_BIN_CAP4:" << std::endl;
@@ -171,6 +216,8 @@ void BM_GRID_REGULAR_BIN_CAP25(benchmark::State &state) {
 
     auto points = make_random_points();
 
+    test::perf_counters perf{};
+    perf.start();
     for (auto _ : state) {
         for (const auto &p : points) {
             for (const dindex entry : g2r.search(p)) {
@@ -178,6 +225,7 @@ void BM_GRID_REGULAR_BIN_CAP25(benchmark::State &state) {
             }
         }
     }
+    perf.stop(state);
 
 #ifdef DETRAY_BENCHMARK_PRINTOUTS
     std::cout << "BM_GRID_REGULAR_BIN_CAP25:" << std::endl;
@@ -200,6 +248,8 @@ void BM_GRID_REGULAR_BIN_CAP100(benchmark::State &state) {
 
     auto points = make_random_points();
 
+    test::perf_counters perf{};
+    perf.start();
     for (auto _ : state) {
         for (const auto &p : points) {
             for (const dindex entry : g2r.search(p)) {
@@ -207,6 +257,7 @@ void BM_GRID_REGULAR_BIN_CAP100(benchmark::State &state) {
             }
         }
     }
+    perf.stop(state);
 
 #ifdef DETRAY_BENCHMARK_PRINTOUTS
     std::cout << "BM_GRID_REGULAR_BIN_CAP100:" << std::endl;
@@ -231,6 +282,8 @@ void BM_GRID_REGULAR_NEIGHBOR_CAP1(benchmark::State &state) {
     // Search window size.
     static const darray<dindex, 2> window = {2u, 2u};
 
+    test::perf_counters perf{};
+    perf.start();
     for (auto _ : state) {
         for (const auto &p : points) {
             for (const dindex entry : g2r.search(p, window)) {
@@ -238,6 +291,7 @@ void BM_GRID_REGULAR_NEIGHBOR_CAP1(benchmark::State &state) {
             }
         }
     }
+    perf.stop(state);
 
 #ifdef DETRAY_BENCHMARK_PRINTOUTS
     std::cout << "BM_GRID_REGULAR_NEIGHBOR_CAP1:" << std::endl;
@@ -262,6 +316,8 @@ void BM_GRID_REGULAR_NEIGHBOR_CAP4(benchmark::State &state) {
     // Search window size.
     static const darray<dindex, 2> window = {2u, 2u};
 
+    test::perf_counters perf{};
+    perf.start();
     for (auto _ : state) {
         for (const auto &p : points) {
             for (const dindex entry : g2r.search(p, window)) {
@@ -269,6 +325,7 @@ void BM_GRID_REGULAR_NEIGHBOR_CAP4(benchmark::State &state) {
             }
         }
     }
+    perf.stop(state);
 
 #ifdef DETRAY_BENCHMARK_PRINTOUTS
     std::cout << "BM_GRID_REGULAR_NEIGHBOR_CAP4:" << std::endl;
@@ -281,6 +338,148 @@ void BM_GRID_REGULAR_NEIGHBOR_CAP4(benchmark::State &state) {
 #endif  // DETRAY_BENCHMARK_PRINTOUTS
 }
 
+void BM_GRID_REGULAR_NEIGHBOR_AXIS_CAP4(benchmark::State &state) {
+
+    // Set up the tested grid object.
+    vecmem::host_memory_resource host_mr;
+    auto g2r = make_regular_grid<bins::static_array<dindex, 4>>(host_mr);
+    populate_grid<complete<>>(g2r);
+
+    auto points = make_random_points();
+
+    // Search window size: different on every axis
+    static const darray<darray<dindex, 2>, 2> window = {{{1u, 1u}, {0u, 3u}}};
+
+    test::perf_counters perf{};
+    perf.start();
+    for (auto _ : state) {
+        for (const auto &p : points) {
+            for (const dindex entry : g2r.search(p, window)) {
+                benchmark::DoNotOptimize(entry);
+            }
+        }
+    }
+    perf.stop(state);
+
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+    std::cout << "BM_GRID_REGULAR_NEIGHBOR_AXIS_CAP4:" << std::endl;
+    std::size_t count{0u};
+    for (const dindex entry : g2r.search(tp, window)) {
+        std::cout << entry << ", ";
+        ++count;
+    }
+    std::cout << "\n=> Neighbors: " << count << std::endl;
+#endif  // DETRAY_BENCHMARK_PRINTOUTS
+}
+
+void BM_GRID_REGULAR_NEIGHBOR_CSR(benchmark::State &state) {
+
+    // Set up the tested grid object: Same content as for the CAP4 test, but
+    // in a compressed bin storage
+    vecmem::host_memory_resource host_mr;
+    auto g2r_ref = make_regular_grid<bins::static_array<dindex, 4>>(host_mr);
+    populate_grid<complete<>>(g2r_ref);
+
+    using ref_grid_t = decltype(g2r_ref);
+    using grid_t = grid_impl<typename ref_grid_t::axes_type,
+                             bins::csr_array<dindex>, simple_serializer>;
+
+    typename grid_t::bin_container_type bin_data{&host_mr};
+    bin_data.append(g2r_ref.bins());
+    typename grid_t::axes_type axes(g2r_ref.axes());
+    grid_t g2r(std::move(bin_data), std::move(axes));
+
+    auto points = make_random_points();
+
+    // Search window size.
+    static const darray<dindex, 2> window = {2u, 2u};
+
+    test::perf_counters perf{};
+    perf.start();
+    for (auto _ : state) {
+        for (const auto &p : points) {
+            for (const dindex entry : g2r.search(p, window)) {
+                benchmark::DoNotOptimize(entry);
+            }
+        }
+    }
+    perf.stop(state);
+
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+    std::cout << "BM_GRID_REGULAR_NEIGHBOR_CSR:" << std::endl;
+    std::size_t count{0u};
+    for (const dindex entry : g2r.search(tp, window)) {
+        std::cout << entry << ", ";
+        ++count;
+    }
+    std::cout << "\n=> Neighbors: " << count << std::endl;
+#endif  // DETRAY_BENCHMARK_PRINTOUTS
+}
+
+void BM_GRID_REGULAR_NEIGHBOR_MORTON(benchmark::State &state) {
+
+    // Set up the tested grid object: Same content as for the CAP4 test, but
+    // the bins are laid out along a Morton curve
+    vecmem::host_memory_resource host_mr;
+    auto g2r = make_regular_grid<bins::static_array<dindex, 4>,
+                                 morton_serializer>(host_mr);
+    populate_grid<complete<>>(g2r);
+
+    auto points = make_random_points();
+
+    // Search window size.
+    static const darray<dindex, 2> window = {2u, 2u};
+
+    test::perf_counters perf{};
+    perf.start();
+    for (auto _ : state) {
+        for (const auto &p : points) {
+            for (const dindex entry : g2r.search(p, window)) {
+                benchmark::DoNotOptimize(entry);
+            }
+        }
+    }
+    perf.stop(state);
+
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+    std::cout << "BM_GRID_REGULAR_NEIGHBOR_MORTON:" << std::endl;
+    std::size_t count{0u};
+    for (const dindex entry : g2r.search(tp, window)) {
+        std::cout << entry << ", ";
+        ++count;
+    }
+    std::cout << "\n=> Neighbors: " << count << std::endl;
+#endif  // DETRAY_BENCHMARK_PRINTOUTS
+}
+
+// Neighborhood lookup in a 3D grid that is larger than the L2 cache, for the
+// row-major and the Morton bin layout
+template <template <std::size_t> class serializer_t>
+void BM_GRID_REGULAR3D_NEIGHBOR_CAP4(benchmark::State &state) {
+
+    // Set up the tested grid object.
+    vecmem::host_memory_resource host_mr;
+    auto g3r = make_regular_grid3D<bins::static_array<dindex, 4>,
+                                   serializer_t>(host_mr);
+    populate_grid<complete<>>(g3r);
+
+    auto points = make_random_points3D();
+
+    // Search window size.
+    static const darray<dindex, 2> window = {1u, 1u};
+
+    test::perf_counters perf{};
+    perf.start();
+    for (auto _ : state) {
+        for (const auto &p : points) {
+            for (const dindex entry : g3r.search(p, window)) {
+                benchmark::DoNotOptimize(entry);
+            }
+        }
+    }
+    perf.stop(state);
+}
+
 // This runs a reference test with a irregular grid structure
 void BM_GRID_IRREGULAR_BIN_CAP1(benchmark::State &state) {
 
@@ -291,11 +490,14 @@ void BM_GRID_IRREGULAR_BIN_CAP1(benchmark::State &state) {
 
     auto points = make_random_points();
 
+    test::perf_counters perf{};
+    perf.start();
     for (auto _ : state) {
         for (const auto &p : points) {
             benchmark::DoNotOptimize(*g2irr.search(p));
         }
     }
+    perf.stop(state);
 
 #ifdef DETRAY_BENCHMARK_PRINTOUTS
     std::cout << "BM_GRID_IRREGULAR_BIN_CAP1:" << std::endl;
@@ -315,6 +517,8 @@ void BM_GRID_IRREGULAR_NEIGHBOR_CAP1(benchmark::State &state) {
     // Search window size.
     static const darray<dindex, 2> window = {2u, 2u};
 
+    test::perf_counters perf{};
+    perf.start();
     for (auto _ : state) {
         for (const auto &p : points) {
             for (const dindex entry : g2irr.search(p, window)) {
@@ -322,6 +526,7 @@ void BM_GRID_IRREGULAR_NEIGHBOR_CAP1(benchmark::State &state) {
             }
         }
     }
+    perf.stop(state);
 
 #ifdef DETRAY_BENCHMARK_PRINTOUTS
     std::cout << "BM_GRID_IRREGULAR_NEIGHBOR_CAP1:" << std::endl;
@@ -376,6 +581,41 @@ BENCHMARK(BM_GRID_REGULAR_NEIGHBOR_CAP4)
     ->MeasureProcessCPUTime()
     ->Unit(benchmark::kMillisecond);
 
+BENCHMARK(BM_GRID_REGULAR_NEIGHBOR_AXIS_CAP4)
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->MeasureProcessCPUTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_GRID_REGULAR_NEIGHBOR_CSR)
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->MeasureProcessCPUTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_GRID_REGULAR_NEIGHBOR_MORTON)
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->MeasureProcessCPUTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE(BM_GRID_REGULAR3D_NEIGHBOR_CAP4, simple_serializer)
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->MeasureProcessCPUTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE(BM_GRID_REGULAR3D_NEIGHBOR_CAP4, morton_serializer)
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->MeasureProcessCPUTime()
+    ->Unit(benchmark::kMillisecond);
+
 BENCHMARK(BM_GRID_IRREGULAR_BIN_CAP1)
 #ifdef DETRAY_BENCHMARK_MULTITHREAD
     ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
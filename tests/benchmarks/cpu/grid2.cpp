@@ -277,6 +277,38 @@ void BM_GRID2_REGULAR_NEIGHBOR_CAP4(benchmark::State &state) {
 }
 
 // This runs a reference test with a irregular grid structure
+void BM_GRID2_REGULAR_NEIGHBOR_AXIS_CAP4(benchmark::State &state) {
+
+    // Set up the tested grid object.
+    vecmem::host_memory_resource host_mr;
+    auto g2r = make_regular_grid<4u, complete_populator>(host_mr);
+    populate_grid(g2r, 4u);
+
+    auto points = make_random_points();
+
+    // Helper zone objects: different on every axis
+    static const darray<dindex, 2> zone11 = {1u, 1u};
+    static const darray<dindex, 2> zone03 = {0u, 3u};
+
+    for (auto _ : state) {
+        for (const auto &p : points) {
+            for (const dindex entry : g2r.zone(p, {zone11, zone03})) {
+                benchmark::DoNotOptimize(entry);
+            }
+        }
+    }
+
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+    std::cout << "BM_GRID2_REGULAR_NEIGHBOR_AXIS_CAP4:" << std::endl;
+    std::size_t count{0u};
+    for (const dindex entry : g2r.zone(tp, {zone11, zone03})) {
+        std::cout << entry << ", ";
+        ++count;
+    }
+    std::cout << "\n=> Neighbors: " << count << std::endl;
+#endif  // DETRAY_BENCHMARK_PRINTOUTS
+}
+
 void BM_GRID2_IRREGULAR_BIN_CAP1(benchmark::State &state) {
 
     // Set up the tested grid object.
@@ -371,6 +403,13 @@ BENCHMARK(BM_GRID2_REGULAR_NEIGHBOR_CAP4)
     ->MeasureProcessCPUTime()
     ->Unit(benchmark::kMillisecond);
 
+BENCHMARK(BM_GRID2_REGULAR_NEIGHBOR_AXIS_CAP4)
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->MeasureProcessCPUTime()
+    ->Unit(benchmark::kMillisecond);
+
 BENCHMARK(BM_GRID2_IRREGULAR_BIN_CAP1)
 #ifdef DETRAY_BENCHMARK_MULTITHREAD
     ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
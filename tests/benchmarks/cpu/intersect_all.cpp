@@ -8,6 +8,8 @@
 // Project include(s)
 #include "detray/core/detector.hpp"
 #include "detray/detectors/build_toy_detector.hpp"
+#include "detray/geometry/mask.hpp"
+#include "detray/geometry/shapes/unbounded.hpp"
 #include "detray/geometry/surface.hpp"
 #include "detray/navigation/detail/ray.hpp"
 #include "detray/navigation/intersection/ray_intersector.hpp"
@@ -24,6 +26,7 @@
 #include <benchmark/benchmark.h>
 
 // System include(s)
+#include <array>
 #include <iostream>
 #include <map>
 #include <string>
@@ -37,6 +40,38 @@ using trk_generator_t =
 constexpr unsigned int theta_steps{100u};
 constexpr unsigned int phi_steps{100u};
 
+namespace {
+
+/// Intersect the surface as if its masks were unbounded
+struct intersect_unbounded {
+
+    template <typename mask_group_t, typename mask_range_t,
+              typename is_container_t, typename traj_t, typename sf_desc_t,
+              typename transform_container_t>
+    inline void operator()(const mask_group_t &mask_group,
+                           const mask_range_t &mask_range,
+                           is_container_t &is_container, const traj_t &traj,
+                           const sf_desc_t &surface,
+                           const transform_container_t &transforms) const {
+
+        using mask_t = typename mask_group_t::value_type;
+        using algebra_t = typename mask_t::algebra_type;
+        using unbounded_mask_t = mask<unbounded<typename mask_t::shape>,
+                                      typename mask_t::links_type, algebra_t>;
+
+        const auto &m =
+            *detray::ranges::subrange(mask_group, mask_range).begin();
+        const std::array<unbounded_mask_t, 1> ub_masks{
+            unbounded_mask_t{m.values(), m.volume_link()}};
+
+        intersection_initialize<ray_intersector>{}(
+            ub_masks, dindex_range{0u, 1u}, is_container, traj, surface,
+            transforms, 0.f, 0.f);
+    }
+};
+
+}  // anonymous namespace
+
 // This test runs intersection with all surfaces of the TrackML detector
 void BM_INTERSECT_ALL(benchmark::State &state) {
 
@@ -103,3 +138,89 @@ BENCHMARK(BM_INTERSECT_ALL)
     ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
 #endif
     ->Unit(benchmark::kMillisecond);
+
+// This test runs intersection with all portals of the TrackML detector, once
+// with their regular masks and once without boundary checks
+template <bool unbounded_portals>
+void BM_INTERSECT_PORTALS(benchmark::State &state) {
+
+    // Detector configuration
+    vecmem::host_memory_resource host_mr;
+    toy_det_config<test::scalar> toy_cfg{};
+    toy_cfg.n_edc_layers(7u);
+    auto [d, names] = build_toy_detector(host_mr, toy_cfg);
+
+    using detector_t = decltype(d);
+    using sf_desc_t = typename detector_t::surface_type;
+
+    detector_t::geometry_context geo_context;
+
+    const auto &transforms = d.transform_store(geo_context);
+
+    std::size_t hits{0u};
+    std::size_t missed{0u};
+    std::size_t n_surfaces{0u};
+    test::point3 origin{0.f, 0.f, 0.f};
+    std::vector<intersection2D<sf_desc_t, typename detector_t::algebra_type>>
+        intersections{};
+
+    // Iterate through uniformly distributed momentum directions
+    auto trk_generator = trk_generator_t{};
+    trk_generator.config()
+        .theta_steps(theta_steps)
+        .phi_steps(phi_steps)
+        .origin(origin);
+
+    for (auto _ : state) {
+
+        for (const auto track : trk_generator) {
+
+            // Loop over all portals in detector
+            for (const sf_desc_t &sf_desc : d.surfaces()) {
+                const auto sf = surface{d, sf_desc};
+                if (!sf.is_portal()) {
+                    continue;
+                }
+                if constexpr (unbounded_portals) {
+                    sf.template visit_mask<intersect_unbounded>(
+                        intersections, detail::ray(track), sf_desc,
+                        transforms);
+                } else {
+                    sf.template visit_mask<
+                        intersection_initialize<ray_intersector>>(
+                        intersections, detail::ray(track), sf_desc,
+                        transforms, 0.f, 0.f);
+                }
+
+                ++n_surfaces;
+            }
+            benchmark::DoNotOptimize(hits);
+            benchmark::DoNotOptimize(missed);
+
+            hits += intersections.size();
+            missed += n_surfaces - intersections.size();
+
+            n_surfaces = 0u;
+            intersections.clear();
+        }
+    }
+
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+    std::cout << "[detray] hits / missed / total = " << hits << " / " << missed
+              << " / " << hits + missed << std::endl;
+#endif  // DETRAY_BENCHMARK_PRINTOUTS
+}
+
+BENCHMARK_TEMPLATE(BM_INTERSECT_PORTALS, false)
+    ->Name("BM_INTERSECT_PORTALS")
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE(BM_INTERSECT_PORTALS, true)
+    ->Name("BM_INTERSECT_PORTALS_UNBOUNDED")
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->Unit(benchmark::kMillisecond);
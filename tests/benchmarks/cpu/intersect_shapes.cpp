@@ -0,0 +1,232 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Detray core include(s).
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/geometry/detail/surface_descriptor.hpp"
+#include "detray/geometry/mask.hpp"
+#include "detray/geometry/shapes.hpp"
+#include "detray/geometry/shapes/unmasked.hpp"
+#include "detray/navigation/detail/helix.hpp"
+#include "detray/navigation/detail/ray.hpp"
+#include "detray/navigation/intersection/helix_intersector.hpp"
+#include "detray/navigation/intersection/intersection.hpp"
+#include "detray/navigation/intersection/ray_intersector.hpp"
+
+// Google Benchmark include(s)
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+// Use the detray:: namespace implicitly.
+using namespace detray;
+
+/// Intersection benchmarks for every surface shape, with the ray and the
+/// helix intersectors, in single and double precision.
+///
+/// The benchmark executable is built once per algebra plugin, which completes
+/// the matrix. Every benchmark reports the time per intersection
+/// ('t_per_intersection') and the fraction of intersections that hit the
+/// mask ('hit_efficiency'). For regression tracking, run with e.g.
+/// '--benchmark_filter=BM_INTERSECT_SHAPE --benchmark_format=json
+/// --benchmark_out=<file>.json'.
+
+namespace {
+
+constexpr unsigned int theta_steps{50u};
+constexpr unsigned int phi_steps{50u};
+constexpr unsigned int n_surfaces{10u};
+
+/// @returns a mask of the shape @tparam shape_t that scales with the distance
+/// @param d of the surface to the origin
+template <typename shape_t, typename algebra_t>
+auto make_mask(const dscalar<algebra_t> d) {
+
+    using scalar_t = dscalar<algebra_t>;
+    using mask_t = mask<shape_t, std::uint_least16_t, algebra_t>;
+
+    if constexpr (std::is_same_v<shape_t, rectangle2D>) {
+        return mask_t{0u, d, d};
+    } else if constexpr (std::is_same_v<shape_t, trapezoid2D>) {
+        return mask_t{0u, scalar_t{0.5f} * d, d, d, scalar_t{1.f} / (2.f * d)};
+    } else if constexpr (std::is_same_v<shape_t, ring2D>) {
+        return mask_t{0u, scalar_t{0.2f} * d, d};
+    } else if constexpr (std::is_same_v<shape_t, annulus2D>) {
+        const scalar_t s{scalar_t{0.1f} * d};
+        return mask_t{0u,
+                      scalar_t{7.2f} * s,
+                      scalar_t{12.f} * s,
+                      scalar_t{0.74195f},
+                      scalar_t{1.33970f},
+                      scalar_t{0.f},
+                      scalar_t{-2.f} * s,
+                      scalar_t{2.f} * s};
+    } else if constexpr (std::is_same_v<shape_t, cylinder2D> ||
+                         std::is_same_v<shape_t, concentric_cylinder2D>) {
+        return mask_t{0u, d, -d, d};
+    } else if constexpr (std::is_same_v<shape_t, line_circular> ||
+                         std::is_same_v<shape_t, line_square>) {
+        return mask_t{0u, scalar_t{0.5f} * d, d};
+    } else {
+        // Unbounded shapes
+        return mask_t{0u};
+    }
+}
+
+/// @returns the placement of the surface with distance @param d to the
+/// origin: cylinders around the z-axis, lines parallel to the z-axis and
+/// planes perpendicular to it
+template <typename shape_t, typename algebra_t>
+dtransform3D<algebra_t> make_transform(const dscalar<algebra_t> d) {
+
+    using vector3_t = dvector3D<algebra_t>;
+
+    if constexpr (std::is_same_v<shape_t, cylinder2D> ||
+                  std::is_same_v<shape_t, concentric_cylinder2D>) {
+        return dtransform3D<algebra_t>{};
+    } else if constexpr (std::is_same_v<shape_t, line_circular> ||
+                         std::is_same_v<shape_t, line_square>) {
+        return dtransform3D<algebra_t>{vector3_t{d, 0.f, 0.f}};
+    } else {
+        return dtransform3D<algebra_t>{vector3_t{0.f, 0.f, d}};
+    }
+}
+
+/// Count the intersections that are inside of the mask
+/// @{
+template <typename intersection_t>
+inline void count_hits(const intersection_t &is, std::size_t &n_hits,
+                       std::size_t &n_is) {
+    ++n_is;
+    if (is.status == intersection::status::e_inside) {
+        ++n_hits;
+    }
+}
+
+template <typename intersection_t, std::size_t N>
+inline void count_hits(const std::array<intersection_t, N> &is,
+                       std::size_t &n_hits, std::size_t &n_is) {
+    for (const auto &sfi : is) {
+        count_hits(sfi, n_hits, n_is);
+    }
+}
+/// @}
+
+}  // anonymous namespace
+
+/// This benchmark intersects the surfaces of a given shape with uniformly
+/// distributed rays or helices, using the algebra plugin in the precision
+/// @tparam scalar_t
+template <typename scalar_t, typename shape_t, bool use_helix>
+void BM_INTERSECT_SHAPE(benchmark::State &state) {
+
+    using algebra_t = ALGEBRA_PLUGIN<scalar_t>;
+    using point3_t = dpoint3D<algebra_t>;
+    using vector3_t = dvector3D<algebra_t>;
+    using trajectory_t = std::conditional_t<use_helix, detail::helix<algebra_t>,
+                                            detail::ray<algebra_t>>;
+    using intersector_t =
+        std::conditional_t<use_helix, helix_intersector<shape_t, algebra_t>,
+                           ray_intersector<shape_t, algebra_t>>;
+    using mask_t = mask<shape_t, std::uint_least16_t, algebra_t>;
+
+    // The surfaces
+    const surface_descriptor<> sf_desc{};
+    dvector<mask_t> masks;
+    dvector<dtransform3D<algebra_t>> transforms;
+    for (unsigned int i = 1u; i <= n_surfaces; ++i) {
+        const scalar_t d{static_cast<scalar_t>(i) * 100.f * unit<scalar_t>::mm};
+        masks.push_back(make_mask<shape_t, algebra_t>(d));
+        transforms.push_back(make_transform<shape_t, algebra_t>(d));
+    }
+
+    // The trajectories (1 GeV tracks in a 2T field for the helix)
+    const point3_t ori{0.f, 0.f, 0.f};
+    const vector3_t B{0.f, 0.f, 2.f * unit<scalar_t>::T};
+    const scalar_t qop{-1.f / unit<scalar_t>::GeV};
+
+    dvector<trajectory_t> trajectories;
+    for (unsigned int i = 0u; i < theta_steps; ++i) {
+        const scalar_t theta{constant<scalar_t>::pi *
+                             (static_cast<scalar_t>(i) + 0.5f) /
+                             static_cast<scalar_t>(theta_steps)};
+        for (unsigned int j = 0u; j < phi_steps; ++j) {
+            const scalar_t phi{-constant<scalar_t>::pi +
+                               2.f * constant<scalar_t>::pi *
+                                   static_cast<scalar_t>(j) /
+                                   static_cast<scalar_t>(phi_steps)};
+
+            const vector3_t dir{math::cos(phi) * math::sin(theta),
+                                math::sin(phi) * math::sin(theta),
+                                math::cos(theta)};
+            if constexpr (use_helix) {
+                trajectories.emplace_back(ori, 0.f, dir, qop, &B);
+            } else {
+                trajectories.emplace_back(ori, 0.f, dir, qop);
+            }
+        }
+    }
+
+    const intersector_t intersector{};
+
+    std::size_t n_hits{0u};
+    std::size_t n_is{0u};
+
+    for (auto _ : state) {
+        for (const auto &traj : trajectories) {
+            for (std::size_t i = 0u; i < masks.size(); ++i) {
+                const auto is =
+                    intersector(traj, sf_desc, masks[i], transforms[i]);
+
+                benchmark::DoNotOptimize(is);
+                count_hits(is, n_hits, n_is);
+            }
+        }
+    }
+
+    const auto n_calls{static_cast<double>(trajectories.size() * masks.size())};
+
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(n_calls));
+    state.counters["t_per_intersection"] = benchmark::Counter(
+        n_calls, benchmark::Counter::kIsIterationInvariantRate |
+                     benchmark::Counter::kInvert);
+    state.counters["hit_efficiency"] = benchmark::Counter(
+        static_cast<double>(n_hits) /
+        static_cast<double>(n_is > 0u ? n_is : 1u));
+}
+
+// Register the ray and helix benchmarks for a shape in float and double
+#define DETRAY_INTERSECT_SHAPE_BENCHMARKS(SHAPE)                            \
+    BENCHMARK_TEMPLATE(BM_INTERSECT_SHAPE, float, SHAPE, false)             \
+        ->Name("BM_INTERSECT_SHAPE/ray/" #SHAPE "/float")                   \
+        ->Unit(benchmark::kMicrosecond);                                    \
+    BENCHMARK_TEMPLATE(BM_INTERSECT_SHAPE, double, SHAPE, false)            \
+        ->Name("BM_INTERSECT_SHAPE/ray/" #SHAPE "/double")                  \
+        ->Unit(benchmark::kMicrosecond);                                    \
+    BENCHMARK_TEMPLATE(BM_INTERSECT_SHAPE, float, SHAPE, true)              \
+        ->Name("BM_INTERSECT_SHAPE/helix/" #SHAPE "/float")                 \
+        ->Unit(benchmark::kMicrosecond);                                    \
+    BENCHMARK_TEMPLATE(BM_INTERSECT_SHAPE, double, SHAPE, true)             \
+        ->Name("BM_INTERSECT_SHAPE/helix/" #SHAPE "/double")                \
+        ->Unit(benchmark::kMicrosecond);
+
+DETRAY_INTERSECT_SHAPE_BENCHMARKS(rectangle2D)
+DETRAY_INTERSECT_SHAPE_BENCHMARKS(trapezoid2D)
+DETRAY_INTERSECT_SHAPE_BENCHMARKS(ring2D)
+DETRAY_INTERSECT_SHAPE_BENCHMARKS(annulus2D)
+DETRAY_INTERSECT_SHAPE_BENCHMARKS(cylinder2D)
+DETRAY_INTERSECT_SHAPE_BENCHMARKS(concentric_cylinder2D)
+DETRAY_INTERSECT_SHAPE_BENCHMARKS(line_circular)
+DETRAY_INTERSECT_SHAPE_BENCHMARKS(line_square)
+DETRAY_INTERSECT_SHAPE_BENCHMARKS(unmasked<>)
@@ -11,9 +11,14 @@
 #include "detray/geometry/detail/surface_descriptor.hpp"
 #include "detray/geometry/mask.hpp"
 #include "detray/geometry/shapes.hpp"
+#include "detray/navigation/detail/helix.hpp"
 #include "detray/navigation/detail/ray.hpp"
+#include "detray/navigation/intersection/helix_intersector.hpp"
 #include "detray/navigation/intersection/ray_concentric_cylinder_intersector.hpp"
 #include "detray/navigation/intersection/ray_intersector.hpp"
+#include "detray/navigation/intersection/ray_plane_batch_intersector.hpp"
+#include "detray/navigation/intersection_kernel.hpp"
+#include "detray/tracks/tracks.hpp"
 
 // Detray utility include(s).
 #include "detray/simulation/event_generator/track_generators.hpp"
@@ -28,6 +33,8 @@
 using namespace detray;
 
 using ray_generator_t = uniform_track_generator<detail::ray<test::algebra>>;
+using track_generator_t =
+    uniform_track_generator<free_track_parameters<test::algebra>>;
 
 static const unsigned int theta_steps = 100u;
 static const unsigned int phi_steps = 100u;
@@ -100,6 +107,75 @@ using plane_surface =
     surface_descriptor<mask_link_t, material_link_t, test::transform3>;
 using intersection_t = intersection2D<plane_surface, test::algebra>;
 
+/// This benchmark runs intersection with the batched planar intersector
+void BM_INTERSECT_PLANES_BATCHED(benchmark::State &state) {
+
+    using indexed_surface =
+        surface_descriptor<mask_link_t, material_link_t, dindex>;
+    using indexed_intersection_t =
+        intersection2D<indexed_surface, test::algebra>;
+
+    unsigned int sfhit = 0u;
+    unsigned int sfmiss = 0u;
+
+    const auto planes = test::planes_along_direction(
+        dists, vector::normalize(test::vector3{1.f, 1.f, 1.f}));
+    const dvector<mask<rectangle2D>> rects = {
+        mask<rectangle2D>{0u, 10.f, 20.f}};
+
+    // Same planes, but with the transforms in a separate container
+    dvector<test::transform3> transforms;
+    dvector<surface_batch<indexed_surface>> batches(1u);
+    for (const auto [idx, plane] : detray::views::enumerate(planes)) {
+        transforms.push_back(plane.transform());
+
+        indexed_surface sf{static_cast<dindex>(idx),
+                           mask_link_t{mask_ids::e_rectangle2, 0u},
+                           material_link_t{material_ids::e_slab, 0u}, 0u,
+                           surface_id::e_sensitive};
+        sf.set_index(static_cast<dindex>(idx));
+        if (!batches.back().push_back(sf)) {
+            batches.emplace_back();
+            batches.back().push_back(sf);
+        }
+    }
+
+    dvector<indexed_intersection_t> intersections;
+    intersections.reserve(planes.size());
+
+    // Iterate through uniformly distributed momentum directions
+    auto ray_generator = ray_generator_t{};
+    ray_generator.config().theta_steps(theta_steps).phi_steps(phi_steps);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sfhit);
+        benchmark::DoNotOptimize(sfmiss);
+
+        // Iterate through uniformly distributed momentum directions
+        for (const auto ray : ray_generator) {
+
+            intersections.clear();
+            for (const auto &batch : batches) {
+                intersection_initialize<ray_intersector>{}(
+                    rects, batch, intersections, ray, transforms, 0.f, 0.f);
+            }
+
+            benchmark::DoNotOptimize(sfhit);
+            benchmark::DoNotOptimize(sfmiss);
+            sfhit += static_cast<unsigned int>(intersections.size());
+            sfmiss += static_cast<unsigned int>(planes.size() -
+                                                intersections.size());
+            benchmark::ClobberMemory();
+        }
+    }
+}
+
+BENCHMARK(BM_INTERSECT_PLANES_BATCHED)
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->Unit(benchmark::kMillisecond);
+
 /// This benchmark runs intersection with the cylinder intersector
 void BM_INTERSECT_CYLINDERS(benchmark::State &state) {
 
@@ -256,3 +332,84 @@ BENCHMARK(BM_INTERSECT_CONCETRIC_CYLINDERS)
     ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
 #endif
     ->Unit(benchmark::kMillisecond);
+
+/// This benchmark runs intersection with the helix cylinder intersector and
+/// counts the Newton iterations (with or without polynomial starting points)
+template <bool polynomial_seed>
+void BM_INTERSECT_HELIX_CYLINDERS(benchmark::State &state) {
+
+    using cylinder_mask = mask<cylinder2D>;
+
+    unsigned int sfhit = 0u;
+    unsigned int sfmiss = 0u;
+    std::size_t n_iterations = 0u;
+    std::size_t n_calls = 0u;
+    dvector<cylinder_mask> cylinders;
+
+    for (test::scalar r : dists) {
+        cylinders.push_back(cylinder_mask{0u, r, -10.f, 10.f});
+    }
+
+    mask_link_t mask_link{mask_ids::e_cylinder2, 0};
+    material_link_t material_link{material_ids::e_slab, 0};
+    plane_surface plane(test::transform3(), mask_link, material_link, 0u,
+                        surface_id::e_sensitive);
+
+    // Low p_T tracks in a 2T field
+    const test::vector3 B{0.f, 0.f, 2.f * unit<test::scalar>::T};
+    auto trk_generator = track_generator_t{};
+    trk_generator.config()
+        .theta_steps(theta_steps)
+        .phi_steps(phi_steps)
+        .p_T(10.f * unit<test::scalar>::MeV);
+
+    auto hci = helix_intersector<cylinder2D, test::algebra>{};
+    hci.polynomial_seed = polynomial_seed;
+    hci.n_iterations = &n_iterations;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sfhit);
+        benchmark::DoNotOptimize(sfmiss);
+
+        // Iterate through uniformly distributed momentum directions
+        for (const auto track : trk_generator) {
+
+            const detail::helix<test::algebra> h(track, &B);
+
+            for (const auto &cylinder : cylinders) {
+                auto inters = hci(h, plane, cylinder, plane.transform());
+                ++n_calls;
+
+                benchmark::DoNotOptimize(sfhit);
+                benchmark::DoNotOptimize(sfmiss);
+                for (const auto &sfi : inters) {
+                    if (sfi.status == intersection::status::e_inside) {
+                        ++sfhit;
+                    } else {
+                        ++sfmiss;
+                    }
+                }
+                benchmark::ClobberMemory();
+            }
+        }
+    }
+
+    // Average number of Newton iterations per intersection call
+    state.counters["newton_its"] = benchmark::Counter(
+        static_cast<double>(n_iterations) /
+        static_cast<double>(n_calls > 0u ? n_calls : 1u));
+}
+
+BENCHMARK_TEMPLATE(BM_INTERSECT_HELIX_CYLINDERS, false)
+    ->Name("BM_INTERSECT_HELIX_CYLINDERS_LINE_SEED")
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE(BM_INTERSECT_HELIX_CYLINDERS, true)
+    ->Name("BM_INTERSECT_HELIX_CYLINDERS_POLYNOMIAL_SEED")
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->Unit(benchmark::kMillisecond);
@@ -1,14 +1,17 @@
 /** Detray library, part of the ACTS project (R&D line)
  *
- * (c) 2020-2023 CERN for the benefit of the ACTS project
+ * (c) 2020-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
 
 // Detray core include(s).
+#include "detray/core/detail/tuple_container.hpp"
 #include "detray/definitions/detail/indexing.hpp"
 #include "detray/geometry/mask.hpp"
 #include "detray/geometry/shapes.hpp"
+#include "detray/geometry/shapes/unbounded.hpp"
+#include "detray/geometry/shapes/unmasked.hpp"
 #include "detray/navigation/intersection/intersection.hpp"
 
 // Detray test include(s).
@@ -17,8 +20,14 @@
 // Google benchmark include(s).
 #include <benchmark/benchmark.h>
 
+// Vecmem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
 // System include(s).
 #include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
 
 // Use the detray:: namespace implicitly.
 using namespace detray;
@@ -611,3 +620,87 @@ BENCHMARK(BM_MASK_LINE_SQUARE)
     ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
 #endif
     ->Unit(benchmark::kMillisecond);
+
+namespace {
+
+/// Collection of many different mask types, as in a detector mask store
+using mask_tuple_t = detail::tuple_container<
+    dtuple, dvector<mask<rectangle2D>>, dvector<mask<trapezoid2D>>,
+    dvector<mask<annulus2D>>, dvector<mask<cylinder2D>>,
+    dvector<mask<concentric_cylinder2D>>, dvector<mask<ring2D>>,
+    dvector<mask<line_circular>>, dvector<mask<line_square>>,
+    dvector<mask<single3D<0>>>, dvector<mask<single3D<1>>>,
+    dvector<mask<single3D<2>>>, dvector<mask<cuboid3D>>,
+    dvector<mask<cylinder3D>>, dvector<mask<unbounded<rectangle2D>>>,
+    dvector<mask<unbounded<trapezoid2D>>>, dvector<mask<unbounded<ring2D>>>,
+    dvector<mask<unbounded<cylinder2D>>>, dvector<mask<unbounded<annulus2D>>>,
+    dvector<mask<unmasked<2>>>, dvector<mask<unmasked<3>>>>;
+
+constexpr std::size_t n_mask_types{20u};
+constexpr std::size_t n_visits{100000u};
+
+/// Check a point against the first mask of a mask collection
+struct inside_check {
+    template <typename mask_group_t>
+    bool operator()(const mask_group_t &masks, const point3 &loc_p) const {
+        return masks[0].is_inside(loc_p, tol) ==
+               intersection::status::e_inside;
+    }
+};
+
+/// Put one mask of every type into the tuple container
+template <std::size_t... I>
+void fill_masks(mask_tuple_t &masks, std::index_sequence<I...> /*seq*/) {
+    (masks.template get<I>().resize(1u), ...);
+}
+
+/// @returns a sequence of random mask type ids
+std::vector<std::size_t> random_mask_ids() {
+    std::mt19937_64 gen{42u};
+    std::uniform_int_distribution<std::size_t> dist(0u, n_mask_types - 1u);
+
+    std::vector<std::size_t> ids(n_visits);
+    for (auto &id : ids) {
+        id = dist(gen);
+    }
+    return ids;
+}
+
+}  // anonymous namespace
+
+// This runs a benchmark on the visitor dispatch of a mask collection with
+// @c n_mask_types different types. The argument selects the implementation:
+// 0 for the jump table of 'visit', 1 for the sequential comparison chain.
+void BM_MASK_VISIT(benchmark::State &state) {
+
+    vecmem::host_memory_resource host_mr;
+    mask_tuple_t masks(host_mr);
+    fill_masks(masks, std::make_index_sequence<n_mask_types>{});
+
+    const std::vector<std::size_t> ids = random_mask_ids();
+    const point3 loc_p{1.f, 0.5f, 0.f};
+    const bool sequential{state.range(0) == 1};
+
+    unsigned long inside = 0u;
+
+    for (auto _ : state) {
+        for (const std::size_t id : ids) {
+            benchmark::DoNotOptimize(inside);
+            const bool is_inside =
+                sequential
+                    ? masks.template visit_sequential<inside_check>(id, loc_p)
+                    : masks.template visit<inside_check>(id, loc_p);
+            inside += static_cast<unsigned long>(is_inside);
+        }
+    }
+
+    state.counters["visits"] = benchmark::Counter(
+        static_cast<double>(n_visits),
+        benchmark::Counter::kIsIterationInvariantRate);
+}
+
+BENCHMARK(BM_MASK_VISIT)
+    ->Arg(0)
+    ->Arg(1)
+    ->ArgName("sequential")
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,305 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Detray core include(s).
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/pdg_particle.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/geometry/mask.hpp"
+#include "detray/geometry/shapes.hpp"
+#include "detray/materials/detail/material_accessor.hpp"
+#include "detray/materials/interaction.hpp"
+#include "detray/materials/material_map.hpp"
+#include "detray/materials/material_slab.hpp"
+#include "detray/materials/predefined_materials.hpp"
+#include "detray/test/types.hpp"
+#include "detray/test/utils/perf_counters.hpp"
+#include "detray/utils/grid/populators.hpp"
+
+// Google Benchmark include(s)
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <type_traits>
+
+// Use the detray:: namespace implicitly.
+using namespace detray;
+
+/// Material lookup and material interaction benchmarks.
+///
+/// The material map benchmarks cover every material map type of the detector
+/// metadata (disc, concentric cylinder and rectangle surface maps, cuboid and
+/// cylinder volume maps) for different numbers of bins per axis. Every
+/// benchmark reports the time per lookup or evaluation ('t_per_call'). For
+/// regression tracking, run with e.g. '--benchmark_filter=BM_MATERIAL
+/// --benchmark_format=json --benchmark_out=<file>.json'.
+
+namespace {
+
+/// Number of lookups/evaluations per benchmark iteration
+constexpr std::size_t n_calls{10000u};
+
+/// Extent of the material maps
+constexpr scalar half_length{500.f * unit<scalar>::mm};
+
+/// @returns the mask that defines the material map of shape @tparam shape_t
+template <typename shape_t>
+auto make_map_bounds() {
+
+    if constexpr (std::is_same_v<shape_t, ring2D>) {
+        return mask<ring2D>{0u, 0.f, half_length};
+    } else if constexpr (std::is_same_v<shape_t, concentric_cylinder2D>) {
+        return mask<concentric_cylinder2D>{0u, half_length, -half_length,
+                                           half_length};
+    } else if constexpr (std::is_same_v<shape_t, rectangle2D>) {
+        return mask<rectangle2D>{0u, half_length, half_length};
+    } else if constexpr (std::is_same_v<shape_t, cuboid3D>) {
+        return mask<cuboid3D>{0u,          -half_length, -half_length,
+                              -half_length, half_length,  half_length,
+                              half_length};
+    } else {
+        static_assert(std::is_same_v<shape_t, cylinder3D>,
+                      "Unknown material map shape");
+        return mask<cylinder3D>{0u,          0.f,
+                                -constant<scalar>::pi, -half_length,
+                                half_length, constant<scalar>::pi,
+                                half_length};
+    }
+}
+
+/// @returns a material map of shape @tparam shape_t with @param n_bins
+/// bins per axis, filled with silicon slabs of varying thickness
+template <typename shape_t>
+auto make_map(const std::size_t n_bins) {
+
+    material_grid_factory<scalar> mat_map_factory{};
+
+    auto mat_map = [&]() {
+        if constexpr (shape_t::dim == 2u) {
+            return mat_map_factory.new_grid(make_map_bounds<shape_t>(),
+                                            {n_bins, n_bins});
+        } else {
+            return mat_map_factory.new_grid(make_map_bounds<shape_t>(),
+                                            {n_bins, n_bins, n_bins});
+        }
+    }();
+
+    scalar thickness{0.1f * unit<scalar>::mm};
+    for (dindex gbin = 0u; gbin < mat_map.nbins(); ++gbin) {
+        mat_map.template populate<replace<>>(
+            gbin, material_slab<scalar>(silicon<scalar>{}, thickness));
+        thickness += 0.001f * unit<scalar>::mm;
+    }
+
+    return mat_map;
+}
+
+/// @returns uniformly distributed local points inside the material map
+/// @param map
+template <typename map_t>
+auto make_points(const map_t &map) {
+
+    using point_t = typename map_t::point_type;
+
+    std::mt19937_64 gen{42u};
+
+    const auto ax0 = map.template get_axis<0>();
+    const auto ax1 = map.template get_axis<1>();
+    std::uniform_real_distribution<scalar> dist0(ax0.min(), ax0.max());
+    std::uniform_real_distribution<scalar> dist1(ax1.min(), ax1.max());
+
+    dvector<point_t> points;
+    points.reserve(n_calls);
+
+    if constexpr (map_t::dim == 2u) {
+        for (std::size_t i = 0u; i < n_calls; ++i) {
+            points.push_back({dist0(gen), dist1(gen)});
+        }
+    } else {
+        const auto ax2 = map.template get_axis<2>();
+        std::uniform_real_distribution<scalar> dist2(ax2.min(), ax2.max());
+
+        for (std::size_t i = 0u; i < n_calls; ++i) {
+            points.push_back({dist0(gen), dist1(gen), dist2(gen)});
+        }
+    }
+
+    return points;
+}
+
+/// Material interaction that is evaluated in the interaction benchmark
+enum class interaction_kernel : std::uint_least8_t {
+    e_bethe_bloch = 0u,
+    e_landau_sigma = 1u,
+    e_scattering = 2u,
+};
+
+/// Register the time per call of the benchmark @param state
+inline void set_counters(benchmark::State &state) {
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(n_calls));
+    state.counters["t_per_call"] = benchmark::Counter(
+        static_cast<double>(n_calls),
+        benchmark::Counter::kIsIterationInvariantRate |
+            benchmark::Counter::kInvert);
+}
+
+}  // anonymous namespace
+
+/// This benchmark looks up the material slabs of a material map of shape
+/// @tparam shape_t at uniformly distributed local positions
+template <typename shape_t>
+void BM_MATERIAL_MAP_LOOKUP(benchmark::State &state) {
+
+    const auto mat_map =
+        make_map<shape_t>(static_cast<std::size_t>(state.range(0)));
+    const auto points = make_points(mat_map);
+
+    test::perf_counters perf{};
+    perf.start();
+    for (auto _ : state) {
+        for (const auto &p : points) {
+            // Only one material slab per bin
+            const material_slab<scalar> &slab = *(mat_map.search(p));
+            benchmark::DoNotOptimize(slab.thickness());
+        }
+    }
+    perf.stop(state);
+
+    set_counters(state);
+}
+
+// Surface material maps
+BENCHMARK_TEMPLATE(BM_MATERIAL_MAP_LOOKUP, ring2D)
+    ->Name("BM_MATERIAL_MAP_LOOKUP/disc")
+    ->RangeMultiplier(10)
+    ->Range(10, 1000);
+BENCHMARK_TEMPLATE(BM_MATERIAL_MAP_LOOKUP, concentric_cylinder2D)
+    ->Name("BM_MATERIAL_MAP_LOOKUP/cylinder2")
+    ->RangeMultiplier(10)
+    ->Range(10, 1000);
+BENCHMARK_TEMPLATE(BM_MATERIAL_MAP_LOOKUP, rectangle2D)
+    ->Name("BM_MATERIAL_MAP_LOOKUP/rectangle")
+    ->RangeMultiplier(10)
+    ->Range(10, 1000);
+
+// Volume material maps
+BENCHMARK_TEMPLATE(BM_MATERIAL_MAP_LOOKUP, cuboid3D)
+    ->Name("BM_MATERIAL_MAP_LOOKUP/cuboid")
+    ->RangeMultiplier(10)
+    ->Range(10, 100);
+BENCHMARK_TEMPLATE(BM_MATERIAL_MAP_LOOKUP, cylinder3D)
+    ->Name("BM_MATERIAL_MAP_LOOKUP/cylinder3")
+    ->RangeMultiplier(10)
+    ->Range(10, 100);
+
+/// This benchmark accesses homogeneous material slabs at random positions
+/// in the slab collection and evaluates the path length in X0
+void BM_MATERIAL_SLAB_ACCESS(benchmark::State &state) {
+
+    const auto n_slabs{static_cast<std::size_t>(state.range(0))};
+
+    dvector<material_slab<scalar>> slabs;
+    slabs.reserve(n_slabs);
+    for (std::size_t i = 0u; i < n_slabs; ++i) {
+        slabs.emplace_back(silicon<scalar>{},
+                           static_cast<scalar>(i + 1u) * unit<scalar>::um);
+    }
+
+    std::mt19937_64 gen{42u};
+    std::uniform_int_distribution<dindex> dist(
+        0u, static_cast<dindex>(n_slabs - 1u));
+    std::uniform_real_distribution<scalar> cos_dist(0.1f, 1.f);
+
+    dvector<dindex> indices;
+    dvector<scalar> cos_inc_angles;
+    indices.reserve(n_calls);
+    cos_inc_angles.reserve(n_calls);
+    for (std::size_t i = 0u; i < n_calls; ++i) {
+        indices.push_back(dist(gen));
+        cos_inc_angles.push_back(cos_dist(gen));
+    }
+
+    const test::point2 loc{0.f, 0.f};
+
+    test::perf_counters perf{};
+    perf.start();
+    for (auto _ : state) {
+        for (std::size_t i = 0u; i < n_calls; ++i) {
+            const auto &slab =
+                detail::material_accessor::get(slabs, indices[i], loc);
+            benchmark::DoNotOptimize(
+                slab.path_segment_in_X0(cos_inc_angles[i], 0.f));
+        }
+    }
+    perf.stop(state);
+
+    set_counters(state);
+}
+
+BENCHMARK(BM_MATERIAL_SLAB_ACCESS)
+    ->Name("BM_MATERIAL_SLAB_ACCESS")
+    ->RangeMultiplier(100)
+    ->Range(10, 100000);
+
+/// This benchmark evaluates the material interaction @tparam K for muons of
+/// different momenta in a silicon slab
+template <interaction_kernel K>
+void BM_MATERIAL_INTERACTION(benchmark::State &state) {
+
+    const material_slab<scalar> slab(silicon<scalar>{},
+                                     0.5f * unit<scalar>::mm);
+    const interaction<scalar> I{};
+
+    constexpr int pdg{pdg_particle::eMuon};
+    constexpr scalar mass{105.7f * unit<scalar>::MeV};
+    constexpr scalar q{-1.f};
+
+    // Momenta from 100 MeV to 100 GeV
+    std::mt19937_64 gen{42u};
+    std::uniform_real_distribution<scalar> dist(-1.f, 2.f);
+
+    dvector<scalar> qops;
+    qops.reserve(n_calls);
+    for (std::size_t i = 0u; i < n_calls; ++i) {
+        qops.push_back(q / (std::pow(10.f, dist(gen)) * unit<scalar>::GeV));
+    }
+
+    const scalar path{slab.thickness()};
+    const scalar path_in_X0{slab.thickness_in_X0()};
+
+    test::perf_counters perf{};
+    perf.start();
+    for (auto _ : state) {
+        for (const scalar qop : qops) {
+            if constexpr (K == interaction_kernel::e_bethe_bloch) {
+                benchmark::DoNotOptimize(I.compute_energy_loss_bethe_bloch(
+                    path, slab.get_material(), pdg, mass, qop, q));
+            } else if constexpr (K == interaction_kernel::e_landau_sigma) {
+                benchmark::DoNotOptimize(
+                    I.compute_energy_loss_landau_sigma_QOverP(
+                        path, slab.get_material(), pdg, mass, qop, q));
+            } else {
+                benchmark::DoNotOptimize(I.compute_multiple_scattering_theta0(
+                    path_in_X0, pdg, mass, qop, q));
+            }
+        }
+    }
+    perf.stop(state);
+
+    set_counters(state);
+}
+
+BENCHMARK_TEMPLATE(BM_MATERIAL_INTERACTION, interaction_kernel::e_bethe_bloch)
+    ->Name("BM_MATERIAL_INTERACTION/bethe_bloch");
+BENCHMARK_TEMPLATE(BM_MATERIAL_INTERACTION, interaction_kernel::e_landau_sigma)
+    ->Name("BM_MATERIAL_INTERACTION/landau_sigma_qop");
+BENCHMARK_TEMPLATE(BM_MATERIAL_INTERACTION, interaction_kernel::e_scattering)
+    ->Name("BM_MATERIAL_INTERACTION/scattering_theta0");
@@ -0,0 +1,101 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/detectors/build_toy_detector.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/line_stepper.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/simulation/event_generator/track_generators.hpp"
+#include "detray/test/types.hpp"
+#include "detray/test/utils/perf_counters.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google Benchmark include(s)
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <iostream>
+
+// Use the detray:: namespace implicitly.
+using namespace detray;
+
+using trk_generator_t =
+    uniform_track_generator<free_track_parameters<test::algebra>>;
+
+constexpr unsigned int theta_steps{50u};
+constexpr unsigned int phi_steps{50u};
+
+// This test navigates straight line tracks through the toy detector, using
+// a given candidate ordering policy in the navigator
+void BM_NAVIGATION_ORDERING(benchmark::State &state,
+                            navigation::candidate_ordering ordering) {
+
+    // Detector configuration
+    vecmem::host_memory_resource host_mr;
+    toy_det_config<test::scalar> toy_cfg{};
+    toy_cfg.n_edc_layers(7u);
+    auto [d, names] = build_toy_detector(host_mr, toy_cfg);
+
+    using detector_t = decltype(d);
+    using navigator_t = navigator<detector_t>;
+    using stepper_t = line_stepper<test::algebra>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain<>>;
+
+    propagation::config<test::scalar> prop_cfg{};
+    prop_cfg.navigation.search_window = {3u, 3u};
+    prop_cfg.navigation.ordering = ordering;
+    propagator_t p{prop_cfg};
+
+    // Iterate through uniformly distributed momentum directions
+    auto trk_generator = trk_generator_t{};
+    trk_generator.config().theta_steps(theta_steps).phi_steps(phi_steps);
+
+    std::size_t n_success{0u};
+
+    test::perf_counters perf{};
+    perf.start();
+    for (auto _ : state) {
+        for (const auto track : trk_generator) {
+            propagator_t::state propagation(track, d);
+
+            benchmark::DoNotOptimize(n_success);
+            n_success += p.propagate(propagation) ? 1u : 0u;
+            benchmark::ClobberMemory();
+        }
+    }
+    perf.stop(state);
+
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+    std::cout << "Successful propagations : " << n_success << std::endl;
+#endif  // DETRAY_BENCHMARK_PRINTOUTS
+}
+
+BENCHMARK_CAPTURE(BM_NAVIGATION_ORDERING, full_sort,
+                  navigation::candidate_ordering::e_full_sort)
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BM_NAVIGATION_ORDERING, insertion_sort,
+                  navigation::candidate_ordering::e_insertion)
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BM_NAVIGATION_ORDERING, k_nearest,
+                  navigation::candidate_ordering::e_k_nearest)
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->Unit(benchmark::kMillisecond);
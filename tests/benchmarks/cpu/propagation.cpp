@@ -0,0 +1,348 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/detectors/build_telescope_detector.hpp"
+#include "detray/detectors/build_toy_detector.hpp"
+#include "detray/detectors/create_wire_chamber.hpp"
+#include "detray/materials/predefined_materials.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/actors/aborters.hpp"
+#include "detray/propagator/actors/parameter_resetter.hpp"
+#include "detray/propagator/actors/parameter_transporter.hpp"
+#include "detray/propagator/actors/pointwise_material_interactor.hpp"
+#include "detray/propagator/base_actor.hpp"
+#include "detray/propagator/line_stepper.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/simulation/event_generator/track_generators.hpp"
+#include "detray/test/types.hpp"
+#include "detray/test/utils/perf_counters.hpp"
+#include "detray/tracks/tracks.hpp"
+#include "detray/utils/inspectors.hpp"
+#include "detray/utils/tuple.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google Benchmark include(s)
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <cstdint>
+#include <cstdlib>
+#include <type_traits>
+
+// Use the detray:: namespace implicitly.
+using namespace detray;
+
+/// Propagation benchmarks on the host.
+///
+/// The benchmarks propagate a batch of tracks through the toy detector, a
+/// telescope detector and the wire chamber, with the straight line stepper
+/// or with the Runge-Kutta stepper in a constant or an inhomogeneous field
+/// (read from the file given by 'DETRAY_BFIELD_FILE'), and with different
+/// actor chains. The benchmark argument switches the covariance transport on
+/// or off. Every benchmark reports the propagated tracks and steps per
+/// second. For regression tracking, run with e.g.
+/// '--benchmark_filter=BM_PROPAGATION/ --benchmark_format=json
+/// --benchmark_out=<file>.json'.
+
+using algebra_t = test::algebra;
+using scalar_t = test::scalar;
+
+using trk_generator_t =
+    uniform_track_generator<free_track_parameters<algebra_t>>;
+
+namespace {
+
+vecmem::host_memory_resource host_mr;
+
+constexpr unsigned int theta_steps{20u};
+constexpr unsigned int phi_steps{20u};
+
+/// Counts the calls of the actor chain, i.e. the propagation steps
+struct step_counter : actor {
+
+    struct state {
+        std::size_t n_steps{0u};
+    };
+
+    template <typename propagator_state_t>
+    DETRAY_HOST_DEVICE void operator()(state &counter_state,
+                                       const propagator_state_t &) const {
+        ++counter_state.n_steps;
+    }
+};
+
+/// Setup of the toy detector
+struct toy_setup {
+    static auto build() {
+        toy_det_config<scalar_t> toy_cfg{};
+        toy_cfg.n_edc_layers(7u);
+        return build_toy_detector(host_mr, toy_cfg);
+    }
+
+    static void configure(trk_generator_t::configuration &trk_cfg) {
+        trk_cfg.theta_steps(theta_steps).phi_steps(phi_steps);
+    }
+};
+
+/// Setup of a telescope detector along the z-axis
+struct telescope_setup {
+    static auto build() {
+        tel_det_config<rectangle2D> tel_cfg{1.f * unit<scalar_t>::m,
+                                            1.f * unit<scalar_t>::m};
+        tel_cfg.n_surfaces(100u)
+            .length(2.f * unit<scalar_t>::m)
+            .module_material(silicon_tml<scalar_t>())
+            .mat_thickness(0.15f * unit<scalar_t>::mm);
+        return build_telescope_detector(host_mr, tel_cfg);
+    }
+
+    static void configure(trk_generator_t::configuration &trk_cfg) {
+        trk_cfg.theta_steps(theta_steps)
+            .phi_steps(phi_steps)
+            .theta_range(0.f, 0.2f);
+    }
+};
+
+/// Setup of the wire chamber
+struct wire_chamber_setup {
+    static auto build() {
+        wire_chamber_config wire_cfg{};
+        wire_cfg.half_z(500.f * unit<scalar>::mm);
+        return create_wire_chamber(host_mr, wire_cfg);
+    }
+
+    static void configure(trk_generator_t::configuration &trk_cfg) {
+        trk_cfg.theta_steps(theta_steps)
+            .phi_steps(phi_steps)
+            .theta_range(0.25f * constant<scalar_t>::pi,
+                         0.75f * constant<scalar_t>::pi);
+    }
+};
+
+/// Magnetic field of the propagation
+enum class field_option : std::uint_least8_t {
+    e_none = 0u,
+    e_const = 1u,
+    e_inhom = 2u,
+};
+
+/// Actors that are run after every step
+enum class actor_option : std::uint_least8_t {
+    /// No actors (apart from the step counter)
+    e_none = 0u,
+    /// Path limit aborter
+    e_aborter = 1u,
+    /// Path limit aborter and material interaction on the surfaces
+    e_material = 2u,
+};
+
+/// Field type for the field option @tparam F
+template <field_option F>
+using field_t =
+    std::conditional_t<F == field_option::e_inhom, bfield::inhom_field_t,
+                       bfield::const_field_t>;
+
+/// Stepper type for the field option @tparam F
+template <field_option F>
+using stepper_t =
+    std::conditional_t<F == field_option::e_none, line_stepper<algebra_t>,
+                       rk_stepper<typename field_t<F>::view_t, algebra_t>>;
+
+/// Actor chain type for the actor option @tparam A
+template <actor_option A>
+using actor_chain_t = std::conditional_t<
+    A == actor_option::e_none, actor_chain<dtuple, step_counter>,
+    std::conditional_t<
+        A == actor_option::e_aborter,
+        actor_chain<dtuple, step_counter, pathlimit_aborter>,
+        actor_chain<dtuple, step_counter, pathlimit_aborter,
+                    parameter_transporter<algebra_t>,
+                    pointwise_material_interactor<algebra_t>,
+                    parameter_resetter<algebra_t>>>>;
+
+}  // anonymous namespace
+
+/// This benchmark propagates a track batch through the detector of the
+/// setup @tparam setup_t with the field option @tparam F and the actor
+/// option @tparam A
+template <typename setup_t, field_option F, actor_option A>
+void BM_PROPAGATION(benchmark::State &state) {
+
+    if constexpr (F == field_option::e_inhom) {
+        if (!std::getenv("DETRAY_BFIELD_FILE")) {
+            state.SkipWithError("DETRAY_BFIELD_FILE is not set");
+            return;
+        }
+    }
+
+    const bool do_covariance_transport{state.range(0) != 0};
+
+    auto [det, names] = setup_t::build();
+
+    using detector_t = decltype(det);
+    using propagator_t =
+        propagator<stepper_t<F>, navigator<detector_t>, actor_chain_t<A>>;
+
+    const field_t<F> field = [] {
+        if constexpr (F == field_option::e_inhom) {
+            return bfield::create_inhom_field();
+        } else {
+            return bfield::create_const_field(dvector3D<algebra_t>{
+                0.f, 0.f, 2.f * unit<scalar_t>::T});
+        }
+    }();
+
+    // Generate the track batch
+    auto trk_cfg = trk_generator_t::configuration{};
+    setup_t::configure(trk_cfg);
+    trk_cfg.p_tot(10.f * unit<scalar_t>::GeV);
+
+    vecmem::vector<free_track_parameters<algebra_t>> tracks(&host_mr);
+    for (const auto track : trk_generator_t{trk_cfg}) {
+        tracks.push_back(track);
+    }
+
+    propagator_t p{};
+
+    std::size_t n_tracks{0u};
+    std::size_t n_steps{0u};
+
+    test::perf_counters perf{};
+    perf.start();
+    for (auto _ : state) {
+        for (const auto &track : tracks) {
+
+            auto propagation = [&]() {
+                if constexpr (F == field_option::e_none) {
+                    return typename propagator_t::state(track, det);
+                } else {
+                    return typename propagator_t::state(track, field, det);
+                }
+            }();
+            propagation._stepping.set_covariance_transport(
+                do_covariance_transport);
+
+            step_counter::state counter_state{};
+            pathlimit_aborter::state aborter_state{};
+            aborter_state.set_path_limit(5.f * unit<scalar_t>::m);
+            parameter_transporter<algebra_t>::state transporter_state{};
+            pointwise_material_interactor<algebra_t>::state interactor_state{};
+            interactor_state.do_covariance_transport = do_covariance_transport;
+            parameter_resetter<algebra_t>::state resetter_state{};
+
+            if constexpr (A == actor_option::e_none) {
+                p.propagate(propagation, detray::tie(counter_state));
+            } else if constexpr (A == actor_option::e_aborter) {
+                p.propagate(propagation,
+                            detray::tie(counter_state, aborter_state));
+            } else {
+                p.propagate(propagation,
+                            detray::tie(counter_state, aborter_state,
+                                        transporter_state, interactor_state,
+                                        resetter_state));
+            }
+
+            benchmark::DoNotOptimize(propagation._stepping().p());
+
+            n_steps += counter_state.n_steps;
+        }
+        n_tracks += tracks.size();
+    }
+    perf.stop(state);
+
+    state.counters["tracks"] = benchmark::Counter(
+        static_cast<double>(n_tracks), benchmark::Counter::kIsRate);
+    state.counters["steps"] = benchmark::Counter(static_cast<double>(n_steps),
+                                                 benchmark::Counter::kIsRate);
+}
+
+// Register the propagation benchmarks of a detector setup for all actor
+// chains, with and without covariance transport
+#define DETRAY_PROPAGATION_BENCHMARK(SETUP, NAME, FIELD, FIELD_NAME)         \
+    BENCHMARK_TEMPLATE(BM_PROPAGATION, SETUP, FIELD, actor_option::e_none)  \
+        ->Name("BM_PROPAGATION/" NAME "/" FIELD_NAME "/no_actors")          \
+        ->ArgName("cov")                                                    \
+        ->DenseRange(0, 1)                                                  \
+        ->Unit(benchmark::kMillisecond);                                    \
+    BENCHMARK_TEMPLATE(BM_PROPAGATION, SETUP, FIELD,                        \
+                       actor_option::e_aborter)                             \
+        ->Name("BM_PROPAGATION/" NAME "/" FIELD_NAME "/aborter")            \
+        ->ArgName("cov")                                                    \
+        ->DenseRange(0, 1)                                                  \
+        ->Unit(benchmark::kMillisecond);                                    \
+    BENCHMARK_TEMPLATE(BM_PROPAGATION, SETUP, FIELD,                        \
+                       actor_option::e_material)                            \
+        ->Name("BM_PROPAGATION/" NAME "/" FIELD_NAME "/material")           \
+        ->ArgName("cov")                                                    \
+        ->DenseRange(0, 1)                                                  \
+        ->Unit(benchmark::kMillisecond);
+
+// Straight line stepper, Runge-Kutta stepper in a constant field and in an
+// inhomogeneous field for every detector
+#define DETRAY_PROPAGATION_BENCHMARKS(SETUP, NAME)                           \
+    DETRAY_PROPAGATION_BENCHMARK(SETUP, NAME, field_option::e_none, "line") \
+    DETRAY_PROPAGATION_BENCHMARK(SETUP, NAME, field_option::e_const,        \
+                                 "rk_const")                                \
+    DETRAY_PROPAGATION_BENCHMARK(SETUP, NAME, field_option::e_inhom,        \
+                                 "rk_inhom")
+
+DETRAY_PROPAGATION_BENCHMARKS(toy_setup, "toy")
+DETRAY_PROPAGATION_BENCHMARKS(telescope_setup, "telescope")
+DETRAY_PROPAGATION_BENCHMARKS(wire_chamber_setup, "wire_chamber")
+
+/// This benchmark only constructs the propagation states of a track batch in
+/// the toy detector, with the propagation inspector @tparam inspector_t
+template <typename inspector_t>
+void BM_PROPAGATION_STATE(benchmark::State &state) {
+
+    auto [det, names] = toy_setup::build();
+
+    using detector_t = decltype(det);
+    using propagator_t =
+        propagator<stepper_t<field_option::e_const>, navigator<detector_t>,
+                   actor_chain<>, propagation::void_timer, inspector_t>;
+
+    const auto field = bfield::create_const_field(
+        dvector3D<algebra_t>{0.f, 0.f, 2.f * unit<scalar_t>::T});
+
+    auto trk_cfg = trk_generator_t::configuration{};
+    toy_setup::configure(trk_cfg);
+
+    vecmem::vector<free_track_parameters<algebra_t>> tracks(&host_mr);
+    for (const auto track : trk_generator_t{trk_cfg}) {
+        tracks.push_back(track);
+    }
+
+    std::size_t n_states{0u};
+    for (auto _ : state) {
+        for (const auto &track : tracks) {
+            typename propagator_t::state propagation(track, field, det);
+            benchmark::DoNotOptimize(propagation);
+        }
+        n_states += tracks.size();
+    }
+
+    state.counters["states"] = benchmark::Counter(
+        static_cast<double>(n_states), benchmark::Counter::kIsRate);
+    state.counters["bytes"] =
+        static_cast<double>(sizeof(typename propagator_t::state));
+}
+
+BENCHMARK_TEMPLATE(BM_PROPAGATION_STATE, propagation::void_inspector)
+    ->Name("BM_PROPAGATION_STATE/void_inspector")
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_PROPAGATION_STATE, propagation::print_inspector)
+    ->Name("BM_PROPAGATION_STATE/print_inspector")
+    ->Unit(benchmark::kMicrosecond);
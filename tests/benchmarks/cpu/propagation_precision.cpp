@@ -0,0 +1,151 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/builders/volume_builder.hpp"
+#include "detray/core/detector.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/navigation/detail/helix.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/simulation/event_generator/track_generators.hpp"
+#include "detray/test/types.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google Benchmark include(s)
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <algorithm>
+#include <memory>
+
+// Use the detray:: namespace implicitly.
+using namespace detray;
+
+using algebra_t = test::algebra;
+using scalar_t = test::scalar;
+using bfield_t = bfield::const_field_t;
+
+/// Runge-Kutta steppers in the algebra precision and with accumulation of the
+/// track position and path lengths in double precision
+using rk_stepper_t = rk_stepper<bfield_t::view_t, algebra_t>;
+using mixed_rk_stepper_t =
+    rk_stepper<bfield_t::view_t, algebra_t, unconstrained_step,
+               stepper_rk_policy, stepping::void_inspector, darray, double>;
+
+/// Double precision reference
+using double_algebra_t = ALGEBRA_PLUGIN<double>;
+using double_vector3 = dvector3D<double_algebra_t>;
+
+using trk_generator_t =
+    uniform_track_generator<free_track_parameters<algebra_t>>;
+
+namespace {
+
+constexpr unsigned int theta_steps{10u};
+constexpr unsigned int phi_steps{10u};
+constexpr unsigned int n_steps{10000u};
+constexpr scalar_t step_size{1.f * unit<scalar_t>::mm};
+
+// Navigation that only provides the step size
+struct nav_state {
+    nav_state(vecmem::host_memory_resource &mr)
+        : m_det{std::make_unique<detray::detector<>>(mr)} {
+
+        // Empty dummy volume without material
+        volume_builder<detray::detector<>> vbuilder{volume_id::e_cylinder};
+        vbuilder.build(*m_det);
+    }
+
+    scalar_t operator()() const { return step_size; }
+    inline auto detector() const -> const detray::detector<> * {
+        return m_det.get();
+    }
+    inline auto volume() -> unsigned int { return 0u; }
+    inline void set_full_trust() {}
+    inline void set_high_trust() {}
+    inline void set_fair_trust() {}
+    inline void set_no_trust() {}
+    inline bool abort() { return false; }
+
+    std::unique_ptr<detray::detector<>> m_det;
+};
+
+template <typename stepping_t>
+struct prop_state {
+    stepping_t _stepping;
+    nav_state _navigation;
+};
+
+}  // namespace
+
+// This test steps long tracks with many short steps in a constant field and
+// compares the end positions to a double precision helix
+template <typename stepper_t>
+void BM_RK_PRECISION(benchmark::State &state) {
+
+    using stepper_state_t = typename stepper_t::state;
+
+    vecmem::host_memory_resource host_mr;
+
+    const dvector3D<algebra_t> B{0.f * unit<scalar_t>::T,
+                                 0.f * unit<scalar_t>::T,
+                                 2.f * unit<scalar_t>::T};
+    const bfield_t hom_bfield = bfield::create_const_field(B);
+    const double_vector3 dB{B[0], B[1], B[2]};
+
+    stepper_t stepper{};
+
+    auto trk_generator = trk_generator_t{};
+    trk_generator.config()
+        .theta_steps(theta_steps)
+        .phi_steps(phi_steps)
+        .p_tot(1.f * unit<scalar_t>::GeV);
+
+    double max_error{0.};
+
+    for (auto _ : state) {
+        for (const auto track : trk_generator) {
+            prop_state<stepper_state_t> propagation{
+                stepper_state_t{track, hom_bfield}, nav_state{host_mr}};
+            propagation._stepping.set_step_size(step_size);
+
+            for (unsigned int i = 0u; i < n_steps; ++i) {
+                stepper.step(propagation);
+            }
+            benchmark::ClobberMemory();
+
+            state.PauseTiming();
+            const auto p0 = track.pos();
+            const auto mom = track.mom();
+            const free_track_parameters<double_algebra_t> dtrack(
+                {p0[0], p0[1], p0[2]}, 0., {mom[0], mom[1], mom[2]},
+                track.charge());
+
+            const auto true_pos =
+                detail::helix(dtrack, &dB)(n_steps * static_cast<double>(
+                                                         step_size));
+            const auto pos = propagation._stepping().pos();
+            const double_vector3 diff{pos[0] - true_pos[0],
+                                      pos[1] - true_pos[1],
+                                      pos[2] - true_pos[2]};
+            max_error = std::max(max_error, getter::norm(diff));
+            state.ResumeTiming();
+        }
+    }
+
+    // Maximal distance to the double precision helix in mm
+    state.counters["max_pos_error"] = max_error;
+}
+
+BENCHMARK_TEMPLATE(BM_RK_PRECISION, rk_stepper_t)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_RK_PRECISION, mixed_rk_stepper_t)
+    ->Unit(benchmark::kMillisecond);
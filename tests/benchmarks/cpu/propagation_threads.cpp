@@ -0,0 +1,283 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/detectors/build_toy_detector.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/parallel_executor.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/propagator/track_ordering.hpp"
+#include "detray/simulation/event_generator/track_generators.hpp"
+#include "detray/test/types.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google Benchmark include(s)
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <algorithm>
+#include <random>
+#include <thread>
+
+// Use the detray:: namespace implicitly.
+using namespace detray;
+
+using algebra_t = test::algebra;
+using scalar_t = test::scalar;
+
+using trk_generator_t =
+    uniform_track_generator<free_track_parameters<algebra_t>>;
+
+namespace {
+
+constexpr unsigned int theta_steps{50u};
+constexpr unsigned int phi_steps{50u};
+
+}  // namespace
+
+// This test propagates a batch of tracks through the toy detector in a
+// constant field with a given number of threads. The first argument is the
+// number of threads, the second is the number of tracks that a thread takes
+// at once (zero: static partitioning of the batch between the threads)
+void BM_PROPAGATION_THREADS(benchmark::State &state) {
+
+    // Detector configuration
+    vecmem::host_memory_resource host_mr;
+    toy_det_config<scalar_t> toy_cfg{};
+    toy_cfg.n_edc_layers(7u);
+    const auto [d, names] = build_toy_detector(host_mr, toy_cfg);
+
+    using detector_t = decltype(d);
+    using intersection_t =
+        intersection2D<typename detector_t::surface_type, algebra_t>;
+    using navigator_t = navigator<detector_t, navigation::void_inspector,
+                                  intersection_t, 20u>;
+    using bfield_t = bfield::const_field_t;
+    using stepper_t = rk_stepper<bfield_t::view_t, algebra_t>;
+    using actor_chain_t = actor_chain<>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+
+    const bfield_t bfield = bfield::create_const_field(
+        dvector3D<algebra_t>{0.f, 0.f, 2.f * unit<scalar_t>::T});
+
+    // Low momentum tracks, some of which loop in the field
+    auto trk_generator = trk_generator_t{};
+    trk_generator.config()
+        .theta_steps(theta_steps)
+        .phi_steps(phi_steps)
+        .p_tot(0.5f * unit<scalar_t>::GeV);
+
+    vecmem::vector<free_track_parameters<algebra_t>> tracks(&host_mr);
+    for (const auto track : trk_generator) {
+        tracks.push_back(track);
+    }
+    const auto n_tracks{static_cast<unsigned int>(tracks.size())};
+
+    vecmem::vector<propagation::result<algebra_t>> results(tracks.size(),
+                                                           &host_mr);
+
+    propagation::parallel_executor exec{};
+    exec.n_threads = static_cast<unsigned int>(state.range(0));
+    exec.chunk_size = state.range(1) > 0
+                          ? static_cast<unsigned int>(state.range(1))
+                          : (n_tracks + exec.n_threads - 1u) / exec.n_threads;
+
+    propagator_t p{};
+
+    for (auto _ : state) {
+        p.propagate_batch(tracks, results, exec, {}, bfield, d);
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["tracks"] = benchmark::Counter(
+        static_cast<double>(n_tracks),
+        benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// This test propagates the same batch, but every thread advances a group of
+// tracks in turn. The first argument is the number of threads, the second
+// is the number of interleaved tracks per group
+void BM_PROPAGATION_INTERLEAVED(benchmark::State &state) {
+
+    // Detector configuration
+    vecmem::host_memory_resource host_mr;
+    toy_det_config<scalar_t> toy_cfg{};
+    toy_cfg.n_edc_layers(7u);
+    const auto [d, names] = build_toy_detector(host_mr, toy_cfg);
+
+    using detector_t = decltype(d);
+    using intersection_t =
+        intersection2D<typename detector_t::surface_type, algebra_t>;
+    using navigator_t = navigator<detector_t, navigation::void_inspector,
+                                  intersection_t, 20u>;
+    using bfield_t = bfield::const_field_t;
+    using stepper_t = rk_stepper<bfield_t::view_t, algebra_t>;
+    using actor_chain_t = actor_chain<>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+
+    const bfield_t bfield = bfield::create_const_field(
+        dvector3D<algebra_t>{0.f, 0.f, 2.f * unit<scalar_t>::T});
+
+    auto trk_generator = trk_generator_t{};
+    trk_generator.config()
+        .theta_steps(theta_steps)
+        .phi_steps(phi_steps)
+        .p_tot(0.5f * unit<scalar_t>::GeV);
+
+    vecmem::vector<free_track_parameters<algebra_t>> tracks(&host_mr);
+    for (const auto track : trk_generator) {
+        tracks.push_back(track);
+    }
+    const auto n_tracks{static_cast<unsigned int>(tracks.size())};
+
+    vecmem::vector<propagation::result<algebra_t>> results(tracks.size(),
+                                                           &host_mr);
+
+    propagation::parallel_executor exec{};
+    exec.n_threads = static_cast<unsigned int>(state.range(0));
+    exec.chunk_size = 1u;
+    const auto group_size{static_cast<unsigned int>(state.range(1))};
+
+    propagator_t p{};
+
+    for (auto _ : state) {
+        p.propagate_batch_interleaved(tracks, results, exec, group_size, {},
+                                      bfield, d);
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["tracks"] = benchmark::Counter(
+        static_cast<double>(n_tracks),
+        benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// This test propagates the batch in a random order, as it could arrive from
+// an event generator. The first argument is the number of threads, the second
+// switches the spatial ordering of the tracks on (1) or off (0)
+void BM_PROPAGATION_ORDERED(benchmark::State &state) {
+
+    // Detector configuration
+    vecmem::host_memory_resource host_mr;
+    toy_det_config<scalar_t> toy_cfg{};
+    toy_cfg.n_edc_layers(7u);
+    const auto [d, names] = build_toy_detector(host_mr, toy_cfg);
+
+    using detector_t = decltype(d);
+    using intersection_t =
+        intersection2D<typename detector_t::surface_type, algebra_t>;
+    using navigator_t = navigator<detector_t, navigation::void_inspector,
+                                  intersection_t, 20u>;
+    using bfield_t = bfield::const_field_t;
+    using stepper_t = rk_stepper<bfield_t::view_t, algebra_t>;
+    using actor_chain_t = actor_chain<>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+
+    const bfield_t bfield = bfield::create_const_field(
+        dvector3D<algebra_t>{0.f, 0.f, 2.f * unit<scalar_t>::T});
+
+    auto trk_generator = trk_generator_t{};
+    trk_generator.config()
+        .theta_steps(theta_steps)
+        .phi_steps(phi_steps)
+        .p_tot(0.5f * unit<scalar_t>::GeV);
+
+    vecmem::vector<free_track_parameters<algebra_t>> tracks(&host_mr);
+    for (const auto track : trk_generator) {
+        tracks.push_back(track);
+    }
+    std::shuffle(tracks.begin(), tracks.end(), std::mt19937{42u});
+    const auto n_tracks{static_cast<unsigned int>(tracks.size())};
+
+    vecmem::vector<propagation::result<algebra_t>> results(tracks.size(),
+                                                           &host_mr);
+
+    // Without ordering, the tracks are propagated in the input order
+    vecmem::vector<unsigned int> order(tracks.size(), &host_mr);
+    if (state.range(1) > 0) {
+        propagation::spatial_order(tracks, order,
+                                   propagation::ordering_config<scalar_t>{});
+    }
+
+    propagation::ordered_executor<propagation::parallel_executor> exec{};
+    exec.exec.n_threads = static_cast<unsigned int>(state.range(0));
+    exec.exec.chunk_size = 8u;
+    exec.order = state.range(1) > 0 ? order.data() : nullptr;
+
+    propagator_t p{};
+
+    for (auto _ : state) {
+        p.propagate_batch(tracks, results, exec, {}, bfield, d);
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["tracks"] = benchmark::Counter(
+        static_cast<double>(n_tracks),
+        benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// Double the number of threads up to the number of hardware threads
+void thread_args(benchmark::internal::Benchmark *bench) {
+    const auto max_threads{static_cast<int>(
+        std::max(1u, std::thread::hardware_concurrency()))};
+
+    for (int n_threads = 1; n_threads < 2 * max_threads; n_threads *= 2) {
+        const int n{std::min(n_threads, max_threads)};
+        // Static partitioning
+        bench->Args({n, 0});
+        // Dynamic chunking
+        bench->Args({n, 8});
+    }
+}
+
+BENCHMARK(BM_PROPAGATION_THREADS)
+    ->Apply(thread_args)
+    ->ArgNames({"threads", "chunk"})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+// Compare single tracks with groups of interleaved tracks
+void interleave_args(benchmark::internal::Benchmark *bench) {
+    const auto max_threads{static_cast<int>(
+        std::max(1u, std::thread::hardware_concurrency()))};
+
+    for (const int n_threads : {1, max_threads}) {
+        for (const int group_size : {1, 4, 8}) {
+            bench->Args({n_threads, group_size});
+        }
+    }
+}
+
+BENCHMARK(BM_PROPAGATION_INTERLEAVED)
+    ->Apply(interleave_args)
+    ->ArgNames({"threads", "group"})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+// Compare shuffled and spatially ordered batches
+void ordering_args(benchmark::internal::Benchmark *bench) {
+    const auto max_threads{static_cast<int>(
+        std::max(1u, std::thread::hardware_concurrency()))};
+
+    for (const int n_threads : {1, max_threads}) {
+        bench->Args({n_threads, 0});
+        bench->Args({n_threads, 1});
+    }
+}
+
+BENCHMARK(BM_PROPAGATION_ORDERED)
+    ->Apply(ordering_args)
+    ->ArgNames({"threads", "ordered"})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
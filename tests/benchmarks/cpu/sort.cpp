@@ -0,0 +1,203 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/definitions/detail/algorithms.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/build_toy_detector.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/line_stepper.hpp"
+#include "detray/simulation/event_generator/track_generators.hpp"
+#include "detray/test/types.hpp"
+#include "detray/tracks/tracks.hpp"
+#include "detray/utils/sort.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google Benchmark include(s)
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// Use the detray:: namespace implicitly.
+using namespace detray;
+
+namespace {
+
+using detector_t = detector<toy_metadata>;
+using navigator_t = navigator<detector_t>;
+using intersection_t = navigator_t::intersection_type;
+using candidates_t = std::vector<intersection_t>;
+
+/// Sorting algorithms under test
+enum class sort_algorithm {
+    e_std_sort = 0,
+    e_insertion = 1,
+    e_selection = 2,
+    e_adaptive = 3,
+};
+
+/// How the candidates are ordered before the sort
+enum class presortedness {
+    e_random = 0,  ///< volume initialization (accelerator order)
+    e_update = 1,  ///< fair trust update (sorted by the previous paths)
+};
+
+/// Minimal propagation state for the navigator
+template <typename stepping_t, typename navigation_t>
+struct prop_state {
+    stepping_t _stepping;
+    navigation_t _navigation;
+};
+
+/// Record the candidate caches of straight line tracks through the toy
+/// detector after every navigation update
+const std::vector<candidates_t> &toy_candidates() {
+
+    static const std::vector<candidates_t> samples = []() {
+        using stepper_t = line_stepper<test::algebra>;
+        using trk_generator_t =
+            uniform_track_generator<free_track_parameters<test::algebra>>;
+
+        vecmem::host_memory_resource host_mr;
+        const auto [det, names] = build_toy_detector(host_mr);
+
+        navigation::config<test::scalar> cfg{};
+        cfg.search_window = {3u, 3u};
+
+        auto trk_generator = trk_generator_t{};
+        trk_generator.config().theta_steps(20u).phi_steps(20u);
+
+        std::vector<candidates_t> recorded{};
+        for (const auto track : trk_generator) {
+            stepper_t stepper;
+            navigator_t nav;
+            prop_state<stepper_t::state, navigator_t::state> propagation{
+                stepper_t::state{track}, navigator_t::state(det, host_mr)};
+            auto &navigation = propagation._navigation;
+
+            bool heartbeat{nav.init(propagation, cfg)};
+            while (heartbeat) {
+                if (navigation.n_candidates() > 1) {
+                    recorded.emplace_back(navigation.begin(),
+                                          navigation.end());
+                }
+                stepper.step(propagation);
+                navigation.set_high_trust();
+                heartbeat = nav.update(propagation, cfg);
+            }
+        }
+        return recorded;
+    }();
+
+    return samples;
+}
+
+/// Prepare the input of the sort from the recorded (sorted) candidates
+std::vector<candidates_t> make_input(const presortedness order) {
+
+    std::vector<candidates_t> input{toy_candidates()};
+
+    std::mt19937_64 gen(42u);
+    // Change of the candidate distances after a step (e.g. track bending)
+    std::normal_distribution<test::scalar> jitter(
+        0.f, 1.f * unit<test::scalar>::mm);
+
+    for (auto &candidates : input) {
+        if (order == presortedness::e_random) {
+            std::shuffle(candidates.begin(), candidates.end(), gen);
+        } else {
+            for (auto &candidate : candidates) {
+                candidate.path += jitter(gen);
+            }
+        }
+    }
+
+    return input;
+}
+
+}  // anonymous namespace
+
+// This benchmark sorts navigation candidate caches of the toy detector with
+// different algorithms
+void BM_SORT_CANDIDATES(benchmark::State &state, sort_algorithm algorithm,
+                        presortedness order) {
+
+    const std::vector<candidates_t> input = make_input(order);
+    std::vector<candidates_t> work{input};
+
+    std::size_t n_candidates{0u};
+    for (const auto &candidates : input) {
+        n_candidates += candidates.size();
+    }
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::copy(input.begin(), input.end(), work.begin());
+        state.ResumeTiming();
+
+        for (auto &candidates : work) {
+            switch (algorithm) {
+                case sort_algorithm::e_insertion: {
+                    insertion_sort(candidates.begin(), candidates.end());
+                    break;
+                }
+                case sort_algorithm::e_selection: {
+                    selection_sort(candidates.begin(), candidates.end());
+                    break;
+                }
+                case sort_algorithm::e_adaptive: {
+                    detail::adaptive_sort(candidates.begin(), candidates.end());
+                    break;
+                }
+                default: {
+                    std::sort(candidates.begin(), candidates.end());
+                    break;
+                }
+            }
+            benchmark::DoNotOptimize(candidates.data());
+        }
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["n_caches"] = static_cast<double>(input.size());
+    state.counters["mean_candidates"] =
+        static_cast<double>(n_candidates) / static_cast<double>(input.size());
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(input.size()));
+}
+
+BENCHMARK_CAPTURE(BM_SORT_CANDIDATES, std_sort_random,
+                  sort_algorithm::e_std_sort, presortedness::e_random)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_SORT_CANDIDATES, insertion_sort_random,
+                  sort_algorithm::e_insertion, presortedness::e_random)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_SORT_CANDIDATES, selection_sort_random,
+                  sort_algorithm::e_selection, presortedness::e_random)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_SORT_CANDIDATES, adaptive_sort_random,
+                  sort_algorithm::e_adaptive, presortedness::e_random)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_SORT_CANDIDATES, std_sort_update,
+                  sort_algorithm::e_std_sort, presortedness::e_update)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_SORT_CANDIDATES, insertion_sort_update,
+                  sort_algorithm::e_insertion, presortedness::e_update)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_SORT_CANDIDATES, selection_sort_update,
+                  sort_algorithm::e_selection, presortedness::e_update)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_SORT_CANDIDATES, adaptive_sort_update,
+                  sort_algorithm::e_adaptive, presortedness::e_update)
+    ->Unit(benchmark::kMicrosecond);
@@ -20,6 +20,10 @@
 // Google include(s).
 #include <benchmark/benchmark.h>
 
+// System include(s)
+#include <cstdlib>
+#include <type_traits>
+
 using namespace detray;
 
 // VecMem memory resource(s)
@@ -32,14 +36,50 @@ vecmem::binary_page_memory_resource bp_mng_mr(mng_mr);
 auto toy_cfg = toy_det_config<scalar>{}.n_brl_layers(4u).n_edc_layers(7u);
 
 void fill_tracks(vecmem::vector<free_track_parameters<algebra_t>> &tracks,
-                 const std::size_t theta_steps, const std::size_t phi_steps) {
+                 const std::size_t theta_steps, const std::size_t phi_steps,
+                 const bool full_spectrum = false) {
     // Set momentum of tracks
     const scalar mom_mag{10.f * unit<scalar>::GeV};
 
+    // Momenta of the full spectrum
+    constexpr std::size_t n_p_steps{8u};
+    const scalar p_min{0.5f * unit<scalar>::GeV};
+
     // Iterate through uniformly distributed momentum directions
+    std::size_t i{0u};
     for (auto traj : uniform_track_generator<free_track_parameters<algebra_t>>(
              phi_steps, theta_steps, mom_mag)) {
+        if (full_spectrum) {
+            // Cycle through momenta between p_min and mom_mag
+            const scalar p{p_min + (mom_mag - p_min) *
+                                       static_cast<scalar>(i % n_p_steps) /
+                                       static_cast<scalar>(n_p_steps - 1u)};
+            traj.set_qop(traj.charge() / p);
+        }
         tracks.push_back(traj);
+        ++i;
+    }
+}
+
+/// Attach the device-side kernel @param counters to the benchmark @param state
+void set_kernel_counters(benchmark::State &state,
+                         const kernel_counters &counters) {
+    if (counters.n_tracks == 0ull) {
+        return;
+    }
+
+    // Lanes per warp on all current NVIDIA devices
+    constexpr double warp_size{32.};
+
+    const auto n_tracks{static_cast<double>(counters.n_tracks)};
+    state.counters["steps_per_track"] =
+        static_cast<double>(counters.n_steps) / n_tracks;
+    state.counters["nav_calls_per_track"] =
+        static_cast<double>(counters.n_nav_calls) / n_tracks;
+    if (counters.n_warp_steps > 0ull) {
+        state.counters["active_lanes"] =
+            static_cast<double>(counters.n_active_lanes) /
+            (warp_size * static_cast<double>(counters.n_warp_steps));
     }
 }
 
@@ -52,9 +92,7 @@ static void BM_PROPAGATOR_CPU(benchmark::State &state) {
     auto bfield = bfield::create_const_field(B);
 
     // Create propagator
-    propagation::config<scalar> cfg{};
-    cfg.navigation.search_window = {3u, 3u};
-    propagator_host_type p{cfg};
+    propagator_host_type p{benchmark_config()};
 
     std::size_t total_tracks = 0;
 
@@ -98,7 +136,7 @@ static void BM_PROPAGATOR_CPU(benchmark::State &state) {
         static_cast<double>(total_tracks), benchmark::Counter::kIsRate);
 }
 
-template <propagate_option opt>
+template <propagate_option opt, bool full_spectrum = false>
 static void BM_PROPAGATOR_CUDA(benchmark::State &state) {
 
     // Create the toy geometry
@@ -112,6 +150,9 @@ static void BM_PROPAGATOR_CUDA(benchmark::State &state) {
     // vecmem copy helper object
     vecmem::cuda::copy copy;
 
+    // Device-side counters of the propagation kernel
+    vecmem::vector<kernel_counters> counters(1u, &mng_mr);
+
     std::size_t total_tracks = 0;
 
     for (auto _ : state) {
@@ -121,7 +162,7 @@ static void BM_PROPAGATOR_CUDA(benchmark::State &state) {
         // Get tracks
         vecmem::vector<free_track_parameters<algebra_t>> tracks(&bp_mng_mr);
         fill_tracks(tracks, static_cast<std::size_t>(state.range(0)),
-                    static_cast<std::size_t>(state.range(0)));
+                    static_cast<std::size_t>(state.range(0)), full_spectrum);
 
         total_tracks += tracks.size();
 
@@ -131,17 +172,106 @@ static void BM_PROPAGATOR_CUDA(benchmark::State &state) {
         auto tracks_data = vecmem::get_data(tracks);
 
         // Create navigator candidates buffer
-        auto candidates_buffer =
-            create_candidates_buffer(det, tracks.size(), dev_mr, &mng_mr);
-        copy.setup(candidates_buffer);
+        auto candidates_buffer = [&]() {
+            nvtx_range range{"upload"};
+            auto buffer = create_candidates_buffer(
+                det, tracks.size(), benchmark_config().navigation, dev_mr,
+                &mng_mr);
+            copy.setup(buffer);
+            return buffer;
+        }();
 
         // Run the propagator test for GPU device
-        propagator_benchmark(det_data, bfield, tracks_data, candidates_buffer,
-                             opt);
+        if constexpr (opt == propagate_option::e_regroup) {
+            vecmem::vector<unsigned int> indices(tracks.size(), &mng_mr);
+            vecmem::vector<unsigned int> is_alive(tracks.size(), &mng_mr);
+            vecmem::vector<unsigned int> keys(tracks.size(), &mng_mr);
+
+            propagator_benchmark_regrouped(det_data, bfield, tracks_data,
+                                           candidates_buffer, indices,
+                                           is_alive, keys);
+        } else {
+            propagator_benchmark<bfield::const_bknd_t>(
+                det_data, bfield, tracks_data, candidates_buffer, opt,
+                counters.data());
+        }
     }
 
     state.counters["TracksPropagated"] = benchmark::Counter(
         static_cast<double>(total_tracks), benchmark::Counter::kIsRate);
+
+    nvtx_range range{"download"};
+    set_kernel_counters(state, counters.front());
+}
+
+/// Propagation in the inhomogeneous field, stored in the device field backend
+/// @tparam device_bknd_t
+template <typename device_bknd_t>
+static void BM_PROPAGATOR_CUDA_INHOM(benchmark::State &state) {
+
+    if (!std::getenv("DETRAY_BFIELD_FILE")) {
+        state.SkipWithError("DETRAY_BFIELD_FILE is not set");
+        return;
+    }
+
+    // Create the toy geometry
+    auto [det, names] = build_toy_detector(bp_mng_mr, toy_cfg);
+    auto det_data = detray::get_data(det);
+
+    // Upload the field to device (array or texture)
+    const bfield::inhom_field_t host_field = bfield::create_inhom_field();
+    covfie::field<device_bknd_t> device_field = [&host_field]() {
+        if constexpr (std::is_same_v<device_bknd_t,
+                                     bfield::cuda::inhom_tex_bknd_t>) {
+            return bfield::cuda::create_inhom_texture_field(host_field);
+        } else {
+            return covfie::field<device_bknd_t>(host_field);
+        }
+    }();
+
+    // vecmem copy helper object
+    vecmem::cuda::copy copy;
+
+    // Device-side counters of the propagation kernel
+    vecmem::vector<kernel_counters> counters(1u, &mng_mr);
+
+    std::size_t total_tracks = 0;
+
+    for (auto _ : state) {
+
+        state.PauseTiming();
+
+        // Get tracks
+        vecmem::vector<free_track_parameters<algebra_t>> tracks(&bp_mng_mr);
+        fill_tracks(tracks, static_cast<std::size_t>(state.range(0)),
+                    static_cast<std::size_t>(state.range(0)));
+
+        total_tracks += tracks.size();
+
+        state.ResumeTiming();
+
+        auto tracks_data = vecmem::get_data(tracks);
+
+        // Create navigator candidates buffer
+        auto candidates_buffer = [&]() {
+            nvtx_range range{"upload"};
+            auto buffer = create_candidates_buffer(
+                det, tracks.size(), benchmark_config().navigation, dev_mr,
+                &mng_mr);
+            copy.setup(buffer);
+            return buffer;
+        }();
+
+        propagator_benchmark<device_bknd_t>(
+            det_data, device_field, tracks_data, candidates_buffer,
+            propagate_option::e_unsync, counters.data());
+    }
+
+    state.counters["TracksPropagated"] = benchmark::Counter(
+        static_cast<double>(total_tracks), benchmark::Counter::kIsRate);
+
+    nvtx_range range{"download"};
+    set_kernel_counters(state, counters.front());
 }
 
 BENCHMARK_TEMPLATE(BM_PROPAGATOR_CPU, propagate_option::e_unsync)
@@ -161,4 +291,26 @@ BENCHMARK_TEMPLATE(BM_PROPAGATOR_CUDA, propagate_option::e_sync)
     ->RangeMultiplier(2)
     ->Range(8, 256);
 
+BENCHMARK_TEMPLATE(BM_PROPAGATOR_CUDA, propagate_option::e_sync, true)
+    ->Name("CUDA sync propagation (full momentum spectrum)")
+    ->RangeMultiplier(2)
+    ->Range(8, 256);
+BENCHMARK_TEMPLATE(BM_PROPAGATOR_CUDA, propagate_option::e_regroup, true)
+    ->Name("CUDA regrouped propagation (full momentum spectrum)")
+    ->RangeMultiplier(2)
+    ->Range(8, 256);
+BENCHMARK_TEMPLATE(BM_PROPAGATOR_CUDA, propagate_option::e_persistent, true)
+    ->Name("CUDA persistent propagation (full momentum spectrum)")
+    ->RangeMultiplier(2)
+    ->Range(8, 256);
+
+BENCHMARK_TEMPLATE(BM_PROPAGATOR_CUDA_INHOM, bfield::cuda::inhom_bknd_t)
+    ->Name("CUDA unsync propagation (inhom. field, array)")
+    ->RangeMultiplier(2)
+    ->Range(8, 256);
+BENCHMARK_TEMPLATE(BM_PROPAGATOR_CUDA_INHOM, bfield::cuda::inhom_tex_bknd_t)
+    ->Name("CUDA unsync propagation (inhom. field, texture)")
+    ->RangeMultiplier(2)
+    ->Range(8, 256);
+
 BENCHMARK_MAIN();
@@ -8,67 +8,314 @@
 #include "benchmark_propagator_cuda_kernel.hpp"
 #include "detray/definitions/detail/cuda_definitions.hpp"
 
+// NVTX include(s)
+#include <nvtx3/nvToolsExt.h>
+
+// System include(s)
+#include <algorithm>
+
 namespace detray {
 
+nvtx_range::nvtx_range(const char* name) {
+    nvtxRangePushA(name);
+}
+
+nvtx_range::~nvtx_range() {
+    nvtxRangePop();
+}
+
+template <typename bfield_bknd_t>
 __global__ void __launch_bounds__(256, 4) propagator_benchmark_kernel(
     typename detector_host_type::view_type det_data,
-    covfie::field_view<bfield::const_bknd_t> field_data,
+    covfie::field_view<bfield_bknd_t> field_data,
     vecmem::data::vector_view<free_track_parameters<algebra_t>> tracks_data,
     vecmem::data::jagged_vector_view<intersection_t> candidates_data,
-    const propagate_option opt) {
+    const propagate_option opt, unsigned int* work_counter,
+    kernel_counters* counters) {
 
-    int gid = threadIdx.x + blockIdx.x * blockDim.x;
+    const unsigned int gid = threadIdx.x + blockIdx.x * blockDim.x;
 
     detector_device_type det(det_data);
     vecmem::device_vector<free_track_parameters<algebra_t>> tracks(tracks_data);
     vecmem::jagged_device_vector<intersection_t> candidates(candidates_data);
 
-    if (gid >= tracks.size()) {
-        return;
+    // Create propagator
+    propagator_device_t<bfield_bknd_t> p{benchmark_config()};
+
+    auto propagate_track = [&](const unsigned int trk_idx) {
+        parameter_transporter<algebra_t>::state transporter_state{};
+        pointwise_material_interactor<algebra_t>::state interactor_state{};
+        parameter_resetter<algebra_t>::state resetter_state{};
+
+        // Create the actor states
+        auto actor_states =
+            tie(transporter_state, interactor_state, resetter_state);
+        // Create the propagator state
+        typename propagator_device_t<bfield_bknd_t>::state p_state(
+            tracks.at(trk_idx), field_data, det, candidates.at(trk_idx));
+
+        // Run propagation
+        if (opt == propagate_option::e_unsync or
+            opt == propagate_option::e_persistent) {
+            p.propagate(p_state, actor_states);
+        } else if (opt == propagate_option::e_sync) {
+            p.propagate_sync(p_state, actor_states);
+        }
+
+        // Add the counts of the track to the global counters
+        if (counters != nullptr) {
+            const counting_timer& cnt = p_state._timer;
+            atomicAdd(&counters->n_tracks, 1ull);
+            atomicAdd(&counters->n_steps,
+                      static_cast<unsigned long long>(cnt.n_steps));
+            atomicAdd(&counters->n_nav_calls,
+                      static_cast<unsigned long long>(cnt.n_nav_calls));
+            atomicAdd(&counters->n_warp_steps,
+                      static_cast<unsigned long long>(cnt.n_warp_steps));
+            atomicAdd(&counters->n_active_lanes,
+                      static_cast<unsigned long long>(cnt.n_active_lanes));
+        }
+    };
+
+    if (opt == propagate_option::e_persistent) {
+        // Pull tracks from the work queue until it is empty
+        for (unsigned int trk_idx = atomicAdd(work_counter, 1u);
+             trk_idx < tracks.size(); trk_idx = atomicAdd(work_counter, 1u)) {
+            propagate_track(trk_idx);
+        }
+    } else if (gid < tracks.size()) {
+        propagate_track(gid);
     }
+}
 
-    // Create propagator
-    propagation::config<scalar> cfg{};
-    cfg.navigation.search_window = {3u, 3u};
-    propagator_device_type p{cfg};
+template <typename bfield_bknd_t>
+void propagator_benchmark(
+    typename detector_host_type::view_type det_data,
+    covfie::field_view<bfield_bknd_t> field_data,
+    vecmem::data::vector_view<free_track_parameters<algebra_t>>& tracks_data,
+    vecmem::data::jagged_vector_view<intersection_t>& candidates_data,
+    const propagate_option opt, kernel_counters* counters) {
+
+    constexpr int thread_dim = 256;
+    int block_dim =
+        static_cast<int>(tracks_data.size() + thread_dim - 1) / thread_dim;
+
+    // Persistent threads: Only launch as many blocks as can be resident
+    unsigned int* work_counter{nullptr};
+    if (opt == propagate_option::e_persistent) {
+        int device{0};
+        int n_sms{0};
+        int blocks_per_sm{0};
+        DETRAY_CUDA_ERROR_CHECK(cudaGetDevice(&device));
+        DETRAY_CUDA_ERROR_CHECK(cudaDeviceGetAttribute(
+            &n_sms, cudaDevAttrMultiProcessorCount, device));
+        DETRAY_CUDA_ERROR_CHECK(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+            &blocks_per_sm, propagator_benchmark_kernel<bfield_bknd_t>,
+            thread_dim, 0u));
+        block_dim = std::max(1, std::min(block_dim, n_sms * blocks_per_sm));
+
+        DETRAY_CUDA_ERROR_CHECK(
+            cudaMalloc(&work_counter, sizeof(unsigned int)));
+        DETRAY_CUDA_ERROR_CHECK(
+            cudaMemset(work_counter, 0, sizeof(unsigned int)));
+    }
+
+    // run the test kernel
+    {
+        nvtx_range range{"propagation kernel"};
+
+        propagator_benchmark_kernel<bfield_bknd_t><<<block_dim, thread_dim>>>(
+            det_data, field_data, tracks_data, candidates_data, opt,
+            work_counter, counters);
+
+        // cuda error check
+        DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
+        DETRAY_CUDA_ERROR_CHECK(cudaDeviceSynchronize());
+    }
+
+    if (work_counter != nullptr) {
+        DETRAY_CUDA_ERROR_CHECK(cudaFree(work_counter));
+    }
+}
+
+/// Explicit instantiations for the magnetic field backends
+/// @{
+template void propagator_benchmark<bfield::const_bknd_t>(
+    typename detector_host_type::view_type,
+    covfie::field_view<bfield::const_bknd_t>,
+    vecmem::data::vector_view<free_track_parameters<algebra_t>>&,
+    vecmem::data::jagged_vector_view<intersection_t>&,
+    const propagate_option, kernel_counters*);
+
+template void propagator_benchmark<bfield::cuda::inhom_bknd_t>(
+    typename detector_host_type::view_type,
+    covfie::field_view<bfield::cuda::inhom_bknd_t>,
+    vecmem::data::vector_view<free_track_parameters<algebra_t>>&,
+    vecmem::data::jagged_vector_view<intersection_t>&,
+    const propagate_option, kernel_counters*);
+
+template void propagator_benchmark<bfield::cuda::inhom_tex_bknd_t>(
+    typename detector_host_type::view_type,
+    covfie::field_view<bfield::cuda::inhom_tex_bknd_t>,
+    vecmem::data::vector_view<free_track_parameters<algebra_t>>&,
+    vecmem::data::jagged_vector_view<intersection_t>&,
+    const propagate_option, kernel_counters*);
+/// @}
+
+/// Propagation and actor states of a track that persist between the rounds
+/// of the regrouped propagation
+struct regroup_track_state {
+
+    DETRAY_DEVICE
+    regroup_track_state(
+        const free_track_parameters<algebra_t>& track,
+        const covfie::field_view<bfield::const_bknd_t>& field_data,
+        const detector_device_type& det,
+        vecmem::device_vector<intersection_t>&& candidates)
+        : p_state(track, field_data, det, std::move(candidates)) {}
 
     parameter_transporter<algebra_t>::state transporter_state{};
     pointwise_material_interactor<algebra_t>::state interactor_state{};
     parameter_resetter<algebra_t>::state resetter_state{};
 
-    // Create the actor states
+    propagator_device_type::state p_state;
+};
+
+/// Number of momentum bins per volume for the regrouping
+constexpr unsigned int regroup_n_qop_bins{8u};
+/// Largest binned |q/p| for the regrouping
+constexpr scalar regroup_qop_max{1.f / (0.5f * unit<scalar>::GeV)};
+
+/// The device detector has to outlive the kernel, since the propagation
+/// states keep a pointer to it
+__global__ void regroup_setup_kernel(
+    typename detector_host_type::view_type det_data,
+    detector_device_type* det) {
+
+    if (threadIdx.x + blockIdx.x * blockDim.x == 0) {
+        new (det) detector_device_type(det_data);
+    }
+}
+
+__global__ void __launch_bounds__(256, 4) regroup_init_kernel(
+    const detector_device_type* det,
+    covfie::field_view<bfield::const_bknd_t> field_data,
+    vecmem::data::vector_view<free_track_parameters<algebra_t>> tracks_data,
+    vecmem::data::jagged_vector_view<intersection_t> candidates_data,
+    regroup_track_state* track_states,
+    vecmem::data::vector_view<unsigned int> is_alive_data,
+    vecmem::data::vector_view<unsigned int> keys_data) {
+
+    int gid = threadIdx.x + blockIdx.x * blockDim.x;
+
+    vecmem::device_vector<free_track_parameters<algebra_t>> tracks(tracks_data);
+    vecmem::jagged_device_vector<intersection_t> candidates(candidates_data);
+    vecmem::device_vector<unsigned int> is_alive(is_alive_data);
+    vecmem::device_vector<unsigned int> keys(keys_data);
+
+    if (gid >= tracks.size()) {
+        return;
+    }
+
+    propagator_device_type p{benchmark_config()};
+
+    regroup_track_state* trk_state = new (&track_states[gid])
+        regroup_track_state(tracks.at(gid), field_data, *det,
+                            candidates.at(gid));
+
     auto actor_states =
-        tie(transporter_state, interactor_state, resetter_state);
-    // Create the propagator state
-    propagator_device_type::state p_state(tracks.at(gid), field_data, det,
-                                          candidates.at(gid));
-
-    // Run propagation
-    if (opt == propagate_option::e_unsync) {
-        p.propagate(p_state, actor_states);
-    } else if (opt == propagate_option::e_sync) {
-        p.propagate_sync(p_state, actor_states);
+        tie(trk_state->transporter_state, trk_state->interactor_state,
+            trk_state->resetter_state);
+
+    is_alive.at(gid) = p.propagate_init(trk_state->p_state, actor_states);
+    keys.at(gid) = propagation::regroup_key(
+        trk_state->p_state, regroup_n_qop_bins, regroup_qop_max);
+}
+
+__global__ void __launch_bounds__(256, 4) regroup_step_kernel(
+    regroup_track_state* track_states,
+    vecmem::data::vector_view<unsigned int> indices_data,
+    const unsigned int n_live,
+    vecmem::data::vector_view<unsigned int> is_alive_data,
+    vecmem::data::vector_view<unsigned int> keys_data) {
+
+    unsigned int gid = threadIdx.x + blockIdx.x * blockDim.x;
+
+    vecmem::device_vector<unsigned int> indices(indices_data);
+    vecmem::device_vector<unsigned int> is_alive(is_alive_data);
+    vecmem::device_vector<unsigned int> keys(keys_data);
+
+    if (gid >= n_live) {
+        return;
     }
+
+    propagator_device_type p{benchmark_config()};
+
+    // Neighbouring threads propagate tracks of the same group
+    const unsigned int trk_idx{indices.at(gid)};
+    regroup_track_state& trk_state = track_states[trk_idx];
+
+    auto actor_states =
+        tie(trk_state.transporter_state, trk_state.interactor_state,
+            trk_state.resetter_state);
+
+    is_alive.at(trk_idx) =
+        p.propagate_steps(trk_state.p_state, actor_states, regroup_n_steps);
+    keys.at(trk_idx) = propagation::regroup_key(
+        trk_state.p_state, regroup_n_qop_bins, regroup_qop_max);
 }
 
-void propagator_benchmark(
+void propagator_benchmark_regrouped(
     typename detector_host_type::view_type det_data,
     covfie::field_view<bfield::const_bknd_t> field_data,
     vecmem::data::vector_view<free_track_parameters<algebra_t>>& tracks_data,
     vecmem::data::jagged_vector_view<intersection_t>& candidates_data,
-    const propagate_option opt) {
+    vecmem::vector<unsigned int>& indices,
+    vecmem::vector<unsigned int>& is_alive,
+    vecmem::vector<unsigned int>& keys) {
 
     constexpr int thread_dim = 256;
-    int block_dim =
-        static_cast<int>(tracks_data.size() + thread_dim - 1) / thread_dim;
+    const auto n_tracks{static_cast<unsigned int>(tracks_data.size())};
 
-    // run the test kernel
-    propagator_benchmark_kernel<<<block_dim, thread_dim>>>(
-        det_data, field_data, tracks_data, candidates_data, opt);
+    // Storage for the states that persist between the kernel launches
+    detector_device_type* det{nullptr};
+    regroup_track_state* track_states{nullptr};
+    DETRAY_CUDA_ERROR_CHECK(
+        cudaMalloc(&det, sizeof(detector_device_type)));
+    DETRAY_CUDA_ERROR_CHECK(
+        cudaMalloc(&track_states, n_tracks * sizeof(regroup_track_state)));
 
-    // cuda error check
+    regroup_setup_kernel<<<1, 1>>>(det_data, det);
+    DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
+
+    int block_dim = static_cast<int>(n_tracks + thread_dim - 1) / thread_dim;
+    regroup_init_kernel<<<block_dim, thread_dim>>>(
+        det, field_data, tracks_data, candidates_data, track_states,
+        vecmem::get_data(is_alive), vecmem::get_data(keys));
     DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
     DETRAY_CUDA_ERROR_CHECK(cudaDeviceSynchronize());
+
+    for (unsigned int i = 0u; i < n_tracks; ++i) {
+        indices[i] = i;
+    }
+    unsigned int n_live{
+        propagation::regroup_tracks(indices, n_tracks, is_alive, keys)};
+
+    // Propagate the live tracks in rounds and compact them in between, so
+    // that the warps stay densely populated
+    while (n_live > 0u) {
+        block_dim = static_cast<int>(n_live + thread_dim - 1) / thread_dim;
+        regroup_step_kernel<<<block_dim, thread_dim>>>(
+            track_states, vecmem::get_data(indices), n_live,
+            vecmem::get_data(is_alive), vecmem::get_data(keys));
+        DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
+        DETRAY_CUDA_ERROR_CHECK(cudaDeviceSynchronize());
+
+        n_live = propagation::regroup_tracks(indices, n_live, is_alive, keys);
+    }
+
+    DETRAY_CUDA_ERROR_CHECK(cudaFree(track_states));
+    DETRAY_CUDA_ERROR_CHECK(cudaFree(det));
 }
 
 }  // namespace detray
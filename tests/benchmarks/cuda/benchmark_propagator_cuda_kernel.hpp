@@ -11,6 +11,7 @@
 #include "detray/definitions/detail/algebra.hpp"
 #include "detray/definitions/units.hpp"
 #include "detray/detectors/bfield.hpp"
+#include "detray/detectors/cuda/bfield.hpp"
 #include "detray/detectors/toy_metadata.hpp"
 #include "detray/navigation/navigator.hpp"
 #include "detray/propagator/actor_chain.hpp"
@@ -19,10 +20,18 @@
 #include "detray/propagator/actors/parameter_transporter.hpp"
 #include "detray/propagator/actors/pointwise_material_interactor.hpp"
 #include "detray/propagator/base_actor.hpp"
+#include "detray/propagator/propagation_timer.hpp"
 #include "detray/propagator/propagator.hpp"
 #include "detray/propagator/rk_stepper.hpp"
+#include "detray/propagator/track_regrouping.hpp"
 #include "detray/tracks/tracks.hpp"
 
+// Vecmem include(s)
+#include <vecmem/containers/vector.hpp>
+
+// System include(s)
+#include <cstdint>
+
 using namespace detray;
 
 using algebra_t = ALGEBRA_PLUGIN<detray::scalar>;
@@ -45,19 +54,124 @@ using propagator_host_type =
 using propagator_device_type =
     propagator<rk_stepper_type, navigator_device_type, actor_chain_t>;
 
+/// @returns the propagation config of the benchmarks (host and device)
+DETRAY_HOST_DEVICE inline propagation::config<scalar> benchmark_config() {
+    propagation::config<scalar> cfg{};
+    cfg.navigation.search_window = {3u, 3u};
+    return cfg;
+}
+
+/// Counters of the propagation kernel, summed over all tracks
+struct kernel_counters {
+    /// Number of propagated tracks
+    unsigned long long n_tracks{0ull};
+    /// Number of steps, i.e. iterations of the inner propagation loop
+    unsigned long long n_steps{0ull};
+    /// Number of navigation calls
+    unsigned long long n_nav_calls{0ull};
+    /// Number of steps that were taken by a warp (counted once per warp)
+    unsigned long long n_warp_steps{0ull};
+    /// Number of active lanes, summed over the warp steps
+    unsigned long long n_active_lanes{0ull};
+};
+
+/// @brief Propagation timer that counts the propagation phases of a track
+/// instead of timing them.
+///
+/// On device, every step also samples which lanes of the warp take the step
+/// together, which measures the thread divergence of the propagation. The
+/// counts are kept per track and are only added to the global counters once
+/// the track is finished.
+struct counting_timer {
+
+    using tick_type = std::uint64_t;
+
+    DETRAY_HOST_DEVICE
+    static constexpr tick_type now() { return 0u; }
+
+    DETRAY_HOST_DEVICE
+    inline void add(const propagation::phase p, const tick_type) {
+        if (p == propagation::phase::e_stepping) {
+            ++n_steps;
+#if defined(__CUDA_ARCH__)
+            const unsigned int mask{__activemask()};
+            // The lowest active lane counts for the whole warp
+            const auto leader{static_cast<unsigned int>(__ffs(mask) - 1)};
+            if (threadIdx.x % static_cast<unsigned int>(warpSize) == leader) {
+                ++n_warp_steps;
+                n_active_lanes += static_cast<unsigned int>(__popc(mask));
+            }
+#endif
+        } else if (p == propagation::phase::e_navigation) {
+            ++n_nav_calls;
+        }
+    }
+
+    unsigned int n_steps{0u};
+    unsigned int n_nav_calls{0u};
+    unsigned int n_warp_steps{0u};
+    unsigned int n_active_lanes{0u};
+};
+
+/// Device propagator for the magnetic field backend @tparam bfield_bknd_t
+template <typename bfield_bknd_t>
+using propagator_device_t =
+    propagator<rk_stepper<covfie::field_view<bfield_bknd_t>, algebra_t>,
+               navigator_device_type, actor_chain_t, counting_timer>;
+
 enum class propagate_option {
     e_unsync = 0,
     e_sync = 1,
+    /// Propagation in rounds of a few steps, after which the finished tracks
+    /// are removed and the live tracks are regrouped by volume and momentum
+    e_regroup = 2,
+    /// Persistent threads that pull the tracks from a global work queue
+    e_persistent = 3,
 };
 
+/// Number of steps between the regrouping of the live tracks
+constexpr unsigned int regroup_n_steps{20u};
+
 namespace detray {
 
+/// @brief NVTX range that is open during the lifetime of the object.
+///
+/// Marks the phases of the benchmark (e.g. upload, kernel and download) in
+/// the timeline of the Nsight Systems profiler. Free, if no profiler is
+/// attached.
+class nvtx_range {
+    public:
+    explicit nvtx_range(const char* name);
+    ~nvtx_range();
+
+    nvtx_range(const nvtx_range&) = delete;
+    nvtx_range& operator=(const nvtx_range&) = delete;
+};
+
 /// test function for propagator with single state
+///
+/// @param counters if given, the kernel counters are added to it
+///                 (managed memory)
+template <typename bfield_bknd_t>
 void propagator_benchmark(
+    typename detector_host_type::view_type det_data,
+    covfie::field_view<bfield_bknd_t> field_data,
+    vecmem::data::vector_view<free_track_parameters<algebra_t>>& tracks_data,
+    vecmem::data::jagged_vector_view<intersection_t>& candidates_data,
+    const propagate_option opt, kernel_counters* counters = nullptr);
+
+/// test function for the propagation in rounds with regrouping of the tracks
+///
+/// @param indices track indices in the order of propagation (managed memory)
+/// @param is_alive whether a track is still alive (managed memory)
+/// @param keys regrouping sort key per track (managed memory)
+void propagator_benchmark_regrouped(
     typename detector_host_type::view_type det_data,
     typename field_type::view_t field_data,
     vecmem::data::vector_view<free_track_parameters<algebra_t>>& tracks_data,
     vecmem::data::jagged_vector_view<intersection_t>& candidates_data,
-    const propagate_option opt);
+    vecmem::vector<unsigned int>& indices,
+    vecmem::vector<unsigned int>& is_alive,
+    vecmem::vector<unsigned int>& keys);
 
 }  // namespace detray
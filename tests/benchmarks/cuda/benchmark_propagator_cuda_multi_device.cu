@@ -0,0 +1,116 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/detectors/build_toy_detector.hpp"
+#include "detray/detectors/toy_metadata.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/actors/aborters.hpp"
+#include "detray/propagator/cuda/propagate_multi_device.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/simulation/event_generator/track_generators.hpp"
+#include "detray/test/types.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/cuda/host_memory_resource.hpp>
+
+// Google include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <string>
+#include <vector>
+
+using namespace detray;
+
+using algebra_t = ALGEBRA_PLUGIN<detray::scalar>;
+
+using device_detector_t = detector<toy_metadata, device_container_types>;
+
+using field_t = bfield::const_field_t;
+using stepper_t = rk_stepper<field_t::view_t, algebra_t>;
+using actor_chain_t = actor_chain<dtuple, pathlimit_aborter>;
+using propagator_t = propagator<
+    stepper_t,
+    navigator<device_detector_t, navigation::void_inspector,
+              intersection2D<device_detector_t::surface_type, algebra_t>,
+              20u>,
+    actor_chain_t>;
+
+using result_t = propagation::result<algebra_t>;
+
+// Pinned host memory, so that the copies of the devices can overlap
+vecmem::cuda::host_memory_resource pinned_mr;
+
+// detector configuration
+auto toy_cfg = toy_det_config<scalar>{}.n_brl_layers(4u).n_edc_layers(7u);
+
+/// Benchmark the propagation of a track batch that is distributed over
+/// several devices
+///
+/// Arguments: number of devices, number of theta and phi steps of the track
+/// generation
+static void BM_PROPAGATOR_CUDA_MULTI_DEVICE(benchmark::State &state) {
+
+    // Use the first devices
+    std::vector<int> devices = cuda::available_devices();
+    const auto n_devices{static_cast<std::size_t>(state.range(0))};
+    if (n_devices > devices.size()) {
+        state.SkipWithError(("Only " + std::to_string(devices.size()) +
+                             " device(s) available")
+                                .c_str());
+        return;
+    }
+    devices.resize(n_devices);
+
+    // Create the toy geometry and upload it to the devices
+    auto [det, names] = build_toy_detector(pinned_mr, toy_cfg);
+    const field_t field =
+        bfield::create_const_field({0.f, 0.f, 2.f * unit<scalar>::T});
+
+    cuda::multi_device_propagator<propagator_t, field_t> device_propagator(
+        devices, det, field);
+
+    // Get tracks
+    const auto n_steps{static_cast<std::size_t>(state.range(1))};
+    vecmem::vector<free_track_parameters<algebra_t>> tracks(&pinned_mr);
+    for (auto traj : uniform_track_generator<free_track_parameters<algebra_t>>(
+             n_steps, n_steps, 10.f * unit<scalar>::GeV)) {
+        tracks.push_back(traj);
+    }
+
+    const actor_chain_t::state_tuple actor_states{pathlimit_aborter::state{}};
+    const propagation::config<scalar> cfg{};
+
+    vecmem::vector<result_t> results(&pinned_mr);
+
+    std::size_t total_tracks = 0;
+
+    for (auto _ : state) {
+        device_propagator.propagate(cuda::launch_config{}, cfg, tracks,
+                                    results, actor_states);
+
+        total_tracks += tracks.size();
+    }
+
+    state.counters["TracksPropagated"] = benchmark::Counter(
+        static_cast<double>(total_tracks), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_PROPAGATOR_CUDA_MULTI_DEVICE)
+    ->Name("CUDA multi-device propagation")
+    ->ArgNames({"n_devices", "n_steps"})
+    ->ArgsProduct({{1, 2, 4, 8}, {128, 256}})
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
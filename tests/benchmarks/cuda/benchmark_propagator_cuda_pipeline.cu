@@ -0,0 +1,128 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/detectors/build_toy_detector.hpp"
+#include "detray/detectors/toy_metadata.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/actors/aborters.hpp"
+#include "detray/propagator/cuda/propagate_pipeline.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/simulation/event_generator/track_generators.hpp"
+#include "detray/test/types.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/cuda/device_memory_resource.hpp>
+#include <vecmem/memory/cuda/host_memory_resource.hpp>
+
+// Google include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <vector>
+
+using namespace detray;
+
+using algebra_t = ALGEBRA_PLUGIN<detray::scalar>;
+
+using device_detector_t = detector<toy_metadata, device_container_types>;
+
+using field_t = bfield::const_field_t;
+using stepper_t = rk_stepper<field_t::view_t, algebra_t>;
+using actor_chain_t = actor_chain<dtuple, pathlimit_aborter>;
+using propagator_t = propagator<
+    stepper_t,
+    navigator<device_detector_t, navigation::void_inspector,
+              intersection2D<device_detector_t::surface_type, algebra_t>,
+              20u>,
+    actor_chain_t>;
+
+using track_t = free_track_parameters<algebra_t>;
+using result_t = propagation::result<algebra_t>;
+
+// Pinned host memory, so that the copies can overlap with the kernels
+vecmem::cuda::host_memory_resource pinned_mr;
+vecmem::cuda::device_memory_resource dev_mr;
+
+// detector configuration
+auto toy_cfg = toy_det_config<scalar>{}.n_brl_layers(4u).n_edc_layers(7u);
+
+/// Number of events that are pushed through the pipeline per iteration
+constexpr std::size_t n_events{32u};
+
+/// Benchmark the sustained throughput of a sequence of events that are
+/// propagated in an overlapping pipeline
+///
+/// Arguments: number of pipeline slots (1 = no overlap), number of theta and
+/// phi steps of the track generation per event
+static void BM_PROPAGATOR_CUDA_PIPELINE(benchmark::State &state) {
+
+    // Create the toy geometry in pinned memory, so that the device can read
+    // it directly
+    auto [det, names] = build_toy_detector(pinned_mr, toy_cfg);
+    const field_t field =
+        bfield::create_const_field({0.f, 0.f, 2.f * unit<scalar>::T});
+
+    // Events of identical shape, with varying momenta
+    const auto n_steps{static_cast<std::size_t>(state.range(1))};
+    std::vector<vecmem::vector<track_t>> events;
+    std::vector<vecmem::vector<result_t>> results;
+    for (std::size_t i = 0u; i < n_events; ++i) {
+        const scalar p{(1.f + static_cast<scalar>(i % 8u)) * unit<scalar>::GeV};
+        auto &tracks = events.emplace_back(&pinned_mr);
+        for (auto traj :
+             uniform_track_generator<track_t>(n_steps, n_steps, p)) {
+            tracks.push_back(traj);
+        }
+        results.emplace_back(tracks.size(), &pinned_mr);
+    }
+    const auto n_tracks{static_cast<unsigned int>(events.front().size())};
+
+    const actor_chain_t::state_tuple actor_states{pathlimit_aborter::state{}};
+    const propagation::config<scalar> cfg{};
+
+    cuda::propagation_pipeline<propagator_t, field_t::view_t> pipeline(
+        dev_mr, static_cast<unsigned int>(state.range(0)), n_tracks,
+        cuda::launch_config{}, cfg, detray::get_data(det), actor_states,
+        field_t::view_t(field));
+
+    std::size_t total_tracks{0u};
+    std::size_t total_bytes{0u};
+
+    for (auto _ : state) {
+        for (std::size_t i = 0u; i < n_events; ++i) {
+            pipeline.submit(events[i], results[i]);
+
+            total_tracks += events[i].size();
+            total_bytes +=
+                events[i].size() * (sizeof(track_t) + sizeof(result_t));
+        }
+        pipeline.wait();
+    }
+
+    // Sustained rates over the whole sequence of events
+    state.counters["TracksPropagated"] = benchmark::Counter(
+        static_cast<double>(total_tracks), benchmark::Counter::kIsRate);
+    state.counters["BytesTransferred"] =
+        benchmark::Counter(static_cast<double>(total_bytes),
+                           benchmark::Counter::kIsRate,
+                           benchmark::Counter::kIs1024);
+}
+
+BENCHMARK(BM_PROPAGATOR_CUDA_PIPELINE)
+    ->Name("CUDA pipelined propagation")
+    ->ArgNames({"n_slots", "n_steps"})
+    ->ArgsProduct({{1, 2, 3, 4}, {16, 64, 128}})
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,214 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/core/trimmed_metadata.hpp"
+#include "detray/definitions/detail/cuda_definitions.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/detectors/build_toy_detector.hpp"
+#include "detray/detectors/toy_metadata.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/actors/parameter_resetter.hpp"
+#include "detray/propagator/actors/parameter_transporter.hpp"
+#include "detray/propagator/actors/pointwise_material_interactor.hpp"
+#include "detray/propagator/cuda/propagate_batch.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/simulation/event_generator/track_generators.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/cuda/managed_memory_resource.hpp>
+
+// Google include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <type_traits>
+
+using namespace detray;
+
+using algebra_t = ALGEBRA_PLUGIN<detray::scalar>;
+
+using field_t = bfield::const_field_t;
+using field_view_t = field_t::view_t;
+
+using mask_id = toy_metadata::mask_ids;
+using material_id = toy_metadata::material_ids;
+
+/// Full device detector
+using device_detector_t = detector<toy_metadata, device_container_types>;
+
+/// Device detector that only visits the types the toy detector is built from
+/// (all of its mask types, but only homogeneous material)
+using trimmed_detector_t = detector<
+    trimmed_metadata<
+        toy_metadata,
+        id_sequence<mask_id::e_rectangle2, mask_id::e_trapezoid2,
+                    mask_id::e_portal_cylinder2, mask_id::e_portal_ring2>,
+        id_sequence<material_id::e_slab>>,
+    device_container_types>;
+
+/// Steppers with and without jacobian transport
+/// @{
+using full_stepper_t = rk_stepper<field_view_t, algebra_t>;
+using no_cov_stepper_t =
+    rk_stepper<field_view_t, algebra_t, unconstrained_step, stepper_rk_policy,
+               stepping::void_inspector, darray, dscalar<algebra_t>, false>;
+/// @}
+
+/// Actor chains with and without covariance transport
+/// @{
+using full_actor_chain_t =
+    actor_chain<tuple, parameter_transporter<algebra_t>,
+                pointwise_material_interactor<algebra_t>,
+                parameter_resetter<algebra_t>>;
+using material_actor_chain_t =
+    actor_chain<tuple, pointwise_material_interactor<algebra_t>>;
+/// @}
+
+/// Batch propagator on the device detector @tparam detector_t
+template <typename detector_t, typename stepper_t, typename actor_chain_t>
+using device_propagator_t = propagator<
+    stepper_t,
+    navigator<detector_t, navigation::void_inspector,
+              intersection2D<typename detector_t::surface_type, algebra_t>,
+              20u>,
+    actor_chain_t>;
+
+/// The benchmarked configurations, from the full to the trimmed propagator
+/// @{
+using full_propagator_t =
+    device_propagator_t<device_detector_t, full_stepper_t, full_actor_chain_t>;
+using no_cov_propagator_t =
+    device_propagator_t<device_detector_t, no_cov_stepper_t,
+                        material_actor_chain_t>;
+using trimmed_propagator_t =
+    device_propagator_t<trimmed_detector_t, no_cov_stepper_t,
+                        material_actor_chain_t>;
+/// @}
+
+// VecMem memory resource(s)
+vecmem::cuda::managed_memory_resource mng_mr;
+
+// detector configuration
+auto toy_cfg = toy_det_config<scalar>{}.n_brl_layers(4u).n_edc_layers(7u);
+
+/// @returns the initial actor states of the chain @tparam actor_chain_t
+template <typename actor_chain_t>
+typename actor_chain_t::state_tuple make_actor_states() {
+    if constexpr (std::is_same_v<actor_chain_t, material_actor_chain_t>) {
+        pointwise_material_interactor<algebra_t>::state interactor_state{};
+        interactor_state.do_covariance_transport = false;
+
+        return typename actor_chain_t::state_tuple{interactor_state};
+    } else {
+        return typename actor_chain_t::state_tuple{};
+    }
+}
+
+/// Add the register and local memory usage and the theoretical occupancy of
+/// the batch propagation kernel for @tparam propagator_t to @param state
+template <typename propagator_t>
+void report_kernel_resources(benchmark::State &state,
+                             const unsigned int threads_per_block) {
+
+    const auto kernel =
+        cuda::kernels::propagate_batch<propagator_t, field_view_t>;
+
+    cudaFuncAttributes attributes{};
+    DETRAY_CUDA_ERROR_CHECK(cudaFuncGetAttributes(&attributes, kernel));
+
+    int device{0};
+    int max_threads_per_sm{0};
+    int blocks_per_sm{0};
+    DETRAY_CUDA_ERROR_CHECK(cudaGetDevice(&device));
+    DETRAY_CUDA_ERROR_CHECK(cudaDeviceGetAttribute(
+        &max_threads_per_sm, cudaDevAttrMaxThreadsPerMultiProcessor, device));
+    DETRAY_CUDA_ERROR_CHECK(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+        &blocks_per_sm, kernel, static_cast<int>(threads_per_block), 0u));
+
+    state.counters["Registers"] = static_cast<double>(attributes.numRegs);
+    state.counters["LocalMemory"] =
+        static_cast<double>(attributes.localSizeBytes);
+    state.counters["Occupancy"] =
+        static_cast<double>(blocks_per_sm * threads_per_block) /
+        static_cast<double>(max_threads_per_sm);
+}
+
+/// Benchmark the batch propagation with the device propagator
+/// @tparam propagator_t
+///
+/// Arguments: number of threads per block, number of theta and phi steps of
+/// the track generation
+template <typename propagator_t>
+static void BM_PROPAGATOR_CUDA_TRIMMED(benchmark::State &state) {
+
+    using actor_chain_t = typename propagator_t::actor_chain_type;
+
+    // Create the toy geometry and bfield
+    auto [det, names] = build_toy_detector(mng_mr, toy_cfg);
+    const field_t field =
+        bfield::create_const_field({0.f, 0.f, 2.f * unit<scalar>::T});
+    const field_view_t field_view(field);
+
+    // Get tracks
+    const auto n_steps{static_cast<std::size_t>(state.range(1))};
+    vecmem::vector<free_track_parameters<algebra_t>> tracks(&mng_mr);
+    for (auto traj : uniform_track_generator<free_track_parameters<algebra_t>>(
+             n_steps, n_steps, 10.f * unit<scalar>::GeV)) {
+        tracks.push_back(traj);
+    }
+    vecmem::vector<propagation::result<algebra_t>> results(tracks.size(),
+                                                           &mng_mr);
+
+    const auto actor_states = make_actor_states<actor_chain_t>();
+
+    propagation::config<scalar> cfg{};
+    cfg.navigation.search_window = {3u, 3u};
+
+    cuda::launch_config launch{};
+    launch.threads_per_block = static_cast<unsigned int>(state.range(0));
+
+    std::size_t total_tracks = 0;
+
+    for (auto _ : state) {
+        // The trimmed detector is constructed from the full detector view
+        cuda::propagate_batch<propagator_t>(
+            launch, cfg, detray::get_data(det), vecmem::get_data(tracks),
+            vecmem::get_data(results), actor_states, field_view);
+        DETRAY_CUDA_ERROR_CHECK(cudaDeviceSynchronize());
+
+        total_tracks += tracks.size();
+    }
+
+    state.counters["TracksPropagated"] = benchmark::Counter(
+        static_cast<double>(total_tracks), benchmark::Counter::kIsRate);
+
+    report_kernel_resources<propagator_t>(state, launch.threads_per_block);
+}
+
+BENCHMARK_TEMPLATE(BM_PROPAGATOR_CUDA_TRIMMED, full_propagator_t)
+    ->Name("CUDA propagation (full)")
+    ->ArgNames({"threads_per_block", "n_steps"})
+    ->ArgsProduct({{64, 128, 256}, {128, 256}})
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PROPAGATOR_CUDA_TRIMMED, no_cov_propagator_t)
+    ->Name("CUDA propagation (no covariance)")
+    ->ArgNames({"threads_per_block", "n_steps"})
+    ->ArgsProduct({{64, 128, 256}, {128, 256}})
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PROPAGATOR_CUDA_TRIMMED, trimmed_propagator_t)
+    ->Name("CUDA propagation (no covariance, trimmed types)")
+    ->ArgNames({"threads_per_block", "n_steps"})
+    ->ArgsProduct({{64, 128, 256}, {128, 256}})
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -30,11 +30,14 @@ class consistency_check : public detray::test::fixture_base<> {
     struct config : public fixture_type::configuration {
         std::string m_name{"detector_consistency"};
         bool m_write_graph{false};
+        // Number of host threads that check the volumes and surfaces
+        unsigned int m_n_threads{1u};
 
         /// Getters
         /// @{
         const std::string &name() const { return m_name; }
         bool write_graph() const { return m_write_graph; }
+        unsigned int n_threads() const { return m_n_threads; }
         /// @}
 
         /// Setters
@@ -47,6 +50,10 @@ class consistency_check : public detray::test::fixture_base<> {
             m_write_graph = do_write;
             return *this;
         }
+        config &n_threads(const unsigned int n) {
+            m_n_threads = n;
+            return *this;
+        }
         /// @}
     };
 
@@ -65,7 +72,9 @@ class consistency_check : public detray::test::fixture_base<> {
         // Build the graph
         volume_graph graph(m_det);
 
-        ASSERT_TRUE(detail::check_consistency(m_det, true))
+        ASSERT_TRUE(detail::check_consistency(m_det, true,
+                                              detail::check_level::e_full,
+                                              m_cfg.n_threads()))
             << graph.to_string();
 
         if (m_cfg.write_graph()) {
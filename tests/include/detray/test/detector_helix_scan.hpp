@@ -9,7 +9,6 @@
 
 // Project include(s)
 #include "detray/geometry/surface.hpp"
-#include "detray/io/frontend/utils/file_handle.hpp"
 #include "detray/navigation/detail/helix.hpp"
 #include "detray/plugins/svgtools/illustrator.hpp"
 #include "detray/simulation/event_generator/track_generators.hpp"
@@ -17,11 +16,18 @@
 #include "detray/test/types.hpp"
 #include "detray/test/utils/particle_gun.hpp"
 #include "detray/test/utils/ray_scan_utils.hpp"
+#include "detray/test/utils/record_writer.hpp"
 #include "detray/test/utils/svg_display.hpp"
+#include "detray/utils/parallel_algorithms.hpp"
 
 // System include(s)
+#include <cstddef>
+#include <functional>
 #include <iostream>
+#include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace detray {
 
@@ -37,6 +43,15 @@ class helix_scan : public test::fixture_base<> {
     public:
     using fixture_type = test::fixture_base<>;
 
+    /// Intersections along a helix, with the indices of their volumes
+    using intersection_record_t = std::vector<std::pair<
+        dindex, intersection2D<typename detector_t::surface_type, algebra_t>>>;
+    /// Records the intersections of the helices of a batch of tracks in the
+    /// given B-field, e.g. on a device
+    using recorder_t = std::function<std::vector<intersection_record_t>(
+        const std::vector<free_track_parameters_t> &,
+        const typename fixture_type::vector3 &)>;
+
     struct config : public fixture_type::configuration {
         using trk_gen_config_t = typename uniform_track_generator<
             free_track_parameters_t>::configuration;
@@ -44,6 +59,13 @@ class helix_scan : public test::fixture_base<> {
         std::string m_name{"helix_scan"};
         bool m_write_inters{false};
         trk_gen_config_t m_trk_gen_cfg{};
+        // Records the intersections instead of the particle gun, if set
+        recorder_t m_recorder{};
+        // Number of tracks that are passed to the recorder at once
+        std::size_t m_batch_size{1u << 16};
+        // Number of host threads that shoot the helices of a batch, if no
+        // recorder is set
+        unsigned int m_n_threads{1u};
         // Visualization style to be applied to the svgs
         detray::svgtools::styling::style m_style =
             detray::svgtools::styling::tableau_colorblind::style;
@@ -56,6 +78,9 @@ class helix_scan : public test::fixture_base<> {
         const trk_gen_config_t &track_generator() const {
             return m_trk_gen_cfg;
         }
+        const recorder_t &intersection_recorder() const { return m_recorder; }
+        std::size_t batch_size() const { return m_batch_size; }
+        unsigned int n_threads() const { return m_n_threads; }
         const auto &svg_style() const { return m_style; }
         /// @}
 
@@ -69,6 +94,18 @@ class helix_scan : public test::fixture_base<> {
             m_write_inters = do_write;
             return *this;
         }
+        config &intersection_recorder(recorder_t recorder) {
+            m_recorder = std::move(recorder);
+            return *this;
+        }
+        config &batch_size(const std::size_t n) {
+            m_batch_size = n;
+            return *this;
+        }
+        config &n_threads(const unsigned int n) {
+            m_n_threads = n;
+            return *this;
+        }
         /// @}
     };
 
@@ -80,6 +117,9 @@ class helix_scan : public test::fixture_base<> {
         m_cfg.name(cfg.name());
         m_cfg.write_intersections(cfg.write_intersections());
         m_cfg.track_generator() = cfg.track_generator();
+        m_cfg.intersection_recorder(cfg.intersection_recorder());
+        m_cfg.batch_size(cfg.batch_size());
+        m_cfg.n_threads(cfg.n_threads());
     }
 
     /// Run the helix scan
@@ -94,9 +134,9 @@ class helix_scan : public test::fixture_base<> {
         dindex start_index{0u};
 
         // B-field vector for helix
-        const typename fixture_type::point3 B{0.f * unit<scalar_t>::T,
-                                              0.f * unit<scalar_t>::T,
-                                              2.f * unit<scalar_t>::T};
+        const typename fixture_type::vector3 B{0.f * unit<scalar_t>::T,
+                                               0.f * unit<scalar_t>::T,
+                                               2.f * unit<scalar_t>::T};
 
         // Iterate through uniformly distributed momentum directions
         std::size_t n_tracks{0u};
@@ -104,27 +144,22 @@ class helix_scan : public test::fixture_base<> {
             uniform_track_generator<free_track_parameters_t>(
                 m_cfg.track_generator());
 
-        detray::io::file_handle outfile{
-            m_cfg.name(), ".csv",
-            std::ios::out | std::ios::binary | std::ios::trunc};
-
+        // Csv output file, written on a background thread
+        std::optional<test::record_writer> outfile{};
         if (m_cfg.write_intersections()) {
-            *outfile << "index,type,x,y,z," << std::endl;
+            outfile.emplace(m_cfg.name() + ".csv",
+                            std::vector<std::string>{"index", "type", "x",
+                                                     "y", "z"});
         }
 
         std::cout << "INFO: Running helix scan on: " << m_names.at(0) << "\n("
                   << trk_state_generator.size() << " helices) ...\n"
                   << std::endl;
 
-        for (auto trk : trk_state_generator) {
-
-            // Get ground truth helix from track
-            detail::helix helix(trk, &B);
-
-            // Shoot helix through the detector and record all surfaces it
-            // encounters
-            const auto intersection_record = particle_gun::shoot_particle(
-                m_det, helix, 14.9f * unit<scalar_t>::um);
+        // Check the intersection record of a single helix
+        // (returns false on failure)
+        auto check_helix = [&](const detail::helix<algebra_t> &helix,
+                               const auto &intersection_record) {
 
             // Csv output
             if (m_cfg.write_intersections()) {
@@ -134,11 +169,10 @@ class helix_scan : public test::fixture_base<> {
                         detray::surface{m_det, intersection.sf_desc};
                     auto glob_pos = sf.local_to_global(gctx, intersection.local,
                                                        helix.dir());
-                    *outfile
-                        << n_tracks << ","
-                        << static_cast<int>(intersection.sf_desc.barcode().id())
-                        << "," << glob_pos[0] << "," << glob_pos[1] << ","
-                        << glob_pos[2] << "," << std::endl;
+                    outfile->append(
+                        n_tracks,
+                        static_cast<int>(intersection.sf_desc.barcode().id()),
+                        glob_pos[0], glob_pos[1], glob_pos[2]);
                 }
             }
 
@@ -167,11 +201,78 @@ class helix_scan : public test::fixture_base<> {
             }
 
             // Is the succession of volumes consistent ?
-            ASSERT_TRUE(err_code) << "\nFailed on helix " << n_tracks << "/"
+            EXPECT_TRUE(err_code) << "\nFailed on helix " << n_tracks << "/"
                                   << trk_state_generator.size() << "\n"
                                   << helix;
+            if (!err_code) {
+                return false;
+            }
 
             ++n_tracks;
+
+            return true;
+        };
+
+        // Shoot the helices of a batch on several host threads. The records
+        // are checked in the order of the tracks, so that the output does
+        // not depend on the number of threads
+        recorder_t recorder{m_cfg.intersection_recorder()};
+        if (!recorder and m_cfg.n_threads() > 1u) {
+            recorder = [this](const std::vector<free_track_parameters_t> &trks,
+                              const typename fixture_type::vector3 &b) {
+                std::vector<intersection_record_t> records(trks.size());
+                detray::ranges::transform(
+                    execution::host_threads_policy{m_cfg.n_threads(), 16u},
+                    trks, records,
+                    [this, &b](const free_track_parameters_t &t) {
+                        return particle_gun::shoot_particle(
+                            m_det, detail::helix(t, &b),
+                            14.9f * unit<scalar_t>::um);
+                    });
+                return records;
+            };
+        }
+
+        if (recorder) {
+            // Record the intersections for a batch of helices together
+            std::vector<free_track_parameters_t> batch{};
+            batch.reserve(m_cfg.batch_size());
+
+            auto shoot_batch = [&]() {
+                const auto records = recorder(batch, B);
+                for (std::size_t i = 0u; i < batch.size(); ++i) {
+                    if (!check_helix(detail::helix(batch[i], &B),
+                                     records[i])) {
+                        return false;
+                    }
+                }
+                batch.clear();
+                return true;
+            };
+
+            for (const auto &trk : trk_state_generator) {
+                batch.push_back(trk);
+                if (batch.size() == m_cfg.batch_size() && !shoot_batch()) {
+                    return;
+                }
+            }
+            if (!batch.empty()) {
+                shoot_batch();
+            }
+        } else {
+            for (auto trk : trk_state_generator) {
+
+                // Get ground truth helix from track
+                detail::helix helix(trk, &B);
+
+                // Shoot helix through the detector and record all surfaces
+                // it encounters
+                if (!check_helix(helix, particle_gun::shoot_particle(
+                                            m_det, helix,
+                                            14.9f * unit<scalar_t>::um))) {
+                    return;
+                }
+            }
         }
     }
 
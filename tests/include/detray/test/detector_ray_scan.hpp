@@ -9,8 +9,8 @@
 
 // Project include(s)
 #include "detray/geometry/surface.hpp"
-#include "detray/io/frontend/utils/file_handle.hpp"
 #include "detray/navigation/detail/ray.hpp"
+#include "detray/navigation/intersection/ray_bundle_intersector.hpp"
 #include "detray/navigation/volume_graph.hpp"
 #include "detray/plugins/svgtools/illustrator.hpp"
 #include "detray/simulation/event_generator/track_generators.hpp"
@@ -19,12 +19,19 @@
 #include "detray/test/utils/hash_tree.hpp"
 #include "detray/test/utils/particle_gun.hpp"
 #include "detray/test/utils/ray_scan_utils.hpp"
+#include "detray/test/utils/record_writer.hpp"
 #include "detray/test/utils/svg_display.hpp"
+#include "detray/utils/parallel_algorithms.hpp"
 
 // System include(s)
+#include <cstddef>
+#include <functional>
 #include <iostream>
+#include <optional>
 #include <sstream>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace detray {
 
@@ -70,6 +77,13 @@ class ray_scan : public test::fixture_base<> {
     public:
     using fixture_type = test::fixture_base<>;
 
+    /// Intersections along a ray, with the indices of their volumes
+    using intersection_record_t = std::vector<std::pair<
+        dindex, intersection2D<typename detector_t::surface_type, algebra_t>>>;
+    /// Records the intersections of a batch of rays, e.g. on a device
+    using recorder_t = std::function<std::vector<intersection_record_t>(
+        const std::vector<ray_t> &)>;
+
     struct config : public fixture_type::configuration {
         using trk_gen_config_t =
             typename uniform_track_generator<ray_t>::configuration;
@@ -77,8 +91,17 @@ class ray_scan : public test::fixture_base<> {
         std::string m_name{"ray_scan"};
         // Write intersection points for plotting
         bool m_write_inters{false};
+        // Intersect the surfaces with several rays at once
+        bool m_bundle_rays{false};
         // Configuration of the ray generator
         trk_gen_config_t m_trk_gen_cfg{};
+        // Records the intersections instead of the particle gun, if set
+        recorder_t m_recorder{};
+        // Number of rays that are passed to the recorder at once
+        std::size_t m_batch_size{1u << 16};
+        // Number of host threads that shoot the rays of a batch, if no
+        // recorder is set
+        unsigned int m_n_threads{1u};
         // Visualization style to be applied to the svgs
         detray::svgtools::styling::style m_style =
             detray::svgtools::styling::tableau_colorblind::style;
@@ -87,10 +110,14 @@ class ray_scan : public test::fixture_base<> {
         /// @{
         const std::string &name() const { return m_name; }
         bool write_intersections() const { return m_write_inters; }
+        bool bundle_rays() const { return m_bundle_rays; }
         trk_gen_config_t &track_generator() { return m_trk_gen_cfg; }
         const trk_gen_config_t &track_generator() const {
             return m_trk_gen_cfg;
         }
+        const recorder_t &intersection_recorder() const { return m_recorder; }
+        std::size_t batch_size() const { return m_batch_size; }
+        unsigned int n_threads() const { return m_n_threads; }
         const auto &svg_style() const { return m_style; }
         /// @}
 
@@ -104,6 +131,22 @@ class ray_scan : public test::fixture_base<> {
             m_write_inters = do_write;
             return *this;
         }
+        config &bundle_rays(const bool do_bundle) {
+            m_bundle_rays = do_bundle;
+            return *this;
+        }
+        config &intersection_recorder(recorder_t recorder) {
+            m_recorder = std::move(recorder);
+            return *this;
+        }
+        config &batch_size(const std::size_t n) {
+            m_batch_size = n;
+            return *this;
+        }
+        config &n_threads(const unsigned int n) {
+            m_n_threads = n;
+            return *this;
+        }
         /// @}
     };
 
@@ -114,7 +157,11 @@ class ray_scan : public test::fixture_base<> {
         : m_det{det}, m_names{names} {
         m_cfg.name(cfg.name());
         m_cfg.write_intersections(cfg.write_intersections());
+        m_cfg.bundle_rays(cfg.bundle_rays());
         m_cfg.track_generator() = cfg.track_generator();
+        m_cfg.intersection_recorder(cfg.intersection_recorder());
+        m_cfg.batch_size(cfg.batch_size());
+        m_cfg.n_threads(cfg.n_threads());
     }
 
     /// Run the ray scan
@@ -139,24 +186,22 @@ class ray_scan : public test::fixture_base<> {
         auto ray_generator =
             uniform_track_generator<ray_t>(m_cfg.track_generator());
 
-        // Csv output file
-        detray::io::file_handle outfile{
-            m_cfg.name(), ".csv",
-            std::ios::out | std::ios::binary | std::ios::trunc};
-
+        // Csv output file, written on a background thread
+        std::optional<test::record_writer> outfile{};
         if (m_cfg.write_intersections()) {
-            *outfile << "index,type,x,y,z," << std::endl;
+            outfile.emplace(m_cfg.name() + ".csv",
+                            std::vector<std::string>{"index", "type", "x",
+                                                     "y", "z"});
         }
 
         std::cout << "INFO: Running ray scan on: " << m_names.at(0) << "\n("
                   << ray_generator.size() << " rays) ...\n"
                   << std::endl;
 
-        for (const auto &ray : ray_generator) {
-
-            // Record all intersections and surfaces along the ray
-            const auto intersection_record =
-                particle_gun::shoot_particle(m_det, ray);
+        // Check the intersection record of a single ray
+        // (returns false on failure)
+        auto check_ray = [&](const ray_t &ray,
+                             const auto &intersection_record) {
 
             // Csv output
             if (m_cfg.write_intersections()) {
@@ -166,11 +211,10 @@ class ray_scan : public test::fixture_base<> {
                         detray::surface{m_det, intersection.sf_desc};
                     auto glob_pos =
                         sf.local_to_global(gctx, intersection.local, ray.dir());
-                    *outfile
-                        << n_tracks << ","
-                        << static_cast<int>(intersection.sf_desc.barcode().id())
-                        << "," << glob_pos[0] << "," << glob_pos[1] << ","
-                        << glob_pos[2] << "," << std::endl;
+                    outfile->append(
+                        n_tracks,
+                        static_cast<int>(intersection.sf_desc.barcode().id()),
+                        glob_pos[0], glob_pos[1], glob_pos[2]);
                 }
             }
 
@@ -184,7 +228,7 @@ class ray_scan : public test::fixture_base<> {
             err_code &= check_connectivity<leaving_world>(portal_trace);
 
             // Display the detector, track and intersections for debugging
-            if (not err_code) {
+            if (!err_code) {
 
                 // Creating the svg generator for the detector.
                 detray::svgtools::illustrator il{m_det, m_names,
@@ -198,9 +242,12 @@ class ray_scan : public test::fixture_base<> {
                                     m_cfg.name());
             }
 
-            ASSERT_TRUE(err_code) << "\nFailed on ray " << n_tracks << "/"
+            EXPECT_TRUE(err_code) << "\nFailed on ray " << n_tracks << "/"
                                   << ray_generator.size() << "\n"
                                   << ray;
+            if (!err_code) {
+                return false;
+            }
 
             // Build an adjacency matrix from this trace that can be checked
             // against the geometry hash (see 'track_geometry_changes')
@@ -208,6 +255,81 @@ class ray_scan : public test::fixture_base<> {
                                            adj_mat_scan, obj_hashes);
 
             ++n_tracks;
+
+            return true;
+        };
+
+        // Shoot the rays of a batch on several host threads
+        recorder_t recorder{m_cfg.intersection_recorder()};
+        if (!recorder and m_cfg.n_threads() > 1u and !m_cfg.bundle_rays()) {
+            recorder = [this](const std::vector<ray_t> &rays) {
+                std::vector<intersection_record_t> records(rays.size());
+                detray::ranges::transform(
+                    execution::host_threads_policy{m_cfg.n_threads(), 64u},
+                    rays, records, [this](const ray_t &ray) {
+                        return particle_gun::shoot_particle(m_det, ray);
+                    });
+                return records;
+            };
+        }
+
+        if (recorder) {
+            // Record the intersections for a batch of rays together
+            std::vector<ray_t> batch{};
+            batch.reserve(m_cfg.batch_size());
+
+            auto shoot_batch = [&]() {
+                const auto records = recorder(batch);
+                for (std::size_t i = 0u; i < batch.size(); ++i) {
+                    if (!check_ray(batch[i], records[i])) {
+                        return false;
+                    }
+                }
+                batch.clear();
+                return true;
+            };
+
+            for (const auto &ray : ray_generator) {
+                batch.push_back(ray);
+                if (batch.size() == m_cfg.batch_size() && !shoot_batch()) {
+                    return;
+                }
+            }
+            if (!batch.empty()) {
+                shoot_batch();
+            }
+        } else if (m_cfg.bundle_rays()) {
+            // Compute the path lengths for all rays in a bundle together
+            using bundle_t = ray_bundle<algebra_t>;
+
+            bundle_t bundle{};
+            auto shoot_bundle = [&]() {
+                const auto records = particle_gun::shoot_bundle(m_det, bundle);
+                for (std::size_t i = 0u; i < bundle.size(); ++i) {
+                    if (!check_ray(bundle[i], records[i])) {
+                        return false;
+                    }
+                }
+                bundle = bundle_t{};
+                return true;
+            };
+
+            for (const auto &ray : ray_generator) {
+                bundle.push_back(ray);
+                if (bundle.full() && !shoot_bundle()) {
+                    return;
+                }
+            }
+            if (bundle.size() > 0u) {
+                shoot_bundle();
+            }
+        } else {
+            for (const auto &ray : ray_generator) {
+                // Record all intersections and surfaces along the ray
+                if (!check_ray(ray, particle_gun::shoot_particle(m_det, ray))) {
+                    return;
+                }
+            }
         }
 
         // Check that the links that were discovered by the scan match the
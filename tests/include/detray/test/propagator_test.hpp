@@ -66,6 +66,14 @@ constexpr scalar_t constrainted_step_size{2.f * unit<scalar_t>::mm};
 constexpr scalar_t is_close{1e-4f};
 constexpr scalar_t path_limit{2.f * unit<scalar_t>::m};
 
+/// @returns the propagation config of the host and device tests
+DETRAY_HOST_DEVICE inline propagation::config<scalar_t> test_config() {
+    propagation::config<scalar_t> cfg{};
+    cfg.navigation.search_window = {3u, 3u};
+    cfg.stepping.rk_error_tol = rk_tolerance;
+    return cfg;
+}
+
 template <template <typename...> class vector_t>
 struct track_inspector : actor {
 
@@ -156,10 +164,7 @@ inline auto run_propagation_host(vecmem::memory_resource *mr,
 
     using propagator_host_t =
         propagator<decltype(stepr), decltype(nav), actor_chain_host_t>;
-    propagation::config<scalar_t> cfg{};
-    cfg.navigation.search_window = {3u, 3u};
-    cfg.stepping.rk_error_tol = rk_tolerance;
-    propagator_host_t p{cfg};
+    propagator_host_t p{test_config()};
 
     // Create vector for track recording
     vecmem::jagged_vector<scalar_t> host_path_lengths(mr);
@@ -9,7 +9,10 @@
 
 // Project include(s)
 #include "detray/geometry/surface.hpp"
+#include "detray/definitions/detail/simd.hpp"
+#include "detray/geometry/detector_volume.hpp"
 #include "detray/navigation/intersection/intersection.hpp"
+#include "detray/navigation/intersection/ray_bundle_intersector.hpp"
 #include "detray/navigation/intersection_kernel.hpp"
 #include "detray/navigation/intersector.hpp"
 #include "detray/utils/ranges.hpp"
@@ -17,7 +20,11 @@
 // System include(s)
 #include <algorithm>
 #include <cmath>
+#include <stdexcept>
+#include <string>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace detray {
 
@@ -47,42 +54,264 @@ struct particle_gun {
             intersection2D<sf_desc_t, typename detector_t::algebra_type>;
 
         std::vector<std::pair<dindex, intersection_t>> intersection_record;
+        std::vector<intersection_t> intersections{};
+
+        // Loop over all surfaces in the detector
+        for (const sf_desc_t &sf_desc : detector.surfaces()) {
+            intersect_surface(detector, sf_desc, traj,
+                              sf_desc.is_portal() ? 0.f : mask_tolerance,
+                              intersections, intersection_record);
+        }
+
+        return sort_and_terminate(std::move(intersection_record));
+    }
+
+    /// Intersect the surfaces of a detector with a ray, volume by volume.
+    ///
+    /// Only the portals of the detector are intersected with the ray at
+    /// first: The volumes with portal crossings are exactly the volumes the
+    /// ray traverses, so that only the surfaces of these volumes need to be
+    /// intersected afterwards. No stepping or navigation is involved, which
+    /// makes this much cheaper than @c shoot_particle for straight line scans
+    /// of large detectors (e.g. material budget scans).
+    ///
+    /// @param detector the detector.
+    /// @param traj the ray to be shot through the detector.
+    /// @param mask_tolerance tolerance for the mask edges
+    ///
+    /// @return the same intersection record as @c shoot_particle
+    template <typename detector_t, typename trajectory_t>
+    DETRAY_HOST inline static auto trace_ray(
+        const detector_t &detector, const trajectory_t &traj,
+        typename detector_t::scalar_type mask_tolerance =
+            1.f * unit<typename detector_t::scalar_type>::um) {
+
+        using sf_desc_t = typename detector_t::surface_type;
+        using intersection_t =
+            intersection2D<sf_desc_t, typename detector_t::algebra_type>;
+
+        std::vector<std::pair<dindex, intersection_t>> intersection_record;
+        std::vector<intersection_t> intersections{};
+
+        // Find the traversed volumes from the portal crossings
+        std::vector<bool> is_traversed(detector.volumes().size(), false);
+        for (const auto &vol_desc : detector.volumes()) {
+            const detector_volume vol{detector, vol_desc};
+            const std::size_t n_crossings{intersection_record.size()};
+
+            for (const sf_desc_t &pt_desc : vol.portals()) {
+                intersect_surface(detector, pt_desc, traj, 0.f, intersections,
+                                  intersection_record);
+            }
+            is_traversed[vol.index()] =
+                intersection_record.size() > n_crossings;
+        }
+
+        // Intersect the remaining surfaces of the traversed volumes only
+        for (const auto &vol_desc : detector.volumes()) {
+            const detector_volume vol{detector, vol_desc};
+            if (!is_traversed[vol.index()]) {
+                continue;
+            }
+            for (const sf_desc_t &sf_desc : vol.surfaces()) {
+                if (!sf_desc.is_portal()) {
+                    intersect_surface(detector, sf_desc, traj, mask_tolerance,
+                                      intersections, intersection_record);
+                }
+            }
+        }
+
+        return sort_and_terminate(std::move(intersection_record));
+    }
+
+    /// Intersect all surfaces in a detector with a given trajectory and
+    /// write the intersections into a preallocated collection, e.g. an
+    /// element of a jagged device vector.
+    ///
+    /// The intersections are not sorted (see @c to_record ). If the capacity
+    /// of the collection is exceeded, the remaining intersections are only
+    /// counted.
+    ///
+    /// @param detector the detector.
+    /// @param traj the trajectory to be shot through the detector.
+    /// @param intersections the intersection collection of fixed size
+    /// @param mask_tolerance tolerance for the mask edges
+    ///
+    /// @return the number of intersections along the trajectory
+    template <typename detector_t, typename trajectory_t,
+              typename is_container_t>
+    DETRAY_HOST_DEVICE inline static unsigned int record_intersections(
+        const detector_t &detector, const trajectory_t &traj,
+        is_container_t &intersections,
+        typename detector_t::scalar_type mask_tolerance =
+            1.f * unit<typename detector_t::scalar_type>::um) {
 
         using intersection_kernel_t = intersection_initialize<intersector>;
 
-        // Loop over all surfaces in the detector
         const auto &trf_store = detector.transform_store();
 
-        std::vector<intersection_t> intersections{};
+        bounded_inserter<is_container_t> inserter{intersections};
 
-        for (const sf_desc_t &sf_desc : detector.surfaces()) {
-            // Retrieve candidate(s) from the surface
+        for (const auto &sf_desc : detector.surfaces()) {
             const auto sf = surface{detector, sf_desc};
+            inserter.sf_desc = sf_desc;
             sf.template visit_mask<intersection_kernel_t>(
-                intersections, traj, sf_desc, trf_store,
+                inserter, traj, sf_desc, trf_store,
                 sf.is_portal() ? 0.f : mask_tolerance);
+        }
+
+        return inserter.n;
+    }
+
+    /// Build the intersection record of a trajectory from the intersections
+    /// that were written by @c record_intersections
+    ///
+    /// @param intersections the recorded intersections
+    /// @param n the number of intersections along the trajectory
+    ///
+    /// @return the same intersection record as @c shoot_particle
+    template <typename is_container_t>
+    DETRAY_HOST inline static auto to_record(
+        const is_container_t &intersections, const unsigned int n) {
+
+        using intersection_t = typename is_container_t::value_type;
+
+        if (n > intersections.size()) {
+            throw std::overflow_error(
+                "Intersection record too small: " + std::to_string(n) +
+                " intersections, capacity " +
+                std::to_string(intersections.size()));
+        }
+
+        std::vector<std::pair<dindex, intersection_t>> intersection_record;
+        intersection_record.reserve(n);
+        for (unsigned int i = 0u; i < n; ++i) {
+            intersection_record.emplace_back(
+                intersections[i].sf_desc.volume(), intersections[i]);
+        }
+
+        return sort_and_terminate(std::move(intersection_record));
+    }
 
+    /// Intersect all surfaces in a detector with a bundle of rays.
+    ///
+    /// The path lengths of all rays in the bundle to a surface are computed
+    /// together (see @c ray_bundle_intersector ), as are the mask checks for
+    /// the common shapes (see @c ray_bundle_mask_check ). Only the rays that
+    /// hit the surface are then handled one by one.
+    ///
+    /// @param detector the detector.
+    /// @param bundle the rays to be shot through the detector.
+    /// @param mask_tolerance tolerance for the mask edges
+    ///
+    /// @return a sorted vector of volume indices with the corresponding
+    ///         intersections per ray in the bundle (same as
+    ///         @c shoot_particle for every single ray)
+    template <typename detector_t, typename value_t>
+    DETRAY_HOST inline static auto shoot_bundle(
+        const detector_t &detector,
+        const ray_bundle<typename detector_t::algebra_type, value_t> &bundle,
+        typename detector_t::scalar_type mask_tolerance =
+            1.f * unit<typename detector_t::scalar_type>::um) {
+
+        using sf_desc_t = typename detector_t::surface_type;
+
+        using intersection_t =
+            intersection2D<sf_desc_t, typename detector_t::algebra_type>;
+        using record_t = std::vector<std::pair<dindex, intersection_t>>;
+
+        std::vector<record_t> intersection_records(bundle.size());
+
+        const auto &trf_store = detector.transform_store();
+
+        for (const sf_desc_t &sf_desc : detector.surfaces()) {
+            const auto sf = surface{detector, sf_desc};
+            sf.template visit_mask<bundle_intersection_initialize>(
+                bundle, sf_desc, trf_store,
+                sf.is_portal() ? 0.f : mask_tolerance, intersection_records);
+        }
+
+        for (auto &record : intersection_records) {
+            record = sort_and_terminate(std::move(record));
+        }
+
+        return intersection_records;
+    }
+
+    private:
+    /// Intersect the surface @param sf_desc with the trajectory @param traj
+    /// and add the intersections that lie in the direction of the trajectory
+    /// to @param intersection_record
+    template <typename detector_t, typename trajectory_t, typename sf_desc_t,
+              typename intersection_t>
+    DETRAY_HOST_DEVICE inline static void intersect_surface(
+        const detector_t &detector, const sf_desc_t &sf_desc,
+        const trajectory_t &traj,
+        const typename detector_t::scalar_type mask_tolerance,
+        std::vector<intersection_t> &intersections,
+        std::vector<std::pair<dindex, intersection_t>> &intersection_record) {
+
+        using intersection_kernel_t = intersection_initialize<intersector>;
+
+        // Retrieve candidate(s) from the surface
+        const auto sf = surface{detector, sf_desc};
+        sf.template visit_mask<intersection_kernel_t>(
+            intersections, traj, sf_desc, detector.transform_store(),
+            mask_tolerance);
+
+        // Candidate is invalid if it lies in the opposite direction
+        for (auto &sfi : intersections) {
+            if (sfi.direction == intersection::direction::e_along) {
+                sfi.sf_desc = sf_desc;
+                // Volume the candidate belongs to
+                intersection_record.emplace_back(sf.volume(), sfi);
+            }
+        }
+        intersections.clear();
+    }
+
+    /// Writes the intersections along the trajectory into a collection of
+    /// fixed size and counts them
+    template <typename is_container_t>
+    struct bounded_inserter {
+        using value_type = typename is_container_t::value_type;
+
+        is_container_t &intersections;
+        /// The surface that is currently intersected
+        decltype(value_type::sf_desc) sf_desc{};
+        /// Number of intersections along the trajectory
+        unsigned int n{0u};
+
+        DETRAY_HOST_DEVICE void push_back(const value_type &sfi) {
             // Candidate is invalid if it lies in the opposite direction
-            for (auto &sfi : intersections) {
-                if (sfi.direction == intersection::direction::e_along) {
-                    sfi.sf_desc = sf_desc;
-                    // Volume the candidate belongs to
-                    intersection_record.emplace_back(sf.volume(), sfi);
-                }
+            if (sfi.direction != intersection::direction::e_along) {
+                return;
             }
-            intersections.clear();
+            if (n < intersections.size()) {
+                intersections[n] = sfi;
+                intersections[n].sf_desc = sf_desc;
+            }
+            ++n;
         }
+    };
+
+    /// Sort the intersections by distance to the origin of the trajectory and
+    /// make sure the intersection record terminates at world portals
+    template <typename record_t>
+    DETRAY_HOST_DEVICE inline static record_t sort_and_terminate(
+        record_t intersection_record) {
+
+        using entry_t = typename record_t::value_type;
 
         // Sort intersections by distance to origin of the trajectory
-        auto sort_path = [&](std::pair<dindex, intersection_t> a,
-                             std::pair<dindex, intersection_t> b) -> bool {
+        auto sort_path = [&](const entry_t &a, const entry_t &b) -> bool {
             return (a.second < b.second);
         };
         std::stable_sort(intersection_record.begin(), intersection_record.end(),
                          sort_path);
 
         // Make sure the intersection record terminates at world portals
-        auto is_world_exit = [](const std::pair<dindex, intersection_t> &r) {
+        auto is_world_exit = [](const entry_t &r) {
             return r.second.volume_link ==
                    detray::detail::invalid_value<decltype(
                        r.second.volume_link)>();
@@ -97,6 +326,110 @@ struct particle_gun {
 
         return intersection_record;
     }
+
+    /// Intersect the rays of a bundle with the masks of a surface and record
+    /// the intersections that lie in the direction of the rays
+    struct bundle_intersection_initialize {
+
+        template <typename mask_group_t, typename mask_range_t,
+                  typename bundle_t, typename sf_desc_t,
+                  typename transform_container_t, typename scalar_t,
+                  typename record_t>
+        DETRAY_HOST inline void operator()(
+            const mask_group_t &mask_group, const mask_range_t &mask_range,
+            const bundle_t &bundle, const sf_desc_t &sf_desc,
+            const transform_container_t &trf_store,
+            const scalar_t mask_tolerance,
+            std::vector<record_t> &intersection_records) const {
+
+            using mask_t = typename mask_group_t::value_type;
+            using shape_t = typename mask_t::shape;
+            using algebra_t = typename mask_t::algebra_type;
+            using intersection_t = typename record_t::value_type::second_type;
+
+            if constexpr (!has_ray_bundle_intersector_v<shape_t,
+                                                        algebra_t>) {
+                // No vectorized intersector: One ray at a time
+                std::vector<intersection_t> intersections{};
+                for (std::size_t i = 0u; i < bundle.size(); ++i) {
+                    intersection_initialize<intersector>{}(
+                        mask_group, mask_range, intersections, bundle[i],
+                        sf_desc, trf_store, mask_tolerance);
+
+                    for (auto &sfi : intersections) {
+                        if (sfi.direction == intersection::direction::e_along) {
+                            sfi.sf_desc = sf_desc;
+                            intersection_records[i].emplace_back(
+                                sf_desc.volume(), sfi);
+                        }
+                    }
+                    intersections.clear();
+                }
+            } else {
+                const auto &trf = trf_store[sf_desc.transform()];
+
+                // Rays that already hit a mask of the surface
+                std::vector<bool> is_hit(bundle.size(), false);
+
+                for (const auto &mask :
+                     detray::ranges::subrange(mask_group, mask_range)) {
+
+                    // Path lengths for all rays at once
+                    auto solutions =
+                        ray_bundle_intersector<shape_t, algebra_t>{}(
+                            bundle, mask, trf, 0.f);
+
+                    // Drop the lanes that miss the mask before going through
+                    // the rays one by one
+                    if constexpr (has_ray_bundle_mask_check_v<shape_t>) {
+                        bool any_hit{false};
+                        for (std::size_t k = 0u; k < solutions.size(); ++k) {
+                            solutions.is_valid[k] =
+                                solutions.is_valid[k] &&
+                                ray_bundle_mask_check<shape_t>{}(
+                                    bundle.pos_at(solutions.path[k]), mask,
+                                    trf, mask_tolerance);
+                            any_hit |= detail::simd::any(solutions.is_valid[k]);
+                        }
+                        if (!any_hit) {
+                            continue;
+                        }
+                    }
+
+                    for (std::size_t i = 0u; i < bundle.size(); ++i) {
+                        if (is_hit[i]) {
+                            continue;
+                        }
+                        for (std::size_t k = 0u; k < solutions.size(); ++k) {
+                            if (!detail::simd::is_set(solutions.is_valid[k],
+                                                      i)) {
+                                continue;
+                            }
+                            const auto ray = bundle[i];
+
+                            intersection_t sfi{};
+                            sfi.path = static_cast<scalar_t>(
+                                detail::simd::get(solutions.path[k], i));
+                            sfi.local = mask.to_local_frame(
+                                trf, ray.pos(sfi.path), ray.dir());
+                            sfi.status =
+                                mask.is_inside(sfi.local, mask_tolerance);
+
+                            if (sfi.status == intersection::status::e_inside) {
+                                sfi.sf_desc = sf_desc;
+                                sfi.direction =
+                                    intersection::direction::e_along;
+                                sfi.volume_link = mask.volume_link();
+                                intersection_records[i].emplace_back(
+                                    sf_desc.volume(), sfi);
+                                is_hit[i] = true;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    };
 };
 
 }  // namespace detray
@@ -0,0 +1,180 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Google Benchmark include(s)
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#ifdef DETRAY_BENCHMARK_PERF_COUNTERS
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace detray::test {
+
+/// @brief Hardware performance counters of a benchmark run.
+///
+/// Counts the CPU cycles, instructions, L1 data cache read misses, last level
+/// cache misses and branch mispredictions of the calling thread between
+/// @c start() and @c stop() using the Linux perf_event interface. On
+/// @c stop(), the misses per benchmark iteration and the instructions per
+/// cycle ('IPC') are attached to the benchmark as user counters.
+///
+/// The counters are only available, if the benchmarks were built with the
+/// 'DETRAY_BENCHMARK_PERF_COUNTERS' option, otherwise all calls are no-ops.
+/// Events that are not supported by the host (e.g. in virtual machines or
+/// with a restrictive 'perf_event_paranoid' setting) are silently omitted.
+class perf_counters {
+
+    public:
+    /// Hardware events that are counted
+    enum event : std::size_t {
+        e_cycles = 0u,
+        e_instructions = 1u,
+        e_l1d_misses = 2u,
+        e_llc_misses = 3u,
+        e_branch_misses = 4u,
+        e_n_events = 5u,
+    };
+
+    /// Open the event counters
+    perf_counters() {
+#ifdef DETRAY_BENCHMARK_PERF_COUNTERS
+        constexpr std::uint64_t l1d_read_miss{
+            PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8u) |
+            (PERF_COUNT_HW_CACHE_RESULT_MISS << 16u)};
+
+        m_fds[e_cycles] =
+            open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+        m_fds[e_instructions] =
+            open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+        m_fds[e_l1d_misses] = open_event(PERF_TYPE_HW_CACHE, l1d_read_miss);
+        m_fds[e_llc_misses] =
+            open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+        m_fds[e_branch_misses] =
+            open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+#endif
+    }
+
+    /// Not copyable, since the counters own their file descriptors
+    /// @{
+    perf_counters(const perf_counters &) = delete;
+    perf_counters &operator=(const perf_counters &) = delete;
+    /// @}
+
+    /// Close the event counters
+    ~perf_counters() {
+#ifdef DETRAY_BENCHMARK_PERF_COUNTERS
+        for (const int fd : m_fds) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+#endif
+    }
+
+    /// Reset and start the counters
+    void start() {
+#ifdef DETRAY_BENCHMARK_PERF_COUNTERS
+        for (const int fd : m_fds) {
+            if (fd >= 0) {
+                ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+        }
+#endif
+    }
+
+    /// Stop the counters and attach the results to the benchmark @param state
+    void stop([[maybe_unused]] benchmark::State &state) {
+#ifdef DETRAY_BENCHMARK_PERF_COUNTERS
+        std::array<double, e_n_events> counts{};
+        std::array<bool, e_n_events> valid{};
+
+        for (std::size_t i = 0u; i < e_n_events; ++i) {
+            if (m_fds[i] >= 0) {
+                ioctl(m_fds[i], PERF_EVENT_IOC_DISABLE, 0);
+                valid[i] = read_event(m_fds[i], counts[i]);
+            }
+        }
+
+        constexpr auto per_iteration{benchmark::Counter::kAvgIterations};
+
+        if (valid[e_l1d_misses]) {
+            state.counters["L1d_misses"] =
+                benchmark::Counter(counts[e_l1d_misses], per_iteration);
+        }
+        if (valid[e_llc_misses]) {
+            state.counters["LLC_misses"] =
+                benchmark::Counter(counts[e_llc_misses], per_iteration);
+        }
+        if (valid[e_branch_misses]) {
+            state.counters["branch_misses"] =
+                benchmark::Counter(counts[e_branch_misses], per_iteration);
+        }
+        if (valid[e_cycles] && valid[e_instructions] &&
+            counts[e_cycles] > 0.) {
+            state.counters["IPC"] = counts[e_instructions] / counts[e_cycles];
+        }
+#endif
+    }
+
+    private:
+#ifdef DETRAY_BENCHMARK_PERF_COUNTERS
+    /// @returns the file descriptor of the counter for the event @param config
+    /// of type @param type on the calling thread (-1 if not supported)
+    static int open_event(const std::uint32_t type,
+                          const std::uint64_t config) {
+        perf_event_attr attr{};
+        attr.size = sizeof(perf_event_attr);
+        attr.type = type;
+        attr.config = config;
+        attr.disabled = 1u;
+        attr.exclude_kernel = 1u;
+        attr.exclude_hv = 1u;
+        attr.read_format =
+            PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        return static_cast<int>(
+            syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0ul));
+    }
+
+    /// Read the counter @param fd into @param count, scaled up if the event
+    /// was multiplexed with other events
+    ///
+    /// @returns whether the counter could be read
+    static bool read_event(const int fd, double &count) {
+        // Value, time enabled, time running
+        std::array<std::uint64_t, 3> values{};
+        const auto n_bytes{sizeof(values)};
+
+        if (read(fd, values.data(), n_bytes) !=
+                static_cast<ssize_t>(n_bytes) ||
+            values[2] == 0u) {
+            return false;
+        }
+        count = static_cast<double>(values[0]) *
+                static_cast<double>(values[1]) /
+                static_cast<double>(values[2]);
+
+        return true;
+    }
+
+    /// File descriptors of the event counters
+    std::array<int, e_n_events> m_fds{-1, -1, -1, -1, -1};
+#endif
+};
+
+}  // namespace detray::test
@@ -0,0 +1,274 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s)
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <initializer_list>
+#include <ios>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace detray::test {
+
+/// Output formats of the record writer
+enum class record_format : std::uint_least8_t {
+    csv = 0u,
+    columnar = 1u,
+};
+
+/// @brief Writes rows of numeric records to file on a background thread.
+///
+/// The rows are collected in a chunk, which is handed to the writer thread
+/// once it is full, while the next chunk is being filled (double buffering).
+/// The formatting and the file IO therefore do not stall the scan loop.
+///
+/// Formats:
+/// - csv: A header line with the column names, then one line per row
+/// - columnar: A binary file (native byte order) that starts with the number
+///   of columns (u64) and the column names (u64 length + characters each).
+///   It is followed by the chunks, each of which holds the number of rows
+///   (u64) and then the values of every column in turn (f64), so that a
+///   column can be read as a contiguous array.
+class record_writer {
+
+    public:
+    /// Open the file @param file_name (an existing file is replaced)
+    ///
+    /// @param columns the names of the record columns
+    /// @param format the output format
+    /// @param chunk_rows number of rows that are written per chunk
+    record_writer(const std::string& file_name,
+                  std::vector<std::string> columns,
+                  const record_format format = record_format::csv,
+                  const std::size_t chunk_rows = 1u << 14u)
+        : m_columns{std::move(columns)},
+          m_format{format},
+          m_chunk_size{chunk_rows * m_columns.size()} {
+
+        if (m_columns.empty() or chunk_rows == 0u) {
+            throw std::invalid_argument(
+                "Record writer needs at least one column and row per chunk");
+        }
+
+        const auto mode = format == record_format::csv
+                              ? std::ios_base::out | std::ios_base::trunc
+                              : std::ios_base::out | std::ios_base::binary |
+                                    std::ios_base::trunc;
+        m_file.open(file_name, mode);
+        if (!m_file.is_open()) {
+            throw std::runtime_error("Could not open file: " + file_name);
+        }
+        write_header();
+
+        m_fill.reserve(m_chunk_size);
+        m_flush.reserve(m_chunk_size);
+        m_worker = std::thread{[this]() { run(); }};
+    }
+
+    /// Not copyable or movable: owns the writer thread
+    /// @{
+    record_writer(const record_writer&) = delete;
+    record_writer& operator=(const record_writer&) = delete;
+    /// @}
+
+    /// Write the remaining rows and close the file
+    ~record_writer() {
+        try {
+            close();
+        } catch (const std::exception& e) {
+            // Do not throw from the destructor
+            std::cerr << "ERROR: " << e.what() << std::endl;
+        }
+    }
+
+    /// @returns the number of columns per row
+    std::size_t n_columns() const { return m_columns.size(); }
+
+    /// Append a row with the values @param values , one per column
+    template <typename... Ts>
+    void append(const Ts&... values) {
+        static_assert(sizeof...(Ts) > 0u, "Empty record");
+        append_row({static_cast<double>(values)...});
+    }
+
+    /// Append a row with the values @param row , one per column
+    void append_row(std::initializer_list<double> row) {
+        if (row.size() != m_columns.size()) {
+            throw std::invalid_argument("Wrong number of record columns");
+        }
+        m_fill.insert(m_fill.end(), row.begin(), row.end());
+        if (m_fill.size() >= m_chunk_size) {
+            submit();
+        }
+    }
+
+    /// Wait until all rows that were appended so far are written
+    void flush() {
+        submit();
+        std::unique_lock<std::mutex> lock{m_mutex};
+        m_cv.wait(lock, [this]() { return !m_pending; });
+        rethrow();
+        m_file.flush();
+    }
+
+    /// Write the remaining rows, stop the writer thread and close the file
+    void close() {
+        if (!m_worker.joinable()) {
+            return;
+        }
+        submit();
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            m_stop = true;
+        }
+        m_cv.notify_all();
+        m_worker.join();
+        m_file.close();
+        rethrow();
+    }
+
+    private:
+    /// Hand the filled chunk to the writer thread
+    void submit() {
+        if (m_fill.empty()) {
+            return;
+        }
+        {
+            // Wait for the writer to finish the previous chunk
+            std::unique_lock<std::mutex> lock{m_mutex};
+            m_cv.wait(lock, [this]() { return !m_pending; });
+            rethrow();
+            m_fill.swap(m_flush);
+            m_pending = true;
+        }
+        m_cv.notify_all();
+        m_fill.clear();
+    }
+
+    /// Writer thread: Write the chunks until the writer is closed
+    void run() {
+        std::unique_lock<std::mutex> lock{m_mutex};
+        while (true) {
+            m_cv.wait(lock, [this]() { return m_pending or m_stop; });
+            if (!m_pending) {
+                return;
+            }
+
+            // The chunk is not touched by the producer while pending
+            lock.unlock();
+            try {
+                write_chunk(m_flush);
+            } catch (...) {
+                m_error = std::current_exception();
+            }
+            m_flush.clear();
+            lock.lock();
+
+            m_pending = false;
+            m_cv.notify_all();
+        }
+    }
+
+    /// Rethrow an exception from the writer thread (needs the lock)
+    void rethrow() {
+        if (m_error) {
+            std::exception_ptr error{};
+            std::swap(error, m_error);
+            std::rethrow_exception(error);
+        }
+    }
+
+    /// Write the column names
+    void write_header() {
+        if (m_format == record_format::csv) {
+            for (std::size_t i = 0u; i < m_columns.size(); ++i) {
+                m_file << m_columns[i]
+                       << (i + 1u == m_columns.size() ? "\n" : ",");
+            }
+        } else {
+            write_value(static_cast<std::uint64_t>(m_columns.size()));
+            for (const std::string& col : m_columns) {
+                write_value(static_cast<std::uint64_t>(col.size()));
+                m_file.write(col.data(),
+                             static_cast<std::streamsize>(col.size()));
+            }
+        }
+    }
+
+    /// Write the rows in @param chunk
+    void write_chunk(const std::vector<double>& chunk) {
+        const std::size_t n_cols{m_columns.size()};
+        const std::size_t n_rows{chunk.size() / n_cols};
+
+        if (m_format == record_format::csv) {
+            for (std::size_t i = 0u; i < chunk.size(); ++i) {
+                m_file << chunk[i] << ((i + 1u) % n_cols == 0u ? "\n" : ",");
+            }
+        } else {
+            // Transpose the rows into columns
+            m_columnar.resize(chunk.size());
+            for (std::size_t row = 0u; row < n_rows; ++row) {
+                for (std::size_t col = 0u; col < n_cols; ++col) {
+                    m_columnar[col * n_rows + row] = chunk[row * n_cols + col];
+                }
+            }
+            write_value(static_cast<std::uint64_t>(n_rows));
+            m_file.write(reinterpret_cast<const char*>(m_columnar.data()),
+                         static_cast<std::streamsize>(m_columnar.size() *
+                                                      sizeof(double)));
+        }
+
+        if (!m_file) {
+            throw std::runtime_error("Could not write records to file");
+        }
+    }
+
+    /// Write a single value @param v in native byte order
+    template <typename T>
+    void write_value(const T v) {
+        m_file.write(reinterpret_cast<const char*>(&v), sizeof(T));
+    }
+
+    /// Names of the columns
+    std::vector<std::string> m_columns;
+    /// Output format
+    record_format m_format;
+    /// Number of values per chunk
+    std::size_t m_chunk_size;
+    /// Output file
+    std::ofstream m_file{};
+
+    /// Chunk that is being filled by the producer
+    std::vector<double> m_fill{};
+    /// Chunk that is being written by the writer thread
+    std::vector<double> m_flush{};
+    /// Transposed chunk for the columnar output (writer thread only)
+    std::vector<double> m_columnar{};
+
+    /// Synchronization with the writer thread
+    /// @{
+    std::mutex m_mutex{};
+    std::condition_variable m_cv{};
+    bool m_pending{false};
+    bool m_stop{false};
+    std::exception_ptr m_error{};
+    std::thread m_worker{};
+    /// @}
+};
+
+}  // namespace detray::test
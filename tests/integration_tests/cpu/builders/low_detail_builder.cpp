@@ -0,0 +1,126 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Detray include(s)
+#include "detray/builders/low_detail_builder.hpp"
+
+#include "detray/detectors/build_toy_detector.hpp"
+#include "detray/geometry/detector_volume.hpp"
+#include "detray/geometry/surface.hpp"
+#include "detray/utils/consistency_checker.hpp"
+
+// Test include(s)
+#include "detray/test/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+using namespace detray;
+
+namespace {
+
+/// @returns the number of surfaces of type @param sf_id and their summed
+/// material budget (area times thickness in X0) in the volume @param vol
+template <typename detector_t>
+auto layer_summary(const detector_t &det,
+                   const typename detector_t::volume_type &vol_desc,
+                   const surface_id sf_id) {
+
+    using scalar_t = typename detector_t::scalar_type;
+
+    std::size_t n_surfaces{0u};
+    scalar_t budget{0.f};
+    for (const auto &sf_desc : detector_volume{det, vol_desc}.surfaces()) {
+        const auto sf = surface{det, sf_desc};
+        if (sf.id() != sf_id) {
+            continue;
+        }
+        ++n_surfaces;
+        if (sf.has_material()) {
+            budget += sf.template visit_mask<detail::mask_area_getter>() *
+                      sf.template visit_material<
+                            detail::material_budget_getter<scalar_t>>()
+                          .second;
+        }
+    }
+
+    return std::make_pair(n_surfaces, budget);
+}
+
+}  // anonymous namespace
+
+/// Derive the low-detail version of the toy detector
+GTEST_TEST(detray_builders, low_detail_builder) {
+
+    using scalar_t = test::scalar;
+
+    vecmem::host_memory_resource host_mr;
+
+    toy_det_config<scalar_t> toy_cfg{};
+    toy_cfg.n_brl_layers(4u).n_edc_layers(3u);
+    const auto [toy_det, names] = build_toy_detector(host_mr, toy_cfg);
+
+    const auto low_det =
+        build_low_detail_detector<toy_metadata>(toy_det, host_mr);
+
+    EXPECT_TRUE(detail::check_consistency(low_det));
+
+    // Same volumes, fewer surfaces
+    ASSERT_EQ(low_det.volumes().size(), toy_det.volumes().size());
+    EXPECT_LT(low_det.surfaces().size(), toy_det.surfaces().size());
+
+    std::size_t n_layers{0u};
+    for (std::size_t i = 0u; i < toy_det.volumes().size(); ++i) {
+        const auto &vol = toy_det.volumes()[i];
+        const auto &low_vol = low_det.volumes()[i];
+
+        EXPECT_EQ(low_vol.id(), vol.id());
+        EXPECT_EQ(low_vol.index(), vol.index());
+
+        const auto [n_pt, pt_budget] =
+            layer_summary(toy_det, vol, surface_id::e_portal);
+        const auto [low_n_pt, low_pt_budget] =
+            layer_summary(low_det, low_vol, surface_id::e_portal);
+        EXPECT_EQ(low_n_pt, n_pt);
+        EXPECT_NEAR(low_pt_budget, pt_budget, 1e-3f * pt_budget + 1e-5f);
+
+        // Every layer is merged into a single surface with the same budget
+        const auto [n_sens, sens_budget] =
+            layer_summary(toy_det, vol, surface_id::e_sensitive);
+        const auto [low_n_sens, low_sens_budget] =
+            layer_summary(low_det, low_vol, surface_id::e_sensitive);
+        if (n_sens == 0u) {
+            EXPECT_EQ(low_n_sens, 0u);
+            continue;
+        }
+        ++n_layers;
+        EXPECT_EQ(low_n_sens, 1u);
+        EXPECT_GT(low_sens_budget, 0.f);
+        EXPECT_NEAR(low_sens_budget, sens_budget, 1e-3f * sens_budget);
+    }
+    EXPECT_EQ(n_layers, toy_cfg.n_brl_layers() + 2u * toy_cfg.n_edc_layers());
+
+    // Material maps are averaged into homogeneous material
+    toy_cfg.use_material_maps(true);
+    const auto [toy_det_maps, names_maps] =
+        build_toy_detector(host_mr, toy_cfg);
+
+    const auto low_det_maps =
+        build_low_detail_detector<toy_metadata>(toy_det_maps, host_mr);
+
+    EXPECT_TRUE(detail::check_consistency(low_det_maps));
+    ASSERT_EQ(low_det_maps.volumes().size(), toy_det_maps.volumes().size());
+    EXPECT_LT(low_det_maps.surfaces().size(), toy_det_maps.surfaces().size());
+    EXPECT_FALSE(low_det_maps.material_store()
+                     .template empty<toy_metadata::material_ids::e_slab>());
+    EXPECT_TRUE(
+        low_det_maps.material_store()
+            .template empty<toy_metadata::material_ids::e_rectangle2_map>());
+}
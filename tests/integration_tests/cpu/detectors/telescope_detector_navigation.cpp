@@ -88,6 +88,30 @@ int main(int argc, char **argv) {
 
     detail::register_checks<helix_navigation>(tel_det, tel_names, cfg_hel_nav);
 
+    //
+    // Long telescope with the planes sorted along the telescope axis
+    //
+    tel_det_config<rectangle2D> sorted_tel_cfg{20.f * unit<scalar_t>::mm,
+                                               20.f * unit<scalar_t>::mm};
+    sorted_tel_cfg.n_surfaces(50u)
+        .length(1000.f * unit<scalar_t>::mm)
+        .sorted_planes(true);
+
+    const auto [sorted_tel_det, sorted_tel_names] =
+        build_telescope_detector(host_mr, sorted_tel_cfg);
+
+    detail::register_checks<consistency_check>(
+        sorted_tel_det, sorted_tel_names,
+        cfg_cons.name("sorted_telescope_detector_consistency"));
+
+    cfg_str_nav.name("sorted_telescope_detector_straight_line_navigation");
+    detail::register_checks<straight_line_navigation>(
+        sorted_tel_det, sorted_tel_names, cfg_str_nav);
+
+    cfg_hel_nav.name("sorted_telescope_detector_helix_navigation");
+    detail::register_checks<helix_navigation>(sorted_tel_det,
+                                              sorted_tel_names, cfg_hel_nav);
+
     // Run the checks
     return RUN_ALL_TESTS();
 }
@@ -54,6 +54,12 @@ int main(int argc, char **argv) {
 
     detail::register_checks<ray_scan>(toy_det, toy_names, cfg_ray_scan);
 
+    // Same scan, but with the rays intersected in bundles
+    ray_scan<toy_detector_t>::config cfg_bundle_scan{cfg_ray_scan};
+    cfg_bundle_scan.name("toy_detector_ray_bundle_scan").bundle_rays(true);
+
+    detail::register_checks<ray_scan>(toy_det, toy_names, cfg_bundle_scan);
+
     // Navigation link consistency, discovered by helix intersection
     helix_scan<toy_detector_t>::config cfg_hel_scan{};
     cfg_hel_scan.name("toy_detector_helix_scan");
@@ -63,6 +69,17 @@ int main(int argc, char **argv) {
     detray::detail::register_checks<detray::helix_scan>(toy_det, toy_names,
                                                         cfg_hel_scan);
 
+    // Same scans, but on several host threads
+    ray_scan<toy_detector_t>::config cfg_ray_scan_mt{cfg_ray_scan};
+    cfg_ray_scan_mt.name("toy_detector_ray_scan_mt").n_threads(4u);
+
+    detail::register_checks<ray_scan>(toy_det, toy_names, cfg_ray_scan_mt);
+
+    helix_scan<toy_detector_t>::config cfg_hel_scan_mt{cfg_hel_scan};
+    cfg_hel_scan_mt.name("toy_detector_helix_scan_mt").n_threads(4u);
+
+    detail::register_checks<helix_scan>(toy_det, toy_names, cfg_hel_scan_mt);
+
     // Comparision of straight line navigation with ray scan
     straight_line_navigation<toy_detector_t>::config cfg_str_nav{};
     cfg_str_nav.name("toy_detector_straight_line_navigation");
@@ -81,6 +98,25 @@ int main(int argc, char **argv) {
 
     detail::register_checks<helix_navigation>(toy_det, toy_names, cfg_hel_nav);
 
+    //
+    // Toy detector with indexed portals in the cylinder volumes
+    //
+    toy_cfg.use_concentric_portals(true);
+
+    auto [conc_toy_det, conc_toy_names] = build_toy_detector(host_mr, toy_cfg);
+
+    detail::register_checks<consistency_check>(
+        conc_toy_det, conc_toy_names,
+        cfg_cons.name("concentric_toy_detector_consistency"));
+
+    cfg_str_nav.name("concentric_toy_detector_straight_line_navigation");
+    detail::register_checks<straight_line_navigation>(
+        conc_toy_det, conc_toy_names, cfg_str_nav);
+
+    cfg_hel_nav.name("concentric_toy_detector_helix_navigation");
+    detail::register_checks<helix_navigation>(conc_toy_det, conc_toy_names,
+                                              cfg_hel_nav);
+
     // Run the checks
     return RUN_ALL_TESTS();
 }
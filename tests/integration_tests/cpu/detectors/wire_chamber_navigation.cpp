@@ -82,6 +82,23 @@ int main(int argc, char **argv) {
 
     detail::register_checks<helix_navigation>(det, names, cfg_hel_nav);
 
+    //
+    // Wire chamber with the wires found by their azimuthal angle
+    //
+    wire_chamber_cfg.use_wire_layers(true);
+
+    auto [wl_det, wl_names] = create_wire_chamber(host_mr, wire_chamber_cfg);
+
+    detail::register_checks<consistency_check>(
+        wl_det, wl_names, cfg_cons.name("wire_layer_chamber_consistency"));
+
+    cfg_str_nav.name("wire_layer_chamber_straight_line_navigation");
+    detail::register_checks<straight_line_navigation>(wl_det, wl_names,
+                                                      cfg_str_nav);
+
+    cfg_hel_nav.name("wire_layer_chamber_helix_navigation");
+    detail::register_checks<helix_navigation>(wl_det, wl_names, cfg_hel_nav);
+
     // Run the checks
     return RUN_ALL_TESTS();
 }
@@ -10,20 +10,25 @@
 #include "detray/definitions/units.hpp"
 #include "detray/detectors/bfield.hpp"
 #include "detray/detectors/build_telescope_detector.hpp"
+#include "detray/detectors/build_toy_detector.hpp"
 #include "detray/geometry/mask.hpp"
 #include "detray/geometry/shapes/unbounded.hpp"
 #include "detray/materials/interaction.hpp"
 #include "detray/materials/material.hpp"
+#include "detray/materials/material_cache.hpp"
 #include "detray/materials/material_slab.hpp"
 #include "detray/materials/predefined_materials.hpp"
 #include "detray/navigation/navigator.hpp"
 #include "detray/propagator/actor_chain.hpp"
 #include "detray/propagator/actors/aborters.hpp"
+#include "detray/propagator/actors/material_accumulator.hpp"
+#include "detray/propagator/actors/multi_hypothesis_interactor.hpp"
 #include "detray/propagator/actors/parameter_resetter.hpp"
 #include "detray/propagator/actors/parameter_transporter.hpp"
 #include "detray/propagator/actors/pointwise_material_interactor.hpp"
 #include "detray/propagator/line_stepper.hpp"
 #include "detray/propagator/propagator.hpp"
+#include "detray/propagator/rk_dp_stepper.hpp"
 #include "detray/propagator/rk_stepper.hpp"
 #include "detray/simulation/random_scatterer.hpp"
 #include "detray/test/types.hpp"
@@ -36,6 +41,11 @@
 // GTest include(s).
 #include <gtest/gtest.h>
 
+// System include(s).
+#include <array>
+#include <cmath>
+#include <utility>
+
 using namespace detray;
 
 using algebra_t = test::algebra;
@@ -69,7 +79,9 @@ GTEST_TEST(detray_material, telescope_geometry_energy_loss) {
     using actor_chain_t =
         actor_chain<dtuple, pathlimit_aborter, parameter_transporter<algebra_t>,
                     interactor_t, parameter_resetter<algebra_t>>;
-    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+    using propagator_t =
+        propagator<stepper_t, navigator_t, actor_chain_t,
+                   propagation::void_timer, propagation::print_inspector>;
 
     // Propagator is built from the stepper and navigator
     propagator_t p{};
@@ -101,11 +113,10 @@ GTEST_TEST(detray_material, telescope_geometry_energy_loss) {
                                  parameter_resetter_state);
 
     propagator_t::state state(bound_param, det);
-    state.do_debug = true;
 
     // Propagate the entire detector
     ASSERT_TRUE(p.propagate(state, actor_states))
-        << state.debug_stream.str() << std::endl;
+        << state._inspector.to_string() << std::endl;
 
     // muon
     const int pdg{interactor_state.pdg};
@@ -247,7 +258,9 @@ GTEST_TEST(detray_material, telescope_geometry_scattering_angle) {
     using actor_chain_t =
         actor_chain<dtuple, pathlimit_aborter, parameter_transporter<algebra_t>,
                     simulator_t, parameter_resetter<algebra_t>>;
-    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+    using propagator_t =
+        propagator<stepper_t, navigator_t, actor_chain_t,
+                   propagation::void_timer, propagation::print_inspector>;
 
     // Propagator is built from the stepper and navigator
     propagator_t p{};
@@ -286,11 +299,10 @@ GTEST_TEST(detray_material, telescope_geometry_scattering_angle) {
                                      simulator_state, parameter_resetter_state);
 
         propagator_t::state state(bound_param, det);
-        state.do_debug = true;
 
         // Propagate the entire detector
         ASSERT_TRUE(p.propagate(state, actor_states))
-            << state.debug_stream.str() << std::endl;
+            << state._inspector.to_string() << std::endl;
 
         const auto& final_param = state._stepping._bound_params;
 
@@ -413,3 +425,507 @@ GTEST_TEST(detray_material, telescope_geometry_volume_material) {
         ASSERT_NEAR(eloss, eloss_approx, eloss * 0.01);
     }
 }
+
+// Accumulate the material budget and apply it on the last telescope plane
+GTEST_TEST(detray_material, telescope_geometry_material_accumulator) {
+
+    vecmem::host_memory_resource host_mr;
+
+    // Build in x-direction from given module positions
+    detail::ray<algebra_t> traj{{0.f, 0.f, 0.f}, 0.f, {1.f, 0.f, 0.f}, -1.f};
+    std::vector<scalar> positions = {0.f,   50.f,  100.f, 150.f, 200.f, 250.f,
+                                     300.f, 350.f, 400.f, 450.f, 500.f};
+
+    const auto mat = silicon_tml<scalar>();
+    constexpr scalar thickness{0.17f * unit<scalar>::cm};
+
+    tel_det_config<rectangle2D> tel_cfg{20.f * unit<scalar>::mm,
+                                        20.f * unit<scalar>::mm};
+    tel_cfg.positions(positions)
+        .pilot_track(traj)
+        .module_material(mat)
+        .mat_thickness(thickness);
+
+    const auto [det, names] = build_telescope_detector(host_mr, tel_cfg);
+
+    using navigator_t = navigator<decltype(det)>;
+    using stepper_t = line_stepper<algebra_t>;
+    using accumulator_t = material_accumulator<algebra_t>;
+    using interactor_t = pointwise_material_interactor<algebra_t>;
+    using acc_actor_chain_t =
+        actor_chain<dtuple, pathlimit_aborter, parameter_transporter<algebra_t>,
+                    accumulator_t, parameter_resetter<algebra_t>>;
+    using pw_actor_chain_t =
+        actor_chain<dtuple, pathlimit_aborter, parameter_transporter<algebra_t>,
+                    interactor_t, parameter_resetter<algebra_t>>;
+    using acc_propagator_t =
+        propagator<stepper_t, navigator_t, acc_actor_chain_t>;
+    using pw_propagator_t =
+        propagator<stepper_t, navigator_t, pw_actor_chain_t>;
+
+    constexpr scalar q{-1.f};
+    constexpr scalar iniP{10.f * unit<scalar>::GeV};
+
+    typename bound_track_parameters<algebra_t>::vector_type bound_vector;
+    getter::element(bound_vector, e_bound_loc0, 0) = 0.f;
+    getter::element(bound_vector, e_bound_loc1, 0) = 0.f;
+    getter::element(bound_vector, e_bound_phi, 0) = 0.f;
+    getter::element(bound_vector, e_bound_theta, 0) = constant<scalar>::pi_2;
+    getter::element(bound_vector, e_bound_qoverp, 0) = q / iniP;
+    getter::element(bound_vector, e_bound_time, 0) = 0.f;
+    typename bound_track_parameters<algebra_t>::covariance_type bound_cov =
+        matrix_operator().template zero<e_bound_size, e_bound_size>();
+
+    const bound_track_parameters<algebra_t> bound_param(
+        geometry::barcode{}.set_index(0u), bound_vector, bound_cov);
+
+    // The last telescope plane is the target
+    geometry::barcode target{};
+    for (const auto& sf_desc : det.surfaces()) {
+        if (sf_desc.is_sensitive()) {
+            target = sf_desc.barcode();
+        }
+    }
+    ASSERT_FALSE(target.is_invalid());
+
+    // Reference: Material interaction on every plane
+    pathlimit_aborter::state aborter_state{};
+    parameter_transporter<algebra_t>::state bound_updater{};
+    parameter_resetter<algebra_t>::state parameter_resetter_state{};
+
+    interactor_t::state interactor_state{};
+    auto pw_actor_states = std::tie(aborter_state, bound_updater,
+                                    interactor_state, parameter_resetter_state);
+
+    pw_propagator_t::state pw_state(bound_param, det);
+    ASSERT_TRUE(pw_propagator_t{}.propagate(pw_state, pw_actor_states));
+
+    const auto& pw_params = pw_state._stepping._bound_params;
+
+    // Lumped material interaction on the target
+    accumulator_t::state accumulator_state{};
+    accumulator_state.target_surface = target;
+    auto acc_actor_states =
+        std::tie(aborter_state, bound_updater, accumulator_state,
+                 parameter_resetter_state);
+
+    acc_propagator_t::state acc_state(bound_param, det);
+    ASSERT_TRUE(acc_propagator_t{}.propagate(acc_state, acc_actor_states));
+
+    const auto& acc_params = acc_state._stepping._bound_params;
+
+    // Material budget
+    const material_slab<scalar> slab(mat, thickness);
+    const auto n_surfaces{static_cast<scalar>(accumulator_state.n_surfaces)};
+
+    EXPECT_TRUE(accumulator_state.applied);
+    EXPECT_GE(accumulator_state.n_surfaces, positions.size() - 1u);
+    EXPECT_NEAR(accumulator_state.path_length, n_surfaces * thickness,
+                1e-4f * thickness);
+    EXPECT_NEAR(accumulator_state.path_in_X0,
+                n_surfaces * slab.thickness_in_X0(), 1e-4f);
+    EXPECT_NEAR(accumulator_state.path_in_L0,
+                n_surfaces * slab.thickness_in_L0(), 1e-4f);
+
+    // The energy loss agrees with the interaction on every plane
+    const scalar mass{accumulator_state.mass};
+    const scalar pw_E{std::hypot(pw_params.p(), mass)};
+    const scalar acc_E{std::hypot(acc_params.p(), mass)};
+    const scalar iniE{std::hypot(iniP, mass)};
+
+    EXPECT_NEAR(iniE - acc_E, accumulator_state.e_loss, 1e-5f);
+    EXPECT_NEAR(acc_E, pw_E, 1e-5f);
+
+    const auto& acc_cov = acc_params.covariance();
+    EXPECT_NEAR(
+        matrix_operator().element(acc_cov, e_bound_qoverp, e_bound_qoverp),
+        matrix_operator().element(pw_params.covariance(), e_bound_qoverp,
+                                  e_bound_qoverp),
+        1e-10f);
+
+    // Multiple scattering of the total material
+    const scalar theta0{
+        interaction<scalar>().compute_multiple_scattering_theta0(
+            accumulator_state.path_in_X0, accumulator_state.pdg, mass,
+            q / iniP, q)};
+    EXPECT_NEAR(
+        matrix_operator().element(acc_cov, e_bound_theta, e_bound_theta),
+        theta0 * theta0, 1e-3f * theta0 * theta0);
+
+    // No target: The track parameters are not touched
+    accumulator_state = {};
+    acc_propagator_t::state no_target_state(bound_param, det);
+    ASSERT_TRUE(
+        acc_propagator_t{}.propagate(no_target_state, acc_actor_states));
+
+    const auto& no_target_params = no_target_state._stepping._bound_params;
+    EXPECT_FALSE(accumulator_state.applied);
+    EXPECT_GT(accumulator_state.e_loss, 0.f);
+    EXPECT_FLOAT_EQ(no_target_params.qop(), q / iniP);
+    EXPECT_FLOAT_EQ(matrix_operator().element(no_target_params.covariance(),
+                                              e_bound_theta, e_bound_theta),
+                    0.f);
+}
+
+// Multiple scattering in the volume material, accumulated by the stepper
+GTEST_TEST(detray_material, telescope_geometry_volume_scattering) {
+
+    vecmem::host_memory_resource host_mr;
+
+    // Propagator types
+    using bfield_t = bfield::const_field_t;
+    using stepper_t = rk_stepper<bfield_t::view_t, algebra_t>;
+    using actor_chain_t =
+        actor_chain<dtuple, pathlimit_aborter, parameter_transporter<algebra_t>,
+                    parameter_resetter<algebra_t>>;
+    using vector3 = test::vector3;
+
+    // No magnetic field: Straight line track
+    const bfield_t const_bfield =
+        bfield::create_const_field(vector3{0.f, 0.f, 0.f});
+
+    // Track setup
+    constexpr scalar q{-1.f};
+    constexpr scalar iniP{10.f * unit<scalar>::GeV};
+    typename bound_track_parameters<algebra_t>::vector_type bound_vector;
+    getter::element(bound_vector, e_bound_loc0, 0) = 0.f;
+    getter::element(bound_vector, e_bound_loc1, 0) = 0.f;
+    getter::element(bound_vector, e_bound_phi, 0) = 0.f;
+    getter::element(bound_vector, e_bound_theta, 0) = constant<scalar>::pi_2;
+    getter::element(bound_vector, e_bound_qoverp, 0) = q / iniP;
+    getter::element(bound_vector, e_bound_time, 0) = 0.f;
+    typename bound_track_parameters<algebra_t>::covariance_type bound_cov =
+        matrix_operator().template zero<e_bound_size, e_bound_size>();
+
+    const bound_track_parameters<algebra_t> bound_param(
+        geometry::barcode{}.set_index(0u), bound_vector, bound_cov);
+
+    // Telescope planes without material in an iron volume
+    detail::ray<algebra_t> traj{{0.f, 0.f, 0.f}, 0.f, {1.f, 0.f, 0.f}, -1.f};
+    const scalar gap{100.f * unit<scalar>::mm};
+    std::vector<scalar> positions = {0.f, gap, 2.f * gap, 3.f * gap};
+
+    const auto vol_mat = iron<scalar>();
+
+    tel_det_config<rectangle2D> tel_cfg{1000.f * unit<scalar>::mm,
+                                        1000.f * unit<scalar>::mm};
+    tel_cfg.positions(positions)
+        .pilot_track(traj)
+        .module_material(vacuum<scalar>())
+        .volume_material(vol_mat);
+
+    const auto [det, names] = build_telescope_detector(host_mr, tel_cfg);
+
+    using navigator_t = navigator<decltype(det)>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+
+    // Propagate and @returns the bound track parameters on the last plane
+    auto propagate = [&](const propagation::config<scalar>& cfg) {
+        pathlimit_aborter::state aborter_state{};
+        parameter_transporter<algebra_t>::state transporter_state{};
+        parameter_resetter<algebra_t>::state resetter_state{};
+        auto actor_states =
+            std::tie(aborter_state, transporter_state, resetter_state);
+
+        propagator_t::state state(bound_param, const_bfield, det);
+        EXPECT_TRUE(propagator_t{cfg}.propagate(state, actor_states));
+
+        return state._stepping._bound_params;
+    };
+
+    const auto theta_var = [](const bound_track_parameters<algebra_t>& bp) {
+        return matrix_operator().element(bp.covariance(), e_bound_theta,
+                                         e_bound_theta);
+    };
+
+    // Without the volume scattering, the angles stay exact
+    propagation::config<scalar> cfg{};
+    const auto no_scat_params = propagate(cfg);
+
+    EXPECT_FLOAT_EQ(theta_var(no_scat_params), 0.f);
+
+    // Scattering angle variance of all gaps, with the momentum on the
+    // planes between the initial and the final momentum
+    cfg.stepping.do_volume_scattering = true;
+    const auto scat_params = propagate(cfg);
+
+    const scalar mass{105.7f * unit<scalar>::MeV};
+    const scalar x_in_X0{gap / vol_mat.X0()};
+    const auto n_gaps{static_cast<scalar>(positions.size() - 1u)};
+    auto expected_var = [&](const scalar qop) {
+        const scalar theta0{
+            interaction<scalar>().compute_multiple_scattering_theta0(
+                x_in_X0, pdg_particle::eMuon, mass, qop, q)};
+        return n_gaps * theta0 * theta0;
+    };
+
+    EXPECT_GT(theta_var(scat_params), expected_var(q / iniP));
+    EXPECT_LE(theta_var(scat_params),
+              1.0001f * expected_var(scat_params.qop()));
+
+    const scalar sin2_theta{1.f - scat_params.dir()[2] * scat_params.dir()[2]};
+    EXPECT_NEAR(matrix_operator().element(scat_params.covariance(),
+                                          e_bound_phi, e_bound_phi),
+                theta_var(scat_params) / sin2_theta,
+                1e-3f * theta_var(scat_params));
+
+    // Thick scatterers: Every gap adds the position variance L^2 theta0^2/3
+    // and the covariance L theta0^2 / 2 on its exit plane, which are
+    // transported through the following gaps. In sum, this is the variance
+    // of a single scatterer of the full length
+    const auto loc_var = [](const bound_track_parameters<algebra_t>& bp,
+                            const unsigned int i) {
+        return matrix_operator().element(bp.covariance(), i, i);
+    };
+    const scalar n_gaps3{n_gaps * n_gaps * n_gaps};
+    for (const unsigned int i : {e_bound_loc0, e_bound_loc1}) {
+        EXPECT_FLOAT_EQ(loc_var(no_scat_params, i), 0.f);
+        EXPECT_GT(loc_var(scat_params, i),
+                  n_gaps3 / 3.f * gap * gap * expected_var(q / iniP) / n_gaps);
+        EXPECT_LE(loc_var(scat_params, i),
+                  1.0001f * n_gaps3 / 3.f * gap * gap *
+                      expected_var(scat_params.qop()) / n_gaps);
+    }
+    // The position is correlated with one of the angles: L theta0^2 n^2 / 2
+    const auto& scat_cov = scat_params.covariance();
+    const scalar loc0_angle_cov{math::max(
+        math::abs(matrix_operator().element(scat_cov, e_bound_loc0,
+                                            e_bound_phi)),
+        math::abs(matrix_operator().element(scat_cov, e_bound_loc0,
+                                            e_bound_theta)))};
+    EXPECT_GT(loc0_angle_cov,
+              0.5f * n_gaps * gap * expected_var(q / iniP));
+    EXPECT_LE(loc0_angle_cov,
+              1.0001f * 0.5f * n_gaps * gap * expected_var(scat_params.qop()));
+
+    // The accumulation does not depend on the step sizes in the material
+    cfg.stepping.max_step_in_X0 = 0.5f;
+    const auto short_step_params = propagate(cfg);
+
+    EXPECT_NEAR(theta_var(short_step_params), theta_var(scat_params),
+                1e-3f * theta_var(scat_params));
+    EXPECT_NEAR(loc_var(short_step_params, e_bound_loc0),
+                loc_var(scat_params, e_bound_loc0),
+                1e-3f * loc_var(scat_params, e_bound_loc0));
+    EXPECT_NEAR(short_step_params.qop(), scat_params.qop(),
+                1e-3f * math::abs(scat_params.qop()));
+
+    // The Dormand-Prince stepper accumulates the same material
+    using dp_stepper_t = rk_dp_stepper<bfield_t::view_t, algebra_t>;
+    using dp_propagator_t =
+        propagator<dp_stepper_t, navigator_t, actor_chain_t>;
+
+    pathlimit_aborter::state aborter_state{};
+    parameter_transporter<algebra_t>::state transporter_state{};
+    parameter_resetter<algebra_t>::state resetter_state{};
+    auto actor_states =
+        std::tie(aborter_state, transporter_state, resetter_state);
+
+    dp_propagator_t::state dp_state(bound_param, const_bfield, det);
+    ASSERT_TRUE(dp_propagator_t{cfg}.propagate(dp_state, actor_states));
+    const auto& dp_params = dp_state._stepping._bound_params;
+
+    EXPECT_NEAR(theta_var(dp_params), theta_var(short_step_params),
+                1e-3f * theta_var(short_step_params));
+    EXPECT_NEAR(loc_var(dp_params, e_bound_loc0),
+                loc_var(short_step_params, e_bound_loc0),
+                1e-3f * loc_var(short_step_params, e_bound_loc0));
+}
+
+// Repeated propagation of the same track with a material lookup cache
+GTEST_TEST(detray_material, toy_geometry_material_cache) {
+
+    vecmem::host_memory_resource host_mr;
+
+    // Toy detector with material maps
+    const auto [det, names] = build_toy_detector(host_mr);
+
+    using navigator_t = navigator<decltype(det)>;
+    using stepper_t = line_stepper<algebra_t>;
+    using interactor_t = pointwise_material_interactor<algebra_t>;
+    using actor_chain_t =
+        actor_chain<dtuple, pathlimit_aborter, parameter_transporter<algebra_t>,
+                    interactor_t, parameter_resetter<algebra_t>>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+
+    const scalar p{10.f * unit<scalar>::GeV};
+    const free_track_parameters<algebra_t> track(
+        {0.f, 0.f, 0.f}, 0.f, {p / std::sqrt(3.f), p / std::sqrt(3.f),
+                               p / std::sqrt(3.f)},
+        -1.f);
+
+    pathlimit_aborter::state aborter_state{};
+    parameter_transporter<algebra_t>::state bound_updater{};
+    parameter_resetter<algebra_t>::state parameter_resetter_state{};
+    interactor_t::state interactor_state{};
+
+    auto actor_states = std::tie(aborter_state, bound_updater,
+                                 interactor_state, parameter_resetter_state);
+
+    // Reference without cache
+    propagator_t::state ref_state(track, det);
+    ASSERT_TRUE(propagator_t{}.propagate(ref_state, actor_states));
+    const scalar ref_p{ref_state._stepping().p()};
+    EXPECT_LT(ref_p, p);
+
+    // The cache is kept between the propagations
+    interactor_t::material_cache_type mat_cache{};
+    interactor_state.mat_cache = &mat_cache;
+
+    propagator_t::state first_state(track, det);
+    ASSERT_TRUE(propagator_t{}.propagate(first_state, actor_states));
+    EXPECT_FLOAT_EQ(first_state._stepping().p(), ref_p);
+
+    const std::size_t n_lookups{mat_cache.n_hits() + mat_cache.n_misses()};
+    EXPECT_GT(mat_cache.n_misses(), 0u);
+    EXPECT_GT(mat_cache.size(), 0u);
+
+    // Second pass: The track crosses the map bins that are in the cache
+    propagator_t::state second_state(track, det);
+    ASSERT_TRUE(propagator_t{}.propagate(second_state, actor_states));
+    EXPECT_FLOAT_EQ(second_state._stepping().p(), ref_p);
+
+    EXPECT_EQ(mat_cache.n_hits() + mat_cache.n_misses(), 2u * n_lookups);
+    EXPECT_GT(mat_cache.n_hits(), 0u);
+
+    mat_cache.clear();
+    EXPECT_EQ(mat_cache.size(), 0u);
+    EXPECT_EQ(mat_cache.n_hits(), 0u);
+}
+
+// Follow several mass hypotheses along a single propagation
+GTEST_TEST(detray_material, telescope_geometry_multi_hypothesis) {
+
+    vecmem::host_memory_resource host_mr;
+
+    // Build in x-direction from given module positions
+    detail::ray<algebra_t> traj{{0.f, 0.f, 0.f}, 0.f, {1.f, 0.f, 0.f}, -1.f};
+    std::vector<scalar> positions = {0.f,   50.f,  100.f, 150.f, 200.f, 250.f,
+                                     300.f, 350.f, 400.f, 450.f, 500.f};
+
+    tel_det_config<rectangle2D> tel_cfg{20.f * unit<scalar>::mm,
+                                        20.f * unit<scalar>::mm};
+    tel_cfg.positions(positions)
+        .pilot_track(traj)
+        .module_material(silicon_tml<scalar>())
+        .mat_thickness(0.17f * unit<scalar>::cm);
+
+    const auto [det, names] = build_telescope_detector(host_mr, tel_cfg);
+
+    using navigator_t = navigator<decltype(det)>;
+    using stepper_t = line_stepper<algebra_t>;
+    using interactor_t = pointwise_material_interactor<algebra_t>;
+    using hypotheses_t = multi_hypothesis_interactor<algebra_t>;
+    using actor_chain_t =
+        actor_chain<dtuple, pathlimit_aborter, parameter_transporter<algebra_t>,
+                    hypotheses_t, interactor_t, parameter_resetter<algebra_t>>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+
+    // Single hypothesis propagation
+    using single_actor_chain_t =
+        actor_chain<dtuple, pathlimit_aborter, parameter_transporter<algebra_t>,
+                    interactor_t, parameter_resetter<algebra_t>>;
+    using single_propagator_t =
+        propagator<stepper_t, navigator_t, single_actor_chain_t>;
+
+    // Hypotheses in addition to the muon reference
+    const std::array<std::pair<int, scalar>, 4u> particles{
+        {{pdg_particle::ePionMinus, 139.57f * unit<scalar>::MeV},
+         {pdg_particle::eKaonMinus, 493.68f * unit<scalar>::MeV},
+         {pdg_particle::eAntiProton, 938.27f * unit<scalar>::MeV},
+         {pdg_particle::eElectron, 0.511f * unit<scalar>::MeV}}};
+
+    auto make_seed = [](const scalar p) {
+        typename bound_track_parameters<algebra_t>::vector_type bound_vector;
+        getter::element(bound_vector, e_bound_loc0, 0) = 0.f;
+        getter::element(bound_vector, e_bound_loc1, 0) = 0.f;
+        getter::element(bound_vector, e_bound_phi, 0) = 0.f;
+        getter::element(bound_vector, e_bound_theta, 0) =
+            constant<scalar>::pi_2;
+        getter::element(bound_vector, e_bound_qoverp, 0) = -1.f / p;
+        getter::element(bound_vector, e_bound_time, 0) = 0.f;
+
+        return bound_track_parameters<algebra_t>(
+            geometry::barcode{}.set_index(0u), bound_vector,
+            matrix_operator().template zero<e_bound_size, e_bound_size>());
+    };
+
+    // High momentum: All hypotheses share the trajectory
+    const auto seed = make_seed(10.f * unit<scalar>::GeV);
+
+    pathlimit_aborter::state aborter_state{};
+    parameter_transporter<algebra_t>::state bound_updater{};
+    parameter_resetter<algebra_t>::state parameter_resetter_state{};
+    interactor_t::state interactor_state{};
+    hypotheses_t::state hyp_state{};
+    for (const auto &[pdg, mass] : particles) {
+        ASSERT_TRUE(hyp_state.add(pdg, mass, seed));
+    }
+    // Full
+    EXPECT_FALSE(hyp_state.add(pdg_particle::eMuon, 105.7f));
+    EXPECT_EQ(hyp_state.size(), particles.size());
+
+    auto actor_states =
+        std::tie(aborter_state, bound_updater, hyp_state, interactor_state,
+                 parameter_resetter_state);
+
+    propagator_t::state state(seed, det);
+    ASSERT_TRUE(propagator_t{}.propagate(state, actor_states));
+    EXPECT_EQ(hyp_state.n_diverged(), 0u);
+
+    // Compare with the propagation of every hypothesis on its own
+    for (std::size_t i = 0u; i < particles.size(); ++i) {
+        const auto &[pdg, mass] = particles[i];
+        const auto &hyp_params = hyp_state[i].params;
+
+        interactor_t::state single_interactor_state{};
+        single_interactor_state.pdg = pdg;
+        single_interactor_state.mass = mass;
+        auto single_actor_states =
+            std::tie(aborter_state, bound_updater, single_interactor_state,
+                     parameter_resetter_state);
+
+        single_propagator_t::state single_state(seed, det);
+        single_state._stepping._pdg = pdg;
+        single_state._stepping._mass = mass;
+        ASSERT_TRUE(
+            single_propagator_t{}.propagate(single_state, single_actor_states));
+
+        const auto &single_params = single_state._stepping._bound_params;
+        EXPECT_EQ(hyp_params.surface_link(), single_params.surface_link());
+        EXPECT_NEAR(hyp_params.qop(), single_params.qop(),
+                    1e-5f * std::abs(single_params.qop()));
+        EXPECT_NEAR(hyp_params.bound_local()[0],
+                    single_params.bound_local()[0], 1e-5f);
+
+        for (const auto idx : {e_bound_phi, e_bound_theta, e_bound_qoverp}) {
+            const scalar var{matrix_operator().element(
+                single_params.covariance(), idx, idx)};
+            EXPECT_NEAR(
+                matrix_operator().element(hyp_params.covariance(), idx, idx),
+                var, 1e-4f * var);
+        }
+    }
+
+    // Low momentum: The slow proton cannot follow the muon
+    const auto slow_seed = make_seed(1.f * unit<scalar>::GeV);
+
+    hypotheses_t::state slow_hyp_state{};
+    slow_hyp_state.max_qop_deviation = 1e-3f;
+    for (const auto &[pdg, mass] : particles) {
+        ASSERT_TRUE(slow_hyp_state.add(pdg, mass, slow_seed));
+    }
+
+    auto slow_actor_states =
+        std::tie(aborter_state, bound_updater, slow_hyp_state,
+                 interactor_state, parameter_resetter_state);
+
+    propagator_t::state slow_state(slow_seed, det);
+    ASSERT_TRUE(propagator_t{}.propagate(slow_state, slow_actor_states));
+
+    EXPECT_FALSE(slow_hyp_state[0].diverged);
+    EXPECT_TRUE(slow_hyp_state[2].diverged);
+    // Stopped on an earlier surface
+    EXPECT_NE(slow_hyp_state[2].params.surface_link(),
+              slow_state._stepping._bound_params.surface_link());
+}
@@ -33,6 +33,7 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <type_traits>
 
 namespace po = boost::program_options;
 using namespace detray;
@@ -458,6 +459,25 @@ bound_getter<algebra_type>::state evaluate_bound_param(
     const scalar rk_tolerance, const scalar constraint_step,
     bool use_field_gradient, bool do_covariance_transport, bool do_inspect) {
 
+    // Record the propagation flow of the track with a debug propagator
+    if constexpr (std::is_same_v<typename propagator_t::inspector_type,
+                                 propagation::void_inspector>) {
+        if (do_inspect) {
+            using debug_propagator_t =
+                propagator<typename propagator_t::stepper_type,
+                           typename propagator_t::navigator_type,
+                           typename propagator_t::actor_chain_type,
+                           typename propagator_t::timer_type,
+                           propagation::print_inspector>;
+
+            return evaluate_bound_param<debug_propagator_t, field_t>(
+                trk_count, detector_length, initial_param, det, field,
+                overstep_tolerance, on_surface_tolerance, rk_tolerance,
+                constraint_step, use_field_gradient, do_covariance_transport,
+                false);
+        }
+    }
+
     // Propagator is built from the stepper and navigator
     propagation::config<scalar> cfg{};
     cfg.navigation.overstep_tolerance = overstep_tolerance;
@@ -481,14 +501,14 @@ bound_getter<algebra_type>::state evaluate_bound_param(
     typename propagator_t::state state(initial_param, field, det);
 
     // Run the propagation for the reference track
-    state.do_debug = do_inspect;
     state._stepping
         .template set_constraint<detray::step::constraint::e_accuracy>(
             constraint_step);
 
     p.propagate(state, actor_states);
-    if (do_inspect) {
-        std::cout << state.debug_stream.str() << std::endl;
+    if constexpr (std::is_same_v<typename propagator_t::inspector_type,
+                                 propagation::print_inspector>) {
+        std::cout << state._inspector.to_string() << std::endl;
     }
 
     return bound_getter_state;
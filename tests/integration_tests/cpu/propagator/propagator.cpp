@@ -19,20 +19,30 @@
 #include "detray/propagator/actors/parameter_resetter.hpp"
 #include "detray/propagator/actors/parameter_transporter.hpp"
 #include "detray/propagator/actors/pointwise_material_interactor.hpp"
+#include "detray/propagator/actors/step_recorder.hpp"
 #include "detray/propagator/base_actor.hpp"
 #include "detray/propagator/line_stepper.hpp"
+#include "detray/propagator/numa_executor.hpp"
+#include "detray/propagator/parallel_executor.hpp"
 #include "detray/propagator/rk_stepper.hpp"
+#include "detray/propagator/track_ordering.hpp"
+#include "detray/propagator/track_regrouping.hpp"
 #include "detray/simulation/event_generator/track_generators.hpp"
 #include "detray/test/types.hpp"
 #include "detray/tracks/tracks.hpp"
 #include "detray/utils/inspectors.hpp"
 
 // Vecmem include(s)
+#include <vecmem/containers/vector.hpp>
 #include <vecmem/memory/host_memory_resource.hpp>
 
 // GTest include(s)
 #include <gtest/gtest.h>
 
+// System include(s)
+#include <algorithm>
+#include <vector>
+
 using namespace detray;
 
 using algebra_t = test::algebra;
@@ -118,6 +128,25 @@ struct helix_inspector : actor {
     }
 };
 
+/// Record the surfaces the navigator reaches
+struct surface_recorder : actor {
+
+    struct state {
+        /// barcodes of the surfaces in the order they were reached
+        std::vector<geometry::barcode> _barcodes;
+    };
+
+    template <typename propagator_state_t>
+    DETRAY_HOST_DEVICE void operator()(
+        state& recorder_state, const propagator_state_t& prop_state) const {
+
+        const auto& navigation = prop_state._navigation;
+        if (navigation.is_on_module() || navigation.is_on_portal()) {
+            recorder_state._barcodes.push_back(navigation.barcode());
+        }
+    }
+};
+
 }  // anonymous namespace
 
 /// Test basic functionality of the propagator using a straight line stepper
@@ -144,6 +173,941 @@ GTEST_TEST(detray_propagator, propagator_line_stepper) {
         << state._navigation.inspector().to_string() << std::endl;
 }
 
+/// Test the batch propagation against the propagation of single tracks
+GTEST_TEST(detray_propagator, propagator_batch) {
+
+    vecmem::host_memory_resource host_mr;
+    auto [d, names] = build_toy_detector(host_mr);
+
+    using detector_t = decltype(d);
+    using intersection_t =
+        intersection2D<typename detector_t::surface_type, algebra_t>;
+    using navigator_t = navigator<detector_t, navigation::void_inspector,
+                                  intersection_t, 20u>;
+    using bfield_t = bfield::const_field_t;
+    using stepper_t = rk_stepper<bfield_t::view_t, algebra_t>;
+    using actor_chain_t = actor_chain<dtuple, pathlimit_aborter>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+    using result_t = propagation::result<algebra_t>;
+
+    const vector3 B{0.f * unit<scalar_t>::T, 0.f * unit<scalar_t>::T,
+                    2.f * unit<scalar_t>::T};
+    const bfield_t hom_bfield = bfield::create_const_field(B);
+
+    // Generate the track batch
+    using generator_t =
+        uniform_track_generator<free_track_parameters<algebra_t>>;
+    auto trk_gen_cfg = generator_t::configuration{};
+    trk_gen_cfg.phi_steps(10u).theta_steps(10u);
+    trk_gen_cfg.p_tot(1.f * unit<scalar_t>::GeV);
+
+    vecmem::vector<free_track_parameters<algebra_t>> tracks(&host_mr);
+    for (const auto track : generator_t{trk_gen_cfg}) {
+        tracks.push_back(track);
+    }
+
+    // Some of the tracks will be stopped by the aborter
+    pathlimit_aborter::state aborter_state{};
+    aborter_state.set_path_limit(50.f * unit<scalar_t>::cm);
+    const actor_chain_t::state_tuple actor_states{aborter_state};
+
+    vecmem::vector<result_t> results(tracks.size(), &host_mr);
+
+    propagator_t p{};
+    p.propagate_batch(tracks, results, propagation::sequential_executor{},
+                      actor_states, hom_bfield, d);
+
+    std::size_t n_success{0u};
+    for (std::size_t i = 0u; i < tracks.size(); ++i) {
+        pathlimit_aborter::state trk_aborter_state{aborter_state};
+        propagator_t::state state(tracks[i], hom_bfield, d);
+
+        const bool success{p.propagate(
+            state, actor_chain_t::state{trk_aborter_state})};
+
+        const auto& res = results[i];
+        EXPECT_EQ(res.success, success);
+        EXPECT_EQ(res.status, state._navigation.status());
+        EXPECT_FLOAT_EQ(res.path_length, state._stepping._path_length);
+        EXPECT_NEAR(getter::norm(res.params.pos() - state._stepping().pos()),
+                    0.f, tol);
+        EXPECT_NEAR(getter::norm(res.params.dir() - state._stepping().dir()),
+                    0.f, tol);
+
+        n_success += success ? 1u : 0u;
+    }
+
+    // Both, successful and aborted tracks are in the batch
+    EXPECT_TRUE(n_success > 0u);
+    EXPECT_TRUE(n_success < tracks.size());
+
+    // Propagate only one of the tracks, e.g. on a device thread
+    const unsigned int trk_idx{42u};
+    vecmem::vector<result_t> single_result(tracks.size(), &host_mr);
+    p.propagate_batch(tracks, single_result,
+                      propagation::single_track_executor{trk_idx},
+                      actor_states, hom_bfield, d);
+
+    EXPECT_EQ(single_result[trk_idx].status, results[trk_idx].status);
+    EXPECT_FLOAT_EQ(single_result[trk_idx].path_length,
+                    results[trk_idx].path_length);
+    EXPECT_FALSE(single_result[0u].success);
+    EXPECT_EQ(single_result[0u].status, navigation::status::e_unknown);
+
+    // Propagate the batch on multiple threads
+    propagation::parallel_executor mt_exec{};
+    mt_exec.n_threads = 4u;
+    mt_exec.chunk_size = 3u;
+
+    vecmem::vector<result_t> mt_results(tracks.size(), &host_mr);
+    p.propagate_batch(tracks, mt_results, mt_exec, actor_states, hom_bfield,
+                      d);
+
+    for (std::size_t i = 0u; i < tracks.size(); ++i) {
+        EXPECT_EQ(mt_results[i].success, results[i].success);
+        EXPECT_EQ(mt_results[i].status, results[i].status);
+        EXPECT_FLOAT_EQ(mt_results[i].path_length, results[i].path_length);
+    }
+
+    // Take the candidate buffers from an event-scoped memory resource
+    propagation::event_memory_resource event_mr{host_mr, 64u * 1024u};
+    for (unsigned int event = 0u; event < 2u; ++event) {
+        vecmem::vector<result_t> ev_results(tracks.size(), &host_mr);
+        p.propagate_batch(tracks, ev_results,
+                          propagation::sequential_executor{}, event_mr,
+                          actor_states, hom_bfield, d);
+
+        for (std::size_t i = 0u; i < tracks.size(); ++i) {
+            EXPECT_EQ(ev_results[i].success, results[i].success);
+            EXPECT_EQ(ev_results[i].status, results[i].status);
+            EXPECT_FLOAT_EQ(ev_results[i].path_length, results[i].path_length);
+        }
+
+        // The tracks reuse the memory of the previous track
+        EXPECT_EQ(event_mr.n_slabs(), 1u);
+        event_mr.reset();
+    }
+
+    // Same on multiple threads
+    vecmem::vector<result_t> mt_ev_results(tracks.size(), &host_mr);
+    p.propagate_batch(tracks, mt_ev_results, mt_exec, event_mr, actor_states,
+                      hom_bfield, d);
+    event_mr.reset();
+
+    for (std::size_t i = 0u; i < tracks.size(); ++i) {
+        EXPECT_EQ(mt_ev_results[i].success, results[i].success);
+        EXPECT_EQ(mt_ev_results[i].status, results[i].status);
+        EXPECT_FLOAT_EQ(mt_ev_results[i].path_length, results[i].path_length);
+    }
+
+    // Propagate a pool of preallocated states
+    std::vector<propagator_t::state> state_pool;
+    state_pool.reserve(tracks.size());
+    for (const auto &track : tracks) {
+        state_pool.emplace_back(track, hom_bfield, d);
+    }
+
+    vecmem::vector<result_t> pool_results(tracks.size(), &host_mr);
+    p.propagate_batch_pooled(state_pool, pool_results, mt_exec, actor_states);
+
+    for (std::size_t i = 0u; i < tracks.size(); ++i) {
+        EXPECT_EQ(pool_results[i].success, results[i].success);
+        EXPECT_EQ(pool_results[i].status, results[i].status);
+        EXPECT_FLOAT_EQ(pool_results[i].path_length, results[i].path_length);
+    }
+
+    // Interleave the tracks of groups that don't divide the batch evenly
+    vecmem::vector<result_t> il_results(tracks.size(), &host_mr);
+    p.propagate_batch_interleaved(tracks, il_results, mt_exec, 5u,
+                                  actor_states, hom_bfield, d);
+
+    for (std::size_t i = 0u; i < tracks.size(); ++i) {
+        EXPECT_EQ(il_results[i].success, results[i].success);
+        EXPECT_EQ(il_results[i].status, results[i].status);
+        EXPECT_FLOAT_EQ(il_results[i].path_length, results[i].path_length);
+    }
+
+    // Propagate the tracks in the order of their spatial keys
+    const propagation::ordering_config<scalar_t> ord_cfg{};
+    vecmem::vector<unsigned int> order(tracks.size(), &host_mr);
+    propagation::spatial_order(tracks, order, ord_cfg);
+
+    std::vector<bool> visited(tracks.size(), false);
+    for (std::size_t i = 0u; i < order.size(); ++i) {
+        ASSERT_TRUE(order[i] < tracks.size());
+        EXPECT_FALSE(visited[order[i]]);
+        visited[order[i]] = true;
+
+        if (i > 0u) {
+            EXPECT_LE(propagation::spatial_key(tracks[order[i - 1u]], ord_cfg),
+                      propagation::spatial_key(tracks[order[i]], ord_cfg));
+        }
+    }
+
+    vecmem::vector<result_t> ord_results(tracks.size(), &host_mr);
+    p.propagate_batch(
+        tracks, ord_results,
+        propagation::ordered_executor<propagation::parallel_executor>{
+            mt_exec, order.data()},
+        actor_states, hom_bfield, d);
+
+    // The results are still in the input order of the tracks
+    for (std::size_t i = 0u; i < tracks.size(); ++i) {
+        EXPECT_EQ(ord_results[i].success, results[i].success);
+        EXPECT_EQ(ord_results[i].status, results[i].status);
+        EXPECT_FLOAT_EQ(ord_results[i].path_length, results[i].path_length);
+    }
+
+    // Propagate on two detector replicas, e.g. on two NUMA nodes
+    using replica_detector_t =
+        detector<typename detector_t::metadata, device_container_types>;
+    using replica_propagator_t = propagator<
+        stepper_t,
+        navigator<replica_detector_t, navigation::void_inspector,
+                  intersection2D<typename replica_detector_t::surface_type,
+                                 algebra_t>,
+                  20u>,
+        actor_chain_t>;
+
+    detector_replicas<detector_t> replicas(d, 2u);
+    const auto fields = numa::replicate(
+        2u, [&hom_bfield](const unsigned int) { return hom_bfield; });
+
+    propagation::numa_executor numa_exec{};
+    numa_exec.threads_per_node = 2u;
+    numa_exec.chunk_size = 3u;
+
+    vecmem::vector<result_t> rep_results(tracks.size(), &host_mr);
+    propagation::propagate_batch_replicated(replica_propagator_t{}, replicas,
+                                            tracks, rep_results, numa_exec,
+                                            actor_states, fields);
+
+    for (std::size_t i = 0u; i < tracks.size(); ++i) {
+        EXPECT_EQ(rep_results[i].success, results[i].success);
+        EXPECT_EQ(rep_results[i].status, results[i].status);
+        EXPECT_FLOAT_EQ(rep_results[i].path_length, results[i].path_length);
+    }
+}
+
+/// Test the propagation that is suspended on every sensitive surface
+GTEST_TEST(detray_propagator, propagator_suspend_resume) {
+
+    vecmem::host_memory_resource host_mr;
+    const auto [d, names] = build_toy_detector(host_mr);
+
+    using navigator_t = navigator<decltype(d)>;
+    using bfield_t = bfield::const_field_t;
+    using stepper_t = rk_stepper<bfield_t::view_t, algebra_t>;
+    using actor_chain_t = actor_chain<dtuple, surface_recorder>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+
+    const vector3 B{0.f * unit<scalar_t>::T, 0.f * unit<scalar_t>::T,
+                    2.f * unit<scalar_t>::T};
+    const bfield_t hom_bfield = bfield::create_const_field(B);
+
+    using generator_t =
+        uniform_track_generator<free_track_parameters<algebra_t>>;
+    auto trk_gen_cfg = generator_t::configuration{};
+    trk_gen_cfg.phi_steps(10u).theta_steps(10u);
+    trk_gen_cfg.p_tot(1.f * unit<scalar_t>::GeV);
+
+    propagator_t p{};
+
+    for (const auto track : generator_t{trk_gen_cfg}) {
+
+        // Reference: uninterrupted propagation
+        surface_recorder::state ref_recorder{};
+        propagator_t::state ref_state(track, hom_bfield, d);
+        const bool ref_success{p.propagate(ref_state, std::tie(ref_recorder))};
+
+        std::vector<geometry::barcode> ref_sensitives;
+        for (const auto bcd : ref_recorder._barcodes) {
+            if (bcd.id() == surface_id::e_sensitive) {
+                ref_sensitives.push_back(bcd);
+            }
+        }
+
+        // Suspend on every sensitive surface
+        surface_recorder::state recorder{};
+        propagator_t::state state(track, hom_bfield, d);
+        std::vector<geometry::barcode> sensitives;
+
+        p.propagate_init(state, std::tie(recorder));
+        while (p.propagate_until(state, propagation::on_sensitive{},
+                                 std::tie(recorder))) {
+            ASSERT_TRUE(state._navigation.is_on_sensitive());
+            sensitives.push_back(state._navigation.barcode());
+        }
+
+        EXPECT_EQ(state._navigation.is_complete(), ref_success);
+        EXPECT_EQ(sensitives, ref_sensitives);
+        EXPECT_EQ(recorder._barcodes, ref_recorder._barcodes);
+        EXPECT_FLOAT_EQ(state._stepping._path_length,
+                        ref_state._stepping._path_length);
+    }
+}
+
+/// Test that soft looping tracks are stopped by the looper aborter
+GTEST_TEST(detray_propagator, looper_aborter) {
+
+    vecmem::host_memory_resource host_mr;
+    const auto [d, names] = build_toy_detector(host_mr);
+
+    using navigator_t = navigator<decltype(d)>;
+    using bfield_t = bfield::const_field_t;
+    using stepper_t = rk_stepper<bfield_t::view_t, algebra_t>;
+    using actor_chain_t =
+        actor_chain<dtuple, pathlimit_aborter, looper_aborter>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+
+    const vector3 B{0.f * unit<scalar_t>::T, 0.f * unit<scalar_t>::T,
+                    2.f * unit<scalar_t>::T};
+    const bfield_t hom_bfield = bfield::create_const_field(B);
+
+    // Low momentum tracks, almost transverse to the field: These loop in the
+    // pixel barrel
+    using generator_t =
+        uniform_track_generator<free_track_parameters<algebra_t>>;
+    auto trk_gen_cfg = generator_t::configuration{};
+    trk_gen_cfg.phi_steps(10u).theta_steps(2u);
+    trk_gen_cfg.theta_range(0.49f * constant<scalar_t>::pi,
+                            0.51f * constant<scalar_t>::pi);
+    trk_gen_cfg.p_tot(50.f * unit<scalar_t>::MeV);
+
+    propagator_t p{};
+
+    for (const auto track : generator_t{trk_gen_cfg}) {
+
+        pathlimit_aborter::state pathlimit_state{5.f * unit<scalar_t>::m};
+
+        // Stop after one turn
+        looper_aborter::state turn_state{};
+        turn_state.max_turns = 1.f;
+
+        propagator_t::state state(track, hom_bfield, d);
+        ASSERT_FALSE(
+            p.propagate(state, std::tie(pathlimit_state, turn_state)));
+        EXPECT_EQ(turn_state.abort_reason, looper_aborter::reason::e_turns);
+        EXPECT_TRUE(turn_state.n_turns() > 1.f);
+        EXPECT_TRUE(turn_state.n_turns() < 1.5f);
+        EXPECT_TRUE(state._stepping._path_length <
+                    pathlimit_state.path_limit());
+
+        // Stop when the looper comes back to a volume
+        looper_aborter::state revisit_state{};
+        revisit_state.max_revisits = 0u;
+
+        propagator_t::state revisit_prop_state(track, hom_bfield, d);
+        ASSERT_FALSE(p.propagate(revisit_prop_state,
+                                 std::tie(pathlimit_state, revisit_state)));
+        EXPECT_EQ(revisit_state.abort_reason,
+                  looper_aborter::reason::e_revisits);
+        EXPECT_EQ(revisit_state.n_revisits, 1u);
+
+        // Stop right away below the momentum threshold
+        looper_aborter::state p_state{};
+        p_state.min_p = 100.f * unit<scalar_t>::MeV;
+
+        propagator_t::state p_prop_state(track, hom_bfield, d);
+        ASSERT_FALSE(
+            p.propagate(p_prop_state, std::tie(pathlimit_state, p_state)));
+        EXPECT_EQ(p_state.abort_reason, looper_aborter::reason::e_momentum);
+        EXPECT_FLOAT_EQ(p_prop_state._stepping._path_length, 0.f);
+    }
+}
+
+/// Test the step-wise propagation of a batch that is regrouped in between
+GTEST_TEST(detray_propagator, propagator_regrouping) {
+
+    vecmem::host_memory_resource host_mr;
+    const auto [d, names] = build_toy_detector(host_mr);
+
+    using detector_t = decltype(d);
+    using intersection_t =
+        intersection2D<typename detector_t::surface_type, algebra_t>;
+    using navigator_t = navigator<detector_t, navigation::void_inspector,
+                                  intersection_t, 20u>;
+    using bfield_t = bfield::const_field_t;
+    using stepper_t = rk_stepper<bfield_t::view_t, algebra_t>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain<>>;
+
+    const vector3 B{0.f * unit<scalar_t>::T, 0.f * unit<scalar_t>::T,
+                    2.f * unit<scalar_t>::T};
+    const bfield_t hom_bfield = bfield::create_const_field(B);
+
+    using generator_t =
+        uniform_track_generator<free_track_parameters<algebra_t>>;
+    auto trk_gen_cfg = generator_t::configuration{};
+    trk_gen_cfg.phi_steps(10u).theta_steps(10u);
+    trk_gen_cfg.p_tot(1.f * unit<scalar_t>::GeV);
+
+    propagator_t p{};
+
+    std::vector<propagator_t::state> states;
+    std::vector<bool> is_complete;
+    std::vector<scalar_t> path_lengths;
+    for (const auto track : generator_t{trk_gen_cfg}) {
+        states.emplace_back(track, hom_bfield, d);
+
+        // Reference: uninterrupted propagation
+        propagator_t::state ref_state(track, hom_bfield, d);
+        is_complete.push_back(p.propagate(ref_state));
+        path_lengths.push_back(ref_state._stepping._path_length);
+    }
+    const auto n_tracks{static_cast<unsigned int>(states.size())};
+
+    std::vector<unsigned int> indices(n_tracks);
+    std::vector<unsigned int> keys(n_tracks, 0u);
+    std::vector<char> is_alive(n_tracks, 0);
+    for (unsigned int i = 0u; i < n_tracks; ++i) {
+        indices[i] = i;
+        is_alive[i] = p.propagate_init(states[i]);
+    }
+
+    // Propagate the live tracks in rounds of a few steps and regroup them
+    unsigned int n_live{n_tracks};
+    unsigned int n_rounds{0u};
+    while (n_live > 0u) {
+        for (unsigned int j = 0u; j < n_live; ++j) {
+            const unsigned int i{indices[j]};
+            is_alive[i] = p.propagate_steps(states[i], {}, 5u);
+            keys[i] = propagation::regroup_key(states[i], 4u, 1.f);
+        }
+
+        const unsigned int n_next{
+            propagation::regroup_tracks(indices, n_live, is_alive, keys)};
+        ASSERT_LE(n_next, n_live);
+
+        // The live tracks are ordered by volume
+        for (unsigned int j = 1u; j < n_next; ++j) {
+            EXPECT_LE(keys[indices[j - 1u]], keys[indices[j]]);
+        }
+
+        n_live = n_next;
+        ++n_rounds;
+    }
+
+    EXPECT_TRUE(n_rounds > 1u);
+    for (unsigned int i = 0u; i < n_tracks; ++i) {
+        EXPECT_EQ(states[i]._navigation.is_complete(), is_complete[i]);
+        EXPECT_FLOAT_EQ(states[i]._stepping._path_length, path_lengths[i]);
+    }
+}
+
+/// Test the propagation in separate stages, as scheduled for a wavefront
+/// pipeline, against the propagation of single tracks
+GTEST_TEST(detray_propagator, propagator_stages) {
+
+    vecmem::host_memory_resource host_mr;
+    const auto [d, names] = build_toy_detector(host_mr);
+
+    using detector_t = decltype(d);
+    using intersection_t =
+        intersection2D<typename detector_t::surface_type, algebra_t>;
+    using navigator_t = navigator<detector_t, navigation::void_inspector,
+                                  intersection_t, 20u>;
+    using bfield_t = bfield::const_field_t;
+    using stepper_t = rk_stepper<bfield_t::view_t, algebra_t>;
+    using actor_chain_t = actor_chain<dtuple, pathlimit_aborter>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+
+    const vector3 B{0.f * unit<scalar_t>::T, 0.f * unit<scalar_t>::T,
+                    2.f * unit<scalar_t>::T};
+    const bfield_t hom_bfield = bfield::create_const_field(B);
+
+    using generator_t =
+        uniform_track_generator<free_track_parameters<algebra_t>>;
+    auto trk_gen_cfg = generator_t::configuration{};
+    trk_gen_cfg.phi_steps(10u).theta_steps(10u);
+    trk_gen_cfg.p_tot(1.f * unit<scalar_t>::GeV);
+
+    pathlimit_aborter::state aborter_state{};
+    aborter_state.set_path_limit(50.f * unit<scalar_t>::cm);
+
+    propagator_t p{};
+
+    std::vector<propagator_t::state> states;
+    std::vector<actor_chain_t::state_tuple> actor_states;
+    std::vector<bool> is_complete;
+    std::vector<scalar_t> path_lengths;
+    for (const auto track : generator_t{trk_gen_cfg}) {
+        states.emplace_back(track, hom_bfield, d);
+        actor_states.emplace_back(aborter_state);
+
+        // Reference: uninterrupted propagation
+        pathlimit_aborter::state ref_aborter_state{aborter_state};
+        propagator_t::state ref_state(track, hom_bfield, d);
+        is_complete.push_back(
+            p.propagate(ref_state, actor_chain_t::state{ref_aborter_state}));
+        path_lengths.push_back(ref_state._stepping._path_length);
+    }
+    const auto n_tracks{static_cast<unsigned int>(states.size())};
+
+    // Queue of the live tracks for every stage
+    std::vector<unsigned int> step_queue;
+    std::vector<unsigned int> nav_queue;
+    std::vector<unsigned int> actor_queue;
+    for (unsigned int i = 0u; i < n_tracks; ++i) {
+        if (p.propagate_init(states[i],
+                             actor_chain_t::make_state(actor_states[i]))) {
+            step_queue.push_back(i);
+        }
+    }
+
+    // Every stage runs over all tracks in its queue
+    while (!step_queue.empty()) {
+        nav_queue.clear();
+        for (const unsigned int i : step_queue) {
+            if (p.step_stage(states[i])) {
+                nav_queue.push_back(i);
+            }
+        }
+        actor_queue.clear();
+        for (const unsigned int i : nav_queue) {
+            if (p.navigation_stage(states[i])) {
+                actor_queue.push_back(i);
+            }
+        }
+        step_queue.clear();
+        for (const unsigned int i : actor_queue) {
+            if (p.actor_stage(states[i],
+                              actor_chain_t::make_state(actor_states[i]))) {
+                step_queue.push_back(i);
+            }
+        }
+    }
+
+    for (unsigned int i = 0u; i < n_tracks; ++i) {
+        EXPECT_EQ(states[i]._navigation.is_complete(), is_complete[i]);
+        EXPECT_FLOAT_EQ(states[i]._stepping._path_length, path_lengths[i]);
+    }
+}
+
+/// Test the timing of the propagation phases
+GTEST_TEST(detray_propagator, propagator_phase_timer) {
+
+    vecmem::host_memory_resource host_mr;
+    const auto [d, names] = build_toy_detector(host_mr);
+
+    using detector_t = decltype(d);
+    using navigator_t = navigator<detector_t>;
+    using bfield_t = bfield::const_field_t;
+    using stepper_t = rk_stepper<bfield_t::view_t, algebra_t>;
+    using actor_chain_t = actor_chain<dtuple, pathlimit_aborter>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+    using timed_propagator_t =
+        propagator<stepper_t, navigator_t, actor_chain_t,
+                   propagation::phase_timer>;
+
+    const vector3 B{0.f * unit<scalar_t>::T, 0.f * unit<scalar_t>::T,
+                    2.f * unit<scalar_t>::T};
+    const bfield_t hom_bfield = bfield::create_const_field(B);
+
+    using generator_t =
+        uniform_track_generator<free_track_parameters<algebra_t>>;
+    auto trk_gen_cfg = generator_t::configuration{};
+    trk_gen_cfg.phi_steps(10u).theta_steps(10u);
+    trk_gen_cfg.p_tot(1.f * unit<scalar_t>::GeV);
+
+    propagator_t p{};
+    timed_propagator_t timed_p{};
+
+    propagation::phase_timer total_timer{};
+    for (const auto track : generator_t{trk_gen_cfg}) {
+
+        pathlimit_aborter::state aborter_state{};
+        aborter_state.set_path_limit(50.f * unit<scalar_t>::cm);
+        pathlimit_aborter::state timed_aborter_state{aborter_state};
+
+        propagator_t::state state(track, hom_bfield, d);
+        timed_propagator_t::state timed_state(track, hom_bfield, d);
+
+        // The timing does not change the propagation
+        const bool is_complete{
+            p.propagate(state, actor_chain_t::state{aborter_state})};
+        EXPECT_EQ(timed_p.propagate(timed_state,
+                                    actor_chain_t::state{timed_aborter_state}),
+                  is_complete);
+        EXPECT_FLOAT_EQ(timed_state._stepping._path_length,
+                        state._stepping._path_length);
+
+        // Every step runs the navigation twice and the actors once, in
+        // addition to the initialization
+        const auto &timer = timed_state._timer;
+        const std::size_t n_steps{timer.calls(propagation::phase::e_stepping)};
+
+        EXPECT_TRUE(n_steps > 0u);
+        EXPECT_EQ(timer.calls(propagation::phase::e_navigation),
+                  2u * n_steps + 2u);
+        EXPECT_EQ(timer.calls(propagation::phase::e_actors), n_steps + 1u);
+        EXPECT_EQ(timer.total(),
+                  timer.ticks(propagation::phase::e_navigation) +
+                      timer.ticks(propagation::phase::e_stepping) +
+                      timer.ticks(propagation::phase::e_actors));
+
+        total_timer += timer;
+    }
+
+    EXPECT_TRUE(total_timer.ticks(propagation::phase::e_navigation) > 0u);
+    EXPECT_TRUE(total_timer.ticks(propagation::phase::e_stepping) > 0u);
+
+    total_timer.reset();
+    EXPECT_EQ(total_timer.total(), 0u);
+    EXPECT_EQ(total_timer.calls(propagation::phase::e_stepping), 0u);
+}
+
+/// Test the recording of the steps into preallocated slices
+GTEST_TEST(detray_propagator, step_recorder) {
+
+    vecmem::host_memory_resource host_mr;
+    const auto [d, names] = build_toy_detector(host_mr);
+
+    using detector_t = decltype(d);
+    using navigator_t = navigator<detector_t>;
+    using bfield_t = bfield::const_field_t;
+    using stepper_t = rk_stepper<bfield_t::view_t, algebra_t>;
+    using recorder_t = step_recorder<algebra_t>;
+    using actor_chain_t = actor_chain<dtuple, recorder_t, pathlimit_aborter>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+
+    const vector3 B{0.f * unit<scalar_t>::T, 0.f * unit<scalar_t>::T,
+                    2.f * unit<scalar_t>::T};
+    const bfield_t hom_bfield = bfield::create_const_field(B);
+
+    using generator_t =
+        uniform_track_generator<free_track_parameters<algebra_t>>;
+    auto trk_gen_cfg = generator_t::configuration{};
+    trk_gen_cfg.phi_steps(5u).theta_steps(5u);
+    trk_gen_cfg.p_tot(1.f * unit<scalar_t>::GeV);
+
+    const dindex n_tracks{25u};
+    const dindex small_capacity{5u};
+
+    // All steps, with Jacobians
+    recorder_t::collection_type steps(host_mr, n_tracks, 1000u, true);
+    // Only the surfaces, in a slice that is too small
+    recorder_t::collection_type surfaces(host_mr, n_tracks, small_capacity);
+
+    ASSERT_EQ(steps.size(), n_tracks);
+    ASSERT_EQ(steps.capacity(), 1000u);
+    ASSERT_TRUE(steps.has_jacobians());
+    ASSERT_EQ(surfaces.capacity(), small_capacity);
+    ASSERT_FALSE(surfaces.has_jacobians());
+
+    propagator_t p{};
+
+    dindex trk{0u};
+    for (const auto track : generator_t{trk_gen_cfg}) {
+
+        pathlimit_aborter::state aborter_state{};
+        aborter_state.set_path_limit(50.f * unit<scalar_t>::cm);
+        pathlimit_aborter::state sf_aborter_state{aborter_state};
+
+        recorder_t::state step_state{steps, trk};
+        recorder_t::state sf_state{surfaces, trk,
+                                   step_record_mode::e_surfaces};
+
+        propagator_t::state state(track, hom_bfield, d);
+        propagator_t::state sf_prop_state(track, hom_bfield, d);
+
+        p.propagate(state, detray::tie(step_state, aborter_state));
+        p.propagate(sf_prop_state, detray::tie(sf_state, sf_aborter_state));
+
+        // Every step fits into the large slice
+        const unsigned int n_steps{step_state.n_records()};
+        ASSERT_TRUE(n_steps > 0u);
+        EXPECT_EQ(step_state.n_overflow(), 0u);
+
+        unsigned int n_sf_steps{0u};
+        for (unsigned int i = 0u; i < n_steps; ++i) {
+            if (i > 0u) {
+                EXPECT_TRUE(steps.path_length(trk, i) >
+                            steps.path_length(trk, i - 1u));
+            }
+            EXPECT_NEAR(getter::norm(steps.dir(trk, i)), 1.f, tol);
+            n_sf_steps += steps.barcode(trk, i).is_invalid() ? 0u : 1u;
+        }
+        EXPECT_FLOAT_EQ(steps.path_length(trk, n_steps - 1u),
+                        state._stepping.path_length());
+        EXPECT_NEAR(getter::norm(steps.pos(trk, n_steps - 1u) -
+                                 state._stepping().pos()),
+                    0.f, tol);
+
+        // The surface records are a subset of the step records and the
+        // steps that did not fit are counted
+        const unsigned int n_sf{sf_state.n_records()};
+        EXPECT_EQ(n_sf + sf_state.n_overflow(), n_sf_steps);
+        EXPECT_EQ(n_sf, std::min(n_sf_steps, small_capacity));
+        for (unsigned int i = 0u; i < n_sf; ++i) {
+            EXPECT_FALSE(surfaces.barcode(trk, i).is_invalid());
+        }
+
+        ++trk;
+    }
+    EXPECT_EQ(trk, n_tracks);
+}
+
+/// Check that the portal look-ahead finds the same surfaces on helical
+/// trajectories, where the prefetch along the tangent at the portal can be
+/// in different search bins than the actual crossing
+GTEST_TEST(detray_propagator, portal_lookahead_const_bfield) {
+
+    vecmem::host_memory_resource host_mr;
+    const auto [d, names] = build_toy_detector(host_mr);
+
+    using detector_t = decltype(d);
+    using intersection_t =
+        intersection2D<typename detector_t::surface_type, algebra_t>;
+    using navigator_t = navigator<detector_t>;
+    using lookahead_navigator_t =
+        navigator<detector_t, navigation::void_inspector, intersection_t, 0u,
+                  navigation::all_features>;
+    using bfield_t = bfield::const_field_t;
+    using stepper_t = rk_stepper<bfield_t::view_t, algebra_t>;
+    using recorder_t = step_recorder<algebra_t>;
+    using actor_chain_t = actor_chain<dtuple, recorder_t>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+    using lookahead_propagator_t =
+        propagator<stepper_t, lookahead_navigator_t, actor_chain_t>;
+
+    const vector3 B{0.f * unit<scalar_t>::T, 0.f * unit<scalar_t>::T,
+                    2.f * unit<scalar_t>::T};
+    const bfield_t hom_bfield = bfield::create_const_field(B);
+
+    // Low momentum: The tracks curl strongly between the portals
+    using generator_t =
+        uniform_track_generator<free_track_parameters<algebra_t>>;
+    auto trk_gen_cfg = generator_t::configuration{};
+    trk_gen_cfg.phi_steps(10u).theta_steps(10u);
+    trk_gen_cfg.p_tot(0.5f * unit<scalar_t>::GeV);
+
+    const dindex n_tracks{100u};
+    recorder_t::collection_type ref_surfaces(host_mr, n_tracks, 1000u);
+    recorder_t::collection_type surfaces(host_mr, n_tracks, 1000u);
+
+    propagation::config<scalar_t> ref_cfg{};
+    ref_cfg.navigation.search_window = {3u, 3u};
+    propagation::config<scalar_t> cfg{ref_cfg};
+    cfg.navigation.portal_lookahead = true;
+
+    propagator_t ref_p{ref_cfg};
+    lookahead_propagator_t p{cfg};
+
+    dindex trk{0u};
+    for (const auto track : generator_t{trk_gen_cfg}) {
+
+        recorder_t::state ref_state{ref_surfaces, trk,
+                                    step_record_mode::e_surfaces};
+        recorder_t::state sf_state{surfaces, trk,
+                                   step_record_mode::e_surfaces};
+
+        propagator_t::state ref_prop_state(track, hom_bfield, d);
+        lookahead_propagator_t::state prop_state(track, hom_bfield, d);
+
+        const bool ref_success{
+            ref_p.propagate(ref_prop_state, detray::tie(ref_state))};
+        ASSERT_EQ(ref_success, p.propagate(prop_state, detray::tie(sf_state)));
+
+        // Same surfaces in the same order
+        const unsigned int n_sf{ref_state.n_records()};
+        ASSERT_TRUE(n_sf > 0u);
+        ASSERT_EQ(n_sf, sf_state.n_records()) << "track " << trk;
+        for (unsigned int i = 0u; i < n_sf; ++i) {
+            ASSERT_EQ(ref_surfaces.barcode(trk, i), surfaces.barcode(trk, i))
+                << "track " << trk << ", surface " << i;
+        }
+
+        ++trk;
+    }
+    EXPECT_EQ(trk, n_tracks);
+}
+
+/// Check that the adaptive mask tolerance only widens the tolerance on
+/// helical trajectories: Every surface that is found with the fixed tolerance
+/// is also found with the adaptive one, in the same order
+GTEST_TEST(detray_propagator, adaptive_mask_tolerance_const_bfield) {
+
+    vecmem::host_memory_resource host_mr;
+    const auto [d, names] = build_toy_detector(host_mr);
+
+    using detector_t = decltype(d);
+    using navigator_t = navigator<detector_t>;
+    using bfield_t = bfield::const_field_t;
+    using stepper_t = rk_stepper<bfield_t::view_t, algebra_t>;
+    using recorder_t = step_recorder<algebra_t>;
+    using actor_chain_t = actor_chain<dtuple, recorder_t>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+
+    const vector3 B{0.f * unit<scalar_t>::T, 0.f * unit<scalar_t>::T,
+                    2.f * unit<scalar_t>::T};
+    const bfield_t hom_bfield = bfield::create_const_field(B);
+
+    // Low momentum: Large sagitta over the steps between the surfaces
+    using generator_t =
+        uniform_track_generator<free_track_parameters<algebra_t>>;
+    auto trk_gen_cfg = generator_t::configuration{};
+    trk_gen_cfg.phi_steps(10u).theta_steps(10u);
+    trk_gen_cfg.p_tot(0.5f * unit<scalar_t>::GeV);
+
+    const dindex n_tracks{100u};
+    recorder_t::collection_type ref_surfaces(host_mr, n_tracks, 1000u);
+    recorder_t::collection_type surfaces(host_mr, n_tracks, 1000u);
+
+    propagation::config<scalar_t> ref_cfg{};
+    ref_cfg.navigation.search_window = {3u, 3u};
+    propagation::config<scalar_t> cfg{ref_cfg};
+    cfg.navigation.adaptive_mask_tolerance = true;
+
+    propagator_t ref_p{ref_cfg};
+    propagator_t p{cfg};
+
+    dindex trk{0u};
+    for (const auto track : generator_t{trk_gen_cfg}) {
+
+        recorder_t::state ref_state{ref_surfaces, trk,
+                                    step_record_mode::e_surfaces};
+        recorder_t::state sf_state{surfaces, trk,
+                                   step_record_mode::e_surfaces};
+
+        propagator_t::state ref_prop_state(track, hom_bfield, d);
+        propagator_t::state prop_state(track, hom_bfield, d);
+
+        // The first initialization happens before the first RK step
+        const bool success{p.propagate(prop_state, detray::tie(sf_state))};
+        if (not ref_p.propagate(ref_prop_state, detray::tie(ref_state))) {
+            ++trk;
+            continue;
+        }
+        ASSERT_TRUE(success) << "track " << trk;
+
+        // The reference surfaces are a subsequence of the adaptive ones
+        const unsigned int n_sf{sf_state.n_records()};
+        unsigned int j{0u};
+        for (unsigned int i = 0u; i < ref_state.n_records(); ++i) {
+            while (j < n_sf and
+                   surfaces.barcode(trk, j) != ref_surfaces.barcode(trk, i)) {
+                ++j;
+            }
+            ASSERT_TRUE(j < n_sf) << "track " << trk << ", surface " << i;
+            ++j;
+        }
+
+        ++trk;
+    }
+    EXPECT_EQ(trk, n_tracks);
+}
+
+/// Test the recorded batch propagation and the compaction of the records
+GTEST_TEST(detray_propagator, step_recorder_batch) {
+
+    vecmem::host_memory_resource host_mr;
+    const auto [d, names] = build_toy_detector(host_mr);
+
+    using detector_t = decltype(d);
+    using navigator_t = navigator<detector_t>;
+    using bfield_t = bfield::const_field_t;
+    using stepper_t = rk_stepper<bfield_t::view_t, algebra_t>;
+    using recorder_t = step_recorder<algebra_t>;
+    using actor_chain_t = actor_chain<dtuple, recorder_t, pathlimit_aborter>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+    using result_t = propagation::result<algebra_t>;
+
+    const vector3 B{0.f * unit<scalar_t>::T, 0.f * unit<scalar_t>::T,
+                    2.f * unit<scalar_t>::T};
+    const bfield_t hom_bfield = bfield::create_const_field(B);
+
+    using generator_t =
+        uniform_track_generator<free_track_parameters<algebra_t>>;
+    auto trk_gen_cfg = generator_t::configuration{};
+    trk_gen_cfg.phi_steps(5u).theta_steps(5u);
+    trk_gen_cfg.p_tot(1.f * unit<scalar_t>::GeV);
+
+    vecmem::vector<free_track_parameters<algebra_t>> tracks(&host_mr);
+    for (const auto track : generator_t{trk_gen_cfg}) {
+        tracks.push_back(track);
+    }
+    const auto n_tracks{static_cast<dindex>(tracks.size())};
+
+    pathlimit_aborter::state aborter_state{};
+    aborter_state.set_path_limit(50.f * unit<scalar_t>::cm);
+
+    propagator_t p{};
+
+    // Only the sensitive surfaces, bound to the tracks by the batch
+    recorder_t::collection_type records(host_mr, n_tracks, 100u);
+    const actor_chain_t::state_tuple actor_states{
+        recorder_t::state{step_record_mode::e_sensitives}, aborter_state};
+
+    vecmem::vector<result_t> results(tracks.size(), &host_mr);
+    p.propagate_batch_recorded(tracks, results, records,
+                               propagation::sequential_executor{},
+                               actor_states, hom_bfield, d);
+
+    // Reference: Every surface of the single track propagation
+    recorder_t::collection_type ref_records(host_mr, n_tracks, 100u);
+    unsigned int n_total{0u};
+    for (dindex trk = 0u; trk < n_tracks; ++trk) {
+        pathlimit_aborter::state ref_aborter_state{aborter_state};
+        recorder_t::state ref_state{ref_records, trk,
+                                    step_record_mode::e_surfaces};
+
+        propagator_t::state state(tracks[trk], hom_bfield, d);
+        p.propagate(state, detray::tie(ref_state, ref_aborter_state));
+
+        EXPECT_FLOAT_EQ(results[trk].path_length,
+                        state._stepping.path_length());
+        EXPECT_EQ(records.n_overflow(trk), 0u);
+
+        // The sensitive records are the sensitive surfaces of the reference
+        unsigned int n_sens{0u};
+        for (unsigned int i = 0u; i < ref_state.n_records(); ++i) {
+            const auto bcd = ref_records.barcode(trk, i);
+            if (bcd.id() != surface_id::e_sensitive) {
+                continue;
+            }
+            ASSERT_LT(n_sens, records.n_records(trk));
+            EXPECT_EQ(records.barcode(trk, n_sens), bcd);
+            EXPECT_FLOAT_EQ(records.path_length(trk, n_sens),
+                            ref_records.path_length(trk, i));
+            ++n_sens;
+        }
+        EXPECT_EQ(records.n_records(trk), n_sens);
+        n_total += n_sens;
+    }
+    ASSERT_TRUE(n_total > 0u);
+
+    // The compact records hold exactly the recorded steps
+    const auto compact = compact_step_records(records, host_mr);
+    ASSERT_EQ(compact.size(), n_tracks);
+    EXPECT_EQ(compact.capacity(), n_total);
+    EXPECT_EQ(compact.n_records(), n_total);
+    EXPECT_EQ(compact.n_dropped(), 0u);
+    for (dindex trk = 0u; trk < n_tracks; ++trk) {
+        ASSERT_EQ(compact.n_records(trk), records.n_records(trk));
+        for (unsigned int i = 0u; i < compact.n_records(trk); ++i) {
+            EXPECT_EQ(compact.barcode(trk, i), records.barcode(trk, i));
+            EXPECT_FLOAT_EQ(compact.path_length(trk, i),
+                            records.path_length(trk, i));
+            EXPECT_NEAR(
+                getter::norm(compact.pos(trk, i) - records.pos(trk, i)), 0.f,
+                tol);
+        }
+    }
+
+    // A buffer that is too small drops the records at the end
+    compact_step_record_collection<algebra_t> small(host_mr, n_tracks,
+                                                    n_total / 2u);
+    auto &offsets = small.offsets();
+    for (dindex trk = 0u; trk < n_tracks; ++trk) {
+        offsets[trk + 1u] = offsets[trk] + records.n_records(trk);
+    }
+    for (dindex trk = 0u; trk < n_tracks; ++trk) {
+        small.gather(records, trk);
+    }
+    EXPECT_EQ(small.n_records(), n_total / 2u);
+    EXPECT_EQ(small.n_dropped(), n_total - n_total / 2u);
+}
+
 /// Fixture for Runge-Kutta Propagation
 class PropagatorWithRkStepper
     : public ::testing::TestWithParam<
@@ -202,7 +1166,9 @@ TEST_P(PropagatorWithRkStepper, rk4_propagator_const_bfield) {
                     parameter_transporter<algebra_t>,
                     pointwise_material_interactor<algebra_t>,
                     parameter_resetter<algebra_t>>;
-    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+    using propagator_t =
+        propagator<stepper_t, navigator_t, actor_chain_t,
+                   propagation::void_timer, propagation::print_inspector>;
 
     // Build detector
     toy_cfg.use_material_maps(false);
@@ -254,16 +1220,14 @@ TEST_P(PropagatorWithRkStepper, rk4_propagator_const_bfield) {
             .template set_constraint<step::constraint::e_accuracy>(step_constr);
 
         // Propagate the entire detector
-        state.do_debug = true;
         ASSERT_TRUE(p.propagate(state, actor_states))
-            << state.debug_stream.str() << std::endl;
+            << state._inspector.to_string() << std::endl;
         //  << state._navigation.inspector().to_string() << std::endl;
 
         // Propagate with path limit
         ASSERT_NEAR(pathlimit_aborter_state.path_limit(), path_limit, tol);
-        lim_state.do_debug = true;
         ASSERT_FALSE(p.propagate(lim_state, lim_actor_states))
-            << lim_state.debug_stream.str() << std::endl;
+            << lim_state._inspector.to_string() << std::endl;
         //<< lim_state._navigation.inspector().to_string() << std::endl;
 
         ASSERT_GE(std::abs(path_limit), lim_state._stepping._abs_path_length)
@@ -304,7 +1268,9 @@ TEST_P(PropagatorWithRkStepper, rk4_propagator_inhom_bfield) {
         actor_chain<dtuple, pathlimit_aborter, parameter_transporter<algebra_t>,
                     pointwise_material_interactor<algebra_t>,
                     parameter_resetter<algebra_t>>;
-    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+    using propagator_t =
+        propagator<stepper_t, navigator_t, actor_chain_t,
+                   propagation::void_timer, propagation::print_inspector>;
 
     // Build detector and magnetic field
     toy_cfg.use_material_maps(false);
@@ -346,16 +1312,14 @@ TEST_P(PropagatorWithRkStepper, rk4_propagator_inhom_bfield) {
             .template set_constraint<step::constraint::e_accuracy>(step_constr);
 
         // Propagate the entire detector
-        state.do_debug = true;
         ASSERT_TRUE(p.propagate(state, actor_states))
-            << state.debug_stream.str() << std::endl;
+            << state._inspector.to_string() << std::endl;
         //<< state._navigation.inspector().to_string() << std::endl;
 
         // Propagate with path limit
         ASSERT_NEAR(pathlimit_aborter_state.path_limit(), path_limit, tol);
-        lim_state.do_debug = true;
         ASSERT_FALSE(p.propagate(lim_state, lim_actor_states))
-            << lim_state.debug_stream.str() << std::endl;
+            << lim_state._inspector.to_string() << std::endl;
         //<< lim_state._navigation.inspector().to_string() << std::endl;
 
         ASSERT_TRUE(lim_state._stepping.path_length() <
@@ -366,6 +1330,64 @@ TEST_P(PropagatorWithRkStepper, rk4_propagator_inhom_bfield) {
     }
 }
 
+/// Test that the curvature-aware navigation policy finds the same surfaces as
+/// the default Runge-Kutta policy
+TEST_P(PropagatorWithRkStepper, rk4_propagator_curvature_policy) {
+
+    // Constant magnetic field type
+    using bfield_t = bfield::const_field_t;
+
+    // Toy detector
+    using detector_t = detector<toy_metadata>;
+
+    // Runge-Kutta propagation with the reference and the curvature policy
+    using navigator_t = navigator<detector_t>;
+    using constraints_t = constrained_step<>;
+    using ref_stepper_t = rk_stepper<bfield_t::view_t, algebra_t,
+                                     constraints_t, stepper_rk_policy>;
+    using stepper_t =
+        rk_stepper<bfield_t::view_t, algebra_t, constraints_t,
+                   stepper_curvature_policy<algebra_t>>;
+    using actor_chain_t = actor_chain<dtuple, surface_recorder>;
+    using ref_propagator_t =
+        propagator<ref_stepper_t, navigator_t, actor_chain_t>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+
+    // Build detector
+    toy_cfg.use_material_maps(false);
+    const auto [det, names] = build_toy_detector(host_mr, toy_cfg);
+
+    const bfield_t bfield = bfield::create_const_field(std::get<2>(GetParam()));
+
+    propagation::config<scalar_t> cfg{};
+    cfg.navigation.overstep_tolerance = overstep_tol;
+    ref_propagator_t ref_p{cfg};
+    propagator_t p{cfg};
+
+    // Iterate through uniformly distributed momentum directions
+    for (auto track : generator_t{trk_gen_cfg}) {
+
+        surface_recorder::state ref_recorder{};
+        surface_recorder::state recorder{};
+        auto ref_actor_states = std::tie(ref_recorder);
+        auto actor_states = std::tie(recorder);
+
+        ref_propagator_t::state ref_state(track, bfield, det);
+        propagator_t::state state(track, bfield, det);
+
+        ref_state._stepping
+            .template set_constraint<step::constraint::e_accuracy>(step_constr);
+        state._stepping.template set_constraint<step::constraint::e_accuracy>(
+            step_constr);
+
+        ASSERT_TRUE(ref_p.propagate(ref_state, ref_actor_states));
+        ASSERT_TRUE(p.propagate(state, actor_states));
+
+        ASSERT_FALSE(recorder._barcodes.empty());
+        ASSERT_EQ(ref_recorder._barcodes, recorder._barcodes);
+    }
+}
+
 // No step size constraint
 INSTANTIATE_TEST_SUITE_P(
     detray_propagator_validation1, PropagatorWithRkStepper,
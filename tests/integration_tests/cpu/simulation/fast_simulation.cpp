@@ -0,0 +1,173 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/build_telescope_detector.hpp"
+#include "detray/materials/predefined_materials.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/line_stepper.hpp"
+#include "detray/propagator/parallel_executor.hpp"
+#include "detray/propagator/propagation_batch.hpp"
+#include "detray/simulation/fast_simulator.hpp"
+#include "detray/simulation/hit_collection.hpp"
+#include "detray/test/types.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <algorithm>
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+using algebra_t = test::algebra;
+using scalar_t = test::scalar;
+
+/// Number of telescope planes
+constexpr unsigned int n_planes{10u};
+
+/// Compare all hits of the collections @param a and @param b
+template <typename collection_t>
+void compare_hits(const collection_t &a, const collection_t &b,
+                  const bool expect_equal) {
+
+    ASSERT_EQ(a.n_tracks(), b.n_tracks());
+
+    bool all_equal{true};
+    for (unsigned int trk = 0u; trk < a.n_tracks(); ++trk) {
+        if (a.n_hits(trk) != b.n_hits(trk)) {
+            all_equal = false;
+            continue;
+        }
+        for (unsigned int i = 0u; i < a.size(trk); ++i) {
+            const auto hit_a = a.at(trk, i);
+            const auto hit_b = b.at(trk, i);
+            all_equal &= (hit_a.barcode == hit_b.barcode) &&
+                         (hit_a.local[0] == hit_b.local[0]) &&
+                         (hit_a.local[1] == hit_b.local[1]) &&
+                         (hit_a.time == hit_b.time) &&
+                         (hit_a.energy_deposit == hit_b.energy_deposit);
+        }
+    }
+
+    EXPECT_EQ(all_equal, expect_equal);
+}
+
+}  // anonymous namespace
+
+// Fast simulation of a track batch in a silicon telescope
+GTEST_TEST(detray_simulation, fast_simulation) {
+
+    vecmem::host_memory_resource host_mr;
+
+    // Build in x-direction from given module positions
+    detail::ray<algebra_t> traj{{0.f, 0.f, 0.f}, 0.f, {1.f, 0.f, 0.f}, -1.f};
+    std::vector<scalar_t> positions;
+    for (unsigned int i = 1u; i <= n_planes; ++i) {
+        positions.push_back(static_cast<scalar_t>(i) * 50.f *
+                            unit<scalar_t>::mm);
+    }
+
+    tel_det_config<rectangle2D> tel_cfg{1.f * unit<scalar_t>::m,
+                                        1.f * unit<scalar_t>::m};
+    tel_cfg.positions(positions)
+        .pilot_track(traj)
+        .module_material(silicon_tml<scalar_t>())
+        .mat_thickness(0.5f * unit<scalar_t>::mm);
+
+    const auto [det, names] = build_telescope_detector(host_mr, tel_cfg);
+
+    using detector_t = decltype(det);
+    using simulator_t =
+        fast_simulator<line_stepper<algebra_t>, navigator<detector_t>>;
+
+    // All tracks start with the same parameters: Only the random numbers
+    // differ between them
+    constexpr unsigned int n_tracks{500u};
+    constexpr scalar_t p{1.f * unit<scalar_t>::GeV};
+    vecmem::vector<free_track_parameters<algebra_t>> tracks(&host_mr);
+    for (unsigned int i = 0u; i < n_tracks; ++i) {
+        tracks.push_back({{0.f, 0.f, 0.f}, 0.f, {p, 0.f, 0.f}, -1.f});
+    }
+
+    simulator_t::config cfg{};
+    cfg.event = 42u;
+    const simulator_t simulator{cfg};
+
+    // Simulate on a single thread
+    hit_collection<algebra_t> seq_hits(host_mr, n_tracks, 2u * n_planes);
+    simulator.simulate(tracks, detray::get_data(seq_hits),
+                       propagation::sequential_executor{}, det);
+
+    const scalar_t e0{math::sqrt(p * p + cfg.mass * cfg.mass)};
+    std::vector<scalar_t> deposits;
+    for (unsigned int trk = 0u; trk < n_tracks; ++trk) {
+        // One hit per plane
+        ASSERT_EQ(seq_hits.n_hits(trk), n_planes);
+        EXPECT_FALSE(seq_hits.overflow(trk));
+
+        scalar_t last_time{0.f};
+        for (unsigned int i = 0u; i < seq_hits.size(trk); ++i) {
+            const auto h = seq_hits.at(trk, i);
+
+            EXPECT_EQ(h.barcode.id(), surface_id::e_sensitive);
+            // Planes are 50 mm apart and the muon is almost as fast as light
+            EXPECT_GT(h.time, last_time + 50.f * unit<scalar_t>::mm);
+            EXPECT_LT(h.time, last_time + 51.f * unit<scalar_t>::mm);
+            EXPECT_GT(h.energy_deposit, 0.f);
+            EXPECT_LT(h.energy_deposit, e0);
+
+            last_time = h.time;
+            deposits.push_back(h.energy_deposit);
+        }
+    }
+
+    // The most probable energy loss of a MIP in 0.5 mm of silicon is about
+    // 140 keV (the median is slightly larger due to the Landau tail)
+    auto median = deposits.begin() + deposits.size() / 2u;
+    std::nth_element(deposits.begin(), median, deposits.end());
+    EXPECT_GT(*median, 0.1f * unit<scalar_t>::MeV);
+    EXPECT_LT(*median, 0.3f * unit<scalar_t>::MeV);
+
+    // The hits do not depend on how the tracks are distributed over threads
+    propagation::parallel_executor par_exec{};
+    par_exec.n_threads = 4u;
+    par_exec.chunk_size = 7u;
+
+    hit_collection<algebra_t> par_hits(host_mr, n_tracks, 2u * n_planes);
+    simulator.simulate(tracks, detray::get_data(par_hits), par_exec, det);
+
+    compare_hits(seq_hits, par_hits, true);
+
+    // Other events give different hits
+    cfg.event = 43u;
+    hit_collection<algebra_t> other_hits(host_mr, n_tracks, 2u * n_planes);
+    simulator_t{cfg}.simulate(tracks, detray::get_data(other_hits),
+                              propagation::sequential_executor{}, det);
+
+    compare_hits(seq_hits, other_hits, false);
+
+    // Too few hit slots: The surplus hits are counted, but dropped
+    hit_collection<algebra_t> small_hits(host_mr, n_tracks, n_planes / 2u);
+    simulator.simulate(tracks, detray::get_data(small_hits),
+                       propagation::sequential_executor{}, det);
+
+    for (unsigned int trk = 0u; trk < n_tracks; ++trk) {
+        EXPECT_TRUE(small_hits.overflow(trk));
+        EXPECT_EQ(small_hits.size(trk), n_planes / 2u);
+        EXPECT_EQ(small_hits.at(trk, 0u).time, seq_hits.at(trk, 0u).time);
+    }
+}
@@ -0,0 +1,140 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detector_scan_cuda_kernel.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/build_toy_detector.hpp"
+#include "detray/test/detail/register_checks.hpp"
+#include "detray/test/detector_helix_scan.hpp"
+#include "detray/test/detector_ray_scan.hpp"
+#include "detray/test/utils/particle_gun.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/data/jagged_vector_buffer.hpp>
+#include <vecmem/containers/jagged_vector.hpp>
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/cuda/device_memory_resource.hpp>
+#include <vecmem/memory/cuda/managed_memory_resource.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+#include <vecmem/utils/cuda/copy.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <cstddef>
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+/// Capacity of the intersection record of a trajectory
+constexpr std::size_t max_intersections{100u};
+
+/// Number of trajectories that are scanned on the device at once
+constexpr std::size_t batch_size{8192u};
+
+using intersection_record_t =
+    typename ray_scan<detector_host_t>::intersection_record_t;
+
+// VecMem memory resource(s) and copy object
+vecmem::host_memory_resource host_mr;
+vecmem::cuda::managed_memory_resource mng_mr;
+vecmem::cuda::device_memory_resource dev_mr;
+vecmem::cuda::copy cuda_cpy;
+
+/// Record the intersections of the @param trajectories on the device with
+/// the scan function @param scan
+template <typename trajectory_t, typename scan_t>
+std::vector<intersection_record_t> record_on_device(
+    const std::vector<trajectory_t> &trajectories, scan_t &&scan) {
+
+    const vecmem::vector<trajectory_t> traj_device(
+        trajectories.begin(), trajectories.end(), &mng_mr);
+    const std::size_t n_trajectories{traj_device.size()};
+
+    // Preallocated intersection records and their fill levels
+    vecmem::data::jagged_vector_buffer<intersection_t> intersections_buffer(
+        std::vector<std::size_t>(n_trajectories, max_intersections), dev_mr,
+        &mng_mr);
+    cuda_cpy.setup(intersections_buffer);
+
+    vecmem::vector<unsigned int> n_intersections(n_trajectories, 0u, &mng_mr);
+
+    scan(vecmem::get_data(traj_device), intersections_buffer,
+         vecmem::get_data(n_intersections));
+
+    vecmem::jagged_vector<intersection_t> intersections(&host_mr);
+    cuda_cpy(intersections_buffer, intersections);
+
+    // Sort the intersections and check the record capacity on the host
+    std::vector<intersection_record_t> records;
+    records.reserve(n_trajectories);
+    for (std::size_t i = 0u; i < n_trajectories; ++i) {
+        records.push_back(
+            particle_gun::to_record(intersections[i], n_intersections[i]));
+    }
+
+    return records;
+}
+
+}  // anonymous namespace
+
+int main(int argc, char **argv) {
+
+    // Filter out the google test flags
+    ::testing::InitGoogleTest(&argc, argv);
+
+    //
+    // Toy detector configuration
+    //
+    toy_det_config<scalar_t> toy_cfg{};
+    toy_cfg.n_brl_layers(4u).n_edc_layers(7u);
+
+    // Build the geometry in memory that is accessible from the device
+    auto [toy_det, toy_names] = build_toy_detector(mng_mr, toy_cfg);
+    auto det_data = detray::get_data(toy_det);
+
+    // Navigation link consistency, discovered by ray intersection on the
+    // device
+    ray_scan<detector_host_t>::config cfg_ray_scan{};
+    cfg_ray_scan.name("toy_detector_ray_scan_cuda");
+    cfg_ray_scan.track_generator().theta_steps(100u).phi_steps(100u);
+    cfg_ray_scan.batch_size(batch_size);
+    cfg_ray_scan.intersection_recorder([&](const std::vector<ray_t> &rays) {
+        return record_on_device(rays, [&](auto rays_data, auto &is_data,
+                                          auto n_is_data) {
+            ray_scan_cuda(det_data, rays_data, is_data, n_is_data);
+        });
+    });
+
+    detail::register_checks<ray_scan>(toy_det, toy_names, cfg_ray_scan);
+
+    // Navigation link consistency, discovered by helix intersection on the
+    // device
+    helix_scan<detector_host_t>::config cfg_hel_scan{};
+    cfg_hel_scan.name("toy_detector_helix_scan_cuda");
+    cfg_hel_scan.track_generator().p_tot(10.f * unit<scalar_t>::GeV);
+    cfg_hel_scan.track_generator().theta_steps(100u).phi_steps(100u);
+    cfg_hel_scan.batch_size(batch_size);
+    cfg_hel_scan.intersection_recorder(
+        [&](const std::vector<track_t> &tracks, const vector3_t &B) {
+            return record_on_device(tracks, [&](auto tracks_data,
+                                                auto &is_data,
+                                                auto n_is_data) {
+                helix_scan_cuda(det_data, tracks_data, B,
+                                14.9f * unit<scalar_t>::um, is_data,
+                                n_is_data);
+            });
+        });
+
+    detail::register_checks<helix_scan>(toy_det, toy_names, cfg_hel_scan);
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,115 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detector_scan_cuda_kernel.hpp"
+#include "detray/definitions/detail/cuda_definitions.hpp"
+#include "detray/navigation/detail/helix.hpp"
+#include "detray/test/utils/particle_gun.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/device_vector.hpp>
+#include <vecmem/containers/jagged_device_vector.hpp>
+
+namespace detray {
+
+namespace {
+
+/// Number of threads per block
+constexpr unsigned int block_dim{64u};
+
+}  // anonymous namespace
+
+__global__ void ray_scan_kernel(
+    typename detector_host_t::view_type det_data,
+    vecmem::data::vector_view<const ray_t> rays_data,
+    vecmem::data::jagged_vector_view<intersection_t> intersections_data,
+    vecmem::data::vector_view<unsigned int> n_intersections_data) {
+
+    const unsigned int gid{threadIdx.x + blockIdx.x * blockDim.x};
+
+    vecmem::device_vector<const ray_t> rays(rays_data);
+    if (gid >= rays.size()) {
+        return;
+    }
+
+    detector_device_t det(det_data);
+    vecmem::jagged_device_vector<intersection_t> intersections(
+        intersections_data);
+    vecmem::device_vector<unsigned int> n_intersections(n_intersections_data);
+
+    auto ray_intersections = intersections.at(gid);
+    n_intersections[gid] =
+        particle_gun::record_intersections(det, rays[gid], ray_intersections);
+}
+
+void ray_scan_cuda(
+    typename detector_host_t::view_type det_data,
+    vecmem::data::vector_view<const ray_t> rays_data,
+    vecmem::data::jagged_vector_view<intersection_t> intersections_data,
+    vecmem::data::vector_view<unsigned int> n_intersections_data) {
+
+    const unsigned int n_blocks{(rays_data.size() + block_dim - 1u) /
+                                block_dim};
+
+    ray_scan_kernel<<<n_blocks, block_dim>>>(
+        det_data, rays_data, intersections_data, n_intersections_data);
+
+    // cuda error check
+    DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
+    DETRAY_CUDA_ERROR_CHECK(cudaDeviceSynchronize());
+}
+
+__global__ void helix_scan_kernel(
+    typename detector_host_t::view_type det_data,
+    vecmem::data::vector_view<const track_t> tracks_data, const vector3_t B,
+    const scalar_t mask_tolerance,
+    vecmem::data::jagged_vector_view<intersection_t> intersections_data,
+    vecmem::data::vector_view<unsigned int> n_intersections_data) {
+
+    const unsigned int gid{threadIdx.x + blockIdx.x * blockDim.x};
+
+    vecmem::device_vector<const track_t> tracks(tracks_data);
+    if (gid >= tracks.size()) {
+        return;
+    }
+
+    detector_device_t det(det_data);
+    vecmem::jagged_device_vector<intersection_t> intersections(
+        intersections_data);
+    vecmem::device_vector<unsigned int> n_intersections(n_intersections_data);
+
+    // Ground truth helix of the track
+    const vector3_t b_field{B};
+    const detail::helix<algebra_t> helix(tracks[gid], &b_field);
+
+    auto helix_intersections = intersections.at(gid);
+    n_intersections[gid] = particle_gun::record_intersections(
+        det, helix, helix_intersections, mask_tolerance);
+}
+
+void helix_scan_cuda(
+    typename detector_host_t::view_type det_data,
+    vecmem::data::vector_view<const track_t> tracks_data, const vector3_t B,
+    const scalar_t mask_tolerance,
+    vecmem::data::jagged_vector_view<intersection_t> intersections_data,
+    vecmem::data::vector_view<unsigned int> n_intersections_data) {
+
+    const unsigned int n_blocks{(tracks_data.size() + block_dim - 1u) /
+                                block_dim};
+
+    helix_scan_kernel<<<n_blocks, block_dim>>>(det_data, tracks_data, B,
+                                               mask_tolerance,
+                                               intersections_data,
+                                               n_intersections_data);
+
+    // cuda error check
+    DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
+    DETRAY_CUDA_ERROR_CHECK(cudaDeviceSynchronize());
+}
+
+}  // namespace detray
@@ -0,0 +1,125 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/definitions/detail/cuda_definitions.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/detectors/build_toy_detector.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/simulation/cuda/simulate_batch.hpp"
+#include "detray/simulation/event_generator/track_generators.hpp"
+#include "detray/simulation/fast_simulator.hpp"
+#include "detray/simulation/hit_collection.hpp"
+#include "detray/test/types.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/cuda/managed_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+using namespace detray;
+
+namespace {
+
+using algebra_t = test::algebra;
+using scalar_t = test::scalar;
+
+/// Absolute tolerance on the local positions and relative tolerance on the
+/// time and the deposited energy
+constexpr scalar_t pos_tol{1e-2f * unit<scalar_t>::mm};
+constexpr scalar_t rel_tol{1e-3f};
+
+using bfield_t = bfield::const_field_t;
+using stepper_t = rk_stepper<bfield_t::view_t, algebra_t>;
+
+/// Simulator on the host or device detector type @tparam detector_t
+template <typename detector_t>
+using simulator_t = fast_simulator<
+    stepper_t,
+    navigator<detector_t, navigation::void_inspector,
+              intersection2D<typename detector_t::surface_type, algebra_t>,
+              20u>>;
+
+}  // anonymous namespace
+
+/// Compare the fast simulation on the device with the host
+TEST(detray_cuda_simulation, simulate_batch) {
+
+    vecmem::cuda::managed_memory_resource mng_mr;
+
+    auto [det, names] = build_toy_detector(mng_mr);
+
+    using host_detector_t = decltype(det);
+    using device_detector_t =
+        detector<typename host_detector_t::metadata, device_container_types>;
+
+    const bfield_t field = bfield::create_const_field(
+        {0.f * unit<scalar_t>::T, 0.f * unit<scalar_t>::T,
+         2.f * unit<scalar_t>::T});
+    const bfield_t::view_t field_view(field);
+
+    // Generate the track batch
+    using generator_t =
+        uniform_track_generator<free_track_parameters<algebra_t>>;
+    auto trk_gen_cfg = generator_t::configuration{};
+    trk_gen_cfg.phi_steps(20u).theta_steps(20u);
+    trk_gen_cfg.p_tot(10.f * unit<scalar_t>::GeV);
+
+    vecmem::vector<free_track_parameters<algebra_t>> tracks(&mng_mr);
+    for (const auto track : generator_t{trk_gen_cfg}) {
+        tracks.push_back(track);
+    }
+    const auto n_tracks{static_cast<unsigned int>(tracks.size())};
+    constexpr unsigned int max_hits{50u};
+
+    fast_simulation_config<scalar_t> cfg{};
+    cfg.event = 7u;
+    cfg.path_limit = 2.f * unit<scalar_t>::m;
+
+    // Host reference
+    hit_collection<algebra_t> host_hits(mng_mr, n_tracks, max_hits);
+    simulator_t<host_detector_t>{cfg}.simulate(
+        tracks, detray::get_data(host_hits),
+        propagation::sequential_executor{}, field_view, det);
+
+    // Device simulation with the same random number streams
+    cuda::launch_config launch{};
+    launch.threads_per_block = 64u;
+
+    hit_collection<algebra_t> device_hits(mng_mr, n_tracks, max_hits);
+    cuda::simulate_batch<simulator_t<device_detector_t>>(
+        launch, cfg, detray::get_data(det), vecmem::get_data(tracks),
+        detray::get_data(device_hits), field_view);
+
+    DETRAY_CUDA_ERROR_CHECK(cudaDeviceSynchronize());
+
+    unsigned int n_total_hits{0u};
+    for (unsigned int trk = 0u; trk < n_tracks; ++trk) {
+        ASSERT_FALSE(host_hits.overflow(trk));
+        ASSERT_EQ(device_hits.n_hits(trk), host_hits.n_hits(trk));
+
+        for (unsigned int i = 0u; i < host_hits.size(trk); ++i) {
+            const auto h_hit = host_hits.at(trk, i);
+            const auto d_hit = device_hits.at(trk, i);
+
+            EXPECT_EQ(d_hit.barcode, h_hit.barcode);
+            EXPECT_NEAR(d_hit.local[0], h_hit.local[0], pos_tol);
+            EXPECT_NEAR(d_hit.local[1], h_hit.local[1], pos_tol);
+            EXPECT_NEAR(d_hit.time, h_hit.time, rel_tol * h_hit.time);
+            EXPECT_NEAR(d_hit.energy_deposit, h_hit.energy_deposit,
+                        rel_tol * h_hit.energy_deposit);
+        }
+        n_total_hits += host_hits.n_hits(trk);
+    }
+
+    EXPECT_GT(n_total_hits, n_tracks);
+}
@@ -0,0 +1,126 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/definitions/detail/cuda_definitions.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/geometry/mask.hpp"
+#include "detray/geometry/shapes/rectangle2D.hpp"
+#include "detray/materials/cuda/material_mapping.hpp"
+#include "detray/materials/material_map.hpp"
+#include "detray/materials/material_mapping.hpp"
+#include "detray/test/types.hpp"
+#include "detray/utils/grid/grid_collection.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/cuda/managed_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+using namespace detray;
+
+namespace {
+
+using algebra_t = test::algebra;
+using scalar_t = test::scalar;
+using point2 = test::point2;
+
+using host_map_t = material_map<rectangle2D, scalar_t>;
+using device_map_t =
+    material_map<rectangle2D, scalar_t, device_container_types>;
+using slab_t = material_slab<scalar_t>;
+
+/// Relative tolerance: The order of the atomic additions differs
+constexpr scalar_t rel_tol{1e-4f};
+
+/// Build two rectangular material maps
+grid_collection<host_map_t> make_maps(vecmem::memory_resource &mr) {
+    material_grid_factory<scalar_t> factory{};
+
+    grid_collection<host_map_t> maps(&mr);
+    const mask<rectangle2D> r0{0u, 10.f, 10.f};
+    const mask<rectangle2D> r1{0u, 5.f, 5.f};
+    maps.push_back(factory.new_grid(r0, {20u, 20u}));
+    maps.push_back(factory.new_grid(r1, {5u, 5u}));
+
+    return maps;
+}
+
+}  // anonymous namespace
+
+/// Compare the material mapping on the device with the host
+TEST(detray_cuda_material, material_mapping) {
+
+    vecmem::cuda::managed_memory_resource mng_mr;
+
+    auto host_maps = make_maps(mng_mr);
+    auto device_maps = make_maps(mng_mr);
+    const std::size_t n_bins{host_maps.bin_storage().size()};
+
+    // Recordings of silicon and gold slabs all over the maps
+    vecmem::vector<material_recording<algebra_t>> recordings(&mng_mr);
+    for (unsigned int i = 0u; i < 100000u; ++i) {
+        const dindex map{i % 2u};
+        const scalar_t hw{map == 0u ? 10.f : 5.f};
+        const scalar_t u{static_cast<scalar_t>(i % 97u) / 97.f};
+        const scalar_t v{static_cast<scalar_t>(i % 89u) / 89.f};
+        const point2 loc{hw * (2.f * u - 1.f), hw * (2.f * v - 1.f)};
+        const scalar_t t{(1.f + static_cast<scalar_t>(i % 5u)) *
+                         unit<scalar_t>::mm};
+        recordings.push_back(
+            {map, loc,
+             (i % 3u) ? slab_t(silicon<scalar_t>{}, t)
+                      : slab_t(gold<scalar_t>{}, t)});
+    }
+
+    // Host reference
+    std::vector<material_bin_sums<scalar_t>> host_sums(n_bins);
+    for (const auto &rec : recordings) {
+        accumulate_material(host_maps, host_sums, rec);
+    }
+    for (dindex i = 0u; i < n_bins; ++i) {
+        finalize_material_bin(host_maps, host_sums, i);
+    }
+
+    // Device mapping
+    vecmem::vector<material_bin_sums<scalar_t>> device_sums(n_bins, &mng_mr);
+
+    cuda::launch_config launch{};
+    launch.threads_per_block = 128u;
+
+    cuda::accumulate_material<grid_collection<device_map_t>, algebra_t>(
+        launch, detray::get_data(device_maps), vecmem::get_data(device_sums),
+        vecmem::get_data(recordings));
+    cuda::finalize_material_maps<grid_collection<device_map_t>, scalar_t>(
+        launch, detray::get_data(device_maps), vecmem::get_data(device_sums));
+
+    DETRAY_CUDA_ERROR_CHECK(cudaDeviceSynchronize());
+
+    unsigned int n_filled{0u};
+    for (std::size_t i = 0u; i < n_bins; ++i) {
+        const slab_t &h_slab = *host_maps.bin_storage()[i];
+        const slab_t &d_slab = *device_maps.bin_storage()[i];
+
+        ASSERT_EQ(device_sums[i].n_entries, host_sums[i].n_entries);
+        ASSERT_EQ(static_cast<bool>(d_slab), static_cast<bool>(h_slab));
+        if (!h_slab) {
+            continue;
+        }
+        EXPECT_NEAR(d_slab.thickness(), h_slab.thickness(),
+                    rel_tol * h_slab.thickness());
+        EXPECT_NEAR(d_slab.thickness_in_X0(), h_slab.thickness_in_X0(),
+                    rel_tol * h_slab.thickness_in_X0());
+        EXPECT_NEAR(d_slab.get_material().mass_density(),
+                    h_slab.get_material().mass_density(),
+                    rel_tol * h_slab.get_material().mass_density());
+        ++n_filled;
+    }
+
+    EXPECT_GT(n_filled, n_bins / 2u);
+}
@@ -124,3 +124,52 @@ TEST(CudaPropagatorValidation10, inhomogeneous_bfield_cpy) {
     run_propagation_test<bfield::cuda::inhom_bknd_t>(
         &mng_mr, det, detray::get_data(det_buff), std::move(field));
 }
+
+/// This tests the texture backend of the inhomogeneous field against the
+/// field values on the host and in a device array
+TEST(CudaPropagatorValidation11, inhomogeneous_bfield_texture) {
+
+    // VecMem memory resource(s)
+    vecmem::cuda::managed_memory_resource mng_mr;
+
+    // Get the magnetic field
+    const auto field = bfield::create_inhom_field();
+    const bfield::cuda::inhom_field_t array_field(field);
+    const bfield::cuda::inhom_tex_field_t tex_field =
+        bfield::cuda::create_inhom_texture_field(field);
+
+    // Sample points in the tracking volume
+    vecmem::vector<point3_t> points(&mng_mr);
+    for (int i = -10; i <= 10; ++i) {
+        for (int j = -10; j <= 10; ++j) {
+            for (int k = -10; k <= 10; ++k) {
+                points.push_back({static_cast<scalar_t>(i) * 95.f,
+                                  static_cast<scalar_t>(j) * 95.f,
+                                  static_cast<scalar_t>(k) * 280.f});
+            }
+        }
+    }
+
+    vecmem::vector<vector3_t> array_values(points.size(), &mng_mr);
+    vecmem::vector<vector3_t> tex_values(points.size(), &mng_mr);
+
+    bfield_sample_test<bfield::cuda::inhom_bknd_t>(
+        array_field, vecmem::get_data(points), vecmem::get_data(array_values));
+    bfield_sample_test<bfield::cuda::inhom_tex_bknd_t>(
+        tex_field, vecmem::get_data(points), vecmem::get_data(tex_values));
+
+    // The texture interpolation is less precise (see inhom_tex_bknd_t)
+    const scalar_t tex_tol{1e-3f * unit<scalar_t>::T};
+
+    const bfield::inhom_field_t::view_t host_view(field);
+    for (std::size_t i = 0u; i < points.size(); ++i) {
+        const point3_t& pos = points[i];
+        const auto b = host_view.at(pos[0], pos[1], pos[2]);
+        const vector3_t host_value{b[0], b[1], b[2]};
+
+        EXPECT_NEAR(getter::norm(array_values[i] - host_value), 0.f,
+                    1e-6f * unit<scalar_t>::T);
+        EXPECT_NEAR(getter::norm(tex_values[i] - host_value), 0.f, tex_tol)
+            << "at (" << pos[0] << ", " << pos[1] << ", " << pos[2] << ")";
+    }
+}
@@ -0,0 +1,575 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/core/trimmed_metadata.hpp"
+#include "detray/definitions/detail/cuda_definitions.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/detectors/build_toy_detector.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/actors/aborters.hpp"
+#include "detray/propagator/actors/step_recorder.hpp"
+#include "detray/propagator/cuda/propagate_batch.hpp"
+#include "detray/propagator/cuda/propagate_heterogeneous.hpp"
+#include "detray/propagator/cuda/propagate_multi_device.hpp"
+#include "detray/propagator/cuda/propagate_recorded.hpp"
+#include "detray/propagator/cuda/propagate_wavefront.hpp"
+#include "detray/propagator/cuda/propagation_graph.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/simulation/event_generator/track_generators.hpp"
+#include "detray/test/types.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/data/vector_buffer.hpp>
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/cuda/device_memory_resource.hpp>
+#include <vecmem/memory/cuda/host_memory_resource.hpp>
+#include <vecmem/memory/cuda/managed_memory_resource.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+using namespace detray;
+
+namespace {
+
+using algebra_t = test::algebra;
+using scalar_t = test::scalar;
+
+constexpr scalar_t tol{1e-4f};
+
+using bfield_t = bfield::const_field_t;
+using stepper_t = rk_stepper<bfield_t::view_t, algebra_t>;
+using actor_chain_t = actor_chain<dtuple, pathlimit_aborter>;
+
+/// Propagator on the host or device detector type @tparam detector_t
+template <typename detector_t>
+using propagator_t = propagator<
+    stepper_t,
+    navigator<detector_t, navigation::void_inspector,
+              intersection2D<typename detector_t::surface_type, algebra_t>,
+              20u>,
+    actor_chain_t>;
+
+using result_t = propagation::result<algebra_t>;
+
+}  // anonymous namespace
+
+namespace {
+
+/// Check the device results @param device_results against @param host_results
+void check_results(const vecmem::vector<result_t>& host_results,
+                   const vecmem::vector<result_t>& device_results) {
+
+    ASSERT_EQ(device_results.size(), host_results.size());
+    for (std::size_t i = 0u; i < host_results.size(); ++i) {
+        const result_t& h_res = host_results[i];
+        const result_t& d_res = device_results[i];
+
+        EXPECT_EQ(d_res.success, h_res.success);
+        EXPECT_EQ(d_res.status, h_res.status);
+        EXPECT_NEAR(d_res.path_length, h_res.path_length, tol);
+        EXPECT_NEAR(getter::norm(d_res.params.pos() - h_res.params.pos()),
+                    0.f, tol);
+    }
+}
+
+}  // anonymous namespace
+
+/// Compare the device batch propagation with the host batch propagation
+TEST(detray_cuda_propagator, propagate_batch) {
+
+    vecmem::cuda::managed_memory_resource mng_mr;
+
+    auto [det, names] = build_toy_detector(mng_mr);
+
+    using host_detector_t = decltype(det);
+    using device_detector_t =
+        detector<typename host_detector_t::metadata, device_container_types>;
+
+    const bfield_t field = bfield::create_const_field(
+        {0.f * unit<scalar_t>::T, 0.f * unit<scalar_t>::T,
+         2.f * unit<scalar_t>::T});
+    const bfield_t::view_t field_view(field);
+
+    // Generate the track batch
+    using generator_t =
+        uniform_track_generator<free_track_parameters<algebra_t>>;
+    auto trk_gen_cfg = generator_t::configuration{};
+    trk_gen_cfg.phi_steps(20u).theta_steps(20u);
+    trk_gen_cfg.p_tot(1.f * unit<scalar_t>::GeV);
+
+    vecmem::vector<free_track_parameters<algebra_t>> tracks(&mng_mr);
+    for (const auto track : generator_t{trk_gen_cfg}) {
+        tracks.push_back(track);
+    }
+
+    pathlimit_aborter::state aborter_state{};
+    aborter_state.set_path_limit(50.f * unit<scalar_t>::cm);
+    const actor_chain_t::state_tuple actor_states{aborter_state};
+
+    const propagation::config<scalar_t> cfg{};
+
+    // Host reference
+    vecmem::vector<result_t> host_results(tracks.size(), &mng_mr);
+    propagator_t<host_detector_t> host_propagator{cfg};
+    host_propagator.propagate_batch(tracks, host_results,
+                                    propagation::sequential_executor{},
+                                    actor_states, field_view, det);
+
+    // Enqueue the device propagation on its own stream
+    cudaStream_t stream;
+    DETRAY_CUDA_ERROR_CHECK(cudaStreamCreate(&stream));
+
+    // One thread per track and persistent threads with a work queue, with
+    // the geometry in global or in shared memory and the views passed as
+    // kernel arguments or in constant memory
+    for (const bool persistent : {false, true}) {
+        for (const bool stage_geometry : {false, true}) {
+            for (const bool constant_views : {false, true}) {
+
+                cuda::launch_config launch{};
+                launch.threads_per_block = 64u;
+                launch.stream = stream;
+                launch.persistent = persistent;
+                launch.chunk_size = 4u;
+                launch.stage_geometry = stage_geometry;
+                launch.constant_views = constant_views;
+
+                vecmem::vector<result_t> device_results(tracks.size(),
+                                                        &mng_mr);
+                cuda::propagate_batch<propagator_t<device_detector_t>>(
+                    launch, cfg, detray::get_data(det),
+                    vecmem::get_data(tracks),
+                    vecmem::get_data(device_results), actor_states,
+                    field_view);
+
+                DETRAY_CUDA_ERROR_CHECK(cudaStreamSynchronize(stream));
+
+                check_results(host_results, device_results);
+            }
+        }
+    }
+
+    // Staged kernels in a wavefront pipeline
+    cuda::launch_config launch{};
+    launch.stream = stream;
+
+    vecmem::vector<result_t> device_results(tracks.size(), &mng_mr);
+    cuda::propagate_wavefront<propagator_t<device_detector_t>>(
+        launch, cfg, detray::get_data(det), vecmem::get_data(tracks),
+        vecmem::get_data(device_results), actor_states, 8u, field_view);
+
+    check_results(host_results, device_results);
+
+    DETRAY_CUDA_ERROR_CHECK(cudaStreamDestroy(stream));
+}
+
+/// Replay the per-event propagation sequence from a CUDA graph
+TEST(detray_cuda_propagator, propagation_graph) {
+
+    vecmem::cuda::host_memory_resource pinned_mr;
+    vecmem::cuda::device_memory_resource dev_mr;
+
+    auto [det, names] = build_toy_detector(pinned_mr);
+
+    using host_detector_t = decltype(det);
+    using device_detector_t =
+        detector<typename host_detector_t::metadata, device_container_types>;
+
+    const bfield_t field = bfield::create_const_field(
+        {0.f * unit<scalar_t>::T, 0.f * unit<scalar_t>::T,
+         2.f * unit<scalar_t>::T});
+    const bfield_t::view_t field_view(field);
+
+    using generator_t =
+        uniform_track_generator<free_track_parameters<algebra_t>>;
+    auto trk_gen_cfg = generator_t::configuration{};
+    trk_gen_cfg.phi_steps(10u).theta_steps(10u);
+    trk_gen_cfg.p_tot(1.f * unit<scalar_t>::GeV);
+
+    vecmem::vector<free_track_parameters<algebra_t>> tracks(&pinned_mr);
+    for (const auto track : generator_t{trk_gen_cfg}) {
+        tracks.push_back(track);
+    }
+    const auto n_tracks{static_cast<unsigned int>(tracks.size())};
+
+    pathlimit_aborter::state aborter_state{};
+    aborter_state.set_path_limit(50.f * unit<scalar_t>::cm);
+    const actor_chain_t::state_tuple actor_states{aborter_state};
+
+    const propagation::config<scalar_t> cfg{};
+
+    // Host reference
+    vecmem::vector<result_t> host_results(tracks.size(), &pinned_mr);
+    propagator_t<host_detector_t> host_propagator{cfg};
+    host_propagator.propagate_batch(tracks, host_results,
+                                    propagation::sequential_executor{},
+                                    actor_states, field_view, det);
+
+    // Device buffers of the events
+    vecmem::data::vector_buffer<free_track_parameters<algebra_t>>
+        track_buffer(n_tracks, dev_mr);
+    vecmem::data::vector_buffer<result_t> result_buffer(n_tracks, dev_mr);
+
+    for (const bool persistent : {false, true}) {
+
+        cuda::launch_config launch{};
+        launch.threads_per_block = 64u;
+        launch.persistent = persistent;
+
+        cuda::propagation_graph<propagator_t<device_detector_t>,
+                                bfield_t::view_t>
+            graph(launch, cfg, detray::get_data(det), actor_states,
+                  field_view);
+
+        // Same buffers for every event: The graph is only captured once
+        vecmem::vector<result_t> device_results(tracks.size(), &pinned_mr);
+        for (unsigned int event = 0u; event < 3u; ++event) {
+            device_results.assign(tracks.size(), result_t{});
+            graph.run(tracks.data(), track_buffer.ptr(), result_buffer.ptr(),
+                      device_results.data(), n_tracks);
+
+            check_results(host_results, device_results);
+        }
+        EXPECT_EQ(graph.n_captures(), 1u);
+        EXPECT_EQ(graph.n_instantiations(), 1u);
+
+        // A smaller event with new host buffers is captured again
+        const unsigned int n_small{n_tracks / 2u};
+        vecmem::vector<free_track_parameters<algebra_t>> small_tracks(
+            tracks.begin(), tracks.begin() + n_small, &pinned_mr);
+        vecmem::vector<result_t> small_host_results(
+            host_results.begin(), host_results.begin() + n_small, &pinned_mr);
+        vecmem::vector<result_t> small_results(n_small, &pinned_mr);
+
+        graph.run(small_tracks.data(), track_buffer.ptr(), result_buffer.ptr(),
+                  small_results.data(), n_small);
+
+        check_results(small_host_results, small_results);
+        EXPECT_EQ(graph.n_captures(), 2u);
+        // The stream-ordered allocation of the persistent mode prevents the
+        // update of the graph
+        if (!persistent) {
+            EXPECT_EQ(graph.n_instantiations(), 1u);
+        }
+    }
+}
+
+/// Compare the propagation on all devices with the host batch propagation
+TEST(detray_cuda_propagator, propagate_multi_device) {
+
+    vecmem::cuda::host_memory_resource pinned_mr;
+
+    auto [det, names] = build_toy_detector(pinned_mr);
+
+    using host_detector_t = decltype(det);
+    using device_detector_t =
+        detector<typename host_detector_t::metadata, device_container_types>;
+
+    const bfield_t field = bfield::create_const_field(
+        {0.f * unit<scalar_t>::T, 0.f * unit<scalar_t>::T,
+         2.f * unit<scalar_t>::T});
+
+    // Generate the track batch
+    using generator_t =
+        uniform_track_generator<free_track_parameters<algebra_t>>;
+    auto trk_gen_cfg = generator_t::configuration{};
+    trk_gen_cfg.phi_steps(20u).theta_steps(21u);
+
+    vecmem::vector<free_track_parameters<algebra_t>> tracks(&pinned_mr);
+    for (const auto track : generator_t{trk_gen_cfg}) {
+        tracks.push_back(track);
+    }
+
+    pathlimit_aborter::state aborter_state{};
+    aborter_state.set_path_limit(50.f * unit<scalar_t>::cm);
+    const actor_chain_t::state_tuple actor_states{aborter_state};
+
+    const propagation::config<scalar_t> cfg{};
+
+    // Host reference
+    vecmem::vector<result_t> host_results(tracks.size(), &pinned_mr);
+    propagator_t<host_detector_t> host_propagator{cfg};
+    host_propagator.propagate_batch(tracks, host_results,
+                                    propagation::sequential_executor{},
+                                    actor_states, bfield_t::view_t(field), det);
+
+    // Distribute the batch over all devices
+    cuda::multi_device_propagator<propagator_t<device_detector_t>, bfield_t>
+        device_propagator(cuda::available_devices(), det, field);
+
+    vecmem::vector<result_t> device_results(&pinned_mr);
+    device_propagator.propagate(cuda::launch_config{}, cfg, tracks,
+                                device_results, actor_states);
+
+    check_results(host_results, device_results);
+}
+
+/// Compare the propagation that is split between the host and all devices
+/// with the host batch propagation
+TEST(detray_cuda_propagator, propagate_heterogeneous) {
+
+    vecmem::cuda::host_memory_resource pinned_mr;
+
+    auto [det, names] = build_toy_detector(pinned_mr);
+
+    using host_detector_t = decltype(det);
+    using device_detector_t =
+        detector<typename host_detector_t::metadata, device_container_types>;
+
+    const bfield_t field = bfield::create_const_field(
+        {0.f * unit<scalar_t>::T, 0.f * unit<scalar_t>::T,
+         2.f * unit<scalar_t>::T});
+
+    using generator_t =
+        uniform_track_generator<free_track_parameters<algebra_t>>;
+    auto trk_gen_cfg = generator_t::configuration{};
+    trk_gen_cfg.phi_steps(20u).theta_steps(21u);
+
+    vecmem::vector<free_track_parameters<algebra_t>> tracks(&pinned_mr);
+    for (const auto track : generator_t{trk_gen_cfg}) {
+        tracks.push_back(track);
+    }
+
+    pathlimit_aborter::state aborter_state{};
+    aborter_state.set_path_limit(50.f * unit<scalar_t>::cm);
+    const actor_chain_t::state_tuple actor_states{aborter_state};
+
+    const propagation::config<scalar_t> cfg{};
+
+    // Host reference
+    vecmem::vector<result_t> host_results(tracks.size(), &pinned_mr);
+    propagator_t<host_detector_t> host_propagator{cfg};
+    host_propagator.propagate_batch(tracks, host_results,
+                                    propagation::sequential_executor{},
+                                    actor_states, bfield_t::view_t(field), det);
+
+    // Small chunks, so that the batch is split between the workers
+    using het_propagator_t =
+        cuda::heterogeneous_propagator<propagator_t<host_detector_t>,
+                                       propagator_t<device_detector_t>,
+                                       bfield_t>;
+    het_propagator_t::config het_cfg{};
+    het_cfg.min_host_chunk = 8u;
+    het_cfg.min_device_chunk = 32u;
+
+    propagation::parallel_executor host_exec{};
+    host_exec.n_threads = 2u;
+
+    het_propagator_t het_propagator(cuda::available_devices(), det, field,
+                                    host_exec, het_cfg);
+
+    // The second batch is scheduled with the measured throughput
+    for (unsigned int n = 0u; n < 2u; ++n) {
+        vecmem::vector<result_t> het_results(&pinned_mr);
+        het_propagator.propagate(cuda::launch_config{}, cfg, tracks,
+                                 het_results, actor_states);
+
+        check_results(host_results, het_results);
+    }
+
+    for (const double rate : het_propagator.throughput()) {
+        EXPECT_TRUE(rate >= 0.);
+    }
+}
+
+/// Compare the recorded sensitive surfaces of the device propagation after
+/// the compaction on the device with the host propagation
+TEST(detray_cuda_propagator, propagate_batch_recorded) {
+
+    vecmem::cuda::managed_memory_resource mng_mr;
+    vecmem::host_memory_resource host_mr;
+
+    auto [det, names] = build_toy_detector(mng_mr);
+
+    using host_detector_t = decltype(det);
+    using device_detector_t =
+        detector<typename host_detector_t::metadata, device_container_types>;
+
+    using host_recorder_t = step_recorder<algebra_t>;
+    using device_recorder_t = step_recorder<algebra_t, device_container_types>;
+
+    /// Propagators that record the trajectory
+    using host_chain_t =
+        actor_chain<dtuple, host_recorder_t, pathlimit_aborter>;
+    using device_chain_t =
+        actor_chain<dtuple, device_recorder_t, pathlimit_aborter>;
+    using host_propagator_t =
+        propagator<stepper_t,
+                   navigator<host_detector_t, navigation::void_inspector,
+                             intersection2D<typename host_detector_t::
+                                                surface_type,
+                                            algebra_t>,
+                             20u>,
+                   host_chain_t>;
+    using device_propagator_t =
+        propagator<stepper_t,
+                   navigator<device_detector_t, navigation::void_inspector,
+                             intersection2D<typename device_detector_t::
+                                                surface_type,
+                                            algebra_t>,
+                             20u>,
+                   device_chain_t>;
+
+    const bfield_t field = bfield::create_const_field(
+        {0.f * unit<scalar_t>::T, 0.f * unit<scalar_t>::T,
+         2.f * unit<scalar_t>::T});
+    const bfield_t::view_t field_view(field);
+
+    using generator_t =
+        uniform_track_generator<free_track_parameters<algebra_t>>;
+    auto trk_gen_cfg = generator_t::configuration{};
+    trk_gen_cfg.phi_steps(20u).theta_steps(20u);
+    trk_gen_cfg.p_tot(1.f * unit<scalar_t>::GeV);
+
+    vecmem::vector<free_track_parameters<algebra_t>> tracks(&mng_mr);
+    for (const auto track : generator_t{trk_gen_cfg}) {
+        tracks.push_back(track);
+    }
+    const auto n_tracks{static_cast<dindex>(tracks.size())};
+
+    pathlimit_aborter::state aborter_state{};
+    aborter_state.set_path_limit(50.f * unit<scalar_t>::cm);
+
+    const propagation::config<scalar_t> cfg{};
+
+    // Host reference
+    vecmem::vector<result_t> host_results(tracks.size(), &mng_mr);
+    host_recorder_t::collection_type host_records(mng_mr, n_tracks, 50u);
+    host_propagator_t host_propagator{cfg};
+    host_propagator.propagate_batch_recorded(
+        tracks, host_results, host_records, propagation::sequential_executor{},
+        host_chain_t::state_tuple{
+            host_recorder_t::state{step_record_mode::e_sensitives},
+            aborter_state},
+        field_view, det);
+    const auto host_compact = compact_step_records(host_records, host_mr);
+
+    cudaStream_t stream;
+    DETRAY_CUDA_ERROR_CHECK(cudaStreamCreate(&stream));
+
+    cuda::launch_config launch{};
+    launch.stream = stream;
+
+    // Record the sensitive surfaces into slices, compact them on the device
+    vecmem::vector<result_t> device_results(tracks.size(), &mng_mr);
+    host_recorder_t::collection_type device_records(mng_mr, n_tracks, 50u);
+    compact_step_record_collection<algebra_t> device_compact(
+        mng_mr, n_tracks, host_compact.n_records());
+
+    cuda::propagate_batch_recorded<device_propagator_t>(
+        launch, cfg, detray::get_data(det), vecmem::get_data(tracks),
+        vecmem::get_data(device_results), device_records.get_data(),
+        device_chain_t::state_tuple{
+            device_recorder_t::state{step_record_mode::e_sensitives},
+            aborter_state},
+        field_view);
+    cuda::compact_step_records<algebra_t>(launch, device_records.get_data(),
+                                          device_compact.get_data());
+
+    // Only the compact records are copied
+    const auto records =
+        cuda::copy_step_records<algebra_t>(stream, device_compact.get_data(),
+                                           host_mr);
+    DETRAY_CUDA_ERROR_CHECK(cudaStreamDestroy(stream));
+
+    check_results(host_results, device_results);
+
+    ASSERT_EQ(records.size(), n_tracks);
+    EXPECT_EQ(records.n_records(), host_compact.n_records());
+    EXPECT_EQ(records.n_dropped(), 0u);
+    for (dindex trk = 0u; trk < n_tracks; ++trk) {
+        ASSERT_EQ(records.n_records(trk), host_compact.n_records(trk));
+        for (unsigned int i = 0u; i < records.n_records(trk); ++i) {
+            EXPECT_EQ(records.barcode(trk, i), host_compact.barcode(trk, i));
+            EXPECT_NEAR(records.path_length(trk, i),
+                        host_compact.path_length(trk, i), tol);
+        }
+    }
+}
+
+/// Compare the trimmed device propagation (only the mask and material types
+/// of the toy detector, no jacobian transport) with the full host propagation
+TEST(detray_cuda_propagator, propagate_batch_trimmed) {
+
+    vecmem::cuda::managed_memory_resource mng_mr;
+
+    auto [det, names] = build_toy_detector(mng_mr);
+
+    using host_detector_t = decltype(det);
+    using metadata_t = typename host_detector_t::metadata;
+    using mask_id = typename metadata_t::mask_ids;
+    using material_id = typename metadata_t::material_ids;
+
+    // The toy detector uses all of its mask types, but only material slabs
+    using trimmed_detector_t = detector<
+        trimmed_metadata<
+            metadata_t,
+            id_sequence<mask_id::e_rectangle2, mask_id::e_trapezoid2,
+                        mask_id::e_portal_cylinder2, mask_id::e_portal_ring2>,
+            id_sequence<material_id::e_slab>>,
+        device_container_types>;
+
+    using trimmed_stepper_t =
+        rk_stepper<bfield_t::view_t, algebra_t, unconstrained_step,
+                   stepper_rk_policy, stepping::void_inspector, darray,
+                   scalar_t, false>;
+    using trimmed_propagator_t =
+        propagator<trimmed_stepper_t,
+                   navigator<trimmed_detector_t, navigation::void_inspector,
+                             intersection2D<typename trimmed_detector_t::
+                                                surface_type,
+                                            algebra_t>,
+                             20u>,
+                   actor_chain_t>;
+
+    const bfield_t field = bfield::create_const_field(
+        {0.f * unit<scalar_t>::T, 0.f * unit<scalar_t>::T,
+         2.f * unit<scalar_t>::T});
+    const bfield_t::view_t field_view(field);
+
+    using generator_t =
+        uniform_track_generator<free_track_parameters<algebra_t>>;
+    auto trk_gen_cfg = generator_t::configuration{};
+    trk_gen_cfg.phi_steps(20u).theta_steps(20u);
+    trk_gen_cfg.p_tot(1.f * unit<scalar_t>::GeV);
+
+    vecmem::vector<free_track_parameters<algebra_t>> tracks(&mng_mr);
+    for (const auto track : generator_t{trk_gen_cfg}) {
+        tracks.push_back(track);
+    }
+
+    pathlimit_aborter::state aborter_state{};
+    aborter_state.set_path_limit(50.f * unit<scalar_t>::cm);
+    const actor_chain_t::state_tuple actor_states{aborter_state};
+
+    const propagation::config<scalar_t> cfg{};
+
+    // Host reference
+    vecmem::vector<result_t> host_results(tracks.size(), &mng_mr);
+    propagator_t<host_detector_t> host_propagator{cfg};
+    host_propagator.propagate_batch(tracks, host_results,
+                                    propagation::sequential_executor{},
+                                    actor_states, field_view, det);
+
+    // The trimmed detector is constructed from the view of the full detector
+    vecmem::vector<result_t> device_results(tracks.size(), &mng_mr);
+    cuda::propagate_batch<trimmed_propagator_t>(
+        cuda::launch_config{}, cfg, detray::get_data(det),
+        vecmem::get_data(tracks), vecmem::get_data(device_results),
+        actor_states, field_view);
+
+    DETRAY_CUDA_ERROR_CHECK(cudaDeviceSynchronize());
+
+    check_results(host_results, device_results);
+}
@@ -19,7 +19,8 @@ __global__ void propagator_test_kernel(
         candidates_data,
     vecmem::data::jagged_vector_view<scalar_t> path_lengths_data,
     vecmem::data::jagged_vector_view<vector3_t> positions_data,
-    vecmem::data::jagged_vector_view<free_matrix_t> jac_transports_data) {
+    vecmem::data::jagged_vector_view<free_matrix_t> jac_transports_data,
+    unsigned int *n_overflows) {
 
     int gid = threadIdx.x + blockIdx.x * blockDim.x;
     using detector_device_t =
@@ -49,10 +50,7 @@ __global__ void propagator_test_kernel(
     using propagator_device_t =
         propagator<decltype(stepr), decltype(nav), actor_chain_device_t>;
 
-    propagation::config<scalar> cfg{};
-    cfg.navigation.search_window = {3u, 3u};
-    cfg.stepping.rk_error_tol = rk_tolerance;
-    propagator_device_t p{cfg};
+    propagator_device_t p{test_config()};
 
     // Create actor states
     inspector_device_t::state insp_state(
@@ -75,11 +73,16 @@ __global__ void propagator_test_kernel(
 
     // Run propagation
     p.propagate(state, actor_states);
+
+    // The candidates did not fit into the buffer
+    if (state._navigation.status() == navigation::status::e_overflow) {
+        atomicAdd(n_overflows, 1u);
+    }
 }
 
 /// Launch the device kernel
 template <typename bfield_bknd_t, typename detector_t>
-void propagator_test(
+unsigned int propagator_test(
     typename detector_t::view_type det_view,
     covfie::field_view<bfield_bknd_t> field_data,
     vecmem::data::vector_view<track_t>& tracks_data,
@@ -92,20 +95,82 @@ void propagator_test(
     constexpr int thread_dim = 2 * WARP_SIZE;
     constexpr int block_dim = theta_steps * phi_steps / thread_dim + 1;
 
+    // Number of tracks with a candidate overflow
+    unsigned int *n_overflows{nullptr};
+    DETRAY_CUDA_ERROR_CHECK(
+        cudaMallocManaged(&n_overflows, sizeof(unsigned int)));
+    *n_overflows = 0u;
+
     // run the test kernel
     propagator_test_kernel<bfield_bknd_t, detector_t>
-        <<<block_dim, thread_dim>>>(det_view, field_data, tracks_data,
-                                    candidates_data, path_lengths_data,
-                                    positions_data, jac_transports_data);
+        <<<block_dim, thread_dim>>>(
+            det_view, field_data, tracks_data, candidates_data,
+            path_lengths_data, positions_data, jac_transports_data,
+            n_overflows);
+
+    // cuda error check
+    DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
+    DETRAY_CUDA_ERROR_CHECK(cudaDeviceSynchronize());
+
+    const unsigned int result{*n_overflows};
+    DETRAY_CUDA_ERROR_CHECK(cudaFree(n_overflows));
+
+    return result;
+}
+
+template <typename bfield_bknd_t>
+__global__ void bfield_sample_test_kernel(
+    covfie::field_view<bfield_bknd_t> field_data,
+    vecmem::data::vector_view<point3_t> points_data,
+    vecmem::data::vector_view<vector3_t> values_data) {
+
+    unsigned int gid = threadIdx.x + blockIdx.x * blockDim.x;
+
+    vecmem::device_vector<point3_t> points(points_data);
+    vecmem::device_vector<vector3_t> values(values_data);
+
+    if (gid >= points.size()) {
+        return;
+    }
+
+    const point3_t& pos = points[gid];
+    const auto b = field_data.at(pos[0], pos[1], pos[2]);
+    values[gid] = vector3_t{b[0], b[1], b[2]};
+}
+
+/// Launch the field sampling kernel
+template <typename bfield_bknd_t>
+void bfield_sample_test(covfie::field_view<bfield_bknd_t> field_data,
+                        vecmem::data::vector_view<point3_t> points_data,
+                        vecmem::data::vector_view<vector3_t> values_data) {
+
+    constexpr int thread_dim = 2 * WARP_SIZE;
+    const int block_dim =
+        static_cast<int>(points_data.size() + thread_dim - 1) / thread_dim;
+
+    bfield_sample_test_kernel<bfield_bknd_t>
+        <<<block_dim, thread_dim>>>(field_data, points_data, values_data);
 
     // cuda error check
     DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
     DETRAY_CUDA_ERROR_CHECK(cudaDeviceSynchronize());
 }
 
+/// Explicit instantiations for the field sampling
+template void bfield_sample_test<bfield::cuda::inhom_bknd_t>(
+    covfie::field_view<bfield::cuda::inhom_bknd_t>,
+    vecmem::data::vector_view<point3_t>,
+    vecmem::data::vector_view<vector3_t>);
+
+template void bfield_sample_test<bfield::cuda::inhom_tex_bknd_t>(
+    covfie::field_view<bfield::cuda::inhom_tex_bknd_t>,
+    vecmem::data::vector_view<point3_t>,
+    vecmem::data::vector_view<vector3_t>);
+
 /// Explicit instantiation for a constant magnetic field
-template void propagator_test<bfield::const_bknd_t,
-                              detector<toy_metadata, host_container_types>>(
+template unsigned int
+propagator_test<bfield::const_bknd_t,
+                detector<toy_metadata, host_container_types>>(
     detector<toy_metadata, host_container_types>::view_type,
     covfie::field_view<bfield::const_bknd_t>,
     vecmem::data::vector_view<track_t>&,
@@ -116,8 +181,9 @@ template void propagator_test<bfield::const_bknd_t,
     vecmem::data::jagged_vector_view<free_matrix_t>&);
 
 /// Explicit instantiation for an inhomogeneous magnetic field
-template void propagator_test<bfield::cuda::inhom_bknd_t,
-                              detector<toy_metadata, host_container_types>>(
+template unsigned int
+propagator_test<bfield::cuda::inhom_bknd_t,
+                detector<toy_metadata, host_container_types>>(
     detector<toy_metadata, host_container_types>::view_type,
     covfie::field_view<bfield::cuda::inhom_bknd_t>,
     vecmem::data::vector_view<track_t>&,
@@ -9,6 +9,7 @@
 
 // Project include(s)
 #include "detray/detectors/bfield.hpp"
+#include "detray/detectors/cuda/bfield.hpp"
 #include "detray/detectors/toy_metadata.hpp"
 #include "detray/test/propagator_test.hpp"
 
@@ -16,24 +17,13 @@
 #include <vecmem/memory/memory_resource.hpp>
 #include <vecmem/utils/cuda/copy.hpp>
 
-// Covfie include(s)
-#include <covfie/cuda/backend/primitive/cuda_device_array.hpp>
-
 namespace detray {
 
-namespace bfield::cuda {
-
-// Inhomogeneous field (cuda)
-using inhom_bknd_t = covfie::backend::affine<covfie::backend::linear<
-    covfie::backend::strided<covfie::vector::vector_d<std::size_t, 3>,
-                             covfie::backend::cuda_device_array<
-                                 covfie::vector::vector_d<scalar, 3>>>>>;
-
-}  // namespace bfield::cuda
-
 /// Launch the propagation test kernel
+///
+/// @returns the number of tracks whose candidates did not fit into the buffer
 template <typename bfield_bknd_t, typename detector_t>
-void propagator_test(
+unsigned int propagator_test(
     typename detector_t::view_type, covfie::field_view<bfield_bknd_t>,
     vecmem::data::vector_view<track_t> &,
     vecmem::data::jagged_vector_view<intersection_t<detector_t>> &,
@@ -41,6 +31,13 @@ void propagator_test(
     vecmem::data::jagged_vector_view<vector3_t> &,
     vecmem::data::jagged_vector_view<free_matrix_t> &);
 
+/// Evaluate the field @param field_data at the points in @param points_data
+/// on the device and write the field values to @param values_data
+template <typename bfield_bknd_t>
+void bfield_sample_test(covfie::field_view<bfield_bknd_t> field_data,
+                        vecmem::data::vector_view<point3_t> points_data,
+                        vecmem::data::vector_view<vector3_t> values_data);
+
 /// Test function for propagator on the device
 template <typename bfield_bknd_t, typename detector_t>
 inline auto run_propagation_device(
@@ -58,33 +55,44 @@ inline auto run_propagation_device(
     // Get tracks data
     auto tracks_data = vecmem::get_data(tracks);
 
-    // Create navigator candidates buffer
-    auto candidates_buffer =
-        create_candidates_buffer(det, theta_steps * phi_steps, *mr);
-    copy.setup(candidates_buffer);
-
     // Create vector buffer for track recording
-    std::vector<std::size_t> sizes(theta_steps * phi_steps, 0);
     std::vector<std::size_t> capacities;
     for (auto &r : host_positions) {
         capacities.push_back(r.size());
     }
 
-    vecmem::data::jagged_vector_buffer<scalar> path_lengths_buffer(
-        capacities, *mr, nullptr, vecmem::data::buffer_type::resizable);
-    vecmem::data::jagged_vector_buffer<vector3_t> positions_buffer(
-        capacities, *mr, nullptr, vecmem::data::buffer_type::resizable);
-    vecmem::data::jagged_vector_buffer<free_matrix_t> jac_transports_buffer(
-        capacities, *mr, nullptr, vecmem::data::buffer_type::resizable);
-
-    copy.setup(path_lengths_buffer);
-    copy.setup(positions_buffer);
-    copy.setup(jac_transports_buffer);
-
-    // Run the propagator test for GPU device
-    propagator_test<bfield_bknd_t, detector_t>(
-        det_view, field_data, tracks_data, candidates_buffer,
-        path_lengths_buffer, positions_buffer, jac_transports_buffer);
+    vecmem::data::jagged_vector_buffer<scalar> path_lengths_buffer;
+    vecmem::data::jagged_vector_buffer<vector3_t> positions_buffer;
+    vecmem::data::jagged_vector_buffer<free_matrix_t> jac_transports_buffer;
+
+    // Run the propagator test for GPU device and rerun it with a larger
+    // navigator candidates buffer, if the candidates of a track overflow
+    auto propagate = [&](auto &candidates_buffer) {
+        // Fresh recording for every attempt
+        path_lengths_buffer = vecmem::data::jagged_vector_buffer<scalar>(
+            capacities, *mr, nullptr, vecmem::data::buffer_type::resizable);
+        positions_buffer = vecmem::data::jagged_vector_buffer<vector3_t>(
+            capacities, *mr, nullptr, vecmem::data::buffer_type::resizable);
+        jac_transports_buffer =
+            vecmem::data::jagged_vector_buffer<free_matrix_t>(
+                capacities, *mr, nullptr,
+                vecmem::data::buffer_type::resizable);
+
+        copy.setup(path_lengths_buffer);
+        copy.setup(positions_buffer);
+        copy.setup(jac_transports_buffer);
+
+        return propagator_test<bfield_bknd_t, detector_t>(
+            det_view, field_data, tracks_data, candidates_buffer,
+            path_lengths_buffer, positions_buffer, jac_transports_buffer);
+    };
+
+    const auto n_overflows =
+        propagate_with_candidates_buffer(det, theta_steps * phi_steps,
+                                         test_config().navigation, propagate,
+                                         copy, *mr)
+            .second;
+    EXPECT_EQ(n_overflows, 0u);
 
     vecmem::jagged_vector<scalar> device_path_lengths(mr);
     vecmem::jagged_vector<vector3_t> device_positions(mr);
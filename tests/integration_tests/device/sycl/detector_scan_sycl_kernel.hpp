@@ -0,0 +1,64 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detector.hpp"
+#include "detray/detectors/toy_metadata.hpp"
+#include "detray/navigation/detail/ray.hpp"
+#include "detray/navigation/intersection/intersection.hpp"
+#include "detray/test/types.hpp"
+#include "detray/tracks/tracks.hpp"
+#include "queue_wrapper.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/data/jagged_vector_view.hpp>
+#include <vecmem/containers/data/vector_view.hpp>
+
+namespace detray {
+
+using algebra_t = test::algebra;
+using scalar_t = test::scalar;
+using vector3_t = test::vector3;
+
+using detector_host_t = detector<toy_metadata, host_container_types>;
+using detector_device_t = detector<toy_metadata, device_container_types>;
+
+using ray_t = detail::ray<algebra_t>;
+using track_t = free_track_parameters<algebra_t>;
+using intersection_t =
+    intersection2D<typename detector_device_t::surface_type, algebra_t>;
+
+/// Record the intersections of the rays with all detector surfaces
+///
+/// @param det_data the detector data
+/// @param rays_data the rays to be shot through the detector
+/// @param intersections_data the (unsorted) intersections per ray
+/// @param n_intersections_data the number of intersections per ray, which
+///                             may exceed the capacity of the record
+/// @param queue the queue the kernel is submitted to (waited for)
+void ray_scan_sycl(
+    typename detector_host_t::view_type det_data,
+    vecmem::data::vector_view<const ray_t> rays_data,
+    vecmem::data::jagged_vector_view<intersection_t> intersections_data,
+    vecmem::data::vector_view<unsigned int> n_intersections_data,
+    detray::sycl::queue_wrapper queue);
+
+/// Record the intersections of the helices of the tracks in the constant
+/// B-field @param B with all detector surfaces
+///
+/// @see ray_scan_sycl for the other parameters
+void helix_scan_sycl(
+    typename detector_host_t::view_type det_data,
+    vecmem::data::vector_view<const track_t> tracks_data, const vector3_t B,
+    const scalar_t mask_tolerance,
+    vecmem::data::jagged_vector_view<intersection_t> intersections_data,
+    vecmem::data::vector_view<unsigned int> n_intersections_data,
+    detray::sycl::queue_wrapper queue);
+
+}  // namespace detray
@@ -81,7 +81,8 @@ template <std::size_t CAP = 0u, typename detector_t>
 auto test_detector_json_io(const detector_t& det,
                            const typename detector_t::name_map& names,
                            std::map<std::string, std::string>& file_names,
-                           vecmem::host_memory_resource& host_mr) {
+                           vecmem::host_memory_resource& host_mr,
+                           const bool stream_grids = false) {
 
     auto writer_cfg = io::detector_writer_config{}
                           .format(io::format::json)
@@ -90,7 +91,7 @@ auto test_detector_json_io(const detector_t& det,
 
     // Read the detector back in
     io::detector_reader_config reader_cfg{};
-    reader_cfg.verbose_check(true);
+    reader_cfg.verbose_check(true).stream_grids(stream_grids);
     for (auto& [_, name] : file_names) {
         reader_cfg.add_file(name);
     }
@@ -249,6 +250,31 @@ GTEST_TEST(io, json_toy_detector_roundtrip_homogeneous_material) {
     // EXPECT_TRUE(toy_detector_test(det_io, names_io));
 }
 
+/// Test the streaming json reader for the surface grids
+GTEST_TEST(io, json_toy_detector_roundtrip_stream_grids) {
+
+    // Toy detector
+    vecmem::host_memory_resource host_mr;
+    toy_det_config<scalar> toy_cfg{};
+    toy_cfg.use_material_maps(false);
+    const auto [toy_det, toy_names] = build_toy_detector(host_mr, toy_cfg);
+
+    std::map<std::string, std::string> file_names;
+    file_names["geometry"] = "toy_detector_geometry.json";
+    file_names["homogeneous_material"] =
+        "toy_detector_homogeneous_material.json";
+    file_names["surface_grids"] = "toy_detector_surface_grids.json";
+
+    auto [det_io, names_io] = test_detector_json_io<1u>(
+        toy_det, toy_names, file_names, host_mr, true);
+
+    EXPECT_EQ(det_io.volumes().size(), toy_det.volumes().size());
+
+    // Remove empty files as there are not material maps
+    std::filesystem::remove("toy_detector_material_maps.json");
+    std::filesystem::remove("toy_detector_material_maps_2.json");
+}
+
 /// Test the reading and writing of a toy detector geometry
 GTEST_TEST(io, json_toy_detector_roundtrip_material_maps) {
 
@@ -297,3 +323,112 @@ GTEST_TEST(io, json_wire_chamber_reader) {
 
     EXPECT_EQ(det_io.volumes().size(), 11u);
 }
+
+/// Test the binary format: A detector read back from binary files has to
+/// produce the same json files as the original detector
+GTEST_TEST(io, binary_wire_chamber_roundtrip) {
+
+    // Wire chamber
+    vecmem::host_memory_resource host_mr;
+    wire_chamber_config wire_cfg{};
+    wire_cfg.use_material_maps(false);
+    auto [wire_det, wire_names] = create_wire_chamber(host_mr, wire_cfg);
+    wire_names.at(0u) = "binary_wire_chamber";
+
+    auto writer_cfg = io::detector_writer_config{}
+                          .format(io::format::binary)
+                          .replace_files(true);
+    io::write_detector(wire_det, wire_names, writer_cfg);
+
+    // Reference json files
+    writer_cfg.format(io::format::json);
+    io::write_detector(wire_det, wire_names, writer_cfg);
+
+    io::detector_reader_config reader_cfg{};
+    reader_cfg.verbose_check(true)
+        .add_file("binary_wire_chamber_geometry.dbin")
+        .add_file("binary_wire_chamber_homogeneous_material.dbin")
+        .add_file("binary_wire_chamber_surface_grids.dbin");
+
+    using detector_t = decltype(wire_det);
+    auto [det_io, names_io] =
+        io::read_detector<detector_t>(host_mr, reader_cfg);
+
+    EXPECT_EQ(det_io.volumes().size(), 11u);
+    EXPECT_EQ(names_io.at(0u), "binary_wire_chamber");
+
+    // Write the result as json and compare with the reference
+    writer_cfg.replace_files(false);
+    io::write_detector(det_io, names_io, writer_cfg);
+
+    for (const std::string tag :
+         {"geometry", "homogeneous_material", "surface_grids"}) {
+        const std::string ref_file{"binary_wire_chamber_" + tag + ".json"};
+        const std::string file{"binary_wire_chamber_" + tag + "_2.json"};
+        EXPECT_TRUE(compare_files(ref_file, file)) << tag;
+        std::filesystem::remove(file);
+    }
+    std::filesystem::remove("binary_wire_chamber_material_maps.json");
+    std::filesystem::remove("binary_wire_chamber_material_maps_2.json");
+    std::filesystem::remove("binary_wire_chamber_material_maps.dbin");
+}
+
+/// Test the sharded json files: A detector read back from the shards has to
+/// produce the same json files as the original detector
+GTEST_TEST(io, json_sharded_wire_chamber_roundtrip) {
+
+    // Wire chamber
+    vecmem::host_memory_resource host_mr;
+    wire_chamber_config wire_cfg{};
+    wire_cfg.use_material_maps(false);
+    auto [wire_det, wire_names] = create_wire_chamber(host_mr, wire_cfg);
+    wire_names.at(0u) = "sharded_wire_chamber";
+
+    // Reference json files
+    auto writer_cfg = io::detector_writer_config{}
+                          .format(io::format::json)
+                          .replace_files(true);
+    io::write_detector(wire_det, wire_names, writer_cfg);
+
+    // Sharded json files
+    wire_names.at(0u) = "shards_wire_chamber";
+    writer_cfg.n_shards(4u);
+    io::write_detector(wire_det, wire_names, writer_cfg);
+    EXPECT_TRUE(
+        std::filesystem::exists("shards_wire_chamber_geometry_shard_3.json"));
+
+    using detector_t = decltype(wire_det);
+
+    // Read the shards concurrently or stream them one after the other
+    for (const bool stream_grids : {false, true}) {
+        io::detector_reader_config reader_cfg{};
+        reader_cfg.verbose_check(true)
+            .stream_grids(stream_grids)
+            .add_file("shards_wire_chamber_geometry.json")
+            .add_file("shards_wire_chamber_homogeneous_material.json")
+            .add_file("shards_wire_chamber_surface_grids.json");
+
+        auto [det_io, names_io] =
+            io::read_detector<detector_t>(host_mr, reader_cfg);
+
+        EXPECT_EQ(det_io.volumes().size(), 11u);
+
+        // Write the result as json and compare with the reference
+        names_io.at(0u) = "sharded_wire_chamber";
+        writer_cfg.n_shards(0u).replace_files(false);
+        io::write_detector(det_io, names_io, writer_cfg);
+
+        for (const std::string tag :
+             {"geometry", "homogeneous_material", "surface_grids"}) {
+            const std::string ref_file{"sharded_wire_chamber_" + tag +
+                                       ".json"};
+            const std::string file{"sharded_wire_chamber_" + tag + "_2.json"};
+            EXPECT_TRUE(compare_files(ref_file, file)) << tag;
+            std::filesystem::remove(file);
+        }
+        std::filesystem::remove("sharded_wire_chamber_material_maps_2.json");
+    }
+    std::filesystem::remove("sharded_wire_chamber_material_maps.json");
+    std::filesystem::remove("shards_wire_chamber_material_maps.json");
+    std::filesystem::remove("shards_wire_chamber_material_maps_shard_0.json");
+}
@@ -8,18 +8,22 @@
 #pragma once
 
 // Project include(s)
-#include "detray/io/frontend/utils/file_handle.hpp"
 #include "detray/materials/detail/material_accessor.hpp"
 #include "detray/navigation/detail/ray.hpp"
 #include "detray/simulation/event_generator/track_generators.hpp"
 #include "detray/test/fixture_base.hpp"
 #include "detray/test/types.hpp"
 #include "detray/test/utils/particle_gun.hpp"
+#include "detray/test/utils/record_writer.hpp"
+#include "detray/utils/parallel_algorithms.hpp"
 
 // System include(s)
-#include <ios>
+#include <cstddef>
+#include <functional>
 #include <iostream>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace detray {
 
@@ -37,12 +41,26 @@ class material_scan : public test::fixture_base<> {
     public:
     using fixture_type = test::fixture_base<>;
 
+    /// Intersections along a ray, with the indices of their volumes
+    using intersection_record_t = std::vector<std::pair<
+        dindex, intersection2D<typename detector_t::surface_type, algebra_t>>>;
+    /// Records the intersections of a batch of rays, e.g. on a device
+    using recorder_t = std::function<std::vector<intersection_record_t>(
+        const std::vector<ray_t> &)>;
+
     struct config : public fixture_type::configuration {
         using trk_gen_config_t =
             typename uniform_track_generator<ray_t>::configuration;
 
         std::string m_name{"material_scan"};
         trk_gen_config_t m_trk_gen_cfg{};
+        // Records the intersections instead of the particle gun, if set
+        recorder_t m_recorder{};
+        // Number of rays that are passed to the recorder at once
+        std::size_t m_batch_size{1u << 16};
+        // Number of host threads that shoot the rays of a batch, if no
+        // recorder is set
+        unsigned int m_n_threads{1u};
 
         /// Getters
         /// @{
@@ -51,6 +69,9 @@ class material_scan : public test::fixture_base<> {
         const trk_gen_config_t &track_generator() const {
             return m_trk_gen_cfg;
         }
+        const recorder_t &intersection_recorder() const { return m_recorder; }
+        std::size_t batch_size() const { return m_batch_size; }
+        unsigned int n_threads() const { return m_n_threads; }
         /// @}
 
         /// Setters
@@ -59,6 +80,18 @@ class material_scan : public test::fixture_base<> {
             m_name = n;
             return *this;
         }
+        config &intersection_recorder(recorder_t recorder) {
+            m_recorder = std::move(recorder);
+            return *this;
+        }
+        config &batch_size(const std::size_t n) {
+            m_batch_size = n;
+            return *this;
+        }
+        config &n_threads(const unsigned int n) {
+            m_n_threads = n;
+            return *this;
+        }
         /// @}
     };
 
@@ -69,6 +102,9 @@ class material_scan : public test::fixture_base<> {
         : m_det{det}, m_names{names} {
         m_cfg.name(cfg.name());
         m_cfg.track_generator() = cfg.track_generator();
+        m_cfg.intersection_recorder(cfg.intersection_recorder());
+        m_cfg.batch_size(cfg.batch_size());
+        m_cfg.n_threads(cfg.n_threads());
     }
 
     /// Run the ray scan
@@ -78,29 +114,27 @@ class material_scan : public test::fixture_base<> {
         auto ray_generator =
             uniform_track_generator<ray_t>(m_cfg.track_generator());
 
-        // Csv output file
-        std::string file_name{m_cfg.name() + "_" + m_names.at(0)};
-        detray::io::file_handle outfile{
-            file_name, ".csv",
-            std::ios::out | std::ios::binary | std::ios::trunc};
-        *outfile << "eta,phi,mat_sX0,mat_sL0,mat_tX0,mat_tL0" << std::endl;
+        // Csv output file, written on a background thread
+        test::record_writer outfile{
+            m_cfg.name() + "_" + m_names.at(0) + ".csv",
+            {"eta", "phi", "mat_sX0", "mat_sL0", "mat_tX0", "mat_tL0"}};
 
         std::cout << "INFO: Running material scan on: " << m_names.at(0)
                   << "\n(" << ray_generator.size() << " rays) ...\n"
                   << std::endl;
 
         scalar_t eta{}, phi{}, mat_sX0{}, mat_sL0{}, mat_tX0{}, mat_tL0{};
-        for (const auto ray : ray_generator) {
 
-            // Record all intersections and surfaces along the ray
-            const auto intersection_record =
-                particle_gun::shoot_particle(m_det, ray);
+        // Accumulate the material along a single ray
+        // (returns false on failure)
+        auto scan_ray = [&](const ray_t &ray,
+                            const auto &intersection_record) {
 
             if (intersection_record.empty()) {
                 std::cout << "ERROR: Intersection trace empty for ray "
                           << n_tracks << "/" << ray_generator.size() << ": "
                           << ray << std::endl;
-                break;
+                return false;
             }
 
             eta = getter::eta(ray.dir());
@@ -122,10 +156,18 @@ class material_scan : public test::fixture_base<> {
                 }
 
                 const auto &p = record.second.local;
+
+                // Not filled by the intersector in lazy incidence mode
+                scalar_t cos_inc{record.second.cos_incidence_angle};
+                if (detail::is_invalid_value(cos_inc)) {
+                    cos_inc = math::abs(sf.cos_angle(
+                        typename detector_t::geometry_context{}, ray.dir(),
+                        p));
+                }
+
                 const auto [seg, t, mx0, ml0] =
                     sf.template visit_material<get_material_params>(
-                        point2_t{p[0], p[1]},
-                        record.second.cos_incidence_angle);
+                        point2_t{p[0], p[1]}, cos_inc);
 
                 if (mx0 > 0.f) {
                     mat_sX0 += seg / mx0;
@@ -150,10 +192,61 @@ class material_scan : public test::fixture_base<> {
                           << ray << std::endl;
             }
 
-            *outfile << eta << "," << phi << "," << mat_sX0 << "," << mat_sL0
-                     << "," << mat_tX0 << "," << mat_tL0 << std::endl;
+            outfile.append(eta, phi, mat_sX0, mat_sL0, mat_tX0, mat_tL0);
 
             ++n_tracks;
+
+            return true;
+        };
+
+        // Shoot the rays of a batch on several host threads. The material is
+        // accumulated in the order of the rays, so that the output does not
+        // depend on the number of threads
+        recorder_t recorder{m_cfg.intersection_recorder()};
+        if (!recorder and m_cfg.n_threads() > 1u) {
+            recorder = [this](const std::vector<ray_t> &rays) {
+                std::vector<intersection_record_t> records(rays.size());
+                detray::ranges::transform(
+                    execution::host_threads_policy{m_cfg.n_threads(), 64u},
+                    rays, records, [this](const ray_t &ray) {
+                        return particle_gun::shoot_particle(m_det, ray);
+                    });
+                return records;
+            };
+        }
+
+        if (recorder) {
+            // Record the intersections for a batch of rays together
+            std::vector<ray_t> batch{};
+            batch.reserve(m_cfg.batch_size());
+
+            auto scan_batch = [&]() {
+                const auto records = recorder(batch);
+                for (std::size_t i = 0u; i < batch.size(); ++i) {
+                    if (!scan_ray(batch[i], records[i])) {
+                        return false;
+                    }
+                }
+                batch.clear();
+                return true;
+            };
+
+            for (const auto &ray : ray_generator) {
+                batch.push_back(ray);
+                if (batch.size() == m_cfg.batch_size() && !scan_batch()) {
+                    return;
+                }
+            }
+            if (!batch.empty()) {
+                scan_batch();
+            }
+        } else {
+            for (const auto ray : ray_generator) {
+                // Record all intersections and surfaces along the ray
+                if (!scan_ray(ray, particle_gun::shoot_particle(m_det, ray))) {
+                    break;
+                }
+            }
         }
     }
 
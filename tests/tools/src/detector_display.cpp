@@ -11,6 +11,7 @@
 #include "detray/io/frontend/utils/create_path.hpp"
 #include "detray/navigation/volume_graph.hpp"
 #include "detray/plugins/svgtools/illustrator.hpp"
+#include "detray/plugins/svgtools/volume_writer.hpp"
 #include "detray/plugins/svgtools/writer.hpp"
 
 // Vecmem include(s)
@@ -23,10 +24,12 @@
 #include <boost/program_options.hpp>
 
 // System include(s)
+#include <algorithm>
 #include <filesystem>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
 
 namespace po = boost::program_options;
 using namespace detray;
@@ -57,6 +60,10 @@ int main(int argc, char** argv) {
         "hide_portals", "Hide portal surfaces")("hide_passives",
                                                 "Hide passive surfaces")(
         "hide_eta_lines", "Hide eta lines")("show_info", "Show info boxes")(
+        "per_volume",
+        "Write every volume to its own files, together with an index")(
+        "n_threads", po::value<unsigned int>(),
+        "Number of threads for the per-volume display")(
         "write_volume_graph", "Writes the volume graph to file");
 
     po::variables_map vm;
@@ -141,8 +148,38 @@ int main(int argc, char** argv) {
     const actsvg::views::z_r zr;
     const actsvg::views::z_phi zphi;
 
-    // Display the volumes
-    if (not volumes.empty()) {
+    // Display the volumes one by one, without holding the whole detector
+    if (vm.count("per_volume")) {
+        const unsigned int n_threads{
+            vm.count("n_threads")
+                ? vm["n_threads"].as<unsigned int>()
+                : std::max(1u, std::thread::hardware_concurrency())};
+
+        if (volumes.empty()) {
+            for (dindex i = 0u; i < det.volumes().size(); ++i) {
+                volumes.push_back(i);
+            }
+        }
+
+        auto svg_index = detray::svgtools::write_volume_svgs(
+            path, il, volumes, xy, xy_axis, n_threads, gctx);
+        const auto zr_index = detray::svgtools::write_volume_svgs(
+            path, il, volumes, zr, zr_axis, n_threads, gctx);
+        const auto zphi_index = detray::svgtools::write_volume_svgs(
+            path, il, volumes, zphi, actsvg::svg::object{}, n_threads, gctx);
+
+        // One index entry per volume for all views
+        for (std::size_t i = 0u; i < svg_index.size(); ++i) {
+            for (const auto* other : {&zr_index, &zphi_index}) {
+                const auto& files = (*other)[i].files;
+                svg_index[i].files.insert(svg_index[i].files.end(),
+                                          files.begin(), files.end());
+            }
+        }
+        detray::svgtools::write_svg_index(path, names.at(0) + "_volumes",
+                                          svg_index);
+    } else if (not volumes.empty()) {
+        // Display the volumes
         const auto [vol_xy_svg, xy_sheets] = il.draw_volumes(volumes, xy, gctx);
         detray::svgtools::write_svg(path / vol_xy_svg._id,
                                     {xy_axis, vol_xy_svg});
@@ -26,9 +26,11 @@
 #include <boost/program_options.hpp>
 
 // System include(s)
+#include <algorithm>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
 
 namespace po = boost::program_options;
 using namespace detray;
@@ -67,7 +69,9 @@ int main(int argc, char **argv) {
         "search_window", po::value<std::vector<dindex>>(&window)->multitoken(),
         "search window size for the grid")(
         "overstep_tol", po::value<scalar_t>()->default_value(-100.f),
-        "overstepping tolerance [um] NOTE: Must be negative!");
+        "overstepping tolerance [um] NOTE: Must be negative!")(
+        "n_threads", po::value<unsigned int>(),
+        "Number of threads for the consistency check and the scans");
 
     po::variables_map vm;
     po::store(parse_command_line(argc, argv, desc,
@@ -101,6 +105,15 @@ int main(int argc, char **argv) {
         hel_scan_cfg.write_intersections(true);
     }
 
+    // Results do not depend on the number of threads
+    const unsigned int n_threads{
+        vm.count("n_threads")
+            ? vm["n_threads"].as<unsigned int>()
+            : std::max(1u, std::thread::hardware_concurrency())};
+    con_chk_cfg.n_threads(n_threads);
+    ray_scan_cfg.n_threads(n_threads);
+    hel_scan_cfg.n_threads(n_threads);
+
     // Input files
     if (vm.count("geometry_file")) {
         reader_cfg.add_file(vm["geometry_file"].as<std::string>());
@@ -75,6 +75,7 @@ int main(int argc, char **argv) {
         "outdir", po::value<std::string>(), "Output directory for files")(
         "write_volume_graph", "writes the volume graph to file")(
         "compactify_json", "not implemented")(
+        "write_binary", "write binary files instead of json")(
         "write_material", "toggle material output")("write_grids",
                                                     "toggle grid output")(
         "modules", po::value<unsigned int>()->default_value(10u),
@@ -108,7 +109,9 @@ int main(int argc, char **argv) {
 
     // Configuration
     detray::io::detector_writer_config writer_cfg{};
-    writer_cfg.format(detray::io::format::json).replace_files(false);
+    writer_cfg.format(vm.count("write_binary") ? detray::io::format::binary
+                                               : detray::io::format::json)
+        .replace_files(false);
 
     // General options
     std::string outdir{vm.count("outdir") ? vm["outdir"].as<std::string>()
@@ -9,6 +9,8 @@
 #include "detray/definitions/units.hpp"
 #include "detray/detectors/build_toy_detector.hpp"
 #include "detray/io/frontend/detector_writer.hpp"
+#include "detray/io/frontend/minimal_metadata.hpp"
+#include "detray/utils/memory_report.hpp"
 
 // Vecmem include(s)
 #include <vecmem/memory/host_memory_resource.hpp>
@@ -28,12 +30,16 @@ int main(int argc, char **argv) {
         "outdir", po::value<std::string>(), "Output directory for files")(
         "write_volume_graph", "writes the volume graph to file")(
         "compactify_json", "not implemented")(
+        "write_binary", "write binary files instead of json")(
         "write_material", "toggle material output")("write_grids",
                                                     "toggle grid output")(
+        "write_minimal_metadata", po::value<std::string>(),
+        "header file for a metadata with only the used types")(
         "barrel_layers", po::value<unsigned int>()->default_value(4u),
         "number of barrel layers [0-4]")(
         "endcap_layers", po::value<unsigned int>()->default_value(3u),
-        "number of endcap layers on either side [0-7]");
+        "number of endcap layers on either side [0-7]")(
+        "print_memory", "print the memory footprint of the detector stores");
 
     po::variables_map vm;
     po::store(parse_command_line(argc, argv, desc,
@@ -51,7 +57,9 @@ int main(int argc, char **argv) {
     // Configuration
     detray::toy_det_config<detray::scalar> toy_cfg{};
     detray::io::detector_writer_config writer_cfg{};
-    writer_cfg.format(detray::io::format::json).replace_files(false);
+    writer_cfg.format(vm.count("write_binary") ? detray::io::format::binary
+                                               : detray::io::format::json)
+        .replace_files(false);
 
     // General options
     std::string outdir{vm.count("outdir") ? vm["outdir"].as<std::string>()
@@ -69,6 +77,18 @@ int main(int argc, char **argv) {
     vecmem::host_memory_resource host_mr;
     auto [toy_det, toy_names] = build_toy_detector(host_mr, toy_cfg);
 
+    if (vm.count("print_memory")) {
+        std::cout << detray::get_memory_report(toy_det).to_string();
+    }
+
     // Write to file
     detray::io::write_detector(toy_det, toy_names, writer_cfg);
+
+    // Write the reduced metadata that only contains the used types
+    if (vm.count("write_minimal_metadata")) {
+        detray::io::write_minimal_metadata(
+            toy_det, "toy_minimal_metadata",
+            vm["write_minimal_metadata"].as<std::string>(),
+            "detray/detectors/toy_metadata.hpp");
+    }
 }
@@ -9,6 +9,7 @@
 #include "detray/definitions/units.hpp"
 #include "detray/detectors/create_wire_chamber.hpp"
 #include "detray/io/frontend/detector_writer.hpp"
+#include "detray/utils/memory_report.hpp"
 
 // Vecmem include(s)
 #include <vecmem/memory/host_memory_resource.hpp>
@@ -31,13 +32,15 @@ int main(int argc, char **argv) {
         "outdir", po::value<std::string>(), "Output directory for files")(
         "write_volume_graph", "writes the volume graph to file")(
         "compactify_json", "not implemented")(
+        "write_binary", "write binary files instead of json")(
         "write_material", "toggle material output")("write_grids",
                                                     "toggle grid output")(
         "layers", po::value<unsigned int>()->default_value(10u),
         "number of layers")(
         "half_z",
         po::value<scalar_t>()->default_value(1000.f * unit<scalar_t>::mm),
-        "half length z of the chamber [mm]");
+        "half length z of the chamber [mm]")(
+        "print_memory", "print the memory footprint of the detector stores");
 
     po::variables_map vm;
     po::store(parse_command_line(argc, argv, desc,
@@ -55,7 +58,9 @@ int main(int argc, char **argv) {
     // Configuration
     detray::wire_chamber_config wire_cfg{};
     detray::io::detector_writer_config writer_cfg{};
-    writer_cfg.format(detray::io::format::json).replace_files(false);
+    writer_cfg.format(vm.count("write_binary") ? detray::io::format::binary
+                                               : detray::io::format::json)
+        .replace_files(false);
 
     // General options
     std::string outdir{vm.count("outdir") ? vm["outdir"].as<std::string>()
@@ -73,6 +78,10 @@ int main(int argc, char **argv) {
     vecmem::host_memory_resource host_mr;
     auto [wire_chamber, names] = create_wire_chamber(host_mr, wire_cfg);
 
+    if (vm.count("print_memory")) {
+        std::cout << detray::get_memory_report(wire_chamber).to_string();
+    }
+
     // Write to file
     detray::io::write_detector(wire_chamber, names, writer_cfg);
 }
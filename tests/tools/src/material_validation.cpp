@@ -19,9 +19,11 @@
 #include <boost/program_options.hpp>
 
 // System include(s)
+#include <algorithm>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
 
 namespace po = boost::program_options;
 using namespace detray;
@@ -45,7 +47,9 @@ int main(int argc, char **argv) {
         "eta_range", po::value<std::vector<scalar_t>>()->multitoken(),
         "min, max range of eta values for particle gun")(
         "origin", po::value<std::vector<scalar_t>>()->multitoken(),
-        "coordintates for particle gun origin position");
+        "coordintates for particle gun origin position")(
+        "n_threads", po::value<unsigned int>(),
+        "Number of threads for the material scan");
 
     po::variables_map vm;
     po::store(parse_command_line(argc, argv, desc,
@@ -65,6 +69,12 @@ int main(int argc, char **argv) {
     detray::material_scan<detector_t>::config mat_scan_cfg{};
     mat_scan_cfg.track_generator().uniform_eta(true);
 
+    // Results do not depend on the number of threads
+    mat_scan_cfg.n_threads(
+        vm.count("n_threads")
+            ? vm["n_threads"].as<unsigned int>()
+            : std::max(1u, std::thread::hardware_concurrency()));
+
     // Input files
     if (vm.count("geometry_file")) {
         reader_cfg.add_file(vm["geometry_file"].as<std::string>());
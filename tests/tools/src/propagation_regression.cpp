@@ -0,0 +1,420 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/detectors/build_toy_detector.hpp"
+#include "detray/detectors/create_wire_chamber.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/simulation/event_generator/track_generators.hpp"
+#include "detray/test/types.hpp"
+#include "detray/tracks/tracks.hpp"
+#include "detray/utils/inspectors.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Boost
+#include <boost/program_options.hpp>
+
+// System include(s)
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace po = boost::program_options;
+using namespace detray;
+
+namespace {
+
+using algebra_t = test::algebra;
+using scalar_t = test::scalar;
+using track_t = free_track_parameters<algebra_t>;
+using bfield_t = bfield::const_field_t;
+
+/// Performance metrics of the propagation of the track sample through one
+/// detector
+struct perf_metrics {
+    std::string detector{};
+    /// Propagated tracks per second (best of all repetitions)
+    double tracks_per_s{0.};
+    /// Mean number of steps per track
+    double steps_per_track{0.};
+    /// Mean number of navigation (re-)initializations per track
+    double inits_per_track{0.};
+    /// Mean number of Runge-Kutta step size adjustments per step
+    double rk_retries_per_step{0.};
+};
+
+/// Names of the baseline file columns
+constexpr const char *csv_header{
+    "detector,tracks_per_s,steps_per_track,inits_per_track,"
+    "rk_retries_per_step"};
+
+/// Relative tolerances of the comparison to the baseline
+struct tolerances {
+    /// Allowed decrease of the throughput
+    double throughput{0.1};
+    /// Allowed increase of the step, initialization and retry counts
+    double counts{0.01};
+};
+
+/// Propagates the track sample @param tracks through the detector @param det
+/// in the magnetic field @param field
+///
+/// @param name name of the detector in the baseline file
+/// @param n_repetitions number of throughput measurements
+///
+/// @returns the performance metrics
+template <typename detector_t>
+perf_metrics measure(const std::string &name, const detector_t &det,
+                     const bfield_t &field, const std::vector<track_t> &tracks,
+                     const unsigned int n_repetitions) {
+
+    // Propagator for the throughput measurement
+    using navigator_t = navigator<detector_t>;
+    using stepper_t = rk_stepper<bfield_t::view_t, algebra_t>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain<>>;
+
+    // Propagator that counts the navigation and stepping calls
+    using counting_navigator_t =
+        navigator<detector_t, navigation::counting_inspector<>>;
+    using counting_stepper_t =
+        rk_stepper<bfield_t::view_t, algebra_t, unconstrained_step,
+                   stepper_rk_policy, stepping::counting_inspector>;
+    using counting_propagator_t =
+        propagator<counting_stepper_t, counting_navigator_t, actor_chain<>>;
+
+    perf_metrics metrics{};
+    metrics.detector = name;
+
+    const auto n_tracks{static_cast<double>(tracks.size())};
+
+    // The counts do not depend on the machine, since the sample is fixed
+    counting_propagator_t counting_p{};
+
+    std::size_t n_inits{0u};
+    std::size_t n_steps{0u};
+    std::size_t n_retries{0u};
+    for (const auto &track : tracks) {
+        typename counting_propagator_t::state propagation(track, field, det);
+        counting_p.propagate(propagation);
+
+        n_inits += propagation._navigation.inspector().total.n_inits;
+        n_steps += propagation._stepping.inspector().n_steps;
+        n_retries += propagation._stepping.inspector().n_rk_adjustments;
+    }
+
+    metrics.steps_per_track = static_cast<double>(n_steps) / n_tracks;
+    metrics.inits_per_track = static_cast<double>(n_inits) / n_tracks;
+    metrics.rk_retries_per_step =
+        n_steps > 0u ? static_cast<double>(n_retries) /
+                           static_cast<double>(n_steps)
+                     : 0.;
+
+    // Throughput without inspectors: Take the fastest repetition, which is
+    // least disturbed by the rest of the system
+    propagator_t p{};
+
+    double best_time{std::numeric_limits<double>::max()};
+    for (unsigned int rep = 0u; rep < n_repetitions; ++rep) {
+
+        std::size_t n_success{0u};
+        const auto start = std::chrono::steady_clock::now();
+
+        for (const auto &track : tracks) {
+            typename propagator_t::state propagation(track, field, det);
+            n_success += p.propagate(propagation) ? 1u : 0u;
+        }
+
+        const std::chrono::duration<double> elapsed{
+            std::chrono::steady_clock::now() - start};
+        best_time = std::min(best_time, elapsed.count());
+
+        // Make sure the propagation is not optimized away
+        if (n_success > tracks.size()) {
+            throw std::runtime_error("Invalid propagation result");
+        }
+    }
+    metrics.tracks_per_s = n_tracks / best_time;
+
+    return metrics;
+}
+
+/// Write the @param metrics to the baseline file @param file_name
+void write_baseline(const std::string &file_name,
+                    const std::vector<perf_metrics> &metrics) {
+
+    std::ofstream file{file_name};
+    if (!file.is_open()) {
+        throw std::invalid_argument("Could not open baseline file: " +
+                                    file_name);
+    }
+
+    file << csv_header << "\n";
+    file << std::setprecision(10);
+    for (const auto &m : metrics) {
+        file << m.detector << "," << m.tracks_per_s << ","
+             << m.steps_per_track << "," << m.inits_per_track << ","
+             << m.rk_retries_per_step << "\n";
+    }
+}
+
+/// @returns the metrics in the baseline file @param file_name
+std::vector<perf_metrics> read_baseline(const std::string &file_name) {
+
+    std::ifstream file{file_name};
+    if (!file.is_open()) {
+        throw std::invalid_argument("Could not open baseline file: " +
+                                    file_name);
+    }
+
+    std::string line{};
+    std::getline(file, line);
+    if (line != csv_header) {
+        throw std::invalid_argument("Unknown baseline file format: " +
+                                    file_name);
+    }
+
+    std::vector<perf_metrics> baseline{};
+    while (std::getline(file, line)) {
+        if (line.empty()) {
+            continue;
+        }
+
+        std::stringstream row{line};
+        std::vector<std::string> cells{};
+        std::string cell{};
+        while (std::getline(row, cell, ',')) {
+            cells.push_back(cell);
+        }
+        if (cells.size() != 5u) {
+            throw std::invalid_argument("Malformed line in baseline file: " +
+                                        line);
+        }
+
+        perf_metrics m{};
+        m.detector = cells[0];
+        m.tracks_per_s = std::stod(cells[1]);
+        m.steps_per_track = std::stod(cells[2]);
+        m.inits_per_track = std::stod(cells[3]);
+        m.rk_retries_per_step = std::stod(cells[4]);
+
+        baseline.push_back(std::move(m));
+    }
+
+    return baseline;
+}
+
+/// Compare a single metric @param value to its baseline @param ref
+///
+/// @param higher_is_better whether an increase is an improvement
+/// @param tol relative tolerance
+///
+/// @returns false in case of a regression
+bool compare(const std::string &metric, const double value, const double ref,
+             const bool higher_is_better, const double tol) {
+
+    const double rel_change{ref != 0. ? (value - ref) / ref
+                                      : (value != 0. ? 1. : 0.)};
+    const double worse{higher_is_better ? -rel_change : rel_change};
+
+    const bool is_regression{worse > tol};
+    const char *verdict{is_regression ? "REGRESSION"
+                                      : (worse < -tol ? "improved" : "ok")};
+
+    std::cout << "  " << std::left << std::setw(22) << metric << std::right
+              << std::setw(14) << ref << std::setw(14) << value
+              << std::setw(9) << std::fixed << std::setprecision(1)
+              << 100. * rel_change << "%  " << verdict << std::endl;
+    std::cout << std::defaultfloat << std::setprecision(6);
+
+    return !is_regression;
+}
+
+/// Compare the @param metrics of a detector to the @param baseline
+///
+/// @returns false in case of a regression
+bool compare(const perf_metrics &metrics,
+             const std::vector<perf_metrics> &baseline,
+             const tolerances &tol) {
+
+    const auto ref = std::find_if(
+        baseline.begin(), baseline.end(), [&metrics](const perf_metrics &b) {
+            return b.detector == metrics.detector;
+        });
+
+    if (ref == baseline.end()) {
+        std::cout << "WARNING: No baseline for detector '" << metrics.detector
+                  << "'" << std::endl;
+        return true;
+    }
+
+    std::cout << "\n" << metrics.detector << ":\n"
+              << "  " << std::left << std::setw(22) << "metric" << std::right
+              << std::setw(14) << "baseline" << std::setw(14) << "measured"
+              << std::setw(10) << "change" << std::endl;
+
+    bool success{true};
+    success &= compare("tracks/s", metrics.tracks_per_s, ref->tracks_per_s,
+                       true, tol.throughput);
+    success &= compare("steps/track", metrics.steps_per_track,
+                       ref->steps_per_track, false, tol.counts);
+    success &= compare("nav. inits/track", metrics.inits_per_track,
+                       ref->inits_per_track, false, tol.counts);
+    success &= compare("RK retries/step", metrics.rk_retries_per_step,
+                       ref->rk_retries_per_step, false, tol.counts);
+
+    return success;
+}
+
+}  // anonymous namespace
+
+int main(int argc, char **argv) {
+
+    // Options parsing
+    po::options_description desc("\ndetray propagation regression options");
+
+    desc.add_options()("help", "produce help message")(
+        "detectors",
+        po::value<std::vector<std::string>>()->multitoken()->default_value(
+            {"toy", "wire_chamber"}, "toy wire_chamber"),
+        "detectors to propagate through (toy, wire_chamber)")(
+        "n_tracks", po::value<std::size_t>()->default_value(1000u),
+        "number of tracks in the sample")(
+        "seed", po::value<std::size_t>()->default_value(42u),
+        "seed of the track sample")(
+        "p_T", po::value<scalar_t>()->default_value(10.f),
+        "transverse momentum of the tracks [GeV]")(
+        "repetitions", po::value<unsigned int>()->default_value(5u),
+        "number of throughput measurements (the fastest is kept)")(
+        "baseline_file", po::value<std::string>(),
+        "baseline file (csv) to compare to")(
+        "write_baseline", po::value<std::string>(),
+        "write the results to a new baseline file (csv)")(
+        "throughput_tol", po::value<double>()->default_value(0.1),
+        "allowed relative decrease of the throughput")(
+        "counts_tol", po::value<double>()->default_value(0.01),
+        "allowed relative increase of the step, navigation initialization "
+        "and RK retry counts");
+
+    po::variables_map vm;
+    po::store(parse_command_line(argc, argv, desc,
+                                 po::command_line_style::unix_style ^
+                                     po::command_line_style::allow_short),
+              vm);
+    po::notify(vm);
+
+    // Help message
+    if (vm.count("help")) {
+        std::cout << desc << std::endl;
+        std::cout << "The throughput depends on the machine: Compare only to "
+                     "baselines that were\nrecorded on the same host."
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const auto detectors = vm["detectors"].as<std::vector<std::string>>();
+    const auto n_repetitions{
+        std::max(vm["repetitions"].as<unsigned int>(), 1u)};
+
+    tolerances tol{};
+    tol.throughput = vm["throughput_tol"].as<double>();
+    tol.counts = vm["counts_tol"].as<double>();
+
+    // Fixed, seeded track sample: The counter-based generator yields the
+    // same tracks on every platform
+    using generator_t = splittable_track_generator<track_t>;
+    auto trk_cfg = generator_t::configuration{};
+    const scalar_t p_T{vm["p_T"].as<scalar_t>() * unit<scalar_t>::GeV};
+    trk_cfg.seed(vm["seed"].as<std::size_t>())
+        .n_tracks(vm["n_tracks"].as<std::size_t>())
+        .do_vertex_smearing(false)
+        .pT_range(p_T, p_T);
+
+    // Constant magnetic field along the beam axis
+    const bfield_t field = bfield::create_const_field(
+        test::vector3{0.f, 0.f, 2.f * unit<scalar_t>::T});
+
+    vecmem::host_memory_resource host_mr;
+
+    std::vector<perf_metrics> results{};
+    for (const auto &name : detectors) {
+        if (name == "toy") {
+            const auto [det, names] = build_toy_detector(host_mr);
+
+            trk_cfg.theta_range(0.1f, constant<scalar_t>::pi - 0.1f);
+            const generator_t gen{trk_cfg};
+            std::vector<track_t> tracks(gen.size());
+            gen.fill(tracks);
+
+            results.push_back(
+                measure(name, det, field, tracks, n_repetitions));
+        } else if (name == "wire_chamber") {
+            const auto [det, names] =
+                create_wire_chamber(host_mr, wire_chamber_config{});
+
+            trk_cfg.theta_range(0.25f * constant<scalar_t>::pi,
+                                0.75f * constant<scalar_t>::pi);
+            const generator_t gen{trk_cfg};
+            std::vector<track_t> tracks(gen.size());
+            gen.fill(tracks);
+
+            results.push_back(
+                measure(name, det, field, tracks, n_repetitions));
+        } else {
+            throw std::invalid_argument("Unknown detector: " + name);
+        }
+    }
+
+    std::cout << "\nPropagation of " << trk_cfg.n_tracks()
+              << " tracks (seed " << trk_cfg.seed() << "):\n";
+    for (const auto &m : results) {
+        std::cout << "  " << std::left << std::setw(14) << m.detector
+                  << std::right << "tracks/s: " << m.tracks_per_s
+                  << ", steps/track: " << m.steps_per_track
+                  << ", nav. inits/track: " << m.inits_per_track
+                  << ", RK retries/step: " << m.rk_retries_per_step
+                  << std::endl;
+    }
+
+    if (vm.count("write_baseline")) {
+        const auto file_name = vm["write_baseline"].as<std::string>();
+        write_baseline(file_name, results);
+        std::cout << "\nWrote baseline file " << file_name << std::endl;
+    }
+
+    bool success{true};
+    if (vm.count("baseline_file")) {
+        const auto baseline =
+            read_baseline(vm["baseline_file"].as<std::string>());
+
+        for (const auto &m : results) {
+            success &= compare(m, baseline, tol);
+        }
+
+        std::cout << "\n"
+                  << (success ? "No performance regression"
+                              : "Performance regression detected!")
+                  << std::endl;
+    }
+
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
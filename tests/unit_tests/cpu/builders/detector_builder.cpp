@@ -94,6 +94,20 @@ GTEST_TEST(detray_builders, detector_builder) {
     // initial checks
     EXPECT_EQ(vbuilder2->vol_index(), 1u);
 
+    // Number of objects that will be added to the detector stores
+    detail::store_sizes<detector_t> sizes{};
+    vbuilder->count(sizes);
+    vbuilder2->count(sizes);
+
+    EXPECT_EQ(sizes.n_volumes, 2u);
+    EXPECT_EQ(sizes.n_surfaces, 12u);
+    // Including the volume placements
+    EXPECT_EQ(sizes.n_transforms, 14u);
+    EXPECT_EQ(sizes.n_masks[static_cast<std::size_t>(mask_id::e_rectangle2)],
+              3u);
+    EXPECT_EQ(sizes.n_masks[static_cast<std::size_t>(mask_id::e_trapezoid2)],
+              6u);
+
     //
     // build the detector
     //
@@ -120,6 +134,11 @@ GTEST_TEST(detray_builders, detector_builder) {
     // Check the acceleration data structure link (indirectly)
     EXPECT_EQ(vol0.n_max_candidates(), 3u);
     EXPECT_EQ(vol1.n_max_candidates(), 9u);
+    // Brute force lookups do not depend on the search window
+    const std::array<dindex, 2> search_window{1u, 1u};
+    EXPECT_EQ(vol0.n_max_candidates(search_window), 3u);
+    EXPECT_EQ(vol1.n_max_candidates(search_window), 9u);
+    EXPECT_EQ(d.n_max_candidates(search_window), 9u);
 
     EXPECT_EQ(d.surfaces().size(), 12u);
     EXPECT_EQ(d.mask_store().template size<mask_id::e_portal_cylinder2>(), 0u);
@@ -0,0 +1,151 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/builders/detector_patch.hpp"
+
+#include "detray/builders/grid_builder.hpp"
+#include "detray/core/detector_upload.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/detectors/build_telescope_detector.hpp"
+#include "detray/detectors/build_toy_detector.hpp"
+#include "detray/materials/predefined_materials.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+using namespace detray;
+
+/// Rebuild a barrel grid of the toy detector and move some surfaces
+GTEST_TEST(detray_builders, detector_patch_toy) {
+
+    vecmem::host_memory_resource host_mr;
+
+    toy_det_config<scalar> toy_cfg{};
+    auto [det, names] = build_toy_detector(host_mr, toy_cfg);
+
+    using detector_t = decltype(det);
+    using transform3_t = typename detector_t::transform3_type;
+
+    // Rebuild the grid of the first barrel volume
+    constexpr auto grid_id{detector_t::accel::id::e_cylinder2_grid};
+    using cyl_grid_t =
+        typename detector_t::accelerator_container::template get_type<grid_id>;
+
+    dindex vol_idx{dindex_invalid};
+    for (const auto &vol_desc : det.volumes()) {
+        const auto link = vol_desc.template accel_link<
+            detector_t::geo_obj_ids::e_sensitive>();
+        if (link.id() == grid_id) {
+            vol_idx = vol_desc.index();
+            break;
+        }
+    }
+    ASSERT_NE(vol_idx, dindex_invalid);
+
+    const auto &old_link = det.volumes()[vol_idx].template accel_link<
+        detector_t::geo_obj_ids::e_sensitive>();
+    const dindex old_grid_idx{old_link.index()};
+    const dindex n_grids{det.accelerator_store().template size<grid_id>()};
+    const dindex n_entries{
+        det.accelerator_store().template get<grid_id>()[old_grid_idx].size()};
+
+    // Empty grid with the same binning as the toy detector
+    const auto &barrel_cfg = toy_cfg.barrel_config();
+    const scalar h_z{barrel_cfg.half_length()};
+    grid_builder<detector_t, cyl_grid_t> gbuilder{};
+    gbuilder.init_grid(
+        {-constant<scalar>::pi, constant<scalar>::pi, -h_z, h_z},
+        {detail::scale_grid_bins(barrel_cfg.binning().first, 1.f),
+         detail::scale_grid_bins(barrel_cfg.binning().second, 1.f)});
+
+    // Runs the consistency check
+    patch::surface_grid<cyl_grid_t>(det, vol_idx, gbuilder.get());
+
+    const auto &new_link = det.volumes()[vol_idx].template accel_link<
+        detector_t::geo_obj_ids::e_sensitive>();
+    EXPECT_EQ(new_link.id(), grid_id);
+    EXPECT_EQ(new_link.index(), n_grids);
+    EXPECT_EQ(det.accelerator_store().template size<grid_id>(), n_grids + 1u);
+    EXPECT_EQ(
+        det.accelerator_store().template get<grid_id>()[n_grids].size(),
+        n_entries);
+
+    // Realign three surfaces (two of them twice)
+    const transform3_t new_trf{typename detector_t::point3_type{1.f, 2.f, 3.f}};
+    const std::vector<dindex> trf_indices = patch::surface_transforms(
+        det, {{20u, new_trf}, {10u, new_trf}, {11u, new_trf}, {10u, new_trf}});
+
+    ASSERT_EQ(trf_indices.size(), 3u);
+    EXPECT_TRUE(std::is_sorted(trf_indices.begin(), trf_indices.end()));
+    for (const dindex sf_idx : {10u, 11u, 20u}) {
+        EXPECT_TRUE(det.transform_store().at(det.surface(sf_idx).transform(),
+                                             {}) == new_trf);
+    }
+}
+
+/// Set the volume material of a telescope detector
+GTEST_TEST(detray_builders, detector_patch_volume_material) {
+
+    vecmem::host_memory_resource host_mr;
+
+    mask<rectangle2D> rectangle{0u, 20.f * unit<scalar>::mm,
+                                20.f * unit<scalar>::mm};
+    tel_det_config<> tel_cfg{rectangle};
+    auto [det, names] = build_telescope_detector(host_mr, tel_cfg);
+
+    using detector_t = decltype(det);
+    constexpr auto mat_id{detector_t::materials::id::e_raw_material};
+
+    const auto n_materials{det.material_store().template size<mat_id>()};
+
+    // Link new material
+    patch::volume_material(det, 0u, argon_liquid<scalar>{});
+
+    const auto &vol_desc = det.volumes()[0u];
+    EXPECT_EQ(vol_desc.material().id(), mat_id);
+    EXPECT_EQ(vol_desc.material().index(), n_materials);
+    EXPECT_EQ(det.material_store().template get<mat_id>()[n_materials],
+              argon_liquid<scalar>{});
+
+    // Overwrite it in place
+    patch::volume_material(det, 0u, silicon<scalar>{});
+
+    EXPECT_EQ(vol_desc.material().index(), n_materials);
+    EXPECT_EQ(det.material_store().template size<mat_id>(), n_materials + 1u);
+    EXPECT_EQ(det.material_store().template get<mat_id>()[n_materials],
+              silicon<scalar>{});
+}
+
+/// Copy single elements between two vectors
+GTEST_TEST(detray_builders, detector_patch_update_elements) {
+
+    vecmem::host_memory_resource host_mr;
+    vecmem::copy cpy;
+
+    vecmem::vector<int> src{{0, 1, 2, 3, 4, 5, 6, 7}, &host_mr};
+    vecmem::vector<int> dst(src.size(), -1, &host_mr);
+
+    const vecmem::data::vector_view<const int> src_view =
+        vecmem::get_data(std::as_const(src));
+    update_elements(src_view, vecmem::get_data(dst), {1u, 2u, 3u, 6u}, cpy);
+
+    const std::vector<int> ref{-1, 1, 2, 3, -1, -1, 6, -1};
+    for (std::size_t i = 0u; i < ref.size(); ++i) {
+        EXPECT_EQ(dst[i], ref[i]) << "element " << i;
+    }
+}
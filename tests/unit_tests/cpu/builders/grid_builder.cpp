@@ -12,6 +12,7 @@
 #include "detray/builders/volume_builder.hpp"
 #include "detray/core/detector.hpp"
 #include "detray/definitions/detail/indexing.hpp"
+#include "detray/detectors/build_toy_detector.hpp"
 #include "detray/detectors/toy_metadata.hpp"
 #include "detray/geometry/mask.hpp"
 #include "detray/geometry/shapes/annulus2D.hpp"
@@ -25,7 +26,9 @@
 #include <gtest/gtest.h>
 
 // System include(s)
+#include <algorithm>
 #include <limits>
+#include <vector>
 
 using namespace detray;
 using namespace detray::axis;
@@ -331,3 +334,339 @@ GTEST_TEST(detray_builders, grid_builder) {
     EXPECT_NEAR(cyl_axis_z.span()[1], 500.f,
                 std::numeric_limits<scalar>::epsilon());
 }
+
+/// Unittest: Test the multi-threaded bin association
+GTEST_TEST(detray_builders, grid_builder_parallel_bin_association) {
+
+    vecmem::host_memory_resource host_mr;
+    const auto [toy_det, names] = build_toy_detector(host_mr);
+
+    using surface_t = detector_t::surface_type;
+    using accel_id = detector_t::accel::id;
+
+    // Disc grid that can hold the overlapping endcap modules
+    using disc_grid_t = grid<axes<ring2D>, bins::static_array<surface_t, 20>,
+                             simple_serializer, host_container_types, false>;
+
+    // Endcap layer with the first disc grid of the toy detector
+    const auto &disc_grids =
+        toy_det.accelerator_store().template get<accel_id::e_disc_grid>();
+    ASSERT_FALSE(disc_grids.empty());
+
+    const auto toy_grid = disc_grids[0];
+    const auto &ax_r = toy_grid.template get_axis<label::e_r>();
+    const auto &ax_phi = toy_grid.template get_axis<label::e_phi>();
+
+    const auto &vol_desc = *std::find_if(
+        toy_det.volumes().begin(), toy_det.volumes().end(),
+        [](const auto &vol) {
+            const auto &link = vol.template accel_link<
+                detector_t::geo_obj_ids::e_sensitive>();
+            return link.id() == accel_id::e_disc_grid and link.index() == 0u;
+        });
+
+    std::vector<surface_t> surfaces{};
+    for (const auto &sf_desc : toy_det.surfaces()) {
+        if (sf_desc.volume() == vol_desc.index() and sf_desc.is_sensitive()) {
+            surfaces.push_back(sf_desc);
+        }
+    }
+    ASSERT_FALSE(surfaces.empty());
+
+    const mask<ring2D> disc_mask{0u, ax_r.min(), ax_r.max()};
+
+    auto build_grid = [&](const unsigned int n_threads) {
+        grid_builder<detector_t, disc_grid_t, bin_associator> gbuilder{};
+        gbuilder.init_grid(disc_mask, {ax_r.nbins(), ax_phi.nbins()});
+        gbuilder.fill_grid(detector_volume{toy_det, vol_desc}, surfaces,
+                           toy_det.transform_store(), toy_det.mask_store(),
+                           {}, bin_associator{n_threads});
+        return gbuilder.get();
+    };
+
+    const auto serial_grid = build_grid(1u);
+    const auto parallel_grid = build_grid(4u);
+
+    // Every surface is associated to at least one bin
+    ASSERT_GE(serial_grid.size(), surfaces.size());
+    ASSERT_EQ(parallel_grid.size(), serial_grid.size());
+
+    // Same bin content in the same order
+    for (dindex gbin = 0u; gbin < serial_grid.nbins(); ++gbin) {
+        const auto serial_bin = serial_grid.bin(gbin);
+        const auto parallel_bin = parallel_grid.bin(gbin);
+        ASSERT_EQ(parallel_bin.size(), serial_bin.size());
+
+        for (dindex i = 0u; i < serial_bin.size(); ++i) {
+            EXPECT_EQ(parallel_bin[i], serial_bin[i]);
+        }
+    }
+}
+
+/// Unittest: Test the automatic binning of a toy detector barrel layer
+GTEST_TEST(detray_builders, grid_builder_auto_binning) {
+
+    vecmem::host_memory_resource host_mr;
+    const auto [toy_det, names] = build_toy_detector(host_mr);
+
+    using surface_t = detector_t::surface_type;
+    using accel_id = detector_t::accel::id;
+    using cyl_grid_t =
+        detector_t::accelerator_container::template get_type<
+            accel_id::e_cylinder2_grid>;
+
+    // First barrel layer of the toy detector
+    const auto &vol_desc = *std::find_if(
+        toy_det.volumes().begin(), toy_det.volumes().end(),
+        [](const auto &vol) {
+            const auto &link = vol.template accel_link<
+                detector_t::geo_obj_ids::e_sensitive>();
+            return link.id() == accel_id::e_cylinder2_grid;
+        });
+    const auto &toy_grid =
+        toy_det.accelerator_store().template get<accel_id::e_cylinder2_grid>()
+            [vol_desc.template accel_link<
+                         detector_t::geo_obj_ids::e_sensitive>()
+                 .index()];
+    const auto &ax_z = toy_grid.template get_axis<label::e_cyl_z>();
+
+    std::vector<surface_t> surfaces{};
+    for (const auto &sf_desc : toy_det.surfaces()) {
+        if (sf_desc.volume() == vol_desc.index() and sf_desc.is_sensitive()) {
+            surfaces.push_back(sf_desc);
+        }
+    }
+    ASSERT_FALSE(surfaces.empty());
+
+    const std::vector<scalar> spans{-constant<scalar>::pi,
+                                    constant<scalar>::pi, ax_z.min(),
+                                    ax_z.max()};
+    const detector_volume vol{toy_det, vol_desc};
+
+    // Every module gets its own bin
+    grid_builder<detector_t, cyl_grid_t> gbuilder{};
+    const auto &report = gbuilder.init_grid(
+        vol, surfaces, toy_det.transform_store(), spans);
+    gbuilder.fill_grid(vol, surfaces, toy_det.transform_store(),
+                       toy_det.mask_store());
+
+    EXPECT_FALSE(report.overflow);
+    EXPECT_EQ(report.n_entries, surfaces.size());
+    EXPECT_EQ(report.n_filled_bins, surfaces.size());
+    EXPECT_EQ(report.max_entries, 1u);
+    EXPECT_EQ(report.total_bins(), gbuilder.get().nbins());
+    EXPECT_GE(report.n_bins[0], report.n_rows[0]);
+    EXPECT_GE(report.n_bins[1], report.n_rows[1]);
+    EXPECT_EQ(gbuilder.get().size(), surfaces.size());
+
+    // Memory budget that is too small to separate the modules
+    grid_binning_config<scalar> cfg{};
+    cfg.max_bytes = 20u * sizeof(typename cyl_grid_t::bin_type);
+
+    grid_builder<detector_t, cyl_grid_t> small_gbuilder{};
+    const auto &small_report = small_gbuilder.init_grid(
+        vol, surfaces, toy_det.transform_store(), spans, cfg);
+
+    EXPECT_TRUE(small_report.overflow);
+    EXPECT_LE(small_report.total_bins(), 20u);
+    EXPECT_LE(small_report.bytes, cfg.max_bytes);
+    EXPECT_GT(small_report.max_entries, 1u);
+}
+
+/// Unittest: Test the automatic binning of an irregular axis
+GTEST_TEST(detray_builders, grid_auto_binning_irregular) {
+
+    using grid_t =
+        grid<axes<concentric_cylinder2D, bounds::e_closed, regular, irregular>,
+             bins::static_array<dindex, 2>, simple_serializer,
+             host_container_types, false>;
+    using point_t = typename grid_t::point_type;
+
+    // Unevenly spaced rows in z, evenly spaced rows in phi
+    const std::vector<scalar> z_rows{-9.f, -8.f, -7.f, 5.f};
+    std::vector<point_t> positions{};
+    for (unsigned int i = 0u; i < 8u; ++i) {
+        const scalar phi{-constant<scalar>::pi +
+                         (static_cast<scalar>(i) + 0.5f) *
+                             constant<scalar>::pi / 4.f};
+        for (const scalar z : z_rows) {
+            positions.push_back(point_t{phi, z});
+        }
+    }
+
+    const std::vector<scalar> spans{-constant<scalar>::pi,
+                                    constant<scalar>::pi, -10.f, 10.f};
+    const auto binning = find_grid_binning<grid_t>(positions, spans);
+
+    ASSERT_EQ(binning.n_bins.size(), 2u);
+    EXPECT_EQ(binning.n_bins[0], 8u);
+    EXPECT_EQ(binning.report.n_rows[0], 8u);
+    EXPECT_EQ(binning.report.n_rows[1], 4u);
+    EXPECT_FALSE(binning.report.irregular[0]);
+    EXPECT_TRUE(binning.report.irregular[1]);
+    EXPECT_FALSE(binning.report.overflow);
+    EXPECT_EQ(binning.report.max_entries, 1u);
+
+    // Edges between the rows
+    EXPECT_TRUE(binning.bin_edges[0].empty());
+    const std::vector<scalar> ref_edges{-10.f, -8.5f, -7.5f, -1.f, 10.f};
+    ASSERT_EQ(binning.bin_edges[1].size(), ref_edges.size());
+    for (std::size_t i = 0u; i < ref_edges.size(); ++i) {
+        EXPECT_NEAR(binning.bin_edges[1][i], ref_edges[i], 1e-5f);
+    }
+
+    // Four entries per bin do not fit into the bins: Refine again along phi
+    grid_binning_config<scalar> cfg{};
+    cfg.target_entries = 4.f;
+    const auto coarse = find_grid_binning<grid_t>(positions, spans, cfg);
+
+    EXPECT_EQ(coarse.n_bins[0], 8u);
+    EXPECT_EQ(coarse.bin_edges[1].size(), 3u);
+    EXPECT_EQ(coarse.report.max_entries, 2u);
+    EXPECT_FALSE(coarse.report.overflow);
+    EXPECT_LT(coarse.report.total_bins(), binning.report.total_bins());
+}
+
+/// Unittest: The bin association with candidate bins per surface gives the
+/// same result as testing every surface against every bin
+GTEST_TEST(detray_builders, grid_builder_bin_association_prefilter) {
+
+    vecmem::host_memory_resource host_mr;
+    const auto [toy_det, names] = build_toy_detector(host_mr);
+    const auto &det = toy_det;
+
+    using surface_t = detector_t::surface_type;
+    using accel_id = detector_t::accel::id;
+
+    using disc_grid_t = grid<axes<ring2D>, bins::static_array<surface_t, 20>,
+                             simple_serializer, host_container_types, false>;
+    using cyl_grid_t =
+        grid<axes<concentric_cylinder2D>, bins::static_array<surface_t, 20>,
+             simple_serializer, host_container_types, false>;
+
+    // Sensitive surfaces of the first volume with a given grid type
+    auto get_surfaces = [&det](const accel_id id) {
+        const auto &vol_desc = *std::find_if(
+            det.volumes().begin(), det.volumes().end(),
+            [id](const auto &vol) {
+                return vol.template accel_link<
+                           detector_t::geo_obj_ids::e_sensitive>()
+                           .id() == id;
+            });
+
+        std::vector<surface_t> surfaces{};
+        for (const auto &sf_desc : det.surfaces()) {
+            if (sf_desc.volume() == vol_desc.index() and
+                sf_desc.is_sensitive()) {
+                surfaces.push_back(sf_desc);
+            }
+        }
+        return surfaces;
+    };
+
+    // Compare the bin content of two grids
+    auto compare = [](const auto &grid, const auto &ref_grid) {
+        ASSERT_GT(ref_grid.size(), 0u);
+        ASSERT_EQ(grid.size(), ref_grid.size());
+
+        for (dindex gbin = 0u; gbin < ref_grid.nbins(); ++gbin) {
+            const auto bin = grid.bin(gbin);
+            const auto ref_bin = ref_grid.bin(gbin);
+            ASSERT_EQ(bin.size(), ref_bin.size()) << "bin " << gbin;
+
+            for (dindex i = 0u; i < ref_bin.size(); ++i) {
+                EXPECT_EQ(bin[i], ref_bin[i]);
+            }
+        }
+    };
+
+    for (const bool abs_tol : {true, false}) {
+        // Endcap layer
+        const auto disc_sfs = get_surfaces(accel_id::e_disc_grid);
+        const mask<ring2D> disc_mask{0u, 20.f, 200.f};
+
+        auto build_disc_grid = [&](const bool prefilter) {
+            grid_builder<detector_t, disc_grid_t, bin_associator> gbuilder{};
+            gbuilder.init_grid(disc_mask, {30u, 120u});
+            detail::bin_association(
+                typename detector_t::geometry_context{}, disc_sfs,
+                det.transform_store(), det.mask_store(), gbuilder.get(),
+                {0.1f, 0.1f}, abs_tol, 1u, prefilter);
+            return gbuilder.get();
+        };
+
+        compare(build_disc_grid(true), build_disc_grid(false));
+
+        // Barrel layer
+        const auto cyl_sfs = get_surfaces(accel_id::e_cylinder2_grid);
+        const mask<concentric_cylinder2D> cyl_mask{0u, 30.f, -500.f, 500.f};
+
+        auto build_cyl_grid = [&](const bool prefilter) {
+            grid_builder<detector_t, cyl_grid_t, bin_associator> gbuilder{};
+            gbuilder.init_grid(cyl_mask, {60u, 50u});
+            detail::bin_association(
+                typename detector_t::geometry_context{}, cyl_sfs,
+                det.transform_store(), det.mask_store(), gbuilder.get(),
+                {0.1f, 0.1f}, abs_tol, 1u, prefilter);
+            return gbuilder.get();
+        };
+
+        compare(build_cyl_grid(true), build_cyl_grid(false));
+    }
+}
+
+/// Unittest: Add the exit portals of a toy detector barrel layer to the bins
+/// of its grid
+GTEST_TEST(detray_builders, grid_builder_portals) {
+
+    vecmem::host_memory_resource host_mr;
+    const auto [toy_det, names] = build_toy_detector(host_mr);
+
+    using surface_t = detector_t::surface_type;
+    using accel_id = detector_t::accel::id;
+    using mask_id = detector_t::masks::id;
+
+    using cyl_grid_t =
+        grid<axes<concentric_cylinder2D>, bins::static_array<surface_t, 8>,
+             simple_serializer, host_container_types, false>;
+    using point_t = cyl_grid_t::point_type;
+
+    // First barrel layer of the toy detector
+    const auto &vol_desc = *std::find_if(
+        toy_det.volumes().begin(), toy_det.volumes().end(),
+        [](const auto &vol) {
+            const auto &link = vol.template accel_link<
+                detector_t::geo_obj_ids::e_sensitive>();
+            return link.id() == accel_id::e_cylinder2_grid;
+        });
+
+    grid_builder<detector_t, cyl_grid_t> gbuilder{};
+    const mask<concentric_cylinder2D> cyl_mask{0u, 30.f, -500.f, 500.f};
+    gbuilder.init_grid(cyl_mask, {10u, 20u});
+    gbuilder.fill_portals(toy_det, vol_desc);
+
+    const auto &grid = gbuilder.get();
+
+    // Every bin is crossed by tracks from the origin
+    bool has_disc{false};
+    for (dindex gbin = 0u; gbin < grid.nbins(); ++gbin) {
+        const auto &bin = grid.bin(gbin);
+        EXPECT_GE(bin.size(), 2u) << "bin " << gbin;
+
+        for (const surface_t &sf_desc : bin) {
+            EXPECT_TRUE(sf_desc.is_portal());
+            EXPECT_EQ(sf_desc.volume(), vol_desc.index());
+            has_disc |= (sf_desc.mask().id() == mask_id::e_portal_ring2);
+        }
+    }
+    // The steep tracks leave through the endcap portals
+    EXPECT_TRUE(has_disc);
+
+    // Central tracks enter through the inner and leave through the outer
+    // cylinder portal
+    const auto &central_bin = grid.search(point_t{0.1f, 1.f});
+    ASSERT_EQ(central_bin.size(), 2u);
+    EXPECT_EQ(central_bin[0].mask().id(), mask_id::e_portal_cylinder2);
+    EXPECT_EQ(central_bin[1].mask().id(), mask_id::e_portal_cylinder2);
+    EXPECT_NE(central_bin[0].index(), central_bin[1].index());
+}
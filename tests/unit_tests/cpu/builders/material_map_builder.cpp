@@ -8,7 +8,9 @@
 // Detray include(s)
 #include "detray/builders/material_map_builder.hpp"
 
+#include "detray/builders/bin_fillers.hpp"
 #include "detray/builders/cuboid_portal_generator.hpp"
+#include "detray/builders/detail/material_map_merging.hpp"
 #include "detray/builders/detector_builder.hpp"
 #include "detray/builders/material_map_factory.hpp"
 #include "detray/builders/surface_factory.hpp"
@@ -27,6 +29,7 @@
 #include <gtest/gtest.h>
 
 // System include(s)
+#include <array>
 #include <limits>
 #include <memory>
 #include <vector>
@@ -124,3 +127,137 @@ TEST(detray_builders, material_map_builder) {
     EXPECT_EQ(mat_factory->materials().at(1).front(), tungsten<scalar>());
     EXPECT_EQ(mat_factory->materials().at(2).front(), gold<scalar>());
 }
+
+/// Unittest: Merge the similar bins of material maps
+TEST(detray_builders, material_map_bin_merging) {
+
+    using scalar_t = typename detector_t::scalar_type;
+    using bin_data_t = fill_by_bin::bin_data<2u, material_slab<scalar_t>>;
+
+    constexpr scalar_t tol{1e-3f};
+    const scalar_t t{1.f * unit<scalar_t>::mm};
+
+    // Fill a 6x4 map with the material given by @param mat_fn
+    auto make_map = [](auto mat_fn) {
+        std::vector<bin_data_t> bins{};
+        for (auto [i, j] : detray::views::cartesian_product{
+                 detray::views::iota{0u, 6u}, detray::views::iota{0u, 4u}}) {
+            bin_data_t bd{};
+            bd.local_bin_idx = {i, j};
+            bd.single_element = mat_fn(i, j);
+            bins.push_back(bd);
+        }
+        return bins;
+    };
+
+    // Homogeneous map (within the tolerance): reduced to a single bin
+    std::array<std::size_t, 2u> n_bins{6u, 4u};
+    auto bins = make_map([t](dindex i, dindex) {
+        return material_slab<scalar_t>{
+            silicon<scalar_t>(), t * (1.f + 1e-4f * static_cast<scalar_t>(i))};
+    });
+    detail::merge_material_bins(bins, n_bins, tol);
+
+    EXPECT_EQ(n_bins[0], 1u);
+    EXPECT_EQ(n_bins[1], 1u);
+    ASSERT_EQ(bins.size(), 1u);
+    EXPECT_EQ(bins[0].single_element.get_material(), silicon<scalar_t>());
+
+    // Two materials along the first axis: merged in groups of three bins
+    n_bins = {6u, 4u};
+    bins = make_map([t](dindex i, dindex) {
+        return material_slab<scalar_t>{
+            i < 3u ? silicon<scalar_t>() : tungsten<scalar_t>(), t};
+    });
+    detail::merge_material_bins(bins, n_bins, tol);
+
+    EXPECT_EQ(n_bins[0], 2u);
+    EXPECT_EQ(n_bins[1], 1u);
+    ASSERT_EQ(bins.size(), 2u);
+    for (const bin_data_t &bd : bins) {
+        EXPECT_EQ(bd.local_bin_idx[1], 0u);
+        EXPECT_EQ(bd.single_element.get_material(),
+                  bd.local_bin_idx[0] == 0u ? silicon<scalar_t>()
+                                            : tungsten<scalar_t>());
+    }
+
+    // Thickness changes outside of the tolerance: Only merged along the
+    // second axis
+    n_bins = {6u, 4u};
+    bins = make_map([t](dindex i, dindex) {
+        return material_slab<scalar_t>{
+            silicon<scalar_t>(), t * (1.f + 0.1f * static_cast<scalar_t>(i))};
+    });
+    detail::merge_material_bins(bins, n_bins, tol);
+
+    EXPECT_EQ(n_bins[0], 6u);
+    EXPECT_EQ(n_bins[1], 1u);
+    EXPECT_EQ(bins.size(), 6u);
+
+    // Empty bins are only merged with other empty bins
+    n_bins = {6u, 4u};
+    bins = make_map([t](dindex, dindex) {
+        return material_slab<scalar_t>{silicon<scalar_t>(), t};
+    });
+    bins.erase(bins.begin());
+    detail::merge_material_bins(bins, n_bins, tol);
+
+    EXPECT_EQ(n_bins[0], 6u);
+    EXPECT_EQ(n_bins[1], 4u);
+    EXPECT_EQ(bins.size(), 23u);
+
+    // Merge the bins in the material map builder
+    using transform3 = typename detector_t::transform3_type;
+    using rectangle_factory = surface_factory<detector_t, rectangle2D>;
+
+    vecmem::host_memory_resource host_mr;
+    detector_t d(host_mr);
+
+    auto mat_factory =
+        std::make_shared<material_map_factory<detector_t, bin_index_t>>(
+            std::make_unique<rectangle_factory>());
+
+    // Homogeneous material
+    mat_factory->push_back({surface_id::e_sensitive,
+                            transform3(point3{0.f, 0.f, -1.f}), 1u,
+                            std::vector<scalar>{10.f, 8.f}});
+    {
+        typename material_map_factory<detector_t, bin_index_t>::data_type
+            mat_data{0u};
+        std::vector<bin_index_t> m_bins{};
+        for (auto [i, j] : detray::views::cartesian_product{
+                 detray::views::iota{0u, 5u}, detray::views::iota{0u, 10u}}) {
+            m_bins.push_back({i, j});
+            mat_data.append(t, silicon<scalar_t>());
+        }
+        mat_factory->add_material(mat_id::e_rectangle2_map,
+                                  std::move(mat_data), {5u, 10u},
+                                  std::move(m_bins));
+    }
+
+    // Thickness changes in every bin
+    mat_factory->push_back({surface_id::e_sensitive,
+                            transform3(point3{0.f, 0.f, 1.f}), 1u,
+                            std::vector<scalar>{10.f, 8.f}});
+    add_material_data(mat_factory, mat_id::e_rectangle2_map, 1u, t);
+
+    auto vbuilder =
+        std::make_unique<volume_builder<detector_t>>(volume_id::e_cuboid);
+    auto mat_builder = material_map_builder<detector_t>{std::move(vbuilder)};
+    mat_builder.set_bin_merging(tol);
+    mat_builder.add_surfaces(mat_factory);
+    mat_builder.build(d);
+
+    const auto &compression = mat_builder.compression();
+    EXPECT_EQ(compression.n_maps, 2u);
+    EXPECT_EQ(compression.n_homogeneous, 1u);
+    EXPECT_EQ(compression.n_bins_in, 100u);
+    EXPECT_EQ(compression.n_bins_out, 51u);
+    EXPECT_NEAR(compression.ratio(), 100. / 51., 1e-9);
+
+    const auto mat_maps =
+        d.material_store().template get<mat_id::e_rectangle2_map>();
+    ASSERT_EQ(mat_maps.size(), 2u);
+    EXPECT_EQ(mat_maps[0].nbins(), 1u);
+    EXPECT_EQ(mat_maps[1].nbins(), 50u);
+}
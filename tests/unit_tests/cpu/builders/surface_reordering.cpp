@@ -0,0 +1,126 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/builders/detail/surface_reordering.hpp"
+
+#include "detray/core/detector.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/detectors/build_toy_detector.hpp"
+#include "detray/test/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <cstddef>
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+/// @returns the boundary values of a mask
+struct get_mask_values {
+    template <typename mask_group_t, typename index_t>
+    inline std::vector<scalar> operator()(const mask_group_t &mask_group,
+                                          const index_t &index) const {
+        const auto &values = mask_group[index].values();
+        return std::vector<scalar>(values.begin(), values.end());
+    }
+};
+
+}  // anonymous namespace
+
+/// Reorder the surfaces of the toy detector and compare to the original
+GTEST_TEST(detray_builders, surface_reordering) {
+
+    vecmem::host_memory_resource host_mr;
+    toy_det_config<scalar> toy_cfg{};
+    toy_cfg.use_material_maps(false);
+
+    const auto [ref_det, ref_names] = build_toy_detector(host_mr, toy_cfg);
+    auto [toy_det, names] = build_toy_detector(host_mr, toy_cfg);
+
+    using detector_t = decltype(toy_det);
+    using accel_id = typename detector_t::accel::id;
+
+    const std::vector<dindex> new_pos = detail::reorder_surfaces(toy_det);
+
+    ASSERT_EQ(new_pos.size(), ref_det.surfaces().size());
+    ASSERT_EQ(toy_det.surfaces().size(), ref_det.surfaces().size());
+    ASSERT_EQ(toy_det.transform_store().size(),
+              ref_det.transform_store().size());
+
+    // The permutation is complete
+    std::vector<bool> is_taken(new_pos.size(), false);
+    for (const dindex j : new_pos) {
+        ASSERT_LT(j, new_pos.size());
+        EXPECT_FALSE(is_taken[j]);
+        is_taken[j] = true;
+    }
+
+    // Every surface kept its geometry and links
+    for (dindex i = 0u; i < ref_det.surfaces().size(); ++i) {
+        const auto &ref_sf = ref_det.surface(i);
+        const auto &sf = toy_det.surface(new_pos[i]);
+
+        EXPECT_EQ(sf.index(), new_pos[i]);
+        EXPECT_EQ(sf.volume(), ref_sf.volume());
+        EXPECT_EQ(sf.id(), ref_sf.id());
+        EXPECT_EQ(sf.material(), ref_sf.material());
+        EXPECT_EQ(sf.mask().id(), ref_sf.mask().id());
+        EXPECT_EQ(toy_det.surfaces()[new_pos[i]].source,
+                  ref_det.surfaces()[i].source);
+
+        // Stays in the same surface range of the volume
+        const auto &vol = toy_det.volume(sf.volume());
+        const auto &rg = vol.sf_link()[static_cast<std::size_t>(sf.id())];
+        EXPECT_TRUE(rg[0] <= new_pos[i] && new_pos[i] < rg[1]);
+
+        const auto &trf = toy_det.transform_store()[sf.transform()];
+        const auto &ref_trf = ref_det.transform_store()[ref_sf.transform()];
+        EXPECT_EQ(trf.translation(), ref_trf.translation());
+
+        EXPECT_EQ(
+            toy_det.mask_store().template visit<get_mask_values>(sf.mask()),
+            ref_det.mask_store().template visit<get_mask_values>(
+                ref_sf.mask()));
+    }
+
+    // The sensitive surfaces in the barrel grids are visited in order
+    const auto &cyl_grids =
+        toy_det.accelerator_store().template get<accel_id::e_cylinder2_grid>();
+    ASSERT_FALSE(cyl_grids.size() == 0u);
+    for (dindex g = 0u; g < cyl_grids.size(); ++g) {
+        dindex last{0u};
+        std::vector<bool> is_seen(toy_det.surfaces().size(), false);
+        for (const auto &sf : cyl_grids[g].all()) {
+            // Surface in the grid is up to date
+            EXPECT_EQ(toy_det.surface(sf.index()).transform(), sf.transform());
+            EXPECT_EQ(toy_det.surface(sf.index()).mask(), sf.mask());
+
+            if (!is_seen[sf.index()]) {
+                is_seen[sf.index()] = true;
+                EXPECT_GE(sf.index(), last);
+                last = sf.index();
+            }
+        }
+    }
+
+    // The source link index was rebuilt
+    for (dindex i = 0u; i < ref_det.surfaces().size(); ++i) {
+        const auto src = ref_det.surfaces()[i].source;
+        if (detail::is_invalid_value(src)) {
+            continue;
+        }
+        EXPECT_EQ(toy_det.surface(source_link_searcher{src}).source, src);
+    }
+}
@@ -1,6 +1,6 @@
 /** Detray library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2023 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -20,6 +20,7 @@
 // System include(s)
 #include <array>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 using namespace detray;
@@ -107,6 +108,28 @@ GTEST_TEST(detray_core, tuple_container) {
     EXPECT_TRUE(container.get<0>().empty());
     EXPECT_TRUE(container.get<1>().empty());
     EXPECT_TRUE(detail::get<2>(container).empty());
+
+    // Visit the elements by index
+    container.get<0>().push_back(1.f);
+    container.get<1>().resize(2u);
+
+    EXPECT_EQ(container.visit<test_func>(0u, 0u), 1u);
+    EXPECT_EQ(container.visit<test_func>(1u, 0u), 2u);
+    EXPECT_EQ(container.visit<test_func>(2u, 0u), 0u);
+    for (std::size_t i = 0u; i < 3u; ++i) {
+        EXPECT_EQ(container.visit<test_func>(i, 0u),
+                  container.visit_sequential<test_func>(i, 0u));
+    }
+
+    // Index out of range: Default result
+    EXPECT_EQ(container.visit<test_func>(3u, 0u), 0u);
+    EXPECT_EQ(container.visit_sequential<test_func>(3u, 0u), 0u);
+
+    // Visit only a subset of the elements: Default result for the others
+    using subset_t = std::index_sequence<0u, 2u>;
+    EXPECT_EQ((container.visit_subset<test_func, subset_t>(0u, 0u)), 1u);
+    EXPECT_EQ((container.visit_subset<test_func, subset_t>(1u, 0u)), 0u);
+    EXPECT_EQ((container.visit_subset<test_func, subset_t>(2u, 0u)), 0u);
 }
 
 GTEST_TEST(detray_core, vector_multi_store) {
@@ -176,4 +199,13 @@ GTEST_TEST(detray_core, vector_multi_store) {
     EXPECT_EQ(vector_store.visit<test_func>(std::make_pair(0u, 0u)), 5u);
     EXPECT_EQ(vector_store.visit<test_func>(std::make_pair(1u, 0u)), 3u);
     EXPECT_EQ(vector_store.visit<test_func>(std::make_pair(2u, 0u)), 4u);
+
+    // call functor on a subset of the collections
+    using subset_t = std::index_sequence<1u>;
+    EXPECT_EQ((vector_store.visit_subset<test_func, subset_t>(
+                  std::make_pair(0u, 0u))),
+              0u);
+    EXPECT_EQ((vector_store.visit_subset<test_func, subset_t>(
+                  std::make_pair(1u, 0u))),
+              3u);
 }
@@ -9,7 +9,12 @@
 #include "detray/core/detector.hpp"
 
 #include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/build_toy_detector.hpp"
+#include "detray/detectors/toy_metadata.hpp"
+#include "detray/geometry/surface.hpp"
 #include "detray/materials/predefined_materials.hpp"
+#include "detray/propagator/propagation_batch.hpp"
 #include "detray/test/utils/prefill_detector.hpp"
 
 // Vecmem include(s)
@@ -18,6 +23,9 @@
 // GTest include(s)
 #include <gtest/gtest.h>
 
+// System include(s)
+#include <vector>
+
 /// This tests the functionality of a detector as a data store manager
 GTEST_TEST(detray_core, detector) {
 
@@ -124,3 +132,57 @@ GTEST_TEST(detray_core, detector) {
     d3 = std::move(d2);
     check_filled_detector(d3);
 }
+
+/// This tests the lookup of the sensitive surface of a global point
+GTEST_TEST(detray_core, detector_surface_at) {
+
+    using namespace detray;
+
+    vecmem::host_memory_resource host_mr;
+    const auto [toy_det, names] = build_toy_detector(host_mr);
+
+    using detector_t = detector<toy_metadata>;
+    using point3_t = typename detector_t::point3_type;
+    using point2_t = typename detector_t::point2_type;
+    using vector3_t = typename detector_t::vector3_type;
+    using surface_t = typename detector_t::surface_type;
+    using mask_id = typename detector_t::masks::id;
+
+    const typename detector_t::geometry_context ctx{};
+    constexpr auto tol{10.f * unit<scalar>::um};
+
+    // The centers of the barrel modules (the annulus center is not on the
+    // surface)
+    std::vector<point3_t> points{};
+    std::vector<surface_t> expected{};
+    for (const auto& sf_desc : toy_det.surfaces()) {
+        if (not sf_desc.is_sensitive() or
+            sf_desc.mask().id() != mask_id::e_rectangle2) {
+            continue;
+        }
+        const detray::surface sf{toy_det, sf_desc};
+        points.push_back(sf.center(ctx));
+        expected.push_back(sf_desc);
+    }
+    ASSERT_FALSE(points.empty());
+
+    for (std::size_t i = 0u; i < points.size(); ++i) {
+        const auto sf_desc = toy_det.surface_at(points[i], tol, ctx);
+        ASSERT_FALSE(sf_desc.barcode().is_invalid()) << expected[i].barcode();
+        EXPECT_EQ(sf_desc.barcode(), expected[i].barcode());
+    }
+
+    // Off the surface: no match
+    const detray::surface sf{toy_det, expected.front()};
+    const vector3_t n{sf.normal(ctx, point2_t{0.f, 0.f})};
+    const point3_t off{points.front() + 1.f * unit<scalar>::mm * n};
+    EXPECT_TRUE(toy_det.surface_at(off, tol, ctx).barcode().is_invalid());
+
+    // Batched lookup
+    std::vector<surface_t> results(points.size());
+    toy_det.surfaces_at(points, results, propagation::sequential_executor{},
+                        tol, ctx);
+    for (std::size_t i = 0u; i < points.size(); ++i) {
+        EXPECT_EQ(results[i].barcode(), expected[i].barcode());
+    }
+}
@@ -0,0 +1,113 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/core/detector_replicas.hpp"
+
+#include "detray/core/detector.hpp"
+#include "detray/detectors/build_toy_detector.hpp"
+#include "detray/utils/numa.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace detray;
+
+/// Test the parsing of the node topology and the node memory resource
+GTEST_TEST(detray_core, numa_memory_resource) {
+
+    // Kernel list format
+    EXPECT_EQ(numa::detail::parse_list("0-3,8,10-11"),
+              std::vector<unsigned int>({0u, 1u, 2u, 3u, 8u, 10u, 11u}));
+    EXPECT_EQ(numa::detail::parse_list("0"), std::vector<unsigned int>({0u}));
+    EXPECT_TRUE(numa::detail::parse_list("").empty());
+
+    EXPECT_GE(numa::n_nodes(), 1u);
+
+    for (const bool huge_pages : {false, true}) {
+        numa::memory_resource mr(0u, huge_pages);
+        EXPECT_EQ(mr.node(), 0u);
+        EXPECT_EQ(mr.huge_pages(), huge_pages);
+        EXPECT_TRUE(mr.is_equal(numa::memory_resource(0u, huge_pages)));
+        EXPECT_FALSE(mr.is_equal(numa::memory_resource(0u, !huge_pages)));
+
+        // The allocations are aligned to (huge) pages and can be written
+        constexpr std::size_t n_bytes{3u * (1u << 20u) + 17u};
+        void *ptr = mr.allocate(n_bytes, 64u);
+        ASSERT_NE(ptr, nullptr);
+        const std::size_t page{huge_pages ? numa::detail::huge_page_size
+                                          : 4096u};
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % page, 0u);
+
+        std::memset(ptr, 0xab, n_bytes);
+        EXPECT_EQ(static_cast<unsigned char *>(ptr)[n_bytes - 1u], 0xabu);
+        mr.deallocate(ptr, n_bytes, 64u);
+    }
+
+    // One object per node
+    const auto replicas = numa::replicate(
+        numa::n_nodes(), [](const unsigned int node) {
+            return std::vector<unsigned int>(10u, node);
+        });
+    ASSERT_EQ(replicas.size(), numa::n_nodes());
+    for (unsigned int node = 0u; node < replicas.size(); ++node) {
+        EXPECT_EQ(replicas[node].back(), node);
+    }
+}
+
+/// Replicate the toy detector on several nodes
+GTEST_TEST(detray_core, detector_replicas) {
+
+    vecmem::host_memory_resource host_mr;
+
+    auto [toy_det, names] = build_toy_detector(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using device_detector_t =
+        detector<typename detector_t::metadata, device_container_types>;
+
+    // More replicas than nodes work as well: Their memory is placed by the
+    // kernel
+    for (const bool huge_pages : {false, true}) {
+        detector_replicas<detector_t> replicas(toy_det, 2u, huge_pages);
+
+        ASSERT_EQ(replicas.size(), 2u);
+        EXPECT_GT(replicas.replica_size(), 0u);
+
+        auto view_0 = replicas.get_data(0u);
+        auto view_1 = replicas.get_data(1u);
+        const device_detector_t det_0(view_0);
+        const device_detector_t det_1(view_1);
+
+        // Same content, different memory
+        ASSERT_EQ(det_0.volumes().size(), toy_det.volumes().size());
+        ASSERT_EQ(det_1.volumes().size(), toy_det.volumes().size());
+        for (unsigned int i = 0u; i < toy_det.volumes().size(); ++i) {
+            EXPECT_TRUE(det_0.volumes()[i] == toy_det.volumes()[i]);
+            EXPECT_TRUE(det_1.volumes()[i] == toy_det.volumes()[i]);
+        }
+        ASSERT_EQ(det_0.surfaces().size(), toy_det.surfaces().size());
+        for (unsigned int i = 0u; i < toy_det.surfaces().size(); ++i) {
+            EXPECT_TRUE(det_0.surfaces()[i] == toy_det.surfaces()[i]);
+            EXPECT_TRUE(det_1.surfaces()[i] == toy_det.surfaces()[i]);
+        }
+        EXPECT_EQ(det_0.transform_store().size(),
+                  toy_det.transform_store().size());
+
+        EXPECT_NE(&det_0.volumes()[0], &det_1.volumes()[0]);
+        EXPECT_NE(&det_0.surfaces()[0], &toy_det.surfaces()[0]);
+    }
+}
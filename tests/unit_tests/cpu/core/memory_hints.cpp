@@ -0,0 +1,109 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/core/detail/memory_hints.hpp"
+
+#include "detray/core/detector.hpp"
+#include "detray/detectors/build_toy_detector.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <cstddef>
+#include <map>
+
+using namespace detray;
+
+namespace {
+
+/// Memory region that was passed to the memory system
+struct region {
+    std::size_t n_bytes{0u};
+    memory_hint hint{memory_hint::e_cold};
+};
+
+}  // anonymous namespace
+
+/// Collect the memory hints of the toy detector stores
+GTEST_TEST(detray_core, memory_hints) {
+
+    vecmem::host_memory_resource host_mr;
+    toy_det_config<scalar> toy_cfg{};
+    toy_cfg.use_material_maps(false);
+    auto [toy_det, names] = build_toy_detector(host_mr, toy_cfg);
+
+    using detector_t = decltype(toy_det);
+    using mask_id = typename detector_t::masks::id;
+    using material_id = typename detector_t::materials::id;
+
+    // The view is constructed directly over the detector memory
+    auto det_data = detray::get_data(toy_det);
+
+    std::map<const void *, region> regions;
+    std::size_t n_bytes_total{0u};
+    apply_memory_hints(det_data, [&regions, &n_bytes_total](
+                                     const void *ptr, const std::size_t n,
+                                     const memory_hint hint) {
+        regions[ptr] = {n, hint};
+        n_bytes_total += n;
+    });
+
+    // Every region is passed exactly once
+    std::size_t n_bytes_view{0u};
+    for_each_memory_region(det_data, [&n_bytes_view](const void *,
+                                                     const std::size_t n) {
+        n_bytes_view += n;
+    });
+    EXPECT_EQ(n_bytes_total, n_bytes_view);
+
+    // Volumes (hot)
+    const void *vol_ptr{toy_det.volumes().data()};
+    ASSERT_EQ(regions.count(vol_ptr), 1u);
+    EXPECT_EQ(regions[vol_ptr].n_bytes,
+              toy_det.volumes().size() *
+                  sizeof(typename detector_t::volume_type));
+    EXPECT_EQ(regions[vol_ptr].hint, memory_hint::e_hot);
+
+    // Masks (hot)
+    const auto &rectangles =
+        toy_det.mask_store().template get<mask_id::e_rectangle2>();
+    const void *rect_ptr{rectangles.data()};
+    ASSERT_EQ(regions.count(rect_ptr), 1u);
+    EXPECT_EQ(regions[rect_ptr].n_bytes,
+              rectangles.size() * sizeof(rectangles.front()));
+    EXPECT_EQ(regions[rect_ptr].hint, memory_hint::e_hot);
+
+    // Material (cold)
+    const auto &slabs =
+        toy_det.material_store().template get<material_id::e_slab>();
+    const void *slab_ptr{slabs.data()};
+    ASSERT_EQ(regions.count(slab_ptr), 1u);
+    EXPECT_EQ(regions[slab_ptr].hint, memory_hint::e_cold);
+
+    // Custom hints
+    detector_memory_hints hints{};
+    hints.materials = memory_hint::e_hot;
+    hints.masks = memory_hint::e_cold;
+
+    regions.clear();
+    apply_memory_hints(
+        det_data,
+        [&regions](const void *ptr, const std::size_t n,
+                   const memory_hint hint) {
+            regions[ptr] = {n, hint};
+        },
+        hints);
+
+    EXPECT_EQ(regions[vol_ptr].hint, memory_hint::e_hot);
+    EXPECT_EQ(regions[rect_ptr].hint, memory_hint::e_cold);
+    EXPECT_EQ(regions[slab_ptr].hint, memory_hint::e_hot);
+}
@@ -0,0 +1,104 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/core/detail/packed_buffer.hpp"
+
+#include "detray/core/detector.hpp"
+#include "detray/detectors/build_toy_detector.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+#include <vecmem/memory/unique_ptr.hpp>
+#include <vecmem/utils/copy.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <cstddef>
+#include <cstring>
+
+using namespace detray;
+
+namespace {
+
+/// Compare a detector that was reconstructed from a packed buffer to the
+/// original detector
+template <typename host_detector_t, typename device_detector_t>
+void check_detector(const host_detector_t &host_det,
+                    const device_detector_t &dev_det) {
+
+    using mask_id = typename host_detector_t::masks::id;
+
+    ASSERT_EQ(dev_det.volumes().size(), host_det.volumes().size());
+    for (unsigned int i = 0u; i < host_det.volumes().size(); ++i) {
+        EXPECT_TRUE(dev_det.volumes()[i] == host_det.volumes()[i]);
+    }
+
+    ASSERT_EQ(dev_det.surfaces().size(), host_det.surfaces().size());
+    for (unsigned int i = 0u; i < host_det.surfaces().size(); ++i) {
+        EXPECT_TRUE(dev_det.surfaces()[i] == host_det.surfaces()[i]);
+    }
+
+    ASSERT_EQ(dev_det.transform_store().size(),
+              host_det.transform_store().size());
+    const typename host_detector_t::geometry_context ctx{};
+    for (unsigned int i = 0u; i < host_det.transform_store().size(); ++i) {
+        const auto &trl = host_det.transform_store().at(i, ctx).translation();
+        const auto &dev_trl =
+            dev_det.transform_store().at(i, ctx).translation();
+        EXPECT_EQ(dev_trl[0], trl[0]);
+        EXPECT_EQ(dev_trl[1], trl[1]);
+        EXPECT_EQ(dev_trl[2], trl[2]);
+    }
+
+    EXPECT_EQ(dev_det.mask_store().template size<mask_id::e_rectangle2>(),
+              host_det.mask_store().template size<mask_id::e_rectangle2>());
+    EXPECT_EQ(dev_det.mask_store().template size<mask_id::e_cylinder2>(),
+              host_det.mask_store().template size<mask_id::e_cylinder2>());
+}
+
+}  // anonymous namespace
+
+/// Pack the toy detector into a single arena
+GTEST_TEST(detray_core, packed_buffer) {
+
+    vecmem::host_memory_resource host_mr;
+    vecmem::copy cpy;
+
+    auto [toy_det, names] = build_toy_detector(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using device_detector_t =
+        detector<typename detector_t::metadata, device_container_types>;
+
+    auto packed_buff = detray::get_packed_buffer(toy_det, host_mr, cpy);
+
+    // Every container is aligned and lies inside of the arena
+    ASSERT_FALSE(packed_buff.offsets().empty());
+    EXPECT_EQ(packed_buff.size() % detail::arena_alignment, 0u);
+    for (const auto &entry : packed_buff.offsets()) {
+        EXPECT_EQ(entry.offset % detail::arena_alignment, 0u);
+        EXPECT_LE(entry.offset, packed_buff.size());
+    }
+
+    auto packed_view = detray::get_data(packed_buff);
+    device_detector_t dev_det(packed_view);
+    check_detector(toy_det, dev_det);
+
+    // Relocate the arena
+    auto arena_copy =
+        vecmem::make_unique_alloc<std::byte[]>(host_mr, packed_buff.size());
+    std::memcpy(arena_copy.get(), packed_buff.data(), packed_buff.size());
+
+    auto relocated_view = packed_buff.get_data(arena_copy.get());
+    device_detector_t reloc_det(relocated_view);
+    check_detector(toy_det, reloc_det);
+
+    EXPECT_NE(&reloc_det.volumes()[0], &dev_det.volumes()[0]);
+}
@@ -0,0 +1,81 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/core/detail/surface_lookup.hpp"
+
+#include "detray/core/detector.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <cstdint>
+
+/// This tests the source link index of the surface lookup
+GTEST_TEST(detray_core, surface_lookup_source_index) {
+
+    using namespace detray;
+
+    using detector_t = detector<>;
+    using surface_t = typename detector_t::surface_type;
+    using lookup_t = typename detector_t::surface_lookup_container;
+
+    vecmem::host_memory_resource host_mr;
+    lookup_t sf_lookup(host_mr);
+
+    // Surfaces with unordered source links, the last ones without
+    constexpr dindex n_surfaces{100u};
+    constexpr dindex n_linked{90u};
+    for (dindex i = 0u; i < n_surfaces; ++i) {
+        surface_t sf_desc{};
+        sf_desc.set_index(i);
+
+        if (i < n_linked) {
+            sf_lookup.insert(sf_desc, (37u * i) % 101u + 1000u);
+        } else {
+            sf_lookup.insert(sf_desc);
+        }
+    }
+    ASSERT_EQ(sf_lookup.size(), n_surfaces);
+
+    // Without index, the searcher falls back to the brute force search
+    EXPECT_TRUE(sf_lookup.source_index().empty());
+    EXPECT_EQ(sf_lookup.search(source_link_searcher{1037u}).index(), 1u);
+
+    sf_lookup.build_source_index();
+    ASSERT_EQ(sf_lookup.source_index().size(), n_linked);
+
+    for (dindex i = 0u; i < n_linked; ++i) {
+        const std::uint64_t source{(37u * i) % 101u + 1000u};
+
+        const auto ref_sf = sf_lookup.search(default_searcher{source});
+        const auto result_sf = sf_lookup.search(source_link_searcher{source});
+
+        EXPECT_EQ(result_sf.index(), i);
+        EXPECT_EQ(result_sf.source, source);
+        EXPECT_EQ(ref_sf, result_sf);
+    }
+
+    // Unknown source link
+    EXPECT_TRUE(detail::is_invalid_value(
+        sf_lookup.search(source_link_searcher{42u}).source));
+    EXPECT_TRUE(detail::is_invalid_value(
+        sf_lookup.search(source_link_searcher{2000u}).source));
+
+    // Changing the surfaces invalidates the index
+    surface_t sf_desc{};
+    sf_desc.set_index(n_surfaces);
+    sf_lookup.insert(sf_desc, 2000u);
+    EXPECT_TRUE(sf_lookup.source_index().empty());
+    EXPECT_EQ(sf_lookup.search(source_link_searcher{2000u}).index(),
+              n_surfaces);
+}
@@ -1,12 +1,13 @@
 /** Detray library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
 
 #include <gtest/gtest.h>
 
+#include "detray/core/detail/multi_context_store.hpp"
 #include "detray/core/detail/single_store.hpp"
 #include "detray/test/types.hpp"
 
@@ -47,3 +48,92 @@ GTEST_TEST(detray_core, static_transform_store) {
     static_store.emplace_back(ctx0);
     ASSERT_EQ(static_store.size(ctx0), 5u);
 }
+
+// This tests the transform store with several geometry contexts
+GTEST_TEST(detray_core, multi_context_transform_store) {
+    using namespace detray;
+    using transform3 = test::transform3;
+    using point3 = test::point3;
+
+    using transform_store_t = multi_context_store<transform3>;
+    using context_t = typename transform_store_t::context_type;
+
+    transform_store_t store;
+    const context_t nominal{};
+
+    ASSERT_TRUE(store.empty(nominal));
+    ASSERT_EQ(store.n_contexts(), 1u);
+
+    for (unsigned int i = 0u; i < 10u; ++i) {
+        store.push_back(transform3{point3{static_cast<scalar>(i), 0.f, 0.f}},
+                        nominal);
+    }
+    ASSERT_EQ(store.size(nominal), 10u);
+
+    // Two alignment contexts that move a few of the transforms
+    const context_t ctx1{store.add_context()};
+    const context_t ctx2{store.add_context()};
+    ASSERT_EQ(store.n_contexts(), 3u);
+    EXPECT_EQ(ctx1.get(), 1u);
+    EXPECT_EQ(ctx2.get(), 2u);
+
+    store.set(7u, transform3{point3{7.f, 1.f, 0.f}}, ctx1);
+    store.set(2u, transform3{point3{2.f, 1.f, 0.f}}, ctx1);
+    store.set(2u, transform3{point3{2.f, 2.f, 0.f}}, ctx2);
+    // Overwrite an existing delta
+    store.set(7u, transform3{point3{7.f, 3.f, 0.f}}, ctx1);
+
+    EXPECT_EQ(store.n_deltas(nominal), 0u);
+    EXPECT_EQ(store.n_deltas(ctx1), 2u);
+    EXPECT_EQ(store.n_deltas(ctx2), 1u);
+    EXPECT_EQ(store.size(ctx1), 10u);
+
+    for (unsigned int i = 0u; i < 10u; ++i) {
+        const scalar x{static_cast<scalar>(i)};
+
+        // The nominal transforms are unchanged
+        EXPECT_FLOAT_EQ(store.at(i, nominal).translation()[0], x);
+        EXPECT_FLOAT_EQ(store.at(i, nominal).translation()[1], 0.f);
+        EXPECT_FLOAT_EQ(store[i].translation()[1], 0.f);
+
+        scalar y1{0.f};
+        scalar y2{0.f};
+        if (i == 7u) {
+            y1 = 3.f;
+        } else if (i == 2u) {
+            y1 = 1.f;
+            y2 = 2.f;
+        }
+        EXPECT_FLOAT_EQ(store.at(i, ctx1).translation()[0], x);
+        EXPECT_FLOAT_EQ(store.at(i, ctx1).translation()[1], y1);
+        EXPECT_FLOAT_EQ(store.at(i, ctx2).translation()[1], y2);
+    }
+
+    // Unknown contexts resolve to the nominal transforms
+    EXPECT_FLOAT_EQ(store.at(2u, context_t{5u}).translation()[1], 0.f);
+
+    // Changing the nominal transform is seen in the contexts without delta
+    store.set(5u, transform3{point3{5.f, 5.f, 0.f}}, nominal);
+    EXPECT_FLOAT_EQ(store.at(5u, ctx1).translation()[1], 5.f);
+    EXPECT_FLOAT_EQ(store.at(5u, ctx2).translation()[1], 5.f);
+
+    // Append a store with deltas: The indices are shifted
+    transform_store_t other;
+    other.push_back(transform3{point3{10.f, 0.f, 0.f}}, nominal);
+    other.push_back(transform3{point3{11.f, 0.f, 0.f}}, nominal);
+    const context_t other_ctx{other.add_context()};
+    other.set(1u, transform3{point3{11.f, 1.f, 0.f}}, other_ctx);
+
+    store.append(std::move(other), nominal);
+    ASSERT_EQ(store.size(nominal), 12u);
+    EXPECT_EQ(store.n_deltas(ctx1), 3u);
+    EXPECT_EQ(store.n_deltas(ctx2), 1u);
+    EXPECT_FLOAT_EQ(store.at(11u, ctx1).translation()[1], 1.f);
+    EXPECT_FLOAT_EQ(store.at(11u, ctx2).translation()[1], 0.f);
+    EXPECT_FLOAT_EQ(store.at(7u, ctx1).translation()[1], 3.f);
+    EXPECT_FLOAT_EQ(store.at(2u, ctx2).translation()[1], 2.f);
+
+    store.clear(nominal);
+    EXPECT_TRUE(store.empty(nominal));
+    EXPECT_EQ(store.n_contexts(), 1u);
+}
@@ -0,0 +1,110 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/test/types.hpp"
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <cmath>
+
+using namespace detray;
+
+namespace {
+
+using field_view_t = bfield::solenoid_field_t::view_t;
+
+constexpr scalar radius{1.2f * unit<scalar>::m};
+constexpr scalar length{6.f * unit<scalar>::m};
+constexpr scalar b_center{2.f * unit<scalar>::T};
+constexpr scalar tol{1e-5f * b_center};
+
+/// Divergence of the field, from central differences
+scalar divergence(const field_view_t &f, const scalar x, const scalar y,
+                  const scalar z) {
+    constexpr scalar h{10.f * unit<scalar>::mm};
+
+    return (f.at(x + h, y, z)[0] - f.at(x - h, y, z)[0] +
+            f.at(x, y + h, z)[1] - f.at(x, y - h, z)[1] +
+            f.at(x, y, z + h)[2] - f.at(x, y, z - h)[2]) /
+           (2.f * h);
+}
+
+}  // anonymous namespace
+
+/// Check the analytic solenoid field against known limits
+GTEST_TEST(detray_detectors, solenoid_field) {
+
+    const bfield::solenoid_field_t field =
+        bfield::create_solenoid_field(radius, length, b_center);
+    const field_view_t view(field);
+
+    // Center of the solenoid
+    auto b = view.at(0.f, 0.f, 0.f);
+    EXPECT_NEAR(b[0], 0.f, tol);
+    EXPECT_NEAR(b[1], 0.f, tol);
+    EXPECT_NEAR(b[2], b_center, tol);
+
+    // On the axis, the field is known in closed form
+    const scalar half_l{0.5f * length};
+    for (scalar z = -2.f * length; z <= 2.f * length; z += 100.f) {
+        const scalar zp{z + half_l};
+        const scalar zm{z - half_l};
+        const scalar b_z{
+            0.5f *
+            (zp / std::sqrt(zp * zp + radius * radius) -
+             zm / std::sqrt(zm * zm + radius * radius)) *
+            (b_center * std::sqrt(radius * radius + half_l * half_l) /
+             half_l)};
+
+        b = view.at(0.f, 0.f, z);
+        EXPECT_NEAR(b[0], 0.f, tol);
+        EXPECT_NEAR(b[1], 0.f, tol);
+        EXPECT_NEAR(b[2], b_z, 10.f * tol) << "z = " << z;
+    }
+
+    // Close to uniform in the central region of a long solenoid
+    b = view.at(0.5f * radius, 0.f, 0.f);
+    EXPECT_NEAR(b[0], 0.f, tol);
+    EXPECT_NEAR(b[2], b_center, 0.02f * b_center);
+
+    // Symmetries: rotation around z and mirror at z = 0
+    for (scalar z = 0.f; z <= length; z += 500.f) {
+        for (scalar r = 0.f; r <= 2.f * radius; r += 300.f) {
+            const auto b1 = view.at(r, 0.f, z);
+            const auto b2 = view.at(0.f, r, z);
+            const auto b3 = view.at(r, 0.f, -z);
+
+            EXPECT_NEAR(b1[0], b2[1], tol);
+            EXPECT_NEAR(b1[2], b2[2], tol);
+            EXPECT_NEAR(b1[0], -b3[0], tol);
+            EXPECT_NEAR(b1[2], b3[2], tol);
+        }
+    }
+
+    // The field lines fan out at the ends of the solenoid
+    b = view.at(0.5f * radius, 0.f, half_l);
+    EXPECT_GT(b[0], 0.f);
+    EXPECT_LT(b[2], b_center);
+    b = view.at(0.5f * radius, 0.f, -half_l);
+    EXPECT_LT(b[0], 0.f);
+
+    // Divergence free (away from the current sheet)
+    for (scalar z = -length; z <= length; z += 400.f) {
+        for (scalar r = 100.f; r <= 3.f * radius; r += 350.f) {
+            if (std::abs(r - radius) < 50.f) {
+                continue;
+            }
+            EXPECT_NEAR(divergence(view, 0.8f * r, 0.6f * r, z), 0.f,
+                        1e-3f * b_center / radius);
+        }
+    }
+}
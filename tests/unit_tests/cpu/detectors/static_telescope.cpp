@@ -0,0 +1,114 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/detectors/static_telescope.hpp"
+
+#include "detray/definitions/units.hpp"
+#include "detray/geometry/mask.hpp"
+#include "detray/geometry/shapes/rectangle2D.hpp"
+#include "detray/geometry/shapes/ring2D.hpp"
+#include "detray/navigation/detail/helix.hpp"
+#include "detray/navigation/detail/ray.hpp"
+#include "detray/test/types.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// GTest include
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <cmath>
+#include <type_traits>
+
+using namespace detray;
+
+namespace {
+
+using algebra_t = test::algebra;
+using scalar_t = test::scalar;
+using point3 = test::point3;
+using vector3 = test::vector3;
+
+constexpr scalar_t tol{1e-4f};
+
+using telescope_t = static_telescope<algebra_t, mask<rectangle2D>,
+                                     mask<ring2D>, mask<rectangle2D>>;
+
+// The geometry is a compile time constant
+constexpr telescope_t telescope{{0.f, 50.f, 100.f},
+                                mask<rectangle2D>{0u, 20.f, 20.f},
+                                mask<ring2D>{0u, 0.f, 10.f},
+                                mask<rectangle2D>{0u, 5.f, 5.f}};
+
+}  // anonymous namespace
+
+static_assert(telescope_t::n_planes == 3u);
+static_assert(telescope.position(1u) == 50.f);
+static_assert(std::is_trivially_copyable_v<telescope_t>);
+
+/// Intersect rays with the telescope planes
+GTEST_TEST(detray_detectors, static_telescope_ray) {
+
+    using ray_t = detail::ray<algebra_t>;
+
+    EXPECT_FLOAT_EQ(telescope.get_mask<0>()[0], 20.f);
+    EXPECT_FLOAT_EQ(telescope.get_mask<1>()[1], 10.f);
+    EXPECT_FLOAT_EQ(telescope.transform(2u).translation()[2], 100.f);
+
+    // Parallel to the telescope axis: All planes are hit
+    const ray_t straight{point3{2.f, 2.f, -10.f}, 0.f, vector3{0.f, 0.f, 1.f},
+                         -1.f};
+    auto hits = telescope.intersect(straight);
+
+    EXPECT_EQ(telescope_t::n_hits(hits), 3u);
+    EXPECT_NEAR(hits[0].path, 10.f, tol);
+    EXPECT_NEAR(hits[1].path, 60.f, tol);
+    EXPECT_NEAR(hits[2].path, 110.f, tol);
+    EXPECT_NEAR(hits[0].local[0], 2.f, tol);
+    EXPECT_NEAR(hits[0].local[1], 2.f, tol);
+
+    // Inclined: Misses the small last plane
+    const vector3 dir = vector::normalize(vector3{0.1f, 0.f, 1.f});
+    const ray_t inclined{point3{0.f, 0.f, 0.f}, 0.f, dir, -1.f};
+    hits = telescope.intersect(inclined);
+
+    EXPECT_EQ(telescope_t::n_hits(hits), 2u);
+    EXPECT_EQ(hits[0].status, intersection::status::e_inside);
+    EXPECT_EQ(hits[1].status, intersection::status::e_inside);
+    EXPECT_NEAR(hits[1].path, 50.f * std::sqrt(1.01f), tol);
+    EXPECT_NE(hits[2].status, intersection::status::e_inside);
+
+    // The tolerance on the mask edges is applied to every plane
+    hits = telescope.intersect(inclined, 6.f);
+    EXPECT_EQ(telescope_t::n_hits(hits), 3u);
+}
+
+/// Intersect a helix with the telescope planes
+GTEST_TEST(detray_detectors, static_telescope_helix) {
+
+    using helix_t = detail::helix<algebra_t>;
+    using ray_t = detail::ray<algebra_t>;
+
+    // A stiff track in a field perpendicular to the telescope axis
+    const free_track_parameters<algebra_t> track(
+        point3{1.f, 1.f, -10.f}, 0.f,
+        vector3{0.f, 0.f, 100.f * unit<scalar_t>::GeV}, -1.f);
+    const vector3 B{0.f, 1.f * unit<scalar_t>::T, 0.f};
+
+    const helix_t hlx(track, &B);
+    const auto helix_hits = telescope.intersect(hlx);
+    const auto ray_hits = telescope.intersect(ray_t{track});
+
+    ASSERT_EQ(telescope_t::n_hits(helix_hits), 3u);
+    for (std::size_t i = 0u; i < telescope_t::n_planes; ++i) {
+        EXPECT_NEAR(helix_hits[i].path, ray_hits[i].path, 1e-2f);
+    }
+
+    // The track is bent in x only (cartesian planes)
+    EXPECT_NEAR(helix_hits[2].local[1], ray_hits[2].local[1], tol);
+    EXPECT_GT(std::abs(helix_hits[2].local[0] - ray_hits[2].local[0]), 0.01f);
+}
@@ -9,6 +9,7 @@
 #include "detray/detectors/build_toy_detector.hpp"
 #include "detray/test/toy_detector_test.hpp"
 #include "detray/test/types.hpp"
+#include "detray/utils/consistency_checker.hpp"
 
 // VecMem include(s).
 #include <vecmem/memory/host_memory_resource.hpp>
@@ -16,6 +17,9 @@
 // GTest include(s)
 #include <gtest/gtest.h>
 
+// System include(s)
+#include <exception>
+
 using namespace detray;
 
 // This test check the building of the tml based toy geometry
@@ -29,8 +33,45 @@ GTEST_TEST(detray_detectors, toy_detector) {
 
     EXPECT_TRUE(toy_detector_test(toy_det, names));
 
+    // Prepare the volumes concurrently
+    toy_cfg.n_build_threads(4u);
+    const auto [toy_det_mt, names_mt] = build_toy_detector(host_mr, toy_cfg);
+
+    EXPECT_TRUE(toy_detector_test(toy_det_mt, names_mt));
+
     /*toy_cfg.use_material_maps(true);
     const auto [toy_det2, names2] = build_toy_detector(host_mr, toy_cfg);
 
     EXPECT_TRUE(toy_detector_test(toy_det2, names2));*/
 }
+
+// Run the light and the full consistency check on several threads
+GTEST_TEST(detray_detectors, toy_detector_consistency) {
+
+    vecmem::host_memory_resource host_mr;
+
+    toy_det_config<scalar> toy_cfg{};
+    toy_cfg.use_material_maps(false).do_check(false);
+    auto [toy_det, names] = build_toy_detector(host_mr, toy_cfg);
+
+    using detail::check_level;
+
+    for (const unsigned int n_threads : {1u, 4u}) {
+        EXPECT_TRUE(detail::check_consistency(toy_det, false,
+                                              check_level::e_light, n_threads));
+        EXPECT_TRUE(detail::check_consistency(toy_det, false,
+                                              check_level::e_full, n_threads));
+    }
+
+    // Break the surface lookup
+    toy_det.surfaces()[5u].set_index(7u);
+
+    for (const unsigned int n_threads : {1u, 4u}) {
+        EXPECT_THROW(detail::check_consistency(toy_det, false,
+                                               check_level::e_light, n_threads),
+                     std::exception);
+        EXPECT_THROW(detail::check_consistency(toy_det, false,
+                                               check_level::e_full, n_threads),
+                     std::exception);
+    }
+}
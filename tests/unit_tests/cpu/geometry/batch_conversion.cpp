@@ -0,0 +1,128 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/geometry/batch_conversion.hpp"
+
+#include "detray/definitions/track_parametrization.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/build_toy_detector.hpp"
+#include "detray/detectors/toy_metadata.hpp"
+#include "detray/geometry/surface.hpp"
+#include "detray/test/types.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <cmath>
+#include <vector>
+
+namespace {
+
+constexpr detray::scalar tol{1e-5f};
+
+}  // anonymous namespace
+
+/// Compare the batched conversions to the conversions of the surface facade
+GTEST_TEST(detray_geometry, batch_conversion) {
+
+    using namespace detray;
+
+    using detector_t = detector<toy_metadata>;
+    using algebra_t = typename detector_t::algebra_type;
+    using surface_t = typename detector_t::surface_type;
+    using point2_t = dpoint2D<algebra_t>;
+    using point3_t = dpoint3D<algebra_t>;
+    using vector3_t = dvector3D<algebra_t>;
+    using free_vector_t = free_vector<algebra_t>;
+    using bound_vector_t = bound_vector<algebra_t>;
+
+    vecmem::host_memory_resource host_mr;
+    const auto [toy_det, names] = build_toy_detector(host_mr);
+    const typename detector_t::geometry_context ctx{};
+
+    // One element on every surface of the detector, in the detector order
+    // (mixed mask types)
+    const vector3_t dir{vector::normalize(vector3_t{1.f, 1.f, 1.f})};
+    const point2_t bound{1.f * unit<scalar>::mm, 2.f * unit<scalar>::mm};
+
+    std::vector<surface_t> surfaces{};
+    std::vector<point3_t> globals{};
+    std::vector<vector3_t> dirs{};
+    std::vector<free_vector_t> free_vecs{};
+    for (const auto &sf_desc : toy_det.surfaces()) {
+        const detray::surface sf{toy_det, sf_desc};
+        const point3_t glob{sf.bound_to_global(ctx, bound, dir)};
+
+        surfaces.push_back(sf_desc);
+        globals.push_back(glob);
+        dirs.push_back(dir);
+        free_vecs.push_back(
+            free_track_parameters<algebra_t>{glob, 0.f, dir, -1.f}.vector());
+    }
+    const auto n{static_cast<unsigned int>(surfaces.size())};
+
+    // The grouping is a permutation of the batch, ordered by mask type
+    const auto groups = geometry::group_by_mask(toy_det, surfaces);
+    ASSERT_EQ(groups.order.size(), n);
+    ASSERT_EQ(groups.offsets.back(), n);
+    std::vector<bool> seen(n, false);
+    for (unsigned int pos = 0u; pos < n; ++pos) {
+        const unsigned int i{groups.order[pos]};
+        ASSERT_LT(i, n);
+        EXPECT_FALSE(seen[i]);
+        seen[i] = true;
+        EXPECT_EQ(static_cast<std::size_t>(surfaces[i].mask().id()),
+                  groups.group_of(groups.offsets, pos));
+    }
+
+    std::vector<point2_t> bound_pos(n);
+    std::vector<point3_t> local_pos(n);
+    std::vector<bound_vector_t> bound_vecs(n);
+    std::vector<free_vector_t> free_vecs_out(n);
+
+    geometry::global_to_bound(toy_det, groups, surfaces, globals, dirs,
+                              bound_pos, ctx);
+    geometry::global_to_local(toy_det, groups, surfaces, globals, dirs,
+                              local_pos, ctx);
+    geometry::free_to_bound_vector(toy_det, groups, surfaces, free_vecs,
+                                   bound_vecs, ctx);
+    geometry::bound_to_free_vector(toy_det, groups, surfaces, bound_vecs,
+                                   free_vecs_out, ctx);
+
+    for (unsigned int i = 0u; i < n; ++i) {
+        const detray::surface sf{toy_det, surfaces[i]};
+
+        const point2_t exp_bound{sf.global_to_bound(ctx, globals[i], dir)};
+        EXPECT_NEAR(bound_pos[i][0], exp_bound[0], tol);
+        EXPECT_NEAR(bound_pos[i][1], exp_bound[1], tol);
+
+        const point3_t exp_local{sf.global_to_local(ctx, globals[i], dir)};
+        for (unsigned int j = 0u; j < 3u; ++j) {
+            EXPECT_NEAR(local_pos[i][j], exp_local[j], tol);
+        }
+
+        const bound_vector_t exp_bound_vec{
+            sf.free_to_bound_vector(ctx, free_vecs[i])};
+        for (unsigned int j = 0u; j < e_bound_size; ++j) {
+            EXPECT_NEAR(getter::element(bound_vecs[i], j, 0u),
+                        getter::element(exp_bound_vec, j, 0u), tol);
+        }
+
+        // Round trip
+        for (unsigned int j = 0u; j < e_free_size; ++j) {
+            const scalar exp_val{getter::element(free_vecs[i], j, 0u)};
+            EXPECT_NEAR(getter::element(free_vecs_out[i], j, 0u), exp_val,
+                        tol * (1.f + std::abs(exp_val)));
+        }
+    }
+}
@@ -0,0 +1,155 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/geometry/detail/compact_transform.hpp"
+
+#include "detray/core/detail/multi_context_store.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/geometry/detail/surface_descriptor.hpp"
+#include "detray/geometry/mask.hpp"
+#include "detray/geometry/shapes/cylinder2D.hpp"
+#include "detray/geometry/shapes/line.hpp"
+#include "detray/geometry/shapes/rectangle2D.hpp"
+#include "detray/navigation/detail/ray.hpp"
+#include "detray/navigation/intersection/ray_intersector.hpp"
+#include "detray/test/types.hpp"
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+using namespace detray;
+
+namespace {
+
+// Three-dimensional definitions
+using algebra_t = test::algebra;
+using vector3 = test::vector3;
+using point3 = test::point3;
+using transform3 = test::transform3;
+using compact_transform3 = compact_transform3D<algebra_t>;
+
+// Tolerances of the single precision storage
+constexpr scalar tol{1e-4f};
+constexpr scalar is_tol{1e-3f};
+
+/// @returns a rotated and shifted test transform
+transform3 make_transform() {
+    const vector3 z = vector::normalize(vector3{1.f, 1.f, 1.f});
+    const vector3 x = vector::normalize(vector3{1.f, -1.f, 0.f});
+    return transform3{point3{3.f, -2.f, 10.f}, z, x, true};
+}
+
+}  // anonymous namespace
+
+/// Compare the compact transform to the full transform
+GTEST_TEST(detray_geometry, compact_transform) {
+
+    // Only the rotation and translation are stored, in single precision
+    EXPECT_EQ(sizeof(compact_transform3), 12u * sizeof(float));
+    EXPECT_LT(sizeof(compact_transform3), sizeof(transform3));
+
+    // Identity
+    const compact_transform3 identity{};
+    const point3 p{1.f, 2.f, 3.f};
+    EXPECT_NEAR(identity.point_to_global(p)[0], 1.f, tol);
+    EXPECT_NEAR(identity.point_to_local(p)[1], 2.f, tol);
+    EXPECT_NEAR(identity.vector_to_global(p)[2], 3.f, tol);
+
+    const transform3 trf = make_transform();
+    const compact_transform3 ctrf{trf};
+
+    for (unsigned int i = 0u; i < 3u; ++i) {
+        EXPECT_NEAR(ctrf.translation()[i], trf.translation()[i], tol);
+        EXPECT_NEAR(ctrf.x()[i], trf.x()[i], tol);
+        EXPECT_NEAR(ctrf.y()[i], trf.y()[i], tol);
+        EXPECT_NEAR(ctrf.z()[i], trf.z()[i], tol);
+    }
+
+    const point3 glob_p{-4.f, 7.f, 0.5f};
+    const vector3 v{0.3f, -0.2f, 0.9f};
+    const auto loc_p = trf.point_to_local(glob_p);
+    const auto c_loc_p = ctrf.point_to_local(glob_p);
+    const auto c_glob_p = ctrf.point_to_global(c_loc_p);
+    const auto loc_v = trf.vector_to_local(v);
+    const auto c_loc_v = ctrf.vector_to_local(v);
+    const auto c_glob_v = ctrf.vector_to_global(c_loc_v);
+
+    for (unsigned int i = 0u; i < 3u; ++i) {
+        EXPECT_NEAR(c_loc_p[i], loc_p[i], tol);
+        EXPECT_NEAR(c_glob_p[i], glob_p[i], tol);
+        EXPECT_NEAR(c_loc_v[i], loc_v[i], tol);
+        EXPECT_NEAR(c_glob_v[i], v[i], tol);
+    }
+
+    // Conversion back to the full transform
+    const transform3 full = ctrf;
+    const auto full_loc_p = full.point_to_local(glob_p);
+    for (unsigned int i = 0u; i < 3u; ++i) {
+        EXPECT_NEAR(full_loc_p[i], loc_p[i], tol);
+    }
+
+    EXPECT_TRUE(ctrf == compact_transform3{trf});
+    EXPECT_FALSE(ctrf == identity);
+
+    // Compact transforms in a transform store
+    multi_context_store<compact_transform3> store;
+    store.push_back(trf);
+    store.push_back(transform3{point3{0.f, 0.f, 1.f}});
+    ASSERT_EQ(store.size(), 2u);
+    EXPECT_TRUE(store.at(0u, {}) == ctrf);
+    EXPECT_NEAR(store.at(1u, {}).translation()[2], 1.f, tol);
+}
+
+/// Intersect surfaces that are placed by a compact transform
+GTEST_TEST(detray_geometry, compact_transform_intersection) {
+
+    const transform3 trf = make_transform();
+    const compact_transform3 ctrf{trf};
+
+    const detail::ray<algebra_t> r(point3{0.f, 0.f, 0.f}, 0.f,
+                                   vector::normalize(vector3{1.f, 0.5f, 2.f}),
+                                   0.f);
+
+    // Plane
+    mask<rectangle2D> rect{0u, 100.f, 100.f};
+    ray_intersector<rectangle2D, algebra_t> pi;
+
+    const auto hit = pi(r, surface_descriptor<>{}, rect, trf);
+    const auto c_hit = pi(r, surface_descriptor<>{}, rect, ctrf);
+
+    ASSERT_EQ(hit.status, intersection::status::e_inside);
+    EXPECT_EQ(c_hit.status, hit.status);
+    EXPECT_NEAR(c_hit.path, hit.path, is_tol);
+    EXPECT_NEAR(c_hit.local[0], hit.local[0], is_tol);
+    EXPECT_NEAR(c_hit.local[1], hit.local[1], is_tol);
+
+    // Cylinder around the ray origin
+    const transform3 cyl_trf{point3{0.f, 0.f, 0.f}, trf.z(), trf.x(), true};
+    mask<cylinder2D> cyl{0u, 4.f, -100.f, 100.f};
+    ray_intersector<cylinder2D, algebra_t> ci;
+
+    const auto cyl_hits = ci(r, surface_descriptor<>{}, cyl, cyl_trf);
+    const auto c_cyl_hits =
+        ci(r, surface_descriptor<>{}, cyl, compact_transform3{cyl_trf});
+
+    for (std::size_t i = 0u; i < 2u; ++i) {
+        EXPECT_EQ(c_cyl_hits[i].status, cyl_hits[i].status);
+        EXPECT_NEAR(c_cyl_hits[i].path, cyl_hits[i].path, is_tol);
+    }
+
+    // Line
+    mask<line_circular> ln{0u, 10.f * unit<scalar>::mm, 100.f};
+    ray_intersector<line_circular, algebra_t> li;
+
+    const auto ln_hit = li(r, surface_descriptor<>{}, ln, trf);
+    const auto c_ln_hit = li(r, surface_descriptor<>{}, ln, ctrf);
+
+    EXPECT_EQ(c_ln_hit.status, ln_hit.status);
+    EXPECT_NEAR(c_ln_hit.path, ln_hit.path, is_tol);
+    EXPECT_NEAR(c_ln_hit.local[0], ln_hit.local[0], is_tol);
+}
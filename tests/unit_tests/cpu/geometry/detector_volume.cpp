@@ -9,11 +9,16 @@
 #include "detray/definitions/units.hpp"
 #include "detray/detectors/build_toy_detector.hpp"
 #include "detray/geometry/detail/volume_descriptor.hpp"
+#include "detray/geometry/detail/volume_kernels.hpp"
+#include "detray/navigation/detail/ray.hpp"
 #include "detray/test/types.hpp"
 
 // GTest include(s)
 #include <gtest/gtest.h>
 
+// System include(s)
+#include <vector>
+
 // TODO: Move these into the test defs
 namespace {
 
@@ -31,6 +36,34 @@ enum accel_ids : unsigned int {
     e_grid = 1,
 };
 
+/// Accelerator that returns a fixed set of surfaces for every search
+template <typename surface_t>
+struct mock_accelerator {
+    std::vector<surface_t> m_surfaces;
+
+    template <typename... Args>
+    auto search(Args &&...) const {
+        return m_surfaces;
+    }
+};
+
+/// Accelerator collection that contains a single mock accelerator
+template <typename surface_t>
+struct mock_accel_group {
+    mock_accelerator<surface_t> m_accel;
+
+    const auto &operator[](const detray::dindex) const { return m_accel; }
+};
+
+/// Record the indices of the visited surfaces
+struct record_surfaces {
+    template <typename surface_t>
+    void operator()(const surface_t &sf,
+                    std::vector<detray::dindex> &indices) const {
+        indices.push_back(sf.index());
+    }
+};
+
 }  // namespace
 
 // This tests the detector volume class and its many links
@@ -194,3 +227,52 @@ GTEST_TEST(detray_geometry, detector_volume) {
     }
     EXPECT_TRUE(sf_indices.empty());
 }
+
+/// This tests the deduplication of surfaces in a neighborhood search
+GTEST_TEST(detray_geometry, unique_neighborhood) {
+
+    using namespace detray;
+
+    vecmem::host_memory_resource host_mr;
+    const auto [toy_det, names] = build_toy_detector(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using surface_t = typename detector_t::surface_type;
+
+    // Barrel layer: surfaces 372 to 600
+    const auto &vol_desc = toy_det.volume(7u);
+
+    // Every surface appears in a number of neighboring bins
+    mock_accel_group<surface_t> group{};
+    std::vector<dindex> expected{};
+    for (dindex i = 372u; i < 400u; ++i) {
+        for (dindex n = 0u; n <= i % 4u; ++n) {
+            group.m_accel.m_surfaces.push_back(toy_det.surface(i));
+        }
+        expected.push_back(i);
+    }
+
+    const detail::ray<test::algebra> trk({0.f, 0.f, 0.f}, 0.f,
+                                         {1.f, 0.f, 0.f}, -1.f);
+    struct navigation_cfg {
+        std::array<dindex, 2> search_window;
+    };
+
+    // All surfaces, including the duplicates
+    std::vector<dindex> sf_indices{};
+    detail::neighborhood_getter<record_surfaces>{}(
+        group, 0u, toy_det, vol_desc, trk, navigation_cfg{}, sf_indices);
+    EXPECT_EQ(sf_indices.size(), group.m_accel.m_surfaces.size());
+
+    // Every surface once, in the order in which they were first found
+    sf_indices.clear();
+    detail::unique_neighborhood_getter<record_surfaces>{}(
+        group, 0u, toy_det, vol_desc, trk, navigation_cfg{}, sf_indices);
+    EXPECT_EQ(sf_indices, expected);
+
+    // Surfaces beyond the capacity of the bitmap are passed through
+    sf_indices.clear();
+    detail::unique_neighborhood_getter<record_surfaces, 0u>{}(
+        group, 0u, toy_det, vol_desc, trk, navigation_cfg{}, sf_indices);
+    EXPECT_EQ(sf_indices.size(), group.m_accel.m_surfaces.size());
+}
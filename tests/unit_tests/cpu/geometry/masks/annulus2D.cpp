@@ -116,6 +116,49 @@ GTEST_TEST(detray_masks, annulus2D) {
     ASSERT_NEAR(centroid[2], 0.f, tol);*/
 }
 
+/// This tests the batched inside check of a stereo annulus
+GTEST_TEST(detray_masks, annulus2D_batch) {
+    using point_t = point3_t;
+
+    constexpr scalar minR{7.2f * unit<scalar>::mm};
+    constexpr scalar maxR{12.0f * unit<scalar>::mm};
+    constexpr scalar minPhi{0.74195f};
+    constexpr scalar maxPhi{1.33970f};
+    point_t offset = {-2.f, 2.f, 0.f};
+
+    mask<annulus2D> ann2{0u,     minR, maxR,      minPhi,
+                         maxPhi, 0.f,  offset[0], offset[1]};
+
+    // points in cartesian module frame
+    const darray<point_t, 5> points{point_t{7.f, 7.f, 0.f},
+                                    point_t{5.f, 5.f, 0.f},
+                                    point_t{10.f, 3.f, 0.f},
+                                    point_t{10.f, 10.f, 0.f},
+                                    point_t{4.f, 10.f, 0.f}};
+
+    // Polar coordinates in the strip frame
+    darray<scalar, 5> loc0;
+    darray<scalar, 5> loc1;
+    for (std::size_t i = 0u; i < points.size(); ++i) {
+        const point_t shifted = points[i] + offset;
+        loc0[i] = getter::perp(shifted);
+        loc1[i] = getter::phi(shifted);
+    }
+
+    EXPECT_EQ(ann2.is_inside(loc0, loc1), 0b00001u);
+
+    // Same result as the single point check
+    for (const scalar t : {tol, 0.07f, 1.3f}) {
+        const auto is_inside = ann2.is_inside(loc0, loc1, t);
+        for (std::size_t i = 0u; i < points.size(); ++i) {
+            const bool is_in{
+                ann2.is_inside(point_t{loc0[i], loc1[i], 0.f}, t) ==
+                intersection::status::e_inside};
+            EXPECT_EQ(((is_inside >> i) & 1u) == 1u, is_in);
+        }
+    }
+}
+
 /// This tests the inside/outside method of the mask
 GTEST_TEST(detray_masks, annulus2D_ratio_test) {
 
@@ -65,6 +65,19 @@ GTEST_TEST(detray_masks, ring2D) {
     ASSERT_NEAR(centroid[2], 0.f, tol);
 }
 
+/// This tests the batched inside check of a ring
+GTEST_TEST(detray_masks, ring2D_batch) {
+
+    mask<ring2D> r2{0u, 0.f * unit<scalar>::mm, 3.5f * unit<scalar>::mm};
+
+    const darray<scalar, 4> loc0{0.5f, 3.5f, 3.6f, 5.f};
+    const darray<scalar, 4> loc1{-2.f, 0.f, 5.f, 1.f};
+
+    EXPECT_EQ(r2.is_inside(loc0, loc1), 0b0011u);
+    // Move outside point inside using a tolerance
+    EXPECT_EQ(r2.is_inside(loc0, loc1, 1.2f), 0b0111u);
+}
+
 /// This tests the inside/outside method of the mask
 GTEST_TEST(detray_masks, ring2D_ratio_test) {
 
@@ -67,6 +67,27 @@ GTEST_TEST(detray_masks, trapezoid2D) {
     ASSERT_NEAR(centroid[2], 0.f, tol);
 }
 
+/// This tests the batched inside check of a trapezoid
+GTEST_TEST(detray_masks, trapezoid2D_batch) {
+
+    constexpr scalar hy{2.f * unit<scalar>::mm};
+    mask<trapezoid2D> t2{0u, 1.f * unit<scalar>::mm, 3.f * unit<scalar>::mm,
+                         hy, 1.f / (2.f * hy)};
+
+    const darray<scalar, 4> loc0{1.f, 2.5f, 3.f, -2.f};
+    const darray<scalar, 4> loc1{-0.5f, 1.f, 1.5f, -1.f};
+
+    const auto is_inside = t2.is_inside(loc0, loc1);
+    EXPECT_EQ(is_inside, 0b0011u);
+
+    // Same result as the single point check
+    for (std::size_t i = 0u; i < loc0.size(); ++i) {
+        const bool is_in{t2.is_inside(point3_t{loc0[i], loc1[i], 0.f}) ==
+                         intersection::status::e_inside};
+        EXPECT_EQ(((is_inside >> i) & 1u) == 1u, is_in);
+    }
+}
+
 /// This tests the inside/outside method of the mask
 GTEST_TEST(detray_masks, trapezoid2D_ratio_test) {
 
@@ -0,0 +1,163 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/geometry/detail/packed_surface_descriptor.hpp"
+
+#include "detray/core/detector.hpp"
+#include "detray/detectors/toy_metadata.hpp"
+#include "detray/geometry/detail/surface_descriptor.hpp"
+#include "detray/navigation/accelerators/surface_grid.hpp"
+#include "detray/navigation/intersection/intersection.hpp"
+#include "detray/test/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <type_traits>
+#include <utility>
+
+using namespace detray;
+
+namespace {
+
+/// Toy detector with packed surface descriptors
+struct packed_toy_metadata : public toy_metadata {
+
+    using surface_type =
+        packed_surface_descriptor<mask_link, material_link, transform_link,
+                                  nav_link>;
+
+    template <template <typename...> class tuple_t = dtuple,
+              typename container_t = host_container_types>
+    using accelerator_store = multi_store<
+        accel_ids, empty_context, tuple_t,
+        brute_force_collection<surface_type, container_t>,
+        grid_collection<disc_sf_grid<surface_type, container_t>>,
+        grid_collection<cylinder_sf_grid<surface_type, container_t>>>;
+};
+
+using mask_link_t = toy_metadata::mask_link;
+using material_link_t = toy_metadata::material_link;
+using mask_id = toy_metadata::mask_ids;
+using material_id = toy_metadata::material_ids;
+using packed_surface_t = packed_toy_metadata::surface_type;
+
+}  // anonymous namespace
+
+/// Encode and decode the links of a packed surface descriptor
+GTEST_TEST(detray_geometry, packed_surface_descriptor) {
+
+    static_assert(sizeof(packed_surface_t) == 16u);
+    static_assert(sizeof(packed_surface_t) <
+                  sizeof(toy_metadata::surface_type));
+    static_assert(detail::is_surface_descriptor_v<packed_surface_t>);
+    static_assert(
+        detail::is_surface_descriptor_v<toy_metadata::surface_type>);
+
+    // Intersections shrink accordingly
+    using intersection_t = intersection2D<packed_surface_t, test::algebra>;
+    using full_intersection_t =
+        intersection2D<toy_metadata::surface_type, test::algebra>;
+    static_assert(sizeof(intersection_t) < sizeof(full_intersection_t));
+
+    // Default: Invalid links
+    packed_surface_t sf{};
+    EXPECT_TRUE(sf.mask().is_invalid());
+    EXPECT_TRUE(sf.material().is_invalid());
+    EXPECT_TRUE(sf.barcode().is_invalid());
+    EXPECT_EQ(sf.transform(), 0u);
+
+    const mask_link_t mask_link{mask_id::e_trapezoid2, 1025u};
+    const material_link_t mat_link{material_id::e_slab, 200000u};
+
+    sf = packed_surface_t{42u, mask_link, mat_link, 7u,
+                          surface_id::e_sensitive};
+    sf.set_index(12u);
+
+    EXPECT_EQ(sf.transform(), 42u);
+    EXPECT_EQ(sf.mask(), mask_link);
+    EXPECT_EQ(sf.mask().id(), mask_id::e_trapezoid2);
+    EXPECT_EQ(sf.mask().index(), 1025u);
+    EXPECT_EQ(sf.material(), mat_link);
+    EXPECT_EQ(sf.volume(), 7u);
+    EXPECT_EQ(sf.index(), 12u);
+    EXPECT_TRUE(sf.is_sensitive());
+
+    // Compare to the full surface descriptor
+    const toy_metadata::surface_type full_sf{42u, mask_link, mat_link, 7u,
+                                             surface_id::e_sensitive};
+    EXPECT_EQ(sf.mask(), full_sf.mask());
+    EXPECT_EQ(sf.material(), full_sf.material());
+    EXPECT_EQ(sf.transform(), full_sf.transform());
+
+    // Update the links
+    sf.update_transform(10u);
+    sf.update_mask(5u);
+    sf.update_material(3u);
+    EXPECT_EQ(sf.transform(), 52u);
+    EXPECT_EQ(sf.mask().index(), 1030u);
+    EXPECT_EQ(sf.mask().id(), mask_id::e_trapezoid2);
+    EXPECT_EQ(sf.material().index(), 200003u);
+
+    // Write through the material proxy
+    sf.material() = material_link_t{material_id::e_disc2_map, 3u};
+    EXPECT_EQ(sf.material().id(), material_id::e_disc2_map);
+    EXPECT_EQ(sf.material().index(), 3u);
+    sf.material().set_index(4u);
+    EXPECT_EQ(std::as_const(sf).material().index(), 4u);
+    EXPECT_EQ(sf.mask().index(), 1030u);
+    EXPECT_EQ(sf.transform(), 52u);
+
+    // Invalid material
+    sf.material() = material_link_t{};
+    EXPECT_TRUE(sf.material().is_invalid());
+    EXPECT_FALSE(sf.mask().is_invalid());
+
+    // Invalid transform
+    sf = packed_surface_t{dindex_invalid, mask_link, mat_link, 7u,
+                          surface_id::e_portal};
+    EXPECT_EQ(sf.transform(), dindex_invalid);
+    EXPECT_TRUE(sf.is_portal());
+}
+
+/// Select the packed surface descriptor through the detector metadata
+GTEST_TEST(detray_geometry, packed_surface_descriptor_metadata) {
+
+    using detector_t = detector<packed_toy_metadata>;
+    using accel_store_t = typename detector_t::accelerator_container;
+    using cyl_grid_t = typename accel_store_t::template get_type<
+        packed_toy_metadata::accel_ids::e_cylinder2_grid>::value_type;
+
+    static_assert(
+        std::is_same_v<typename detector_t::surface_type, packed_surface_t>);
+    static_assert(std::is_same_v<typename cyl_grid_t::value_type,
+                                 packed_surface_t>);
+    static_assert(detail::is_surface_grid_v<cyl_grid_t>);
+
+    // Fill the detector surface lookup
+    vecmem::host_memory_resource host_mr;
+    detector_t det{host_mr};
+
+    const mask_link_t mask_link{mask_id::e_rectangle2, 3u};
+    const material_link_t mat_link{material_id::e_slab, 5u};
+    packed_surface_t sf{1u, mask_link, mat_link, 0u, surface_id::e_sensitive};
+    sf.set_index(0u);
+    det.surfaces().push_back(sf, 0u);
+
+    ASSERT_EQ(det.surfaces().size(), 1u);
+    EXPECT_EQ(det.surface(0u).mask(), mask_link);
+    EXPECT_EQ(det.surface(0u).material(), mat_link);
+
+    // Compressed grid entries can be filled from the packed descriptor
+    const surface_index_entry entry{sf};
+    EXPECT_EQ(entry.index(), 0u);
+}
@@ -10,10 +10,19 @@
 #include "detray/geometry/mask.hpp"
 #include "detray/geometry/shapes.hpp"
 #include "detray/materials/material_map.hpp"
+#include "detray/materials/material_mapping.hpp"
+#include "detray/test/types.hpp"
+#include "detray/utils/grid/grid_collection.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
 
 // GTest include(s)
 #include <gtest/gtest.h>
 
+// System include(s)
+#include <vector>
+
 using namespace detray;
 using namespace detray::axis;
 
@@ -239,3 +248,62 @@ GTEST_TEST(detray_material, trapezoid_map) {
     EXPECT_FALSE(trapezoid_map.at(199, 0) ==
                  material_t(aluminium<scalar>{}, 201.f * unit<scalar>::mm));
 }
+
+/// Unittest: Test the binning of material recordings into material maps
+GTEST_TEST(detray_material, material_mapping) {
+
+    using algebra_t = test::algebra;
+    using point2 = test::point2;
+    using map_t = material_map<rectangle2D, scalar>;
+
+    constexpr scalar tol{1e-5f};
+    constexpr scalar mm{unit<scalar>::mm};
+
+    vecmem::host_memory_resource host_mr;
+    grid_collection<map_t> maps(&host_mr);
+    const mask<rectangle2D> r0{0u, 10.f, 10.f};
+    const mask<rectangle2D> r1{0u, 5.f, 5.f};
+    maps.push_back(mat_map_factory.new_grid(r0, {10u, 10u}));
+    maps.push_back(mat_map_factory.new_grid(r1, {2u, 2u}));
+
+    std::vector<material_bin_sums<scalar>> sums(maps.bin_storage().size());
+    ASSERT_EQ(sums.size(), 104u);
+
+    // Silicon in a bin of the first map, silicon and gold in the second
+    const std::vector<material_recording<algebra_t>> recordings{
+        {0u, point2{0.5f, 0.5f}, material_t(silicon<scalar>{}, 1.f * mm)},
+        {0u, point2{0.6f, 0.7f}, material_t(silicon<scalar>{}, 3.f * mm)},
+        {1u, point2{-2.f, -2.f}, material_t(silicon<scalar>{}, 1.f * mm)},
+        {1u, point2{-2.f, -2.f}, material_t(gold<scalar>{}, 1.f * mm)}};
+
+    for (const auto &rec : recordings) {
+        accumulate_material(maps, sums, rec);
+    }
+    for (dindex i = 0u; i < sums.size(); ++i) {
+        finalize_material_bin(maps, sums, i);
+    }
+
+    // Average of the same material
+    const material_t slab0 = *maps[0].search(point2{0.5f, 0.5f});
+    EXPECT_NEAR(slab0.thickness(), 2.f * mm, tol);
+    EXPECT_NEAR(slab0.get_material().X0(), silicon<scalar>{}.X0(),
+                tol * silicon<scalar>{}.X0());
+    EXPECT_NEAR(slab0.get_material().mass_density(),
+                silicon<scalar>{}.mass_density(),
+                tol * silicon<scalar>{}.mass_density());
+
+    // Average of two materials: Same thickness in X0 and mass
+    const material_t slab1 = *maps[1].search(point2{-2.f, -2.f});
+    const scalar t_in_X0{0.5f * mm *
+                         (1.f / silicon<scalar>{}.X0() +
+                          1.f / gold<scalar>{}.X0())};
+    const scalar rho{0.5f * (silicon<scalar>{}.mass_density() +
+                             gold<scalar>{}.mass_density())};
+    EXPECT_NEAR(slab1.thickness(), 1.f * mm, tol);
+    EXPECT_NEAR(slab1.thickness_in_X0(), t_in_X0, tol * t_in_X0);
+    EXPECT_NEAR(slab1.get_material().mass_density(), rho, tol * rho);
+
+    // Bins without recordings
+    EXPECT_FALSE(static_cast<bool>(*maps[0].search(point2{-9.f, -9.f})));
+    EXPECT_FALSE(static_cast<bool>(*maps[1].search(point2{2.f, 2.f})));
+}
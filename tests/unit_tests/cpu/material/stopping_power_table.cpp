@@ -0,0 +1,114 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "detray/detectors/build_toy_detector.hpp"
+#include "detray/materials/interaction.hpp"
+#include "detray/materials/interaction_table.hpp"
+#include "detray/materials/material.hpp"
+#include "detray/materials/material_slab.hpp"
+#include "detray/materials/predefined_materials.hpp"
+#include "detray/propagator/actors/pointwise_material_interactor.hpp"
+#include "detray/test/types.hpp"
+
+// Vecmem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <algorithm>
+#include <vector>
+
+using namespace detray;
+using algebra_t = test::algebra;
+
+namespace {
+
+// Muon mass
+constexpr scalar mass{105.7f * unit<scalar>::MeV};
+
+// Relative tolerance of the interpolation
+constexpr scalar rel_tol{1e-2f};
+
+}  // anonymous namespace
+
+// Compare the tabulated with the analytic stopping power
+GTEST_TEST(detray_material, stopping_power_table) {
+
+    const std::vector<material<scalar>> materials{
+        hydrogen_liquid<scalar>(), beryllium<scalar>(), silicon<scalar>(),
+        argon_liquid<scalar>(), iron<scalar>(), tungsten<scalar>()};
+
+    for (const auto& mat : materials) {
+
+        const stopping_power_table<scalar> table(mat, mass);
+
+        EXPECT_TRUE(table.matches(mat, mass));
+        EXPECT_FALSE(table.matches(mat, 0.5f * mass));
+        EXPECT_FALSE(table.matches(vacuum<scalar>(), mass));
+
+        for (const scalar p : {0.05f, 0.1f, 0.5f, 1.f, 10.f, 100.f, 1000.f}) {
+            const scalar qop{-1.f / (p * unit<scalar>::GeV)};
+            const scalar log_bg{-math::log(mass * math::abs(qop))};
+            ASSERT_TRUE(table.in_range(log_bg));
+
+            const scalar expected{interaction<scalar>().compute_bethe_bloch(
+                mat, pdg_particle::eMuon,
+                detail::relativistic_quantities<scalar>(mass, qop, -1.f))};
+
+            EXPECT_NEAR((table(log_bg) - expected) / expected, 0.f, rel_tol)
+                << mat.to_string() << ", p = " << p << " GeV";
+        }
+    }
+}
+
+// Compare the energy loss of the material interactor with and without the
+// stopping power tables
+GTEST_TEST(detray_material, stopping_power_table_interactor) {
+
+    vecmem::host_memory_resource host_mr;
+
+    using interactor_t = pointwise_material_interactor<algebra_t>;
+    using table_t = typename interactor_t::stopping_power_table_type;
+
+    // Build the tables for the materials of the toy detector
+    const auto [det, names] = build_toy_detector(host_mr);
+    const auto materials = collect_materials(det);
+
+    ASSERT_FALSE(materials.empty());
+    EXPECT_TRUE(std::find(materials.begin(), materials.end(),
+                          silicon_tml<scalar>()) != materials.end());
+    EXPECT_TRUE(std::find(materials.begin(), materials.end(),
+                          vacuum<scalar>()) == materials.end());
+
+    auto tables = make_stopping_power_tables(materials, mass, host_mr);
+    ASSERT_EQ(tables.size(), materials.size());
+
+    interactor_t::state analytic_state{};
+    analytic_state.mass = mass;
+
+    interactor_t::state table_state{analytic_state};
+    table_state.stopping_power_tables = vecmem::get_data(
+        static_cast<const dvector<table_t>&>(tables));
+
+    const material_slab<scalar> slab(silicon_tml<scalar>(),
+                                     0.15f * unit<scalar>::mm);
+    const scalar path_segment{slab.path_segment(1.f)};
+
+    for (const scalar p : {0.1f, 1.f, 10.f, 100.f}) {
+        const scalar qop{1.f / (p * unit<scalar>::GeV)};
+
+        const scalar e_loss{interactor_t::kernel{}.energy_loss(
+            analytic_state, slab.get_material(), path_segment, qop, 1.f)};
+        const scalar e_loss_table{interactor_t::kernel{}.energy_loss(
+            table_state, slab.get_material(), path_segment, qop, 1.f)};
+
+        EXPECT_NEAR((e_loss_table - e_loss) / e_loss, 0.f, rel_tol);
+    }
+}
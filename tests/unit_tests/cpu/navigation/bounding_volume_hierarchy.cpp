@@ -0,0 +1,154 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Detray include(s)
+#include "detray/navigation/accelerators/bounding_volume_hierarchy.hpp"
+
+#include "detray/navigation/detail/ray.hpp"
+#include "detray/test/types.hpp"
+#include "detray/test/utils/planes_along_direction.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+vecmem::host_memory_resource host_mr;
+
+// Algebra definitions
+using vector3 = test::vector3;
+
+/// The hierarchy search does not need the detector
+struct dummy_detector {
+    using volume_type = dindex;
+};
+
+struct navigation_cfg {
+    scalar mask_tolerance{0.01f};
+};
+
+}  // anonymous namespace
+
+/// Test the construction of the hierarchies and the line search
+GTEST_TEST(detray_navigation, bvh_collection) {
+
+    // Where to place the surfaces
+    dvector<scalar> distances1{0.f, 10.0f, 20.0f, 40.0f, 80.0f, 100.0f,
+                               120.0f, 150.0f, 200.0f, 250.0f, 300.0f};
+    dvector<scalar> distances2{30.0f, 230.0f, 240.0f};
+    // surface direction
+    vector3 direction{0.f, 0.f, 1.f};
+
+    auto surfaces1 = test::planes_along_direction(distances1, direction);
+    auto surfaces2 = test::planes_along_direction(distances2, direction);
+
+    using surface_t = typename decltype(surfaces1)::value_type;
+    using bvh_t = bvh_collection<surface_t>;
+    using aabb_t = typename bvh_t::aabb_type;
+
+    // Thin boxes around the planes
+    auto make_boxes = [](const dvector<scalar>& distances) {
+        std::vector<aabb_t> boxes{};
+        for (const scalar d : distances) {
+            boxes.emplace_back(boxes.size(), -10.f, -10.f, d - 0.1f, 10.f,
+                               10.f, d + 0.1f);
+        }
+        return boxes;
+    };
+
+    bvh_t bvh_coll(&host_mr);
+
+    // Check a few basics
+    ASSERT_TRUE(bvh_coll.empty());
+
+    constexpr dindex max_leaf_size{2u};
+    bvh_coll.push_back(surfaces1, make_boxes(distances1), max_leaf_size);
+    EXPECT_EQ(bvh_coll.size(), 1UL);
+    bvh_coll.push_back(surfaces2, make_boxes(distances2), max_leaf_size);
+    EXPECT_EQ(bvh_coll.size(), 2UL);
+
+    ASSERT_FALSE(bvh_coll.empty());
+    ASSERT_EQ(bvh_coll.all().size(), distances1.size() + distances2.size());
+
+    // Check a single hierarchy
+    const auto bvh1 = bvh_coll[0];
+    const auto bvh2 = bvh_coll[1];
+    EXPECT_EQ(bvh1.size(), distances1.size());
+    EXPECT_EQ(bvh2.size(), distances2.size());
+    EXPECT_EQ(bvh1.all().size(), distances1.size());
+    EXPECT_EQ(bvh2.all().size(), distances2.size());
+    EXPECT_EQ(bvh1.n_max_candidates(), distances1.size());
+    EXPECT_EQ(bvh_coll.nodes().size(), bvh1.n_nodes() + bvh2.n_nodes());
+
+    // Check the tree structure
+    EXPECT_EQ(bvh1.node(0u).n_subtree, bvh1.n_nodes());
+    EXPECT_FALSE(bvh1.node(0u).is_leaf());
+    for (dindex i = 0u; i < bvh1.n_nodes(); ++i) {
+        const auto& node = bvh1.node(i);
+        EXPECT_LE(i + node.n_subtree, bvh1.n_nodes());
+        if (node.is_leaf()) {
+            EXPECT_GE(node.sf_end - node.sf_begin, 1u);
+            EXPECT_LE(node.sf_end - node.sf_begin, max_leaf_size);
+        }
+    }
+
+    // Every surface ends up in exactly one leaf
+    std::vector<dindex> n_found(distances1.size(), 0u);
+    for (const auto& sf : bvh1.all()) {
+        ++n_found[sf.index()];
+    }
+    for (const dindex n : n_found) {
+        EXPECT_EQ(n, 1u);
+    }
+
+    const dummy_detector det{};
+    const dindex vol{0u};
+    const navigation_cfg cfg{};
+
+    // Line along the surface direction: all surfaces are found
+    detail::ray<test::algebra> trk_z({0.f, 0.f, -5.f}, 0.f, direction, -1.f);
+    dindex n_sf{0u};
+    for (const auto& sf : bvh1.search(det, vol, trk_z, cfg)) {
+        EXPECT_EQ(sf.volume(), 0UL);
+        ++n_sf;
+    }
+    EXPECT_EQ(n_sf, distances1.size());
+
+    // Line perpendicular to the surface direction: only one surface is hit
+    detail::ray<test::algebra> trk_x({0.f, 0.f, 40.f}, 0.f, {1.f, 0.f, 0.f},
+                                     -1.f);
+    n_sf = 0u;
+    for (const auto& sf : bvh1.search(det, vol, trk_x, cfg)) {
+        EXPECT_EQ(sf.index(), 3u);
+        ++n_sf;
+    }
+    EXPECT_EQ(n_sf, 1u);
+
+    // Line that misses all boxes
+    detail::ray<test::algebra> trk_miss({0.f, 0.f, 45.f}, 0.f,
+                                        {1.f, 0.f, 0.f}, -1.f);
+    const auto miss = bvh1.search(det, vol, trk_miss, cfg);
+    EXPECT_TRUE(miss.begin() == miss.end());
+
+    // The second hierarchy only contains its own surfaces
+    detail::ray<test::algebra> trk_x2({0.f, 0.f, 230.f}, 0.f, {1.f, 0.f, 0.f},
+                                      -1.f);
+    n_sf = 0u;
+    for (const auto& sf : bvh2.search(det, vol, trk_x2, cfg)) {
+        EXPECT_EQ(sf.index(), 1u);
+        ++n_sf;
+    }
+    EXPECT_EQ(n_sf, 1u);
+}
@@ -0,0 +1,128 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Detray include(s)
+#include "detray/navigation/accelerators/concentric_portal_finder.hpp"
+
+#include "detray/navigation/detail/ray.hpp"
+#include "detray/test/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <algorithm>
+#include <array>
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+vecmem::host_memory_resource host_mr;
+
+// Algebra definitions
+using point3 = test::point3;
+using vector3 = test::vector3;
+
+/// The portal search does not need the detector
+struct dummy_detector {
+    using volume_type = dindex;
+};
+
+struct navigation_cfg {
+    std::array<dindex, 2> search_window{0u, 0u};
+};
+
+}  // anonymous namespace
+
+/// Test the sorting of the portals and the search windows
+GTEST_TEST(detray_navigation, concentric_portal_collection) {
+
+    using shape_t = detail::concentric_shape;
+    using portal_coll_t = concentric_portal_collection<dindex>;
+
+    // Volume between r = 10 and r = 20 and z = -50 to 50: Surface '0' is a
+    // passive surface, '1' and '2' are the inner cylinder segments, '3' - '6'
+    // the outer cylinder segments and '7' and '8' the discs (not in order)
+    const std::vector<dindex> surfaces{5u, 0u, 8u, 2u, 3u, 7u, 6u, 1u, 4u};
+    const std::vector<shape_t> shapes{
+        shape_t::e_cylinder, shape_t::e_other,    shape_t::e_disc,
+        shape_t::e_cylinder, shape_t::e_cylinder, shape_t::e_disc,
+        shape_t::e_cylinder, shape_t::e_cylinder, shape_t::e_cylinder};
+    const std::vector<scalar> positions{20.f, 0.f,  50.f, 10.f, 20.f,
+                                        -50.f, 20.f, 10.f, 20.f};
+    const std::vector<scalar> lower{0.f, 0.f,   10.f,  0.f, -50.f,
+                                    10.f, 25.f, -50.f, -25.f};
+
+    portal_coll_t portal_coll(&host_mr);
+
+    // Check a few basics
+    ASSERT_TRUE(portal_coll.empty());
+
+    portal_coll.push_back(surfaces, shapes, positions, lower);
+    EXPECT_EQ(portal_coll.size(), 1UL);
+    ASSERT_FALSE(portal_coll.empty());
+    ASSERT_EQ(portal_coll.all().size(), surfaces.size());
+
+    const auto portals = portal_coll[0];
+    EXPECT_EQ(portals.size(), surfaces.size());
+    EXPECT_EQ(portals.all().size(), surfaces.size());
+    EXPECT_EQ(portals.n_others(), 1u);
+    EXPECT_EQ(portals.n_cylinders(), 6u);
+    EXPECT_EQ(portals.n_discs(), 2u);
+    EXPECT_EQ(portals.n_max_candidates(), 9u);
+
+    // The surfaces are sorted by shape, position and segment
+    for (dindex i = 0u; i < portals.size(); ++i) {
+        EXPECT_EQ(portals.at(i), i);
+    }
+    EXPECT_FLOAT_EQ(portals.position(1u), 10.f);
+    EXPECT_FLOAT_EQ(portals.position(6u), 20.f);
+    EXPECT_FLOAT_EQ(portals.position(7u), -50.f);
+    EXPECT_FLOAT_EQ(portals.position(8u), 50.f);
+
+    const dummy_detector det{};
+    const dindex vol{0u};
+    const navigation_cfg cfg{};
+
+    // Collect the surfaces that are found
+    auto found = [&](const auto& trk) {
+        std::vector<dindex> sfs{};
+        for (const dindex sf : portals.search(det, vol, trk, cfg)) {
+            sfs.push_back(sf);
+        }
+        std::sort(sfs.begin(), sfs.end());
+        return sfs;
+    };
+
+    // Radially outwards at z = 10: Outer segment '5' and its neighbors
+    detail::ray<test::algebra> trk_r({15.f, 0.f, 10.f}, 0.f, {1.f, 0.f, 0.f},
+                                     -1.f);
+    EXPECT_EQ(found(trk_r),
+              std::vector<dindex>({0u, 1u, 2u, 4u, 5u, 6u, 7u, 8u}));
+
+    // Along z at z = 40: the last outer segment and its neighbor
+    detail::ray<test::algebra> trk_z({0.f, 15.f, 40.f}, 0.f, {0.f, 0.f, 1.f},
+                                     -1.f);
+    EXPECT_EQ(found(trk_z), std::vector<dindex>({0u, 1u, 2u, 5u, 6u, 7u, 8u}));
+
+    // Inclined, towards the first outer segment
+    const vector3 dir_incl{vector::normalize(vector3{1.f, 0.f, -8.f})};
+    detail::ray<test::algebra> trk_incl({15.f, 0.f, 0.f}, 0.f, dir_incl,
+                                        -1.f);
+    EXPECT_EQ(found(trk_incl),
+              std::vector<dindex>({0u, 1u, 2u, 3u, 4u, 7u, 8u}));
+
+    // On the inner cylinder, pointing outwards
+    detail::ray<test::algebra> trk_on({0.f, -10.f, -30.f}, 0.f,
+                                      {0.f, -1.f, 0.f}, -1.f);
+    EXPECT_EQ(found(trk_on), std::vector<dindex>({0u, 1u, 2u, 3u, 4u, 7u, 8u}));
+}
@@ -11,6 +11,7 @@
 #include "detray/geometry/shapes/concentric_cylinder2D.hpp"
 #include "detray/geometry/shapes/cylinder2D.hpp"
 #include "detray/navigation/detail/ray.hpp"
+#include "detray/navigation/detail/ray_transform_cache.hpp"
 #include "detray/navigation/intersection/ray_concentric_cylinder_intersector.hpp"
 #include "detray/navigation/intersection/ray_intersector.hpp"
 #include "detray/test/types.hpp"
@@ -200,3 +201,37 @@ GTEST_TEST(detray_intersection, concentric_cylinders) {
     EXPECT_NEAR(hits_cylinrical[1].local[0], hit_cocylindrical.local[0], tol);
     EXPECT_NEAR(hits_cylinrical[1].local[1], hit_cocylindrical.local[1], tol);
 }
+
+// This checks that cylinders which share a placement reuse the projection of
+// the ray and yield the same intersections as without the cache
+GTEST_TEST(detray_intersection, cylinder_transform_cache) {
+    const transform3_t shifted(vector3{3.f, 2.f, 10.f});
+    ray_intersector<cylinder2D, algebra_t> ci;
+
+    // Test ray
+    const point3 ori = {3.f, 2.f, 5.f};
+    const point3 dir = vector::normalize(vector3{1.f, 1.f, 0.f});
+    ray_t ray(ori, 0.f, dir, 0.f);
+
+    mask<cylinder2D, std::uint_least16_t, algebra_t> inner{0u, r, -hz, hz};
+    mask<cylinder2D, std::uint_least16_t, algebra_t> outer{0u, 2.f * r, -hz,
+                                                            hz};
+
+    const surface_descriptor<> sf_desc{};
+    detail::ray_transform_cache<algebra_t> trf_cache{};
+
+    for (const auto &cyl : {inner, outer}) {
+        const auto hits = ci(ray, sf_desc, cyl, shifted, tol, -not_defined);
+        const auto hits_cached =
+            ci(ray, sf_desc, cyl, shifted, trf_cache, tol, -not_defined);
+
+        for (std::size_t i = 0u; i < 2u; ++i) {
+            ASSERT_TRUE(hits[i].status == intersection::status::e_inside);
+            ASSERT_TRUE(hits_cached[i].status == hits[i].status);
+            EXPECT_NEAR(hits_cached[i].path, hits[i].path, tol);
+            EXPECT_NEAR(hits_cached[i].local[0], hits[i].local[0], tol);
+            EXPECT_NEAR(hits_cached[i].local[1], hits[i].local[1], tol);
+        }
+        EXPECT_NEAR(hits[1].path, cyl[cylinder2D::e_r], tol);
+    }
+}
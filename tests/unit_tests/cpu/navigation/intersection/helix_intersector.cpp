@@ -260,6 +260,44 @@ GTEST_TEST(detray_intersection, helix_cylinder_intersector) {
     EXPECT_NEAR(global1[2], pos_far[2], tol);
 }
 
+/// Compare the Newton iterations of the helix-cylinder intersection with and
+/// without the polynomial refinement of the starting points
+GTEST_TEST(detray_intersection, helix_cylinder_polynomial_seed) {
+
+    // Transform matrix
+    const transform3_t trf(trl, z_axis, w);
+
+    // Cylinder surface (4 cm radius)
+    const scalar r{4.f * unit<scalar>::cm};
+    const scalar hz{10.f * unit<scalar>::cm};
+    const mask<cylinder2D> cylinder{0u, r, -hz, hz};
+
+    std::size_t n_line{0u};
+    helix_intersector<cylinder2D, algebra_t> hci_line;
+    hci_line.polynomial_seed = false;
+    hci_line.n_iterations = &n_line;
+
+    std::size_t n_poly{0u};
+    helix_intersector<cylinder2D, algebra_t> hci_poly;
+    hci_poly.n_iterations = &n_poly;
+
+    const auto is_line =
+        hci_line(hlx, surface_descriptor<>{}, cylinder, trf, tol);
+    const auto is_poly =
+        hci_poly(hlx, surface_descriptor<>{}, cylinder, trf, tol);
+
+    // Same solutions, but found with fewer iterations
+    const scalar conv_tol{hci_poly.convergence_tolerance};
+    for (std::size_t i = 0u; i < 2u; ++i) {
+        EXPECT_TRUE(is_poly[i].status == intersection::status::e_inside);
+        EXPECT_NEAR(is_poly[i].path, is_line[i].path, conv_tol);
+        EXPECT_NEAR(is_poly[i].local[0], is_line[i].local[0], conv_tol);
+        EXPECT_NEAR(is_poly[i].local[1], is_line[i].local[1], conv_tol);
+    }
+    EXPECT_GT(n_poly, 0u);
+    EXPECT_LT(n_poly, n_line);
+}
+
 /// Test the intersection between a helical trajectory and a line
 GTEST_TEST(detray_intersection, helix_line_intersector) {
 
@@ -351,3 +389,32 @@ GTEST_TEST(detray_intersection, helix_line_intersector) {
     EXPECT_EQ(is.status, intersection::status::e_inside);
     EXPECT_EQ(is.direction, intersection::direction::e_opposite);
 }
+
+/// Test the early rejection of surfaces that cannot be reached by a helix
+GTEST_TEST(detray_intersection, helix_intersector_early_reject) {
+
+    // Vector on the surface
+    const vector3 v = vector::cross(z_axis, w);
+
+    // Rectangle surface
+    const mask<rectangle2D> rectangle{0u, 10.f * unit<scalar>::cm,
+                                      10.f * unit<scalar>::cm};
+
+    // The surface on the helix can be reached
+    const transform3_t trf(trl, w, v);
+    EXPECT_TRUE(hlx.can_reach(rectangle, trf, tol));
+
+    // Surface far outside of the helix circle
+    const scalar r{hlx.radius()};
+    const transform3_t trf_far(vector3{5.f * r, 0.f, 0.f},
+                               vector3{1.f, 0.f, 0.f}, vector3{0.f, 1.f, 0.f});
+    EXPECT_FALSE(hlx.can_reach(rectangle, trf_far, tol));
+
+    const helix_intersector<rectangle2D, algebra_t> hpi;
+    const auto is = hpi(hlx, surface_descriptor<>{}, rectangle, trf_far, tol);
+    EXPECT_FALSE(is.status == intersection::status::e_inside);
+
+    // Unbounded surfaces are never rejected
+    const mask<unmasked<2>> unmasked_bound{};
+    EXPECT_TRUE(hlx.can_reach(unmasked_bound, trf_far, tol));
+}
@@ -292,3 +292,75 @@ GTEST_TEST(detray_intersection, intersection_kernel_helix) {
         sfi_helix.clear();
     }
 }
+
+// This tests the batched intersection of planar surfaces
+GTEST_TEST(detray_intersection, intersection_kernel_ray_batch) {
+    vecmem::host_memory_resource host_mr;
+
+    // Ten planes along z, every other one is shifted out of the ray path
+    typename transform_container_t::context_type static_context{};
+    transform_container_t transform_store;
+    mask_container_t mask_store(host_mr);
+    surface_batch<surface_t> batch_rect{};
+    surface_batch<surface_t> batch_trap{};
+    surface_container_t surfaces{};
+
+    for (dindex i = 0u; i < 10u; ++i) {
+        const scalar shift{(i % 2u == 0u) ? 0.f : 50.f};
+        transform_store.emplace_back(
+            static_context,
+            vector3{shift, 0.f, 10.f * static_cast<scalar>(i + 1u)});
+
+        const bool is_rect{i < 6u};
+        const dindex mask_idx{is_rect ? i : i - 6u};
+        if (is_rect) {
+            mask_store.template push_back<e_rectangle2>(
+                rectangle_t{0u, 10.f, 10.f}, empty_context{});
+        } else {
+            mask_store.template push_back<e_trapezoid2>(
+                trapezoid_t{0u, 10.f, 20.f, 30.f}, empty_context{});
+        }
+
+        surface_t sf(i, {is_rect ? e_rectangle2 : e_trapezoid2, mask_idx},
+                     {e_slab, 0u}, 0u, surface_id::e_sensitive);
+        sf.set_index(i);
+        surfaces.push_back(sf);
+        ASSERT_TRUE(is_rect ? batch_rect.push_back(sf)
+                            : batch_trap.push_back(sf));
+    }
+
+    const point3 pos{0.f, 0.f, 0.f};
+    const vector3 mom{0.01f, 0.01f, 10.f};
+    const free_track_parameters<algebra_t> track(pos, 0.f, mom, -1.f);
+
+    // Reference: One surface at a time
+    std::vector<intersection2D<surface_t, algebra_t>> sfi_ref;
+    for (const auto &surface : surfaces) {
+        mask_store.visit<intersection_initialize<ray_intersector>>(
+            surface.mask(), sfi_ref, detail::ray(track), surface,
+            transform_store, tol);
+    }
+
+    // Batched
+    std::vector<intersection2D<surface_t, algebra_t>> sfi_batch;
+    mask_store.visit<intersection_initialize<ray_intersector>>(
+        e_rectangle2, batch_rect, sfi_batch, detail::ray(track),
+        transform_store, tol, 0.f);
+    mask_store.visit<intersection_initialize<ray_intersector>>(
+        e_trapezoid2, batch_trap, sfi_batch, detail::ray(track),
+        transform_store, tol, 0.f);
+
+    ASSERT_EQ(sfi_ref.size(), 5u);
+    ASSERT_EQ(sfi_batch.size(), sfi_ref.size());
+    for (std::size_t i = 0u; i < sfi_ref.size(); ++i) {
+        EXPECT_EQ(sfi_batch[i].sf_desc.index(), sfi_ref[i].sf_desc.index());
+        EXPECT_EQ(sfi_batch[i].status, intersection::status::e_inside);
+        EXPECT_EQ(sfi_batch[i].direction, sfi_ref[i].direction);
+        EXPECT_EQ(sfi_batch[i].volume_link, sfi_ref[i].volume_link);
+        EXPECT_NEAR(sfi_batch[i].path, sfi_ref[i].path, tol);
+        EXPECT_NEAR(sfi_batch[i].local[0], sfi_ref[i].local[0], is_close);
+        EXPECT_NEAR(sfi_batch[i].local[1], sfi_ref[i].local[1], is_close);
+        EXPECT_NEAR(sfi_batch[i].cos_incidence_angle,
+                    sfi_ref[i].cos_incidence_angle, is_close);
+    }
+}
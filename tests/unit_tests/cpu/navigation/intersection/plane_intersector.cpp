@@ -9,7 +9,9 @@
 #include "detray/geometry/detail/surface_descriptor.hpp"
 #include "detray/geometry/mask.hpp"
 #include "detray/geometry/shapes/rectangle2D.hpp"
+#include "detray/geometry/shapes/ring2D.hpp"
 #include "detray/geometry/shapes/unmasked.hpp"
+#include "detray/navigation/detail/plane_record.hpp"
 #include "detray/navigation/detail/ray.hpp"
 #include "detray/navigation/intersection/ray_intersector.hpp"
 #include "detray/test/types.hpp"
@@ -114,3 +116,51 @@ GTEST_TEST(detray_intersection, plane_incidence_angle) {
 
     ASSERT_NEAR(is.cos_incidence_angle, std::cos(constant<scalar>::pi_4), tol);
 }
+
+// The compact plane placement gives the same intersections as the transform
+GTEST_TEST(detray_intersection, plane_record_ray) {
+    // Rotated and shifted plane
+    const vector3 x{1.f, 0.f, -1.f};
+    const vector3 z{1.f, 0.f, 1.f};
+    const vector3 t{1.f, 2.f, 3.f};
+
+    const transform3 trf{t, vector::normalize(z), vector::normalize(x)};
+    const detail::plane_record<algebra_t> plane{trf};
+
+    const point3 p{-2.f, 5.f, 7.f};
+    const auto loc_trf = trf.point_to_local(p);
+    const auto loc_plane = plane.point_to_local(p);
+    for (unsigned int i = 0u; i < 3u; ++i) {
+        ASSERT_NEAR(loc_plane[i], loc_trf[i], 1e-5f);
+    }
+
+    // Test ray
+    const point3 pos{-1.f, 1.f, 0.f};
+    const vector3 mom{1.f, 0.2f, 0.1f};
+    const detail::ray<algebra_t> r(pos, 0.f, mom, 0.f);
+
+    ray_intersector<rectangle2D, algebra_t> pi;
+    mask<rectangle2D> rect{0u, 10.f, 10.f};
+
+    const auto is_trf = pi(r, surface_descriptor<>{}, rect, trf);
+    const auto is_plane = pi(r, surface_descriptor<>{}, rect, plane);
+
+    ASSERT_TRUE(is_plane.status == intersection::status::e_inside);
+    ASSERT_NEAR(is_plane.path, is_trf.path, 1e-5f);
+    ASSERT_NEAR(is_plane.local[0], is_trf.local[0], 1e-5f);
+    ASSERT_NEAR(is_plane.local[1], is_trf.local[1], 1e-5f);
+    ASSERT_NEAR(is_plane.cos_incidence_angle, is_trf.cos_incidence_angle,
+                1e-5f);
+
+    // Polar local frame
+    ray_intersector<ring2D, algebra_t> ri;
+    mask<ring2D> ring{0u, 0.f, 10.f};
+
+    const auto is_ring_trf = ri(r, surface_descriptor<>{}, ring, trf);
+    const auto is_ring_plane = ri(r, surface_descriptor<>{}, ring, plane);
+
+    ASSERT_TRUE(is_ring_plane.status == intersection::status::e_inside);
+    ASSERT_NEAR(is_ring_plane.path, is_ring_trf.path, 1e-5f);
+    ASSERT_NEAR(is_ring_plane.local[0], is_ring_trf.local[0], 1e-5f);
+    ASSERT_NEAR(is_ring_plane.local[1], is_ring_trf.local[1], 1e-5f);
+}
@@ -0,0 +1,117 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/navigation/intersection/ray_bundle_intersector.hpp"
+
+#include "detray/geometry/detail/surface_descriptor.hpp"
+#include "detray/geometry/mask.hpp"
+#include "detray/geometry/shapes/cylinder2D.hpp"
+#include "detray/geometry/shapes/rectangle2D.hpp"
+#include "detray/navigation/detail/ray.hpp"
+#include "detray/navigation/intersection/ray_intersector.hpp"
+#include "detray/test/types.hpp"
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <cstddef>
+#include <limits>
+
+using namespace detray;
+
+// Three-dimensional definitions
+using algebra_t = test::algebra;
+using vector3 = test::vector3;
+using point3 = test::point3;
+using transform3 = test::transform3;
+using bundle_t = ray_bundle<algebra_t>;
+
+namespace {
+
+constexpr scalar tol{1e-5f};
+
+/// @returns a full bundle of rays in direction @param dir, spread out in x
+bundle_t make_bundle(const vector3 &dir, const scalar z0 = 0.f) {
+    bundle_t bundle{};
+    for (std::size_t i = 0u; i < bundle_t::capacity(); ++i) {
+        const scalar x{-2.f + static_cast<scalar>(i) * 0.75f};
+        bundle.push_back(
+            detail::ray<algebra_t>{point3{x, 1.f, z0}, 0.f, dir, 0.f});
+    }
+    return bundle;
+}
+
+}  // namespace
+
+// Check the lane-wise intersection and mask check of a plane against the
+// single ray intersector
+GTEST_TEST(detray_intersection, ray_bundle_plane) {
+
+    const transform3 trf(vector3{0.5f, 0.f, 10.f});
+    const mask<rectangle2D> rect{0u, 1.5f, 3.f};
+
+    bundle_t bundle = make_bundle(vector3{0.f, 0.f, 1.f});
+    ASSERT_TRUE(bundle.full());
+
+    const auto sol =
+        ray_bundle_intersector<rectangle2D, algebra_t>{}(bundle, rect, trf);
+    const auto is_inside = ray_bundle_mask_check<rectangle2D>{}(
+        bundle.pos_at(sol.path[0]), rect, trf, 0.f);
+
+    for (std::size_t i = 0u; i < bundle.size(); ++i) {
+        const auto sfi = ray_intersector<rectangle2D, algebra_t>{}(
+            bundle[i], surface_descriptor<>{}, rect, trf);
+
+        ASSERT_TRUE(detail::simd::is_set(sol.is_valid[0], i));
+        ASSERT_NEAR(detail::simd::get(sol.path[0], i), sfi.path, tol);
+        EXPECT_EQ(detail::simd::is_set(is_inside, i),
+                  sfi.status == intersection::status::e_inside)
+            << "lane " << i;
+    }
+
+    // Step the whole bundle onto the plane
+    bundle.advance(sol.path[0]);
+    for (std::size_t i = 0u; i < bundle.size(); ++i) {
+        ASSERT_NEAR(bundle[i].pos()[2], 10.f, tol);
+    }
+}
+
+// Check the lane-wise intersection and mask check of a cylinder against the
+// single ray intersector
+GTEST_TEST(detray_intersection, ray_bundle_cylinder) {
+
+    const transform3 trf{};
+    const mask<cylinder2D> cyl{0u, 5.f, -1.f, 1.f};
+
+    // Inclined rays, of which only some reach the cylinder within its length
+    const bundle_t bundle = make_bundle(vector3{0.96f, 0.f, 0.28f}, -2.5f);
+
+    const auto sol =
+        ray_bundle_intersector<cylinder2D, algebra_t>{}(bundle, cyl, trf);
+
+    for (std::size_t i = 0u; i < bundle.size(); ++i) {
+        const auto sfis = ray_intersector<cylinder2D, algebra_t>{}(
+            bundle[i], surface_descriptor<>{}, cyl, trf);
+
+        for (std::size_t k = 0u; k < sol.size(); ++k) {
+            const auto is_inside = ray_bundle_mask_check<cylinder2D>{}(
+                bundle.pos_at(sol.path[k]), cyl, trf, 0.f);
+
+            // Solutions behind the rays are not built by the intersector
+            if (sfis[k].status != intersection::status::e_missed) {
+                ASSERT_NEAR(detail::simd::get(sol.path[k], i), sfis[k].path,
+                            tol);
+            }
+            EXPECT_EQ(detail::simd::is_set(sol.is_valid[k], i) &&
+                          detail::simd::is_set(is_inside, i),
+                      sfis[k].status == intersection::status::e_inside)
+                << "lane " << i << ", solution " << k;
+        }
+    }
+}
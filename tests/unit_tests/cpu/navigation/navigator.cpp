@@ -11,9 +11,11 @@
 #include "detray/definitions/detail/indexing.hpp"
 #include "detray/detectors/build_toy_detector.hpp"
 #include "detray/detectors/create_wire_chamber.hpp"
+#include "detray/detectors/factories/barrel_generator.hpp"
 #include "detray/navigation/navigator.hpp"
 #include "detray/propagator/line_stepper.hpp"
 #include "detray/tracks/tracks.hpp"
+#include "detray/utils/chrome_trace.hpp"
 #include "detray/utils/inspectors.hpp"
 
 // Test include(s)
@@ -26,7 +28,13 @@
 #include <gtest/gtest.h>
 
 // System include(s)
+#include <algorithm>
+#include <cstdint>
 #include <map>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace detray {
 
@@ -107,6 +115,64 @@ inline void check_step(navigator_t &nav, stepper_t &stepper,
                                   next_id);
 }
 
+/// Count the surfaces that are visited
+struct count_surfaces {
+    template <typename surface_t>
+    DETRAY_HOST_DEVICE void operator()(const surface_t &,
+                                       std::size_t &n_surfaces) const {
+        ++n_surfaces;
+    }
+};
+
+/// Navigate a straight line track from the origin along @param dir through
+/// @param det and @returns the barcodes of the surfaces it reached
+template <typename detector_t>
+inline std::vector<geometry::barcode> record_surfaces(
+    const detector_t &det, const navigation::config<scalar> &cfg,
+    const test::vector3 &dir, vecmem::memory_resource &mr,
+    const vecmem::vector<detail::plane_record<test::algebra>> *planes =
+        nullptr,
+    const vecmem::vector<detail::barrel_placement<test::algebra>> *barrels =
+        nullptr) {
+
+    using algebra_t = test::algebra;
+    using intersection_t = intersection2D<typename detector_t::surface_type,
+                                          typename detector_t::algebra_type>;
+    using navigator_t = navigator<detector_t, navigation::void_inspector,
+                                  intersection_t, 0u, navigation::all_features>;
+    using stepper_t = line_stepper<algebra_t, constrained_step<>>;
+
+    const test::point3 pos{0.f, 0.f, 0.f};
+    free_track_parameters<algebra_t> traj(pos, 0.f, dir, -1.f);
+
+    stepper_t stepper;
+    navigator_t nav;
+    prop_state<typename stepper_t::state, typename navigator_t::state>
+        propagation{typename stepper_t::state{traj},
+                    typename navigator_t::state(det, mr)};
+    auto &navigation = propagation._navigation;
+    if (planes) {
+        navigation.set_plane_records(*planes);
+    }
+    if (barrels) {
+        navigation.set_barrel_placements(*barrels);
+    }
+
+    std::vector<geometry::barcode> barcodes{};
+    bool heartbeat{nav.init(propagation, cfg)};
+    while (heartbeat) {
+        stepper.step(propagation);
+        navigation.set_high_trust();
+        heartbeat = nav.update(propagation, cfg);
+        if (heartbeat and
+            (navigation.is_on_module() or navigation.is_on_portal())) {
+            barcodes.push_back(navigation.barcode());
+        }
+    }
+
+    return barcodes;
+}
+
 }  // anonymous namespace
 
 }  // namespace detray
@@ -443,3 +509,1875 @@ GTEST_TEST(detray_navigation, navigator_wire_chamber) {
     // std::cout << navigation.inspector().to_string() << std::endl;
     ASSERT_TRUE(navigation.is_complete()) << navigation.inspector().to_string();
 }
+
+/// Compare the navigation with a fixed size candidate cache to the default one
+GTEST_TEST(detray_navigation, navigator_fixed_size_cache) {
+    using namespace detray;
+    using namespace detray::navigation;
+
+    using algebra_t = test::algebra;
+    using point3 = test::point3;
+    using vector3 = test::vector3;
+
+    vecmem::host_memory_resource host_mr;
+
+    auto [toy_det, names] = build_toy_detector(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using intersection_t = intersection2D<typename detector_t::surface_type,
+                                          typename detector_t::algebra_type>;
+    using navigator_t = navigator<detector_t>;
+    using fixed_navigator_t =
+        navigator<detector_t, navigation::void_inspector, intersection_t, 20u>;
+    using constraint_t = constrained_step<>;
+    using stepper_t = line_stepper<algebra_t, constraint_t>;
+
+    static_assert(fixed_navigator_t::candidate_cache_type::capacity() == 20u);
+
+    // test track
+    point3 pos{0.f, 0.f, 0.f};
+    vector3 mom{1.f, 1.f, 0.f};
+    free_track_parameters<algebra_t> traj(pos, 0.f, mom, -1.f);
+
+    stepper_t stepper;
+    navigator_t nav;
+    fixed_navigator_t fixed_nav;
+    navigation::config<scalar> cfg{};
+    cfg.on_surface_tolerance = 1.f * unit<scalar>::um;
+    cfg.search_window = {3u, 3u};
+
+    prop_state<stepper_t::state, navigator_t::state> propagation{
+        stepper_t::state{traj}, navigator_t::state(toy_det, host_mr)};
+    prop_state<stepper_t::state, fixed_navigator_t::state> fixed_propagation{
+        stepper_t::state{traj}, fixed_navigator_t::state(toy_det)};
+    auto &navigation = propagation._navigation;
+    auto &fixed_navigation = fixed_propagation._navigation;
+
+    ASSERT_TRUE(nav.init(propagation, cfg));
+    ASSERT_TRUE(fixed_nav.init(fixed_propagation, cfg));
+
+    // No volume can return more candidates than the search window allows
+    // (the toy detector has one intersection per surface, plus the slack
+    // of one surface for the overflow check)
+    const std::size_t n_max_candidates{detray::n_max_candidates(toy_det, cfg)};
+    ASSERT_EQ(detail::max_intersection_solutions<detector_t>(), 1u);
+    ASSERT_EQ(n_max_candidates,
+              toy_det.n_max_candidates(cfg.search_window) + 1u);
+
+    // Both navigators have to encounter the same sequence of surfaces
+    bool heartbeat{true};
+    std::size_t n_surfaces{0u};
+    while (heartbeat) {
+        ASSERT_EQ(navigation.n_candidates(), fixed_navigation.n_candidates());
+        ASSERT_TRUE(std::as_const(navigation).candidates().size() <=
+                    n_max_candidates);
+        ASSERT_EQ(navigation.next_surface().barcode(),
+                  fixed_navigation.next_surface().barcode());
+
+        stepper.step(propagation);
+        stepper.step(fixed_propagation);
+        navigation.set_high_trust();
+        fixed_navigation.set_high_trust();
+
+        heartbeat = nav.update(propagation, cfg);
+        ASSERT_EQ(heartbeat, fixed_nav.update(fixed_propagation, cfg));
+        ASSERT_EQ(navigation.status(), fixed_navigation.status());
+        ASSERT_EQ(navigation.volume(), fixed_navigation.volume());
+        n_surfaces += navigation.is_on_module() ? 1u : 0u;
+    }
+
+    ASSERT_TRUE(navigation.is_complete());
+    ASSERT_TRUE(fixed_navigation.is_complete());
+    ASSERT_TRUE(n_surfaces > 0u);
+    EXPECT_EQ(fixed_navigation.n_evicted(), 0u);
+}
+
+/// Navigate with a fixed size candidate cache that is too small for the
+/// search window: The surfaces that do not fit are found again, after the
+/// last surface that was kept
+GTEST_TEST(detray_navigation, navigator_fixed_size_cache_eviction) {
+    using namespace detray;
+    using namespace detray::navigation;
+
+    using algebra_t = test::algebra;
+    using point3 = test::point3;
+    using vector3 = test::vector3;
+
+    vecmem::host_memory_resource host_mr;
+
+    auto [toy_det, names] = build_toy_detector(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using intersection_t = intersection2D<typename detector_t::surface_type,
+                                          typename detector_t::algebra_type>;
+    using navigator_t = navigator<detector_t>;
+    using fixed_navigator_t =
+        navigator<detector_t, navigation::void_inspector, intersection_t, 12u>;
+    using constraint_t = constrained_step<>;
+    using stepper_t = line_stepper<algebra_t, constraint_t>;
+
+    navigation::config<scalar> cfg{};
+    cfg.on_surface_tolerance = 1.f * unit<scalar>::um;
+    cfg.search_window = {3u, 3u};
+
+    // The barrel layers return more candidates than fit into the cache
+    ASSERT_TRUE(toy_det.n_max_candidates(cfg.search_window) > 12u);
+
+    stepper_t stepper;
+    navigator_t nav;
+    fixed_navigator_t fixed_nav;
+
+    // Record the sequence of surfaces that are reached
+    auto record = [](const auto &state, std::vector<dindex> &sequence) {
+        if ((state.is_on_module() or state.is_on_portal()) and
+            (sequence.empty() or sequence.back() != state.barcode().index())) {
+            sequence.push_back(state.barcode().index());
+        }
+    };
+
+    std::size_t n_evicted{0u};
+    for (const scalar mom_z : {0.f, 0.3f, 1.f}) {
+
+        point3 pos{0.f, 0.f, 0.f};
+        vector3 mom{1.f, 1.f, mom_z};
+        free_track_parameters<algebra_t> traj(pos, 0.f, mom, -1.f);
+
+        prop_state<stepper_t::state, navigator_t::state> propagation{
+            stepper_t::state{traj}, navigator_t::state(toy_det, host_mr)};
+        prop_state<stepper_t::state, fixed_navigator_t::state>
+            fixed_propagation{stepper_t::state{traj},
+                              fixed_navigator_t::state(toy_det)};
+        auto &navigation = propagation._navigation;
+        auto &fixed_navigation = fixed_propagation._navigation;
+
+        ASSERT_TRUE(nav.init(propagation, cfg));
+        ASSERT_TRUE(fixed_nav.init(fixed_propagation, cfg));
+
+        std::vector<dindex> ref_surfaces{};
+        std::vector<dindex> surfaces{};
+
+        bool heartbeat{true};
+        while (heartbeat) {
+            stepper.step(propagation);
+            navigation.set_high_trust();
+            heartbeat = nav.update(propagation, cfg);
+            record(navigation, ref_surfaces);
+        }
+        heartbeat = true;
+        while (heartbeat) {
+            stepper.step(fixed_propagation);
+            fixed_navigation.set_high_trust();
+            heartbeat = fixed_nav.update(fixed_propagation, cfg);
+            record(fixed_navigation, surfaces);
+        }
+
+        // No surface is skipped
+        ASSERT_TRUE(navigation.is_complete());
+        ASSERT_TRUE(fixed_navigation.is_complete());
+        EXPECT_EQ(surfaces, ref_surfaces) << "p_z: " << mom_z;
+
+        n_evicted += fixed_navigation.n_evicted();
+    }
+
+    // The cache did overflow
+    EXPECT_TRUE(n_evicted > 0u);
+}
+
+/// Check that a copy of an initialized state navigates on its own candidates
+GTEST_TEST(detray_navigation, navigator_state_copy) {
+    using namespace detray;
+
+    using algebra_t = test::algebra;
+
+    vecmem::host_memory_resource host_mr;
+
+    const auto [toy_det, names] = build_toy_detector(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using intersection_t = intersection2D<typename detector_t::surface_type,
+                                          typename detector_t::algebra_type>;
+    using navigator_t =
+        navigator<detector_t, navigation::void_inspector, intersection_t, 20u>;
+    using stepper_t = line_stepper<algebra_t, constrained_step<>>;
+    using prop_state_t = prop_state<stepper_t::state, navigator_t::state>;
+
+    free_track_parameters<algebra_t> traj({0.f, 0.f, 0.f}, 0.f,
+                                          {1.f, 1.f, 0.f}, -1.f);
+
+    stepper_t stepper;
+    navigator_t nav;
+    navigation::config<scalar> cfg{};
+    cfg.search_window = {3u, 3u};
+
+    prop_state_t propagation{stepper_t::state{traj},
+                             navigator_t::state(toy_det)};
+    ASSERT_TRUE(nav.init(propagation, cfg));
+
+    // The copy refers to the candidates in its own cache
+    prop_state_t copy{propagation};
+    const auto &navigation = std::as_const(propagation._navigation);
+    const auto &copy_navigation = std::as_const(copy._navigation);
+
+    ASSERT_EQ(copy_navigation.n_candidates(), navigation.n_candidates());
+    const auto next_pos{navigation.next() - navigation.candidates().begin()};
+    EXPECT_EQ(&(*copy_navigation.next()),
+              &(*(copy_navigation.candidates().begin() + next_pos)));
+
+    // Both states encounter the same surfaces
+    bool heartbeat{true};
+    while (heartbeat) {
+        ASSERT_EQ(copy_navigation.next_surface().barcode(),
+                  navigation.next_surface().barcode());
+
+        stepper.step(propagation);
+        stepper.step(copy);
+        propagation._navigation.set_high_trust();
+        copy._navigation.set_high_trust();
+
+        heartbeat = nav.update(propagation, cfg);
+        ASSERT_EQ(heartbeat, nav.update(copy, cfg));
+        ASSERT_EQ(copy_navigation.status(), navigation.status());
+    }
+    EXPECT_TRUE(copy_navigation.is_complete());
+}
+
+/// Check that a full candidate cache keeps the closest candidates and the
+/// portals
+GTEST_TEST(detray_navigation, candidate_cache_overflow) {
+    using namespace detray;
+
+    using detector_t = detector<>;
+    using intersection_t = intersection2D<typename detector_t::surface_type,
+                                          typename detector_t::algebra_type>;
+
+    navigation::candidate_cache<intersection_t, 3u> cache;
+
+    auto add = [&cache](const scalar path, const surface_id id) {
+        intersection_t sfi{};
+        sfi.path = path;
+        sfi.sf_desc.set_id(id);
+        cache.push_back(sfi);
+    };
+
+    auto sorted_paths = [&cache]() {
+        std::vector<scalar> paths;
+        for (const auto &sfi : cache) {
+            paths.push_back(sfi.path);
+        }
+        std::sort(paths.begin(), paths.end());
+        return paths;
+    };
+
+    for (const scalar path : {5.f, -1.f, 4.f, 2.f, 10.f, 3.f}) {
+        add(path, surface_id::e_sensitive);
+    }
+
+    ASSERT_TRUE(cache.full());
+    ASSERT_EQ(cache.size(), 3u);
+    EXPECT_FALSE(cache.is_complete());
+    EXPECT_EQ(cache.n_evicted(), 3u);
+
+    auto paths = sorted_paths();
+    EXPECT_FLOAT_EQ(paths[0], -1.f);
+    EXPECT_FLOAT_EQ(paths[1], 2.f);
+    EXPECT_FLOAT_EQ(paths[2], 3.f);
+
+    // A portal replaces the furthest other surface, even if it is further
+    add(20.f, surface_id::e_portal);
+    paths = sorted_paths();
+    EXPECT_FLOAT_EQ(paths[0], -1.f);
+    EXPECT_FLOAT_EQ(paths[1], 2.f);
+    EXPECT_FLOAT_EQ(paths[2], 20.f);
+    EXPECT_EQ(cache.n_evicted(), 4u);
+
+    // ... and is not replaced by closer surfaces
+    add(1.f, surface_id::e_sensitive);
+    add(0.f, surface_id::e_passive);
+    paths = sorted_paths();
+    EXPECT_FLOAT_EQ(paths[0], -1.f);
+    EXPECT_FLOAT_EQ(paths[1], 0.f);
+    EXPECT_FLOAT_EQ(paths[2], 20.f);
+    EXPECT_EQ(cache.n_evicted(), 6u);
+
+    // Portals push out the remaining surfaces, then the closest ones are kept
+    add(30.f, surface_id::e_portal);
+    add(15.f, surface_id::e_portal);
+    add(25.f, surface_id::e_portal);
+    paths = sorted_paths();
+    EXPECT_FLOAT_EQ(paths[0], 15.f);
+    EXPECT_FLOAT_EQ(paths[1], 20.f);
+    EXPECT_FLOAT_EQ(paths[2], 25.f);
+    EXPECT_EQ(cache.n_evicted(), 9u);
+
+    // The count is kept for the whole track
+    cache.clear();
+    EXPECT_TRUE(cache.is_complete());
+    EXPECT_EQ(cache.n_evicted(), 9u);
+}
+
+/// Check that all candidate ordering policies result in the same navigation
+GTEST_TEST(detray_navigation, navigator_candidate_ordering) {
+    using namespace detray;
+    using namespace detray::navigation;
+
+    using algebra_t = test::algebra;
+    using point3 = test::point3;
+    using vector3 = test::vector3;
+
+    vecmem::host_memory_resource host_mr;
+
+    auto [toy_det, names] = build_toy_detector(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using navigator_t = navigator<detector_t>;
+    using constraint_t = constrained_step<>;
+    using stepper_t = line_stepper<algebra_t, constraint_t>;
+
+    // test track
+    point3 pos{0.f, 0.f, 0.f};
+    vector3 mom{1.f, 1.f, 0.f};
+    free_track_parameters<algebra_t> traj(pos, 0.f, mom, -1.f);
+
+    stepper_t stepper;
+    navigator_t nav;
+    navigation::config<scalar> ref_cfg{};
+    ref_cfg.on_surface_tolerance = 1.f * unit<scalar>::um;
+    ref_cfg.search_window = {3u, 3u};
+
+    for (const auto ordering :
+         {candidate_ordering::e_insertion, candidate_ordering::e_k_nearest,
+          candidate_ordering::e_adaptive}) {
+
+        navigation::config<scalar> cfg{ref_cfg};
+        cfg.ordering = ordering;
+        cfg.n_nearest = 2u;
+
+        prop_state<stepper_t::state, navigator_t::state> ref_propagation{
+            stepper_t::state{traj}, navigator_t::state(toy_det, host_mr)};
+        prop_state<stepper_t::state, navigator_t::state> propagation{
+            stepper_t::state{traj}, navigator_t::state(toy_det, host_mr)};
+        auto &ref_navigation = ref_propagation._navigation;
+        auto &navigation = propagation._navigation;
+
+        ASSERT_TRUE(nav.init(ref_propagation, ref_cfg));
+        ASSERT_TRUE(nav.init(propagation, cfg));
+
+        // Alternate between the trust levels that trigger a re-ordering
+        bool heartbeat{true};
+        std::size_t n_steps{0u};
+        while (heartbeat) {
+            ASSERT_EQ(ref_navigation.n_candidates(), navigation.n_candidates());
+            ASSERT_EQ(ref_navigation.next_surface().barcode(),
+                      navigation.next_surface().barcode());
+
+            stepper.step(ref_propagation);
+            stepper.step(propagation);
+            if (n_steps % 2u == 0u) {
+                ref_navigation.set_high_trust();
+                navigation.set_high_trust();
+            } else {
+                ref_navigation.set_fair_trust();
+                navigation.set_fair_trust();
+            }
+
+            heartbeat = nav.update(ref_propagation, ref_cfg);
+            ASSERT_EQ(heartbeat, nav.update(propagation, cfg));
+            ASSERT_EQ(ref_navigation.status(), navigation.status());
+            ASSERT_EQ(ref_navigation.volume(), navigation.volume());
+            ++n_steps;
+        }
+
+        ASSERT_TRUE(ref_navigation.is_complete());
+        ASSERT_TRUE(navigation.is_complete());
+    }
+}
+
+/// Check that the portal look-ahead does not change the navigation flow
+GTEST_TEST(detray_navigation, navigator_portal_lookahead) {
+    using namespace detray;
+    using namespace detray::navigation;
+
+    using algebra_t = test::algebra;
+    using point3 = test::point3;
+    using vector3 = test::vector3;
+
+    vecmem::host_memory_resource host_mr;
+
+    auto [toy_det, names] = build_toy_detector(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using intersection_t = intersection2D<typename detector_t::surface_type,
+                                          typename detector_t::algebra_type>;
+    using navigator_t = navigator<detector_t>;
+    using lookahead_navigator_t =
+        navigator<detector_t, navigation::void_inspector, intersection_t, 0u,
+                  navigation::all_features>;
+
+    // The look-ahead data is only part of the state if it is requested
+    static_assert(sizeof(navigator_t::state) <
+                  sizeof(lookahead_navigator_t::state));
+
+    using constraint_t = constrained_step<>;
+    using stepper_t = line_stepper<algebra_t, constraint_t>;
+
+    // test track
+    point3 pos{0.f, 0.f, 0.f};
+    vector3 mom{1.f, 1.f, 0.f};
+    free_track_parameters<algebra_t> traj(pos, 0.f, mom, -1.f);
+
+    stepper_t stepper;
+    navigator_t ref_nav;
+    lookahead_navigator_t nav;
+    navigation::config<scalar> ref_cfg{};
+    ref_cfg.on_surface_tolerance = 1.f * unit<scalar>::um;
+    ref_cfg.search_window = {3u, 3u};
+
+    navigation::config<scalar> cfg{ref_cfg};
+    cfg.portal_lookahead = true;
+
+    prop_state<stepper_t::state, navigator_t::state> ref_propagation{
+        stepper_t::state{traj}, navigator_t::state(toy_det, host_mr)};
+    prop_state<stepper_t::state, lookahead_navigator_t::state> propagation{
+        stepper_t::state{traj}, lookahead_navigator_t::state(toy_det, host_mr)};
+    auto &ref_navigation = ref_propagation._navigation;
+    auto &navigation = propagation._navigation;
+
+    ASSERT_TRUE(ref_nav.init(ref_propagation, ref_cfg));
+    ASSERT_TRUE(nav.init(propagation, cfg));
+
+    bool heartbeat{true};
+    std::size_t n_steps{0u};
+    std::size_t n_prefetched{0u};
+    while (heartbeat) {
+        ASSERT_EQ(ref_navigation.next_surface().barcode(),
+                  navigation.next_surface().barcode());
+        if (not navigation.lookahead().empty()) {
+            ++n_prefetched;
+        }
+
+        stepper.step(ref_propagation);
+        stepper.step(propagation);
+        if (n_steps % 2u == 0u) {
+            ref_navigation.set_high_trust();
+            navigation.set_high_trust();
+        } else {
+            ref_navigation.set_fair_trust();
+            navigation.set_fair_trust();
+        }
+
+        heartbeat = ref_nav.update(ref_propagation, ref_cfg);
+        ASSERT_EQ(heartbeat, nav.update(propagation, cfg));
+        ASSERT_EQ(ref_navigation.status(), navigation.status());
+        ASSERT_EQ(ref_navigation.volume(), navigation.volume());
+        ++n_steps;
+    }
+
+    EXPECT_TRUE(n_prefetched > 0u);
+    ASSERT_TRUE(ref_navigation.is_complete());
+    ASSERT_TRUE(navigation.is_complete());
+}
+
+/// Check that replaying the cached accelerator search does not change the
+/// navigation flow
+GTEST_TEST(detray_navigation, navigator_search_cache) {
+    using namespace detray;
+    using namespace detray::navigation;
+
+    using algebra_t = test::algebra;
+    using point3 = test::point3;
+    using vector3 = test::vector3;
+
+    vecmem::host_memory_resource host_mr;
+
+    auto [toy_det, names] = build_toy_detector(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using intersection_t = intersection2D<typename detector_t::surface_type,
+                                          typename detector_t::algebra_type>;
+    using navigator_t =
+        navigator<detector_t, navigation::void_inspector, intersection_t, 0u,
+                  navigation::all_features>;
+    using constraint_t = constrained_step<>;
+    using stepper_t = line_stepper<algebra_t, constraint_t>;
+
+    // test track
+    point3 pos{0.f, 0.f, 0.f};
+    vector3 mom{1.f, 1.f, 0.f};
+    free_track_parameters<algebra_t> traj(pos, 0.f, mom, -1.f);
+
+    stepper_t stepper;
+    navigator_t nav;
+    navigation::config<scalar> ref_cfg{};
+    ref_cfg.on_surface_tolerance = 1.f * unit<scalar>::um;
+    ref_cfg.search_window = {3u, 3u};
+
+    navigation::config<scalar> cfg{ref_cfg};
+    cfg.cache_search = true;
+
+    prop_state<stepper_t::state, navigator_t::state> ref_propagation{
+        stepper_t::state{traj}, navigator_t::state(toy_det, host_mr)};
+    prop_state<stepper_t::state, navigator_t::state> propagation{
+        stepper_t::state{traj}, navigator_t::state(toy_det, host_mr)};
+    auto &ref_navigation = ref_propagation._navigation;
+    auto &navigation = propagation._navigation;
+
+    ASSERT_TRUE(nav.init(ref_propagation, ref_cfg));
+    ASSERT_TRUE(nav.init(propagation, cfg));
+
+    // The reference does not fill the cache
+    EXPECT_TRUE(ref_navigation.search_cache().surfaces.empty());
+
+    // Brute force search in the beampipe volume
+    const auto &search_cache = navigation.search_cache();
+    ASSERT_TRUE(search_cache.complete);
+    EXPECT_EQ(search_cache.volume, navigation.volume());
+    EXPECT_EQ(search_cache.bin_key, 0u);
+    EXPECT_FALSE(search_cache.surfaces.empty());
+
+    // A second initialization at the same position replays the search
+    const std::size_t n_candidates{navigation.n_candidates()};
+    const auto next_bcd{navigation.next_surface().barcode()};
+    ASSERT_TRUE(nav.init(propagation, cfg));
+    EXPECT_EQ(navigation.n_candidates(), n_candidates);
+    EXPECT_EQ(navigation.next_surface().barcode(), next_bcd);
+
+    constexpr auto inv_key{navigator_t::search_cache_type::k_invalid_key};
+
+    bool heartbeat{true};
+    std::size_t n_steps{0u};
+    std::size_t n_grid_searches{0u};
+    while (heartbeat) {
+        ASSERT_EQ(ref_navigation.next_surface().barcode(),
+                  navigation.next_surface().barcode());
+        ASSERT_EQ(ref_navigation.n_candidates(), navigation.n_candidates());
+
+        stepper.step(ref_propagation);
+        stepper.step(propagation);
+        // Re-initialize frequently to exercise the cache
+        if (n_steps % 3u == 0u) {
+            ref_navigation.set_no_trust();
+            navigation.set_no_trust();
+        } else {
+            ref_navigation.set_fair_trust();
+            navigation.set_fair_trust();
+        }
+
+        heartbeat = nav.update(ref_propagation, ref_cfg);
+        ASSERT_EQ(heartbeat, nav.update(propagation, cfg));
+        ASSERT_EQ(ref_navigation.status(), navigation.status());
+        ASSERT_EQ(ref_navigation.volume(), navigation.volume());
+
+        if (search_cache.bin_key != 0u and search_cache.bin_key != inv_key) {
+            ++n_grid_searches;
+        }
+        ++n_steps;
+    }
+
+    // The search in the layer volumes was keyed by the grid bins
+    EXPECT_TRUE(n_grid_searches > 0u);
+    ASSERT_TRUE(ref_navigation.is_complete());
+    ASSERT_TRUE(navigation.is_complete());
+}
+
+/// Check that a follower track that shares the searches of a leader track
+/// navigates the same way as on its own
+GTEST_TEST(detray_navigation, navigator_bundle) {
+    using namespace detray;
+    using namespace detray::navigation;
+
+    using algebra_t = test::algebra;
+    using point3 = test::point3;
+    using vector3 = test::vector3;
+
+    vecmem::host_memory_resource host_mr;
+
+    auto [toy_det, names] = build_toy_detector(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using intersection_t = intersection2D<typename detector_t::surface_type,
+                                          typename detector_t::algebra_type>;
+    using navigator_t =
+        navigator<detector_t, navigation::void_inspector, intersection_t, 0u,
+                  navigation::all_features>;
+    using constraint_t = constrained_step<>;
+    using stepper_t = line_stepper<algebra_t, constraint_t>;
+
+    // Leader and a slightly different follower track
+    point3 pos{0.f, 0.f, 0.f};
+    vector3 leader_mom{1.f, 1.f, 0.f};
+    vector3 mom{1.f, 1.001f, 0.001f};
+    free_track_parameters<algebra_t> leader_traj(pos, 0.f, leader_mom, -1.f);
+    free_track_parameters<algebra_t> traj(pos, 0.f, mom, -1.f);
+
+    stepper_t stepper;
+    navigator_t nav;
+    navigation::config<scalar> cfg{};
+    cfg.on_surface_tolerance = 1.f * unit<scalar>::um;
+    cfg.search_window = {3u, 3u};
+    cfg.cache_search = true;
+
+    prop_state<stepper_t::state, navigator_t::state> leader_propagation{
+        stepper_t::state{leader_traj}, navigator_t::state(toy_det, host_mr)};
+    prop_state<stepper_t::state, navigator_t::state> ref_propagation{
+        stepper_t::state{traj}, navigator_t::state(toy_det, host_mr)};
+    prop_state<stepper_t::state, navigator_t::state> propagation{
+        stepper_t::state{traj}, navigator_t::state(toy_det, host_mr)};
+    auto &leader_navigation = leader_propagation._navigation;
+    auto &ref_navigation = ref_propagation._navigation;
+    auto &navigation = propagation._navigation;
+
+    navigation.set_leader(leader_navigation);
+    ASSERT_TRUE(navigation.has_leader());
+
+    ASSERT_TRUE(nav.init(leader_propagation, cfg));
+    ASSERT_TRUE(nav.init(ref_propagation, cfg));
+    ASSERT_TRUE(nav.init(propagation, cfg));
+
+    // Propagate the tracks in lock step
+    bool leader_heartbeat{true};
+    bool heartbeat{true};
+    std::size_t n_steps{0u};
+    std::size_t n_shared{0u};
+    while (heartbeat) {
+        ASSERT_EQ(ref_navigation.next_surface().barcode(),
+                  navigation.next_surface().barcode());
+        ASSERT_EQ(ref_navigation.n_candidates(), navigation.n_candidates());
+
+        if (leader_heartbeat) {
+            stepper.step(leader_propagation);
+            leader_navigation.set_no_trust();
+            leader_heartbeat = nav.update(leader_propagation, cfg);
+        }
+
+        stepper.step(ref_propagation);
+        stepper.step(propagation);
+        // Re-initialize frequently to exercise the search sharing
+        if (n_steps % 3u == 0u) {
+            ref_navigation.set_no_trust();
+            navigation.set_no_trust();
+        } else {
+            ref_navigation.set_fair_trust();
+            navigation.set_fair_trust();
+        }
+
+        heartbeat = nav.update(ref_propagation, cfg);
+        ASSERT_EQ(heartbeat, nav.update(propagation, cfg));
+        ASSERT_EQ(ref_navigation.status(), navigation.status());
+        ASSERT_EQ(ref_navigation.volume(), navigation.volume());
+
+        // The search of the leader was replayed, instead of searching again
+        const auto own_volume{navigation.search_cache().volume};
+        if (!detail::is_invalid_value(own_volume) and
+            own_volume != navigation.volume()) {
+            ++n_shared;
+        }
+        ++n_steps;
+    }
+
+    EXPECT_TRUE(n_shared > 0u);
+    ASSERT_TRUE(ref_navigation.is_complete());
+    ASSERT_TRUE(navigation.is_complete());
+
+    navigation.clear_leader();
+    EXPECT_FALSE(navigation.has_leader());
+}
+
+/// Check that only intersecting the exit portals does not change the
+/// navigation flow
+GTEST_TEST(detray_navigation, navigator_analytic_portal_exit) {
+    using namespace detray;
+    using namespace detray::navigation;
+
+    using algebra_t = test::algebra;
+    using point3 = test::point3;
+    using vector3 = test::vector3;
+
+    vecmem::host_memory_resource host_mr;
+
+    auto [toy_det, names] = build_toy_detector(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using navigator_t = navigator<detector_t>;
+    using constraint_t = constrained_step<>;
+    using stepper_t = line_stepper<algebra_t, constraint_t>;
+
+    // test track
+    point3 pos{0.f, 0.f, 0.f};
+    vector3 mom{1.f, 1.f, 0.f};
+    free_track_parameters<algebra_t> traj(pos, 0.f, mom, -1.f);
+
+    stepper_t stepper;
+    navigator_t nav;
+    navigation::config<scalar> ref_cfg{};
+    ref_cfg.on_surface_tolerance = 1.f * unit<scalar>::um;
+    ref_cfg.search_window = {3u, 3u};
+
+    navigation::config<scalar> cfg{ref_cfg};
+    cfg.analytic_portal_exit = true;
+
+    prop_state<stepper_t::state, navigator_t::state> ref_propagation{
+        stepper_t::state{traj}, navigator_t::state(toy_det, host_mr)};
+    prop_state<stepper_t::state, navigator_t::state> propagation{
+        stepper_t::state{traj}, navigator_t::state(toy_det, host_mr)};
+    auto &ref_navigation = ref_propagation._navigation;
+    auto &navigation = propagation._navigation;
+
+    ASSERT_TRUE(nav.init(ref_propagation, ref_cfg));
+    ASSERT_TRUE(nav.init(propagation, cfg));
+
+    bool heartbeat{true};
+    std::size_t n_steps{0u};
+    std::size_t n_fewer_candidates{0u};
+    while (heartbeat) {
+        ASSERT_EQ(ref_navigation.next_surface().barcode(),
+                  navigation.next_surface().barcode());
+        // Portals behind the exit are not in the cache
+        ASSERT_LE(navigation.n_candidates(), ref_navigation.n_candidates());
+        if (navigation.n_candidates() < ref_navigation.n_candidates()) {
+            ++n_fewer_candidates;
+        }
+
+        stepper.step(ref_propagation);
+        stepper.step(propagation);
+        // Re-initialize frequently to exercise the exit search
+        if (n_steps % 3u == 0u) {
+            ref_navigation.set_no_trust();
+            navigation.set_no_trust();
+        } else {
+            ref_navigation.set_fair_trust();
+            navigation.set_fair_trust();
+        }
+
+        heartbeat = nav.update(ref_propagation, ref_cfg);
+        ASSERT_EQ(heartbeat, nav.update(propagation, cfg));
+        ASSERT_EQ(ref_navigation.status(), navigation.status());
+        ASSERT_EQ(ref_navigation.volume(), navigation.volume());
+        ++n_steps;
+    }
+
+    EXPECT_TRUE(n_fewer_candidates > 0u);
+    ASSERT_TRUE(ref_navigation.is_complete());
+    ASSERT_TRUE(navigation.is_complete());
+}
+
+/// Check that the binned portal search falls back to all portals, if the grid
+/// bins don't hold any portals
+GTEST_TEST(detray_navigation, navigator_binned_portals) {
+    using namespace detray;
+    using namespace detray::navigation;
+
+    using algebra_t = test::algebra;
+    using point3 = test::point3;
+    using vector3 = test::vector3;
+
+    vecmem::host_memory_resource host_mr;
+
+    auto [toy_det, names] = build_toy_detector(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using navigator_t = navigator<detector_t>;
+    using constraint_t = constrained_step<>;
+    using stepper_t = line_stepper<algebra_t, constraint_t>;
+
+    // test track
+    point3 pos{0.f, 0.f, 0.f};
+    vector3 mom{1.f, 1.f, 0.5f};
+    free_track_parameters<algebra_t> traj(pos, 0.f, mom, -1.f);
+
+    stepper_t stepper;
+    navigator_t nav;
+    navigation::config<scalar> ref_cfg{};
+    ref_cfg.on_surface_tolerance = 1.f * unit<scalar>::um;
+    ref_cfg.search_window = {3u, 3u};
+
+    navigation::config<scalar> cfg{ref_cfg};
+    cfg.binned_portals = true;
+
+    prop_state<stepper_t::state, navigator_t::state> ref_propagation{
+        stepper_t::state{traj}, navigator_t::state(toy_det, host_mr)};
+    prop_state<stepper_t::state, navigator_t::state> propagation{
+        stepper_t::state{traj}, navigator_t::state(toy_det, host_mr)};
+    auto &ref_navigation = ref_propagation._navigation;
+    auto &navigation = propagation._navigation;
+
+    ASSERT_TRUE(nav.init(ref_propagation, ref_cfg));
+    ASSERT_TRUE(nav.init(propagation, cfg));
+
+    bool heartbeat{true};
+    while (heartbeat) {
+        ASSERT_EQ(ref_navigation.next_surface().barcode(),
+                  navigation.next_surface().barcode());
+
+        stepper.step(ref_propagation);
+        stepper.step(propagation);
+        ref_navigation.set_no_trust();
+        navigation.set_no_trust();
+
+        heartbeat = nav.update(ref_propagation, ref_cfg);
+        ASSERT_EQ(heartbeat, nav.update(propagation, cfg));
+        ASSERT_EQ(ref_navigation.status(), navigation.status());
+        ASSERT_EQ(ref_navigation.volume(), navigation.volume());
+    }
+
+    ASSERT_TRUE(ref_navigation.is_complete());
+    ASSERT_TRUE(navigation.is_complete());
+}
+
+/// Check that only intersecting the exit portal of gap volumes does not change
+/// the navigation flow
+GTEST_TEST(detray_navigation, navigator_gap_volume_shortcut) {
+    using namespace detray;
+    using namespace detray::navigation;
+
+    using algebra_t = test::algebra;
+    using point3 = test::point3;
+    using vector3 = test::vector3;
+
+    vecmem::host_memory_resource host_mr;
+
+    auto [toy_det, names] = build_toy_detector(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using navigator_t = navigator<detector_t>;
+    using constraint_t = constrained_step<>;
+    using stepper_t = line_stepper<algebra_t, constraint_t>;
+
+    // The toy detector has gap volumes between its barrel layers
+    std::size_t n_gaps{0u};
+    for (const auto &vol_desc : toy_det.volumes()) {
+        const auto vol = detector_volume{toy_det, vol_desc};
+        ASSERT_EQ(vol.is_portal_only(),
+                  vol.surfaces<surface_id::e_sensitive>().empty() and
+                      vol.surfaces<surface_id::e_passive>().empty());
+        if (vol.is_portal_only()) {
+            ++n_gaps;
+        }
+    }
+    EXPECT_TRUE(n_gaps > 0u);
+    EXPECT_FALSE(detector_volume{toy_det, 0u}.is_portal_only());
+
+    // test track
+    point3 pos{0.f, 0.f, 0.f};
+    vector3 mom{1.f, 1.f, 0.f};
+    free_track_parameters<algebra_t> traj(pos, 0.f, mom, -1.f);
+
+    stepper_t stepper;
+    navigator_t nav;
+    navigation::config<scalar> ref_cfg{};
+    ref_cfg.on_surface_tolerance = 1.f * unit<scalar>::um;
+    ref_cfg.search_window = {3u, 3u};
+
+    navigation::config<scalar> cfg{ref_cfg};
+    cfg.gap_volume_shortcut = true;
+
+    prop_state<stepper_t::state, navigator_t::state> ref_propagation{
+        stepper_t::state{traj}, navigator_t::state(toy_det, host_mr)};
+    prop_state<stepper_t::state, navigator_t::state> propagation{
+        stepper_t::state{traj}, navigator_t::state(toy_det, host_mr)};
+    auto &ref_navigation = ref_propagation._navigation;
+    auto &navigation = propagation._navigation;
+
+    ASSERT_TRUE(nav.init(ref_propagation, ref_cfg));
+    ASSERT_TRUE(nav.init(propagation, cfg));
+
+    bool heartbeat{true};
+    std::size_t n_gap_steps{0u};
+    while (heartbeat) {
+        ASSERT_EQ(ref_navigation.next_surface().barcode(),
+                  navigation.next_surface().barcode());
+        ASSERT_NEAR(ref_navigation(), navigation(), 1e-4f);
+        // Portals behind the exit are not in the cache
+        ASSERT_LE(navigation.n_candidates(), ref_navigation.n_candidates());
+        if (detector_volume{toy_det, navigation.volume()}.is_portal_only()) {
+            ++n_gap_steps;
+        }
+
+        stepper.step(ref_propagation);
+        stepper.step(propagation);
+
+        heartbeat = nav.update(ref_propagation, ref_cfg);
+        ASSERT_EQ(heartbeat, nav.update(propagation, cfg));
+        ASSERT_EQ(ref_navigation.status(), navigation.status());
+        ASSERT_EQ(ref_navigation.volume(), navigation.volume());
+    }
+
+    EXPECT_TRUE(n_gap_steps > 0u);
+    ASSERT_TRUE(ref_navigation.is_complete());
+    ASSERT_TRUE(navigation.is_complete());
+}
+
+/// Check that passive surfaces without material can be left out of the
+/// navigation
+GTEST_TEST(detray_navigation, navigator_skip_empty_passives) {
+    using namespace detray;
+
+    vecmem::host_memory_resource host_mr;
+
+    auto [toy_det, names] = build_toy_detector(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using material_link_t = detector_t::surface_type::material_link;
+
+    const test::vector3 dir{1.f, 1.f, 0.f};
+
+    navigation::config<scalar> ref_cfg{};
+    ref_cfg.search_window = {3u, 3u};
+
+    navigation::config<scalar> cfg{ref_cfg};
+    cfg.skip_empty_passives = true;
+
+    // The beampipe carries material: Nothing is skipped
+    const auto ref_barcodes = record_surfaces(toy_det, ref_cfg, dir, host_mr);
+    ASSERT_EQ(ref_barcodes, record_surfaces(toy_det, cfg, dir, host_mr));
+
+    // Remove the material from the passive surfaces
+    std::size_t n_passives{0u};
+    for (auto &sf_desc : toy_det.surfaces()) {
+        if (sf_desc.is_passive()) {
+            sf_desc.material() =
+                material_link_t{detector_t::materials::id::e_none, 0u};
+            ++n_passives;
+        }
+    }
+    ASSERT_TRUE(n_passives > 0u);
+
+    // The passive surfaces are still reached without the filter
+    const auto barcodes = record_surfaces(toy_det, cfg, dir, host_mr);
+    ASSERT_EQ(ref_barcodes, record_surfaces(toy_det, ref_cfg, dir, host_mr));
+
+    std::vector<geometry::barcode> expected{};
+    for (const auto &bcd : ref_barcodes) {
+        if (bcd.id() != surface_id::e_passive) {
+            expected.push_back(bcd);
+        }
+    }
+    EXPECT_TRUE(expected.size() < ref_barcodes.size());
+    EXPECT_EQ(expected, barcodes);
+}
+
+/// Check that the compact plane placements yield the same navigation
+GTEST_TEST(detray_navigation, navigator_plane_records) {
+    using namespace detray;
+
+    vecmem::host_memory_resource host_mr;
+
+    const auto [toy_det, names] = build_toy_detector(host_mr);
+
+    const auto planes = detail::build_plane_records(toy_det, host_mr);
+    ASSERT_EQ(planes.size(), toy_det.transform_store().size());
+
+    navigation::config<scalar> cfg{};
+    cfg.search_window = {3u, 3u};
+
+    for (const test::vector3 &dir :
+         {test::vector3{1.f, 1.f, 0.f}, test::vector3{1.f, 0.f, 1.f},
+          test::vector3{0.f, 1.f, -2.f}}) {
+        const auto ref_barcodes = record_surfaces(toy_det, cfg, dir, host_mr);
+        ASSERT_FALSE(ref_barcodes.empty());
+        EXPECT_EQ(ref_barcodes,
+                  record_surfaces(toy_det, cfg, dir, host_mr, &planes));
+    }
+}
+
+/// Check that the procedural module placements of the barrel layers match the
+/// stored transforms and yield the same navigation
+GTEST_TEST(detray_navigation, navigator_barrel_placements) {
+    using namespace detray;
+
+    vecmem::host_memory_resource host_mr;
+
+    const auto [toy_det, names] = build_toy_detector(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using accel_id = detector_t::accel::id;
+
+    // Same layer parameters as the toy detector
+    toy_det_config<scalar> toy_cfg{};
+
+    vecmem::vector<detail::barrel_placement<test::algebra>> barrels(&host_mr);
+    for (const auto &vol_desc : toy_det.volumes()) {
+        const auto &link = vol_desc.template accel_link<
+            detector_t::geo_obj_ids::e_sensitive>();
+        if (link.id() != accel_id::e_cylinder2_grid) {
+            continue;
+        }
+
+        // Transform index of the first module in the layer
+        dindex trf_offset{dindex_invalid};
+        for (const auto &sf_desc : toy_det.surfaces()) {
+            if (sf_desc.volume() == vol_desc.index() and
+                sf_desc.is_sensitive()) {
+                trf_offset = std::min(trf_offset, sf_desc.transform());
+            }
+        }
+        ASSERT_NE(trf_offset, dindex_invalid);
+
+        const std::size_t j{barrels.size() + 1u};
+        auto brl_cfg = toy_cfg.barrel_config();
+        brl_cfg.binning(toy_cfg.barrel_layer_binning().at(j))
+            .radius(toy_cfg.barrel_layer_radii().at(j));
+        barrels.push_back(
+            barrel_generator<detector_t>{brl_cfg}.placement(trf_offset));
+    }
+    ASSERT_EQ(barrels.size(), 4u);
+
+    // The procedural placements reproduce the stored ones
+    const auto &trfs = toy_det.transform_store();
+    for (const auto &layer : barrels) {
+        for (dindex i = 0u; i < layer.n_modules(); ++i) {
+            const dindex trf_idx{layer.transform_offset() + i};
+            const auto trf = layer.transform(trf_idx);
+            for (unsigned int k = 0u; k < 3u; ++k) {
+                EXPECT_NEAR(trf.translation()[k],
+                            trfs[trf_idx].translation()[k], 1e-4f);
+                EXPECT_NEAR(trf.z()[k], trfs[trf_idx].z()[k], 1e-5f);
+                EXPECT_NEAR(trf.x()[k], trfs[trf_idx].x()[k], 1e-5f);
+            }
+        }
+    }
+
+    navigation::config<scalar> cfg{};
+    cfg.search_window = {3u, 3u};
+
+    for (const test::vector3 &dir :
+         {test::vector3{1.f, 1.f, 0.f}, test::vector3{1.f, 0.f, 1.f},
+          test::vector3{0.f, 1.f, -2.f}}) {
+        const auto ref_barcodes = record_surfaces(toy_det, cfg, dir, host_mr);
+        ASSERT_FALSE(ref_barcodes.empty());
+        EXPECT_EQ(ref_barcodes, record_surfaces(toy_det, cfg, dir, host_mr,
+                                                nullptr, &barrels));
+    }
+}
+
+/// Check that a surface that was passed by a step is found again
+GTEST_TEST(detray_navigation, navigator_overstep_recovery) {
+    using namespace detray;
+
+    using algebra_t = test::algebra;
+
+    vecmem::host_memory_resource host_mr;
+
+    const auto [toy_det, names] = build_toy_detector(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using navigator_t =
+        navigator<detector_t, navigation::counting_inspector<>>;
+    using stepper_t = line_stepper<algebra_t, constrained_step<>>;
+
+    const test::point3 pos{0.f, 0.f, 0.f};
+    const test::vector3 dir{1.f, 1.f, 0.f};
+    const free_track_parameters<algebra_t> traj(pos, 0.f, dir, -1.f);
+
+    constexpr scalar overstep{1.f * unit<scalar>::mm};
+
+    navigation::config<scalar> ref_cfg{};
+    ref_cfg.search_window = {3u, 3u};
+
+    navigation::config<scalar> cfg{ref_cfg};
+    cfg.overstep_recovery_tolerance = -5.f * unit<scalar>::mm;
+
+    // Move the track past the first sensitive surface and update the
+    // navigation. @returns the surface that was passed
+    auto overstep_module = [&](navigator_t::state &navigation,
+                               auto &propagation,
+                               const navigation::config<scalar> &nav_cfg) {
+        stepper_t stepper;
+        navigator_t nav;
+
+        EXPECT_TRUE(nav.init(propagation, nav_cfg));
+        while (not navigation.next_surface().is_sensitive()) {
+            stepper.step(propagation);
+            navigation.set_high_trust();
+            EXPECT_TRUE(nav.update(propagation, nav_cfg));
+        }
+        const auto missed{navigation.next_surface().barcode()};
+
+        auto &track = propagation._stepping();
+        track.set_pos(track.pos() + (navigation() + overstep) * track.dir());
+        navigation.set_high_trust();
+        EXPECT_TRUE(nav.update(propagation, nav_cfg));
+
+        return missed;
+    };
+
+    // Without recovery, the volume is re-initialized behind the surface
+    prop_state<stepper_t::state, navigator_t::state> ref_propagation{
+        stepper_t::state{traj}, navigator_t::state(toy_det, host_mr)};
+    auto &ref_navigation = ref_propagation._navigation;
+
+    const auto ref_missed =
+        overstep_module(ref_navigation, ref_propagation, ref_cfg);
+    EXPECT_NE(ref_navigation.next_surface().barcode(), ref_missed);
+    EXPECT_EQ(ref_navigation.inspector().total.n_overstep_recoveries, 0u);
+
+    // With recovery, the track is sent back to the surface
+    prop_state<stepper_t::state, navigator_t::state> propagation{
+        stepper_t::state{traj}, navigator_t::state(toy_det, host_mr)};
+    auto &navigation = propagation._navigation;
+
+    const auto missed = overstep_module(navigation, propagation, cfg);
+    ASSERT_EQ(missed, ref_missed);
+    EXPECT_EQ(navigation.next_surface().barcode(), missed);
+    EXPECT_NEAR(navigation(), -overstep, 1.f * unit<scalar>::um);
+    EXPECT_EQ(navigation.trust_level(), navigation::trust_level::e_full);
+    EXPECT_EQ(navigation.inspector().total.n_overstep_recoveries, 1u);
+
+    // The step back reaches the surface
+    stepper_t stepper;
+    stepper.step(propagation);
+    navigation.set_high_trust();
+    ASSERT_TRUE(navigator_t{}.update(propagation, cfg));
+    EXPECT_TRUE(navigation.is_on_module());
+    EXPECT_EQ(navigation.barcode(), missed);
+}
+
+/// Check that the deduplicating neighborhood search yields every surface once
+GTEST_TEST(detray_navigation, navigator_unique_candidates) {
+    using namespace detray;
+    using namespace detray::navigation;
+
+    using algebra_t = test::algebra;
+    using point3 = test::point3;
+    using vector3 = test::vector3;
+
+    vecmem::host_memory_resource host_mr;
+
+    auto [toy_det, names] = build_toy_detector(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using navigator_t = navigator<detector_t>;
+    using constraint_t = constrained_step<>;
+    using stepper_t = line_stepper<algebra_t, constraint_t>;
+
+    // test track
+    point3 pos{0.f, 0.f, 0.f};
+    vector3 mom{1.f, 1.f, 0.f};
+    free_track_parameters<algebra_t> traj(pos, 0.f, mom, -1.f);
+
+    stepper_t stepper;
+    navigator_t nav;
+    navigation::config<scalar> ref_cfg{};
+    ref_cfg.on_surface_tolerance = 1.f * unit<scalar>::um;
+    ref_cfg.search_window = {3u, 3u};
+
+    navigation::config<scalar> cfg{ref_cfg};
+    cfg.unique_candidates = true;
+
+    prop_state<stepper_t::state, navigator_t::state> ref_propagation{
+        stepper_t::state{traj}, navigator_t::state(toy_det, host_mr)};
+    prop_state<stepper_t::state, navigator_t::state> propagation{
+        stepper_t::state{traj}, navigator_t::state(toy_det, host_mr)};
+    auto &ref_navigation = ref_propagation._navigation;
+    auto &navigation = propagation._navigation;
+
+    // Count the candidates of the same (non-portal) surface in the cache
+    auto max_duplicates = [&toy_det](const navigator_t::state &state) {
+        std::map<dindex, std::size_t> n_hits{};
+        std::size_t n_max{0u};
+        for (const auto &candidate : state) {
+            if (not toy_det.surface(candidate.sf_desc.barcode()).is_portal()) {
+                n_max = std::max(n_max, ++n_hits[candidate.sf_desc.index()]);
+            }
+        }
+        return n_max;
+    };
+
+    // Record the sequence of surfaces that are reached
+    std::vector<dindex> ref_surfaces{};
+    std::vector<dindex> surfaces{};
+    auto record = [](const navigator_t::state &state,
+                     std::vector<dindex> &sequence) {
+        if ((state.is_on_module() or state.is_on_portal()) and
+            (sequence.empty() or sequence.back() != state.barcode().index())) {
+            sequence.push_back(state.barcode().index());
+        }
+    };
+
+    ASSERT_TRUE(nav.init(ref_propagation, ref_cfg));
+    ASSERT_TRUE(nav.init(propagation, cfg));
+
+    bool ref_heartbeat{true};
+    bool heartbeat{true};
+    while (ref_heartbeat or heartbeat) {
+        if (ref_heartbeat) {
+            stepper.step(ref_propagation);
+            ref_navigation.set_high_trust();
+            ref_heartbeat = nav.update(ref_propagation, ref_cfg);
+            record(ref_navigation, ref_surfaces);
+        }
+        if (heartbeat) {
+            ASSERT_TRUE(max_duplicates(navigation) <= 1u);
+            stepper.step(propagation);
+            navigation.set_high_trust();
+            heartbeat = nav.update(propagation, cfg);
+            record(navigation, surfaces);
+        }
+    }
+
+    // Same navigation flow
+    EXPECT_EQ(surfaces, ref_surfaces);
+    ASSERT_TRUE(ref_navigation.is_complete());
+    ASSERT_TRUE(navigation.is_complete());
+}
+
+/// Check that the grid search along the track direction finds the same
+/// surfaces with a narrower search window
+GTEST_TEST(detray_navigation, navigator_search_path) {
+    using namespace detray;
+    using namespace detray::navigation;
+
+    using algebra_t = test::algebra;
+    using point3 = test::point3;
+    using vector3 = test::vector3;
+
+    vecmem::host_memory_resource host_mr;
+
+    auto [toy_det, names] = build_toy_detector(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using navigator_t = navigator<detector_t>;
+    using constraint_t = constrained_step<>;
+    using stepper_t = line_stepper<algebra_t, constraint_t>;
+
+    stepper_t stepper;
+    navigator_t nav;
+    navigation::config<scalar> ref_cfg{};
+    ref_cfg.on_surface_tolerance = 1.f * unit<scalar>::um;
+    ref_cfg.search_window = {3u, 3u};
+
+    navigation::config<scalar> cfg{ref_cfg};
+    cfg.search_window = {1u, 1u};
+    cfg.search_path_length = 50.f * unit<scalar>::mm;
+
+    // Record the sequence of surfaces that are reached
+    auto record = [](const navigator_t::state &state,
+                     std::vector<dindex> &sequence) {
+        if ((state.is_on_module() or state.is_on_portal()) and
+            (sequence.empty() or sequence.back() != state.barcode().index())) {
+            sequence.push_back(state.barcode().index());
+        }
+    };
+
+    // Count the surfaces that the grid searches yield on volume entry
+    std::size_t n_ref_tested{0u};
+    std::size_t n_tested{0u};
+
+    // Largest number of candidates in the cache
+    std::size_t n_max_cached{0u};
+
+    // Tracks at different polar angles
+    for (const scalar mom_z : {0.f, 0.3f, 1.f, 2.f}) {
+
+        point3 pos{0.f, 0.f, 0.f};
+        vector3 mom{1.f, 1.f, mom_z};
+        free_track_parameters<algebra_t> traj(pos, 0.f, mom, -1.f);
+
+        prop_state<stepper_t::state, navigator_t::state> ref_propagation{
+            stepper_t::state{traj}, navigator_t::state(toy_det, host_mr)};
+        prop_state<stepper_t::state, navigator_t::state> propagation{
+            stepper_t::state{traj}, navigator_t::state(toy_det, host_mr)};
+        auto &ref_navigation = ref_propagation._navigation;
+        auto &navigation = propagation._navigation;
+
+        std::vector<dindex> ref_surfaces{};
+        std::vector<dindex> surfaces{};
+
+        ASSERT_TRUE(nav.init(ref_propagation, ref_cfg));
+        ASSERT_TRUE(nav.init(propagation, cfg));
+
+        bool ref_heartbeat{true};
+        bool heartbeat{true};
+        while (ref_heartbeat or heartbeat) {
+            if (ref_heartbeat) {
+                const dindex volume{ref_navigation.volume()};
+                stepper.step(ref_propagation);
+                ref_navigation.set_high_trust();
+                ref_heartbeat = nav.update(ref_propagation, ref_cfg);
+                record(ref_navigation, ref_surfaces);
+
+                if (ref_heartbeat and ref_navigation.volume() != volume) {
+                    const auto vol =
+                        detector_volume{toy_det, ref_navigation.volume()};
+                    const auto &track = ref_propagation._stepping();
+                    vol.template visit_neighborhood<count_surfaces>(
+                        track, ref_cfg.for_volume(vol.index()), n_ref_tested);
+                    vol.template visit_neighborhood<count_surfaces>(
+                        track, cfg.for_volume(vol.index()), n_tested);
+                }
+            }
+            if (heartbeat) {
+                n_max_cached =
+                    std::max(n_max_cached, navigation.n_candidates());
+                stepper.step(propagation);
+                navigation.set_high_trust();
+                heartbeat = nav.update(propagation, cfg);
+                record(navigation, surfaces);
+            }
+        }
+
+        // Same navigation flow
+        EXPECT_EQ(surfaces, ref_surfaces) << "p_z: " << mom_z;
+        ASSERT_TRUE(ref_navigation.is_complete());
+        ASSERT_TRUE(navigation.is_complete());
+    }
+
+    // Fewer surfaces have to be intersected
+    EXPECT_TRUE(n_tested < n_ref_tested);
+
+    // The capacity of a candidates buffer covers the search along the path,
+    // which can reach further than the wider search window
+    const std::size_t n_buffer{n_max_candidates(toy_det, cfg)};
+    EXPECT_TRUE(n_max_cached <= n_buffer);
+    EXPECT_TRUE(n_max_candidates(toy_det, ref_cfg) <= n_buffer);
+
+    navigation::config<scalar> vol_path_cfg{ref_cfg};
+    vol_path_cfg.edit_volume_config(7u)->search_path_length =
+        cfg.search_path_length;
+    EXPECT_EQ(n_max_candidates(toy_det, vol_path_cfg), n_buffer);
+}
+
+/// Check the per-volume navigation settings
+GTEST_TEST(detray_navigation, navigator_volume_config) {
+    using namespace detray;
+    using namespace detray::navigation;
+
+    using algebra_t = test::algebra;
+    using point3 = test::point3;
+    using vector3 = test::vector3;
+
+    // Lookup of the volume settings
+    navigation::config<scalar> cfg{};
+    cfg.search_window = {0u, 0u};
+
+    ASSERT_TRUE(cfg.set_volume_config({2u, 1.f * unit<scalar>::um,
+                                       -1.f * unit<scalar>::mm, {1u, 1u}}));
+    // Replace the settings of volume 2
+    ASSERT_TRUE(cfg.set_volume_config({2u, 2.f * unit<scalar>::um,
+                                       -1.f * unit<scalar>::mm, {3u, 3u}}));
+    ASSERT_EQ(cfg.volume_configs.size(), 1u);
+
+    const auto vol_cfg2 = cfg.for_volume(2u);
+    EXPECT_EQ(vol_cfg2.volume, 2u);
+    EXPECT_EQ(vol_cfg2.mask_tolerance, 2.f * unit<scalar>::um);
+    EXPECT_EQ(vol_cfg2.overstep_tolerance, -1.f * unit<scalar>::mm);
+    EXPECT_EQ(vol_cfg2.search_window[0], 3u);
+    EXPECT_EQ(vol_cfg2.search_window[1], 3u);
+
+    // Falls back to the global settings
+    const auto vol_cfg1 = cfg.for_volume(1u);
+    EXPECT_EQ(vol_cfg1.volume, 1u);
+    EXPECT_EQ(vol_cfg1.mask_tolerance, cfg.mask_tolerance);
+    EXPECT_EQ(vol_cfg1.overstep_tolerance, cfg.overstep_tolerance);
+    EXPECT_EQ(vol_cfg1.search_window[0], 0u);
+    EXPECT_EQ(vol_cfg1.search_window[1], 0u);
+
+    // A replaced entry does not inherit the global settings
+    cfg.unique_candidates = true;
+    cfg.search_path_length = 10.f * unit<scalar>::mm;
+    cfg.binned_portals = true;
+    EXPECT_FALSE(cfg.for_volume(2u).unique_candidates);
+    EXPECT_EQ(cfg.for_volume(2u).search_path_length, 0.f);
+    EXPECT_FALSE(cfg.for_volume(2u).binned_portals);
+
+    // An edited entry starts from the global settings
+    auto *vol_cfg3 = cfg.edit_volume_config(3u);
+    ASSERT_NE(vol_cfg3, nullptr);
+    vol_cfg3->search_window = {2u, 2u};
+    ASSERT_EQ(cfg.volume_configs.size(), 2u);
+
+    EXPECT_EQ(cfg.for_volume(3u).search_window[0], 2u);
+    EXPECT_EQ(cfg.for_volume(3u).mask_tolerance, cfg.mask_tolerance);
+    EXPECT_EQ(cfg.for_volume(3u).overstep_tolerance, cfg.overstep_tolerance);
+    EXPECT_TRUE(cfg.for_volume(3u).unique_candidates);
+    EXPECT_EQ(cfg.for_volume(3u).search_path_length,
+              10.f * unit<scalar>::mm);
+    EXPECT_TRUE(cfg.for_volume(3u).binned_portals);
+
+    // Editing an existing entry keeps its settings
+    ASSERT_EQ(cfg.edit_volume_config(2u)->search_window[0], 3u);
+    ASSERT_EQ(cfg.edit_volume_config(3u), vol_cfg3);
+    ASSERT_EQ(cfg.volume_configs.size(), 2u);
+
+    // Later changes of the global settings don't reach the entries
+    cfg.binned_portals = false;
+    EXPECT_TRUE(cfg.for_volume(3u).binned_portals);
+    EXPECT_FALSE(cfg.for_volume(1u).binned_portals);
+
+    // The table has a fixed capacity
+    for (dindex v = 10u; cfg.volume_configs.size() < k_max_volume_configs;
+         ++v) {
+        ASSERT_TRUE(cfg.set_volume_config({v}));
+    }
+    ASSERT_FALSE(cfg.set_volume_config({100u}));
+    ASSERT_EQ(cfg.edit_volume_config(100u), nullptr);
+    ASSERT_TRUE(cfg.set_volume_config({2u}));
+
+    // Navigation with per-volume search windows
+    vecmem::host_memory_resource host_mr;
+
+    auto [toy_det, names] = build_toy_detector(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using navigator_t = navigator<detector_t>;
+    using constraint_t = constrained_step<>;
+    using stepper_t = line_stepper<algebra_t, constraint_t>;
+
+    // test track
+    point3 pos{0.f, 0.f, 0.f};
+    vector3 mom{1.f, 1.f, 0.f};
+    free_track_parameters<algebra_t> traj(pos, 0.f, mom, -1.f);
+
+    stepper_t stepper;
+    navigator_t nav;
+
+    // Reference: the wide search window everywhere
+    navigation::config<scalar> ref_cfg{};
+    ref_cfg.on_surface_tolerance = 1.f * unit<scalar>::um;
+    ref_cfg.search_window = {3u, 3u};
+
+    prop_state<stepper_t::state, navigator_t::state> ref_propagation{
+        stepper_t::state{traj}, navigator_t::state(toy_det, host_mr)};
+    auto &ref_navigation = ref_propagation._navigation;
+
+    ASSERT_TRUE(nav.init(ref_propagation, ref_cfg));
+
+    // Record the reference navigation flow
+    std::vector<std::size_t> ref_n_candidates{};
+    std::vector<geometry::barcode> ref_next{};
+    std::vector<dindex> ref_volumes{ref_navigation.volume()};
+    bool heartbeat{true};
+    while (heartbeat) {
+        ref_n_candidates.push_back(ref_navigation.n_candidates());
+        ref_next.push_back(ref_navigation.next_surface().barcode());
+
+        stepper.step(ref_propagation);
+        ref_navigation.set_high_trust();
+        heartbeat = nav.update(ref_propagation, ref_cfg);
+        ref_volumes.push_back(ref_navigation.volume());
+    }
+    ASSERT_TRUE(ref_navigation.is_complete());
+
+    // Only the visited volumes that contain surface grids get the wide search
+    // window
+    navigation::config<scalar> vol_cfg{ref_cfg};
+    vol_cfg.search_window = {0u, 0u};
+    for (const dindex vol_idx : ref_volumes) {
+        // Left the detector world
+        if (vol_idx >= toy_det.volumes().size()) {
+            continue;
+        }
+        const auto det_vol = detector_volume{toy_det, vol_idx};
+        if (det_vol.n_max_candidates(ref_cfg.search_window) >
+            det_vol.n_max_candidates(vol_cfg.search_window)) {
+            auto *entry = vol_cfg.edit_volume_config(vol_idx);
+            ASSERT_NE(entry, nullptr);
+            entry->search_window = ref_cfg.search_window;
+        }
+    }
+    ASSERT_FALSE(vol_cfg.volume_configs.empty());
+
+    prop_state<stepper_t::state, navigator_t::state> propagation{
+        stepper_t::state{traj}, navigator_t::state(toy_det, host_mr)};
+    auto &navigation = propagation._navigation;
+
+    ASSERT_TRUE(nav.init(propagation, vol_cfg));
+
+    heartbeat = true;
+    std::size_t n_steps{0u};
+    while (heartbeat) {
+        ASSERT_TRUE(n_steps < ref_next.size());
+        ASSERT_EQ(ref_n_candidates[n_steps], navigation.n_candidates());
+        ASSERT_EQ(ref_next[n_steps], navigation.next_surface().barcode());
+
+        stepper.step(propagation);
+        navigation.set_high_trust();
+        heartbeat = nav.update(propagation, vol_cfg);
+        ++n_steps;
+        ASSERT_EQ(ref_volumes[n_steps], navigation.volume());
+    }
+
+    ASSERT_EQ(n_steps, ref_next.size());
+    ASSERT_TRUE(navigation.is_complete());
+}
+
+/// Check the adaptive mask tolerance: no curvature for straight line tracks
+GTEST_TEST(detray_navigation, navigator_adaptive_mask_tolerance) {
+    using namespace detray;
+    using namespace detray::navigation;
+
+    using algebra_t = test::algebra;
+    using point3 = test::point3;
+    using vector3 = test::vector3;
+
+    vecmem::host_memory_resource host_mr;
+
+    auto [toy_det, names] = build_toy_detector(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using navigator_t = navigator<detector_t>;
+    using constraint_t = constrained_step<>;
+    using stepper_t = line_stepper<algebra_t, constraint_t>;
+
+    // test track
+    point3 pos{0.f, 0.f, 0.f};
+    vector3 mom{1.f, 1.f, 0.f};
+    free_track_parameters<algebra_t> traj(pos, 0.f, mom, -1.f);
+
+    stepper_t stepper;
+    navigator_t nav;
+
+    navigation::config<scalar> cfg{};
+    cfg.on_surface_tolerance = 1.f * unit<scalar>::um;
+    cfg.search_window = {3u, 3u};
+    cfg.adaptive_mask_tolerance = true;
+
+    // The adaptive tolerance stays at the fixed value for a straight line
+    navigation::config<scalar> ref_cfg{cfg};
+    ref_cfg.adaptive_mask_tolerance = false;
+
+    prop_state<stepper_t::state, navigator_t::state> ref_propagation{
+        stepper_t::state{traj}, navigator_t::state(toy_det, host_mr)};
+    prop_state<stepper_t::state, navigator_t::state> propagation{
+        stepper_t::state{traj}, navigator_t::state(toy_det, host_mr)};
+    auto &ref_navigation = ref_propagation._navigation;
+    auto &navigation = propagation._navigation;
+
+    ASSERT_TRUE(nav.init(ref_propagation, ref_cfg));
+    ASSERT_TRUE(nav.init(propagation, cfg));
+
+    bool heartbeat{true};
+    std::size_t n_steps{0u};
+    while (heartbeat) {
+        ASSERT_EQ(ref_navigation.n_candidates(), navigation.n_candidates());
+        ASSERT_EQ(ref_navigation.next_surface().barcode(),
+                  navigation.next_surface().barcode());
+
+        stepper.step(ref_propagation);
+        stepper.step(propagation);
+        if (n_steps % 2u == 0u) {
+            ref_navigation.set_high_trust();
+            navigation.set_high_trust();
+        } else {
+            ref_navigation.set_fair_trust();
+            navigation.set_fair_trust();
+        }
+
+        heartbeat = nav.update(ref_propagation, ref_cfg);
+        ASSERT_EQ(heartbeat, nav.update(propagation, cfg));
+        ASSERT_EQ(ref_navigation.status(), navigation.status());
+        ASSERT_EQ(ref_navigation.volume(), navigation.volume());
+        ++n_steps;
+    }
+
+    ASSERT_TRUE(ref_navigation.is_complete());
+    ASSERT_TRUE(navigation.is_complete());
+}
+
+/// Check the navigation counters
+GTEST_TEST(detray_navigation, navigator_counting_inspector) {
+    using namespace detray;
+    using namespace detray::navigation;
+
+    using algebra_t = test::algebra;
+    using point3 = test::point3;
+    using vector3 = test::vector3;
+
+    vecmem::host_memory_resource host_mr;
+
+    auto [toy_det, names] = build_toy_detector(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using inspector_t = navigation::counting_inspector<32u>;
+    using navigator_t = navigator<detector_t, inspector_t>;
+    using constraint_t = constrained_step<>;
+    using stepper_t = line_stepper<algebra_t, constraint_t>;
+
+    ASSERT_TRUE(toy_det.volumes().size() <= 32u);
+
+    // test track
+    point3 pos{0.f, 0.f, 0.f};
+    vector3 mom{1.f, 1.f, 0.f};
+    free_track_parameters<algebra_t> traj(pos, 0.f, mom, -1.f);
+
+    stepper_t stepper;
+    navigator_t nav;
+    navigation::config<scalar> cfg{};
+    cfg.on_surface_tolerance = 1.f * unit<scalar>::um;
+    cfg.search_window = {3u, 3u};
+
+    prop_state<stepper_t::state, navigator_t::state> propagation{
+        stepper_t::state{traj}, navigator_t::state(toy_det, host_mr)};
+    auto &navigation = propagation._navigation;
+
+    ASSERT_TRUE(nav.init(propagation, cfg));
+
+    // Count the calls independently
+    unsigned int n_high_trust{0u};
+    unsigned int n_volume_switches{0u};
+    bool heartbeat{true};
+    while (heartbeat) {
+        const auto volume = navigation.volume();
+
+        stepper.step(propagation);
+        navigation.set_high_trust();
+
+        heartbeat = nav.update(propagation, cfg);
+        // Every high trust update is reported (also when reaching a portal)
+        ++n_high_trust;
+        if (heartbeat and navigation.volume() != volume) {
+            ++n_volume_switches;
+        }
+    }
+    ASSERT_TRUE(navigation.is_complete());
+
+    const auto &counter = navigation.inspector();
+    const auto &total = counter.total;
+
+    EXPECT_EQ(total.n_volume_switches, n_volume_switches);
+    // One init at the start and one per volume
+    EXPECT_EQ(total.n_inits, total.n_volume_switches + total.n_no_trust + 1u);
+    EXPECT_TRUE(total.n_candidates >= total.n_inits);
+    EXPECT_EQ(total.n_high_trust, n_high_trust);
+    EXPECT_EQ(total.n_fair_trust, 0u);
+    EXPECT_EQ(total.n_aborts, 0u);
+    EXPECT_EQ(total.n_overflows, 0u);
+    EXPECT_EQ(total.n_overstep_recoveries, 0u);
+    EXPECT_EQ(total.n_lookahead_switches, 0u);
+
+    // The per volume counters add up to the totals
+    volume_counters sum{};
+    for (dindex v = 0u; v < toy_det.volumes().size(); ++v) {
+        sum += counter[v];
+    }
+    EXPECT_EQ(sum.n_inits, total.n_inits);
+    EXPECT_EQ(sum.n_high_trust, total.n_high_trust);
+    EXPECT_EQ(sum.n_candidates, total.n_candidates);
+    EXPECT_EQ(sum.n_volume_switches, total.n_volume_switches);
+    // The first volume is not entered through a portal
+    EXPECT_EQ(counter[0u].n_volume_switches, 0u);
+    EXPECT_TRUE(counter[0u].n_inits >= 1u);
+
+    // The volume switches on prefetched candidates replace inits
+    using intersection_t = intersection2D<typename detector_t::surface_type,
+                                          typename detector_t::algebra_type>;
+    using lookahead_navigator_t =
+        navigator<detector_t, inspector_t, intersection_t, 0u,
+                  navigation::all_features>;
+
+    navigation::config<scalar> lookahead_cfg{cfg};
+    lookahead_cfg.portal_lookahead = true;
+
+    lookahead_navigator_t lookahead_nav;
+    prop_state<stepper_t::state, lookahead_navigator_t::state>
+        lookahead_propagation{stepper_t::state{traj},
+                              lookahead_navigator_t::state(toy_det, host_mr)};
+    auto &lookahead_navigation = lookahead_propagation._navigation;
+
+    ASSERT_TRUE(lookahead_nav.init(lookahead_propagation, lookahead_cfg));
+    heartbeat = true;
+    while (heartbeat) {
+        stepper.step(lookahead_propagation);
+        lookahead_navigation.set_high_trust();
+        heartbeat = lookahead_nav.update(lookahead_propagation, lookahead_cfg);
+    }
+    ASSERT_TRUE(lookahead_navigation.is_complete());
+
+    const auto &lookahead_total = lookahead_navigation.inspector().total;
+    EXPECT_EQ(lookahead_total.n_volume_switches, total.n_volume_switches);
+    EXPECT_TRUE(lookahead_total.n_lookahead_switches > 0u);
+    EXPECT_EQ(lookahead_total.n_inits + lookahead_total.n_lookahead_switches,
+              total.n_inits);
+
+    // An overflow is not counted as an abort
+    prop_state<stepper_t::state, navigator_t::state> overflow_propagation{
+        stepper_t::state{traj}, navigator_t::state(toy_det, host_mr)};
+    auto &overflow_navigation = overflow_propagation._navigation;
+
+    ASSERT_TRUE(nav.init(overflow_propagation, cfg));
+    ASSERT_FALSE(overflow_navigation.overflow());
+
+    const auto &overflow_total = overflow_navigation.inspector().total;
+    EXPECT_EQ(overflow_total.n_overflows, 1u);
+    EXPECT_EQ(overflow_total.n_aborts, 0u);
+}
+
+/// Record a navigation trace and export it as a Chrome trace
+GTEST_TEST(detray_navigation, navigator_trace_inspector) {
+    using namespace detray;
+    using namespace detray::navigation;
+
+    using algebra_t = test::algebra;
+    using point3 = test::point3;
+    using vector3 = test::vector3;
+
+    vecmem::host_memory_resource host_mr;
+
+    auto [toy_det, names] = build_toy_detector(host_mr);
+
+    using detector_t = decltype(toy_det);
+    // Small buffer, so that the oldest records are overwritten
+    using inspector_t = navigation::trace_inspector<8u>;
+    using navigator_t = navigator<detector_t, inspector_t>;
+    using constraint_t = constrained_step<>;
+    using stepper_t = line_stepper<algebra_t, constraint_t>;
+
+    // test track
+    point3 pos{0.f, 0.f, 0.f};
+    vector3 mom{1.f, 1.f, 0.f};
+    free_track_parameters<algebra_t> traj(pos, 0.f, mom, -1.f);
+
+    stepper_t stepper;
+    navigator_t nav;
+    navigation::config<scalar> cfg{};
+    cfg.on_surface_tolerance = 1.f * unit<scalar>::um;
+    cfg.search_window = {3u, 3u};
+
+    prop_state<stepper_t::state, navigator_t::state> propagation{
+        stepper_t::state{traj}, navigator_t::state(toy_det, host_mr)};
+    auto &navigation = propagation._navigation;
+    navigation.inspector().reset(7u);
+
+    ASSERT_TRUE(nav.init(propagation, cfg));
+
+    std::size_t n_calls{1u};
+    bool heartbeat{true};
+    while (heartbeat) {
+        stepper.step(propagation);
+        navigation.set_high_trust();
+
+        heartbeat = nav.update(propagation, cfg);
+        ++n_calls;
+    }
+    ASSERT_TRUE(navigation.is_complete());
+
+    const auto &tracer = navigation.inspector();
+
+    // Every update is recorded, plus the exit call and the initializations
+    // after volume switches
+    ASSERT_TRUE(tracer.n_records >= n_calls + 1u);
+    ASSERT_EQ(tracer.size(), 8u);
+
+    // The records are ordered from the oldest to the newest
+    for (std::size_t i = 0u; i < tracer.size(); ++i) {
+        EXPECT_EQ(tracer[i].track_id, 7u);
+        EXPECT_EQ(tracer[i].step, tracer.n_records - tracer.size() + i);
+        if (i > 0u) {
+            EXPECT_TRUE(tracer[i].timestamp >= tracer[i - 1u].timestamp);
+        }
+    }
+    EXPECT_EQ(tracer[7u].kind, trace_record::call::e_exit);
+    EXPECT_EQ(tracer[7u].nav_status,
+              static_cast<std::int8_t>(status::e_on_target));
+
+    // Export
+    std::vector<trace_record> records;
+    collect_trace(tracer, records);
+    ASSERT_EQ(records.size(), 8u);
+
+    std::stringstream trace;
+    write_chrome_trace(trace, records);
+    const std::string json{trace.str()};
+
+    EXPECT_EQ(json.find("{\"traceEvents\":["), 0u);
+    EXPECT_NE(json.find("\"tid\":7"), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"exit\""), std::string::npos);
+    // One complete event per record, apart from the last one
+    std::size_t n_complete{0u};
+    for (auto p = json.find("\"ph\":\"X\""); p != std::string::npos;
+         p = json.find("\"ph\":\"X\"", p + 1u)) {
+        ++n_complete;
+    }
+    EXPECT_EQ(n_complete, 7u);
+}
+
+/// Re-run the navigation restricted to the surfaces found by a first pass
+GTEST_TEST(detray_navigation, navigator_guided) {
+    using namespace detray;
+    using namespace detray::navigation;
+
+    using algebra_t = test::algebra;
+    using point3 = test::point3;
+    using vector3 = test::vector3;
+
+    vecmem::host_memory_resource host_mr;
+
+    auto [toy_det, names] = build_toy_detector(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using intersection_t =
+        intersection2D<typename detector_t::surface_type, algebra_t>;
+    using inspector_t =
+        navigation::object_tracer<intersection_t, dvector,
+                                  navigation::status::e_on_module,
+                                  navigation::status::e_on_portal>;
+    using navigator_t = navigator<detector_t, inspector_t, intersection_t, 0u,
+                                  navigation::all_features>;
+    using constraint_t = constrained_step<>;
+    using stepper_t = line_stepper<algebra_t, constraint_t>;
+
+    // test track
+    point3 pos{0.f, 0.f, 0.f};
+    vector3 mom{1.f, 1.f, 0.f};
+    free_track_parameters<algebra_t> traj(pos, 0.f, mom, -1.f);
+
+    stepper_t stepper;
+    navigator_t nav;
+    navigation::config<scalar> cfg{};
+    cfg.on_surface_tolerance = 1.f * unit<scalar>::um;
+    cfg.search_window = {3u, 3u};
+
+    // Navigate the track and record the surfaces it crosses
+    auto run = [&](const std::vector<geometry::barcode> *guide) {
+        prop_state<stepper_t::state, navigator_t::state> propagation{
+            stepper_t::state{traj}, navigator_t::state(toy_det, host_mr)};
+        auto &navigation = propagation._navigation;
+        if (guide) {
+            navigation.set_guide(*guide);
+            EXPECT_TRUE(navigation.is_guided());
+        }
+
+        EXPECT_TRUE(nav.init(propagation, cfg));
+
+        auto n_candidates{navigation.n_candidates()};
+        bool heartbeat{true};
+        while (heartbeat) {
+            stepper.step(propagation);
+            navigation.set_high_trust();
+            heartbeat = nav.update(propagation, cfg);
+            n_candidates = std::max(n_candidates, navigation.n_candidates());
+        }
+        EXPECT_TRUE(navigation.is_complete());
+
+        std::vector<geometry::barcode> trace;
+        for (const auto &record : navigation.inspector().object_trace) {
+            trace.push_back(record.sf_desc.barcode());
+        }
+        return std::make_pair(trace, n_candidates);
+    };
+
+    const auto [ref_trace, ref_n_candidates] = run(nullptr);
+    ASSERT_FALSE(ref_trace.empty());
+
+    const auto [guided_trace, guided_n_candidates] = run(&ref_trace);
+
+    // Same surfaces in the same order, from a smaller candidate set
+    ASSERT_EQ(guided_trace.size(), ref_trace.size());
+    for (std::size_t i = 0u; i < ref_trace.size(); ++i) {
+        EXPECT_EQ(guided_trace[i], ref_trace[i]) << "at surface " << i;
+    }
+    EXPECT_TRUE(guided_n_candidates <= ref_n_candidates);
+
+    // An empty guide only leaves the portals of the volume
+    const std::vector<geometry::barcode> empty_guide{};
+    prop_state<stepper_t::state, navigator_t::state> propagation{
+        stepper_t::state{traj}, navigator_t::state(toy_det, host_mr)};
+    auto &navigation = propagation._navigation;
+    navigation.set_guide(empty_guide);
+    ASSERT_TRUE(navigation.is_guided());
+    ASSERT_TRUE(nav.init(propagation, cfg));
+    for (const auto &candidate : std::as_const(navigation).candidates()) {
+        EXPECT_TRUE(candidate.sf_desc.is_portal());
+    }
+    navigation.clear_guide();
+    EXPECT_FALSE(navigation.is_guided());
+}
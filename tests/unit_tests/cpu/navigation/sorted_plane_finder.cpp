@@ -0,0 +1,147 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Detray include(s)
+#include "detray/navigation/accelerators/sorted_plane_finder.hpp"
+
+#include "detray/navigation/detail/ray.hpp"
+#include "detray/test/types.hpp"
+#include "detray/test/utils/planes_along_direction.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <array>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+vecmem::host_memory_resource host_mr;
+
+// Algebra definitions
+using point3 = test::point3;
+using vector3 = test::vector3;
+
+/// The plane search does not need the detector
+struct dummy_detector {
+    using volume_type = dindex;
+};
+
+struct navigation_cfg {
+    std::array<dindex, 2> search_window{0u, 0u};
+};
+
+}  // anonymous namespace
+
+/// Test the sorting of the planes and the search window
+GTEST_TEST(detray_navigation, sorted_plane_collection) {
+
+    // Where to place the surfaces (not in order)
+    dvector<scalar> distances{40.f, 0.f, 20.f, 10.f, 80.f,
+                              30.f, 60.f, 50.f, 70.f, 90.f};
+    // surface direction
+    vector3 direction{0.f, 0.f, 1.f};
+
+    auto surfaces = test::planes_along_direction(distances, direction);
+
+    using surface_t = typename decltype(surfaces)::value_type;
+    using plane_coll_t = sorted_plane_collection<surface_t>;
+    using axis_t = typename plane_coll_t::axis_type;
+
+    std::vector<point3> centers{};
+    for (const scalar d : distances) {
+        centers.push_back(d * direction);
+    }
+
+    plane_coll_t plane_coll(&host_mr);
+
+    // Check a few basics
+    ASSERT_TRUE(plane_coll.empty());
+
+    const axis_t axis{{0.f, 0.f, -10.f}, {0.f, 0.f, 1.f}};
+    plane_coll.push_back(surfaces, centers, axis);
+    EXPECT_EQ(plane_coll.size(), 1UL);
+    ASSERT_FALSE(plane_coll.empty());
+    ASSERT_EQ(plane_coll.all().size(), distances.size());
+
+    const auto planes = plane_coll[0];
+    EXPECT_EQ(planes.size(), distances.size());
+    EXPECT_EQ(planes.all().size(), distances.size());
+    EXPECT_EQ(planes.n_max_candidates(), distances.size());
+    EXPECT_EQ(planes.n_max_candidates(std::array<dindex, 2>{1u, 0u}), 3u);
+
+    // The planes are sorted along the axis
+    for (dindex i = 0u; i < planes.size(); ++i) {
+        EXPECT_FLOAT_EQ(planes.position(i), 10.f * static_cast<scalar>(i + 1u));
+        EXPECT_FLOAT_EQ(distances[planes.at(i).index()],
+                        10.f * static_cast<scalar>(i));
+    }
+
+    const dummy_detector det{};
+    const dindex vol{0u};
+    navigation_cfg cfg{};
+
+    // Collect the distances of the planes that are found
+    auto found = [&](const auto& trk) {
+        std::vector<scalar> dists{};
+        for (const auto& sf : planes.search(det, vol, trk, cfg)) {
+            dists.push_back(distances[sf.index()]);
+        }
+        return dists;
+    };
+
+    constexpr scalar inf{std::numeric_limits<scalar>::max()};
+
+    // Between two planes: the plane behind and the next plane
+    detail::ray<test::algebra> trk_fw({0.f, 0.f, 25.f}, 0.f, direction, -1.f);
+    EXPECT_EQ(found(trk_fw), std::vector<scalar>({20.f, 30.f}));
+    EXPECT_FLOAT_EQ(planes.horizon(trk_fw, cfg), 5.f);
+
+    // Backwards: the plane behind is now the plane at larger distance
+    detail::ray<test::algebra> trk_bw({0.f, 0.f, 25.f}, 0.f, -direction, -1.f);
+    EXPECT_EQ(found(trk_bw), std::vector<scalar>({20.f, 30.f}));
+    EXPECT_FLOAT_EQ(planes.horizon(trk_bw, cfg), 5.f);
+
+    // On a plane: it is returned as the plane behind the track
+    detail::ray<test::algebra> trk_on({0.f, 0.f, 50.f}, 0.f, direction, -1.f);
+    EXPECT_EQ(found(trk_on), std::vector<scalar>({50.f, 60.f}));
+
+    // Larger window
+    cfg.search_window = {2u, 0u};
+    EXPECT_EQ(found(trk_fw), std::vector<scalar>({20.f, 30.f, 40.f, 50.f}));
+    EXPECT_EQ(found(trk_bw), std::vector<scalar>({0.f, 10.f, 20.f, 30.f}));
+    // The window reaches the first plane: complete search
+    EXPECT_FLOAT_EQ(planes.horizon(trk_bw, cfg), inf);
+
+    // Inclined track: the horizon is the path to the last plane
+    const vector3 dir_incl{vector::normalize(vector3{1.f, 0.f, 1.f})};
+    detail::ray<test::algebra> trk_incl({0.f, 0.f, 25.f}, 0.f, dir_incl, -1.f);
+    EXPECT_NEAR(planes.horizon(trk_incl, cfg), 25.f * std::sqrt(2.f), 1e-4f);
+
+    // Before and behind the telescope
+    cfg.search_window = {0u, 0u};
+    detail::ray<test::algebra> trk_before({0.f, 0.f, -5.f}, 0.f, direction,
+                                          -1.f);
+    EXPECT_EQ(found(trk_before), std::vector<scalar>({0.f}));
+    detail::ray<test::algebra> trk_behind({0.f, 0.f, 95.f}, 0.f, direction,
+                                          -1.f);
+    EXPECT_EQ(found(trk_behind), std::vector<scalar>({90.f}));
+    EXPECT_FLOAT_EQ(planes.horizon(trk_behind, cfg), inf);
+
+    // Perpendicular to the axis: no travel along the axis
+    detail::ray<test::algebra> trk_x({0.f, 0.f, 25.f}, 0.f, {1.f, 0.f, 0.f},
+                                     -1.f);
+    EXPECT_FLOAT_EQ(planes.horizon(trk_x, cfg), inf);
+}
@@ -0,0 +1,175 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Detray include(s)
+#include "detray/navigation/accelerators/surface_grid.hpp"
+
+#include "detray/builders/grid_builder.hpp"
+#include "detray/detectors/build_toy_detector.hpp"
+#include "detray/geometry/detail/volume_kernels.hpp"
+#include "detray/geometry/detector_volume.hpp"
+#include "detray/navigation/detail/ray.hpp"
+#include "detray/navigation/navigation_config.hpp"
+#include "detray/test/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <type_traits>
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+vecmem::host_memory_resource host_mr;
+
+/// Record the surfaces that were handed out by the neighborhood search
+template <typename surface_t>
+struct surface_recorder {
+    template <typename sf_t>
+    void operator()(const sf_t &sf, std::vector<dindex> &found) const {
+        // Compressed entries have to be resolved before they are visited
+        static_assert(std::is_same_v<sf_t, surface_t>,
+                      "Only surface descriptors should be visited");
+        found.push_back(sf.index());
+    }
+};
+
+/// @returns the number of bins of the axis @param ax without over-/underflow
+template <typename axis_t>
+std::size_t n_inner_bins(const axis_t &ax) {
+    return ax.nbins() - (ax.bounds() == axis::bounds::e_open ? 2u : 0u);
+}
+
+}  // anonymous namespace
+
+/// Test a surface grid that stores surface indices instead of descriptors
+GTEST_TEST(detray_navigation, surface_index_grid) {
+
+    using namespace detray::axis;
+
+    const auto [det, names] = build_toy_detector(host_mr);
+
+    using detector_t = std::remove_cv_t<decltype(det)>;
+    using surface_t = typename detector_t::surface_type;
+    using accel_id = typename detector_t::accel::id;
+    using geo_obj_id = typename detector_t::geo_obj_ids;
+
+    using index_grid_t =
+        typename toy_metadata::template cylinder_sf_grid<surface_index_entry,
+                                                         host_container_types>;
+
+    // The compressed entry is only a fraction of the descriptor
+    EXPECT_EQ(sizeof(surface_index_entry), 4u);
+    EXPECT_GE(sizeof(surface_t), 4u * sizeof(surface_index_entry));
+    EXPECT_TRUE(detail::is_surface_index_grid_v<index_grid_t>);
+    EXPECT_FALSE(detail::is_surface_grid_v<index_grid_t>);
+
+    // Conversion from a surface descriptor
+    const auto &first_sf = det.surfaces()[3u];
+    EXPECT_EQ(surface_index_entry{first_sf}.index(), 3u);
+    EXPECT_EQ(surface_index_entry{3u}, surface_index_entry{first_sf});
+    EXPECT_TRUE(detail::is_invalid_value(surface_index_entry{}));
+
+    // Find the first barrel layer
+    const auto &cyl_grids =
+        det.accelerator_store().template get<accel_id::e_cylinder2_grid>();
+    ASSERT_FALSE(cyl_grids.empty());
+
+    dindex vol_idx{dindex_invalid};
+    for (const auto &vol_desc : det.volumes()) {
+        const auto &link =
+            vol_desc.template accel_link<geo_obj_id::e_sensitive>();
+        if (link.id() == accel_id::e_cylinder2_grid and link.index() == 0u) {
+            vol_idx = vol_desc.index();
+            break;
+        }
+    }
+    ASSERT_NE(vol_idx, dindex_invalid);
+
+    const auto &vol_desc = det.volumes()[vol_idx];
+    const auto ref_grid = cyl_grids[0];
+
+    // Build the same grid with compressed entries
+    const auto &ax_rphi = ref_grid.template get_axis<label::e_rphi>();
+    const auto &ax_z = ref_grid.template get_axis<label::e_cyl_z>();
+
+    const mask<concentric_cylinder2D> cyl_mask{0u, 1.f, ax_z.min(),
+                                               ax_z.max()};
+
+    grid_builder<detector_t, index_grid_t> gbuilder{};
+    gbuilder.init_grid(cyl_mask, {n_inner_bins(ax_rphi), n_inner_bins(ax_z)});
+    gbuilder.fill_grid(detector_volume{det, vol_desc}, det.surfaces(),
+                       det.transform_store(), det.mask_store());
+
+    const auto &idx_grid = gbuilder.get();
+    ASSERT_EQ(idx_grid.nbins(), ref_grid.nbins());
+    ASSERT_EQ(idx_grid.all().size(), ref_grid.all().size());
+
+    // Same content in every bin
+    for (dindex gbin = 0u; gbin < ref_grid.nbins(); ++gbin) {
+        const auto ref_bin = ref_grid.bin(gbin);
+        const auto idx_bin = idx_grid.bin(gbin);
+        ASSERT_EQ(idx_bin.size(), ref_bin.size());
+
+        auto ref_itr = ref_bin.begin();
+        for (const auto &entry : idx_bin) {
+            EXPECT_EQ(entry.index(), (*ref_itr).index());
+            EXPECT_EQ(det.surface(entry.index()), *ref_itr);
+            ++ref_itr;
+        }
+    }
+
+    // The neighborhood search resolves the compressed entries
+    grid_collection<index_grid_t> idx_grids(&host_mr);
+    idx_grids.push_back(idx_grid);
+
+    using recorder_t = surface_recorder<surface_t>;
+
+    navigation::volume_config<scalar> cfg{};
+    cfg.search_window = {1u, 1u};
+
+    dindex n_tested{0u};
+    for (const auto &sf : ref_grid.all()) {
+        const auto &trf = det.transform_store()[sf.transform()];
+        const auto pos = trf.translation();
+        const auto dir = vector::normalize(pos);
+
+        detail::ray<test::algebra> trk(pos, 0.f, dir, -1.f);
+
+        std::vector<dindex> ref_found{};
+        std::vector<dindex> idx_found{};
+
+        detail::neighborhood_getter<recorder_t>{}(
+            cyl_grids, 0u, det, vol_desc, trk, cfg, ref_found);
+        detail::neighborhood_getter<recorder_t>{}(
+            idx_grids, 0u, det, vol_desc, trk, cfg, idx_found);
+
+        EXPECT_FALSE(idx_found.empty());
+        EXPECT_EQ(idx_found, ref_found);
+
+        ref_found.clear();
+        idx_found.clear();
+
+        detail::unique_neighborhood_getter<recorder_t>{}(
+            cyl_grids, 0u, det, vol_desc, trk, cfg, ref_found);
+        detail::unique_neighborhood_getter<recorder_t>{}(
+            idx_grids, 0u, det, vol_desc, trk, cfg, idx_found);
+
+        EXPECT_EQ(idx_found, ref_found);
+
+        if (++n_tested == 10u) {
+            break;
+        }
+    }
+    EXPECT_EQ(n_tested, 10u);
+}
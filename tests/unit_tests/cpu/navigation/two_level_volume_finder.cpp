@@ -0,0 +1,117 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Detray include(s)
+#include "detray/navigation/accelerators/two_level_volume_finder.hpp"
+
+#include "detray/builders/detail/volume_extent.hpp"
+#include "detray/detectors/build_toy_detector.hpp"
+#include "detray/test/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+vecmem::host_memory_resource host_mr;
+
+using point3 = test::point3;
+
+}  // anonymous namespace
+
+/// Test the volume lookup on a few hand made volumes
+GTEST_TEST(detray_navigation, two_level_volume_finder) {
+
+    using finder_t = two_level_volume_finder<host_container_types, scalar>;
+    using box_t = typename finder_t::box_type;
+
+    finder_t vol_finder(&host_mr);
+    ASSERT_TRUE(vol_finder.empty());
+    EXPECT_EQ(vol_finder.search(point3{0.f, 0.f, 0.f}), dindex_invalid);
+
+    // Beampipe, two barrel layers with a gap and two endcaps
+    const std::vector<box_t> boxes{{0.f, 20.f, -500.f, 500.f, 0u},
+                                   {20.f, 50.f, -300.f, 300.f, 1u},
+                                   {60.f, 100.f, -300.f, 300.f, 2u},
+                                   {20.f, 100.f, -500.f, -300.f, 3u},
+                                   {20.f, 100.f, 300.f, 500.f, 4u}};
+
+    vol_finder.build(boxes);
+    ASSERT_FALSE(vol_finder.empty());
+
+    // Coarse grid: twice the number of distinct boundaries per axis
+    const auto& axes = vol_finder.axes();
+    EXPECT_EQ(axes.n_bins_r, 10u);
+    EXPECT_EQ(axes.n_bins_z, 8u);
+    EXPECT_FLOAT_EQ(axes.r_min, 0.f);
+    EXPECT_FLOAT_EQ(axes.r_max, 100.f);
+    EXPECT_FLOAT_EQ(axes.z_min, -500.f);
+    EXPECT_FLOAT_EQ(axes.z_max, 500.f);
+    EXPECT_EQ(vol_finder.cells().size(), 80u);
+
+    // Some cells are resolved directly, the others hold a short list
+    dindex n_direct{0u};
+    for (const auto& cell : vol_finder.cells()) {
+        if (cell.n_entries == 0u and cell.value != dindex_invalid) {
+            ++n_direct;
+        }
+    }
+    EXPECT_GT(n_direct, 0u);
+    EXPECT_FALSE(vol_finder.boxes().empty());
+
+    // Points inside the volumes (also off the x-axis)
+    EXPECT_EQ(vol_finder.search(point3{0.f, 0.f, 0.f}), 0u);
+    EXPECT_EQ(vol_finder.search(point3{10.f, 10.f, -450.f}), 0u);
+    EXPECT_EQ(vol_finder.search(point3{30.f, 0.f, 10.f}), 1u);
+    EXPECT_EQ(vol_finder.search(point3{0.f, -45.f, 299.f}), 1u);
+    EXPECT_EQ(vol_finder.search(point3{70.f, 0.f, -100.f}), 2u);
+    EXPECT_EQ(vol_finder.search(point3{0.f, 90.f, -100.f}), 2u);
+    EXPECT_EQ(vol_finder.search(point3{50.f, 50.f, -400.f}), 3u);
+    EXPECT_EQ(vol_finder.search(point3{25.f, 0.f, 301.f}), 4u);
+
+    // The gap between the barrel layers and points outside of all volumes
+    EXPECT_EQ(vol_finder.search(point3{55.f, 0.f, 0.f}), dindex_invalid);
+    EXPECT_EQ(vol_finder.search(point3{101.f, 0.f, 0.f}), dindex_invalid);
+    EXPECT_EQ(vol_finder.search(point3{0.f, 0.f, 501.f}), dindex_invalid);
+
+    // Explicit number of bins
+    vol_finder.build(boxes, 2u, 3u);
+    EXPECT_EQ(vol_finder.cells().size(), 6u);
+    EXPECT_EQ(vol_finder.search(point3{70.f, 0.f, -100.f}), 2u);
+    EXPECT_EQ(vol_finder.search(point3{55.f, 0.f, 0.f}), dindex_invalid);
+}
+
+/// Test the volume finder that the detector builder fills for the toy detector
+GTEST_TEST(detray_navigation, two_level_volume_finder_toy_detector) {
+
+    const auto [det, names] = build_toy_detector(host_mr);
+
+    using detector_t = decltype(det);
+    using box_t = typename detector_t::volume_finder::box_type;
+
+    ASSERT_FALSE(det.volume_search_grid().empty());
+
+    // Every volume is found at the center of its r-z extent
+    const auto boxes = detail::volume_rz_boxes<box_t>(det);
+    EXPECT_EQ(boxes.size(), det.volumes().size());
+
+    for (const box_t& box : boxes) {
+        const scalar r{0.5f * (box.r_min + box.r_max)};
+        const scalar z{0.5f * (box.z_min + box.z_max)};
+
+        EXPECT_EQ(det.volume_search_grid().search(r, z), box.volume);
+        EXPECT_EQ(det.volume(point3{0.f, r, z}).index(), box.volume);
+    }
+}
@@ -20,6 +20,7 @@
 // System include(s)
 #include <iostream>
 #include <map>
+#include <vector>
 
 // This tests the linking of a geometry by loading it into a graph structure
 GTEST_TEST(detray_navigation, volume_graph) {
@@ -88,3 +89,49 @@ GTEST_TEST(detray_navigation, volume_graph) {
     // Check this with graph
     ASSERT_TRUE(adj_mat == adj_truth);
 }
+
+// Compare the volume adjacency of the detector to the graph
+GTEST_TEST(detray_navigation, volume_adjacency) {
+    using namespace detray;
+
+    vecmem::host_memory_resource host_mr;
+
+    toy_det_config<scalar> toy_cfg{};
+    toy_cfg.n_edc_layers(1u);
+
+    auto [det, names] = build_toy_detector(host_mr, toy_cfg);
+
+    using detector_t = decltype(det);
+
+    const volume_graph<detector_t> graph(det);
+    const auto &adj_mat = graph.adjacency_matrix();
+    const auto &adjacency = det.volume_adjacency();
+
+    const dindex n_volumes{static_cast<dindex>(det.volumes().size())};
+    ASSERT_EQ(adjacency.n_volumes(), n_volumes);
+
+    // The graph also counts the links of the sensitive and passive surfaces
+    // to their own volume, so compare the links between different volumes
+    const dindex dim{n_volumes + 1u};
+    for (dindex i = 0u; i < n_volumes; ++i) {
+        std::vector<dindex> n_links(dim, 0u);
+
+        for (const auto &edge : adjacency.neighbours(i)) {
+            const dindex j{edge.leaves_world() ? n_volumes : edge.volume};
+            n_links[j] = edge.n_portals();
+
+            for (const dindex pt_idx : adjacency.portals(edge)) {
+                const auto &pt_desc = det.surface(pt_idx);
+                EXPECT_TRUE(pt_desc.is_portal());
+                EXPECT_EQ(pt_desc.volume(), i);
+            }
+        }
+
+        for (dindex j = 0u; j < dim; ++j) {
+            if (j != i) {
+                EXPECT_EQ(n_links[j], adj_mat[dim * i + j])
+                    << "volume " << i << " -> " << j;
+            }
+        }
+    }
+}
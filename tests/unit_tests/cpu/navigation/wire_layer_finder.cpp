@@ -0,0 +1,179 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Detray include(s)
+#include "detray/navigation/accelerators/wire_layer_finder.hpp"
+
+#include "detray/definitions/units.hpp"
+#include "detray/navigation/detail/ray.hpp"
+#include "detray/test/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+vecmem::host_memory_resource host_mr;
+
+// Algebra definitions
+using point3 = test::point3;
+using vector3 = test::vector3;
+
+/// The wire search does not need the detector
+struct dummy_detector {
+    using volume_type = dindex;
+};
+
+struct navigation_cfg {
+    std::array<dindex, 2> search_window{0u, 0u};
+};
+
+constexpr dindex n_wires{64u};
+constexpr scalar radius{100.f};
+constexpr scalar pitch{2.f * constant<scalar>::pi /
+                       static_cast<scalar>(n_wires)};
+
+/// Build a layer of wires, half a pitch away from phi = 0, with the stereo
+/// angle @param tan_stereo
+wire_layer_collection<dindex> make_layer(const scalar tan_stereo) {
+
+    std::vector<dindex> surfaces{};
+    std::vector<point3> centers{};
+    std::vector<vector3> dirs{};
+    for (dindex i = 0u; i < n_wires; ++i) {
+        const scalar phi{(static_cast<scalar>(i) + 0.5f) * pitch};
+        surfaces.push_back(i);
+        centers.push_back(
+            {radius * std::cos(phi), radius * std::sin(phi), 0.f});
+        dirs.push_back(vector::normalize(vector3{-tan_stereo * std::sin(phi),
+                                                 tan_stereo * std::cos(phi),
+                                                 1.f}));
+    }
+
+    wire_layer_collection<dindex> wire_layers(&host_mr);
+    wire_layers.push_back(surfaces, centers, dirs, 5.f);
+
+    return wire_layers;
+}
+
+/// @returns a radial track at the azimuthal angle @param phi and at @param z
+detail::ray<test::algebra> radial_track(const scalar phi,
+                                        const scalar z = 0.f) {
+    const vector3 dir{std::cos(phi), std::sin(phi), 0.f};
+    return {96.f * dir + point3{0.f, 0.f, z}, 0.f, dir, -1.f};
+}
+
+}  // anonymous namespace
+
+/// Test the sorting of the wires and the search windows
+GTEST_TEST(detray_navigation, wire_layer_collection) {
+
+    const auto wire_layers = make_layer(0.f);
+
+    // Check a few basics
+    EXPECT_EQ(wire_layers.size(), 1UL);
+    ASSERT_FALSE(wire_layers.empty());
+    ASSERT_EQ(wire_layers.all().size(), n_wires);
+
+    const auto wires = wire_layers[0];
+    EXPECT_EQ(wires.size(), n_wires);
+    EXPECT_EQ(wires.all().size(), n_wires);
+    EXPECT_EQ(wires.n_max_candidates(), n_wires);
+    EXPECT_FLOAT_EQ(wires.layer().r_min, 95.f);
+    EXPECT_FLOAT_EQ(wires.layer().r_max, 105.f);
+    EXPECT_FLOAT_EQ(wires.layer().slope_min, 0.f);
+    EXPECT_FLOAT_EQ(wires.layer().slope_max, 0.f);
+
+    // The wires are sorted by their angle in [-pi, pi)
+    for (dindex i = 1u; i < wires.size(); ++i) {
+        EXPECT_LT(wires.phi(i - 1u), wires.phi(i));
+    }
+    EXPECT_EQ(wires.at(0u), n_wires / 2u);
+    EXPECT_EQ(wires.at(n_wires - 1u), n_wires / 2u - 1u);
+
+    const dummy_detector det{};
+    const dindex vol{0u};
+    navigation_cfg cfg{};
+
+    // Collect the wires that are found
+    auto found = [&](const auto& trk) {
+        std::vector<dindex> sfs{};
+        for (const dindex sf : wires.search(det, vol, trk, cfg)) {
+            sfs.push_back(sf);
+        }
+        std::sort(sfs.begin(), sfs.end());
+        return sfs;
+    };
+
+    // Radially outwards between two wires
+    EXPECT_EQ(found(radial_track(0.f)), std::vector<dindex>({0u, 63u}));
+    EXPECT_EQ(found(radial_track(0.8f * pitch)),
+              std::vector<dindex>({0u, 1u}));
+
+    // Wrap around at phi = pi
+    EXPECT_EQ(found(radial_track(constant<scalar>::pi - 0.2f * pitch)),
+              std::vector<dindex>({31u, 32u}));
+
+    // Tangential: the track sweeps over several wires, before it leaves the
+    // layer through the outer radius
+    detail::ray<test::algebra> trk_t({100.f, 0.f, 0.f}, 0.f, {0.f, 1.f, 0.f},
+                                     -1.f);
+    EXPECT_EQ(found(trk_t),
+              std::vector<dindex>({0u, 1u, 2u, 3u, 62u, 63u}));
+
+    // Parallel to the wires: all wires
+    detail::ray<test::algebra> trk_z({100.f, 0.f, 0.f}, 0.f, {0.f, 0.f, 1.f},
+                                     -1.f);
+    EXPECT_EQ(found(trk_z).size(), n_wires);
+
+    // Larger window
+    cfg.search_window = {2u, 0u};
+    EXPECT_EQ(found(radial_track(0.f)),
+              std::vector<dindex>({0u, 1u, 62u, 63u}));
+}
+
+/// Test the search in a layer of stereo wires
+GTEST_TEST(detray_navigation, wire_layer_collection_stereo) {
+
+    // The wire angle changes by 0.001 per mm in z
+    const auto wire_layers = make_layer(0.1f);
+    const auto wires = wire_layers[0];
+
+    EXPECT_NEAR(wires.layer().slope_min, 0.001f, 1e-6f);
+    EXPECT_NEAR(wires.layer().slope_max, 0.001f, 1e-6f);
+
+    const dummy_detector det{};
+    const dindex vol{0u};
+    const navigation_cfg cfg{};
+
+    auto found = [&](const auto& trk) {
+        std::vector<dindex> sfs{};
+        for (const dindex sf : wires.search(det, vol, trk, cfg)) {
+            sfs.push_back(sf);
+        }
+        std::sort(sfs.begin(), sfs.end());
+        return sfs;
+    };
+
+    // At z = 0, the wires are where they are without stereo angle
+    EXPECT_EQ(found(radial_track(0.f)), std::vector<dindex>({0u, 63u}));
+
+    // At z = 100 mm, the wires are shifted by about a pitch
+    EXPECT_EQ(found(radial_track(0.f, 100.f)),
+              std::vector<dindex>({62u, 63u}));
+}
@@ -17,6 +17,8 @@
 // System include(s).
 #include <sstream>
 #include <string>
+#include <type_traits>
+#include <utility>
 
 using namespace detray;
 
@@ -156,3 +158,106 @@ GTEST_TEST(detray_propagator, actor_chain) {
                     "obs 0.2]:") == 0)
         << "Printer call chain: " << printer_state.to_string() << std::endl;
 }
+
+namespace {
+
+/// Mock detector, surface and navigation for the fused surface actor calls
+struct mock_surface {
+    unsigned int *n_visits;
+
+    int transform(int /*ctx*/) const { return 0; }
+
+    template <typename functor_t, typename... Args>
+    void visit_mask(Args &&... args) const {
+        ++(*n_visits);
+        // Pass a mask group and an index
+        functor_t{}(std::string{"mask"}, 3u, std::forward<Args>(args)...);
+    }
+};
+
+struct mock_prop_state {
+    struct detector_type {
+        using geometry_context = int;
+    };
+
+    struct navigation_state {
+        bool on_module{false};
+        mutable unsigned int n_visits{0u};
+
+        bool is_on_module() const { return on_module; }
+        mock_surface get_surface() const { return {&n_visits}; }
+    } _navigation;
+
+    std::stringstream log{};
+};
+
+/// Actor that appends its ID to the propagation log on module surfaces
+template <unsigned int ID>
+struct surface_log_actor : detray::actor {
+
+    struct is_surface_actor : public std::true_type {};
+
+    struct state {};
+
+    /// Called without resolved surface
+    template <typename propagator_state_t>
+    void operator()(state & /*actor_state*/,
+                    propagator_state_t &p_state) const {
+        if (p_state._navigation.is_on_module()) {
+            p_state.log << "[unfused " << ID << "]";
+        }
+    }
+
+    /// Called with the resolved surface mask
+    template <typename surface_t, typename mask_group_t, typename index_t,
+              typename transform3_t, typename propagator_state_t>
+    void operator()(state & /*actor_state*/, const surface_t & /*sf*/,
+                    const mask_group_t &mask_group, const index_t &index,
+                    const transform3_t & /*trf3*/,
+                    propagator_state_t &p_state) const {
+        p_state.log << "[" << mask_group << " " << index << " " << ID << "]";
+    }
+};
+
+/// Actor that is called independently of the surface
+struct log_actor : detray::actor {
+
+    struct state {};
+
+    template <typename propagator_state_t>
+    void operator()(state & /*actor_state*/,
+                    propagator_state_t &p_state) const {
+        p_state.log << "[log]";
+    }
+};
+
+}  // namespace
+
+// Test the fused calls of surface actors
+GTEST_TEST(detray_propagator, actor_chain_surface_actors) {
+
+    using actor_chain_t =
+        actor_chain<dtuple, surface_log_actor<0u>, log_actor,
+                    surface_log_actor<1u>>;
+
+    actor_chain_t::state_tuple states{};
+    auto actor_states = actor_chain_t::make_state(states);
+
+    actor_chain_t run_actors{};
+    mock_prop_state prop_state{};
+
+    // Not on a surface: Only the generic actor is called
+    run_actors(actor_states, prop_state);
+
+    EXPECT_EQ(prop_state.log.str(), "[log]");
+    EXPECT_EQ(prop_state._navigation.n_visits, 0u);
+
+    // On a surface: The mask is visited once for all actors, which are called
+    // in order
+    prop_state.log.str("");
+    prop_state._navigation.on_module = true;
+    run_actors(actor_states, prop_state);
+
+    EXPECT_EQ(prop_state.log.str(), "[mask 3 0][log][mask 3 1]");
+    EXPECT_EQ(prop_state._navigation.n_visits, 1u);
+}
@@ -0,0 +1,193 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "detray/propagator/async_service.hpp"
+
+// Vecmem include(s).
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+/// Doubles every "track"
+struct double_dispatcher {
+    void operator()(const vecmem::vector<int> &tracks,
+                    vecmem::vector<int> &results) const {
+        for (std::size_t i = 0u; i < tracks.size(); ++i) {
+            results[i] = 2 * tracks[i];
+        }
+    }
+};
+
+/// Fails on every batch
+struct failing_dispatcher {
+    void operator()(const vecmem::vector<int> &, vecmem::vector<int> &) const {
+        throw std::runtime_error("Dispatch failed");
+    }
+};
+
+}  // anonymous namespace
+
+// Test the results of single requests and the flush on the deadline
+GTEST_TEST(detray_propagator, async_service_deadline) {
+
+    using service_t = propagation::async_service<int, int, double_dispatcher>;
+
+    vecmem::host_memory_resource host_mr;
+
+    service_t::config cfg{};
+    cfg.batch_size = 1000u;
+    cfg.max_delay = std::chrono::microseconds{200};
+    service_t service{double_dispatcher{}, host_mr, cfg};
+
+    // The batch never fills up: Dispatched on the deadline
+    auto future = service.submit({1, 2, 3});
+    const std::vector<int> results = future.get();
+
+    ASSERT_EQ(results.size(), 3u);
+    EXPECT_EQ(results[0], 2);
+    EXPECT_EQ(results[1], 4);
+    EXPECT_EQ(results[2], 6);
+
+    const auto stats = service.stats();
+    EXPECT_EQ(stats.n_batches, 1u);
+    EXPECT_EQ(stats.n_tracks, 3u);
+    EXPECT_EQ(stats.n_deadline_batches, 1u);
+
+    // Empty requests complete, too
+    EXPECT_TRUE(service.submit({}).get().empty());
+}
+
+// Test the coalescing of requests from several threads into full batches
+GTEST_TEST(detray_propagator, async_service_batching) {
+
+    using service_t = propagation::async_service<int, int, double_dispatcher>;
+
+    vecmem::host_memory_resource host_mr;
+
+    constexpr int n_threads{4};
+    constexpr int n_requests{50};
+    constexpr int n_tracks{8};
+
+    // Long delay: Only the last batch should wait for the deadline
+    service_t::config cfg{};
+    cfg.batch_size = 64u;
+    cfg.max_delay = std::chrono::microseconds{20000};
+
+    std::atomic<int> n_callbacks{0};
+    std::atomic<int> n_wrong{0};
+    {
+        service_t service{double_dispatcher{}, host_mr, cfg};
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < n_threads; ++t) {
+            threads.emplace_back([&, t]() {
+                std::vector<std::future<std::vector<int>>> futures;
+                for (int r = 0; r < n_requests; ++r) {
+                    const int first{(t * n_requests + r) * n_tracks};
+                    std::vector<int> tracks(n_tracks);
+                    for (int i = 0; i < n_tracks; ++i) {
+                        tracks[static_cast<std::size_t>(i)] = first + i;
+                    }
+
+                    // Alternate between futures and callbacks
+                    if (r % 2 == 0) {
+                        futures.push_back(service.submit(tracks));
+                        continue;
+                    }
+                    service.submit(tracks, [&, first](std::vector<int> &&res) {
+                        for (int i = 0; i < n_tracks; ++i) {
+                            if (res[static_cast<std::size_t>(i)] !=
+                                2 * (first + i)) {
+                                ++n_wrong;
+                            }
+                        }
+                        ++n_callbacks;
+                    });
+                }
+
+                for (std::size_t r = 0u; r < futures.size(); ++r) {
+                    const std::vector<int> res = futures[r].get();
+                    const int first{(t * n_requests + 2 * static_cast<int>(r)) *
+                                    n_tracks};
+                    for (int i = 0; i < n_tracks; ++i) {
+                        if (res[static_cast<std::size_t>(i)] !=
+                            2 * (first + i)) {
+                            ++n_wrong;
+                        }
+                    }
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+
+        // The remaining callbacks are completed before the service stops
+    }
+
+    EXPECT_EQ(n_wrong.load(), 0);
+    EXPECT_EQ(n_callbacks.load(), n_threads * n_requests / 2);
+}
+
+// Test the batch statistics and that requests are not split
+GTEST_TEST(detray_propagator, async_service_batch_size) {
+
+    using service_t = propagation::async_service<int, int, double_dispatcher>;
+
+    vecmem::host_memory_resource host_mr;
+
+    service_t::config cfg{};
+    cfg.batch_size = 10u;
+    cfg.max_delay = std::chrono::microseconds{100};
+    service_t service{double_dispatcher{}, host_mr, cfg};
+
+    // Larger than a batch: Dispatched on its own
+    const std::vector<int> results =
+        service.submit(std::vector<int>(25, 1)).get();
+    ASSERT_EQ(results.size(), 25u);
+    for (const int r : results) {
+        EXPECT_EQ(r, 2);
+    }
+
+    const auto stats = service.stats();
+    EXPECT_EQ(stats.n_batches, 1u);
+    EXPECT_EQ(stats.n_tracks, 25u);
+}
+
+// Test the error handling of a failing dispatcher
+GTEST_TEST(detray_propagator, async_service_error) {
+
+    using service_t = propagation::async_service<int, int, failing_dispatcher>;
+
+    vecmem::host_memory_resource host_mr;
+    service_t service{failing_dispatcher{}, host_mr};
+
+    auto future = service.submit({1, 2});
+
+    std::promise<std::size_t> n_results;
+    service.submit({3}, [&n_results](std::vector<int> &&res) {
+        n_results.set_value(res.size());
+    });
+
+    EXPECT_THROW(future.get(), std::runtime_error);
+    EXPECT_EQ(n_results.get_future().get(), 0u);
+}
@@ -0,0 +1,106 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "detray/propagator/covariance_batch.hpp"
+
+#include "detray/definitions/track_parametrization.hpp"
+#include "detray/test/types.hpp"
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <vector>
+
+using namespace detray;
+
+using algebra_t = test::algebra;
+using matrix_operator = test::matrix_operator;
+
+namespace {
+
+constexpr scalar tol{1e-4f};
+
+/// @returns a jacobian that differs from track to track
+bound_matrix<algebra_t> make_jacobian(const unsigned int trk) {
+    bound_matrix<algebra_t> jac =
+        matrix_operator().template identity<e_bound_size, e_bound_size>();
+    for (unsigned int i = 0u; i < e_bound_size; ++i) {
+        for (unsigned int j = 0u; j < e_bound_size; ++j) {
+            getter::element(jac, i, j) +=
+                0.01f * static_cast<scalar>((i + 3u * j + trk) % 7u);
+        }
+    }
+    return jac;
+}
+
+/// @returns a symmetric covariance that differs from track to track
+bound_matrix<algebra_t> make_covariance(const unsigned int trk) {
+    bound_matrix<algebra_t> cov =
+        matrix_operator().template zero<e_bound_size, e_bound_size>();
+    for (unsigned int i = 0u; i < e_bound_size; ++i) {
+        for (unsigned int j = 0u; j < e_bound_size; ++j) {
+            getter::element(cov, i, j) =
+                (i == j) ? 1.f + 0.1f * static_cast<scalar>(trk % 5u)
+                         : 0.05f / static_cast<scalar>(i + j);
+        }
+    }
+    return cov;
+}
+
+}  // anonymous namespace
+
+// Compare the batched covariance transport with the dense matrix products
+GTEST_TEST(detray_propagator, covariance_batch) {
+
+    using batch_view_t = propagation::bound_matrix_batch_view<algebra_t>;
+
+    // Not a multiple of the lane width of the host transport
+    constexpr unsigned int n_tracks{150u};
+
+    std::vector<scalar> jac_data(batch_view_t::n_elements(n_tracks));
+    std::vector<scalar> cov_data(batch_view_t::n_elements(n_tracks));
+    std::vector<scalar> cov_data_single(batch_view_t::n_elements(n_tracks));
+
+    const batch_view_t jac_batch{jac_data.data(), n_tracks};
+    const batch_view_t cov_batch{cov_data.data(), n_tracks};
+    const batch_view_t cov_batch_single{cov_data_single.data(), n_tracks};
+
+    for (unsigned int trk = 0u; trk < n_tracks; ++trk) {
+        propagation::gather(make_jacobian(trk), jac_batch, trk);
+        propagation::gather(make_covariance(trk), cov_batch, trk);
+        propagation::gather(make_covariance(trk), cov_batch_single, trk);
+    }
+
+    // Lane parallel and one track at a time
+    propagation::transport_covariance(jac_batch, cov_batch);
+    for (unsigned int trk = 0u; trk < n_tracks; ++trk) {
+        propagation::transport_covariance(jac_batch, cov_batch_single, trk);
+    }
+
+    for (unsigned int trk = 0u; trk < n_tracks; ++trk) {
+        const bound_matrix<algebra_t> jac = make_jacobian(trk);
+        const bound_matrix<algebra_t> ref_cov =
+            jac * make_covariance(trk) * matrix_operator().transpose(jac);
+
+        bound_matrix<algebra_t> new_cov =
+            matrix_operator().template zero<e_bound_size, e_bound_size>();
+        propagation::scatter(cov_batch, trk, new_cov);
+
+        for (unsigned int i = 0u; i < e_bound_size; ++i) {
+            for (unsigned int j = 0u; j < e_bound_size; ++j) {
+                EXPECT_NEAR(getter::element(new_cov, i, j),
+                            getter::element(ref_cov, i, j), tol)
+                    << "track " << trk;
+                EXPECT_NEAR(cov_batch_single(i, j, trk),
+                            getter::element(ref_cov, i, j), tol)
+                    << "track " << trk;
+            }
+        }
+    }
+}
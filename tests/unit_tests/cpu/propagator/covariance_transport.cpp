@@ -134,3 +134,153 @@ GTEST_TEST(detray_propagator, covariance_transport) {
         }
     }
 }
+
+namespace {
+
+/// Surface with the properties that decide about the bound conversion
+struct mock_surface {
+    bool m_sensitive{false};
+    bool m_material{false};
+
+    constexpr bool is_sensitive() const { return m_sensitive; }
+    constexpr bool has_material() const { return m_material; }
+};
+
+}  // anonymous namespace
+
+GTEST_TEST(detray_propagator, lazy_bound_conversion) {
+
+    using stepper_state_t = line_stepper<algebra_t>::state;
+
+    stepper_state_t stepping{free_track_parameters<algebra_t>{}};
+
+    const mock_surface passive{false, false};
+    const mock_surface passive_with_material{false, true};
+    const mock_surface sensitive{true, false};
+
+    // By default, the parameters are converted on every module surface
+    EXPECT_TRUE(stepping.do_bound_conversion(passive));
+    EXPECT_TRUE(stepping.do_bound_conversion(passive_with_material));
+    EXPECT_TRUE(stepping.do_bound_conversion(sensitive));
+
+    // Lazy: skip the passive surfaces without material
+    stepping.set_lazy_bound_conversion(true);
+    EXPECT_FALSE(stepping.do_bound_conversion(passive));
+    EXPECT_TRUE(stepping.do_bound_conversion(passive_with_material));
+    EXPECT_TRUE(stepping.do_bound_conversion(sensitive));
+
+    // The telescope surfaces are sensitive: same result in both modes
+    vecmem::host_memory_resource host_mr;
+
+    detail::ray<algebra_t> traj{{0.f, 0.f, 0.f}, 0.f, {1.f, 0.f, 0.f}, -1.f};
+    tel_det_config<rectangle2D> tel_cfg{200.f * unit<scalar>::mm,
+                                        200.f * unit<scalar>::mm};
+    tel_cfg.positions({0.f, 10.f, 20.f, 30.f}).pilot_track(traj);
+
+    const auto [det, names] = build_telescope_detector(host_mr, tel_cfg);
+
+    using navigator_t = navigator<decltype(det)>;
+    using actor_chain_t = actor_chain<dtuple, parameter_transporter<algebra_t>,
+                                      parameter_resetter<algebra_t>>;
+    using propagator_t =
+        propagator<line_stepper<algebra_t>, navigator_t, actor_chain_t>;
+
+    typename bound_track_parameters<algebra_t>::vector_type bound_vector =
+        matrix_operator().template zero<e_bound_size, 1u>();
+    getter::element(bound_vector, e_bound_theta, 0u) = constant<scalar>::pi_4;
+    getter::element(bound_vector, e_bound_qoverp, 0u) = -0.1f;
+
+    const bound_track_parameters<algebra_t> bound_param0(
+        geometry::barcode{}.set_index(0u), bound_vector,
+        matrix_operator().template identity<e_bound_size, e_bound_size>());
+
+    propagator_t p{};
+
+    parameter_transporter<algebra_t>::state transporter{};
+    parameter_resetter<algebra_t>::state resetter{};
+
+    propagator_t::state eager_propagation(bound_param0, det);
+    p.propagate(eager_propagation, std::tie(transporter, resetter));
+
+    propagator_t::state lazy_propagation(bound_param0, det);
+    lazy_propagation._stepping.set_lazy_bound_conversion(true);
+    p.propagate(lazy_propagation, std::tie(transporter, resetter));
+
+    const auto& eager_param = eager_propagation._stepping._bound_params;
+    const auto& lazy_param = lazy_propagation._stepping._bound_params;
+
+    EXPECT_EQ(eager_param.surface_link(), lazy_param.surface_link());
+    for (unsigned int i = 0u; i < e_bound_size; i++) {
+        for (unsigned int j = 0u; j < e_bound_size; j++) {
+            EXPECT_NEAR(
+                matrix_operator().element(eager_param.covariance(), i, j),
+                matrix_operator().element(lazy_param.covariance(), i, j), tol);
+        }
+    }
+}
+
+// Trajectory-only transport: same track parameters, covariance untouched
+GTEST_TEST(detray_propagator, covariance_transport_disabled) {
+
+    vecmem::host_memory_resource host_mr;
+
+    detail::ray<algebra_t> traj{{0.f, 0.f, 0.f}, 0.f, {1.f, 0.f, 0.f}, -1.f};
+    tel_det_config<rectangle2D> tel_cfg{200.f * unit<scalar>::mm,
+                                        200.f * unit<scalar>::mm};
+    tel_cfg.positions({0.f, 10.f, 20.f, 30.f}).pilot_track(traj);
+
+    const auto [det, names] = build_telescope_detector(host_mr, tel_cfg);
+
+    using navigator_t = navigator<decltype(det)>;
+    using stepper_t = line_stepper<algebra_t>;
+    using cov_chain_t = actor_chain<dtuple, parameter_transporter<algebra_t>,
+                                    parameter_resetter<algebra_t>>;
+    using trajectory_chain_t =
+        actor_chain<dtuple, parameter_transporter<algebra_t, false>,
+                    parameter_resetter<algebra_t, false>>;
+    using cov_propagator_t = propagator<stepper_t, navigator_t, cov_chain_t>;
+    using trj_propagator_t =
+        propagator<stepper_t, navigator_t, trajectory_chain_t>;
+
+    typename bound_track_parameters<algebra_t>::vector_type bound_vector =
+        matrix_operator().template zero<e_bound_size, 1u>();
+    getter::element(bound_vector, e_bound_theta, 0u) = constant<scalar>::pi_4;
+    getter::element(bound_vector, e_bound_qoverp, 0u) = -0.1f;
+
+    const bound_track_parameters<algebra_t> bound_param0(
+        geometry::barcode{}.set_index(0u), bound_vector,
+        matrix_operator().template identity<e_bound_size, e_bound_size>());
+
+    // Covariance transport
+    cov_propagator_t cov_p{};
+    parameter_transporter<algebra_t>::state cov_transporter{};
+    parameter_resetter<algebra_t>::state cov_resetter{};
+
+    cov_propagator_t::state cov_propagation(bound_param0, det);
+    cov_p.propagate(cov_propagation, std::tie(cov_transporter, cov_resetter));
+
+    // Track parameters only
+    trj_propagator_t trj_p{};
+    parameter_transporter<algebra_t, false>::state trj_transporter{};
+    parameter_resetter<algebra_t, false>::state trj_resetter{};
+
+    trj_propagator_t::state trj_propagation(bound_param0, det);
+    trj_propagation._stepping.set_covariance_transport(false);
+    trj_p.propagate(trj_propagation, std::tie(trj_transporter, trj_resetter));
+
+    const auto& cov_param = cov_propagation._stepping._bound_params;
+    const auto& trj_param = trj_propagation._stepping._bound_params;
+
+    EXPECT_EQ(cov_param.surface_link(), trj_param.surface_link());
+    for (unsigned int i = 0u; i < e_bound_size; i++) {
+        EXPECT_NEAR(matrix_operator().element(cov_param.vector(), i, 0u),
+                    matrix_operator().element(trj_param.vector(), i, 0u), tol);
+
+        // The initial covariance was not transported
+        for (unsigned int j = 0u; j < e_bound_size; j++) {
+            EXPECT_FLOAT_EQ(
+                matrix_operator().element(trj_param.covariance(), i, j),
+                matrix_operator().element(bound_param0.covariance(), i, j));
+        }
+    }
+}
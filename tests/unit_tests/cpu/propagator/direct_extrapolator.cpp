@@ -0,0 +1,300 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/propagator/direct_extrapolator.hpp"
+
+#include "detray/definitions/units.hpp"
+#include "detray/geometry/mask.hpp"
+#include "detray/geometry/shapes/line.hpp"
+#include "detray/geometry/shapes/rectangle2D.hpp"
+#include "detray/materials/lumped_cylinder_material.hpp"
+#include "detray/materials/predefined_materials.hpp"
+#include "detray/navigation/detail/helix.hpp"
+#include "detray/test/types.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Google Test include(s).
+#include <gtest/gtest.h>
+
+using namespace detray;
+
+namespace {
+
+using algebra_t = test::algebra;
+using transform3_t = test::transform3;
+using vector3 = test::vector3;
+using point3 = test::point3;
+using matrix_operator = test::matrix_operator;
+using extrapolator_t = direct_extrapolator<algebra_t>;
+
+constexpr scalar tol{1e-3f};
+
+const vector3 z_axis{0.f, 0.f, 1.f};
+
+// Homogeneous field
+struct const_field {
+    vector3 at(const scalar, const scalar, const scalar) const { return m_b; }
+
+    vector3 m_b;
+};
+
+// Solenoid-like field that decreases linearly along z
+struct gradient_field {
+    vector3 at(const scalar, const scalar, const scalar z) const {
+        return {0.f, 0.f,
+                2.f * unit<scalar>::T * (1.f - z / (4.f * unit<scalar>::m))};
+    }
+};
+
+// Track through the origin
+const free_track_parameters<algebra_t> free_trk(
+    {0.f, 0.f, 0.f}, 0.f,
+    {1.f * unit<scalar>::GeV, 0.f, 0.5f * unit<scalar>::GeV}, -1.f);
+
+// Placement of a plane that is perpendicular to the track at @param s
+transform3_t plane_placement(const detail::helix<algebra_t> &hlx,
+                             const scalar s) {
+    const vector3 w = hlx.dir(s);
+    return transform3_t{hlx(s), w, vector::cross(z_axis, w)};
+}
+
+}  // anonymous namespace
+
+/// Extrapolate to a plane in a homogeneous field
+GTEST_TEST(detray_propagator, direct_extrapolator_homogeneous) {
+
+    const const_field field{{0.f, 0.f, 2.f * unit<scalar>::T}};
+    const detail::helix<algebra_t> hlx(free_trk, &field.m_b);
+
+    const scalar path{50.f * unit<scalar>::cm};
+    const transform3_t trf = plane_placement(hlx, path);
+    const mask<rectangle2D> rectangle{0u, 10.f * unit<scalar>::cm,
+                                      10.f * unit<scalar>::cm};
+
+    const auto res = extrapolator_t{}(free_trk, rectangle, trf, field);
+
+    ASSERT_TRUE(res.success);
+    // A single step, the second iteration only confirms
+    EXPECT_EQ(res.n_iterations, 2u);
+    EXPECT_NEAR(res.path_length, path, tol);
+
+    const point3 pos = res.free_params.pos();
+    const point3 exp_pos = hlx(path);
+    for (unsigned int i = 0u; i < 3u; ++i) {
+        EXPECT_NEAR(pos[i], exp_pos[i], tol);
+    }
+    EXPECT_NEAR(res.bound_params.bound_local()[0], 0.f, tol);
+    EXPECT_NEAR(res.bound_params.bound_local()[1], 0.f, tol);
+    EXPECT_NEAR(res.bound_params.qop(), free_trk.qop(), tol);
+
+    // Same transport jacobian as the analytical helix
+    const auto exp_jac = hlx.jacobian(path);
+    for (unsigned int i = 0u; i < e_free_size; ++i) {
+        for (unsigned int j = 0u; j < e_free_size; ++j) {
+            const scalar exp{matrix_operator().element(exp_jac, i, j)};
+            EXPECT_NEAR(matrix_operator().element(res.free_jacobian, i, j),
+                        exp, tol * (1.f + math::abs(exp)));
+        }
+    }
+
+    // The plane lies behind the track
+    const auto res_back = extrapolator_t{}(
+        free_track_parameters<algebra_t>{hlx(2.f * path), 0.f,
+                                         free_trk.p() * hlx.dir(2.f * path),
+                                         -1.f},
+        rectangle, trf, field);
+    EXPECT_FALSE(res_back.success);
+
+    // The target is missed
+    const mask<rectangle2D> small_rectangle{0u, 1.f * unit<scalar>::mm,
+                                            1.f * unit<scalar>::mm};
+    const transform3_t shifted{
+        hlx(path) + 5.f * unit<scalar>::mm * z_axis, hlx.dir(path),
+        vector::cross(z_axis, hlx.dir(path))};
+    EXPECT_FALSE(
+        extrapolator_t{}(free_trk, small_rectangle, shifted, field).success);
+}
+
+/// Extrapolate along a straight line, with and without the backward direction
+GTEST_TEST(detray_propagator, direct_extrapolator_no_field) {
+
+    const const_field field{{0.f, 0.f, 0.f}};
+
+    const free_track_parameters<algebra_t> trk(
+        {0.f, 0.f, 0.f}, 0.f,
+        {1.f * unit<scalar>::GeV, 1.f * unit<scalar>::GeV, 0.f}, -1.f);
+
+    const mask<rectangle2D> rectangle{0u, 2.f * unit<scalar>::m,
+                                      2.f * unit<scalar>::m};
+    // Plane at x = +-1m (normal along x)
+    const transform3_t front{vector3{1.f * unit<scalar>::m, 0.f, 0.f},
+                             vector3{1.f, 0.f, 0.f}, vector3{0.f, 1.f, 0.f}};
+    const transform3_t back{vector3{-1.f * unit<scalar>::m, 0.f, 0.f},
+                            vector3{1.f, 0.f, 0.f}, vector3{0.f, 1.f, 0.f}};
+
+    const scalar exp_path{constant<scalar>::sqrt2 * unit<scalar>::m};
+
+    const auto res = extrapolator_t{}(trk, rectangle, front, field);
+    ASSERT_TRUE(res.success);
+    EXPECT_EQ(res.n_iterations, 1u);
+    EXPECT_NEAR(res.path_length, exp_path, tol);
+    EXPECT_NEAR(res.free_params.pos()[1], 1.f * unit<scalar>::m, tol);
+    EXPECT_NEAR(
+        matrix_operator().element(res.free_jacobian, e_free_pos0, e_free_dir0),
+        exp_path, tol);
+
+    EXPECT_FALSE(extrapolator_t{}(trk, rectangle, back, field).success);
+
+    extrapolation::config<scalar> cfg{};
+    cfg.allow_backward = true;
+    const auto res_back = extrapolator_t{}(
+        trk, rectangle, back, field,
+        static_cast<const extrapolator_t::material_type *>(nullptr), cfg);
+    ASSERT_TRUE(res_back.success);
+    EXPECT_NEAR(res_back.path_length, -exp_path, tol);
+    EXPECT_NEAR(res_back.free_params.pos()[1], -1.f * unit<scalar>::m, tol);
+}
+
+/// Extrapolate to a plane and back to the departure surface and to the beam
+/// line (perigee)
+GTEST_TEST(detray_propagator, direct_extrapolator_bound) {
+
+    const const_field field{{0.f, 0.f, 2.f * unit<scalar>::T}};
+    const detail::helix<algebra_t> hlx(free_trk, &field.m_b);
+
+    const mask<rectangle2D> rectangle{0u, 10.f * unit<scalar>::cm,
+                                      10.f * unit<scalar>::cm};
+    const transform3_t departure = plane_placement(hlx, 0.f);
+    const transform3_t target = plane_placement(hlx, 30.f * unit<scalar>::cm);
+
+    // Bound parameters on the departure surface
+    const auto bound_vec = detail::free_to_bound_vector<
+        mask<rectangle2D>::local_frame_type>(departure, free_trk.vector());
+    auto bound_cov =
+        matrix_operator().template identity<e_bound_size, e_bound_size>();
+    for (unsigned int i = 0u; i < e_bound_size; ++i) {
+        matrix_operator().element(bound_cov, i, i) = 0.01f;
+    }
+    const bound_track_parameters<algebra_t> bound_params{
+        geometry::barcode{}, bound_vec, bound_cov};
+
+    extrapolation::config<scalar> cfg{};
+    cfg.allow_backward = true;
+    const auto *no_mat =
+        static_cast<const extrapolator_t::material_type *>(nullptr);
+
+    const auto res = extrapolator_t{}(bound_params, rectangle, departure,
+                                      rectangle, target, field, no_mat, cfg);
+    ASSERT_TRUE(res.success);
+    EXPECT_NEAR(res.path_length, 30.f * unit<scalar>::cm, tol);
+
+    // Transported covariance
+    for (unsigned int i = 0u; i < e_bound_size; ++i) {
+        EXPECT_GT(
+            matrix_operator().element(res.bound_params.covariance(), i, i),
+            0.f);
+    }
+
+    // Back to the departure surface
+    const auto res_back =
+        extrapolator_t{}(res.bound_params, rectangle, target, rectangle,
+                         departure, field, no_mat, cfg);
+    ASSERT_TRUE(res_back.success);
+    EXPECT_NEAR(res_back.path_length, -30.f * unit<scalar>::cm, tol);
+    for (unsigned int i = 0u; i < e_bound_size; ++i) {
+        EXPECT_NEAR(matrix_operator().element(res_back.bound_params.vector(),
+                                              i, 0u),
+                    matrix_operator().element(bound_vec, i, 0u), tol);
+    }
+
+    // The jacobians of both directions are inverse to each other
+    const auto round_trip = res_back.full_jacobian * res.full_jacobian;
+    for (unsigned int i = 0u; i < e_bound_size; ++i) {
+        for (unsigned int j = 0u; j < e_bound_size; ++j) {
+            EXPECT_NEAR(matrix_operator().element(round_trip, i, j),
+                        (i == j) ? 1.f : 0.f, 1e-2f);
+        }
+    }
+
+    // Perigee: Line surface along the z-axis
+    const mask<line_circular> beam_line{0u, 1.f * unit<scalar>::m,
+                                        1.f * unit<scalar>::m};
+    const auto res_perigee = extrapolator_t{}(
+        res.bound_params, rectangle, target, beam_line, transform3_t{}, field,
+        no_mat, cfg);
+    ASSERT_TRUE(res_perigee.success);
+    // The track started on the beam line
+    EXPECT_NEAR(res_perigee.path_length, -30.f * unit<scalar>::cm, tol);
+    EXPECT_NEAR(res_perigee.bound_params.bound_local()[0], 0.f, tol);
+    EXPECT_NEAR(res_perigee.bound_params.bound_local()[1], 0.f, tol);
+}
+
+/// Extrapolate in an inhomogeneous field
+GTEST_TEST(detray_propagator, direct_extrapolator_gradient_field) {
+
+    const gradient_field field{};
+    const vector3 b0{field.at(0.f, 0.f, 0.f)};
+    const detail::helix<algebra_t> hlx(free_trk, &b0);
+
+    const transform3_t trf = plane_placement(hlx, 1.f * unit<scalar>::m);
+    const mask<rectangle2D> rectangle{0u, 1.f * unit<scalar>::m,
+                                      1.f * unit<scalar>::m};
+
+    const auto res = extrapolator_t{}(free_trk, rectangle, trf, field);
+
+    ASSERT_TRUE(res.success);
+    // The field changes along the way
+    EXPECT_GT(res.n_iterations, 2u);
+
+    // On the plane
+    const point3 loc = trf.point_to_local(res.free_params.pos());
+    EXPECT_NEAR(loc[2], 0.f, tol);
+}
+
+/// Collect the material of a lumped material model
+GTEST_TEST(detray_propagator, direct_extrapolator_material) {
+
+    const const_field field{{0.f, 0.f, 0.f}};
+    const transform3_t trf{vector3{1.f * unit<scalar>::m, 0.f, 0.f},
+                           vector3{1.f, 0.f, 0.f}, vector3{0.f, 1.f, 0.f}};
+    const mask<rectangle2D> rectangle{0u, 1.f * unit<scalar>::m,
+                                      1.f * unit<scalar>::m};
+
+    const free_track_parameters<algebra_t> trk(
+        {0.f, 0.f, 0.f}, 0.f, {1.f * unit<scalar>::GeV, 0.f, 0.f}, -1.f);
+
+    const material_slab<scalar> beampipe{beryllium<scalar>(),
+                                         0.8f * unit<scalar>::mm};
+    const material_slab<scalar> layer{silicon<scalar>(),
+                                      0.5f * unit<scalar>::mm};
+
+    lumped_cylinder_material<scalar> mat{};
+    ASSERT_TRUE(mat.add(25.f * unit<scalar>::mm, 1.f * unit<scalar>::m,
+                        beampipe));
+    ASSERT_TRUE(mat.add(50.f * unit<scalar>::cm, 1.f * unit<scalar>::m,
+                        layer));
+    // Not reached
+    ASSERT_TRUE(mat.add(2.f * unit<scalar>::m, 1.f * unit<scalar>::m, layer));
+    EXPECT_EQ(mat.size(), 3u);
+
+    const auto res = extrapolator_t{}(trk, rectangle, trf, field, &mat);
+    ASSERT_TRUE(res.success);
+
+    // Perpendicular crossings
+    EXPECT_NEAR(res.path_in_X0,
+                beampipe.thickness_in_X0() + layer.thickness_in_X0(), tol);
+    EXPECT_NEAR(res.path_in_L0,
+                beampipe.thickness_in_L0() + layer.thickness_in_L0(), tol);
+
+    // Bent track: At least the same material
+    const const_field b_field{{0.f, 0.f, 2.f * unit<scalar>::T}};
+    const auto res_b = extrapolator_t{}(trk, rectangle, trf, b_field, &mat);
+    ASSERT_TRUE(res_b.success);
+    EXPECT_GE(res_b.path_in_X0 + tol,
+              beampipe.thickness_in_X0() + layer.thickness_in_X0());
+}
@@ -0,0 +1,77 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "detray/propagator/event_memory_resource.hpp"
+
+// Vecmem include(s).
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cstddef>
+#include <cstdint>
+
+using namespace detray;
+
+// Test the bump allocation and the rollback of the latest allocation
+GTEST_TEST(detray_propagator, event_memory_resource) {
+
+    vecmem::host_memory_resource host_mr;
+    propagation::event_memory_resource event_mr{host_mr, 1024u};
+
+    EXPECT_EQ(event_mr.n_slabs(), 0u);
+    EXPECT_EQ(event_mr.capacity(), 0u);
+
+    // Alignment is respected
+    void *p0 = event_mr.allocate(3u, 1u);
+    void *p1 = event_mr.allocate(16u, 16u);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p1) % 16u, 0u);
+    EXPECT_NE(p0, p1);
+    EXPECT_EQ(event_mr.n_slabs(), 1u);
+    EXPECT_EQ(event_mr.capacity(), 1024u);
+
+    // The latest allocation is given back and reused
+    event_mr.deallocate(p1, 16u, 16u);
+    void *p2 = event_mr.allocate(16u, 16u);
+    EXPECT_EQ(p1, p2);
+
+    // Older allocations are only freed by the reset
+    event_mr.deallocate(p0, 3u, 1u);
+    void *p3 = event_mr.allocate(3u, 1u);
+    EXPECT_NE(p0, p3);
+
+    // Oversized allocations get their own slab
+    void *big = event_mr.allocate(4096u, 8u);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(big) % 8u, 0u);
+    EXPECT_EQ(event_mr.n_slabs(), 2u);
+    EXPECT_GE(event_mr.capacity(), 1024u + 4096u);
+
+    // The slabs are kept for the next event
+    event_mr.reset();
+    EXPECT_EQ(event_mr.n_slabs(), 2u);
+    EXPECT_EQ(event_mr.allocate(3u, 1u), p0);
+
+    // A second event with the same allocations needs no new slabs
+    {
+        vecmem::vector<int> v(&event_mr);
+        for (int i = 0; i < 500; ++i) {
+            v.push_back(i);
+        }
+        EXPECT_EQ(v.size(), 500u);
+        EXPECT_EQ(v[499], 499);
+    }
+    EXPECT_EQ(event_mr.n_slabs(), 2u);
+
+    // Give everything back to the upstream resource
+    event_mr.release();
+    EXPECT_EQ(event_mr.n_slabs(), 0u);
+    EXPECT_EQ(event_mr.capacity(), 0u);
+}
@@ -0,0 +1,298 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// detray include(s)
+#include "detray/propagator/helix_stepper.hpp"
+
+#include "detray/builders/volume_builder.hpp"
+#include "detray/core/detector.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/navigation/detail/trajectories.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/simulation/event_generator/track_generators.hpp"
+#include "detray/test/types.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// System include(s)
+#include <memory>
+
+// google-test include(s)
+#include <gtest/gtest.h>
+
+using namespace detray;
+
+using algebra_t = test::algebra;
+using vector3 = test::vector3;
+using point3 = test::point3;
+using matrix_operator = test::matrix_operator;
+
+/// Steppers
+template <typename bfield_view_t>
+using helix_stepper_t = helix_stepper<bfield_view_t, algebra_t>;
+template <typename bfield_view_t>
+using chelix_stepper_t =
+    helix_stepper<bfield_view_t, algebra_t, constrained_step<>>;
+template <typename bfield_view_t>
+using rk_stepper_t = rk_stepper<bfield_view_t, algebra_t>;
+
+namespace {
+
+constexpr scalar tol{1e-3f};
+
+vecmem::host_memory_resource host_mr;
+
+// dummy navigation struct
+struct nav_state {
+    /// New detector
+    nav_state(vecmem::host_memory_resource &mr, const scalar step_size)
+        : m_step_size{step_size},
+          m_det{std::make_unique<detray::detector<>>(mr)} {
+
+        // Empty dummy volume without material
+        volume_builder<detray::detector<>> vbuilder{volume_id::e_cylinder};
+        vbuilder.build(*m_det);
+    }
+
+    scalar operator()() const { return m_step_size; }
+    inline auto current_object() const -> dindex { return dindex_invalid; }
+    inline auto tolerance() const -> scalar { return tol; }
+    inline auto detector() const -> const detray::detector<> * {
+        return m_det.get();
+    }
+    inline auto volume() -> unsigned int { return 0u; }
+    inline void set_full_trust() {}
+    inline void set_high_trust() {}
+    inline void set_fair_trust() {}
+    inline void set_no_trust() {}
+    inline bool abort() { return false; }
+
+    scalar m_step_size;
+    std::unique_ptr<detray::detector<>> m_det;
+};
+
+// Solenoid-like field that decreases linearly along z
+struct gradient_field {
+    vector3 at(const scalar, const scalar, const scalar z) const {
+        return {0.f, 0.f, (2.f - 1e-3f * z) * unit<scalar>::T};
+    }
+};
+
+// dummy propagator state
+template <typename stepping_t, typename navigation_t>
+struct prop_state {
+    stepping_t _stepping;
+    navigation_t _navigation;
+};
+
+}  // namespace
+
+// This tests the track state of the helix stepper in a constant field
+GTEST_TEST(detray_propagator, helix_stepper) {
+
+    // Constant magnetic field
+    using bfield_t = bfield::const_field_t;
+    using bfield_view_t = bfield_t::view_t;
+
+    vector3 B{1.f * unit<scalar>::T, 1.f * unit<scalar>::T,
+              1.f * unit<scalar>::T};
+    const bfield_t hom_bfield = bfield::create_const_field(B);
+
+    helix_stepper_t<bfield_view_t> h_stepper;
+    chelix_stepper_t<bfield_view_t> ch_stepper;
+
+    constexpr unsigned int n_steps = 10u;
+    constexpr scalar stepsize_constr{5.f * unit<scalar>::mm};
+
+    // Track generator configuration
+    const scalar p_mag{10.f * unit<scalar>::GeV};
+    constexpr unsigned int theta_steps = 50u;
+    constexpr unsigned int phi_steps = 50u;
+
+    // Iterate through uniformly distributed momentum directions
+    for (auto track : uniform_track_generator<free_track_parameters<algebra_t>>(
+             phi_steps, theta_steps, p_mag)) {
+
+        free_track_parameters c_track(track);
+
+        // helix trajectory
+        detail::helix helix(track, &B);
+
+        prop_state<helix_stepper_t<bfield_view_t>::state, nav_state>
+            propagation{
+                helix_stepper_t<bfield_view_t>::state{track, hom_bfield},
+                nav_state{host_mr, 10.f * unit<scalar>::mm}};
+        prop_state<chelix_stepper_t<bfield_view_t>::state, nav_state>
+            c_propagation{
+                chelix_stepper_t<bfield_view_t>::state{c_track, hom_bfield},
+                nav_state{host_mr, 10.f * unit<scalar>::mm}};
+
+        auto &h_state = propagation._stepping;
+        auto &ch_state = c_propagation._stepping;
+
+        // The constrained stepper needs twice as many steps
+        ch_state.template set_constraint<step::constraint::e_user>(
+            stepsize_constr);
+
+        for (unsigned int i_s = 0u; i_s < n_steps; i_s++) {
+            ASSERT_TRUE(h_stepper.step(propagation));
+            ASSERT_TRUE(ch_stepper.step(c_propagation));
+            ASSERT_TRUE(ch_stepper.step(c_propagation));
+        }
+
+        // No Runge-Kutta steps in a constant field
+        ASSERT_EQ(h_state._n_helix_steps, n_steps);
+        ASSERT_EQ(h_state._n_rk_steps, 0u);
+        ASSERT_EQ(ch_state._n_helix_steps, 2u * n_steps);
+        ASSERT_EQ(ch_state._n_rk_steps, 0u);
+
+        const scalar path_length{h_state.path_length()};
+        ASSERT_NEAR(path_length, 100.f * unit<scalar>::mm, tol);
+        ASSERT_NEAR(path_length, ch_state.path_length(), tol);
+
+        // Check that the stepper position lies on the truth helix
+        const point3 forward_relative_error{
+            (1.f / path_length) * (h_state().pos() - helix(path_length))};
+        EXPECT_NEAR(getter::norm(forward_relative_error), 0.f, tol);
+        EXPECT_NEAR(getter::norm(h_state().dir() - helix.dir(path_length)),
+                    0.f, tol);
+        ASSERT_NEAR(
+            getter::norm(h_state().pos() - ch_state().pos()) / path_length,
+            0.f, tol);
+
+        // Roll the same track back to the origin
+        propagation._navigation.m_step_size *= -1.f;
+        c_propagation._navigation.m_step_size *= -1.f;
+        for (unsigned int i_s = 0u; i_s < n_steps; i_s++) {
+            h_stepper.step(propagation);
+            ch_stepper.step(c_propagation);
+            ch_stepper.step(c_propagation);
+        }
+
+        ASSERT_NEAR(h_state.path_length(), 0.f, tol);
+        ASSERT_NEAR(ch_state.path_length(), 0.f, tol);
+
+        const point3 backward_relative_error{1.f / (2.f * path_length) *
+                                             (h_state().pos())};
+        EXPECT_NEAR(getter::norm(backward_relative_error), 0.f, tol);
+        ASSERT_NEAR(getter::norm(h_state().pos() - ch_state().pos()) /
+                        (2.f * path_length),
+                    0.f, tol);
+    }
+}
+
+// This tests the transport jacobian of the helix stepper
+GTEST_TEST(detray_propagator, helix_stepper_jacobian) {
+
+    // Constant magnetic field
+    using bfield_t = bfield::const_field_t;
+    using bfield_view_t = bfield_t::view_t;
+
+    vector3 B{0.f * unit<scalar>::T, 1.f * unit<scalar>::T,
+              2.f * unit<scalar>::T};
+    const bfield_t hom_bfield = bfield::create_const_field(B);
+
+    helix_stepper_t<bfield_view_t> h_stepper;
+
+    const scalar p_mag{1.f * unit<scalar>::GeV};
+    constexpr unsigned int theta_steps = 10u;
+    constexpr unsigned int phi_steps = 10u;
+    constexpr unsigned int n_steps = 20u;
+
+    for (auto track : uniform_track_generator<free_track_parameters<algebra_t>>(
+             phi_steps, theta_steps, p_mag)) {
+
+        detail::helix helix(track, &B);
+
+        prop_state<helix_stepper_t<bfield_view_t>::state, nav_state>
+            propagation{
+                helix_stepper_t<bfield_view_t>::state{track, hom_bfield},
+                nav_state{host_mr, 5.f * unit<scalar>::mm}};
+
+        auto &h_state = propagation._stepping;
+
+        for (unsigned int i_s = 0u; i_s < n_steps; i_s++) {
+            ASSERT_TRUE(h_stepper.step(propagation));
+        }
+
+        // Compare with the analytical jacobian of the full path
+        const scalar path_length{h_state.path_length()};
+        const auto true_J = helix.jacobian(path_length);
+        for (unsigned int i = 0u; i < e_free_size; i++) {
+            for (unsigned int j = 0u; j < e_free_size; j++) {
+                ASSERT_NEAR(
+                    matrix_operator().element(h_state._jac_transport, i, j),
+                    matrix_operator().element(true_J, i, j),
+                    path_length * tol)
+                    << "at (" << i << ", " << j << ")";
+            }
+        }
+    }
+}
+
+// This tests the fallback to the Runge-Kutta stepper in a field gradient
+GTEST_TEST(detray_propagator, helix_stepper_fallback) {
+
+    const gradient_field inhom_bfield{};
+
+    helix_stepper_t<gradient_field> h_stepper;
+    rk_stepper_t<gradient_field> rk_stepper;
+
+    const scalar p_mag{1.f * unit<scalar>::GeV};
+    constexpr unsigned int theta_steps = 10u;
+    constexpr unsigned int phi_steps = 10u;
+    constexpr unsigned int n_steps = 20u;
+
+    for (auto track : uniform_track_generator<free_track_parameters<algebra_t>>(
+             phi_steps, theta_steps, p_mag)) {
+
+        // Small steps are accurate enough for the helix
+        prop_state<helix_stepper_t<gradient_field>::state, nav_state>
+            short_propagation{
+                helix_stepper_t<gradient_field>::state{track, inhom_bfield},
+                nav_state{host_mr, 0.1f * unit<scalar>::mm}};
+        for (unsigned int i_s = 0u; i_s < n_steps; i_s++) {
+            ASSERT_TRUE(h_stepper.step(short_propagation));
+        }
+        ASSERT_EQ(short_propagation._stepping._n_rk_steps, 0u);
+
+        // Large steps fall back to Runge-Kutta, if the track crosses the
+        // field gradient
+        prop_state<helix_stepper_t<gradient_field>::state, nav_state>
+            propagation{
+                helix_stepper_t<gradient_field>::state{track, inhom_bfield},
+                nav_state{host_mr, 100.f * unit<scalar>::mm}};
+        prop_state<rk_stepper_t<gradient_field>::state, nav_state>
+            rk_propagation{
+                rk_stepper_t<gradient_field>::state{track, inhom_bfield},
+                nav_state{host_mr, 100.f * unit<scalar>::mm}};
+
+        auto &h_state = propagation._stepping;
+        auto &rk_state = rk_propagation._stepping;
+
+        for (unsigned int i_s = 0u; i_s < n_steps; i_s++) {
+            ASSERT_TRUE(h_stepper.step(propagation));
+        }
+
+        if (math::abs(track.dir()[2]) > 0.1f) {
+            ASSERT_GT(h_state._n_rk_steps, 0u);
+        }
+
+        // Follow the same track with the Runge-Kutta stepper to the end point
+        const scalar path_length{h_state.path_length()};
+        while (path_length - rk_state.path_length() > tol) {
+            rk_propagation._navigation.m_step_size =
+                path_length - rk_state.path_length();
+            ASSERT_TRUE(rk_stepper.step(rk_propagation));
+        }
+
+        ASSERT_NEAR(rk_state.path_length(), path_length, tol);
+        ASSERT_NEAR(
+            getter::norm(h_state().pos() - rk_state().pos()) / path_length,
+            0.f, tol);
+    }
+}
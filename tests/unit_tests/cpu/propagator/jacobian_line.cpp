@@ -136,3 +136,89 @@ GTEST_TEST(detray_coordinates, jacobian_line2D_case2) {
         }
     }
 }
+
+// Compare the sparse jacobian products with the dense matrix products
+GTEST_TEST(detray_coordinates, jacobian_line2D_sparse_products) {
+
+    using jac_engine = detail::jacobian_engine<line2D<algebra_t>>;
+
+    // Preparation work
+    vector3 z = {1.f, 2.f, 3.f};
+    z = vector::normalize(z);
+    vector3 x = {2.f, -4.f, 2.f};
+    x = vector::normalize(x);
+    const point3 t = {0.f, 0.f, 0.f};
+    const transform3 trf(t, z, x);
+    const vector3 mom = {1.f, 6.f, -2.f};
+    const vector3 d = vector::normalize(mom);
+    const scalar time{0.1f};
+    const scalar charge{-1.f};
+
+    const point3 global =
+        detail::bound_to_free_position(trf, ln, point2{1.f, 2.f}, d);
+
+    const free_track_parameters<algebra_t> free_params(global, time, mom,
+                                                       charge);
+    const auto free_vec = free_params.vector();
+    const auto bound_vec =
+        detail::free_to_bound_vector<line2D<algebra_t>>(trf, free_vec);
+
+    const vector3 dtds = {0.01f, -0.02f, 0.005f};
+    const scalar dqopds{-0.001f};
+
+    const matrix_operator m;
+
+    // Dense transport jacobian and symmetric covariance
+    free_matrix<algebra_t> transport =
+        m.template identity<e_free_size, e_free_size>();
+    for (unsigned int i = 0u; i < e_free_size; i++) {
+        for (unsigned int j = 0u; j < e_free_size; j++) {
+            m.element(transport, i, j) +=
+                0.01f * static_cast<scalar>(i + 2u * j);
+        }
+    }
+    bound_matrix<algebra_t> cov = m.template zero<e_bound_size, e_bound_size>();
+    for (unsigned int i = 0u; i < e_bound_size; i++) {
+        for (unsigned int j = 0u; j < e_bound_size; j++) {
+            m.element(cov, i, j) =
+                (i == j) ? 1.f : 0.1f / static_cast<scalar>(i + j);
+        }
+    }
+
+    // Dense reference
+    const free_matrix<algebra_t> correction =
+        m.template identity<e_free_size, e_free_size>() +
+        jac_engine::path_correction(global, d, dtds, dqopds, trf);
+    const auto bound_to_free =
+        jac_engine::bound_to_free_jacobian(trf, ln, bound_vec);
+    const matrix_type<e_bound_size, e_free_size> ref_to_bound =
+        jac_engine::free_to_bound_jacobian(trf, free_vec) * correction *
+        transport;
+    const bound_matrix<algebra_t> ref_jac = ref_to_bound * bound_to_free;
+    const bound_matrix<algebra_t> ref_cov =
+        ref_jac * cov * m.transpose(ref_jac);
+
+    // Sparse products
+    const auto transport_to_bound = jac_engine::free_to_bound_transport(
+        jac_engine::corrected_free_to_bound_jacobian(trf, free_vec, dtds,
+                                                     dqopds),
+        transport);
+    const bound_matrix<algebra_t> full_jac =
+        jac_engine::full_jacobian(transport_to_bound, bound_to_free);
+    const bound_matrix<algebra_t> new_cov =
+        jac_engine::transport_covariance<e_bound_size>(full_jac, cov);
+
+    constexpr scalar tol{1e-4f};
+    for (unsigned int i = 0u; i < e_bound_size; i++) {
+        for (unsigned int j = 0u; j < e_free_size; j++) {
+            EXPECT_NEAR(m.element(transport_to_bound, i, j),
+                        m.element(ref_to_bound, i, j), tol);
+        }
+        for (unsigned int j = 0u; j < e_bound_size; j++) {
+            EXPECT_NEAR(m.element(full_jac, i, j), m.element(ref_jac, i, j),
+                        tol);
+            EXPECT_NEAR(m.element(new_cov, i, j), m.element(ref_cov, i, j),
+                        tol);
+        }
+    }
+}
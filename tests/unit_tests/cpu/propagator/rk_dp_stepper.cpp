@@ -0,0 +1,238 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// detray include(s)
+#include "detray/propagator/rk_dp_stepper.hpp"
+
+#include "detray/builders/volume_builder.hpp"
+#include "detray/core/detector.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/navigation/detail/trajectories.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/simulation/event_generator/track_generators.hpp"
+#include "detray/test/types.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// System include(s)
+#include <memory>
+
+// google-test include(s)
+#include <gtest/gtest.h>
+
+using namespace detray;
+
+using algebra_t = test::algebra;
+using vector3 = test::vector3;
+using point3 = test::point3;
+using matrix_operator = test::matrix_operator;
+
+/// Runge-Kutta steppers
+template <typename bfield_t>
+using rk_dp_stepper_t = rk_dp_stepper<typename bfield_t::view_t, algebra_t>;
+template <typename bfield_t>
+using crk_dp_stepper_t =
+    rk_dp_stepper<typename bfield_t::view_t, algebra_t, constrained_step<>>;
+template <typename bfield_t>
+using rk_stepper_t = rk_stepper<typename bfield_t::view_t, algebra_t>;
+
+namespace {
+
+constexpr scalar tol{1e-3f};
+
+vecmem::host_memory_resource host_mr;
+
+// dummy navigation struct
+struct nav_state {
+    /// New detector
+    nav_state(vecmem::host_memory_resource &mr, const scalar step_size)
+        : m_step_size{step_size},
+          m_det{std::make_unique<detray::detector<>>(mr)} {
+
+        // Empty dummy volume without material
+        volume_builder<detray::detector<>> vbuilder{volume_id::e_cylinder};
+        vbuilder.build(*m_det);
+    }
+
+    scalar operator()() const { return m_step_size; }
+    inline auto current_object() const -> dindex { return dindex_invalid; }
+    inline auto tolerance() const -> scalar { return tol; }
+    inline auto detector() const -> const detray::detector<> * {
+        return m_det.get();
+    }
+    inline auto volume() -> unsigned int { return 0u; }
+    inline void set_full_trust() {}
+    inline void set_high_trust() {}
+    inline void set_fair_trust() {}
+    inline void set_no_trust() {}
+    inline bool abort() { return false; }
+
+    scalar m_step_size;
+    std::unique_ptr<detray::detector<>> m_det;
+};
+
+// dummy propagator state
+template <typename stepping_t, typename navigation_t>
+struct prop_state {
+    stepping_t _stepping;
+    navigation_t _navigation;
+};
+
+}  // namespace
+
+// This tests the track state of the Dormand-Prince stepper against a helix
+GTEST_TEST(detray_propagator, rk_dp_stepper) {
+    using namespace step;
+
+    // Constant magnetic field
+    using bfield_t = bfield::const_field_t;
+
+    vector3 B{1.f * unit<scalar>::T, 1.f * unit<scalar>::T,
+              1.f * unit<scalar>::T};
+    const bfield_t hom_bfield = bfield::create_const_field(B);
+
+    rk_dp_stepper_t<bfield_t> dp_stepper;
+    crk_dp_stepper_t<bfield_t> cdp_stepper;
+
+    constexpr unsigned int n_steps = 100u;
+    constexpr scalar stepsize_constr{0.5f * unit<scalar>::mm};
+
+    // Track generator configuration
+    const scalar p_mag{10.f * unit<scalar>::GeV};
+    constexpr unsigned int theta_steps = 50u;
+    constexpr unsigned int phi_steps = 50u;
+
+    // Iterate through uniformly distributed momentum directions
+    for (auto track : uniform_track_generator<free_track_parameters<algebra_t>>(
+             phi_steps, theta_steps, p_mag)) {
+
+        free_track_parameters c_track(track);
+
+        // helix trajectory
+        detail::helix helix(track, &B);
+
+        prop_state<rk_dp_stepper_t<bfield_t>::state, nav_state> propagation{
+            rk_dp_stepper_t<bfield_t>::state{track, hom_bfield},
+            nav_state{host_mr, 1.f * unit<scalar>::mm}};
+        prop_state<crk_dp_stepper_t<bfield_t>::state, nav_state>
+            c_propagation{
+                crk_dp_stepper_t<bfield_t>::state{c_track, hom_bfield},
+                nav_state{host_mr, 1.f * unit<scalar>::mm}};
+
+        auto &dp_state = propagation._stepping;
+        auto &cdp_state = c_propagation._stepping;
+
+        // The constrained stepper needs twice as many steps
+        cdp_state.template set_constraint<constraint::e_user>(
+            stepsize_constr);
+
+        dp_state.set_step_size(1.f * unit<scalar>::mm);
+        cdp_state.set_step_size(1.f * unit<scalar>::mm);
+
+        for (unsigned int i_s = 0u; i_s < n_steps; i_s++) {
+            ASSERT_TRUE(dp_stepper.step(propagation));
+            ASSERT_TRUE(cdp_stepper.step(c_propagation));
+            ASSERT_TRUE(cdp_stepper.step(c_propagation));
+        }
+
+        const scalar path_length{dp_state.path_length()};
+        ASSERT_NEAR(path_length, 100.f * unit<scalar>::mm, tol);
+        ASSERT_NEAR(path_length, cdp_state.path_length(), tol);
+        ASSERT_NEAR(
+            getter::norm(dp_state().pos() - cdp_state().pos()) / path_length,
+            0.f, tol);
+
+        // The last stage can be reused by the next step
+        ASSERT_TRUE(dp_state._fsal);
+
+        // Check that the stepper position lies on the truth helix
+        const point3 forward_relative_error{
+            (1.f / path_length) * (dp_state().pos() - helix(path_length))};
+        EXPECT_NEAR(getter::norm(forward_relative_error), 0.f, tol);
+        EXPECT_NEAR(getter::norm(dp_state().dir() - helix.dir(path_length)),
+                    0.f, tol);
+
+        // Roll the same track back to the origin
+        propagation._navigation.m_step_size *= -1.f;
+        c_propagation._navigation.m_step_size *= -1.f;
+        for (unsigned int i_s = 0u; i_s < n_steps; i_s++) {
+            dp_stepper.step(propagation);
+            cdp_stepper.step(c_propagation);
+            cdp_stepper.step(c_propagation);
+        }
+
+        ASSERT_NEAR(dp_state.path_length(), 0.f, tol);
+        ASSERT_NEAR(cdp_state.path_length(), 0.f, tol);
+
+        const point3 backward_relative_error{1.f / (2.f * path_length) *
+                                             (dp_state().pos())};
+        EXPECT_NEAR(getter::norm(backward_relative_error), 0.f, tol);
+        ASSERT_NEAR(getter::norm(dp_state().pos() - cdp_state().pos()) /
+                        (2.f * path_length),
+                    0.f, tol);
+    }
+}
+
+// This tests the transport jacobian of the Dormand-Prince stepper
+GTEST_TEST(detray_propagator, rk_dp_stepper_jacobian) {
+
+    // Constant magnetic field
+    using bfield_t = bfield::const_field_t;
+
+    vector3 B{0.f * unit<scalar>::T, 1.f * unit<scalar>::T,
+              2.f * unit<scalar>::T};
+    const bfield_t hom_bfield = bfield::create_const_field(B);
+
+    rk_dp_stepper_t<bfield_t> dp_stepper;
+    rk_stepper_t<bfield_t> rk_stepper;
+
+    const scalar p_mag{1.f * unit<scalar>::GeV};
+    constexpr unsigned int theta_steps = 10u;
+    constexpr unsigned int phi_steps = 10u;
+    constexpr unsigned int n_steps = 20u;
+
+    for (auto track : uniform_track_generator<free_track_parameters<algebra_t>>(
+             phi_steps, theta_steps, p_mag)) {
+
+        detail::helix helix(track, &B);
+
+        prop_state<rk_dp_stepper_t<bfield_t>::state, nav_state> propagation{
+            rk_dp_stepper_t<bfield_t>::state{track, hom_bfield},
+            nav_state{host_mr, 5.f * unit<scalar>::mm}};
+        prop_state<rk_stepper_t<bfield_t>::state, nav_state> rk_propagation{
+            rk_stepper_t<bfield_t>::state{track, hom_bfield},
+            nav_state{host_mr, 5.f * unit<scalar>::mm}};
+
+        auto &dp_state = propagation._stepping;
+        auto &rk_state = rk_propagation._stepping;
+
+        for (unsigned int i_s = 0u; i_s < n_steps; i_s++) {
+            ASSERT_TRUE(dp_stepper.step(propagation));
+            ASSERT_TRUE(rk_stepper.step(rk_propagation));
+        }
+
+        const scalar path_length{dp_state.path_length()};
+        ASSERT_NEAR(path_length, rk_state.path_length(), tol);
+
+        // Compare with the analytical jacobian and the RKN4 jacobian
+        const auto true_J = helix.jacobian(path_length);
+        for (unsigned int i = 0u; i < e_free_size; i++) {
+            for (unsigned int j = 0u; j < e_free_size; j++) {
+                const scalar dp_ij{
+                    matrix_operator().element(dp_state._jac_transport, i, j)};
+                ASSERT_NEAR(dp_ij, matrix_operator().element(true_J, i, j),
+                            path_length * tol)
+                    << "at (" << i << ", " << j << ")";
+                ASSERT_NEAR(
+                    dp_ij,
+                    matrix_operator().element(rk_state._jac_transport, i, j),
+                    path_length * tol)
+                    << "at (" << i << ", " << j << ")";
+            }
+        }
+    }
+}
@@ -12,6 +12,8 @@
 #include "detray/core/detector.hpp"
 #include "detray/definitions/units.hpp"
 #include "detray/detectors/bfield.hpp"
+#include "detray/detectors/compressed_bfield.hpp"
+#include "detray/detectors/sparse_bfield.hpp"
 #include "detray/geometry/surface.hpp"
 #include "detray/io/frontend/utils/file_handle.hpp"
 #include "detray/navigation/detail/trajectories.hpp"
@@ -19,8 +21,10 @@
 #include "detray/simulation/event_generator/track_generators.hpp"
 #include "detray/test/types.hpp"
 #include "detray/tracks/tracks.hpp"
+#include "detray/utils/inspectors.hpp"
 
 // System include(s)
+#include <cstdint>
 #include <memory>
 
 // google-test include(s)
@@ -285,6 +289,169 @@ TEST(detray_propagator, rk_stepper_inhomogeneous_bfield) {
     }
 }
 
+/// Compare the field values and the propagated tracks of the compressed field
+/// maps to the full precision field map
+TEST(detray_propagator, rk_stepper_compressed_bfield) {
+    using namespace step;
+
+    // Read the magnetic field map and compress it
+    using bfield_t = bfield::inhom_field_t;
+    using int16_bfield_t = bfield::inhom_int16_field_t;
+    using bf16_bfield_t = bfield::inhom_bf16_field_t;
+
+    const bfield_t inhom_bfield = bfield::create_inhom_field();
+    const int16_bfield_t int16_bfield =
+        bfield::compress_field<int16_bfield_t>(inhom_bfield);
+    const bf16_bfield_t bf16_bfield =
+        bfield::compress_field<bf16_bfield_t>(inhom_bfield);
+
+    // Field values inside the tracking volume
+    const bfield_t::view_t bview(inhom_bfield);
+    const int16_bfield_t::view_t int16_view(int16_bfield);
+    const bf16_bfield_t::view_t bf16_view(bf16_bfield);
+
+    for (scalar x = -500.f; x <= 500.f; x += 50.f) {
+        for (scalar y = -500.f; y <= 500.f; y += 50.f) {
+            for (scalar z = -1000.f; z <= 1000.f; z += 50.f) {
+                const auto b = bview.at(x, y, z);
+                const auto b_int16 = int16_view.at(x, y, z);
+                const auto b_bf16 = bf16_view.at(x, y, z);
+
+                for (unsigned int i = 0u; i < 3u; ++i) {
+                    EXPECT_NEAR(b_int16[i], b[i], 1e-4f * unit<scalar>::T);
+                    EXPECT_NEAR(b_bf16[i], b[i], 1e-2f * unit<scalar>::T);
+                }
+            }
+        }
+    }
+
+    // Propagated tracks: Use a fixed step size, so that the tracks can be
+    // compared after the same path length
+    crk_stepper_t<bfield_t> crk_stepper;
+    crk_stepper_t<int16_bfield_t> int16_stepper;
+    crk_stepper_t<bf16_bfield_t> bf16_stepper;
+
+    constexpr unsigned int rk_steps = 200u;
+    constexpr scalar stepsize_constr{0.5f * unit<scalar>::mm};
+
+    const scalar p_mag{10.f * unit<scalar>::GeV};
+    constexpr unsigned int theta_steps = 50u;
+    constexpr unsigned int phi_steps = 50u;
+
+    for (auto track : uniform_track_generator<free_track_parameters<algebra_t>>(
+             phi_steps, theta_steps, p_mag)) {
+
+        prop_state<crk_stepper_t<bfield_t>::state, nav_state> propagation{
+            crk_stepper_t<bfield_t>::state{track, inhom_bfield},
+            nav_state{host_mr}};
+        prop_state<crk_stepper_t<int16_bfield_t>::state, nav_state>
+            int16_propagation{
+                crk_stepper_t<int16_bfield_t>::state{track, int16_bfield},
+                nav_state{host_mr}};
+        prop_state<crk_stepper_t<bf16_bfield_t>::state, nav_state>
+            bf16_propagation{
+                crk_stepper_t<bf16_bfield_t>::state{track, bf16_bfield},
+                nav_state{host_mr}};
+
+        propagation._stepping.template set_constraint<constraint::e_user>(
+            stepsize_constr);
+        int16_propagation._stepping
+            .template set_constraint<constraint::e_user>(stepsize_constr);
+        bf16_propagation._stepping.template set_constraint<constraint::e_user>(
+            stepsize_constr);
+
+        for (unsigned int i_s = 0u; i_s < rk_steps; i_s++) {
+            crk_stepper.step(propagation);
+            int16_stepper.step(int16_propagation);
+            bf16_stepper.step(bf16_propagation);
+        }
+
+        const scalar path_length{propagation._stepping.path_length()};
+        ASSERT_TRUE(path_length > 0.f);
+        ASSERT_NEAR(int16_propagation._stepping.path_length(), path_length,
+                    tol);
+        ASSERT_NEAR(bf16_propagation._stepping.path_length(), path_length,
+                    tol);
+
+        const point3 pos = propagation._stepping().pos();
+        const vector3 dir = propagation._stepping().dir();
+
+        EXPECT_NEAR(getter::norm(int16_propagation._stepping().pos() - pos) /
+                        path_length,
+                    0.f, 1e-5f);
+        EXPECT_NEAR(getter::norm(int16_propagation._stepping().dir() - dir),
+                    0.f, 1e-5f);
+        EXPECT_NEAR(getter::norm(bf16_propagation._stepping().pos() - pos) /
+                        path_length,
+                    0.f, 1e-4f);
+        EXPECT_NEAR(getter::norm(bf16_propagation._stepping().dir() - dir),
+                    0.f, 1e-4f);
+    }
+}
+
+/// Compare the field values of the sparse field map to the full precision
+/// field map and check that the constant blocks save memory
+TEST(detray_propagator, rk_stepper_sparse_bfield) {
+
+    using bfield_t = bfield::inhom_field_t;
+    using sparse_bfield_t = bfield::inhom_sparse_field_t;
+
+    constexpr scalar tolerance{1e-3f * unit<scalar>::T};
+
+    const bfield_t inhom_bfield = bfield::create_inhom_field();
+    const sparse_bfield_t sparse_bfield =
+        bfield::sparsify_field<sparse_bfield_t>(inhom_bfield, tolerance);
+
+    // A dense block keeps every grid point, a constant block only one
+    const auto conf =
+        sparse_bfield.backend().get_backend().get_backend().get_configuration();
+    ASSERT_GT(conf.n_blocks(), 0u);
+    EXPECT_LE(conf.n_values, conf.n_blocks() * 64u);
+
+    // With a tolerance above the field strength, every block is constant
+    const sparse_bfield_t const_bfield = bfield::sparsify_field<
+        sparse_bfield_t>(inhom_bfield, 100.f * unit<scalar>::T);
+    const auto &const_data =
+        const_bfield.backend().get_backend().get_backend();
+    EXPECT_EQ(const_data.get_configuration().n_values, conf.n_blocks());
+    EXPECT_EQ(const_data.size_bytes(),
+              conf.n_blocks() * (sizeof(std::uint32_t) + 3u * sizeof(scalar)));
+
+    // Field values in and around the tracking volume
+    const bfield_t::view_t bview(inhom_bfield);
+    const sparse_bfield_t::view_t sparse_view(sparse_bfield);
+
+    for (scalar x = -5000.f; x <= 5000.f; x += 250.f) {
+        for (scalar y = -5000.f; y <= 5000.f; y += 250.f) {
+            for (scalar z = -10000.f; z <= 10000.f; z += 250.f) {
+                const auto b = bview.at(x, y, z);
+                const auto b_sparse = sparse_view.at(x, y, z);
+
+                // The interpolation of values within the tolerance
+                for (unsigned int i = 0u; i < 3u; ++i) {
+                    EXPECT_NEAR(b_sparse[i], b[i], tolerance + 1e-6f);
+                }
+            }
+        }
+    }
+
+    // A vanishing tolerance only merges exactly constant blocks
+    const sparse_bfield_t exact_bfield =
+        bfield::sparsify_field<sparse_bfield_t>(inhom_bfield, 0.f);
+    const sparse_bfield_t::view_t exact_view(exact_bfield);
+
+    for (scalar x = -500.f; x <= 500.f; x += 50.f) {
+        for (scalar z = -1000.f; z <= 1000.f; z += 50.f) {
+            const auto b = bview.at(x, 0.f, z);
+            const auto b_exact = exact_view.at(x, 0.f, z);
+
+            for (unsigned int i = 0u; i < 3u; ++i) {
+                EXPECT_FLOAT_EQ(b_exact[i], b[i]);
+            }
+        }
+    }
+}
+
 /// This tests dqop of the Runge-Kutta stepper
 TEST(detray_propagator, qop_derivative) {
     using namespace step;
@@ -341,3 +508,292 @@ TEST(detray_propagator, qop_derivative) {
         }
     }
 }
+
+/// This tests the field lookups of the Runge-Kutta stepper
+TEST(detray_propagator, rk_stepper_field_lookup) {
+    using namespace step;
+
+    // Constant magnetic field
+    using bfield_t = bfield::const_field_t;
+
+    vector3 B{0.f * unit<scalar>::T, 1.f * unit<scalar>::T,
+              2.f * unit<scalar>::T};
+    const bfield_t hom_bfield = bfield::create_const_field(B);
+
+    rk_stepper_t<bfield_t> rk_stepper;
+
+    const point3 pos{0.f, 0.f, 0.f};
+    const vector3 mom{1.f * unit<scalar>::GeV, 0.f, 0.f};
+    const free_track_parameters<algebra_t> track(pos, 0.f, mom, -1.f);
+
+    prop_state<rk_stepper_t<bfield_t>::state, nav_state> propagation{
+        rk_stepper_t<bfield_t>::state{track, hom_bfield}, nav_state{host_mr}};
+    rk_stepper_t<bfield_t>::state &rk_state = propagation._stepping;
+
+    const vector3 b = rk_state.evaluate_field(pos);
+    EXPECT_NEAR(getter::norm(b - B), 0.f, tol);
+
+    // No gradient in a constant field
+    const auto dBdr = rk_state.evaluate_field_gradient(pos);
+    for (unsigned int i = 0u; i < 3u; ++i) {
+        for (unsigned int j = 0u; j < 3u; ++j) {
+            EXPECT_NEAR(getter::element(dBdr, i, j), 0.f, tol);
+        }
+    }
+
+    // Step with the field gradient in the jacobian transport
+    stepping::config<scalar> step_cfg{};
+    step_cfg.do_covariance_transport = true;
+    step_cfg.use_field_gradient = true;
+    rk_state.set_step_size(1.f * unit<scalar>::mm);
+    rk_state._initialized = false;
+    ASSERT_TRUE(rk_stepper.step(propagation, step_cfg));
+    EXPECT_NEAR(getter::norm(rk_state._step_data.b_first - B), 0.f, tol);
+    EXPECT_NEAR(getter::norm(rk_state._step_data.b_middle - B), 0.f, tol);
+    EXPECT_NEAR(getter::norm(rk_state._step_data.b_last - B), 0.f, tol);
+}
+
+/// This tests that the jacobian transport can be switched off per track
+TEST(detray_propagator, rk_stepper_no_covariance_transport) {
+    using namespace step;
+
+    // Constant magnetic field
+    using bfield_t = bfield::const_field_t;
+
+    vector3 B{0.f * unit<scalar>::T, 1.f * unit<scalar>::T,
+              2.f * unit<scalar>::T};
+    const bfield_t hom_bfield = bfield::create_const_field(B);
+
+    rk_stepper_t<bfield_t> rk_stepper;
+
+    const point3 pos{0.f, 0.f, 0.f};
+    const vector3 mom{1.f * unit<scalar>::GeV, 1.f * unit<scalar>::GeV, 0.f};
+    const free_track_parameters<algebra_t> track(pos, 0.f, mom, -1.f);
+
+    prop_state<rk_stepper_t<bfield_t>::state, nav_state> propagation{
+        rk_stepper_t<bfield_t>::state{track, hom_bfield}, nav_state{host_mr}};
+    prop_state<rk_stepper_t<bfield_t>::state, nav_state> cov_propagation{
+        rk_stepper_t<bfield_t>::state{track, hom_bfield}, nav_state{host_mr}};
+    rk_stepper_t<bfield_t>::state &rk_state = propagation._stepping;
+    rk_stepper_t<bfield_t>::state &cov_rk_state = cov_propagation._stepping;
+
+    ASSERT_TRUE(rk_state.do_covariance_transport());
+    rk_state.set_covariance_transport(false);
+    ASSERT_FALSE(rk_state.do_covariance_transport());
+
+    for (unsigned int i_s = 0u; i_s < 10u; i_s++) {
+        ASSERT_TRUE(rk_stepper.step(propagation));
+        ASSERT_TRUE(rk_stepper.step(cov_propagation));
+    }
+
+    // The track is the same, but only one jacobian was transported
+    EXPECT_NEAR(getter::norm(rk_state().pos() - cov_rk_state().pos()), 0.f,
+                tol);
+    EXPECT_NEAR(getter::norm(rk_state().dir() - cov_rk_state().dir()), 0.f,
+                tol);
+
+    const auto I =
+        matrix_operator().template identity<e_free_size, e_free_size>();
+    bool is_identity{true};
+    for (unsigned int i = 0u; i < e_free_size; i++) {
+        for (unsigned int j = 0u; j < e_free_size; j++) {
+            EXPECT_FLOAT_EQ(
+                matrix_operator().element(rk_state._jac_transport, i, j),
+                matrix_operator().element(I, i, j));
+            is_identity &=
+                (matrix_operator().element(cov_rk_state._jac_transport, i,
+                                           j) ==
+                 matrix_operator().element(I, i, j));
+        }
+    }
+    EXPECT_FALSE(is_identity);
+}
+
+/// This tests that the step size control survives a navigation reset
+TEST(detray_propagator, rk_stepper_suggested_step_size) {
+    using namespace step;
+
+    // Constant magnetic field
+    using bfield_t = bfield::const_field_t;
+
+    vector3 B{0.f * unit<scalar>::T, 0.f * unit<scalar>::T,
+              2.f * unit<scalar>::T};
+    const bfield_t hom_bfield = bfield::create_const_field(B);
+
+    rk_stepper_t<bfield_t> rk_stepper;
+
+    const point3 pos{0.f, 0.f, 0.f};
+    const vector3 mom{0.1f * unit<scalar>::GeV, 0.f, 0.f};
+    const free_track_parameters<algebra_t> track(pos, 0.f, mom, -1.f);
+
+    prop_state<rk_stepper_t<bfield_t>::state, nav_state> propagation{
+        rk_stepper_t<bfield_t>::state{track, hom_bfield}, nav_state{host_mr}};
+    rk_stepper_t<bfield_t>::state &rk_state = propagation._stepping;
+
+    // No suggestion before the first step
+    ASSERT_EQ(rk_state._suggested_step_size, 0.f);
+    rk_state.reset_step_size(-10.f * unit<scalar>::m);
+    ASSERT_EQ(rk_state.step_size(), -10.f * unit<scalar>::m);
+    ASSERT_TRUE(rk_state._initialized);
+
+    rk_state.reset_step_size(10.f * unit<scalar>::m);
+    for (unsigned int i_s = 0u; i_s < 10u; i_s++) {
+        ASSERT_TRUE(rk_stepper.step(propagation));
+    }
+    const scalar suggestion{rk_state._suggested_step_size};
+    ASSERT_GT(suggestion, 0.f);
+    ASSERT_LT(suggestion, 10.f * unit<scalar>::m);
+    // The steps are cut by the navigation, but the suggestion is not
+    ASSERT_GE(suggestion, math::abs(rk_state.step_size()));
+
+    // The navigation restarts from the suggested step size
+    rk_state.reset_step_size(10.f * unit<scalar>::m);
+    ASSERT_NEAR(rk_state.step_size(), suggestion, tol);
+    rk_state.reset_step_size(-10.f * unit<scalar>::m);
+    ASSERT_NEAR(rk_state.step_size(), -suggestion, tol);
+    ASSERT_TRUE(rk_state._initialized);
+
+    // Shorter distances are not changed
+    rk_state.reset_step_size(0.5f * suggestion);
+    ASSERT_NEAR(rk_state.step_size(), 0.5f * suggestion, tol);
+}
+
+/// This tests the counters of the stepping inspector
+TEST(detray_propagator, rk_stepper_counting_inspector) {
+
+    // Constant magnetic field
+    using bfield_t = bfield::const_field_t;
+    using stepper_t =
+        rk_stepper<typename bfield_t::view_t, algebra_t, constrained_step<>,
+                   stepper_rk_policy, stepping::counting_inspector>;
+
+    vector3 B{0.f * unit<scalar>::T, 0.f * unit<scalar>::T,
+              2.f * unit<scalar>::T};
+    const bfield_t hom_bfield = bfield::create_const_field(B);
+
+    stepper_t rk_stepper;
+
+    const point3 pos{0.f, 0.f, 0.f};
+    const vector3 mom{0.1f * unit<scalar>::GeV, 0.f, 0.f};
+    const free_track_parameters<algebra_t> track(pos, 0.f, mom, -1.f);
+
+    prop_state<stepper_t::state, nav_state> propagation{
+        stepper_t::state{track, hom_bfield}, nav_state{host_mr}};
+    stepper_t::state &rk_state = propagation._stepping;
+
+    // The initial step size is too large for the error tolerance
+    propagation._navigation.m_step_size = 10.f * unit<scalar>::m;
+    rk_state.reset_step_size(10.f * unit<scalar>::m);
+    for (unsigned int i_s = 0u; i_s < 10u; i_s++) {
+        ASSERT_TRUE(rk_stepper.step(propagation));
+    }
+
+    const auto &counter = rk_state.inspector();
+    EXPECT_EQ(counter.n_steps, 10u);
+    EXPECT_TRUE(counter.n_rk_adjustments > 0u);
+
+    // A step size constraint cuts every step
+    rk_state.template set_constraint<step::constraint::e_user>(
+        0.1f * unit<scalar>::mm);
+    for (unsigned int i_s = 0u; i_s < 5u; i_s++) {
+        ASSERT_TRUE(rk_stepper.step(propagation));
+    }
+    EXPECT_EQ(counter.n_steps, 15u);
+    EXPECT_TRUE(counter.n_constrained >= 5u);
+
+    stepping::counting_inspector sum{};
+    sum += counter;
+    sum += counter;
+    EXPECT_EQ(sum.n_steps, 30u);
+    EXPECT_EQ(sum.n_rk_adjustments, 2u * counter.n_rk_adjustments);
+}
+
+/// This tests the step statistics of the stepping inspector
+TEST(detray_propagator, rk_stepper_statistics_inspector) {
+
+    // Constant magnetic field
+    using bfield_t = bfield::const_field_t;
+    using inspector_t = stepping::statistics_inspector<>;
+    using stepper_t =
+        rk_stepper<typename bfield_t::view_t, algebra_t, constrained_step<>,
+                   stepper_rk_policy, inspector_t>;
+
+    vector3 B{0.f * unit<scalar>::T, 0.f * unit<scalar>::T,
+              2.f * unit<scalar>::T};
+    const bfield_t hom_bfield = bfield::create_const_field(B);
+
+    stepper_t rk_stepper;
+
+    const point3 pos{0.f, 0.f, 0.f};
+    const vector3 mom{0.1f * unit<scalar>::GeV, 0.f, 0.f};
+    const free_track_parameters<algebra_t> track(pos, 0.f, mom, -1.f);
+
+    prop_state<stepper_t::state, nav_state> propagation{
+        stepper_t::state{track, hom_bfield}, nav_state{host_mr}};
+    stepper_t::state &rk_state = propagation._stepping;
+    propagation._navigation.m_step_size = 10.f * unit<scalar>::m;
+
+    // The error control reduces the initial step size
+    rk_state.reset_step_size(10.f * unit<scalar>::m);
+    for (unsigned int i_s = 0u; i_s < 10u; i_s++) {
+        ASSERT_TRUE(rk_stepper.step(propagation));
+    }
+
+    const auto &stats = rk_state.inspector();
+    EXPECT_EQ(stats.n_steps, 10u);
+    EXPECT_TRUE(stats.n_retries > 0u);
+    EXPECT_EQ(stats.n_max_retries, 0u);
+    EXPECT_EQ(stats.n_min_steps, 0u);
+    // One lookup per step and two per error estimate
+    EXPECT_EQ(stats.n_field_lookups, 3u * stats.n_steps + 2u * stats.n_retries);
+    // Only the first step needed adjustments
+    EXPECT_EQ(stats.retry_hist[0], 9u);
+    EXPECT_NEAR(stats.mean_retries(),
+                static_cast<scalar>(stats.n_retries) / 10.f, tol);
+
+    unsigned int n_binned_steps{0u};
+    for (const unsigned int n : stats.step_size_hist) {
+        n_binned_steps += n;
+    }
+    EXPECT_EQ(n_binned_steps, 10u);
+
+    // A user constraint cuts every step: The steps end up in the bin
+    // [100um, 1mm)
+    rk_state.template set_constraint<step::constraint::e_user>(
+        0.5f * unit<scalar>::mm);
+    const unsigned int n_prev_steps{stats.step_size_hist[3]};
+    for (unsigned int i_s = 0u; i_s < 5u; i_s++) {
+        ASSERT_TRUE(rk_stepper.step(propagation));
+    }
+    EXPECT_EQ(stats.n_steps, 15u);
+    EXPECT_EQ(stats.n_constrained[step::constraint::e_user], 5u);
+    EXPECT_EQ(stats.n_constrained[step::constraint::e_accuracy], 0u);
+    EXPECT_EQ(stats.n_constrained[step::constraint::e_actor], 0u);
+    EXPECT_EQ(stats.n_constrained[step::constraint::e_aborter], 0u);
+    EXPECT_EQ(stats.step_size_hist[3], n_prev_steps + 5u);
+    EXPECT_FLOAT_EQ(inspector_t::step_size_edge(3), 100.f * unit<scalar>::um);
+
+    // The error control gives up after a single adjustment
+    prop_state<stepper_t::state, nav_state> aborted_propagation{
+        stepper_t::state{track, hom_bfield}, nav_state{host_mr}};
+    aborted_propagation._navigation.m_step_size = 10.f * unit<scalar>::m;
+    aborted_propagation._stepping.reset_step_size(10.f * unit<scalar>::m);
+
+    stepping::config<scalar> cfg{};
+    cfg.max_rk_updates = 1u;
+    rk_stepper.step(aborted_propagation, cfg);
+
+    const auto &aborted_stats = aborted_propagation._stepping.inspector();
+    EXPECT_EQ(aborted_stats.n_steps, 0u);
+    EXPECT_EQ(aborted_stats.n_retries, 1u);
+    EXPECT_EQ(aborted_stats.n_max_retries, 1u);
+    EXPECT_EQ(aborted_stats.n_field_lookups, 3u);
+
+    // Statistics of several tracks
+    inspector_t sum{};
+    sum += stats;
+    sum += aborted_stats;
+    EXPECT_EQ(sum.n_steps, 15u);
+    EXPECT_EQ(sum.n_max_retries, 1u);
+    EXPECT_EQ(sum.n_retries, stats.n_retries + 1u);
+}
@@ -0,0 +1,208 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// detray include(s)
+#include "detray/propagator/rk_stepper.hpp"
+
+#include "detray/builders/volume_builder.hpp"
+#include "detray/core/detector.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/navigation/detail/trajectories.hpp"
+#include "detray/test/types.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// System include(s)
+#include <memory>
+#include <type_traits>
+
+// google-test include(s)
+#include <gtest/gtest.h>
+
+using namespace detray;
+
+using algebra_t = test::algebra;
+using vector3 = test::vector3;
+using point3 = test::point3;
+using matrix_operator = test::matrix_operator;
+
+/// Runge-Kutta steppers in the algebra precision and with accumulation of the
+/// track position and path lengths in double precision
+template <typename bfield_t>
+using rk_stepper_t = rk_stepper<typename bfield_t::view_t, algebra_t>;
+template <typename bfield_t>
+using mixed_rk_stepper_t =
+    rk_stepper<typename bfield_t::view_t, algebra_t, unconstrained_step,
+               stepper_rk_policy, stepping::void_inspector, darray, double>;
+
+/// Reference in double precision
+using double_algebra_t = ALGEBRA_PLUGIN<double>;
+using double_vector3 = dvector3D<double_algebra_t>;
+
+namespace {
+
+constexpr scalar tol{1e-3f};
+
+vecmem::host_memory_resource host_mr;
+
+// dummy navigation struct
+struct nav_state {
+    /// New detector
+    nav_state(vecmem::host_memory_resource &mr, const scalar step_size)
+        : m_step_size{step_size},
+          m_det{std::make_unique<detray::detector<>>(mr)} {
+
+        // Empty dummy volume without material
+        volume_builder<detray::detector<>> vbuilder{volume_id::e_cylinder};
+        vbuilder.build(*m_det);
+    }
+
+    scalar operator()() const { return m_step_size; }
+    inline auto current_object() const -> dindex { return dindex_invalid; }
+    inline auto tolerance() const -> scalar { return tol; }
+    inline auto detector() const -> const detray::detector<> * {
+        return m_det.get();
+    }
+    inline auto volume() -> unsigned int { return 0u; }
+    inline void set_full_trust() {}
+    inline void set_high_trust() {}
+    inline void set_fair_trust() {}
+    inline void set_no_trust() {}
+    inline bool abort() { return false; }
+
+    scalar m_step_size;
+    std::unique_ptr<detray::detector<>> m_det;
+};
+
+// dummy propagator state
+template <typename stepping_t, typename navigation_t>
+struct prop_state {
+    stepping_t _stepping;
+    navigation_t _navigation;
+};
+
+/// @returns the distance between the position @param pos and the double
+/// precision helix of the track @param track after the path length @param s
+template <typename point3_t>
+double helix_distance(const free_track_parameters<algebra_t> &track,
+                      const vector3 &B, const point3_t &pos, const double s) {
+
+    const auto p0 = track.pos();
+    const auto mom = track.mom();
+    const free_track_parameters<double_algebra_t> dtrack(
+        {p0[0], p0[1], p0[2]}, 0., {mom[0], mom[1], mom[2]}, track.charge());
+    const double_vector3 dB{B[0], B[1], B[2]};
+
+    const auto true_pos = detail::helix(dtrack, &dB)(s);
+    const double_vector3 diff{pos[0] - true_pos[0], pos[1] - true_pos[1],
+                              pos[2] - true_pos[2]};
+
+    return getter::norm(diff);
+}
+
+/// Steps a track with the RK stepper and with the stepper @tparam
+/// mixed_stepper_t and checks the accumulators (only present if the stepper
+/// runs in mixed precision, i.e. if the scalar type is not double)
+template <typename mixed_stepper_t, typename bfield_t>
+void check_mixed_precision(const bfield_t &hom_bfield, const vector3 &B) {
+
+    rk_stepper_t<bfield_t> rk_stepper;
+    mixed_stepper_t mixed_rk_stepper;
+
+    // Many short steps on a long track
+    constexpr unsigned int n_steps{10000u};
+    const scalar step_size{1.f * unit<scalar>::mm};
+
+    const point3 pos{1.f * unit<scalar>::m, 0.f, 0.f};
+    const vector3 mom{0.f, 1.f * unit<scalar>::GeV, 1.f * unit<scalar>::GeV};
+    const free_track_parameters<algebra_t> track(pos, 0.f, mom, -1.f);
+
+    prop_state<typename rk_stepper_t<bfield_t>::state, nav_state> propagation{
+        typename rk_stepper_t<bfield_t>::state{track, hom_bfield},
+        nav_state{host_mr, step_size}};
+    prop_state<typename mixed_stepper_t::state, nav_state>
+        mixed_propagation{typename mixed_stepper_t::state{track, hom_bfield},
+                          nav_state{host_mr, step_size}};
+
+    auto &rk_state = propagation._stepping;
+    auto &mixed_state = mixed_propagation._stepping;
+
+    rk_state.set_step_size(step_size);
+    mixed_state.set_step_size(step_size);
+
+    for (unsigned int i_s = 0u; i_s < n_steps; i_s++) {
+        ASSERT_TRUE(rk_stepper.step(propagation));
+        ASSERT_TRUE(mixed_rk_stepper.step(mixed_propagation));
+    }
+
+    // The path length is exact in double precision
+    const double path_length{static_cast<double>(n_steps) * step_size};
+    if constexpr (mixed_stepper_t::is_mixed_precision) {
+        EXPECT_NEAR(mixed_state._acc.path_length, path_length, 1e-6);
+    }
+    EXPECT_NEAR(mixed_state.path_length(), path_length, tol);
+    EXPECT_NEAR(rk_state.path_length(), path_length, 10.f * tol);
+
+    const double rk_error{
+        helix_distance(track, B, rk_state().pos(), path_length)};
+    double mixed_error{
+        helix_distance(track, B, mixed_state().pos(), path_length)};
+    if constexpr (mixed_stepper_t::is_mixed_precision) {
+        mixed_error =
+            helix_distance(track, B, mixed_state._acc.pos, path_length);
+    }
+
+    EXPECT_LE(mixed_error, rk_error);
+    if constexpr (std::is_same_v<scalar, float>) {
+        EXPECT_LT(mixed_error, 0.1 * rk_error);
+    }
+
+    // The track position is the rounded position of the accumulator
+    if constexpr (mixed_stepper_t::is_mixed_precision) {
+        for (unsigned int i = 0u; i < 3u; ++i) {
+            EXPECT_EQ(mixed_state().pos()[i],
+                      static_cast<scalar>(mixed_state._acc.pos[i]));
+        }
+    }
+
+    // A position that is set from outside is picked up by the next step
+    const point3 new_pos{0.f, 1.f * unit<scalar>::m, 0.f};
+    mixed_state().set_pos(new_pos);
+    mixed_state._s = 0.f;
+    ASSERT_TRUE(mixed_rk_stepper.step(mixed_propagation));
+    EXPECT_NEAR(getter::norm(mixed_state().pos() - new_pos), step_size, tol);
+    EXPECT_NEAR(mixed_state._s, step_size, tol);
+    if constexpr (mixed_stepper_t::is_mixed_precision) {
+        EXPECT_NEAR(mixed_state._acc.s, step_size, tol);
+    }
+}
+
+}  // namespace
+
+// This tests the accumulation of the track position and path length in double
+// precision for long tracks with many steps
+GTEST_TEST(detray_propagator, rk_stepper_mixed_precision) {
+
+    // Constant magnetic field
+    using bfield_t = bfield::const_field_t;
+
+    vector3 B{0.f * unit<scalar>::T, 0.f * unit<scalar>::T,
+              2.f * unit<scalar>::T};
+    const bfield_t hom_bfield = bfield::create_const_field(B);
+
+    static_assert(mixed_rk_stepper_t<bfield_t>::is_mixed_precision ==
+                  not std::is_same_v<scalar, double>);
+    static_assert(not rk_stepper_t<bfield_t>::is_mixed_precision);
+
+    check_mixed_precision<mixed_rk_stepper_t<bfield_t>>(hom_bfield, B);
+
+    // Without mixed precision, the stepper state does not carry accumulators
+    if constexpr (mixed_rk_stepper_t<bfield_t>::is_mixed_precision) {
+        EXPECT_LT(sizeof(rk_stepper_t<bfield_t>::state),
+                  sizeof(mixed_rk_stepper_t<bfield_t>::state));
+    }
+}
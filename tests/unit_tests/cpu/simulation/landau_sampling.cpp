@@ -7,13 +7,17 @@
 
 // Project include(s).
 #include "detray/simulation/landau_distribution.hpp"
+#include "detray/simulation/landau_table_distribution.hpp"
 
 // GTest include(s)
 #include <gtest/gtest.h>
 
 // System include(s)
 #include <algorithm>
+#include <cmath>
 #include <iterator>
+#include <random>
+#include <vector>
 
 using namespace detray;
 
@@ -89,3 +93,53 @@ TYPED_TEST(detray_simulation_LandauSamplingValidation, landau_sampling) {
     // Make sure that max and mpv index is close to each other
     EXPECT_TRUE(max_index == mpv_index || max_index == mpv_index - 1u);
 }
+
+// Validate the table-based sampling against the CERNLIB G110 quantile
+TYPED_TEST(detray_simulation_LandauSamplingValidation, landau_table_sampling) {
+
+    using scalar_t = typename TestFixture::scalar_type;
+
+    const landau_distribution<scalar_t> ld;
+    const landau_table_distribution<scalar_t> ld_table;
+
+    // Compare the quantiles: absolute in the core, relative in the tails
+    constexpr std::size_t n_points{100000u};
+    for (std::size_t i = 1u; i < n_points; ++i) {
+        const auto z{static_cast<scalar_t>(i) /
+                     static_cast<scalar_t>(n_points)};
+        const scalar_t ref{ld.quantile(z)};
+        const scalar_t tol{1e-3f * std::max(scalar_t{1}, std::abs(ref))};
+
+        ASSERT_NEAR(ld_table.quantile(z), ref, tol) << "z = " << z;
+    }
+    EXPECT_EQ(ld_table.quantile(0.f), ld.quantile(0.f));
+    EXPECT_EQ(ld_table.quantile(1.f), ld.quantile(1.f));
+
+    // Compare the distribution shapes with the same random numbers
+    std::mt19937_64 gen_a{0u};
+    std::mt19937_64 gen_b{0u};
+
+    std::vector<int> counter(this->n_bins, 0);
+    std::vector<int> counter_table(this->n_bins, 0);
+
+    const auto minf = static_cast<scalar_t>(this->min);
+    const auto maxf = static_cast<scalar_t>(this->max);
+    constexpr std::size_t n_samples{1000000u};
+    for (std::size_t i = 0u; i < n_samples; i++) {
+        const auto sa = ld(gen_a, this->mu, this->sigma);
+        const auto sb = ld_table(gen_b, this->mu, this->sigma);
+
+        if (sa > minf && sa < maxf) {
+            counter[this->get_index(sa)]++;
+        }
+        if (sb > minf && sb < maxf) {
+            counter_table[this->get_index(sb)]++;
+        }
+    }
+
+    // Samples only move to the neighbouring bin near the bin edges
+    for (std::size_t i = 0u; i < this->n_bins; ++i) {
+        EXPECT_NEAR(counter_table[i], counter[i], 0.01 * counter[i] + 10)
+            << "bin " << i;
+    }
+}
@@ -95,3 +95,37 @@ GTEST_TEST(detray_simulation, particle_gun) {
         ++n_tracks;
     }
 }
+
+/// Compare the volume-wise ray tracing with the brute force intersection of
+/// all surfaces in the toy geometry
+GTEST_TEST(detray_simulation, particle_gun_trace_ray) {
+
+    vecmem::host_memory_resource host_mr;
+    auto [toy_det, names] = build_toy_detector(host_mr);
+
+    unsigned int theta_steps{50u};
+    unsigned int phi_steps{50u};
+
+    for (const auto test_ray : uniform_track_generator<detail::ray<algebra_t>>(
+             phi_steps, theta_steps)) {
+
+        const auto expected = particle_gun::shoot_particle(toy_det, test_ray);
+        const auto trace = particle_gun::trace_ray(toy_det, test_ray);
+
+        ASSERT_EQ(expected.size(), trace.size());
+
+        for (std::size_t i = 0u; i < trace.size(); ++i) {
+            // The order of the overlapping portals can be flipped
+            EXPECT_NEAR(expected[i].second.path, trace[i].second.path, tol);
+            if (expected[i].second.sf_desc.barcode() !=
+                trace[i].second.sf_desc.barcode()) {
+                ASSERT_TRUE(i + 1u < trace.size());
+                EXPECT_EQ(expected[i].second.sf_desc.barcode(),
+                          trace[i + 1u].second.sf_desc.barcode());
+                EXPECT_EQ(expected[i + 1u].second.sf_desc.barcode(),
+                          trace[i].second.sf_desc.barcode());
+                ++i;
+            }
+        }
+    }
+}
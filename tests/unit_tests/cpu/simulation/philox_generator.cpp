@@ -0,0 +1,131 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "detray/simulation/landau_distribution.hpp"
+#include "detray/simulation/philox_generator.hpp"
+#include "detray/test/types.hpp"
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace detray;
+
+using scalar_t = test::scalar;
+
+// Compare to the known answers of the Random123 reference implementation
+GTEST_TEST(detray_simulation, philox_known_answers) {
+
+    using counter_t = philox_generator::counter_type;
+
+    EXPECT_EQ(philox_generator::block({0u, 0u, 0u, 0u}, {0u, 0u}),
+              (counter_t{0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u}));
+    EXPECT_EQ(philox_generator::block(
+                  {0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu},
+                  {0xffffffffu, 0xffffffffu}),
+              (counter_t{0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu}));
+    EXPECT_EQ(philox_generator::block(
+                  {0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u},
+                  {0xa4093822u, 0x299f31d0u}),
+              (counter_t{0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u}));
+}
+
+// The streams only depend on the event, track and step number
+GTEST_TEST(detray_simulation, philox_streams) {
+
+    constexpr std::size_t n_tracks{100u};
+    constexpr std::size_t n_draws{10u};
+
+    // Draw the random numbers of the tracks one after the other
+    std::vector<std::vector<std::uint32_t>> sequential(n_tracks);
+    for (std::size_t trk = 0u; trk < n_tracks; ++trk) {
+        philox_generator gen{42u, trk};
+        for (std::size_t i = 0u; i < n_draws; ++i) {
+            sequential[trk].push_back(gen());
+        }
+    }
+
+    // Interleave the tracks in reverse order
+    std::vector<philox_generator> generators;
+    for (std::size_t trk = 0u; trk < n_tracks; ++trk) {
+        generators.emplace_back(42u, trk);
+    }
+    for (std::size_t i = 0u; i < n_draws; ++i) {
+        for (std::size_t trk = n_tracks; trk-- > 0u;) {
+            EXPECT_EQ(generators[trk](), sequential[trk][i]);
+        }
+    }
+
+    // Different events, tracks and steps give different streams
+    philox_generator gen{42u, 0u};
+    EXPECT_NE(philox_generator(43u, 0u)(), gen());
+    gen.set_step(0u);
+    EXPECT_NE(philox_generator(42u, 1u)(), gen());
+    gen.set_step(0u);
+    EXPECT_NE(philox_generator(42u, 0u, 1u)(), gen());
+
+    // The stream of a step does not depend on the previous steps
+    philox_generator gen_a{42u, 3u};
+    philox_generator gen_b{42u, 3u};
+    for (std::size_t i = 0u; i < 7u; ++i) {
+        gen_a();
+    }
+    gen_a.next_step();
+    gen_b.next_step();
+    EXPECT_EQ(gen_a.step(), 1u);
+    for (std::size_t i = 0u; i < n_draws; ++i) {
+        EXPECT_EQ(gen_a(), gen_b());
+    }
+}
+
+// Check the moments of the uniform and normal random numbers
+GTEST_TEST(detray_simulation, philox_distributions) {
+
+    philox_generator gen{1u, 2u};
+
+    constexpr std::size_t n_samples{1000000u};
+    double sum_u{0.};
+    double sum_u2{0.};
+    double sum_n{0.};
+    double sum_n2{0.};
+    for (std::size_t i = 0u; i < n_samples; ++i) {
+        const auto u{static_cast<double>(gen.uniform<scalar_t>())};
+        ASSERT_TRUE(u > 0. && u < 1.);
+        sum_u += u;
+        sum_u2 += u * u;
+
+        const auto n{static_cast<double>(gen.normal<scalar_t>(1.f, 2.f))};
+        sum_n += n;
+        sum_n2 += n * n;
+    }
+    const double n{static_cast<double>(n_samples)};
+
+    // Uniform: mean = 1/2, variance = 1/12
+    EXPECT_NEAR(sum_u / n, 0.5, 1e-3);
+    EXPECT_NEAR(sum_u2 / n - (sum_u / n) * (sum_u / n), 1. / 12., 1e-3);
+    // Normal: mean = 1, variance = 4
+    EXPECT_NEAR(sum_n / n, 1., 1e-2);
+    EXPECT_NEAR(sum_n2 / n - (sum_n / n) * (sum_n / n), 4., 2e-2);
+
+    // Can be used with the distributions of the standard library
+    std::uniform_real_distribution<scalar_t> dist(-1.f, 1.f);
+    const scalar_t x{dist(gen)};
+    EXPECT_TRUE(x >= -1.f && x < 1.f);
+
+    // Reproducible Landau samples
+    landau_distribution<scalar_t> landau{};
+    philox_generator gen_a{5u, 6u};
+    philox_generator gen_b{5u, 6u};
+    for (std::size_t i = 0u; i < 100u; ++i) {
+        EXPECT_EQ(landau(gen_a, 0.f, 1.f), landau(gen_b, 0.f, 1.f));
+    }
+}
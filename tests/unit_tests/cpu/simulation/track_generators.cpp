@@ -17,6 +17,9 @@
 // GTest include(s)
 #include <gtest/gtest.h>
 
+// System include(s)
+#include <vector>
+
 using namespace detray;
 
 using algebra_t = test::algebra;
@@ -376,3 +379,100 @@ GTEST_TEST(detray_simulation, random_track_generator_normal) {
                 std::pow(0.5f / 3.0f * (theta_range[1] - theta_range[0]), 2.f),
                 tol);
 }
+
+/// Tests the splittable track generator with counter-based random numbers
+GTEST_TEST(detray_simulation, splittable_track_generator) {
+
+    using track_t = free_track_parameters<algebra_t>;
+    using trk_generator_t = splittable_track_generator<track_t>;
+
+    // Tolerance depends on sample size
+    constexpr scalar_t tol{0.05f};
+
+    constexpr std::size_t n_gen_tracks{10000u};
+
+    trk_generator_t::configuration trk_gen_cfg{};
+    trk_gen_cfg.seed(42u);
+    trk_gen_cfg.n_tracks(n_gen_tracks);
+    trk_gen_cfg.phi_range(-0.9f * constant<scalar_t>::pi,
+                          0.8f * constant<scalar_t>::pi);
+    trk_gen_cfg.mom_range(1.f * unit<scalar_t>::GeV, 2.f * unit<scalar_t>::GeV);
+    trk_gen_cfg.origin_stddev({0.1f * unit<scalar_t>::mm,
+                               0.f * unit<scalar_t>::mm,
+                               0.2f * unit<scalar_t>::mm});
+
+    const trk_generator_t trk_gen{trk_gen_cfg};
+    ASSERT_EQ(trk_gen.size(), n_gen_tracks);
+
+    // Serial generation
+    std::vector<track_t> tracks{};
+    for (const auto track : trk_gen) {
+        tracks.push_back(track);
+    }
+    ASSERT_EQ(tracks.size(), n_gen_tracks);
+
+    // Generation in place
+    std::vector<track_t> filled(n_gen_tracks);
+    trk_gen.fill(filled);
+
+    // The partitioning does not change the tracks (uneven split)
+    constexpr std::size_t n_parts{7u};
+    std::size_t n_tracks{0u};
+    for (std::size_t part = 0u; part < n_parts; ++part) {
+        const auto sub_gen = trk_gen.subrange(part, n_parts);
+        ASSERT_EQ(sub_gen.offset(), n_tracks);
+
+        for (std::size_t i = 0u; i < sub_gen.size(); ++i) {
+            const track_t track = sub_gen[i];
+            const track_t& ref = tracks[n_tracks];
+
+            for (unsigned int j = 0u; j < 3u; ++j) {
+                EXPECT_EQ(track.pos()[j], ref.pos()[j]);
+                EXPECT_EQ(track.dir()[j], ref.dir()[j]);
+                EXPECT_EQ(filled[n_tracks].dir()[j], ref.dir()[j]);
+            }
+            EXPECT_EQ(track.p(), ref.p());
+
+            ++n_tracks;
+        }
+    }
+    ASSERT_EQ(n_tracks, n_gen_tracks);
+
+    // Sub-ranges of sub-ranges
+    const auto sub_gen = trk_gen.subrange(1u, 2u).subrange(2u, 3u);
+    EXPECT_EQ(sub_gen.offset(), 8334u);
+    EXPECT_EQ(sub_gen.size(), 1666u);
+    EXPECT_EQ(sub_gen[0].p(), tracks[8334u].p());
+
+    // A different seed gives different tracks
+    trk_gen_cfg.seed(43u);
+    EXPECT_NE(trk_generator_t{trk_gen_cfg}[0].p(), tracks[0].p());
+
+    // Check uniform distribution
+    std::vector<scalar_t> x{};
+    std::vector<scalar_t> z{};
+    std::vector<scalar_t> mom{};
+    std::vector<scalar_t> phi{};
+    for (const track_t& track : tracks) {
+        x.push_back(track.pos()[0]);
+        z.push_back(track.pos()[2]);
+        mom.push_back(track.p());
+        phi.push_back(getter::phi(track.dir()));
+    }
+
+    const auto& ori_stddev = trk_gen_cfg.origin_stddev();
+    const auto& phi_range = trk_gen_cfg.phi_range();
+    const auto& mom_range = trk_gen_cfg.mom_range();
+
+    EXPECT_NEAR(statistics::mean(x), 0.f, tol);
+    EXPECT_NEAR(statistics::mean(z), 0.f, tol);
+    EXPECT_NEAR(statistics::mean(mom), 0.5f * (mom_range[0] + mom_range[1]),
+                tol);
+    EXPECT_NEAR(statistics::mean(phi), 0.5f * (phi_range[0] + phi_range[1]),
+                tol);
+
+    EXPECT_NEAR(statistics::variance(x), ori_stddev[0] * ori_stddev[0], tol);
+    EXPECT_NEAR(statistics::variance(z), ori_stddev[2] * ori_stddev[2], tol);
+    EXPECT_NEAR(statistics::variance(phi),
+                1.0f / 12.0f * std::pow(phi_range[1] - phi_range[0], 2.f), tol);
+}
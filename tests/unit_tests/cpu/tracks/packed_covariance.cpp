@@ -0,0 +1,85 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/tracks/packed_covariance.hpp"
+
+#include "detray/test/types.hpp"
+
+// Google Test include(s)
+#include <gtest/gtest.h>
+
+using namespace detray;
+
+using algebra_t = test::algebra;
+using matrix_operator = test::matrix_operator;
+
+constexpr scalar tol{1e-5f};
+
+GTEST_TEST(detray_tracks, packed_covariance) {
+
+    using packed_cov_t = packed_covariance<algebra_t>;
+
+    static_assert(packed_cov_t::n_elements == 21u);
+
+    // Every element of the upper triangle has its own storage
+    bool used[packed_cov_t::n_elements]{};
+    for (unsigned int i = 0u; i < e_bound_size; ++i) {
+        for (unsigned int j = i; j < e_bound_size; ++j) {
+            const std::size_t idx{packed_cov_t::index(i, j)};
+            ASSERT_LT(idx, packed_cov_t::n_elements);
+            EXPECT_FALSE(used[idx]);
+            used[idx] = true;
+            EXPECT_EQ(packed_cov_t::index(j, i), idx);
+        }
+    }
+
+    // Symmetric covariance and a jacobian
+    bound_matrix<algebra_t> cov =
+        matrix_operator().template zero<e_bound_size, e_bound_size>();
+    bound_matrix<algebra_t> jac =
+        matrix_operator().template identity<e_bound_size, e_bound_size>();
+    for (unsigned int i = 0u; i < e_bound_size; ++i) {
+        for (unsigned int j = 0u; j < e_bound_size; ++j) {
+            getter::element(cov, i, j) =
+                (i == j) ? 2.f : 0.1f / static_cast<scalar>(i + j);
+            getter::element(jac, i, j) +=
+                0.02f * static_cast<scalar>((2u * i + j) % 5u);
+        }
+    }
+
+    const packed_cov_t packed_cov{cov};
+
+    // Round trip
+    const bound_matrix<algebra_t> unpacked = packed_cov.to_matrix();
+    for (unsigned int i = 0u; i < e_bound_size; ++i) {
+        for (unsigned int j = 0u; j < e_bound_size; ++j) {
+            EXPECT_FLOAT_EQ(packed_cov(i, j), getter::element(cov, i, j));
+            EXPECT_FLOAT_EQ(getter::element(unpacked, i, j),
+                            getter::element(cov, i, j));
+        }
+    }
+
+    // Transport
+    const bound_matrix<algebra_t> ref_cov =
+        jac * cov * matrix_operator().transpose(jac);
+    packed_cov_t new_cov = packed_cov.transport(jac);
+    for (unsigned int i = 0u; i < e_bound_size; ++i) {
+        for (unsigned int j = 0u; j < e_bound_size; ++j) {
+            EXPECT_NEAR(new_cov(i, j), getter::element(ref_cov, i, j), tol);
+        }
+    }
+
+    // Update of a variance
+    new_cov.add_variance(e_bound_theta, 0.5f);
+    EXPECT_NEAR(new_cov(e_bound_theta, e_bound_theta),
+                getter::element(ref_cov, e_bound_theta, e_bound_theta) + 0.5f,
+                tol);
+
+    // The packed storage is smaller than the dense matrix
+    EXPECT_LT(sizeof(packed_cov_t), sizeof(bound_matrix<algebra_t>));
+}
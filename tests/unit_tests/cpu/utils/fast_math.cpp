@@ -0,0 +1,79 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "detray/definitions/detail/fast_math.hpp"
+
+// Google Test include(s).
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <cmath>
+
+using namespace detray;
+
+// Check the approximations against the documented error bounds
+GTEST_TEST(detray_utils, fast_math_approximations) {
+
+    // Sine and cosine
+    for (int i = -100000; i <= 100000; ++i) {
+        const float x{static_cast<float>(i) * 0.08f};
+        const auto xd{static_cast<double>(x)};
+
+        float s;
+        float c;
+        detail::approx::sincos(x, s, c);
+        ASSERT_NEAR(s, std::sin(xd), 2e-7) << x;
+        ASSERT_NEAR(c, std::cos(xd), 2e-7) << x;
+        ASSERT_EQ(detail::approx::sin(x), s);
+        ASSERT_EQ(detail::approx::cos(x), c);
+    }
+
+    // Arcus tangent in all quadrants
+    for (int i = -200; i <= 200; ++i) {
+        for (int j = -200; j <= 200; ++j) {
+            const float x{static_cast<float>(i) * 0.05f};
+            const float y{static_cast<float>(j) * 0.05f};
+
+            ASSERT_NEAR(detail::approx::atan2(y, x),
+                        std::atan2(static_cast<double>(y),
+                                   static_cast<double>(x)),
+                        3e-7)
+                << x << ", " << y;
+        }
+    }
+
+    // Natural logarithm
+    for (float x = 1e-30f; x < 1e30f; x *= 1.001f) {
+        const double expected{std::log(static_cast<double>(x))};
+        const double tol{2e-7 * std::fmax(1., std::fabs(expected))};
+
+        ASSERT_NEAR(detail::approx::log(x), expected, tol) << x;
+    }
+}
+
+// The dispatch never approximates double precision
+GTEST_TEST(detray_utils, fast_math_dispatch) {
+
+    const double x{0.7};
+    ASSERT_EQ(fast_math::sin(x), std::sin(x));
+    ASSERT_EQ(fast_math::cos(x), std::cos(x));
+    ASSERT_EQ(fast_math::atan2(x, -x), std::atan2(x, -x));
+    ASSERT_EQ(fast_math::log(x), std::log(x));
+
+    const float xf{0.7f};
+#if defined(DETRAY_FAST_MATH)
+    ASSERT_EQ(fast_math::sin(xf), detail::approx::sin(xf));
+    ASSERT_EQ(fast_math::log(xf), detail::approx::log(xf));
+#else
+    ASSERT_EQ(fast_math::sin(xf), std::sin(xf));
+    ASSERT_EQ(fast_math::log(xf), std::log(xf));
+#endif
+
+    const double v[3]{1., 1., 0.};
+    ASSERT_EQ(fast_math::phi(v), std::atan2(1., 1.));
+}
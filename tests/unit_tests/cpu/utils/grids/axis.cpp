@@ -20,6 +20,7 @@
 
 // System include(s)
 #include <limits>
+#include <vector>
 
 using namespace detray;
 using namespace detray::axis;
@@ -330,6 +331,57 @@ GTEST_TEST(detray_grid, closed_irregular_axis) {
     EXPECT_EQ(cir_axis.range(3.f, nhood11s), expected_range);
 }
 
+GTEST_TEST(detray_grid, irregular_axis_lookup) {
+
+    using irregular_t = irregular<host_container_types, scalar>;
+
+    // Bin edges with very different bin widths
+    const std::vector<scalar> edges = {-3.f, 1.f,   2.f,   2.25f, 4.f,
+                                       8.f,  12.f,  15.f,  40.f,  40.5f};
+    const auto n_bins{static_cast<dindex>(edges.size() - 1u)};
+
+    // Some other axis in front of the edges
+    vecmem::vector<scalar> bin_edges = {-100.f, 100.f};
+    const auto offset{static_cast<dindex>(bin_edges.size())};
+    bin_edges.insert(bin_edges.end(), edges.begin(), edges.end());
+
+    // Reference axis without lookup table
+    single_axis<closed<label::e_z>, irregular_t> ref_axis({offset, n_bins},
+                                                          &bin_edges);
+    EXPECT_FALSE(ref_axis.m_binning.has_lookup());
+
+    // The lookup table follows the bin edges
+    irregular_t::append_lookup(edges, bin_edges);
+    EXPECT_GT(bin_edges.size(), offset + edges.size() + 2u);
+    EXPECT_LE(bin_edges.size(),
+              offset + edges.size() + 2u +
+                  irregular_t::max_lookup_cells_per_bin * n_bins);
+
+    single_axis<closed<label::e_z>, irregular_t> lut_axis(
+        {offset, n_bins | irregular_t::lookup_flag}, &bin_edges);
+    EXPECT_TRUE(lut_axis.m_binning.has_lookup());
+
+    // The table does not change the axis
+    EXPECT_EQ(lut_axis.nbins(), n_bins);
+    EXPECT_NEAR(lut_axis.span()[0], -3.f, tol);
+    EXPECT_NEAR(lut_axis.span()[1], 40.5f, tol);
+    EXPECT_EQ(lut_axis.bin_edges(), ref_axis.bin_edges());
+
+    // Same bins as the binary search, also on the bin edges and outside
+    for (const scalar e : edges) {
+        EXPECT_EQ(lut_axis.m_binning.bin(e), ref_axis.m_binning.bin(e));
+        EXPECT_EQ(lut_axis.bin(e), ref_axis.bin(e)) << e;
+    }
+    for (scalar v = -10.f; v < 50.f; v += 0.01f) {
+        EXPECT_EQ(lut_axis.m_binning.bin(v), ref_axis.m_binning.bin(v)) << v;
+    }
+
+    const darray<dindex, 2> nhood11i = {1u, 1u};
+    const darray<scalar, 2> nhood11s = {4.f, 5.5f};
+    EXPECT_EQ(lut_axis.range(3.f, nhood11i), ref_axis.range(3.f, nhood11i));
+    EXPECT_EQ(lut_axis.range(3.f, nhood11s), ref_axis.range(3.f, nhood11s));
+}
+
 GTEST_TEST(detray_grid, multi_axis) {
 
     // readable axis ownership definition
@@ -409,6 +461,23 @@ GTEST_TEST(detray_grid, multi_axis) {
     expected_ranges[2] = {3u, 8u};
     EXPECT_EQ(axes.bin_ranges(p3, nhood11s), expected_ranges);
 
+    // Segment range access: cover the bins between two points
+    EXPECT_EQ(axes.bin_ranges(p3, p3, nhood22i), axes.bin_ranges(p3, nhood22i));
+    point3 p3_end{-5.5f, 3.2f, 24.1f};
+    expected_ranges[0] = {4u, 12u};
+    expected_ranges[1] = {21u, 24u};
+    expected_ranges[2] = {5u, 13u};
+    EXPECT_EQ(axes.bin_ranges(p3, p3_end, nhood00i), expected_ranges);
+    EXPECT_EQ(axes.bin_ranges(p3_end, p3, nhood00i), expected_ranges);
+    expected_ranges[0] = {2u, 14u};
+    expected_ranges[1] = {19u, 26u};
+    expected_ranges[2] = {3u, 15u};
+    EXPECT_EQ(axes.bin_ranges(p3, p3_end, nhood22i), expected_ranges);
+    // Clamped to the closed axis
+    p3_end = {-50.f, 3.2f, 24.1f};
+    expected_ranges[0] = {0u, 14u};
+    EXPECT_EQ(axes.bin_ranges(p3, p3_end, nhood22i), expected_ranges);
+
     // Owning multi axis test
     vecmem::vector<scalar> bin_edges_cp(bin_edges);
     // Offsets into edges container and #bins for all axes
@@ -438,3 +507,55 @@ GTEST_TEST(detray_grid, multi_axis) {
     auto z_axis_device = axes_device.get_axis<label::e_z>();
     EXPECT_EQ(z_axis_device.nbins(), 50u);
 }
+
+GTEST_TEST(detray_grid, multi_axis_segment) {
+
+    using polar_2D =
+        multi_axis<false, polar2D<test::algebra>,
+                   single_axis<closed<label::e_r>,
+                               regular<host_container_types, scalar>>,
+                   single_axis<circular<label::e_phi>,
+                               regular<host_container_types, scalar>>>;
+    using point2 = polar_2D::point_type;
+
+    // 10 bins in r, 12 bins in phi
+    vecmem::vector<scalar> bin_edges = {0.f, 10.f, -constant<scalar>::pi,
+                                        constant<scalar>::pi};
+    vecmem::vector<dindex_range> edge_ranges = {{0u, 10u}, {2u, 12u}};
+
+    polar_2D axes(edge_ranges, bin_edges);
+
+    const darray<dindex, 2> nhood00i = {0u, 0u};
+    const darray<dindex, 2> nhood11i = {1u, 1u};
+
+    // Phi bin width
+    const scalar w{constant<scalar>::pi / 6.f};
+
+    // Segment that does not cross the phi boundary
+    axis::multi_bin_range<2> expected_ranges{};
+    expected_ranges[0] = {2u, 6u};
+    expected_ranges[1] = {5, 9};
+    EXPECT_EQ(axes.bin_ranges(point2{2.5f, -0.5f * w},
+                              point2{5.5f, 2.5f * w}, nhood00i),
+              expected_ranges);
+
+    // Segment that crosses the phi boundary: take the shorter way
+    expected_ranges[0] = {2u, 3u};
+    expected_ranges[1] = {10, 13};
+    EXPECT_EQ(axes.bin_ranges(point2{2.5f, constant<scalar>::pi - 1.5f * w},
+                              point2{2.5f, -constant<scalar>::pi + 0.5f * w},
+                              nhood00i),
+              expected_ranges);
+    expected_ranges[0] = {1u, 4u};
+    expected_ranges[1] = {-2, 2};
+    EXPECT_EQ(axes.bin_ranges(point2{2.5f, -constant<scalar>::pi + 0.5f * w},
+                              point2{2.5f, constant<scalar>::pi - 0.5f * w},
+                              nhood11i),
+              expected_ranges);
+
+    // The range never covers a bin twice
+    const auto ranges = axes.bin_ranges(point2{2.5f, -2.5f * w},
+                                        point2{2.5f, 3.5f * w},
+                                        darray<dindex, 2>{4u, 4u});
+    EXPECT_EQ(ranges[1][1] - ranges[1][0], 12);
+}
@@ -10,7 +10,11 @@
 
 #include "detray/builders/grid_builder.hpp"
 #include "detray/definitions/detail/indexing.hpp"
+#include "detray/geometry/mask.hpp"
 #include "detray/geometry/shapes/cuboid3D.hpp"
+#include "detray/geometry/shapes/cylinder2D.hpp"
+#include "detray/geometry/shapes/rectangle2D.hpp"
+#include "detray/geometry/shapes/ring2D.hpp"
 #include "detray/test/types.hpp"
 
 // Vecmem include(s)
@@ -24,6 +28,8 @@
 // System include(s)
 #include <algorithm>
 #include <limits>
+#include <thread>
+#include <vector>
 
 using namespace detray;
 using namespace detray::axis;
@@ -383,6 +389,30 @@ GTEST_TEST(detray_grid, bin_view) {
     for (auto [i, entry] : detray::views::enumerate(grid_search3)) {
         EXPECT_EQ(entry, expected[i]) << "bin entry: " << entry;
     }
+
+    //
+    // Bin 1 and nearest neighbors, but not in y
+    //
+    const std::array<std::array<dindex, 2>, 3> axis_window_sizes{
+        {{1u, 1u}, {0u, 0u}, {1u, 1u}}};
+    search_window[1] = axis::bin_range{1, 2};
+
+    expected = {21, 821, 1621, 22, 822, 1622, 23, 823, 1623};
+
+    const auto bview4 = axis::detail::bin_view(grid_3D, search_window);
+    const auto grid_search4 = grid_3D.search(p, axis_window_sizes);
+
+    ASSERT_EQ(bview4.size(), 9u);
+    ASSERT_EQ(grid_search4.size(), 9u);
+
+    for (auto [i, entry] : detray::views::enumerate(grid_search4)) {
+        EXPECT_EQ(entry, expected[i]) << "bin entry: " << entry;
+    }
+
+    // Upper bound on the number of entries a search can return
+    EXPECT_EQ(grid_3D.n_max_candidates(std::array<dindex, 2>{0u, 0u}), 1u);
+    EXPECT_EQ(grid_3D.n_max_candidates(search_window_size), 27u);
+    EXPECT_EQ(grid_3D.n_max_candidates(std::array<dindex, 2>{1u, 2u}), 64u);
 }
 
 /// Integration test: Test replace population
@@ -604,3 +634,175 @@ GTEST_TEST(detray_grid, regular_attach_population) {
         EXPECT_TRUE(entry == 5.f || entry == 6.f || entry == 7.f);
     }
 }
+
+/// Test the concurrent two-phase population of a grid with dynamic bins
+GTEST_TEST(detray_grid, concurrent_population) {
+
+    // Owning, 3D cartesian grid with dynamic bin capacities
+    using grid_t = grid<axes<cuboid3D>, bins::dynamic_array<dindex>>;
+
+    constexpr dindex n_threads{4u};
+
+    // Empty bins without capacity
+    grid_t::bin_container_type bin_data{};
+    bin_data.bins.resize(40'000u);
+
+    dvector<scalar> bin_edges_cp(bin_edges);
+    dvector<dindex_range> edge_ranges_cp(edge_ranges);
+    cartesian_3D<is_owning, host_container_types> axes_own(
+        std::move(edge_ranges_cp), std::move(bin_edges_cp));
+    grid_t g3(std::move(bin_data), std::move(axes_own));
+
+    // Every thread adds its index to the bins whose index modulo the number
+    // of threads is not smaller
+    auto populate_all = [&g3](auto populator) {
+        using populator_t = decltype(populator);
+
+        std::vector<std::thread> threads{};
+        for (dindex t = 0u; t < n_threads; ++t) {
+            threads.emplace_back([&g3, t]() {
+                for (dindex gbin = 0u; gbin < g3.nbins(); ++gbin) {
+                    if (t <= gbin % n_threads) {
+                        g3.template populate<populator_t>(gbin, t);
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    };
+
+    // Count the entries, lay out the bins and fill them
+    populate_all(atomic_count{});
+    g3.bins().allocate_entries();
+    populate_all(atomic_attach{});
+    sort_bins(g3);
+
+    EXPECT_EQ(g3.all().size(), 100'000u);
+
+    for (dindex gbin = 0u; gbin < g3.nbins(); ++gbin) {
+        const auto bin = g3.bin(gbin);
+        ASSERT_EQ(bin.size(), gbin % n_threads + 1u);
+        for (auto [i, entry] : detray::views::enumerate(bin)) {
+            EXPECT_EQ(entry, i) << "global bin: " << gbin;
+        }
+    }
+}
+
+namespace {
+
+/// Fill the bins of a 2D grid with a varying number of entries, using the
+/// global bin index as entry
+template <typename grid_t>
+void fill_grid(grid_t& g) {
+    for (dindex gbin = 0u; gbin < g.nbins(); ++gbin) {
+        for (dindex i = 0u; i < (gbin * 7u) % 5u; ++i) {
+            g.template populate<attach<>>(gbin, gbin);
+        }
+    }
+}
+
+/// Transcribe a 2D grid into a grid with compressed bin storage and compare
+/// the bin content and the neighborhood lookups of both grids
+template <typename grid_t>
+void test_csr_grid(const grid_t& ref_grid) {
+
+    using csr_grid_t =
+        grid_impl<typename grid_t::axes_type, bins::csr_array<dindex>>;
+    using axes_t = typename csr_grid_t::axes_type;
+
+    typename csr_grid_t::bin_container_type bin_data{};
+    bin_data.append(ref_grid.bins());
+    EXPECT_EQ(bin_data.size(), ref_grid.nbins());
+
+    axes_t axes_cp(ref_grid.axes());
+    csr_grid_t csr_grid(std::move(bin_data), std::move(axes_cp));
+    ASSERT_EQ(csr_grid.nbins(), ref_grid.nbins());
+
+    // Same bin content
+    for (dindex gbin = 0u; gbin < ref_grid.nbins(); ++gbin) {
+        const auto ref_bin = ref_grid.bin(gbin);
+        const auto csr_bin = csr_grid.bin(gbin);
+        ASSERT_EQ(csr_bin.size(), ref_bin.size());
+        EXPECT_TRUE(std::equal(csr_bin.begin(), csr_bin.end(),
+                               ref_bin.begin()));
+    }
+
+    // Same candidates in the neighborhood lookups (up to ordering)
+    const auto ax0 = ref_grid.template get_axis<0>();
+    const auto ax1 = ref_grid.template get_axis<1>();
+    constexpr int n_points{23};
+    for (const dindex win : {0u, 1u, 2u, 20u}) {
+        const std::array<dindex, 2> search_window{win, win};
+
+        for (int i = 0; i <= n_points; ++i) {
+            for (int j = 0; j <= n_points; ++j) {
+                // Sample points slightly outside the axis spans, as well
+                const scalar s0{static_cast<scalar>(i) /
+                                static_cast<scalar>(n_points)};
+                const scalar s1{static_cast<scalar>(j) /
+                                static_cast<scalar>(n_points)};
+                const scalar l0{ax0.span()[1] - ax0.span()[0]};
+                const scalar l1{ax1.span()[1] - ax1.span()[0]};
+                const typename grid_t::point_type p{
+                    ax0.span()[0] + (1.1f * s0 - 0.05f) * l0,
+                    ax1.span()[0] + (1.1f * s1 - 0.05f) * l1};
+
+                std::vector<dindex> ref_entries{};
+                for (const dindex e : ref_grid.search(p, search_window)) {
+                    ref_entries.push_back(e);
+                }
+                std::vector<dindex> csr_entries{};
+                for (const dindex e : csr_grid.search(p, search_window)) {
+                    csr_entries.push_back(e);
+                }
+
+                std::sort(ref_entries.begin(), ref_entries.end());
+                std::sort(csr_entries.begin(), csr_entries.end());
+
+                // A search window that is larger than a circular axis visits
+                // the bins of the reference grid repeatedly, while the
+                // compressed storage visits every bin once
+                if (2u * win + 1u > ax0.nbins() ||
+                    2u * win + 1u > ax1.nbins()) {
+                    ref_entries.erase(
+                        std::unique(ref_entries.begin(), ref_entries.end()),
+                        ref_entries.end());
+                    csr_entries.erase(
+                        std::unique(csr_entries.begin(), csr_entries.end()),
+                        csr_entries.end());
+                }
+                ASSERT_EQ(csr_entries, ref_entries);
+            }
+        }
+    }
+}
+
+}  // anonymous namespace
+
+/// Test the compressed bin storage against a grid with static bin capacities
+GTEST_TEST(detray_grid, csr_array) {
+
+    vecmem::host_memory_resource host_mr;
+    auto gr_factory =
+        grid_factory<bins::static_array<dindex, 4>, simple_serializer>{host_mr};
+
+    // Closed axes
+    mask<rectangle2D> rect{0u, 10.f, 20.f};
+    auto rect_gr = gr_factory.new_grid(rect, {10u, 12u});
+    fill_grid(rect_gr);
+    test_csr_grid(rect_gr);
+
+    // Circular first axis (rows wrap around)
+    mask<cylinder2D> cyl{0u, 5.f, -10.f, 10.f};
+    auto cyl_gr = gr_factory.new_grid(cyl, {9u, 7u});
+    fill_grid(cyl_gr);
+    test_csr_grid(cyl_gr);
+
+    // Circular second axis
+    mask<ring2D> ring{0u, 1.f, 10.f};
+    auto ring_gr = gr_factory.new_grid(ring, {6u, 11u});
+    fill_grid(ring_gr);
+    test_csr_grid(ring_gr);
+}
@@ -10,14 +10,20 @@
 
 #include "detray/definitions/detail/indexing.hpp"
 #include "detray/geometry/shapes/cylinder3D.hpp"
+#include "detray/geometry/shapes/ring2D.hpp"
 #include "detray/test/types.hpp"
 #include "detray/utils/grid/grid.hpp"
 #include "detray/utils/grid/populators.hpp"
 #include "detray/utils/grid/serializers.hpp"
 
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
 // System include(s)
 #include <algorithm>
 #include <limits>
+#include <utility>
+#include <vector>
 
 // GTest include(s)
 #include <gtest/gtest.h>
@@ -256,3 +262,70 @@ GTEST_TEST(detray_grid, grid_collection_dynamic_bin) {
                        typename grid_collection<grid_t>::const_view_type>,
         "Grid collection const view incorrectly assembled");
 }
+
+/// Unittest: Test a collection of grids with compressed (CSR) bin storage
+GTEST_TEST(detray_grid, grid_collection_csr) {
+
+    // Owning and non-owning grid types with compressed bin storage
+    using grid_t = grid<axes<ring2D>, bins::csr_array<dindex>,
+                        simple_serializer, host_container_types, is_n_owning>;
+    using grid_owning_t = grid_t::template type<true>;
+    using axes_owning_t = grid_owning_t::axes_type;
+
+    // Two grids: 2 x 3 and 3 x 4 bins (r, phi)
+    std::vector<std::vector<dindex>> bins_0{{0u},     {},   {1u, 2u},
+                                            {3u},     {4u}, {}};
+    std::vector<std::vector<dindex>> bins_1{
+        {5u}, {6u, 7u}, {},       {8u},  {9u},       {10u},
+        {},   {11u},    {12u},    {13u}, {14u, 15u}, {16u}};
+
+    grid_owning_t::bin_container_type bin_data_0{};
+    bin_data_0.append(bins_0);
+    grid_owning_t::bin_container_type bin_data_1{};
+    bin_data_1.append(bins_1);
+
+    axes_owning_t axes_0(dvector<dindex_range>{{0u, 2u}, {2u, 3u}},
+                         dvector<scalar>{0.f, 10.f, -constant<scalar>::pi,
+                                         constant<scalar>::pi});
+    axes_owning_t axes_1(dvector<dindex_range>{{0u, 3u}, {2u, 4u}},
+                         dvector<scalar>{10.f, 40.f, -constant<scalar>::pi,
+                                         constant<scalar>::pi});
+
+    grid_owning_t grid_0(std::move(bin_data_0), std::move(axes_0));
+    grid_owning_t grid_1(std::move(bin_data_1), std::move(axes_1));
+
+    vecmem::host_memory_resource host_mr;
+    grid_collection<grid_t> grid_coll(&host_mr);
+    grid_coll.push_back(grid_0);
+    grid_coll.push_back(grid_1);
+
+    // Basics: the grids share the offset that closes the first grid
+    EXPECT_EQ(grid_coll.size(), 2u);
+    EXPECT_EQ(grid_coll.bin_storage().offsets.size(), 19u);
+    EXPECT_EQ(grid_coll.bin_storage().entries.size(), 17u);
+
+    // Same bin content as the single grids
+    for (const auto& [gr, ref_bins] :
+         {std::make_pair(grid_coll[0], &bins_0),
+          std::make_pair(grid_coll[1], &bins_1)}) {
+        ASSERT_EQ(gr.nbins(), ref_bins->size());
+        for (dindex gbin = 0u; gbin < gr.nbins(); ++gbin) {
+            const auto bin = gr.bin(gbin);
+            const auto& ref_bin = (*ref_bins)[gbin];
+            ASSERT_EQ(bin.size(), ref_bin.size());
+            EXPECT_TRUE(std::equal(bin.begin(), bin.end(), ref_bin.begin()));
+        }
+    }
+
+    // Neighborhood lookup in the second grid, wrapping around in phi
+    const std::array<dindex, 2> search_window{1u, 1u};
+    const typename grid_t::point_type p{15.f, -3.f};
+
+    std::vector<dindex> expected{5u, 6u, 7u, 8u, 9u, 13u, 14u, 15u};
+    std::vector<dindex> entries{};
+    for (const dindex e : grid_coll[1].search(p, search_window)) {
+        entries.push_back(e);
+    }
+    std::sort(entries.begin(), entries.end());
+    EXPECT_EQ(entries, expected);
+}
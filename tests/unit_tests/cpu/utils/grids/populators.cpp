@@ -18,6 +18,8 @@
 // System include(s)
 #include <algorithm>
 #include <climits>
+#include <thread>
+#include <vector>
 
 using namespace detray;
 
@@ -235,3 +237,43 @@ GTEST_TEST(detray_grid, regular_attach_populator) {
     stored = {50u, 6u, 7u, 8u};
     test_content(bin_data[49], stored);
 }
+
+/// Atomic attach populator, called from several threads
+GTEST_TEST(detray_grid, atomic_attach_populator) {
+    detray::atomic_attach attacher{};
+
+    constexpr unsigned int n_threads{5u};
+
+    // Create some empty bins
+    dvector<bins::static_array<dindex, 4>> bin_data(50);
+
+    // Every thread adds its index to every bin, one more than fits
+    std::vector<std::thread> threads{};
+    for (unsigned int t = 0u; t < n_threads; ++t) {
+        threads.emplace_back([&bin_data, t]() {
+            for (auto& bin : bin_data) {
+                bin.atomic_push_back(t);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Every bin is full, the order of the entries depends on the threads
+    for (auto& bin : bin_data) {
+        ASSERT_EQ(bin.size(), 4u);
+        detray::detail::sequential_sort(bin.begin(), bin.end());
+        ASSERT_TRUE(std::is_sorted(bin.begin(), bin.end()));
+        ASSERT_TRUE(std::adjacent_find(bin.begin(), bin.end()) == bin.end());
+    }
+
+    // Fill the last slot of a bin with the populator
+    bin_data[0].init(1u);
+    attacher(bin_data[0], 2u);
+    attacher(bin_data[0], 3u);
+    attacher(bin_data[0], 4u);
+
+    dvector<dindex> stored = {1u, 2u, 3u, 4u};
+    test_content(bin_data[0], stored);
+}
@@ -23,6 +23,7 @@
 
 // System inculde(s)
 #include <climits>
+#include <vector>
 
 using namespace detray;
 using namespace detray::axis;
@@ -108,3 +109,96 @@ GTEST_TEST(detray_grid, serializer3D) {
     expected_mbin = {1u, 1u, 1u};
     EXPECT_EQ(serializer(axes, 13u), expected_mbin);
 }
+
+GTEST_TEST(detray_grid, morton_serializer2D) {
+
+    // Offsets into edges container and #bins for all axes
+    vecmem::vector<dindex_range> edge_ranges = {{0u, 6u}, {2u, 12u}};
+    // Not needed for serializer test
+    vecmem::vector<scalar> bin_edges{};
+
+    polar_axes axes(std::move(edge_ranges), std::move(bin_edges));
+
+    morton_serializer<2> serializer{};
+
+    // Serializing: The first 4x4 cell is complete
+    multi_bin<2> mbin{0u, 0u};
+    EXPECT_EQ(serializer(axes, mbin), 0u);
+    mbin = {1u, 0u};
+    EXPECT_EQ(serializer(axes, mbin), 1u);
+    mbin = {0u, 1u};
+    EXPECT_EQ(serializer(axes, mbin), 2u);
+    mbin = {3u, 3u};
+    EXPECT_EQ(serializer(axes, mbin), 15u);
+    // The next cell only contains two bins on the first axis
+    mbin = {4u, 0u};
+    EXPECT_EQ(serializer(axes, mbin), 16u);
+    mbin = {5u, 3u};
+    EXPECT_EQ(serializer(axes, mbin), 23u);
+    mbin = {0u, 4u};
+    EXPECT_EQ(serializer(axes, mbin), 24u);
+
+    // Deserialize
+    multi_bin<2> expected_mbin{0u, 0u};
+    EXPECT_EQ(serializer(axes, 0u), expected_mbin);
+    expected_mbin = {0u, 1u};
+    EXPECT_EQ(serializer(axes, 2u), expected_mbin);
+    expected_mbin = {5u, 3u};
+    EXPECT_EQ(serializer(axes, 23u), expected_mbin);
+    expected_mbin = {0u, 4u};
+    EXPECT_EQ(serializer(axes, 24u), expected_mbin);
+
+    // The serialization is a bijection onto the global bin indices
+    const dindex n_bins{axes.nbins()};
+    std::vector<bool> is_filled(n_bins, false);
+    for (dindex i = 0u; i < 6u; ++i) {
+        for (dindex j = 0u; j < 12u; ++j) {
+            mbin = {i, j};
+            const dindex gbin{serializer(axes, mbin)};
+            ASSERT_TRUE(gbin < n_bins);
+            EXPECT_FALSE(is_filled[gbin]);
+            is_filled[gbin] = true;
+            EXPECT_EQ(serializer(axes, gbin), mbin);
+        }
+    }
+}
+
+GTEST_TEST(detray_grid, morton_serializer3D) {
+
+    // Offsets into edges container and #bins for all axes
+    vecmem::vector<dindex_range> edge_ranges = {{0u, 3u}, {2u, 5u}, {4u, 2u}};
+    // Not needed for serializer test
+    vecmem::vector<scalar> bin_edges{};
+
+    cylinder_axes axes(std::move(edge_ranges), std::move(bin_edges));
+
+    morton_serializer<3> serializer{};
+
+    // Serializing
+    multi_bin<3> mbin{0u, 0u, 0u};
+    EXPECT_EQ(serializer(axes, mbin), 0u);
+    mbin = {1u, 0u, 0u};
+    EXPECT_EQ(serializer(axes, mbin), 1u);
+    mbin = {0u, 1u, 0u};
+    EXPECT_EQ(serializer(axes, mbin), 2u);
+    mbin = {0u, 0u, 1u};
+    EXPECT_EQ(serializer(axes, mbin), 4u);
+    mbin = {1u, 1u, 1u};
+    EXPECT_EQ(serializer(axes, mbin), 7u);
+
+    // The serialization is a bijection onto the global bin indices
+    const dindex n_bins{axes.nbins()};
+    std::vector<bool> is_filled(n_bins, false);
+    for (dindex i = 0u; i < 3u; ++i) {
+        for (dindex j = 0u; j < 5u; ++j) {
+            for (dindex k = 0u; k < 2u; ++k) {
+                mbin = {i, j, k};
+                const dindex gbin{serializer(axes, mbin)};
+                ASSERT_TRUE(gbin < n_bins);
+                EXPECT_FALSE(is_filled[gbin]);
+                is_filled[gbin] = true;
+                EXPECT_EQ(serializer(axes, gbin), mbin);
+            }
+        }
+    }
+}
@@ -0,0 +1,87 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/utils/memory_report.hpp"
+
+#include "detray/detectors/build_toy_detector.hpp"
+#include "detray/test/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <algorithm>
+#include <string>
+
+using namespace detray;
+
+/// Test the memory report of the toy detector
+GTEST_TEST(detray_utils, memory_report) {
+
+    vecmem::host_memory_resource host_mr;
+    toy_det_config<test::scalar> toy_cfg{};
+    toy_cfg.n_edc_layers(2u);
+    auto [toy_det, names] = build_toy_detector(host_mr, toy_cfg);
+
+    using detector_t = decltype(toy_det);
+    using volume_t = typename detector_t::volume_type;
+    using mask_id = typename detector_t::masks::id;
+
+    const memory_report report = get_memory_report(toy_det);
+
+    // One entry per volume, surface, transform store and volume finder, and
+    // one entry per collection in the mask, material and accelerator stores
+    const std::size_t n_entries{
+        4u + detector_t::mask_container::n_collections() +
+        detector_t::material_container::n_collections() +
+        detector_t::accelerator_container::n_collections()};
+    ASSERT_EQ(report.entries.size(), n_entries);
+
+    const auto find_entry = [&report](const std::string &name) {
+        return std::find_if(
+            report.entries.begin(), report.entries.end(),
+            [&name](const memory_report::entry &e) { return e.name == name; });
+    };
+
+    // Volume descriptors
+    const auto vol_entry = find_entry("volumes");
+    ASSERT_NE(vol_entry, report.entries.end());
+    EXPECT_EQ(vol_entry->usage.n_containers, 1u);
+    EXPECT_EQ(vol_entry->usage.bytes,
+              toy_det.volumes().size() * sizeof(volume_t));
+
+    // Rectangle masks of the sensitive modules
+    const auto &rectangles =
+        toy_det.mask_store().template get<mask_id::e_rectangle2>();
+    const auto rect_entry = find_entry("masks/rectangle2D");
+    ASSERT_NE(rect_entry, report.entries.end());
+    EXPECT_EQ(rect_entry->usage.bytes,
+              rectangles.size() * sizeof(rectangles.front()));
+
+    // The bin slack is part of the data
+    for (const auto &e : report.entries) {
+        EXPECT_LE(e.usage.bin_slack_bytes, e.usage.bytes) << e.name;
+    }
+
+    // The total is the sum of the entries
+    std::size_t total_bytes{0u};
+    for (const auto &e : report.entries) {
+        total_bytes += e.usage.bytes;
+    }
+    EXPECT_EQ(report.total().bytes, total_bytes);
+    EXPECT_GT(total_bytes, 0u);
+
+    // The printout contains every store
+    const std::string table{report.to_string()};
+    for (const auto &e : report.entries) {
+        EXPECT_NE(table.find(e.name), std::string::npos) << e.name;
+    }
+}
@@ -0,0 +1,130 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "detray/utils/parallel_algorithms.hpp"
+
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/utils/ranges.hpp"
+
+// Google Test include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+const execution::host_threads_policy host_threads{4u, 16u};
+
+}  // anonymous namespace
+
+// Test the range algorithms with the different execution policies
+GTEST_TEST(detray_utils, parallel_for_each) {
+
+    std::vector<dindex> seq(1000u);
+    std::iota(seq.begin(), seq.end(), 0u);
+
+    std::atomic<dindex> sum{0u};
+    auto add = [&sum](const dindex i) { sum += i; };
+
+    detray::ranges::for_each(execution::seq, seq, add);
+    ASSERT_EQ(sum.load(), 499500u);
+
+    sum = 0u;
+    detray::ranges::for_each(host_threads, seq, add);
+    ASSERT_EQ(sum.load(), 499500u);
+
+    // Elements can be modified
+    detray::ranges::for_each(host_threads, seq, [](dindex &i) { i *= 2u; });
+    ASSERT_EQ(seq[10], 20u);
+    ASSERT_EQ(seq[999], 1998u);
+
+    // The error of the lowest index is rethrown
+    try {
+        detray::ranges::for_each(host_threads, seq, [](const dindex i) {
+            if (i % 200u == 100u) {
+                throw std::invalid_argument(std::to_string(i));
+            }
+        });
+        FAIL() << "Expected an exception";
+    } catch (const std::invalid_argument &err) {
+        EXPECT_EQ(std::string(err.what()), "100");
+    }
+}
+
+GTEST_TEST(detray_utils, parallel_transform) {
+
+    dvector<dindex> interval_1 = {2u, 3u, 4u};
+    dvector<dindex> interval_2 = {7u, 8u, 9u};
+    dvector<dvector<dindex>> intervals{interval_1, interval_2};
+    const auto joined = detray::views::join(intervals);
+
+    std::vector<dindex> reference = {4u, 6u, 8u, 14u, 16u, 18u};
+    std::vector<dindex> check(joined.size(), 0u);
+    auto twice = [](const dindex i) { return 2u * i; };
+
+    detray::ranges::transform(execution::seq, joined, check, twice);
+    ASSERT_EQ(check, reference);
+
+    std::fill(check.begin(), check.end(), 0u);
+    detray::ranges::transform(host_threads, joined, check, twice);
+    ASSERT_EQ(check, reference);
+
+    // Reduction
+    auto max_value = [](const dindex a, const dindex b) {
+        return std::max(a, b);
+    };
+    EXPECT_EQ(detray::ranges::transform_reduce(execution::seq, joined, 0u,
+                                               max_value, twice),
+              18u);
+    EXPECT_EQ(detray::ranges::transform_reduce(host_threads, joined, 0u,
+                                               max_value, twice),
+              18u);
+
+    std::vector<dindex> seq(1000u);
+    std::iota(seq.begin(), seq.end(), 0u);
+    EXPECT_EQ(detray::ranges::transform_reduce(host_threads, seq, 1u,
+                                               std::plus<>{}, twice),
+              999001u);
+}
+
+GTEST_TEST(detray_utils, parallel_sort) {
+
+    std::vector<dindex> reference(1001u);
+    std::iota(reference.begin(), reference.end(), 0u);
+
+    // Scrambled sequence
+    std::vector<dindex> vec(reference.size());
+    for (std::size_t i = 0u; i < vec.size(); ++i) {
+        vec[i] = static_cast<dindex>((i * 367u) % vec.size());
+    }
+
+    std::vector<dindex> check{vec};
+    detray::ranges::sort(execution::seq, check);
+    ASSERT_EQ(check, reference);
+
+    check = vec;
+    detray::ranges::sort(host_threads, check);
+    ASSERT_EQ(check, reference);
+
+    // Custom comparison on an uneven number of parts
+    check = vec;
+    detray::ranges::sort(execution::host_threads_policy{3u, 1u}, check,
+                         std::greater<>{});
+    std::reverse(check.begin(), check.end());
+    ASSERT_EQ(check, reference);
+}
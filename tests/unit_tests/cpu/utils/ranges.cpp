@@ -510,6 +510,47 @@ GTEST_TEST(detray_utils, ranges_static_join) {
     ASSERT_EQ(check, reference);
 }
 
+// Unittest for the span-wise iteration of (joined) ranges
+GTEST_TEST(detray_utils, ranges_for_each) {
+
+    dvector<dindex> interval_0 = {};
+    dvector<dindex> interval_1 = {2u, 3u, 4u};
+    dvector<dindex> interval_2 = {7u, 8u, 9u};
+    dvector<dindex> interval_3 = {10u, 11u, 12u, 13u};
+    dvector<dvector<dindex>> intervals{interval_0, interval_1, interval_0,
+                                       interval_2, interval_3, interval_0};
+
+    std::vector<dindex> reference = {};
+    std::vector<dindex> check = {};
+    auto collect = [&check](const dindex i) { check.push_back(i); };
+
+    // Join
+    auto joined = detray::views::join(intervals);
+    for (const auto j : joined) {
+        reference.push_back(j);
+    }
+    detray::ranges::for_each(joined, collect);
+    ASSERT_EQ(check.size(), 10u);
+    ASSERT_EQ(check, reference);
+
+    // Static join
+    reference.clear();
+    check.clear();
+    auto static_joined = detray::views::static_join(interval_1, interval_2);
+    for (const auto j : static_joined) {
+        reference.push_back(j);
+    }
+    detray::ranges::for_each(static_joined, collect);
+    ASSERT_EQ(check.size(), 6u);
+    ASSERT_EQ(check, reference);
+
+    // Generic range
+    check.clear();
+    detray::ranges::for_each(detray::views::iota(dindex_range{2u, 5u}),
+                             collect);
+    ASSERT_EQ(check, std::vector<dindex>({2u, 3u, 4u}));
+}
+
 // Unittest for the subrange implementation
 GTEST_TEST(detray_utils, ranges_subrange) {
 
@@ -0,0 +1,97 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// detray test
+#include "detray/test/utils/record_writer.hpp"
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace detray;
+
+// Write records in csv format
+GTEST_TEST(detray_utils, record_writer_csv) {
+
+    const std::string file_name{"record_writer_test.csv"};
+    {
+        // Small chunks: Several hand-overs to the writer thread
+        test::record_writer writer{file_name, {"index", "x"},
+                                   test::record_format::csv, 3u};
+        EXPECT_EQ(writer.n_columns(), 2u);
+        for (unsigned int i = 0u; i < 10u; ++i) {
+            writer.append(i, 0.5f * static_cast<float>(i));
+        }
+        EXPECT_THROW(writer.append(1, 2, 3), std::invalid_argument);
+    }
+
+    std::ifstream file{file_name};
+    std::string line;
+    std::getline(file, line);
+    EXPECT_EQ(line, "index,x");
+    for (unsigned int i = 0u; i < 10u; ++i) {
+        ASSERT_TRUE(std::getline(file, line));
+        std::stringstream expected;
+        expected << i << "," << 0.5 * i;
+        EXPECT_EQ(line, expected.str());
+    }
+    EXPECT_FALSE(std::getline(file, line));
+
+    std::remove(file_name.c_str());
+}
+
+// Write records in the binary columnar format
+GTEST_TEST(detray_utils, record_writer_columnar) {
+
+    const std::string file_name{"record_writer_test.bin"};
+    {
+        test::record_writer writer{file_name, {"a", "bc"},
+                                   test::record_format::columnar, 4u};
+        for (int i = 0; i < 6; ++i) {
+            writer.append(i, -i);
+        }
+        writer.flush();
+    }
+
+    std::ifstream file{file_name, std::ios_base::binary};
+    auto read_u64 = [&file]() {
+        std::uint64_t v{0u};
+        file.read(reinterpret_cast<char*>(&v), sizeof(v));
+        return v;
+    };
+
+    ASSERT_EQ(read_u64(), 2u);
+    for (const std::string name : {"a", "bc"}) {
+        std::string col(read_u64(), ' ');
+        file.read(col.data(), static_cast<std::streamsize>(col.size()));
+        EXPECT_EQ(col, name);
+    }
+
+    // Two chunks: 4 + 2 rows
+    int row{0};
+    for (const std::uint64_t n_rows : {4u, 2u}) {
+        ASSERT_EQ(read_u64(), n_rows);
+        std::vector<double> values(2u * n_rows);
+        file.read(reinterpret_cast<char*>(values.data()),
+                  static_cast<std::streamsize>(values.size() * sizeof(double)));
+        for (std::size_t i = 0u; i < n_rows; ++i) {
+            EXPECT_EQ(values[i], row + static_cast<int>(i));
+            EXPECT_EQ(values[n_rows + i], -(row + static_cast<int>(i)));
+        }
+        row += static_cast<int>(n_rows);
+    }
+    EXPECT_EQ(file.peek(), std::char_traits<char>::eof());
+
+    std::remove(file_name.c_str());
+}
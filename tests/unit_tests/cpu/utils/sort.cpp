@@ -8,9 +8,18 @@
 // Project include(s).
 #include "detray/utils/sort.hpp"
 
+#include "detray/definitions/detail/algorithms.hpp"
+
 // Google Test include(s).
 #include <gtest/gtest.h>
 
+// System include(s).
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <vector>
+
 // Test sort functions
 GTEST_TEST(detray_utils, insertion_sort) {
 
@@ -31,3 +40,97 @@ GTEST_TEST(detray_utils, selection_sort) {
 
     ASSERT_EQ(vec, vec_sorted);
 }
+
+GTEST_TEST(detray_utils, partial_selection_sort) {
+
+    std::vector<double> vec = {4.1, 5., 1.2, 9., 1.4};
+    std::vector<double> vec_sorted = {1.2, 1.4, 4.1};
+
+    detray::partial_selection_sort(vec.begin(), vec.begin() + 3, vec.end());
+
+    ASSERT_EQ(std::vector<double>(vec.begin(), vec.begin() + 3), vec_sorted);
+    // The remaining elements are the two largest ones
+    ASSERT_TRUE(vec[3] >= 5. and vec[4] >= 5.);
+}
+
+GTEST_TEST(detray_utils, linear_insertion_sort) {
+
+    std::vector<double> vec = {4.1, 5., 1.2, 1.4, 9.};
+    std::vector<double> vec_sorted = {1.2, 1.4, 4.1, 5., 9.};
+
+    detray::linear_insertion_sort(vec.begin(), vec.end());
+
+    ASSERT_EQ(vec, vec_sorted);
+
+    detray::linear_insertion_sort(vec.begin(), vec.end(), std::greater<>{});
+    std::reverse(vec_sorted.begin(), vec_sorted.end());
+
+    ASSERT_EQ(vec, vec_sorted);
+}
+
+// Every permutation of up to eight elements is sorted by the networks
+GTEST_TEST(detray_utils, sorting_network) {
+
+    for (int n = 0; n <= 8; ++n) {
+        std::vector<int> perm(static_cast<std::size_t>(n));
+        std::iota(perm.begin(), perm.end(), 0);
+        const std::vector<int> sorted{perm};
+
+        do {
+            std::vector<int> vec{perm};
+            ASSERT_TRUE(detray::sorting_network(vec.begin(), vec.end()));
+            ASSERT_EQ(vec, sorted);
+        } while (std::next_permutation(perm.begin(), perm.end()));
+    }
+
+    // Too large for a network
+    std::vector<int> vec = {9, 8, 7, 6, 5, 4, 3, 2, 1};
+    const std::vector<int> unsorted{vec};
+    ASSERT_FALSE(detray::sorting_network(vec.begin(), vec.end()));
+    ASSERT_EQ(vec, unsorted);
+}
+
+GTEST_TEST(detray_utils, count_descents) {
+
+    std::vector<double> vec = {1.2, 1.4, 4.1, 5., 9.};
+    ASSERT_EQ(detray::count_descents(vec.begin(), vec.end()), 0);
+
+    vec = {4.1, 5., 1.2, 9., 1.4};
+    ASSERT_EQ(detray::count_descents(vec.begin(), vec.end()), 2);
+}
+
+// Random, almost sorted and reversed ranges of different sizes
+GTEST_TEST(detray_utils, adaptive_sort) {
+
+    std::mt19937 gen(42u);
+    std::uniform_real_distribution<float> dist(-10.f, 100.f);
+
+    for (std::size_t n : {0u, 1u, 2u, 5u, 8u, 9u, 16u, 17u, 30u, 50u, 200u}) {
+        std::vector<float> vec(n);
+        std::generate(vec.begin(), vec.end(), [&]() { return dist(gen); });
+
+        std::vector<float> vec_sorted{vec};
+        std::sort(vec_sorted.begin(), vec_sorted.end());
+
+        // Random order
+        std::vector<float> res{vec};
+        detray::detail::adaptive_sort(res.begin(), res.end());
+        ASSERT_EQ(res, vec_sorted) << "n = " << n;
+
+        // Almost sorted
+        res = vec_sorted;
+        if (n > 3u) {
+            std::swap(res[1], res[2]);
+            std::swap(res[n - 1u], res[n - 2u]);
+        }
+        detray::detail::adaptive_sort(res.begin(), res.end());
+        ASSERT_EQ(res, vec_sorted) << "n = " << n;
+
+        // Reversed, with a custom comparison
+        res = vec_sorted;
+        detray::detail::adaptive_sort(res.begin(), res.end(),
+                                      std::greater<>{});
+        std::reverse(res.begin(), res.end());
+        ASSERT_EQ(res, vec_sorted) << "n = " << n;
+    }
+}
@@ -7,6 +7,7 @@
 
 // Project include(s)
 #include "detector_cuda_kernel.hpp"
+#include "detray/core/detector_upload.hpp"
 #include "detray/detectors/build_toy_detector.hpp"
 
 // Vecmem include(s)
@@ -15,6 +16,7 @@
 #include <vecmem/memory/host_memory_resource.hpp>
 #include <vecmem/utils/cuda/async_copy.hpp>
 #include <vecmem/utils/cuda/copy.hpp>
+#include <vecmem/utils/cuda/stream_wrapper.hpp>
 
 // Google Test include(s)
 #include <gtest/gtest.h>
@@ -96,3 +98,76 @@ TEST(detector_cuda, detector) {
         EXPECT_EQ(cylinders_host[i] == cylinders_device[i], true);
     }
 }
+
+TEST(detector_cuda, detector_upload_async) {
+    // memory resources
+    vecmem::host_memory_resource host_mr;
+    vecmem::cuda::managed_memory_resource mng_mr;
+    vecmem::cuda::device_memory_resource dev_mr;
+
+    vecmem::cuda::stream_wrapper stream;
+    vecmem::cuda::async_copy cuda_cpy{stream};
+
+    // create toy geometry in host memory
+    auto [toy_det, names] = build_toy_detector(host_mr);
+
+    auto ctx0 = typename detector_host_t::geometry_context();
+
+    auto& volumes_host = toy_det.volumes();
+    auto& surfaces_host = toy_det.surfaces();
+    auto& transforms_host = toy_det.transform_store();
+    auto& masks_host = toy_det.mask_store();
+    auto& discs_host = masks_host.get<disc_id>();
+    auto& cylinders_host = masks_host.get<cylinder_id>();
+    auto& rectangles_host = masks_host.get<rectangle_id>();
+
+    // Enqueue the upload
+    auto upload = detray::upload_async(toy_det, dev_mr, cuda_cpy);
+
+    // The geometry is uploaded first
+    ASSERT_FALSE(upload.events[upload_stage::e_geometry].empty());
+    ASSERT_FALSE(upload.events[upload_stage::e_material].empty());
+
+    // copied outpus from device side
+    vecmem::vector<det_volume_t> volumes_device(volumes_host.size(), &mng_mr);
+    vecmem::vector<det_surface_t> surfaces_device(surfaces_host.size(),
+                                                  &mng_mr);
+    vecmem::vector<transform_t> transforms_device(transforms_host.size(),
+                                                  &mng_mr);
+    vecmem::vector<rectangle_t> rectangles_device(rectangles_host.size(),
+                                                  &mng_mr);
+    vecmem::vector<disc_t> discs_device(discs_host.size(), &mng_mr);
+    vecmem::vector<cylinder_t> cylinders_device(cylinders_host.size(), &mng_mr);
+
+    // The test kernel only needs the geometry
+    upload.events.wait(upload_stage::e_geometry);
+
+    detector_test(detray::get_data(upload.buffer),
+                  vecmem::get_data(volumes_device),
+                  vecmem::get_data(surfaces_device),
+                  vecmem::get_data(transforms_device),
+                  vecmem::get_data(rectangles_device),
+                  vecmem::get_data(discs_device),
+                  vecmem::get_data(cylinders_device));
+
+    upload.events.wait();
+
+    for (unsigned int i = 0u; i < volumes_host.size(); i++) {
+        EXPECT_EQ(volumes_host[i] == volumes_device[i], true);
+    }
+    for (unsigned int i = 0u; i < surfaces_host.size(); i++) {
+        EXPECT_EQ(surfaces_device[i] == surfaces_host[i], true);
+    }
+    for (unsigned int i = 0u; i < transforms_host.size(ctx0); i++) {
+        EXPECT_EQ(transforms_host.at(i, ctx0) == transforms_device[i], true);
+    }
+    for (unsigned int i = 0u; i < rectangles_host.size(); i++) {
+        EXPECT_EQ(rectangles_host[i] == rectangles_device[i], true);
+    }
+    for (unsigned int i = 0u; i < discs_host.size(); i++) {
+        EXPECT_EQ(discs_host[i] == discs_device[i], true);
+    }
+    for (unsigned int i = 0u; i < cylinders_host.size(); i++) {
+        EXPECT_EQ(cylinders_host[i] == cylinders_device[i], true);
+    }
+}
@@ -112,9 +112,9 @@ TEST(navigator_cuda, navigator) {
     // Get tracks data
     auto tracks_data = vecmem::get_data(tracks_device);
 
-    // Create navigator candidates buffer
-    auto candidates_buffer =
-        create_candidates_buffer(det, theta_steps * phi_steps, dev_mr, &mng_mr);
+    // Create navigator candidates buffer for the search window of the config
+    auto candidates_buffer = create_candidates_buffer(
+        det, theta_steps * phi_steps, cfg, dev_mr, &mng_mr);
     copy.setup(candidates_buffer);
 
     // Run navigator test
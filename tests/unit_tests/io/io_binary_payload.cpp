@@ -0,0 +1,267 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/definitions/geometry.hpp"
+#include "detray/definitions/grid_axis.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/io/binary/binary_io.hpp"
+#include "detray/io/binary/binary_reader.hpp"
+#include "detray/io/binary/binary_writer.hpp"
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+
+/// Write @param in to a binary stream and read it back into @param out
+template <typename payload_t>
+void binary_roundtrip(const payload_t& in, payload_t& out) {
+    std::stringstream ss{std::ios_base::in | std::ios_base::out |
+                         std::ios_base::binary};
+    detray::io::to_binary(ss, in);
+    detray::io::from_binary(ss, out);
+
+    // The full record was consumed
+    EXPECT_EQ(ss.peek(), std::char_traits<char>::eof());
+}
+
+}  // anonymous namespace
+
+/// This tests the binary io for the file header, including the preamble
+GTEST_TEST(io, binary_header_payload) {
+
+    detray::io::geo_header_payload h;
+    h.common.version = "v0.0.1";
+    h.common.detector = "test_detector";
+    h.common.tag = "geometry";
+    h.common.date = "01.01.2024";
+    h.sub_header.emplace();
+    h.sub_header->n_volumes = 2u;
+    h.sub_header->n_surfaces = 42u;
+
+    std::stringstream ss{std::ios_base::in | std::ios_base::out |
+                         std::ios_base::binary};
+    detray::io::detail::write_binary_header(ss, h);
+    detray::io::to_binary(ss, std::uint32_t{7u});
+
+    // Peek at the common header and skip the sub-header
+    detray::io::common_header_payload ph =
+        detray::io::detail::read_binary_header(ss);
+
+    EXPECT_EQ(h.common.version, ph.version);
+    EXPECT_EQ(h.common.detector, ph.detector);
+    EXPECT_EQ(h.common.tag, ph.tag);
+    EXPECT_EQ(h.common.date, ph.date);
+
+    std::uint32_t data{0u};
+    detray::io::from_binary(ss, data);
+    EXPECT_EQ(data, 7u);
+
+    // Wrong file type
+    std::stringstream bad{"DTRJ", std::ios_base::in | std::ios_base::binary};
+    EXPECT_THROW(detray::io::detail::read_binary_header(bad),
+                 std::invalid_argument);
+}
+
+/// This tests the little-endian encoding of arithmetic values
+GTEST_TEST(io, binary_value_encoding) {
+
+    std::stringstream ss{std::ios_base::in | std::ios_base::out |
+                         std::ios_base::binary};
+    detray::io::to_binary(ss, std::uint32_t{0x04030201u});
+
+    const std::string bytes{ss.str()};
+    ASSERT_EQ(bytes.size(), 4u);
+    EXPECT_EQ(bytes[0], 1);
+    EXPECT_EQ(bytes[1], 2);
+    EXPECT_EQ(bytes[2], 3);
+    EXPECT_EQ(bytes[3], 4);
+
+    // Truncated record
+    std::uint64_t v{0u};
+    EXPECT_THROW(detray::io::from_binary(ss, v), std::runtime_error);
+}
+
+/// This tests the binary io for a surface
+GTEST_TEST(io, binary_surface_payload) {
+
+    detray::io::surface_payload s;
+    s.index_in_coll = 5u;
+    s.transform.tr = {100.f, 200.f, 300.f};
+    s.transform.rot = {1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 1.f};
+    s.mask.shape = detray::io::shape_id::trapezoid2;
+    s.mask.volume_link.link = 1u;
+    s.mask.boundaries = {10.f, 20.f, 30.f, 1.f / 60.f};
+    s.material = detray::io::material_link_payload{
+        detray::io::material_id::slab, 3u};
+    s.source = 123456789u;
+    s.barcode = std::nullopt;
+    s.type = detray::surface_id::e_portal;
+
+    detray::io::surface_payload ps;
+    binary_roundtrip(s, ps);
+
+    EXPECT_EQ(s.index_in_coll, ps.index_in_coll);
+    EXPECT_EQ(s.transform.tr, ps.transform.tr);
+    EXPECT_EQ(s.transform.rot, ps.transform.rot);
+    EXPECT_EQ(s.mask.shape, ps.mask.shape);
+    EXPECT_EQ(s.mask.volume_link.link, ps.mask.volume_link.link);
+    EXPECT_EQ(s.mask.boundaries, ps.mask.boundaries);
+    ASSERT_TRUE(ps.material.has_value());
+    EXPECT_EQ(s.material->type, ps.material->type);
+    EXPECT_EQ(s.material->index, ps.material->index);
+    EXPECT_EQ(s.source, ps.source);
+    EXPECT_FALSE(ps.barcode.has_value());
+    EXPECT_EQ(s.type, ps.type);
+}
+
+/// This tests the binary io for a material slab
+GTEST_TEST(io, binary_material_slab_payload) {
+
+    detray::io::material_slab_payload m;
+    m.type = detray::io::material_id::slab;
+    m.surface.link = 2u;
+    m.thickness = 1.5;
+    m.mat.params = {1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f};
+
+    detray::io::material_slab_payload pm;
+    binary_roundtrip(m, pm);
+
+    EXPECT_EQ(m.type, pm.type);
+    EXPECT_FALSE(pm.index_in_coll.has_value());
+    EXPECT_EQ(m.surface.link, pm.surface.link);
+    EXPECT_EQ(m.thickness, pm.thickness);
+    EXPECT_EQ(m.mat.params, pm.mat.params);
+}
+
+/// This tests the binary io for a collection of grids
+GTEST_TEST(io, binary_grids_payload) {
+
+    detray::io::axis_payload a;
+    a.binning = detray::axis::binning::e_regular;
+    a.bounds = detray::axis::bounds::e_circular;
+    a.label = detray::axis::label::e_phi;
+    a.edges = {-detray::constant<detray::real_io>::pi,
+               detray::constant<detray::real_io>::pi};
+    a.bins = 10u;
+
+    detray::io::grid_payload<> g;
+    g.owner_link.link = 4u;
+    g.grid_link = {detray::io::accel_id::polar2_grid, 0u};
+    g.axes = {a, a};
+    g.bins.push_back({{0u, 1u}, {1u, 2u, 3u}});
+    g.bins.push_back({{2u, 3u}, {}});
+
+    detray::io::detector_grids_payload<> d;
+    d.grids[0u] = {g};
+    d.grids[3u] = {g, g};
+
+    detray::io::detector_grids_payload<> pd;
+    binary_roundtrip(d, pd);
+
+    ASSERT_EQ(pd.grids.size(), 2u);
+    ASSERT_EQ(pd.grids.at(3u).size(), 2u);
+
+    const auto& pg = pd.grids.at(3u).back();
+    EXPECT_EQ(pg.owner_link.link, g.owner_link.link);
+    EXPECT_EQ(pg.grid_link.type, g.grid_link.type);
+    EXPECT_EQ(pg.grid_link.index, g.grid_link.index);
+    ASSERT_EQ(pg.axes.size(), 2u);
+    EXPECT_EQ(pg.axes[1].binning, a.binning);
+    EXPECT_EQ(pg.axes[1].bounds, a.bounds);
+    EXPECT_EQ(pg.axes[1].label, a.label);
+    EXPECT_EQ(pg.axes[1].bins, a.bins);
+    EXPECT_EQ(pg.axes[1].edges, a.edges);
+    ASSERT_EQ(pg.bins.size(), 2u);
+    EXPECT_EQ(pg.bins[0].loc_index, g.bins[0].loc_index);
+    EXPECT_EQ(pg.bins[0].content, g.bins[0].content);
+    EXPECT_TRUE(pg.bins[1].content.empty());
+    EXPECT_FALSE(pg.transform.has_value());
+
+    // Only read the grids of the selected volumes
+    std::stringstream ss{std::ios_base::in | std::ios_base::out |
+                         std::ios_base::binary};
+    detray::io::to_binary(ss, d);
+    detray::io::to_binary(ss, std::uint32_t{7u});
+
+    detray::io::detector_grids_payload<> sd;
+    detray::io::from_binary(ss, sd,
+                            [](std::size_t vol_idx) { return vol_idx == 3u; });
+
+    ASSERT_EQ(sd.grids.size(), 1u);
+    EXPECT_EQ(sd.grids.at(3u).size(), 2u);
+
+    // The stream is positioned after the grid collection
+    std::uint32_t data{0u};
+    detray::io::from_binary(ss, data);
+    EXPECT_EQ(data, 7u);
+}
+
+/// This tests the compression of the grid bins
+GTEST_TEST(io, binary_grid_bin_compression) {
+
+    // Surface grid bins: Decreasing local indices and content
+    std::vector<detray::io::grid_bin_payload<std::size_t>> sf_bins;
+    sf_bins.push_back({{5u, 1000u}, {300u, 12u, 4000000000u}});
+    sf_bins.push_back({{6u, 1000u}, {300u, 12u, 4000000000u}});
+    sf_bins.push_back({{0u, 999u}, {}});
+    sf_bins.push_back({{1u, 999u}, {7u}});
+
+    std::vector<detray::io::grid_bin_payload<std::size_t>> p_sf_bins;
+    binary_roundtrip(sf_bins, p_sf_bins);
+
+    ASSERT_EQ(p_sf_bins.size(), sf_bins.size());
+    for (std::size_t i = 0u; i < sf_bins.size(); ++i) {
+        EXPECT_EQ(p_sf_bins[i].loc_index, sf_bins[i].loc_index);
+        EXPECT_EQ(p_sf_bins[i].content, sf_bins[i].content);
+    }
+
+    // Material map bins: The same material in neighbouring bins
+    detray::io::material_slab_payload slab;
+    slab.type = detray::io::material_id::slab;
+    slab.surface.link = 2u;
+    slab.thickness = 1.5;
+    slab.mat.params = {1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f};
+
+    std::vector<detray::io::grid_bin_payload<
+        detray::io::material_slab_payload>>
+        mat_bins;
+    for (unsigned int i = 0u; i < 100u; ++i) {
+        mat_bins.push_back({{i % 10u, i / 10u}, {slab}});
+    }
+    mat_bins.back().content.front().thickness = 2.;
+
+    std::stringstream ss{std::ios_base::in | std::ios_base::out |
+                         std::ios_base::binary};
+    detray::io::to_binary(ss, mat_bins);
+
+    // Much smaller than the uncompressed bins
+    std::stringstream ref_ss{std::ios_base::in | std::ios_base::out |
+                             std::ios_base::binary};
+    for (const auto& bin : mat_bins) {
+        detray::io::to_binary(ref_ss, bin);
+    }
+    EXPECT_LT(5u * ss.str().size(), ref_ss.str().size());
+
+    decltype(mat_bins) p_mat_bins;
+    detray::io::from_binary(ss, p_mat_bins);
+
+    ASSERT_EQ(p_mat_bins.size(), mat_bins.size());
+    for (std::size_t i = 0u; i < mat_bins.size(); ++i) {
+        EXPECT_EQ(p_mat_bins[i].loc_index, mat_bins[i].loc_index);
+        ASSERT_EQ(p_mat_bins[i].content.size(), 1u);
+        EXPECT_EQ(p_mat_bins[i].content[0].thickness,
+                  mat_bins[i].content[0].thickness);
+        EXPECT_EQ(p_mat_bins[i].content[0].mat.params,
+                  mat_bins[i].content[0].mat.params);
+    }
+}
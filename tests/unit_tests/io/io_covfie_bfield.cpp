@@ -0,0 +1,104 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/io/covfie/read_bfield.hpp"
+
+// Covfie include(s)
+#include <covfie/core/backend/primitive/array.hpp>
+#include <covfie/core/backend/transformer/strided.hpp>
+#include <covfie/core/field.hpp>
+#include <covfie/core/field_view.hpp>
+#include <covfie/core/vector.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+using namespace detray;
+
+namespace {
+
+using field_t = covfie::field<covfie::backend::strided<
+    covfie::vector::size3,
+    covfie::backend::array<covfie::vector::float3>>>;
+
+}  // namespace
+
+/// Write a field map and read it back with both covfie readers
+GTEST_TEST(io, covfie_bfield_round_trip) {
+
+    const std::string file_name{"io_covfie_bfield_test.cvf"};
+    constexpr unsigned int nx{5u};
+    constexpr unsigned int ny{7u};
+    constexpr unsigned int nz{3u};
+
+    field_t field(covfie::make_parameter_pack(
+        field_t::backend_t::configuration_t{nx, ny, nz}));
+    field_t::view_t view(field);
+
+    for (unsigned int x = 0u; x < nx; ++x) {
+        for (unsigned int y = 0u; y < ny; ++y) {
+            for (unsigned int z = 0u; z < nz; ++z) {
+                view.at(x, y, z) = {static_cast<float>(x) + 0.5f,
+                                    -static_cast<float>(y),
+                                    static_cast<float>(x * y * z)};
+            }
+        }
+    }
+
+    {
+        std::ofstream out_file(file_name, std::ios::out | std::ios::binary);
+        ASSERT_TRUE(out_file.good());
+        field.dump(out_file);
+    }
+
+    ASSERT_TRUE(io::check_covfie_file(file_name));
+
+    const field_t streamed_field = io::read_bfield<field_t>(file_name);
+    const field_t mapped_field = io::read_bfield_via_mmap<field_t>(file_name);
+
+    // The mapping is released, but the field keeps its values
+    std::remove(file_name.c_str());
+
+    const field_t::view_t streamed_view(streamed_field);
+    const field_t::view_t mapped_view(mapped_field);
+
+    for (unsigned int x = 0u; x < nx; ++x) {
+        for (unsigned int y = 0u; y < ny; ++y) {
+            for (unsigned int z = 0u; z < nz; ++z) {
+                for (unsigned int i = 0u; i < 3u; ++i) {
+                    EXPECT_EQ(mapped_view.at(x, y, z)[i],
+                              streamed_view.at(x, y, z)[i]);
+                    EXPECT_EQ(mapped_view.at(x, y, z)[i],
+                              view.at(x, y, z)[i]);
+                }
+            }
+        }
+    }
+}
+
+/// Files that don't hold a covfie field are rejected
+GTEST_TEST(io, covfie_bfield_invalid_file) {
+
+    const std::string file_name{"io_covfie_bfield_invalid.cvf"};
+    {
+        std::ofstream out_file(file_name, std::ios::out | std::ios::binary);
+        out_file << "not a field";
+    }
+
+    EXPECT_THROW(io::read_bfield<field_t>(file_name), std::runtime_error);
+    EXPECT_THROW(io::read_bfield_via_mmap<field_t>(file_name),
+                 std::runtime_error);
+
+    std::remove(file_name.c_str());
+}
@@ -0,0 +1,89 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/io/frontend/detector_cache.hpp"
+
+#include "detray/core/detector.hpp"
+#include "detray/detectors/build_telescope_detector.hpp"
+#include "detray/io/frontend/detector_writer.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace detray;
+
+/// Build a telescope detector through the cache
+GTEST_TEST(io, detector_cache) {
+
+    vecmem::host_memory_resource host_mr;
+
+    mask<rectangle2D> rec2{0u, 100.f, 100.f};
+    tel_det_config<rectangle2D> tel_cfg{rec2};
+    tel_cfg.positions({1.f, 50.f, 100.f, 150.f, 200.f});
+
+    auto [tel_det, tel_names] = build_telescope_detector(host_mr, tel_cfg);
+    using detector_t = decltype(tel_det);
+    using device_detector_t =
+        detector<typename detector_t::metadata, device_container_types>;
+
+    auto writer_cfg = io::detector_writer_config{}
+                          .format(io::format::json)
+                          .replace_files(true);
+    io::write_detector(tel_det, tel_names, writer_cfg);
+
+    io::detector_reader_config reader_cfg{};
+    reader_cfg.add_file("telescope_detector_geometry.json")
+        .add_file("telescope_detector_homogeneous_material.json");
+
+    const std::string cache_dir{"detector_cache"};
+    std::filesystem::remove_all(cache_dir);
+    const io::detector_cache<detector_t> cache{cache_dir};
+
+    // Miss: Read the detector from file and add it to the cache
+    EXPECT_FALSE(cache.contains(reader_cfg));
+    {
+        auto [snap, names] = cache.load(host_mr, reader_cfg);
+        const device_detector_t det(snap.get_view());
+
+        EXPECT_EQ(det.volumes().size(), tel_det.volumes().size());
+        EXPECT_EQ(det.surfaces().size(), tel_det.surfaces().size());
+        EXPECT_EQ(names, tel_names);
+    }
+
+    // Hit: Map the snapshot
+    EXPECT_TRUE(cache.contains(reader_cfg));
+    {
+        auto [snap, names] = cache.load(host_mr, reader_cfg);
+        const device_detector_t det(snap.get_view());
+
+        ASSERT_EQ(det.surfaces().size(), tel_det.surfaces().size());
+        for (unsigned int i = 0u; i < tel_det.surfaces().size(); ++i) {
+            EXPECT_TRUE(det.surfaces()[i] == tel_det.surfaces()[i]);
+        }
+        EXPECT_EQ(names, tel_names);
+    }
+
+    // The key depends on the grid parameters and the file content
+    const std::string key{io::detector_cache<detector_t>::key(reader_cfg)};
+    EXPECT_NE(key, (io::detector_cache<detector_t, 1u>::key(reader_cfg)));
+
+    std::ofstream{"telescope_detector_geometry.json", std::ios_base::app}
+        << " ";
+    EXPECT_NE(key, io::detector_cache<detector_t>::key(reader_cfg));
+    EXPECT_FALSE(cache.contains(reader_cfg));
+
+    std::filesystem::remove_all(cache_dir);
+}
@@ -0,0 +1,86 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/io/frontend/detector_snapshot.hpp"
+
+#include "detray/core/detector.hpp"
+#include "detray/detectors/build_telescope_detector.hpp"
+#include "detray/detectors/build_toy_detector.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+
+using namespace detray;
+
+/// Write the toy detector to a snapshot file and map it back in
+GTEST_TEST(io, detector_snapshot) {
+
+    vecmem::host_memory_resource host_mr;
+    toy_det_config<scalar> toy_cfg{};
+    toy_cfg.use_material_maps(true);
+    auto [toy_det, names] = build_toy_detector(host_mr, toy_cfg);
+
+    using detector_t = decltype(toy_det);
+    using device_detector_t =
+        detector<typename detector_t::metadata, device_container_types>;
+    using mask_id = typename detector_t::masks::id;
+    using material_id = typename detector_t::materials::id;
+
+    const std::string file_name{"toy_detector_snapshot.dsnp"};
+    const std::size_t n_bytes{
+        io::detector_snapshot<detector_t>::write(file_name, toy_det)};
+    EXPECT_EQ(std::filesystem::file_size(file_name), n_bytes);
+
+    {
+        auto snap = io::detector_snapshot<detector_t>::open(file_name);
+        EXPECT_EQ(snap.size(), n_bytes);
+
+        // Read-only view
+        const auto const_view = snap.get_data();
+        EXPECT_EQ(detray::detail::get<0>(const_view.m_view).size(),
+                  toy_det.volumes().size());
+
+        // Detector directly over the mapped file
+        auto view = snap.get_view();
+        const device_detector_t snap_det(view);
+
+        ASSERT_EQ(snap_det.volumes().size(), toy_det.volumes().size());
+        for (unsigned int i = 0u; i < toy_det.volumes().size(); ++i) {
+            EXPECT_TRUE(snap_det.volumes()[i] == toy_det.volumes()[i]);
+        }
+        ASSERT_EQ(snap_det.surfaces().size(), toy_det.surfaces().size());
+        for (unsigned int i = 0u; i < toy_det.surfaces().size(); ++i) {
+            EXPECT_TRUE(snap_det.surfaces()[i] == toy_det.surfaces()[i]);
+        }
+        EXPECT_EQ(snap_det.transform_store().size(),
+                  toy_det.transform_store().size());
+        EXPECT_EQ(
+            snap_det.mask_store().template size<mask_id::e_trapezoid2>(),
+            toy_det.mask_store().template size<mask_id::e_trapezoid2>());
+        constexpr auto cyl_map_id{material_id::e_concentric_cylinder2_map};
+        EXPECT_EQ(snap_det.material_store().template size<cyl_map_id>(),
+                  toy_det.material_store().template size<cyl_map_id>());
+    }
+
+    // Only the same detector type can open the snapshot
+    using tel_detector_t = detector<telescope_metadata<rectangle2D>>;
+    EXPECT_THROW(io::detector_snapshot<tel_detector_t>::open(file_name),
+                 std::runtime_error);
+
+    std::filesystem::remove(file_name);
+    EXPECT_THROW(io::detector_snapshot<detector_t>::open(file_name),
+                 std::runtime_error);
+}
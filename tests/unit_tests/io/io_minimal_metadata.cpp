@@ -0,0 +1,140 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/io/frontend/minimal_metadata.hpp"
+
+#include "detray/core/detail/filtered_store.hpp"
+#include "detray/detectors/build_toy_detector.hpp"
+#include "detray/detectors/toy_metadata.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+using namespace detray;
+
+namespace {
+
+/// Hand-written reduction of the toy metadata: Only rectangles, portal
+/// cylinders and the cylinder surface grid
+enum class reduced_mask_ids : std::uint8_t {
+    e_rectangle2 = 0,
+    e_portal_cylinder2 = 1,
+};
+
+enum class reduced_accel_ids : std::uint8_t {
+    e_brute_force = 0,
+    e_cylinder2_grid = 1,
+};
+
+struct reduced_surface {};
+
+}  // anonymous namespace
+
+/// Compile-time reduction of the toy detector data stores
+GTEST_TEST(io, minimal_metadata_filtered_store) {
+
+    using toy_mask_store_t = toy_metadata::mask_store<>;
+    using reduced_mask_store_t =
+        detail::filter_store_t<toy_mask_store_t, reduced_mask_ids, 0u, 2u>;
+
+    static_assert(reduced_mask_store_t::n_collections() == 2u);
+    static_assert(
+        std::is_same_v<typename reduced_mask_store_t::template get_type<
+                           reduced_mask_ids::e_rectangle2>,
+                       typename toy_mask_store_t::template get_type<
+                           toy_metadata::mask_ids::e_rectangle2>>);
+    static_assert(
+        std::is_same_v<typename reduced_mask_store_t::template get_type<
+                           reduced_mask_ids::e_portal_cylinder2>,
+                       typename toy_mask_store_t::template get_type<
+                           toy_metadata::mask_ids::e_portal_cylinder2>>);
+
+    // Rebind the surface type of the acceleration structures
+    using toy_accel_store_t = toy_metadata::accelerator_store<>;
+    using reduced_accel_store_t = detail::filter_store_t<
+        detail::rebind_value_t<toy_accel_store_t, toy_metadata::surface_type,
+                               reduced_surface>,
+        reduced_accel_ids, 0u, 2u>;
+
+    static_assert(reduced_accel_store_t::n_collections() == 2u);
+    static_assert(
+        std::is_same_v<typename reduced_accel_store_t::template get_type<
+                           reduced_accel_ids::e_brute_force>,
+                       brute_force_collection<reduced_surface,
+                                              host_container_types>>);
+    static_assert(
+        std::is_same_v<typename reduced_accel_store_t::template get_type<
+                           reduced_accel_ids::e_cylinder2_grid>,
+                       grid_collection<toy_metadata::cylinder_sf_grid<
+                           reduced_surface, host_container_types>>>);
+}
+
+/// Find the types that the toy detector uses and generate a reduced metadata
+GTEST_TEST(io, minimal_metadata_toy_detector) {
+
+    vecmem::host_memory_resource host_mr;
+    toy_det_config<scalar> toy_cfg{};
+    toy_cfg.use_material_maps(false);
+    const auto [toy_det, names] = build_toy_detector(host_mr, toy_cfg);
+
+    const io::detector_type_usage usage = io::get_type_usage(toy_det);
+
+    // All mask types of the toy metadata are in use
+    ASSERT_EQ(usage.masks.size(), 4u);
+    EXPECT_EQ(io::detector_type_usage::n_used(usage.masks), 4u);
+    EXPECT_EQ(usage.masks[0].id_names.front(), "e_rectangle2");
+    EXPECT_EQ(usage.masks[1].id_names.front(), "e_trapezoid2");
+    EXPECT_EQ(usage.masks[2].id_names.front(), "e_portal_cylinder2");
+    EXPECT_EQ(usage.masks[3].id_names.front(), "e_portal_ring2");
+
+    std::size_t n_mask_refs{0u};
+    for (const auto& u : usage.masks) {
+        n_mask_refs += u.n_references;
+    }
+    EXPECT_EQ(n_mask_refs, toy_det.surfaces().size());
+
+    // Only homogeneous material without material maps
+    ASSERT_EQ(usage.materials.size(), 4u);
+    EXPECT_EQ(io::detector_type_usage::n_used(usage.materials), 1u);
+    EXPECT_FALSE(usage.materials[0].is_used());
+    EXPECT_FALSE(usage.materials[1].is_used());
+    EXPECT_FALSE(usage.materials[2].is_used());
+    EXPECT_TRUE(usage.materials[3].is_used());
+    EXPECT_EQ(usage.materials[3].id_names.front(), "e_slab");
+
+    // Brute force search and surface grids in the barrel and endcaps
+    ASSERT_EQ(usage.accelerators.size(), 3u);
+    EXPECT_EQ(io::detector_type_usage::n_used(usage.accelerators), 3u);
+    EXPECT_EQ(usage.accelerators[0].id_names.front(), "e_brute_force");
+
+    // Generate the reduced metadata
+    std::stringstream out;
+    io::write_minimal_metadata(toy_det, "toy_minimal_metadata", out,
+                               "detray/detectors/toy_metadata.hpp");
+    const std::string header{out.str()};
+
+    EXPECT_NE(header.find("struct toy_minimal_metadata"), std::string::npos);
+    EXPECT_NE(header.find("detray/detectors/toy_metadata.hpp"),
+              std::string::npos);
+    EXPECT_NE(header.find("filter_store_t"), std::string::npos);
+    EXPECT_NE(header.find("e_rectangle2 = "), std::string::npos);
+    EXPECT_NE(header.find("e_slab = 0"), std::string::npos);
+    EXPECT_NE(header.find("e_none = 1u"), std::string::npos);
+    EXPECT_NE(header.find("e_default = e_brute_force"), std::string::npos);
+    // Unused material maps are not registered
+    EXPECT_EQ(header.find("e_disc2_map"), std::string::npos);
+}
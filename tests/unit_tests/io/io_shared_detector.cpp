@@ -0,0 +1,94 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/io/frontend/shared_detector.hpp"
+
+#include "detray/core/detector.hpp"
+#include "detray/detectors/build_telescope_detector.hpp"
+#include "detray/detectors/build_toy_detector.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// POSIX include(s)
+#include <unistd.h>
+
+// System include(s)
+#include <stdexcept>
+#include <string>
+
+using namespace detray;
+
+/// Share the toy detector through a POSIX shared memory segment
+GTEST_TEST(io, shared_detector) {
+
+    vecmem::host_memory_resource host_mr;
+    auto [toy_det, names] = build_toy_detector(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using device_detector_t =
+        detector<typename detector_t::metadata, device_container_types>;
+    using mask_id = typename detector_t::masks::id;
+
+    // Unique name per test process
+    const std::string name{"/detray_test_" + std::to_string(::getpid())};
+    io::shared_detector<detector_t>::remove(name);
+
+    auto owner = io::shared_detector<detector_t>::create(name, toy_det);
+    EXPECT_TRUE(owner.is_owner());
+    EXPECT_GT(owner.size(), 0u);
+
+    // The name can only be taken once
+    EXPECT_THROW(io::shared_detector<detector_t>::create(name, toy_det),
+                 std::runtime_error);
+
+    // Attach (as another process would)
+    {
+        auto shared = io::shared_detector<detector_t>::attach(name);
+        EXPECT_FALSE(shared.is_owner());
+        EXPECT_EQ(shared.size(), owner.size());
+
+        // Read-only view
+        const auto const_view = shared.get_data();
+        EXPECT_EQ(detray::detail::get<0>(const_view.m_view).size(),
+                  toy_det.volumes().size());
+
+        // Detector over the shared memory
+        auto view = shared.get_view();
+        const device_detector_t shm_det(view);
+
+        ASSERT_EQ(shm_det.volumes().size(), toy_det.volumes().size());
+        for (unsigned int i = 0u; i < toy_det.volumes().size(); ++i) {
+            EXPECT_TRUE(shm_det.volumes()[i] == toy_det.volumes()[i]);
+        }
+        ASSERT_EQ(shm_det.surfaces().size(), toy_det.surfaces().size());
+        for (unsigned int i = 0u; i < toy_det.surfaces().size(); ++i) {
+            EXPECT_TRUE(shm_det.surfaces()[i] == toy_det.surfaces()[i]);
+        }
+        EXPECT_EQ(shm_det.transform_store().size(),
+                  toy_det.transform_store().size());
+        EXPECT_EQ(shm_det.mask_store().template size<mask_id::e_trapezoid2>(),
+                  toy_det.mask_store().template size<mask_id::e_trapezoid2>());
+
+        // The data is not owned by the attached process
+        EXPECT_NE(&shm_det.volumes()[0], &toy_det.volumes()[0]);
+    }
+
+    // Only the same detector type can attach
+    using tel_detector_t = detector<telescope_metadata<rectangle2D>>;
+    EXPECT_THROW(io::shared_detector<tel_detector_t>::attach(name),
+                 std::runtime_error);
+
+    // The owner removes the segment name
+    owner = io::shared_detector<detector_t>{};
+    EXPECT_THROW(io::shared_detector<detector_t>::attach(name),
+                 std::runtime_error);
+}
@@ -37,9 +37,12 @@ int main() {
     // create toy geometry with vecmem managed memory resouce
     auto [det_mng, names_mng] = detray::build_toy_detector(mng_mr);
 
-    // Get the view onto the detector data directly
+    // Get the view onto the detector data directly (no copy)
     auto det_mng_data = detray::get_data(det_mng);
 
+    // Keep the hot data on the device and the material on the host
+    detray::tutorial::prefetch(det_mng_data);
+
     // Pass the view and call the kernel
     std::cout << "Using CUDA unified memory:" << std::endl;
     detray::tutorial::print(det_mng_data);
@@ -93,12 +96,15 @@ int main() {
     auto vgrid_buff = detray::get_buffer(det_host.volume_search_grid(), dev_mr,
                                          cuda_cpy, detray::copy::sync,
                                          vecmem::data::buffer_type::fixed_size);
+    auto adj_buff = detray::get_buffer(det_host.volume_adjacency(), dev_mr,
+                                       cuda_cpy, detray::copy::sync,
+                                       vecmem::data::buffer_type::fixed_size);
 
     // Assemble the detector buffer
     auto det_custom_buff = typename decltype(det_host)::buffer_type(
         std::move(vol_buff), std::move(sf_buff), std::move(trf_buff),
         std::move(msk_buff), std::move(mat_buff), std::move(acc_buff),
-        std::move(vgrid_buff));
+        std::move(vgrid_buff), std::move(adj_buff));
 
     std::cout << "\nCustom buffer setup:" << std::endl;
     detray::tutorial::print(detray::get_data(det_custom_buff));
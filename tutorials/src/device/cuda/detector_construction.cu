@@ -6,6 +6,7 @@
  */
 
 #include "detector_construction.hpp"
+#include "detray/core/detail/memory_hints.hpp"
 #include "detray/definitions/detail/cuda_definitions.hpp"
 
 namespace detray::tutorial {
@@ -51,4 +52,30 @@ void print(typename detray::tutorial::detector_host_t::view_type det_data) {
     DETRAY_CUDA_ERROR_CHECK(cudaDeviceSynchronize());
 }
 
+void prefetch(typename detray::tutorial::detector_host_t::view_type det_data) {
+
+    int device{0};
+    DETRAY_CUDA_ERROR_CHECK(cudaGetDevice(&device));
+
+    // Hot stores are moved to the device, cold stores stay on the host and
+    // are accessed remotely
+    detray::apply_memory_hints(
+        det_data, [device](const void* ptr, const std::size_t n_bytes,
+                           const detray::memory_hint hint) {
+            const int location{hint == detray::memory_hint::e_hot
+                                   ? device
+                                   : cudaCpuDeviceId};
+            DETRAY_CUDA_ERROR_CHECK(cudaMemAdvise(
+                ptr, n_bytes, cudaMemAdviseSetPreferredLocation, location));
+            DETRAY_CUDA_ERROR_CHECK(cudaMemAdvise(
+                ptr, n_bytes, cudaMemAdviseSetAccessedBy, device));
+            if (hint == detray::memory_hint::e_hot) {
+                DETRAY_CUDA_ERROR_CHECK(
+                    cudaMemPrefetchAsync(ptr, n_bytes, device));
+            }
+        });
+
+    DETRAY_CUDA_ERROR_CHECK(cudaDeviceSynchronize());
+}
+
 }  // namespace detray::tutorial
@@ -26,4 +26,8 @@ using acc_id = typename detector_host_t::accel::id;
 /// Detector construction tutorial function (prints some detector statistics)
 void print(typename detector_host_t::view_type det_data);
 
+/// Advise the CUDA driver where to keep the stores of a detector that was
+/// allocated in unified memory (hot stores on the device)
+void prefetch(typename detector_host_t::view_type det_data);
+
 }  // namespace detray::tutorial
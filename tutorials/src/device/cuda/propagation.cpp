@@ -53,13 +53,17 @@ int main() {
         bfield);
     auto tracks_data = detray::get_data(tracks);
 
-    // Create navigator candidates buffer
+    // Propagation configuration
+    detray::propagation::config<detray::scalar> cfg{};
+    cfg.navigation.search_window = {3u, 3u};
+
+    // Create navigator candidates buffer for the search window of the config
     vecmem::copy copy;  //< Helper object for performing memory copies.
-    auto candidates_buffer =
-        detray::create_candidates_buffer(det, theta_steps * phi_steps, mng_mr);
+    auto candidates_buffer = detray::create_candidates_buffer(
+        det, theta_steps * phi_steps, cfg.navigation, mng_mr);
     copy.setup(candidates_buffer);
 
     // Run the propagator test for GPU device
-    detray::tutorial::propagation(det_data, device_bfield, tracks_data,
+    detray::tutorial::propagation(cfg, det_data, device_bfield, tracks_data,
                                   candidates_buffer);
 }
@@ -67,6 +67,7 @@ using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
 
 /// Propagation tutorial function
 void propagation(
+    const propagation::config<scalar> &cfg,
     typename detector_host_t::view_type det_data,
     typename device_field_t::view_t field_data,
     const vecmem::data::vector_view<
@@ -16,6 +16,7 @@ inline constexpr detray::scalar path_limit{2.f *
 
 /// Kernel that runs the entire propagation loop
 __global__ void propagation_kernel(
+    const propagation::config<scalar> cfg,
     typename detray::tutorial::detector_host_t::view_type det_data,
     typename detray::tutorial::device_field_t::view_t field_data,
     const vecmem::data::vector_view<
@@ -42,8 +43,6 @@ __global__ void propagation_kernel(
         candidates_data);
 
     // Create propagator from a stepper and a navigator
-    propagation::config<scalar> cfg{};
-    cfg.navigation.search_window = {3u, 3u};
     detray::tutorial::propagator_t p{cfg};
 
     // Create actor states
@@ -67,6 +66,7 @@ __global__ void propagation_kernel(
 }
 
 void propagation(
+    const propagation::config<scalar> &cfg,
     typename detray::tutorial::detector_host_t::view_type det_data,
     typename detray::tutorial::device_field_t::view_t field_data,
     const vecmem::data::vector_view<
@@ -79,8 +79,8 @@ void propagation(
     int block_dim = tracks_data.size() / thread_dim + 1;
 
     // run the tutorial kernel
-    propagation_kernel<<<block_dim, thread_dim>>>(det_data, field_data,
-                                                  tracks_data, candidates_data);
+    propagation_kernel<<<block_dim, thread_dim>>>(
+        cfg, det_data, field_data, tracks_data, candidates_data);
 
     // cuda error check
     DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
@@ -9,6 +9,7 @@
 
 // Project include(s)
 #include "detray/definitions/detail/algebra.hpp"
+#include "detray/detectors/detail/solenoid_field.hpp"
 #include "detray/io/covfie/read_bfield.hpp"
 
 // Covfie include(s)
@@ -29,6 +30,11 @@ using const_bknd_t =
 
 using const_field_t = covfie::field<const_bknd_t>;
 
+/// Analytic field of a finite solenoid along z (host and device)
+using solenoid_bknd_t = detail::solenoid<detray::scalar>;
+
+using solenoid_field_t = covfie::field<solenoid_bknd_t>;
+
 /// Inhomogeneous field (host)
 using inhom_bknd_t =
     covfie::backend::affine<covfie::backend::linear<covfie::backend::strided<
@@ -50,9 +56,22 @@ inline const_field_t create_const_field(const vector3_t &B) {
         const_bknd_t::configuration_t{B[0], B[1], B[2]})};
 }
 
+/// @returns an analytic solenoid field
+///
+/// @param radius the radius of the solenoid coil
+/// @param length the full length of the solenoid
+/// @param b_center the field strength in the center of the solenoid
+inline solenoid_field_t create_solenoid_field(const detray::scalar radius,
+                                              const detray::scalar length,
+                                              const detray::scalar b_center) {
+    return solenoid_field_t{
+        covfie::make_parameter_pack(solenoid_bknd_t::configuration_t{
+            radius, 0.5f * length, b_center})};
+}
+
 /// @returns a constant covfie field constructed from the field vector @param B
 inline inhom_field_t create_inhom_field() {
-    return io::read_bfield<inhom_field_t>(
+    return io::read_bfield_via_mmap<inhom_field_t>(
         !std::getenv("DETRAY_BFIELD_FILE") ? ""
                                            : std::getenv("DETRAY_BFIELD_FILE"));
 }
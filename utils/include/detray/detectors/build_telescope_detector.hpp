@@ -13,6 +13,7 @@
 #include "detray/builders/homogeneous_material_builder.hpp"
 #include "detray/builders/homogeneous_material_generator.hpp"
 #include "detray/builders/homogeneous_volume_material_builder.hpp"
+#include "detray/builders/sorted_plane_builder.hpp"
 #include "detray/core/detector.hpp"
 #include "detray/definitions/units.hpp"
 #include "detray/detectors/factories/telescope_generator.hpp"
@@ -77,6 +78,9 @@ struct tel_det_config {
     trajectory_t m_trajectory{};
     /// Safety envelope between the test surfaces and the portals
     scalar m_envelope{0.1f * unit<scalar>::mm};
+    /// Sort the test surfaces along the telescope axis, instead of testing
+    /// all of them during navigation
+    bool m_sorted_planes{false};
     /// Run detector consistency check after reading
     bool m_do_check{true};
 
@@ -125,6 +129,10 @@ struct tel_det_config {
         m_envelope = e;
         return *this;
     }
+    constexpr tel_det_config &sorted_planes(const bool sort) {
+        m_sorted_planes = sort;
+        return *this;
+    }
     tel_det_config &do_check(const bool check) {
         m_do_check = check;
         return *this;
@@ -150,6 +158,7 @@ struct tel_det_config {
     }
     const trajectory_t &pilot_track() const { return m_trajectory; }
     constexpr scalar envelope() const { return m_envelope; }
+    constexpr bool sorted_planes() const { return m_sorted_planes; }
     bool do_check() const { return m_do_check; }
     /// @}
 };
@@ -208,8 +217,9 @@ inline auto build_telescope_detector(
     }
 
     // @todo: Temporal restriction due to missing local navigation
-    assert((tel_generator->size() < 20u) &&
-           "Due to WIP, please choose less than 20 surfaces for now");
+    assert((cfg.sorted_planes() || tel_generator->size() < 20u) &&
+           "Due to WIP, please choose less than 20 surfaces for now, or sort "
+           "the planes");
 
     // Add homogeneous material description if a valid material was configured
     volume_builder_interface<detector_t> *vm_builder{v_builder};
@@ -253,6 +263,15 @@ inline auto build_telescope_detector(
         full_v_builder->set_material(cfg.volume_material());
     }
 
+    // If requested, sort the modules along the telescope axis
+    if (cfg.sorted_planes()) {
+        using plane_builder_t = sorted_plane_builder<
+            detector_t,
+            sorted_plane_collection<typename detector_t::surface_type>>;
+
+        det_builder.template decorate<plane_builder_t>(vm_builder);
+    }
+
     // Build and return the detector
     auto det = det_builder.build(resource);
 
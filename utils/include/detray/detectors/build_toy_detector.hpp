@@ -8,6 +8,7 @@
 #pragma once
 
 // Project include(s)
+#include "detray/builders/concentric_portal_builder.hpp"
 #include "detray/builders/cylinder_portal_generator.hpp"
 #include "detray/builders/detector_builder.hpp"
 #include "detray/builders/grid_builder.hpp"
@@ -91,6 +92,8 @@ struct toy_det_config {
     hom_material_config<scalar_t> m_material_config{};
     /// Put material maps on portals or use homogenous material on modules
     bool m_use_material_maps{false};
+    /// Index the portals of the cylinder volumes by radius and z position
+    bool m_use_concentric_portals{false};
     /// Number of bins for material maps
     std::array<std::size_t, 2> m_cyl_map_bins{20u, 20u};
     std::array<std::size_t, 2> m_disc_map_bins{3u, 20u};
@@ -132,8 +135,13 @@ struct toy_det_config {
     barrel_generator_config<scalar_t> m_barrel_factory_cfg{};
     /// Config for the module generation (endcaps)
     endcap_generator_config<scalar_t> m_endcap_factory_cfg{};
+    /// Scale factor for the number of surface grid bins per axis, relative
+    /// to the number of modules
+    scalar_t m_grid_bin_scale{1.f};
     /// Run detector consistency check after reading
     bool m_do_check{true};
+    /// Number of threads that prepare the volumes during the build
+    unsigned int m_n_build_threads{1u};
 
     /// Setters
     /// @{
@@ -153,6 +161,10 @@ struct toy_det_config {
         m_use_material_maps = b;
         return *this;
     }
+    constexpr toy_det_config &use_concentric_portals(const bool b) {
+        m_use_concentric_portals = b;
+        return *this;
+    }
     constexpr toy_det_config &cyl_map_bins(const std::size_t n_phi,
                                            const std::size_t n_z) {
         m_cyl_map_bins = {n_phi, n_z};
@@ -182,10 +194,24 @@ struct toy_det_config {
         m_mapped_material = mat;
         return *this;
     }
+    toy_det_config &barrel_layer_binning(
+        const std::vector<std::pair<unsigned int, unsigned int>> &binning) {
+        m_barrel_binning = binning;
+        return *this;
+    }
+    constexpr toy_det_config &grid_bin_scale(const scalar_t scale) {
+        assert(scale > 0.f);
+        m_grid_bin_scale = scale;
+        return *this;
+    }
     constexpr toy_det_config &do_check(const bool check) {
         m_do_check = check;
         return *this;
     }
+    constexpr toy_det_config &n_build_threads(const unsigned int n) {
+        m_n_build_threads = n;
+        return *this;
+    }
     /// @}
 
     /// Getters
@@ -200,6 +226,9 @@ struct toy_det_config {
     constexpr auto &material_config() { return m_material_config; }
     constexpr const auto &material_config() const { return m_material_config; }
     constexpr bool use_material_maps() const { return m_use_material_maps; }
+    constexpr bool use_concentric_portals() const {
+        return m_use_concentric_portals;
+    }
     constexpr const std::array<std::size_t, 2> &cyl_map_bins() const {
         return m_cyl_map_bins;
     }
@@ -233,7 +262,11 @@ struct toy_det_config {
     constexpr endcap_generator_config<scalar_t> &endcap_config() {
         return m_endcap_factory_cfg;
     }
+    constexpr scalar_t grid_bin_scale() const { return m_grid_bin_scale; }
     constexpr bool do_check() const { return m_do_check; }
+    constexpr unsigned int n_build_threads() const {
+        return m_n_build_threads;
+    }
     /// @}
 };
 
@@ -355,6 +388,17 @@ decorate_material(
     }
 }
 
+/// @returns the number of grid bins for @param n_modules modules along an axis
+/// and the bin scale factor @param scale (at least one bin)
+template <typename scalar_t>
+inline std::size_t scale_grid_bins(const std::size_t n_modules,
+                                   const scalar_t scale) {
+    const auto n_bins{static_cast<std::size_t>(
+        math::round(static_cast<scalar_t>(n_modules) * scale))};
+
+    return n_bins > 0u ? n_bins : 1u;
+}
+
 /// Helper method for creating the barrel surface grids.
 ///
 /// @param det_builder detector builder the barrel section should be added to
@@ -386,7 +430,8 @@ inline void add_cylinder_grid(
     vgr_builder->set_type(detector_t::geo_obj_ids::e_sensitive);
     vgr_builder->init_grid(
         {-constant<scalar_t>::pi, constant<scalar_t>::pi, -h_z, h_z},
-        {barrel_cfg.binning().first, barrel_cfg.binning().second});
+        {scale_grid_bins(barrel_cfg.binning().first, cfg.grid_bin_scale()),
+         scale_grid_bins(barrel_cfg.binning().second, cfg.grid_bin_scale())});
 }
 
 /// Helper method for creating the endcap surface grids.
@@ -421,7 +466,8 @@ inline void add_disc_grid(
     vgr_builder->set_type(detector_t::geo_obj_ids::e_sensitive);
     vgr_builder->init_grid(
         {inner_r, outer_r, -constant<scalar_t>::pi, constant<scalar_t>::pi},
-        {endcap_cfg.binning().size(), endcap_cfg.binning().back()});
+        {scale_grid_bins(endcap_cfg.binning().size(), cfg.grid_bin_scale()),
+         scale_grid_bins(endcap_cfg.binning().back(), cfg.grid_bin_scale())});
 }
 
 /// Helper method for creating the barrel section.
@@ -1081,7 +1127,20 @@ inline auto build_toy_detector(vecmem::memory_resource &resource,
                               pos_edc_vol_extents, brl_vol_extents);
     }
 
+    // Replace the brute force portal search where possible
+    if (cfg.use_concentric_portals()) {
+        using portal_builder_t = concentric_portal_builder<
+            detector_t,
+            concentric_portal_collection<typename detector_t::surface_type>>;
+
+        for (dindex vol_idx = 0u; vol_idx < det_builder.n_volumes();
+             ++vol_idx) {
+            det_builder.template decorate<portal_builder_t>(vol_idx);
+        }
+    }
+
     // Build and return the detector
+    det_builder.set_n_threads(cfg.n_build_threads());
     auto det = det_builder.build(resource);
 
     if (cfg.do_check()) {
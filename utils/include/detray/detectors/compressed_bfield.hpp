@@ -0,0 +1,329 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/detectors/bfield.hpp"
+
+// Covfie include(s)
+#include <covfie/core/backend/primitive/array.hpp>
+#include <covfie/core/backend/transformer/affine.hpp>
+#include <covfie/core/backend/transformer/linear.hpp>
+#include <covfie/core/backend/transformer/strided.hpp>
+#include <covfie/core/field.hpp>
+#include <covfie/core/parameter_pack.hpp>
+#include <covfie/core/utility/binary_io.hpp>
+#include <covfie/core/vector.hpp>
+
+// System include(s)
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace detray::bfield {
+
+namespace detail {
+
+/// @brief Store the field components as 16 bit integers, scaled by the
+/// largest field component in the map.
+///
+/// The quantization error is at most half a step, i.e. |B|_max / 65534, which
+/// is about 3e-5 T for a 2 T solenoid field.
+template <typename scalar_t>
+struct int16_codec {
+    using scalar_type = scalar_t;
+    using storage_type = std::int16_t;
+
+    /// Field value of one integer step
+    struct configuration_t {
+        scalar_t scale{1.f};
+    };
+
+    /// @returns the configuration for a field with the largest component
+    /// magnitude @param max_abs
+    static configuration_t configure(const scalar_t max_abs) {
+        constexpr auto n_steps{
+            static_cast<scalar_t>(std::numeric_limits<storage_type>::max())};
+        return {max_abs > 0.f ? max_abs / n_steps : 1.f};
+    }
+
+    /// @returns the stored value of the field component @param v
+    static storage_type encode(const scalar_t v, const configuration_t &cfg) {
+        return static_cast<storage_type>(math::round(v / cfg.scale));
+    }
+
+    /// @returns the field component of the stored value @param v
+    DETRAY_HOST_DEVICE
+    static constexpr scalar_t decode(const storage_type v,
+                                     const configuration_t &cfg) {
+        return cfg.scale * static_cast<scalar_t>(v);
+    }
+};
+
+/// @brief Store the field components as bfloat16 (upper half of an IEEE
+/// single precision float).
+///
+/// Needs no scale and the conversion to float is a shift. The relative error
+/// of a component is at most 2^-9.
+template <typename scalar_t>
+struct bfloat16_codec {
+    using scalar_type = scalar_t;
+    using storage_type = std::uint16_t;
+
+    /// Nothing to configure
+    struct configuration_t {};
+
+    static configuration_t configure(const scalar_t) { return {}; }
+
+    /// @returns the stored value of the field component @param v (rounded to
+    /// nearest even)
+    static storage_type encode(const scalar_t v, const configuration_t &) {
+        const auto f{static_cast<float>(v)};
+        std::uint32_t bits{0u};
+        std::memcpy(&bits, &f, sizeof(f));
+        bits += 0x7fffu + ((bits >> 16u) & 1u);
+
+        return static_cast<storage_type>(bits >> 16u);
+    }
+
+    /// @returns the field component of the stored value @param v
+    DETRAY_HOST_DEVICE
+    static scalar_t decode(const storage_type v, const configuration_t &) {
+        const std::uint32_t bits{static_cast<std::uint32_t>(v) << 16u};
+        float f{0.f};
+        std::memcpy(&f, &bits, sizeof(f));
+
+        return static_cast<scalar_t>(f);
+    }
+};
+
+/// @brief Covfie transformer backend that decodes the compressed field
+/// components of the underlying backend.
+///
+/// Placed below the @c linear interpolation, so that the eight grid points
+/// of an interpolation cell are read in the compressed format and only
+/// decoded in registers.
+///
+/// @tparam codec_t how the field components are stored
+/// @tparam _backend_t the storage backend (e.g. strided array)
+template <typename codec_t, typename _backend_t>
+struct decompress {
+    using this_t = decompress<codec_t, _backend_t>;
+    static constexpr bool is_initial = false;
+
+    using backend_t = _backend_t;
+    using codec_type = codec_t;
+
+    using contravariant_input_t = typename backend_t::contravariant_input_t;
+    using contravariant_output_t = contravariant_input_t;
+    using covariant_input_t = typename backend_t::covariant_output_t;
+    using covariant_output_t =
+        covfie::vector::vector_d<typename codec_t::scalar_type,
+                                 covariant_input_t::dimensions>;
+
+    using configuration_t = typename codec_t::configuration_t;
+
+    static constexpr std::uint32_t IO_MAGIC_HEADER = 0xDE7A0C01;
+
+    struct owning_data_t {
+        using parent_t = this_t;
+
+        owning_data_t() = default;
+
+        /// Construct from the codec configuration and the arguments of the
+        /// storage backend
+        template <typename... Args>
+        explicit owning_data_t(
+            covfie::parameter_pack<configuration_t, Args...> &&args)
+            : m_conf(args.x), m_backend(std::move(args.xs)) {}
+
+        /// Construct from the codec configuration and the storage backend
+        owning_data_t(const configuration_t &conf,
+                      typename backend_t::owning_data_t &&be)
+            : m_conf(conf), m_backend(std::move(be)) {}
+
+        /// Convert from a field with the same codec, but different storage
+        /// (e.g. host to device memory)
+        template <
+            typename T,
+            std::enable_if_t<
+                !std::is_same_v<T, owning_data_t> &&
+                    std::is_same_v<typename T::parent_t::codec_type, codec_t>,
+                bool> = true>
+        explicit owning_data_t(const T &o)
+            : m_conf(o.get_configuration()), m_backend(o.get_backend()) {}
+
+        typename backend_t::owning_data_t &get_backend() { return m_backend; }
+
+        const typename backend_t::owning_data_t &get_backend() const {
+            return m_backend;
+        }
+
+        configuration_t get_configuration() const { return m_conf; }
+
+        static owning_data_t read_binary(std::istream &fs) {
+            covfie::utility::read_io_header(fs, IO_MAGIC_HEADER);
+
+            const auto conf{
+                covfie::utility::read_binary<configuration_t>(fs)};
+            auto be{backend_t::owning_data_t::read_binary(fs)};
+
+            covfie::utility::read_io_footer(fs, IO_MAGIC_HEADER);
+
+            return owning_data_t(conf, std::move(be));
+        }
+
+        static void write_binary(std::ostream &fs, const owning_data_t &o) {
+            covfie::utility::write_io_header(fs, IO_MAGIC_HEADER);
+
+            fs.write(reinterpret_cast<const char *>(&o.m_conf),
+                     sizeof(configuration_t));
+            backend_t::owning_data_t::write_binary(fs, o.m_backend);
+
+            covfie::utility::write_io_footer(fs, IO_MAGIC_HEADER);
+        }
+
+        configuration_t m_conf{};
+        typename backend_t::owning_data_t m_backend{};
+    };
+
+    struct non_owning_data_t {
+        using parent_t = this_t;
+
+        explicit non_owning_data_t(const owning_data_t &src)
+            : m_conf(src.m_conf), m_backend(src.m_backend) {}
+
+        /// @returns the decoded field at the grid point @param c
+        DETRAY_HOST_DEVICE
+        typename covariant_output_t::vector_t at(
+            typename contravariant_input_t::vector_t c) const {
+
+            const auto &v = m_backend.at(c);
+
+            typename covariant_output_t::vector_t res{};
+            for (std::size_t i = 0u; i < covariant_output_t::dimensions; ++i) {
+                res[i] = codec_t::decode(v[i], m_conf);
+            }
+
+            return res;
+        }
+
+        typename backend_t::non_owning_data_t &get_backend() {
+            return m_backend;
+        }
+
+        const typename backend_t::non_owning_data_t &get_backend() const {
+            return m_backend;
+        }
+
+        configuration_t m_conf;
+        typename backend_t::non_owning_data_t m_backend;
+    };
+};
+
+/// Storage of the compressed field grid (host)
+template <typename codec_t>
+using compressed_storage_t = covfie::backend::strided<
+    covfie::vector::vector_d<std::size_t, 3>,
+    covfie::backend::array<
+        covfie::vector::vector_d<typename codec_t::storage_type, 3>>>;
+
+}  // namespace detail
+
+/// Inhomogeneous field with compressed field values (host)
+template <typename codec_t>
+using compressed_bknd_t = covfie::backend::affine<covfie::backend::linear<
+    detail::decompress<codec_t, detail::compressed_storage_t<codec_t>>>>;
+
+/// Inhomogeneous field, stored as scaled 16 bit integers (host)
+using inhom_int16_bknd_t =
+    compressed_bknd_t<detail::int16_codec<detray::scalar>>;
+using inhom_int16_field_t = covfie::field<inhom_int16_bknd_t>;
+
+/// Inhomogeneous field, stored as bfloat16 (host)
+using inhom_bf16_bknd_t =
+    compressed_bknd_t<detail::bfloat16_codec<detray::scalar>>;
+using inhom_bf16_field_t = covfie::field<inhom_bf16_bknd_t>;
+
+/// @returns the compressed version of the full precision field @param field
+///
+/// The field keeps the grid and the affine transformation of the original
+/// field, only the field values are encoded.
+template <typename compressed_field_t>
+inline compressed_field_t compress_field(const inhom_field_t &field) {
+
+    using affine_t = typename compressed_field_t::backend_t;
+    using linear_t = typename affine_t::backend_t;
+    using decompress_t = typename linear_t::backend_t;
+    using codec_t = typename decompress_t::codec_type;
+    using strided_t = typename decompress_t::backend_t;
+    using array_t = typename strided_t::backend_t;
+    using storage_t = typename codec_t::storage_type;
+
+    // Full precision grid
+    const auto &src_affine = field.backend();
+    const auto &src_strided = src_affine.get_backend().get_backend();
+    const auto sizes = src_strided.get_configuration();
+    const typename std::decay_t<decltype(src_strided)>::parent_t::
+        non_owning_data_t src(src_strided);
+
+    // Scale from the largest field component
+    detray::scalar max_abs{0.f};
+    for (std::size_t i = 0u; i < sizes[0]; ++i) {
+        for (std::size_t j = 0u; j < sizes[1]; ++j) {
+            for (std::size_t k = 0u; k < sizes[2]; ++k) {
+                const auto &b = src.at({i, j, k});
+                for (std::size_t c = 0u; c < 3u; ++c) {
+                    max_abs =
+                        math::max(max_abs, static_cast<detray::scalar>(
+                                               math::abs(b[c])));
+                }
+            }
+        }
+    }
+    const auto conf{codec_t::configure(max_abs)};
+
+    compressed_field_t compressed{covfie::make_parameter_pack(
+        src_affine.get_configuration(), typename linear_t::configuration_t{},
+        conf, sizes,
+        typename array_t::configuration_t{sizes[0] * sizes[1] * sizes[2]})};
+
+    // Encode the field values
+    typename strided_t::non_owning_data_t dst(
+        compressed.backend().get_backend().get_backend().get_backend());
+    for (std::size_t i = 0u; i < sizes[0]; ++i) {
+        for (std::size_t j = 0u; j < sizes[1]; ++j) {
+            for (std::size_t k = 0u; k < sizes[2]; ++k) {
+                const auto &b = src.at({i, j, k});
+                auto &v = dst.at({i, j, k});
+                for (std::size_t c = 0u; c < 3u; ++c) {
+                    v[c] = static_cast<storage_t>(codec_t::encode(
+                        static_cast<detray::scalar>(b[c]), conf));
+                }
+            }
+        }
+    }
+
+    return compressed;
+}
+
+/// @returns a compressed field map, read from the full precision field file
+/// in the environment variable 'DETRAY_BFIELD_FILE'
+template <typename compressed_field_t = inhom_int16_field_t>
+inline compressed_field_t create_compressed_inhom_field() {
+    return compress_field<compressed_field_t>(create_inhom_field());
+}
+
+}  // namespace detray::bfield
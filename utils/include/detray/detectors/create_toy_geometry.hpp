@@ -8,6 +8,7 @@
 #pragma once
 
 // Project include(s)
+#include "detray/builders/detail/volume_extent.hpp"
 #include "detray/builders/grid_builder.hpp"
 #include "detray/builders/volume_builder.hpp"
 #include "detray/core/detector.hpp"
@@ -1222,30 +1223,12 @@ inline auto create_toy_geometry(vecmem::memory_resource &resource,
             beampipe_idx, edc_lay_sizes, edc_positions, edc_config);
     }
 
-    // Add volume grid
-    // TODO: Fill it
-
-    // Dimensions of the volume grid: minr, min phi, minz, maxr, maxphi, maxz
-    // TODO: Adapt to number of layers
-    mask<cylinder3D> vgrid_dims{0u,      0.f,   -constant<scalar>::pi,
-                                -2000.f, 180.f, constant<scalar>::pi,
-                                2000.f};
-    std::array<std::size_t, 3> n_vgrid_bins{1u, 1u, 1u};
-
-    scalar half_size_z{cfg.n_edc_layers() > 0
-                           ? edc_lay_sizes[cfg.n_edc_layers() - 1].second
-                           : brl_half_z};
-    std::array<std::vector<scalar>, 3UL> bin_edges{
-        std::vector<scalar>{0.f, brl_lay_sizes[cfg.n_brl_layers()].second},
-        std::vector<scalar>{-constant<scalar>::pi, constant<scalar>::pi},
-        std::vector<scalar>{-half_size_z, half_size_z}};
-
-    grid_factory_type<typename detector_t::volume_finder> vgrid_factory{};
-    auto vgrid = vgrid_factory.template new_grid<
-        axis::open<axis::label::e_r>, axis::circular<axis::label::e_phi>,
-        axis::open<axis::label::e_z>, axis::irregular<>, axis::regular<>,
-        axis::irregular<>>(vgrid_dims, n_vgrid_bins, {}, bin_edges);
-    det.set_volume_finder(std::move(vgrid));
+    // Add volume finder
+    using vol_finder_t = typename detector_t::volume_finder;
+    vol_finder_t vol_finder{resource};
+    vol_finder.build(
+        detail::volume_rz_boxes<typename vol_finder_t::box_type>(det));
+    det.set_volume_finder(std::move(vol_finder));
 
     return std::make_pair(std::move(det), std::move(name_map));
 }
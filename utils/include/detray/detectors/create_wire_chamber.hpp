@@ -8,6 +8,7 @@
 #pragma once
 
 // Project include(s)
+#include "detray/builders/detail/volume_extent.hpp"
 #include "detray/builders/grid_builder.hpp"
 #include "detray/core/detector.hpp"
 #include "detray/core/detector_metadata.hpp"
@@ -33,6 +34,8 @@ struct wire_chamber_config {
     scalar m_half_z{1000.f * unit<scalar>::mm};
     /// Do material maps on portals
     bool m_use_material_maps{false};
+    /// Find the wires by their azimuthal angle instead of a surface grid
+    bool m_use_wire_layers{false};
     /// Number of bins for material maps
     std::array<std::size_t, 2> m_cyl_map_bins{20u, 20u};
     std::array<std::size_t, 2> m_disc_map_bins{3u, 20u};
@@ -64,6 +67,10 @@ struct wire_chamber_config {
         m_use_material_maps = b;
         return *this;
     }
+    constexpr wire_chamber_config &use_wire_layers(const bool b) {
+        m_use_wire_layers = b;
+        return *this;
+    }
     constexpr wire_chamber_config &cyl_map_bins(const std::size_t n_rphi,
                                                 const std::size_t n_z) {
         m_cyl_map_bins = {n_rphi, n_z};
@@ -83,6 +90,7 @@ struct wire_chamber_config {
     constexpr unsigned int n_layers() const { return m_n_layers; }
     constexpr scalar half_z() const { return m_half_z; }
     constexpr bool use_material_maps() const { return m_use_material_maps; }
+    constexpr bool use_wire_layers() const { return m_use_wire_layers; }
     constexpr const std::array<std::size_t, 2> &cyl_map_bins() const {
         return m_cyl_map_bins;
     }
@@ -249,83 +257,98 @@ inline auto create_wire_chamber(vecmem::memory_resource &resource,
         det.append_transforms(std::move(transforms));
         det.append_materials(std::move(materials));
 
+        using geo_obj_ids = typename detector_t::geo_obj_ids;
+
         //
-        // Fill Grid
+        // Fill the wire layer
         //
-
-        // Get relevant ids
-        using geo_obj_ids = typename detector_t::geo_obj_ids;
-        constexpr auto cyl_id = detector_t::masks::id::e_portal_cylinder2;
-        constexpr auto grid_id = detector_t::accel::id::e_cylinder2_grid;
-
-        using cyl_grid_t =
-            typename detector_t::accelerator_container::template get_type<
-                grid_id>;
-        auto gbuilder = grid_builder<detector_t, cyl_grid_t>{};
-
-        // The portal portals are at the end of the portal range by construction
-        auto vol = detector_volume{det, vol_desc};
-        auto portal_mask_idx = (vol.portals().end() - 4)->mask().index();
-        const auto &inner_cyl_mask =
-            det.mask_store().template get<cyl_id>().at(portal_mask_idx);
-
-        portal_mask_idx = (vol.portals().end() - 3)->mask().index();
-        const auto &outer_cyl_mask =
-            det.mask_store().template get<cyl_id>().at(portal_mask_idx);
-
-        // Correct cylinder radius so that the grid lies in the middle
-        using cyl_mask_t = detail::remove_cvref_t<decltype(outer_cyl_mask)>;
-        typename cyl_mask_t::mask_values mask_values{outer_cyl_mask.values()};
-        mask_values[cylinder2D::e_r] =
-            0.5f * (inner_cyl_mask.values()[cylinder2D::e_r] +
-                    outer_cyl_mask.values()[cylinder2D::e_r]);
-        const cyl_mask_t cyl_mask{mask_values, 0u};
-
-        std::vector<std::pair<typename cyl_grid_t::loc_bin_index, dindex>>
-            capacities{};
-        auto bin_indexer2D = detray::views::cartesian_product{
-            detray::views::iota{0u, 100u}, detray::views::iota{0u, 1u}};
-        for (const auto &bin_idx : bin_indexer2D) {
-            typename cyl_grid_t::loc_bin_index mbin{std::get<0>(bin_idx),
-                                                    std::get<1>(bin_idx)};
-            // @Todo: fine-tune capacity
-            capacities.emplace_back(mbin, 3u);
+        if (cfg.use_wire_layers()) {
+            constexpr auto wire_layer_id =
+                detector_t::accel::id::e_wire_layers;
+
+            auto vol = detector_volume{det, vol_desc};
+
+            std::vector<typename detector_t::surface_type> wires{};
+            std::vector<point3> wire_centers{};
+            std::vector<vector3> wire_dirs{};
+            for (const auto &sf_desc : vol.surfaces()) {
+                if (sf_desc.is_sensitive()) {
+                    const auto &trf =
+                        det.transform_store().at(sf_desc.transform(), ctx0);
+                    wires.push_back(sf_desc);
+                    wire_centers.push_back(trf.translation());
+                    wire_dirs.push_back(trf.z());
+                }
+            }
+
+            // A track can hit a wire up to the corner of its drift cell
+            auto &wire_layers =
+                det.accelerator_store().template get<wire_layer_id>();
+            wire_layers.push_back(wires, wire_centers, wire_dirs,
+                                  constant<scalar>::sqrt2 * cell_size);
+            vol_desc.template set_accel_link<geo_obj_ids::e_sensitive>(
+                wire_layer_id, wire_layers.size() - 1u);
+        } else {
+            //
+            // Fill Grid
+            //
+
+            // Get relevant ids
+            constexpr auto cyl_id = detector_t::masks::id::e_portal_cylinder2;
+            constexpr auto grid_id = detector_t::accel::id::e_cylinder2_grid;
+
+            using cyl_grid_t =
+                typename detector_t::accelerator_container::template get_type<
+                    grid_id>;
+            auto gbuilder = grid_builder<detector_t, cyl_grid_t>{};
+
+            // The portal portals are at the end of the portal range by
+            // construction
+            auto vol = detector_volume{det, vol_desc};
+            auto portal_mask_idx = (vol.portals().end() - 4)->mask().index();
+            const auto &inner_cyl_mask =
+                det.mask_store().template get<cyl_id>().at(portal_mask_idx);
+
+            portal_mask_idx = (vol.portals().end() - 3)->mask().index();
+            const auto &outer_cyl_mask =
+                det.mask_store().template get<cyl_id>().at(portal_mask_idx);
+
+            // Correct cylinder radius so that the grid lies in the middle
+            using cyl_mask_t = detail::remove_cvref_t<decltype(outer_cyl_mask)>;
+            typename cyl_mask_t::mask_values mask_values{
+                outer_cyl_mask.values()};
+            mask_values[cylinder2D::e_r] =
+                0.5f * (inner_cyl_mask.values()[cylinder2D::e_r] +
+                        outer_cyl_mask.values()[cylinder2D::e_r]);
+            const cyl_mask_t cyl_mask{mask_values, 0u};
+
+            std::vector<std::pair<typename cyl_grid_t::loc_bin_index, dindex>>
+                capacities{};
+            auto bin_indexer2D = detray::views::cartesian_product{
+                detray::views::iota{0u, 100u}, detray::views::iota{0u, 1u}};
+            for (const auto &bin_idx : bin_indexer2D) {
+                typename cyl_grid_t::loc_bin_index mbin{std::get<0>(bin_idx),
+                                                        std::get<1>(bin_idx)};
+                // @Todo: fine-tune capacity
+                capacities.emplace_back(mbin, 3u);
+            }
+
+            // Add new grid to the detector
+            gbuilder.init_grid(cyl_mask, {100u, 1u}, capacities);
+            gbuilder.fill_grid(vol, det.surfaces(), det.transform_store(),
+                               det.mask_store(), ctx0);
+
+            det.accelerator_store().template push_back<grid_id>(gbuilder.get());
+            vol_desc.template set_accel_link<geo_obj_ids::e_sensitive>(
+                grid_id, det.accelerator_store().template size<grid_id>() - 1u);
         }
 
-        // Add new grid to the detector
-        gbuilder.init_grid(cyl_mask, {100u, 1u}, capacities);
-        gbuilder.fill_grid(vol, det.surfaces(), det.transform_store(),
-                           det.mask_store(), ctx0);
-
-        det.accelerator_store().template push_back<grid_id>(gbuilder.get());
-        vol_desc.template set_accel_link<geo_obj_ids::e_sensitive>(
-            grid_id, det.accelerator_store().template size<grid_id>() - 1u);
-
-        // Add volume grid
-        // TODO: Fill it
-
-        // Dimensions of the volume grid: minr, min phi, minz, maxr, maxphi,
-        // maxz
-        // TODO: Adapt to number of layers
-        mask<cylinder3D> vgrid_dims{0u,     0.f,   -constant<scalar>::pi,
-                                    -600.f, 180.f, constant<scalar>::pi,
-                                    600.f};
-        std::array<std::size_t, 3> n_vgrid_bins{1u, 1u, 1u};
-
-        const scalar outer_radius{inner_cyl_rad +
-                                  static_cast<scalar>(cfg.n_layers() + 1) *
-                                      cell_size * 2.f};
-        std::array<std::vector<scalar>, 3UL> bin_edges{
-            std::vector<scalar>{0.f, outer_radius},
-            std::vector<scalar>{-constant<scalar>::pi, constant<scalar>::pi},
-            std::vector<scalar>{-cyl_half_z, cyl_half_z}};
-
-        grid_factory_type<typename detector_t::volume_finder> vgrid_factory{};
-        auto vgrid = vgrid_factory.template new_grid<
-            axis::open<axis::label::e_r>, axis::circular<axis::label::e_phi>,
-            axis::open<axis::label::e_z>, axis::irregular<>, axis::regular<>,
-            axis::irregular<>>(vgrid_dims, n_vgrid_bins, {}, bin_edges);
-        det.set_volume_finder(std::move(vgrid));
+        // Add volume finder
+        using vol_finder_t = typename detector_t::volume_finder;
+        vol_finder_t vol_finder{resource};
+        vol_finder.build(
+            detail::volume_rz_boxes<typename vol_finder_t::box_type>(det));
+        det.set_volume_finder(std::move(vol_finder));
     }
 
     return std::make_pair(std::move(det), std::move(name_map));
@@ -0,0 +1,226 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/units.hpp"
+
+// Covfie include(s)
+#include <covfie/core/parameter_pack.hpp>
+#include <covfie/core/utility/binary_io.hpp>
+#include <covfie/core/vector.hpp>
+
+// System include(s)
+#include <cstdint>
+#include <iostream>
+#include <type_traits>
+
+namespace detray::bfield::detail {
+
+/// @brief Bulirsch's generalized complete elliptic integral
+///
+/// cel(kc, p, c, s) = int_0^{pi/2} (c cos^2 + s sin^2) /
+///                    ((cos^2 + p sin^2) sqrt(cos^2 + kc^2 sin^2)) dphi
+///
+/// Computed by the iterative algorithm of Bulirsch, as given in
+/// N. Derby, S. Olbert, Am. J. Phys. 78 (2010) 229, which converges
+/// quadratically.
+template <typename scalar_t>
+DETRAY_HOST_DEVICE inline scalar_t cel(const scalar_t kc, const scalar_t p,
+                                       const scalar_t c, const scalar_t s) {
+
+    constexpr scalar_t err_tol{
+        std::is_same_v<scalar_t, float> ? scalar_t{1e-4} : scalar_t{1e-8}};
+
+    // Singular on the solenoid current sheet
+    if (kc == 0.f) {
+        return 0.f;
+    }
+
+    scalar_t k{math::abs(kc)};
+    scalar_t pp{p};
+    scalar_t cc{c};
+    scalar_t ss{s};
+    scalar_t em{1.f};
+
+    if (p > 0.f) {
+        pp = math::sqrt(p);
+        ss = s / pp;
+    } else {
+        scalar_t f{kc * kc};
+        scalar_t q{1.f - f};
+        const scalar_t g{1.f - pp};
+        f = f - pp;
+        q = q * (ss - c * pp);
+        pp = math::sqrt(f / g);
+        cc = (c - ss) / g;
+        ss = -q / (g * g * pp) + cc * pp;
+    }
+
+    scalar_t f{cc};
+    cc = cc + ss / pp;
+    scalar_t g{k / pp};
+    ss = 2.f * (ss + f * g);
+    pp = g + pp;
+    g = em;
+    em = k + em;
+    scalar_t kk{k};
+
+    while (math::abs(g - k) > g * err_tol) {
+        k = 2.f * math::sqrt(kk);
+        kk = k * em;
+        f = cc;
+        cc = cc + ss / pp;
+        g = kk / pp;
+        ss = 2.f * (ss + f * g);
+        pp = g + pp;
+        g = em;
+        em = k + em;
+    }
+
+    return constant<scalar_t>::pi_2 * (ss + cc * em) / (em * (em + pp));
+}
+
+/// @brief Covfie backend that computes the field of an ideal, finite
+/// solenoid in closed form.
+///
+/// The solenoid is centered at the origin and its axis is the global z axis.
+/// The field is the one of a cylindrical current sheet (Derby and Olbert),
+/// i.e. it falls off realistically towards the ends of the solenoid and is
+/// defined everywhere outside of it as well. No memory is read, the field is
+/// computed from the three configuration values.
+///
+/// @tparam scalar_t the scalar type of the field computation
+template <typename scalar_t>
+struct solenoid {
+    using this_t = solenoid<scalar_t>;
+    static constexpr bool is_initial = true;
+
+    using contravariant_input_t = covfie::vector::vector_d<scalar_t, 3>;
+    using covariant_output_t = covfie::vector::vector_d<scalar_t, 3>;
+
+    /// Geometry and strength of the solenoid
+    struct configuration_t {
+        /// Radius of the current sheet
+        scalar_t radius{1.f};
+        /// Half length of the solenoid
+        scalar_t half_length{1.f};
+        /// Field in the center of the solenoid
+        scalar_t b_center{0.f};
+    };
+
+    static constexpr std::uint32_t IO_MAGIC_HEADER = 0xDE7A0501;
+
+    struct owning_data_t {
+        using parent_t = this_t;
+
+        owning_data_t() = default;
+
+        explicit owning_data_t(const configuration_t &conf) : m_conf(conf) {}
+
+        explicit owning_data_t(covfie::parameter_pack<configuration_t> &&args)
+            : owning_data_t(args.x) {}
+
+        configuration_t get_configuration() const { return m_conf; }
+
+        static owning_data_t read_binary(std::istream &fs) {
+            covfie::utility::read_io_header(fs, IO_MAGIC_HEADER);
+
+            const auto conf{
+                covfie::utility::read_binary<configuration_t>(fs)};
+
+            covfie::utility::read_io_footer(fs, IO_MAGIC_HEADER);
+
+            return owning_data_t(conf);
+        }
+
+        static void write_binary(std::ostream &fs, const owning_data_t &o) {
+            covfie::utility::write_io_header(fs, IO_MAGIC_HEADER);
+
+            fs.write(reinterpret_cast<const char *>(&o.m_conf),
+                     sizeof(configuration_t));
+
+            covfie::utility::write_io_footer(fs, IO_MAGIC_HEADER);
+        }
+
+        configuration_t m_conf{};
+    };
+
+    struct non_owning_data_t {
+        using parent_t = this_t;
+
+        /// Precompute the constants of the field formula
+        explicit non_owning_data_t(const owning_data_t &src)
+            : m_radius{src.m_conf.radius},
+              m_half_length{src.m_conf.half_length} {
+            // The field in the center is reduced by the finite length,
+            // compared to the infinite solenoid (mu0 * n * I)
+            const scalar_t a{m_radius};
+            const scalar_t b{m_half_length};
+            const scalar_t b_inf{src.m_conf.b_center *
+                                 math::sqrt(a * a + b * b) / b};
+            m_b0 = b_inf * constant<scalar_t>::inv_pi;
+        }
+
+        /// @returns the field at the global position @param p
+        DETRAY_HOST_DEVICE
+        typename covariant_output_t::vector_t at(
+            typename contravariant_input_t::vector_t p) const {
+
+            const scalar_t a{m_radius};
+            const scalar_t rho{math::sqrt(p[0] * p[0] + p[1] * p[1])};
+
+            const scalar_t z_p{p[2] + m_half_length};
+            const scalar_t z_m{p[2] - m_half_length};
+
+            const scalar_t a_p_rho{a + rho};
+            const scalar_t a_m_rho{a - rho};
+            const scalar_t den_p{
+                math::sqrt(z_p * z_p + a_p_rho * a_p_rho)};
+            const scalar_t den_m{
+                math::sqrt(z_m * z_m + a_p_rho * a_p_rho)};
+
+            const scalar_t alpha_p{a / den_p};
+            const scalar_t alpha_m{a / den_m};
+            const scalar_t beta_p{z_p / den_p};
+            const scalar_t beta_m{z_m / den_m};
+            const scalar_t gamma{a_m_rho / a_p_rho};
+
+            const scalar_t k_p{
+                math::sqrt(z_p * z_p + a_m_rho * a_m_rho) / den_p};
+            const scalar_t k_m{
+                math::sqrt(z_m * z_m + a_m_rho * a_m_rho) / den_m};
+
+            const scalar_t b_rho{
+                m_b0 * (alpha_p * cel(k_p, scalar_t{1}, scalar_t{1},
+                                      scalar_t{-1}) -
+                        alpha_m * cel(k_m, scalar_t{1}, scalar_t{1},
+                                      scalar_t{-1}))};
+            const scalar_t b_z{
+                m_b0 * a / a_p_rho *
+                (beta_p * cel(k_p, gamma * gamma, scalar_t{1}, gamma) -
+                 beta_m * cel(k_m, gamma * gamma, scalar_t{1}, gamma))};
+
+            // No radial field on the axis
+            if (rho == 0.f) {
+                return {0.f, 0.f, b_z};
+            }
+
+            return {b_rho * p[0] / rho, b_rho * p[1] / rho, b_z};
+        }
+
+        scalar_t m_radius;
+        scalar_t m_half_length;
+        /// mu0 * n * I / pi
+        scalar_t m_b0;
+    };
+};
+
+}  // namespace detray::bfield::detail
@@ -13,6 +13,7 @@
 #include "detray/definitions/detail/indexing.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/definitions/geometry.hpp"
+#include "detray/geometry/detail/barrel_placement.hpp"
 #include "detray/geometry/mask.hpp"
 #include "detray/geometry/shapes/rectangle2D.hpp"
 #include "detray/materials/material.hpp"
@@ -101,10 +102,8 @@ struct barrel_generator_config {
 template <typename detector_t, typename mask_shape_t = rectangle2D>
 class barrel_generator final : public surface_factory_interface<detector_t> {
 
+    using algebra_t = typename detector_t::algebra_type;
     using scalar_t = typename detector_t::scalar_type;
-    using transform3_t = typename detector_t::transform3_type;
-    using point3_t = typename detector_t::point3_type;
-    using vector3_t = typename detector_t::vector3_type;
 
     public:
     /// Build a barrel layer according to the parameters given in @param cfg
@@ -166,74 +165,31 @@ class barrel_generator final : public surface_factory_interface<detector_t> {
         // Modules link back to mother volume in navigation
         const auto mask_volume_link{static_cast<nav_link_t>(volume_idx)};
 
-        // surface grid bins
-        const unsigned int n_phi_bins{m_cfg.binning().first};
-        const unsigned int n_z_bins{m_cfg.binning().second};
+        // The module placements are computed from the layer parameters
+        const auto layer{
+            placement(static_cast<dindex>(transforms.size(ctx)))};
 
-        // module positions
-        std::vector<point3_t> mod_centers;
-        mod_centers.reserve(n_phi_bins * n_z_bins);
+        // Create geometry data: ring by ring in z, along phi in every ring
+        for (dindex z_bin = 0u; z_bin < m_cfg.binning().second; ++z_bin) {
+            for (dindex phi_bin = 0u; phi_bin < m_cfg.binning().first;
+                 ++phi_bin) {
 
-        // prep work
-        const scalar_t phi_step{2.f * constant<scalar_t>::pi /
-                                static_cast<scalar_t>(n_phi_bins)};
-        const scalar_t min_phi{-constant<scalar_t>::pi + 0.5f * phi_step};
+                // Surfaces with the linking into the local containers
+                mask_link_t mask_link = {mask_id,
+                                         masks.template size<mask_id>()};
+                material_link_t material_link{no_material, 0u};
+                const auto trf_index = transforms.size(ctx);
+                assert(trf_index == layer.transform_index(phi_bin, z_bin));
 
-        // @TODO: Only work for rectangles
-        const scalar_t z_start{
-            -0.5f * static_cast<scalar_t>(n_z_bins - 1u) *
-            (2.f * m_cfg.module_bounds().at(1) - m_cfg.z_overlap())};
-        const scalar_t z_step{(math::abs(z_start) - z_start) /
-                              static_cast<scalar_t>(n_z_bins - 1)};
+                surfaces.push_back({trf_index, mask_link, material_link,
+                                    volume_idx, surface_id::e_sensitive},
+                                   invalid_src_link);
 
-        // loop over the z bins
-        for (unsigned int z_bin = 0u; z_bin < n_z_bins; ++z_bin) {
-
-            // prepare z and r
-            const scalar_t mod_z{z_start +
-                                 static_cast<scalar_t>(z_bin) * z_step};
-            const scalar_t mod_r{
-                (z_bin % 2u) != 0u
-                    ? m_cfg.radius() - 0.5f * m_cfg.radial_stagger()
-                    : m_cfg.radius() + 0.5f * m_cfg.radial_stagger()};
-
-            for (unsigned int phiBin = 0u; phiBin < n_phi_bins; ++phiBin) {
-                // calculate the current phi value
-                const scalar_t mod_phi{min_phi + static_cast<scalar_t>(phiBin) *
-                                                     phi_step};
-                mod_centers.push_back(point3_t{mod_r * math::cos(mod_phi),
-                                               mod_r * math::sin(mod_phi),
-                                               mod_z});
+                // Create the module transform
+                transforms.push_back(layer.transform(phi_bin, z_bin), ctx);
             }
         }
 
-        // Create geometry data
-        for (auto &mod_center : mod_centers) {
-
-            // Surfaces with the linking into the local containers
-            mask_link_t mask_link = {mask_id, masks.template size<mask_id>()};
-            material_link_t material_link{no_material, 0u};
-            const auto trf_index = transforms.size(ctx);
-
-            surfaces.push_back({trf_index, mask_link, material_link, volume_idx,
-                                surface_id::e_sensitive},
-                               invalid_src_link);
-
-            // Build the transform
-            // The local phi
-            const scalar_t mod_phi{algebra::getter::phi(mod_center)};
-            // Local z axis is the normal vector
-            const scalar_t tilt_phi{m_cfg.tilt_phi()};
-            const vector3_t mod_local_z{math::cos(mod_phi + tilt_phi),
-                                        math::sin(mod_phi + tilt_phi), 0.f};
-            // Local x axis the normal to local y,z
-            const vector3_t mod_local_x{-math::sin(mod_phi + tilt_phi),
-                                        math::cos(mod_phi + tilt_phi), 0.f};
-
-            // Create the module transform
-            transforms.emplace_back(ctx, mod_center, mod_local_z, mod_local_x);
-        }
-
         // Add the mask
         masks.template emplace_back<mask_id>(
             empty_context{}, m_cfg.module_bounds(), mask_volume_link);
@@ -241,6 +197,32 @@ class barrel_generator final : public surface_factory_interface<detector_t> {
         return {surfaces_offset, static_cast<dindex>(surfaces.size())};
     }
 
+    /// @returns the procedural placement of the layer modules, if the first
+    /// module has the transform index @param trf_offset
+    DETRAY_HOST
+    auto placement(const dindex trf_offset) const
+        -> detail::barrel_placement<algebra_t> {
+
+        const dindex n_phi_bins{m_cfg.binning().first};
+        const dindex n_z_bins{m_cfg.binning().second};
+
+        // @TODO: Only work for rectangles
+        const scalar_t z_start{
+            -0.5f * static_cast<scalar_t>(n_z_bins - 1u) *
+            (2.f * m_cfg.module_bounds().at(1) - m_cfg.z_overlap())};
+        const scalar_t z_step{(math::abs(z_start) - z_start) /
+                              static_cast<scalar_t>(n_z_bins - 1)};
+
+        return {trf_offset,
+                n_phi_bins,
+                n_z_bins,
+                m_cfg.radius(),
+                m_cfg.radial_stagger(),
+                m_cfg.tilt_phi(),
+                z_start,
+                z_step};
+    }
+
     private:
     /// The generator configuration
     barrel_generator_config<scalar_t> m_cfg{};
@@ -0,0 +1,407 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/detectors/bfield.hpp"
+
+// Covfie include(s)
+#include <covfie/core/backend/primitive/array.hpp>
+#include <covfie/core/backend/transformer/affine.hpp>
+#include <covfie/core/backend/transformer/linear.hpp>
+#include <covfie/core/field.hpp>
+#include <covfie/core/parameter_pack.hpp>
+#include <covfie/core/utility/binary_io.hpp>
+#include <covfie/core/vector.hpp>
+
+// System include(s)
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace detray::bfield {
+
+namespace detail {
+
+/// @brief Covfie backend that stores the field grid in blocks, which are
+/// either constant or dense.
+///
+/// The grid is divided into cubes of @c block_size^3 grid points. A block in
+/// which no field component varies by more than twice the tolerance of the
+/// conversion is stored as a single value, all other blocks keep every grid
+/// point. A block table holds the position of every block in the value pool
+/// and whether it is dense (lowest bit). For field maps of a whole cavern,
+/// where most of the volume outside of the magnets sees a (nearly) constant
+/// or vanishing field, this reduces the memory by up to a factor
+/// @c block_size^3 .
+///
+/// Placed below the @c linear interpolation, like the strided grid it
+/// replaces, so that a lookup reads the block table entry and then a single
+/// value for each of the eight corners of the interpolation cell.
+///
+/// @tparam block_size number of grid points per block and axis
+/// @tparam _table_array_t array backend of the block table (host or device)
+/// @tparam _value_array_t array backend of the value pool (host or device)
+template <std::size_t block_size, typename _table_array_t,
+          typename _value_array_t>
+struct block_sparse {
+    using this_t = block_sparse<block_size, _table_array_t, _value_array_t>;
+    static constexpr bool is_initial = true;
+
+    static_assert(block_size > 0u, "Blocks need at least one grid point");
+
+    using table_array_t = _table_array_t;
+    using value_array_t = _value_array_t;
+
+    using contravariant_input_t = covfie::vector::vector_d<std::size_t, 3>;
+    using covariant_output_t = typename value_array_t::covariant_output_t;
+
+    /// Number of grid points per block and axis
+    static constexpr std::size_t block_dim{block_size};
+    /// Number of grid points per block
+    static constexpr std::size_t block_volume{block_size * block_size *
+                                              block_size};
+
+    /// Size of the grid and of the value pool
+    struct configuration_t {
+        /// Number of grid points per axis
+        std::array<std::size_t, 3> sizes{0u, 0u, 0u};
+        /// Number of stored field values (constant and dense blocks)
+        std::size_t n_values{0u};
+
+        /// @returns the number of blocks along the axis @param i
+        DETRAY_HOST_DEVICE
+        constexpr std::size_t n_blocks(const std::size_t i) const {
+            return (sizes[i] + block_size - 1u) / block_size;
+        }
+
+        /// @returns the total number of blocks
+        DETRAY_HOST_DEVICE
+        constexpr std::size_t n_blocks() const {
+            return n_blocks(0u) * n_blocks(1u) * n_blocks(2u);
+        }
+    };
+
+    static constexpr std::uint32_t IO_MAGIC_HEADER = 0xDE7A5B01;
+
+    struct owning_data_t {
+        using parent_t = this_t;
+
+        owning_data_t() = default;
+
+        /// Allocate the block table and the value pool for the configuration
+        /// @param args (filled by @c sparsify_field )
+        explicit owning_data_t(covfie::parameter_pack<configuration_t> &&args)
+            : m_conf(args.x),
+              m_table(covfie::make_parameter_pack(
+                  typename table_array_t::configuration_t{
+                      m_conf.n_blocks()})),
+              m_values(covfie::make_parameter_pack(
+                  typename value_array_t::configuration_t{m_conf.n_values})) {
+        }
+
+        /// Construct from the configuration, the block table and the values
+        owning_data_t(const configuration_t &conf,
+                      typename table_array_t::owning_data_t &&table,
+                      typename value_array_t::owning_data_t &&values)
+            : m_conf(conf),
+              m_table(std::move(table)),
+              m_values(std::move(values)) {}
+
+        /// Convert from a sparse field with the same block size, but
+        /// different storage (e.g. host to device memory)
+        template <typename T,
+                  std::enable_if_t<!std::is_same_v<T, owning_data_t> &&
+                                       T::parent_t::block_dim == block_dim,
+                                   bool> = true>
+        explicit owning_data_t(const T &o)
+            : m_conf{o.get_configuration().sizes,
+                     o.get_configuration().n_values},
+              m_table(o.get_table()),
+              m_values(o.get_values()) {}
+
+        configuration_t get_configuration() const { return m_conf; }
+
+        typename table_array_t::owning_data_t &get_table() { return m_table; }
+
+        const typename table_array_t::owning_data_t &get_table() const {
+            return m_table;
+        }
+
+        typename value_array_t::owning_data_t &get_values() {
+            return m_values;
+        }
+
+        const typename value_array_t::owning_data_t &get_values() const {
+            return m_values;
+        }
+
+        /// @returns the memory of the block table and the values in bytes
+        std::size_t size_bytes() const {
+            return m_conf.n_blocks() * sizeof(std::uint32_t) +
+                   m_conf.n_values *
+                       sizeof(typename covariant_output_t::vector_t);
+        }
+
+        static owning_data_t read_binary(std::istream &fs) {
+            covfie::utility::read_io_header(fs, IO_MAGIC_HEADER);
+
+            const auto conf{
+                covfie::utility::read_binary<configuration_t>(fs)};
+            auto table{table_array_t::owning_data_t::read_binary(fs)};
+            auto values{value_array_t::owning_data_t::read_binary(fs)};
+
+            covfie::utility::read_io_footer(fs, IO_MAGIC_HEADER);
+
+            return owning_data_t(conf, std::move(table), std::move(values));
+        }
+
+        static void write_binary(std::ostream &fs, const owning_data_t &o) {
+            covfie::utility::write_io_header(fs, IO_MAGIC_HEADER);
+
+            fs.write(reinterpret_cast<const char *>(&o.m_conf),
+                     sizeof(configuration_t));
+            table_array_t::owning_data_t::write_binary(fs, o.m_table);
+            value_array_t::owning_data_t::write_binary(fs, o.m_values);
+
+            covfie::utility::write_io_footer(fs, IO_MAGIC_HEADER);
+        }
+
+        configuration_t m_conf{};
+        typename table_array_t::owning_data_t m_table{};
+        typename value_array_t::owning_data_t m_values{};
+    };
+
+    struct non_owning_data_t {
+        using parent_t = this_t;
+
+        explicit non_owning_data_t(const owning_data_t &src)
+            : m_conf(src.m_conf),
+              m_table(src.m_table),
+              m_values(src.m_values) {}
+
+        /// @returns the field at the grid point @param c
+        DETRAY_HOST_DEVICE
+        typename covariant_output_t::vector_t at(
+            typename contravariant_input_t::vector_t c) const {
+            return m_values.at({value_index(c)});
+        }
+
+        /// @returns the position of the grid point @param c in the value pool
+        DETRAY_HOST_DEVICE
+        std::size_t value_index(
+            typename contravariant_input_t::vector_t c) const {
+
+            const std::size_t block{
+                (c[0] / block_size * m_conf.n_blocks(1u) + c[1] / block_size) *
+                    m_conf.n_blocks(2u) +
+                c[2] / block_size};
+            const std::uint32_t entry{m_table.at({block})[0]};
+            const std::size_t offset{entry >> 1u};
+
+            // Constant block
+            if ((entry & 1u) == 0u) {
+                return offset;
+            }
+
+            return offset +
+                   ((c[0] % block_size) * block_size + c[1] % block_size) *
+                       block_size +
+                   c[2] % block_size;
+        }
+
+        typename table_array_t::non_owning_data_t &get_table() {
+            return m_table;
+        }
+
+        typename value_array_t::non_owning_data_t &get_values() {
+            return m_values;
+        }
+
+        configuration_t m_conf;
+        typename table_array_t::non_owning_data_t m_table;
+        typename value_array_t::non_owning_data_t m_values;
+    };
+};
+
+/// Block table of the sparse field (host)
+using sparse_table_t =
+    covfie::backend::array<covfie::vector::vector_d<std::uint32_t, 1>>;
+
+/// Value pool of the sparse field (host)
+using sparse_values_t =
+    covfie::backend::array<covfie::vector::vector_d<detray::scalar, 3>>;
+
+}  // namespace detail
+
+/// Inhomogeneous field with constant blocks stored only once (host)
+template <std::size_t block_size = 4u>
+using sparse_bknd_t = covfie::backend::affine<
+    covfie::backend::linear<detail::block_sparse<
+        block_size, detail::sparse_table_t, detail::sparse_values_t>>>;
+
+using inhom_sparse_bknd_t = sparse_bknd_t<>;
+using inhom_sparse_field_t = covfie::field<inhom_sparse_bknd_t>;
+
+/// @returns the sparse version of the field @param field
+///
+/// Every block of grid points, in which no field component deviates by more
+/// than @param tolerance from the center of its range, is replaced by that
+/// central value. The other blocks are kept unchanged. The field keeps the
+/// grid and the affine transformation of the original field.
+template <typename sparse_field_t = inhom_sparse_field_t>
+inline sparse_field_t sparsify_field(const inhom_field_t &field,
+                                     const detray::scalar tolerance) {
+
+    using affine_t = typename sparse_field_t::backend_t;
+    using linear_t = typename affine_t::backend_t;
+    using sparse_t = typename linear_t::backend_t;
+    using configuration_t = typename sparse_t::configuration_t;
+
+    constexpr std::size_t bs{sparse_t::block_dim};
+
+    // Full precision grid
+    const auto &src_affine = field.backend();
+    const auto &src_strided = src_affine.get_backend().get_backend();
+    const auto sizes = src_strided.get_configuration();
+    const typename std::decay_t<decltype(src_strided)>::parent_t::
+        non_owning_data_t src(src_strided);
+
+    configuration_t conf{};
+    conf.sizes = {sizes[0], sizes[1], sizes[2]};
+
+    // @returns the grid point at the block index and the position in the
+    // block, clamped to the grid (edge blocks are padded)
+    auto grid_point = [&conf](const std::array<std::size_t, 3> &b,
+                              const std::array<std::size_t, 3> &l) {
+        std::array<std::size_t, 3> c{};
+        for (std::size_t a = 0u; a < 3u; ++a) {
+            c[a] = math::min(b[a] * bs + l[a], conf.sizes[a] - 1u);
+        }
+        return c;
+    };
+
+    // Classify the blocks
+    std::vector<std::uint32_t> table(conf.n_blocks());
+    std::vector<std::array<detray::scalar, 3>> constants(conf.n_blocks());
+    std::size_t n_values{0u};
+
+    std::array<std::size_t, 3> b{};
+    for (b[0] = 0u; b[0] < conf.n_blocks(0u); ++b[0]) {
+        for (b[1] = 0u; b[1] < conf.n_blocks(1u); ++b[1]) {
+            for (b[2] = 0u; b[2] < conf.n_blocks(2u); ++b[2]) {
+                const std::size_t block{
+                    (b[0] * conf.n_blocks(1u) + b[1]) * conf.n_blocks(2u) +
+                    b[2]};
+
+                std::array<detray::scalar, 3> lo{}, hi{};
+                bool first{true};
+                std::array<std::size_t, 3> l{};
+                for (l[0] = 0u; l[0] < bs; ++l[0]) {
+                    for (l[1] = 0u; l[1] < bs; ++l[1]) {
+                        for (l[2] = 0u; l[2] < bs; ++l[2]) {
+                            const auto c = grid_point(b, l);
+                            const auto &v = src.at({c[0], c[1], c[2]});
+                            for (std::size_t i = 0u; i < 3u; ++i) {
+                                const auto vi{
+                                    static_cast<detray::scalar>(v[i])};
+                                lo[i] = first ? vi : math::min(lo[i], vi);
+                                hi[i] = first ? vi : math::max(hi[i], vi);
+                            }
+                            first = false;
+                        }
+                    }
+                }
+
+                bool is_const{true};
+                for (std::size_t i = 0u; i < 3u; ++i) {
+                    is_const &= (hi[i] - lo[i] <= 2.f * tolerance);
+                    constants[block][i] = 0.5f * (lo[i] + hi[i]);
+                }
+
+                table[block] = static_cast<std::uint32_t>(n_values << 1u) |
+                               (is_const ? 0u : 1u);
+                n_values += is_const ? 1u : sparse_t::block_volume;
+            }
+        }
+    }
+    // The lowest bit of a table entry is the block type
+    if (n_values >= (std::size_t{1u} << 31u)) {
+        throw std::length_error("Sparse field map too large");
+    }
+    conf.n_values = n_values;
+
+    sparse_field_t sparse{covfie::make_parameter_pack(
+        src_affine.get_configuration(), typename linear_t::configuration_t{},
+        conf)};
+
+    // Fill the block table and the value pool
+    typename sparse_t::non_owning_data_t dst(
+        sparse.backend().get_backend().get_backend());
+
+    for (std::size_t block = 0u; block < table.size(); ++block) {
+        dst.get_table().at({block})[0] = table[block];
+    }
+
+    for (b[0] = 0u; b[0] < conf.n_blocks(0u); ++b[0]) {
+        for (b[1] = 0u; b[1] < conf.n_blocks(1u); ++b[1]) {
+            for (b[2] = 0u; b[2] < conf.n_blocks(2u); ++b[2]) {
+                const std::size_t block{
+                    (b[0] * conf.n_blocks(1u) + b[1]) * conf.n_blocks(2u) +
+                    b[2]};
+                const std::size_t offset{table[block] >> 1u};
+
+                if ((table[block] & 1u) == 0u) {
+                    auto &v = dst.get_values().at({offset});
+                    for (std::size_t i = 0u; i < 3u; ++i) {
+                        v[i] = constants[block][i];
+                    }
+                    continue;
+                }
+
+                std::size_t n{offset};
+                std::array<std::size_t, 3> l{};
+                for (l[0] = 0u; l[0] < bs; ++l[0]) {
+                    for (l[1] = 0u; l[1] < bs; ++l[1]) {
+                        for (l[2] = 0u; l[2] < bs; ++l[2]) {
+                            const auto c = grid_point(b, l);
+                            const auto &src_v = src.at({c[0], c[1], c[2]});
+                            auto &v = dst.get_values().at({n++});
+                            for (std::size_t i = 0u; i < 3u; ++i) {
+                                v[i] = static_cast<detray::scalar>(src_v[i]);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return sparse;
+}
+
+/// @returns a sparse field map, read from the full precision field file in
+/// the environment variable 'DETRAY_BFIELD_FILE'
+///
+/// @param tolerance the largest deviation of a field component in the
+///                  constant blocks
+template <typename sparse_field_t = inhom_sparse_field_t>
+inline sparse_field_t create_sparse_inhom_field(
+    const detray::scalar tolerance) {
+    return sparsify_field<sparse_field_t>(create_inhom_field(), tolerance);
+}
+
+}  // namespace detray::bfield
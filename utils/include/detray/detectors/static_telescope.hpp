@@ -0,0 +1,156 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/geometry/detail/surface_descriptor.hpp"
+#include "detray/navigation/detail/helix.hpp"
+#include "detray/navigation/detail/ray.hpp"
+#include "detray/navigation/intersection/helix_intersector.hpp"
+#include "detray/navigation/intersection/intersection.hpp"
+#include "detray/navigation/intersection/ray_intersector.hpp"
+#include "detray/utils/tuple.hpp"
+
+// System include(s)
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace detray {
+
+/// @brief Telescope of planes with a geometry that is fixed at compile time.
+///
+/// Meant for small, fixed setups like test-beam telescopes, where the
+/// generic detector (vecmem containers, runtime mask dispatch and the
+/// navigator) is more than is needed. The planes are placed perpendicular to
+/// the z-axis at the given positions, and every plane has its own mask type,
+/// so that the mask of a plane is known at compile time. The data is held in
+/// fixed size arrays and can be @c constexpr .
+///
+/// A trajectory is intersected with all planes at once: The loop over the
+/// planes is unrolled and the mask checks are dispatched statically. The
+/// telescope is trivially copyable and can be passed to a device kernel by
+/// value.
+///
+/// @tparam algebra_t the algebra type
+/// @tparam mask_ts the mask types of the planes, in the order of the planes
+template <typename algebra_t, typename... mask_ts>
+class static_telescope {
+
+    public:
+    using algebra_type = algebra_t;
+    using scalar_type = dscalar<algebra_t>;
+    using point3_type = dpoint3D<algebra_t>;
+    using transform3_type = dtransform3D<algebra_t>;
+    using intersection_type = intersection2D<surface_descriptor<>, algebra_t>;
+
+    /// Number of planes
+    static constexpr std::size_t n_planes{sizeof...(mask_ts)};
+
+    static_assert(n_planes > 0u, "Telescope needs at least one plane");
+
+    /// Intersections of a trajectory with every plane
+    using hits_type = darray<intersection_type, n_planes>;
+
+    /// Construct from the plane positions @param positions along the z-axis
+    /// and the masks @param masks of the planes
+    DETRAY_HOST_DEVICE
+    constexpr static_telescope(const darray<scalar_type, n_planes> &positions,
+                               const mask_ts &... masks)
+        : m_positions{positions}, m_masks{masks...} {}
+
+    /// @returns the position of the plane @param i along the z-axis
+    DETRAY_HOST_DEVICE
+    constexpr scalar_type position(const std::size_t i) const {
+        return m_positions[i];
+    }
+
+    /// @returns the mask of the plane @tparam I
+    template <std::size_t I>
+    DETRAY_HOST_DEVICE const auto &get_mask() const {
+        return detray::get<I>(m_masks);
+    }
+
+    /// @returns the placement of the plane @param i
+    DETRAY_HOST_DEVICE
+    transform3_type transform(const std::size_t i) const {
+        return transform3_type{point3_type{0.f, 0.f, m_positions[i]}};
+    }
+
+    /// Intersect the trajectory @param traj with every plane
+    ///
+    /// @param traj a ray or a helix
+    /// @param mask_tolerance the tolerance on the edges of the masks
+    ///
+    /// @returns the intersections in the order of the planes (the plane
+    /// index is the index in the array). Missed planes have an outside or
+    /// undefined intersection status.
+    template <typename trajectory_t>
+    DETRAY_HOST_DEVICE hits_type
+    intersect(const trajectory_t &traj,
+              const scalar_type mask_tolerance = 0.f) const {
+        hits_type hits{};
+        intersect(traj, mask_tolerance, hits,
+                  std::make_index_sequence<n_planes>{});
+        return hits;
+    }
+
+    /// @returns the number of planes that were hit inside of their masks
+    DETRAY_HOST_DEVICE
+    static std::size_t n_hits(const hits_type &hits) {
+        std::size_t n{0u};
+        for (const intersection_type &hit : hits) {
+            n += (hit.status == intersection::status::e_inside) ? 1u : 0u;
+        }
+        return n;
+    }
+
+    private:
+    /// Unrolled loop over the planes
+    template <typename trajectory_t, std::size_t... I>
+    DETRAY_HOST_DEVICE void intersect(
+        const trajectory_t &traj, const scalar_type mask_tolerance,
+        hits_type &hits, std::index_sequence<I...> /*seq*/) const {
+        ((hits[I] = intersect_plane<I>(traj, mask_tolerance)), ...);
+    }
+
+    /// @returns the intersection of @param traj with the plane @tparam I
+    template <std::size_t I, typename trajectory_t>
+    DETRAY_HOST_DEVICE intersection_type
+    intersect_plane(const trajectory_t &traj,
+                    const scalar_type mask_tolerance) const {
+
+        using mask_t = std::decay_t<decltype(detray::get<I>(m_masks))>;
+        using shape_t = typename mask_t::shape;
+
+        const transform3_type trf{transform(I)};
+
+        if constexpr (std::is_same_v<trajectory_t,
+                                     detail::helix<algebra_t>>) {
+            return helix_intersector<shape_t, algebra_t>{}(
+                traj, surface_descriptor<>{}, get_mask<I>(), trf,
+                mask_tolerance);
+        } else {
+            static_assert(std::is_same_v<trajectory_t, detail::ray<algebra_t>>,
+                          "Only rays and helices can be intersected");
+            return ray_intersector<shape_t, algebra_t>{}(
+                traj, surface_descriptor<>{}, get_mask<I>(), trf,
+                mask_tolerance);
+        }
+    }
+
+    /// Positions of the planes along the z-axis
+    darray<scalar_type, n_planes> m_positions{};
+    /// Masks of the planes
+    dtuple<mask_ts...> m_masks{};
+};
+
+}  // namespace detray
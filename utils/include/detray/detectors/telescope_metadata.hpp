@@ -18,6 +18,7 @@
 #include "detray/materials/material_rod.hpp"
 #include "detray/materials/material_slab.hpp"
 #include "detray/navigation/accelerators/brute_force_finder.hpp"
+#include "detray/navigation/accelerators/sorted_plane_finder.hpp"
 
 namespace detray {
 
@@ -110,7 +111,8 @@ struct telescope_metadata {
     using surface_type =
         surface_descriptor<mask_link, material_link, transform_link, nav_link>;
 
-    /// No grids/other acceleration data structure, everything is brute forced
+    /// The portals are brute forced, the modules can be sorted along the
+    /// telescope axis
     enum geo_objects : std::uint8_t {
         e_portal = 0,
         e_sensitive = 1,
@@ -121,19 +123,21 @@ struct telescope_metadata {
     /// Acceleration data structures
     enum class accel_ids {
         e_brute_force = 0,  // test all surfaces in a volume (brute force)
+        e_sorted_planes = 1,  // next planes along the telescope axis
         e_default = e_brute_force,
     };
 
-    /// One link for all surfaces (in the brute force method)
+    /// One link for the portals and one for the modules
     using object_link_type =
         dmulti_index<dtyped_index<accel_ids, dindex>, geo_objects::e_size>;
 
-    /// How to store the brute force search data structure
+    /// How to store the search data structures
     template <template <typename...> class tuple_t = dtuple,
               typename container_t = host_container_types>
     using accelerator_store =
         multi_store<accel_ids, empty_context, tuple_t,
-                    brute_force_collection<surface_type, container_t>>;
+                    brute_force_collection<surface_type, container_t>,
+                    sorted_plane_collection<surface_type, container_t>>;
 
     /// Volume search (only one volume exists)
     template <typename container_t = host_container_types>
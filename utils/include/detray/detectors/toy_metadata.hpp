@@ -8,8 +8,8 @@
 #pragma once
 
 // Project include(s)
+#include "detray/core/detail/multi_context_store.hpp"
 #include "detray/core/detail/multi_store.hpp"
-#include "detray/core/detail/single_store.hpp"
 #include "detray/definitions/detail/containers.hpp"
 #include "detray/definitions/detail/indexing.hpp"
 #include "detray/geometry/detail/surface_descriptor.hpp"
@@ -21,7 +21,9 @@
 #include "detray/materials/material_map.hpp"
 #include "detray/materials/material_slab.hpp"
 #include "detray/navigation/accelerators/brute_force_finder.hpp"
+#include "detray/navigation/accelerators/concentric_portal_finder.hpp"
 #include "detray/navigation/accelerators/surface_grid.hpp"
+#include "detray/navigation/accelerators/two_level_volume_finder.hpp"
 
 namespace detray {
 
@@ -79,7 +81,8 @@ struct toy_metadata {
     /// How to store coordinate transform matrices
     template <template <typename...> class vector_t = dvector>
     using transform_store =
-        single_store<dtransform3D<algebra_type>, vector_t, geometry_context>;
+        multi_context_store<dtransform3D<algebra_type>, vector_t,
+                            geometry_context>;
 
     /// Mask type ids
     enum class mask_ids : std::uint8_t {
@@ -124,7 +127,8 @@ struct toy_metadata {
     using surface_type =
         surface_descriptor<mask_link, material_link, transform_link, nav_link>;
 
-    /// Portals and passives in the brute froce search, sensitives in the grids
+    /// Portals and passives in the brute froce search (or the concentric
+    /// portal index), sensitives in the grids
     enum geo_objects : std::uint8_t {
         e_portal = 0,
         e_passive = 0,
@@ -135,9 +139,10 @@ struct toy_metadata {
 
     /// Acceleration data structures
     enum class accel_ids : std::uint8_t {
-        e_brute_force = 0,     // test all surfaces in a volume (brute force)
-        e_disc_grid = 1,       // endcap
-        e_cylinder2_grid = 2,  // barrel
+        e_brute_force = 0,         // test all surfaces in a volume (brute force)
+        e_disc_grid = 1,           // endcap
+        e_cylinder2_grid = 2,      // barrel
+        e_concentric_portals = 3,  // portals by radius and z
         e_default = e_brute_force,
     };
 
@@ -152,14 +157,14 @@ struct toy_metadata {
         accel_ids, empty_context, tuple_t,
         brute_force_collection<surface_type, container_t>,
         grid_collection<disc_sf_grid<surface_type, container_t>>,
-        grid_collection<cylinder_sf_grid<surface_type, container_t>>>;
+        grid_collection<cylinder_sf_grid<surface_type, container_t>>,
+        concentric_portal_collection<surface_type, container_t>>;
 
-    /// Volume search grid
+    /// Volume search data structure (coarse r-z grid with per-cell volume
+    /// lists)
     template <typename container_t = host_container_types>
     using volume_finder =
-        grid<axes<cylinder3D, axis::bounds::e_open, axis::irregular,
-                  axis::regular, axis::irregular>,
-             bins::single<dindex>, simple_serializer, container_t>;
+        two_level_volume_finder<container_t, dscalar<algebra_type>>;
 };
 
 }  // namespace detray
@@ -0,0 +1,260 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/propagator/propagation_batch.hpp"
+#include "detray/simulation/event_generator/random_track_generator.hpp"
+#include "detray/simulation/philox_generator.hpp"
+#include "detray/utils/ranges/ranges.hpp"
+
+// System include(s)
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace detray {
+
+/// @brief Generates track states with random momentum directions that can be
+/// split into independent sub-ranges.
+///
+/// Same track distributions as the @c random_track_generator with uniformly
+/// distributed momentum and angles, but the random numbers of a track are
+/// drawn from a counter-based @c philox_generator that is keyed by the seed
+/// and the index of the track. Every track can therefore be generated on its
+/// own, without generating the preceding tracks first: The generator is a
+/// light-weight, copyable view with random access, which can be partitioned
+/// into sub-ranges (e.g. one per host thread) or indexed by the global thread
+/// index in a device kernel. The tracks do not depend on the partitioning.
+///
+/// @tparam track_t the type of track parametrization that should be used.
+template <typename track_t>
+class splittable_track_generator
+    : public detray::ranges::view_interface<
+          splittable_track_generator<track_t>> {
+
+    using point3 = typename track_t::point3_type;
+    using vector3 = typename track_t::vector3_type;
+
+    public:
+    /// Same configuration as the random track generator
+    using configuration =
+        typename random_track_generator<track_t>::configuration;
+
+    private:
+    /// @brief Nested iterator type that generates track states by index.
+    struct iterator {
+
+        using difference_type = std::ptrdiff_t;
+        using value_type = track_t;
+        using pointer = track_t*;
+        using reference = track_t&;
+        using iterator_category = detray::ranges::random_access_iterator_tag;
+
+        constexpr iterator() = default;
+
+        DETRAY_HOST_DEVICE
+        constexpr iterator(const splittable_track_generator* gen,
+                           std::size_t i)
+            : m_gen{gen}, m_idx{i} {}
+
+        /// @returns whether we reached the end of iteration
+        DETRAY_HOST_DEVICE
+        constexpr bool operator==(const iterator& rhs) const {
+            return rhs.m_idx == m_idx;
+        }
+
+        /// @returns whether we reached the end of iteration
+        DETRAY_HOST_DEVICE
+        constexpr bool operator!=(const iterator& rhs) const {
+            return not(*this == rhs);
+        }
+
+        /// Random access iteration
+        /// @{
+        DETRAY_HOST_DEVICE
+        constexpr auto operator++() -> iterator& {
+            ++m_idx;
+            return *this;
+        }
+        DETRAY_HOST_DEVICE
+        constexpr auto operator--() -> iterator& {
+            --m_idx;
+            return *this;
+        }
+        DETRAY_HOST_DEVICE
+        constexpr auto operator+=(const difference_type j) -> iterator& {
+            m_idx = static_cast<std::size_t>(
+                static_cast<difference_type>(m_idx) + j);
+            return *this;
+        }
+        DETRAY_HOST_DEVICE
+        constexpr auto operator+(const difference_type j) const -> iterator {
+            iterator tmp{*this};
+            return tmp += j;
+        }
+        DETRAY_HOST_DEVICE
+        constexpr auto operator-(const iterator& rhs) const
+            -> difference_type {
+            return static_cast<difference_type>(m_idx) -
+                   static_cast<difference_type>(rhs.m_idx);
+        }
+        /// @}
+
+        /// @returns the track with the current index
+        DETRAY_HOST_DEVICE
+        track_t operator*() const { return m_gen->generate(m_idx); }
+
+        /// Generator that owns the configuration
+        const splittable_track_generator* m_gen{nullptr};
+
+        /// Global index of the current track
+        std::size_t m_idx{0u};
+    };
+
+    public:
+    using iterator_t = iterator;
+
+    /// Default constructor
+    constexpr splittable_track_generator() = default;
+
+    /// Construct from external configuration @param cfg: Generates the
+    /// tracks [0, n_tracks)
+    DETRAY_HOST_DEVICE
+    constexpr splittable_track_generator(const configuration& cfg)
+        : m_cfg{cfg}, m_begin{0u}, m_end{cfg.n_tracks()} {}
+
+    /// Construct the sub-range [@param begin, @param end) of the tracks
+    /// from external configuration @param cfg
+    DETRAY_HOST_DEVICE
+    constexpr splittable_track_generator(const configuration& cfg,
+                                         std::size_t begin, std::size_t end)
+        : m_cfg{cfg}, m_begin{begin}, m_end{end} {
+        assert(begin <= end);
+        assert(end <= cfg.n_tracks());
+    }
+
+    /// Access the configuration
+    DETRAY_HOST_DEVICE
+    constexpr const configuration& config() const { return m_cfg; }
+
+    /// @returns the first track of the range
+    DETRAY_HOST_DEVICE
+    constexpr auto begin() const noexcept -> iterator {
+        return {this, m_begin};
+    }
+
+    /// @returns the end of the range
+    DETRAY_HOST_DEVICE
+    constexpr auto end() const noexcept -> iterator { return {this, m_end}; }
+
+    /// @returns the number of tracks in the range
+    DETRAY_HOST_DEVICE
+    constexpr auto size() const noexcept -> std::size_t {
+        return m_end - m_begin;
+    }
+
+    /// @returns the global index of the first track of the range
+    DETRAY_HOST_DEVICE
+    constexpr std::size_t offset() const noexcept { return m_begin; }
+
+    /// @returns the track @param i of the range
+    DETRAY_HOST_DEVICE
+    track_t operator[](const std::size_t i) const {
+        assert(i < size());
+        return generate(m_begin + i);
+    }
+
+    /// @returns the sub-range @param part of @param n_parts sub-ranges of
+    /// almost equal size (the first sub-ranges get one more track, if the
+    /// tracks cannot be distributed evenly)
+    DETRAY_HOST_DEVICE
+    constexpr splittable_track_generator subrange(
+        const std::size_t part, const std::size_t n_parts) const {
+        assert(n_parts > 0u);
+        assert(part < n_parts);
+
+        const std::size_t n{size() / n_parts};
+        const std::size_t rest{size() % n_parts};
+
+        const std::size_t first{m_begin + part * n +
+                                (part < rest ? part : rest)};
+        const std::size_t last{first + n + (part < rest ? 1u : 0u)};
+
+        return {m_cfg, first, last};
+    }
+
+    /// Generate the tracks of the range in place.
+    ///
+    /// @param tracks the output range, with at least @c size() elements
+    /// @param exec the executor that distributes the track indices (e.g.
+    ///             over the host threads)
+    template <typename track_range_t,
+              typename executor_t = propagation::sequential_executor>
+    DETRAY_HOST_DEVICE void fill(track_range_t& tracks,
+                                 const executor_t& exec = {}) const {
+        assert(tracks.size() >= size());
+
+        exec(static_cast<unsigned int>(size()), [&](const unsigned int i) {
+            tracks[i] = generate(m_begin + i);
+        });
+    }
+
+    /// @returns the track with the global index @param trk
+    DETRAY_HOST_DEVICE
+    track_t generate(const std::size_t trk) const {
+
+        philox_generator rand_gen{static_cast<std::uint64_t>(m_cfg.seed()),
+                                  static_cast<std::uint64_t>(trk)};
+
+        point3 vtx = m_cfg.origin();
+        if (m_cfg.do_vertex_smearing()) {
+            const point3& stddev = m_cfg.origin_stddev();
+            for (unsigned int i = 0u; i < 3u; ++i) {
+                vtx[i] = detail::normal_random(rand_gen, vtx[i], stddev[i]);
+            }
+        }
+
+        const std::array<scalar, 2>& phi_rng = m_cfg.phi_range();
+        const std::array<scalar, 2>& theta_rng = m_cfg.theta_range();
+        const std::array<scalar, 2>& mom_rng = m_cfg.mom_range();
+
+        const scalar p_mag{math::max(
+            detail::uniform_random(rand_gen, mom_rng[0], mom_rng[1]),
+            scalar{0.f})};
+        const scalar phi{
+            detail::uniform_random(rand_gen, phi_rng[0], phi_rng[1])};
+        const scalar theta{
+            detail::uniform_random(rand_gen, theta_rng[0], theta_rng[1])};
+        const scalar sin_theta{math::sin(theta)};
+
+        // Momentum direction from angles
+        vector3 mom{math::cos(phi) * sin_theta, math::sin(phi) * sin_theta,
+                    math::cos(theta)};
+        // Magnitude of momentum
+        vector::normalize(mom);
+
+        mom = (m_cfg.is_pT() ? 1.f / sin_theta : 1.f) * p_mag * mom;
+
+        return track_t{vtx, m_cfg.time(), mom, m_cfg.charge()};
+    }
+
+    private:
+    configuration m_cfg{};
+
+    /// Global index range of the tracks
+    std::size_t m_begin{0u};
+    std::size_t m_end{0u};
+};
+
+}  // namespace detray
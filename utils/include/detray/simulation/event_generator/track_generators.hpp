@@ -9,4 +9,5 @@
 
 // Project include(s)
 #include "detray/simulation/event_generator/random_track_generator.hpp"
+#include "detray/simulation/event_generator/splittable_track_generator.hpp"
 #include "detray/simulation/event_generator/uniform_track_generator.hpp"
@@ -0,0 +1,156 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/actors/aborters.hpp"
+#include "detray/propagator/actors/parameter_resetter.hpp"
+#include "detray/propagator/actors/parameter_transporter.hpp"
+#include "detray/propagator/base_actor.hpp"
+#include "detray/propagator/propagation_batch.hpp"
+#include "detray/propagator/propagation_config.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/simulation/hit_collection.hpp"
+#include "detray/simulation/hit_recorder.hpp"
+#include "detray/simulation/random_scatterer.hpp"
+#include "detray/utils/tuple.hpp"
+
+// System include(s).
+#include <cstdint>
+#include <limits>
+
+namespace detray {
+
+/// Configuration of the fast simulation
+template <typename scalar_t>
+struct fast_simulation_config {
+    /// Propagation setup
+    propagation::config<scalar_t> propagation{};
+    /// Event number (seed of the random number streams)
+    std::uint64_t event{0u};
+    /// Maximal path length of a track
+    scalar_t path_limit{std::numeric_limits<scalar_t>::max()};
+    /// Particle hypothesis (default muon)
+    scalar_t mass{105.7f * unit<scalar_t>::MeV};
+    int pdg{13};
+    /// Material interactions
+    bool do_energy_loss{true};
+    bool do_multiple_scattering{true};
+};
+
+/// @brief Fast simulation of a batch of tracks.
+///
+/// Propagates every track through the detector with the @c random_scatterer ,
+/// which samples the energy loss and the multiple scattering on the material
+/// surfaces, and records the hits on the sensitive surfaces in a preallocated
+/// @c hit_collection (see @c hit_recorder ). The random numbers of a track
+/// are drawn from a counter-based generator that is keyed by the event
+/// number and the index of the track in the batch, so the simulated hits do
+/// not depend on the executor that distributes the tracks (sequentially or
+/// on multiple threads on host, one track per thread on device).
+///
+/// @tparam stepper_t the stepper type
+/// @tparam navigator_t the navigator type, with a candidate cache of fixed
+///                     capacity for device code
+template <typename stepper_t, typename navigator_t>
+class fast_simulator {
+
+    public:
+    using algebra_type = typename stepper_t::algebra_type;
+    using scalar_type = dscalar<algebra_type>;
+    using detector_type = typename navigator_t::detector_type;
+    using free_track_parameters_type =
+        typename stepper_t::free_track_parameters_type;
+
+    using scatterer_type = random_scatterer<algebra_type>;
+    using recorder_type = hit_recorder<algebra_type>;
+    using hit_collection_type = typename recorder_type::hit_collection_type;
+
+    /// The hits are recorded after the material interaction on a surface
+    using actor_chain_type =
+        actor_chain<dtuple, pathlimit_aborter,
+                    parameter_transporter<algebra_type>,
+                    composite_actor<dtuple, scatterer_type, recorder_type>,
+                    parameter_resetter<algebra_type>>;
+    using propagator_type =
+        propagator<stepper_t, navigator_t, actor_chain_type>;
+
+    using config = fast_simulation_config<scalar_type>;
+
+    /// Construct from the simulation configuration @param cfg
+    DETRAY_HOST_DEVICE
+    explicit fast_simulator(const config &cfg) : m_cfg{cfg} {}
+
+    /// @returns the simulation configuration
+    DETRAY_HOST_DEVICE
+    const config &get_config() const { return m_cfg; }
+
+    /// Simulate the batch of tracks @param tracks and record their hits.
+    ///
+    /// @param tracks the initial track parameters
+    /// @param hits_view view of the hit collection, with at least one track
+    ///                  slot per track
+    /// @param exec the executor that distributes the tracks
+    /// @param args the arguments for the propagation state construction,
+    ///             i.e. the detector or the magnetic field and the detector
+    template <typename track_range_t,
+              typename executor_t = propagation::sequential_executor,
+              typename... state_args_t>
+    DETRAY_HOST_DEVICE void simulate(
+        const track_range_t &tracks,
+        typename hit_collection_type::view_type hits_view,
+        const executor_t &exec, const state_args_t &... args) const {
+
+        exec(static_cast<unsigned int>(tracks.size()),
+             [&](const unsigned int i) {
+                 simulate_track(tracks[i], i, hits_view, args...);
+             });
+    }
+
+    /// Simulate the track @param track with the index @param trk in the
+    /// batch and record its hits.
+    ///
+    /// @returns whether the track left the detector
+    template <typename... state_args_t>
+    DETRAY_HOST_DEVICE bool simulate_track(
+        const free_track_parameters_type &track, const unsigned int trk,
+        typename hit_collection_type::view_type hits_view,
+        const state_args_t &... args) const {
+
+        pathlimit_aborter::state aborter_state{};
+        aborter_state.set_path_limit(m_cfg.path_limit);
+        typename parameter_transporter<algebra_type>::state transporter_state{};
+        typename parameter_resetter<algebra_type>::state resetter_state{};
+
+        typename scatterer_type::state scatterer_state{m_cfg.event, trk};
+        scatterer_state.mass = m_cfg.mass;
+        scatterer_state.pdg = m_cfg.pdg;
+        scatterer_state.do_energy_loss = m_cfg.do_energy_loss;
+        scatterer_state.do_multiple_scattering = m_cfg.do_multiple_scattering;
+
+        typename recorder_type::state recorder_state{hits_view, trk,
+                                                     track.time()};
+
+        auto actor_states =
+            detray::tie(aborter_state, transporter_state, scatterer_state,
+                        recorder_state, resetter_state);
+
+        propagator_type p{m_cfg.propagation};
+        typename propagator_type::state propagation(track, args...);
+
+        return p.propagate(propagation, actor_states);
+    }
+
+    private:
+    config m_cfg{};
+};
+
+}  // namespace detray
@@ -0,0 +1,191 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/geometry/barcode.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <cassert>
+#include <type_traits>
+
+namespace detray {
+
+/// A simulated hit on a sensitive surface
+template <typename algebra_t>
+struct simulated_hit {
+    using scalar_type = dscalar<algebra_t>;
+    using point2_type = dpoint2D<algebra_t>;
+
+    /// The surface that was hit
+    geometry::barcode barcode{};
+    /// Bound local position on the surface
+    point2_type local{0.f, 0.f};
+    /// Time of the hit (in mm, i.e. time times the speed of light)
+    scalar_type time{0.f};
+    /// Energy that the particle deposited in the surface material
+    scalar_type energy_deposit{0.f};
+};
+
+/// @brief Preallocated structure-of-arrays buffer of simulated hits.
+///
+/// Every track of a batch owns a fixed number of consecutive hit slots, so
+/// that the hits can be recorded concurrently without atomics and in an order
+/// that does not depend on the scheduling of the tracks. The number of hits
+/// of every track is counted beyond the capacity, so that an overflow can be
+/// detected after the simulation (the surplus hits are dropped).
+///
+/// @tparam algebra_t the algebra type of the local positions
+/// @tparam container_t the vector type of the columns (host or device)
+template <typename algebra_t,
+          template <typename...> class container_t = dvector>
+class hit_collection {
+
+    public:
+    using scalar_type = dscalar<algebra_t>;
+    using point2_type = dpoint2D<algebra_t>;
+    using value_type = simulated_hit<algebra_t>;
+    using size_type = unsigned int;
+
+    /// Vecmem view types
+    using view_type =
+        dmulti_view<dvector_view<geometry::barcode>, dvector_view<point2_type>,
+                    dvector_view<scalar_type>, dvector_view<scalar_type>,
+                    dvector_view<size_type>>;
+    using const_view_type = dmulti_view<
+        dvector_view<const geometry::barcode>, dvector_view<const point2_type>,
+        dvector_view<const scalar_type>, dvector_view<const scalar_type>,
+        dvector_view<const size_type>>;
+
+    /// Hit slots for @param n_tracks tracks with @param max_hits hits each in
+    /// the memory resource @param resource (host-side only)
+    template <typename allocator_t = vecmem::memory_resource,
+              std::enable_if_t<not detail::is_device_view_v<allocator_t>,
+                               bool> = true>
+    DETRAY_HOST hit_collection(allocator_t &resource, const size_type n_tracks,
+                               const size_type max_hits)
+        : m_barcodes(n_tracks * max_hits, &resource),
+          m_local(n_tracks * max_hits, &resource),
+          m_time(n_tracks * max_hits, &resource),
+          m_energy_deposit(n_tracks * max_hits, &resource),
+          m_n_hits(n_tracks, 0u, &resource) {}
+
+    /// Construct from the container @param view . Mainly used device-side.
+    template <typename collection_view_t,
+              std::enable_if_t<detail::is_device_view_v<collection_view_t>,
+                               bool> = true>
+    DETRAY_HOST_DEVICE explicit hit_collection(collection_view_t view)
+        : m_barcodes(detail::get<0>(view.m_view)),
+          m_local(detail::get<1>(view.m_view)),
+          m_time(detail::get<2>(view.m_view)),
+          m_energy_deposit(detail::get<3>(view.m_view)),
+          m_n_hits(detail::get<4>(view.m_view)) {}
+
+    /// @returns the number of tracks
+    DETRAY_HOST_DEVICE
+    size_type n_tracks() const {
+        return static_cast<size_type>(m_n_hits.size());
+    }
+
+    /// @returns the number of hit slots per track
+    DETRAY_HOST_DEVICE
+    size_type capacity() const {
+        return m_n_hits.empty() ? 0u
+                                : static_cast<size_type>(m_barcodes.size()) /
+                                      n_tracks();
+    }
+
+    /// @returns the number of hits of the track @param trk , including the
+    /// hits that did not fit into its slots
+    DETRAY_HOST_DEVICE
+    size_type n_hits(const size_type trk) const { return m_n_hits[trk]; }
+
+    /// @returns the number of recorded hits of the track @param trk
+    DETRAY_HOST_DEVICE
+    size_type size(const size_type trk) const {
+        return n_hits(trk) < capacity() ? n_hits(trk) : capacity();
+    }
+
+    /// @returns whether hits of the track @param trk were dropped
+    DETRAY_HOST_DEVICE
+    bool overflow(const size_type trk) const {
+        return n_hits(trk) > capacity();
+    }
+
+    /// @returns the hit @param i of the track @param trk
+    DETRAY_HOST_DEVICE
+    value_type at(const size_type trk, const size_type i) const {
+        assert(i < size(trk));
+        const size_type idx{trk * capacity() + i};
+
+        return {m_barcodes[idx], m_local[idx], m_time[idx],
+                m_energy_deposit[idx]};
+    }
+
+    /// Record the hit @param h of the track @param trk
+    ///
+    /// @returns false if the slots of the track are full (the hit is dropped)
+    DETRAY_HOST_DEVICE
+    bool push_back(const size_type trk, const value_type &h) {
+        const size_type i{m_n_hits[trk]++};
+        if (i >= capacity()) {
+            return false;
+        }
+        const size_type idx{trk * capacity() + i};
+
+        m_barcodes[idx] = h.barcode;
+        m_local[idx] = h.local;
+        m_time[idx] = h.time;
+        m_energy_deposit[idx] = h.energy_deposit;
+
+        return true;
+    }
+
+    /// Forget the hits of all tracks (host-side only)
+    DETRAY_HOST void clear() {
+        for (auto &n : m_n_hits) {
+            n = 0u;
+        }
+    }
+
+    /// @returns the view on the columns - non-const
+    DETRAY_HOST auto get_data() -> view_type {
+        return view_type{
+            detray::get_data(m_barcodes), detray::get_data(m_local),
+            detray::get_data(m_time), detray::get_data(m_energy_deposit),
+            detray::get_data(m_n_hits)};
+    }
+
+    /// @returns the view on the columns - const
+    DETRAY_HOST auto get_data() const -> const_view_type {
+        return const_view_type{
+            detray::get_data(m_barcodes), detray::get_data(m_local),
+            detray::get_data(m_time), detray::get_data(m_energy_deposit),
+            detray::get_data(m_n_hits)};
+    }
+
+    private:
+    /// Hit columns, @c capacity() slots per track
+    /// @{
+    container_t<geometry::barcode> m_barcodes;
+    container_t<point2_type> m_local;
+    container_t<scalar_type> m_time;
+    container_t<scalar_type> m_energy_deposit;
+    /// @}
+    /// Number of hits per track
+    container_t<size_type> m_n_hits;
+};
+
+}  // namespace detray
@@ -0,0 +1,92 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/propagator/base_actor.hpp"
+#include "detray/simulation/hit_collection.hpp"
+
+// Vecmem include(s).
+#include <vecmem/containers/device_vector.hpp>
+
+namespace detray {
+
+/// @brief Records the hits of a track on the sensitive surfaces.
+///
+/// Observes the @c random_scatterer : It is called after the material
+/// interaction of the track, from which it takes the particle mass and the
+/// deposited energy. The time of flight is accumulated along the path, using
+/// the velocity of the particle before the energy loss on the current
+/// surface (the steppers do not transport the time).
+template <typename algebra_t>
+struct hit_recorder : actor {
+
+    using scalar_type = dscalar<algebra_t>;
+    using hit_collection_type =
+        hit_collection<algebra_t, vecmem::device_vector>;
+    using hit_type = typename hit_collection_type::value_type;
+
+    struct state {
+
+        /// Record the hits of the track @param trk in the hit collection
+        /// @param hits_view , starting at time @param t0
+        DETRAY_HOST_DEVICE
+        state(typename hit_collection_type::view_type hits_view,
+              const unsigned int trk, const scalar_type t0 = 0.f)
+            : hits(hits_view), track_index{trk}, time{t0} {}
+
+        /// Where to record the hits
+        hit_collection_type hits;
+        /// The index of the track in the hit collection
+        unsigned int track_index{0u};
+        /// Time and path length of the last hit
+        scalar_type time{0.f};
+        scalar_type path_length{0.f};
+    };
+
+    /// Record a hit on a sensitive surface
+    ///
+    /// @param recorder_state where to record the hit
+    /// @param simulator_state state of the observed @c random_scatterer
+    /// @param prop_state state of the propagation
+    template <typename simulator_state_t, typename propagator_state_t>
+    DETRAY_HOST_DEVICE void operator()(
+        state &recorder_state, const simulator_state_t &simulator_state,
+        propagator_state_t &prop_state) const {
+
+        const auto &navigation = prop_state._navigation;
+
+        if (not navigation.is_on_sensitive()) {
+            return;
+        }
+
+        const auto &stepping = prop_state._stepping;
+        const auto &bound_params = stepping._bound_params;
+
+        // Velocity before the energy loss on this surface
+        const scalar_type m{simulator_state.mass};
+        const scalar_type p{bound_params.p()};
+        const scalar_type energy{math::sqrt(m * m + p * p) +
+                                 simulator_state.deposited_energy};
+        const scalar_type beta{math::sqrt(energy * energy - m * m) / energy};
+
+        const scalar_type path_length{math::abs(stepping._abs_path_length)};
+        recorder_state.time +=
+            (path_length - recorder_state.path_length) / beta;
+        recorder_state.path_length = path_length;
+
+        recorder_state.hits.push_back(
+            recorder_state.track_index,
+            hit_type{navigation.barcode(), bound_params.bound_local(),
+                     recorder_state.time, simulator_state.deposited_energy});
+    }
+};
+
+}  // namespace detray
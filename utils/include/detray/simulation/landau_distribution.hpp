@@ -9,6 +9,8 @@
 
 // Project include(s).
 #include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/simulation/philox_generator.hpp"
 
 // System include(s).
 #include <array>
@@ -40,20 +42,25 @@ class landau_distribution {
     ///
     /// Reference[1]: ROOT TRandom.cxx
     /// Reference[2]: ACTS LandauDistribution.cxx
+    ///
+    /// @note can be used in device code with the @c philox_generator
     template <typename generator_t>
-    scalar_type operator()(generator_t &generator, const scalar_type location,
-                           const scalar_type scale) const {
-        const auto z = std::uniform_real_distribution<scalar_type>()(generator);
+    DETRAY_HOST_DEVICE scalar_type operator()(generator_t &generator,
+                                              const scalar_type location,
+                                              const scalar_type scale) const {
+        const auto z = detail::uniform_random<scalar_type>(generator);
         // LANDAU quantile : algorithm from CERNLIB G110 ranlan
         // Converted by Rene Brun from CERNLIB routine ranlan(G110),
         // Moved and adapted to QuantFuncMathCore by B. List 29.4.2010
         return location + scale * quantile(z);
     }
 
-    private:
+    /// @returns the quantile of the standard Landau distribution at the
+    /// cumulative probability @param z
+    DETRAY_HOST_DEVICE
     scalar_type quantile(const scalar_type z) const {
 
-        static const double f[982] = {
+        static constexpr double f[982] = {
             0.,        0.,        0.,        0.,        0.,        -2.244733,
             -2.204365, -2.168163, -2.135219, -2.104898, -2.076740, -2.050397,
             -2.025605, -2.002150, -1.979866, -1.958612, -1.938275, -1.918760,
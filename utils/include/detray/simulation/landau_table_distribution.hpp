@@ -0,0 +1,291 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/simulation/landau_distribution.hpp"
+#include "detray/simulation/philox_generator.hpp"
+
+// System include(s).
+#include <limits>
+
+namespace detray {
+
+/// Landau distribution, sampled from a precomputed inverse-CDF table
+///
+/// Alternative to the @c landau_distribution , which evaluates the CERNLIB
+/// G110 quantile in double precision, with a different approximation in each
+/// of four ranges. Here, the quantile is instead interpolated linearly in a
+/// single precision table, which is evaluated from the G110 quantile. To
+/// keep the interpolation accurate in the upper tail, where the quantile
+/// diverges like 1/(1-z), the table holds the quantile multiplied by (1-z).
+/// This covers the cumulative probability range [0.007, 1) with one lookup
+/// and one division. Only the lower tail (z < 0.007, i.e. 0.7% of the
+/// samples) falls back to the G110 quantile.
+///
+/// The deviation from the G110 quantile is below 5e-4 in the core of the
+/// distribution and below 5e-4 relative in the upper tail.
+///
+/// @note can be used in device code with the @c philox_generator
+template <typename scalar_t>
+class landau_table_distribution {
+
+    public:
+    using scalar_type = scalar_t;
+
+    /// Generate a random number following a Landau distribution with
+    /// location parameter @param location and scale parameter @param scale
+    /// (see @c landau_distribution )
+    template <typename generator_t>
+    DETRAY_HOST_DEVICE scalar_type operator()(generator_t &generator,
+                                              const scalar_type location,
+                                              const scalar_type scale) const {
+        const auto z = detail::uniform_random<scalar_type>(generator);
+        return location + scale * quantile(z);
+    }
+
+    /// @returns the quantile of the standard Landau distribution at the
+    /// cumulative probability @param z
+    DETRAY_HOST_DEVICE
+    scalar_type quantile(const scalar_type z) const {
+
+        /// Lower edge of the table in the cumulative probability
+        constexpr float z_min{0.007f};
+        /// Number of table bins on [z_min, 1]
+        constexpr unsigned int n_bins{1024u};
+
+        /// The quantile times (1 - z) on n_bins + 1 equidistant points in z
+        static constexpr float h[n_bins + 1u] = {
+            -2.188934f, -2.151917f, -2.118025f, -2.086669f, -2.057415f,
+            -2.029936f, -2.003980f, -1.979343f, -1.955865f, -1.933413f,
+            -1.911875f, -1.891160f, -1.871188f, -1.851893f, -1.833215f,
+            -1.815105f, -1.797518f, -1.780414f, -1.763759f, -1.747521f,
+            -1.731675f, -1.716194f, -1.701056f, -1.686241f, -1.671730f,
+            -1.657507f, -1.643556f, -1.629862f, -1.616414f, -1.603199f,
+            -1.590206f, -1.577425f, -1.564847f, -1.552461f, -1.540261f,
+            -1.528239f, -1.516386f, -1.504698f, -1.493167f, -1.481787f,
+            -1.470554f, -1.459460f, -1.448503f, -1.437676f, -1.426976f,
+            -1.416399f, -1.405941f, -1.395596f, -1.385363f, -1.375238f,
+            -1.365218f, -1.355298f, -1.345477f, -1.335753f, -1.326121f,
+            -1.316580f, -1.307127f, -1.297760f, -1.288476f, -1.279273f,
+            -1.270151f, -1.261106f, -1.252136f, -1.243241f, -1.234416f,
+            -1.225664f, -1.216978f, -1.208362f, -1.199810f, -1.191324f,
+            -1.182899f, -1.174537f, -1.166235f, -1.157991f, -1.149806f,
+            -1.141677f, -1.133603f, -1.125584f, -1.117619f, -1.109705f,
+            -1.101843f, -1.094031f, -1.086269f, -1.078556f, -1.070890f,
+            -1.063271f, -1.055698f, -1.048170f, -1.040688f, -1.033249f,
+            -1.025853f, -1.018498f, -1.011186f, -1.003915f, -0.996684f,
+            -0.989493f, -0.982341f, -0.975226f, -0.968151f, -0.961113f,
+            -0.954111f, -0.947146f, -0.940218f, -0.933323f, -0.926464f,
+            -0.919639f, -0.912847f, -0.906089f, -0.899363f, -0.892670f,
+            -0.886008f, -0.879379f, -0.872780f, -0.866212f, -0.859674f,
+            -0.853166f, -0.846688f, -0.840238f, -0.833817f, -0.827425f,
+            -0.821061f, -0.814724f, -0.808415f, -0.802133f, -0.795878f,
+            -0.789649f, -0.783446f, -0.777269f, -0.771118f, -0.764992f,
+            -0.758891f, -0.752814f, -0.746762f, -0.740734f, -0.734731f,
+            -0.728751f, -0.722795f, -0.716861f, -0.710951f, -0.705063f,
+            -0.699197f, -0.693354f, -0.687533f, -0.681733f, -0.675956f,
+            -0.670199f, -0.664464f, -0.658749f, -0.653055f, -0.647381f,
+            -0.641728f, -0.636095f, -0.630482f, -0.624889f, -0.619316f,
+            -0.613762f, -0.608227f, -0.602711f, -0.597214f, -0.591736f,
+            -0.586276f, -0.580835f, -0.575412f, -0.570007f, -0.564620f,
+            -0.559251f, -0.553899f, -0.548566f, -0.543249f, -0.537950f,
+            -0.532668f, -0.527402f, -0.522154f, -0.516922f, -0.511706f,
+            -0.506507f, -0.501324f, -0.496158f, -0.491007f, -0.485873f,
+            -0.480754f, -0.475650f, -0.470563f, -0.465490f, -0.460433f,
+            -0.455391f, -0.450365f, -0.445353f, -0.440356f, -0.435374f,
+            -0.430407f, -0.425454f, -0.420515f, -0.415591f, -0.410682f,
+            -0.405786f, -0.400904f, -0.396037f, -0.391183f, -0.386343f,
+            -0.381517f, -0.376704f, -0.371905f, -0.367120f, -0.362348f,
+            -0.357589f, -0.352843f, -0.348110f, -0.343391f, -0.338684f,
+            -0.333990f, -0.329309f, -0.324640f, -0.319984f, -0.315341f,
+            -0.310710f, -0.306092f, -0.301485f, -0.296891f, -0.292310f,
+            -0.287740f, -0.283183f, -0.278637f, -0.274103f, -0.269582f,
+            -0.265071f, -0.260573f, -0.256086f, -0.251610f, -0.247147f,
+            -0.242694f, -0.238253f, -0.233823f, -0.229405f, -0.224998f,
+            -0.220602f, -0.216217f, -0.211843f, -0.207480f, -0.203128f,
+            -0.198786f, -0.194456f, -0.190136f, -0.185827f, -0.181529f,
+            -0.177241f, -0.172964f, -0.168697f, -0.164440f, -0.160194f,
+            -0.155958f, -0.151733f, -0.147518f, -0.143312f, -0.139118f,
+            -0.134933f, -0.130758f, -0.126593f, -0.122438f, -0.118293f,
+            -0.114158f, -0.110032f, -0.105917f, -0.101811f, -0.097715f,
+            -0.093628f, -0.089551f, -0.085484f, -0.081425f, -0.077377f,
+            -0.073338f, -0.069308f, -0.065288f, -0.061277f, -0.057275f,
+            -0.053282f, -0.049298f, -0.045324f, -0.041359f, -0.037403f,
+            -0.033456f, -0.029518f, -0.025589f, -0.021669f, -0.017758f,
+            -0.013855f, -0.009961f, -0.006077f, -0.002201f, 0.001666f,
+            0.005525f,  0.009375f,  0.013217f,  0.017049f,  0.020874f,
+            0.024689f,  0.028496f,  0.032294f,  0.036085f,  0.039867f,
+            0.043641f,  0.047406f,  0.051162f,  0.054911f,  0.058652f,
+            0.062384f,  0.066108f,  0.069823f,  0.073531f,  0.077231f,
+            0.080922f,  0.084605f,  0.088281f,  0.091948f,  0.095607f,
+            0.099259f,  0.102902f,  0.106538f,  0.110165f,  0.113785f,
+            0.117397f,  0.121001f,  0.124598f,  0.128187f,  0.131768f,
+            0.135341f,  0.138906f,  0.142465f,  0.146015f,  0.149557f,
+            0.153093f,  0.156620f,  0.160140f,  0.163653f,  0.167158f,
+            0.170656f,  0.174146f,  0.177629f,  0.181104f,  0.184572f,
+            0.188033f,  0.191486f,  0.194932f,  0.198370f,  0.201801f,
+            0.205226f,  0.208642f,  0.212052f,  0.215454f,  0.218850f,
+            0.222238f,  0.225619f,  0.228993f,  0.232359f,  0.235719f,
+            0.239071f,  0.242417f,  0.245755f,  0.249086f,  0.252411f,
+            0.255728f,  0.259039f,  0.262342f,  0.265639f,  0.268928f,
+            0.272212f,  0.275488f,  0.278757f,  0.282019f,  0.285275f,
+            0.288523f,  0.291765f,  0.295000f,  0.298228f,  0.301450f,
+            0.304665f,  0.307873f,  0.311074f,  0.314269f,  0.317457f,
+            0.320639f,  0.323813f,  0.326982f,  0.330143f,  0.333298f,
+            0.336446f,  0.339588f,  0.342723f,  0.345852f,  0.348974f,
+            0.352089f,  0.355199f,  0.358301f,  0.361397f,  0.364486f,
+            0.367570f,  0.370647f,  0.373717f,  0.376781f,  0.379839f,
+            0.382890f,  0.385935f,  0.388973f,  0.392006f,  0.395031f,
+            0.398051f,  0.401064f,  0.404071f,  0.407071f,  0.410066f,
+            0.413054f,  0.416036f,  0.419011f,  0.421980f,  0.424943f,
+            0.427900f,  0.430851f,  0.433795f,  0.436734f,  0.439665f,
+            0.442591f,  0.445511f,  0.448425f,  0.451332f,  0.454234f,
+            0.457129f,  0.460018f,  0.462901f,  0.465778f,  0.468649f,
+            0.471514f,  0.474373f,  0.477226f,  0.480072f,  0.482913f,
+            0.485748f,  0.488577f,  0.491400f,  0.494216f,  0.497027f,
+            0.499832f,  0.502631f,  0.505424f,  0.508211f,  0.510992f,
+            0.513767f,  0.516536f,  0.519299f,  0.522057f,  0.524808f,
+            0.527554f,  0.530293f,  0.533027f,  0.535755f,  0.538477f,
+            0.541193f,  0.543904f,  0.546608f,  0.549307f,  0.552000f,
+            0.554686f,  0.557368f,  0.560043f,  0.562713f,  0.565377f,
+            0.568035f,  0.570687f,  0.573334f,  0.575975f,  0.578610f,
+            0.581240f,  0.583863f,  0.586481f,  0.589093f,  0.591700f,
+            0.594300f,  0.596895f,  0.599485f,  0.602068f,  0.604646f,
+            0.607218f,  0.609785f,  0.612346f,  0.614901f,  0.617450f,
+            0.619994f,  0.622532f,  0.625064f,  0.627591f,  0.630112f,
+            0.632628f,  0.635138f,  0.637641f,  0.640140f,  0.642633f,
+            0.645120f,  0.647602f,  0.650079f,  0.652549f,  0.655014f,
+            0.657474f,  0.659928f,  0.662376f,  0.664819f,  0.667256f,
+            0.669688f,  0.672114f,  0.674534f,  0.676949f,  0.679359f,
+            0.681762f,  0.684161f,  0.686553f,  0.688940f,  0.691322f,
+            0.693698f,  0.696069f,  0.698433f,  0.700793f,  0.703147f,
+            0.705495f,  0.707838f,  0.710175f,  0.712507f,  0.714833f,
+            0.717154f,  0.719469f,  0.721779f,  0.724083f,  0.726382f,
+            0.728676f,  0.730964f,  0.733246f,  0.735524f,  0.737795f,
+            0.740061f,  0.742322f,  0.744577f,  0.746826f,  0.749071f,
+            0.751309f,  0.753542f,  0.755770f,  0.757992f,  0.760209f,
+            0.762421f,  0.764626f,  0.766827f,  0.769022f,  0.771211f,
+            0.773395f,  0.775574f,  0.777747f,  0.779914f,  0.782076f,
+            0.784233f,  0.786385f,  0.788530f,  0.790671f,  0.792805f,
+            0.794935f,  0.797059f,  0.799178f,  0.801291f,  0.803399f,
+            0.805502f,  0.807598f,  0.809690f,  0.811776f,  0.813857f,
+            0.815932f,  0.818002f,  0.820067f,  0.822125f,  0.824179f,
+            0.826227f,  0.828270f,  0.830307f,  0.832339f,  0.834365f,
+            0.836386f,  0.838401f,  0.840411f,  0.842416f,  0.844415f,
+            0.846408f,  0.848396f,  0.850379f,  0.852356f,  0.854328f,
+            0.856295f,  0.858256f,  0.860211f,  0.862161f,  0.864105f,
+            0.866045f,  0.867979f,  0.869907f,  0.871830f,  0.873748f,
+            0.875660f,  0.877567f,  0.879468f,  0.881364f,  0.883254f,
+            0.885139f,  0.887018f,  0.888892f,  0.890760f,  0.892623f,
+            0.894481f,  0.896333f,  0.898179f,  0.900020f,  0.901856f,
+            0.903685f,  0.905510f,  0.907329f,  0.909142f,  0.910951f,
+            0.912753f,  0.914550f,  0.916341f,  0.918127f,  0.919908f,
+            0.921683f,  0.923452f,  0.925216f,  0.926974f,  0.928728f,
+            0.930475f,  0.932218f,  0.933954f,  0.935686f,  0.937411f,
+            0.939131f,  0.940846f,  0.942555f,  0.944258f,  0.945956f,
+            0.947648f,  0.949334f,  0.951016f,  0.952691f,  0.954361f,
+            0.956025f,  0.957684f,  0.959337f,  0.960985f,  0.962627f,
+            0.964263f,  0.965894f,  0.967519f,  0.969139f,  0.970752f,
+            0.972361f,  0.973963f,  0.975560f,  0.977152f,  0.978737f,
+            0.980317f,  0.981892f,  0.983461f,  0.985024f,  0.986582f,
+            0.988135f,  0.989681f,  0.991222f,  0.992757f,  0.994286f,
+            0.995810f,  0.997328f,  0.998840f,  1.000347f,  1.001848f,
+            1.003343f,  1.004832f,  1.006316f,  1.007793f,  1.009266f,
+            1.010732f,  1.012192f,  1.013647f,  1.015096f,  1.016539f,
+            1.017976f,  1.019408f,  1.020833f,  1.022253f,  1.023667f,
+            1.025076f,  1.026478f,  1.027874f,  1.029265f,  1.030650f,
+            1.032029f,  1.033403f,  1.034771f,  1.036133f,  1.037489f,
+            1.038839f,  1.040183f,  1.041521f,  1.042853f,  1.044179f,
+            1.045500f,  1.046814f,  1.048123f,  1.049425f,  1.050722f,
+            1.052012f,  1.053297f,  1.054575f,  1.055847f,  1.057114f,
+            1.058374f,  1.059628f,  1.060876f,  1.062118f,  1.063354f,
+            1.064584f,  1.065808f,  1.067026f,  1.068237f,  1.069443f,
+            1.070642f,  1.071835f,  1.073022f,  1.074204f,  1.075379f,
+            1.076549f,  1.077712f,  1.078868f,  1.080019f,  1.081163f,
+            1.082301f,  1.083433f,  1.084559f,  1.085678f,  1.086791f,
+            1.087897f,  1.088998f,  1.090092f,  1.091179f,  1.092261f,
+            1.093336f,  1.094404f,  1.095466f,  1.096522f,  1.097571f,
+            1.098614f,  1.099650f,  1.100680f,  1.101704f,  1.102721f,
+            1.103731f,  1.104735f,  1.105732f,  1.106723f,  1.107708f,
+            1.108685f,  1.109658f,  1.110623f,  1.111582f,  1.112534f,
+            1.113480f,  1.114419f,  1.115351f,  1.116277f,  1.117196f,
+            1.118108f,  1.119013f,  1.119912f,  1.120804f,  1.121689f,
+            1.122567f,  1.123439f,  1.124304f,  1.125161f,  1.126012f,
+            1.126856f,  1.127693f,  1.128524f,  1.129347f,  1.130163f,
+            1.130972f,  1.131775f,  1.132570f,  1.133358f,  1.134139f,
+            1.134913f,  1.135680f,  1.136440f,  1.137193f,  1.137940f,
+            1.138680f,  1.139412f,  1.140138f,  1.140855f,  1.141566f,
+            1.142270f,  1.142966f,  1.143655f,  1.144337f,  1.145011f,
+            1.145678f,  1.146338f,  1.146990f,  1.147634f,  1.148271f,
+            1.148901f,  1.149523f,  1.150138f,  1.150745f,  1.151344f,
+            1.151936f,  1.152520f,  1.153096f,  1.153660f,  1.154222f,
+            1.154775f,  1.155321f,  1.155859f,  1.156390f,  1.156913f,
+            1.157427f,  1.157935f,  1.158434f,  1.158925f,  1.159408f,
+            1.159884f,  1.160351f,  1.160810f,  1.161261f,  1.161704f,
+            1.162139f,  1.162566f,  1.162985f,  1.163396f,  1.163798f,
+            1.164192f,  1.164578f,  1.164955f,  1.165324f,  1.165685f,
+            1.166037f,  1.166381f,  1.166716f,  1.167043f,  1.167361f,
+            1.167671f,  1.167972f,  1.168264f,  1.168548f,  1.168823f,
+            1.169089f,  1.169346f,  1.169594f,  1.169834f,  1.170064f,
+            1.170286f,  1.170499f,  1.170702f,  1.170897f,  1.171082f,
+            1.171258f,  1.171425f,  1.171583f,  1.171731f,  1.171870f,
+            1.172000f,  1.172120f,  1.172230f,  1.172332f,  1.172423f,
+            1.172505f,  1.172577f,  1.172640f,  1.172692f,  1.172735f,
+            1.172768f,  1.172791f,  1.172805f,  1.172808f,  1.172801f,
+            1.172784f,  1.172756f,  1.172719f,  1.172671f,  1.172612f,
+            1.172544f,  1.172464f,  1.172375f,  1.172274f,  1.172163f,
+            1.172042f,  1.171909f,  1.171766f,  1.171611f,  1.171446f,
+            1.171269f,  1.171082f,  1.170883f,  1.170673f,  1.170452f,
+            1.170219f,  1.169975f,  1.169719f,  1.169451f,  1.169172f,
+            1.168881f,  1.168578f,  1.168263f,  1.167936f,  1.167597f,
+            1.167246f,  1.166882f,  1.166506f,  1.166117f,  1.165716f,
+            1.165302f,  1.164876f,  1.164436f,  1.163984f,  1.163518f,
+            1.163039f,  1.162547f,  1.162042f,  1.161523f,  1.160990f,
+            1.160444f,  1.159884f,  1.159310f,  1.158721f,  1.158119f,
+            1.157502f,  1.156870f,  1.156224f,  1.155564f,  1.154888f,
+            1.154197f,  1.153491f,  1.152770f,  1.152033f,  1.151281f,
+            1.150513f,  1.149729f,  1.148928f,  1.148112f,  1.147279f,
+            1.146429f,  1.145562f,  1.144679f,  1.143778f,  1.142860f,
+            1.141924f,  1.140970f,  1.139998f,  1.139008f,  1.137999f,
+            1.136972f,  1.135925f,  1.134860f,  1.133774f,  1.132669f,
+            1.131544f,  1.130399f,  1.129233f,  1.128045f,  1.126837f,
+            1.125607f,  1.124355f,  1.123081f,  1.121784f,  1.120464f,
+            1.119120f,  1.117753f,  1.116361f,  1.114945f,  1.113503f,
+            1.112036f,  1.110542f,  1.109022f,  1.107475f,  1.105900f,
+            1.104296f,  1.102663f,  1.101001f,  1.099308f,  1.097584f,
+            1.095829f,  1.094040f,  1.092218f,  1.090361f,  1.088469f,
+            1.086540f,  1.084573f,  1.082567f,  1.080520f,  1.078432f,
+            1.076300f,  1.074123f,  1.071899f,  1.069627f,  1.067303f,
+            1.064930f,  1.062502f,  1.060014f,  1.057463f,  1.054845f,
+            1.052157f,  1.049394f,  1.046552f,  1.043624f,  1.040604f,
+            1.037484f,  1.034252f,  1.030896f,  1.027398f,  1.023732f,
+            1.019864f,  1.015741f,  1.011277f,  1.006315f,  1.000015f};
+
+        if (z < z_min) {
+            return landau_distribution<scalar_type>{}.quantile(z);
+        }
+        if (z >= 1) {
+            return std::numeric_limits<scalar_type>::max();
+        }
+
+        const float u{static_cast<float>(z - z_min) *
+                      (static_cast<float>(n_bins) / (1.f - z_min))};
+        // Guard against rounding at the upper edge
+        const unsigned int i{static_cast<unsigned int>(u) < n_bins
+                                 ? static_cast<unsigned int>(u)
+                                 : n_bins - 1u};
+        const float w{u - static_cast<float>(i)};
+        const float h_z{h[i] + w * (h[i + 1u] - h[i])};
+
+        return static_cast<scalar_type>(h_z) / (1 - z);
+    }
+};
+
+}  // namespace detray
@@ -0,0 +1,222 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/units.hpp"
+
+// System include(s).
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <type_traits>
+
+namespace detray {
+
+/// @brief Counter-based random number generator (Philox4x32-10)
+///
+/// Every block of four 32 bit random numbers is a bijection of a 128 bit
+/// counter under a 64 bit key [Salmon et al., SC'11]. The key is given by the
+/// seed (e.g. the event number) and the counter consists of the track number,
+/// the step number and the number of blocks that were drawn in the current
+/// step. Therefore, the random number stream of a track only depends on
+/// (event, track, step), and not on the order in which the tracks are
+/// processed by the threads. The generator state fits into a few registers
+/// and can be used in device code. It satisfies the
+/// @c UniformRandomBitGenerator requirements, so it can also be used with the
+/// distributions of the standard library on the host.
+class philox_generator {
+
+    public:
+    using result_type = std::uint32_t;
+    using counter_type = darray<std::uint32_t, 4>;
+    using key_type = darray<std::uint32_t, 2>;
+
+    /// Default generator: seed, track and step zero
+    constexpr philox_generator() = default;
+
+    /// Construct the generator for the track @param track of the event
+    /// @param seed at step @param step
+    DETRAY_HOST_DEVICE
+    constexpr philox_generator(const std::uint64_t seed,
+                               const std::uint64_t track = 0u,
+                               const std::uint32_t step = 0u)
+        : m_key{lo(seed), hi(seed)},
+          m_counter{0u, step, lo(track), hi(track)} {}
+
+    /// Smallest and largest value that can be generated
+    /// @{
+    DETRAY_HOST_DEVICE
+    static constexpr result_type min() {
+        return std::numeric_limits<result_type>::min();
+    }
+    DETRAY_HOST_DEVICE
+    static constexpr result_type max() {
+        return std::numeric_limits<result_type>::max();
+    }
+    /// @}
+
+    /// Set the seed (e.g. the event number) and restart the current step
+    DETRAY_HOST_DEVICE
+    constexpr void set_seed(const std::uint64_t seed) {
+        m_key = {lo(seed), hi(seed)};
+        restart();
+    }
+
+    /// Set the track number and restart the current step
+    DETRAY_HOST_DEVICE
+    constexpr void set_track(const std::uint64_t track) {
+        m_counter[2] = lo(track);
+        m_counter[3] = hi(track);
+        restart();
+    }
+
+    /// Set the step number and start drawing from its first block
+    DETRAY_HOST_DEVICE
+    constexpr void set_step(const std::uint32_t step) {
+        m_counter[1] = step;
+        restart();
+    }
+
+    /// @returns the current step number
+    DETRAY_HOST_DEVICE
+    constexpr std::uint32_t step() const { return m_counter[1]; }
+
+    /// Move to the stream of the next step
+    DETRAY_HOST_DEVICE
+    constexpr void next_step() { set_step(m_counter[1] + 1u); }
+
+    /// @returns the next 32 bit random number
+    DETRAY_HOST_DEVICE
+    constexpr result_type operator()() {
+        if (m_n_used == 4u) {
+            m_block = block(m_counter, m_key);
+            ++m_counter[0];
+            m_n_used = 0u;
+        }
+        return m_block[m_n_used++];
+    }
+
+    /// @returns a uniformly distributed random number in the open interval
+    /// (0, 1), with 23 (float) or 53 (double) random bits
+    template <typename scalar_t>
+    DETRAY_HOST_DEVICE constexpr scalar_t uniform() {
+        if constexpr (std::is_same_v<scalar_t, float>) {
+            return (static_cast<float>((*this)() >> 9) + 0.5f) *
+                   (1.f / 8388608.f);
+        } else {
+            // Draw the upper bits first to keep the stream well defined
+            const std::uint64_t upper{(*this)()};
+            const std::uint64_t bits{((upper << 32) | (*this)()) >> 11};
+            return static_cast<scalar_t>(
+                (static_cast<double>(bits) + 0.5) * (1. / 9007199254740992.));
+        }
+    }
+
+    /// @returns a normally distributed random number with mean @param mean
+    /// and standard deviation @param sigma (Box-Muller transform)
+    template <typename scalar_t>
+    DETRAY_HOST_DEVICE scalar_t normal(const scalar_t mean = 0.f,
+                                       const scalar_t sigma = 1.f) {
+        const scalar_t u1{uniform<scalar_t>()};
+        const scalar_t u2{uniform<scalar_t>()};
+
+        return mean + sigma * math::sqrt(-2.f * math::log(u1)) *
+                          math::cos(2.f * constant<scalar_t>::pi * u2);
+    }
+
+    /// @returns the block of random numbers for @param counter under the key
+    /// @param key (ten Philox rounds)
+    DETRAY_HOST_DEVICE
+    static constexpr counter_type block(counter_type counter, key_type key) {
+        for (unsigned int r = 0u; r < 10u; ++r) {
+            if (r > 0u) {
+                key[0] += weyl_0;
+                key[1] += weyl_1;
+            }
+            const std::uint64_t p0{static_cast<std::uint64_t>(mult_0) *
+                                   counter[0]};
+            const std::uint64_t p1{static_cast<std::uint64_t>(mult_1) *
+                                   counter[2]};
+            counter = {hi(p1) ^ counter[1] ^ key[0], lo(p1),
+                       hi(p0) ^ counter[3] ^ key[1], lo(p0)};
+        }
+        return counter;
+    }
+
+    private:
+    /// Philox multipliers and Weyl sequence for the key schedule
+    /// @{
+    static constexpr std::uint32_t mult_0{0xD2511F53u};
+    static constexpr std::uint32_t mult_1{0xCD9E8D57u};
+    static constexpr std::uint32_t weyl_0{0x9E3779B9u};
+    static constexpr std::uint32_t weyl_1{0xBB67AE85u};
+    /// @}
+
+    /// Lower and upper 32 bits of @param v
+    /// @{
+    DETRAY_HOST_DEVICE
+    static constexpr std::uint32_t lo(const std::uint64_t v) {
+        return static_cast<std::uint32_t>(v);
+    }
+    DETRAY_HOST_DEVICE
+    static constexpr std::uint32_t hi(const std::uint64_t v) {
+        return static_cast<std::uint32_t>(v >> 32);
+    }
+    /// @}
+
+    /// Start drawing from the first block of the current step
+    DETRAY_HOST_DEVICE
+    constexpr void restart() {
+        m_counter[0] = 0u;
+        m_n_used = 4u;
+    }
+
+    /// Key: seed
+    key_type m_key{0u, 0u};
+    /// Counter: block, step, track (lower and upper bits)
+    counter_type m_counter{0u, 0u, 0u, 0u};
+    /// Current block of random numbers and how many of them were used
+    counter_type m_block{0u, 0u, 0u, 0u};
+    unsigned int m_n_used{4u};
+};
+
+namespace detail {
+
+/// @returns a uniformly distributed random number in [@param min, @param max)
+/// from @param generator
+template <typename scalar_t, typename generator_t>
+DETRAY_HOST_DEVICE inline scalar_t uniform_random(generator_t &generator,
+                                                  const scalar_t min = 0.f,
+                                                  const scalar_t max = 1.f) {
+    if constexpr (std::is_same_v<generator_t, philox_generator>) {
+        return min + (max - min) * generator.template uniform<scalar_t>();
+    } else {
+        return std::uniform_real_distribution<scalar_t>(min, max)(generator);
+    }
+}
+
+/// @returns a normally distributed random number with mean @param mean and
+/// standard deviation @param sigma from @param generator
+template <typename scalar_t, typename generator_t>
+DETRAY_HOST_DEVICE inline scalar_t normal_random(generator_t &generator,
+                                                 const scalar_t mean,
+                                                 const scalar_t sigma) {
+    if constexpr (std::is_same_v<generator_t, philox_generator>) {
+        return generator.template normal<scalar_t>(mean, sigma);
+    } else {
+        return std::normal_distribution<scalar_t>(mean, sigma)(generator);
+    }
+}
+
+}  // namespace detail
+
+}  // namespace detray
@@ -15,6 +15,7 @@
 #include "detray/materials/interaction.hpp"
 #include "detray/propagator/base_actor.hpp"
 #include "detray/simulation/landau_distribution.hpp"
+#include "detray/simulation/philox_generator.hpp"
 #include "detray/simulation/scattering_helper.hpp"
 #include "detray/tracks/bound_track_parameters.hpp"
 #include "detray/utils/axis_rotation.hpp"
@@ -22,11 +23,15 @@
 #include "detray/utils/unit_vectors.hpp"
 
 // System include(s).
-#include <random>
+#include <cstdint>
 
 namespace detray {
 
-template <typename algebra_t>
+/// @tparam algebra_t the algebra type
+/// @tparam landau_t the sampler of the energy loss, e.g. the
+///                  @c landau_table_distribution for fast simulation
+template <typename algebra_t,
+          typename landau_t = landau_distribution<dscalar<algebra_t>>>
 struct random_scatterer : actor {
 
     using scalar_type = dscalar<algebra_t>;
@@ -36,8 +41,9 @@ struct random_scatterer : actor {
     using interaction_type = interaction<scalar_type>;
 
     struct state {
-        std::random_device rd{};
-        std::mt19937_64 generator{rd()};
+        /// Counter-based random number generator: The stream is given by the
+        /// seed and the track number and moves on with every interaction
+        philox_generator generator{};
 
         /// The particle mass
         scalar_type mass{105.7f * unit<scalar_type>::MeV};
@@ -54,16 +60,28 @@ struct random_scatterer : actor {
         /// projected scattering angle
         scalar_type projected_scattering_angle = 0.f;
 
+        /// energy that was lost in the last interaction
+        scalar_type deposited_energy = 0.f;
+
         // Simulation setup
         bool do_energy_loss = true;
         bool do_multiple_scattering = true;
 
         /// Constructor with seed
         ///
-        /// @param sd the seed number
-        state(const uint_fast64_t sd = 0u) { generator.seed(sd); }
-
-        void set_seed(const uint_fast64_t sd) { generator.seed(sd); }
+        /// @param sd the seed number (e.g. the event number)
+        /// @param track the track number in the event
+        DETRAY_HOST_DEVICE
+        state(const std::uint64_t sd = 0u, const std::uint64_t track = 0u)
+            : generator{sd, track} {}
+
+        DETRAY_HOST_DEVICE
+        void set_seed(const std::uint64_t sd) { generator.set_seed(sd); }
+
+        DETRAY_HOST_DEVICE
+        void set_track(const std::uint64_t track) {
+            generator.set_track(track);
+        }
     };
 
     /// Material store visitor
@@ -135,8 +153,8 @@ struct random_scatterer : actor {
     };
 
     template <typename propagator_state_t>
-    DETRAY_HOST inline void operator()(state& simulator_state,
-                                       propagator_state_t& prop_state) const {
+    DETRAY_HOST_DEVICE inline void operator()(
+        state& simulator_state, propagator_state_t& prop_state) const {
 
         auto& navigation = prop_state._navigation;
 
@@ -149,13 +167,37 @@ struct random_scatterer : actor {
         const auto& is = *navigation.current();
         const auto sf = navigation.get_surface();
 
-        sf.template visit_material<kernel>(simulator_state, bound_params,
-                                           is.cos_incidence_angle, is.local[0]);
+        // No interaction, unless the surface material says otherwise
+        simulator_state.e_loss_mpv = 0.f;
+        simulator_state.e_loss_sigma = 0.f;
+        simulator_state.projected_scattering_angle = 0.f;
+        simulator_state.deposited_energy = 0.f;
+
+        if (!sf.has_material()) {
+            return;
+        }
+        const scalar_type cos_inc{
+            navigation.cos_incidence_angle(bound_params.dir())};
+        if (!sf.template visit_material<kernel>(simulator_state, bound_params,
+                                                cos_inc, is.local[0])) {
+            return;
+        }
+
+        // Draw the random numbers of this interaction from a new stream, so
+        // that the following interactions do not depend on how many numbers
+        // were drawn here
+        simulator_state.generator.next_step();
 
         // Get the new momentum
-        const auto new_mom = attenuate(
-            simulator_state.e_loss_mpv, simulator_state.e_loss_sigma,
-            simulator_state.mass, bound_params.p(), simulator_state.generator);
+        const scalar_type mass{simulator_state.mass};
+        const scalar_type p0{bound_params.p()};
+        const auto new_mom =
+            attenuate(simulator_state.e_loss_mpv, simulator_state.e_loss_sigma,
+                      mass, p0, simulator_state.generator);
+
+        simulator_state.deposited_energy =
+            math::sqrt(mass * mass + p0 * p0) -
+            math::sqrt(mass * mass + new_mom * new_mom);
 
         // Update Qop
         bound_params.set_qop(bound_params.charge() / new_mom);
@@ -178,16 +220,13 @@ struct random_scatterer : actor {
 
     /// @brief Get the new momentum from the landau distribution
     template <typename generator_t>
-    DETRAY_HOST inline scalar_type attenuate(const scalar_type mpv,
-                                             const scalar_type sigma,
-                                             const scalar_type m0,
-                                             const scalar_type p0,
-                                             generator_t& generator) const {
+    DETRAY_HOST_DEVICE inline scalar_type attenuate(
+        const scalar_type mpv, const scalar_type sigma, const scalar_type m0,
+        const scalar_type p0, generator_t& generator) const {
 
         // Get the random energy loss
         // @todo tune the scale parameters (e_loss_mpv and e_loss_sigma)
-        const auto e_loss =
-            landau_distribution<scalar_type>{}(generator, mpv, sigma);
+        const auto e_loss = landau_t{}(generator, mpv, sigma);
 
         // E = sqrt(m^2 + p^2)
         const auto energy = math::sqrt(m0 * m0 + p0 * p0);
@@ -211,7 +250,7 @@ struct random_scatterer : actor {
     /// @param generator random generator
     /// @returns the new direction from random scattering
     template <typename generator_t>
-    DETRAY_HOST inline vector3_type scatter(
+    DETRAY_HOST_DEVICE inline vector3_type scatter(
         const vector3_type& dir, const scalar_type projected_scattering_angle,
         generator_t& generator) const {
 
@@ -11,6 +11,7 @@
 #include "detray/definitions/detail/algebra.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/definitions/units.hpp"
+#include "detray/simulation/philox_generator.hpp"
 #include "detray/utils/axis_rotation.hpp"
 #include "detray/utils/unit_vectors.hpp"
 
@@ -30,18 +31,18 @@ struct scattering_helper {
     ///
     /// @param dir  input direction
     /// @param angle  scattering angle
-    /// @param generator random generator
+    /// @param generator random generator (@c philox_generator in device code)
     /// @returns the new direction from random scattering
     template <typename generator_t>
-    DETRAY_HOST inline vector3_type operator()(const vector3_type& dir,
-                                               const scalar_type angle,
-                                               generator_t& generator) const {
+    DETRAY_HOST_DEVICE inline vector3_type operator()(
+        const vector3_type& dir, const scalar_type angle,
+        generator_t& generator) const {
 
         // Generate theta and phi for random scattering
         const scalar_type r_theta{
-            std::normal_distribution<scalar_type>(0.f, angle)(generator)};
-        const scalar_type r_phi{std::uniform_real_distribution<scalar_type>(
-            -constant<scalar_type>::pi, constant<scalar_type>::pi)(generator)};
+            detail::normal_random<scalar_type>(generator, 0.f, angle)};
+        const scalar_type r_phi{detail::uniform_random<scalar_type>(
+            generator, -constant<scalar_type>::pi, constant<scalar_type>::pi)};
 
         // xaxis of curvilinear plane
         const vector3_type u =